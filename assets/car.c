@@ -1,843 +1,844 @@
 // Generated by png2bitmap_rgb565_c_h_pragonce.py
+#include <stddef.h>
 #include <stdint.h>
 #include "car.h"
 
 // 100x100, RGB565 format
 static const uint16_t car_100x100_pixels[10000] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad55, 0xffff, 
-  0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xad55, 0xe71d, 0xef7e, 0xf79e, 
-  0xf79e, 0xf7bf, 0xf7df, 0xf7bf, 0xf7df, 0xf79e, 0xe73d, 0xdefb, 0x9cd3, 0x0000, 0x0000, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xad55, 0x0000, 0xef7d, 
-  0xf7bf, 0xf7bf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7df, 0xf79e, 
-  0xef7e, 0xe71d, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0x0000, 0xef7e, 0xf7df, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffdf, 0xffdf, 
-  0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xf79f, 0xef3d, 0xbdfa, 0x0000, 0xffff, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xffdf, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffff, 0xf7bf, 0xffff, 0xf79e, 
-  0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xffdf, 0xffff, 0xffdf, 0xffdf, 
-  0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffdf, 0xffff, 0xffdf, 0xf79e, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffff, 0xffff, 0x0000, 0xffff, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0xffff, 0x0000, 0xf7bf, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 
-  0xffdf, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xffdf, 0xffff, 0xffdf, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffff, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xffff, 0xffdf, 
-  0xffff, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffdf, 0x0000, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0x0000, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 
-  0xffff, 0xffdf, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xffdf, 0xffdf, 0xffff, 0xffdf, 0xffdf, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffdf, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xffdf, 0xffdf, 
-  0xffff, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffdf, 0x0000, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0x0000, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 
-  0xffff, 0xffff, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffdf, 0xffdf, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffdf, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffdf, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xef5f, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7bf, 0xef5d, 0xe71c, 0xdedb, 0xd6ba, 0xd6ba, 0xdedb, 
-  0xdefc, 0xe73d, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0x0000, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0x0000, 0xffff, 0xffdf, 0xffff, 0xe73d, 0xb596, 0x8c51, 0x634d, 0x4a6a, 0x4a49, 0x4229, 
-  0x4228, 0x4208, 0x4228, 0x4229, 0x4229, 0x4a49, 0x528a, 0x6b4d, 0x8410, 0xb596, 0xef5d, 0xffff, 
-  0xffff, 0xffdf, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xad55, 0xffff, 0xad75, 0x4228, 0x4208, 0x4a69, 
-  0x5aec, 0x632d, 0x6b6e, 0x738e, 0x7bcf, 0x7bef, 0x7bcf, 0x7bcf, 0x73cf, 0x738e, 0x6b6e, 0x5b0c, 
-  0x4a6a, 0x4a69, 0x528a, 0xa534, 0xffff, 0xf7bf, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xffff, 0xf7bf, 
-  0x8430, 0x6b4d, 0x8431, 0x8431, 0x8431, 0x8451, 0x8431, 0x8430, 0x8410, 0x8410, 0x8410, 0x8430, 
-  0x8430, 0x8430, 0x8430, 0x8431, 0x8c51, 0x8431, 0x6b4d, 0x8c51, 0xffff, 0xf7be, 0x0000, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0x0000, 0xbdf7, 0xffff, 0xc618, 0x7bcf, 0x8410, 0x7bf0, 0x7c10, 0x7c10, 0x8410, 0x8410, 
-  0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7c10, 0x7c10, 0x7c10, 0x7c10, 0x8430, 0x73ae, 0xbdf7, 
-  0xffff, 0xef7d, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xce59, 0xffff, 0xd6ba, 0x7bef, 0x8410, 0x8410, 
-  0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 
-  0x7c10, 0x8430, 0x7bef, 0xce79, 0xf7be, 0xf7be, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xf79e, 0xef5d, 
-  0xce59, 0x9cd3, 0x7bcf, 0x8430, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 
-  0x8410, 0x8410, 0x8410, 0x8410, 0x8431, 0x7bcf, 0x9cf4, 0xce59, 0xdedb, 0xffff, 0x0000, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0x0000, 0xf79e, 0xef7e, 0xad55, 0xce59, 0x73af, 0x7bcf, 0x7bcf, 0x73cf, 0x73af, 0x73af, 
-  0x73cf, 0x73af, 0x7bcf, 0x7bcf, 0x73af, 0x73af, 0x7bcf, 0x73cf, 0x73cf, 0x73af, 0xdedb, 0xad55, 
-  0xdefb, 0xffff, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xd6ba, 0xef5d, 0x9cd3, 0xe71c, 0xc618, 0x9cf4, 
-  0xad55, 0xad75, 0xb596, 0xbdf7, 0xc618, 0xbe18, 0xc618, 0xc618, 0xbdd7, 0xb5b6, 0xb596, 0xad75, 
-  0xa514, 0xc638, 0xf7be, 0x8c71, 0xe73c, 0xffdf, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xe73c, 0xf7be, 
-  0x9492, 0xce59, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73d, 0x8410, 0xe73c, 0xf7be, 0x0000, 0xad55, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0x0000, 0xe73c, 0xf7be, 0x8c71, 0xbdf8, 0xffff, 0xf7bf, 0xd6ba, 0xbdf8, 0xad55, 0x94b2, 
-  0x8410, 0x7bcf, 0x7bcf, 0x7bf0, 0x8c71, 0x9cf4, 0xbdd7, 0xce79, 0xef7e, 0xffff, 0xdedb, 0x7bf0, 
-  0xe73c, 0xf7bf, 0x0000, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xd6bc, 0xf7be, 0x8c72, 0xb5b7, 0xffff, 0x8451, 
-  0x39e8, 0x39e8, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39c7, 0x31a7, 
-  0x6b4d, 0xf7be, 0xdedb, 0x7bcf, 0xe73c, 0xffff, 0x0000, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xe71c, 0xf7bf, 
-  0x8c72, 0xbdd7, 0xffff, 0x4a69, 0x4228, 0x4a49, 0x4229, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 
-  0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x39c7, 0xd69a, 0xe73c, 0x7bcf, 0xe73d, 0xf7be, 0x0000, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0x0000, 0xd6bc, 0xf7bf, 0x8c72, 0xbdd7, 0xffff, 0x528a, 0x4208, 0x4229, 0x4229, 0x4229, 
-  0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4249, 0x4249, 0x4229, 0x4208, 0xd69a, 0xe73c, 0x7bcf, 
-  0xef5d, 0xf79e, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xd6bc, 0xf7bf, 0x8c72, 0xbdd7, 0xffff, 0x4a6a, 
-  0x4208, 0x4a49, 0x4229, 0x4229, 0x4229, 0x4229, 0x4249, 0x4249, 0x4249, 0x4229, 0x4a49, 0x4249, 
-  0x39e8, 0xd69a, 0xe73c, 0x738e, 0xef7d, 0xf79e, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xef5d, 0xf7be, 
-  0x9492, 0xb596, 0xffff, 0x528b, 0x4208, 0x4249, 0x4249, 0x4229, 0x4249, 0x4229, 0x4229, 0x4229, 
-  0x4229, 0x4229, 0x4a49, 0x4a49, 0x4208, 0xd69a, 0xe71c, 0x73ae, 0xf79e, 0xef7e, 0x0000, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0x0000, 0xdedb, 0xf7be, 0x9492, 0xb596, 0xffff, 0x4a6a, 0x4208, 0x4229, 0x4229, 0x4229, 
-  0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4209, 0x31c7, 0xd69a, 0xdefb, 0x738e, 
-  0xf79e, 0xf7be, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xd6ba, 0xffdf, 0xc618, 0xbdf7, 0xffff, 0x8c72, 
-  0x4229, 0x4a49, 0x4a4a, 0x4a6a, 0x4a6a, 0x4a6a, 0x4a4a, 0x4a4a, 0x4a4a, 0x4a49, 0x4a6a, 0x4229, 
-  0x6b6e, 0xf7be, 0xdefb, 0xad76, 0xffdf, 0xf79e, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xe71c, 0xffdf, 
-  0xa514, 0xc638, 0xffff, 0xffdf, 0xe73d, 0xe71c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 
-  0xe73c, 0xe73d, 0xe73d, 0xe73d, 0xffdf, 0xffff, 0xe71c, 0x8c51, 0xef7e, 0xef7e, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0x0000, 0xe73e, 0xffff, 0x8c72, 0xa535, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd6ba, 0x738e, 
-  0xf79e, 0xef7d, 0x0000, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xef5c, 0xffdf, 0x9492, 0xad75, 0xffff, 0xffdf, 
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 
-  0xffdf, 0xffff, 0xd6bb, 0x7bcf, 0xf79e, 0xf7be, 0x0000, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0x0000, 0xe71c, 0xffdf, 
-  0x9492, 0xad55, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xdedb, 0x73af, 0xf79e, 0xf79e, 0x0000, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0x0000, 0xe73d, 0xffdf, 0x9492, 0xad75, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xdedb, 0x73af, 
-  0xef7e, 0xef5d, 0x8c51, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xe71c, 0xffdf, 0x9492, 0xad76, 0xffff, 0xffdf, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffdf, 0xffff, 0xdedb, 0x73af, 0xef7e, 0xef7d, 0xa534, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xdefc, 0xffdf, 
-  0x9492, 0xad75, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xdedb, 0x738e, 0xf79e, 0xef7e, 0xd6ba, 0x0000, 
-  0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0x0000, 0xef7d, 0xf7bf, 0x9492, 0xc618, 0xffff, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffff, 0xef5d, 0x8c51, 
-  0xef5d, 0xf7be, 0xe73c, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xf7be, 0xf7bf, 0xbdf8, 0xce59, 0xffff, 0xffdf, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffdf, 
-  0xf7bf, 0xffdf, 0xe71c, 0xad76, 0xf7be, 0xf79e, 0xc619, 0x0000, 0x7bef, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xf7bf, 0xffff, 
-  0x9cd3, 0xbdf7, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 
-  0xffdf, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xe73c, 0x8410, 0xef7d, 0xffdf, 0xce7a, 0x0000, 
-  0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0x0000, 0xf7bf, 0xffdf, 0x8c72, 0xd69a, 0xbdd7, 0xbdf8, 0xef7e, 0xffdf, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xef7d, 0xc639, 0xb5b6, 0xf7bf, 0x8c51, 
-  0xe73c, 0xffff, 0xe71c, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xffff, 0xf7be, 0xad55, 0xe71c, 0x8410, 0x73cf, 
-  0x8431, 0x9cf3, 0xb5d7, 0xc618, 0xd69a, 0xdefb, 0xdedb, 0xd69a, 0xc618, 0xb5b6, 0x9cd3, 0x8410, 
-  0x7bef, 0x8410, 0xf79e, 0xb5b6, 0xe71c, 0xffff, 0xe71c, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 
-  0xf79e, 0xe6fc, 0x7bf0, 0x8410, 0x7bef, 0x7bcf, 0x73af, 0x73cf, 0x7bcf, 0x7bcf, 0x7bef, 0x7bef, 
-  0x7bcf, 0x73af, 0x7bcf, 0x7bf0, 0x8430, 0x7bef, 0xdedb, 0xffdf, 0xffdf, 0xffdf, 0xef5e, 0x0000, 
-  0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0xffff, 0x0000, 0xf7bf, 0xffff, 0xc638, 0x6b8e, 0x8451, 0x8431, 0x8410, 0x8410, 0x8410, 
-  0x8410, 0x8410, 0x8410, 0x7c10, 0x8430, 0x8431, 0x8430, 0x8430, 0x8431, 0x6b6e, 0xbdf7, 0xffff, 
-  0xffff, 0xffdf, 0xd69c, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0x0000, 0xf79e, 0xffff, 0xa514, 0x39c7, 0x5aec, 
-  0x738e, 0x7bef, 0x8430, 0x8410, 0x8410, 0x8430, 0x8410, 0x7c10, 0x8430, 0x8410, 0x7bf0, 0x738e, 
-  0x5aec, 0x39e7, 0x9cf3, 0xffff, 0xffff, 0xffdf, 0xad55, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xf79e, 
-  0xffff, 0x8c71, 0x39c7, 0x4a49, 0x4229, 0x4a49, 0x52ab, 0x5aec, 0x634d, 0x6b6e, 0x6b6d, 0x632c, 
-  0x5aeb, 0x52aa, 0x4a69, 0x4228, 0x4249, 0x39c7, 0x8431, 0xffff, 0xffff, 0xffdf, 0x7bef, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0xffff, 0x0000, 0xffdf, 0xffff, 0xbdd7, 0x39e7, 0x39c7, 0x4229, 0x4229, 0x4229, 0x4229, 
-  0x4228, 0x4228, 0x4228, 0x4229, 0x4a49, 0x4228, 0x4229, 0x4228, 0x39c7, 0x39e7, 0xb5b6, 0xffdf, 
-  0xffff, 0xffff, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xf7be, 0xffff, 0xffdf, 0xdedb, 0x8c72, 
-  0x528a, 0x39e8, 0x39c7, 0x39c7, 0x39c7, 0x39e8, 0x39e8, 0x39e7, 0x39c7, 0x39e8, 0x39e7, 0x52cb, 
-  0x8c71, 0xd6bb, 0xffff, 0xf7bf, 0xffdf, 0xffff, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xffdf, 
-  0xffff, 0xffdf, 0xffff, 0xffff, 0xf79e, 0xce79, 0xa535, 0x8410, 0x738e, 0x6b6d, 0x632d, 0x73af, 
-  0x8430, 0xa514, 0xce79, 0xf79e, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xf7bf, 0x0000, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0xffff, 0x0000, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xf7bf, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffff, 
-  0xffff, 0xf7be, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xffdf, 0xffff, 0xffdf, 0xffdf, 0xffdf, 
-  0xffdf, 0xf7df, 0xffdf, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffdf, 0xf7df, 0xffdf, 0xf7bf, 0xf7bf, 
-  0xffff, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xf79f, 
-  0xffdf, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xf7bf, 0x0000, 0xffff, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0xffff, 0x0000, 0x8c54, 0xef5d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffdf, 
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 
-  0xce7b, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0x8c72, 0xdefc, 0xffdf, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xf7bf, 0xf7be, 0xd6bb, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xe71c, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffdf, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
-  0xffdf, 0xffdf, 0xffdf, 0xf7df, 0xffff, 0xef7d, 0x0000, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x52aa, 0xdedc, 0xe75d, 
-  0xe71c, 0xdf1c, 0xe71c, 0xe73c, 0xe73c, 0xdefb, 0x7bef, 0x0000, 0x0000, 0x0000, 0xffff, 0x7bef, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 
-  0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 
-  0xad5f, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x7bef, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0x7bef, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xad55), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xad55), BITMAP_PX(0xe71d), BITMAP_PX(0xef7e), BITMAP_PX(0xf79e), 
+  BITMAP_PX(0xf79e), BITMAP_PX(0xf7bf), BITMAP_PX(0xf7df), BITMAP_PX(0xf7bf), BITMAP_PX(0xf7df), BITMAP_PX(0xf79e), BITMAP_PX(0xe73d), BITMAP_PX(0xdefb), BITMAP_PX(0x9cd3), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xad55), BITMAP_PX(0x0000), BITMAP_PX(0xef7d), 
+  BITMAP_PX(0xf7bf), BITMAP_PX(0xf7bf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xf7df), BITMAP_PX(0xf79e), 
+  BITMAP_PX(0xef7e), BITMAP_PX(0xe71d), BITMAP_PX(0xbdf7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xef7e), BITMAP_PX(0xf7df), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xf79f), BITMAP_PX(0xef3d), BITMAP_PX(0xbdfa), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xf7bf), BITMAP_PX(0xffff), BITMAP_PX(0xf79e), 
+  BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xf79e), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xf7bf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffdf), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0x0000), BITMAP_PX(0xffff), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0x0000), BITMAP_PX(0xffff), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xef5f), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xf7bf), BITMAP_PX(0xef5d), BITMAP_PX(0xe71c), BITMAP_PX(0xdedb), BITMAP_PX(0xd6ba), BITMAP_PX(0xd6ba), BITMAP_PX(0xdedb), 
+  BITMAP_PX(0xdefc), BITMAP_PX(0xe73d), BITMAP_PX(0xf79e), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xe73d), BITMAP_PX(0xb596), BITMAP_PX(0x8c51), BITMAP_PX(0x634d), BITMAP_PX(0x4a6a), BITMAP_PX(0x4a49), BITMAP_PX(0x4229), 
+  BITMAP_PX(0x4228), BITMAP_PX(0x4208), BITMAP_PX(0x4228), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4a49), BITMAP_PX(0x528a), BITMAP_PX(0x6b4d), BITMAP_PX(0x8410), BITMAP_PX(0xb596), BITMAP_PX(0xef5d), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xad55), BITMAP_PX(0xffff), BITMAP_PX(0xad75), BITMAP_PX(0x4228), BITMAP_PX(0x4208), BITMAP_PX(0x4a69), 
+  BITMAP_PX(0x5aec), BITMAP_PX(0x632d), BITMAP_PX(0x6b6e), BITMAP_PX(0x738e), BITMAP_PX(0x7bcf), BITMAP_PX(0x7bef), BITMAP_PX(0x7bcf), BITMAP_PX(0x7bcf), BITMAP_PX(0x73cf), BITMAP_PX(0x738e), BITMAP_PX(0x6b6e), BITMAP_PX(0x5b0c), 
+  BITMAP_PX(0x4a6a), BITMAP_PX(0x4a69), BITMAP_PX(0x528a), BITMAP_PX(0xa534), BITMAP_PX(0xffff), BITMAP_PX(0xf7bf), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xf7bf), 
+  BITMAP_PX(0x8430), BITMAP_PX(0x6b4d), BITMAP_PX(0x8431), BITMAP_PX(0x8431), BITMAP_PX(0x8431), BITMAP_PX(0x8451), BITMAP_PX(0x8431), BITMAP_PX(0x8430), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8430), 
+  BITMAP_PX(0x8430), BITMAP_PX(0x8430), BITMAP_PX(0x8430), BITMAP_PX(0x8431), BITMAP_PX(0x8c51), BITMAP_PX(0x8431), BITMAP_PX(0x6b4d), BITMAP_PX(0x8c51), BITMAP_PX(0xffff), BITMAP_PX(0xf7be), BITMAP_PX(0x0000), BITMAP_PX(0xffff), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xbdf7), BITMAP_PX(0xffff), BITMAP_PX(0xc618), BITMAP_PX(0x7bcf), BITMAP_PX(0x8410), BITMAP_PX(0x7bf0), BITMAP_PX(0x7c10), BITMAP_PX(0x7c10), BITMAP_PX(0x8410), BITMAP_PX(0x8410), 
+  BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x7c10), BITMAP_PX(0x7c10), BITMAP_PX(0x7c10), BITMAP_PX(0x7c10), BITMAP_PX(0x8430), BITMAP_PX(0x73ae), BITMAP_PX(0xbdf7), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xef7d), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xce59), BITMAP_PX(0xffff), BITMAP_PX(0xd6ba), BITMAP_PX(0x7bef), BITMAP_PX(0x8410), BITMAP_PX(0x8410), 
+  BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), 
+  BITMAP_PX(0x7c10), BITMAP_PX(0x8430), BITMAP_PX(0x7bef), BITMAP_PX(0xce79), BITMAP_PX(0xf7be), BITMAP_PX(0xf7be), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xf79e), BITMAP_PX(0xef5d), 
+  BITMAP_PX(0xce59), BITMAP_PX(0x9cd3), BITMAP_PX(0x7bcf), BITMAP_PX(0x8430), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), 
+  BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8431), BITMAP_PX(0x7bcf), BITMAP_PX(0x9cf4), BITMAP_PX(0xce59), BITMAP_PX(0xdedb), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xf79e), BITMAP_PX(0xef7e), BITMAP_PX(0xad55), BITMAP_PX(0xce59), BITMAP_PX(0x73af), BITMAP_PX(0x7bcf), BITMAP_PX(0x7bcf), BITMAP_PX(0x73cf), BITMAP_PX(0x73af), BITMAP_PX(0x73af), 
+  BITMAP_PX(0x73cf), BITMAP_PX(0x73af), BITMAP_PX(0x7bcf), BITMAP_PX(0x7bcf), BITMAP_PX(0x73af), BITMAP_PX(0x73af), BITMAP_PX(0x7bcf), BITMAP_PX(0x73cf), BITMAP_PX(0x73cf), BITMAP_PX(0x73af), BITMAP_PX(0xdedb), BITMAP_PX(0xad55), 
+  BITMAP_PX(0xdefb), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xd6ba), BITMAP_PX(0xef5d), BITMAP_PX(0x9cd3), BITMAP_PX(0xe71c), BITMAP_PX(0xc618), BITMAP_PX(0x9cf4), 
+  BITMAP_PX(0xad55), BITMAP_PX(0xad75), BITMAP_PX(0xb596), BITMAP_PX(0xbdf7), BITMAP_PX(0xc618), BITMAP_PX(0xbe18), BITMAP_PX(0xc618), BITMAP_PX(0xc618), BITMAP_PX(0xbdd7), BITMAP_PX(0xb5b6), BITMAP_PX(0xb596), BITMAP_PX(0xad75), 
+  BITMAP_PX(0xa514), BITMAP_PX(0xc638), BITMAP_PX(0xf7be), BITMAP_PX(0x8c71), BITMAP_PX(0xe73c), BITMAP_PX(0xffdf), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xe73c), BITMAP_PX(0xf7be), 
+  BITMAP_PX(0x9492), BITMAP_PX(0xce59), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xe73d), BITMAP_PX(0x8410), BITMAP_PX(0xe73c), BITMAP_PX(0xf7be), BITMAP_PX(0x0000), BITMAP_PX(0xad55), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xe73c), BITMAP_PX(0xf7be), BITMAP_PX(0x8c71), BITMAP_PX(0xbdf8), BITMAP_PX(0xffff), BITMAP_PX(0xf7bf), BITMAP_PX(0xd6ba), BITMAP_PX(0xbdf8), BITMAP_PX(0xad55), BITMAP_PX(0x94b2), 
+  BITMAP_PX(0x8410), BITMAP_PX(0x7bcf), BITMAP_PX(0x7bcf), BITMAP_PX(0x7bf0), BITMAP_PX(0x8c71), BITMAP_PX(0x9cf4), BITMAP_PX(0xbdd7), BITMAP_PX(0xce79), BITMAP_PX(0xef7e), BITMAP_PX(0xffff), BITMAP_PX(0xdedb), BITMAP_PX(0x7bf0), 
+  BITMAP_PX(0xe73c), BITMAP_PX(0xf7bf), BITMAP_PX(0x0000), BITMAP_PX(0xad55), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xd6bc), BITMAP_PX(0xf7be), BITMAP_PX(0x8c72), BITMAP_PX(0xb5b7), BITMAP_PX(0xffff), BITMAP_PX(0x8451), 
+  BITMAP_PX(0x39e8), BITMAP_PX(0x39e8), BITMAP_PX(0x39c7), BITMAP_PX(0x39c7), BITMAP_PX(0x39c7), BITMAP_PX(0x39c7), BITMAP_PX(0x39c7), BITMAP_PX(0x39c7), BITMAP_PX(0x39c7), BITMAP_PX(0x39e7), BITMAP_PX(0x39c7), BITMAP_PX(0x31a7), 
+  BITMAP_PX(0x6b4d), BITMAP_PX(0xf7be), BITMAP_PX(0xdedb), BITMAP_PX(0x7bcf), BITMAP_PX(0xe73c), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xad55), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xe71c), BITMAP_PX(0xf7bf), 
+  BITMAP_PX(0x8c72), BITMAP_PX(0xbdd7), BITMAP_PX(0xffff), BITMAP_PX(0x4a69), BITMAP_PX(0x4228), BITMAP_PX(0x4a49), BITMAP_PX(0x4229), BITMAP_PX(0x4a49), BITMAP_PX(0x4a49), BITMAP_PX(0x4a49), BITMAP_PX(0x4a49), BITMAP_PX(0x4a49), 
+  BITMAP_PX(0x4a49), BITMAP_PX(0x4a49), BITMAP_PX(0x4a49), BITMAP_PX(0x4a49), BITMAP_PX(0x39c7), BITMAP_PX(0xd69a), BITMAP_PX(0xe73c), BITMAP_PX(0x7bcf), BITMAP_PX(0xe73d), BITMAP_PX(0xf7be), BITMAP_PX(0x0000), BITMAP_PX(0xffff), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xd6bc), BITMAP_PX(0xf7bf), BITMAP_PX(0x8c72), BITMAP_PX(0xbdd7), BITMAP_PX(0xffff), BITMAP_PX(0x528a), BITMAP_PX(0x4208), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4229), 
+  BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4249), BITMAP_PX(0x4249), BITMAP_PX(0x4229), BITMAP_PX(0x4208), BITMAP_PX(0xd69a), BITMAP_PX(0xe73c), BITMAP_PX(0x7bcf), 
+  BITMAP_PX(0xef5d), BITMAP_PX(0xf79e), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xd6bc), BITMAP_PX(0xf7bf), BITMAP_PX(0x8c72), BITMAP_PX(0xbdd7), BITMAP_PX(0xffff), BITMAP_PX(0x4a6a), 
+  BITMAP_PX(0x4208), BITMAP_PX(0x4a49), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4249), BITMAP_PX(0x4249), BITMAP_PX(0x4249), BITMAP_PX(0x4229), BITMAP_PX(0x4a49), BITMAP_PX(0x4249), 
+  BITMAP_PX(0x39e8), BITMAP_PX(0xd69a), BITMAP_PX(0xe73c), BITMAP_PX(0x738e), BITMAP_PX(0xef7d), BITMAP_PX(0xf79e), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xef5d), BITMAP_PX(0xf7be), 
+  BITMAP_PX(0x9492), BITMAP_PX(0xb596), BITMAP_PX(0xffff), BITMAP_PX(0x528b), BITMAP_PX(0x4208), BITMAP_PX(0x4249), BITMAP_PX(0x4249), BITMAP_PX(0x4229), BITMAP_PX(0x4249), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4229), 
+  BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4a49), BITMAP_PX(0x4a49), BITMAP_PX(0x4208), BITMAP_PX(0xd69a), BITMAP_PX(0xe71c), BITMAP_PX(0x73ae), BITMAP_PX(0xf79e), BITMAP_PX(0xef7e), BITMAP_PX(0x0000), BITMAP_PX(0xffff), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xdedb), BITMAP_PX(0xf7be), BITMAP_PX(0x9492), BITMAP_PX(0xb596), BITMAP_PX(0xffff), BITMAP_PX(0x4a6a), BITMAP_PX(0x4208), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4229), 
+  BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4209), BITMAP_PX(0x31c7), BITMAP_PX(0xd69a), BITMAP_PX(0xdefb), BITMAP_PX(0x738e), 
+  BITMAP_PX(0xf79e), BITMAP_PX(0xf7be), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xd6ba), BITMAP_PX(0xffdf), BITMAP_PX(0xc618), BITMAP_PX(0xbdf7), BITMAP_PX(0xffff), BITMAP_PX(0x8c72), 
+  BITMAP_PX(0x4229), BITMAP_PX(0x4a49), BITMAP_PX(0x4a4a), BITMAP_PX(0x4a6a), BITMAP_PX(0x4a6a), BITMAP_PX(0x4a6a), BITMAP_PX(0x4a4a), BITMAP_PX(0x4a4a), BITMAP_PX(0x4a4a), BITMAP_PX(0x4a49), BITMAP_PX(0x4a6a), BITMAP_PX(0x4229), 
+  BITMAP_PX(0x6b6e), BITMAP_PX(0xf7be), BITMAP_PX(0xdefb), BITMAP_PX(0xad76), BITMAP_PX(0xffdf), BITMAP_PX(0xf79e), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xe71c), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xa514), BITMAP_PX(0xc638), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xe73d), BITMAP_PX(0xe71c), BITMAP_PX(0xe73c), BITMAP_PX(0xe73c), BITMAP_PX(0xe73c), BITMAP_PX(0xe73c), BITMAP_PX(0xe73c), BITMAP_PX(0xe73c), 
+  BITMAP_PX(0xe73c), BITMAP_PX(0xe73d), BITMAP_PX(0xe73d), BITMAP_PX(0xe73d), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xe71c), BITMAP_PX(0x8c51), BITMAP_PX(0xef7e), BITMAP_PX(0xef7e), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xe73e), BITMAP_PX(0xffff), BITMAP_PX(0x8c72), BITMAP_PX(0xa535), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xd6ba), BITMAP_PX(0x738e), 
+  BITMAP_PX(0xf79e), BITMAP_PX(0xef7d), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xef5c), BITMAP_PX(0xffdf), BITMAP_PX(0x9492), BITMAP_PX(0xad75), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xd6bb), BITMAP_PX(0x7bcf), BITMAP_PX(0xf79e), BITMAP_PX(0xf7be), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0xe71c), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0x9492), BITMAP_PX(0xad55), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xdedb), BITMAP_PX(0x73af), BITMAP_PX(0xf79e), BITMAP_PX(0xf79e), BITMAP_PX(0x0000), BITMAP_PX(0xffff), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xe73d), BITMAP_PX(0xffdf), BITMAP_PX(0x9492), BITMAP_PX(0xad75), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xdedb), BITMAP_PX(0x73af), 
+  BITMAP_PX(0xef7e), BITMAP_PX(0xef5d), BITMAP_PX(0x8c51), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xe71c), BITMAP_PX(0xffdf), BITMAP_PX(0x9492), BITMAP_PX(0xad76), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xdedb), BITMAP_PX(0x73af), BITMAP_PX(0xef7e), BITMAP_PX(0xef7d), BITMAP_PX(0xa534), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xdefc), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0x9492), BITMAP_PX(0xad75), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xdedb), BITMAP_PX(0x738e), BITMAP_PX(0xf79e), BITMAP_PX(0xef7e), BITMAP_PX(0xd6ba), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xef7d), BITMAP_PX(0xf7bf), BITMAP_PX(0x9492), BITMAP_PX(0xc618), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xef5d), BITMAP_PX(0x8c51), 
+  BITMAP_PX(0xef5d), BITMAP_PX(0xf7be), BITMAP_PX(0xe73c), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xf7be), BITMAP_PX(0xf7bf), BITMAP_PX(0xbdf8), BITMAP_PX(0xce59), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xf7bf), BITMAP_PX(0xffdf), BITMAP_PX(0xe71c), BITMAP_PX(0xad76), BITMAP_PX(0xf7be), BITMAP_PX(0xf79e), BITMAP_PX(0xc619), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xf7bf), BITMAP_PX(0xffff), 
+  BITMAP_PX(0x9cd3), BITMAP_PX(0xbdf7), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xe73c), BITMAP_PX(0x8410), BITMAP_PX(0xef7d), BITMAP_PX(0xffdf), BITMAP_PX(0xce7a), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xf7bf), BITMAP_PX(0xffdf), BITMAP_PX(0x8c72), BITMAP_PX(0xd69a), BITMAP_PX(0xbdd7), BITMAP_PX(0xbdf8), BITMAP_PX(0xef7e), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xef7d), BITMAP_PX(0xc639), BITMAP_PX(0xb5b6), BITMAP_PX(0xf7bf), BITMAP_PX(0x8c51), 
+  BITMAP_PX(0xe73c), BITMAP_PX(0xffff), BITMAP_PX(0xe71c), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xf7be), BITMAP_PX(0xad55), BITMAP_PX(0xe71c), BITMAP_PX(0x8410), BITMAP_PX(0x73cf), 
+  BITMAP_PX(0x8431), BITMAP_PX(0x9cf3), BITMAP_PX(0xb5d7), BITMAP_PX(0xc618), BITMAP_PX(0xd69a), BITMAP_PX(0xdefb), BITMAP_PX(0xdedb), BITMAP_PX(0xd69a), BITMAP_PX(0xc618), BITMAP_PX(0xb5b6), BITMAP_PX(0x9cd3), BITMAP_PX(0x8410), 
+  BITMAP_PX(0x7bef), BITMAP_PX(0x8410), BITMAP_PX(0xf79e), BITMAP_PX(0xb5b6), BITMAP_PX(0xe71c), BITMAP_PX(0xffff), BITMAP_PX(0xe71c), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xf79e), 
+  BITMAP_PX(0xf79e), BITMAP_PX(0xe6fc), BITMAP_PX(0x7bf0), BITMAP_PX(0x8410), BITMAP_PX(0x7bef), BITMAP_PX(0x7bcf), BITMAP_PX(0x73af), BITMAP_PX(0x73cf), BITMAP_PX(0x7bcf), BITMAP_PX(0x7bcf), BITMAP_PX(0x7bef), BITMAP_PX(0x7bef), 
+  BITMAP_PX(0x7bcf), BITMAP_PX(0x73af), BITMAP_PX(0x7bcf), BITMAP_PX(0x7bf0), BITMAP_PX(0x8430), BITMAP_PX(0x7bef), BITMAP_PX(0xdedb), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xef5e), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xf7bf), BITMAP_PX(0xffff), BITMAP_PX(0xc638), BITMAP_PX(0x6b8e), BITMAP_PX(0x8451), BITMAP_PX(0x8431), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), 
+  BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x7c10), BITMAP_PX(0x8430), BITMAP_PX(0x8431), BITMAP_PX(0x8430), BITMAP_PX(0x8430), BITMAP_PX(0x8431), BITMAP_PX(0x6b6e), BITMAP_PX(0xbdf7), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xd69c), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0xf79e), BITMAP_PX(0xffff), BITMAP_PX(0xa514), BITMAP_PX(0x39c7), BITMAP_PX(0x5aec), 
+  BITMAP_PX(0x738e), BITMAP_PX(0x7bef), BITMAP_PX(0x8430), BITMAP_PX(0x8410), BITMAP_PX(0x8410), BITMAP_PX(0x8430), BITMAP_PX(0x8410), BITMAP_PX(0x7c10), BITMAP_PX(0x8430), BITMAP_PX(0x8410), BITMAP_PX(0x7bf0), BITMAP_PX(0x738e), 
+  BITMAP_PX(0x5aec), BITMAP_PX(0x39e7), BITMAP_PX(0x9cf3), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xad55), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xf79e), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x8c71), BITMAP_PX(0x39c7), BITMAP_PX(0x4a49), BITMAP_PX(0x4229), BITMAP_PX(0x4a49), BITMAP_PX(0x52ab), BITMAP_PX(0x5aec), BITMAP_PX(0x634d), BITMAP_PX(0x6b6e), BITMAP_PX(0x6b6d), BITMAP_PX(0x632c), 
+  BITMAP_PX(0x5aeb), BITMAP_PX(0x52aa), BITMAP_PX(0x4a69), BITMAP_PX(0x4228), BITMAP_PX(0x4249), BITMAP_PX(0x39c7), BITMAP_PX(0x8431), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xbdd7), BITMAP_PX(0x39e7), BITMAP_PX(0x39c7), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4229), BITMAP_PX(0x4229), 
+  BITMAP_PX(0x4228), BITMAP_PX(0x4228), BITMAP_PX(0x4228), BITMAP_PX(0x4229), BITMAP_PX(0x4a49), BITMAP_PX(0x4228), BITMAP_PX(0x4229), BITMAP_PX(0x4228), BITMAP_PX(0x39c7), BITMAP_PX(0x39e7), BITMAP_PX(0xb5b6), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xf7be), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xdedb), BITMAP_PX(0x8c72), 
+  BITMAP_PX(0x528a), BITMAP_PX(0x39e8), BITMAP_PX(0x39c7), BITMAP_PX(0x39c7), BITMAP_PX(0x39c7), BITMAP_PX(0x39e8), BITMAP_PX(0x39e8), BITMAP_PX(0x39e7), BITMAP_PX(0x39c7), BITMAP_PX(0x39e8), BITMAP_PX(0x39e7), BITMAP_PX(0x52cb), 
+  BITMAP_PX(0x8c71), BITMAP_PX(0xd6bb), BITMAP_PX(0xffff), BITMAP_PX(0xf7bf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xf79e), BITMAP_PX(0xce79), BITMAP_PX(0xa535), BITMAP_PX(0x8410), BITMAP_PX(0x738e), BITMAP_PX(0x6b6d), BITMAP_PX(0x632d), BITMAP_PX(0x73af), 
+  BITMAP_PX(0x8430), BITMAP_PX(0xa514), BITMAP_PX(0xce79), BITMAP_PX(0xf79e), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xf7bf), BITMAP_PX(0x0000), BITMAP_PX(0xffff), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xf7bf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xf7be), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xffdf), BITMAP_PX(0xf7df), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xf7df), BITMAP_PX(0xffdf), BITMAP_PX(0xf7bf), BITMAP_PX(0xf7bf), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0xf79f), 
+  BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xf7bf), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x8c54), BITMAP_PX(0xef5d), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), 
+  BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xf79e), 
+  BITMAP_PX(0xce7b), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x8c72), BITMAP_PX(0xdefc), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0xf7bf), BITMAP_PX(0xf7be), BITMAP_PX(0xd6bb), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xe71c), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffff), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xf7df), BITMAP_PX(0xf7df), BITMAP_PX(0xf7df), BITMAP_PX(0xf7df), 
+  BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xffdf), BITMAP_PX(0xf7df), BITMAP_PX(0xffff), BITMAP_PX(0xef7d), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0xdedc), BITMAP_PX(0xe75d), 
+  BITMAP_PX(0xe71c), BITMAP_PX(0xdf1c), BITMAP_PX(0xe71c), BITMAP_PX(0xe73c), BITMAP_PX(0xe73c), BITMAP_PX(0xdefb), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x7bef), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), 
+  BITMAP_PX(0xad5f), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0x7bef), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0xffff), 
+  BITMAP_PX(0x7bef), BITMAP_PX(0xffff), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000)
 };
 
-const bitmap car_100x100_bitmap = { 100, 100, (uint16_t*)car_100x100_pixels };
+const bitmap car_100x100_bitmap = { 100, 100, (uint16_t*)car_100x100_pixels, BITMAP_RAW, NULL, 0 };
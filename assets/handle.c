@@ -1,543 +1,544 @@
 // Generated by png2bitmap_rgb565_c_h_pragonce.py
+#include <stddef.h>
 #include <stdint.h>
 #include "handle.h"
 
 // 80x80, RGB565 format
 static const uint16_t handle_80x80_pixels[6400] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0xaaaa, 0x7bef, 0x7bef, 0xbbef, 0xbbef, 
-  0xbbef, 0xbbef, 0x7bef, 0x7bef, 0xaaaa, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf800, 0xaaaa, 
-  0xbbef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xffff, 0x7bef, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x51c5, 0x8b4c, 
-  0x9bcd, 0xa42f, 0x9c2f, 0x9c2f, 0x9c2f, 0x9c2f, 0x9c0f, 0x940e, 0x8bad, 0x3984, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xad55, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0xfbef, 
-  0x0000, 0x0000, 0x1000, 0x8b6d, 0xb4b1, 0xc533, 0xcd53, 0xcd74, 0xc574, 0xbd13, 0xb4d2, 0xb4b1, 
-  0xb4d2, 0xbcf2, 0xbd12, 0xc553, 0xc554, 0xbd33, 0xa4b1, 0x8bee, 0x628a, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffe0, 0xffef, 0x0000, 0x0000, 0x4185, 0x8bad, 0xacb1, 0xbcd2, 
-  0xb4d2, 0x940f, 0x6aeb, 0x5228, 0x39a6, 0x2945, 0x2924, 0x3124, 0x3145, 0x3965, 0x4185, 0x49c6, 
-  0x5a28, 0x730c, 0x9c2f, 0xb513, 0xb513, 0xa470, 0x7b6c, 0x3964, 0x0000, 0x0000, 0xaaaa, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 
-  0x0000, 0x0000, 0x51a6, 0x834c, 0xa450, 0xacd1, 0x836d, 0x4a08, 0x2925, 0x10c3, 0x10a3, 0x10c3, 
-  0x18e3, 0x20e4, 0x2104, 0x2124, 0x2924, 0x2924, 0x2904, 0x28e4, 0x20c3, 0x20a3, 0x20e4, 0x3986, 
-  0x62aa, 0x942f, 0xb512, 0xa470, 0x8b8d, 0x5207, 0x0000, 0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xaaaa, 0x0000, 0x4923, 0xabed, 0xc4d1, 0xb4b0, 
-  0x6aca, 0x3145, 0x18a3, 0x18c3, 0x20e4, 0x2904, 0x2924, 0x2945, 0x3165, 0x3966, 0x3986, 0x3986, 
-  0x39a6, 0x39a6, 0x3186, 0x3186, 0x3165, 0x2945, 0x2925, 0x2104, 0x20c4, 0x20e4, 0x41c7, 0x7b6d, 
-  0xb4f3, 0xac90, 0x8b8c, 0x20a2, 0x0000, 0xaaaa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0xffff, 0x0000, 0x5228, 0xa3ee, 0xccf1, 0x834b, 0x3103, 0x1882, 0x18e3, 0x2104, 0x2924, 
-  0x3145, 0x39a6, 0x5228, 0x732c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x6b0c, 0x49e7, 0x3986, 0x3165, 0x2945, 0x2125, 0x18c4, 0x18c4, 0x39a6, 0x7b6d, 0xb4f2, 0x93ce, 
-  0x49e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0x0000, 0x0000, 0x6248, 0x9bef, 
-  0x8bad, 0x3985, 0x18c3, 0x18e4, 0x2904, 0x3124, 0x3985, 0x5a49, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5000, 0x5000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x4a28, 0x41c6, 0x3165, 0x2125, 0x18e4, 0x18c3, 0x4a08, 0x9c30, 0x942f, 0x5a88, 0x0000, 0x0000, 
-  0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5248, 0xa40f, 0x7aeb, 0x2904, 0x18c3, 0x2104, 0x2945, 
-  0x39a6, 0xfdf7, 0x0000, 0x0000, 0x0000, 0x39e7, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x39e7, 0x0000, 0x0000, 0x0000, 0x8c4e, 0x39c6, 
-  0x3165, 0x2104, 0x18c3, 0x2945, 0x836d, 0xa491, 0x6aca, 0x1945, 0x0000, 0x52aa, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 
-  0x5228, 0x8bad, 0x6269, 0x3103, 0x2104, 0x2925, 0x3986, 0x73ac, 0x0000, 0x0000, 0x39e7, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0x0000, 0x0000, 0x632c, 0x3186, 0x2925, 0x20c4, 
-  0x20e4, 0x6acb, 0xa470, 0x6aaa, 0x6269, 0x0000, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf800, 0x1861, 0x5a48, 0x834c, 0x5a27, 0x3944, 0x2904, 
-  0x3124, 0x4a08, 0x0000, 0x0000, 0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x39e7, 0x0000, 0x0000, 0x49e7, 0x3165, 0x2104, 0x2104, 0x5a48, 0xa40e, 
-  0x72a9, 0x4228, 0x0000, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x52aa, 0x0000, 0x49e6, 0x938e, 0x5a48, 0x2904, 0x28e3, 0x3144, 0x4a08, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x3800, 0x0000, 0x4a49, 0x3986, 0x2904, 0x3124, 0x6aaa, 0xa40e, 0x6a68, 0x4b6d, 0x7bef, 
-  0xf800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x0000, 0x41a6, 0x8b8d, 0x6aaa, 
-  0x2904, 0x2104, 0x3145, 0x8bae, 0x0000, 0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0x0000, 
-  0x73ac, 0x3965, 0x2924, 0x2944, 0x834b, 0xabed, 0x6207, 0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x52a0, 0x0000, 0x3165, 0x730b, 0x8b6d, 0x3945, 0x28e3, 0x3144, 0x62eb, 0x0000, 
-  0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x0000, 0x6aea, 0x3985, 0x3144, 
-  0x4186, 0xa3ef, 0x9b6c, 0x6a48, 0x0000, 0xaaaa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 
-  0x5a49, 0x9bee, 0x5a07, 0x3924, 0x3965, 0x4a27, 0x0000, 0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0x0000, 0x5249, 0x3986, 0x3144, 0x5a28, 0xac2e, 0x9309, 
-  0x830b, 0x7800, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x0000, 0x3986, 0x836d, 0x6289, 0x3923, 0x3924, 
-  0x39a6, 0x0000, 0x52a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x39e7, 0x0000, 0x41c7, 0x3985, 0x4164, 0x72ca, 0x9b8c, 0x6228, 0x0000, 0x52aa, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x7bef, 0x0000, 0x3126, 0x5a49, 0x7b4c, 0x4165, 0x3103, 0x3944, 0x41e7, 0x0000, 0x52a0, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39c7, 
-  0x3985, 0x3945, 0x41a6, 0x834c, 0x6249, 0x39a6, 0x0000, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x0000, 0x39a6, 0x7b0c, 
-  0x5a28, 0x3924, 0x3944, 0x3965, 0x0000, 0x52a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52a0, 0x0000, 0x3165, 0x3985, 0x3124, 0x628a, 
-  0x7b2c, 0x49c6, 0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x7be0, 0x0000, 0x3986, 0x5a48, 0x7b2c, 0x4165, 0x3103, 0x3164, 0x2aaa, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x7bef, 0x7bef, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x52aa, 0x0000, 0x3965, 0x3945, 0x3986, 0x7b4c, 0x5a07, 0x49e7, 0x0000, 
-  0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 
-  0x0000, 0x49a6, 0x832b, 0x6a89, 0x3103, 0x3944, 0x39c5, 0x0000, 0x7800, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0x39e7, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x39c7, 0x3965, 0x3124, 0x6aca, 0x6aca, 0x41a6, 0x0000, 0x39e7, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x554a, 0x5a27, 0x8b4c, 0x41a5, 
-  0x2903, 0x41a5, 0x0000, 0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2945, 0x3186, 0x39e8, 0x4249, 
-  0x4a69, 0x4249, 0x39c7, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0xffff, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x0000, 0x41c7, 0x3124, 
-  0x49c7, 0x7b4b, 0x41c6, 0x9cd3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x7bef, 0x0000, 0x41c7, 0x6a89, 0x7b0b, 0x2903, 0x3123, 0x732b, 0x0000, 0x7800, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x7bef, 0xffff, 0x0000, 0x0000, 
-  0x39c6, 0x3186, 0x4208, 0x5acb, 0x6b6d, 0x73ae, 0x83ef, 0x8c30, 0x8430, 0x840f, 0x7bef, 0x7bef, 
-  0x632c, 0x4a6a, 0x39e7, 0x4a67, 0x0000, 0x0000, 0x0000, 0x7bef, 0x52aa, 0xffff, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3965, 0x3124, 0x7b2b, 0x5207, 0x4207, 
-  0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0x0000, 
-  0x4986, 0x7aca, 0x6aaa, 0x20e2, 0x3944, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x52aa, 
-  0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738e, 0x3a08, 0x2945, 0x39e7, 0x73ae, 0x8c71, 
-  0x8c50, 0xb574, 0xc5b5, 0xbd94, 0xbd74, 0xbdb5, 0xad13, 0x94b2, 0xa514, 0x7bcf, 0x4208, 0x3186, 
-  0x52ab, 0x7c30, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x52aa, 0xffff, 0x0000, 0x0000, 
-  0x0000, 0x39e7, 0x0000, 0x41c7, 0x3103, 0x6aca, 0x62a9, 0x39a6, 0x0000, 0x39e7, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3800, 0x0000, 0x4185, 0x7aea, 0x5227, 0x20c2, 
-  0x3944, 0x0000, 0x0000, 0x0000, 0x7bef, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a6b, 0x6b4d, 
-  0x738e, 0x8410, 0x528a, 0x2966, 0x2945, 0x5acb, 0x738e, 0x7bae, 0xad13, 0x734c, 0x4a07, 0x41c6, 
-  0x41e7, 0x5269, 0x8c2f, 0xa513, 0x840f, 0x8451, 0x4a6a, 0x2965, 0x39e7, 0x6b6e, 0x9cd3, 0x7bcf, 
-  0x73ae, 0x5acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x0000, 0x52aa, 0x7bef, 0x5269, 
-  0x3124, 0x6269, 0x72eb, 0x3986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3965, 0x72ea, 0x41c6, 0x20e3, 0x3985, 0x0000, 0x2945, 0x0000, 
-  0x0000, 0x0000, 0x8c71, 0x630c, 0x630c, 0x630c, 0x632d, 0x630c, 0x6b6e, 0x630c, 0x2125, 0x2104, 
-  0x2966, 0x52aa, 0x62ca, 0x8bee, 0x39a6, 0x4a49, 0x9491, 0xa534, 0xa514, 0x7bcf, 0x31a6, 0x630b, 
-  0x9450, 0x630b, 0x5acb, 0x2945, 0x2125, 0x3186, 0x8c72, 0x7bcf, 0x738e, 0x738e, 0x6b6d, 0x632c, 
-  0x634d, 0x7bef, 0x0000, 0x0000, 0x0000, 0x4a49, 0x0000, 0x5228, 0x3145, 0x5a48, 0x732c, 0x3986, 
-  0xcfff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8c53, 
-  0x3965, 0x6aca, 0x3986, 0x3985, 0x49e7, 0x4a06, 0x0000, 0x0000, 0x6b8e, 0x632c, 0x630c, 0x630c, 
-  0x630c, 0x5acb, 0x4a49, 0x39e7, 0x5aeb, 0x2986, 0x10a3, 0x18e4, 0x3186, 0x4a28, 0x7b6c, 0x3165, 
-  0x5acb, 0xad55, 0xad34, 0xa514, 0xad34, 0xb596, 0xa534, 0x39e7, 0x62ca, 0x62ea, 0x4a49, 0x2945, 
-  0x20e4, 0x10a3, 0x630c, 0x6b4d, 0x4208, 0x52ab, 0x6b4d, 0x738e, 0x6b8e, 0x6b4d, 0x6b6d, 0x6b8e, 
-  0x0000, 0x0000, 0x5aa8, 0x5207, 0x3986, 0x5228, 0x732c, 0x3986, 0x636d, 0x0000, 0x7bef, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0x0000, 0x5aec, 0x3985, 0x6aca, 0x41c7, 0x62aa, 
-  0x732b, 0x5a68, 0x4a07, 0x4a6a, 0x52ab, 0x5aec, 0x52ab, 0x4a49, 0x4209, 0x39c7, 0x39c7, 0x39e7, 
-  0x5aeb, 0x2104, 0x18c3, 0x18e4, 0x2945, 0x5a69, 0x5268, 0x2965, 0x8410, 0x7bcf, 0x8c51, 0xc638, 
-  0xbdf7, 0x8c71, 0x9491, 0x8410, 0x39a6, 0x6b0b, 0x39c7, 0x2125, 0x18c3, 0x0882, 0x4a49, 0x73af, 
-  0x31a6, 0x4208, 0x4208, 0x4a49, 0x5acb, 0x634d, 0x738e, 0x6b6d, 0x630c, 0x4207, 0x72ea, 0x838c, 
-  0x5a69, 0x5248, 0x7b2c, 0x39a6, 0x5acb, 0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x7bef, 0x0000, 0x4a29, 0x3965, 0x6aca, 0x5a48, 0x732c, 0x9c2f, 0x940f, 0x6b2b, 0x6b6d, 
-  0x4a49, 0x39c7, 0x39e7, 0x39e7, 0x3924, 0x0000, 0x0000, 0x0000, 0x52cb, 0x2104, 0x10a3, 0x18e4, 
-  0x2104, 0x6289, 0x41c6, 0x4a49, 0x736d, 0x632c, 0x8c71, 0xffdf, 0xce58, 0x738e, 0x7bef, 0x7c10, 
-  0x41e8, 0x6289, 0x41c6, 0x18e4, 0x10a3, 0x0882, 0x39c7, 0x7bf0, 0x0000, 0x0000, 0x0000, 0x2124, 
-  0x4208, 0x4229, 0x4228, 0x4a69, 0x8430, 0x83ef, 0x9c70, 0xb513, 0x7b6c, 0x62a9, 0x7b2c, 0x39a6, 
-  0x4a6a, 0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0x0000, 0x41e8, 
-  0x3945, 0x6aea, 0x62aa, 0x838d, 0xacb1, 0x9c50, 0x8c30, 0x5aec, 0x4a49, 0x4208, 0x31a7, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4a6a, 0x2104, 0x10a3, 0x10c3, 0x18e4, 0x5248, 0x41c6, 0x4228, 
-  0x5aeb, 0x5aec, 0x6b4d, 0x8410, 0x6b6d, 0x6b4c, 0x6b6d, 0x6b6e, 0x4208, 0x5a69, 0x39a6, 0x18c3, 
-  0x1083, 0x0862, 0x3187, 0x6b4e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39c7, 0x4a49, 0x4228, 
-  0x5aeb, 0xa534, 0x9c71, 0xbd54, 0x9c50, 0x732c, 0x7b2c, 0x39a6, 0x4a49, 0x0000, 0x52aa, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0x0000, 0x4a4a, 0x3145, 0x730b, 0x730b, 0x838d, 
-  0x9c50, 0x83ad, 0x5acb, 0x2966, 0x3166, 0x4a28, 0x3166, 0x2946, 0x3186, 0x2965, 0x3186, 0x2966, 
-  0x39c7, 0x18e3, 0x0882, 0x10a3, 0x18c3, 0x39a6, 0x4a28, 0x31a6, 0x528a, 0x528a, 0x5aeb, 0x528a, 
-  0x5acb, 0x5aeb, 0x528a, 0x5acb, 0x41e7, 0x6289, 0x2924, 0x10a3, 0x0882, 0x0041, 0x2945, 0x4208, 
-  0x2986, 0x3186, 0x2986, 0x3186, 0x3186, 0x3186, 0x39c7, 0x31a7, 0x2145, 0x5aec, 0x7b6d, 0xa470, 
-  0x9c2f, 0x838d, 0x7b4c, 0x39a6, 0x4a69, 0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x7bef, 0x0000, 0x4a69, 0x3945, 0x730b, 0x730b, 0x7b4c, 0x836c, 0x6aaa, 0x3165, 0x2105, 
-  0x10a3, 0x18e3, 0x18c3, 0x18e4, 0x18e4, 0x1904, 0x2104, 0x18e4, 0x2966, 0x18c3, 0x0841, 0x10a3, 
-  0x10a3, 0x2104, 0x5269, 0x4208, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4a69, 0x4a49, 0x3a08, 0x39e7, 
-  0x5289, 0x4a27, 0x18c3, 0x0882, 0x0882, 0x0021, 0x2925, 0x2946, 0x2104, 0x2104, 0x2104, 0x2104, 
-  0x2104, 0x18e4, 0x18c3, 0x10a3, 0x2105, 0x2966, 0x5a68, 0x7b4b, 0x7b6c, 0x838d, 0x7b2b, 0x39a6, 
-  0x526a, 0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0x0000, 0x62cc, 
-  0x3145, 0x72ea, 0x730a, 0x5a69, 0x5a48, 0x49c6, 0x18a2, 0x1082, 0x0862, 0x0861, 0x0862, 0x0861, 
-  0x0862, 0x0862, 0x0842, 0x0842, 0x18a3, 0x10a3, 0x2104, 0x18c3, 0x1083, 0x18c3, 0x3145, 0x6b0c, 
-  0x52aa, 0x31c7, 0x3186, 0x2965, 0x3186, 0x3186, 0x39e7, 0x6b0b, 0x5a89, 0x20e3, 0x1082, 0x0862, 
-  0x18e4, 0x18e4, 0x18e3, 0x10a3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x1062, 0x1082, 0x1082, 
-  0x10a3, 0x18c3, 0x41a6, 0x6289, 0x6aca, 0x7b4d, 0x732b, 0x3965, 0x5aab, 0x0000, 0x7bef, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0x7c30, 0x3145, 0x6aa9, 0x72ea, 0x49c6, 
-  0x3944, 0x20e3, 0x1061, 0x0841, 0x1062, 0x10a2, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 
-  0x1082, 0x1082, 0x4228, 0x2945, 0x1082, 0x1082, 0x18a3, 0x3165, 0x734d, 0x83ef, 0x6b6d, 0x5aeb, 
-  0x5acb, 0x736d, 0x83ef, 0x5aca, 0x20e3, 0x1062, 0x0862, 0x1082, 0x2966, 0x39e8, 0x0861, 0x18c3, 
-  0x18c3, 0x18e4, 0x2104, 0x2104, 0x2104, 0x18e3, 0x18c3, 0x1082, 0x0862, 0x1082, 0x2903, 0x49c7, 
-  0x5248, 0x730c, 0x6aea, 0x3165, 0x632d, 0x0000, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xffff, 0x3145, 0x6248, 0x6aca, 0x3944, 0x20c2, 0x20c2, 0x18c3, 0x18e3, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 
-  0x1904, 0x0862, 0x0862, 0x10a3, 0x20e3, 0x4a28, 0x736d, 0x83ef, 0x83ee, 0x6b2c, 0x39a5, 0x10a1, 
-  0x0861, 0x0821, 0x0841, 0x2145, 0x5acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x10a2, 0x2903, 0x3124, 0x41a6, 0x730b, 0x6289, 0x3165, 
-  0xe71c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x3165, 0x49e6, 0x72ca, 0x30e3, 0x28e3, 0x4a07, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0x0000, 0xbdf7, 0x39e8, 0x18c3, 0x0041, 0x0862, 
-  0x0862, 0x0861, 0x1082, 0x10a2, 0x10a2, 0x1061, 0x0861, 0x0841, 0x0801, 0x0820, 0x2104, 0x52aa, 
-  0x0000, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x5227, 0x3964, 0x3965, 0x6b0b, 0x5228, 0x3165, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0x0000, 0x39c6, 0x3985, 0x72ea, 0x3923, 
-  0x3944, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xbdf7, 0x39e8, 0x18e4, 0x0021, 0x0021, 0x0821, 0x0842, 0x0842, 
-  0x0841, 0x0041, 0x0020, 0x0000, 0x0841, 0x2945, 0x52aa, 0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd555, 0x49a5, 
-  0x3985, 0x732b, 0x41c6, 0x3186, 0x0000, 0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x52aa, 0x0000, 0x4a49, 0x3145, 0x6aaa, 0x4185, 0x3923, 0xb512, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x4a6a, 0x2945, 0x1082, 0x0021, 0x0021, 0x0000, 0x0000, 0x0000, 0x0841, 0x18e4, 
-  0x31a6, 0xb596, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x936d, 0x49a5, 0x51e7, 0x730b, 0x3144, 0x4a29, 
-  0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 
-  0x8c52, 0x3145, 0x5207, 0x5a27, 0x3122, 0x62a8, 0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 
-  0x1082, 0x0000, 0x0861, 0x1082, 0x1082, 0x0021, 0x0021, 0x18c3, 0x18e4, 0x0000, 0x39e7, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x52aa, 0x0000, 0x6ac9, 0x4185, 0x6aca, 0x5a69, 0x2924, 0x9cf3, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39a6, 0x3965, 0x6aca, 
-  0x3943, 0x49a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0x0000, 0x2104, 0x2104, 0x0841, 0x0841, 
-  0x0841, 0x1082, 0x18e3, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52a0, 0x0000, 0x5a27, 0x49a6, 
-  0x7b6c, 0x3985, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x52aa, 0x0000, 0x528a, 0x2924, 0x6289, 0x5207, 0x3103, 0x8b4c, 0x0000, 
-  0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xffff, 0x0000, 0x52aa, 0x73ae, 0x18c3, 0x2124, 0x18c3, 0x4208, 0x73ae, 0x18c3, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x7bef, 0x0000, 0x8b8b, 0x49a5, 0x5a89, 0x62a9, 0x2104, 0x4249, 0x0000, 
-  0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0xd6ba, 0x3145, 0x3985, 0x732c, 0x3123, 0x41a4, 0x0000, 0x5000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x0000, 
-  0x4208, 0x8c51, 0x0000, 0x0000, 0x0000, 0x0841, 0x632c, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52a0, 
-  0x0000, 0x5227, 0x49c6, 0x7b4c, 0x3944, 0x2945, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0x0000, 0x4208, 0x2103, 
-  0x6268, 0x5a89, 0x3122, 0x6a68, 0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0x0000, 0x31a6, 0x7bcf, 0x0000, 0x5aeb, 
-  0x0000, 0xef7d, 0x5acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0x0000, 0x72e9, 0x41a5, 0x6aeb, 0x5a48, 
-  0x20e3, 0x4249, 0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0x3165, 0x2924, 0x732c, 0x49c6, 0x3944, 
-  0xbd75, 0x0000, 0x7be0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x39e7, 0x0000, 0x2965, 0x6b6d, 0x0000, 0x632c, 0x0000, 0xb5b6, 0x52aa, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x7bef, 0x0000, 0x9c0e, 0x41a5, 0x5a69, 0x732b, 0x20e2, 0x2965, 0xffff, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x52aa, 0x0000, 0x4a6a, 0x2104, 0x41a5, 0x7b4d, 0x3944, 0x4185, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x2104, 0x630c, 0x0020, 0x52aa, 0x0000, 0x9cf3, 0x4a49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf800, 0x0000, 0xffff, 0x49e6, 
-  0x4a07, 0x7b6d, 0x3944, 0x18e3, 0x4a8a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x0000, 
-  0x39e7, 0x20c3, 0x6269, 0x730b, 0x3143, 0x49e7, 0x0000, 0x39e0, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x5acb, 0xffff, 0x0000, 
-  0x0000, 0x8c51, 0x39e7, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xf800, 0x0000, 0x0020, 0x5247, 0x41a5, 0x732c, 0x49c5, 0x18c2, 0x39a7, 
-  0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7c71, 0x3166, 0x30e2, 0x6aa9, 
-  0x72ea, 0x4164, 0x5207, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a69, 0xb596, 0x0000, 0x0000, 0x7bef, 0x31a6, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0x0000, 
-  0x0000, 0x5248, 0x41a5, 0x734c, 0x49e6, 0x1881, 0x2966, 0xce7f, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x7bef, 0x0000, 0x5acb, 0x3144, 0x28c2, 0x6289, 0x72ca, 0x4164, 0x5207, 
-  0x0000, 0x0000, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x4208, 0x9492, 0x39e7, 0x0000, 0x6b6e, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x0000, 0x0020, 0x4a07, 0x4165, 0x732c, 0x5a68, 
-  0x1061, 0x2945, 0x632d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x52aa, 0x0000, 0x4a69, 0x2904, 0x1882, 0x6269, 0x72eb, 0x4185, 0x41c6, 0xffff, 0x0000, 0x39e7, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39c7, 0x9cd3, 0x0000, 
-  0x0000, 0x6b6d, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 
-  0x5000, 0x0000, 0xad53, 0x49e6, 0x49c6, 0x730b, 0x5208, 0x1061, 0x2104, 0x4aab, 0x0000, 0x52aa, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0x0000, 0x4229, 
-  0x2104, 0x1881, 0x5a48, 0x7b2c, 0x49e6, 0x3964, 0x5a89, 0x0000, 0x0000, 0x39e0, 0x7800, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2084, 0x2904, 0x6b2c, 0x62ea, 0x7b8d, 0x62ca, 0x20e2, 0x0000, 
-  0x5000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0x0000, 0x0000, 0x0000, 0x6289, 0x41a5, 0x5a28, 
-  0x836d, 0x49e6, 0x1061, 0x2104, 0x4a49, 0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39e0, 0x0000, 0x4a49, 0x2124, 0x1061, 0x41c6, 
-  0x7b6d, 0x6289, 0x3984, 0x3984, 0x730a, 0x0000, 0x0000, 0x0000, 0x39e0, 0x52a0, 0x4924, 0x0000, 
-  0x41a5, 0x51e6, 0x6aea, 0x732b, 0x730b, 0x5a68, 0x41a5, 0x5a68, 0x0000, 0x52a5, 0x39e7, 0x39e7, 
-  0x0000, 0x0000, 0x0000, 0x732b, 0x49c6, 0x51c6, 0x7aea, 0x834c, 0x3944, 0x1061, 0x2924, 0x4a69, 
-  0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x500a, 0x0000, 0x4a89, 0x2924, 0x1861, 0x28e3, 0x6aca, 0x7b4c, 0x5a47, 
-  0x3964, 0x3944, 0x41e5, 0x0000, 0x0000, 0x0000, 0x0000, 0x736c, 0x41a5, 0x6ac9, 0x838d, 0x838d, 
-  0x838d, 0x7b4c, 0x5227, 0x49e6, 0x842f, 0x0000, 0x0000, 0x0000, 0x0000, 0x6289, 0x49c5, 0x51c5, 
-  0x72ca, 0x8bad, 0x6aa9, 0x20a1, 0x1882, 0x2945, 0x6b4d, 0x0000, 0x52aa, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x52aa, 0x0000, 0x6b6f, 0x3186, 0x18a2, 0x1061, 0x4185, 0x732b, 0x7b4c, 0x5a89, 0x3985, 0x3143, 
-  0x3123, 0x41a5, 0x49c5, 0x49a5, 0x5207, 0x7b4c, 0x8bae, 0x8bae, 0x8bce, 0x8bae, 0x72ea, 0x5227, 
-  0x5206, 0x5a26, 0x5a27, 0x51e6, 0x49c5, 0x51e7, 0x72ea, 0x93ad, 0x834c, 0x4164, 0x1041, 0x18a3, 
-  0x2986, 0xffff, 0x0000, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x0000, 0x0000, 
-  0x39e7, 0x2104, 0x1082, 0x1861, 0x4185, 0x730b, 0x7b8d, 0x732b, 0x5a69, 0x49e6, 0x41c6, 0x5207, 
-  0x6aea, 0x838d, 0x83ad, 0x8bad, 0x8bce, 0x8bae, 0x838d, 0x730a, 0x6268, 0x6248, 0x6a88, 0x72ea, 
-  0x836c, 0x8b8d, 0x72ea, 0x4184, 0x1861, 0x1061, 0x2104, 0x4209, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8c51, 0x3186, 0x20e3, 
-  0x1061, 0x1041, 0x2903, 0x5228, 0x730b, 0x836d, 0x83ad, 0x8bae, 0x8bee, 0x940f, 0x940f, 0x940f, 
-  0x942f, 0x9c30, 0x9c50, 0x9c50, 0x940f, 0x93ce, 0x8bad, 0x7b2b, 0x5a07, 0x28e2, 0x1040, 0x1061, 
-  0x18c3, 0x31a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5000, 0x0000, 0x0000, 0x73ae, 0x31a7, 0x1904, 0x1062, 0x0820, 
-  0x1040, 0x20a2, 0x3944, 0x49c6, 0x6268, 0x6ac9, 0x6aea, 0x6aea, 0x6aca, 0x62a9, 0x5a48, 0x51e6, 
-  0x4185, 0x3923, 0x28a2, 0x1841, 0x1020, 0x1061, 0x20e3, 0x3186, 0x0020, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x4228, 0x2945, 0x18c3, 0x1061, 0x0820, 0x0800, 
-  0x0820, 0x0820, 0x0820, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1061, 0x18c3, 
-  0x2945, 0x4a4a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x000a, 0x0000, 0x0000, 0x0000, 0x0020, 0x528a, 0x31a7, 0x2945, 0x2104, 0x18c3, 0x18c3, 0x10a2, 
-  0x10a2, 0x18c3, 0x18e3, 0x1904, 0x2965, 0x31c7, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0xaaaa), BITMAP_PX(0x7bef), BITMAP_PX(0x7bef), BITMAP_PX(0xbbef), BITMAP_PX(0xbbef), 
+  BITMAP_PX(0xbbef), BITMAP_PX(0xbbef), BITMAP_PX(0x7bef), BITMAP_PX(0x7bef), BITMAP_PX(0xaaaa), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xf800), BITMAP_PX(0xaaaa), 
+  BITMAP_PX(0xbbef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x7bef), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0xad55), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x51c5), BITMAP_PX(0x8b4c), 
+  BITMAP_PX(0x9bcd), BITMAP_PX(0xa42f), BITMAP_PX(0x9c2f), BITMAP_PX(0x9c2f), BITMAP_PX(0x9c2f), BITMAP_PX(0x9c2f), BITMAP_PX(0x9c0f), BITMAP_PX(0x940e), BITMAP_PX(0x8bad), BITMAP_PX(0x3984), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xad55), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0xfbef), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x1000), BITMAP_PX(0x8b6d), BITMAP_PX(0xb4b1), BITMAP_PX(0xc533), BITMAP_PX(0xcd53), BITMAP_PX(0xcd74), BITMAP_PX(0xc574), BITMAP_PX(0xbd13), BITMAP_PX(0xb4d2), BITMAP_PX(0xb4b1), 
+  BITMAP_PX(0xb4d2), BITMAP_PX(0xbcf2), BITMAP_PX(0xbd12), BITMAP_PX(0xc553), BITMAP_PX(0xc554), BITMAP_PX(0xbd33), BITMAP_PX(0xa4b1), BITMAP_PX(0x8bee), BITMAP_PX(0x628a), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xffff), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffe0), BITMAP_PX(0xffef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x4185), BITMAP_PX(0x8bad), BITMAP_PX(0xacb1), BITMAP_PX(0xbcd2), 
+  BITMAP_PX(0xb4d2), BITMAP_PX(0x940f), BITMAP_PX(0x6aeb), BITMAP_PX(0x5228), BITMAP_PX(0x39a6), BITMAP_PX(0x2945), BITMAP_PX(0x2924), BITMAP_PX(0x3124), BITMAP_PX(0x3145), BITMAP_PX(0x3965), BITMAP_PX(0x4185), BITMAP_PX(0x49c6), 
+  BITMAP_PX(0x5a28), BITMAP_PX(0x730c), BITMAP_PX(0x9c2f), BITMAP_PX(0xb513), BITMAP_PX(0xb513), BITMAP_PX(0xa470), BITMAP_PX(0x7b6c), BITMAP_PX(0x3964), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xaaaa), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x51a6), BITMAP_PX(0x834c), BITMAP_PX(0xa450), BITMAP_PX(0xacd1), BITMAP_PX(0x836d), BITMAP_PX(0x4a08), BITMAP_PX(0x2925), BITMAP_PX(0x10c3), BITMAP_PX(0x10a3), BITMAP_PX(0x10c3), 
+  BITMAP_PX(0x18e3), BITMAP_PX(0x20e4), BITMAP_PX(0x2104), BITMAP_PX(0x2124), BITMAP_PX(0x2924), BITMAP_PX(0x2924), BITMAP_PX(0x2904), BITMAP_PX(0x28e4), BITMAP_PX(0x20c3), BITMAP_PX(0x20a3), BITMAP_PX(0x20e4), BITMAP_PX(0x3986), 
+  BITMAP_PX(0x62aa), BITMAP_PX(0x942f), BITMAP_PX(0xb512), BITMAP_PX(0xa470), BITMAP_PX(0x8b8d), BITMAP_PX(0x5207), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xaaaa), BITMAP_PX(0x0000), BITMAP_PX(0x4923), BITMAP_PX(0xabed), BITMAP_PX(0xc4d1), BITMAP_PX(0xb4b0), 
+  BITMAP_PX(0x6aca), BITMAP_PX(0x3145), BITMAP_PX(0x18a3), BITMAP_PX(0x18c3), BITMAP_PX(0x20e4), BITMAP_PX(0x2904), BITMAP_PX(0x2924), BITMAP_PX(0x2945), BITMAP_PX(0x3165), BITMAP_PX(0x3966), BITMAP_PX(0x3986), BITMAP_PX(0x3986), 
+  BITMAP_PX(0x39a6), BITMAP_PX(0x39a6), BITMAP_PX(0x3186), BITMAP_PX(0x3186), BITMAP_PX(0x3165), BITMAP_PX(0x2945), BITMAP_PX(0x2925), BITMAP_PX(0x2104), BITMAP_PX(0x20c4), BITMAP_PX(0x20e4), BITMAP_PX(0x41c7), BITMAP_PX(0x7b6d), 
+  BITMAP_PX(0xb4f3), BITMAP_PX(0xac90), BITMAP_PX(0x8b8c), BITMAP_PX(0x20a2), BITMAP_PX(0x0000), BITMAP_PX(0xaaaa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x5228), BITMAP_PX(0xa3ee), BITMAP_PX(0xccf1), BITMAP_PX(0x834b), BITMAP_PX(0x3103), BITMAP_PX(0x1882), BITMAP_PX(0x18e3), BITMAP_PX(0x2104), BITMAP_PX(0x2924), 
+  BITMAP_PX(0x3145), BITMAP_PX(0x39a6), BITMAP_PX(0x5228), BITMAP_PX(0x732c), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x6b0c), BITMAP_PX(0x49e7), BITMAP_PX(0x3986), BITMAP_PX(0x3165), BITMAP_PX(0x2945), BITMAP_PX(0x2125), BITMAP_PX(0x18c4), BITMAP_PX(0x18c4), BITMAP_PX(0x39a6), BITMAP_PX(0x7b6d), BITMAP_PX(0xb4f2), BITMAP_PX(0x93ce), 
+  BITMAP_PX(0x49e7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7800), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x6248), BITMAP_PX(0x9bef), 
+  BITMAP_PX(0x8bad), BITMAP_PX(0x3985), BITMAP_PX(0x18c3), BITMAP_PX(0x18e4), BITMAP_PX(0x2904), BITMAP_PX(0x3124), BITMAP_PX(0x3985), BITMAP_PX(0x5a49), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x5000), BITMAP_PX(0x5000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x4a28), BITMAP_PX(0x41c6), BITMAP_PX(0x3165), BITMAP_PX(0x2125), BITMAP_PX(0x18e4), BITMAP_PX(0x18c3), BITMAP_PX(0x4a08), BITMAP_PX(0x9c30), BITMAP_PX(0x942f), BITMAP_PX(0x5a88), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x5248), BITMAP_PX(0xa40f), BITMAP_PX(0x7aeb), BITMAP_PX(0x2904), BITMAP_PX(0x18c3), BITMAP_PX(0x2104), BITMAP_PX(0x2945), 
+  BITMAP_PX(0x39a6), BITMAP_PX(0xfdf7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x8c4e), BITMAP_PX(0x39c6), 
+  BITMAP_PX(0x3165), BITMAP_PX(0x2104), BITMAP_PX(0x18c3), BITMAP_PX(0x2945), BITMAP_PX(0x836d), BITMAP_PX(0xa491), BITMAP_PX(0x6aca), BITMAP_PX(0x1945), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0800), 
+  BITMAP_PX(0x5228), BITMAP_PX(0x8bad), BITMAP_PX(0x6269), BITMAP_PX(0x3103), BITMAP_PX(0x2104), BITMAP_PX(0x2925), BITMAP_PX(0x3986), BITMAP_PX(0x73ac), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x632c), BITMAP_PX(0x3186), BITMAP_PX(0x2925), BITMAP_PX(0x20c4), 
+  BITMAP_PX(0x20e4), BITMAP_PX(0x6acb), BITMAP_PX(0xa470), BITMAP_PX(0x6aaa), BITMAP_PX(0x6269), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xf800), BITMAP_PX(0x1861), BITMAP_PX(0x5a48), BITMAP_PX(0x834c), BITMAP_PX(0x5a27), BITMAP_PX(0x3944), BITMAP_PX(0x2904), 
+  BITMAP_PX(0x3124), BITMAP_PX(0x4a08), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x49e7), BITMAP_PX(0x3165), BITMAP_PX(0x2104), BITMAP_PX(0x2104), BITMAP_PX(0x5a48), BITMAP_PX(0xa40e), 
+  BITMAP_PX(0x72a9), BITMAP_PX(0x4228), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x49e6), BITMAP_PX(0x938e), BITMAP_PX(0x5a48), BITMAP_PX(0x2904), BITMAP_PX(0x28e3), BITMAP_PX(0x3144), BITMAP_PX(0x4a08), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x3800), BITMAP_PX(0x0000), BITMAP_PX(0x4a49), BITMAP_PX(0x3986), BITMAP_PX(0x2904), BITMAP_PX(0x3124), BITMAP_PX(0x6aaa), BITMAP_PX(0xa40e), BITMAP_PX(0x6a68), BITMAP_PX(0x4b6d), BITMAP_PX(0x7bef), 
+  BITMAP_PX(0xf800), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x41a6), BITMAP_PX(0x8b8d), BITMAP_PX(0x6aaa), 
+  BITMAP_PX(0x2904), BITMAP_PX(0x2104), BITMAP_PX(0x3145), BITMAP_PX(0x8bae), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x73ac), BITMAP_PX(0x3965), BITMAP_PX(0x2924), BITMAP_PX(0x2944), BITMAP_PX(0x834b), BITMAP_PX(0xabed), BITMAP_PX(0x6207), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52a0), BITMAP_PX(0x0000), BITMAP_PX(0x3165), BITMAP_PX(0x730b), BITMAP_PX(0x8b6d), BITMAP_PX(0x3945), BITMAP_PX(0x28e3), BITMAP_PX(0x3144), BITMAP_PX(0x62eb), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x6aea), BITMAP_PX(0x3985), BITMAP_PX(0x3144), 
+  BITMAP_PX(0x4186), BITMAP_PX(0xa3ef), BITMAP_PX(0x9b6c), BITMAP_PX(0x6a48), BITMAP_PX(0x0000), BITMAP_PX(0xaaaa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x1082), 
+  BITMAP_PX(0x5a49), BITMAP_PX(0x9bee), BITMAP_PX(0x5a07), BITMAP_PX(0x3924), BITMAP_PX(0x3965), BITMAP_PX(0x4a27), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x5249), BITMAP_PX(0x3986), BITMAP_PX(0x3144), BITMAP_PX(0x5a28), BITMAP_PX(0xac2e), BITMAP_PX(0x9309), 
+  BITMAP_PX(0x830b), BITMAP_PX(0x7800), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x3986), BITMAP_PX(0x836d), BITMAP_PX(0x6289), BITMAP_PX(0x3923), BITMAP_PX(0x3924), 
+  BITMAP_PX(0x39a6), BITMAP_PX(0x0000), BITMAP_PX(0x52a0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x41c7), BITMAP_PX(0x3985), BITMAP_PX(0x4164), BITMAP_PX(0x72ca), BITMAP_PX(0x9b8c), BITMAP_PX(0x6228), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x3126), BITMAP_PX(0x5a49), BITMAP_PX(0x7b4c), BITMAP_PX(0x4165), BITMAP_PX(0x3103), BITMAP_PX(0x3944), BITMAP_PX(0x41e7), BITMAP_PX(0x0000), BITMAP_PX(0x52a0), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39c7), 
+  BITMAP_PX(0x3985), BITMAP_PX(0x3945), BITMAP_PX(0x41a6), BITMAP_PX(0x834c), BITMAP_PX(0x6249), BITMAP_PX(0x39a6), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x39a6), BITMAP_PX(0x7b0c), 
+  BITMAP_PX(0x5a28), BITMAP_PX(0x3924), BITMAP_PX(0x3944), BITMAP_PX(0x3965), BITMAP_PX(0x0000), BITMAP_PX(0x52a0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52a0), BITMAP_PX(0x0000), BITMAP_PX(0x3165), BITMAP_PX(0x3985), BITMAP_PX(0x3124), BITMAP_PX(0x628a), 
+  BITMAP_PX(0x7b2c), BITMAP_PX(0x49c6), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7be0), BITMAP_PX(0x0000), BITMAP_PX(0x3986), BITMAP_PX(0x5a48), BITMAP_PX(0x7b2c), BITMAP_PX(0x4165), BITMAP_PX(0x3103), BITMAP_PX(0x3164), BITMAP_PX(0x2aaa), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x52aa), BITMAP_PX(0x52aa), BITMAP_PX(0x52aa), BITMAP_PX(0x52aa), BITMAP_PX(0x52aa), BITMAP_PX(0x7bef), BITMAP_PX(0x7bef), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x3965), BITMAP_PX(0x3945), BITMAP_PX(0x3986), BITMAP_PX(0x7b4c), BITMAP_PX(0x5a07), BITMAP_PX(0x49e7), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x49a6), BITMAP_PX(0x832b), BITMAP_PX(0x6a89), BITMAP_PX(0x3103), BITMAP_PX(0x3944), BITMAP_PX(0x39c5), BITMAP_PX(0x0000), BITMAP_PX(0x7800), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x39c7), BITMAP_PX(0x3965), BITMAP_PX(0x3124), BITMAP_PX(0x6aca), BITMAP_PX(0x6aca), BITMAP_PX(0x41a6), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x554a), BITMAP_PX(0x5a27), BITMAP_PX(0x8b4c), BITMAP_PX(0x41a5), 
+  BITMAP_PX(0x2903), BITMAP_PX(0x41a5), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x1082), BITMAP_PX(0x2945), BITMAP_PX(0x3186), BITMAP_PX(0x39e8), BITMAP_PX(0x4249), 
+  BITMAP_PX(0x4a69), BITMAP_PX(0x4249), BITMAP_PX(0x39c7), BITMAP_PX(0x18c3), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x41c7), BITMAP_PX(0x3124), 
+  BITMAP_PX(0x49c7), BITMAP_PX(0x7b4b), BITMAP_PX(0x41c6), BITMAP_PX(0x9cd3), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x41c7), BITMAP_PX(0x6a89), BITMAP_PX(0x7b0b), BITMAP_PX(0x2903), BITMAP_PX(0x3123), BITMAP_PX(0x732b), BITMAP_PX(0x0000), BITMAP_PX(0x7800), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x7bef), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x39c6), BITMAP_PX(0x3186), BITMAP_PX(0x4208), BITMAP_PX(0x5acb), BITMAP_PX(0x6b6d), BITMAP_PX(0x73ae), BITMAP_PX(0x83ef), BITMAP_PX(0x8c30), BITMAP_PX(0x8430), BITMAP_PX(0x840f), BITMAP_PX(0x7bef), BITMAP_PX(0x7bef), 
+  BITMAP_PX(0x632c), BITMAP_PX(0x4a6a), BITMAP_PX(0x39e7), BITMAP_PX(0x4a67), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x52aa), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x3965), BITMAP_PX(0x3124), BITMAP_PX(0x7b2b), BITMAP_PX(0x5207), BITMAP_PX(0x4207), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x4986), BITMAP_PX(0x7aca), BITMAP_PX(0x6aaa), BITMAP_PX(0x20e2), BITMAP_PX(0x3944), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x52aa), 
+  BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x738e), BITMAP_PX(0x3a08), BITMAP_PX(0x2945), BITMAP_PX(0x39e7), BITMAP_PX(0x73ae), BITMAP_PX(0x8c71), 
+  BITMAP_PX(0x8c50), BITMAP_PX(0xb574), BITMAP_PX(0xc5b5), BITMAP_PX(0xbd94), BITMAP_PX(0xbd74), BITMAP_PX(0xbdb5), BITMAP_PX(0xad13), BITMAP_PX(0x94b2), BITMAP_PX(0xa514), BITMAP_PX(0x7bcf), BITMAP_PX(0x4208), BITMAP_PX(0x3186), 
+  BITMAP_PX(0x52ab), BITMAP_PX(0x7c30), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x52aa), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x41c7), BITMAP_PX(0x3103), BITMAP_PX(0x6aca), BITMAP_PX(0x62a9), BITMAP_PX(0x39a6), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x3800), BITMAP_PX(0x0000), BITMAP_PX(0x4185), BITMAP_PX(0x7aea), BITMAP_PX(0x5227), BITMAP_PX(0x20c2), 
+  BITMAP_PX(0x3944), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x4a6b), BITMAP_PX(0x6b4d), 
+  BITMAP_PX(0x738e), BITMAP_PX(0x8410), BITMAP_PX(0x528a), BITMAP_PX(0x2966), BITMAP_PX(0x2945), BITMAP_PX(0x5acb), BITMAP_PX(0x738e), BITMAP_PX(0x7bae), BITMAP_PX(0xad13), BITMAP_PX(0x734c), BITMAP_PX(0x4a07), BITMAP_PX(0x41c6), 
+  BITMAP_PX(0x41e7), BITMAP_PX(0x5269), BITMAP_PX(0x8c2f), BITMAP_PX(0xa513), BITMAP_PX(0x840f), BITMAP_PX(0x8451), BITMAP_PX(0x4a6a), BITMAP_PX(0x2965), BITMAP_PX(0x39e7), BITMAP_PX(0x6b6e), BITMAP_PX(0x9cd3), BITMAP_PX(0x7bcf), 
+  BITMAP_PX(0x73ae), BITMAP_PX(0x5acb), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x7bef), BITMAP_PX(0x5269), 
+  BITMAP_PX(0x3124), BITMAP_PX(0x6269), BITMAP_PX(0x72eb), BITMAP_PX(0x3986), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x3965), BITMAP_PX(0x72ea), BITMAP_PX(0x41c6), BITMAP_PX(0x20e3), BITMAP_PX(0x3985), BITMAP_PX(0x0000), BITMAP_PX(0x2945), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x8c71), BITMAP_PX(0x630c), BITMAP_PX(0x630c), BITMAP_PX(0x630c), BITMAP_PX(0x632d), BITMAP_PX(0x630c), BITMAP_PX(0x6b6e), BITMAP_PX(0x630c), BITMAP_PX(0x2125), BITMAP_PX(0x2104), 
+  BITMAP_PX(0x2966), BITMAP_PX(0x52aa), BITMAP_PX(0x62ca), BITMAP_PX(0x8bee), BITMAP_PX(0x39a6), BITMAP_PX(0x4a49), BITMAP_PX(0x9491), BITMAP_PX(0xa534), BITMAP_PX(0xa514), BITMAP_PX(0x7bcf), BITMAP_PX(0x31a6), BITMAP_PX(0x630b), 
+  BITMAP_PX(0x9450), BITMAP_PX(0x630b), BITMAP_PX(0x5acb), BITMAP_PX(0x2945), BITMAP_PX(0x2125), BITMAP_PX(0x3186), BITMAP_PX(0x8c72), BITMAP_PX(0x7bcf), BITMAP_PX(0x738e), BITMAP_PX(0x738e), BITMAP_PX(0x6b6d), BITMAP_PX(0x632c), 
+  BITMAP_PX(0x634d), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x4a49), BITMAP_PX(0x0000), BITMAP_PX(0x5228), BITMAP_PX(0x3145), BITMAP_PX(0x5a48), BITMAP_PX(0x732c), BITMAP_PX(0x3986), 
+  BITMAP_PX(0xcfff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x8c53), 
+  BITMAP_PX(0x3965), BITMAP_PX(0x6aca), BITMAP_PX(0x3986), BITMAP_PX(0x3985), BITMAP_PX(0x49e7), BITMAP_PX(0x4a06), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x6b8e), BITMAP_PX(0x632c), BITMAP_PX(0x630c), BITMAP_PX(0x630c), 
+  BITMAP_PX(0x630c), BITMAP_PX(0x5acb), BITMAP_PX(0x4a49), BITMAP_PX(0x39e7), BITMAP_PX(0x5aeb), BITMAP_PX(0x2986), BITMAP_PX(0x10a3), BITMAP_PX(0x18e4), BITMAP_PX(0x3186), BITMAP_PX(0x4a28), BITMAP_PX(0x7b6c), BITMAP_PX(0x3165), 
+  BITMAP_PX(0x5acb), BITMAP_PX(0xad55), BITMAP_PX(0xad34), BITMAP_PX(0xa514), BITMAP_PX(0xad34), BITMAP_PX(0xb596), BITMAP_PX(0xa534), BITMAP_PX(0x39e7), BITMAP_PX(0x62ca), BITMAP_PX(0x62ea), BITMAP_PX(0x4a49), BITMAP_PX(0x2945), 
+  BITMAP_PX(0x20e4), BITMAP_PX(0x10a3), BITMAP_PX(0x630c), BITMAP_PX(0x6b4d), BITMAP_PX(0x4208), BITMAP_PX(0x52ab), BITMAP_PX(0x6b4d), BITMAP_PX(0x738e), BITMAP_PX(0x6b8e), BITMAP_PX(0x6b4d), BITMAP_PX(0x6b6d), BITMAP_PX(0x6b8e), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x5aa8), BITMAP_PX(0x5207), BITMAP_PX(0x3986), BITMAP_PX(0x5228), BITMAP_PX(0x732c), BITMAP_PX(0x3986), BITMAP_PX(0x636d), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x5aec), BITMAP_PX(0x3985), BITMAP_PX(0x6aca), BITMAP_PX(0x41c7), BITMAP_PX(0x62aa), 
+  BITMAP_PX(0x732b), BITMAP_PX(0x5a68), BITMAP_PX(0x4a07), BITMAP_PX(0x4a6a), BITMAP_PX(0x52ab), BITMAP_PX(0x5aec), BITMAP_PX(0x52ab), BITMAP_PX(0x4a49), BITMAP_PX(0x4209), BITMAP_PX(0x39c7), BITMAP_PX(0x39c7), BITMAP_PX(0x39e7), 
+  BITMAP_PX(0x5aeb), BITMAP_PX(0x2104), BITMAP_PX(0x18c3), BITMAP_PX(0x18e4), BITMAP_PX(0x2945), BITMAP_PX(0x5a69), BITMAP_PX(0x5268), BITMAP_PX(0x2965), BITMAP_PX(0x8410), BITMAP_PX(0x7bcf), BITMAP_PX(0x8c51), BITMAP_PX(0xc638), 
+  BITMAP_PX(0xbdf7), BITMAP_PX(0x8c71), BITMAP_PX(0x9491), BITMAP_PX(0x8410), BITMAP_PX(0x39a6), BITMAP_PX(0x6b0b), BITMAP_PX(0x39c7), BITMAP_PX(0x2125), BITMAP_PX(0x18c3), BITMAP_PX(0x0882), BITMAP_PX(0x4a49), BITMAP_PX(0x73af), 
+  BITMAP_PX(0x31a6), BITMAP_PX(0x4208), BITMAP_PX(0x4208), BITMAP_PX(0x4a49), BITMAP_PX(0x5acb), BITMAP_PX(0x634d), BITMAP_PX(0x738e), BITMAP_PX(0x6b6d), BITMAP_PX(0x630c), BITMAP_PX(0x4207), BITMAP_PX(0x72ea), BITMAP_PX(0x838c), 
+  BITMAP_PX(0x5a69), BITMAP_PX(0x5248), BITMAP_PX(0x7b2c), BITMAP_PX(0x39a6), BITMAP_PX(0x5acb), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x4a29), BITMAP_PX(0x3965), BITMAP_PX(0x6aca), BITMAP_PX(0x5a48), BITMAP_PX(0x732c), BITMAP_PX(0x9c2f), BITMAP_PX(0x940f), BITMAP_PX(0x6b2b), BITMAP_PX(0x6b6d), 
+  BITMAP_PX(0x4a49), BITMAP_PX(0x39c7), BITMAP_PX(0x39e7), BITMAP_PX(0x39e7), BITMAP_PX(0x3924), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52cb), BITMAP_PX(0x2104), BITMAP_PX(0x10a3), BITMAP_PX(0x18e4), 
+  BITMAP_PX(0x2104), BITMAP_PX(0x6289), BITMAP_PX(0x41c6), BITMAP_PX(0x4a49), BITMAP_PX(0x736d), BITMAP_PX(0x632c), BITMAP_PX(0x8c71), BITMAP_PX(0xffdf), BITMAP_PX(0xce58), BITMAP_PX(0x738e), BITMAP_PX(0x7bef), BITMAP_PX(0x7c10), 
+  BITMAP_PX(0x41e8), BITMAP_PX(0x6289), BITMAP_PX(0x41c6), BITMAP_PX(0x18e4), BITMAP_PX(0x10a3), BITMAP_PX(0x0882), BITMAP_PX(0x39c7), BITMAP_PX(0x7bf0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x2124), 
+  BITMAP_PX(0x4208), BITMAP_PX(0x4229), BITMAP_PX(0x4228), BITMAP_PX(0x4a69), BITMAP_PX(0x8430), BITMAP_PX(0x83ef), BITMAP_PX(0x9c70), BITMAP_PX(0xb513), BITMAP_PX(0x7b6c), BITMAP_PX(0x62a9), BITMAP_PX(0x7b2c), BITMAP_PX(0x39a6), 
+  BITMAP_PX(0x4a6a), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x41e8), 
+  BITMAP_PX(0x3945), BITMAP_PX(0x6aea), BITMAP_PX(0x62aa), BITMAP_PX(0x838d), BITMAP_PX(0xacb1), BITMAP_PX(0x9c50), BITMAP_PX(0x8c30), BITMAP_PX(0x5aec), BITMAP_PX(0x4a49), BITMAP_PX(0x4208), BITMAP_PX(0x31a7), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x4a6a), BITMAP_PX(0x2104), BITMAP_PX(0x10a3), BITMAP_PX(0x10c3), BITMAP_PX(0x18e4), BITMAP_PX(0x5248), BITMAP_PX(0x41c6), BITMAP_PX(0x4228), 
+  BITMAP_PX(0x5aeb), BITMAP_PX(0x5aec), BITMAP_PX(0x6b4d), BITMAP_PX(0x8410), BITMAP_PX(0x6b6d), BITMAP_PX(0x6b4c), BITMAP_PX(0x6b6d), BITMAP_PX(0x6b6e), BITMAP_PX(0x4208), BITMAP_PX(0x5a69), BITMAP_PX(0x39a6), BITMAP_PX(0x18c3), 
+  BITMAP_PX(0x1083), BITMAP_PX(0x0862), BITMAP_PX(0x3187), BITMAP_PX(0x6b4e), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39c7), BITMAP_PX(0x4a49), BITMAP_PX(0x4228), 
+  BITMAP_PX(0x5aeb), BITMAP_PX(0xa534), BITMAP_PX(0x9c71), BITMAP_PX(0xbd54), BITMAP_PX(0x9c50), BITMAP_PX(0x732c), BITMAP_PX(0x7b2c), BITMAP_PX(0x39a6), BITMAP_PX(0x4a49), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x4a4a), BITMAP_PX(0x3145), BITMAP_PX(0x730b), BITMAP_PX(0x730b), BITMAP_PX(0x838d), 
+  BITMAP_PX(0x9c50), BITMAP_PX(0x83ad), BITMAP_PX(0x5acb), BITMAP_PX(0x2966), BITMAP_PX(0x3166), BITMAP_PX(0x4a28), BITMAP_PX(0x3166), BITMAP_PX(0x2946), BITMAP_PX(0x3186), BITMAP_PX(0x2965), BITMAP_PX(0x3186), BITMAP_PX(0x2966), 
+  BITMAP_PX(0x39c7), BITMAP_PX(0x18e3), BITMAP_PX(0x0882), BITMAP_PX(0x10a3), BITMAP_PX(0x18c3), BITMAP_PX(0x39a6), BITMAP_PX(0x4a28), BITMAP_PX(0x31a6), BITMAP_PX(0x528a), BITMAP_PX(0x528a), BITMAP_PX(0x5aeb), BITMAP_PX(0x528a), 
+  BITMAP_PX(0x5acb), BITMAP_PX(0x5aeb), BITMAP_PX(0x528a), BITMAP_PX(0x5acb), BITMAP_PX(0x41e7), BITMAP_PX(0x6289), BITMAP_PX(0x2924), BITMAP_PX(0x10a3), BITMAP_PX(0x0882), BITMAP_PX(0x0041), BITMAP_PX(0x2945), BITMAP_PX(0x4208), 
+  BITMAP_PX(0x2986), BITMAP_PX(0x3186), BITMAP_PX(0x2986), BITMAP_PX(0x3186), BITMAP_PX(0x3186), BITMAP_PX(0x3186), BITMAP_PX(0x39c7), BITMAP_PX(0x31a7), BITMAP_PX(0x2145), BITMAP_PX(0x5aec), BITMAP_PX(0x7b6d), BITMAP_PX(0xa470), 
+  BITMAP_PX(0x9c2f), BITMAP_PX(0x838d), BITMAP_PX(0x7b4c), BITMAP_PX(0x39a6), BITMAP_PX(0x4a69), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x4a69), BITMAP_PX(0x3945), BITMAP_PX(0x730b), BITMAP_PX(0x730b), BITMAP_PX(0x7b4c), BITMAP_PX(0x836c), BITMAP_PX(0x6aaa), BITMAP_PX(0x3165), BITMAP_PX(0x2105), 
+  BITMAP_PX(0x10a3), BITMAP_PX(0x18e3), BITMAP_PX(0x18c3), BITMAP_PX(0x18e4), BITMAP_PX(0x18e4), BITMAP_PX(0x1904), BITMAP_PX(0x2104), BITMAP_PX(0x18e4), BITMAP_PX(0x2966), BITMAP_PX(0x18c3), BITMAP_PX(0x0841), BITMAP_PX(0x10a3), 
+  BITMAP_PX(0x10a3), BITMAP_PX(0x2104), BITMAP_PX(0x5269), BITMAP_PX(0x4208), BITMAP_PX(0x39e7), BITMAP_PX(0x4228), BITMAP_PX(0x4228), BITMAP_PX(0x4228), BITMAP_PX(0x4a69), BITMAP_PX(0x4a49), BITMAP_PX(0x3a08), BITMAP_PX(0x39e7), 
+  BITMAP_PX(0x5289), BITMAP_PX(0x4a27), BITMAP_PX(0x18c3), BITMAP_PX(0x0882), BITMAP_PX(0x0882), BITMAP_PX(0x0021), BITMAP_PX(0x2925), BITMAP_PX(0x2946), BITMAP_PX(0x2104), BITMAP_PX(0x2104), BITMAP_PX(0x2104), BITMAP_PX(0x2104), 
+  BITMAP_PX(0x2104), BITMAP_PX(0x18e4), BITMAP_PX(0x18c3), BITMAP_PX(0x10a3), BITMAP_PX(0x2105), BITMAP_PX(0x2966), BITMAP_PX(0x5a68), BITMAP_PX(0x7b4b), BITMAP_PX(0x7b6c), BITMAP_PX(0x838d), BITMAP_PX(0x7b2b), BITMAP_PX(0x39a6), 
+  BITMAP_PX(0x526a), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x62cc), 
+  BITMAP_PX(0x3145), BITMAP_PX(0x72ea), BITMAP_PX(0x730a), BITMAP_PX(0x5a69), BITMAP_PX(0x5a48), BITMAP_PX(0x49c6), BITMAP_PX(0x18a2), BITMAP_PX(0x1082), BITMAP_PX(0x0862), BITMAP_PX(0x0861), BITMAP_PX(0x0862), BITMAP_PX(0x0861), 
+  BITMAP_PX(0x0862), BITMAP_PX(0x0862), BITMAP_PX(0x0842), BITMAP_PX(0x0842), BITMAP_PX(0x18a3), BITMAP_PX(0x10a3), BITMAP_PX(0x2104), BITMAP_PX(0x18c3), BITMAP_PX(0x1083), BITMAP_PX(0x18c3), BITMAP_PX(0x3145), BITMAP_PX(0x6b0c), 
+  BITMAP_PX(0x52aa), BITMAP_PX(0x31c7), BITMAP_PX(0x3186), BITMAP_PX(0x2965), BITMAP_PX(0x3186), BITMAP_PX(0x3186), BITMAP_PX(0x39e7), BITMAP_PX(0x6b0b), BITMAP_PX(0x5a89), BITMAP_PX(0x20e3), BITMAP_PX(0x1082), BITMAP_PX(0x0862), 
+  BITMAP_PX(0x18e4), BITMAP_PX(0x18e4), BITMAP_PX(0x18e3), BITMAP_PX(0x10a3), BITMAP_PX(0x0862), BITMAP_PX(0x0862), BITMAP_PX(0x0862), BITMAP_PX(0x0862), BITMAP_PX(0x0862), BITMAP_PX(0x1062), BITMAP_PX(0x1082), BITMAP_PX(0x1082), 
+  BITMAP_PX(0x10a3), BITMAP_PX(0x18c3), BITMAP_PX(0x41a6), BITMAP_PX(0x6289), BITMAP_PX(0x6aca), BITMAP_PX(0x7b4d), BITMAP_PX(0x732b), BITMAP_PX(0x3965), BITMAP_PX(0x5aab), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x7c30), BITMAP_PX(0x3145), BITMAP_PX(0x6aa9), BITMAP_PX(0x72ea), BITMAP_PX(0x49c6), 
+  BITMAP_PX(0x3944), BITMAP_PX(0x20e3), BITMAP_PX(0x1061), BITMAP_PX(0x0841), BITMAP_PX(0x1062), BITMAP_PX(0x10a2), BITMAP_PX(0x18c3), BITMAP_PX(0x18e3), BITMAP_PX(0x18e3), BITMAP_PX(0x18e3), BITMAP_PX(0x18c3), BITMAP_PX(0x18c3), 
+  BITMAP_PX(0x1082), BITMAP_PX(0x1082), BITMAP_PX(0x4228), BITMAP_PX(0x2945), BITMAP_PX(0x1082), BITMAP_PX(0x1082), BITMAP_PX(0x18a3), BITMAP_PX(0x3165), BITMAP_PX(0x734d), BITMAP_PX(0x83ef), BITMAP_PX(0x6b6d), BITMAP_PX(0x5aeb), 
+  BITMAP_PX(0x5acb), BITMAP_PX(0x736d), BITMAP_PX(0x83ef), BITMAP_PX(0x5aca), BITMAP_PX(0x20e3), BITMAP_PX(0x1062), BITMAP_PX(0x0862), BITMAP_PX(0x1082), BITMAP_PX(0x2966), BITMAP_PX(0x39e8), BITMAP_PX(0x0861), BITMAP_PX(0x18c3), 
+  BITMAP_PX(0x18c3), BITMAP_PX(0x18e4), BITMAP_PX(0x2104), BITMAP_PX(0x2104), BITMAP_PX(0x2104), BITMAP_PX(0x18e3), BITMAP_PX(0x18c3), BITMAP_PX(0x1082), BITMAP_PX(0x0862), BITMAP_PX(0x1082), BITMAP_PX(0x2903), BITMAP_PX(0x49c7), 
+  BITMAP_PX(0x5248), BITMAP_PX(0x730c), BITMAP_PX(0x6aea), BITMAP_PX(0x3165), BITMAP_PX(0x632d), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x3145), BITMAP_PX(0x6248), BITMAP_PX(0x6aca), BITMAP_PX(0x3944), BITMAP_PX(0x20c2), BITMAP_PX(0x20c2), BITMAP_PX(0x18c3), BITMAP_PX(0x18e3), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x4208), 
+  BITMAP_PX(0x1904), BITMAP_PX(0x0862), BITMAP_PX(0x0862), BITMAP_PX(0x10a3), BITMAP_PX(0x20e3), BITMAP_PX(0x4a28), BITMAP_PX(0x736d), BITMAP_PX(0x83ef), BITMAP_PX(0x83ee), BITMAP_PX(0x6b2c), BITMAP_PX(0x39a5), BITMAP_PX(0x10a1), 
+  BITMAP_PX(0x0861), BITMAP_PX(0x0821), BITMAP_PX(0x0841), BITMAP_PX(0x2145), BITMAP_PX(0x5acb), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x2945), BITMAP_PX(0x10a2), BITMAP_PX(0x2903), BITMAP_PX(0x3124), BITMAP_PX(0x41a6), BITMAP_PX(0x730b), BITMAP_PX(0x6289), BITMAP_PX(0x3165), 
+  BITMAP_PX(0xe71c), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x3165), BITMAP_PX(0x49e6), BITMAP_PX(0x72ca), BITMAP_PX(0x30e3), BITMAP_PX(0x28e3), BITMAP_PX(0x4a07), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x3186), BITMAP_PX(0x0000), BITMAP_PX(0xbdf7), BITMAP_PX(0x39e8), BITMAP_PX(0x18c3), BITMAP_PX(0x0041), BITMAP_PX(0x0862), 
+  BITMAP_PX(0x0862), BITMAP_PX(0x0861), BITMAP_PX(0x1082), BITMAP_PX(0x10a2), BITMAP_PX(0x10a2), BITMAP_PX(0x1061), BITMAP_PX(0x0861), BITMAP_PX(0x0841), BITMAP_PX(0x0801), BITMAP_PX(0x0820), BITMAP_PX(0x2104), BITMAP_PX(0x52aa), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x2945), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x5227), BITMAP_PX(0x3964), BITMAP_PX(0x3965), BITMAP_PX(0x6b0b), BITMAP_PX(0x5228), BITMAP_PX(0x3165), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x39c6), BITMAP_PX(0x3985), BITMAP_PX(0x72ea), BITMAP_PX(0x3923), 
+  BITMAP_PX(0x3944), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xbdf7), BITMAP_PX(0x39e8), BITMAP_PX(0x18e4), BITMAP_PX(0x0021), BITMAP_PX(0x0021), BITMAP_PX(0x0821), BITMAP_PX(0x0842), BITMAP_PX(0x0842), 
+  BITMAP_PX(0x0841), BITMAP_PX(0x0041), BITMAP_PX(0x0020), BITMAP_PX(0x0000), BITMAP_PX(0x0841), BITMAP_PX(0x2945), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xd555), BITMAP_PX(0x49a5), 
+  BITMAP_PX(0x3985), BITMAP_PX(0x732b), BITMAP_PX(0x41c6), BITMAP_PX(0x3186), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x4a49), BITMAP_PX(0x3145), BITMAP_PX(0x6aaa), BITMAP_PX(0x4185), BITMAP_PX(0x3923), BITMAP_PX(0xb512), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x4a6a), BITMAP_PX(0x2945), BITMAP_PX(0x1082), BITMAP_PX(0x0021), BITMAP_PX(0x0021), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0841), BITMAP_PX(0x18e4), 
+  BITMAP_PX(0x31a6), BITMAP_PX(0xb596), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x936d), BITMAP_PX(0x49a5), BITMAP_PX(0x51e7), BITMAP_PX(0x730b), BITMAP_PX(0x3144), BITMAP_PX(0x4a29), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x8c52), BITMAP_PX(0x3145), BITMAP_PX(0x5207), BITMAP_PX(0x5a27), BITMAP_PX(0x3122), BITMAP_PX(0x62a8), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x18c3), 
+  BITMAP_PX(0x1082), BITMAP_PX(0x0000), BITMAP_PX(0x0861), BITMAP_PX(0x1082), BITMAP_PX(0x1082), BITMAP_PX(0x0021), BITMAP_PX(0x0021), BITMAP_PX(0x18c3), BITMAP_PX(0x18e4), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x6ac9), BITMAP_PX(0x4185), BITMAP_PX(0x6aca), BITMAP_PX(0x5a69), BITMAP_PX(0x2924), BITMAP_PX(0x9cf3), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39a6), BITMAP_PX(0x3965), BITMAP_PX(0x6aca), 
+  BITMAP_PX(0x3943), BITMAP_PX(0x49a5), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x2104), BITMAP_PX(0x2104), BITMAP_PX(0x0841), BITMAP_PX(0x0841), 
+  BITMAP_PX(0x0841), BITMAP_PX(0x1082), BITMAP_PX(0x18e3), BITMAP_PX(0x0841), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52a0), BITMAP_PX(0x0000), BITMAP_PX(0x5a27), BITMAP_PX(0x49a6), 
+  BITMAP_PX(0x7b6c), BITMAP_PX(0x3985), BITMAP_PX(0x3186), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x528a), BITMAP_PX(0x2924), BITMAP_PX(0x6289), BITMAP_PX(0x5207), BITMAP_PX(0x3103), BITMAP_PX(0x8b4c), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x73ae), BITMAP_PX(0x18c3), BITMAP_PX(0x2124), BITMAP_PX(0x18c3), BITMAP_PX(0x4208), BITMAP_PX(0x73ae), BITMAP_PX(0x18c3), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x8b8b), BITMAP_PX(0x49a5), BITMAP_PX(0x5a89), BITMAP_PX(0x62a9), BITMAP_PX(0x2104), BITMAP_PX(0x4249), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0xd6ba), BITMAP_PX(0x3145), BITMAP_PX(0x3985), BITMAP_PX(0x732c), BITMAP_PX(0x3123), BITMAP_PX(0x41a4), BITMAP_PX(0x0000), BITMAP_PX(0x5000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x4208), BITMAP_PX(0x8c51), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0841), BITMAP_PX(0x632c), BITMAP_PX(0x0861), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52a0), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x5227), BITMAP_PX(0x49c6), BITMAP_PX(0x7b4c), BITMAP_PX(0x3944), BITMAP_PX(0x2945), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x4208), BITMAP_PX(0x2103), 
+  BITMAP_PX(0x6268), BITMAP_PX(0x5a89), BITMAP_PX(0x3122), BITMAP_PX(0x6a68), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x31a6), BITMAP_PX(0x7bcf), BITMAP_PX(0x0000), BITMAP_PX(0x5aeb), 
+  BITMAP_PX(0x0000), BITMAP_PX(0xef7d), BITMAP_PX(0x5acb), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x72e9), BITMAP_PX(0x41a5), BITMAP_PX(0x6aeb), BITMAP_PX(0x5a48), 
+  BITMAP_PX(0x20e3), BITMAP_PX(0x4249), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xad55), BITMAP_PX(0x3165), BITMAP_PX(0x2924), BITMAP_PX(0x732c), BITMAP_PX(0x49c6), BITMAP_PX(0x3944), 
+  BITMAP_PX(0xbd75), BITMAP_PX(0x0000), BITMAP_PX(0x7be0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x2965), BITMAP_PX(0x6b6d), BITMAP_PX(0x0000), BITMAP_PX(0x632c), BITMAP_PX(0x0000), BITMAP_PX(0xb5b6), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x9c0e), BITMAP_PX(0x41a5), BITMAP_PX(0x5a69), BITMAP_PX(0x732b), BITMAP_PX(0x20e2), BITMAP_PX(0x2965), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x4a6a), BITMAP_PX(0x2104), BITMAP_PX(0x41a5), BITMAP_PX(0x7b4d), BITMAP_PX(0x3944), BITMAP_PX(0x4185), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x2104), BITMAP_PX(0x630c), BITMAP_PX(0x0020), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x9cf3), BITMAP_PX(0x4a49), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xf800), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x49e6), 
+  BITMAP_PX(0x4a07), BITMAP_PX(0x7b6d), BITMAP_PX(0x3944), BITMAP_PX(0x18e3), BITMAP_PX(0x4a8a), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x39e7), BITMAP_PX(0x20c3), BITMAP_PX(0x6269), BITMAP_PX(0x730b), BITMAP_PX(0x3143), BITMAP_PX(0x49e7), BITMAP_PX(0x0000), BITMAP_PX(0x39e0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0861), BITMAP_PX(0x5acb), BITMAP_PX(0xffff), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x8c51), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xf800), BITMAP_PX(0x0000), BITMAP_PX(0x0020), BITMAP_PX(0x5247), BITMAP_PX(0x41a5), BITMAP_PX(0x732c), BITMAP_PX(0x49c5), BITMAP_PX(0x18c2), BITMAP_PX(0x39a7), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7c71), BITMAP_PX(0x3166), BITMAP_PX(0x30e2), BITMAP_PX(0x6aa9), 
+  BITMAP_PX(0x72ea), BITMAP_PX(0x4164), BITMAP_PX(0x5207), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x4a69), BITMAP_PX(0xb596), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x31a6), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x5248), BITMAP_PX(0x41a5), BITMAP_PX(0x734c), BITMAP_PX(0x49e6), BITMAP_PX(0x1881), BITMAP_PX(0x2966), BITMAP_PX(0xce7f), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x5acb), BITMAP_PX(0x3144), BITMAP_PX(0x28c2), BITMAP_PX(0x6289), BITMAP_PX(0x72ca), BITMAP_PX(0x4164), BITMAP_PX(0x5207), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x4208), BITMAP_PX(0x9492), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x6b6e), BITMAP_PX(0x2965), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0020), BITMAP_PX(0x4a07), BITMAP_PX(0x4165), BITMAP_PX(0x732c), BITMAP_PX(0x5a68), 
+  BITMAP_PX(0x1061), BITMAP_PX(0x2945), BITMAP_PX(0x632d), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x4a69), BITMAP_PX(0x2904), BITMAP_PX(0x1882), BITMAP_PX(0x6269), BITMAP_PX(0x72eb), BITMAP_PX(0x4185), BITMAP_PX(0x41c6), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39c7), BITMAP_PX(0x9cd3), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x6b6d), BITMAP_PX(0x2124), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), 
+  BITMAP_PX(0x5000), BITMAP_PX(0x0000), BITMAP_PX(0xad53), BITMAP_PX(0x49e6), BITMAP_PX(0x49c6), BITMAP_PX(0x730b), BITMAP_PX(0x5208), BITMAP_PX(0x1061), BITMAP_PX(0x2104), BITMAP_PX(0x4aab), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e7), BITMAP_PX(0x0000), BITMAP_PX(0x4229), 
+  BITMAP_PX(0x2104), BITMAP_PX(0x1881), BITMAP_PX(0x5a48), BITMAP_PX(0x7b2c), BITMAP_PX(0x49e6), BITMAP_PX(0x3964), BITMAP_PX(0x5a89), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e0), BITMAP_PX(0x7800), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x2084), BITMAP_PX(0x2904), BITMAP_PX(0x6b2c), BITMAP_PX(0x62ea), BITMAP_PX(0x7b8d), BITMAP_PX(0x62ca), BITMAP_PX(0x20e2), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x5000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x6289), BITMAP_PX(0x41a5), BITMAP_PX(0x5a28), 
+  BITMAP_PX(0x836d), BITMAP_PX(0x49e6), BITMAP_PX(0x1061), BITMAP_PX(0x2104), BITMAP_PX(0x4a49), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e0), BITMAP_PX(0x0000), BITMAP_PX(0x4a49), BITMAP_PX(0x2124), BITMAP_PX(0x1061), BITMAP_PX(0x41c6), 
+  BITMAP_PX(0x7b6d), BITMAP_PX(0x6289), BITMAP_PX(0x3984), BITMAP_PX(0x3984), BITMAP_PX(0x730a), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x39e0), BITMAP_PX(0x52a0), BITMAP_PX(0x4924), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x41a5), BITMAP_PX(0x51e6), BITMAP_PX(0x6aea), BITMAP_PX(0x732b), BITMAP_PX(0x730b), BITMAP_PX(0x5a68), BITMAP_PX(0x41a5), BITMAP_PX(0x5a68), BITMAP_PX(0x0000), BITMAP_PX(0x52a5), BITMAP_PX(0x39e7), BITMAP_PX(0x39e7), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x732b), BITMAP_PX(0x49c6), BITMAP_PX(0x51c6), BITMAP_PX(0x7aea), BITMAP_PX(0x834c), BITMAP_PX(0x3944), BITMAP_PX(0x1061), BITMAP_PX(0x2924), BITMAP_PX(0x4a69), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x500a), BITMAP_PX(0x0000), BITMAP_PX(0x4a89), BITMAP_PX(0x2924), BITMAP_PX(0x1861), BITMAP_PX(0x28e3), BITMAP_PX(0x6aca), BITMAP_PX(0x7b4c), BITMAP_PX(0x5a47), 
+  BITMAP_PX(0x3964), BITMAP_PX(0x3944), BITMAP_PX(0x41e5), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x736c), BITMAP_PX(0x41a5), BITMAP_PX(0x6ac9), BITMAP_PX(0x838d), BITMAP_PX(0x838d), 
+  BITMAP_PX(0x838d), BITMAP_PX(0x7b4c), BITMAP_PX(0x5227), BITMAP_PX(0x49e6), BITMAP_PX(0x842f), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x6289), BITMAP_PX(0x49c5), BITMAP_PX(0x51c5), 
+  BITMAP_PX(0x72ca), BITMAP_PX(0x8bad), BITMAP_PX(0x6aa9), BITMAP_PX(0x20a1), BITMAP_PX(0x1882), BITMAP_PX(0x2945), BITMAP_PX(0x6b4d), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x6b6f), BITMAP_PX(0x3186), BITMAP_PX(0x18a2), BITMAP_PX(0x1061), BITMAP_PX(0x4185), BITMAP_PX(0x732b), BITMAP_PX(0x7b4c), BITMAP_PX(0x5a89), BITMAP_PX(0x3985), BITMAP_PX(0x3143), 
+  BITMAP_PX(0x3123), BITMAP_PX(0x41a5), BITMAP_PX(0x49c5), BITMAP_PX(0x49a5), BITMAP_PX(0x5207), BITMAP_PX(0x7b4c), BITMAP_PX(0x8bae), BITMAP_PX(0x8bae), BITMAP_PX(0x8bce), BITMAP_PX(0x8bae), BITMAP_PX(0x72ea), BITMAP_PX(0x5227), 
+  BITMAP_PX(0x5206), BITMAP_PX(0x5a26), BITMAP_PX(0x5a27), BITMAP_PX(0x51e6), BITMAP_PX(0x49c5), BITMAP_PX(0x51e7), BITMAP_PX(0x72ea), BITMAP_PX(0x93ad), BITMAP_PX(0x834c), BITMAP_PX(0x4164), BITMAP_PX(0x1041), BITMAP_PX(0x18a3), 
+  BITMAP_PX(0x2986), BITMAP_PX(0xffff), BITMAP_PX(0x0000), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x39e7), BITMAP_PX(0x2104), BITMAP_PX(0x1082), BITMAP_PX(0x1861), BITMAP_PX(0x4185), BITMAP_PX(0x730b), BITMAP_PX(0x7b8d), BITMAP_PX(0x732b), BITMAP_PX(0x5a69), BITMAP_PX(0x49e6), BITMAP_PX(0x41c6), BITMAP_PX(0x5207), 
+  BITMAP_PX(0x6aea), BITMAP_PX(0x838d), BITMAP_PX(0x83ad), BITMAP_PX(0x8bad), BITMAP_PX(0x8bce), BITMAP_PX(0x8bae), BITMAP_PX(0x838d), BITMAP_PX(0x730a), BITMAP_PX(0x6268), BITMAP_PX(0x6248), BITMAP_PX(0x6a88), BITMAP_PX(0x72ea), 
+  BITMAP_PX(0x836c), BITMAP_PX(0x8b8d), BITMAP_PX(0x72ea), BITMAP_PX(0x4184), BITMAP_PX(0x1861), BITMAP_PX(0x1061), BITMAP_PX(0x2104), BITMAP_PX(0x4209), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x8c51), BITMAP_PX(0x3186), BITMAP_PX(0x20e3), 
+  BITMAP_PX(0x1061), BITMAP_PX(0x1041), BITMAP_PX(0x2903), BITMAP_PX(0x5228), BITMAP_PX(0x730b), BITMAP_PX(0x836d), BITMAP_PX(0x83ad), BITMAP_PX(0x8bae), BITMAP_PX(0x8bee), BITMAP_PX(0x940f), BITMAP_PX(0x940f), BITMAP_PX(0x940f), 
+  BITMAP_PX(0x942f), BITMAP_PX(0x9c30), BITMAP_PX(0x9c50), BITMAP_PX(0x9c50), BITMAP_PX(0x940f), BITMAP_PX(0x93ce), BITMAP_PX(0x8bad), BITMAP_PX(0x7b2b), BITMAP_PX(0x5a07), BITMAP_PX(0x28e2), BITMAP_PX(0x1040), BITMAP_PX(0x1061), 
+  BITMAP_PX(0x18c3), BITMAP_PX(0x31a6), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x5000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x73ae), BITMAP_PX(0x31a7), BITMAP_PX(0x1904), BITMAP_PX(0x1062), BITMAP_PX(0x0820), 
+  BITMAP_PX(0x1040), BITMAP_PX(0x20a2), BITMAP_PX(0x3944), BITMAP_PX(0x49c6), BITMAP_PX(0x6268), BITMAP_PX(0x6ac9), BITMAP_PX(0x6aea), BITMAP_PX(0x6aea), BITMAP_PX(0x6aca), BITMAP_PX(0x62a9), BITMAP_PX(0x5a48), BITMAP_PX(0x51e6), 
+  BITMAP_PX(0x4185), BITMAP_PX(0x3923), BITMAP_PX(0x28a2), BITMAP_PX(0x1841), BITMAP_PX(0x1020), BITMAP_PX(0x1061), BITMAP_PX(0x20e3), BITMAP_PX(0x3186), BITMAP_PX(0x0020), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0x4228), BITMAP_PX(0x2945), BITMAP_PX(0x18c3), BITMAP_PX(0x1061), BITMAP_PX(0x0820), BITMAP_PX(0x0800), 
+  BITMAP_PX(0x0820), BITMAP_PX(0x0820), BITMAP_PX(0x0820), BITMAP_PX(0x0800), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0020), BITMAP_PX(0x0840), BITMAP_PX(0x1061), BITMAP_PX(0x18c3), 
+  BITMAP_PX(0x2945), BITMAP_PX(0x4a4a), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x000a), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0020), BITMAP_PX(0x528a), BITMAP_PX(0x31a7), BITMAP_PX(0x2945), BITMAP_PX(0x2104), BITMAP_PX(0x18c3), BITMAP_PX(0x18c3), BITMAP_PX(0x10a2), 
+  BITMAP_PX(0x10a2), BITMAP_PX(0x18c3), BITMAP_PX(0x18e3), BITMAP_PX(0x1904), BITMAP_PX(0x2965), BITMAP_PX(0x31c7), BITMAP_PX(0x7bef), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x52aa), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000)
 };
 
-const bitmap handle_80x80_bitmap = { 80, 80, (uint16_t*)handle_80x80_pixels };
+const bitmap handle_80x80_bitmap = { 80, 80, (uint16_t*)handle_80x80_pixels, BITMAP_RAW, NULL, 0 };
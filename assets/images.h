@@ -2,8 +2,29 @@
 
 #include <stdint.h>
 
+// Pixel data layout of a bitmap
+typedef enum {
+    BITMAP_RAW = 0,  // Uncompressed pixels in bitmap->bitmap
+    BITMAP_RLE = 1   // Row-wise RLE stream in bitmap->data (see bitmap_rle.h)
+} bitmap_format_t;
+
+// Compressed bitmaps leave .bitmap NULL, so code that needs random pixel
+// access (rotation, sprites) skips them; fb_draw_bitmap() and
+// fb_restore_bitmap_region() accept both formats.
 typedef struct bitmap {
     uint16_t width;
     uint16_t height;
-    uint16_t* bitmap;
+    uint16_t* bitmap;     // BITMAP_RAW pixels (NULL otherwise)
+    uint8_t format;       // bitmap_format_t
+    const uint8_t* data;  // Encoded stream for compressed formats
+    uint32_t data_size;   // Encoded stream size in bytes
 } bitmap;
+
+// Pixel literal in frame buffer storage order.
+// With FB_WIRE_ORDER, RGB565 values are stored high byte first in memory
+// (the order the ST7789 expects), so they are byte-swapped on little-endian CPUs.
+#if defined(FB_WIRE_ORDER) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define BITMAP_PX(v) ((uint16_t)((((v) & 0x00FFu) << 8) | (((v) >> 8) & 0x00FFu)))
+#else
+#define BITMAP_PX(v) ((uint16_t)(v))
+#endif
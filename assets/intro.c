@@ -1,4809 +1,4621 @@
-// Generated by png2bitmap_rgb565_c_h_pragonce.py
+// Generated by png2c.py: python3 assets/png2c.py --rle assets/image/intro_240x240.png --out-c assets/intro.c --out-h assets/intro.h
+#include <stddef.h>
 #include <stdint.h>
 #include "intro.h"
 
-// 240x240, RGB565 format
-static const uint16_t intro_240x240_pixels[57600] = {
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 
-  0x12c8, 0x1287, 0x01c5, 0x01c6, 0x0a27, 0x1b28, 0x01e6, 0x01c6, 0x12c7, 0x12a7, 0x01e5, 0x2328, 
-  0x0a26, 0x01c6, 0x01e6, 0x09e6, 0x01e7, 0x09e7, 0x09e7, 0x01e7, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x0206, 0x1b28, 0x0a26, 0x01c6, 0x01e6, 0x01e6, 0x01c5, 0x1b08, 0x0a67, 0x01c6, 
-  0x01c6, 0x0a87, 0x1b08, 0x01c6, 0x01e6, 0x01e5, 0x1b08, 0x0a26, 0x01c6, 0x01e6, 0x01e7, 0x01e6, 
-  0x1b08, 0x12a7, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 
-  0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01c6, 0x12a7, 
-  0x12c7, 0x01c6, 0x01e6, 0x1b08, 0x0a06, 0x01a6, 0x1287, 0x1ae8, 0x01c6, 0x01e6, 0x1b08, 0x0a26, 
-  0x01c5, 0x0a87, 0x1b08, 0x01c5, 0x12e7, 0x12a7, 0x01c6, 0x09e6, 0x01e6, 0x01c6, 0x1287, 0x12e7, 
-  0x01a5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a26, 
-  0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x12c7, 0x1287, 0x01c6, 0x01e7, 0x01e6, 0x01c6, 0x0a87, 0x12e8, 
-  0x01c6, 0x01e6, 0x01e6, 0x01c5, 0x0a46, 0x1b28, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b28, 0x0205, 0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x09e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 0x09e7, 0x09e7, 
-  0x01e7, 0x09e6, 0x01c6, 0x0226, 0x2348, 0x0206, 0x01c6, 0x09e6, 0x01e6, 0x1b08, 0x0a66, 0x01a6, 
-  0x01e6, 0x01a6, 0x1287, 0x12c7, 0x01c5, 0x01e6, 0x01c6, 0x01c6, 0x0a46, 0x2328, 0x01e6, 0x01c6, 
-  0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x0a07, 0x09e7, 0x09e7, 0x0a07, 0x0a27, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x09e7, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01c5, 
-  0x12c8, 0x1287, 0x01c5, 0x01c6, 0x0a26, 0x1b28, 0x01e6, 0x01c6, 0x12c7, 0x1287, 0x01e5, 0x1b28, 
-  0x0a26, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x01e7, 0x09e6, 0x09e7, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x0206, 0x1b28, 0x0a26, 0x01c6, 0x01e6, 0x01c6, 0x01c5, 0x1b08, 0x0a67, 0x01a6, 
-  0x01c6, 0x0a87, 0x1b08, 0x01c6, 0x01e6, 0x01e5, 0x1b08, 0x0a26, 0x01a6, 0x09e6, 0x09e7, 0x01e6, 
-  0x1b08, 0x12a7, 0x01c5, 0x01c6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x09c6, 0x01c5, 0x12a7, 
-  0x12c7, 0x01c6, 0x01e6, 0x1b28, 0x0a27, 0x01a6, 0x1287, 0x1ac8, 0x01c6, 0x01e6, 0x1b08, 0x0a26, 
-  0x01c5, 0x0a67, 0x1b08, 0x01a5, 0x12c7, 0x1287, 0x01c6, 0x09e6, 0x09e7, 0x01c6, 0x1287, 0x1ae7, 
-  0x01a5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a26, 
-  0x01c6, 0x01e6, 0x01e7, 0x01c6, 0x12c7, 0x1287, 0x01c6, 0x01e7, 0x01e6, 0x01c6, 0x0a87, 0x1ae8, 
-  0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 0x1b28, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b28, 0x0205, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01e7, 0x01e6, 0x01c6, 0x0226, 0x2348, 0x0a06, 0x01c6, 0x09e7, 0x01c5, 0x1b08, 0x0a67, 0x01c5, 
-  0x01e6, 0x01a6, 0x1287, 0x12c8, 0x01c5, 0x01e6, 0x01c6, 0x01c6, 0x0a46, 0x1b28, 0x01e6, 0x01c6, 
-  0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x0a07, 0x0a27, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x09e7, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x01c5, 
-  0x12c7, 0x1287, 0x01c5, 0x01c6, 0x0a26, 0x1b08, 0x01e5, 0x01c6, 0x12c7, 0x1287, 0x01e5, 0x1b28, 
-  0x0a26, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x01e6, 
-  0x09e6, 0x01e6, 0x01e6, 0x1b28, 0x0a26, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a67, 0x01a6, 
-  0x01c6, 0x0a86, 0x1b08, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a46, 0x01a6, 0x09e6, 0x09e7, 0x01c5, 
-  0x1b08, 0x12a7, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x09e6, 0x01c6, 0x12a7, 
-  0x12c7, 0x01c6, 0x01e6, 0x1b28, 0x0a27, 0x01a6, 0x1287, 0x1ac8, 0x01c6, 0x01e5, 0x1b08, 0x0a46, 
-  0x01c5, 0x0a67, 0x1ae8, 0x01c5, 0x12c7, 0x1287, 0x01c6, 0x01e6, 0x01e7, 0x01c6, 0x1287, 0x12e7, 
-  0x01c5, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a46, 
-  0x01c6, 0x01e6, 0x01e7, 0x01c6, 0x12c7, 0x1287, 0x01c6, 0x09e7, 0x01e6, 0x01c6, 0x0a87, 0x12e8, 
-  0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 0x1b08, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x0205, 
-  0x1b28, 0x0205, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 
-  0x09e7, 0x01e6, 0x01c6, 0x0226, 0x2348, 0x0206, 0x01c6, 0x09e6, 0x01c5, 0x1b08, 0x0a67, 0x01a5, 
-  0x01c6, 0x01a6, 0x1287, 0x12c8, 0x01c5, 0x01e6, 0x01c6, 0x01c6, 0x0a46, 0x1b28, 0x01e6, 0x09e6, 
-  0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x0a27, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x01e6, 0x09e6, 0x01c5, 
-  0x12c7, 0x1287, 0x01c5, 0x01c6, 0x0a26, 0x1b28, 0x01e6, 0x01c6, 0x12c7, 0x1287, 0x01e5, 0x1b28, 
-  0x0a26, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e6, 0x01e6, 
-  0x09e6, 0x01e6, 0x01e6, 0x1b28, 0x0a26, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a67, 0x01a6, 
-  0x01c6, 0x0a86, 0x1b08, 0x01c6, 0x01c6, 0x01c5, 0x1b28, 0x0a46, 0x01c6, 0x09e6, 0x09e6, 0x01c5, 
-  0x1b08, 0x12a7, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x09e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01c6, 0x09e7, 0x01a5, 0x12a7, 
-  0x1ae8, 0x01c5, 0x0206, 0x1b08, 0x0a26, 0x01a6, 0x0a66, 0x1ac8, 0x01c6, 0x01e5, 0x1b08, 0x0a26, 
-  0x01c5, 0x0a66, 0x1ae8, 0x01c5, 0x12c7, 0x1287, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0a87, 0x12e7, 
-  0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e5, 0x1b08, 0x0a46, 
-  0x01c6, 0x01c6, 0x01e6, 0x01c5, 0x12c7, 0x1287, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0a87, 0x12e8, 
-  0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 0x1b08, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0205, 
-  0x1b28, 0x0205, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x09e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09c6, 0x09e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x01c6, 0x0226, 0x2348, 0x0206, 0x01c6, 0x01e6, 0x01c5, 0x1b08, 0x0a66, 0x01c5, 
-  0x09e6, 0x01a6, 0x1287, 0x12c8, 0x01c5, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 0x1b08, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 
-  0x12c7, 0x1287, 0x01c5, 0x01c6, 0x0a26, 0x1b28, 0x01e6, 0x01c6, 0x12c7, 0x1287, 0x01e5, 0x1b28, 
-  0x0a26, 0x01c6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x09e6, 0x01e6, 
-  0x09e6, 0x01c6, 0x0206, 0x1b28, 0x0a26, 0x01c6, 0x01e6, 0x01c6, 0x01c5, 0x1b08, 0x0a67, 0x01c6, 
-  0x01c6, 0x0a87, 0x1b08, 0x01c6, 0x01c6, 0x01c5, 0x1b28, 0x0a46, 0x01c6, 0x09e7, 0x09e7, 0x01c5, 
-  0x1b08, 0x12a7, 0x01c6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 
-  0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x01e6, 0x01e7, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x01c6, 0x0a26, 0x1ae7, 
-  0x0a66, 0x01c6, 0x01e6, 0x1b08, 0x0a26, 0x01a6, 0x0a87, 0x12c7, 0x01c6, 0x01e5, 0x1b08, 0x0a26, 
-  0x01a5, 0x0a66, 0x1b08, 0x01c5, 0x12e7, 0x1287, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0a87, 0x12e7, 
-  0x01c5, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e5, 0x1b08, 0x0a46, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x12c7, 0x1287, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x0a87, 0x12e7, 
-  0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 0x1b28, 0x01c5, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b28, 0x0205, 0x01c6, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09c7, 0x09e7, 0x01e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x09e7, 0x09e6, 0x09c6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09c6, 
-  0x09e6, 0x09e6, 0x01c6, 0x0226, 0x2348, 0x0206, 0x01e6, 0x01e6, 0x01c5, 0x1b08, 0x0a66, 0x01a5, 
-  0x09c6, 0x01a6, 0x1287, 0x12c8, 0x01c5, 0x01e6, 0x01e6, 0x01c6, 0x0a26, 0x1b08, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x09e7, 0x0a07, 0x0a07, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 
-  0x12c7, 0x1287, 0x01c5, 0x01c6, 0x0a27, 0x1b08, 0x01e6, 0x01c6, 0x12c7, 0x1287, 0x01c5, 0x1b28, 
-  0x0a26, 0x01c6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x01e7, 0x09e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01e6, 0x1b28, 0x0a26, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a67, 0x01c6, 
-  0x01c6, 0x0a86, 0x1b07, 0x01c5, 0x01c6, 0x01c5, 0x1b28, 0x0a46, 0x01c6, 0x09e6, 0x09e6, 0x01c6, 
-  0x1b08, 0x12a7, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 
-  0x09e6, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09c6, 
-  0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x0a26, 0x1ae8, 0x0a67, 
-  0x01e6, 0x01e6, 0x01e5, 0x1b08, 0x0a26, 0x01a6, 0x0a66, 0x12c7, 0x01c6, 0x01e6, 0x1b08, 0x0a26, 
-  0x01a6, 0x0a66, 0x1ae8, 0x01c5, 0x12c7, 0x1287, 0x01c5, 0x01e6, 0x01e6, 0x01c6, 0x0a87, 0x1ae7, 
-  0x01c5, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e5, 0x1b08, 0x0a46, 
-  0x01c6, 0x01e6, 0x09c6, 0x01c6, 0x12c7, 0x1287, 0x01c6, 0x01e6, 0x01c6, 0x01a6, 0x0a87, 0x12e7, 
-  0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 0x1b08, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b28, 0x0205, 0x01c6, 0x01e6, 0x01e6, 0x09e7, 0x09e6, 0x01e6, 0x01e6, 0x01c6, 0x09e6, 0x09e6, 
-  0x09e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x09e6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x09e6, 0x01c6, 0x0226, 0x2348, 0x0206, 0x01c6, 0x09e6, 0x01c5, 0x1b08, 0x0a66, 0x01a5, 
-  0x09c6, 0x01a5, 0x1287, 0x12c7, 0x01c5, 0x01e6, 0x01c6, 0x01c6, 0x0a26, 0x1b08, 0x01e6, 0x09e6, 
-  0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x09e7, 0x0a07, 0x0a07, 
-  0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 
-  0x12c8, 0x1287, 0x01c5, 0x01c6, 0x0a26, 0x1b08, 0x01e5, 0x01c6, 0x12c7, 0x1287, 0x01e5, 0x1b28, 
-  0x0a26, 0x01c6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01e6, 0x1b28, 0x0206, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x1b08, 0x0a67, 0x01c6, 
-  0x0a46, 0x23a8, 0x23c8, 0x1286, 0x01c5, 0x01c6, 0x1b08, 0x0a26, 0x01c6, 0x01e6, 0x01e6, 0x01c5, 
-  0x1b08, 0x12a7, 0x01c5, 0x01e6, 0x09e6, 0x09e7, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x09c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 0x1ac8, 0x0a26, 0x01c6, 
-  0x01c6, 0x01e6, 0x12c7, 0x1b08, 0x0a06, 0x01a6, 0x0a67, 0x1ac8, 0x01a6, 0x01e5, 0x1b08, 0x0a26, 
-  0x01c6, 0x0a66, 0x1ae8, 0x01a5, 0x12c7, 0x1287, 0x01c5, 0x09e6, 0x01e6, 0x01c5, 0x1287, 0x12e7, 
-  0x01c5, 0x01e6, 0x09e7, 0x09e7, 0x09e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a26, 
-  0x01c6, 0x01c6, 0x01e6, 0x01c5, 0x12c7, 0x1287, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0a87, 0x12e8, 
-  0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 0x1b08, 0x01e5, 0x01e6, 0x01e6, 0x09c6, 0x01c6, 0x0206, 
-  0x1b28, 0x0205, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x09e6, 0x09e6, 
-  0x09e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x0226, 0x2348, 0x0206, 0x01e6, 0x09e6, 0x01c5, 0x1b08, 0x0a66, 0x01a5, 
-  0x09e6, 0x01a6, 0x0a87, 0x12c7, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x0a26, 0x1b08, 0x01e6, 0x01e6, 
-  0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x09e7, 0x09e6, 0x09e7, 0x0a07, 0x0a07, 0x09e7, 0x0a07, 0x0a07, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 
-  0x12c8, 0x12a7, 0x01c5, 0x01c6, 0x0a26, 0x1b08, 0x01e5, 0x01c6, 0x12c7, 0x1287, 0x01e5, 0x1b28, 
-  0x0a26, 0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c5, 0x1b08, 0x0205, 0x01a5, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a67, 0x01e5, 
-  0x1b47, 0x2c09, 0x2be8, 0x2388, 0x0a25, 0x01c5, 0x1b28, 0x0a26, 0x01c6, 0x01c6, 0x01c6, 0x0a06, 
-  0x2388, 0x12a6, 0x01c5, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x0a26, 0x1b08, 0x0a46, 0x01c6, 0x01c6, 
-  0x01e6, 0x1ae7, 0x12a7, 0x0206, 0x01e6, 0x01c6, 0x1287, 0x1ac8, 0x01c6, 0x01e6, 0x1b08, 0x0a26, 
-  0x01c6, 0x0a66, 0x1ae8, 0x01a5, 0x12c7, 0x1287, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x1287, 0x12e7, 
-  0x01c5, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a26, 
-  0x01c6, 0x01e6, 0x01e7, 0x01c6, 0x12c7, 0x1287, 0x01c6, 0x01e6, 0x01c6, 0x01a6, 0x0a87, 0x1ae8, 
-  0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 0x1b08, 0x01e5, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x0206, 
-  0x1b28, 0x01e5, 0x01c6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x09e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x0a86, 0x2388, 0x23a9, 
-  0x12a6, 0x01c5, 0x01c6, 0x0226, 0x2348, 0x0206, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a66, 0x01a5, 
-  0x09e7, 0x01a6, 0x1287, 0x12c8, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x0a26, 0x1b08, 0x01e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 
-  0x12c8, 0x12a7, 0x01c5, 0x01c6, 0x0a26, 0x1b08, 0x01e5, 0x01c6, 0x12c7, 0x1287, 0x01e5, 0x1b28, 
-  0x0a26, 0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01c6, 0x0a45, 0x2348, 0x0a25, 0x01a5, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a67, 0x0205, 
-  0x2be9, 0x1b67, 0x0a65, 0x2bc8, 0x12a6, 0x01c5, 0x1b28, 0x0a26, 0x01c6, 0x01e6, 0x01c5, 0x1ae6, 
-  0x2c08, 0x23a8, 0x1286, 0x01e6, 0x09e6, 0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x0a06, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a46, 0x0a46, 0x0a26, 0x0a46, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x1ae8, 0x0a46, 0x01c6, 0x01c6, 0x01e5, 
-  0x1ae7, 0x12c7, 0x01c6, 0x01c6, 0x01c6, 0x0a66, 0x1b28, 0x1287, 0x01c6, 0x01e5, 0x1b08, 0x0a46, 
-  0x01c6, 0x0a66, 0x1ae8, 0x01a5, 0x12c7, 0x1287, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0a86, 0x12e7, 
-  0x01c5, 0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x01c6, 0x01e6, 0x1b08, 0x0a26, 
-  0x01c6, 0x09e6, 0x09e7, 0x01c5, 0x12c7, 0x1287, 0x01a6, 0x01c6, 0x01c6, 0x01a6, 0x0a67, 0x12e7, 
-  0x01c5, 0x01c6, 0x01e6, 0x01c6, 0x0a26, 0x1b08, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x0205, 
-  0x1b08, 0x01e5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x0206, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a46, 0x0a26, 0x0a86, 0x23a8, 0x23a7, 0x2387, 
-  0x23a8, 0x0a66, 0x01c6, 0x0a26, 0x1b48, 0x0206, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a66, 0x01a5, 
-  0x01c6, 0x01a6, 0x1287, 0x12c7, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x0a26, 0x1b08, 0x01e6, 0x01e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 
-  0x12c8, 0x12a7, 0x01c5, 0x01c6, 0x0a26, 0x1b28, 0x01e5, 0x01c5, 0x12c7, 0x1287, 0x01c5, 0x1b28, 
-  0x0a26, 0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09c7, 0x09c6, 0x09c6, 0x09c6, 
-  0x01c5, 0x0a05, 0x2387, 0x2be8, 0x2347, 0x01e5, 0x01a5, 0x01c6, 0x01c5, 0x1b08, 0x0a67, 0x0206, 
-  0x2be9, 0x1b47, 0x12c6, 0x2bc8, 0x12c6, 0x01c5, 0x1b28, 0x0a46, 0x01c6, 0x01c5, 0x1286, 0x23a7, 
-  0x2386, 0x2be7, 0x2bc8, 0x0a26, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x01c6, 0x0a06, 0x1ac8, 0x1b08, 
-  0x1ae8, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x0a26, 0x01c6, 0x01c6, 0x0205, 0x1b08, 
-  0x12a7, 0x01c6, 0x01a6, 0x01a5, 0x0a46, 0x1b48, 0x0a66, 0x01e6, 0x01e6, 0x0225, 0x1b28, 0x0a26, 
-  0x01c5, 0x0a66, 0x1ae8, 0x01a5, 0x12c7, 0x1287, 0x01c6, 0x01e6, 0x01c6, 0x01a6, 0x1286, 0x12e7, 
-  0x01c5, 0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09c6, 0x09c6, 0x01c6, 0x01c6, 0x1b28, 0x0a67, 
-  0x0207, 0x0207, 0x0207, 0x01c5, 0x12c7, 0x0a87, 0x01c5, 0x0206, 0x0207, 0x01e6, 0x1287, 0x1ac8, 
-  0x01a5, 0x01c6, 0x01e6, 0x01c6, 0x0a46, 0x1b08, 0x01e5, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e5, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x09e6, 0x09c6, 0x09c6, 0x01e6, 0x0a26, 0x12a7, 
-  0x2348, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b27, 0x2bc8, 0x1b46, 0x12e5, 
-  0x2bc8, 0x1286, 0x01c6, 0x0226, 0x1b28, 0x0206, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a66, 0x01a5, 
-  0x01c6, 0x01a5, 0x1287, 0x12c8, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x0a26, 0x1b08, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01e6, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 
-  0x12c7, 0x1287, 0x01c5, 0x01c6, 0x0a26, 0x1b28, 0x01e5, 0x01c6, 0x12c7, 0x1287, 0x01c5, 0x1b28, 
-  0x0a26, 0x01c6, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x01c6, 0x09e6, 0x09c6, 
-  0x01c5, 0x1b26, 0x2bc7, 0x1b06, 0x2387, 0x1b06, 0x01c5, 0x01c6, 0x01c5, 0x1b08, 0x0a67, 0x01e5, 
-  0x1b27, 0x2bc8, 0x2be8, 0x2388, 0x0a45, 0x01c5, 0x1b28, 0x0a46, 0x01c6, 0x01c5, 0x12a6, 0x2be7, 
-  0x1b05, 0x2366, 0x2c08, 0x0a46, 0x01c6, 0x09e7, 0x09e7, 0x01c6, 0x0a46, 0x1aa8, 0x0a06, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0206, 0x01e6, 0x01e6, 0x01e5, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 0x1ae7, 0x1ae7, 
-  0x0206, 0x01c6, 0x01a5, 0x1266, 0x2348, 0x12a6, 0x01e6, 0x01c6, 0x0a26, 0x2328, 0x1ac7, 0x0a06, 
-  0x01a6, 0x0a46, 0x1ac8, 0x01a5, 0x12c7, 0x1287, 0x01c6, 0x01e6, 0x09e6, 0x01a6, 0x1287, 0x12e7, 
-  0x01c5, 0x01c6, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x09c6, 0x01c6, 0x09c6, 0x0965, 0x1a06, 0x09a5, 
-  0x0985, 0x09a5, 0x09e6, 0x01e6, 0x12a7, 0x1267, 0x0185, 0x09c6, 0x09a5, 0x0185, 0x11c5, 0x1a27, 
-  0x0185, 0x01a6, 0x01c6, 0x01a6, 0x0a46, 0x1b08, 0x01e5, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e5, 0x01c6, 0x09e6, 0x01e6, 0x01c6, 0x01c6, 0x09e7, 0x01c6, 0x0a46, 0x2389, 0x12a7, 
-  0x01c5, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e5, 0x01e6, 0x01e5, 0x01e5, 0x01e5, 0x0205, 0x1b47, 0x2bc8, 0x2bc8, 
-  0x2367, 0x0a25, 0x01c6, 0x0a26, 0x1b28, 0x01e6, 0x01c6, 0x09c6, 0x01c5, 0x1b08, 0x0a66, 0x01a5, 
-  0x09e6, 0x01a5, 0x1287, 0x12c8, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x0a26, 0x1b08, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x0a07, 
-  0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01c6, 
-  0x12c7, 0x1287, 0x01a5, 0x01c6, 0x0a26, 0x1b28, 0x01e5, 0x01c6, 0x12c7, 0x1287, 0x01c5, 0x1b28, 
-  0x0a26, 0x01c6, 0x01c6, 0x01c6, 0x09e6, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01c5, 0x2366, 0x3408, 0x12c5, 0x2387, 0x1b06, 0x01c5, 0x01c6, 0x01c5, 0x1b08, 0x0a67, 0x01a5, 
-  0x01c5, 0x1ae7, 0x1b07, 0x0a65, 0x01a5, 0x01e6, 0x1b28, 0x0a46, 0x01c6, 0x01c6, 0x0a25, 0x2387, 
-  0x2c07, 0x2c08, 0x2347, 0x0a06, 0x09c6, 0x09e6, 0x01c6, 0x0a26, 0x1ae8, 0x0a07, 0x01a6, 0x01c6, 
-  0x01c6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x0205, 0x1b28, 0x12a7, 0x01a5, 
-  0x01c6, 0x01e5, 0x12a6, 0x2388, 0x12c7, 0x01e6, 0x01c6, 0x0a26, 0x1b28, 0x1ac7, 0x01e5, 0x01c6, 
-  0x01c6, 0x1ac7, 0x1287, 0x01a5, 0x1ac7, 0x1287, 0x01c6, 0x01c6, 0x09e6, 0x01a6, 0x0a87, 0x12e7, 
-  0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x09c6, 0x09c6, 0x09a5, 0x0903, 0x0020, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0041, 0x0103, 0x1aa8, 0x1206, 0x0061, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x00c3, 0x0965, 0x01a6, 0x01a6, 0x0a26, 0x1b08, 0x01c6, 0x01c6, 0x01e6, 0x09e6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x0206, 0x12e7, 0x12a7, 0x0206, 
-  0x01c6, 0x01c6, 0x09e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x0225, 0x12e7, 0x1b07, 
-  0x0a45, 0x01c5, 0x01c6, 0x0206, 0x1b28, 0x01e6, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a66, 0x01a5, 
-  0x01c6, 0x01a6, 0x1287, 0x12c7, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x0a26, 0x1b08, 0x01e6, 0x01e6, 
-  0x01c6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x0a07, 
-  0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x12c7, 0x1287, 0x01a5, 0x01c6, 0x0a46, 0x1b28, 0x01e5, 0x01c6, 0x12c7, 0x1287, 0x01c5, 0x1b28, 
-  0x0a26, 0x01c6, 0x01e6, 0x01c6, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 
-  0x01c6, 0x12a6, 0x2c08, 0x3448, 0x2bc8, 0x0a65, 0x01c5, 0x01c6, 0x01c5, 0x1b08, 0x0a67, 0x01a6, 
-  0x01c6, 0x01c5, 0x01c5, 0x01a5, 0x01a6, 0x01c6, 0x1b28, 0x0a46, 0x01c6, 0x01c6, 0x01c5, 0x0a45, 
-  0x12e6, 0x12e6, 0x0a05, 0x01a6, 0x01c6, 0x01c6, 0x0a26, 0x1ae8, 0x0a47, 0x01a6, 0x09c6, 0x01e6, 
-  0x12c7, 0x1ae8, 0x1ac8, 0x1ac8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x12e8, 0x12e8, 0x12e8, 0x12e8, 0x1ae8, 0x1ae8, 0x1ae7, 0x1b08, 0x1b07, 0x01e6, 0x09c6, 
-  0x01c5, 0x12c6, 0x1b48, 0x12a7, 0x01e6, 0x01c5, 0x0a25, 0x1b07, 0x12a7, 0x01e6, 0x01c6, 0x01c5, 
-  0x12a7, 0x12a7, 0x01e6, 0x01a5, 0x12c7, 0x1287, 0x01c6, 0x01e6, 0x09c6, 0x01a6, 0x0a87, 0x12e7, 
-  0x01a5, 0x01c6, 0x01c6, 0x01c6, 0x09e6, 0x09c6, 0x09e6, 0x0944, 0x0020, 0x10c2, 0x2183, 0x3a65, 
-  0x42a5, 0x3265, 0x1963, 0x0020, 0x0963, 0x00e1, 0x10e1, 0x3264, 0x4305, 0x4325, 0x2a04, 0x1902, 
-  0x0020, 0x0082, 0x09a5, 0x01c6, 0x0a26, 0x1b08, 0x01c5, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e5, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x01c6, 0x01e5, 0x12c7, 0x0a66, 0x01c5, 0x01c6, 
-  0x01c6, 0x01c6, 0x09e7, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x01c6, 0x09c6, 0x09e6, 0x09c6, 
-  0x01e6, 0x09c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e5, 0x01e5, 
-  0x01c6, 0x01c6, 0x01c6, 0x0206, 0x1b28, 0x01e6, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a66, 0x01a5, 
-  0x01c6, 0x01a6, 0x1287, 0x12c8, 0x01c5, 0x01e6, 0x01c6, 0x01c6, 0x0a26, 0x1b08, 0x01e6, 0x09e6, 
-  0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x12c7, 0x1287, 0x01c5, 0x01c6, 0x0a46, 0x1b28, 0x01e5, 0x01c6, 0x12c7, 0x1287, 0x01c5, 0x1b28, 
-  0x0a26, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e5, 0x12a6, 0x1306, 0x12a6, 0x01c5, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a47, 0x01a6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01c6, 0x1b08, 0x0a46, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x0a06, 0x1ac8, 0x0a07, 0x01a6, 0x01c6, 0x01e6, 0x12a7, 
-  0x12a7, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x0a87, 0x1287, 0x1287, 0x0a87, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x0a87, 0x1287, 0x0a87, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x0a26, 0x01c6, 0x01c5, 
-  0x1286, 0x2368, 0x0a86, 0x01a5, 0x01c6, 0x0225, 0x1ae7, 0x12c7, 0x01e5, 0x01e6, 0x01e6, 0x1266, 
-  0x1267, 0x01c5, 0x01c6, 0x01c5, 0x12c7, 0x1287, 0x01c6, 0x01e6, 0x09e6, 0x01c6, 0x0a87, 0x12e7, 
-  0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x01e6, 0x0206, 0x0964, 0x0000, 0x5388, 0x7509, 0x6ca7, 
-  0x7509, 0x7d69, 0x7509, 0x42e6, 0x0060, 0x1962, 0x7d29, 0x8de9, 0x8dc9, 0x7d68, 0x7d48, 0x74ca, 
-  0x1902, 0x0020, 0x0985, 0x01a6, 0x0a26, 0x1b08, 0x01c5, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e5, 0x12c7, 0x1287, 0x01c5, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x09c7, 0x09c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x09e6, 0x01c6, 
-  0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x0206, 0x1b28, 0x01e6, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a66, 0x01c5, 
-  0x09e6, 0x01a6, 0x1287, 0x12c8, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x0a26, 0x1b08, 0x01e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x09e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a5, 
-  0x12c7, 0x12a7, 0x01c5, 0x01c6, 0x0a26, 0x1b28, 0x01e5, 0x01c5, 0x12c7, 0x1287, 0x01c5, 0x1b28, 
-  0x1ae7, 0x0206, 0x0206, 0x0205, 0x0205, 0x01e5, 0x01e6, 0x01e6, 0x09c6, 0x09c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x09c6, 0x01e6, 0x01e5, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a47, 0x01a6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 0x1b27, 0x0a86, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 
-  0x09e6, 0x01e6, 0x01c6, 0x01c6, 0x0a06, 0x1ae8, 0x0a47, 0x01c6, 0x09e6, 0x0206, 0x1ae8, 0x12a7, 
-  0x01e6, 0x01a6, 0x01c6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01a5, 0x01a5, 0x01a6, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01a5, 0x01a6, 0x01a6, 0x01a5, 0x01a5, 0x01a6, 0x01a5, 0x01c5, 0x01c5, 0x01c6, 0x01c5, 0x0a66, 
-  0x1b48, 0x0a86, 0x01e6, 0x01c6, 0x0a06, 0x12a7, 0x0a66, 0x01e6, 0x01c6, 0x0a05, 0x1ac7, 0x0a46, 
-  0x01c6, 0x01c6, 0x09e6, 0x01c6, 0x12c7, 0x1267, 0x01c6, 0x09e6, 0x09e6, 0x01a5, 0x0a86, 0x12e7, 
-  0x01c5, 0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x0a26, 0x1308, 0x09e4, 0x0020, 0x5367, 0x7507, 0x6446, 
-  0x4325, 0x53a6, 0x7507, 0x74e9, 0x00a1, 0x53c7, 0x964a, 0x7507, 0x53a6, 0x6466, 0x6ce6, 0x7509, 
-  0x10e1, 0x0061, 0x09a6, 0x01a6, 0x0a26, 0x1b08, 0x01c5, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e5, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x12c7, 0x1287, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01c6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x0226, 0x1b28, 0x01e6, 0x01c6, 0x09e7, 0x01c5, 0x1b08, 0x0a66, 0x01a5, 
-  0x01e6, 0x01a6, 0x1287, 0x1ac8, 0x01c5, 0x09c6, 0x01c6, 0x01c6, 0x0a46, 0x1b08, 0x01e6, 0x09c6, 
-  0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x0a26, 0x0a25, 0x0a25, 0x0a25, 0x0a26, 0x0a26, 0x0a25, 0x0a25, 0x0a25, 0x0a25, 0x0a26, 0x0205, 
-  0x12c7, 0x1287, 0x01c6, 0x01e6, 0x0a47, 0x1b28, 0x01e5, 0x01c5, 0x12c7, 0x1287, 0x01a5, 0x0a26, 
-  0x1b48, 0x1b48, 0x0aa6, 0x1b48, 0x1b68, 0x12e7, 0x01e5, 0x01c6, 0x01c6, 0x09c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x01c6, 0x01c5, 0x1ae8, 0x0a47, 0x01a6, 
-  0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e5, 0x1b06, 0x23a7, 0x2367, 0x0a06, 0x01c6, 0x01e6, 0x09e7, 
-  0x09c6, 0x01c6, 0x01c6, 0x0a06, 0x1aa8, 0x0a27, 0x01c6, 0x09e6, 0x0206, 0x1ae8, 0x12c7, 0x0226, 
-  0x01e6, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0226, 0x0206, 0x0206, 0x0226, 0x0206, 0x0206, 
-  0x0206, 0x0206, 0x0206, 0x0206, 0x0226, 0x0226, 0x0206, 0x0206, 0x0226, 0x0206, 0x0206, 0x0206, 
-  0x0206, 0x0a26, 0x0226, 0x0226, 0x0226, 0x0206, 0x0206, 0x0206, 0x0226, 0x0205, 0x0a86, 0x2348, 
-  0x0a66, 0x01c6, 0x01c6, 0x0a46, 0x2328, 0x0a67, 0x01c6, 0x01c6, 0x01c5, 0x1ae7, 0x1267, 0x01c5, 
-  0x01e6, 0x09e6, 0x09e6, 0x01c6, 0x1ac7, 0x1287, 0x01c6, 0x09e6, 0x09e6, 0x01a5, 0x0a87, 0x12c7, 
-  0x01c5, 0x01c6, 0x01e6, 0x01e6, 0x0206, 0x2369, 0x2368, 0x2328, 0x0081, 0x3224, 0x7508, 0x6cc6, 
-  0x64a6, 0x3ac5, 0x4b46, 0x5387, 0x0020, 0x4305, 0x6427, 0x4b45, 0x74c7, 0x74e6, 0x7d47, 0x6407, 
-  0x0060, 0x0923, 0x09e6, 0x01c6, 0x0a26, 0x1b28, 0x01e5, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e5, 0x01c6, 0x01c6, 0x01c6, 0x1287, 0x0a66, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x09c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x0a06, 0x1b28, 0x01e6, 0x01e6, 0x01c6, 0x01c5, 0x1b08, 0x0a66, 0x01a6, 
-  0x01c6, 0x01a6, 0x1287, 0x1ac8, 0x01c5, 0x01c6, 0x01e6, 0x01c6, 0x0a46, 0x1b08, 0x01e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x0a07, 0x0a07, 
-  0x2328, 0x2328, 0x1b48, 0x1b48, 0x2348, 0x2348, 0x1b48, 0x1b48, 0x2328, 0x2328, 0x1b28, 0x2348, 
-  0x12a7, 0x01e6, 0x09e6, 0x01e7, 0x0a47, 0x1b28, 0x01e5, 0x01c5, 0x12c7, 0x1287, 0x01a6, 0x01c6, 
-  0x0206, 0x23a9, 0x1b28, 0x0205, 0x1327, 0x2be9, 0x0a86, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x09c6, 
-  0x09c6, 0x09e6, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x01a5, 0x1ae7, 0x0a46, 0x01a6, 
-  0x01e6, 0x01e6, 0x09e6, 0x01c6, 0x12c6, 0x1b67, 0x1b66, 0x2367, 0x12e6, 0x01e5, 0x01e6, 0x09e6, 
-  0x09c6, 0x01c6, 0x0a06, 0x1aa8, 0x0a07, 0x01c6, 0x01c7, 0x0a26, 0x1b08, 0x12c7, 0x0226, 0x0206, 
-  0x0a45, 0x1b28, 0x1b08, 0x1b08, 0x1b28, 0x1b29, 0x1b29, 0x1b29, 0x1b29, 0x1b29, 0x2329, 0x1b29, 
-  0x1b29, 0x1b29, 0x1b29, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 
-  0x1b28, 0x1b29, 0x2329, 0x1b29, 0x1b29, 0x1b28, 0x1b28, 0x1b29, 0x1b29, 0x1b28, 0x1b48, 0x12a7, 
-  0x0206, 0x01c5, 0x0a46, 0x1b28, 0x0a66, 0x01e6, 0x01a6, 0x01e5, 0x1287, 0x1267, 0x01e6, 0x01c6, 
-  0x09c6, 0x01c6, 0x09e6, 0x01c5, 0x12c7, 0x1287, 0x01c6, 0x01e6, 0x09e6, 0x01a6, 0x0a87, 0x12e7, 
-  0x01a5, 0x01c6, 0x09c6, 0x01e6, 0x12c7, 0x23a9, 0x0a46, 0x1266, 0x00e2, 0x0020, 0x5387, 0x8569, 
-  0x7546, 0x7d88, 0x4b47, 0x0000, 0x0020, 0x0020, 0x3a85, 0x8dca, 0x85a7, 0x85a8, 0x74c8, 0x1101, 
-  0x0040, 0x0985, 0x09e6, 0x01c6, 0x0a26, 0x1b28, 0x01e5, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e5, 0x01c6, 0x01c6, 0x01c6, 0x1ac8, 0x0a46, 0x01c6, 0x01c6, 0x01e6, 0x12a7, 0x1287, 
-  0x01c5, 0x01c6, 0x01c6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x0226, 0x1b48, 0x01e5, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a66, 0x01c6, 
-  0x09c7, 0x01a6, 0x1287, 0x12c8, 0x01a5, 0x01c6, 0x01e6, 0x01c6, 0x0a46, 0x1b08, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0206, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x0206, 0x09e6, 0x09e6, 0x01e7, 0x0a46, 0x1b28, 0x01e5, 0x01c5, 0x12c7, 0x1287, 0x01c6, 0x01e6, 
-  0x01e6, 0x1b68, 0x2368, 0x0225, 0x1b67, 0x2c09, 0x0a86, 0x01c5, 0x01c6, 0x01c6, 0x09e6, 0x09e6, 
-  0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x01c5, 0x0205, 0x1b07, 0x12c6, 0x01c5, 
-  0x01c6, 0x01e6, 0x01e6, 0x01c5, 0x12e6, 0x1b67, 0x0aa5, 0x1306, 0x1b06, 0x01e5, 0x01c6, 0x09c6, 
-  0x01c6, 0x0a26, 0x1ac8, 0x0a07, 0x01a6, 0x01c6, 0x0206, 0x1ae8, 0x1ae8, 0x0226, 0x01e6, 0x0a45, 
-  0x1b28, 0x12c7, 0x01e5, 0x01e6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01e5, 0x01c5, 
-  0x01c5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01c5, 0x0a26, 0x1b08, 0x0a87, 0x01c6, 0x09c6, 0x01e5, 0x12c7, 0x12c7, 0x01c6, 0x01c6, 0x09c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x0a26, 0x1b08, 0x0a67, 0x01c6, 0x09e6, 0x09e6, 0x01a6, 0x0a87, 0x12e7, 
-  0x01a5, 0x01c6, 0x01c6, 0x01e6, 0x12c8, 0x1b69, 0x0205, 0x0a66, 0x09c4, 0x0040, 0x0040, 0x3a65, 
-  0x6408, 0x63e8, 0x1922, 0x0000, 0x0820, 0x0800, 0x10c1, 0x5ba7, 0x7ca8, 0x63e7, 0x1942, 0x0040, 
-  0x0923, 0x09c6, 0x01c6, 0x01c6, 0x0a46, 0x1b28, 0x01e5, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x0205, 
-  0x1b08, 0x01e5, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a87, 0x01c6, 0x0206, 0x0a87, 0x1b48, 0x1b27, 
-  0x0a66, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x0226, 0x1b48, 0x01e6, 0x09e6, 0x09c6, 0x01c5, 0x1b08, 0x0a66, 0x01a6, 
-  0x09c6, 0x01a5, 0x1287, 0x12c8, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x0a46, 0x1b28, 0x01e6, 0x01c6, 
-  0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 
-  0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x0a46, 0x1b28, 0x01e5, 0x01c5, 0x12c7, 0x12a7, 0x01c6, 0x09e6, 
-  0x01c6, 0x0a26, 0x2368, 0x23e8, 0x2c48, 0x23e8, 0x0a45, 0x01c5, 0x01c6, 0x01c6, 0x01e6, 0x09e6, 
-  0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x0a25, 0x1b47, 0x2be7, 0x23c7, 0x12a6, 
-  0x01e5, 0x01e6, 0x01e6, 0x01e5, 0x12a6, 0x1b47, 0x1b26, 0x1b06, 0x12a6, 0x01e5, 0x01c6, 0x01a6, 
-  0x0a46, 0x1ae8, 0x0a27, 0x09c6, 0x09e6, 0x0a26, 0x1b08, 0x12a7, 0x0206, 0x0206, 0x0a45, 0x2348, 
-  0x1b07, 0x01e6, 0x01c6, 0x01e6, 0x0a46, 0x1267, 0x1267, 0x1267, 0x0a87, 0x1287, 0x0a87, 0x0a87, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x0a87, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x12a7, 0x12a7, 0x1287, 
-  0x1286, 0x2369, 0x12a7, 0x01c6, 0x01c6, 0x0a05, 0x12e7, 0x12a7, 0x0a06, 0x09c6, 0x09c6, 0x09e6, 
-  0x09e6, 0x01c5, 0x0a46, 0x2328, 0x0a86, 0x01c6, 0x09e7, 0x09e6, 0x09e7, 0x01a5, 0x0a87, 0x12e7, 
-  0x01c5, 0x01c6, 0x01e6, 0x01e6, 0x0a26, 0x2389, 0x1327, 0x23a9, 0x1b47, 0x08e2, 0x0000, 0x2000, 
-  0x58c4, 0x3883, 0x2841, 0x8107, 0x9107, 0x8927, 0x4063, 0x3041, 0x7926, 0x3841, 0x0800, 0x0061, 
-  0x1185, 0x01c6, 0x01c6, 0x01c6, 0x0a46, 0x1b08, 0x01c5, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e5, 0x01c5, 0x01c6, 0x01c5, 0x1b28, 0x0a87, 0x01c6, 0x0a46, 0x1b47, 0x1b47, 0x1b47, 
-  0x1b47, 0x1267, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01c6, 0x0226, 0x1b48, 0x01e6, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a66, 0x01a5, 
-  0x01e6, 0x01c5, 0x1287, 0x1ac8, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x0a46, 0x1b28, 0x01c6, 0x01c6, 
-  0x01e6, 0x01c6, 0x09e6, 0x09e6, 0x09c7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01a5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x0246, 0x1b28, 0x01e5, 0x01c5, 0x12e7, 0x12a7, 0x01c6, 0x09e6, 
-  0x01e6, 0x01e5, 0x0a26, 0x1b07, 0x1b27, 0x0a86, 0x01c5, 0x01c6, 0x01c6, 0x09e6, 0x09e6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x01c6, 0x12c7, 0x2be8, 0x1305, 0x1b66, 0x2bc8, 
-  0x0a25, 0x01c5, 0x01e6, 0x01e6, 0x0205, 0x1286, 0x2348, 0x12a6, 0x01c5, 0x01c6, 0x01a5, 0x0a06, 
-  0x1ae8, 0x0a27, 0x01a6, 0x09c6, 0x0206, 0x1ae8, 0x12c8, 0x0206, 0x01e6, 0x0a45, 0x1b68, 0x1ae7, 
-  0x0205, 0x01c6, 0x01e6, 0x0a66, 0x12c7, 0x12a7, 0x12a7, 0x12a7, 0x12c8, 0x12c8, 0x12c7, 0x12a7, 
-  0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 
-  0x12a7, 0x12c7, 0x12c8, 0x12c8, 0x12c7, 0x12c8, 0x1ac8, 0x12c8, 0x12c8, 0x12c7, 0x12c7, 0x12c8, 
-  0x12c8, 0x12c8, 0x0a06, 0x01c6, 0x01e5, 0x12c7, 0x12a7, 0x01e6, 0x09e6, 0x09c6, 0x01c6, 0x01e7, 
-  0x01e6, 0x0a46, 0x1b08, 0x0a66, 0x01e5, 0x09e7, 0x09e7, 0x09e6, 0x01c6, 0x01a5, 0x0a87, 0x12e7, 
-  0x01a5, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x12c7, 0x1b08, 0x1b07, 0x09a3, 0x0000, 0x3042, 0xb169, 
-  0xc1ab, 0x4062, 0x48c4, 0xd1ab, 0xd12a, 0xd14a, 0xa989, 0x4862, 0xa968, 0xc1aa, 0x50a4, 0x0000, 
-  0x00a2, 0x01c6, 0x01c6, 0x01c6, 0x0a46, 0x1b08, 0x01c5, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e5, 0x01c5, 0x01c6, 0x01c5, 0x1b28, 0x0a86, 0x01c6, 0x0a26, 0x12c7, 0x1b07, 0x1b07, 
-  0x12c7, 0x0a06, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x09e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x0226, 0x2328, 0x0206, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a66, 0x01a5, 
-  0x09e6, 0x01a5, 0x1287, 0x1ae8, 0x01c5, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 0x1b28, 0x01c5, 0x01c6, 
-  0x01c6, 0x01e6, 0x09e6, 0x09c7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 
-  0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x1ae8, 0x0a66, 0x01e6, 0x01c6, 0x12e8, 0x12a7, 0x01c6, 0x09e7, 
-  0x01e6, 0x09e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x09e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x01c6, 0x1ae7, 0x2c08, 0x1b25, 0x2386, 0x23c8, 
-  0x0225, 0x01c5, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e5, 0x01c5, 0x01c6, 0x01a5, 0x0a06, 0x1ac8, 
-  0x0a67, 0x01c6, 0x09c6, 0x01e6, 0x1ae8, 0x12c8, 0x0206, 0x01e6, 0x0a45, 0x1b47, 0x12c6, 0x01e6, 
-  0x01e6, 0x0206, 0x12c7, 0x1b08, 0x0a26, 0x01a5, 0x01c5, 0x01c5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01a5, 0x01c5, 0x01c5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01e5, 0x1ac8, 0x12a7, 0x01c6, 0x09e6, 0x09e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x0225, 0x1b08, 0x0a66, 0x01e5, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09c6, 0x01a5, 0x1287, 0x12c7, 
-  0x01a5, 0x09e6, 0x01c6, 0x09e6, 0x01c6, 0x01c5, 0x01c5, 0x09e6, 0x0102, 0x0000, 0x9148, 0xa949, 
-  0x5062, 0x2000, 0x2000, 0x6083, 0x8906, 0x8106, 0x5883, 0x2820, 0x2821, 0x8107, 0x99a9, 0x1020, 
-  0x0041, 0x09c5, 0x01e6, 0x01c6, 0x0a46, 0x1b08, 0x01c5, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0205, 
-  0x1b08, 0x0205, 0x01c5, 0x01c6, 0x01c5, 0x1b28, 0x0a86, 0x01c6, 0x01e6, 0x0206, 0x12a7, 0x12e7, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x09e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x0226, 0x1b28, 0x01e6, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a66, 0x01a5, 
-  0x09e7, 0x01a5, 0x1287, 0x1ae8, 0x01c5, 0x01e6, 0x01c6, 0x01c6, 0x0a26, 0x1b28, 0x01c5, 0x01c6, 
-  0x01c6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x0a07, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x0a87, 0x0a87, 0x0a87, 0x0a86, 0x1286, 
-  0x1286, 0x1287, 0x0a87, 0x1287, 0x1267, 0x01c5, 0x09e6, 0x01c6, 0x1ae8, 0x12a7, 0x01c6, 0x09e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x09e6, 0x09e6, 0x01c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x01e6, 0x09e7, 0x09c6, 0x0a26, 0x1b47, 0x2c08, 0x2be8, 0x12a6, 
-  0x0206, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01c6, 0x09e6, 0x01c6, 0x09e6, 0x12a7, 0x0a46, 
-  0x09c7, 0x09c7, 0x0206, 0x1ae8, 0x12c8, 0x0206, 0x01c6, 0x0a46, 0x1b27, 0x12c7, 0x0205, 0x01e6, 
-  0x0a26, 0x1b07, 0x1b48, 0x0a67, 0x01e6, 0x09c6, 0x01e6, 0x12a8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ac8, 0x1288, 0x0206, 0x01e6, 0x01c6, 0x09e6, 0x09e6, 0x01c6, 0x0225, 
-  0x1b28, 0x0a66, 0x01e5, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x01a5, 0x1287, 0x12e7, 
-  0x01c5, 0x01c6, 0x09c6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x11c6, 0x0081, 0x0800, 0x48c4, 0x2841, 
-  0x5883, 0xa969, 0x9948, 0x4883, 0x1000, 0x2821, 0x9107, 0xb149, 0x7106, 0x1820, 0x30a3, 0x0820, 
-  0x0020, 0x0964, 0x0206, 0x01c6, 0x0a46, 0x1b08, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x0205, 
-  0x1b08, 0x0205, 0x01c5, 0x01e5, 0x01c5, 0x1b28, 0x0a67, 0x01c6, 0x09e6, 0x01a6, 0x1267, 0x1ac8, 
-  0x01c6, 0x09c6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x09c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x01c6, 0x0226, 0x1b28, 0x01e6, 0x01c6, 0x01e6, 0x01c5, 0x1b08, 0x0a66, 0x01c5, 
-  0x09e7, 0x01c5, 0x1287, 0x1ae8, 0x01c5, 0x09e6, 0x01e6, 0x01c6, 0x0a46, 0x1b08, 0x01c5, 0x01c6, 
-  0x01c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x0a07, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01a6, 0x01c6, 0x01c6, 0x01e6, 0x09e7, 0x01c6, 0x1b08, 0x12a7, 0x01c6, 0x09e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 
-  0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x01c6, 0x0a26, 0x0a66, 0x1266, 0x01e6, 
-  0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x01c6, 0x0a06, 0x1aa8, 0x0a06, 0x01e6, 
-  0x09e7, 0x0a06, 0x1ae8, 0x12c8, 0x0a07, 0x01c6, 0x0a25, 0x1b07, 0x12c7, 0x01e5, 0x01e6, 0x01e6, 
-  0x1ae7, 0x2368, 0x0a66, 0x01e6, 0x01e6, 0x01e6, 0x1ae8, 0x1287, 0x1267, 0x0a67, 0x0a67, 0x0a67, 
-  0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x1267, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 
-  0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 
-  0x0a67, 0x0a67, 0x0a67, 0x0a47, 0x01e6, 0x01e6, 0x09e6, 0x09c6, 0x09c6, 0x01c6, 0x0205, 0x1b28, 
-  0x12a6, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01c5, 0x1287, 0x12e7, 
-  0x01a5, 0x01c6, 0x01c6, 0x01e6, 0x09e7, 0x09e6, 0x09e7, 0x08c2, 0x0800, 0x58e5, 0x3062, 0x3842, 
-  0xb949, 0xc909, 0xd14a, 0xa969, 0x1820, 0x70e5, 0xd16a, 0xd109, 0xc96a, 0x6905, 0x1020, 0x3883, 
-  0x0800, 0x0081, 0x09c6, 0x01c6, 0x0a46, 0x1b08, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b28, 0x0205, 0x01c5, 0x01e5, 0x01c5, 0x1b28, 0x0a67, 0x01c6, 0x09c6, 0x01a6, 0x1267, 0x12a7, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x09c6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x01c6, 0x0a26, 0x1b28, 0x0206, 0x01c6, 0x01c6, 0x01c5, 0x1ae8, 0x0a46, 0x01a5, 
-  0x09e6, 0x01c5, 0x12a7, 0x1ae8, 0x01c5, 0x09e6, 0x01e6, 0x01c6, 0x0a26, 0x1b08, 0x01c5, 0x01c6, 
-  0x01c6, 0x09e6, 0x09e7, 0x09e6, 0x01e6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x01c6, 0x09c6, 0x09c7, 0x01e7, 0x09e7, 0x09c7, 0x01c6, 0x01e6, 0x09e7, 0x09e6, 0x09e6, 0x01e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x09e6, 0x09e7, 0x01e6, 0x1b08, 0x12a7, 0x01c6, 0x09e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x09c6, 0x09c6, 0x09c6, 0x09e6, 0x01e6, 0x01e7, 0x01e6, 0x09e6, 0x09e6, 
-  0x09e6, 0x01c6, 0x09c6, 0x09e7, 0x09e7, 0x09e6, 0x01c6, 0x09e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x01c6, 0x01c6, 0x0a06, 0x1ae8, 0x0a47, 0x01c6, 0x01c6, 
-  0x0a06, 0x1b08, 0x12c8, 0x0206, 0x01e6, 0x0a05, 0x1b07, 0x12a6, 0x01c5, 0x01c6, 0x01e5, 0x1b07, 
-  0x2368, 0x0a66, 0x0206, 0x01e6, 0x0a26, 0x1ae8, 0x1287, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x09e6, 0x09e6, 0x09c6, 0x01e6, 0x0225, 0x1b08, 0x0a66, 
-  0x01e5, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x01a6, 0x1287, 0x12e7, 
-  0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09a6, 0x0020, 0x5083, 0xc98b, 0x5083, 0x68c5, 
-  0xc929, 0xc0e8, 0xc909, 0xb169, 0x2021, 0x70e6, 0xc929, 0xc0e8, 0xc129, 0x9168, 0x3862, 0xa969, 
-  0x58c4, 0x0000, 0x0965, 0x01e7, 0x0a26, 0x1b08, 0x01c5, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b08, 0x0205, 0x01e5, 0x01e6, 0x01c5, 0x1b28, 0x0a67, 0x01a6, 0x09c6, 0x01a6, 0x1267, 0x12a7, 
-  0x01c5, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01c6, 
-  0x01e6, 0x09c6, 0x09c6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 
-  0x01e7, 0x09e6, 0x01c6, 0x0a06, 0x1b28, 0x01e6, 0x01c6, 0x01c6, 0x01c5, 0x1ae8, 0x0a46, 0x01a5, 
-  0x09e6, 0x01a6, 0x12a7, 0x1ac8, 0x01c5, 0x01e6, 0x01c6, 0x01a6, 0x0a26, 0x1b08, 0x01c5, 0x01c6, 
-  0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c6, 0x01c5, 0x01c5, 0x01a5, 0x01a6, 0x01a6, 0x01c6, 0x01c5, 0x1b08, 0x12a7, 0x01c6, 0x09e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x01e7, 0x09e7, 0x09e7, 0x09e6, 
-  0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09c6, 0x09e7, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x01e6, 
-  0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x01c6, 0x0a06, 0x1ac8, 0x0a47, 0x01c6, 0x01c6, 0x01e6, 
-  0x1ae7, 0x12e8, 0x0227, 0x0206, 0x0a25, 0x1ae7, 0x12a7, 0x01c5, 0x01a6, 0x01e5, 0x12c7, 0x2348, 
-  0x0a66, 0x01e6, 0x09e7, 0x0a26, 0x1ae8, 0x1267, 0x01c6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01a6, 0x01c6, 0x01c6, 0x01a6, 0x01c6, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01c6, 
-  0x01c6, 0x01a6, 0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01c6, 0x01c6, 0x01e5, 0x1ae7, 0x1287, 0x01e5, 
-  0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x09c6, 0x01c6, 0x01c6, 0x01c5, 0x12c7, 0x12e7, 
-  0x01c5, 0x01e6, 0x01e6, 0x0206, 0x0a06, 0x0a26, 0x09c5, 0x0020, 0x78c6, 0xd16b, 0x4883, 0x60c4, 
-  0xc94a, 0xc109, 0xc94a, 0x8106, 0x0000, 0x2841, 0xb149, 0xc929, 0xd14a, 0x9147, 0x4062, 0xc16a, 
-  0x78e6, 0x0000, 0x0965, 0x01e7, 0x0a26, 0x1b08, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b28, 0x0205, 0x01c5, 0x01e6, 0x01c5, 0x1b08, 0x0a67, 0x01a6, 0x09e6, 0x01a6, 0x1267, 0x1ac8, 
-  0x01c5, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09c6, 0x01c6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x0206, 0x1b28, 0x01e6, 0x01c6, 0x09c6, 0x01c5, 0x1ae8, 0x0a46, 0x01a5, 
-  0x09e6, 0x01a6, 0x1287, 0x1ac8, 0x01c5, 0x01e6, 0x01e6, 0x01c6, 0x0a26, 0x1b08, 0x01c5, 0x01c6, 
-  0x09c6, 0x01c6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x0a47, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a66, 0x0a67, 0x0a67, 0x0a46, 0x0a67, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a46, 0x0a67, 0x0a67, 0x1b08, 0x1287, 0x01c6, 0x09e6, 
-  0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 
-  0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x01c6, 0x01c6, 0x01c6, 0x01e7, 0x09e6, 0x09e6, 0x01e6, 0x09e6, 
-  0x01e6, 0x09e6, 0x01e6, 0x01c6, 0x01c6, 0x0a27, 0x1ac8, 0x0a07, 0x01c6, 0x01c6, 0x0206, 0x12c7, 
-  0x1288, 0x0206, 0x01e6, 0x0a26, 0x1b07, 0x12c7, 0x09e6, 0x01c6, 0x09e6, 0x1b07, 0x1b28, 0x0a26, 
-  0x01c6, 0x01c6, 0x0a06, 0x1ae8, 0x0a67, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01a6, 0x01e6, 
-  0x0a47, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 
-  0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 
-  0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x12c8, 0x0a67, 0x01e6, 0x09e6, 
-  0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x09c6, 0x09e6, 0x01c6, 0x01c6, 0x01c6, 0x0a66, 0x1b49, 0x1267, 
-  0x01a5, 0x01e6, 0x0a86, 0x1b28, 0x1b28, 0x23a9, 0x1ac7, 0x0000, 0x60a4, 0xb989, 0x3041, 0x1020, 
-  0x7106, 0x9147, 0x70c5, 0x3841, 0x4062, 0x2841, 0x4883, 0x7906, 0x7926, 0x3862, 0x1800, 0xa148, 
-  0x7106, 0x0000, 0x0944, 0x01e6, 0x0a26, 0x1b08, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b08, 0x0205, 0x01c5, 0x01e6, 0x01c5, 0x1b08, 0x0a67, 0x01a6, 0x09c6, 0x01a6, 0x1267, 0x1ac7, 
-  0x01a5, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x09c6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x01c6, 0x0206, 0x1b28, 0x01e6, 0x01a6, 0x09c6, 0x01c5, 0x1b08, 0x0a46, 0x01a5, 
-  0x09c6, 0x01a6, 0x1287, 0x1ac8, 0x01c5, 0x01e6, 0x01c6, 0x01c6, 0x01e5, 0x12a7, 0x12a7, 0x01c5, 
-  0x01c6, 0x01c6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1267, 0x01c6, 0x09e6, 0x09e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x09e6, 0x09c6, 0x01c6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 
-  0x09e6, 0x09e6, 0x01e6, 0x01c6, 0x0a06, 0x1ae8, 0x0a27, 0x01c6, 0x09c6, 0x01e6, 0x1ac8, 0x1288, 
-  0x01e6, 0x01c6, 0x0a06, 0x1ae7, 0x12a7, 0x09e6, 0x01c6, 0x09e6, 0x12c7, 0x1b28, 0x0a26, 0x01c6, 
-  0x01c6, 0x01e6, 0x12a7, 0x0a47, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e5, 0x1287, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1267, 0x01c6, 0x09c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x09c6, 0x09c6, 0x01c6, 0x01c5, 0x0a66, 0x1b08, 0x0a67, 0x01c6, 
-  0x01c6, 0x01c5, 0x1b68, 0x0ac6, 0x0a85, 0x1b88, 0x12c6, 0x0061, 0x1821, 0x50a3, 0x4062, 0x2021, 
-  0x0000, 0x0800, 0x3021, 0xa128, 0xc149, 0xb169, 0x58c4, 0x0000, 0x0000, 0x2021, 0x4083, 0x5083, 
-  0x2041, 0x0020, 0x0944, 0x01c6, 0x0a26, 0x1b08, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e5, 0x01c5, 0x01c6, 0x01c5, 0x1b08, 0x0a67, 0x01a6, 0x01c6, 0x01a6, 0x1267, 0x1ac7, 
-  0x01a5, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x09c6, 0x09c6, 0x01c6, 
-  0x01c6, 0x09c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x09e6, 0x09e6, 0x01c6, 0x0206, 0x1b08, 0x01e6, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x0a46, 0x01c5, 
-  0x01c6, 0x01a6, 0x1287, 0x1ae7, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x1ae8, 0x12a7, 
-  0x01e5, 0x01a6, 0x01c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c6, 0x09c6, 0x01c6, 0x09e6, 
-  0x09e6, 0x01e6, 0x01c6, 0x01c6, 0x09e7, 0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x01c6, 0x09e6, 
-  0x09e7, 0x09e6, 0x09e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x0a26, 0x1b08, 0x0a47, 0x01c6, 0x09e6, 0x01e6, 0x1ac8, 0x12a7, 0x01e6, 
-  0x01a6, 0x09e5, 0x1ac7, 0x1287, 0x01c6, 0x01c6, 0x0206, 0x1ae7, 0x1b28, 0x0a26, 0x01c6, 0x01c6, 
-  0x0a06, 0x1aa7, 0x1247, 0x01c5, 0x01c6, 0x01e6, 0x09e7, 0x01c6, 0x01c6, 0x01e6, 0x1ae8, 0x12a7, 
-  0x01a5, 0x01c6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01c5, 0x01c5, 0x01a5, 0x01a6, 0x01a5, 0x01c5, 
-  0x01c5, 0x01c6, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x09e6, 0x09e6, 0x01e6, 0x09c6, 0x09e6, 0x09c6, 0x01e5, 0x0a86, 0x1b48, 0x1287, 0x01c5, 0x01e6, 
-  0x01c6, 0x01a5, 0x1b07, 0x1327, 0x1327, 0x23e9, 0x1b68, 0x0944, 0x0000, 0x1820, 0xa168, 0xa949, 
-  0x4883, 0x0000, 0x68e5, 0xd12a, 0xc0e8, 0xc908, 0xb169, 0x2021, 0x2842, 0xa948, 0xc16a, 0x4883, 
-  0x0000, 0x08a2, 0x09a6, 0x01a5, 0x0a06, 0x1b08, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e5, 0x01c5, 0x01c6, 0x01a5, 0x1b08, 0x0a67, 0x01c6, 0x01e6, 0x01a6, 0x1267, 0x1ac8, 
-  0x01a5, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x09c6, 0x09c6, 0x01c6, 0x09c6, 0x09c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x09e7, 0x09e6, 0x01c6, 0x0a06, 0x1b28, 0x01e6, 0x01c6, 0x09c6, 0x01c5, 0x1b08, 0x0a66, 0x01a5, 
-  0x09c6, 0x01a6, 0x1287, 0x12c7, 0x01a5, 0x01c6, 0x09e6, 0x09c6, 0x01c6, 0x01c6, 0x0a26, 0x2328, 
-  0x12a7, 0x01e5, 0x01c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x09e6, 
-  0x09e6, 0x09e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x09e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01c6, 0x0a26, 0x1b08, 0x0a47, 0x01c6, 0x09e6, 0x01e6, 0x12a8, 0x1288, 0x09e6, 0x01c6, 
-  0x09e5, 0x1ac7, 0x1246, 0x01a5, 0x01c6, 0x01e6, 0x1ae7, 0x2348, 0x0a46, 0x01e6, 0x01c6, 0x09e6, 
-  0x1aa8, 0x0a27, 0x01a5, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x0206, 0x12a7, 0x1287, 0x09e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c7, 0x01c7, 0x01c7, 0x01c7, 0x01e7, 0x01e6, 0x01c6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c7, 0x01c7, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01c5, 0x0a86, 0x1b68, 0x0a86, 0x01e6, 0x09e6, 0x01c6, 
-  0x01a6, 0x0a05, 0x1b28, 0x23c9, 0x2409, 0x23e9, 0x0a87, 0x09a5, 0x0040, 0x1821, 0xa128, 0xc909, 
-  0xb149, 0x3041, 0x60c5, 0xd16a, 0xc908, 0xc109, 0xb169, 0x4883, 0x9127, 0xc909, 0xc92a, 0x50a4, 
-  0x0000, 0x0924, 0x01a6, 0x0186, 0x0a06, 0x1b08, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e5, 0x01a6, 0x01c6, 0x01a6, 0x1b08, 0x0a47, 0x01c6, 0x01e6, 0x01a6, 0x1267, 0x1ac8, 
-  0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01e6, 0x01c6, 0x01c6, 0x0206, 0x1b08, 0x01e6, 0x01c6, 0x09c6, 0x01e5, 0x1b08, 0x1286, 0x01a5, 
-  0x09c6, 0x01a5, 0x1286, 0x12a7, 0x0185, 0x01c6, 0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x01e6, 0x0206, 
-  0x1ac8, 0x12a7, 0x01e5, 0x01c6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x0206, 0x12c7, 0x1b28, 0x12e7, 0x01e5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x09c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e5, 0x01e5, 0x01e5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x0a46, 0x2349, 0x0a67, 0x01c6, 0x09e7, 0x0206, 0x1ac8, 0x12c8, 0x0207, 0x01c6, 0x0a26, 
-  0x1ae7, 0x1266, 0x01a5, 0x01a6, 0x01c5, 0x1ae7, 0x2348, 0x0a67, 0x01e6, 0x09e7, 0x09e6, 0x1ac8, 
-  0x0a26, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x0226, 0x1b08, 0x1287, 0x01c5, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01e5, 0x01e5, 0x0a86, 0x1b68, 0x0a87, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01e5, 0x12c7, 0x0a86, 0x0a66, 0x0a86, 0x0a86, 0x01e5, 0x09c6, 0x00c2, 0x0000, 0x7906, 0xc929, 
-  0xd14a, 0x68c5, 0x1820, 0x8927, 0xb169, 0xa168, 0x58c4, 0x4863, 0xc949, 0xc909, 0xb149, 0x2841, 
-  0x0041, 0x0985, 0x01a5, 0x01a6, 0x0a06, 0x1ae8, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x0206, 
-  0x1b08, 0x01e6, 0x01a6, 0x01c6, 0x01a6, 0x1b08, 0x0a67, 0x01c6, 0x09e6, 0x01c6, 0x1287, 0x1ac8, 
-  0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x09c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x09e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x0206, 0x1b08, 0x01e6, 0x01c6, 0x09c7, 0x01e6, 0x1b28, 0x1287, 0x01c6, 
-  0x01c6, 0x01a5, 0x1286, 0x1ae7, 0x01c5, 0x01a5, 0x01c6, 0x09e7, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 
-  0x0206, 0x1b08, 0x12c7, 0x01e5, 0x01c6, 0x01c6, 0x09c6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 
-  0x01c6, 0x01e6, 0x09e6, 0x09e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x0206, 0x0206, 0x0226, 
-  0x0226, 0x1307, 0x1ba8, 0x1b87, 0x23a8, 0x1ae7, 0x01e5, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x0226, 0x1ae8, 0x1b28, 0x1b08, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b29, 0x1b29, 0x1b28, 0x1b29, 0x1b29, 0x1b08, 0x1b08, 
-  0x1ae8, 0x1ae8, 0x0a47, 0x01c6, 0x01e6, 0x0a26, 0x1ac7, 0x12c8, 0x0a07, 0x09e6, 0x0a05, 0x1b08, 
-  0x1287, 0x01a5, 0x01a5, 0x09c5, 0x12a6, 0x1b07, 0x0a46, 0x01c6, 0x01c6, 0x01e6, 0x12a7, 0x0a26, 
-  0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x0206, 0x1b08, 0x1287, 0x01e5, 0x01c6, 0x01c6, 
-  0x01c6, 0x0205, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b09, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1b08, 0x1b08, 0x1ae8, 0x1b08, 0x2349, 0x0a87, 0x01e5, 0x01e6, 0x09e6, 0x01e6, 0x0a46, 
-  0x12e7, 0x0a67, 0x01c6, 0x01a5, 0x01a5, 0x01c5, 0x01c6, 0x01a6, 0x0964, 0x0020, 0x1821, 0x9127, 
-  0xc18a, 0x60c4, 0x0800, 0x3021, 0x6083, 0x4883, 0x0800, 0x3862, 0xb169, 0xa128, 0x4863, 0x0000, 
-  0x0903, 0x09a6, 0x01a6, 0x01a6, 0x0a06, 0x1ae7, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x01c6, 0x0206, 
-  0x1ae8, 0x01c5, 0x01a6, 0x01c6, 0x01a6, 0x1ae8, 0x0a47, 0x01c6, 0x09e6, 0x01c6, 0x1287, 0x1ae8, 
-  0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x0206, 0x1b08, 0x01e6, 0x09e6, 0x09e7, 0x01e6, 0x1b28, 0x0a86, 0x01c6, 
-  0x01c6, 0x1286, 0x2348, 0x2348, 0x0a26, 0x01a5, 0x01c6, 0x09e6, 0x09e6, 0x01e6, 0x01c6, 0x01e7, 
-  0x01e6, 0x0a26, 0x1b08, 0x12c7, 0x01e6, 0x01c6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01c6, 0x09e6, 0x09e6, 0x01e6, 0x01c6, 0x01c6, 0x01c5, 0x12c7, 0x1b08, 0x1b08, 0x1b49, 0x1b48, 
-  0x1b48, 0x23a9, 0x1b87, 0x0ae5, 0x1b67, 0x1b68, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x0206, 0x0226, 0x1b08, 0x1ae8, 0x0a46, 0x0a46, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a06, 0x0a06, 0x0a26, 0x0a46, 0x0a66, 0x1266, 0x1266, 0x1246, 0x1226, 0x0a26, 0x0a05, 0x0a26, 
-  0x0a06, 0x01e6, 0x01c5, 0x01c5, 0x0a26, 0x1b08, 0x12c7, 0x0206, 0x01c6, 0x01e5, 0x1ae7, 0x1ac7, 
-  0x01c5, 0x01a5, 0x01a5, 0x12a6, 0x1b28, 0x0a26, 0x01c6, 0x01e6, 0x01e6, 0x1ac8, 0x1287, 0x01c6, 
-  0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c5, 0x1287, 0x1267, 0x01c5, 0x01c6, 0x01c6, 0x01e5, 
-  0x0a86, 0x2368, 0x1286, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x1226, 0x1226, 0x0a26, 
-  0x0a26, 0x1246, 0x0a66, 0x0a66, 0x0a46, 0x0a26, 0x0a06, 0x0a05, 0x0a05, 0x0a06, 0x0a26, 0x0a26, 
-  0x0a06, 0x0a26, 0x0a26, 0x0a26, 0x0a46, 0x0226, 0x01e5, 0x01c6, 0x01e6, 0x0206, 0x0246, 0x1307, 
-  0x0ac7, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x01c6, 0x0985, 0x00a1, 0x1020, 
-  0x2861, 0x1000, 0x50e4, 0xa969, 0xb108, 0xb129, 0x8947, 0x2841, 0x2041, 0x1800, 0x0040, 0x0944, 
-  0x09a5, 0x01c6, 0x01c6, 0x01c6, 0x0a26, 0x1b07, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x0205, 
-  0x1ae8, 0x01e6, 0x01c6, 0x01c6, 0x01a5, 0x1ae7, 0x0a67, 0x01c6, 0x01e6, 0x01c6, 0x12a7, 0x1b08, 
-  0x01c5, 0x09c6, 0x09a6, 0x0985, 0x0985, 0x01a6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x0a06, 0x1b08, 0x0206, 0x09e6, 0x09e7, 0x01e6, 0x1b28, 0x12a7, 0x01c5, 
-  0x01c5, 0x12a6, 0x2307, 0x2307, 0x11e5, 0x0164, 0x01c6, 0x01c6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x0a26, 0x1ae8, 0x12c7, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x12c7, 0x1ae7, 0x0225, 0x0205, 0x0226, 0x0a46, 
-  0x0246, 0x1307, 0x1b88, 0x1b47, 0x1b68, 0x1b28, 0x09e6, 0x09e6, 0x09c6, 0x09c6, 0x09a6, 0x09c5, 
-  0x09c6, 0x09c6, 0x01c5, 0x1ae8, 0x2308, 0x09e6, 0x01c6, 0x01a6, 0x0186, 0x0186, 0x0185, 0x0185, 
-  0x01a5, 0x01a5, 0x01a5, 0x01e6, 0x0985, 0x0081, 0x0061, 0x0040, 0x0020, 0x0020, 0x0020, 0x00e2, 
-  0x0a26, 0x0a46, 0x0a86, 0x0a86, 0x2348, 0x2368, 0x01e6, 0x01c6, 0x01a5, 0x1ac7, 0x1ae8, 0x0a06, 
-  0x09c6, 0x09e6, 0x1b08, 0x1b08, 0x09e5, 0x01a5, 0x01a6, 0x01a5, 0x1aa7, 0x1267, 0x09e6, 0x0a06, 
-  0x09e6, 0x09e6, 0x09c6, 0x09c6, 0x01a5, 0x1267, 0x0a06, 0x0185, 0x09a6, 0x09c6, 0x01c6, 0x0a86, 
-  0x2349, 0x12c7, 0x0206, 0x01c6, 0x01a6, 0x0185, 0x0185, 0x0185, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x0124, 0x0041, 0x0020, 0x0020, 0x0020, 
-  0x0040, 0x0040, 0x0143, 0x09a5, 0x00a1, 0x0040, 0x0020, 0x0020, 0x0020, 0x0041, 0x0124, 0x01c5, 
-  0x01c6, 0x01c6, 0x09c6, 0x09a6, 0x0985, 0x09a5, 0x09a6, 0x09a6, 0x01c6, 0x0a26, 0x1ae8, 0x1266, 
-  0x0a06, 0x09c6, 0x09c6, 0x09a6, 0x0985, 0x0985, 0x0985, 0x01a5, 0x01e6, 0x0a27, 0x0a27, 0x0964, 
-  0x0061, 0x0000, 0x38a3, 0xa148, 0xb149, 0xb149, 0x8927, 0x1821, 0x0020, 0x0903, 0x0a06, 0x0a27, 
-  0x09a6, 0x09a6, 0x09c6, 0x09c6, 0x0a26, 0x1ae7, 0x01c5, 0x09a6, 0x09c6, 0x09c6, 0x09c6, 0x09e5, 
-  0x1ae8, 0x09e6, 0x01a5, 0x09a5, 0x0185, 0x1ac7, 0x1226, 0x01a5, 0x01e6, 0x0a07, 0x09c5, 0x00e2, 
-  0x0081, 0x0061, 0x0041, 0x0040, 0x0020, 0x0082, 0x09a5, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 
-  0x09c6, 0x09c6, 0x01c5, 0x09c5, 0x01c6, 0x09c5, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 
-  0x09c6, 0x09a6, 0x09a5, 0x0a05, 0x2328, 0x0a26, 0x0a07, 0x0a07, 0x01c5, 0x1b28, 0x1aa7, 0x00c1, 
-  0x0081, 0x0080, 0x0040, 0x0040, 0x0020, 0x0081, 0x0985, 0x01a6, 0x01c6, 0x01c6, 0x09e6, 0x09e6, 
-  0x01e7, 0x09e7, 0x01e6, 0x0a06, 0x12e8, 0x1287, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e5, 0x1ae8, 0x1b08, 0x0205, 0x01a5, 0x01a5, 0x01a6, 0x01c6, 
-  0x01c5, 0x01e5, 0x12c7, 0x1b28, 0x12e7, 0x09e4, 0x00c2, 0x0081, 0x0061, 0x0061, 0x0061, 0x0061, 
-  0x0061, 0x0061, 0x0061, 0x0881, 0x0881, 0x0061, 0x0061, 0x0041, 0x0041, 0x0041, 0x0041, 0x00a2, 
-  0x09a5, 0x01e6, 0x01e6, 0x09c6, 0x00a1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 
-  0x1205, 0x2368, 0x1b48, 0x2368, 0x23a9, 0x1aa7, 0x00c2, 0x0061, 0x0041, 0x0881, 0x0081, 0x0081, 
-  0x00a1, 0x00a1, 0x08e2, 0x00a1, 0x0041, 0x0041, 0x0061, 0x0061, 0x0881, 0x0081, 0x0081, 0x0081, 
-  0x0061, 0x0081, 0x0081, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x00a2, 0x09c5, 0x1b49, 
-  0x12c7, 0x0226, 0x0985, 0x08a2, 0x0041, 0x0041, 0x0041, 0x0041, 0x0061, 0x0944, 0x0a07, 0x0a07, 
-  0x0924, 0x0082, 0x0061, 0x0061, 0x0041, 0x08a2, 0x0904, 0x0041, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0985, 
-  0x0a06, 0x09c6, 0x0903, 0x0061, 0x0061, 0x0041, 0x0041, 0x0061, 0x0061, 0x0081, 0x08c1, 0x0081, 
-  0x0061, 0x0061, 0x0061, 0x0041, 0x0041, 0x0041, 0x0041, 0x00e3, 0x09e6, 0x0227, 0x0207, 0x1248, 
-  0x0903, 0x0000, 0x0000, 0x0000, 0x1820, 0x1820, 0x0800, 0x0820, 0x0881, 0x1206, 0x12c8, 0x09e5, 
-  0x0081, 0x0061, 0x0061, 0x0061, 0x00a1, 0x08a1, 0x0061, 0x0041, 0x0061, 0x0061, 0x0061, 0x0081, 
-  0x08c2, 0x0881, 0x0061, 0x0061, 0x0061, 0x0881, 0x0081, 0x0081, 0x0903, 0x0944, 0x0061, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08c3, 0x09c5, 0x01e6, 0x01e6, 0x01e6, 0x0964, 
-  0x0082, 0x0061, 0x0081, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 
-  0x0061, 0x0061, 0x0061, 0x0081, 0x08e2, 0x00c2, 0x0924, 0x09c6, 0x01a5, 0x1287, 0x0923, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00a2, 0x0985, 0x01c6, 0x01c6, 0x09e6, 0x01e6, 
-  0x01e6, 0x09e7, 0x09e7, 0x01c6, 0x0a06, 0x2308, 0x12a7, 0x01c6, 0x09e6, 0x0a07, 0x0a07, 0x0a07, 
-  0x1287, 0x12a7, 0x12a7, 0x1287, 0x1b08, 0x1b28, 0x0206, 0x01c6, 0x01c6, 0x0a46, 0x1287, 0x1287, 
-  0x12a7, 0x12a7, 0x12a7, 0x12c7, 0x1266, 0x00e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x00a2, 0x09c6, 0x0a27, 0x00c2, 0x0020, 0x1020, 0x48c3, 0x48c4, 0x48c4, 0x40c4, 0x1041, 0x0000, 
-  0x0020, 0x0142, 0x0a46, 0x0a66, 0x0a05, 0x00e1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0081, 0x0a06, 
-  0x0a46, 0x0985, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0944, 0x0944, 
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x40e4, 0x48e4, 0x48c4, 
-  0x40e4, 0x1040, 0x0000, 0x0000, 0x0800, 0x38a3, 0x48c4, 0x48c3, 0x40c3, 0x1040, 0x0000, 0x0061, 
-  0x0984, 0x00e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08e3, 0x09e6, 0x0a07, 0x0944, 
-  0x0020, 0x0000, 0x3083, 0x40a4, 0x48a4, 0x50c4, 0x48a3, 0x0800, 0x0020, 0x00e2, 0x1205, 0x00a1, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x29e4, 0x3245, 0x3224, 0x3225, 0x2183, 0x0000, 0x0000, 0x0103, 0x0a07, 0x0a06, 0x0964, 0x0040, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x00c2, 0x09c5, 0x0903, 0x0000, 0x0020, 
-  0x3205, 0x3a45, 0x3225, 0x3a45, 0x1102, 0x0000, 0x0020, 0x0924, 0x01c6, 0x01e6, 0x09e6, 0x01e6, 
-  0x01e6, 0x09e7, 0x01e6, 0x09e7, 0x09e6, 0x0a06, 0x1b08, 0x1287, 0x09e6, 0x09e6, 0x09e7, 0x0a07, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae7, 0x1ae7, 0x0a46, 0x01e6, 0x01a6, 0x0206, 0x1ae8, 0x12c7, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x11a4, 0x0000, 0x2061, 0x5905, 0x50e4, 0x5105, 0x5905, 0x5905, 
-  0x5905, 0x5905, 0x5905, 0x5904, 0x58e4, 0x58e4, 0x58e4, 0x58e4, 0x50e4, 0x50e4, 0x50e4, 0x1841, 
-  0x0000, 0x08e3, 0x0944, 0x0040, 0x1020, 0x7105, 0xb9aa, 0xc16a, 0xc169, 0xc18a, 0x8147, 0x2882, 
-  0x0000, 0x0061, 0x0964, 0x0985, 0x00c2, 0x0040, 0x0820, 0x48e4, 0x50e4, 0x50e4, 0x58e4, 0x58e4, 
-  0x5905, 0x5905, 0x5905, 0x5905, 0x5904, 0x58e4, 0x5904, 0x5905, 0x5905, 0x5904, 0x5905, 0x5905, 
-  0x5905, 0x5905, 0x5905, 0x5905, 0x5905, 0x5905, 0x5904, 0x50e4, 0x5905, 0x40c3, 0x0000, 0x08c2, 
-  0x0965, 0x0882, 0x0000, 0x0820, 0x40c4, 0x48c4, 0x48c4, 0x48c4, 0x2061, 0x0000, 0x0020, 0x0000, 
-  0x1820, 0x6105, 0x60e5, 0x58e4, 0x48e4, 0x1020, 0x0000, 0x0000, 0x58e4, 0xb9aa, 0xc98a, 0xc18a, 
-  0xc9aa, 0x7126, 0x1020, 0x0000, 0x58c4, 0xb989, 0xc98a, 0xc98a, 0xc1aa, 0x6905, 0x0820, 0x0020, 
-  0x0061, 0x0000, 0x2061, 0x50e4, 0x50c4, 0x50e4, 0x50e4, 0x50e4, 0x58e4, 0x58e5, 0x58e5, 0x58e5, 
-  0x58e5, 0x58e5, 0x58e5, 0x58e5, 0x58e5, 0x58e4, 0x5905, 0x2061, 0x0000, 0x0081, 0x08e3, 0x0020, 
-  0x0000, 0x48a3, 0xb989, 0xc96a, 0xc96a, 0xd18a, 0xc169, 0x58c4, 0x0820, 0x0040, 0x0881, 0x0000, 
-  0x1943, 0x3ac6, 0x3aa5, 0x3aa5, 0x3aa5, 0x3a85, 0x3a85, 0x3a85, 0x3a85, 0x3a85, 0x3a85, 0x3a85, 
-  0x3a85, 0x3aa5, 0x3aa5, 0x3a85, 0x3aa5, 0x3a85, 0x3a85, 0x3225, 0x0000, 0x0000, 0x0000, 0x3a65, 
-  0x858a, 0x85c9, 0x85c9, 0x85ea, 0x7509, 0x29c4, 0x0000, 0x0061, 0x0903, 0x0903, 0x0041, 0x0000, 
-  0x0060, 0x3a86, 0x3a85, 0x3aa5, 0x3aa5, 0x3a85, 0x3a85, 0x3a85, 0x3aa5, 0x3aa5, 0x3aa5, 0x3a85, 
-  0x3a85, 0x3a85, 0x3a85, 0x3a85, 0x3ac5, 0x3224, 0x0000, 0x0040, 0x00a2, 0x0020, 0x0000, 0x42c6, 
-  0x85aa, 0x85e9, 0x85c9, 0x860a, 0x6468, 0x3245, 0x0020, 0x0061, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x09e6, 0x01c6, 0x0a06, 0x1b08, 0x12c8, 0x01e6, 0x09e6, 0x0a07, 
-  0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c6, 0x01c6, 0x0206, 0x1ae8, 0x0a46, 0x01a5, 0x01c5, 
-  0x01c6, 0x01c6, 0x01e6, 0x01c5, 0x0020, 0x1841, 0x8967, 0xc1aa, 0xc189, 0xc189, 0xc169, 0xc169, 
-  0xc169, 0xc169, 0xc169, 0xc169, 0xc169, 0xc169, 0xc169, 0xc169, 0xc169, 0xc169, 0xc189, 0x8947, 
-  0x2882, 0x0020, 0x0020, 0x0000, 0x2862, 0xb9aa, 0xc128, 0xc128, 0xc128, 0xc128, 0xc98a, 0x6946, 
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x0820, 0x6905, 0xb9a9, 0xc189, 0xc169, 0xc169, 0xc169, 
-  0xc169, 0xc169, 0xc169, 0xc169, 0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 
-  0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xb189, 0x58e4, 0x0800, 
-  0x0020, 0x0000, 0x0800, 0x6105, 0xb9a9, 0xc169, 0xb969, 0xb989, 0x9147, 0x2862, 0x0000, 0x1020, 
-  0x8126, 0xc9aa, 0xc969, 0xc169, 0xb98a, 0x7946, 0x1020, 0x0800, 0xa189, 0xc929, 0xc128, 0xc128, 
-  0xc128, 0xb98a, 0x2882, 0x1000, 0xa969, 0xc129, 0xc148, 0xc128, 0xc149, 0xb189, 0x2061, 0x0000, 
-  0x0000, 0x1841, 0x9167, 0xc9aa, 0xc189, 0xc169, 0xc169, 0xc169, 0xc169, 0xc169, 0xc169, 0xc169, 
-  0xc169, 0xc169, 0xc969, 0xc989, 0xc989, 0xc189, 0xc98a, 0x9147, 0x2062, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x9968, 0xc949, 0xc128, 0xc128, 0xc128, 0xc949, 0xa9a9, 0x1841, 0x0000, 0x0000, 0x1943, 
-  0x6cc9, 0x85e9, 0x85c8, 0x85c8, 0x7dc8, 0x7da8, 0x7d88, 0x7d88, 0x7d88, 0x7d88, 0x7da8, 0x7da8, 
-  0x7da8, 0x7da8, 0x7da8, 0x7da8, 0x7da8, 0x7da8, 0x85a8, 0x8589, 0x42e6, 0x0020, 0x0000, 0x74c9, 
-  0x7da7, 0x7546, 0x7566, 0x7546, 0x7dc8, 0x6c4a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 
-  0x5367, 0x85c9, 0x7dc8, 0x7dc8, 0x7dc8, 0x7dc8, 0x7dc8, 0x7dc8, 0x85c8, 0x85c8, 0x7dc8, 0x7dc8, 
-  0x7dc8, 0x85c8, 0x85c8, 0x85c8, 0x85c8, 0x7d89, 0x42c6, 0x0000, 0x0000, 0x0000, 0x0020, 0x74e9, 
-  0x7587, 0x7546, 0x7566, 0x7546, 0x7dc8, 0x7d2a, 0x0040, 0x0040, 0x01c5, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x09e7, 0x09e6, 0x0a06, 0x1b28, 0x12c7, 0x01e6, 0x09e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01c6, 0x0a46, 0x1b48, 0x12a7, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x09c6, 0x0020, 0x3082, 0xc1aa, 0xc128, 0xc128, 0xc128, 0xc128, 0xc928, 
-  0xc128, 0xc928, 0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc9aa, 
-  0x60e4, 0x0000, 0x0020, 0x0000, 0x3042, 0xb969, 0xc149, 0xc149, 0xc149, 0xc148, 0xc96a, 0x6906, 
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x1020, 0xa168, 0xc949, 0xc128, 0xc128, 0xc128, 0xc128, 
-  0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc148, 0xc149, 0xc148, 0xc128, 
-  0xc128, 0xc928, 0xc128, 0xc128, 0xc128, 0xc128, 0xc928, 0xc128, 0xc128, 0xc949, 0x8147, 0x0000, 
-  0x0020, 0x0000, 0x0820, 0xa188, 0xc949, 0xc128, 0xc128, 0xc108, 0xc18a, 0x48c4, 0x0000, 0x1841, 
-  0xb969, 0xc949, 0xc148, 0xc128, 0xc128, 0xb9aa, 0x2062, 0x0800, 0xa168, 0xc949, 0xc149, 0xc149, 
-  0xc149, 0xb989, 0x2862, 0x1000, 0xa948, 0xc149, 0xc149, 0xc149, 0xc149, 0xb189, 0x2861, 0x0000, 
-  0x0000, 0x3062, 0xb989, 0xc949, 0xc149, 0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc108, 
-  0xc108, 0xc128, 0xc128, 0xc948, 0xc129, 0xc149, 0xc128, 0xc98a, 0x50e4, 0x0000, 0x0000, 0x0000, 
-  0x0800, 0xa148, 0xc949, 0xc149, 0xc149, 0xc149, 0xc949, 0xa989, 0x1841, 0x0020, 0x0000, 0x3245, 
-  0x85c9, 0x7546, 0x7566, 0x7566, 0x7566, 0x7566, 0x6d46, 0x7546, 0x7546, 0x7546, 0x7546, 0x7566, 
-  0x7566, 0x7566, 0x7546, 0x7566, 0x7566, 0x7566, 0x7546, 0x7d87, 0x74ca, 0x0020, 0x0020, 0x6ca9, 
-  0x7da7, 0x7567, 0x7567, 0x7566, 0x7da7, 0x6408, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0861, 
-  0x750a, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 
-  0x7586, 0x7586, 0x7586, 0x7586, 0x6d46, 0x7dc8, 0x6428, 0x0000, 0x0020, 0x0000, 0x0020, 0x6ca8, 
-  0x7587, 0x7567, 0x7567, 0x7587, 0x7da7, 0x6ca9, 0x0040, 0x0041, 0x09a6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e7, 0x09e7, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x0a46, 0x2349, 0x1ae8, 0x09e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x0a46, 0x1b28, 0x12a7, 0x01e6, 0x01c6, 0x01e5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01e5, 0x09c5, 0x0020, 0x3062, 0xb989, 0xc128, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xc149, 0xc148, 0xc148, 0xc148, 0xc149, 0xc149, 0xc169, 0xc169, 0xc149, 0xc149, 0xc98a, 
-  0x58e4, 0x0000, 0x0020, 0x0000, 0x3062, 0xb989, 0xc149, 0xc149, 0xc149, 0xc149, 0xc98a, 0x7126, 
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0800, 0x9147, 0xc969, 0xc149, 0xc149, 0xc148, 0xc128, 
-  0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc949, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xc148, 0xc149, 0xc149, 0xc149, 0xc149, 0xc129, 0xc148, 0xc128, 0xc149, 0x7926, 0x0000, 
-  0x0020, 0x0020, 0x0820, 0x9968, 0xc969, 0xc148, 0xc149, 0xc128, 0xc169, 0x40a3, 0x0000, 0x1820, 
-  0xa948, 0xc949, 0xc149, 0xc149, 0xc149, 0xb989, 0x2862, 0x0800, 0xa168, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xb989, 0x3062, 0x1000, 0xa968, 0xc149, 0xc149, 0xc149, 0xc149, 0xb189, 0x2861, 0x0000, 
-  0x0000, 0x3062, 0xb989, 0xc149, 0xc149, 0xc149, 0xc149, 0xc148, 0xc128, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xc149, 0xc149, 0xc149, 0xc169, 0xc149, 0xc148, 0xc969, 0x58c4, 0x0000, 0x0020, 0x0000, 
-  0x0800, 0xa168, 0xc969, 0xc149, 0xc149, 0xc149, 0xc949, 0xa989, 0x1841, 0x0020, 0x0000, 0x2a04, 
-  0x7d89, 0x7567, 0x7567, 0x7567, 0x7567, 0x7567, 0x7567, 0x7567, 0x7567, 0x7567, 0x7567, 0x7567, 
-  0x7567, 0x7567, 0x7567, 0x7567, 0x7587, 0x7587, 0x7567, 0x7d87, 0x6468, 0x0000, 0x0020, 0x6ca9, 
-  0x7da7, 0x7567, 0x7567, 0x7566, 0x7dc7, 0x6428, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0841, 
-  0x6cc9, 0x7587, 0x7587, 0x7587, 0x7587, 0x7587, 0x7587, 0x7587, 0x7587, 0x7587, 0x7587, 0x7587, 
-  0x7587, 0x7587, 0x7587, 0x7587, 0x7567, 0x7dc8, 0x5bc7, 0x0000, 0x0000, 0x0000, 0x0020, 0x6ca8, 
-  0x7da7, 0x7567, 0x7587, 0x7587, 0x7dc7, 0x6cc9, 0x0040, 0x0041, 0x09a6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e7, 0x09e6, 0x01e7, 0x01e7, 0x01e7, 0x09e6, 0x09e7, 0x0a07, 0x01e6, 0x0a47, 0x1b28, 0x1287, 
-  0x0206, 0x0206, 0x0206, 0x0226, 0x0226, 0x1b28, 0x12c7, 0x0206, 0x01e6, 0x0a66, 0x1b08, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1b08, 0x1aa7, 0x0020, 0x2862, 0xb189, 0xc149, 0xc169, 0xc169, 0xc149, 0xc949, 
-  0xc949, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc169, 0xc169, 0xc969, 0xc149, 0xc98a, 
-  0x58e4, 0x0000, 0x0020, 0x0000, 0x3042, 0xb989, 0xc149, 0xc149, 0xc149, 0xc149, 0xc98a, 0x6926, 
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0800, 0x9147, 0xc969, 0xc169, 0xc169, 0xc149, 0xc149, 
-  0xc149, 0xc149, 0xc149, 0xc169, 0xc169, 0xc149, 0xc149, 0xc949, 0xc169, 0xc169, 0xc949, 0xc149, 
-  0xc149, 0xc149, 0xc949, 0xc949, 0xc949, 0xc149, 0xc149, 0xc149, 0xc149, 0xc169, 0x7946, 0x0000, 
-  0x0020, 0x0000, 0x0820, 0x9988, 0xc949, 0xc948, 0xc949, 0xc128, 0xc18a, 0x40c4, 0x0000, 0x1820, 
-  0xa968, 0xc149, 0xc149, 0xc169, 0xc149, 0xc1aa, 0x2862, 0x0800, 0xa168, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xb989, 0x3082, 0x1000, 0xa969, 0xc149, 0xc149, 0xc149, 0xc149, 0xb189, 0x2862, 0x0000, 
-  0x0000, 0x3082, 0xb989, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc949, 
-  0xc169, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc989, 0x60c4, 0x0000, 0x0000, 0x0000, 
-  0x0800, 0xa168, 0xc969, 0xc149, 0xc149, 0xc149, 0xc949, 0xa989, 0x1841, 0x0020, 0x0000, 0x2a04, 
-  0x7da9, 0x7567, 0x7587, 0x7587, 0x7567, 0x7587, 0x7587, 0x7587, 0x7567, 0x7587, 0x7587, 0x7587, 
-  0x7587, 0x7d87, 0x7d87, 0x7d87, 0x7d87, 0x7d87, 0x7d87, 0x7dc8, 0x6c89, 0x0000, 0x0020, 0x6ca9, 
-  0x7da7, 0x7567, 0x7567, 0x7566, 0x7dc7, 0x6428, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 
-  0x3b46, 0x6d49, 0x6d48, 0x6d48, 0x6d48, 0x6548, 0x6d48, 0x6548, 0x6548, 0x6548, 0x6d48, 0x6d48, 
-  0x7587, 0x7587, 0x7587, 0x7587, 0x7587, 0x7dc8, 0x5bc7, 0x0000, 0x0000, 0x0000, 0x0020, 0x6ca8, 
-  0x7da7, 0x7587, 0x7587, 0x7587, 0x7da7, 0x6cc8, 0x0040, 0x0041, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x0a07, 0x09e6, 0x0a46, 0x2328, 
-  0x1b29, 0x2329, 0x2329, 0x2329, 0x2349, 0x12c7, 0x0206, 0x01e6, 0x0a86, 0x2369, 0x12c7, 0x0205, 
-  0x01e5, 0x01e5, 0x01e5, 0x09a4, 0x0000, 0x1000, 0x80c5, 0xa928, 0xb128, 0xb128, 0xb108, 0xb108, 
-  0xb108, 0xb108, 0xb108, 0xb108, 0xb108, 0xc149, 0xc149, 0xc949, 0xc169, 0xc969, 0xc149, 0xc98a, 
-  0x58e5, 0x0000, 0x0020, 0x0000, 0x3042, 0xb969, 0xc949, 0xc149, 0xc949, 0xc149, 0xc98a, 0x6926, 
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0800, 0x8106, 0xb929, 0xb128, 0xb128, 0xb108, 0xb108, 
-  0xb108, 0xb108, 0xb108, 0xb108, 0xb928, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xb928, 0xb108, 0xb108, 0xb108, 0xb108, 0xb108, 0xb928, 0xb128, 0xb928, 0xa908, 0x58a4, 0x0000, 
-  0x0020, 0x0000, 0x0820, 0x9968, 0xc949, 0xc949, 0xc949, 0xc128, 0xc98a, 0x40c4, 0x0000, 0x1820, 
-  0xa968, 0xc149, 0xc149, 0xc169, 0xc149, 0xc1aa, 0x2862, 0x0000, 0xa168, 0xc149, 0xb949, 0xc149, 
-  0xc949, 0xb989, 0x3062, 0x1000, 0xa969, 0xc949, 0xc149, 0xc149, 0xc149, 0xb189, 0x2862, 0x0000, 
-  0x0000, 0x2841, 0x9907, 0xb128, 0xa908, 0xb108, 0xb108, 0xb128, 0xb128, 0xb128, 0xb128, 0xb128, 
-  0xb128, 0xb948, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc96a, 0x60c4, 0x0000, 0x0020, 0x0000, 
-  0x0800, 0x9968, 0xc969, 0xc169, 0xc149, 0xc149, 0xc949, 0xa969, 0x1841, 0x0000, 0x0000, 0x0983, 
-  0x4c68, 0x6508, 0x5ce8, 0x5d08, 0x6508, 0x6508, 0x6508, 0x5d08, 0x5d08, 0x5d08, 0x5d08, 0x5d08, 
-  0x5d08, 0x5d28, 0x6528, 0x6528, 0x6528, 0x6508, 0x6508, 0x5d29, 0x2b26, 0x0020, 0x0020, 0x6cc9, 
-  0x7da7, 0x7567, 0x6d67, 0x6d66, 0x7dc7, 0x6428, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 
-  0x1b27, 0x1367, 0x1346, 0x1346, 0x1346, 0x1346, 0x1346, 0x0b46, 0x0b46, 0x0b46, 0x1346, 0x0b04, 
-  0x4c86, 0x7da7, 0x7587, 0x7587, 0x7587, 0x85e8, 0x5bc7, 0x0000, 0x0000, 0x0000, 0x0020, 0x6ca8, 
-  0x7da7, 0x7586, 0x7587, 0x7587, 0x7da7, 0x6ca8, 0x0040, 0x0041, 0x09a6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e6, 0x0a06, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01e5, 0x01e5, 0x01c6, 0x0a87, 0x2389, 0x12a7, 0x01e5, 0x01c6, 
-  0x01c5, 0x09e5, 0x0a05, 0x09a5, 0x0000, 0x1821, 0x6864, 0x7024, 0x7824, 0x7824, 0x7824, 0x7824, 
-  0x7824, 0x7824, 0x7044, 0x7824, 0x7824, 0xa8e7, 0xc969, 0xc949, 0xc169, 0xc169, 0xc149, 0xc98a, 
-  0x58e5, 0x0000, 0x0000, 0x0000, 0x3042, 0xb969, 0xc149, 0xc149, 0xc149, 0xc149, 0xc98a, 0x6926, 
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0800, 0x6084, 0x8045, 0x7845, 0x7845, 0x7844, 0x7844, 
-  0x7844, 0x7844, 0x7844, 0x7824, 0x9086, 0xc169, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xb929, 
-  0x8845, 0x7824, 0x7844, 0x7824, 0x7824, 0x7844, 0x7844, 0x7844, 0x7044, 0x7845, 0x5063, 0x0000, 
-  0x0000, 0x0000, 0x0820, 0x9968, 0xc949, 0xc949, 0xc149, 0xc928, 0xc18a, 0x40c4, 0x0000, 0x1820, 
-  0xa968, 0xc149, 0xc149, 0xc169, 0xc149, 0xc1aa, 0x2882, 0x0000, 0xa168, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xb989, 0x3062, 0x1000, 0xa969, 0xc949, 0xc149, 0xc149, 0xc149, 0xb189, 0x2861, 0x0000, 
-  0x0000, 0x2021, 0x7865, 0x7824, 0x7824, 0x7824, 0x7024, 0x7024, 0x7824, 0x7844, 0x7824, 0x7844, 
-  0x8044, 0xa907, 0xc969, 0xc149, 0xc128, 0xc149, 0xc129, 0xc96a, 0x60c4, 0x0000, 0x0020, 0x0000, 
-  0x1000, 0xa148, 0xc969, 0xc149, 0xc169, 0xc149, 0xc949, 0xa989, 0x1841, 0x0000, 0x0000, 0x09a4, 
-  0x1b47, 0x0b05, 0x0b26, 0x0b06, 0x0b06, 0x0b06, 0x0b26, 0x0b46, 0x1346, 0x0b46, 0x0b46, 0x0b46, 
-  0x0b46, 0x0b26, 0x0b26, 0x0b26, 0x0b06, 0x0b26, 0x1326, 0x1327, 0x1ac6, 0x0020, 0x0020, 0x6cc9, 
-  0x7da7, 0x7567, 0x7567, 0x7567, 0x7da7, 0x6429, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 
-  0x1b07, 0x2be8, 0x2386, 0x2386, 0x1b86, 0x2386, 0x23a6, 0x23a6, 0x23a6, 0x23a6, 0x23a6, 0x1b65, 
-  0x54a6, 0x7da7, 0x7587, 0x7587, 0x7587, 0x85e8, 0x5bc7, 0x0000, 0x0000, 0x0000, 0x0020, 0x6cc8, 
-  0x7da7, 0x7587, 0x7587, 0x7587, 0x7da7, 0x6cc9, 0x0040, 0x0041, 0x01a6, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x1267, 0x1267, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x1287, 0x2349, 0x12e8, 0x0206, 0x01e6, 0x0a26, 
-  0x1b08, 0x12c7, 0x12a7, 0x1226, 0x0000, 0x0800, 0x6084, 0x7865, 0x7045, 0x7045, 0x7045, 0x7045, 
-  0x7045, 0x7065, 0x7065, 0x7065, 0x7845, 0xb0e8, 0xc949, 0xc949, 0xc969, 0xc149, 0xc128, 0xc98a, 
-  0x58e5, 0x0000, 0x0000, 0x0000, 0x3062, 0xb969, 0xc149, 0xc149, 0xc149, 0xc149, 0xc18a, 0x6926, 
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x4863, 0x7065, 0x7065, 0x7065, 0x7065, 0x7065, 
-  0x7865, 0x7065, 0x7865, 0x7845, 0x90c7, 0xc169, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0x8065, 0x7045, 0x7045, 0x7065, 0x7065, 0x7045, 0x7045, 0x7045, 0x7045, 0x6085, 0x3062, 0x0000, 
-  0x0000, 0x0000, 0x0820, 0x9968, 0xc949, 0xc929, 0xc129, 0xc128, 0xc18a, 0x40c4, 0x0000, 0x1821, 
-  0xa968, 0xc949, 0xc149, 0xc149, 0xc149, 0xc1aa, 0x2862, 0x0000, 0xa168, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xb989, 0x2882, 0x1000, 0xa968, 0xc949, 0xc149, 0xc148, 0xc148, 0xb169, 0x2861, 0x0000, 
-  0x0000, 0x1020, 0x5884, 0x7065, 0x7045, 0x7045, 0x7045, 0x7045, 0x7045, 0x7865, 0x7845, 0x7865, 
-  0x7865, 0xa908, 0xc949, 0xc149, 0xc128, 0xc129, 0xc128, 0xc969, 0x60c4, 0x0000, 0x0020, 0x0000, 
-  0x1000, 0xa168, 0xc969, 0xc149, 0xc169, 0xc149, 0xc949, 0xa969, 0x1841, 0x0000, 0x0000, 0x0902, 
-  0x1ac7, 0x1327, 0x0b27, 0x3408, 0x3428, 0x3428, 0x3c48, 0x1ba7, 0x0b47, 0x0b88, 0x0b88, 0x0b88, 
-  0x1367, 0x3428, 0x3427, 0x3427, 0x3427, 0x1b67, 0x0b27, 0x1328, 0x11c4, 0x0000, 0x0040, 0x6cc9, 
-  0x7da7, 0x7587, 0x7567, 0x7567, 0x7da8, 0x6429, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 
-  0x4347, 0x7da9, 0x7568, 0x7588, 0x7588, 0x7588, 0x7588, 0x7588, 0x7588, 0x7568, 0x7568, 0x7568, 
-  0x7567, 0x7567, 0x7587, 0x7587, 0x7567, 0x85e8, 0x5be8, 0x0000, 0x0000, 0x0000, 0x0040, 0x6cc8, 
-  0x7da7, 0x7587, 0x7587, 0x7587, 0x7da7, 0x6cc9, 0x0040, 0x0041, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x12c7, 0x12c8, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x1287, 0x0206, 0x01e6, 0x0a46, 0x12e7, 
-  0x12e7, 0x0a25, 0x01a5, 0x0185, 0x0061, 0x0000, 0x2841, 0x5884, 0x5064, 0x5063, 0x4863, 0x4863, 
-  0x4863, 0x4863, 0x4884, 0x5084, 0x6064, 0xa907, 0xd169, 0xc949, 0xc949, 0xc149, 0xc129, 0xc98a, 
-  0x58e5, 0x0000, 0x0020, 0x0000, 0x3062, 0xb969, 0xc149, 0xc149, 0xc149, 0xc149, 0xc98a, 0x6926, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x4063, 0x4863, 0x4863, 0x4863, 0x5084, 
-  0x5084, 0x5084, 0x5084, 0x5063, 0xa128, 0xc969, 0xc149, 0xc149, 0xc149, 0xc149, 0xc949, 0xb949, 
-  0x6044, 0x4863, 0x5064, 0x5884, 0x5084, 0x5064, 0x4884, 0x4864, 0x5084, 0x4083, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x1000, 0xa168, 0xc929, 0xc128, 0xc129, 0xc128, 0xc969, 0x4883, 0x0000, 0x2020, 
-  0xb168, 0xc949, 0xc149, 0xc149, 0xc148, 0xc1aa, 0x2862, 0x0800, 0xa168, 0xc949, 0xc149, 0xc149, 
-  0xc148, 0xb989, 0x3062, 0x1000, 0xa969, 0xc949, 0xc149, 0xc148, 0xc949, 0xb169, 0x2861, 0x0000, 
-  0x0000, 0x0000, 0x1821, 0x4884, 0x4863, 0x4863, 0x4863, 0x4863, 0x4863, 0x5084, 0x5084, 0x5084, 
-  0x5084, 0x9927, 0xc969, 0xc149, 0xc149, 0xc129, 0xc128, 0xc969, 0x60c4, 0x0000, 0x0000, 0x0000, 
-  0x1000, 0x9948, 0xc969, 0xc169, 0xc169, 0xc149, 0xc949, 0xa989, 0x1841, 0x0000, 0x0000, 0x0000, 
-  0x08c2, 0x0984, 0x3387, 0x7588, 0x7588, 0x7588, 0x7d88, 0x5ce8, 0x1b06, 0x0a24, 0x0a24, 0x0a24, 
-  0x4428, 0x75a9, 0x7588, 0x7588, 0x7588, 0x5488, 0x1204, 0x0963, 0x0000, 0x0000, 0x0040, 0x6cc9, 
-  0x7da7, 0x7587, 0x7567, 0x7566, 0x7da7, 0x6429, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x08a1, 
-  0x856b, 0x7587, 0x7546, 0x7566, 0x7566, 0x7567, 0x7567, 0x7567, 0x7587, 0x7567, 0x7567, 0x7567, 
-  0x7547, 0x7547, 0x7567, 0x7587, 0x7567, 0x7da9, 0x4ba7, 0x0000, 0x0020, 0x0000, 0x0040, 0x6cc8, 
-  0x7da7, 0x7587, 0x7587, 0x7567, 0x7da7, 0x6ca9, 0x0020, 0x0041, 0x09a6, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 0x09e7, 0x0a07, 
-  0x01a4, 0x01a4, 0x01a4, 0x01a4, 0x01a4, 0x01a4, 0x01a4, 0x01c5, 0x01c5, 0x0a26, 0x1b48, 0x12a7, 
-  0x01e5, 0x01e6, 0x01e6, 0x1287, 0x11e5, 0x0061, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0820, 0x0800, 0x8906, 0xd16a, 0xc149, 0xc149, 0xc149, 0xc129, 0xc98a, 
-  0x58e5, 0x0000, 0x0020, 0x0000, 0x3062, 0xb989, 0xc949, 0xc149, 0xc149, 0xc149, 0xc98a, 0x6926, 
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0800, 0x0820, 0x0000, 0x4082, 0xb189, 0xc949, 0xc149, 0xc149, 0xc149, 0xc149, 0xc949, 0xc169, 
-  0x70e5, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0820, 0x0020, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x1000, 0xa168, 0xc949, 0xc149, 0xc149, 0xc149, 0xc949, 0x9106, 0x68c5, 0x80e5, 
-  0xb949, 0xc149, 0xc149, 0xc149, 0xc149, 0xc1aa, 0x2882, 0x0800, 0xa168, 0xc969, 0xc149, 0xc149, 
-  0xc149, 0xb989, 0x3062, 0x1020, 0xa989, 0xc169, 0xc149, 0xc149, 0xc949, 0xb189, 0x2861, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 
-  0x0000, 0x8106, 0xc969, 0xc148, 0xc149, 0xc149, 0xc128, 0xc969, 0x60c4, 0x0000, 0x0020, 0x0000, 
-  0x1000, 0x9968, 0xc969, 0xc149, 0xc149, 0xc149, 0xc949, 0xb169, 0x1841, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x6468, 0x7dc7, 0x7566, 0x7566, 0x6d46, 0x85c9, 0x3a85, 0x0000, 0x0000, 0x0860, 
-  0x7529, 0x7587, 0x7567, 0x7546, 0x7546, 0x7d89, 0x2143, 0x0000, 0x0020, 0x0000, 0x0040, 0x6cc9, 
-  0x7da7, 0x7587, 0x7567, 0x7566, 0x7da7, 0x6428, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0881, 
-  0x7d4a, 0x7567, 0x7546, 0x7546, 0x7546, 0x7566, 0x7586, 0x7587, 0x7587, 0x7587, 0x7567, 0x7547, 
-  0x7547, 0x7547, 0x7547, 0x7567, 0x7547, 0x756a, 0x22e5, 0x0020, 0x0020, 0x0000, 0x0040, 0x6cc8, 
-  0x7da7, 0x7567, 0x7567, 0x7567, 0x7d87, 0x6ca9, 0x0020, 0x0041, 0x01a6, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x09e7, 0x01e7, 0x09e7, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x12e8, 0x12e8, 0x12e7, 0x1b29, 0x12c8, 0x01e6, 
-  0x01e6, 0x01e5, 0x12c7, 0x1b28, 0x0a47, 0x0965, 0x0081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x8906, 0xc969, 0xc149, 0xc149, 0xc149, 0xc129, 0xc98a, 
-  0x58e5, 0x0000, 0x0020, 0x0000, 0x3062, 0xb989, 0xc969, 0xc169, 0xc169, 0xc149, 0xc98a, 0x6906, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x1821, 0x9968, 0xc169, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xb189, 0x58e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0800, 0xa168, 0xc949, 0xc149, 0xc149, 0xc149, 0xc149, 0xc169, 0xc969, 0xc169, 
-  0xc149, 0xc169, 0xc149, 0xc149, 0xc149, 0xc18a, 0x2841, 0x0800, 0xa168, 0xc969, 0xc149, 0xc149, 
-  0xc149, 0xb989, 0x3082, 0x1000, 0xa989, 0xc169, 0xc169, 0xc149, 0xc949, 0xb189, 0x2861, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x7906, 0xd169, 0xc149, 0xc149, 0xc149, 0xc128, 0xc969, 0x60c4, 0x0000, 0x0020, 0x0000, 
-  0x0800, 0x9968, 0xc969, 0xc149, 0xc169, 0xc149, 0xc949, 0xa969, 0x1841, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x6448, 0x7dc7, 0x7567, 0x7566, 0x7566, 0x85c9, 0x3a65, 0x0000, 0x0000, 0x0881, 
-  0x6d09, 0x7587, 0x7547, 0x7567, 0x7566, 0x7d89, 0x2163, 0x0000, 0x0020, 0x0000, 0x0040, 0x6cc9, 
-  0x7dc7, 0x7567, 0x7567, 0x7566, 0x7dc7, 0x6408, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 
-  0x53e7, 0x7568, 0x7547, 0x7547, 0x7567, 0x7588, 0x7dc8, 0x7dc8, 0x7dc8, 0x7587, 0x7567, 0x7547, 
-  0x7547, 0x7547, 0x7547, 0x7546, 0x7567, 0x54c8, 0x1a64, 0x0020, 0x0020, 0x0000, 0x0040, 0x6cc8, 
-  0x7da7, 0x7567, 0x7567, 0x7567, 0x7da7, 0x6ca9, 0x0020, 0x0020, 0x01a6, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x0a46, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a46, 0x0a46, 0x0a46, 0x0a66, 0x0a46, 0x01c6, 0x01e6, 
-  0x0205, 0x1b08, 0x12e8, 0x0226, 0x01e6, 0x0985, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8106, 0xc969, 0xb949, 0xc169, 0xc169, 0xc149, 0xc98a, 
-  0x58e4, 0x0000, 0x0020, 0x0000, 0x3062, 0xb989, 0xc169, 0xc969, 0xc149, 0xc149, 0xc969, 0x8927, 
-  0x3882, 0x38c3, 0x2082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 
-  0x0800, 0x1020, 0x8126, 0xc969, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xc169, 0xb989, 0x60e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0820, 0xa168, 0xd149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xc169, 0xc169, 0xc169, 0xc149, 0xc149, 0xc18a, 0x7906, 0x70c5, 0xb969, 0xc169, 0xc149, 0xc149, 
-  0xc149, 0xb989, 0x3082, 0x1000, 0xa989, 0xc169, 0xc149, 0xc149, 0xc949, 0xb189, 0x2861, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x8106, 0xd169, 0xc149, 0xc149, 0xc149, 0xc128, 0xc969, 0x60c4, 0x0000, 0x0020, 0x0000, 
-  0x0800, 0x9968, 0xc969, 0xc149, 0xc169, 0xc149, 0xc949, 0xa989, 0x1841, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x6468, 0x7dc7, 0x7566, 0x7587, 0x7566, 0x85c9, 0x3a65, 0x0000, 0x0000, 0x0881, 
-  0x7509, 0x7587, 0x7547, 0x7567, 0x7586, 0x7da9, 0x2183, 0x0000, 0x0020, 0x0000, 0x0040, 0x6cc9, 
-  0x75a7, 0x7567, 0x7567, 0x7566, 0x7da7, 0x6c68, 0x1942, 0x1943, 0x1923, 0x0040, 0x0000, 0x0020, 
-  0x1a24, 0x2b66, 0x2345, 0x2345, 0x2365, 0x23a5, 0x2be6, 0x3425, 0x4466, 0x7588, 0x7587, 0x7567, 
-  0x7547, 0x6d47, 0x7547, 0x7567, 0x54c7, 0x1aa5, 0x08c1, 0x0000, 0x0000, 0x0000, 0x0040, 0x6cc8, 
-  0x75a7, 0x7567, 0x7567, 0x7567, 0x7da7, 0x6cc9, 0x0020, 0x0041, 0x01a6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 0x09e7, 0x0a07, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e6, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 
-  0x12e8, 0x12c7, 0x0205, 0x0206, 0x09a6, 0x0061, 0x0000, 0x1820, 0x2041, 0x2041, 0x1821, 0x1841, 
-  0x1841, 0x1841, 0x1841, 0x2041, 0x1820, 0x88e6, 0xc969, 0xc149, 0xc149, 0xc149, 0xc149, 0xc98a, 
-  0x58e4, 0x0000, 0x0020, 0x0000, 0x3062, 0xb989, 0xc149, 0xc969, 0xc169, 0xc149, 0xc149, 0xc169, 
-  0xc189, 0xb9aa, 0x9968, 0x3062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x1000, 
-  0x50c4, 0xa188, 0xb969, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc129, 0xc128, 0xc129, 0xc149, 
-  0xc149, 0xc149, 0xb98a, 0x50c4, 0x0800, 0x0800, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0820, 0x9988, 0xd169, 0xc949, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xc169, 0xc169, 0xc149, 0xc149, 0xc149, 0xc969, 0xc98a, 0xc98a, 0xc169, 0xc169, 0xc169, 0xc149, 
-  0xc149, 0xb989, 0x3082, 0x1020, 0xa989, 0xc169, 0xc149, 0xc149, 0xc949, 0xb169, 0x2862, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x1020, 0x1841, 0x1841, 0x1821, 0x1841, 0x1841, 0x1841, 0x2041, 0x2041, 
-  0x1820, 0x9106, 0xd169, 0xc149, 0xc149, 0xc149, 0xc128, 0xc969, 0x60c4, 0x0000, 0x0000, 0x0000, 
-  0x0800, 0x9968, 0xc969, 0xc149, 0xc149, 0xc149, 0xc949, 0xa989, 0x1841, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x6468, 0x7dc7, 0x7567, 0x7587, 0x7566, 0x85c9, 0x3a65, 0x0000, 0x0000, 0x0881, 
-  0x6ce9, 0x7567, 0x7547, 0x7567, 0x7566, 0x7d89, 0x2183, 0x0000, 0x0020, 0x0000, 0x0040, 0x6ce9, 
-  0x75a7, 0x7587, 0x7567, 0x7566, 0x7567, 0x7d68, 0x7d89, 0x7d69, 0x856a, 0x4286, 0x0020, 0x0000, 
-  0x0081, 0x0a45, 0x0224, 0x0a85, 0x12e5, 0x1305, 0x1325, 0x23a4, 0x6d68, 0x7da7, 0x7587, 0x7567, 
-  0x7547, 0x6d27, 0x7546, 0x6508, 0x2386, 0x1205, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x6cc8, 
-  0x75a7, 0x7567, 0x7587, 0x7567, 0x7da7, 0x6cc9, 0x0020, 0x0021, 0x01a6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x01e7, 0x09e7, 0x01e7, 0x09e7, 0x0a07, 
-  0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x1b29, 0x2349, 
-  0x12c8, 0x0206, 0x0206, 0x09e6, 0x00c2, 0x0000, 0x3021, 0x9147, 0xb989, 0xb169, 0xb169, 0xb169, 
-  0xb169, 0xb169, 0xb169, 0xb169, 0xa969, 0xb949, 0xc149, 0xc149, 0xc169, 0xc149, 0xc149, 0xc98a, 
-  0x58e4, 0x0000, 0x0020, 0x0000, 0x3062, 0xb989, 0xc149, 0xc169, 0xc969, 0xc149, 0xc149, 0xc949, 
-  0xc929, 0xc128, 0xc98a, 0x6926, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1820, 0x50a3, 0xa988, 
-  0xb148, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc128, 0xc128, 0xc149, 0xc149, 
-  0xc149, 0xc149, 0xc149, 0xb949, 0xa988, 0x58a3, 0x2841, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0820, 0xa188, 0xd169, 0xc949, 0xc149, 0xc149, 0xc149, 0xc149, 0xc969, 0xc969, 
-  0xc169, 0xc169, 0xc149, 0xc149, 0xc169, 0xc149, 0xc169, 0xc149, 0xc169, 0xc969, 0xc169, 0xc149, 
-  0xc149, 0xb989, 0x3082, 0x1020, 0xa989, 0xc169, 0xc149, 0xc149, 0xc949, 0xb169, 0x2861, 0x0000, 
-  0x0020, 0x0000, 0x1820, 0x8126, 0xb1a9, 0xb189, 0xb189, 0xb189, 0xb189, 0xb169, 0xb169, 0xb169, 
-  0xb169, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc969, 0x58c4, 0x0000, 0x0000, 0x0000, 
-  0x0800, 0x9968, 0xc969, 0xc149, 0xc169, 0xc149, 0xc949, 0xa989, 0x1841, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x6468, 0x7dc7, 0x7567, 0x7587, 0x7566, 0x85c9, 0x3a65, 0x0000, 0x0000, 0x0861, 
-  0x6ce9, 0x7567, 0x7567, 0x7567, 0x7566, 0x7d88, 0x2183, 0x0000, 0x0020, 0x0000, 0x0040, 0x6ce9, 
-  0x75a7, 0x7566, 0x7587, 0x7587, 0x7567, 0x7567, 0x7587, 0x7586, 0x7587, 0x7d2b, 0x10a2, 0x0000, 
-  0x10c2, 0x19a3, 0x1983, 0x4346, 0x7569, 0x6d08, 0x6d28, 0x6d47, 0x7da7, 0x7da7, 0x7d87, 0x7587, 
-  0x7567, 0x7587, 0x6527, 0x2365, 0x0aa5, 0x1184, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x6cc9, 
-  0x75a7, 0x7567, 0x7587, 0x7567, 0x7da7, 0x6cc9, 0x0020, 0x0020, 0x09a6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01e6, 0x01e6, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01c5, 0x01c5, 0x0aa7, 0x1267, 0x0020, 0x2041, 0x9927, 0xc169, 0xc949, 0xc949, 0xc949, 0xc949, 
-  0xc949, 0xc969, 0xc969, 0xc169, 0xc169, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc148, 0xc98a, 
-  0x58e4, 0x0000, 0x0020, 0x0000, 0x3062, 0xb989, 0xc169, 0xc169, 0xc169, 0xc169, 0xc949, 0xc149, 
-  0xc149, 0xc149, 0xc969, 0x7106, 0x0000, 0x0000, 0x2862, 0x38a3, 0x48a3, 0x9988, 0xb969, 0xc949, 
-  0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xb108, 0xa0c7, 0xb969, 0xc149, 0xc149, 
-  0xc148, 0xc148, 0xc148, 0xc149, 0xc969, 0xb989, 0xa989, 0x50a4, 0x3883, 0x2062, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0820, 0xa188, 0xd169, 0xc949, 0xc149, 0xc149, 0xc169, 0xb928, 0xa907, 0xb128, 
-  0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc169, 0xc169, 0xc969, 0xc969, 0xc169, 
-  0xc149, 0xb989, 0x3082, 0x1000, 0xa989, 0xc169, 0xc149, 0xc149, 0xc949, 0xb169, 0x2862, 0x0000, 
-  0x0000, 0x1021, 0x8927, 0xc969, 0xc949, 0xc969, 0xc969, 0xc149, 0xc149, 0xc169, 0xc969, 0xc969, 
-  0xc969, 0xc169, 0xc149, 0xc149, 0xc149, 0xc149, 0xc148, 0xc969, 0x58c4, 0x0000, 0x0020, 0x0000, 
-  0x0800, 0x9968, 0xc969, 0xc149, 0xc169, 0xc149, 0xc949, 0xa989, 0x1841, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x6468, 0x7dc7, 0x7587, 0x7587, 0x7566, 0x85c9, 0x3a65, 0x0000, 0x0000, 0x0881, 
-  0x6ce9, 0x7587, 0x7567, 0x7587, 0x7566, 0x7d88, 0x2163, 0x0000, 0x0020, 0x0000, 0x0040, 0x6ce9, 
-  0x75a7, 0x7566, 0x7566, 0x7587, 0x7587, 0x7587, 0x7587, 0x7587, 0x7587, 0x7d4a, 0x10c2, 0x2183, 
-  0x74e9, 0x7d89, 0x7d89, 0x7da8, 0x7587, 0x7547, 0x7546, 0x7567, 0x7567, 0x7587, 0x7587, 0x7d87, 
-  0x7dc7, 0x6d68, 0x2c06, 0x1326, 0x1265, 0x0040, 0x0000, 0x0000, 0x0020, 0x0000, 0x0040, 0x6cc9, 
-  0x7da7, 0x7567, 0x7567, 0x7566, 0x7da7, 0x6ca9, 0x0020, 0x0040, 0x09c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x0a87, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x12a7, 0x1287, 0x2349, 0x1ac8, 0x0000, 0x3882, 0xc18a, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xc949, 0xc169, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc98a, 
-  0x58e4, 0x0000, 0x0020, 0x0000, 0x3062, 0xb989, 0xc169, 0xc149, 0xc169, 0xc149, 0xc949, 0xc149, 
-  0xc129, 0xc128, 0xc98a, 0x7926, 0x0000, 0x40a3, 0xa989, 0xc189, 0xc189, 0xc169, 0xc149, 0xc149, 
-  0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc169, 0xb949, 0x98a6, 0x7824, 0x98e7, 0xc169, 0xc969, 
-  0xc149, 0xc149, 0xc149, 0xc169, 0xc949, 0xc949, 0xc949, 0xc169, 0xb989, 0xa948, 0x60c4, 0x1020, 
-  0x0000, 0x0000, 0x0820, 0xa188, 0xd149, 0xc949, 0xc969, 0xc149, 0xc169, 0x88a5, 0x6823, 0x7044, 
-  0xb128, 0xc169, 0xc149, 0xc149, 0xc149, 0xc149, 0xc169, 0xc149, 0xc149, 0xc149, 0xc169, 0xc169, 
-  0xc149, 0xb989, 0x3082, 0x1000, 0xa989, 0xc969, 0xc169, 0xc149, 0xc949, 0xb169, 0x2861, 0x0000, 
-  0x0000, 0x38a3, 0xc1aa, 0xc928, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc169, 0xc169, 0xc169, 
-  0xc169, 0xc149, 0xc169, 0xc149, 0xc149, 0xc969, 0xc149, 0xc969, 0x58c4, 0x0000, 0x0020, 0x0000, 
-  0x0800, 0x9968, 0xc969, 0xc149, 0xc169, 0xc149, 0xc949, 0xa989, 0x1841, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x6468, 0x7dc7, 0x7586, 0x7587, 0x7566, 0x85c9, 0x3a65, 0x0000, 0x0000, 0x0881, 
-  0x7509, 0x7586, 0x7567, 0x7587, 0x7566, 0x7d88, 0x2163, 0x0000, 0x0020, 0x0000, 0x0040, 0x6ce9, 
-  0x75a7, 0x7566, 0x7566, 0x7567, 0x7587, 0x7587, 0x7567, 0x7567, 0x7567, 0x856a, 0x1903, 0x6c89, 
-  0x7da7, 0x7586, 0x7586, 0x7da7, 0x7d87, 0x7567, 0x6d47, 0x7547, 0x7547, 0x7567, 0x7da8, 0x6d48, 
-  0x5d09, 0x23e7, 0x13a7, 0x1ae6, 0x0101, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x6cc9, 
-  0x7da7, 0x7587, 0x7567, 0x7567, 0x7da7, 0x6cc9, 0x0020, 0x0040, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01c6, 0x0a06, 0x0a66, 0x0a46, 0x01c6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x09e7, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x0a46, 0x09e6, 0x0000, 0x3082, 0xc189, 0xc949, 0xc949, 0xc949, 0xc949, 0xc949, 
-  0xc969, 0xc949, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc9aa, 
-  0x5905, 0x0000, 0x0020, 0x0000, 0x3062, 0xb989, 0xc169, 0xc169, 0xc169, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xc149, 0xc169, 0x68e5, 0x0000, 0x8967, 0xc969, 0xc128, 0xc148, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xc149, 0xc149, 0xc149, 0xb949, 0xa8e7, 0x98c6, 0x7844, 0x7885, 0x8065, 0x98e7, 0xa0e7, 
-  0xb949, 0xc149, 0xc169, 0xc969, 0xc949, 0xc149, 0xc148, 0xc128, 0xc128, 0xc128, 0xb9aa, 0x3082, 
-  0x0000, 0x0000, 0x0820, 0xa188, 0xc969, 0xc949, 0xc969, 0xc949, 0xc169, 0x80c6, 0x6044, 0x6864, 
-  0xb148, 0xc169, 0xc169, 0xc169, 0xc149, 0xc149, 0xb948, 0xb948, 0xc169, 0xc149, 0xc169, 0xc169, 
-  0xc149, 0xb989, 0x3082, 0x1000, 0xa189, 0xc969, 0xc149, 0xc149, 0xc949, 0xb169, 0x2861, 0x0000, 
-  0x0000, 0x38a3, 0xc189, 0xc948, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc98a, 0x58e4, 0x0000, 0x0020, 0x0000, 
-  0x0800, 0x9968, 0xc969, 0xc149, 0xc169, 0xc949, 0xc949, 0xa989, 0x1841, 0x0000, 0x0000, 0x0000, 
-  0x0020, 0x0020, 0x5c48, 0x7dc7, 0x7587, 0x7587, 0x7586, 0x85e9, 0x3245, 0x0000, 0x0000, 0x1101, 
-  0x7549, 0x7587, 0x7566, 0x7566, 0x7586, 0x7d88, 0x2163, 0x0000, 0x0020, 0x0000, 0x0040, 0x6ce9, 
-  0x7da7, 0x7566, 0x7566, 0x7586, 0x7587, 0x75a7, 0x7dc8, 0x75a8, 0x7588, 0x6cca, 0x10e2, 0x5c47, 
-  0x7567, 0x7567, 0x7567, 0x7567, 0x7587, 0x7567, 0x7546, 0x7567, 0x7568, 0x6508, 0x54a8, 0x33e7, 
-  0x0b26, 0x1ba8, 0x1b07, 0x00e1, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x6ca9, 
-  0x7da7, 0x7567, 0x7567, 0x7567, 0x7da7, 0x74c9, 0x0040, 0x0040, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x0206, 0x12e7, 0x1b88, 0x1b68, 0x0a66, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 
-  0x01c5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01c5, 0x01a5, 0x01e6, 0x01a5, 0x0000, 0x3082, 0xc189, 0xc148, 0xc969, 0xc949, 0xc969, 0xc969, 
-  0xc949, 0xc949, 0xc949, 0xc969, 0xc969, 0xc169, 0xc169, 0xc169, 0xc169, 0xc969, 0xc969, 0xc189, 
-  0x48c3, 0x0000, 0x0020, 0x0000, 0x3062, 0xb989, 0xc169, 0xc169, 0xc169, 0xc149, 0xc149, 0xb108, 
-  0x98a6, 0x90c6, 0x88a6, 0x4842, 0x0000, 0x8146, 0xc969, 0xc148, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xc149, 0xc969, 0xb948, 0x98a6, 0x7824, 0x7065, 0x5884, 0x4042, 0x6884, 0x8065, 0x7024, 
-  0x98c6, 0xc169, 0xc969, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc128, 0xb169, 0x3082, 
-  0x0000, 0x0000, 0x0820, 0x9988, 0xc969, 0xc969, 0xc969, 0xc949, 0xc189, 0x70e5, 0x4863, 0x5884, 
-  0xb169, 0xc969, 0xc969, 0xc149, 0xc149, 0xc149, 0x8885, 0x7844, 0xb148, 0xc169, 0xc169, 0xc169, 
-  0xc949, 0xb989, 0x3082, 0x1000, 0xa989, 0xc169, 0xc169, 0xc149, 0xc949, 0xb169, 0x2861, 0x0000, 
-  0x0000, 0x38a3, 0xc1a9, 0xc948, 0xc149, 0xc149, 0xc149, 0xc149, 0xc949, 0xc169, 0xc169, 0xc169, 
-  0xc169, 0xc169, 0xc969, 0xc969, 0xc969, 0xc169, 0xc969, 0xb969, 0x5083, 0x0000, 0x0000, 0x0000, 
-  0x0800, 0x9968, 0xc969, 0xc169, 0xc169, 0xc949, 0xc949, 0xa989, 0x1841, 0x0000, 0x0000, 0x0020, 
-  0x0020, 0x0000, 0x6468, 0x75c7, 0x7566, 0x7587, 0x7587, 0x85c8, 0x4325, 0x0060, 0x0000, 0x2a63, 
-  0x7da8, 0x7586, 0x7586, 0x7566, 0x7566, 0x7da9, 0x1963, 0x0000, 0x0020, 0x0000, 0x0040, 0x6ce9, 
-  0x7da7, 0x7567, 0x7566, 0x7566, 0x7587, 0x6527, 0x3c26, 0x3c47, 0x33e6, 0x1b06, 0x08c1, 0x3b66, 
-  0x6d48, 0x7587, 0x7da8, 0x7da8, 0x7dc8, 0x7dc8, 0x7588, 0x3c47, 0x3c27, 0x2386, 0x02a5, 0x0b06, 
-  0x1347, 0x1285, 0x0101, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x6ca9, 
-  0x7d87, 0x7566, 0x7566, 0x7566, 0x7da8, 0x5407, 0x0020, 0x0041, 0x01c6, 0x01e6, 0x09e6, 0x01e6, 
-  0x0ae6, 0x1ba7, 0x1b87, 0x1b87, 0x1b87, 0x12e7, 0x12e7, 0x12e7, 0x12e8, 0x12e8, 0x12e8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1a46, 0x0000, 0x3882, 0xc189, 0xc149, 0xc969, 0xc949, 0xc949, 0xc969, 
-  0xc148, 0x98a6, 0x9086, 0x9086, 0x9086, 0x9086, 0x9086, 0x90a6, 0x90a6, 0x90a6, 0x98a6, 0x88a6, 
-  0x3042, 0x0000, 0x0000, 0x0000, 0x3062, 0xb989, 0xc169, 0xc169, 0xc169, 0xc149, 0xc169, 0xa0e7, 
-  0x7024, 0x7044, 0x7085, 0x4083, 0x0000, 0x60a4, 0xb949, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xb928, 0xa0a6, 0x8865, 0x7844, 0x7085, 0x48a4, 0x1020, 0x0000, 0x2841, 0x6884, 0x7865, 
-  0x7844, 0x9086, 0xa8e7, 0xc149, 0xc148, 0xc128, 0xc149, 0xc149, 0xc128, 0xc149, 0x9948, 0x2021, 
-  0x0000, 0x0000, 0x0820, 0x9988, 0xc969, 0xc949, 0xc149, 0xc149, 0xc189, 0x48c3, 0x0000, 0x2041, 
-  0xb169, 0xc969, 0xc169, 0xc149, 0xc149, 0xc169, 0x8065, 0x7024, 0xb148, 0xc969, 0xc169, 0xc169, 
-  0xc149, 0xb989, 0x3082, 0x1000, 0xa989, 0xc169, 0xc169, 0xc169, 0xc949, 0xb169, 0x2861, 0x0000, 
-  0x0000, 0x38a3, 0xc189, 0xc929, 0xc149, 0xc149, 0xc149, 0xc949, 0xb928, 0x9086, 0x8885, 0x8886, 
-  0x90a6, 0x90a6, 0x98a6, 0x98a6, 0x90a6, 0x90a5, 0x90a6, 0x90a5, 0x4042, 0x0000, 0x0020, 0x0000, 
-  0x0800, 0x9968, 0xc969, 0xc169, 0xc969, 0xc969, 0xc949, 0xb189, 0x1841, 0x0000, 0x0000, 0x0020, 
-  0x0020, 0x0000, 0x21c4, 0x64e7, 0x7587, 0x7587, 0x7d87, 0x7d88, 0x6486, 0x1962, 0x0000, 0x3b04, 
-  0x7da8, 0x7586, 0x7587, 0x7566, 0x7587, 0x5c26, 0x08c1, 0x0000, 0x0020, 0x0000, 0x0040, 0x6ce9, 
-  0x7da7, 0x7567, 0x7566, 0x7546, 0x7587, 0x54a8, 0x0ae5, 0x0b06, 0x0ae6, 0x1b07, 0x0902, 0x1284, 
-  0x2ba6, 0x2be6, 0x2c06, 0x3426, 0x3446, 0x3447, 0x2c07, 0x0b46, 0x0ae6, 0x0ac6, 0x12e7, 0x09a4, 
-  0x08e2, 0x0060, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5408, 
-  0x7588, 0x6d48, 0x6d48, 0x7588, 0x4ca7, 0x2305, 0x0040, 0x0041, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x1307, 0x1ba8, 0x1ba8, 0x1ba8, 0x1b47, 0x0a86, 0x1266, 0x0a86, 0x1287, 0x12a7, 0x1287, 0x1287, 
-  0x0a67, 0x0a46, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a46, 0x0a46, 0x0a66, 0x0a66, 
-  0x0a66, 0x0a66, 0x0a46, 0x09a5, 0x0000, 0x3882, 0xc189, 0xc949, 0xc949, 0xc949, 0xc149, 0xc149, 
-  0xb948, 0x7824, 0x7024, 0x7024, 0x7024, 0x7824, 0x7824, 0x7824, 0x7824, 0x7824, 0x7044, 0x7085, 
-  0x2862, 0x0000, 0x0000, 0x0000, 0x3062, 0xb989, 0xc169, 0xc169, 0xc169, 0xc169, 0xc169, 0x9927, 
-  0x5864, 0x68a5, 0x50a4, 0x1821, 0x0020, 0x5063, 0x8885, 0xb948, 0xc149, 0xc149, 0xc149, 0xc169, 
-  0xa8c7, 0x8845, 0x7024, 0x7044, 0x70a5, 0x4883, 0x1020, 0x0000, 0x0020, 0x0000, 0x2021, 0x6084, 
-  0x8065, 0x7824, 0x8045, 0x8865, 0xa8e7, 0xc149, 0xc148, 0xc149, 0xc149, 0xb128, 0x7084, 0x1820, 
-  0x0000, 0x0000, 0x0820, 0xa188, 0xc969, 0xc949, 0xc149, 0xc148, 0xc1a9, 0x40c3, 0x0000, 0x1841, 
-  0xa968, 0xc949, 0xc169, 0xc149, 0xc149, 0xc189, 0x70a5, 0x6043, 0xb168, 0xc169, 0xc169, 0xc169, 
-  0xc149, 0xb989, 0x3082, 0x1000, 0xa988, 0xc969, 0xc169, 0xc149, 0xc949, 0xb169, 0x2861, 0x0000, 
-  0x0000, 0x3883, 0xc1aa, 0xc928, 0xc149, 0xc149, 0xc149, 0xc949, 0xb928, 0x7024, 0x6824, 0x6824, 
-  0x7024, 0x7024, 0x7044, 0x7044, 0x7044, 0x6844, 0x7024, 0x7865, 0x4062, 0x0000, 0x0020, 0x0000, 
-  0x0800, 0xa168, 0xc969, 0xc169, 0xc969, 0xc969, 0xc949, 0xa989, 0x1841, 0x0000, 0x0000, 0x0020, 
-  0x0020, 0x0000, 0x0020, 0x5c87, 0x75a7, 0x7567, 0x7d87, 0x7d87, 0x7da9, 0x2a24, 0x0000, 0x4b45, 
-  0x7da7, 0x7586, 0x75a7, 0x7586, 0x7de8, 0x2a64, 0x0000, 0x0020, 0x0000, 0x0000, 0x0040, 0x6ce9, 
-  0x75a7, 0x7567, 0x7587, 0x7566, 0x7587, 0x5ca8, 0x12e6, 0x1307, 0x1b48, 0x11e4, 0x00a1, 0x12c6, 
-  0x0b06, 0x0b06, 0x0ae6, 0x0306, 0x0b45, 0x0b45, 0x0b25, 0x1366, 0x1b46, 0x1265, 0x0902, 0x0060, 
-  0x0000, 0x0020, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x2283, 
-  0x2b64, 0x2324, 0x2344, 0x2385, 0x1b86, 0x1ae6, 0x0040, 0x0040, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x0a26, 0x1b27, 0x23c8, 0x1b68, 0x0a45, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0205, 0x0206, 0x0205, 
-  0x0205, 0x0205, 0x01e5, 0x0164, 0x0000, 0x3882, 0xc189, 0xc149, 0xc949, 0xc149, 0xc149, 0xc149, 
-  0xb149, 0x7085, 0x6865, 0x7065, 0x7065, 0x7865, 0x7865, 0x7885, 0x7885, 0x7885, 0x7085, 0x60a5, 
-  0x1841, 0x0000, 0x0020, 0x0000, 0x3062, 0xb989, 0xc169, 0xc169, 0xc149, 0xc149, 0xc98a, 0x7126, 
-  0x1020, 0x1841, 0x1020, 0x0020, 0x0020, 0x5083, 0x7865, 0x8065, 0x8065, 0x8065, 0x8865, 0x9085, 
-  0x8865, 0x7845, 0x6865, 0x50a4, 0x2842, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x1820, 
-  0x5083, 0x6885, 0x7865, 0x7845, 0x8065, 0x8865, 0x8865, 0x8045, 0x8065, 0x8065, 0x7085, 0x2041, 
-  0x0000, 0x0000, 0x0820, 0x9988, 0xc969, 0xc949, 0xc149, 0xc128, 0xc1aa, 0x48c4, 0x0000, 0x2041, 
-  0xa968, 0xc149, 0xc169, 0xc169, 0xc149, 0xc189, 0x3882, 0x1820, 0xa168, 0xc969, 0xc169, 0xc169, 
-  0xc949, 0xb989, 0x3082, 0x1000, 0xa989, 0xc169, 0xc169, 0xc149, 0xc149, 0xb169, 0x2861, 0x0000, 
-  0x0000, 0x3883, 0xc1aa, 0xc928, 0xc149, 0xc149, 0xc148, 0xc149, 0xb148, 0x7064, 0x7085, 0x7085, 
-  0x7085, 0x7085, 0x7085, 0x7065, 0x7065, 0x7065, 0x7065, 0x60a5, 0x2842, 0x0000, 0x0020, 0x0000, 
-  0x1000, 0xa148, 0xc969, 0xc169, 0xc969, 0xc969, 0xc949, 0xb189, 0x1841, 0x0000, 0x0000, 0x0000, 
-  0x0020, 0x0000, 0x0060, 0x64a7, 0x75a7, 0x7567, 0x7567, 0x7567, 0x85e9, 0x3264, 0x0000, 0x6468, 
-  0x7587, 0x7566, 0x7587, 0x7566, 0x7dc8, 0x3244, 0x0000, 0x0020, 0x0000, 0x0000, 0x0040, 0x6cc9, 
-  0x75a7, 0x7587, 0x7587, 0x7586, 0x7da7, 0x5c28, 0x0061, 0x00a1, 0x08e2, 0x0081, 0x0020, 0x08e1, 
-  0x1a66, 0x1aa6, 0x12c6, 0x12e6, 0x4468, 0x6548, 0x6528, 0x6528, 0x6d49, 0x64e8, 0x6468, 0x6488, 
-  0x6488, 0x6c88, 0x6488, 0x64a8, 0x6ca9, 0x6cc9, 0x6cc9, 0x6cc9, 0x6cc9, 0x6cc9, 0x64c8, 0x64c8, 
-  0x5ca7, 0x64c8, 0x4427, 0x1b46, 0x1b27, 0x1a86, 0x0020, 0x0020, 0x0185, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x0226, 0x0a46, 0x0226, 0x01e6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x09c7, 0x01c6, 0x09c6, 
-  0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 0x1b28, 0x1b08, 0x1b28, 
-  0x1b28, 0x1b28, 0x1b28, 0x1a87, 0x0000, 0x3882, 0xc189, 0xc149, 0xc949, 0xc149, 0xc149, 0xc149, 
-  0xa168, 0x3863, 0x3063, 0x4063, 0x4063, 0x4063, 0x4063, 0x4063, 0x4063, 0x4063, 0x4083, 0x2041, 
-  0x0000, 0x0000, 0x0020, 0x0000, 0x3062, 0xb969, 0xc149, 0xc169, 0xc149, 0xc949, 0xc98a, 0x6126, 
-  0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x3083, 0x6084, 0x6865, 0x7044, 0x7044, 0x7044, 0x7845, 
-  0x7065, 0x6085, 0x3042, 0x0820, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 
-  0x0820, 0x1821, 0x4863, 0x7085, 0x7865, 0x7845, 0x7044, 0x7044, 0x7045, 0x7065, 0x6084, 0x1821, 
-  0x0000, 0x0000, 0x0820, 0x9988, 0xc949, 0xc949, 0xc149, 0xc148, 0xc1aa, 0x50c4, 0x0000, 0x2041, 
-  0xa968, 0xc149, 0xc169, 0xc169, 0xc149, 0xc1aa, 0x2882, 0x0000, 0xa168, 0xc969, 0xc149, 0xc149, 
-  0xc949, 0xb989, 0x3082, 0x1000, 0xa989, 0xc169, 0xc169, 0xc149, 0xc149, 0xa969, 0x2861, 0x0000, 
-  0x0000, 0x38a3, 0xc1aa, 0xc948, 0xc149, 0xc149, 0xc149, 0xc949, 0xa148, 0x4062, 0x4063, 0x4863, 
-  0x4063, 0x4063, 0x4063, 0x4063, 0x4863, 0x4863, 0x4883, 0x2062, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x1000, 0xa148, 0xc969, 0xc149, 0xc169, 0xc969, 0xc949, 0xb189, 0x1841, 0x0000, 0x0000, 0x0000, 
-  0x0020, 0x0000, 0x0060, 0x64c8, 0x75a7, 0x7566, 0x7566, 0x7566, 0x85c9, 0x3264, 0x0000, 0x6ca8, 
-  0x75a7, 0x7566, 0x7587, 0x7566, 0x7dc8, 0x3224, 0x0000, 0x0020, 0x0000, 0x0000, 0x0040, 0x6cc9, 
-  0x75a7, 0x7567, 0x7587, 0x7566, 0x7dc7, 0x5c08, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 
-  0x0020, 0x0081, 0x1202, 0x3b86, 0x7588, 0x7567, 0x7da7, 0x7da7, 0x7da7, 0x7dc7, 0x7dc7, 0x75a7, 
-  0x7587, 0x75a7, 0x75a7, 0x75a7, 0x75a7, 0x7da7, 0x7da7, 0x7da8, 0x7dc7, 0x7dc7, 0x7dc7, 0x7da7, 
-  0x7da7, 0x7587, 0x7588, 0x652a, 0x22c5, 0x0060, 0x0000, 0x0040, 0x09c6, 0x0a06, 0x0a27, 0x0a47, 
-  0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a27, 0x0a27, 0x0a27, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0206, 
-  0x01e6, 0x01e6, 0x0206, 0x09c5, 0x0020, 0x3882, 0xc189, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0x9147, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3062, 0xb989, 0xc149, 0xc149, 0xc149, 0xc149, 0xc98a, 0x6926, 
-  0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x1020, 0x4884, 0x5864, 0x5064, 0x5063, 0x5084, 
-  0x3862, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0800, 0x1020, 0x4063, 0x5884, 0x5864, 0x5864, 0x6064, 0x4883, 0x0800, 0x0000, 
-  0x0000, 0x0000, 0x0820, 0xa188, 0xc949, 0xc149, 0xc949, 0xc149, 0xc1aa, 0x50c4, 0x0000, 0x2041, 
-  0xb168, 0xc149, 0xc149, 0xc149, 0xc149, 0xc1aa, 0x3082, 0x0800, 0xa168, 0xc969, 0xc149, 0xc149, 
-  0xc149, 0xb989, 0x3082, 0x1000, 0xa989, 0xc969, 0xc169, 0xc149, 0xc149, 0xa969, 0x2861, 0x0000, 
-  0x0000, 0x38a3, 0xc1aa, 0xc949, 0xc149, 0xc149, 0xc149, 0xc949, 0x9948, 0x0800, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x1000, 0xa148, 0xc969, 0xc149, 0xc169, 0xc169, 0xd149, 0xb189, 0x1841, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0060, 0x64c8, 0x75a7, 0x6d66, 0x7567, 0x7566, 0x7dc9, 0x3264, 0x0000, 0x6cc9, 
-  0x7dc7, 0x7566, 0x7567, 0x6d46, 0x7dc8, 0x3224, 0x0000, 0x0020, 0x0000, 0x0000, 0x0040, 0x6cc9, 
-  0x75a7, 0x7567, 0x7567, 0x7567, 0x7dc7, 0x6448, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-  0x0000, 0x08a1, 0x5427, 0x6d48, 0x7567, 0x7547, 0x7567, 0x7567, 0x7587, 0x7587, 0x7567, 0x7567, 
-  0x6d46, 0x6d46, 0x6d46, 0x6d46, 0x6d46, 0x6d46, 0x7546, 0x7567, 0x7567, 0x7567, 0x7587, 0x7587, 
-  0x7587, 0x7567, 0x7567, 0x7da8, 0x64e8, 0x1122, 0x0000, 0x08a1, 0x1a87, 0x12e8, 0x1ae8, 0x1b08, 
-  0x1b29, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x09c6, 0x0020, 0x4082, 0xc989, 0xc949, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0x9148, 0x0800, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3062, 0xb969, 0xc149, 0xc169, 0xc149, 0xc149, 0xc98a, 0x6926, 
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0820, 0x0800, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0820, 0x9988, 0xc949, 0xc149, 0xc149, 0xc929, 0xc98a, 0x50c4, 0x0000, 0x2041, 
-  0xb168, 0xc949, 0xc169, 0xc149, 0xc149, 0xc1aa, 0x3082, 0x0800, 0xa168, 0xc949, 0xc149, 0xc949, 
-  0xc949, 0xb989, 0x3082, 0x1000, 0xa968, 0xc969, 0xc149, 0xc149, 0xc949, 0xb169, 0x2861, 0x0000, 
-  0x0000, 0x38a3, 0xc1aa, 0xc949, 0xc149, 0xc149, 0xc149, 0xc949, 0x9948, 0x0800, 0x0020, 0x0020, 
-  0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x1000, 0xa148, 0xc969, 0xc149, 0xc169, 0xc149, 0xc949, 0xb189, 0x1841, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0060, 0x64c8, 0x7587, 0x7566, 0x7567, 0x7566, 0x7dc8, 0x2a44, 0x0000, 0x6ce9, 
-  0x7dc7, 0x7566, 0x7567, 0x6d46, 0x7da8, 0x3224, 0x0000, 0x0020, 0x0000, 0x0000, 0x0040, 0x6cc9, 
-  0x75a7, 0x7567, 0x7567, 0x7567, 0x7dc7, 0x6448, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 
-  0x0841, 0x4326, 0x7da8, 0x7566, 0x7567, 0x7547, 0x7567, 0x7567, 0x7d87, 0x7dc8, 0x7dc8, 0x7da8, 
-  0x75a7, 0x7587, 0x7587, 0x7587, 0x7587, 0x7587, 0x7587, 0x7587, 0x7da7, 0x7da7, 0x7587, 0x7587, 
-  0x7587, 0x7587, 0x7587, 0x7587, 0x7dc8, 0x5c28, 0x10a1, 0x0000, 0x0164, 0x01a5, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x0206, 0x01c6, 0x0020, 0x3862, 0xc189, 0xc149, 0xc149, 0xc149, 0xc149, 0xc949, 
-  0x9147, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3062, 0xb969, 0xc149, 0xc169, 0xc169, 0xc149, 0xc98a, 0x6926, 
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 
-  0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0820, 0xa188, 0xc949, 0xc149, 0xc949, 0xc929, 0xc98a, 0x48c4, 0x0000, 0x1820, 
-  0xb168, 0xc949, 0xc169, 0xc169, 0xc149, 0xc1aa, 0x3082, 0x0800, 0xa168, 0xc949, 0xc149, 0xc149, 
-  0xc949, 0xb989, 0x3082, 0x1000, 0xa968, 0xc969, 0xc149, 0xc949, 0xc949, 0xb169, 0x2861, 0x0000, 
-  0x0000, 0x3883, 0xc1aa, 0xc929, 0xc149, 0xc149, 0xc149, 0xc949, 0xa168, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0800, 0xa148, 0xc969, 0xc149, 0xc149, 0xc149, 0xc949, 0xb189, 0x1841, 0x0000, 0x0000, 0x0000, 
-  0x0020, 0x0000, 0x0060, 0x64e8, 0x7587, 0x7566, 0x7566, 0x7566, 0x7da8, 0x2a24, 0x0000, 0x6cc9, 
-  0x7dc7, 0x7567, 0x7567, 0x6d46, 0x7da8, 0x3224, 0x0000, 0x0020, 0x0020, 0x0000, 0x0040, 0x6cc9, 
-  0x75a7, 0x7567, 0x7566, 0x7566, 0x7dc7, 0x6448, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 
-  0x10e2, 0x7daa, 0x7586, 0x7567, 0x7567, 0x7567, 0x7546, 0x7567, 0x6d69, 0x4466, 0x4487, 0x4467, 
-  0x3c47, 0x3c47, 0x3c27, 0x3c27, 0x3c26, 0x3c27, 0x3c27, 0x3c27, 0x3c46, 0x4446, 0x6d48, 0x7587, 
-  0x7567, 0x7587, 0x7587, 0x7587, 0x7566, 0x85e9, 0x2183, 0x0000, 0x09a5, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x01c6, 0x09e6, 0x09e7, 0x09e6, 0x09c6, 0x09c6, 0x09e6, 
-  0x12c8, 0x12e8, 0x12c8, 0x12c8, 0x12e8, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 
-  0x12c7, 0x12c7, 0x1348, 0x1266, 0x0020, 0x3862, 0xc189, 0xc148, 0xc149, 0xc149, 0xc149, 0xc949, 
-  0xa948, 0x3862, 0x3062, 0x3882, 0x38a3, 0x38a3, 0x3883, 0x38a3, 0x38a3, 0x38a3, 0x3883, 0x50c4, 
-  0x60e5, 0x5905, 0x2041, 0x0000, 0x3062, 0xb989, 0xc149, 0xc169, 0xc169, 0xc149, 0xc98a, 0x6926, 
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0800, 0xa168, 0xd149, 0xc929, 0xc929, 0xc129, 0xc98a, 0x60c4, 0x1841, 0x3862, 
-  0xb168, 0xc969, 0xc169, 0xc169, 0xc149, 0xc1aa, 0x3082, 0x0800, 0xa168, 0xc949, 0xc149, 0xc149, 
-  0xc949, 0xc189, 0x3082, 0x1000, 0xa968, 0xc969, 0xc169, 0xc149, 0xc949, 0xb169, 0x2861, 0x0000, 
-  0x0000, 0x3883, 0xc18a, 0xc929, 0xc149, 0xc149, 0xc149, 0xc949, 0xa948, 0x3862, 0x3082, 0x3082, 
-  0x3082, 0x3083, 0x3083, 0x3083, 0x3883, 0x3883, 0x48c4, 0x50e4, 0x50e4, 0x50e5, 0x1841, 0x0000, 
-  0x1000, 0xa148, 0xc969, 0xc149, 0xc149, 0xc169, 0xc949, 0xb189, 0x1841, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0040, 0x64c8, 0x7587, 0x7567, 0x7567, 0x7566, 0x7da8, 0x21c3, 0x0000, 0x6cc9, 
-  0x7da7, 0x7587, 0x7587, 0x6d46, 0x7da8, 0x2a04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x6cc9, 
-  0x75a7, 0x7567, 0x7587, 0x7567, 0x7dc7, 0x6448, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x10c2, 0x7549, 0x7567, 0x7567, 0x7567, 0x7567, 0x7547, 0x6d27, 0x33e7, 0x0306, 0x0b27, 0x0327, 
-  0x0327, 0x0306, 0x0306, 0x0306, 0x0306, 0x0307, 0x0306, 0x02e6, 0x02e6, 0x0306, 0x3407, 0x7547, 
-  0x7567, 0x7567, 0x7567, 0x7587, 0x7566, 0x7d88, 0x2163, 0x0000, 0x09c6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 
-  0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x1287, 0x0a86, 0x0a86, 0x0aa6, 0x0a86, 0x0a86, 0x0a86, 
-  0x0aa7, 0x0aa6, 0x1348, 0x1b07, 0x0020, 0x3862, 0xc189, 0xc149, 0xc149, 0xc949, 0xc949, 0xc949, 
-  0xc949, 0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xc169, 0xc969, 
-  0xd16a, 0xc98a, 0x8948, 0x1021, 0x3041, 0xb989, 0xc149, 0xc149, 0xc169, 0xc149, 0xc98a, 0x6926, 
-  0x0000, 0x0020, 0x0000, 0x0000, 0x1820, 0x6105, 0x8147, 0x7926, 0x7926, 0x7926, 0x7946, 0x7946, 
-  0x7926, 0x7126, 0x7126, 0x7926, 0x7926, 0x7926, 0x7926, 0x7926, 0x7926, 0x7926, 0x7926, 0x7926, 
-  0x7926, 0x7926, 0x7926, 0x7926, 0x7926, 0x7926, 0x7926, 0x7926, 0x7926, 0x7926, 0x8147, 0x4083, 
-  0x0000, 0x0000, 0x1020, 0xa168, 0xd149, 0xc949, 0xc149, 0xc149, 0xc149, 0xb969, 0xb989, 0xb169, 
-  0xc149, 0xc149, 0xc149, 0xc169, 0xc149, 0xc1aa, 0x3082, 0x0800, 0xa148, 0xc949, 0xc949, 0xc149, 
-  0xc949, 0xb989, 0x3082, 0x1000, 0xa988, 0xc169, 0xc169, 0xc149, 0xc949, 0xb169, 0x2841, 0x0000, 
-  0x0000, 0x3883, 0xc1aa, 0xc949, 0xc149, 0xc949, 0xc949, 0xc949, 0xc949, 0xc189, 0xc189, 0xc189, 
-  0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xc189, 0xc969, 0xc969, 0xc98a, 0x9148, 0x1041, 
-  0x0800, 0xa148, 0xc949, 0xc149, 0xc969, 0xc969, 0xc949, 0xb189, 0x1841, 0x0000, 0x0000, 0x29c4, 
-  0x5c08, 0x53c7, 0x5c07, 0x6d27, 0x7567, 0x7567, 0x7567, 0x7567, 0x7567, 0x5c27, 0x4b86, 0x6d07, 
-  0x7567, 0x7587, 0x7587, 0x7567, 0x7588, 0x6488, 0x5bc8, 0x5c08, 0x5368, 0x0020, 0x0020, 0x6ca8, 
-  0x7da7, 0x7567, 0x7587, 0x7567, 0x7dc7, 0x6428, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x10c2, 0x7529, 0x7567, 0x7567, 0x7567, 0x7567, 0x7567, 0x6507, 0x1305, 0x1307, 0x1327, 0x1347, 
-  0x1327, 0x1327, 0x1327, 0x1327, 0x1327, 0x1327, 0x1307, 0x1307, 0x1307, 0x0ae7, 0x1326, 0x6527, 
-  0x7567, 0x7566, 0x7566, 0x7587, 0x7566, 0x7dc9, 0x2183, 0x0000, 0x0a06, 0x0226, 0x01e6, 0x01c5, 
-  0x01c5, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 
-  0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01a5, 0x01c6, 0x01c5, 0x01c6, 0x01c6, 0x01c5, 0x01a6, 
-  0x01c5, 0x01c5, 0x0246, 0x1246, 0x0020, 0x3062, 0xc189, 0xc149, 0xc149, 0xc149, 0xc149, 0xc949, 
-  0xc949, 0xc949, 0xc949, 0xc949, 0xc949, 0xc949, 0xc929, 0xc929, 0xc929, 0xc929, 0xc928, 0xc128, 
-  0xc928, 0xc928, 0xb18a, 0x2041, 0x3041, 0xb989, 0xc149, 0xc169, 0xc169, 0xc149, 0xc98a, 0x6926, 
-  0x0000, 0x0020, 0x0000, 0x0000, 0x7126, 0xc18a, 0xc969, 0xc969, 0xc969, 0xc969, 0xc969, 0xc969, 
-  0xc969, 0xc969, 0xc969, 0xc969, 0xc969, 0xc969, 0xc969, 0xc969, 0xd169, 0xd169, 0xc949, 0xc949, 
-  0xc969, 0xc969, 0xc969, 0xc949, 0xc969, 0xc969, 0xc969, 0xc949, 0xc969, 0xc949, 0xd169, 0xa948, 
-  0x2862, 0x0000, 0x1000, 0xa168, 0xd149, 0xc149, 0xc149, 0xc148, 0xc148, 0xc149, 0xc949, 0xc949, 
-  0xc149, 0xc149, 0xc149, 0xc149, 0xc949, 0xc189, 0x2862, 0x0000, 0xa168, 0xc949, 0xc149, 0xc149, 
-  0xc149, 0xb989, 0x3082, 0x1000, 0xa988, 0xc969, 0xc169, 0xc149, 0xc949, 0xb169, 0x2842, 0x0000, 
-  0x0000, 0x3883, 0xc18a, 0xc129, 0xc149, 0xc969, 0xc949, 0xc949, 0xc949, 0xc929, 0xc929, 0xc949, 
-  0xc929, 0xc928, 0xc928, 0xc928, 0xc928, 0xc928, 0xc128, 0xc128, 0xc128, 0xc128, 0xb18a, 0x2862, 
-  0x0800, 0x9948, 0xc969, 0xc949, 0xc969, 0xc969, 0xc949, 0xa989, 0x1841, 0x0000, 0x2163, 0x7529, 
-  0x7da8, 0x7da7, 0x7dc8, 0x7587, 0x7567, 0x7567, 0x7567, 0x7567, 0x7567, 0x7587, 0x7587, 0x7566, 
-  0x7567, 0x7567, 0x7587, 0x7587, 0x7567, 0x7da7, 0x7dc8, 0x7da7, 0x7da9, 0x42e6, 0x0000, 0x6ca8, 
-  0x75a7, 0x7587, 0x7587, 0x7566, 0x7dc7, 0x6428, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x10c2, 0x7529, 0x7566, 0x7567, 0x7567, 0x7567, 0x7566, 0x7568, 0x4bc7, 0x08c1, 0x08e2, 0x0902, 
-  0x0902, 0x0902, 0x0902, 0x0902, 0x0902, 0x0902, 0x0902, 0x0902, 0x0902, 0x00a1, 0x43c7, 0x7588, 
-  0x7567, 0x6d66, 0x6d66, 0x7566, 0x7566, 0x85c9, 0x21a3, 0x0060, 0x1b48, 0x1b48, 0x12e8, 0x12e8, 
-  0x12c8, 0x12e8, 0x12e8, 0x12e8, 0x1b08, 0x1b08, 0x12e8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x09e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01e6, 0x09e5, 0x0000, 0x3062, 0xc189, 0xc128, 0xc149, 0xc149, 0xc149, 0xc949, 
-  0xc949, 0xc949, 0xc149, 0xc149, 0xc149, 0xc149, 0xc949, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xc929, 0xb189, 0x1841, 0x3041, 0xb989, 0xc149, 0xc169, 0xc149, 0xc149, 0xc98a, 0x6926, 
-  0x0000, 0x0000, 0x0000, 0x0800, 0x9968, 0xc969, 0xc129, 0xc128, 0xc148, 0xc128, 0xc128, 0xc148, 
-  0xc148, 0xc128, 0xc128, 0xc128, 0xc128, 0xc148, 0xc148, 0xc948, 0xc949, 0xc948, 0xc928, 0xc128, 
-  0xc128, 0xc148, 0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc128, 0xc169, 
-  0x5083, 0x0000, 0x0820, 0xa188, 0xc949, 0xc149, 0xc149, 0xc148, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xc149, 0xc149, 0xc149, 0xc949, 0xc18a, 0x3062, 0x0800, 0xa168, 0xc949, 0xc949, 0xc949, 
-  0xc149, 0xb989, 0x3082, 0x1000, 0xa989, 0xc969, 0xc169, 0xc149, 0xc949, 0xb169, 0x2841, 0x0000, 
-  0x0000, 0x3883, 0xc1aa, 0xc149, 0xc149, 0xc949, 0xc149, 0xc949, 0xc949, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xc149, 0xc149, 0xc149, 0xc949, 0xc949, 0xc149, 0xc129, 0xc148, 0xc128, 0xb18a, 0x2862, 
-  0x0800, 0xa148, 0xc969, 0xc949, 0xc969, 0xc149, 0xc949, 0xa989, 0x1841, 0x0000, 0x29e4, 0x85c9, 
-  0x7567, 0x7566, 0x7566, 0x7567, 0x7566, 0x7566, 0x7567, 0x7567, 0x7567, 0x7567, 0x7546, 0x7566, 
-  0x7567, 0x7567, 0x7587, 0x7587, 0x7587, 0x7586, 0x7566, 0x6d46, 0x7587, 0x53a7, 0x0000, 0x6cc8, 
-  0x75c7, 0x7587, 0x7587, 0x7566, 0x7da7, 0x6428, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x10a1, 0x6d09, 0x7567, 0x7567, 0x7567, 0x7567, 0x7567, 0x7567, 0x7528, 0x6c88, 0x6ca8, 0x6ca8, 
-  0x6ca8, 0x6ca8, 0x6ca8, 0x74a8, 0x6ca8, 0x6ca8, 0x6ca8, 0x6ca8, 0x6ca8, 0x6c88, 0x7528, 0x7567, 
-  0x7567, 0x6d66, 0x6d66, 0x7566, 0x7587, 0x7d89, 0x1983, 0x0080, 0x12c6, 0x0a87, 0x0a46, 0x0a26, 
-  0x0a26, 0x0a27, 0x0a27, 0x0a27, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a67, 0x0a67, 0x0a47, 0x0a67, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01a6, 0x1287, 0x11e5, 0x0000, 0x2862, 0xa948, 0xb908, 0xc129, 0xc949, 0xc949, 0xc949, 
-  0xc949, 0xc949, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xc149, 0xc128, 0xa148, 0x1841, 0x3042, 0xb989, 0xc169, 0xc169, 0xc149, 0xc149, 0xc98a, 0x6926, 
-  0x0000, 0x0000, 0x0000, 0x0800, 0x9147, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc148, 
-  0xc149, 0xc149, 0xc148, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xc148, 0xc148, 0xc148, 0xc148, 0xc148, 0xc149, 0xc149, 0xc149, 0xc149, 0xc148, 0xc128, 0xc169, 
-  0x4883, 0x0000, 0x0000, 0x8106, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc949, 0xc969, 
-  0xc949, 0xc949, 0xc149, 0xc949, 0xc929, 0xc18a, 0x3062, 0x0800, 0x9968, 0xc949, 0xc949, 0xc149, 
-  0xc949, 0xb989, 0x3082, 0x1000, 0xa969, 0xc969, 0xc149, 0xc149, 0xc949, 0xb169, 0x2841, 0x0000, 
-  0x0000, 0x3062, 0xb148, 0xc949, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 0xc149, 
-  0xc949, 0xc149, 0xc149, 0xc929, 0xc129, 0xc129, 0xc129, 0xc949, 0xc149, 0xc148, 0xa969, 0x2862, 
-  0x0800, 0xa148, 0xc969, 0xc149, 0xc949, 0xc949, 0xc949, 0xa969, 0x1841, 0x0000, 0x29e4, 0x7dca, 
-  0x7547, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 
-  0x7566, 0x7566, 0x7566, 0x7567, 0x7566, 0x7566, 0x7566, 0x7546, 0x7568, 0x4b47, 0x0020, 0x6cc9, 
-  0x7da7, 0x7587, 0x7587, 0x6d66, 0x7da7, 0x6428, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0060, 0x43e6, 0x7587, 0x7566, 0x7567, 0x7567, 0x7567, 0x7567, 0x7567, 0x7da7, 0x75a7, 0x7da7, 
-  0x7da7, 0x7da7, 0x7da7, 0x7da7, 0x7da7, 0x7da7, 0x7da7, 0x7da7, 0x7dc7, 0x7da7, 0x7587, 0x7567, 
-  0x7566, 0x7566, 0x7566, 0x7546, 0x7da8, 0x5487, 0x0901, 0x0041, 0x01e6, 0x01e6, 0x01a6, 0x01a6, 
-  0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a47, 0x0a67, 0x0a66, 0x0a67, 0x0a67, 0x0a67, 
-  0x0a67, 0x0a46, 0x2329, 0x19e6, 0x0000, 0x1821, 0x7064, 0x90a6, 0xc149, 0xc128, 0xc149, 0xc129, 
-  0xc128, 0xc128, 0xc128, 0xb948, 0xb928, 0xb928, 0xb928, 0xb948, 0xb928, 0xc128, 0xc149, 0xb928, 
-  0xb108, 0x9065, 0x6864, 0x1020, 0x3042, 0xb989, 0xc149, 0xc949, 0xc949, 0xc149, 0xc98a, 0x6906, 
-  0x0000, 0x0020, 0x0020, 0x0820, 0x8126, 0xc149, 0xc169, 0xc969, 0xc969, 0xc969, 0xc969, 0xc949, 
-  0xc969, 0xc949, 0xc949, 0xc949, 0xc949, 0xc949, 0xc949, 0xc949, 0xc949, 0xc969, 0xc949, 0xc949, 
-  0xc949, 0xc949, 0xc949, 0xc949, 0xc969, 0xc969, 0xc949, 0xc949, 0xc949, 0xc949, 0xc149, 0xb148, 
-  0x4062, 0x0000, 0x0000, 0x5063, 0x8885, 0xb128, 0xc149, 0xc148, 0xc149, 0xc149, 0xb928, 0xc149, 
-  0xc148, 0xc149, 0xc129, 0xb928, 0xb908, 0xb989, 0x3062, 0x0800, 0xa168, 0xc949, 0xc149, 0xc149, 
-  0xc148, 0xb989, 0x3882, 0x1000, 0xa968, 0xc949, 0xc149, 0xc128, 0xc128, 0xb169, 0x2841, 0x0000, 
-  0x0000, 0x2841, 0x8885, 0xa8c7, 0xb949, 0xb928, 0xc128, 0xb948, 0xb948, 0xb948, 0xc148, 0xc128, 
-  0xc128, 0xc128, 0xc128, 0xb928, 0xb908, 0xb928, 0xb908, 0xb108, 0xb128, 0x98a6, 0x7085, 0x1821, 
-  0x1000, 0x9947, 0xc949, 0xc149, 0xc149, 0xc149, 0xc949, 0xa989, 0x1841, 0x0000, 0x1942, 0x64c8, 
-  0x7588, 0x7568, 0x7588, 0x7588, 0x7588, 0x7588, 0x7588, 0x7588, 0x7588, 0x7588, 0x7588, 0x7588, 
-  0x7588, 0x7588, 0x7588, 0x7588, 0x7588, 0x7588, 0x7568, 0x7588, 0x6d09, 0x2224, 0x0040, 0x6cc8, 
-  0x75a7, 0x7566, 0x7566, 0x6d46, 0x75a7, 0x6428, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0080, 0x2345, 0x6548, 0x75a7, 0x7567, 0x7566, 0x7566, 0x7567, 0x7567, 0x7567, 0x7567, 0x7566, 
-  0x7567, 0x7567, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 0x7566, 
-  0x7566, 0x7566, 0x7567, 0x7568, 0x6509, 0x2ba6, 0x0902, 0x0041, 0x1266, 0x0a87, 0x0a67, 0x0a47, 
-  0x0a47, 0x0a47, 0x0a67, 0x0a67, 0x0a67, 0x0a47, 0x0a47, 0x0a47, 0x1267, 0x1267, 0x1267, 0x1267, 
-  0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1ae7, 0x2328, 0x12c7, 0x09c5, 0x0020, 0x1821, 0x7065, 0x7845, 0x8065, 0x8065, 0x8045, 0x8045, 
-  0x8045, 0x8045, 0x8045, 0x8045, 0x8045, 0x8045, 0x8045, 0x8045, 0x8044, 0x8045, 0x8845, 0x8044, 
-  0x7824, 0x7844, 0x6085, 0x1020, 0x3041, 0xc1aa, 0xc969, 0xc949, 0xc949, 0xc169, 0xc1aa, 0x6926, 
-  0x0000, 0x0020, 0x0000, 0x0800, 0x5864, 0x98c7, 0xa907, 0xa907, 0xa907, 0xa8e7, 0xa8e7, 0xa8e7, 
-  0xa8e7, 0xa8e7, 0xa8e7, 0xa8e7, 0xa8e7, 0xa8e7, 0xa8e7, 0xa8e7, 0xa8e7, 0xa8e7, 0xa8e7, 0xa8e7, 
-  0xa8e7, 0xa8e7, 0xa8e7, 0xa8e7, 0xa8e7, 0xa8e7, 0xa907, 0xb0e7, 0xb0e7, 0xa8e7, 0xa8e7, 0x8085, 
-  0x3021, 0x0000, 0x0000, 0x5084, 0x7844, 0x8044, 0x8865, 0x8065, 0x8065, 0x8044, 0x8044, 0x8044, 
-  0x8045, 0x8865, 0x8845, 0x8845, 0x8044, 0x8085, 0x2041, 0x0820, 0xa188, 0xc969, 0xc149, 0xc149, 
-  0xc149, 0xc1aa, 0x38a3, 0x1000, 0xb189, 0xc969, 0xc149, 0xc149, 0xc149, 0xb189, 0x3062, 0x0000, 
-  0x0020, 0x2842, 0x7885, 0x8044, 0x8045, 0x8045, 0x8045, 0x8045, 0x8045, 0x8044, 0x8045, 0x8845, 
-  0x8845, 0x8845, 0x8845, 0x8044, 0x8044, 0x8045, 0x8044, 0x8044, 0x8044, 0x7844, 0x68a5, 0x1041, 
-  0x0800, 0xa168, 0xc969, 0xc149, 0xc149, 0xc149, 0xd169, 0xb189, 0x2041, 0x0000, 0x0902, 0x1b06, 
-  0x2386, 0x23a6, 0x23a6, 0x23a7, 0x23c7, 0x23c7, 0x23a6, 0x23a6, 0x23a6, 0x23a6, 0x23a6, 0x23a6, 
-  0x23a6, 0x23a6, 0x23a6, 0x23a6, 0x23a6, 0x23a6, 0x23a6, 0x23c7, 0x23c7, 0x1224, 0x0060, 0x6ce9, 
-  0x7da8, 0x7567, 0x7567, 0x7567, 0x85e9, 0x6c49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 
-  0x08a1, 0x1306, 0x2bc6, 0x5ce8, 0x6d48, 0x7587, 0x75a7, 0x75a7, 0x75a7, 0x75a8, 0x75a8, 0x7da7, 
-  0x75a7, 0x7588, 0x7d87, 0x7da7, 0x7da7, 0x7da7, 0x7da7, 0x7da7, 0x7da7, 0x75a7, 0x75a7, 0x75a7, 
-  0x7587, 0x7d87, 0x6507, 0x4c88, 0x2386, 0x1b26, 0x0922, 0x0060, 0x1ae7, 0x1b27, 0x1b08, 0x12e8, 
-  0x12e8, 0x12e8, 0x12e8, 0x12e8, 0x12e8, 0x12e8, 0x12e8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01c5, 0x01e5, 0x01e5, 0x01e5, 0x01e6, 0x01e6, 0x0206, 
-  0x01e5, 0x01c4, 0x43cd, 0x642f, 0x0861, 0x1820, 0x6885, 0x7865, 0x7845, 0x7845, 0x7844, 0x7844, 
-  0x7844, 0x7844, 0x7844, 0x7844, 0x7845, 0x7845, 0x7845, 0x7844, 0x7844, 0x7845, 0x7844, 0x7844, 
-  0x7845, 0x7865, 0x68a5, 0x1020, 0x2841, 0xa148, 0xb108, 0xa8e7, 0xa0e7, 0x98e7, 0xa128, 0x58c4, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5884, 0x7844, 0x7824, 0x7824, 0x7824, 0x7824, 0x7824, 0x7824, 
-  0x7804, 0x7804, 0x7804, 0x7024, 0x7824, 0x7824, 0x7824, 0x7824, 0x7824, 0x7824, 0x7824, 0x7824, 
-  0x7824, 0x7824, 0x7824, 0x7824, 0x7824, 0x7824, 0x7824, 0x7824, 0x7824, 0x7804, 0x7804, 0x7865, 
-  0x3042, 0x0000, 0x0000, 0x4083, 0x7885, 0x7845, 0x7845, 0x7844, 0x7044, 0x7044, 0x7044, 0x7844, 
-  0x7844, 0x7824, 0x7824, 0x7824, 0x7824, 0x7865, 0x2041, 0x0820, 0x8927, 0xa0e7, 0x98e7, 0xa0e7, 
-  0xa0e7, 0xa928, 0x3082, 0x1020, 0x9127, 0xa8e7, 0x98c7, 0x98e7, 0x98c7, 0x9107, 0x2841, 0x0000, 
-  0x0000, 0x2841, 0x70a5, 0x7865, 0x7044, 0x7044, 0x7044, 0x7044, 0x7044, 0x7824, 0x7844, 0x7844, 
-  0x7824, 0x7824, 0x7824, 0x7824, 0x7824, 0x7844, 0x7844, 0x7844, 0x8045, 0x8065, 0x68a5, 0x1041, 
-  0x0800, 0x8906, 0xa0e7, 0x98c6, 0x98e7, 0xa0e7, 0xb108, 0x88a6, 0x1821, 0x0000, 0x0922, 0x1327, 
-  0x02e6, 0x02e6, 0x0306, 0x0306, 0x0306, 0x0306, 0x0306, 0x0307, 0x0306, 0x0306, 0x0306, 0x0306, 
-  0x0306, 0x0306, 0x0306, 0x0306, 0x0306, 0x0306, 0x0306, 0x0306, 0x0b88, 0x1266, 0x0060, 0x4c08, 
-  0x4c67, 0x4447, 0x4467, 0x4c88, 0x54e9, 0x4387, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 
-  0x0040, 0x1204, 0x1306, 0x0b26, 0x3407, 0x4c88, 0x4488, 0x4488, 0x4c88, 0x4c88, 0x4c88, 0x4487, 
-  0x4468, 0x4488, 0x4467, 0x4487, 0x4488, 0x4c88, 0x4c88, 0x4c88, 0x4c88, 0x4c88, 0x4c88, 0x4488, 
-  0x4488, 0x4c88, 0x2bc7, 0x02a5, 0x0b06, 0x1245, 0x0061, 0x0040, 0x01c5, 0x01e5, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x0a07, 0x0207, 
-  0x0164, 0x4b6d, 0xc71b, 0xd73c, 0x0861, 0x0000, 0x2841, 0x6084, 0x8086, 0x7865, 0x7865, 0x7865, 
-  0x7865, 0x7865, 0x7865, 0x7865, 0x7865, 0x7865, 0x7865, 0x7865, 0x7865, 0x7865, 0x7865, 0x7885, 
-  0x7885, 0x5083, 0x2862, 0x0020, 0x2021, 0x7865, 0x7844, 0x7824, 0x7824, 0x7024, 0x7845, 0x4043, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5083, 0x7865, 0x7844, 0x7824, 0x7844, 0x7844, 0x8024, 0x8024, 
-  0x8024, 0x8024, 0x8024, 0x7824, 0x7844, 0x7824, 0x8044, 0x8044, 0x8044, 0x8044, 0x8044, 0x8044, 
-  0x8044, 0x8044, 0x8044, 0x8044, 0x8044, 0x8024, 0x7824, 0x7824, 0x8024, 0x8024, 0x8045, 0x6064, 
-  0x2041, 0x0000, 0x0020, 0x1020, 0x5083, 0x7885, 0x7885, 0x7885, 0x7885, 0x7885, 0x7865, 0x7865, 
-  0x7865, 0x7865, 0x8065, 0x8065, 0x8065, 0x78a6, 0x2041, 0x0020, 0x5884, 0x7844, 0x7844, 0x7824, 
-  0x8024, 0x7845, 0x2041, 0x0820, 0x6864, 0x7824, 0x7824, 0x7824, 0x7024, 0x6844, 0x2821, 0x0000, 
-  0x0020, 0x0820, 0x3042, 0x6884, 0x7865, 0x7865, 0x7865, 0x7865, 0x7865, 0x7865, 0x7865, 0x7865, 
-  0x8065, 0x7865, 0x7865, 0x7865, 0x7865, 0x7865, 0x7865, 0x8085, 0x7885, 0x6084, 0x3062, 0x0020, 
-  0x0820, 0x6864, 0x8024, 0x7024, 0x7024, 0x7824, 0x7824, 0x7064, 0x1821, 0x0000, 0x0881, 0x0983, 
-  0x1286, 0x0b47, 0x0b47, 0x0b47, 0x0b47, 0x0b47, 0x0b47, 0x0b68, 0x0b47, 0x0b47, 0x0b47, 0x1348, 
-  0x1347, 0x1348, 0x1347, 0x0b48, 0x0b47, 0x1348, 0x1347, 0x1347, 0x1245, 0x0942, 0x0080, 0x12e6, 
-  0x0306, 0x0306, 0x0306, 0x0306, 0x0346, 0x0a44, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 
-  0x0000, 0x0040, 0x1a45, 0x1347, 0x0326, 0x0326, 0x0326, 0x0306, 0x0306, 0x0306, 0x0306, 0x0326, 
-  0x0306, 0x0326, 0x0326, 0x0326, 0x0306, 0x0326, 0x0306, 0x0326, 0x0326, 0x0326, 0x0326, 0x0326, 
-  0x0326, 0x0306, 0x02e6, 0x12e7, 0x1205, 0x0040, 0x0000, 0x0020, 0x09a5, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e7, 0x09e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x332b, 
-  0x8513, 0xbe99, 0xd75d, 0xcf1c, 0x7c30, 0x0000, 0x0000, 0x1841, 0x3062, 0x3042, 0x3042, 0x3042, 
-  0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x2842, 0x2842, 0x2842, 0x2862, 
-  0x2041, 0x0800, 0x0000, 0x0000, 0x2041, 0x70a5, 0x7865, 0x7865, 0x8065, 0x7865, 0x80a6, 0x3883, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0x4883, 0x60a5, 0x6084, 0x6884, 0x6884, 0x6884, 0x6064, 
-  0x6064, 0x6064, 0x6064, 0x6064, 0x6064, 0x6064, 0x6084, 0x6084, 0x6084, 0x6084, 0x6084, 0x6884, 
-  0x6884, 0x6884, 0x6884, 0x6884, 0x6864, 0x6084, 0x6064, 0x5864, 0x5864, 0x5864, 0x6084, 0x3862, 
-  0x0000, 0x0040, 0x0061, 0x0020, 0x0820, 0x2862, 0x2862, 0x2862, 0x2842, 0x2842, 0x2842, 0x2842, 
-  0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x3062, 0x0820, 0x0020, 0x58a4, 0x7885, 0x8085, 0x8085, 
-  0x8085, 0x78a6, 0x2041, 0x0000, 0x6085, 0x7865, 0x8065, 0x8065, 0x8065, 0x70a5, 0x2041, 0x0000, 
-  0x0020, 0x0020, 0x0000, 0x1841, 0x2862, 0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x2842, 0x3042, 
-  0x3042, 0x3042, 0x3042, 0x3042, 0x3042, 0x3062, 0x3062, 0x3062, 0x2841, 0x0800, 0x0000, 0x0000, 
-  0x0820, 0x68a5, 0x8886, 0x8065, 0x7865, 0x7865, 0x7865, 0x6884, 0x1020, 0x0020, 0x0020, 0x0000, 
-  0x08e2, 0x09c4, 0x09c4, 0x09c4, 0x09c4, 0x09c4, 0x09c4, 0x09c4, 0x09c4, 0x09c4, 0x09c4, 0x09c4, 
-  0x09c4, 0x09c4, 0x09c4, 0x09e4, 0x09e4, 0x09e4, 0x11e4, 0x11a4, 0x0040, 0x0000, 0x0881, 0x2348, 
-  0x1388, 0x1368, 0x1368, 0x1347, 0x1368, 0x1a66, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 
-  0x0000, 0x0000, 0x0881, 0x1a66, 0x1ba8, 0x1388, 0x1368, 0x1368, 0x1368, 0x1368, 0x1368, 0x1368, 
-  0x1368, 0x1368, 0x1368, 0x1368, 0x1368, 0x1368, 0x1368, 0x1368, 0x1368, 0x1368, 0x1368, 0x1368, 
-  0x1368, 0x1347, 0x1b48, 0x1205, 0x0020, 0x0000, 0x0000, 0x08e3, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e7, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01a6, 0x01a5, 0x0185, 0x2aaa, 0xbeba, 
-  0xefff, 0xd75d, 0xd73d, 0xd75d, 0xd73c, 0x31e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0040, 0x0040, 0x0000, 0x0820, 0x2862, 0x3062, 0x3862, 0x4062, 0x4062, 0x3862, 0x1021, 
-  0x0000, 0x0902, 0x19e5, 0x0061, 0x0000, 0x0020, 0x0820, 0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 
-  0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x1020, 0x1020, 
-  0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x0820, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000, 
-  0x0040, 0x1184, 0x1226, 0x08e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0x3862, 0x3862, 0x4062, 
-  0x3862, 0x3062, 0x0820, 0x0000, 0x2862, 0x3062, 0x4063, 0x4063, 0x4063, 0x3062, 0x0000, 0x0020, 
-  0x0923, 0x0103, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0081, 0x0040, 
-  0x0000, 0x2862, 0x3862, 0x3862, 0x3862, 0x3862, 0x3042, 0x1841, 0x0000, 0x0081, 0x0963, 0x0061, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0040, 0x1143, 
-  0x11a3, 0x11c4, 0x11c4, 0x1183, 0x1163, 0x08e2, 0x0000, 0x08c1, 0x1a05, 0x0964, 0x0944, 0x0944, 
-  0x0923, 0x0081, 0x0000, 0x08a1, 0x1184, 0x1163, 0x1163, 0x1163, 0x1163, 0x1163, 0x1163, 0x1163, 
-  0x1163, 0x0963, 0x0963, 0x0963, 0x1163, 0x1163, 0x0963, 0x0963, 0x0963, 0x1163, 0x1163, 0x0963, 
-  0x1163, 0x1163, 0x1143, 0x0860, 0x0000, 0x0000, 0x08e2, 0x09c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0185, 0x0144, 0x19e7, 0xae18, 0xc6da, 0xdf7d, 
-  0xd73c, 0xe79e, 0xcf1c, 0xb679, 0x2a89, 0x0964, 0x0103, 0x00c2, 0x0061, 0x0061, 0x0061, 0x0881, 
-  0x08e2, 0x08a2, 0x08c2, 0x0902, 0x0902, 0x08c2, 0x08c2, 0x08c2, 0x0902, 0x08a2, 0x0082, 0x00a2, 
-  0x00a2, 0x1a46, 0x1206, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0040, 0x1205, 0x1ac7, 0x0943, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 
-  0x0983, 0x0a66, 0x0245, 0x0a05, 0x0943, 0x0902, 0x0102, 0x08e2, 0x00e2, 0x00e2, 0x00e2, 0x0102, 
-  0x0102, 0x0902, 0x0902, 0x0902, 0x0902, 0x0102, 0x0963, 0x08e2, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0943, 
-  0x0205, 0x0226, 0x09a4, 0x0902, 0x0902, 0x0902, 0x0902, 0x08e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 
-  0x00e2, 0x08e2, 0x00e2, 0x0902, 0x0902, 0x0902, 0x0902, 0x0902, 0x00e2, 0x09a4, 0x0a46, 0x09c4, 
-  0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0983, 0x0a66, 0x0983, 
-  0x00e1, 0x00e2, 0x08e2, 0x08e2, 0x08e2, 0x08e2, 0x08e2, 0x08e2, 0x08e2, 0x08e2, 0x08e2, 0x08e2, 
-  0x08e2, 0x08e2, 0x08e1, 0x08e2, 0x00e2, 0x08e2, 0x00e2, 0x0902, 0x1a06, 0x19c5, 0x0020, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x2286, 0x1ac7, 0x01c6, 0x01c6, 0x01c5, 
-  0x1246, 0x1a46, 0x0081, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x08e2, 0x09a6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x0a07, 0x01c6, 0x11e7, 0x2228, 0xae17, 0xd77d, 0xd73c, 0xcf1c, 
-  0xc6ba, 0xbe79, 0x3b4c, 0x0a27, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x09a6, 0x0986, 0x09e6, 
-  0x1ae8, 0x09c5, 0x01c6, 0x1ae8, 0x1b08, 0x01e6, 0x09e6, 0x0a26, 0x2328, 0x09e5, 0x01c6, 0x09c6, 
-  0x01c6, 0x1ae8, 0x0a46, 0x0985, 0x08a2, 0x0041, 0x0081, 0x08c1, 0x08a1, 0x08a2, 0x00a2, 0x0902, 
-  0x0984, 0x0a26, 0x12a7, 0x0185, 0x0944, 0x11e5, 0x09a4, 0x0123, 0x0103, 0x0984, 0x11c5, 0x0944, 
-  0x0944, 0x0963, 0x1205, 0x09a5, 0x0964, 0x0944, 0x0123, 0x09a4, 0x1225, 0x1225, 0x09e4, 0x3268, 
-  0xa595, 0xb5f7, 0xb5f7, 0xadb6, 0xb617, 0xa554, 0x3ae9, 0x2246, 0x2206, 0x1a06, 0x2246, 0x2287, 
-  0x2328, 0x1b48, 0x1b48, 0x1b48, 0x1b49, 0x2349, 0x1b29, 0x1b29, 0x1b28, 0x1b08, 0x1b28, 0x1b29, 
-  0x1b29, 0x1b29, 0x2329, 0x2329, 0x2329, 0x2329, 0x2369, 0x22c8, 0x00a2, 0x0061, 0x0061, 0x0041, 
-  0x18e3, 0x2965, 0x5b2c, 0x7c0f, 0x18e3, 0x2124, 0x2124, 0x2144, 0x2145, 0x2124, 0x19a4, 0x1aa7, 
-  0x1b08, 0x1b49, 0x2349, 0x2369, 0x2369, 0x2349, 0x2329, 0x2329, 0x2309, 0x2329, 0x2329, 0x2309, 
-  0x2309, 0x2309, 0x1b29, 0x2329, 0x2329, 0x2329, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x22e8, 
-  0x2206, 0x0041, 0x0061, 0x0081, 0x0081, 0x0081, 0x0061, 0x0882, 0x1a06, 0x1b28, 0x1b28, 0x2348, 
-  0x2348, 0x2348, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 
-  0x2349, 0x2349, 0x2348, 0x2349, 0x2349, 0x2349, 0x2348, 0x2328, 0x2308, 0x1226, 0x1144, 0x0041, 
-  0x0020, 0x0881, 0x0081, 0x0081, 0x0081, 0x0041, 0x19c4, 0x1ac7, 0x01e6, 0x01c6, 0x01a5, 0x0a05, 
-  0x1ac7, 0x0a06, 0x09c5, 0x0944, 0x0881, 0x0061, 0x0061, 0x0061, 0x0081, 0x0881, 0x0061, 0x0061, 
-  0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 
-  0x0061, 0x0081, 0x0081, 0x0903, 0x0985, 0x09c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x0a07, 
-  0x01c6, 0x01c6, 0x0207, 0x01e6, 0x01c5, 0x22a9, 0xae38, 0xd73c, 0xd73c, 0xcf1b, 0xcefb, 0xefff, 
-  0x6430, 0x0164, 0x0a48, 0x0207, 0x0207, 0x09e7, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x0206, 
-  0x1ae7, 0x01c5, 0x01a5, 0x12c7, 0x12e7, 0x01e6, 0x01c6, 0x0226, 0x1b28, 0x0206, 0x01e6, 0x01e6, 
-  0x01e6, 0x1b08, 0x0a46, 0x01a5, 0x09a6, 0x0985, 0x1247, 0x2b28, 0x1206, 0x09e6, 0x0a27, 0x2349, 
-  0x0226, 0x0a46, 0x12c7, 0x01a5, 0x01e6, 0x1b28, 0x12a7, 0x01c5, 0x0a05, 0x1287, 0x1247, 0x0a27, 
-  0x0a87, 0x1b28, 0x12e8, 0x0a47, 0x0a27, 0x0a47, 0x1307, 0x1368, 0x12e7, 0x0225, 0x2b09, 0xbeda, 
-  0xdf9d, 0xdf7d, 0xe79e, 0xf7ff, 0xdf5d, 0x53ad, 0x01c5, 0x01e6, 0x01c5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e6, 0x01e5, 0x01e5, 0x01e5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e6, 0x01e6, 0x09e6, 0x0a07, 0x0185, 
-  0x5bad, 0xadb6, 0xd71c, 0xefbe, 0xd6db, 0xcedb, 0xd6fb, 0xdf1c, 0xdf5d, 0xcefb, 0x4b6c, 0x32c9, 
-  0x01a5, 0x01e6, 0x0a27, 0x0227, 0x01e6, 0x01a5, 0x0185, 0x01a5, 0x01a5, 0x01c5, 0x01c6, 0x01c5, 
-  0x01c5, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e5, 0x01c5, 0x01c5, 0x01c5, 0x01a5, 0x01a5, 0x0185, 
-  0x0185, 0x0185, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x09a6, 0x09a6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 
-  0x01e6, 0x01e5, 0x01e5, 0x01e6, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x0185, 
-  0x09c5, 0x2288, 0x1206, 0x09e6, 0x0a06, 0x1247, 0x1246, 0x01c6, 0x01c6, 0x01c6, 0x0a46, 0x1ae8, 
-  0x0a26, 0x01e6, 0x01e6, 0x0a26, 0x22e7, 0x1a66, 0x09a5, 0x09a5, 0x11c5, 0x1a67, 0x1206, 0x09a5, 
-  0x09e6, 0x09e6, 0x1226, 0x09e6, 0x09a6, 0x09c6, 0x09a6, 0x09a6, 0x09a6, 0x09a6, 0x09a6, 0x09a6, 
-  0x09c6, 0x09c6, 0x09c6, 0x09e6, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01e6, 0x0a07, 0x0206, 0x22ea, 0x53ce, 0xb679, 0xdf9e, 0xd75d, 0xcf1c, 0xd75c, 0xbeba, 0x8d34, 
-  0x3aeb, 0x01a5, 0x0a27, 0x0207, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x0206, 
-  0x1b07, 0x01e6, 0x01a6, 0x12a7, 0x12c7, 0x01c5, 0x01c6, 0x0226, 0x1b28, 0x0206, 0x01c6, 0x01e6, 
-  0x01c6, 0x1b08, 0x0a67, 0x01a6, 0x01c6, 0x01a6, 0x0a67, 0x1ae7, 0x01c5, 0x01c6, 0x0206, 0x1b49, 
-  0x0226, 0x0a66, 0x12e7, 0x01c5, 0x01c5, 0x1b08, 0x0a66, 0x01a5, 0x1287, 0x0a06, 0x01a5, 0x0a46, 
-  0x1b28, 0x12e8, 0x0a26, 0x0227, 0x0a47, 0x12c7, 0x1327, 0x0ac6, 0x01e4, 0x2288, 0x9df6, 0xd75c, 
-  0xc6db, 0xd73c, 0xd71c, 0xae17, 0x434c, 0x0205, 0x12e8, 0x12c7, 0x0a87, 0x0aa7, 0x0a87, 0x0a66, 
-  0x0a67, 0x0a87, 0x0a87, 0x0a87, 0x0a87, 0x0a87, 0x0a87, 0x0a87, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x0a87, 0x1287, 0x1287, 0x1287, 0x1287, 0x0a87, 0x0a87, 0x0a87, 0x0aa7, 0x0ac7, 0x0ac7, 0x0aa8, 
-  0x0a66, 0x01c4, 0x74f1, 0x9e17, 0xd75d, 0xefdf, 0xe79e, 0xd73c, 0xd75c, 0xd73c, 0xd77d, 0xd75c, 
-  0x6450, 0x3b6c, 0x01e5, 0x01e5, 0x01e5, 0x0a26, 0x0a46, 0x0a67, 0x1287, 0x1287, 0x12a7, 0x0a87, 
-  0x1287, 0x1287, 0x0a87, 0x0a87, 0x12a7, 0x12a7, 0x0a87, 0x0a87, 0x1287, 0x0a87, 0x0a67, 0x0a67, 
-  0x0a67, 0x0a87, 0x1287, 0x1287, 0x0aa7, 0x0aa7, 0x0a87, 0x0a87, 0x0a87, 0x0a87, 0x0a87, 0x0a87, 
-  0x0a87, 0x0a87, 0x0a87, 0x0a87, 0x0a87, 0x1287, 0x0a87, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x0a87, 0x0a87, 0x0a87, 0x0a87, 0x0a87, 0x1287, 0x1287, 0x1287, 0x1267, 0x0a67, 0x12a7, 
-  0x1aa7, 0x0a06, 0x01c6, 0x0206, 0x12c7, 0x12a7, 0x01e6, 0x01c6, 0x01c5, 0x0a46, 0x1b08, 0x0a46, 
-  0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x0a46, 0x1b48, 0x1286, 0x01a5, 0x0185, 0x09e5, 0x1aa7, 0x0a26, 
-  0x01e5, 0x0206, 0x0227, 0x0a27, 0x0a26, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x09c6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x0a07, 0x0164, 0x1a48, 0xae38, 0xefdf, 0xd75d, 0xd73c, 0xd73c, 0xe7bf, 0xcf1b, 0x430b, 0x00c2, 
-  0x0164, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e6, 0x01a5, 0x12a7, 0x12c7, 0x01a5, 0x01c6, 0x0a26, 0x1b28, 0x0206, 0x01e6, 0x01e7, 
-  0x01e6, 0x1b28, 0x0a67, 0x01a6, 0x01c6, 0x01a6, 0x1267, 0x12c7, 0x01a5, 0x01c6, 0x0206, 0x1b28, 
-  0x0226, 0x0a86, 0x1b08, 0x01c5, 0x01c5, 0x1b08, 0x0a66, 0x01c5, 0x1ac8, 0x01a5, 0x01c5, 0x1ae8, 
-  0x12c8, 0x0227, 0x0247, 0x0247, 0x1328, 0x1b28, 0x0225, 0x336a, 0x5c0e, 0xae37, 0xd75d, 0xc6fb, 
-  0xcf3c, 0xcefb, 0x6c0f, 0x0184, 0x0246, 0x1b28, 0x1b48, 0x1b28, 0x1308, 0x12e7, 0x12c7, 0x12c7, 
-  0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12a7, 0x12c7, 0x12c7, 0x12a7, 0x12c7, 0x12c7, 0x12c7, 
-  0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12a7, 0x12a7, 0x12a7, 0x1287, 
-  0x0a87, 0x0a87, 0x0245, 0x0245, 0x6cb1, 0x8513, 0xa5d6, 0xefdf, 0xd75d, 0xcf1b, 0xd73c, 0xd73c, 
-  0xe7ff, 0xc6fa, 0x5c8f, 0x544f, 0x22c8, 0x01e4, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12c7, 0x12c7, 
-  0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 
-  0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12a7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 
-  0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12a7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 
-  0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12a7, 0x12a7, 0x1287, 
-  0x01c5, 0x01a5, 0x01c5, 0x09e5, 0x1b08, 0x01e6, 0x0206, 0x01c6, 0x0a46, 0x1ae8, 0x0a26, 0x0206, 
-  0x01e7, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x0a66, 0x1b48, 0x1266, 0x09c5, 0x09c5, 0x0a26, 0x1ae8, 
-  0x0a26, 0x01e6, 0x09e7, 0x0a06, 0x1aa8, 0x1267, 0x01a5, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01a5, 0x01c5, 0x01c5, 0x01c6, 0x01c5, 0x01e5, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 
-  0x0985, 0x6c0f, 0x9d96, 0xdf9d, 0xd73c, 0xd73c, 0xd73c, 0xdf7d, 0x74b1, 0x3b0b, 0x0123, 0x09a5, 
-  0x01a5, 0x01a6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e6, 0x01a5, 0x12a7, 0x12c7, 0x01a5, 0x01c6, 0x0206, 0x1b28, 0x0206, 0x01e6, 0x01e7, 
-  0x01e6, 0x1b28, 0x0a67, 0x01a6, 0x01c6, 0x01a6, 0x1267, 0x12c7, 0x01a5, 0x01c6, 0x01e6, 0x1b28, 
-  0x0226, 0x0a86, 0x1b28, 0x01c5, 0x01c5, 0x1ae8, 0x0a46, 0x01c5, 0x1ae8, 0x01a5, 0x0a26, 0x1aa8, 
-  0x0206, 0x0227, 0x0247, 0x1328, 0x1ba9, 0x0245, 0x2b2a, 0xbeda, 0xdfbe, 0xcf3c, 0xcf1b, 0xdf9e, 
-  0xcf1b, 0x432b, 0x0164, 0x0a26, 0x12a7, 0x1ae7, 0x0226, 0x01e5, 0x0226, 0x12a7, 0x12a7, 0x12a7, 
-  0x12a7, 0x12a7, 0x12a7, 0x1287, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x1287, 0x12a7, 
-  0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x12a7, 0x12a7, 0x0aa7, 0x0266, 0x338b, 0x7532, 0xae58, 0xe7df, 0xd73c, 0xd71c, 
-  0xd73c, 0xd75c, 0xd79d, 0xcf5c, 0x9575, 0x7470, 0x1aa8, 0x0245, 0x12e8, 0x1ae8, 0x12c7, 0x12c7, 
-  0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 
-  0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 
-  0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x1287, 0x1287, 0x12a7, 0x1287, 
-  0x12a7, 0x1287, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x1287, 0x12a7, 
-  0x12a8, 0x12a8, 0x12a7, 0x09e6, 0x0a26, 0x01e6, 0x01e6, 0x0a67, 0x1b08, 0x0206, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01c5, 0x0a45, 0x2368, 0x12a7, 0x01e5, 0x01e6, 0x0a46, 
-  0x1ac7, 0x0a26, 0x01c6, 0x01c6, 0x0a06, 0x1ac8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x9534, 0xd75d, 0xd75d, 0xcf1c, 0xd75d, 0xdf9e, 0xefdf, 0x7d13, 0x02c7, 0x0286, 0x0a06, 0x01a5, 
-  0x01a6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b08, 0x01e6, 0x01a5, 0x12a7, 0x12a7, 0x01a5, 0x01c6, 0x0206, 0x1b08, 0x0206, 0x01e6, 0x09e7, 
-  0x01c6, 0x1b08, 0x0a67, 0x01a6, 0x01c6, 0x01a6, 0x0a67, 0x12c7, 0x01c5, 0x01c6, 0x01e6, 0x1b08, 
-  0x0206, 0x0a66, 0x1b08, 0x01c6, 0x01a5, 0x1ae8, 0x0a26, 0x01c5, 0x1ae8, 0x01c5, 0x0a26, 0x1267, 
-  0x01a5, 0x0206, 0x0a87, 0x1b68, 0x2349, 0x8d74, 0xb678, 0xdf9d, 0xcf1b, 0xcf1c, 0xd73c, 0x6c30, 
-  0x432c, 0x0144, 0x0a06, 0x12a7, 0x1267, 0x01c5, 0x01e6, 0x0a46, 0x1b28, 0x12a7, 0x1287, 0x1267, 
-  0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1287, 0x1267, 0x1267, 0x1287, 
-  0x1287, 0x1287, 0x0a87, 0x1287, 0x0a87, 0x1287, 0x1287, 0x1287, 0x0a67, 0x1267, 0x0a67, 0x0a67, 
-  0x1267, 0x1267, 0x1267, 0x1287, 0x12a7, 0x12e8, 0x12c8, 0x0245, 0x2b0a, 0x53ad, 0xbe99, 0xe7be, 
-  0xd73c, 0xd73c, 0xcf1b, 0xcf1c, 0xdf7d, 0xdf9e, 0xb699, 0x9df6, 0x12c8, 0x0a66, 0x12a7, 0x1287, 
-  0x1287, 0x1267, 0x1287, 0x1287, 0x0a67, 0x1267, 0x1267, 0x0a67, 0x1267, 0x1267, 0x1267, 0x0a67, 
-  0x0a67, 0x1267, 0x0a67, 0x0a67, 0x1287, 0x1267, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 
-  0x0a67, 0x1267, 0x1267, 0x1267, 0x0a67, 0x0a67, 0x0a67, 0x0a87, 0x1287, 0x1267, 0x1267, 0x0a67, 
-  0x0a67, 0x1267, 0x0a67, 0x0a67, 0x1267, 0x0a67, 0x1267, 0x1267, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 
-  0x0a67, 0x0a67, 0x0a67, 0x01e6, 0x01c6, 0x01a5, 0x0a26, 0x1ae8, 0x0a46, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 0x0a86, 0x2348, 0x12a7, 0x01e6, 0x01c6, 
-  0x0a06, 0x1aa7, 0x09e6, 0x01a5, 0x01c6, 0x0a06, 0x1287, 0x0a67, 0x1287, 0x1287, 0x0a87, 0x0a87, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x0a87, 0x0a87, 0x0a87, 0x1287, 0x1287, 0x1287, 0x0a87, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0xd77d, 0xc6fb, 0xcefb, 0xcf1b, 0xdf9d, 0x7491, 0x432c, 0x12c9, 0x0ac8, 0x0aa8, 0x0206, 0x01c6, 
-  0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0226, 
-  0x1b28, 0x01e6, 0x01a5, 0x12a7, 0x12a7, 0x01a5, 0x01c6, 0x0a06, 0x1b08, 0x0205, 0x01e6, 0x09e7, 
-  0x01c6, 0x1b08, 0x0a66, 0x01a6, 0x01c6, 0x01a6, 0x0a67, 0x12c7, 0x01c5, 0x01c6, 0x01e6, 0x1b08, 
-  0x0205, 0x0a46, 0x1b08, 0x01c6, 0x01a5, 0x1ae8, 0x0a46, 0x01c5, 0x1ae8, 0x01a5, 0x0a26, 0x1267, 
-  0x0185, 0x01e6, 0x0ac7, 0x3c2c, 0xb699, 0xe79e, 0xdf7d, 0xd73c, 0xd71c, 0xd73c, 0x63ce, 0x0103, 
-  0x0123, 0x09c6, 0x1aa7, 0x1267, 0x09c5, 0x01c6, 0x0a26, 0x1b28, 0x0a87, 0x01e6, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c5, 0x01e6, 0x0206, 0x01c5, 0x0163, 0x2ac9, 0x4bad, 
-  0xc6fb, 0xd75c, 0xd75d, 0xd75d, 0xcf1c, 0xcf1c, 0xdf7d, 0xdf5d, 0xa617, 0x74b2, 0x0164, 0x0185, 
-  0x0184, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01c5, 0x01c6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x0a46, 0x1ac7, 0x0a06, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 0x0a66, 0x2348, 0x12a7, 0x01c6, 
-  0x01c6, 0x0a06, 0x1aa7, 0x0a06, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01a6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x01a5, 0x01a6, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 
-  0x01a6, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0xcf1c, 0xcf1c, 0xd75d, 0xcf1b, 0xd75c, 0x430b, 0x0123, 0x0a48, 0x0247, 0x12c8, 0x1ae8, 0x01c6, 
-  0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0226, 
-  0x1b28, 0x01e6, 0x01a5, 0x12a7, 0x12a7, 0x01a5, 0x01a6, 0x0a06, 0x1b08, 0x01e5, 0x01e6, 0x09e7, 
-  0x01c6, 0x1b08, 0x0a47, 0x01a6, 0x01c6, 0x0186, 0x1267, 0x12c7, 0x01c5, 0x01c6, 0x01e6, 0x1ae8, 
-  0x01e5, 0x0a46, 0x1ae8, 0x01c6, 0x01c6, 0x1ae8, 0x0a46, 0x01c5, 0x1ae8, 0x0185, 0x0a06, 0x1267, 
-  0x0144, 0x09c5, 0x2308, 0xae98, 0xdf9e, 0xcefb, 0xd71c, 0xe7be, 0x6c71, 0x1a48, 0x09c6, 0x01a5, 
-  0x09e6, 0x1ae7, 0x1266, 0x01c5, 0x01c5, 0x01e6, 0x12c7, 0x0a66, 0x01c6, 0x01e6, 0x0a87, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b09, 0x2308, 0x2308, 0x2308, 0x2309, 0x2329, 0x2329, 0x2328, 0x2328, 0x1b28, 
-  0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x2328, 0x2328, 0x2308, 0x2308, 0x2308, 0x2309, 0x2309, 0x2329, 
-  0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2328, 0x1b28, 0x1b29, 0x2329, 0x2328, 0x12a7, 0x1286, 
-  0x338b, 0x5c6f, 0xc6da, 0xdf5d, 0xefdf, 0xdf5d, 0xcf1b, 0xcf1b, 0xdf7d, 0xcf3c, 0xb679, 0x74b1, 
-  0x2ac9, 0x22c8, 0x1287, 0x2309, 0x2309, 0x1b08, 0x2308, 0x2308, 0x2308, 0x1b08, 0x1b08, 0x2328, 
-  0x2329, 0x2329, 0x2328, 0x2329, 0x1b28, 0x1b28, 0x1b28, 0x1b08, 0x1b28, 0x1b28, 0x2328, 0x2308, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 0x2329, 0x1b29, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 
-  0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x2308, 0x2308, 0x1b08, 0x1b28, 
-  0x1b28, 0x2329, 0x2329, 0x2328, 0x1b28, 0x1b08, 0x0a06, 0x01c6, 0x09e6, 0x01c6, 0x01c6, 0x01a5, 
-  0x01c5, 0x01a6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 0x0a66, 0x2348, 0x12a7, 
-  0x01e6, 0x01a5, 0x09e6, 0x1ac7, 0x1226, 0x01c6, 0x09e6, 0x01e7, 0x01e7, 0x01e7, 0x09e7, 0x09e6, 
-  0x09c7, 0x09c7, 0x09e6, 0x09c6, 0x01c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x01e6, 0x01e6, 
-  0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0xd75c, 0xcf1b, 0xbe99, 0x7471, 0x2207, 0x19c6, 0x0165, 0x01e7, 0x0227, 0x0247, 0x12c7, 0x12a7, 
-  0x09e6, 0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0226, 
-  0x1b28, 0x01e6, 0x01a5, 0x12a7, 0x12a7, 0x01a5, 0x01c6, 0x09e6, 0x1b08, 0x0205, 0x01e6, 0x01e7, 
-  0x01c5, 0x1b08, 0x0a66, 0x01a6, 0x01c6, 0x01a6, 0x0a67, 0x12c7, 0x01c5, 0x01c6, 0x01e6, 0x1ae8, 
-  0x01e5, 0x0a46, 0x12e8, 0x01c6, 0x01c6, 0x1ae8, 0x0a66, 0x01e5, 0x1ae8, 0x01a5, 0x09e6, 0x0205, 
-  0x0944, 0x8513, 0xc71b, 0xcf1c, 0xcf1c, 0xdf7d, 0xe79e, 0x8534, 0x0a27, 0x0206, 0x01e6, 0x0a06, 
-  0x1ae7, 0x0a26, 0x01c5, 0x01c5, 0x0a06, 0x1ac7, 0x0a26, 0x01a5, 0x01c6, 0x0a67, 0x1b48, 0x12c7, 
-  0x0225, 0x0205, 0x01e5, 0x01e5, 0x0205, 0x01e5, 0x01e5, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x01e5, 0x01e5, 0x01c5, 0x01c5, 
-  0x01a4, 0x01c5, 0x09c5, 0x53ad, 0x9534, 0xbe79, 0xe79e, 0xd73c, 0xcefb, 0xcf1c, 0xdf7d, 0xcf3c, 
-  0xd75c, 0x7450, 0x32c9, 0x09c5, 0x0184, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01e5, 0x0205, 0x0205, 
-  0x0225, 0x0225, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x01e5, 0x01e5, 0x01e5, 0x0205, 
-  0x0205, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x0205, 0x0205, 0x0205, 0x0205, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x0205, 0x01e5, 0x01e5, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x01e5, 0x01a6, 0x01a6, 0x01a6, 0x01e6, 0x12c7, 0x1b48, 
-  0x1ac7, 0x09e5, 0x01a5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 0x0a46, 0x1b28, 
-  0x1267, 0x01e6, 0x01c6, 0x0a05, 0x1ac7, 0x0a06, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 
-  0xe7de, 0x8d14, 0x0945, 0x0965, 0x0144, 0x11e6, 0x11c6, 0x01a5, 0x01e6, 0x0a27, 0x0226, 0x12e7, 
-  0x12e8, 0x0a06, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0226, 
-  0x1b28, 0x01e6, 0x01a5, 0x12a7, 0x12a7, 0x01a5, 0x01c6, 0x0206, 0x1ae8, 0x01c5, 0x01c5, 0x01c6, 
-  0x01a5, 0x1b07, 0x0a66, 0x01a6, 0x01c6, 0x01a6, 0x0a87, 0x12c7, 0x01c5, 0x01c6, 0x01e6, 0x1ae8, 
-  0x01e5, 0x0a46, 0x12c8, 0x01a5, 0x01c6, 0x1ae8, 0x0a67, 0x0226, 0x2369, 0x01a4, 0x1a27, 0x3b4b, 
-  0x8513, 0xd77d, 0xcf1c, 0xcf1c, 0xcf1c, 0xb638, 0x8513, 0x0247, 0x0a88, 0x0227, 0x0a67, 0x1ae7, 
-  0x0a46, 0x01c5, 0x01c5, 0x01e5, 0x1ac7, 0x0a66, 0x01e5, 0x01c5, 0x0a87, 0x1b08, 0x1287, 0x0206, 
-  0x01e6, 0x0a26, 0x1267, 0x0a67, 0x0a67, 0x0a67, 0x0a47, 0x0a47, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 
-  0x0a67, 0x0a67, 0x1267, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a67, 0x0a67, 0x0a67, 0x1267, 
-  0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 
-  0x0a47, 0x0a67, 0x12a7, 0x12a7, 0x01e5, 0x6cb1, 0xb6b9, 0xa657, 0xdf7d, 0xdf7d, 0xcefb, 0xcf1c, 
-  0xd73c, 0xdf7d, 0xdf9e, 0x536d, 0x2248, 0x0184, 0x0184, 0x09e5, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1267, 0x1267, 0x0a67, 0x1267, 0x1267, 0x1267, 0x0a67, 0x1247, 0x0a67, 
-  0x0a67, 0x0a67, 0x0a67, 0x1267, 0x1267, 0x1267, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 
-  0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x1267, 
-  0x0a67, 0x0a67, 0x1267, 0x1267, 0x1267, 0x1247, 0x1247, 0x1247, 0x1246, 0x12c7, 0x1b88, 0x1347, 
-  0x1b48, 0x12e7, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e5, 
-  0x12c7, 0x12a7, 0x01e6, 0x01c6, 0x0a06, 0x1ac8, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a87, 0x0a87, 
-  0x1287, 0x0a87, 0x0a87, 0x0a67, 0x0a67, 0x0a67, 0x1267, 0x1267, 0x1267, 0x1267, 0x0a67, 0x1267, 
-  0x0a67, 0x0a87, 0x1267, 0x1267, 0x0a87, 0x0a87, 0x1287, 0x1287, 0x1267, 0x1287, 0x1288, 0x1288, 
-  0x8d14, 0x09c6, 0x01a6, 0x09a5, 0x0985, 0x0144, 0x1227, 0x1206, 0x0185, 0x01e6, 0x0206, 0x0a66, 
-  0x1327, 0x0aa6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0226, 
-  0x1b28, 0x0206, 0x01c5, 0x12c7, 0x12a7, 0x01a5, 0x01c6, 0x09e6, 0x2309, 0x1266, 0x1266, 0x1287, 
-  0x0a86, 0x2368, 0x0a66, 0x01a6, 0x01e6, 0x01a6, 0x0a87, 0x12e7, 0x01a5, 0x01c6, 0x01e6, 0x1ae8, 
-  0x01e5, 0x0a46, 0x12e8, 0x01a5, 0x01c5, 0x1ae8, 0x0a66, 0x0a46, 0x1327, 0x0205, 0x8533, 0xdf9e, 
-  0xcf3c, 0xcf1c, 0xcf1c, 0xd75d, 0x8514, 0x0185, 0x01c5, 0x0a67, 0x0268, 0x12c8, 0x1ae8, 0x0a26, 
-  0x01e5, 0x01c5, 0x0a06, 0x1ac7, 0x0a46, 0x01e5, 0x01c5, 0x0a46, 0x1ae8, 0x0a66, 0x01e6, 0x01e6, 
-  0x0a46, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b28, 0x1b28, 0x2349, 0x1308, 0x0a86, 0x1287, 0x74b1, 0x9dd6, 0xd75c, 0xcf1c, 
-  0xd71c, 0xcf1c, 0xcf1b, 0xd75d, 0xcf3c, 0x5c2f, 0x5c4f, 0x3b8b, 0x1266, 0x12a7, 0x1b28, 0x2349, 
-  0x2308, 0x2308, 0x1b08, 0x1b08, 0x1b08, 0x2308, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 0x1b28, 0x1b87, 0x0285, 
-  0x1b47, 0x1b27, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x0a46, 0x2348, 0x12a7, 0x01c5, 0x01c5, 0x0a46, 0x1b08, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b09, 0x1b09, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x2309, 0x2308, 
-  0x0aa6, 0x0ac7, 0x0206, 0x01c6, 0x0185, 0x0165, 0x0164, 0x1a87, 0x09a5, 0x0185, 0x01e6, 0x0206, 
-  0x0aa6, 0x0a86, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0226, 
-  0x1b28, 0x0206, 0x01e6, 0x0a66, 0x12a7, 0x0a06, 0x01c6, 0x01e6, 0x1287, 0x1286, 0x1286, 0x12a7, 
-  0x12c7, 0x12c7, 0x0225, 0x01e6, 0x01c6, 0x01e6, 0x12e7, 0x12c7, 0x01c5, 0x01c6, 0x01e6, 0x1ae8, 
-  0x01e5, 0x0a66, 0x12e8, 0x01c6, 0x01c5, 0x1ae8, 0x0a66, 0x0184, 0x646f, 0x8533, 0xdf7d, 0xcf3c, 
-  0xcf1b, 0xd75c, 0xcf3c, 0x8d54, 0x0985, 0x01a5, 0x0a07, 0x0207, 0x0a87, 0x2328, 0x0a67, 0x01e6, 
-  0x01c6, 0x0a26, 0x1ae7, 0x0a66, 0x01c5, 0x01c6, 0x1267, 0x1ae7, 0x0205, 0x01c6, 0x01e6, 0x0a67, 
-  0x1ae8, 0x0a06, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01a5, 0x01c5, 0x01c6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01e6, 0x01e6, 0x09c6, 0x4b6c, 0x7cd2, 0xd75c, 0xcf1c, 
-  0xcf1c, 0xcefb, 0xcefc, 0xcefb, 0xcf1b, 0xd75c, 0xe7de, 0xae17, 0x5bae, 0x6c30, 0x1227, 0x0123, 
-  0x01c6, 0x01c6, 0x01a5, 0x01c5, 0x01c6, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x0a26, 0x1b27, 0x1b88, 
-  0x1b48, 0x0a66, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x0a66, 0x2328, 0x1286, 0x01c5, 0x01c6, 0x01c5, 0x01c5, 0x01c6, 0x01c5, 0x01c6, 0x01c5, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01e5, 0x01c5, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 
-  0x1c29, 0x1ba8, 0x0226, 0x0206, 0x01e6, 0x01a5, 0x0185, 0x09c5, 0x1aa7, 0x09a5, 0x01a5, 0x01e6, 
-  0x12c7, 0x0a86, 0x01c6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0226, 
-  0x1b08, 0x0206, 0x01e6, 0x01c5, 0x1ae8, 0x1287, 0x01a5, 0x01c5, 0x01a4, 0x0164, 0x0164, 0x0164, 
-  0x0184, 0x0a86, 0x12e7, 0x0206, 0x0206, 0x1b07, 0x2389, 0x12c7, 0x01c5, 0x01c6, 0x01e6, 0x1ae8, 
-  0x01e5, 0x0a46, 0x12e7, 0x01c6, 0x01e6, 0x1286, 0x01c4, 0x6c2f, 0xdf5d, 0xe79e, 0xcf1c, 0xcf1c, 
-  0xe79e, 0xae58, 0x542e, 0x1245, 0x0184, 0x09a5, 0x0185, 0x0a47, 0x1b28, 0x0a26, 0x01e6, 0x01e6, 
-  0x0a46, 0x1b28, 0x0a66, 0x01e6, 0x01e5, 0x0a67, 0x12c7, 0x01e6, 0x01c6, 0x01c6, 0x0a26, 0x1b08, 
-  0x0a26, 0x01e6, 0x09e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01a6, 0x01a6, 0x0185, 0x0164, 0x7cb2, 0xe7be, 0xd77d, 0xcf1c, 0xcf1b, 
-  0xd75c, 0xdf9e, 0xdf9e, 0xdf9e, 0xdf9d, 0xd71c, 0xcf1c, 0xdf5d, 0xe7be, 0xefdf, 0xa5f7, 0x74b2, 
-  0x0185, 0x0124, 0x01a6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e7, 0x01c6, 0x0a26, 0x12a7, 
-  0x1266, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c5, 0x0a46, 0x2369, 0x12a7, 0x01c5, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09e7, 
-  0x13c8, 0x13c8, 0x1b88, 0x12e7, 0x0206, 0x01e6, 0x01a5, 0x0185, 0x0a46, 0x1287, 0x0185, 0x01a5, 
-  0x12c7, 0x0a86, 0x01c6, 0x09e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0226, 
-  0x12a7, 0x01e6, 0x01e6, 0x01e6, 0x0a26, 0x12c8, 0x1b29, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ac8, 
-  0x1ae8, 0x1287, 0x1266, 0x01e6, 0x0206, 0x0a86, 0x0a87, 0x0a26, 0x01c6, 0x01c6, 0x01e6, 0x1ae8, 
-  0x01c5, 0x0a46, 0x12e8, 0x01e6, 0x0185, 0x5c2f, 0x9595, 0xcf3c, 0xd73c, 0xcf1c, 0xcf3c, 0xdf9e, 
-  0x9555, 0x2309, 0x0204, 0x1ac7, 0x01c5, 0x0185, 0x09e5, 0x1287, 0x0a26, 0x01e6, 0x01e6, 0x0a46, 
-  0x1b28, 0x0a87, 0x0206, 0x0206, 0x1287, 0x12c7, 0x01e6, 0x01e6, 0x01c6, 0x0a26, 0x1ae8, 0x0a26, 
-  0x01e6, 0x0206, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01c5, 0x01e5, 0x01c5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01e5, 
-  0x01e5, 0x0206, 0x0206, 0x01e6, 0x0143, 0x53ae, 0x9595, 0xd73c, 0xcf3c, 0xcf1c, 0xcf1c, 0xd77d, 
-  0x8513, 0x4b2b, 0x538d, 0x4b6c, 0x6c4f, 0xd77d, 0xd75c, 0xd73c, 0xd71c, 0xcf1c, 0xdf9d, 0xd77d, 
-  0x9575, 0x640f, 0x00e3, 0x0144, 0x01a5, 0x01a5, 0x01c5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01e5, 0x01c5, 0x01c5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01a5, 0x01a5, 
-  0x01a5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x0a66, 0x2369, 0x12c7, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e6, 0x01e6, 
-  0x13c8, 0x13e8, 0x1c09, 0x1ba8, 0x0a87, 0x01c6, 0x01c6, 0x01a5, 0x01c5, 0x12a7, 0x0185, 0x01a5, 
-  0x12c7, 0x0a86, 0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x0a06, 0x01e6, 0x01c6, 0x01e6, 0x01a6, 0x0a26, 0x0aa7, 0x0aa7, 0x12a7, 0x0a87, 0x0a87, 0x0a66, 
-  0x0a66, 0x01c5, 0x0185, 0x01c6, 0x01e7, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x1ae8, 
-  0x01a5, 0x0a26, 0x12a7, 0x0144, 0x7491, 0xd75c, 0xdf9d, 0xcf1b, 0xcf3c, 0xd73c, 0xd77d, 0x8d74, 
-  0x09e6, 0x12c7, 0x12c7, 0x1ae7, 0x01e5, 0x0a06, 0x1ac7, 0x01e5, 0x01c6, 0x01c5, 0x0226, 0x1b48, 
-  0x0a87, 0x0206, 0x0206, 0x12a7, 0x12c7, 0x0206, 0x01e6, 0x01e6, 0x0a46, 0x1ae7, 0x0a26, 0x01c6, 
-  0x01e6, 0x0226, 0x1b08, 0x1b28, 0x1b08, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b08, 0x1b08, 0x1b28, 
-  0x1b28, 0x1b08, 0x1b08, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 
-  0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1328, 0x12e7, 0x0286, 0x4c0d, 0xc71b, 0xdfbe, 0xd73c, 0xd75d, 0xdf5d, 0xdf5d, 0x8d74, 
-  0x1a87, 0x0a04, 0x0a45, 0x0a45, 0x2308, 0x7d71, 0xa636, 0xe79e, 0xdf5d, 0xd75d, 0xcf1b, 0xcefb, 
-  0xdf9e, 0xcf3c, 0xa5f7, 0x5c4f, 0x1287, 0x1ae8, 0x1ae8, 0x1b28, 0x2349, 0x1b48, 0x1b48, 0x2348, 
-  0x2348, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 0x1b28, 
-  0x1b28, 0x2328, 0x2328, 0x2328, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 
-  0x1b28, 0x2308, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x2349, 0x12c7, 0x0205, 0x01e6, 0x01e6, 0x01e6, 
-  0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x0206, 0x01e6, 0x0a66, 0x2348, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 
-  0x2328, 0x2308, 0x1b28, 0x1b28, 0x1b28, 0x2328, 0x2328, 0x2328, 0x2328, 0x2328, 0x2329, 0x2329, 
-  0x1b28, 0x1b28, 0x2329, 0x2329, 0x2329, 0x2329, 0x2328, 0x2328, 0x2328, 0x2329, 0x2328, 0x2328, 
-  0x13c8, 0x13c8, 0x13c8, 0x1bc9, 0x12c7, 0x01c6, 0x09e6, 0x01a6, 0x09e5, 0x12a7, 0x01a5, 0x01a5, 
-  0x12c7, 0x0a86, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e5, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 
-  0x01c5, 0x01a4, 0x5c2e, 0xae17, 0xcefb, 0xd75d, 0xcf1b, 0xcf5c, 0xd77d, 0x8d34, 0x2ae9, 0x2329, 
-  0x01a5, 0x1ae8, 0x0a86, 0x1b08, 0x01e5, 0x0a46, 0x1ae8, 0x01c5, 0x01c6, 0x01e5, 0x1ae7, 0x0a86, 
-  0x0206, 0x01e6, 0x12a7, 0x1b08, 0x0206, 0x01e6, 0x01c6, 0x0a66, 0x1ae8, 0x0a26, 0x01e5, 0x01c6, 
-  0x01e5, 0x1ac7, 0x0a86, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a26, 0x0a26, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a26, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a26, 0x0a26, 0x0a26, 0x0a25, 0x0a26, 0x0a26, 
-  0x0a25, 0x0a66, 0x22a7, 0x74d1, 0xcf7c, 0xcf3c, 0xc6fb, 0xcf1c, 0xd71c, 0x9595, 0x1a27, 0x11e6, 
-  0x0184, 0x09e5, 0x0a06, 0x0a26, 0x0a46, 0x0a67, 0x1ac9, 0x22a9, 0x8513, 0xcf3c, 0xcf1b, 0xd75d, 
-  0xcefb, 0xcf1c, 0xdf7d, 0xc6fb, 0xbeda, 0x5c4f, 0x1a46, 0x1a87, 0x0a46, 0x0a66, 0x0a46, 0x0a66, 
-  0x0a66, 0x0a45, 0x0a45, 0x0a25, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a26, 0x0a46, 0x0a46, 0x0a66, 0x0a46, 0x1ae7, 0x12a7, 0x01c5, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0226, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a26, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x13c8, 0x13c8, 0x1bc9, 0x12e7, 0x01e6, 0x01e6, 0x09e6, 0x01c6, 0x01e5, 0x12c7, 0x01c5, 0x01a5, 
-  0x12c7, 0x0aa6, 0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01c6, 0x0206, 
-  0x1287, 0x01e6, 0x01e6, 0x01c6, 0x01a5, 0x01a5, 0x01c5, 0x09e6, 0x01e6, 0x09e6, 0x0206, 0x0206, 
-  0x0a06, 0x0206, 0x01a5, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0207, 0x0207, 0x0a46, 0x1b48, 
-  0x0184, 0x434c, 0xcf3b, 0xd77d, 0xcf3c, 0xcf1b, 0xdf7d, 0xc6fb, 0xa637, 0x09c5, 0x0a46, 0x12c7, 
-  0x01a5, 0x12c8, 0x0a86, 0x1b08, 0x0206, 0x0a46, 0x1ae8, 0x01c5, 0x01c5, 0x1ae8, 0x0a66, 0x01c6, 
-  0x01e6, 0x0a86, 0x1ae7, 0x0206, 0x01e6, 0x01c6, 0x0a26, 0x12e7, 0x0a26, 0x01e6, 0x01e6, 0x0206, 
-  0x12a7, 0x0a46, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 
-  0x0164, 0x434c, 0xcf5c, 0xd75d, 0xd75c, 0xcf1b, 0xd77d, 0xbeba, 0x2228, 0x09e6, 0x01e6, 0x01e6, 
-  0x01a6, 0x0185, 0x01a6, 0x01c6, 0x01e6, 0x0207, 0x0227, 0x0227, 0x1227, 0x11a6, 0x8513, 0xbeba, 
-  0xd75c, 0xd75c, 0xcefb, 0xcf1c, 0xd75d, 0xcefb, 0xcefb, 0xb658, 0x09c6, 0x0164, 0x01c6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e5, 0x1ac8, 0x1aa7, 0x01e5, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 
-  0x1b48, 0x1b69, 0x12e7, 0x0206, 0x01e6, 0x01e6, 0x01c6, 0x01c5, 0x1266, 0x12a7, 0x01c6, 0x01a5, 
-  0x12e7, 0x0aa7, 0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01c6, 0x0a26, 
-  0x2349, 0x0206, 0x01e6, 0x01c6, 0x0185, 0x0a05, 0x1ac6, 0x2327, 0x0a46, 0x09e6, 0x0a26, 0x1b07, 
-  0x2388, 0x1b68, 0x0a46, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x0207, 0x0a28, 0x0266, 0x1b28, 
-  0x4bad, 0xcf1b, 0xcf1b, 0xc6fb, 0xcf3c, 0xdf7d, 0xbe99, 0x32a9, 0x1aa8, 0x01e6, 0x1287, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a86, 0x1b08, 0x01e6, 0x0a46, 0x1ae8, 0x01c5, 0x01c5, 0x12e8, 0x0a46, 0x01c5, 
-  0x12a7, 0x12c7, 0x0206, 0x0206, 0x01e6, 0x0a67, 0x1ae8, 0x0a26, 0x01e6, 0x01c6, 0x0206, 0x1b08, 
-  0x0a86, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x09c6, 0x0165, 0x0144, 
-  0x434d, 0xcf3c, 0xd75c, 0xcf1c, 0xcefb, 0xdf9d, 0xbe9a, 0x3aeb, 0x0185, 0x01e6, 0x0207, 0x0207, 
-  0x0207, 0x0a07, 0x0a27, 0x0a07, 0x0207, 0x0207, 0x0227, 0x0a07, 0x01a6, 0x0165, 0x0144, 0x11a6, 
-  0x9575, 0xb679, 0xdf9e, 0xd75d, 0xcefb, 0xd73c, 0xd75d, 0xdf5d, 0xa5f7, 0x5c2f, 0x2aca, 0x0124, 
-  0x0144, 0x01a6, 0x09c6, 0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e5, 0x1ac7, 0x12c7, 0x01e5, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 
-  0x09e7, 0x0a07, 0x09e7, 0x09e6, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c5, 0x12a7, 0x1ac7, 0x01e5, 0x01e6, 0x01a5, 
-  0x12c7, 0x12a7, 0x01c6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0226, 
-  0x1b48, 0x0206, 0x01e6, 0x01c6, 0x09e5, 0x1ae7, 0x1ae6, 0x1b26, 0x1b27, 0x01c6, 0x12a7, 0x2c09, 
-  0x1b88, 0x1b47, 0x2348, 0x0a06, 0x01a6, 0x01a6, 0x01a6, 0x09c6, 0x01e6, 0x01a5, 0x336c, 0x74f1, 
-  0xd75c, 0xcf3c, 0xc71b, 0xd75c, 0xae58, 0x95b5, 0x22a9, 0x01c5, 0x1b09, 0x01e5, 0x0a87, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a86, 0x1b08, 0x0205, 0x0a66, 0x1ae7, 0x01e6, 0x01e5, 0x1b08, 0x0a46, 0x01e5, 
-  0x1b28, 0x01e6, 0x01e6, 0x01e6, 0x0a66, 0x1b28, 0x0a46, 0x01c6, 0x01c6, 0x0205, 0x1ae7, 0x12a7, 
-  0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x01e7, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x09e7, 0x0a07, 0x0185, 0x32aa, 0x53ae, 
-  0xcf1b, 0xcf3c, 0xd75d, 0xe7df, 0xefff, 0xc6ba, 0x2acb, 0x01a6, 0x09e7, 0x09e7, 0x01e7, 0x0a27, 
-  0x09e7, 0x0144, 0x0124, 0x09e6, 0x0a28, 0x0a27, 0x01e7, 0x01c6, 0x01a6, 0x0185, 0x0185, 0x0986, 
-  0x0165, 0x22aa, 0x9575, 0xbe79, 0xefbe, 0xdf9e, 0xd73c, 0xcf1c, 0xdf7d, 0xe7de, 0xa5f7, 0x3aea, 
-  0x4b4c, 0x09c6, 0x0103, 0x01c6, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e7, 0x09e6, 0x09e7, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01c6, 0x01a6, 0x0185, 0x01a6, 0x01e5, 0x1b07, 0x12a7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01c5, 0x12a7, 0x1ae8, 0x01e6, 0x01e6, 0x01c6, 0x0a26, 
-  0x12c7, 0x0a46, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01c6, 0x0226, 
-  0x1b28, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x2ba9, 0x01e3, 0x12a5, 0x1b07, 0x01a5, 0x12a7, 0x2409, 
-  0x0b06, 0x1327, 0x2388, 0x09e6, 0x01a5, 0x0185, 0x09a5, 0x0103, 0x2268, 0x5c0f, 0xbeba, 0xe7be, 
-  0xd73c, 0xcf1b, 0xd75c, 0xb679, 0x3aca, 0x01c4, 0x0a06, 0x01e6, 0x1b28, 0x01e5, 0x0a87, 0x1ac7, 
-  0x01a5, 0x12e8, 0x0a86, 0x1b28, 0x01e5, 0x0a46, 0x1ae7, 0x01c5, 0x01e5, 0x1b08, 0x0a46, 0x01e5, 
-  0x1ae8, 0x01e6, 0x01c6, 0x0a66, 0x1b28, 0x0a46, 0x01e6, 0x01e6, 0x0206, 0x1b08, 0x1287, 0x01c5, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x0164, 0x436d, 0xcf1b, 0xd77d, 
-  0xcefb, 0xe7df, 0xa5b6, 0x5b2c, 0x6bae, 0x1925, 0x0062, 0x0104, 0x0904, 0x08e3, 0x00c3, 0x00e3, 
-  0x0000, 0x52a9, 0x7bee, 0x08a2, 0x0061, 0x0103, 0x09a5, 0x0985, 0x0186, 0x01a6, 0x01c6, 0x01e6, 
-  0x0a07, 0x0207, 0x0164, 0x3b2c, 0x9575, 0x84f3, 0xcefb, 0xe7de, 0xcf1c, 0xcefb, 0xd73c, 0xd77d, 
-  0xe7be, 0x7cd2, 0x4b4d, 0x01a6, 0x0164, 0x09e7, 0x0a07, 0x0a07, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 
-  0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x01c5, 0x1206, 0x1246, 0x0a05, 0x01c5, 0x0206, 0x1b28, 
-  0x12a7, 0x01a5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x01e6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x12a7, 0x1ae7, 0x0206, 0x01e6, 0x01c6, 0x0a46, 0x1b28, 
-  0x1286, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x0226, 
-  0x1b28, 0x01e6, 0x01e6, 0x01e6, 0x0a87, 0x2388, 0x1b06, 0x1ae6, 0x1225, 0x0185, 0x0a26, 0x1b28, 
-  0x1b88, 0x23c9, 0x1b08, 0x01e6, 0x01c5, 0x09a6, 0x0124, 0x2a48, 0xae17, 0xdfbd, 0xcf3c, 0xcf1b, 
-  0xd75c, 0xe7be, 0xae38, 0x2a68, 0x0144, 0x1aa8, 0x0a06, 0x01c6, 0x1b08, 0x01e5, 0x0a67, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a86, 0x1b08, 0x01e6, 0x0a46, 0x12e7, 0x01c5, 0x01c5, 0x1b08, 0x0a46, 0x01e5, 
-  0x1b08, 0x01c5, 0x0a26, 0x1b08, 0x0a46, 0x01e6, 0x01e6, 0x0226, 0x1b28, 0x12a7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x0164, 0x32ca, 0x7471, 0xbe79, 0xdf5d, 0xcf1c, 
-  0xcebb, 0x5b0c, 0x39c7, 0x41e7, 0x5a89, 0x62eb, 0x6b2c, 0x31a6, 0x0001, 0x0002, 0x0002, 0x39c7, 
-  0x7bee, 0xbdd5, 0xdeb8, 0x7bee, 0x738c, 0x4a69, 0x0000, 0x00a2, 0x0986, 0x09c7, 0x09e7, 0x01e7, 
-  0x0207, 0x0207, 0x0a27, 0x01e6, 0x0185, 0x0144, 0x538d, 0x7cd2, 0xd73c, 0xd75c, 0xcf1c, 0xcefb, 
-  0xcefb, 0xd75d, 0xdf9e, 0x9554, 0x5bae, 0x0185, 0x01a5, 0x01e6, 0x0206, 0x01e6, 0x01e6, 0x01e6, 
-  0x01c6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 
-  0x01e5, 0x01e6, 0x01e6, 0x01c5, 0x01c5, 0x12a6, 0x1b07, 0x2368, 0x1b07, 0x0a26, 0x01e6, 0x0206, 
-  0x12e7, 0x1287, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 
-  0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 
-  0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1b08, 0x12c8, 0x0206, 0x01e6, 0x01c6, 0x0226, 0x1b49, 0x1b08, 
-  0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x0226, 
-  0x1b28, 0x01e6, 0x01c6, 0x0207, 0x0206, 0x0aa6, 0x2388, 0x1286, 0x0164, 0x01a6, 0x01c6, 0x01e6, 
-  0x1b48, 0x1b48, 0x0226, 0x0206, 0x09c6, 0x0144, 0x2248, 0xae78, 0xd77d, 0xc6fb, 0xcf1c, 0xd75d, 
-  0xc6da, 0x5c2f, 0x3bcc, 0x01a4, 0x01c6, 0x1ac8, 0x0a26, 0x01c6, 0x1b08, 0x01c5, 0x0a67, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a86, 0x1b08, 0x0206, 0x0a46, 0x12e7, 0x01c5, 0x01c5, 0x1b08, 0x0a46, 0x01e5, 
-  0x1b08, 0x01c5, 0x0a87, 0x1ae8, 0x01a5, 0x09c6, 0x01e6, 0x1b08, 0x12c7, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01c6, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0207, 0x0185, 0x2a89, 0xb679, 0xe7df, 0xdf5d, 0xdf7e, 0xdf7d, 
-  0x4a49, 0x3986, 0x8c0f, 0xc5b4, 0xd616, 0xce36, 0xd656, 0xad33, 0x83ef, 0x5acc, 0x1065, 0x2947, 
-  0x4a48, 0x9cf2, 0xd6b8, 0xce77, 0xd697, 0xbdb4, 0x8c6f, 0x5289, 0x0041, 0x0082, 0x09c6, 0x0a48, 
-  0x0a88, 0x1b09, 0x1b08, 0x1b08, 0x1b29, 0x1b09, 0x0a26, 0x09e5, 0x4bed, 0x8db4, 0xe7be, 0xdf7d, 
-  0xd73c, 0xcefb, 0xcefb, 0xe79e, 0xd75d, 0x9575, 0x9dd6, 0x542e, 0x0245, 0x12c7, 0x12e8, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1ae7, 0x2368, 0x12e6, 0x12e6, 0x2388, 0x1287, 0x01c6, 0x01e6, 
-  0x0206, 0x12c7, 0x12a7, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a06, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 
-  0x0a47, 0x0a46, 0x0a46, 0x0a46, 0x0a47, 0x0206, 0x01c6, 0x01c5, 0x0205, 0x1b08, 0x1b08, 0x0a06, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 
-  0x1b28, 0x01e6, 0x01c6, 0x01e6, 0x0206, 0x0225, 0x1b68, 0x0a66, 0x01a6, 0x01a6, 0x01a6, 0x0165, 
-  0x1266, 0x1287, 0x0227, 0x01e6, 0x2268, 0x9db6, 0xb658, 0xd75c, 0xc6fb, 0xcf3c, 0xd75c, 0xcf1b, 
-  0x432b, 0x0205, 0x1328, 0x0226, 0x01c5, 0x1ae8, 0x0a47, 0x01c6, 0x1b08, 0x01c5, 0x0a66, 0x12c7, 
-  0x01a5, 0x12c8, 0x0a87, 0x1b28, 0x0205, 0x0a46, 0x12e7, 0x01c6, 0x01c6, 0x1b08, 0x0a46, 0x01e5, 
-  0x1b08, 0x01c5, 0x0a87, 0x1ae8, 0x01c5, 0x01e6, 0x12c7, 0x0a86, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e7, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01c6, 0x2a89, 0xb679, 0xd75d, 0xcf1c, 0xcedb, 0x4a8b, 0x39e9, 
-  0x6b2d, 0xb553, 0xc5f4, 0xc5d4, 0xbdb3, 0xbdb3, 0xbd93, 0xc5d4, 0xce35, 0xb593, 0x9cd1, 0x83ef, 
-  0x62cb, 0x4228, 0x39e8, 0x9cf2, 0xb594, 0xbdd5, 0xce56, 0xb593, 0x94b0, 0x9cd1, 0x31e7, 0x00e3, 
-  0x09c5, 0x0a46, 0x0a66, 0x0a46, 0x0a46, 0x0a26, 0x09e5, 0x09c5, 0x0184, 0x1a27, 0x7472, 0xae38, 
-  0xc6ba, 0xd75c, 0xd73c, 0xcefb, 0xcefb, 0xdf5d, 0xe79e, 0xc6da, 0xa657, 0x4bcd, 0x1246, 0x0a26, 
-  0x0a06, 0x1226, 0x0a27, 0x0a26, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a47, 0x0a47, 0x0a47, 
-  0x0a67, 0x0a67, 0x0a66, 0x0a46, 0x0a66, 0x1b48, 0x1b48, 0x1b48, 0x2368, 0x0a66, 0x01a6, 0x01c6, 
-  0x01e6, 0x01e6, 0x12c7, 0x1287, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 
-  0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x01e6, 0x01e6, 0x0206, 0x01e6, 0x01e6, 0x0206, 0x0226, 0x12c7, 0x12e7, 0x0a46, 0x0206, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x09e7, 0x01e6, 0x09e6, 0x01c6, 0x0206, 
-  0x1b28, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x0205, 0x1b89, 0x0aa7, 0x01e6, 0x01c6, 0x01a6, 0x0164, 
-  0x1226, 0x0a06, 0x01a5, 0x2248, 0xb638, 0xdf9d, 0xd75d, 0xcf1c, 0xd75d, 0xbeda, 0x430b, 0x3329, 
-  0x01c4, 0x0a66, 0x1b08, 0x01e6, 0x01a5, 0x1ae8, 0x0a47, 0x01e6, 0x1b08, 0x01c5, 0x0a66, 0x12c7, 
-  0x01a5, 0x12c8, 0x0a86, 0x1b28, 0x0205, 0x0a46, 0x12e8, 0x01c6, 0x01c6, 0x1b08, 0x0a66, 0x01e5, 
-  0x1b08, 0x01c5, 0x0a87, 0x1ae8, 0x01a5, 0x1ae8, 0x1287, 0x01c6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01a6, 0x09c6, 0x9575, 0xc6db, 0xdf9e, 0xd75d, 0x7c30, 0x18e3, 0x6aeb, 0x9430, 
-  0xce17, 0xce17, 0xad54, 0xad53, 0xad53, 0xbdb4, 0xc5f4, 0xbdb4, 0xbdb4, 0xc5f4, 0xce35, 0xc615, 
-  0xbdb5, 0x7b8e, 0x5a8a, 0x2124, 0x39e7, 0xad54, 0xb5b5, 0xce57, 0xce56, 0xce56, 0xb574, 0x9470, 
-  0x2124, 0x00a2, 0x0144, 0x0185, 0x01a6, 0x0185, 0x0165, 0x0165, 0x01a6, 0x0186, 0x0185, 0x0145, 
-  0x7471, 0xcf1c, 0xbe9a, 0xd73c, 0xdf5d, 0xd73c, 0xcefb, 0xcf1c, 0xd75d, 0xc6db, 0xb659, 0x2a48, 
-  0x0986, 0x0144, 0x0165, 0x01a6, 0x01a6, 0x0185, 0x0186, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x0a66, 0x2348, 0x2368, 0x12c7, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x0206, 0x12c7, 0x0a66, 0x0206, 0x0226, 0x0226, 0x0226, 0x0226, 0x0226, 0x0226, 
-  0x0226, 0x0226, 0x0226, 0x0226, 0x0226, 0x0226, 0x0226, 0x0226, 0x0226, 0x0226, 0x0226, 0x0226, 
-  0x0a26, 0x0a26, 0x0226, 0x0226, 0x0226, 0x0226, 0x0226, 0x0206, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a26, 0x0226, 0x0206, 0x0a26, 0x0a27, 0x0a27, 0x0a27, 0x0a27, 0x0a27, 0x0a27, 0x0a47, 
-  0x1b49, 0x1b29, 0x1b29, 0x1b29, 0x1b29, 0x1b28, 0x1b28, 0x1b28, 0x0206, 0x01c6, 0x01c6, 0x01e7, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x09e6, 0x01c6, 0x0206, 
-  0x1b28, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e5, 0x2369, 0x0aa7, 0x0207, 0x0a07, 0x09e7, 0x0985, 
-  0x1205, 0x11c6, 0x19c6, 0xb638, 0xdf9d, 0xcf1c, 0xcefb, 0xd75d, 0xcefb, 0x432c, 0x0102, 0x1aa7, 
-  0x01c5, 0x0a46, 0x12e7, 0x01c5, 0x01a5, 0x1ae8, 0x0a47, 0x01e6, 0x1b08, 0x01c5, 0x0a67, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a86, 0x1b28, 0x01e6, 0x0a46, 0x12e7, 0x01e5, 0x01c6, 0x1b08, 0x0a46, 0x01e5, 
-  0x1b28, 0x01c5, 0x0a67, 0x1ae8, 0x01a5, 0x1b08, 0x0a66, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e7, 
-  0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x09e7, 0x0185, 0x1a28, 0xa5d7, 0xefdf, 0xdf7d, 0xadd7, 0x7410, 0x2925, 0x7b8d, 0xc575, 0xde58, 
-  0xbd75, 0x9cd3, 0x4acd, 0x42cd, 0x3a6c, 0x7c51, 0xa553, 0xbdd4, 0xc614, 0xbdd4, 0xbdb3, 0xbdd4, 
-  0xbdd4, 0xc5f5, 0xbd94, 0x8c0f, 0x736e, 0x18c4, 0x4a49, 0xa513, 0xb5b5, 0xce36, 0xc616, 0xc615, 
-  0xbdd5, 0x7bcd, 0x10a2, 0x08c2, 0x00c2, 0x0165, 0x09e7, 0x01c6, 0x01c6, 0x01e6, 0x0a07, 0x0207, 
-  0x0a07, 0x11e7, 0x11e7, 0xa5d7, 0xbe9a, 0xbe79, 0xdf7d, 0xd75d, 0xc6fb, 0xcf3c, 0xd73c, 0xcf1b, 
-  0xae38, 0x2a69, 0x1207, 0x0124, 0x0186, 0x09c7, 0x09c6, 0x01e7, 0x01e6, 0x01e6, 0x09e6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x0206, 0x01e6, 0x01e6, 0x0a06, 0x0206, 0x09e6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e5, 0x12a7, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b09, 0x1b09, 0x1b09, 0x2309, 0x2329, 0x2329, 
-  0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x09e6, 0x01c6, 0x0206, 
-  0x1b28, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01c5, 0x1b28, 0x0a87, 0x01a5, 0x01c6, 0x01a5, 0x0123, 
-  0x2247, 0xa5f7, 0xc6db, 0xd73c, 0xcf1c, 0xd73c, 0xe7be, 0xd75d, 0x4b8d, 0x0185, 0x09c5, 0x1ae8, 
-  0x01c5, 0x0a46, 0x12e7, 0x01c6, 0x01a5, 0x1ae8, 0x0a47, 0x01e6, 0x1b28, 0x01c5, 0x0a66, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a87, 0x1b28, 0x01e6, 0x0a47, 0x12e7, 0x01c6, 0x01c6, 0x1b08, 0x0a46, 0x0205, 
-  0x1b28, 0x01e5, 0x0a87, 0x1ae8, 0x01a5, 0x1ae7, 0x0a46, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x09c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 
-  0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09c6, 0x01e6, 0x01a6, 
-  0x0144, 0x2248, 0xae58, 0xefff, 0xb618, 0x8c92, 0x39c6, 0x6b6c, 0xc5d5, 0xbd94, 0xacf3, 0x9472, 
-  0x4a6b, 0x426c, 0x5b91, 0x5370, 0x4b50, 0x3aad, 0x3a6c, 0x6bb0, 0x9d13, 0xc635, 0xc615, 0xc5f5, 
-  0xbdb4, 0xbdb4, 0xbdb4, 0xc5d4, 0xad74, 0x9492, 0x632c, 0x3165, 0x630b, 0x8c71, 0xb5b5, 0xd698, 
-  0xce57, 0xc5f5, 0xbdd4, 0x840e, 0x31a6, 0x1124, 0x00c2, 0x0165, 0x01c6, 0x01c6, 0x01e7, 0x01c7, 
-  0x0165, 0x0165, 0x0186, 0x09a6, 0x0165, 0x2a89, 0xa5f7, 0xb659, 0xdf9e, 0xcf1c, 0xcefb, 0xd75c, 
-  0xd73c, 0xd75d, 0x9db6, 0x32aa, 0x1186, 0x0103, 0x01e6, 0x0206, 0x01e6, 0x01c6, 0x01a5, 0x01a5, 
-  0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 
-  0x01c6, 0x01c6, 0x01a5, 0x01c5, 0x01c5, 0x01e5, 0x01c5, 0x01e5, 0x01c5, 0x01c5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01c5, 0x01e5, 0x01c5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e6, 0x01e6, 0x01c5, 0x01e5, 0x01e6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c7, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e7, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01c6, 0x0226, 
-  0x1b28, 0x01e5, 0x01c6, 0x01e6, 0x01c6, 0x01a5, 0x1ae7, 0x01e5, 0x438d, 0x540f, 0x5c30, 0x53ce, 
-  0x9554, 0xd75d, 0xcf1c, 0xcf1c, 0xe7be, 0xd71c, 0xa5f7, 0x6430, 0x01c5, 0x0a07, 0x01e6, 0x1ae8, 
-  0x01c5, 0x0a46, 0x12e7, 0x01c6, 0x01a5, 0x1ae8, 0x0a67, 0x01e6, 0x1b28, 0x01e5, 0x0a67, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a87, 0x1b08, 0x01e6, 0x0a46, 0x12e8, 0x01c6, 0x01c6, 0x1b08, 0x0a67, 0x0205, 
-  0x1b28, 0x01e5, 0x0a87, 0x1ae8, 0x01a5, 0x12e7, 0x0a46, 0x01c6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 
-  0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 
-  0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x0a07, 0x0185, 0x2248, 
-  0x4b6d, 0xae18, 0xefff, 0x8cd3, 0x4208, 0x630b, 0xd657, 0xc5d5, 0xbd94, 0xc5b5, 0x39e8, 0x1106, 
-  0x2a2c, 0x5bb1, 0x5390, 0x4b70, 0x4b70, 0x5390, 0x5370, 0x328d, 0x42cd, 0x7c31, 0x8472, 0xa553, 
-  0xc5f4, 0xbdd4, 0xbdb4, 0xbdd4, 0xc5d5, 0xc5f5, 0xc615, 0xb574, 0x41e7, 0x20e4, 0x62eb, 0x7bee, 
-  0x9cd2, 0xd677, 0xbdd4, 0xc5f4, 0xce36, 0x632b, 0x4207, 0x1104, 0x1227, 0x1288, 0x1288, 0x1287, 
-  0x0a47, 0x1267, 0x1287, 0x1267, 0x1267, 0x1247, 0x09c4, 0x3b4b, 0x8d94, 0xbeda, 0xe7be, 0xcf1c, 
-  0xcefb, 0xcf3c, 0xcf1c, 0xdf9d, 0x84f3, 0x4b4c, 0x12a8, 0x0246, 0x1287, 0x1287, 0x1267, 0x1267, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x12a7, 0x12a7, 
-  0x12a7, 0x1287, 0x12a7, 0x12a7, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1267, 0x1267, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x12a7, 0x12a7, 0x12a8, 0x1288, 0x12a7, 0x12a7, 0x12a7, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01c6, 0x0226, 
-  0x1b28, 0x01e5, 0x01c6, 0x01c6, 0x01c6, 0x01a5, 0x1ac8, 0x6470, 0xcf3c, 0xe79e, 0xe79e, 0xe7be, 
-  0xdf5d, 0xcf1c, 0xd73c, 0xcf3c, 0x8d34, 0x6c71, 0x01c6, 0x01e6, 0x0a07, 0x01e7, 0x0206, 0x1b08, 
-  0x01c5, 0x0a46, 0x12e7, 0x01c6, 0x01a5, 0x1ae8, 0x0a67, 0x01e6, 0x1b28, 0x01e5, 0x0a67, 0x12e7, 
-  0x01a5, 0x12e8, 0x0a87, 0x1b08, 0x01e6, 0x0a46, 0x1ae8, 0x01c6, 0x01c6, 0x1b08, 0x0a67, 0x0206, 
-  0x1b28, 0x01e5, 0x0a87, 0x12e8, 0x01a5, 0x1ae8, 0x0a46, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 
-  0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x0124, 0x1a07, 0x9db6, 
-  0xefdf, 0xefff, 0x8cb2, 0x5acb, 0xbe37, 0xdf19, 0xb593, 0xbdb4, 0xbdb4, 0xbdb4, 0x7bad, 0x6b6d, 
-  0x4aac, 0x3aad, 0x430f, 0x5391, 0x5390, 0x5390, 0x5390, 0x53b1, 0x5390, 0x3aae, 0x328d, 0x638f, 
-  0x94b2, 0xa512, 0xbdd4, 0xbdb4, 0xbdb4, 0xbdb4, 0xbdd4, 0xb533, 0xacb3, 0x6b0e, 0x39c9, 0x3166, 
-  0x3186, 0x840f, 0xc615, 0xbdd4, 0xbdd4, 0xce56, 0x7bce, 0x10c3, 0x1a06, 0x1ac7, 0x1ac7, 0x12a7, 
-  0x12a7, 0x12c7, 0x12a7, 0x12a7, 0x1287, 0x1287, 0x1287, 0x0a46, 0x0205, 0x540e, 0x84f3, 0xd73c, 
-  0xe79e, 0xcefb, 0xcf1c, 0xc71b, 0xd75d, 0xe79e, 0x95d5, 0x7511, 0x12a7, 0x0a25, 0x0a46, 0x1287, 
-  0x1ac8, 0x12c7, 0x1ac7, 0x1ac7, 0x12c7, 0x12c7, 0x1ac7, 0x1ac7, 0x1ac8, 0x1ac8, 0x1ac7, 0x1ac8, 
-  0x12c8, 0x1ac8, 0x12c7, 0x1ac8, 0x1ac7, 0x12c7, 0x12c7, 0x1ac7, 0x1ac8, 0x12a7, 0x12a7, 0x12c8, 
-  0x1ac7, 0x1ac7, 0x1ac7, 0x12a7, 0x1ac7, 0x12c7, 0x1ac7, 0x12c7, 0x1ac7, 0x12c7, 0x12c7, 0x1ac8, 
-  0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x12c7, 0x12a7, 0x12c7, 0x12c7, 0x12a7, 
-  0x1ac8, 0x1ac8, 0x12c7, 0x12c7, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 
-  0x09e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0226, 
-  0x1b28, 0x01e5, 0x01e6, 0x01c6, 0x01c6, 0x01a5, 0x1ae8, 0xb6d9, 0xcf1c, 0xcefb, 0xcf1b, 0xcefb, 
-  0xcf1c, 0xd73c, 0xd73c, 0x63ce, 0x0104, 0x0165, 0x0a07, 0x0a07, 0x0a07, 0x01e6, 0x0206, 0x1b28, 
-  0x01e5, 0x0a46, 0x12e7, 0x01c6, 0x01c5, 0x1b08, 0x0a67, 0x0206, 0x1b28, 0x01e5, 0x0a87, 0x12c7, 
-  0x01a5, 0x12c8, 0x0a87, 0x1b08, 0x01e6, 0x0a46, 0x1ae8, 0x01c6, 0x01e6, 0x1b08, 0x0a47, 0x0206, 
-  0x1b28, 0x01e5, 0x0a87, 0x1ae8, 0x01c5, 0x1ae8, 0x0a46, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0144, 0x11c6, 0x5bae, 0x9575, 0xdf7d, 
-  0xd75c, 0x8cb2, 0x5aec, 0x8431, 0x52cb, 0x632b, 0xd6b8, 0xc616, 0xbdb4, 0xbdb4, 0xc5f5, 0xce16, 
-  0xa4f2, 0x73ae, 0x4aed, 0x328c, 0x432f, 0x53b1, 0x4b70, 0x4b70, 0x5390, 0x5bd1, 0x5390, 0x42ce, 
-  0x2a0b, 0x8451, 0xc5f4, 0xbdb4, 0xbdd4, 0xbdd5, 0xacd2, 0x7b4e, 0x520b, 0x1065, 0x2107, 0x6b0d, 
-  0x62cc, 0x3987, 0x6b2c, 0xa512, 0x9cb2, 0x7b6d, 0x51a7, 0x61e8, 0x10c3, 0x01a5, 0x01c5, 0x01c5, 
-  0x01a5, 0x0185, 0x0184, 0x0184, 0x0184, 0x0184, 0x0184, 0x01c5, 0x0226, 0x01c4, 0x0163, 0x53ad, 
-  0x7cb2, 0xcf3c, 0xcf1b, 0xcf1c, 0xcf1b, 0xcf1b, 0xdf7d, 0xdf5d, 0x8d54, 0x74d2, 0x332b, 0x0a26, 
-  0x01a4, 0x01a5, 0x0184, 0x0185, 0x0185, 0x01a5, 0x01a5, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01a5, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x0226, 
-  0x1b28, 0x0205, 0x01e6, 0x09e7, 0x01e6, 0x01e5, 0x2328, 0xbeda, 0xd77d, 0xcf1c, 0xcf1c, 0xcf1c, 
-  0xcf1c, 0xd73c, 0xd75c, 0x7cb2, 0x0944, 0x09a5, 0x01a5, 0x01a6, 0x01e6, 0x01e6, 0x0206, 0x1b28, 
-  0x01e5, 0x0a46, 0x12e7, 0x01c6, 0x01c5, 0x1ae8, 0x0a67, 0x0206, 0x1b28, 0x01e5, 0x0a86, 0x12c7, 
-  0x01a5, 0x12c8, 0x0a86, 0x1b28, 0x0206, 0x0a46, 0x1ae8, 0x01c6, 0x01e6, 0x1b08, 0x0a66, 0x0205, 
-  0x1b28, 0x01e5, 0x0a87, 0x1ae8, 0x01c5, 0x1ae8, 0x0a46, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0207, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0207, 0x01c6, 0x1a68, 0x8d54, 0x9db6, 0xdf7d, 0xd73c, 0xcefb, 
-  0xdf7d, 0x4249, 0x8431, 0x4a8a, 0x6baf, 0x5aec, 0x4207, 0x83ee, 0xce15, 0xbd93, 0xbdb4, 0xbdb4, 
-  0xc5d5, 0xc5f5, 0xa532, 0x8471, 0x5b4e, 0x3acd, 0x4b50, 0x53b1, 0x53b1, 0x53b1, 0x53b1, 0x5bb0, 
-  0x7c31, 0xad53, 0xbdd4, 0xc5d4, 0xbd94, 0x9c50, 0x6aac, 0x1864, 0x18e7, 0x2169, 0x2148, 0x18c5, 
-  0x2925, 0x18a3, 0x3147, 0x8bcf, 0x6a6b, 0x69c9, 0x8a8b, 0x8a8b, 0x1903, 0x1ac7, 0x1ae7, 0x1ac7, 
-  0x1ac7, 0x12c7, 0x1ac7, 0x1ac8, 0x1ac8, 0x1ac7, 0x1ac8, 0x1ae8, 0x1b49, 0x2349, 0x2349, 0x12a7, 
-  0x12a7, 0x7d12, 0xcf3c, 0xcf1b, 0xcf1c, 0xd73c, 0xcf1b, 0xcf1c, 0xe79e, 0xdf9d, 0xbeda, 0x8573, 
-  0x22e8, 0x0205, 0x1287, 0x12c8, 0x1ac8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ae8, 0x1ae7, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae7, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ac8, 0x12c8, 0x1ac8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ac8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x22e8, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x01c6, 0x0226, 
-  0x1b28, 0x0206, 0x01e6, 0x09e7, 0x09e6, 0x0206, 0x2349, 0x3b8c, 0x5bcf, 0xc6fb, 0xcf1b, 0xcf1c, 
-  0xcf1c, 0xcf1c, 0xd73c, 0xdf7d, 0x9534, 0x0985, 0x0144, 0x0164, 0x01a5, 0x01c6, 0x0206, 0x1b28, 
-  0x0206, 0x0a46, 0x12e8, 0x01c6, 0x01c5, 0x1ae8, 0x0a67, 0x0206, 0x1b28, 0x01e6, 0x0a87, 0x12c7, 
-  0x01a5, 0x12c8, 0x0a86, 0x1b28, 0x0206, 0x0a47, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0205, 
-  0x1b28, 0x01e5, 0x0a87, 0x1ae8, 0x01c5, 0x1ae8, 0x0a46, 0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x0207, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01a6, 0x0144, 0x84f2, 0xefdf, 0xd75d, 0xcefb, 0xcefb, 0xdf9e, 
-  0x73ef, 0x73af, 0x73b1, 0xa576, 0xd73d, 0xb639, 0x84b3, 0x5b2c, 0x39c6, 0x9490, 0xc616, 0xbdd5, 
-  0xc5f5, 0xbdd4, 0xbdd4, 0xc615, 0xad53, 0x8471, 0x42ad, 0x3aae, 0x42ce, 0x4b2f, 0x6bf0, 0xad94, 
-  0xbdf5, 0xbdd5, 0xbdb5, 0xacd2, 0x8bef, 0x4189, 0x18a6, 0x2148, 0x29eb, 0x320b, 0x320b, 0x2189, 
-  0x2148, 0x1906, 0x1064, 0x49a8, 0x7a4b, 0x8a6b, 0x8a6a, 0x8a6a, 0x18c2, 0x0a05, 0x0a45, 0x0a25, 
-  0x0a05, 0x0a26, 0x0a26, 0x0a46, 0x0a26, 0x0a26, 0x0a26, 0x0a46, 0x0a87, 0x0aa7, 0x12a8, 0x0a26, 
-  0x1a88, 0xae58, 0xd73c, 0xcf1c, 0xcf1c, 0xcf1c, 0xd75d, 0xd75d, 0xcf1b, 0xcefb, 0xd73c, 0xd75c, 
-  0xae58, 0xa637, 0x3b6b, 0x09e5, 0x0a26, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a26, 0x0a26, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a26, 0x0a46, 0x0a47, 0x0a46, 0x0a47, 0x0a47, 0x0a47, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x01e6, 0x0226, 
-  0x1b08, 0x01e5, 0x01c6, 0x09e7, 0x01e6, 0x0226, 0x1b28, 0x0205, 0x01a6, 0x1a07, 0x53ae, 0xc6fb, 
-  0xc6fb, 0xd75d, 0xd75d, 0xdf5d, 0xcefb, 0x11c6, 0x09c4, 0x1ac7, 0x1266, 0x01c5, 0x0206, 0x1b28, 
-  0x0206, 0x0a46, 0x12e8, 0x01e6, 0x01c5, 0x1b08, 0x0a67, 0x0206, 0x1b28, 0x01e6, 0x0a87, 0x12c7, 
-  0x01a5, 0x12c8, 0x0a86, 0x1b28, 0x0206, 0x0a47, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a67, 0x0206, 
-  0x1b28, 0x01e5, 0x0a87, 0x1ae8, 0x01c5, 0x1ae8, 0x0a46, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e6, 0x0207, 0x0207, 0x0206, 0x0206, 0x0207, 0x0207, 0x0207, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x0165, 0x6c71, 0xb659, 0xcefb, 0xd71c, 0xcefb, 0xd75c, 0xdf7d, 0x73ef, 
-  0x4a8b, 0x6b70, 0x9536, 0xc71d, 0xbebc, 0xb69b, 0xb6dc, 0x7cf5, 0x4b2e, 0x3a4a, 0x31e7, 0x9cf2, 
-  0xb594, 0xbdd4, 0xbdd4, 0xb5b3, 0xbdd4, 0xbdd4, 0xa553, 0x73cf, 0x73cf, 0xad53, 0xb573, 0xbdd4, 
-  0xbdd4, 0xb573, 0x8bae, 0x49c8, 0x28e6, 0x0024, 0x10e7, 0x3a4c, 0x320b, 0x29eb, 0x29eb, 0x320b, 
-  0x2a0b, 0x2989, 0x0823, 0x4106, 0x8a6b, 0x824a, 0x8a4a, 0x928b, 0x20e3, 0x01c4, 0x01c5, 0x01c5, 
-  0x01e5, 0x01e5, 0x01e5, 0x0205, 0x0205, 0x0205, 0x01e5, 0x01c5, 0x01c5, 0x01c5, 0x01e5, 0x1a68, 
-  0x7cb2, 0xdf7d, 0xd73c, 0xcf1c, 0xcf3c, 0xd75d, 0xb679, 0xae78, 0xd73c, 0xdf5d, 0xd73c, 0xcf1c, 
-  0xd73c, 0xdf7d, 0xbe9a, 0x9d96, 0x1a47, 0x09e5, 0x01a4, 0x01c4, 0x0205, 0x0225, 0x0205, 0x01e5, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e5, 0x01e5, 0x0205, 0x01e5, 0x01e5, 0x01e6, 0x0206, 0x01e6, 0x01e6, 0x0206, 0x0206, 
-  0x0206, 0x01e6, 0x01e5, 0x01e5, 0x01e5, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 
-  0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x01e6, 0x0206, 0x0206, 0x0206, 0x0a06, 0x0a26, 0x0a06, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 
-  0x1ae8, 0x01e6, 0x01e6, 0x0a07, 0x0206, 0x0225, 0x2348, 0x1267, 0x01c6, 0x0185, 0x09c6, 0x11c6, 
-  0x7d13, 0xc6fa, 0xb699, 0x9dd6, 0x2ac9, 0x1aa7, 0x1ae7, 0x1aa6, 0x1b27, 0x1266, 0x01e6, 0x1b28, 
-  0x0205, 0x0a46, 0x1308, 0x01c6, 0x01c5, 0x1b08, 0x0a67, 0x0206, 0x1b28, 0x01e5, 0x0a87, 0x12c7, 
-  0x01a5, 0x12c8, 0x0a87, 0x1b28, 0x0206, 0x0a47, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x1b28, 0x01e5, 0x0a87, 0x1ae8, 0x01c5, 0x1ae8, 0x0a46, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e7, 0x01e6, 0x0206, 0x0206, 0x0206, 0x0206, 0x0207, 0x0207, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x0185, 0x6c50, 0xd75d, 0xd75c, 0xcf1c, 0xcf1b, 0xdf5d, 0xd71c, 0x7410, 0x4228, 
-  0x73d1, 0x6390, 0xbebb, 0xbedc, 0xae3a, 0x8d57, 0x4b50, 0x4b70, 0x42ef, 0x3aae, 0x324c, 0x2125, 
-  0x39e7, 0x738c, 0xa512, 0xc635, 0xbdd4, 0xbdb4, 0xbdd4, 0xb593, 0xb593, 0xbdd4, 0xbdf4, 0xbdb4, 
-  0xbd94, 0x730c, 0x28e4, 0x1084, 0x20e6, 0x41a9, 0x10c6, 0x322c, 0x2a0b, 0x320c, 0x322c, 0x29ca, 
-  0x10a4, 0x3105, 0x7a4a, 0x7a4a, 0x824a, 0x824a, 0x824a, 0x8a6a, 0x20c2, 0x22c7, 0x22e8, 0x22e8, 
-  0x1b08, 0x2328, 0x2329, 0x2349, 0x2349, 0x2349, 0x1b29, 0x1ae8, 0x1aa7, 0x22e9, 0x438b, 0xbeda, 
-  0xdf7d, 0xcf3c, 0xcf1c, 0xd77d, 0xc6fb, 0xb678, 0x336b, 0x1ac8, 0xae38, 0xbe79, 0xbeba, 0xd77d, 
-  0xcf3c, 0xcefb, 0xd75d, 0xdf5d, 0xcf1c, 0x9df6, 0x3bab, 0x440c, 0x2b69, 0x12c7, 0x1b28, 0x2328, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x2328, 0x2328, 0x2328, 0x2328, 0x2328, 0x2328, 0x1b28, 0x1b28, 
-  0x1b28, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 0x1b28, 0x1b28, 0x1b08, 0x2328, 0x2328, 0x2328, 
-  0x2328, 0x2328, 0x2329, 0x2329, 0x2329, 0x2329, 0x2328, 0x2328, 0x1b28, 0x2328, 0x2328, 0x2329, 
-  0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2309, 0x2329, 0x2329, 0x2329, 0x2329, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0a46, 0x1b08, 
-  0x0a26, 0x01e6, 0x09c6, 0x09e7, 0x0206, 0x0a86, 0x1b28, 0x0a26, 0x01c6, 0x09e6, 0x01c6, 0x0205, 
-  0x2b49, 0x1a88, 0x09e6, 0x09e6, 0x01e5, 0x2368, 0x1b07, 0x0a25, 0x1b27, 0x1287, 0x01c5, 0x1b08, 
-  0x0205, 0x0a66, 0x12e8, 0x01c6, 0x01c6, 0x1b08, 0x0a67, 0x0206, 0x1b28, 0x01e5, 0x0a87, 0x12c7, 
-  0x01a5, 0x12c8, 0x0a87, 0x1b28, 0x0206, 0x0a46, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0226, 
-  0x1b28, 0x01e5, 0x0a87, 0x1ae8, 0x01c5, 0x1ae8, 0x0a46, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e7, 0x0206, 0x0207, 0x0207, 0x0207, 0x0207, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 
-  0x01e6, 0x01a5, 0x7471, 0xd77d, 0xcf1b, 0xc6fb, 0xd75c, 0xdf7d, 0xbe79, 0x328a, 0x0104, 0x5b0c, 
-  0x7c33, 0xa5d9, 0xa619, 0x8516, 0x3ace, 0x328d, 0x3aad, 0x328d, 0x3aae, 0x3aae, 0x3ace, 0x3aad, 
-  0x324c, 0x10c4, 0x3a08, 0x9490, 0xad53, 0xce56, 0xc636, 0xbdd4, 0xbdd4, 0xb553, 0xa4f1, 0x7b6d, 
-  0x49a7, 0x2905, 0x2988, 0x320b, 0x2948, 0x49a9, 0x10a5, 0x320b, 0x322c, 0x29cb, 0x2169, 0x3168, 
-  0x6a09, 0x7a29, 0x7a2a, 0x822a, 0x7a2a, 0x822a, 0x8a4a, 0x7a29, 0x20c3, 0x00e2, 0x01c5, 0x01c5, 
-  0x01e5, 0x01c5, 0x01c5, 0x01c5, 0x01e5, 0x0206, 0x0226, 0x01c5, 0x0984, 0x8533, 0xcf5c, 0xcf1b, 
-  0xcf1c, 0xcf1c, 0xdf9d, 0xcf1c, 0x53ae, 0x01a5, 0x0206, 0x0206, 0x0a06, 0x01a5, 0x32aa, 0xa5d7, 
-  0xbe9a, 0xdf7d, 0xcf1c, 0xcf1c, 0xd73c, 0xd73c, 0xcf1c, 0xd75c, 0x7cf2, 0x3b0a, 0x01c5, 0x0143, 
-  0x0163, 0x01a5, 0x01a4, 0x01a4, 0x01c5, 0x01c5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01c5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01c5, 0x01c5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x0206, 0x0206, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01c6, 0x0a46, 0x1ae8, 0x0a26, 
-  0x01e6, 0x09c6, 0x09e6, 0x01e6, 0x0a66, 0x1b08, 0x0a46, 0x01c6, 0x09e6, 0x01e6, 0x0a26, 0x1ae8, 
-  0x0a47, 0x01c6, 0x01e6, 0x01c6, 0x0a06, 0x1ae8, 0x1b27, 0x2388, 0x2348, 0x0a26, 0x01e5, 0x1b08, 
-  0x0205, 0x0a66, 0x12e7, 0x01c5, 0x01c5, 0x12e8, 0x0a67, 0x0206, 0x1b28, 0x01e5, 0x0a87, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a87, 0x1b08, 0x0206, 0x0a46, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x1b28, 0x01e5, 0x1287, 0x1ae8, 0x01c5, 0x1ae8, 0x0a67, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x09c6, 0x09e7, 0x0164, 
-  0x0164, 0x6c71, 0xdf7d, 0xcf1b, 0xc6fb, 0xdf7d, 0xae18, 0x84f3, 0x19c6, 0x19c6, 0x6bef, 0x7390, 
-  0x6bb1, 0x9577, 0x42ee, 0x2a2c, 0x328d, 0x3a8e, 0x3aae, 0x3aae, 0x3aae, 0x3aae, 0x3aae, 0x3aad, 
-  0x3a8d, 0x3ace, 0x2a0a, 0x10c4, 0x52cb, 0x8c4f, 0x840e, 0xb594, 0xb553, 0x732c, 0x28e4, 0x18a4, 
-  0x0883, 0x29c9, 0x3a2c, 0x29eb, 0x2948, 0x49a9, 0x10a5, 0x322c, 0x2189, 0x2107, 0x3907, 0x724a, 
-  0x7a4a, 0x7a09, 0x7a29, 0x822a, 0x822a, 0x824a, 0x69c8, 0x8b4e, 0x8c10, 0x08e2, 0x1aa7, 0x1308, 
-  0x12e8, 0x12e8, 0x12c7, 0x12a7, 0x12a7, 0x12a7, 0x0245, 0x1246, 0x84f3, 0xd75c, 0xcf1b, 0xc6fb, 
-  0xcf3c, 0xcf3c, 0xa637, 0x5c6f, 0x0a66, 0x12c7, 0x12a7, 0x12a7, 0x0a87, 0x0a66, 0x0a26, 0x01c4, 
-  0x53ee, 0x9df6, 0xcf1c, 0xe79e, 0xcf1b, 0xcf1c, 0xd73c, 0xd73c, 0xdf7d, 0xdf7d, 0x6c30, 0x4b2c, 
-  0x3aeb, 0x01a4, 0x0a26, 0x1287, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x1287, 0x1287, 0x1287, 0x1287, 0x12a7, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x12a7, 0x12a7, 0x12a8, 0x12a8, 0x1aa8, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0a46, 0x12c8, 0x0206, 0x01c6, 
-  0x09c6, 0x09e6, 0x01e6, 0x0a46, 0x1ae8, 0x0a26, 0x01c6, 0x0a07, 0x01e6, 0x0a26, 0x1b08, 0x1267, 
-  0x01e6, 0x0a06, 0x09e6, 0x01e6, 0x01c6, 0x01a5, 0x0a66, 0x2348, 0x0a26, 0x01c6, 0x01e6, 0x1b28, 
-  0x0205, 0x0a46, 0x12e7, 0x01c6, 0x01c5, 0x12e8, 0x0a67, 0x0206, 0x1b28, 0x01e6, 0x0a87, 0x12c7, 
-  0x01a5, 0x12c8, 0x0a87, 0x1b28, 0x0206, 0x0a66, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a67, 0x0206, 
-  0x2328, 0x01e5, 0x12a7, 0x1ae8, 0x01a5, 0x1ae8, 0x0a46, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x0207, 0x0207, 0x0206, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x09e6, 0x0165, 0x0124, 0x432c, 
-  0x6c30, 0xd73c, 0xd73c, 0xcf1b, 0xdf9d, 0xa5d6, 0x2228, 0x0124, 0x0944, 0x1924, 0x31c8, 0x3a6c, 
-  0x5350, 0x2a2c, 0x3a8d, 0x3a8d, 0x328d, 0x328d, 0x3aad, 0x3aae, 0x3aae, 0x3aae, 0x3aad, 0x3a8d, 
-  0x3a8d, 0x3aad, 0x3aae, 0x42ef, 0x322b, 0x1926, 0x1946, 0xa512, 0x7b4d, 0x3126, 0x10c4, 0x2147, 
-  0x320b, 0x29eb, 0x320b, 0x29eb, 0x2948, 0x49c8, 0x1085, 0x1947, 0x20c4, 0x61c8, 0x826b, 0x7a4a, 
-  0x7a4a, 0x826a, 0x826b, 0x826b, 0x826b, 0x59a8, 0x3126, 0x62ed, 0x6b4e, 0x08c2, 0x22e8, 0x1b49, 
-  0x1b49, 0x1b69, 0x1b69, 0x1b49, 0x12c7, 0x1ac8, 0x5c8f, 0x9dd6, 0xdf7d, 0xcf1c, 0xcf1b, 0xd77d, 
-  0xcf3c, 0x5c2f, 0x0a86, 0x12e7, 0x1b29, 0x1b08, 0x1b08, 0x1b08, 0x1ac8, 0x12a7, 0x12a7, 0x1aa8, 
-  0x12a7, 0x0266, 0x6450, 0x8d34, 0xdf5d, 0xe7be, 0xd73c, 0xd71c, 0xd71c, 0xd73c, 0xdf7d, 0xe7be, 
-  0xc6fb, 0x43cc, 0x22a8, 0x0a45, 0x1ae8, 0x2328, 0x1ae8, 0x1ac7, 0x1ac7, 0x1ac7, 0x1ac7, 0x1ac7, 
-  0x12c7, 0x1ac7, 0x12c7, 0x12c8, 0x12e8, 0x1ac8, 0x1ac8, 0x12c8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 
-  0x1ac8, 0x1ac8, 0x12c8, 0x12c8, 0x12c8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 
-  0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0a67, 0x1ae8, 0x0206, 0x01e6, 0x09c6, 
-  0x09e7, 0x01e6, 0x0a46, 0x1ae8, 0x0a26, 0x01a6, 0x09c6, 0x01e6, 0x0226, 0x1ae8, 0x1287, 0x01e6, 
-  0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01a5, 0x1287, 0x12e7, 0x01c5, 0x01e6, 0x01e6, 0x1b28, 
-  0x0206, 0x0a46, 0x12e7, 0x01c6, 0x01c5, 0x1ae8, 0x0a47, 0x01e6, 0x1b28, 0x01e5, 0x0a87, 0x12c7, 
-  0x01a5, 0x12c8, 0x0a87, 0x1b28, 0x0206, 0x0a66, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x2329, 0x01e5, 0x1287, 0x1ae8, 0x01a5, 0x1ae8, 0x0a46, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x0a07, 0x0185, 0x538e, 0x7cf3, 0xc6fb, 
-  0xd77d, 0xcf1b, 0xc6fb, 0xdf7d, 0xadf7, 0x1a28, 0x0985, 0x00a2, 0x0041, 0x632c, 0x4228, 0x10c5, 
-  0x324d, 0x3ace, 0x3a8d, 0x3a8d, 0x3aae, 0x3aad, 0x3aad, 0x3aad, 0x3a8d, 0x3a8e, 0x3a8d, 0x3a8d, 
-  0x3a8d, 0x3aae, 0x3aae, 0x3a8d, 0x3aae, 0x3aae, 0x42ee, 0xb595, 0x628a, 0x18c5, 0x3a2c, 0x29eb, 
-  0x29ea, 0x29eb, 0x29eb, 0x29ca, 0x2927, 0x4187, 0x1883, 0x4967, 0x69e9, 0x824a, 0x7a09, 0x824a, 
-  0x722a, 0x4126, 0x3905, 0x59e9, 0x82cd, 0x28c5, 0x39c9, 0x39ca, 0x39c9, 0x0041, 0x0124, 0x0164, 
-  0x0184, 0x01e5, 0x0247, 0x0206, 0x11e6, 0x8513, 0xd75d, 0xd73c, 0xcf1c, 0xd73c, 0xd75c, 0x6c70, 
-  0x436c, 0x0163, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01a5, 0x01a5, 0x01c5, 
-  0x01e6, 0x01e6, 0x0184, 0x01a5, 0x53ce, 0x7cd2, 0xdf7d, 0xdf5d, 0xd73c, 0xcf1c, 0xcf1c, 0xcf1c, 
-  0xcefb, 0xd73c, 0xa5f7, 0x7cb2, 0x1a88, 0x0184, 0x01e5, 0x01a5, 0x0184, 0x0185, 0x0185, 0x01a5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01a5, 0x01a5, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0a47, 0x1b28, 0x0a26, 0x01c6, 0x09e6, 0x09e6, 
-  0x01e6, 0x0a46, 0x1b08, 0x0a26, 0x01a6, 0x09c6, 0x01c6, 0x0226, 0x1b08, 0x1287, 0x01e5, 0x0a06, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x1287, 0x1b08, 0x01c5, 0x01e6, 0x01e6, 0x1b28, 
-  0x0206, 0x0a46, 0x1308, 0x01c5, 0x01c5, 0x1ae8, 0x0a67, 0x01e6, 0x1b28, 0x01e5, 0x0a67, 0x12c7, 
-  0x01a5, 0x12c8, 0x0a86, 0x1b28, 0x0206, 0x0a66, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x2328, 0x01e5, 0x1287, 0x1ae8, 0x01a5, 0x1ae8, 0x0a46, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0a07, 0x01a5, 0x538d, 0xcf1c, 0xdf9d, 0xcefc, 
-  0xcefb, 0xcf1b, 0xdf9e, 0x9db6, 0x19a6, 0x00e3, 0x1104, 0x6b6d, 0x840f, 0xc616, 0xbdb4, 0x39c7, 
-  0x0022, 0x10e6, 0x3a8e, 0x3acf, 0x3aae, 0x3aae, 0x3aad, 0x3aae, 0x3a8e, 0x3a8e, 0x3aad, 0x3aad, 
-  0x3a8e, 0x3aae, 0x3a8e, 0x3a8d, 0x3a8d, 0x2a4d, 0x6bcf, 0xa4d2, 0x626a, 0x10a5, 0x320b, 0x29eb, 
-  0x29eb, 0x29eb, 0x29eb, 0x21a9, 0x20e6, 0x61e9, 0x61c8, 0x826b, 0x7a2a, 0x7a29, 0x7a29, 0x7a6b, 
-  0x30c4, 0x0000, 0x0000, 0x1863, 0x624b, 0x4188, 0x422a, 0x5aed, 0x2125, 0x11a5, 0x1226, 0x1267, 
-  0x1aa7, 0x1ae8, 0x12c7, 0x1aa8, 0x9d96, 0xd77d, 0xc6fb, 0xcf1c, 0xcf1c, 0xdf7d, 0x7d32, 0x1286, 
-  0x0a86, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ac8, 0x1ae8, 0x1b08, 0x0aa6, 0x22e8, 0x5c6f, 0x4bed, 0x9db6, 0xdf7e, 0xcf1c, 0xcf1c, 
-  0xcf1b, 0xcf1c, 0xd75d, 0xe7bf, 0xae17, 0x8d54, 0x2ae9, 0x0a25, 0x1aa7, 0x1ac7, 0x1ac8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 0x1ae8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ae8, 0x1ac8, 
-  0x1ac8, 0x1ac8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ac8, 0x1ae8, 0x1ae8, 
-  0x1ac8, 0x1ac8, 0x1ac8, 0x1ae8, 0x1ae8, 0x1ac8, 0x1ae8, 0x1ae8, 0x1ae8, 0x22e9, 0x22e8, 0x22e8, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x0206, 0x01e6, 0x01e6, 0x01e6, 0x0a46, 0x1ac8, 0x0a26, 0x01c6, 0x09e6, 0x09e6, 0x01e6, 
-  0x0a46, 0x1ae8, 0x0a46, 0x01a6, 0x09c6, 0x01c6, 0x0205, 0x12e8, 0x1287, 0x01e6, 0x0206, 0x01e6, 
-  0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x1287, 0x1b07, 0x01e5, 0x01e6, 0x01e6, 0x1b28, 
-  0x0206, 0x0a46, 0x12e8, 0x01c5, 0x01a5, 0x1ae7, 0x0a67, 0x01e6, 0x1b28, 0x01e5, 0x1267, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a86, 0x1b28, 0x0206, 0x0a66, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x2329, 0x01e5, 0x1287, 0x1ae8, 0x01a5, 0x1b08, 0x0a46, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01a6, 0x0165, 0x4b4d, 0xd71c, 0xd73d, 0xcefb, 0xd73c, 
-  0xdf7d, 0xae38, 0x436d, 0x2228, 0x0020, 0x4249, 0x94b1, 0xc5f5, 0xc615, 0xb593, 0xbdb3, 0xa512, 
-  0x8c50, 0x736e, 0x2147, 0x1107, 0x3a8d, 0x3aae, 0x3aae, 0x3aae, 0x3a8d, 0x3a8d, 0x3a8d, 0x3a8d, 
-  0x3a8e, 0x3aae, 0x3a8e, 0x328d, 0x3aae, 0x2a0b, 0x8c50, 0x832d, 0x2905, 0x29a9, 0x320b, 0x320b, 
-  0x320b, 0x29ea, 0x29ca, 0x0884, 0x20c4, 0x7a4b, 0x822a, 0x7a09, 0x7a29, 0x7a29, 0x7a2a, 0x3905, 
-  0x0801, 0x18c4, 0x18a3, 0x0000, 0x1883, 0x20c4, 0x1925, 0x19a6, 0x0143, 0x09e5, 0x09e5, 0x09e5, 
-  0x09e5, 0x09c5, 0x8533, 0xb658, 0xd75d, 0xcf1c, 0xcf1c, 0xcf1c, 0xd75d, 0x6c50, 0x09e5, 0x0a66, 
-  0x1287, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a46, 0x0a46, 0x0a67, 0x0a67, 0x0a67, 
-  0x0a67, 0x0a66, 0x0a66, 0x0a66, 0x1266, 0x0a45, 0x0204, 0x0204, 0x22c8, 0x3b6b, 0xa617, 0xd73c, 
-  0xcf1c, 0xd73c, 0xd73c, 0xcf1c, 0xdf7d, 0xe79e, 0xae38, 0x8d54, 0x11c5, 0x09e5, 0x0a66, 0x0a66, 
-  0x0a66, 0x1266, 0x1246, 0x0a46, 0x1246, 0x0a46, 0x0a46, 0x0a46, 0x0a47, 0x0a66, 0x0a66, 0x0a46, 
-  0x0a46, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a67, 0x0a67, 0x0a67, 0x0a47, 0x0a67, 0x0a67, 
-  0x1247, 0x0a47, 0x0a47, 0x1247, 0x1247, 0x1247, 0x1247, 0x1247, 0x1267, 0x1267, 0x1267, 0x1267, 
-  0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1ac8, 0x0a06, 0x01c6, 0x09c6, 0x09e6, 0x01c6, 0x0a26, 
-  0x1ae8, 0x0a26, 0x01c6, 0x09e6, 0x01c6, 0x0205, 0x1ae8, 0x0a67, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01a6, 0x1287, 0x1ae7, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 
-  0x0206, 0x0a66, 0x1ae8, 0x01a5, 0x01a5, 0x1ae7, 0x0a66, 0x01e6, 0x1b28, 0x01e5, 0x1267, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a86, 0x1b28, 0x0206, 0x0a46, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a47, 0x0206, 
-  0x2328, 0x01c5, 0x1287, 0x1ae8, 0x01a5, 0x1ae8, 0x0a67, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01a6, 0x0185, 0x0944, 0x3acb, 0xcefb, 0xd73c, 0xcefb, 0xdf7d, 0xd73c, 
-  0x53ee, 0x2289, 0x00e3, 0x0082, 0x6b6c, 0xbdd5, 0xc5f5, 0xbdb4, 0xbdb3, 0xbdb4, 0xa512, 0xad32, 
-  0xce15, 0xbdd5, 0x9470, 0x6b4e, 0x1906, 0x1907, 0x324c, 0x326d, 0x3aae, 0x3aad, 0x3a8d, 0x3a8e, 
-  0x3a8d, 0x3a8e, 0x3a8e, 0x3aae, 0x326d, 0x7c10, 0xacd2, 0x6a4a, 0x1083, 0x29eb, 0x320b, 0x322c, 
-  0x322c, 0x1906, 0x0862, 0x51c9, 0x59e9, 0x4147, 0x822a, 0x7a2a, 0x7a29, 0x824a, 0x30e4, 0x0000, 
-  0x1083, 0x18c5, 0x18c5, 0x1083, 0x0822, 0x10e4, 0x2288, 0x1ae8, 0x1b08, 0x1ac7, 0x1267, 0x1225, 
-  0x22a8, 0x8d34, 0xd73c, 0xd75d, 0xcefb, 0xd73c, 0xcf3c, 0xcf1c, 0x7d53, 0x1287, 0x1ac7, 0x1ae8, 
-  0x1b08, 0x2328, 0x2308, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x2329, 0x2349, 0x2349, 0x1b08, 0x2b6a, 0x4c0d, 
-  0xbe9a, 0xcefb, 0xd73c, 0xdf7d, 0xcf1c, 0xcefb, 0xd75d, 0xcf1c, 0xae17, 0x9574, 0x2b69, 0x2b69, 
-  0x1ae8, 0x1287, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ae8, 0x1ae8, 0x1ae8, 0x2308, 0x2308, 0x22e8, 
-  0x22e8, 0x2308, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x22e8, 0x22e8, 0x22e8, 0x22e8, 0x22e8, 0x22e8, 0x22e8, 0x22e8, 0x22e9, 0x22e9, 
-  0x01e5, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e5, 0x01e5, 0x01e6, 0x01e5, 0x01e5, 0x01e5, 0x01a5, 0x01a6, 0x01a6, 0x01c5, 0x0a26, 0x1ae8, 
-  0x0a46, 0x01c6, 0x09e6, 0x01e6, 0x0206, 0x1ae8, 0x0a67, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x1287, 0x12e7, 0x01c5, 0x01e6, 0x01e6, 0x1b08, 
-  0x0206, 0x0a46, 0x1ae8, 0x01c5, 0x01a5, 0x1ae7, 0x0a47, 0x01e6, 0x1b28, 0x01e5, 0x1267, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a86, 0x1b28, 0x0206, 0x0a46, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a47, 0x0206, 
-  0x2328, 0x01c5, 0x1287, 0x1ae8, 0x01a5, 0x1b08, 0x0a66, 0x01c6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e7, 0x01a6, 0x1228, 0x32ca, 0xb658, 0xbe9a, 0xcf1c, 0xc6db, 0xd75d, 0xcefb, 0x5bae, 
-  0x0965, 0x1165, 0x2945, 0x632b, 0xbdd5, 0xbdb4, 0xb593, 0xbdb4, 0xbd94, 0xa4d2, 0x9cb1, 0xbdb4, 
-  0xbdb4, 0xbdd4, 0xc5f5, 0xbd94, 0x83ef, 0x62ec, 0x10a3, 0x2168, 0x2a0b, 0x326d, 0x42ef, 0x3acf, 
-  0x3a8d, 0x3a8d, 0x3a8e, 0x3aae, 0x2a4c, 0x8c71, 0xa410, 0x20c5, 0x2168, 0x320b, 0x31eb, 0x29ea, 
-  0x2947, 0x51c9, 0x724a, 0x6a0a, 0x620b, 0x3927, 0x824a, 0x822a, 0x822a, 0x6a09, 0x1061, 0x0000, 
-  0x0021, 0x3187, 0x6b4e, 0x31a8, 0x0842, 0x1125, 0x1248, 0x0a27, 0x0206, 0x01a5, 0x09c5, 0x19a5, 
-  0x84f3, 0xd79d, 0xcefb, 0xcefb, 0xdf5d, 0xd75d, 0x8d54, 0x1a47, 0x0a06, 0x01a4, 0x01c5, 0x01c5, 
-  0x01e5, 0x0205, 0x0205, 0x01e6, 0x01e6, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x0205, 0x0205, 0x0205, 0x0205, 0x0206, 0x0206, 0x0206, 0x0206, 0x0a06, 0x09e5, 0x0184, 0x01a4, 
-  0x1227, 0x2288, 0x7cb2, 0xbe59, 0xcedb, 0xcf3c, 0xc6db, 0xcefb, 0xdf7d, 0xdf5d, 0xcefb, 0xcf3c, 
-  0x6c70, 0x1a06, 0x0964, 0x0103, 0x09c5, 0x09c5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x09e5, 0x09e5, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x0a06, 0x0a06, 0x09e6, 0x09e6, 0x09e6, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a47, 0x0a47, 0x0a67, 0x0a66, 0x1ae8, 0x0a46, 
-  0x01c6, 0x09c6, 0x01c6, 0x0205, 0x1ac7, 0x0a66, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01c6, 0x0a67, 0x1ae7, 0x01c6, 0x09e6, 0x01e6, 0x1b08, 
-  0x0206, 0x0a66, 0x1ae8, 0x01a5, 0x01a5, 0x1ae8, 0x0a46, 0x01e6, 0x1b28, 0x01e5, 0x1267, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a86, 0x1b28, 0x0206, 0x0a46, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a46, 0x0206, 
-  0x2328, 0x01e5, 0x1287, 0x1ae8, 0x01a5, 0x1ae8, 0x0a67, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x0a27, 0x01c6, 0x32ca, 0xb679, 0xcf1c, 0xcf3c, 0xcf1c, 0xcf1c, 0xdf9e, 0xb659, 0x32aa, 0x0186, 
-  0x1186, 0x634c, 0xc5f6, 0xbdd5, 0xbdb4, 0xbd94, 0xbdb4, 0xad33, 0xa4d2, 0xa4d2, 0xbdd4, 0xbdd4, 
-  0xbdb4, 0xbdb4, 0xbdb4, 0xbdb4, 0xbdb4, 0xad53, 0x9cd2, 0x6b2d, 0x2966, 0x29ca, 0x21ca, 0x21aa, 
-  0x3aae, 0x3a8e, 0x3a8d, 0x328e, 0x4b0e, 0x8c50, 0x730d, 0x18c6, 0x2189, 0x2168, 0x2147, 0x18a3, 
-  0x59e9, 0x828c, 0x722b, 0x5989, 0x620b, 0x4128, 0x7a2a, 0x7a2a, 0x8a8b, 0x30e4, 0x0000, 0x0020, 
-  0x10a4, 0x5acb, 0x8410, 0x2987, 0x0021, 0x0944, 0x12a8, 0x12c8, 0x12e8, 0x1287, 0x7491, 0xc6fb, 
-  0xc6db, 0xc6fb, 0xc6fb, 0xcf3c, 0xa637, 0x8553, 0x1267, 0x12a7, 0x0a86, 0x0a46, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a26, 0x0a26, 0x0a06, 0x0a26, 
-  0x0a66, 0x0a87, 0x1287, 0x11e5, 0x53ad, 0xc6da, 0xdf7d, 0xd75d, 0xcefb, 0xcefc, 0xd73c, 0xd73d, 
-  0xcf1b, 0xcefb, 0x536d, 0x2a48, 0x01e5, 0x0205, 0x1267, 0x1267, 0x1247, 0x0a46, 0x0a47, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a26, 0x0a46, 0x0a26, 0x0a46, 0x0a26, 0x0a46, 0x0a26, 0x0a27, 
-  0x0a26, 0x0a46, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x1247, 0x0a47, 0x1247, 0x1247, 0x1247, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 0x1b08, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x0a26, 0x01c6, 
-  0x09c6, 0x01c6, 0x0206, 0x12c7, 0x0a46, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 
-  0x01c6, 0x09c6, 0x01c6, 0x01e6, 0x01e6, 0x0206, 0x12c7, 0x1287, 0x01c6, 0x01c6, 0x01e6, 0x1b08, 
-  0x0206, 0x0a46, 0x1ae8, 0x01c5, 0x01a5, 0x1ae8, 0x0a46, 0x01e6, 0x1b28, 0x01e5, 0x0a67, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a87, 0x1b28, 0x0206, 0x0a46, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a47, 0x0206, 
-  0x2328, 0x01e5, 0x1287, 0x1ae8, 0x01a5, 0x1ae8, 0x0a67, 0x01c6, 0x01e6, 0x01c6, 0x01a6, 0x0165, 
-  0x0124, 0x32eb, 0xc6ba, 0xd75d, 0xcf1c, 0xcefb, 0xdf7d, 0xb679, 0x84f3, 0x2a69, 0x0144, 0x1165, 
-  0x6bad, 0xd698, 0xb5b4, 0xbdb4, 0xbd94, 0xbdb4, 0xad32, 0x9c91, 0xbd94, 0xbdd4, 0xbdb4, 0xbdb4, 
-  0xbdb4, 0xbdb4, 0xbdb4, 0xbdb3, 0xbdb4, 0xbdb4, 0xbdd4, 0xb573, 0xbdb5, 0x738e, 0x3187, 0x3a09, 
-  0x2169, 0x2189, 0x42cf, 0x2a0c, 0x8452, 0x9cb2, 0x2128, 0x2149, 0x1906, 0x1883, 0x4146, 0x7a4a, 
-  0x7a4a, 0x7a4b, 0x69ea, 0x7a6b, 0x722b, 0x3907, 0x7a2a, 0x722a, 0x620a, 0x20a3, 0x0000, 0x0020, 
-  0x18e6, 0x6b6d, 0x9471, 0x2125, 0x0020, 0x0984, 0x1ac8, 0x12c7, 0x12e8, 0x7d53, 0xdf9d, 0xcf3c, 
-  0xcf1b, 0xcf3d, 0xd79e, 0x8513, 0x1267, 0x12c7, 0x1b28, 0x2349, 0x2349, 0x1b28, 0x1b08, 0x12e8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ac8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ac8, 0x1ac7, 0x1ac7, 0x1ac8, 
-  0x1b08, 0x1b08, 0x1ae8, 0x1ac8, 0x0205, 0x53ee, 0x8d54, 0x9575, 0xe79e, 0xe7be, 0xdf7d, 0xcf1c, 
-  0xd73c, 0xcf1c, 0xd75d, 0xcf1b, 0x6c90, 0x43ec, 0x12e7, 0x1b08, 0x2329, 0x1b08, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ac8, 0x1ac8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ac8, 0x1ae8, 0x1ac8, 0x1ac8, 0x22e8, 0x1ae8, 0x22e8, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c6, 
-  0x01c5, 0x0a06, 0x12c7, 0x1267, 0x01c5, 0x09e6, 0x01e6, 0x01e6, 0x01e7, 0x01c6, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e6, 0x09e6, 0x01c6, 0x01c5, 0x1ae7, 0x2308, 0x01c5, 0x01e6, 0x01c6, 0x09e6, 0x1b08, 
-  0x0206, 0x0a46, 0x1ae8, 0x01c5, 0x01a5, 0x1ae8, 0x0a67, 0x01e6, 0x1b28, 0x01e5, 0x0a66, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a87, 0x1b28, 0x0206, 0x0a66, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a47, 0x0206, 
-  0x2328, 0x01e5, 0x1287, 0x1ac8, 0x01a4, 0x1b08, 0x1287, 0x01e6, 0x0a07, 0x09e7, 0x0144, 0x2228, 
-  0x63ae, 0xae18, 0xdf7d, 0xcf1b, 0xcefb, 0xd75d, 0xd73c, 0x434c, 0x0103, 0x0185, 0x00c3, 0x0020, 
-  0x736e, 0xa513, 0xc616, 0xbdd5, 0xbdb4, 0xad12, 0xa4f2, 0xbd94, 0xbdb4, 0xbdb4, 0xbdb4, 0xbdb4, 
-  0xbdb4, 0xbdb4, 0xbdb4, 0xbdb4, 0xbdb4, 0xbdb3, 0xbdb4, 0xbdb4, 0xbdd4, 0xbdb5, 0xad33, 0xb594, 
-  0x4208, 0x2126, 0x10e5, 0x39e9, 0x9cf3, 0x738f, 0x18e7, 0x10c6, 0x3925, 0x7a2a, 0x7a29, 0x7a09, 
-  0x7a29, 0x7a2a, 0x824a, 0x826b, 0x6a0b, 0x3927, 0x7209, 0x4106, 0x4168, 0x20c3, 0x0000, 0x0021, 
-  0x18e6, 0x528b, 0x5aec, 0x0862, 0x00a2, 0x0985, 0x00e3, 0x434c, 0x7491, 0xd71c, 0xcf1c, 0xcefc, 
-  0xd75d, 0x9595, 0x6c50, 0x0985, 0x0184, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a4, 0x01a4, 0x01a5, 0x01a5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x0184, 0x01c5, 0x7491, 0x7471, 0x9595, 0xdf7e, 
-  0xc6db, 0xcefb, 0xcefb, 0xcefb, 0xdf5d, 0xc6da, 0x7d12, 0x2aa9, 0x0122, 0x0184, 0x0184, 0x0184, 
-  0x01a5, 0x01a4, 0x01a5, 0x01a5, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x12c8, 0x1ac8, 0x1ae8, 0x1ac8, 0x1ac8, 0x1ac8, 0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x12c8, 
-  0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 
-  0x12c7, 0x1ac8, 0x0a46, 0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01e6, 0x01e5, 0x12c7, 0x1b08, 0x0a26, 0x01c6, 0x01e6, 0x01c6, 0x0206, 0x1b28, 
-  0x0206, 0x0a46, 0x12e7, 0x01c5, 0x01a5, 0x1ae8, 0x0a66, 0x0206, 0x1b28, 0x01e5, 0x0a66, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a87, 0x1b28, 0x0206, 0x0a46, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a46, 0x0205, 
-  0x1b28, 0x01e5, 0x12a7, 0x1ac7, 0x01a5, 0x12a7, 0x01e5, 0x0144, 0x0206, 0x01e6, 0x19c6, 0x9d96, 
-  0xdfbe, 0xcf1c, 0xcefb, 0xcf1c, 0xe7be, 0xcf1c, 0x53ae, 0x01c6, 0x0a07, 0x09a6, 0x0061, 0x4984, 
-  0x41a7, 0x2968, 0x73b0, 0x8c72, 0xad55, 0x9cb1, 0xb593, 0xbdb4, 0xbdb4, 0xbdb4, 0xbdb4, 0xbdb4, 
-  0xbdb4, 0xbdb4, 0xbdb4, 0xbdb4, 0xbdb4, 0xbdb4, 0xbdb4, 0xbdb4, 0xbdb4, 0xbdb4, 0xad52, 0x9c90, 
-  0xbd94, 0xa512, 0x630b, 0x9cb0, 0x9cd2, 0x2948, 0x0044, 0x4187, 0x826b, 0x7a2a, 0x7a09, 0x7a09, 
-  0x7a29, 0x7a09, 0x7a2a, 0x826b, 0x6a2b, 0x3106, 0x4947, 0x4947, 0x59e8, 0x1882, 0x0020, 0x0821, 
-  0x18e6, 0x2127, 0x10c5, 0x0061, 0x1184, 0x0123, 0x4b2c, 0xcefb, 0xdf7e, 0xcf1c, 0xcefb, 0xdf7d, 
-  0xb6b9, 0x2b29, 0x0a04, 0x1266, 0x1287, 0x12c7, 0x1ae7, 0x1ac7, 0x1ac7, 0x1ac8, 0x12c8, 0x1ac7, 
-  0x1ac7, 0x1ac7, 0x1ac7, 0x1ac7, 0x1ac7, 0x1ac7, 0x1ac7, 0x1ac7, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 
-  0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac7, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 
-  0x1ac7, 0x1aa7, 0x1aa7, 0x1ac7, 0x1ac7, 0x1ae8, 0x1ae8, 0x1ac8, 0x0a86, 0x0a45, 0x2ae9, 0xa5f7, 
-  0xdf7d, 0xdf7d, 0xd71c, 0xcefb, 0xcefb, 0xd71c, 0xe7be, 0xadf7, 0x7491, 0x330a, 0x01c4, 0x1287, 
-  0x12a7, 0x1aa7, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1aa8, 0x1aa8, 0x1ac8, 0x1ac8, 
-  0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1aa8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1aa8, 0x1aa8, 
-  0x1287, 0x1287, 0x12a7, 0x12a7, 0x12a7, 0x1287, 0x1287, 0x1287, 0x12a7, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x0a87, 
-  0x1287, 0x0a46, 0x01e6, 0x01e6, 0x01e6, 0x01c7, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e5, 0x12a7, 0x1b28, 0x0a26, 0x01c6, 0x09e6, 0x01c6, 0x0206, 0x12a7, 0x1287, 
-  0x01e5, 0x0a66, 0x12e7, 0x01c5, 0x01c5, 0x1ae8, 0x0a67, 0x0206, 0x1b28, 0x01e5, 0x0a87, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a86, 0x1b08, 0x0206, 0x0a46, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x1b28, 0x01e5, 0x12a7, 0x1ae8, 0x0143, 0x53ce, 0x8533, 0x7cd2, 0x11e6, 0x2269, 0xb658, 0xdf7d, 
-  0xc6fb, 0xc6fb, 0xcf1c, 0xcefb, 0x640f, 0x3b2c, 0x01a5, 0x0a07, 0x0207, 0x09c6, 0x10e3, 0xabca, 
-  0xde13, 0x7baf, 0x0002, 0x2948, 0x420c, 0x9471, 0xc5f5, 0xbdd5, 0xbdb4, 0xbdb4, 0xbdd4, 0xbdb4, 
-  0xbdd4, 0xbdb4, 0xbdb4, 0xbdb4, 0xbdd4, 0xbdb4, 0xbdb4, 0xbdb4, 0xbdb4, 0xa512, 0xad32, 0xad33, 
-  0xbdb4, 0xbdd4, 0xce15, 0xbd94, 0x9410, 0x5a09, 0x3127, 0x724a, 0x7a4a, 0x7a2a, 0x7a2a, 0x7a0a, 
-  0x7a29, 0x7a09, 0x7a2a, 0x61c9, 0x3927, 0x28e6, 0x6a2a, 0x59a8, 0x1062, 0x0020, 0x0000, 0x0021, 
-  0x0883, 0x0883, 0x08a3, 0x09a5, 0x0184, 0x5bce, 0xcf1c, 0xcf1c, 0xc6fb, 0xcf1c, 0xdf7d, 0xa5f7, 
-  0x2ac9, 0x0a87, 0x12a7, 0x1246, 0x0a46, 0x1266, 0x1266, 0x1287, 0x1286, 0x1287, 0x1287, 0x1267, 
-  0x1267, 0x1266, 0x1267, 0x1267, 0x1267, 0x1267, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1287, 0x1287, 0x1287, 
-  0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x0a46, 0x0a67, 0x1267, 0x12a7, 0x12a8, 0x09e5, 0x1a27, 
-  0x4b6d, 0x434c, 0xb658, 0xdf7d, 0xd73c, 0xd73c, 0xcefb, 0xd73c, 0xe7be, 0xb699, 0x95d5, 0x2ae9, 
-  0x1246, 0x12a7, 0x12a7, 0x1287, 0x1287, 0x1287, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 
-  0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e6, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x0205, 0x0206, 0x0206, 0x01e6, 0x0206, 0x0206, 0x0206, 0x01e6, 0x01e6, 0x0206, 0x01e6, 0x0206, 
-  0x0206, 0x0206, 0x1ae7, 0x1b08, 0x0a26, 0x01c6, 0x09c6, 0x09c6, 0x01e6, 0x1ac7, 0x1287, 0x01c5, 
-  0x01c6, 0x0a66, 0x1ae8, 0x01c5, 0x01a5, 0x1ae7, 0x0a66, 0x0206, 0x1b28, 0x01e6, 0x0a87, 0x12c7, 
-  0x01a5, 0x12e8, 0x0a86, 0x1b08, 0x0206, 0x0a46, 0x1ae7, 0x01c6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x1b28, 0x01e5, 0x12c7, 0x12a6, 0x53ad, 0xcf1c, 0xdf9e, 0xdf7d, 0xae38, 0xb638, 0xdf7d, 0xd71c, 
-  0xd75d, 0xcf1c, 0xc71b, 0x4b6d, 0x0144, 0x01c6, 0x0a07, 0x01e7, 0x0207, 0x09e6, 0x18e3, 0xb40a, 
-  0xfed4, 0xeeda, 0xc5d7, 0x738f, 0x0003, 0x39aa, 0x7390, 0xb575, 0xbdd5, 0xbdd4, 0xbdb3, 0xbdb3, 
-  0xbdb3, 0xbdb4, 0xbdb3, 0xbdb4, 0xbdd4, 0xbdb4, 0xbdb4, 0xad32, 0x9c91, 0xad13, 0xbd94, 0xbdd4, 
-  0xbdb4, 0xbdb4, 0xb593, 0x93ee, 0x82eb, 0x828b, 0x4988, 0x720a, 0x824a, 0x7a4a, 0x7a2a, 0x7a29, 
-  0x7a29, 0x720a, 0x69e9, 0x30c6, 0x5189, 0x5a0a, 0x3125, 0x1061, 0x00a2, 0x0924, 0x08e3, 0x0924, 
-  0x0965, 0x09c6, 0x0185, 0x5bce, 0xae38, 0xcf1b, 0xd75d, 0xcf1c, 0xc6fc, 0xc71c, 0xae18, 0x1a07, 
-  0x01a5, 0x0a07, 0x01e6, 0x01c5, 0x01c5, 0x01e5, 0x01a5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01a5, 0x01c5, 
-  0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09a5, 0x0185, 
-  0x0165, 0x0185, 0x2268, 0x53ad, 0xcefb, 0xd73c, 0xcf1c, 0xcf1b, 0xc6fb, 0xd73c, 0xd75d, 0xbe79, 
-  0x9db6, 0x1227, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x01c6, 
-  0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 
-  0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x2349, 0x1b29, 
-  0x2349, 0x1b49, 0x1b29, 0x1b29, 0x2349, 0x1b49, 0x1b29, 0x1b29, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 
-  0x1b48, 0x1b49, 0x2348, 0x0a66, 0x01e6, 0x09e6, 0x01c6, 0x01e6, 0x12a7, 0x1267, 0x09e6, 0x09e6, 
-  0x01c6, 0x1287, 0x1ae8, 0x01e6, 0x01c5, 0x1ae8, 0x0a66, 0x0206, 0x1b28, 0x01e6, 0x1287, 0x12c7, 
-  0x01a5, 0x1ae8, 0x0a87, 0x1b28, 0x0206, 0x0a67, 0x1ae7, 0x01c5, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x2328, 0x01e5, 0x12c7, 0x0a65, 0x74b2, 0xe7be, 0xc6fb, 0xcefb, 0xd75d, 0xd75c, 0xcf1c, 0xd73c, 
-  0xdf5d, 0x53ae, 0x19e7, 0x0165, 0x01c6, 0x0a07, 0x0207, 0x01e7, 0x0a07, 0x0944, 0x18a2, 0x82a7, 
-  0xb42b, 0xf693, 0xffff, 0x9472, 0x2968, 0x31cb, 0x2108, 0x2128, 0x39ea, 0x9491, 0xa4f1, 0xc5f3, 
-  0xbdd3, 0xbdb3, 0xbdb3, 0xbdd4, 0xbdb4, 0xb573, 0x9491, 0xa512, 0xb573, 0xb593, 0xbdb3, 0xb593, 
-  0xbdd4, 0xbdf5, 0xacd1, 0x7aaa, 0x7a29, 0x7a29, 0x4168, 0x6a09, 0x822a, 0x8229, 0x8249, 0x7a2a, 
-  0x7a2a, 0x4106, 0x2884, 0x5988, 0x61e9, 0x18a3, 0x08e3, 0x0985, 0x0985, 0x0185, 0x09a5, 0x09c6, 
-  0x01c6, 0x01c6, 0x53ce, 0xcf1c, 0xdf7d, 0xd73c, 0xd75d, 0xcf3c, 0xae18, 0x2207, 0x11a6, 0x0165, 
-  0x09e7, 0x0a07, 0x0227, 0x0226, 0x0a66, 0x1b07, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09c6, 0x01a5, 0x0a05, 
-  0x0a25, 0x01e5, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x09c6, 
-  0x09a6, 0x01a6, 0x1a28, 0xa5f7, 0xd73c, 0xd71c, 0xcf1b, 0xcf1c, 0xd73c, 0xcf1b, 0xcefb, 0xd75c, 
-  0xd73c, 0xceda, 0x84f3, 0x01a5, 0x01c6, 0x01a6, 0x01a6, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 
-  0x01e6, 0x09e6, 0x09e6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09e6, 0x09e6, 
-  0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 
-  0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0205, 0x0205, 0x0206, 
-  0x0205, 0x0206, 0x0206, 0x01e5, 0x01e6, 0x01c6, 0x01e6, 0x12a7, 0x1267, 0x01e6, 0x0a06, 0x01e6, 
-  0x0a67, 0x1ae8, 0x0a26, 0x01e6, 0x01e6, 0x1b08, 0x0a67, 0x0206, 0x1b28, 0x01e6, 0x1287, 0x1ae7, 
-  0x01a5, 0x1ae8, 0x0a86, 0x1b28, 0x0206, 0x0a66, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x2348, 0x01e5, 0x12a7, 0x0a86, 0x640f, 0xcf1c, 0xd73c, 0xd73c, 0xc6fb, 0xc6fb, 0xcf1c, 0xdf7d, 
-  0x8d34, 0x2289, 0x09e6, 0x01a6, 0x01c6, 0x01c6, 0x01e6, 0x01e7, 0x0a07, 0x0904, 0x9470, 0x39a6, 
-  0x3923, 0xb42a, 0xe654, 0x83ce, 0x10a4, 0x4a6c, 0x4aad, 0x18e7, 0x18e7, 0x1086, 0x4209, 0xad33, 
-  0xb5b4, 0xc5f5, 0xbdd4, 0xb5b3, 0x9cb1, 0xa4f1, 0xbdb3, 0xbdb4, 0xbdd4, 0xbdb4, 0xb593, 0xbdb3, 
-  0xb572, 0xa4d1, 0x7aaa, 0x7a6a, 0x824a, 0x7a2a, 0x4168, 0x69e9, 0x8229, 0x7a2a, 0x722a, 0x59a8, 
-  0x40e6, 0x59a8, 0x61c9, 0x4946, 0x0841, 0x0944, 0x0a06, 0x0226, 0x0a26, 0x0a06, 0x0184, 0x0144, 
-  0x11c6, 0x3b0b, 0xc71b, 0xcf3c, 0xc6fb, 0xd73c, 0xcefb, 0x3b6c, 0x1247, 0x01a5, 0x0184, 0x01a5, 
-  0x01c6, 0x01e6, 0x0a46, 0x2388, 0x23a9, 0x2388, 0x1ac7, 0x01a5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0a45, 0x2347, 
-  0x2368, 0x1ae7, 0x01c5, 0x01a5, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x0185, 
-  0x11e7, 0x19e7, 0xa5f7, 0xdf9d, 0xcf1c, 0xcf1c, 0xd75d, 0xcefb, 0xb679, 0xcefb, 0xd75d, 0xcefb, 
-  0xcefb, 0xd73c, 0xd73c, 0x7cd2, 0x2248, 0x19e7, 0x19e7, 0x0185, 0x0185, 0x09c6, 0x01c6, 0x01c6, 
-  0x01a6, 0x01a5, 0x01a5, 0x01a6, 0x01a6, 0x01a5, 0x01a6, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 
-  0x0a47, 0x0a47, 0x0a67, 0x0a67, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 
-  0x0a47, 0x0a67, 0x0a67, 0x0a46, 0x0a66, 0x0a67, 0x0a66, 0x0a46, 0x0a46, 0x0a67, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a47, 0x0a47, 0x0a67, 0x0a47, 0x0a47, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a66, 0x0a67, 0x0a67, 0x12c7, 0x1287, 0x01e6, 0x0a06, 0x01e6, 0x0a67, 
-  0x1ae8, 0x0a26, 0x01e6, 0x01e6, 0x0a66, 0x2348, 0x0a46, 0x0206, 0x1b28, 0x01e6, 0x1287, 0x12e7, 
-  0x01c5, 0x1ae8, 0x0a87, 0x1b28, 0x0206, 0x0a46, 0x1ae7, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x2328, 0x01e5, 0x0a87, 0x1ac7, 0x01e5, 0x2b2a, 0x9dd6, 0xbe79, 0xd75d, 0xd75d, 0xc6fb, 0xcf1c, 
-  0xcf1c, 0xd75c, 0x436c, 0x01a5, 0x01c6, 0x01a6, 0x01c6, 0x01e6, 0x01e6, 0x0924, 0x83ee, 0xb594, 
-  0x9cb1, 0x5248, 0x4185, 0x0000, 0x3187, 0x39c9, 0x2126, 0x420a, 0x3a0a, 0x2107, 0x1907, 0x10a6, 
-  0x4a4b, 0x6b4e, 0x9471, 0x9cd1, 0xb572, 0xbdb3, 0xbdb3, 0xbdb4, 0xb5b3, 0xbdd4, 0xbdd4, 0xa4b1, 
-  0x7aaa, 0x7a8a, 0x7a6a, 0x7a6a, 0x824a, 0x822a, 0x4968, 0x7209, 0x826b, 0x59c9, 0x4107, 0x61c9, 
-  0x826b, 0x69e9, 0x20a3, 0x0081, 0x0964, 0x0a05, 0x0ae7, 0x1367, 0x1b88, 0x0ac6, 0x2ac9, 0x432b, 
-  0xb659, 0xc71b, 0xcf1c, 0xcf3c, 0xdfbe, 0xcf3c, 0x43cc, 0x0ac7, 0x12c8, 0x0a67, 0x0206, 0x01c6, 
-  0x01c5, 0x09e5, 0x2328, 0x2388, 0x1b68, 0x23a8, 0x1ae7, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0205, 0x1b47, 0x2347, 
-  0x1ac6, 0x2b48, 0x1ae7, 0x0a46, 0x0a66, 0x0a66, 0x0a46, 0x0a46, 0x0a66, 0x12a7, 0x12c7, 0x1a87, 
-  0x9d95, 0xcf1b, 0xc6fb, 0xc71b, 0xcf1c, 0xd73c, 0xbeb9, 0x644f, 0x11e5, 0x7d32, 0xbed9, 0xdf7d, 
-  0xdf7d, 0xcefb, 0xd71c, 0xdf5d, 0xcefb, 0xc6db, 0xc6da, 0x4b4c, 0x1a47, 0x01c4, 0x0205, 0x1267, 
-  0x0a66, 0x0a46, 0x0a46, 0x1247, 0x1247, 0x1247, 0x1247, 0x1247, 0x1247, 0x1247, 0x1247, 0x1247, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 
-  0x1ae8, 0x1b08, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 0x12c7, 0x0206, 0x0a06, 0x01e6, 0x1287, 0x1ae7, 
-  0x0226, 0x01e6, 0x01c6, 0x0a06, 0x1ac7, 0x0a46, 0x01e5, 0x0226, 0x1b48, 0x0206, 0x1287, 0x12c7, 
-  0x01c5, 0x1ae8, 0x0a86, 0x1b28, 0x0206, 0x0a46, 0x1b08, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x1b28, 0x01e5, 0x1287, 0x1ae8, 0x01e5, 0x2348, 0x1226, 0x11c6, 0x7cb2, 0x9dd7, 0xe7be, 0xd75c, 
-  0xc6fb, 0xe7de, 0x43ad, 0x01a5, 0x09e7, 0x01a6, 0x01a6, 0x01a6, 0x01c6, 0x08e3, 0x4a6a, 0x632d, 
-  0x94b1, 0xc658, 0x9cd2, 0x528a, 0x18c4, 0x2105, 0x422a, 0x2968, 0x3188, 0x422b, 0x424c, 0x31aa, 
-  0x2109, 0x0005, 0x4a4c, 0x73af, 0xad53, 0xb593, 0xbdb3, 0xbdb3, 0xbdf4, 0xb573, 0x9c50, 0x7a6a, 
-  0x7a29, 0x7a4a, 0x824a, 0x824a, 0x7a4a, 0x824a, 0x4988, 0x51a9, 0x4947, 0x4948, 0x726b, 0x6a09, 
-  0x5187, 0x2104, 0x0144, 0x0a06, 0x09e5, 0x1286, 0x1347, 0x1307, 0x0b07, 0x2348, 0xae78, 0xdf7d, 
-  0xcf1c, 0xc6fb, 0xcf5d, 0xb6ba, 0x8513, 0x438c, 0x0aa7, 0x1b69, 0x23ca, 0x1b69, 0x0a87, 0x01e6, 
-  0x01c6, 0x0a06, 0x2328, 0x1b06, 0x1307, 0x23a8, 0x1b07, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0206, 0x2368, 0x12c5, 
-  0x0a44, 0x2347, 0x2368, 0x1ae7, 0x1b07, 0x1ae7, 0x1aa7, 0x1aa7, 0x1b08, 0x1b28, 0x33aa, 0xb6b8, 
-  0xd73c, 0xcf1b, 0xc71b, 0xcf1b, 0xcf1b, 0x7471, 0x332a, 0x12c7, 0x1b28, 0x2369, 0x33aa, 0x8d34, 
-  0x9d96, 0xdf7d, 0xd75d, 0xcefb, 0xd71c, 0xd73c, 0xcf3c, 0xd75c, 0xb699, 0x64d0, 0x4c2d, 0x0265, 
-  0x12c7, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01a5, 0x01c5, 0x01a5, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01e6, 0x01e6, 0x12a7, 0x1ae8, 0x0a06, 
-  0x09e6, 0x01e6, 0x0a26, 0x1287, 0x0a06, 0x01a5, 0x01e5, 0x12a7, 0x1ac7, 0x01e6, 0x1287, 0x12c7, 
-  0x01c5, 0x12e8, 0x0a86, 0x1b28, 0x0206, 0x0a46, 0x1b08, 0x01e5, 0x01e5, 0x1b08, 0x0a46, 0x0206, 
-  0x1b28, 0x01c5, 0x1287, 0x1ae8, 0x01c5, 0x1b08, 0x0a46, 0x01a5, 0x0144, 0x1a69, 0x74b2, 0xa617, 
-  0xe7ff, 0x9db6, 0x2289, 0x01c6, 0x09e6, 0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x0924, 0x18e4, 0x3187, 
-  0x632e, 0x73af, 0xa534, 0xd6ba, 0xa514, 0x2966, 0x0000, 0x2106, 0x39e9, 0x2148, 0x39ca, 0x4a4c, 
-  0x5acd, 0x420a, 0x2128, 0x0845, 0x3188, 0x5acc, 0xb574, 0xa533, 0x9cb1, 0x8b6d, 0x7a29, 0x7a49, 
-  0x7a29, 0x8249, 0x8a8b, 0x8a8b, 0x826b, 0x7a2a, 0x4148, 0x4168, 0x4947, 0x620a, 0x4166, 0x20e4, 
-  0x00a2, 0x09a5, 0x0a06, 0x01e6, 0x01e6, 0x0a46, 0x0a86, 0x01c4, 0x1246, 0x9595, 0xcf1c, 0xc6fb, 
-  0xcf1b, 0xdfbe, 0xbeba, 0x432b, 0x0103, 0x01a5, 0x0207, 0x0247, 0x0267, 0x1b28, 0x1b69, 0x0206, 
-  0x01e6, 0x01e6, 0x1266, 0x2347, 0x2388, 0x23a8, 0x1287, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0206, 0x1b27, 0x2be9, 
-  0x2ba8, 0x2368, 0x0a46, 0x01a5, 0x01c5, 0x01c5, 0x0185, 0x01a5, 0x01a5, 0x09c5, 0x8d74, 0xd75d, 
-  0xcf1b, 0xcefb, 0xcf1b, 0xcf3c, 0x6c2f, 0x0103, 0x01c5, 0x0a27, 0x0247, 0x0247, 0x0206, 0x0185, 
-  0x11e6, 0x640f, 0x84f3, 0xdf9e, 0xd73c, 0xcefb, 0xcefb, 0xcf1b, 0xcf1c, 0xdf9d, 0xb699, 0x74d1, 
-  0x3b4b, 0x0103, 0x01c5, 0x01c6, 0x01a5, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x12c8, 0x12c8, 0x12c8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 
-  0x1ac8, 0x1ac8, 0x12c8, 0x1ac8, 0x12c8, 0x12e8, 0x12e8, 0x1ac8, 0x1ac8, 0x12c8, 0x1ac8, 0x12c8, 
-  0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x12e8, 0x1ae8, 0x1ac8, 0x1ae8, 0x1ae8, 0x1ac8, 0x12c8, 0x12c8, 
-  0x1ae8, 0x12e8, 0x1ae8, 0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x1ae8, 0x1b08, 0x0a26, 0x09e6, 
-  0x09e6, 0x0a26, 0x1ae7, 0x0a46, 0x01a5, 0x01e5, 0x12a7, 0x1ae7, 0x0a06, 0x01c5, 0x1286, 0x12c7, 
-  0x01a5, 0x1ae8, 0x0a86, 0x1b28, 0x0206, 0x0a46, 0x1b07, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x1b28, 0x01c5, 0x1287, 0x1ae8, 0x01c5, 0x1ae8, 0x0a46, 0x01c6, 0x0a07, 0x0a07, 0x0124, 0x2aca, 
-  0x74b2, 0x1a48, 0x0185, 0x09e7, 0x01e6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x09e6, 0x0964, 0x0882, 
-  0x3187, 0x5b0d, 0x5aed, 0x6b8f, 0x94d3, 0x9d13, 0x73ae, 0x5aec, 0x0842, 0x2967, 0x39e9, 0x31a9, 
-  0x31a9, 0x39ea, 0x39a9, 0x7bd0, 0x8c51, 0x6b6e, 0x2946, 0x3167, 0x6208, 0x8229, 0x7a49, 0x7a49, 
-  0x826a, 0x7229, 0x4125, 0x4125, 0x61a8, 0x824b, 0x61c9, 0x7a4a, 0x722a, 0x28e4, 0x0000, 0x0924, 
-  0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x0a06, 0x0a26, 0x01a4, 0x32e9, 0x95d6, 0xcf5c, 0xc6fb, 0xd73c, 
-  0xcefb, 0x7491, 0x434c, 0x0123, 0x09e7, 0x09e7, 0x0207, 0x0a27, 0x0227, 0x0227, 0x1308, 0x12e7, 
-  0x0226, 0x0207, 0x01c5, 0x0a26, 0x1286, 0x1266, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x0a46, 0x1b07, 
-  0x1b07, 0x12a7, 0x01c6, 0x09c6, 0x09c6, 0x01e6, 0x09c7, 0x0144, 0x0985, 0x8d54, 0xdf7d, 0xcf1c, 
-  0xd73c, 0xe79e, 0xdf7d, 0x63ce, 0x0103, 0x09a6, 0x09c6, 0x0a06, 0x0207, 0x0207, 0x0207, 0x0a07, 
-  0x01e6, 0x0124, 0x11e7, 0x5bce, 0xa5f7, 0xdf9e, 0xd75d, 0xcf1c, 0xcf1b, 0xcefb, 0xd73c, 0xefdf, 
-  0xbe79, 0x7cb2, 0x1a07, 0x0123, 0x01a6, 0x09c6, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x0a07, 
-  0x1288, 0x1288, 0x12a8, 0x12a8, 0x1288, 0x1287, 0x1287, 0x12a7, 0x1287, 0x1287, 0x1287, 0x1288, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x12a7, 0x12a7, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x1287, 0x12a7, 
-  0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x1287, 0x1287, 0x1287, 0x1287, 0x12a7, 0x0a26, 0x0206, 0x0a06, 
-  0x0a06, 0x1ac7, 0x0a26, 0x01e6, 0x01e6, 0x1287, 0x12a7, 0x0206, 0x01e6, 0x0a06, 0x1ae8, 0x12a7, 
-  0x01a5, 0x1b08, 0x12a7, 0x1b28, 0x01e5, 0x0a46, 0x1b08, 0x01e6, 0x01e6, 0x1b08, 0x0a67, 0x0206, 
-  0x2328, 0x01c5, 0x1287, 0x1ae8, 0x01a5, 0x1ae8, 0x0a46, 0x01c6, 0x09e6, 0x09e6, 0x0a07, 0x01a6, 
-  0x0164, 0x01a6, 0x09e6, 0x01c6, 0x09c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x1ac6, 0x2b68, 0x11a5, 
-  0x08c3, 0x18e4, 0x10a3, 0x39e8, 0x52ac, 0x6b4e, 0x94b2, 0xad55, 0x9492, 0x52ab, 0x0022, 0x2125, 
-  0x31c9, 0x422b, 0x3988, 0xe71a, 0xffff, 0xe6fa, 0xa4f3, 0x6aca, 0x6964, 0x9289, 0x7229, 0x826a, 
-  0x69e8, 0x30e4, 0x0000, 0x0000, 0x2085, 0x722b, 0x8a6b, 0x4926, 0x2083, 0x00a2, 0x0944, 0x09a5, 
-  0x01a5, 0x01c6, 0x09e6, 0x09e7, 0x09e6, 0x0164, 0x2aa9, 0xb699, 0xcf5c, 0xc6db, 0xc71b, 0xd75d, 
-  0x640f, 0x0184, 0x01c5, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x0207, 0x0227, 0x0a67, 0x1b48, 
-  0x12e8, 0x0206, 0x09e6, 0x01a5, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0206, 
-  0x0226, 0x0226, 0x0206, 0x09e6, 0x09c6, 0x01a6, 0x0165, 0x6c30, 0x9d95, 0xd75d, 0xcf1b, 0xcf3c, 
-  0xcf3c, 0x8513, 0x5c0f, 0x0165, 0x01a6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x09e6, 0x0144, 0x2a89, 0x4b8d, 0x53ae, 0xcefb, 0xdf7d, 0xd71c, 0xd73c, 0xd73c, 
-  0xdf5d, 0xe79e, 0x9d75, 0x7cd2, 0x11a6, 0x0144, 0x0185, 0x01c6, 0x09e6, 0x0a07, 0x0a07, 0x0a07, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0a06, 0x0a26, 0x0a46, 
-  0x1ae8, 0x0a46, 0x01c5, 0x01e6, 0x1287, 0x1287, 0x01e6, 0x01c6, 0x09e6, 0x2308, 0x1ae7, 0x0a05, 
-  0x01e6, 0x0a46, 0x1b28, 0x1287, 0x01e6, 0x0a66, 0x1ae7, 0x01e6, 0x01e6, 0x1b08, 0x0a46, 0x0206, 
-  0x2328, 0x01c5, 0x1287, 0x12c8, 0x01a5, 0x1ae8, 0x0a46, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 
-  0x09e7, 0x09e6, 0x01c6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x1287, 0x2bc8, 0x2307, 0x1206, 
-  0x09a5, 0x0944, 0x0984, 0x0903, 0x2986, 0x4a6b, 0x4a8b, 0x6b6e, 0x94f4, 0xad75, 0x94b2, 0x4a6a, 
-  0x10a4, 0x20e6, 0x28e6, 0xd616, 0xff59, 0xff38, 0xffda, 0xe5cf, 0xc3c7, 0x9ac9, 0x7a29, 0x724a, 
-  0x20c5, 0x0864, 0x18c6, 0x20e6, 0x1085, 0x28e6, 0x28e5, 0x08e4, 0x0144, 0x09c6, 0x09c5, 0x01a5, 
-  0x01a5, 0x09a6, 0x01a6, 0x0185, 0x2268, 0x9db6, 0xb679, 0xd75c, 0xc6db, 0xcf1c, 0xcf1c, 0x538d, 
-  0x01c5, 0x0a47, 0x0a46, 0x0206, 0x01e5, 0x01c5, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x0206, 0x0246, 
-  0x2349, 0x12c7, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x0226, 0x1b08, 
-  0x2389, 0x1b48, 0x0267, 0x0227, 0x01e6, 0x09a6, 0x84f3, 0xd75c, 0xdf7d, 0xcf1b, 0xcf1c, 0xd77d, 
-  0x8533, 0x01c4, 0x01e5, 0x0a06, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0206, 
-  0x0206, 0x0206, 0x0206, 0x0a07, 0x01c5, 0x01a4, 0x01c5, 0x2aea, 0x640f, 0xcf1b, 0xcefb, 0xcf1b, 
-  0xcf1c, 0xc6da, 0xd73c, 0xd75d, 0xae17, 0xae18, 0x7471, 0x0185, 0x0a26, 0x0226, 0x0a47, 0x0a47, 
-  0x1b08, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1b08, 0x1b08, 0x1b28, 
-  0x0a67, 0x0206, 0x0a26, 0x12a7, 0x1ac8, 0x0a06, 0x01c5, 0x01e5, 0x1ac7, 0x1ae7, 0x01e6, 0x01e6, 
-  0x0226, 0x1ae7, 0x1266, 0x0a06, 0x01e6, 0x0a46, 0x1ae8, 0x01e6, 0x01e6, 0x1b08, 0x0a47, 0x0206, 
-  0x2328, 0x01c5, 0x1287, 0x1ae8, 0x01a5, 0x1ae8, 0x0a47, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x1286, 0x2ba8, 0x2b67, 0x1225, 0x01a5, 
-  0x01a5, 0x1226, 0x2b67, 0x22c6, 0x1144, 0x10a3, 0x31a7, 0x3a09, 0x39e9, 0x52ec, 0x8c72, 0xb596, 
-  0x9cf3, 0x734d, 0x28e5, 0x49e7, 0xbc8d, 0xcd0d, 0xee2e, 0xe56c, 0xe4cc, 0x92e9, 0x61e9, 0x20a4, 
-  0x10a6, 0x18c7, 0x2128, 0x3169, 0x18a5, 0x0863, 0x0944, 0x09e7, 0x0a07, 0x09e6, 0x01c6, 0x09c6, 
-  0x09a6, 0x0165, 0x09c6, 0x2228, 0xb638, 0xdf9d, 0xd75c, 0xcf1c, 0xd75c, 0xcf1c, 0x6470, 0x1ac7, 
-  0x1ae8, 0x1b48, 0x1b48, 0x1b48, 0x1b28, 0x1b28, 0x1b08, 0x1b08, 0x1ae7, 0x01e6, 0x01c6, 0x01e6, 
-  0x0a26, 0x1b28, 0x1287, 0x01e6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x1ae8, 0x0aa6, 
-  0x0a86, 0x23a9, 0x1b68, 0x1328, 0x1ae8, 0x8d74, 0xdf7d, 0xcf1c, 0xcefb, 0xd73c, 0xd73c, 0xa617, 
-  0x2349, 0x2349, 0x236a, 0x2349, 0x1b29, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 
-  0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b29, 0x1b29, 0x1b29, 0x12c7, 0x1b08, 0x3c0c, 0x33ca, 0x7532, 
-  0xd73c, 0xd73c, 0xcf1c, 0xc6db, 0xcf1c, 0xd75c, 0xc6db, 0xbe99, 0x6cf1, 0x2b8a, 0x2369, 0x1b29, 
-  0x0a46, 0x0a66, 0x0a66, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a66, 0x0a66, 
-  0x0a46, 0x0a46, 0x0a66, 0x0a66, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a66, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a66, 0x0a66, 
-  0x0a67, 0x0a67, 0x12c8, 0x12a7, 0x0a06, 0x01e6, 0x0a06, 0x1ac7, 0x1ac7, 0x01c5, 0x01e6, 0x0206, 
-  0x1ae8, 0x12a7, 0x0206, 0x09e6, 0x01e6, 0x1267, 0x1ac7, 0x01c6, 0x01c5, 0x1b08, 0x0a67, 0x0206, 
-  0x2328, 0x01c5, 0x1287, 0x1ae8, 0x01a5, 0x1ae8, 0x0a47, 0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 
-  0x01e7, 0x01e6, 0x01c6, 0x01c6, 0x09c6, 0x01c5, 0x12a7, 0x2b87, 0x2327, 0x0a05, 0x09c6, 0x01c5, 
-  0x1245, 0x2347, 0x2367, 0x1a86, 0x09c5, 0x2a67, 0x1103, 0x0041, 0x0841, 0x2946, 0x39e8, 0x632d, 
-  0x9cb3, 0xbdb5, 0xbdb5, 0x9c90, 0x3104, 0x5185, 0xc42a, 0x9b09, 0x7a6a, 0x49c9, 0x1064, 0x0021, 
-  0x18c6, 0x18c7, 0x4a6b, 0x7bd0, 0x20e5, 0x0022, 0x09a6, 0x09e7, 0x01e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x0185, 0x1186, 0x9575, 0xc6fb, 0xd73c, 0xcefb, 0xd73c, 0xd73c, 0x9d96, 0x32ea, 0x01c5, 0x09e6, 
-  0x0a06, 0x0226, 0x0a26, 0x0a26, 0x0a46, 0x0a26, 0x0a26, 0x0226, 0x0a46, 0x12a7, 0x09e6, 0x01a6, 
-  0x01c6, 0x0a06, 0x1ae8, 0x1246, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c5, 0x1ae7, 0x0a66, 
-  0x0a45, 0x1326, 0x1307, 0x7531, 0xd73c, 0xd73c, 0xd73c, 0xcf1c, 0xdf7d, 0xadf7, 0x32ca, 0x1a48, 
-  0x01c5, 0x0a06, 0x0a26, 0x0a26, 0x0a26, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 
-  0x0a06, 0x0a26, 0x0a26, 0x0a26, 0x0206, 0x0206, 0x0a06, 0x0a26, 0x0a26, 0x0206, 0x0205, 0x0984, 
-  0x7471, 0xb679, 0xadf7, 0xcefb, 0xd73c, 0xc6da, 0xcf1b, 0xdf5d, 0xd73c, 0xd75c, 0x4bad, 0x1a67, 
-  0x1ae8, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1b08, 0x1b28, 0x12a7, 0x09e6, 0x09e6, 0x0a26, 0x1b08, 0x1ae8, 0x01c5, 0x01c6, 0x0206, 0x1ac7, 
-  0x1267, 0x01e6, 0x0a06, 0x01e6, 0x1ac7, 0x1ac7, 0x01e6, 0x01c6, 0x01c5, 0x1b08, 0x0a46, 0x0205, 
-  0x1b08, 0x01c5, 0x1287, 0x1ae7, 0x01a5, 0x1ae8, 0x0a67, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x09c6, 0x01c6, 0x01c6, 0x01a6, 0x1286, 0x2b87, 0x2b47, 0x0a05, 0x01c5, 0x0a06, 0x1286, 
-  0x2367, 0x23a7, 0x1ae6, 0x0a05, 0x09e6, 0x1a67, 0x1a06, 0x1165, 0x08c3, 0x0882, 0x2124, 0x4a29, 
-  0x5aac, 0x5b0d, 0x7bef, 0x8c30, 0xad53, 0x9c70, 0x49c7, 0x49c7, 0x39a7, 0x3189, 0x1084, 0x0000, 
-  0x18c6, 0x2108, 0x632e, 0x8c31, 0x2106, 0x0001, 0x0965, 0x09c6, 0x01c6, 0x0a07, 0x0206, 0x01c5, 
-  0x09a6, 0x9d75, 0xd77d, 0xcf3c, 0xc6fb, 0xd75d, 0xdf5d, 0x63ef, 0x0144, 0x01a5, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x0a47, 0x1aa7, 0x01c6, 
-  0x01a6, 0x09e6, 0x09e6, 0x1287, 0x1267, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01c6, 0x01a5, 0x1287, 0x1b48, 
-  0x1b07, 0x338a, 0x6cb0, 0xd75c, 0xd73c, 0xd71c, 0xd71b, 0xdf5d, 0x9d95, 0x11e7, 0x01a5, 0x01a6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x09e7, 0x09c6, 0x0185, 
-  0x0185, 0x0985, 0x0985, 0x8d14, 0xb659, 0xdf7d, 0xdf5d, 0xcefb, 0xd71c, 0xd71c, 0xc6db, 0xc6ba, 
-  0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01a5, 0x01a5, 
-  0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01a5, 0x01a5, 
-  0x01c5, 0x01c5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01e6, 0x01e6, 0x0a26, 0x1b08, 0x1ae7, 0x01e6, 0x01e6, 0x0a06, 0x1ac7, 0x1287, 
-  0x01c5, 0x09e6, 0x01e6, 0x1267, 0x1ae8, 0x09e6, 0x01c6, 0x01c6, 0x01c6, 0x1b08, 0x0a46, 0x0206, 
-  0x1b08, 0x01c5, 0x1287, 0x1ae8, 0x01a5, 0x1ae8, 0x0a67, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x12a6, 0x2ba7, 0x2367, 0x1246, 0x01a5, 0x0a05, 0x1b27, 0x2ba7, 
-  0x2b87, 0x1ae7, 0x0205, 0x0a26, 0x1a87, 0x1206, 0x09a6, 0x09c6, 0x09c6, 0x1207, 0x11a6, 0x0082, 
-  0x2946, 0x2966, 0x422a, 0x5aed, 0x7bef, 0x8c70, 0x94d2, 0x8c92, 0x8431, 0x420c, 0x1064, 0x0000, 
-  0x18a5, 0x2149, 0x6b6f, 0x7bf0, 0x2105, 0x0041, 0x0985, 0x09a5, 0x09c6, 0x01c6, 0x22a9, 0x4bad, 
-  0x9575, 0xdf7d, 0xcf1c, 0xcf1c, 0xdf7d, 0xc69a, 0x5bae, 0x0165, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x09e7, 0x09e7, 0x01e7, 0x01e6, 0x0a46, 0x1aa8, 
-  0x09e6, 0x01c6, 0x01c5, 0x01e5, 0x1ac7, 0x1287, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x09a6, 0x09c6, 0x0a86, 
-  0x5c4e, 0xcf3b, 0xd73c, 0xd71c, 0xcf1b, 0xd75d, 0xe7be, 0xa5d7, 0x09a5, 0x01c6, 0x09c6, 0x09c6, 
-  0x01c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c7, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x09e6, 
-  0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09c6, 0x09c7, 0x09e6, 0x09e6, 0x09c6, 0x09e6, 0x09e7, 0x09e7, 
-  0x09c6, 0x09e6, 0x09e6, 0x01a5, 0x1a48, 0x8d13, 0xae18, 0xefbe, 0xd73c, 0xcedb, 0xcf1b, 0xcf1b, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1267, 0x1267, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1267, 0x1267, 0x1286, 0x1286, 0x1287, 0x1287, 0x1287, 0x1287, 0x1286, 0x1287, 0x1267, 0x1267, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1286, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1b08, 0x1b08, 0x0206, 0x01e6, 0x0226, 0x1ae8, 0x1287, 0x01e6, 
-  0x09e6, 0x01c6, 0x1287, 0x12a7, 0x01e5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x1b08, 0x0a47, 0x0206, 
-  0x1b08, 0x01e5, 0x1287, 0x1ae8, 0x01a5, 0x1ae8, 0x0a66, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x09c6, 0x01e6, 0x12c7, 0x2388, 0x1b07, 0x1226, 0x01a5, 0x01c5, 0x1286, 0x2ba7, 0x2b87, 
-  0x1ae6, 0x01e6, 0x0a26, 0x1ac7, 0x0a06, 0x01a5, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x0a26, 0x2288, 
-  0x1185, 0x0062, 0x18e4, 0x2946, 0x52ad, 0x5b0e, 0x634f, 0x632f, 0x528c, 0x2907, 0x0842, 0x0000, 
-  0x10a5, 0x2128, 0x5b0f, 0x5acd, 0x18a4, 0x00e3, 0x09a6, 0x0985, 0x0103, 0x09a6, 0x9db6, 0xefde, 
-  0xd75c, 0xcf1c, 0xd73c, 0xd73c, 0x9575, 0x432b, 0x0144, 0x09e6, 0x01c6, 0x01e6, 0x01e6, 0x09e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x09e6, 0x01e6, 0x01e7, 0x01c6, 0x0a26, 
-  0x12a7, 0x01c5, 0x01a5, 0x01c6, 0x0a06, 0x1ac8, 0x1287, 0x01c5, 0x09e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x09c6, 0x0164, 0x0164, 0x5c2f, 
-  0xd73c, 0xd73c, 0xd71b, 0xcefb, 0xd73c, 0x9db6, 0x84f2, 0x1a27, 0x01c5, 0x01e6, 0x01c5, 0x01c5, 
-  0x01c6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c6, 0x01e6, 0x0206, 0x0164, 0x32ea, 0x84f3, 0xadf7, 0xe79e, 0xcefb, 0xc6db, 
-  0x2bc9, 0x2bc9, 0x2be9, 0x2bc9, 0x2bc9, 0x2bc9, 0x23c9, 0x23c9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 
-  0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 
-  0x23c9, 0x23c9, 0x23a9, 0x23c9, 0x23c9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 
-  0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 
-  0x2bc9, 0x2bc9, 0x23c9, 0x2be9, 0x1b48, 0x0a26, 0x0206, 0x0a26, 0x1b08, 0x12a7, 0x01e6, 0x01e6, 
-  0x01c6, 0x1287, 0x1aa7, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x1b08, 0x0a67, 0x0205, 
-  0x2328, 0x01e5, 0x1287, 0x1ae8, 0x01a5, 0x1ae8, 0x0a66, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x09c6, 0x01c6, 0x12a7, 0x2b88, 0x1aa7, 0x09e5, 0x01a5, 0x01a5, 0x0a66, 0x2367, 0x23a7, 0x12c6, 
-  0x01e6, 0x0a26, 0x1ae7, 0x0a26, 0x01a5, 0x09c6, 0x09c6, 0x09e6, 0x09e6, 0x0a06, 0x22c8, 0x1a47, 
-  0x09c6, 0x09c6, 0x0103, 0x00e2, 0x2146, 0x2946, 0x2146, 0x2125, 0x20e6, 0x0842, 0x0000, 0x0021, 
-  0x18e6, 0x2107, 0x31a9, 0x2926, 0x08c3, 0x0986, 0x09a6, 0x0145, 0x53ae, 0x84f3, 0xd77d, 0xc71b, 
-  0xcf1b, 0xcf1c, 0xdf7d, 0x6c30, 0x0164, 0x0185, 0x09e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01c6, 
-  0x1267, 0x1ac8, 0x09e6, 0x01c6, 0x09e6, 0x0a26, 0x12a7, 0x0a66, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x09c6, 0x0144, 0x434c, 0x8533, 0xcf1b, 
-  0xd73c, 0xcf1b, 0xd75c, 0xe79e, 0x9e36, 0x2b29, 0x0a25, 0x12c7, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 
-  0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x12e8, 0x12e8, 0x1ae8, 0x12e8, 0x12e8, 0x1ae8, 0x12e8, 0x12e8, 
-  0x1ae8, 0x1ae8, 0x12e8, 0x12e8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b09, 0x1ae8, 0x0225, 0x332a, 0x640f, 0xbe9a, 0xdf9e, 
-  0x0a66, 0x0a66, 0x0a66, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a66, 0x0a66, 0x0a86, 
-  0x0a66, 0x0a86, 0x0a66, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 
-  0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 
-  0x0a66, 0x0a66, 0x0a66, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a66, 0x0a66, 0x0a66, 
-  0x0a66, 0x0a66, 0x0a66, 0x0a87, 0x0a46, 0x0206, 0x0a27, 0x1ae8, 0x12a7, 0x0206, 0x0206, 0x01e6, 
-  0x1287, 0x1ac7, 0x01e5, 0x01c5, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x1b08, 0x0a46, 0x0206, 
-  0x2328, 0x01e5, 0x1287, 0x1ae8, 0x01c5, 0x1b08, 0x0a46, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x12a7, 0x2348, 0x1286, 0x01c5, 0x01c6, 0x01c6, 0x0a65, 0x2367, 0x2ba7, 0x1ae6, 0x0206, 
-  0x0a26, 0x1ac7, 0x1246, 0x01c5, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x0a06, 0x1ac8, 0x1227, 0x01a5, 
-  0x09c6, 0x01a6, 0x1a87, 0x1ac8, 0x0924, 0x00c3, 0x00c2, 0x00a2, 0x0904, 0x1166, 0x08a3, 0x0001, 
-  0x0863, 0x0842, 0x0821, 0x0882, 0x09a6, 0x09c6, 0x11c6, 0x7491, 0xcf5c, 0xd77d, 0xc6fb, 0xcf1c, 
-  0xd73c, 0xe7be, 0x8d54, 0x01c6, 0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x01e7, 0x09e6, 0x09e6, 
-  0x01c6, 0x0a47, 0x12a7, 0x0206, 0x09e6, 0x0a06, 0x0206, 0x1ac7, 0x12a7, 0x01c5, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x09c6, 0x01a5, 0x53ce, 0xb679, 0xdf9d, 0xc71b, 
-  0xcf1b, 0xdf7d, 0xb658, 0x53ee, 0x2ae9, 0x0a46, 0x1287, 0x1267, 0x1267, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1287, 0x1287, 0x1287, 0x1287, 0x1267, 
-  0x1287, 0x1287, 0x1267, 0x0a67, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1267, 0x1287, 0x0a06, 0x0144, 0x3b0b, 0x4b8d, 
-  0x22e8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae9, 0x1ae8, 0x1ae8, 0x22e8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae9, 0x1ae9, 0x1ae9, 0x1ae8, 0x1ae8, 0x1ae8, 0x22e9, 0x2309, 0x2308, 0x2309, 0x22e9, 
-  0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x22e8, 
-  0x22e8, 0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 
-  0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x2309, 0x2329, 0x2329, 0x1287, 0x01e6, 0x0206, 0x0206, 0x12a7, 
-  0x1ac8, 0x01e5, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x1b08, 0x0a66, 0x0206, 
-  0x1b28, 0x01e5, 0x1287, 0x1ae8, 0x01c5, 0x1b08, 0x0a67, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x12a7, 0x2388, 0x12a7, 0x01c6, 0x09e6, 0x01c6, 0x0a66, 0x2387, 0x2387, 0x12a6, 0x01e5, 0x0a26, 
-  0x1ac7, 0x1246, 0x01c5, 0x09e6, 0x09e6, 0x0a06, 0x09e6, 0x0a06, 0x1ae8, 0x1266, 0x01a5, 0x09c6, 
-  0x01c5, 0x0a26, 0x1267, 0x0a27, 0x0a27, 0x0a07, 0x09e6, 0x09e7, 0x09e6, 0x0a07, 0x09e7, 0x0965, 
-  0x0944, 0x0124, 0x0924, 0x0944, 0x09c6, 0x09c6, 0x9575, 0xdfbe, 0xc6fb, 0xc6fb, 0xcf3c, 0xd77d, 
-  0x8d14, 0x3b0b, 0x1248, 0x01e6, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x09e7, 0x09e6, 
-  0x09e6, 0x01c6, 0x1267, 0x1ac7, 0x09e6, 0x01e6, 0x01e6, 0x0a06, 0x1b28, 0x12a7, 0x01c5, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x09e6, 0x01c6, 0x01c5, 0x6450, 0xd75c, 0xcf3c, 0xcefb, 0xcf3c, 
-  0xd75c, 0xbeb9, 0x43ec, 0x0225, 0x01c5, 0x01c6, 0x01a5, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01a5, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01a5, 
-  0x01c5, 0x01c5, 0x01c6, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09e6, 0x0a07, 0x01a5, 0x0185, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a27, 0x0a26, 0x0a26, 
-  0x0a27, 0x0a27, 0x0a27, 0x0a27, 0x0a27, 0x0a27, 0x0a27, 0x0a27, 0x0a26, 0x0a26, 0x0a27, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a27, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x01e6, 0x01e6, 0x01e6, 0x12a7, 0x12c7, 
-  0x01e6, 0x01e6, 0x09e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x1b08, 0x0a46, 0x0206, 
-  0x1b28, 0x01e5, 0x1287, 0x1ae8, 0x01c5, 0x1b08, 0x0a46, 0x01a6, 0x01e6, 0x01e6, 0x01e6, 0x1ae7, 
-  0x2368, 0x1286, 0x09e6, 0x09e6, 0x01e6, 0x0a66, 0x2387, 0x2ba7, 0x12a6, 0x09e6, 0x0a06, 0x1ac8, 
-  0x0a26, 0x01c6, 0x0a06, 0x09e6, 0x09e6, 0x01e6, 0x0a26, 0x1ae7, 0x1266, 0x01c6, 0x01c6, 0x01a5, 
-  0x1266, 0x1ae7, 0x0a06, 0x01e6, 0x0a07, 0x09e6, 0x01c6, 0x01a6, 0x09c6, 0x09e6, 0x01a6, 0x01c6, 
-  0x0a07, 0x09e6, 0x09c6, 0x0165, 0x6c71, 0xbeda, 0xd73c, 0xcf1c, 0xcf1c, 0xcf1c, 0xc6ba, 0x8d94, 
-  0x1206, 0x0144, 0x01e6, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 
-  0x09e6, 0x09e7, 0x01e6, 0x0a46, 0x12a7, 0x0a06, 0x01e6, 0x01e6, 0x0205, 0x1b08, 0x1287, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x09e6, 0x01c6, 0x01e6, 0x01e6, 0x0185, 0x2aca, 0x9575, 0xd73c, 0xcf3c, 0xc6fb, 0xd77d, 0xbe99, 
-  0x330a, 0x2b8a, 0x12e7, 0x0a26, 0x0a06, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x09c6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x09c6, 0x09c6, 0x01c6, 0x01c6, 0x09e6, 0x09e6, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a46, 0x0a46, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a46, 0x0a46, 0x1287, 0x12a7, 0x01e6, 
-  0x01e6, 0x09e6, 0x09e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x1b08, 0x0a67, 0x0206, 
-  0x1b28, 0x01e6, 0x12a7, 0x1ae8, 0x01c5, 0x1ae8, 0x0a67, 0x01c6, 0x09e6, 0x01c6, 0x1287, 0x2369, 
-  0x1286, 0x01e6, 0x09e6, 0x01c6, 0x0a66, 0x2388, 0x2388, 0x12c6, 0x01e6, 0x0a26, 0x1ac8, 0x0a46, 
-  0x01e6, 0x09e6, 0x09e6, 0x0a06, 0x01e6, 0x0a46, 0x1b08, 0x0a46, 0x01c6, 0x01c6, 0x01a5, 0x1266, 
-  0x1b07, 0x0a46, 0x09e6, 0x0a06, 0x09e6, 0x09e6, 0x01c6, 0x01a6, 0x01a6, 0x01a6, 0x2289, 0x2289, 
-  0x09e7, 0x09e6, 0x0124, 0x6430, 0xd77d, 0xd75c, 0xd73c, 0xd75d, 0xe7be, 0x9595, 0x0965, 0x1a87, 
-  0x1246, 0x01a5, 0x09e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0a47, 0x1ac7, 0x0a06, 0x01e6, 0x09e6, 0x0206, 0x1ae7, 0x1287, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x09c6, 0x01a6, 0x0165, 0x32ea, 0xc6fb, 0xdf7d, 0xd73c, 0xcf1b, 0xd75d, 0xbe99, 0x2aa9, 
-  0x01c4, 0x0225, 0x0a26, 0x01e6, 0x09e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 
-  0x09c6, 0x01a6, 0x0a06, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a46, 0x0a26, 0x0a27, 
-  0x0a47, 0x0a26, 0x0a26, 0x0a26, 0x0a27, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a46, 0x0a46, 0x0a26, 0x0a26, 0x0a47, 0x0a27, 0x0a27, 0x0a27, 0x0a27, 0x0a47, 0x0a47, 
-  0x1b48, 0x1b48, 0x1b28, 0x1b28, 0x1b28, 0x1b29, 0x1b29, 0x1b29, 0x1b29, 0x1b29, 0x1b29, 0x1b29, 
-  0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b48, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 
-  0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b48, 0x1b48, 0x1b48, 
-  0x1b48, 0x1b48, 0x1b48, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b29, 0x1b29, 0x1b29, 0x1b29, 0x1b28, 
-  0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b07, 0x0206, 0x0a06, 
-  0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a67, 0x0226, 
-  0x1b28, 0x01e5, 0x12a7, 0x1ae8, 0x01a5, 0x1b08, 0x0a67, 0x01c6, 0x01c6, 0x12a7, 0x2368, 0x0a66, 
-  0x09e6, 0x0a07, 0x01e6, 0x0a66, 0x2367, 0x23a8, 0x12c6, 0x01e6, 0x0a26, 0x1ae7, 0x0a26, 0x01c6, 
-  0x0a06, 0x09e6, 0x0a06, 0x01e6, 0x0a26, 0x1b07, 0x1286, 0x01e6, 0x09c6, 0x01c5, 0x12a6, 0x1b27, 
-  0x0a46, 0x01e6, 0x09e6, 0x09e7, 0x09e6, 0x01e6, 0x01c6, 0x01c6, 0x0185, 0x2228, 0xbedb, 0xc6db, 
-  0x01e6, 0x01c6, 0x6c30, 0xcf5c, 0xcf3c, 0xcf1b, 0xbeba, 0xb679, 0x7cf2, 0x1227, 0x01a5, 0x12a7, 
-  0x1aa7, 0x0185, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 
-  0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x0a47, 0x1ae8, 0x0a26, 0x01e6, 0x01e6, 0x0206, 0x1ae7, 
-  0x1286, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 
-  0x09e7, 0x0185, 0x0144, 0x432c, 0xc6fb, 0xcf3c, 0xcf1b, 0xd71c, 0xdf7d, 0xbeba, 0x330a, 0x0205, 
-  0x0a26, 0x01e6, 0x01e6, 0x09e7, 0x01e7, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09e6, 
-  0x01c6, 0x0a66, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 
-  0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1b08, 0x2308, 0x2308, 0x1b08, 0x2308, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0206, 0x0206, 0x0206, 0x0206, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0206, 0x0206, 0x0206, 
-  0x0206, 0x0206, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0206, 0x0206, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0226, 
-  0x1b28, 0x01e5, 0x12a7, 0x1ae8, 0x01a5, 0x1b08, 0x0a66, 0x01a6, 0x0a26, 0x2368, 0x12a7, 0x01c6, 
-  0x0a07, 0x01e6, 0x0a66, 0x2387, 0x23a8, 0x12c6, 0x01e5, 0x0a26, 0x12a7, 0x0a46, 0x01c5, 0x09e6, 
-  0x09e6, 0x0a06, 0x0206, 0x0a06, 0x1b07, 0x1286, 0x01e6, 0x09e6, 0x01c5, 0x12a6, 0x2368, 0x0a66, 
-  0x01e6, 0x0a06, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01c6, 0x09e6, 0x0124, 0x6c71, 0xdfbe, 0xcf1b, 
-  0x5c0f, 0x6c71, 0xdf9d, 0xcf3c, 0xcf1b, 0xd77d, 0x53ae, 0x0185, 0x01a6, 0x0206, 0x0206, 0x1ae8, 
-  0x1ac7, 0x01a5, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x09e6, 0x01e6, 0x01e7, 0x01e6, 0x0a47, 0x1ae7, 0x0a06, 0x01c6, 0x01e6, 0x0206, 
-  0x1b08, 0x12a7, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e7, 
-  0x0164, 0x1227, 0x6cb1, 0xc73c, 0xcf3c, 0xcf1b, 0xdf7d, 0xc71b, 0xaed8, 0x4bed, 0x01c5, 0x0206, 
-  0x01e5, 0x01c6, 0x01c6, 0x01e6, 0x09e6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x0a26, 0x1b08, 0x0a46, 0x01e5, 0x0205, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x09c6, 0x01e6, 
-  0x09e6, 0x01e6, 0x01e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 0x09e7, 0x09e7, 0x01e7, 0x09e7, 
-  0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0225, 
-  0x1b28, 0x01e5, 0x12a7, 0x1ae8, 0x01a5, 0x1ae8, 0x0a66, 0x01a6, 0x0a27, 0x1b08, 0x01c5, 0x09e6, 
-  0x01c6, 0x0a66, 0x23a8, 0x2bc8, 0x12c6, 0x01e5, 0x0a26, 0x1ae8, 0x0a46, 0x01c6, 0x09e6, 0x09e6, 
-  0x09e6, 0x01e6, 0x0a26, 0x1aa7, 0x1266, 0x01e6, 0x0a06, 0x01c5, 0x1286, 0x2368, 0x1287, 0x01e6, 
-  0x09e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01a6, 0x1a07, 0xb679, 0xd75c, 0xcf1b, 
-  0xdf9d, 0xdf9d, 0xcf3c, 0xcf3c, 0xd73c, 0xbeba, 0x1a28, 0x01a6, 0x0a07, 0x09e6, 0x01e5, 0x1307, 
-  0x1ae8, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 
-  0x01e6, 0x01e7, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0a67, 0x12a7, 0x01e6, 0x01c6, 0x01e6, 
-  0x0a06, 0x1ae7, 0x0a86, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01a6, 0x0123, 
-  0x3aca, 0xae58, 0xd77d, 0xcefb, 0xcf1b, 0xcf3c, 0xb699, 0x5c4f, 0x1307, 0x0a66, 0x0185, 0x0a46, 
-  0x12a7, 0x0a26, 0x01c5, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x09e6, 0x01c6, 0x0a26, 
-  0x12c7, 0x0a26, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x01e6, 0x01c6, 
-  0x01c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x1b28, 0x01e5, 0x12a7, 0x1ae8, 0x01a5, 0x1ae8, 0x0a66, 0x01a6, 0x0a27, 0x1b08, 0x01e6, 0x01c6, 
-  0x0a46, 0x2368, 0x23c8, 0x12e7, 0x01e6, 0x0a27, 0x1ac8, 0x0a47, 0x01c6, 0x0206, 0x09e6, 0x09e6, 
-  0x01c6, 0x0a06, 0x1ac7, 0x0a46, 0x01c5, 0x09e6, 0x01c5, 0x12a7, 0x2368, 0x0a86, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01a6, 0x1a48, 0x7cf3, 0xdf9d, 0xdf9e, 
-  0xcf1b, 0xcf1b, 0xcf3c, 0xcf3c, 0xd75c, 0xcefb, 0x2aa9, 0x01c6, 0x09e6, 0x09c6, 0x01c5, 0x12e7, 
-  0x1307, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 0x12c7, 0x09e6, 0x01c6, 
-  0x01e6, 0x0206, 0x1ae7, 0x1287, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x0a06, 0x01a5, 0x2aca, 0x642f, 
-  0xae58, 0xd77d, 0xcefb, 0xcefb, 0xd75d, 0xa5d6, 0x1a07, 0x0185, 0x0185, 0x01c5, 0x0a66, 0x2368, 
-  0x2388, 0x1b28, 0x0a46, 0x01c6, 0x09c6, 0x09e6, 0x01e6, 0x09c6, 0x09e6, 0x01c6, 0x0a26, 0x1b08, 
-  0x0a26, 0x01c6, 0x09c6, 0x01c6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 
-  0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x1b28, 0x01e5, 0x12a7, 0x1ae8, 0x01a5, 0x1ae8, 0x0a66, 0x01a6, 0x0a27, 0x1b08, 0x01c5, 0x0a46, 
-  0x2368, 0x23a8, 0x12c7, 0x01e6, 0x0a26, 0x1ac8, 0x0a27, 0x01c6, 0x09e7, 0x0a06, 0x0a06, 0x01e6, 
-  0x0a26, 0x1ae7, 0x0a46, 0x01c6, 0x09e6, 0x01c5, 0x12a7, 0x2388, 0x1286, 0x01e6, 0x01e7, 0x01e6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01c6, 0x01c6, 0x4bad, 0x6430, 
-  0xcf3c, 0xd75c, 0xcf3c, 0xd73c, 0xd71c, 0xdf9e, 0x3aeb, 0x0164, 0x09c6, 0x01c6, 0x01a5, 0x12a7, 
-  0x12e7, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 0x12c7, 0x0206, 
-  0x01c6, 0x01e6, 0x0206, 0x12a7, 0x1286, 0x01c6, 0x01e6, 0x0a06, 0x0185, 0x1a27, 0xae78, 0xdf9e, 
-  0xcf1c, 0xcefb, 0xcf1c, 0xdf7d, 0xbeba, 0x1a07, 0x0144, 0x01a6, 0x01c6, 0x01a6, 0x1b27, 0x2388, 
-  0x12a6, 0x2368, 0x1ae7, 0x01c6, 0x09e6, 0x09c6, 0x01e6, 0x01e7, 0x01c6, 0x0a46, 0x1b28, 0x0a46, 
-  0x09c6, 0x01e6, 0x01c5, 0x12a7, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b09, 0x1b09, 0x1b09, 0x1b09, 0x1b09, 0x1b09, 0x1b09, 0x1b09, 0x1b09, 0x1b09, 0x2309, 0x1b09, 
-  0x2309, 0x2309, 0x2309, 0x2309, 0x2309, 0x2309, 0x2309, 0x1b09, 0x1b08, 0x1ae9, 0x1ae9, 0x1ae8, 
-  0x1ae9, 0x1ae8, 0x1ae8, 0x1ae9, 0x1ae9, 0x1b08, 0x1b08, 0x1b28, 0x12c7, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x1b28, 0x01e5, 0x1287, 0x1ac8, 0x01a5, 0x1ae8, 0x0a66, 0x01a6, 0x0a27, 0x1b08, 0x01c5, 0x12c7, 
-  0x12e7, 0x1b08, 0x0a66, 0x0205, 0x1ae7, 0x0a46, 0x01c6, 0x09e7, 0x09e7, 0x09e7, 0x01e6, 0x0a26, 
-  0x1b28, 0x1287, 0x01e6, 0x01e6, 0x01c6, 0x12c7, 0x2388, 0x1286, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x0164, 0x0185, 
-  0x2248, 0x6430, 0xdf7d, 0xd73c, 0xd73c, 0xd75d, 0xae79, 0x2aa9, 0x0185, 0x09c6, 0x01a5, 0x12a7, 
-  0x12c7, 0x01a5, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c5, 0x01a5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 0x12c7, 
-  0x0205, 0x01e6, 0x01c6, 0x01c5, 0x12a7, 0x1287, 0x01c6, 0x01c5, 0x3b2b, 0xa617, 0xd75c, 0xcefb, 
-  0xcefb, 0xd75c, 0xd73c, 0x4bcd, 0x2b0a, 0x01a5, 0x01c6, 0x01a6, 0x01a6, 0x01a6, 0x1ae7, 0x2368, 
-  0x1b27, 0x2388, 0x1ae7, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x0a46, 0x1b48, 0x0a66, 0x01e6, 
-  0x01c6, 0x01e6, 0x1ae8, 0x1287, 0x0a66, 0x0a66, 0x0a66, 0x0a67, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 
-  0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a86, 0x0a67, 0x0a66, 0x0a67, 0x0a66, 0x0a87, 0x0a87, 0x0a67, 
-  0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a87, 0x0a87, 0x0a87, 0x1287, 0x1267, 0x1287, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a46, 0x0a66, 0x1287, 0x01e6, 0x01c6, 
-  0x01c6, 0x01e7, 0x01e6, 0x01c6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x1b28, 0x01e5, 0x1287, 0x1ac8, 0x01a5, 0x1ae8, 0x0a66, 0x01a6, 0x0a27, 0x1b08, 0x01c5, 0x12c7, 
-  0x0a86, 0x12c7, 0x1287, 0x1ae7, 0x0a66, 0x01c6, 0x09e7, 0x09e7, 0x09e7, 0x01e6, 0x0a06, 0x1b08, 
-  0x0a66, 0x01e6, 0x01e6, 0x01c5, 0x1286, 0x2388, 0x0a66, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 
-  0x0165, 0x11c6, 0x2228, 0x6c50, 0xd75d, 0xbeda, 0x432c, 0x1207, 0x09c6, 0x01a6, 0x0a26, 0x1b48, 
-  0x1b48, 0x0a26, 0x01a6, 0x01e6, 0x01e6, 0x0206, 0x01e6, 0x01c6, 0x01e6, 0x0206, 0x01e6, 0x01e6, 
-  0x01c5, 0x0205, 0x0205, 0x01c5, 0x01c6, 0x01c6, 0x01e5, 0x01e5, 0x01c6, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01c6, 0x0a46, 
-  0x1ae7, 0x0a06, 0x01c6, 0x01c6, 0x01e6, 0x1ac8, 0x1227, 0x1a27, 0xbeba, 0xdf7d, 0xcefb, 0xcefc, 
-  0xdf7d, 0xcefb, 0x434b, 0x01c5, 0x01c5, 0x01e7, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x0a26, 0x1b28, 
-  0x2389, 0x1b28, 0x0a26, 0x01c6, 0x01c6, 0x09e6, 0x01c6, 0x0a26, 0x1b28, 0x0a46, 0x01e6, 0x01e6, 
-  0x01e6, 0x1ae8, 0x1287, 0x01c5, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0226, 0x0a26, 0x0a26, 0x0a26, 0x0226, 0x0226, 0x0a26, 0x0a26, 
-  0x0226, 0x0a26, 0x0a26, 0x0a26, 0x0226, 0x0226, 0x0a26, 0x0a26, 0x0a06, 0x0a26, 0x0a26, 0x0a06, 
-  0x0a06, 0x0a26, 0x0226, 0x0226, 0x0226, 0x0226, 0x0a26, 0x0226, 0x01c5, 0x0a46, 0x12c7, 0x01e6, 
-  0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a67, 0x0206, 
-  0x1b08, 0x01e5, 0x1287, 0x1ac8, 0x01a5, 0x1ae8, 0x0a66, 0x01a6, 0x0a27, 0x1b08, 0x01c5, 0x12c7, 
-  0x12a6, 0x12e7, 0x1287, 0x1b08, 0x0a06, 0x01c6, 0x09e7, 0x09e7, 0x01e6, 0x0a26, 0x1b08, 0x12a7, 
-  0x01e6, 0x09e6, 0x09e6, 0x12a7, 0x2348, 0x0a46, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x09e7, 0x01c6, 0x0185, 0x09c6, 0x1a48, 0x1a68, 0x0185, 0x01c6, 0x09e6, 0x01c6, 0x0a86, 0x1b88, 
-  0x1b68, 0x0a46, 0x01a6, 0x01c6, 0x0a26, 0x2369, 0x0a06, 0x01a6, 0x12c7, 0x23a9, 0x0a46, 0x01c6, 
-  0x0a46, 0x1b68, 0x1b68, 0x1266, 0x01a6, 0x01a6, 0x12e7, 0x1b48, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 
-  0x0a67, 0x1ae8, 0x0a06, 0x01c6, 0x0185, 0x1a27, 0x95b6, 0xc6ba, 0xcf1b, 0xcf1b, 0xd73c, 0xd75d, 
-  0x9dd6, 0x2aa9, 0x01a5, 0x0a07, 0x0a07, 0x01e7, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x0206, 0x0a06, 0x01e6, 0x09e6, 0x09e7, 0x01c6, 0x0a06, 0x1ae7, 0x0a46, 0x01e6, 0x01e6, 0x0206, 
-  0x12c7, 0x1287, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ac8, 0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x12c8, 0x12c7, 0x12c7, 0x12c8, 0x12c7, 0x12c7, 
-  0x1ae8, 0x1ae8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x0a46, 0x01c5, 0x1267, 0x1ac8, 
-  0x09e6, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x1b28, 0x01e5, 0x1287, 0x1ae8, 0x01a5, 0x1ae8, 0x0a66, 0x01a6, 0x0a27, 0x1b08, 0x01c5, 0x12a7, 
-  0x12a6, 0x12c7, 0x1287, 0x1b08, 0x0a26, 0x01c6, 0x09e6, 0x01e6, 0x0a26, 0x1b08, 0x1287, 0x0206, 
-  0x0a06, 0x01e6, 0x12a7, 0x2368, 0x1266, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x09e7, 0x01c6, 0x0185, 0x01a6, 0x09c6, 0x01e6, 0x01e6, 0x01e6, 0x0ac6, 0x1ba8, 
-  0x1b68, 0x0a26, 0x01a6, 0x01a6, 0x0a06, 0x2349, 0x0206, 0x01c6, 0x1307, 0x23c9, 0x0a67, 0x01c6, 
-  0x0a46, 0x1b88, 0x1b88, 0x1266, 0x01a5, 0x01c6, 0x1308, 0x1b68, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x1267, 0x1287, 0x01a5, 0x2268, 0xb658, 0xdf7d, 0xd73c, 0xcefb, 0xcf3c, 0xd73c, 0x7451, 
-  0x0123, 0x0164, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 
-  0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x0a46, 0x1ae7, 0x0a06, 0x01a6, 0x01c6, 0x01e5, 0x1ac7, 
-  0x1287, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x1287, 0x1287, 0x1287, 0x0a87, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x0a87, 0x1287, 
-  0x1287, 0x1287, 0x0a86, 0x0a87, 0x0a87, 0x1287, 0x0a87, 0x1287, 0x1287, 0x0a87, 0x0a87, 0x1287, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x09e6, 0x1ac8, 0x0a46, 0x01c5, 0x1267, 
-  0x1ac7, 0x09e6, 0x01c6, 0x09c6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0205, 
-  0x1b28, 0x01e6, 0x12a7, 0x1ae8, 0x01a5, 0x1ae8, 0x0a66, 0x01a6, 0x0a26, 0x1b08, 0x01c5, 0x12c7, 
-  0x12a7, 0x12c7, 0x1287, 0x1ae8, 0x0a06, 0x09c6, 0x01a6, 0x0a06, 0x1b08, 0x1287, 0x01e6, 0x0a26, 
-  0x01e6, 0x12a7, 0x2388, 0x1266, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e7, 0x01e6, 0x12e7, 0x23e8, 
-  0x23a8, 0x0a46, 0x01a6, 0x01a6, 0x0a06, 0x2349, 0x0a06, 0x01a6, 0x12c7, 0x23a9, 0x0a47, 0x01a6, 
-  0x0a26, 0x2388, 0x23a9, 0x12a7, 0x01a5, 0x01e6, 0x1b48, 0x2388, 0x01e6, 0x01c6, 0x01c6, 0x09c6, 
-  0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x0a07, 0x01a5, 0x332a, 0x6cd1, 0xae38, 0xdf9d, 0xcf1b, 0xcf1b, 0xe79e, 0xd77c, 0x5c4f, 0x09c5, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a67, 0x0a67, 0x0a87, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x1267, 0x1267, 
-  0x1267, 0x1267, 0x1287, 0x1287, 0x0a87, 0x1b08, 0x0a66, 0x01e6, 0x01c6, 0x01c5, 0x12c7, 0x1287, 
-  0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x12e7, 0x12e7, 0x12e7, 0x12e7, 0x12e7, 0x12e7, 0x12c7, 0x12c7, 0x12c7, 0x12e7, 0x12c7, 0x12c7, 
-  0x12e7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12a7, 
-  0x1267, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x0a06, 0x1ac8, 0x1287, 0x01c6, 
-  0x1267, 0x1ac8, 0x0a06, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x1b08, 0x0a66, 0x0205, 
-  0x1b08, 0x01e6, 0x12a7, 0x1ae8, 0x01a5, 0x1ae8, 0x0a66, 0x01a6, 0x0a27, 0x1b08, 0x01c5, 0x12c7, 
-  0x12a7, 0x12c7, 0x0a87, 0x1ae8, 0x0a26, 0x01a6, 0x0a06, 0x1ac7, 0x0a67, 0x01e6, 0x09e6, 0x01e6, 
-  0x12c7, 0x2389, 0x1287, 0x01e6, 0x01e7, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x0a66, 0x1307, 
-  0x12e7, 0x0a26, 0x01a6, 0x01c6, 0x0206, 0x12a7, 0x01e6, 0x01a6, 0x0a46, 0x12c7, 0x0a06, 0x01a6, 
-  0x09e6, 0x12c7, 0x12e7, 0x0a46, 0x01c6, 0x01e6, 0x12c7, 0x12c7, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 
-  0x0124, 0x0185, 0xa5f7, 0xdfbe, 0xd73c, 0xd71c, 0xdf5d, 0xdf5d, 0x8cf3, 0x53ee, 0x0a66, 0x12c7, 
-  0x12a7, 0x1287, 0x1287, 0x1287, 0x1287, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12c7, 
-  0x12a7, 0x12a7, 0x12a7, 0x12c7, 0x1ae8, 0x0a46, 0x01e6, 0x09e6, 0x01e5, 0x12c7, 0x12a7, 0x01c5, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x09e7, 0x01e7, 0x09e7, 0x0a07, 0x01c6, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c6, 0x01c5, 
-  0x1267, 0x1286, 0x01e5, 0x09e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x0a06, 0x1ac8, 0x1267, 
-  0x01c6, 0x1247, 0x1ae8, 0x09e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x1b08, 0x0a67, 0x0206, 
-  0x1b28, 0x01e6, 0x1287, 0x1ae8, 0x01a5, 0x1b08, 0x0a66, 0x01c6, 0x0a27, 0x1b08, 0x01c5, 0x12a7, 
-  0x12a7, 0x12c7, 0x0a87, 0x1ae8, 0x0a06, 0x01c6, 0x1ac7, 0x12a7, 0x01a6, 0x01c6, 0x01c5, 0x12a7, 
-  0x2388, 0x1287, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x0185, 0x0185, 0x01a5, 0x01a5, 
-  0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01e5, 0x01e5, 0x01c5, 0x01a5, 0x01a6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x09c6, 0x0165, 0x0944, 
-  0x6430, 0x7cd2, 0xd75d, 0xcf1c, 0xcf1c, 0xdf5d, 0xae58, 0x646f, 0x0164, 0x0143, 0x01c5, 0x01e5, 
-  0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a6, 0x01c6, 0x01c5, 0x01a5, 0x01c5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01a5, 0x01c6, 0x01e6, 0x01c5, 0x12a7, 0x1287, 0x01c5, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x09e7, 0x09e7, 0x01e6, 0x09c6, 0x8533, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b09, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x0a26, 0x01e6, 
-  0x01e6, 0x1aa7, 0x1ac7, 0x01c5, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x09e7, 0x01c6, 0x0a26, 0x1ac8, 
-  0x1267, 0x01c5, 0x1267, 0x12a7, 0x09e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x1b08, 0x0a67, 0x0205, 
-  0x1b28, 0x01e6, 0x1287, 0x1ae8, 0x01a5, 0x1b08, 0x0a67, 0x01a6, 0x0a27, 0x1b08, 0x01c5, 0x12c7, 
-  0x12a7, 0x12c7, 0x1287, 0x1ae8, 0x0a06, 0x0a26, 0x1ae8, 0x01c6, 0x01c6, 0x01c5, 0x1286, 0x2348, 
-  0x12a7, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x09e5, 0x12e7, 0x1307, 
-  0x1b27, 0x1b27, 0x1327, 0x1b27, 0x1b27, 0x1b27, 0x1b27, 0x1b07, 0x1b07, 0x1307, 0x1307, 0x1327, 
-  0x1327, 0x1b27, 0x1347, 0x1b47, 0x1347, 0x1347, 0x1b48, 0x1b27, 0x12e7, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x0185, 0x0144, 0x7cd2, 
-  0xd79d, 0xd77d, 0xcf1b, 0xcf1c, 0xcf3c, 0xdf9e, 0x544e, 0x02a6, 0x0a46, 0x01c5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 0x01e6, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01e5, 0x12a7, 0x1266, 0x01e6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c7, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x09e6, 0x01c6, 0x01c6, 0x01a5, 0x7cf3, 0xd77d, 
-  0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 
-  0x0a66, 0x0a66, 0x0a46, 0x0a66, 0x0a66, 0x0a66, 0x0a46, 0x0a46, 0x0a67, 0x1267, 0x1ae7, 0x0a26, 
-  0x01a5, 0x09c5, 0x1aa7, 0x1ac7, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x09e7, 0x01c6, 0x09e6, 
-  0x1ae8, 0x1267, 0x0185, 0x0a26, 0x1ac7, 0x09e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x1b08, 0x0a66, 0x0205, 
-  0x1b28, 0x01e5, 0x1287, 0x1ae8, 0x01c5, 0x1b08, 0x0a67, 0x01a6, 0x0a27, 0x1b08, 0x01c5, 0x12a7, 
-  0x12a7, 0x12c7, 0x1287, 0x1b08, 0x0a26, 0x0a46, 0x1ae8, 0x01a6, 0x0a06, 0x12c7, 0x2348, 0x0a67, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0a26, 0x1b27, 0x23a8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x1bc8, 0x23c8, 0x1b88, 0x01e6, 0x01a6, 0x01a6, 
-  0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x09e7, 0x0a07, 0x09e6, 0x74b1, 0xa617, 0xcf3c, 
-  0xcf1b, 0xc6fb, 0xcf3c, 0xcf3c, 0xcf1b, 0xcf3c, 0x3b8b, 0x0ac6, 0x1b28, 0x1ae7, 0x1b08, 0x1b28, 
-  0x1b28, 0x1b28, 0x1b08, 0x1ae7, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ac8, 0x1ac7, 0x1ac7, 0x1ac8, 0x1ae8, 
-  0x1ae8, 0x1ac8, 0x1ac8, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1287, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x09e6, 0x01c6, 0x09a6, 0x0985, 0x74b2, 0xdf7d, 0xcf1c, 
-  0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x12e7, 0x1ae7, 0x1ae8, 0x12e8, 0x1ae8, 0x1ae8, 0x1b08, 
-  0x1b08, 0x1b08, 0x1ae8, 0x1b08, 0x1b08, 0x1ae8, 0x0a26, 0x01c5, 0x01e6, 0x01e5, 0x0a26, 0x1ac7, 
-  0x0a46, 0x01c5, 0x01c5, 0x1286, 0x1286, 0x01c5, 0x09e6, 0x09c7, 0x09e6, 0x09e6, 0x09e6, 0x01c6, 
-  0x0a06, 0x1ac7, 0x0a66, 0x01c5, 0x1246, 0x1ae8, 0x0a26, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x1b08, 0x0a66, 0x0205, 
-  0x1b28, 0x01e5, 0x1287, 0x1ae8, 0x01c5, 0x1ae8, 0x0a66, 0x01a6, 0x0a26, 0x1b08, 0x01c5, 0x12a7, 
-  0x12a7, 0x12e7, 0x12a7, 0x1b08, 0x0a26, 0x0a46, 0x1b08, 0x01c5, 0x0a67, 0x12a7, 0x0a26, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x1b48, 0x1ba8, 0x1ba8, 0x1ba8, 
-  0x1ba8, 0x1ba8, 0x1ba8, 0x1ba8, 0x1ba8, 0x1ba8, 0x1ba8, 0x1ba8, 0x1ba8, 0x1ba8, 0x1ba8, 0x1ba8, 
-  0x1ba8, 0x1bc8, 0x1ba8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1b88, 0x0206, 0x01c6, 0x01c5, 
-  0x01c5, 0x01c5, 0x01a6, 0x01a6, 0x01c6, 0x0a07, 0x0a07, 0x01c5, 0x6c91, 0xdf9e, 0xdf7d, 0xcf1c, 
-  0xcf1c, 0xd75c, 0xcf3c, 0x7471, 0x2227, 0x2248, 0x0a06, 0x0226, 0x0a46, 0x0a26, 0x0a06, 0x0a26, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a46, 0x0a26, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x09e7, 0x0165, 0x5bce, 0xbeba, 0xcefb, 0xd73d, 0xd75d, 
-  0x0206, 0x0206, 0x0206, 0x0a06, 0x0206, 0x0206, 0x0a06, 0x0206, 0x0a06, 0x0206, 0x0206, 0x0206, 
-  0x0a06, 0x0206, 0x0206, 0x0a06, 0x0206, 0x0a26, 0x0a67, 0x0a26, 0x0206, 0x01e6, 0x01c6, 0x0a26, 
-  0x1b08, 0x0a46, 0x01a5, 0x01a5, 0x12a7, 0x12a7, 0x01e6, 0x09e6, 0x09c7, 0x09e6, 0x01c6, 0x09c6, 
-  0x01c6, 0x01e6, 0x1b08, 0x0a66, 0x01e5, 0x1287, 0x1b08, 0x0206, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x1b08, 0x0a66, 0x0205, 
-  0x1b28, 0x01e6, 0x12a7, 0x1ae8, 0x01a5, 0x1b08, 0x0a67, 0x01a6, 0x0a26, 0x1b08, 0x01c5, 0x12c7, 
-  0x12a7, 0x12e7, 0x12a7, 0x1b08, 0x0a26, 0x0a67, 0x1b08, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e7, 0x01e7, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x0206, 0x0a26, 0x0a26, 0x0a46, 0x0206, 0x01e6, 0x1b88, 0x1ba8, 0x1ba8, 0x1ba8, 
-  0x1ba8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x0206, 0x0a66, 0x1b68, 
-  0x1b27, 0x1b47, 0x1266, 0x09e6, 0x01a6, 0x0185, 0x0185, 0x74b1, 0xd75d, 0xcf3c, 0xcf1c, 0xd73c, 
-  0xd73d, 0xc6ba, 0x7c91, 0x0123, 0x01a5, 0x01a5, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01a5, 0x01a5, 
-  0x01c5, 0x0226, 0x0a26, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e7, 0x01e7, 0x01e6, 0x09e6, 0x01e6, 0x0164, 0x5bef, 0xcf3c, 0xcf3c, 0xcefb, 0xcf3c, 0xbe9a, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x0a47, 0x2368, 0x12c7, 0x01c6, 0x01c6, 0x01c5, 
-  0x0a06, 0x1ae8, 0x1266, 0x01c5, 0x01e6, 0x1ac7, 0x1287, 0x01e6, 0x09e7, 0x09e6, 0x09c6, 0x09e6, 
-  0x09e6, 0x01c6, 0x01e6, 0x12c7, 0x1287, 0x01e6, 0x1267, 0x1ac7, 0x0a26, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x1b08, 0x0a66, 0x0205, 
-  0x1b28, 0x01e6, 0x12a7, 0x1b08, 0x01c5, 0x1b08, 0x0a67, 0x01a6, 0x0a27, 0x1b08, 0x01c5, 0x12c7, 
-  0x12a7, 0x12e8, 0x12a7, 0x1b08, 0x0a26, 0x0a67, 0x1b28, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01c6, 0x1286, 0x23a8, 0x2388, 0x23a9, 0x0a67, 0x0206, 0x1ba8, 0x1bc8, 0x1ba8, 0x1ba8, 
-  0x1bc8, 0x1ba8, 0x1ba8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1b88, 0x01e6, 0x0aa7, 0x2409, 
-  0x23c8, 0x1ba8, 0x1b68, 0x12e7, 0x09e5, 0x2aa9, 0x642f, 0xd79d, 0xcf3c, 0xcf1b, 0xd73c, 0xd75c, 
-  0xae37, 0x11c6, 0x0144, 0x0185, 0x0185, 0x01a6, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01a5, 0x01a5, 
-  0x1ac7, 0x2388, 0x2388, 0x12a7, 0x0206, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 
-  0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 
-  0x01e7, 0x01e7, 0x0a07, 0x0a07, 0x0185, 0x53ae, 0xcf3c, 0xc73c, 0xc6fb, 0xd75d, 0x9d96, 0x19c7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x0a46, 0x1b28, 0x1287, 0x01c6, 0x01c6, 
-  0x01c6, 0x0a06, 0x1ae8, 0x0a46, 0x01c6, 0x01e6, 0x12a7, 0x1287, 0x01c6, 0x09c6, 0x09e6, 0x09e6, 
-  0x09e7, 0x09e7, 0x01e6, 0x0a26, 0x1b08, 0x1267, 0x01c6, 0x1267, 0x12a7, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x1b08, 0x0a66, 0x0205, 
-  0x1b28, 0x01e6, 0x12a7, 0x1b08, 0x01c5, 0x1b08, 0x0a67, 0x01a6, 0x0a27, 0x1b08, 0x01c5, 0x12c7, 
-  0x12a7, 0x1ae7, 0x12a7, 0x1b28, 0x0226, 0x0a66, 0x1b28, 0x01e5, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01c6, 0x0a46, 0x1b07, 0x1ae7, 0x1ae7, 0x09e6, 0x01e6, 0x1ba8, 0x1bc8, 0x1ba8, 0x1bc8, 
-  0x1ba8, 0x1ba8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1b88, 0x01e5, 0x0aa7, 0x1387, 
-  0x0b26, 0x1ba8, 0x0264, 0x0183, 0x540e, 0xc73c, 0xcf5c, 0xcf3c, 0xcf1c, 0xd77d, 0xe7be, 0x6cf1, 
-  0x2368, 0x12e7, 0x0a86, 0x0a46, 0x0a26, 0x0a46, 0x1247, 0x1267, 0x1287, 0x1287, 0x1267, 0x1ac7, 
-  0x2367, 0x1ae7, 0x1b47, 0x2368, 0x0226, 0x01c6, 0x01c6, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e7, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 
-  0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x0a07, 0x01a5, 0x01a5, 0x6450, 0xd77d, 0xcf1c, 0xc6fb, 0xcf5c, 0xa5f7, 0x11a6, 0x0164, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x09e7, 0x01c6, 0x0a26, 0x1b07, 0x1267, 0x01c6, 
-  0x01e6, 0x01c5, 0x0a26, 0x1ae8, 0x0a46, 0x01e6, 0x01e5, 0x12a7, 0x12a7, 0x01c6, 0x09e6, 0x09e7, 
-  0x09e6, 0x09e7, 0x09e7, 0x09c6, 0x0a06, 0x1aa8, 0x1267, 0x01c5, 0x0a46, 0x1aa7, 0x01e6, 0x01c6, 
-  0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0205, 
-  0x1b28, 0x01e6, 0x12a7, 0x1ae8, 0x01c5, 0x1b08, 0x0a87, 0x01a6, 0x0a06, 0x1b08, 0x01c5, 0x12c7, 
-  0x12c7, 0x12e7, 0x0aa7, 0x1b28, 0x0226, 0x0a66, 0x1b28, 0x01e5, 0x01e7, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01c5, 0x01c5, 0x01a5, 0x01a5, 0x01e5, 0x1b88, 0x1bc8, 0x1ba8, 0x1bc8, 
-  0x1ba8, 0x1ba8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1b68, 0x01c5, 0x0122, 0x2ae9, 
-  0x7d52, 0x2328, 0x4bcc, 0x74b1, 0xcf3c, 0xcf3c, 0xcf1b, 0xc6fb, 0xdf9d, 0xae17, 0x7491, 0x12a7, 
-  0x12e7, 0x1b28, 0x1b08, 0x12c7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12c7, 0x12c7, 0x1ae7, 0x1b27, 
-  0x2368, 0x12a6, 0x1b07, 0x2368, 0x0a26, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c7, 0x01e7, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x0207, 0x01e7, 0x01e6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01a6, 0x01a5, 
-  0x01c6, 0x0185, 0x53ce, 0x7cf3, 0xdf7d, 0xdf5d, 0xcf1b, 0xd77d, 0xae17, 0x1185, 0x0103, 0x0145, 
-  0x01c6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x01e6, 0x09e6, 0x01c6, 0x0a26, 0x2328, 0x1287, 
-  0x01c6, 0x01c6, 0x01c6, 0x0a06, 0x1ac7, 0x0a46, 0x01c6, 0x09e5, 0x1aa7, 0x1287, 0x01c5, 0x01e6, 
-  0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x01e6, 0x09e6, 0x12c8, 0x1287, 0x01e6, 0x1287, 0x1ae8, 0x0a86, 
-  0x0225, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0205, 
-  0x1b28, 0x01e6, 0x12a7, 0x1ae8, 0x01c5, 0x1b08, 0x1287, 0x01a6, 0x0a26, 0x1b08, 0x01c5, 0x12c7, 
-  0x12c7, 0x12e7, 0x0aa7, 0x1b08, 0x0226, 0x0a66, 0x1b28, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x0206, 0x0206, 0x01e6, 0x01c6, 0x01e6, 0x1b88, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x23c8, 0x1367, 0x2ae9, 0x640f, 0x9595, 
-  0xdfff, 0x8d54, 0xc6fb, 0xe7df, 0xcf3c, 0xd73c, 0xd77d, 0xdfde, 0xa617, 0x21e7, 0x0103, 0x0a06, 
-  0x0206, 0x0206, 0x01e6, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a6, 0x01c5, 0x0a46, 
-  0x2348, 0x2389, 0x2368, 0x12c7, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x0a06, 0x12e8, 0x1ae8, 0x12c8, 0x12c8, 0x12c8, 0x1ac8, 0x1ac8, 0x12c8, 0x12c8, 0x12c7, 0x12a7, 
-  0x0a46, 0x5c0f, 0xd73c, 0xe7be, 0xcf1c, 0xcf3c, 0xe7be, 0xc6ba, 0x438c, 0x1266, 0x1a87, 0x1a87, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x0a47, 0x2b69, 
-  0x1287, 0x01c6, 0x09e6, 0x01c6, 0x0a26, 0x1ae8, 0x0a06, 0x01c5, 0x01e5, 0x1287, 0x1287, 0x01e6, 
-  0x01e6, 0x09e6, 0x09e6, 0x09c7, 0x09e6, 0x01c6, 0x0a07, 0x1ae8, 0x1267, 0x01c5, 0x0a66, 0x1b28, 
-  0x1b48, 0x12e7, 0x1307, 0x1307, 0x1308, 0x1308, 0x1308, 0x1308, 0x1b08, 0x12e8, 0x1b08, 0x0a26, 
-  0x01a6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0205, 
-  0x1b28, 0x01e5, 0x1287, 0x1ae8, 0x01c5, 0x0a26, 0x0206, 0x01c5, 0x0a26, 0x1b28, 0x01c5, 0x12c7, 
-  0x12a7, 0x12e7, 0x0aa7, 0x1b08, 0x0226, 0x0a46, 0x1b28, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x0a46, 0x1b27, 0x1307, 0x1307, 0x0206, 0x01e5, 0x1b88, 0x1bc8, 0x1ba8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1be9, 0x1346, 0x7551, 0xefff, 0xc75c, 
-  0xc71b, 0xd79d, 0xd75c, 0xcf1c, 0xd73c, 0xdf9d, 0xa5d6, 0x4b6d, 0x2268, 0x0123, 0x09c6, 0x01c6, 
-  0x0206, 0x0206, 0x0206, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x09c6, 0x09c6, 0x09e6, 0x0206, 
-  0x0a26, 0x0a46, 0x0a46, 0x01e5, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01a5, 0x0a06, 
-  0x1b28, 0x12e8, 0x12a7, 0x12a7, 0x12a7, 0x1287, 0x1287, 0x1287, 0x1287, 0x1267, 0x1287, 0x09e5, 
-  0x5c2f, 0xcf7d, 0xcf3c, 0xc6fb, 0xd75c, 0xc6da, 0x5c0f, 0x3b4b, 0x0a67, 0x12a8, 0x1287, 0x12a7, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x09e7, 0x01c6, 0x0a47, 
-  0x2369, 0x12a7, 0x01c6, 0x09e6, 0x01e6, 0x0a26, 0x1ae8, 0x0a06, 0x01c6, 0x01e5, 0x12a7, 0x1287, 
-  0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x09e6, 0x09e7, 0x09c7, 0x0a06, 0x1ae8, 0x1287, 0x01a5, 0x0a06, 
-  0x1287, 0x2369, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a67, 0x0a67, 0x0a67, 0x0a46, 0x12c7, 0x2348, 
-  0x0a26, 0x01a5, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b08, 0x0a66, 0x0206, 
-  0x1b28, 0x01c5, 0x1267, 0x1ac8, 0x01c5, 0x01c5, 0x1287, 0x12c7, 0x0a66, 0x1b28, 0x01c5, 0x12c7, 
-  0x12c7, 0x12e7, 0x0aa7, 0x1b08, 0x0226, 0x0a46, 0x1b08, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e7, 
-  0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e7, 0x01c6, 0x0a87, 0x23a8, 0x1b88, 0x23a8, 0x0a66, 0x01e5, 0x1b88, 0x1bc8, 0x1ba8, 0x1bc8, 
-  0x1bc8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1b68, 0x1a66, 0x7d12, 0xd77d, 
-  0xcf3c, 0xcf1b, 0xcf1b, 0xcf3c, 0xcf1b, 0xe7be, 0x7c71, 0x0102, 0x01e5, 0x09c6, 0x01a6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01c5, 
-  0x1286, 0x1b27, 0x1b07, 0x0205, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x12a7, 0x1ae7, 
-  0x0a67, 0x0206, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01a6, 0x01a6, 0x01a5, 0x0164, 0x4b8d, 
-  0xc6fb, 0xc71b, 0xc71b, 0xcf5c, 0xcf1b, 0x42eb, 0x0164, 0x01e6, 0x0a07, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 
-  0x1247, 0x2328, 0x12a7, 0x01e6, 0x01e6, 0x01e6, 0x0a26, 0x1aa7, 0x0a06, 0x01e6, 0x0206, 0x12a7, 
-  0x1287, 0x01e6, 0x01e7, 0x09e7, 0x01e6, 0x09e6, 0x09e7, 0x01a6, 0x12e8, 0x1287, 0x01a5, 0x01c6, 
-  0x01c6, 0x1246, 0x1266, 0x01a5, 0x01e5, 0x01e6, 0x0206, 0x01e6, 0x01e6, 0x01c6, 0x01e5, 0x1ae7, 
-  0x2368, 0x1ae7, 0x0a26, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1b28, 0x0a87, 0x0206, 
-  0x2328, 0x01c5, 0x1267, 0x1aa8, 0x01a5, 0x0a46, 0x2347, 0x2368, 0x0a86, 0x1b28, 0x01e5, 0x12e7, 
-  0x12c7, 0x12e7, 0x0aa7, 0x1b08, 0x0226, 0x0a46, 0x1b08, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x0a67, 0x1b68, 0x1b48, 0x2368, 0x0a46, 0x0206, 0x1b88, 0x1bc8, 0x1ba8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1ba8, 0x1bc8, 0x1ba8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1b68, 0x01c5, 0x1287, 0x7d53, 
-  0xcf7d, 0xcf5c, 0xd75d, 0xcf1c, 0xcf1b, 0xcf3c, 0xd73c, 0x644f, 0x01a4, 0x09e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x0206, 0x0206, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a07, 0x0a07, 0x0a07, 0x01e6, 0x1266, 
-  0x2368, 0x23a8, 0x23a8, 0x2348, 0x0a26, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x1ac7, 0x2348, 0x0a47, 
-  0x01e6, 0x0206, 0x0206, 0x0207, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x0165, 0x3b0b, 0xb679, 0xbedb, 
-  0xcf3c, 0xcf3c, 0xc71b, 0xb679, 0x3b0b, 0x0185, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x09e7, 0x0a07, 
-  0x01c6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x09e6, 
-  0x01c6, 0x1267, 0x2368, 0x12c7, 0x01c6, 0x09e6, 0x01e6, 0x0a06, 0x1aa7, 0x0a26, 0x01e6, 0x01e6, 
-  0x12a7, 0x1287, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x12e7, 0x0a87, 0x01c6, 0x09e7, 
-  0x09c7, 0x01c6, 0x09e5, 0x12a7, 0x1b48, 0x23a8, 0x0aa7, 0x01e7, 0x09e7, 0x09c6, 0x01e6, 0x1ae7, 
-  0x2368, 0x1ae7, 0x1b07, 0x0a26, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x1b28, 0x0a87, 0x0206, 
-  0x1b08, 0x01c6, 0x1267, 0x1287, 0x1266, 0x2347, 0x1b47, 0x2347, 0x2348, 0x1b28, 0x01c5, 0x12c7, 
-  0x12c7, 0x12c7, 0x0a87, 0x1b08, 0x0206, 0x0a46, 0x1b08, 0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x0206, 0x0206, 0x0a06, 0x01e6, 0x0206, 0x1b88, 0x1bc8, 0x1ba8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1ba8, 0x1bc8, 0x1ba8, 0x1ba8, 0x1bc8, 0x1bc8, 
-  0x1ba8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1b88, 0x0a06, 0x0a86, 0x1b48, 
-  0x2b49, 0x8574, 0xa658, 0xc73c, 0xd77d, 0xcefb, 0xe7be, 0x7d33, 0x0a86, 0x1ae8, 0x12e8, 0x12e8, 
-  0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 
-  0x2368, 0x2388, 0x23a8, 0x2368, 0x0226, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x12e7, 0x2388, 0x0a47, 0x01a5, 
-  0x01e6, 0x09e6, 0x01e7, 0x0a07, 0x0a07, 0x0a07, 0x01e6, 0x0185, 0x32eb, 0xbeba, 0xcf7d, 0xc71b, 
-  0xd75c, 0xae59, 0x4b4d, 0x11c6, 0x0185, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x1267, 0x2368, 0x12a7, 0x01c6, 0x09c6, 0x01e6, 0x0a46, 0x1ac8, 0x0a26, 0x01c6, 
-  0x01e5, 0x12a7, 0x1287, 0x09e7, 0x01e6, 0x01c6, 0x01c6, 0x01c5, 0x1b08, 0x12c7, 0x01c6, 0x09e7, 
-  0x09c7, 0x01c6, 0x01e6, 0x1ac7, 0x2368, 0x1b68, 0x12c7, 0x0a07, 0x0a07, 0x01c6, 0x1287, 0x23a8, 
-  0x1286, 0x01a5, 0x1ac7, 0x0a27, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x0a26, 0x1b08, 0x0a46, 0x0a26, 
-  0x2328, 0x01c6, 0x1267, 0x1267, 0x1265, 0x2367, 0x1286, 0x1b27, 0x2367, 0x1287, 0x01c5, 0x12c7, 
-  0x12c7, 0x12c7, 0x0a87, 0x1b08, 0x0206, 0x0a26, 0x1b08, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0206, 0x1b88, 0x1bc8, 0x1ba8, 0x1ba8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1ba8, 0x1ba8, 0x1ba8, 0x1ba8, 0x1ba8, 
-  0x1ba8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1b88, 0x0206, 0x0a27, 0x0a06, 
-  0x0144, 0x01a5, 0x09e6, 0x84f3, 0xae59, 0xdfbe, 0xdf7e, 0x430b, 0x01a4, 0x0a06, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 
-  0x12a6, 0x1b47, 0x1b27, 0x0a45, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0a67, 0x2369, 0x1b48, 0x1267, 0x01c6, 0x01c6, 
-  0x01c6, 0x09e6, 0x09e6, 0x0a07, 0x0a27, 0x0a48, 0x2b0b, 0x53ae, 0xc6fb, 0xd75d, 0xc6fb, 0xcf5c, 
-  0xcf1c, 0x3aeb, 0x0124, 0x01a6, 0x09c6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e7, 
-  0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01e6, 0x09e6, 0x01e6, 0x1266, 0x2348, 0x1286, 0x01a5, 0x01c6, 0x01e6, 0x0a27, 0x1aa7, 0x0a26, 
-  0x01c5, 0x01e6, 0x12a7, 0x1267, 0x01e6, 0x09e6, 0x09e6, 0x01c6, 0x12c7, 0x0a87, 0x01c6, 0x01c6, 
-  0x09c6, 0x01c6, 0x0a47, 0x2328, 0x1266, 0x01a5, 0x1ae8, 0x0a47, 0x0a07, 0x09e7, 0x12a7, 0x2bc9, 
-  0x1286, 0x01a5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x0a06, 0x1b28, 0x1287, 0x01c6, 0x0a26, 
-  0x2329, 0x01e6, 0x1287, 0x1287, 0x09e5, 0x1ae7, 0x2347, 0x2347, 0x12a7, 0x0206, 0x01c5, 0x12c7, 
-  0x12c7, 0x12c7, 0x1287, 0x1b08, 0x0206, 0x0a46, 0x1b08, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e7, 0x01e6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x09c6, 0x09e7, 0x09e6, 0x01e6, 0x01c6, 0x09e6, 0x1b88, 0x1bc8, 0x1ba8, 0x1ba8, 
-  0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1ba8, 0x1ba8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1b88, 0x0a06, 0x01c6, 0x0185, 
-  0x0165, 0x0165, 0x01c6, 0x0184, 0x2228, 0x8d14, 0x6bef, 0x0144, 0x09c6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x01c6, 0x09e6, 0x09e6, 0x09e7, 0x0a07, 0x0207, 
-  0x1286, 0x12a6, 0x0a65, 0x01e5, 0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01c6, 0x1287, 0x2368, 0x0a46, 0x01e6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x09e6, 0x0a27, 0x01a5, 0x9df7, 0xefff, 0xd73c, 0xcf1c, 0xdf7d, 0xc6fb, 
-  0x434c, 0x0185, 0x09c6, 0x09c7, 0x09c6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x09e6, 0x01c6, 0x0a66, 0x2368, 0x12a7, 0x01c6, 0x09e6, 0x09e7, 0x0a26, 0x12a7, 
-  0x0a26, 0x01a5, 0x01c6, 0x0a26, 0x09e6, 0x09e7, 0x09e7, 0x01c6, 0x0a67, 0x0a26, 0x01c6, 0x01c6, 
-  0x09c6, 0x01c6, 0x0a26, 0x2369, 0x1246, 0x0165, 0x0a06, 0x09e6, 0x09e7, 0x0a07, 0x0a47, 0x1ae7, 
-  0x0a46, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x0a06, 0x1aa7, 0x0a47, 0x01e6, 0x01e6, 0x12a7, 
-  0x2308, 0x01e6, 0x1287, 0x1ae8, 0x0185, 0x0a06, 0x1ae7, 0x12a6, 0x01e6, 0x0207, 0x01c6, 0x12c7, 
-  0x12a7, 0x12c8, 0x1287, 0x1ae8, 0x0a06, 0x0a46, 0x1b08, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01a5, 0x01a6, 0x01c6, 0x09e6, 0x1b88, 0x1bc8, 0x1ba8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1ba8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1b68, 0x01c6, 0x09c6, 0x1246, 
-  0x1226, 0x1246, 0x01e6, 0x01c5, 0x0185, 0x00e2, 0x00e2, 0x0185, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 
-  0x01a6, 0x01a6, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a6, 0x01a5, 0x01a6, 0x01c6, 0x01e6, 0x0aa7, 
-  0x2388, 0x2388, 0x2348, 0x1286, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x01c6, 0x1287, 0x1b28, 0x0206, 0x0a07, 0x09e6, 0x01e6, 
-  0x01c6, 0x01a6, 0x09c6, 0x0144, 0x09e7, 0x3b4c, 0xb679, 0xd75d, 0xcefb, 0xdf7d, 0xcedb, 0x432c, 
-  0x0185, 0x09e7, 0x09c6, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x09e6, 0x01e6, 0x1267, 0x2368, 0x12c7, 0x0a06, 0x0a06, 0x01e6, 0x0a06, 
-  0x1aa7, 0x0a06, 0x01a5, 0x01c6, 0x01c6, 0x09e7, 0x09e7, 0x01c6, 0x1b08, 0x12a7, 0x01a6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x1266, 0x1ae7, 0x0a26, 0x01a6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01a6, 0x0a05, 0x1ac7, 0x0a26, 0x0185, 0x01a5, 0x1287, 0x12e7, 
-  0x0a67, 0x01e6, 0x12a8, 0x1b08, 0x01e6, 0x01c5, 0x12c7, 0x0205, 0x01c6, 0x09e7, 0x01c6, 0x12c7, 
-  0x12c7, 0x12c7, 0x1287, 0x1ae8, 0x0a06, 0x0a46, 0x1b08, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 
-  0x09e6, 0x01e6, 0x0a46, 0x12c7, 0x1286, 0x12a7, 0x0a06, 0x01e6, 0x1ba8, 0x1bc8, 0x1ba8, 0x1bc8, 
-  0x1bc8, 0x1ba8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1b68, 0x01a5, 0x0a26, 0x2b89, 
-  0x2389, 0x2b89, 0x1ae8, 0x1ac7, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ae8, 0x1ae8, 0x1308, 0x23a8, 
-  0x1b47, 0x0a45, 0x1b07, 0x2388, 0x0a26, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01e7, 0x01e7, 0x01e6, 
-  0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e7, 0x09e7, 0x09e7, 0x01e7, 0x09e6, 0x01a6, 0x1267, 0x1b08, 0x0206, 0x0a07, 0x0207, 0x01e7, 
-  0x01e6, 0x01c6, 0x0103, 0x19e7, 0x9df7, 0xd77d, 0xd73c, 0xd73c, 0xefdf, 0xbe9a, 0x32aa, 0x0185, 
-  0x0a07, 0x09e7, 0x09e7, 0x09e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x0a07, 
-  0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x09c7, 0x09e7, 0x09e6, 0x1287, 0x2368, 0x12a7, 0x01e6, 0x09e6, 0x01a6, 
-  0x09c5, 0x1267, 0x09e5, 0x01a5, 0x01c6, 0x01c6, 0x09e7, 0x01c6, 0x12c7, 0x1286, 0x01a5, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01a5, 0x0a46, 0x0a27, 0x01c6, 0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x09c6, 
-  0x09e7, 0x09e7, 0x09e7, 0x01c6, 0x0a06, 0x1ac7, 0x0a47, 0x01c6, 0x01a5, 0x1246, 0x1ac8, 0x0a06, 
-  0x01e6, 0x01e6, 0x12c8, 0x1b28, 0x01c6, 0x01c6, 0x1ae7, 0x0a05, 0x01a5, 0x09e7, 0x01c6, 0x12c7, 
-  0x12a7, 0x12c7, 0x1287, 0x1ae8, 0x0a06, 0x0a46, 0x1b08, 0x01c5, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01e6, 0x01c6, 0x1287, 0x23a9, 0x2368, 0x2389, 0x0a06, 0x01c6, 0x1b88, 0x1bc8, 0x1ba8, 0x1bc8, 
-  0x1ba8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1b68, 0x01a5, 0x09c6, 0x0a46, 
-  0x0a67, 0x0a86, 0x1266, 0x1266, 0x1287, 0x1287, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1287, 0x1287, 0x0a86, 0x1ae7, 
-  0x2327, 0x1ae7, 0x2348, 0x12a6, 0x01e5, 0x01c6, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e7, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x1ac6, 0x2348, 0x0a66, 0x0206, 0x0207, 0x0207, 
-  0x0a07, 0x0144, 0x42eb, 0xbe9a, 0xd77d, 0xc6fb, 0xd75d, 0xcf1c, 0x5bef, 0x32eb, 0x01a6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x09c7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x09e6, 0x09e6, 0x09e7, 0x01e6, 0x0a66, 0x2348, 0x12c7, 0x01c5, 0x09a6, 
-  0x01a5, 0x01c5, 0x1ac7, 0x0a06, 0x01a6, 0x01e6, 0x09e7, 0x01e6, 0x12c7, 0x0a86, 0x01c5, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09c6, 0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x09e6, 0x09e6, 0x09e6, 0x0a26, 0x1b08, 0x0a47, 0x01c6, 0x01c6, 0x1287, 0x1ac8, 0x09e6, 0x09e6, 
-  0x09e6, 0x01c6, 0x12c8, 0x1b28, 0x01c5, 0x01c6, 0x1ae8, 0x0a25, 0x01a5, 0x01c6, 0x01c6, 0x12c7, 
-  0x12a7, 0x1ae8, 0x1287, 0x1b08, 0x0a06, 0x0a46, 0x1b08, 0x01c5, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x09e6, 0x0a26, 0x0a26, 0x0a06, 0x01c6, 0x01e6, 0x1b88, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1b68, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01a5, 0x01a5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01a4, 
-  0x1ac7, 0x2b89, 0x2368, 0x0a26, 0x01a6, 0x01c6, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x09e7, 0x09e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e7, 0x01e6, 0x01e6, 0x01c6, 0x01a6, 0x0a05, 0x1b06, 0x2347, 0x1b47, 0x0a87, 0x0207, 0x0207, 
-  0x1248, 0x9db6, 0xc6fb, 0xcf5c, 0xc6db, 0xcf3c, 0xbeba, 0x42eb, 0x0144, 0x01a6, 0x09e6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09c7, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x0207, 0x0a26, 0x1267, 0x22c8, 0x09c6, 
-  0x01a5, 0x01a5, 0x12a7, 0x0a06, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x1307, 0x12a7, 0x01c6, 0x01c6, 
-  0x01a6, 0x01c6, 0x0a27, 0x238a, 0x12e8, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09e6, 
-  0x09e6, 0x01c6, 0x0a26, 0x1b08, 0x1267, 0x01e6, 0x01c6, 0x1287, 0x1ae8, 0x0a06, 0x01c6, 0x09c6, 
-  0x01c5, 0x0206, 0x1ae8, 0x1b08, 0x01c6, 0x01e6, 0x1b08, 0x0a45, 0x01a5, 0x01c6, 0x01a6, 0x12c7, 
-  0x12a7, 0x12c7, 0x1287, 0x1b08, 0x0a26, 0x0a46, 0x1b08, 0x01c6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x01e6, 0x1b88, 0x1bc8, 0x1ba8, 0x1bc8, 
-  0x1bc8, 0x1ba8, 0x1ba8, 0x1ba8, 0x1ba8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1b68, 0x01c6, 0x01e6, 0x0a06, 
-  0x0a06, 0x0a06, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a5, 
-  0x0a05, 0x0a46, 0x0a06, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x09c6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e7, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01a6, 0x0a06, 0x1b08, 0x0a25, 0x1265, 0x2b88, 0x1288, 0x01c6, 0x1a68, 
-  0xae38, 0xdf7d, 0xcf1c, 0xcf1c, 0xcf3c, 0xcf1b, 0x3acb, 0x00e3, 0x09c7, 0x09e7, 0x09e7, 0x09c7, 
-  0x09e6, 0x09e7, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x09e6, 0x0a06, 0x0a06, 0x09e6, 0x01c6, 0x09e6, 0x2b29, 0x1aa8, 
-  0x01c6, 0x1227, 0x0a26, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x1307, 0x12a6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x0226, 0x238a, 0x12e8, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09e7, 
-  0x01c6, 0x0a06, 0x1b08, 0x1287, 0x0a06, 0x01e6, 0x12a7, 0x2308, 0x0a06, 0x01c6, 0x09c6, 0x01c6, 
-  0x0a26, 0x0a27, 0x12a8, 0x1ae7, 0x01c6, 0x01e6, 0x1b08, 0x0a45, 0x01a5, 0x01c6, 0x01a6, 0x12c7, 
-  0x12a7, 0x12c7, 0x12a7, 0x1b08, 0x0a26, 0x0a46, 0x1b08, 0x01c5, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 
-  0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x09e7, 
-  0x09e6, 0x09e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01e6, 0x1b88, 0x1bc8, 0x1ba8, 0x1ba8, 
-  0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1b68, 0x01c6, 0x0a67, 0x2369, 
-  0x1b68, 0x2389, 0x0a66, 0x0a26, 0x0a46, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a06, 
-  0x2308, 0x1266, 0x01c5, 0x0a06, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 
-  0x09e7, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 
-  0x09e7, 0x01e6, 0x01e6, 0x01c6, 0x09e6, 0x1ac7, 0x09e4, 0x0a25, 0x2b48, 0x09e6, 0x1a28, 0xa617, 
-  0xdf9d, 0xcf1c, 0xd73c, 0xbe9a, 0xb699, 0x4b2c, 0x0124, 0x09a6, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x1ae7, 0x2368, 0x1ae7, 0x0a06, 0x09c6, 0x01a5, 0x0185, 0x1aa7, 
-  0x1ae7, 0x2308, 0x1247, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x12c7, 0x0a86, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x1308, 0x12a7, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09e6, 0x01e6, 
-  0x0a06, 0x1ac8, 0x0a67, 0x0a06, 0x0a26, 0x1b08, 0x2348, 0x1267, 0x01c6, 0x09c6, 0x01c5, 0x0a46, 
-  0x1aa7, 0x01a5, 0x0a66, 0x12c7, 0x01a6, 0x01c6, 0x1b08, 0x0a45, 0x01a5, 0x01c6, 0x01a5, 0x12c7, 
-  0x12a7, 0x12c7, 0x12a7, 0x1b08, 0x0a26, 0x0a67, 0x1b28, 0x01e5, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e7, 0x01c6, 0x01e6, 0x0a47, 0x0a46, 0x0a46, 0x01c6, 0x01e6, 0x1b88, 0x1bc8, 0x1ba8, 0x1ba8, 
-  0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1b68, 0x01c6, 0x1287, 0x23c9, 
-  0x2388, 0x2388, 0x1b07, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 0x1b28, 
-  0x2368, 0x0a26, 0x01e5, 0x2329, 0x0a26, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x09e7, 
-  0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x09e6, 0x09e7, 0x01e6, 0x01e7, 0x01a5, 0x09c5, 0x1a87, 0x1245, 0x01e3, 0x2a88, 0xb659, 0xd79d, 
-  0xcf1c, 0xd75d, 0xcedb, 0x2269, 0x09c6, 0x09c6, 0x01a6, 0x01c6, 0x01e6, 0x09e7, 0x09e7, 0x0a07, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x01e6, 0x09e6, 0x01e6, 0x0a26, 0x12a7, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x12a7, 0x1287, 0x1306, 0x1b86, 0x1b66, 0x1b67, 0x12a7, 0x01c6, 0x01a6, 0x01a5, 0x12a7, 
-  0x23a8, 0x2387, 0x0a46, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x01a5, 0x1286, 0x12c7, 0x01e6, 0x01c6, 
-  0x01c6, 0x01a6, 0x0a46, 0x2368, 0x1b07, 0x0a06, 0x01c6, 0x01e6, 0x01c6, 0x09c6, 0x01e6, 0x0a26, 
-  0x1ac7, 0x0a47, 0x09e6, 0x0a06, 0x1ae8, 0x2368, 0x1287, 0x09e6, 0x09e7, 0x01a6, 0x0a26, 0x1a87, 
-  0x09c6, 0x0185, 0x1246, 0x12a7, 0x01a5, 0x01c6, 0x1b08, 0x0a46, 0x01c5, 0x09c6, 0x01a6, 0x12c7, 
-  0x12a7, 0x12c7, 0x1287, 0x1b28, 0x0a26, 0x0a67, 0x1b28, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 
-  0x0206, 0x12a7, 0x1b28, 0x23c9, 0x23c8, 0x23c9, 0x0a46, 0x01e6, 0x1ba8, 0x1bc8, 0x1ba8, 0x1bc8, 
-  0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1b88, 0x0206, 0x0a67, 0x1b07, 
-  0x12c7, 0x1ae7, 0x0a26, 0x01e5, 0x01c5, 0x01c5, 0x01c5, 0x01e5, 0x01c5, 0x01c5, 0x01c5, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e5, 0x01e6, 0x01e6, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x0a26, 
-  0x2328, 0x1ac7, 0x0206, 0x1aa8, 0x0a06, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01c6, 0x09c5, 0x0184, 0x32e9, 0x4bad, 0xae37, 0xd77d, 0xc71b, 
-  0xd75c, 0xd75d, 0x5bce, 0x01a6, 0x0a07, 0x09e7, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 
-  0x01e6, 0x01c6, 0x0a06, 0x1ae7, 0x1ae7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x1ac7, 0x12c7, 0x1ac7, 
-  0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x1ac7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12e7, 
-  0x1ae7, 0x1ae7, 0x1b28, 0x23a7, 0x1b86, 0x1b66, 0x1b66, 0x2347, 0x01c5, 0x01a6, 0x01a5, 0x1286, 
-  0x23c8, 0x23a7, 0x12a6, 0x0205, 0x01e6, 0x09c7, 0x01c6, 0x01c5, 0x1ac7, 0x2388, 0x12e7, 0x0a06, 
-  0x01e6, 0x01c5, 0x12a6, 0x2bc8, 0x23a8, 0x12e7, 0x0206, 0x01c6, 0x09e6, 0x01e6, 0x0a26, 0x1ac7, 
-  0x1247, 0x01c6, 0x01e6, 0x1287, 0x2328, 0x0a66, 0x0206, 0x0a07, 0x01c6, 0x0a46, 0x1a87, 0x09e6, 
-  0x09e6, 0x0186, 0x1246, 0x12c7, 0x01a5, 0x01e6, 0x1b08, 0x0a46, 0x01a5, 0x01c6, 0x01a6, 0x12c7, 
-  0x12a7, 0x12c7, 0x0a87, 0x1b28, 0x0a26, 0x0a67, 0x1b28, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01c6, 0x01e6, 0x01e5, 
-  0x12a7, 0x12e7, 0x1307, 0x1b47, 0x1b27, 0x1307, 0x0a06, 0x01e6, 0x1b88, 0x1bc8, 0x1ba8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1b88, 0x0226, 0x0206, 0x01c5, 
-  0x01a5, 0x01c5, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x0a26, 0x12c7, 0x0a27, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e7, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e6, 0x01e7, 0x0207, 0x0a27, 0x01e6, 0x1a07, 0x9575, 0xd79d, 0xc71b, 0xc6fb, 0xd77d, 
-  0xd77d, 0x7471, 0x01a6, 0x0a27, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x09e7, 0x01e7, 0x01e6, 0x01e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x01c6, 0x0a06, 0x1aa7, 0x0a46, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c5, 0x01c5, 0x01c6, 0x01c5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x0226, 0x0aa6, 0x1346, 0x1b87, 0x1b47, 0x1286, 0x01c6, 0x01c6, 0x01e5, 0x1b07, 
-  0x1b47, 0x1b67, 0x23a8, 0x12c6, 0x0a26, 0x01e6, 0x0a26, 0x1ae7, 0x1ae7, 0x1ac6, 0x2388, 0x0a46, 
-  0x01e6, 0x0a46, 0x1b47, 0x1b27, 0x1b06, 0x2387, 0x0a66, 0x01e6, 0x01e6, 0x0a26, 0x12a7, 0x0a26, 
-  0x01c6, 0x01e6, 0x1286, 0x2348, 0x1246, 0x01e6, 0x0a07, 0x01e6, 0x1266, 0x1ac7, 0x09e6, 0x09c6, 
-  0x09e6, 0x0185, 0x1267, 0x1ae8, 0x01a6, 0x01e6, 0x1b08, 0x0a46, 0x01c5, 0x09e6, 0x01a6, 0x12c7, 
-  0x12c7, 0x12e7, 0x12a7, 0x1b28, 0x0226, 0x0a67, 0x1b28, 0x01e5, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 
-  0x01c6, 0x01e6, 0x01e6, 0x01e7, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 
-  0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 0x01e5, 0x12a7, 
-  0x1287, 0x01e5, 0x0205, 0x0206, 0x01e5, 0x01c6, 0x01c6, 0x01e6, 0x1b88, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1ba8, 0x1bc8, 0x1b88, 0x0206, 0x0a67, 0x1308, 
-  0x12e7, 0x12e8, 0x0a26, 0x01e6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x01e6, 0x01c6, 
-  0x0a26, 0x12c7, 0x12e8, 0x0206, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x0207, 0x0a27, 0x0207, 0x1268, 0xa5f6, 0xd77d, 0xc6db, 0xc6fb, 0xd75d, 0x7cb2, 
-  0x534d, 0x0165, 0x09e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x0a26, 0x1ae8, 0x0a46, 0x01e6, 0x09e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e5, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x0a66, 0x1b47, 0x1ae7, 0x01e5, 0x01e6, 0x01c6, 0x0a26, 0x2388, 
-  0x1b47, 0x2388, 0x23c8, 0x1b47, 0x0a67, 0x01c6, 0x1267, 0x2bc9, 0x12e6, 0x12a6, 0x1b07, 0x0a06, 
-  0x01c6, 0x0a87, 0x2be9, 0x1b47, 0x1b26, 0x2388, 0x0a47, 0x01e6, 0x0a27, 0x1ae8, 0x0a26, 0x01a6, 
-  0x01a5, 0x1266, 0x2328, 0x1266, 0x01e6, 0x09e6, 0x01c6, 0x1247, 0x1ac8, 0x0a26, 0x01e6, 0x09e7, 
-  0x01c6, 0x0a26, 0x12c7, 0x0a47, 0x01c6, 0x01c6, 0x1b08, 0x0a26, 0x01c6, 0x09e7, 0x01a6, 0x12c7, 
-  0x12c7, 0x12e7, 0x12a7, 0x1b08, 0x0226, 0x0a67, 0x1b28, 0x01e5, 0x09e6, 0x09e7, 0x01e6, 0x01e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x01e6, 0x01e7, 0x01e6, 0x09e6, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e5, 0x12a7, 0x1ac8, 
-  0x0206, 0x01e6, 0x01e6, 0x0206, 0x0206, 0x0206, 0x09e6, 0x09e6, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1ba8, 0x1bc8, 0x1b68, 0x01e5, 0x0aa7, 0x23e9, 
-  0x1bc8, 0x23a8, 0x0a46, 0x01c5, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e5, 
-  0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 0x01e5, 
-  0x2348, 0x2388, 0x2388, 0x1b07, 0x0206, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x09e6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x0207, 0x01e6, 0x1248, 0x9595, 0xd77d, 0xcf1b, 0xcefb, 0xcf3c, 0x7430, 0x00e3, 
-  0x0104, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x2328, 0x1287, 0x01c6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x0a26, 0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x12c7, 0x0a26, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x1ac7, 
-  0x2bc9, 0x2388, 0x2388, 0x0a66, 0x0a07, 0x09e7, 0x0a07, 0x1b08, 0x2388, 0x1b48, 0x0a26, 0x0185, 
-  0x01a6, 0x0a67, 0x23c8, 0x23c8, 0x2bc8, 0x12c7, 0x0a06, 0x09e7, 0x0a27, 0x0a48, 0x09c6, 0x01a5, 
-  0x1246, 0x2307, 0x1246, 0x01c5, 0x01c6, 0x01c6, 0x0a26, 0x1aa7, 0x0a06, 0x09e6, 0x0a07, 0x01c6, 
-  0x1267, 0x2369, 0x12a7, 0x01c6, 0x01c6, 0x01c6, 0x1ae8, 0x0a46, 0x01c6, 0x09e7, 0x01c6, 0x12c7, 
-  0x12c7, 0x12e7, 0x12a7, 0x1b08, 0x0206, 0x0a67, 0x1b08, 0x01c5, 0x09e7, 0x01e7, 0x01e7, 0x01e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x09e7, 0x01e7, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e7, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x12a7, 0x1aa7, 0x0a06, 
-  0x0206, 0x01c5, 0x0a26, 0x1b28, 0x1b28, 0x1b48, 0x0a46, 0x0206, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1ba8, 0x1bc8, 0x1b68, 0x01c5, 0x0a86, 0x23c8, 
-  0x1ba8, 0x2388, 0x1ae7, 0x1ae7, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 
-  0x23a8, 0x12a6, 0x1b06, 0x23a8, 0x0a26, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 
-  0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x09e7, 0x01e7, 0x01e6, 
-  0x01e6, 0x01c6, 0x09c6, 0x7d13, 0xae38, 0xdf7d, 0xc6fb, 0xcefb, 0xdf7d, 0x640f, 0x0104, 0x0165, 
-  0x09c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x09e7, 0x09e7, 
-  0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x0a26, 0x01e6, 0x09e6, 0x09e6, 0x01c6, 0x01e6, 0x1ac7, 0x1b07, 0x0a46, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a26, 0x0a26, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a26, 
-  0x0a26, 0x0a46, 0x0a46, 0x0a26, 0x0a47, 0x0206, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x09e6, 
-  0x0a46, 0x0a06, 0x0a26, 0x01e6, 0x09e6, 0x09e7, 0x01e7, 0x0a07, 0x0a46, 0x0a06, 0x01a5, 0x01a6, 
-  0x01c6, 0x0206, 0x0a66, 0x0a67, 0x0a67, 0x0a27, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x1a87, 
-  0x22e7, 0x0a05, 0x0185, 0x01a6, 0x01c6, 0x0a26, 0x1287, 0x09e6, 0x01c6, 0x09e6, 0x01e6, 0x1267, 
-  0x2348, 0x12c7, 0x0a26, 0x09e7, 0x01c6, 0x01c6, 0x1ac7, 0x0a26, 0x01c6, 0x01e7, 0x01c6, 0x12c7, 
-  0x12c7, 0x12e7, 0x0aa7, 0x1b08, 0x0206, 0x0a67, 0x1b08, 0x01c5, 0x01e6, 0x01e7, 0x01e7, 0x01e7, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x09e7, 0x09e7, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 
-  0x09e7, 0x09e7, 0x09e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x1ac7, 0x1287, 0x01e6, 0x01e6, 
-  0x01e6, 0x0a46, 0x2328, 0x23a8, 0x1ba8, 0x23a8, 0x0a66, 0x0206, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1b68, 0x01c5, 0x0a46, 0x2388, 
-  0x1b88, 0x2368, 0x0a46, 0x0a06, 0x0a26, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a46, 0x0a26, 0x0a26, 0x0a46, 0x0a26, 0x0a26, 0x0a46, 0x0a46, 0x12a6, 
-  0x2388, 0x2347, 0x1b27, 0x1b48, 0x0226, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01a6, 0x01a6, 0x01c6, 0x01e7, 
-  0x01a6, 0x0165, 0x7cf3, 0xd77d, 0xd75d, 0xc6fb, 0xd73c, 0xdf5d, 0x6c50, 0x09a5, 0x09c6, 0x09c6, 
-  0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x09e7, 0x01e7, 
-  0x01e6, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01c6, 0x09e6, 0x09e6, 0x01c6, 0x0a05, 0x1ae7, 0x1ac7, 0x0a26, 0x01e6, 0x01c6, 0x01a6, 0x01a6, 
-  0x01a6, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01a5, 0x01a5, 0x01a6, 
-  0x01a5, 0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01a5, 0x01a6, 0x01a6, 0x01c6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09c6, 0x09c6, 0x09e6, 
-  0x01c6, 0x09e6, 0x09e6, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x09e6, 0x1266, 0x2b48, 
-  0x1267, 0x01a5, 0x01a6, 0x01a5, 0x1226, 0x1aa7, 0x09e6, 0x01e6, 0x09e6, 0x01c6, 0x0a67, 0x2b89, 
-  0x1b28, 0x0206, 0x0a06, 0x09e6, 0x01e5, 0x1ac7, 0x1266, 0x01e5, 0x01e6, 0x09e7, 0x01c6, 0x12e7, 
-  0x12c7, 0x12e7, 0x0aa7, 0x1b08, 0x0226, 0x0a67, 0x1b08, 0x01c5, 0x09e6, 0x09e7, 0x01e6, 0x01e6, 
-  0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x09e7, 0x01e7, 0x01e7, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 
-  0x09e6, 0x09e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x1ac7, 0x1ac8, 0x0206, 0x0a06, 0x01c6, 
-  0x1266, 0x2327, 0x1ae7, 0x1b27, 0x1b27, 0x1b48, 0x0a46, 0x0206, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 
-  0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 
-  0x1ba8, 0x1ba8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1ba8, 0x1bc8, 0x1b68, 0x09c5, 0x01e6, 0x0a26, 
-  0x0a26, 0x0a06, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 
-  0x1307, 0x23a8, 0x1b47, 0x0a46, 0x0206, 0x09e6, 0x09e7, 0x09e7, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x0185, 0x1a69, 0x22aa, 0x1248, 0x01c6, 
-  0x0985, 0x7cb2, 0xcf5c, 0xc6fb, 0xcf1b, 0xcf1b, 0xc6ba, 0x7c92, 0x01a5, 0x09e7, 0x09e6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 
-  0x01e7, 0x01e7, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01e7, 0x09e7, 0x01c6, 0x0a06, 0x1ae7, 0x1aa7, 0x09e6, 0x01c6, 0x01c6, 0x09e6, 0x1267, 0x1267, 
-  0x1267, 0x0a87, 0x1267, 0x0a67, 0x0a67, 0x0a67, 0x0a87, 0x1287, 0x1267, 0x1267, 0x0a67, 0x0a67, 
-  0x0a67, 0x1247, 0x1247, 0x1247, 0x1267, 0x1267, 0x0a87, 0x1287, 0x0a87, 0x0a87, 0x0a87, 0x0a87, 
-  0x0a67, 0x0a46, 0x09e6, 0x01c6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 
-  0x09c6, 0x01e6, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x0a07, 0x09e7, 0x01c6, 0x0a06, 0x1ae8, 0x12a8, 
-  0x0a07, 0x09e7, 0x01a6, 0x0a26, 0x1a87, 0x09e6, 0x01e6, 0x09e7, 0x01e6, 0x0a46, 0x2368, 0x2328, 
-  0x0a26, 0x0a07, 0x09e7, 0x0a06, 0x1aa7, 0x1266, 0x01c6, 0x01e6, 0x01e6, 0x09e7, 0x01c6, 0x12e8, 
-  0x12c7, 0x12e7, 0x0a87, 0x1b08, 0x0226, 0x0a67, 0x1b08, 0x01c5, 0x09e7, 0x09e7, 0x01e6, 0x01e6, 
-  0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x01e7, 0x01e6, 0x09e7, 0x01e6, 0x01e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x01e5, 0x1ac7, 0x1ac7, 0x0a06, 0x01e6, 0x09e6, 0x0a46, 
-  0x2307, 0x1286, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 0x0a26, 0x23c8, 0x23e8, 0x23e8, 0x23e8, 
-  0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x1bc8, 0x23c8, 
-  0x23c8, 0x1bc8, 0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x1b68, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x01e7, 0x09e7, 0x09e7, 0x01e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x09e6, 0x09e6, 0x09c6, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x0207, 
-  0x0267, 0x1b27, 0x2388, 0x0226, 0x0206, 0x09e7, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x01e6, 0x09e7, 0x09e6, 0x01c6, 0x434c, 0xc6fb, 0xe7be, 0xa617, 0x2207, 
-  0x8d34, 0xd77d, 0xc71b, 0xc71b, 0xd73c, 0x84f3, 0x09a6, 0x09e7, 0x01e7, 0x09e7, 0x09e6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01e7, 0x01e6, 0x0a06, 0x1ae7, 0x1287, 0x01c6, 0x01c6, 0x01c6, 0x0a26, 0x1267, 0x1ae8, 0x1ae8, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1ae8, 0x1ae8, 0x0a27, 0x01c6, 0x09e6, 0x09e7, 0x09c7, 0x09e6, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e6, 0x0a07, 0x0a06, 0x1268, 0x0a27, 
-  0x0a07, 0x0207, 0x1267, 0x1aa7, 0x09e6, 0x01c6, 0x09e6, 0x01e6, 0x0a67, 0x2389, 0x1b08, 0x0a06, 
-  0x09e6, 0x01e6, 0x0a07, 0x1ac8, 0x1267, 0x01c5, 0x09e6, 0x01c6, 0x01e6, 0x09e7, 0x01e6, 0x1ae8, 
-  0x12c7, 0x1ae8, 0x1287, 0x1ae8, 0x0226, 0x0a67, 0x1b28, 0x01c5, 0x09c6, 0x09c7, 0x09e7, 0x09e7, 
-  0x09e7, 0x01e6, 0x09e7, 0x09e7, 0x01e6, 0x09e7, 0x09e7, 0x01e6, 0x01e6, 0x01e7, 0x09c7, 0x09c7, 
-  0x09c6, 0x09c6, 0x09e6, 0x01c6, 0x01e6, 0x12a7, 0x12a8, 0x0a06, 0x0a06, 0x0a06, 0x1246, 0x1ae7, 
-  0x1aa7, 0x09c6, 0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x0a06, 0x1b28, 0x1b47, 0x1b48, 0x1b47, 
-  0x1327, 0x1327, 0x1327, 0x1327, 0x1327, 0x1327, 0x1327, 0x1b27, 0x1327, 0x1327, 0x1327, 0x1b27, 
-  0x1b27, 0x1b27, 0x1b47, 0x1347, 0x1347, 0x1b67, 0x1347, 0x1b48, 0x1ae7, 0x01e6, 0x01c6, 0x09a6, 
-  0x0986, 0x09c6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x01e7, 
-  0x01c6, 0x09c6, 0x09e7, 0x09c6, 0x01c6, 0x09c6, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x0207, 
-  0x0227, 0x1308, 0x23c8, 0x0aa7, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0185, 0xae58, 0xdf7d, 0xcf3c, 0xd73c, 0xd75c, 
-  0xd75c, 0xcf1c, 0xcf1b, 0xcf3c, 0x9595, 0x09a6, 0x01c6, 0x01e7, 0x09c6, 0x09c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x01c6, 0x01e6, 0x2328, 0x1b07, 0x01e6, 0x09e6, 0x01c6, 0x1267, 0x2309, 0x0a27, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01e6, 0x01c5, 0x01c5, 0x01e5, 0x01e6, 0x01e6, 0x01e5, 
-  0x01e5, 0x01e6, 0x01c6, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x01e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x01e6, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x12a8, 0x1b09, 0x0207, 0x0207, 0x0a47, 
-  0x0a47, 0x12c8, 0x2329, 0x0a06, 0x01c6, 0x09c6, 0x01c6, 0x0a26, 0x2329, 0x1ae8, 0x0a47, 0x0a27, 
-  0x0a07, 0x1247, 0x2329, 0x1287, 0x01a6, 0x09c6, 0x09c6, 0x09c6, 0x09e7, 0x09e7, 0x01c6, 0x1ae8, 
-  0x12c7, 0x1b08, 0x12c8, 0x1b29, 0x0a47, 0x12a8, 0x2369, 0x01e6, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 
-  0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x01e7, 0x09e7, 0x09e7, 0x01e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x0a07, 0x09e7, 0x01e6, 0x1ac7, 0x1ac8, 0x0a06, 0x0a07, 0x0a47, 0x1aa7, 0x2307, 0x0a06, 
-  0x01a6, 0x09e6, 0x09e7, 0x09c6, 0x09a6, 0x09c6, 0x09a6, 0x01c6, 0x0a07, 0x0226, 0x0206, 0x01e6, 
-  0x0206, 0x0226, 0x0206, 0x0206, 0x0206, 0x0206, 0x01e6, 0x01e6, 0x01c5, 0x01e6, 0x0a06, 0x01e6, 
-  0x01e6, 0x01e6, 0x0206, 0x0206, 0x0226, 0x0a47, 0x0a67, 0x0a47, 0x0227, 0x01e6, 0x09a6, 0x01a5, 
-  0x09c6, 0x09e6, 0x01e6, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x01c6, 
-  0x01c6, 0x0a07, 0x09e7, 0x09c7, 0x09e7, 0x01c6, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x01c6, 
-  0x0a07, 0x12c8, 0x1b48, 0x2368, 0x0a26, 0x01c6, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0185, 0xb679, 0xefff, 0xcefb, 0xcf1c, 0xcf1c, 
-  0xcf1c, 0xcf1c, 0xcf1c, 0xcf3c, 0x6c50, 0x0124, 0x01c6, 0x09c6, 0x09e6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 
-  0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01e6, 0x1ae7, 0x1b08, 0x0a26, 0x01c6, 0x01c6, 0x1287, 0x2308, 0x1267, 0x0144, 0x0103, 0x0124, 
-  0x0185, 0x09c6, 0x09c6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x09e6, 0x01c6, 0x01c6, 0x01c6, 0x09e7, 0x01c6, 0x09c7, 
-  0x09c7, 0x09c7, 0x09c6, 0x09c6, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x0185, 0x00e3, 0x00e3, 0x0123, 0x1205, 0x01c5, 0x01a6, 0x0144, 0x0081, 
-  0x0984, 0x1205, 0x00e2, 0x0144, 0x09e6, 0x01c6, 0x0a06, 0x2328, 0x11e5, 0x0061, 0x0061, 0x0061, 
-  0x0061, 0x00a2, 0x00e2, 0x00a2, 0x09a6, 0x09c6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x01c6, 0x12c8, 
-  0x12e7, 0x1aa7, 0x0123, 0x0163, 0x00c2, 0x0102, 0x0984, 0x00a2, 0x00a2, 0x00a2, 0x00a2, 0x00e3, 
-  0x01e6, 0x09e7, 0x09e7, 0x01a6, 0x0185, 0x0165, 0x0185, 0x0185, 0x0185, 0x0185, 0x01c6, 0x09c6, 
-  0x00e3, 0x0041, 0x0124, 0x1ac7, 0x1ae8, 0x0a27, 0x0a07, 0x0a87, 0x1b27, 0x2307, 0x1267, 0x09c6, 
-  0x01a6, 0x0124, 0x0145, 0x09e7, 0x09a6, 0x09c6, 0x09c6, 0x0144, 0x0061, 0x0143, 0x0a06, 0x0a06, 
-  0x0164, 0x0103, 0x0103, 0x00e3, 0x0103, 0x0103, 0x0124, 0x0144, 0x01c6, 0x0144, 0x00a1, 0x0164, 
-  0x0a27, 0x0206, 0x0206, 0x0206, 0x0144, 0x0164, 0x0164, 0x0144, 0x0144, 0x01a6, 0x01a6, 0x0144, 
-  0x0061, 0x0082, 0x01a5, 0x01c6, 0x09e7, 0x01e7, 0x09e7, 0x01c6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 
-  0x0165, 0x0081, 0x0124, 0x0165, 0x00a2, 0x0103, 0x09a6, 0x09c6, 0x09c6, 0x01c6, 0x09e7, 0x01e6, 
-  0x01e6, 0x0aa7, 0x1307, 0x1b07, 0x0206, 0x0a07, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x01e6, 
-  0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x09c6, 0x09c6, 0x01c6, 0x536d, 0x84d2, 0xe7be, 0xd75d, 0xcefb, 
-  0xcf1c, 0xcf1b, 0xcefb, 0xcf3c, 0xcf3c, 0x53ae, 0x0165, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 
-  0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x2328, 0x2307, 0x09e6, 0x01c6, 0x01e6, 0x1a87, 0x2309, 0x0a06, 0x0165, 0x84d2, 0x9534, 0x9d96, 
-  0x3aeb, 0x0164, 0x09e7, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x09e6, 
-  0x09e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x09c6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 
-  0x09e6, 0x09e7, 0x0185, 0x2145, 0x4a28, 0x4208, 0x4228, 0x4a28, 0x4a69, 0x10c3, 0x2104, 0x9cf3, 
-  0x4a49, 0x1082, 0x9cd3, 0x52aa, 0x0124, 0x0a67, 0x22e8, 0x0922, 0x1082, 0x9471, 0xb575, 0xad55, 
-  0xad55, 0xad34, 0xa4f3, 0x41e7, 0x0061, 0x09c6, 0x0a07, 0x09e7, 0x09e6, 0x09e7, 0x01c6, 0x12c8, 
-  0x12c7, 0x08e3, 0x6b2c, 0x738e, 0x6b6d, 0x6b6d, 0x736d, 0x738e, 0x738e, 0x738d, 0x738e, 0x6b4c, 
-  0x1144, 0x0207, 0x0185, 0x10c3, 0x18e3, 0x18e3, 0x1903, 0x1904, 0x2124, 0x1904, 0x0944, 0x00a2, 
-  0x4a69, 0xad34, 0x2165, 0x1205, 0x0a26, 0x09e7, 0x0a67, 0x1b07, 0x2b88, 0x1aa7, 0x01e6, 0x09c6, 
-  0x0904, 0x4208, 0x31c7, 0x0944, 0x09c6, 0x09c6, 0x0185, 0x1924, 0xa534, 0x5aeb, 0x1225, 0x1a66, 
-  0x4208, 0x528a, 0x4a49, 0x4228, 0x4208, 0x39e7, 0x4208, 0x3a08, 0x00a2, 0x31a6, 0x9cd3, 0x39e7, 
-  0x0a66, 0x1b48, 0x12c7, 0x1144, 0x528a, 0x52cb, 0x52aa, 0x52aa, 0x39c7, 0x0103, 0x09e6, 0x08c2, 
-  0x9cb2, 0x8410, 0x00c2, 0x09e6, 0x01c6, 0x01e6, 0x0985, 0x00a2, 0x0081, 0x00e3, 0x0185, 0x0164, 
-  0x2145, 0x94b2, 0x4228, 0x18e3, 0xa514, 0x5269, 0x00e3, 0x09c6, 0x01a6, 0x09c6, 0x0104, 0x0082, 
-  0x1103, 0x1123, 0x1123, 0x1103, 0x10e3, 0x00a2, 0x09a6, 0x09e7, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x09c6, 0x09c6, 0x09e7, 0x0164, 0x09c6, 0x4b2c, 0x7cb2, 0xe7be, 
-  0xcf3c, 0xcf1c, 0xcf1b, 0xcefb, 0xd77d, 0xa617, 0x0144, 0x09c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 
-  0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x1ae7, 0x0a06, 0x01a5, 0x01c6, 0x1a87, 0x2328, 0x1247, 0x1a07, 0x9d75, 0xd73c, 0xd77d, 0xdf7d, 
-  0xb679, 0x32ca, 0x0185, 0x01c6, 0x01c6, 0x01c6, 0x09e6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x09e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x09e6, 
-  0x09e7, 0x09e6, 0x01c6, 0x01c6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09c6, 0x0a07, 0x00a2, 0x6b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x39c7, 0x2965, 0xffff, 
-  0x7bcf, 0x18e3, 0xffff, 0x8c30, 0x00e2, 0x2b8a, 0x0963, 0x4208, 0xe73c, 0xf7be, 0xdefb, 0xe71b, 
-  0xe71b, 0xdefb, 0xf7be, 0xffff, 0x83ef, 0x00a2, 0x0a07, 0x09e7, 0x09e6, 0x09c6, 0x01c6, 0x12c8, 
-  0x1287, 0x0882, 0xe71c, 0xffff, 0xffbe, 0xffde, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0x2165, 0x01a6, 0x0041, 0x9cd2, 0xffff, 0xfffe, 0xffff, 0xffff, 0xffbe, 0xc618, 0x0882, 0x0020, 
-  0x7bef, 0xffff, 0x39c7, 0x0123, 0x01e6, 0x0a26, 0x1ae7, 0x2348, 0x2308, 0x09e6, 0x09e7, 0x01a6, 
-  0x10c3, 0xffde, 0xc617, 0x0061, 0x09c6, 0x09c6, 0x0144, 0x2985, 0xffff, 0x9cd2, 0x01c3, 0x0983, 
-  0xdeba, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0820, 0x5aca, 0xffff, 0x632c, 
-  0x0a24, 0x2409, 0x1ac6, 0x10e3, 0xffde, 0xffff, 0xffff, 0xffff, 0xc618, 0x00a1, 0x0a27, 0x08a2, 
-  0xffde, 0xdedb, 0x00a2, 0x01c6, 0x01c6, 0x09e7, 0x0061, 0x7bae, 0xdeda, 0x2965, 0x0124, 0x0124, 
-  0x31c6, 0xffff, 0x7bce, 0x2924, 0xffff, 0x83ef, 0x0082, 0x09e7, 0x09a6, 0x00a2, 0x2124, 0xad54, 
-  0xf79e, 0xf79d, 0xf7bd, 0xf7be, 0xe73c, 0x5acb, 0x0061, 0x01a6, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x0a07, 0x0a07, 0x0144, 0x11e7, 0x3aaa, 
-  0x8d34, 0xdf7d, 0xcf1c, 0xd73c, 0xc6ba, 0x3b2c, 0x0185, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x0185, 0x0185, 0x01a5, 0x1267, 0x1b08, 0x0a46, 0x1a27, 0x9db6, 0xdf9e, 0xcf1c, 0xcedb, 0xcefb, 
-  0xd73c, 0x434c, 0x0165, 0x01c6, 0x01a6, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01a6, 0x09e7, 0x00a2, 0x6b4d, 0xffff, 0x736d, 0x4208, 0x8c50, 0xffff, 0x39c6, 0x2124, 0xffdf, 
-  0x6b6d, 0x1082, 0xffdf, 0x7bcf, 0x0163, 0x1b08, 0x08a2, 0xe71b, 0xe73c, 0x18e3, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0841, 0xb5b6, 0xffff, 0x4a69, 0x0124, 0x0a07, 0x09e6, 0x09c6, 0x01c6, 0x12c7, 
-  0x1286, 0x0903, 0x18c3, 0x18c3, 0x18c3, 0x0841, 0x0020, 0x18c3, 0x2124, 0x10a2, 0xb595, 0xffdf, 
-  0x2124, 0x0144, 0x00c2, 0x4a28, 0x7bcf, 0x7bce, 0x7bcf, 0x7bce, 0xf79d, 0xdeba, 0x0882, 0x0020, 
-  0x73ae, 0xffdf, 0x31c6, 0x0103, 0x0a46, 0x1ae7, 0x2328, 0x1aa7, 0x09e6, 0x09e6, 0x09e7, 0x01a6, 
-  0x10e3, 0xf79d, 0xbdf7, 0x0082, 0x09e7, 0x09e7, 0x0164, 0x2965, 0xffdf, 0x9471, 0x0182, 0x11c4, 
-  0x39c7, 0x528a, 0x4a49, 0xdeba, 0xf79d, 0x52aa, 0x4a28, 0x4a69, 0x0020, 0x5acb, 0xffdf, 0x52aa, 
-  0x0040, 0x19e5, 0x00c1, 0x0000, 0x2965, 0x31a6, 0x31a6, 0x39c7, 0x2945, 0x0040, 0x00e3, 0x0882, 
-  0xef3c, 0xd679, 0x00c2, 0x01e6, 0x01c6, 0x0a07, 0x0040, 0x9491, 0xffff, 0x31c6, 0x0124, 0x0124, 
-  0x31a6, 0xffdf, 0x73ae, 0x2924, 0xffdf, 0x7bae, 0x00a2, 0x0a27, 0x0103, 0x20e3, 0xe71b, 0xffff, 
-  0xa534, 0x8c50, 0x8c71, 0x8c30, 0xce79, 0xffff, 0x8410, 0x0020, 0x09c6, 0x09e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e6, 0x09e7, 0x01a6, 0x0144, 
-  0x1207, 0x2a89, 0xa5f7, 0xcefb, 0x2aaa, 0x01a5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01a5, 0x0185, 0x1247, 0x1267, 0x0163, 0x1207, 0xa5d7, 0xdf7d, 0xcefc, 0xd71c, 0xdf7d, 0xdf5d, 
-  0x640f, 0x0185, 0x01c6, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a66, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a66, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 
-  0x0a46, 0x1267, 0x0102, 0x6b6d, 0xffff, 0x31a6, 0x0000, 0x52aa, 0xffff, 0x39e7, 0x2965, 0xffff, 
-  0xe71b, 0xd69a, 0xffff, 0x7bef, 0x0102, 0x1247, 0x08a2, 0xdeda, 0xffff, 0x738e, 0x18c3, 0x18e3, 
-  0x18e3, 0x18e3, 0x3185, 0xd6ba, 0xffdf, 0x39e7, 0x0124, 0x0a07, 0x01c6, 0x09c7, 0x01c6, 0x12a7, 
-  0x1246, 0x1aa7, 0x1245, 0x1a87, 0x00a1, 0x4a69, 0x9492, 0x1924, 0x1247, 0x00a1, 0xb596, 0xffff, 
-  0x18e3, 0x0144, 0x09c6, 0x00c2, 0x0061, 0x00c2, 0x00c2, 0x0000, 0xe6fb, 0xdeda, 0x08c2, 0x00c2, 
-  0x7bce, 0xffff, 0x31a6, 0x0143, 0x12a7, 0x2328, 0x1ac7, 0x01c6, 0x09c6, 0x09e7, 0x0a07, 0x01a6, 
-  0x10c3, 0xf79e, 0xc5f7, 0x00c3, 0x0a28, 0x0a07, 0x0144, 0x2144, 0xffff, 0x8c50, 0x0102, 0x12c7, 
-  0x0184, 0x0164, 0x0000, 0xce38, 0xef7d, 0x0000, 0x0081, 0x09e5, 0x0143, 0x630c, 0xffff, 0xce79, 
-  0xbdb6, 0x18c3, 0x8c51, 0xdeda, 0xce58, 0xce78, 0xce78, 0xce79, 0xce79, 0xdedb, 0x83ef, 0x0000, 
-  0xef7d, 0xd699, 0x00c2, 0x01e6, 0x01e7, 0x09e7, 0x0040, 0x8c51, 0xffff, 0x31c6, 0x0165, 0x0185, 
-  0x31c7, 0xffff, 0x73ae, 0x2944, 0xffff, 0x7bae, 0x00a2, 0x0a28, 0x00a2, 0xb5b6, 0xffdf, 0x5aeb, 
-  0x0000, 0x0061, 0x0081, 0x0081, 0x08a2, 0xa534, 0xffdf, 0x5aeb, 0x00e3, 0x0a07, 0x09c6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x09e6, 0x01c6, 0x01c6, 0x09e7, 
-  0x01e6, 0x01a5, 0x1227, 0x1a89, 0x01e6, 0x09e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 
-  0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x0a07, 
-  0x0185, 0x1267, 0x1a87, 0x1a27, 0x3aca, 0x9595, 0xd75d, 0xcefb, 0xd71c, 0xcefc, 0xadf7, 0x6410, 
-  0x01a5, 0x01c6, 0x1227, 0x2308, 0x2308, 0x2308, 0x2308, 0x2308, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x2349, 0x09a3, 0x6b6d, 0xffff, 0x3186, 0x0000, 0x52aa, 0xffff, 0x39e7, 0x2965, 0xffff, 
-  0xd6da, 0xc617, 0xffff, 0x7bef, 0x00a1, 0x1267, 0x0903, 0x3165, 0xbdd7, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xe73c, 0x5aeb, 0x0061, 0x09c6, 0x01e6, 0x01e6, 0x09e6, 0x01a5, 0x1aa7, 
-  0x11e5, 0x09c4, 0x09e4, 0x1aa7, 0x0040, 0x94b2, 0xffff, 0x2986, 0x0143, 0x0081, 0xce59, 0xad54, 
-  0x0000, 0x0103, 0x09a6, 0x0124, 0x0103, 0x0164, 0x0185, 0x0081, 0xe73c, 0xdefb, 0x1103, 0x0123, 
-  0x7bef, 0xffff, 0x2124, 0x00e1, 0x1a86, 0x1aa7, 0x09c6, 0x09e6, 0x09e6, 0x09e7, 0x0a07, 0x09e6, 
-  0x10c3, 0xf7bd, 0xbdf7, 0x00a2, 0x0a48, 0x0a07, 0x0164, 0x2144, 0xffff, 0x8c50, 0x0040, 0x0a06, 
-  0x1267, 0x00c2, 0x52aa, 0xef7d, 0xffff, 0x9471, 0x0081, 0x1aa8, 0x09a4, 0x630c, 0xffff, 0xe73c, 
-  0xdefb, 0x2924, 0x738d, 0xb595, 0xad54, 0x9cf3, 0xa513, 0xad54, 0xb5b6, 0xb5b6, 0x738e, 0x0020, 
-  0xef7d, 0xd699, 0x00a2, 0x09e6, 0x01e7, 0x0a07, 0x0061, 0x94b2, 0xffff, 0x39c7, 0x0061, 0x0020, 
-  0x2145, 0xffff, 0x73ae, 0x2944, 0xffff, 0x73ae, 0x0082, 0x09e7, 0x10e3, 0xf79e, 0xce79, 0x0000, 
-  0x0985, 0x0a26, 0x0a47, 0x1288, 0x0144, 0x2965, 0xffff, 0x8c71, 0x0081, 0x01e6, 0x01a6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x01a6, 0x01a5, 
-  0x01c6, 0x01e6, 0x01c6, 0x01a6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 
-  0x1247, 0x1aa7, 0x01c5, 0x7491, 0xdfbe, 0xcf1c, 0xcefc, 0xcefb, 0xdf5d, 0x84d3, 0x0185, 0x01e6, 
-  0x01e6, 0x0a67, 0x22c8, 0x0a06, 0x01c5, 0x01e6, 0x01e6, 0x01e6, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e6, 0x01e6, 
-  0x01e5, 0x01e6, 0x01e6, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e6, 0x01e6, 0x01c6, 0x01e6, 
-  0x01e6, 0x0a27, 0x00e2, 0x6b6d, 0xffff, 0x528a, 0x2944, 0x73ae, 0xffff, 0x4207, 0x2985, 0xffff, 
-  0x6b4d, 0x1082, 0xffff, 0x7bcf, 0x0061, 0x0924, 0x0041, 0x0000, 0x0000, 0x4228, 0x4a69, 0x4a49, 
-  0x4a69, 0x4a69, 0x528a, 0x18e3, 0x0000, 0x0041, 0x0061, 0x0985, 0x01c6, 0x09c6, 0x01a5, 0x09a5, 
-  0x2164, 0x3186, 0x31a6, 0x39e7, 0x2965, 0xa534, 0xffbe, 0x52aa, 0x3186, 0x39c7, 0x5289, 0x39e7, 
-  0x3186, 0x18e3, 0x00a2, 0x3186, 0x4208, 0x4208, 0x4248, 0x4a48, 0xef5d, 0xdedb, 0x1103, 0x00c2, 
-  0x7bef, 0xffff, 0x52aa, 0x3186, 0x1903, 0x0144, 0x09c6, 0x09e7, 0x09e6, 0x01c6, 0x0a27, 0x1206, 
-  0x2145, 0xf7be, 0xce38, 0x08a2, 0x09e7, 0x0a27, 0x0164, 0x2965, 0xffff, 0x8c50, 0x0020, 0x0964, 
-  0x0000, 0x5269, 0xffff, 0xe73c, 0xd679, 0xffff, 0x8c51, 0x0061, 0x00c2, 0x5aeb, 0xffff, 0x632c, 
-  0x0000, 0x08e3, 0x00a2, 0x0000, 0x0000, 0x528a, 0x528a, 0x39c7, 0x0000, 0x0020, 0x0123, 0x08e3, 
-  0xef5d, 0xce79, 0x0000, 0x0040, 0x0144, 0x0a27, 0x0061, 0x9cd2, 0xffff, 0x3186, 0x4a49, 0xbdb6, 
-  0xbdd6, 0xffff, 0x738d, 0x2945, 0xffff, 0x7bae, 0x00a2, 0x09e6, 0x08a2, 0xef5c, 0xdefb, 0x0861, 
-  0x0061, 0x0185, 0x01c6, 0x09e6, 0x0081, 0x5289, 0xffff, 0x8c50, 0x00e2, 0x1ac8, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x12a8, 0x12a8, 0x12a7, 0x12a8, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x12a7, 0x12a7, 0x1287, 0x1287, 0x1287, 0x12a7, 0x12a7, 0x12a7, 0x1287, 0x1287, 
-  0x12a7, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x0225, 0x09e6, 0x8cf3, 0xd75d, 0xc6db, 0xcedb, 0xcefb, 0xd73c, 0x7c91, 0x09c6, 0x0a27, 0x0206, 
-  0x1287, 0x1ae8, 0x0a06, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09e6, 0x09e6, 
-  0x09e7, 0x09e6, 0x09e7, 0x01e6, 0x01c6, 0x01e6, 0x09e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x0a28, 0x00e2, 0x6b6d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4228, 0x3186, 0xffff, 
-  0x7bef, 0x18e3, 0xffff, 0x8430, 0x0000, 0x5acb, 0xce59, 0xce79, 0xce79, 0xbdf7, 0xbdf7, 0xbdf7, 
-  0xc617, 0xc618, 0xc618, 0xce59, 0xd69a, 0xce79, 0xa514, 0x00a2, 0x09c7, 0x09c6, 0x09e7, 0x0081, 
-  0x9491, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0x8410, 0x0000, 0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe6fb, 0x1103, 0x00e2, 
-  0x8410, 0xffff, 0xffff, 0xffff, 0x630c, 0x00a2, 0x09e7, 0x09c6, 0x09e6, 0x09e6, 0x1ac8, 0x0902, 
-  0x83ef, 0xffff, 0xffff, 0x5aeb, 0x00e2, 0x0a48, 0x0164, 0x2985, 0xffff, 0x8c50, 0x0000, 0x08a2, 
-  0x840f, 0xffff, 0xe71b, 0x3186, 0x0841, 0xb5b6, 0xffff, 0xa534, 0x0020, 0x528a, 0xffdf, 0x632c, 
-  0x0081, 0x0a07, 0x0144, 0x2124, 0xd69a, 0xffff, 0xffff, 0xffff, 0xa513, 0x08a2, 0x09c6, 0x08e3, 
-  0xe6fb, 0xf79d, 0xb595, 0xa534, 0x1103, 0x01a6, 0x1965, 0xdefb, 0xffff, 0x8c51, 0x5acb, 0xdedb, 
-  0xd699, 0xffff, 0x738d, 0x2945, 0xffff, 0x7bae, 0x0081, 0x0a07, 0x0081, 0x840f, 0xffff, 0xce58, 
-  0x3186, 0x10a2, 0x10e3, 0x10c3, 0x5289, 0xef5d, 0xef7d, 0x41e7, 0x0984, 0x1b08, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ac8, 0x1ac8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x84f3, 0x9575, 0xdf7d, 0xd71c, 0xcefb, 0xcf1c, 0xd73c, 0x6c30, 0x0144, 0x01c6, 0x01c6, 0x1247, 
-  0x22c8, 0x0a47, 0x01e6, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x01e6, 0x01c6, 
-  0x01e6, 0x09e6, 0x09e6, 0x01c6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 
-  0x09e7, 0x01e7, 0x09e7, 0x01e6, 0x01c6, 0x01e7, 0x09e7, 0x01e7, 0x01e7, 0x01e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x0a07, 0x0185, 0x1904, 0x5aca, 0x4a48, 0x4a48, 0x5aeb, 0x630c, 0x10c2, 0x2965, 0xdeba, 
-  0x630c, 0x18c2, 0xd6ba, 0x6b4c, 0x0020, 0x528a, 0xbdd7, 0xad54, 0xad54, 0xad54, 0xad75, 0xad75, 
-  0xad75, 0xad75, 0xad75, 0xad54, 0xa534, 0xb5b6, 0x9471, 0x00a2, 0x09e7, 0x09e7, 0x09e7, 0x09a5, 
-  0x31c6, 0x5aeb, 0x5289, 0x52aa, 0x52aa, 0x5aca, 0x5aca, 0x52aa, 0x4a89, 0x4a48, 0x4a48, 0x4a69, 
-  0x5acb, 0x2965, 0x0041, 0xd6ba, 0xe73c, 0x4a69, 0x4a48, 0x4228, 0x4a49, 0x4207, 0x0924, 0x0103, 
-  0x8430, 0xffff, 0x73ce, 0x5acb, 0x2965, 0x0144, 0x09c6, 0x09c7, 0x09e6, 0x1287, 0x1a66, 0x1903, 
-  0xdeda, 0xffff, 0xffff, 0xb595, 0x10e2, 0x09a5, 0x0164, 0x2985, 0xffff, 0x8c71, 0x0020, 0x10a2, 
-  0xd699, 0xce79, 0x2965, 0x00e3, 0x11a6, 0x18e3, 0x9cd3, 0xbdf7, 0x0841, 0x52aa, 0xffff, 0x6b4d, 
-  0x0081, 0x0a07, 0x10e3, 0xce79, 0xffff, 0x630c, 0x18c3, 0x8c71, 0xffff, 0x9471, 0x0061, 0x08c3, 
-  0xdefa, 0xffde, 0xe73c, 0xd679, 0x10c3, 0x00e3, 0x31e7, 0xffdf, 0xffff, 0xe71c, 0x10a2, 0x0000, 
-  0x2124, 0xffff, 0x738d, 0x2945, 0xffff, 0x7bae, 0x0081, 0x0a07, 0x09a5, 0x0040, 0x8c50, 0xffff, 
-  0xffff, 0xf7be, 0xffde, 0xf7be, 0xffff, 0xef7d, 0x4208, 0x0020, 0x0165, 0x0185, 0x01a5, 0x01c5, 
-  0x01a5, 0x01a5, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c6, 0x01a6, 
-  0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01a5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 
-  0xe7be, 0xdf7d, 0xcedb, 0xcefb, 0xe79e, 0x7cd2, 0x3289, 0x0185, 0x01a6, 0x01c6, 0x0a06, 0x1ac8, 
-  0x0a27, 0x01e6, 0x0206, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x0103, 0x0000, 0x39c6, 0x39c6, 0x0000, 0x0103, 0x09a5, 0x1144, 0x10e3, 
-  0x0882, 0x10a2, 0x52aa, 0x2924, 0x00a2, 0x00e3, 0x0000, 0x4a48, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 
-  0x5aeb, 0x5aeb, 0x5aca, 0x52aa, 0x4a49, 0x0000, 0x0020, 0x0965, 0x09e6, 0x09e7, 0x01c6, 0x1ae8, 
-  0x0a05, 0x0000, 0x8c71, 0xa534, 0xa534, 0xa534, 0xa534, 0xa534, 0x9d13, 0x9cf2, 0x9cd2, 0x7bcf, 
-  0x0000, 0x00e3, 0x00c2, 0xdeda, 0xdedb, 0x0040, 0x09a4, 0x00e2, 0x0081, 0x00c2, 0x0a06, 0x0103, 
-  0x8430, 0xffff, 0x2144, 0x0020, 0x0144, 0x09c6, 0x09c6, 0x01c6, 0x1266, 0x22e7, 0x0060, 0x5269, 
-  0xffff, 0x7bce, 0x8c71, 0xffff, 0x4208, 0x00a1, 0x1a67, 0x29a6, 0xffff, 0x9491, 0x00a1, 0x0944, 
-  0x0861, 0x0000, 0x0000, 0x0082, 0x00c2, 0x0020, 0x0000, 0x0000, 0x0000, 0x10a2, 0x630c, 0x2124, 
-  0x0103, 0x01e6, 0x2144, 0xffff, 0xc617, 0x0020, 0x00e3, 0x0882, 0xef7c, 0xc617, 0x0020, 0x0882, 
-  0xe73b, 0xce78, 0x0020, 0x0081, 0x0903, 0x0000, 0x8c50, 0xf7be, 0xc618, 0xffff, 0x632c, 0x0000, 
-  0x31a6, 0xffff, 0x73ae, 0x2965, 0xffff, 0x7bce, 0x0081, 0x09e7, 0x01e7, 0x09a5, 0x0020, 0x4228, 
-  0x840f, 0x9492, 0x9491, 0x9492, 0x7bef, 0x3165, 0x00a1, 0x22a8, 0x1a87, 0x1ac8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ac8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae9, 0x1ae9, 0x1ae9, 0x1ae9, 0x1ae9, 0x22e9, 0x22e9, 
-  0xcefb, 0xcefb, 0xcf1c, 0xdf7d, 0x8d13, 0x11c6, 0x0144, 0x09c6, 0x01c6, 0x0a07, 0x1aa8, 0x0a27, 
-  0x01e6, 0x01e6, 0x0206, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 0x1b28, 0x1b08, 0x1b28, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 0x1b28, 0x1b28, 0x1b08, 0x1b08, 0x1b28, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 0x1b28, 0x1b28, 
-  0x1b08, 0x1b08, 0x1ac8, 0x1ac8, 0x00a1, 0xe71b, 0xe71b, 0x0000, 0x0081, 0x0081, 0x0061, 0x0061, 
-  0x0000, 0x2945, 0xffff, 0x8430, 0x0061, 0x09e6, 0x08e3, 0xce38, 0xffdf, 0xf7be, 0xf7de, 0xf7be, 
-  0xf7bd, 0xf7bd, 0xf79d, 0xffff, 0xffde, 0x1904, 0x0165, 0x09c6, 0x09c6, 0x09e7, 0x01e6, 0x1308, 
-  0x1b07, 0x10e3, 0xad75, 0xce58, 0xc638, 0xce59, 0xce79, 0xce58, 0xc637, 0xc617, 0xffde, 0xef5c, 
-  0x10c3, 0x09e6, 0x00e3, 0xdedb, 0xdeba, 0x0902, 0x1288, 0x01a5, 0x09a5, 0x09c6, 0x0a06, 0x00e2, 
-  0x8410, 0xffff, 0x31e7, 0x0164, 0x0a07, 0x09e7, 0x09e6, 0x1267, 0x1a87, 0x09a4, 0x2104, 0xc617, 
-  0xffde, 0x10a2, 0x39c6, 0xffff, 0xad54, 0x10e2, 0x09a4, 0x31a6, 0xffff, 0x9491, 0x00a2, 0x0a06, 
-  0x1103, 0x9cf3, 0xb595, 0xad54, 0xad55, 0xb575, 0xb595, 0xad54, 0xa534, 0x9cf3, 0x9cd2, 0x4207, 
-  0x0103, 0x0206, 0x1944, 0xffdf, 0xbdf7, 0x00a2, 0x09e6, 0x0861, 0xef5b, 0xbdf6, 0x0020, 0x0082, 
-  0xe73b, 0xce78, 0x0061, 0x0a07, 0x0985, 0x0841, 0xd699, 0xc638, 0x2124, 0xffff, 0xb595, 0x0861, 
-  0x31a6, 0xffff, 0x73ae, 0x2965, 0xffff, 0x7bae, 0x0081, 0x09e7, 0x09e6, 0x01e6, 0x1944, 0xb596, 
-  0x6b4d, 0x0000, 0x00c2, 0x0000, 0x8c71, 0x632c, 0x08c2, 0x1226, 0x0a26, 0x0a46, 0x0a66, 0x0a67, 
-  0x0a67, 0x0a67, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x1267, 0x1266, 0x1266, 0x0a66, 0x1266, 0x1286, 
-  0x1286, 0x1266, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 
-  0x0a66, 0x0a67, 0x0a67, 0x0a66, 0x0a67, 0x0a66, 0x0a66, 0x0a67, 0x1267, 0x1267, 0x1267, 0x0a66, 
-  0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x0a67, 0x1267, 0x0a67, 0x1267, 0x1267, 0x1267, 0x1267, 0x1247, 
-  0xd71c, 0xcf1c, 0xd71c, 0x9554, 0x09c6, 0x01c6, 0x09e6, 0x01c6, 0x0a06, 0x1a87, 0x09e6, 0x01c6, 
-  0x01c6, 0x01e6, 0x1ac8, 0x1286, 0x0a46, 0x0a66, 0x0a66, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a66, 0x0a66, 0x0a66, 0x0a66, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a26, 0x0a26, 0x00a1, 0xce58, 0xffdf, 0xce79, 0xce59, 0xce59, 0xce58, 0xce38, 
-  0xc637, 0xd699, 0xffff, 0x840f, 0x0081, 0x0a06, 0x00c2, 0x3165, 0x39e7, 0x31a6, 0x3186, 0x2965, 
-  0x2945, 0x2965, 0x2945, 0xbdf6, 0xef7c, 0x10e3, 0x0165, 0x09c6, 0x09c6, 0x09e6, 0x0206, 0x1307, 
-  0x1b07, 0x08e2, 0x2965, 0x3185, 0x3185, 0x31a6, 0x31a6, 0x3185, 0x3186, 0x2965, 0xc617, 0xe73c, 
-  0x08c3, 0x09e6, 0x00e2, 0xd6ba, 0xd6ba, 0x10a2, 0x10e3, 0x10c3, 0x10c2, 0x08a2, 0x1904, 0x0040, 
-  0x7bef, 0xffff, 0x31a6, 0x0144, 0x0a07, 0x0a07, 0x1267, 0x1a87, 0x09c6, 0x0061, 0x4a69, 0xffff, 
-  0xbdd6, 0x0020, 0x0020, 0xbdf7, 0xffff, 0x39e7, 0x0040, 0x2986, 0xffff, 0x9471, 0x00a2, 0x0a67, 
-  0x2185, 0xe6fb, 0xf79d, 0xf79d, 0xf79d, 0xf79e, 0xf79d, 0xef7c, 0xef5c, 0xf79d, 0xffff, 0x73ae, 
-  0x0123, 0x0a47, 0x2144, 0xffff, 0xc618, 0x0040, 0x00a2, 0x1082, 0xef7c, 0xce78, 0x0061, 0x08c2, 
-  0xe73b, 0xce58, 0x0061, 0x0a07, 0x00a2, 0x73ae, 0xffff, 0x8c51, 0x0000, 0xce79, 0xffff, 0x31a6, 
-  0x2965, 0xffff, 0x73ae, 0x2965, 0xffff, 0x73ae, 0x00a1, 0x0a07, 0x01e6, 0x0185, 0x1924, 0xffff, 
-  0xad54, 0x0061, 0x09c5, 0x10c2, 0xffff, 0xb5b6, 0x0000, 0x0164, 0x0185, 0x01e6, 0x01e6, 0x0206, 
-  0x01e6, 0x01e6, 0x01e5, 0x01e5, 0x01e5, 0x01e6, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e5, 0x0205, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x0205, 0x01e5, 0x01e5, 
-  0x01e6, 0x01e6, 0x01e5, 0x01e5, 0x0206, 0x01e6, 0x01e6, 0x01e6, 0x0206, 0x0206, 0x0206, 0x01e6, 
-  0xdf7d, 0x9554, 0x11c6, 0x11e6, 0x01c6, 0x09e7, 0x01e6, 0x1246, 0x22a8, 0x09e6, 0x01c6, 0x01c6, 
-  0x0a26, 0x22e8, 0x1247, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x00a2, 0xd679, 0xf79e, 0xb5b6, 0xbdd7, 0xb5d6, 0xb5b6, 0xb595, 
-  0xb595, 0xbdd6, 0xffff, 0x8410, 0x0081, 0x09e7, 0x0082, 0xce38, 0xffdf, 0xffff, 0xffff, 0xfffe, 
-  0xffff, 0xffff, 0xffde, 0xffff, 0xffbe, 0x18e3, 0x0165, 0x09e7, 0x09e6, 0x09e7, 0x01e6, 0x12e7, 
-  0x12e7, 0x1123, 0xef5c, 0xffff, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 
-  0x1103, 0x01e7, 0x00c2, 0xdeda, 0xffff, 0xf7bd, 0xffde, 0xffdf, 0xffbe, 0xffbe, 0xd6ba, 0x0020, 
-  0x73ae, 0xffff, 0x2986, 0x0123, 0x01e7, 0x1ac8, 0x22c8, 0x09e6, 0x0164, 0x2965, 0xf79d, 0xffde, 
-  0x39e7, 0x00c2, 0x0902, 0x4a69, 0xf79e, 0xffde, 0x39c7, 0x2104, 0xffff, 0x8c51, 0x0163, 0x2baa, 
-  0x19c5, 0x0882, 0x0881, 0x0881, 0x08a2, 0x0881, 0x0861, 0x0861, 0x0020, 0x52aa, 0xffdf, 0x6b6d, 
-  0x09e4, 0x238a, 0x1103, 0xad34, 0xffff, 0x7bae, 0x2945, 0x94b2, 0xffff, 0x736d, 0x0943, 0x1164, 
-  0xe73c, 0xce38, 0x08e2, 0x09e5, 0x4248, 0xffff, 0xdefb, 0x10c3, 0x00a2, 0x39c7, 0xffdf, 0xe73c, 
-  0x4207, 0xffff, 0x73ae, 0x2945, 0xffff, 0x73ae, 0x0963, 0x19a5, 0x1945, 0x1924, 0x2965, 0xf7be, 
-  0xa534, 0x10c3, 0x2145, 0x2145, 0xef9d, 0xb595, 0x10a2, 0x2144, 0x1964, 0x1a67, 0x2329, 0x1b08, 
-  0x2328, 0x1b29, 0x1b08, 0x2308, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 0x2329, 0x2329, 0x1b28, 
-  0x1b28, 0x1b28, 0x1b08, 0x1b08, 0x1b28, 0x1b28, 0x2328, 0x2328, 0x2329, 0x1b28, 0x1b28, 0x1b28, 
-  0x1b08, 0x1b28, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b28, 0x2328, 0x1b28, 0x1b28, 0x2328, 0x1b28, 0x2328, 0x1b28, 0x2328, 
-  0x8d34, 0x09a5, 0x0185, 0x01c6, 0x09e7, 0x01e6, 0x0a47, 0x1ae8, 0x0a06, 0x01e6, 0x01e6, 0x01e6, 
-  0x1ac8, 0x1266, 0x01c6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x01e6, 0x01e6, 
-  0x01e6, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x01e7, 
-  0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x01e7, 0x09e7, 0x09e6, 0x0081, 0xd6ba, 0xd699, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x18e3, 0xffdf, 0x8430, 0x0081, 0x0a07, 0x00a2, 0xd679, 0xf79d, 0x52aa, 0x528a, 0x5aca, 
-  0x5acb, 0x5acb, 0x528a, 0x4a69, 0x4a28, 0x0881, 0x0185, 0x09e7, 0x09e7, 0x09e7, 0x01c6, 0x12c7, 
-  0x12e7, 0x1123, 0xef5d, 0xce58, 0x18e3, 0x2124, 0x2124, 0x2124, 0x2965, 0x3186, 0x3186, 0x2945, 
-  0x08c3, 0x0a07, 0x0944, 0x7bae, 0x9cb2, 0x9491, 0x94b2, 0x9cd3, 0x9cd2, 0x9cd3, 0x52aa, 0x0000, 
-  0x7bce, 0xffdf, 0x2965, 0x0123, 0x1287, 0x1aa8, 0x0a07, 0x0a07, 0x0185, 0x2165, 0xce38, 0x7bef, 
-  0x0040, 0x1a87, 0x2287, 0x0040, 0x7bae, 0xc618, 0x2965, 0x2124, 0xffff, 0x8c51, 0x0983, 0x1ae9, 
-  0x0a07, 0x09c6, 0x01a5, 0x1226, 0x1a87, 0x09c5, 0x0185, 0x09a6, 0x0081, 0x52aa, 0xffdf, 0x738e, 
-  0x0102, 0x0a68, 0x0964, 0x0841, 0xad55, 0xffff, 0xffff, 0xffff, 0x8c50, 0x0081, 0x0a06, 0x0903, 
-  0xe73c, 0xce38, 0x0041, 0x00e2, 0x31a6, 0xb596, 0x4208, 0x00c2, 0x09e6, 0x0061, 0x83ef, 0xbdb6, 
-  0x39c7, 0xffff, 0x6b8d, 0x2965, 0xffdf, 0x7bef, 0x0020, 0x4248, 0xffff, 0xffde, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd679, 0x00c2, 0x0a06, 0x0206, 
-  0x0206, 0x0206, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x0206, 0x0206, 0x0206, 
-  0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x0206, 0x0206, 0x0206, 0x0a06, 0x01e6, 0x01e6, 0x01e6, 
-  0x0a06, 0x0a06, 0x01e6, 0x09e6, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 
-  0x0165, 0x01a5, 0x01c6, 0x09e6, 0x01e6, 0x1247, 0x22e8, 0x0a06, 0x01e6, 0x01e6, 0x0a06, 0x22e8, 
-  0x1226, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09c6, 0x09c6, 0x09e6, 0x09e7, 0x09e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e7, 0x09e7, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 
-  0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x01e6, 0x0082, 0xdeba, 0xffff, 0xef5c, 0xef5c, 0xef5c, 0xef5c, 0xef7c, 
-  0xef7d, 0xef9d, 0xffff, 0x9491, 0x00a2, 0x0a27, 0x00a2, 0xdeda, 0xffff, 0xbdf7, 0xc617, 0xc638, 
-  0xc638, 0xc618, 0xc617, 0xbdd7, 0xc618, 0x4228, 0x0124, 0x0a07, 0x09e7, 0x09e7, 0x01c6, 0x12c7, 
-  0x12e7, 0x1123, 0xf7be, 0xffff, 0xce99, 0xd699, 0xce99, 0xd699, 0xdeda, 0xdedb, 0xdedb, 0xdedb, 
-  0x31c6, 0x0a26, 0x1a46, 0x0040, 0x0000, 0x0000, 0x00a0, 0x0101, 0x00e1, 0x00e1, 0x00e3, 0x0000, 
-  0x83ef, 0xffff, 0x2965, 0x0984, 0x22c8, 0x0a06, 0x09e7, 0x0a07, 0x0a07, 0x0144, 0x0040, 0x0061, 
-  0x1a66, 0x1a67, 0x09c6, 0x09a5, 0x0061, 0x0000, 0x0061, 0x31a6, 0xffff, 0x9cd3, 0x00c2, 0x0a48, 
-  0x0a07, 0x0a07, 0x1287, 0x2308, 0x0a07, 0x09e6, 0x09e7, 0x0a28, 0x0103, 0x630c, 0xffff, 0x7bef, 
-  0x00e2, 0x0a27, 0x09c6, 0x00c3, 0x0841, 0x4a48, 0x632c, 0x528a, 0x0041, 0x09c6, 0x0a07, 0x08c3, 
-  0xffbe, 0xdeba, 0x0020, 0x0965, 0x00c2, 0x0040, 0x00e3, 0x09e6, 0x01e6, 0x09c6, 0x00c2, 0x0000, 
-  0x2965, 0xffff, 0x73ae, 0x31a6, 0xffff, 0x8410, 0x0020, 0x29a6, 0x8410, 0x7bef, 0x7bef, 0x7bce, 
-  0x7bce, 0x7bef, 0x83ef, 0x83ef, 0x83ef, 0x83ef, 0x840f, 0x8c30, 0x6b6d, 0x08c2, 0x01c6, 0x01c6, 
-  0x09e7, 0x09c6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01e6, 0x09e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x01c6, 
-  0x01c6, 0x09c6, 0x09c6, 0x01c6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09c7, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x1247, 0x1ac8, 0x0a06, 0x01c6, 0x01e6, 0x0a06, 0x1ae8, 0x1287, 
-  0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x09c6, 
-  0x09c6, 0x09e6, 0x01e6, 0x01e6, 0x01e7, 0x09e6, 0x01e7, 0x01e7, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 
-  0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 0x09e7, 
-  0x09e7, 0x01e7, 0x09e6, 0x09e7, 0x00c2, 0x630b, 0xa514, 0xa514, 0xa514, 0xa513, 0xa513, 0xa513, 
-  0xa534, 0xa514, 0xa514, 0x4228, 0x0124, 0x0a27, 0x00e3, 0x738d, 0xb575, 0xb5b6, 0xbdd6, 0xbdd6, 
-  0xbdd6, 0xbdb6, 0xbdd6, 0xbdd7, 0xc618, 0x39e7, 0x0123, 0x0a07, 0x09c7, 0x09e7, 0x01e6, 0x12c7, 
-  0x12e7, 0x0903, 0x8c30, 0xa514, 0xad34, 0xa513, 0x9cf3, 0x9cf3, 0xa514, 0xa534, 0xad34, 0xad55, 
-  0x2145, 0x09c5, 0x09a5, 0x09a6, 0x09a5, 0x1226, 0x2308, 0x2328, 0x2b89, 0x2329, 0x1247, 0x0082, 
-  0x4a49, 0xa4f4, 0x18e3, 0x11c5, 0x09e6, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x09e6, 0x1aa7, 
-  0x1aa7, 0x09e6, 0x09e7, 0x09e6, 0x09c6, 0x09c6, 0x0165, 0x1924, 0xb596, 0x6b4c, 0x0103, 0x0a47, 
-  0x0a27, 0x12a7, 0x1ac7, 0x09e5, 0x01c6, 0x09e6, 0x09c6, 0x0a27, 0x0185, 0x39e7, 0xa4f4, 0x4a69, 
-  0x0103, 0x01a6, 0x0185, 0x01a6, 0x0144, 0x0082, 0x0081, 0x0103, 0x09e6, 0x0207, 0x01c6, 0x0082, 
-  0x8c51, 0x83ef, 0x0082, 0x01a6, 0x0185, 0x01a6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x09c6, 0x0144, 
-  0x08a2, 0x528a, 0x2124, 0x2104, 0xa4f4, 0x4a49, 0x00e3, 0x0185, 0x0061, 0x0061, 0x0041, 0x0041, 
-  0x0041, 0x0020, 0x0040, 0x0041, 0x0061, 0x0061, 0x0061, 0x0061, 0x0081, 0x0165, 0x01a6, 0x01a6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x01c6, 0x01a6, 0x01a6, 0x01a5, 0x01c5, 
-  0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c6, 0x01a6, 0x01a6, 0x01a6, 
-  0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x09c6, 0x01a6, 0x0a47, 0x1ac8, 0x01e6, 0x01c6, 0x01e6, 0x0a06, 0x1ac7, 0x1286, 0x01c6, 
-  0x09e6, 0x09e6, 0x01e7, 0x09e7, 0x01e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09e7, 
-  0x09e6, 0x01e7, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x00a2, 0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 
-  0x0020, 0x0020, 0x0041, 0x00e3, 0x01c6, 0x01c6, 0x01a6, 0x0082, 0x0040, 0x0020, 0x0020, 0x0020, 
-  0x0020, 0x0020, 0x0020, 0x0040, 0x0041, 0x00e3, 0x09a6, 0x09e7, 0x09e7, 0x09e6, 0x01c6, 0x12e8, 
-  0x1286, 0x1205, 0x00a1, 0x00c1, 0x0081, 0x0081, 0x00a1, 0x0000, 0x0000, 0x0000, 0x0020, 0x0060, 
-  0x0903, 0x0985, 0x09a6, 0x01a5, 0x0a06, 0x1aa7, 0x1287, 0x2348, 0x2308, 0x0a27, 0x09e7, 0x0185, 
-  0x0082, 0x0060, 0x0943, 0x01a6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x1aa7, 0x1a87, 
-  0x01c6, 0x09c6, 0x09c6, 0x09e6, 0x09e7, 0x09e7, 0x0a06, 0x1a06, 0x00a1, 0x00e3, 0x09e6, 0x0207, 
-  0x1288, 0x1ac7, 0x09c5, 0x01c6, 0x09e6, 0x09c6, 0x09e6, 0x0a07, 0x0a27, 0x1205, 0x0983, 0x11e5, 
-  0x1a87, 0x1287, 0x12a7, 0x12a7, 0x12c8, 0x1ae8, 0x1b28, 0x1b49, 0x1b48, 0x1b28, 0x1ae8, 0x1225, 
-  0x00c1, 0x0142, 0x1ac7, 0x1b08, 0x12c7, 0x1aa7, 0x1ae7, 0x1308, 0x1308, 0x12e8, 0x12a7, 0x12a7, 
-  0x1266, 0x01e4, 0x1225, 0x1205, 0x0122, 0x09c4, 0x1ac7, 0x1b08, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x12e7, 0x12c7, 0x1ae8, 
-  0x1ae7, 0x1ae7, 0x1ae7, 0x1ae7, 0x1ae7, 0x1ae7, 0x1ae7, 0x1ae7, 0x1ae7, 0x12e7, 0x12e7, 0x12e7, 
-  0x12e7, 0x12e7, 0x1307, 0x1ae7, 0x1ae7, 0x12e7, 0x1ae7, 0x12e7, 0x12e7, 0x12e7, 0x12e7, 0x12e7, 
-  0x12e7, 0x12e7, 0x12e7, 0x12e7, 0x12e7, 0x12e7, 0x12e7, 0x12e7, 0x12e7, 0x12e7, 0x12e7, 0x12e7, 
-  0x12e7, 0x12e7, 0x12e7, 0x1ae7, 0x1ae7, 0x12e7, 0x1ae7, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x01c6, 0x01a6, 0x0a06, 0x1aa8, 0x0a06, 0x01c6, 0x01c6, 0x0206, 0x1ac7, 0x0a46, 0x01c6, 0x01e6, 
-  0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 
-  0x09e6, 0x09e6, 0x09e6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x09c6, 0x09e6, 0x09c6, 0x09c6, 
-  0x09e7, 0x09c6, 0x09c6, 0x09e7, 0x09e6, 0x09e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x01e6, 0x09e6, 0x09e6, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x01c6, 0x1287, 
-  0x1226, 0x1266, 0x1266, 0x2349, 0x0a47, 0x12a7, 0x23aa, 0x0a07, 0x09e7, 0x09c6, 0x1a87, 0x1a47, 
-  0x09c6, 0x09c6, 0x01c6, 0x1247, 0x22e8, 0x0a26, 0x1ac7, 0x1aa7, 0x0a06, 0x0a07, 0x09c6, 0x0185, 
-  0x1247, 0x22a8, 0x09c6, 0x09c6, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x01c6, 0x1aa8, 0x1a87, 0x09e6, 
-  0x09e7, 0x09c6, 0x09c6, 0x09c6, 0x09e7, 0x0a27, 0x2309, 0x1aa8, 0x0a07, 0x0a07, 0x0a27, 0x12c8, 
-  0x1ac8, 0x09e6, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 0x0a28, 0x0a28, 0x1ae9, 0x2baa, 0x2bea, 0x23a9, 
-  0x2368, 0x1b67, 0x1b68, 0x2388, 0x23c8, 0x23e8, 0x23c8, 0x23c8, 0x23c9, 0x23e8, 0x23c8, 0x23a8, 
-  0x23a9, 0x23e9, 0x2409, 0x2409, 0x23e9, 0x2c09, 0x2be9, 0x23c8, 0x23c8, 0x23a8, 0x2368, 0x2388, 
-  0x23c8, 0x23e9, 0x23a8, 0x23a8, 0x23a9, 0x23a8, 0x23a8, 0x23a8, 0x23a8, 0x23a8, 0x23a8, 0x23a8, 
-  0x23a8, 0x23a8, 0x23a8, 0x23a8, 0x23a8, 0x23a8, 0x23a8, 0x23a8, 0x23a8, 0x23a8, 0x23a8, 0x23a8, 
-  0x23a8, 0x23a8, 0x23a8, 0x23a8, 0x23a8, 0x23a8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 
-  0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 
-  0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23c8, 0x23a8, 0x23a8, 0x23a8, 
-  0x23a8, 0x23a8, 0x23a8, 0x23c8, 0x23c8, 0x23c9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 0x2bc9, 
-  0x01c6, 0x0a06, 0x1ae8, 0x0a06, 0x01c6, 0x09e6, 0x01c6, 0x0a06, 0x1b28, 0x01e6, 0x01e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x09c6, 0x09e6, 0x09e6, 0x09c6, 0x09c6, 0x09c6, 0x09e6, 0x01e6, 
-  0x09e6, 0x09c6, 0x09e6, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e6, 0x09c6, 0x09e6, 0x09e6, 0x09c6, 
-  0x09e6, 0x09e7, 0x09e7, 0x01e7, 0x01e7, 0x09e6, 0x09c6, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01c6, 0x09e6, 0x09e7, 0x09e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e6, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09c6, 0x09e6, 0x0a07, 0x09e7, 0x09e7, 0x0186, 0x1267, 
-  0x1246, 0x1266, 0x1246, 0x1b49, 0x0a67, 0x0a87, 0x2389, 0x01a6, 0x00e2, 0x0143, 0x1aa7, 0x09e6, 
-  0x09c6, 0x01a6, 0x1247, 0x2328, 0x12a7, 0x1ae8, 0x1287, 0x09c6, 0x09e6, 0x09e7, 0x09a6, 0x1247, 
-  0x1aa8, 0x09e6, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01c6, 0x1a87, 0x1a87, 0x09e6, 0x09e6, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0185, 0x1aa8, 0x12a8, 0x09e6, 0x0a07, 0x09e6, 0x0964, 0x0984, 
-  0x0964, 0x09a6, 0x09e6, 0x09c6, 0x09e7, 0x0a07, 0x0185, 0x0a06, 0x1266, 0x0184, 0x0143, 0x0102, 
-  0x09a4, 0x0a05, 0x0a05, 0x0a66, 0x0aa6, 0x0a86, 0x0a66, 0x0a46, 0x0a46, 0x0a46, 0x0225, 0x0205, 
-  0x01e5, 0x0205, 0x0205, 0x0a25, 0x0aa6, 0x0204, 0x01a3, 0x09e5, 0x0143, 0x0122, 0x09e5, 0x0a66, 
-  0x0a66, 0x0a46, 0x0a46, 0x0a46, 0x0a26, 0x0a26, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a26, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a26, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x01c6, 0x0a46, 0x1b08, 0x01c6, 0x09e7, 0x09e6, 0x01c6, 0x0a06, 0x1b28, 0x0a06, 0x01e6, 0x09e6, 
-  0x09e6, 0x09e7, 0x09e6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 
-  0x01e6, 0x09e6, 0x01c6, 0x01c6, 0x01e6, 0x01e7, 0x09e7, 0x01e6, 0x09c6, 0x01e6, 0x09e6, 0x09e6, 
-  0x09c6, 0x09e6, 0x01e7, 0x09e6, 0x09e6, 0x09e6, 0x01c6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09c7, 0x09e6, 0x01e7, 0x09e7, 0x09e7, 0x09e6, 
-  0x01e6, 0x01e7, 0x09e7, 0x09e7, 0x01e7, 0x09e6, 0x09c6, 0x09c7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e6, 0x09e7, 0x0a07, 0x09a5, 0x00c3, 0x08e3, 0x09a6, 0x0a07, 0x0a07, 0x0965, 0x0041, 0x0061, 
-  0x0081, 0x0061, 0x0081, 0x0923, 0x0123, 0x1287, 0x1b48, 0x1944, 0x6b2c, 0x31a6, 0x11c4, 0x0a26, 
-  0x01c6, 0x0a06, 0x2348, 0x12e7, 0x12c7, 0x12c7, 0x01c6, 0x09c6, 0x09c6, 0x09c6, 0x1a47, 0x1ac8, 
-  0x01c5, 0x09e6, 0x0a07, 0x09e7, 0x09e7, 0x09c6, 0x01a6, 0x1a87, 0x1aa7, 0x01c6, 0x09e6, 0x09c6, 
-  0x09c6, 0x09e7, 0x09e7, 0x0944, 0x2986, 0x29a6, 0x0985, 0x0a07, 0x0a27, 0x0144, 0x39e7, 0x6b6d, 
-  0x10c3, 0x0165, 0x09c6, 0x09e7, 0x09c6, 0x0040, 0x2986, 0x4249, 0x3a07, 0x39e7, 0x31a6, 0x39a6, 
-  0x0041, 0x00a2, 0x09e6, 0x01e6, 0x0207, 0x01e7, 0x01e6, 0x01c6, 0x01a6, 0x0904, 0x1904, 0x2124, 
-  0x1924, 0x1904, 0x2104, 0x1903, 0x00c2, 0x52aa, 0x5acb, 0x0000, 0x4228, 0x5acb, 0x00c2, 0x01e6, 
-  0x01c6, 0x01c6, 0x09c6, 0x09e6, 0x09e7, 0x09c6, 0x01c6, 0x01c6, 0x01a6, 0x01c6, 0x01c6, 0x09c6, 
-  0x01c6, 0x09c6, 0x01c7, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x01c6, 0x09e6, 
-  0x01e7, 0x09c6, 0x09c6, 0x01c6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x09c6, 0x09c6, 0x09c6, 0x01c6, 0x01c6, 0x01a6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x01c6, 0x09c6, 0x09e6, 0x09c7, 0x09c7, 0x09e7, 0x09c7, 0x09c7, 
-  0x01a6, 0x0a46, 0x1b08, 0x01c6, 0x09e6, 0x09e6, 0x01c6, 0x0a06, 0x1b28, 0x0a06, 0x01e6, 0x09e6, 
-  0x09e6, 0x01e7, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x01e7, 0x01e6, 0x09e6, 0x09e7, 0x09c6, 0x09e6, 
-  0x09e6, 0x09c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 
-  0x09e7, 0x09e7, 0x01e6, 0x09e6, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01e7, 0x09e7, 0x09e7, 0x09c7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 0x01e7, 
-  0x01e7, 0x01e7, 0x01e7, 0x09e7, 0x01e7, 0x01c6, 0x01c6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x0a07, 0x01a6, 0x1944, 0xce58, 0xad34, 0x0103, 0x0a27, 0x01e6, 0x1144, 0xc618, 0xd6ba, 
-  0xd679, 0xd679, 0xd679, 0xce59, 0x9492, 0x1184, 0x1ae7, 0x31c6, 0xffff, 0x8410, 0x00e2, 0x1227, 
-  0x01a6, 0x1247, 0x2328, 0x01e6, 0x1b08, 0x12a7, 0x01c6, 0x09a6, 0x0985, 0x1226, 0x1aa7, 0x0964, 
-  0x31c7, 0x1104, 0x0985, 0x0a07, 0x09c6, 0x01a5, 0x1266, 0x1aa7, 0x0a06, 0x09e7, 0x09e7, 0x09c7, 
-  0x09e7, 0x09e7, 0x0a06, 0x1944, 0xef5c, 0xd679, 0x00e3, 0x0a47, 0x1aa7, 0x0101, 0x9491, 0xffff, 
-  0x31a6, 0x0103, 0x09e7, 0x09a6, 0x08a2, 0x8410, 0xffde, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xbdd7, 0x39c7, 0x00a2, 0x09e7, 0x0207, 0x01c6, 0x01c6, 0x01c6, 0x0145, 0x10c3, 0xdeda, 0xffdf, 
-  0xffff, 0xffff, 0xf7be, 0xa514, 0x0000, 0xdeda, 0xf7bd, 0x0020, 0xbdf7, 0xffde, 0x08c2, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x09e7, 0x09c7, 0x09c6, 
-  0x01a6, 0x0a47, 0x1b08, 0x01c6, 0x09e6, 0x09e6, 0x01c6, 0x0a06, 0x1b28, 0x0a06, 0x09e6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09c6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x01e7, 0x01e6, 
-  0x01e7, 0x01e7, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x09c6, 0x09e6, 0x09e7, 0x01e7, 0x09e7, 0x09e6, 
-  0x09e6, 0x09e7, 0x01e6, 0x09e7, 0x01e7, 0x09e7, 0x09e6, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 
-  0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x01e7, 0x09e7, 
-  0x01e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e7, 0x01c6, 0x09e6, 0x09e7, 0x09c6, 0x09e6, 0x09e7, 
-  0x09e7, 0x09e7, 0x0103, 0x2124, 0xffff, 0xd6ba, 0x0061, 0x09c6, 0x01c6, 0x1124, 0xbdd7, 0xce38, 
-  0xc5f7, 0xbdd6, 0xbdd6, 0xffff, 0xce38, 0x0942, 0x1b07, 0x31a6, 0xffff, 0x83ef, 0x0122, 0x1247, 
-  0x0186, 0x1247, 0x1b08, 0x01e6, 0x1b28, 0x12a7, 0x01c6, 0x01a5, 0x1226, 0x1a47, 0x0185, 0x10c3, 
-  0xffff, 0xa514, 0x0020, 0x0985, 0x09c5, 0x1246, 0x1a87, 0x01e6, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x09e7, 0x0a07, 0x1205, 0x10c2, 0xf79e, 0xd69a, 0x0041, 0x09e6, 0x2308, 0x00a1, 0x8c50, 0xffdf, 
-  0x2965, 0x0124, 0x0a07, 0x00c2, 0x9cd2, 0xffff, 0xad54, 0x4228, 0x4228, 0x4208, 0x4228, 0x630c, 
-  0xef5d, 0xef7d, 0x4a49, 0x09c5, 0x12a8, 0x0a27, 0x0a27, 0x1227, 0x09c6, 0x10c3, 0xf7be, 0xc638, 
-  0x632c, 0x73ae, 0xffdf, 0xb595, 0x0000, 0xc637, 0xdf1a, 0x0000, 0xb595, 0xef5c, 0x08e2, 0x0a47, 
-  0x1287, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x0a67, 0x1267, 0x1267, 0x0a67, 0x0a67, 0x0a67, 
-  0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x0a67, 0x0a67, 0x1267, 0x1267, 0x1267, 
-  0x1267, 0x1267, 0x0a67, 0x0a67, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 
-  0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x0a67, 0x1287, 0x1267, 0x1267, 0x1267, 
-  0x1267, 0x1267, 0x1287, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x0a67, 
-  0x0a87, 0x0a67, 0x0a67, 0x1267, 0x1267, 0x1267, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x01c6, 0x0a66, 0x1b08, 0x01c6, 0x09e6, 0x09e6, 0x01e6, 0x0a06, 0x1b08, 0x0a06, 0x01e6, 0x01e7, 
-  0x09e7, 0x09e6, 0x09e6, 0x01e7, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x01e7, 
-  0x01e6, 0x01e6, 0x09e6, 0x01c6, 0x01e6, 0x01e6, 0x01c6, 0x09e6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 
-  0x09e7, 0x0185, 0x0185, 0x01a6, 0x0a07, 0x09e7, 0x01e6, 0x09e6, 0x09e7, 0x09e6, 0x01e6, 0x09e6, 
-  0x09e7, 0x09e7, 0x01e7, 0x09e7, 0x09e6, 0x01e7, 0x01e6, 0x01e7, 0x09e7, 0x09c6, 0x09e6, 0x09e7, 
-  0x09e7, 0x0a07, 0x00c2, 0x6b4d, 0xef7d, 0xf79e, 0x4a28, 0x00e3, 0x09e6, 0x0944, 0x00c2, 0x0103, 
-  0x00c2, 0x00a1, 0x0000, 0xdeda, 0xbdd6, 0x00e2, 0x1ac6, 0x2985, 0xffff, 0x840f, 0x0163, 0x1288, 
-  0x01a6, 0x1247, 0x1ae8, 0x01c5, 0x1b08, 0x12a7, 0x01c6, 0x09e6, 0x1a87, 0x09c6, 0x09e6, 0x0903, 
-  0x7bef, 0xffff, 0x8c71, 0x0000, 0x11c5, 0x1aa7, 0x09e6, 0x09e6, 0x09c6, 0x09e7, 0x0a07, 0x0a07, 
-  0x0a07, 0x1206, 0x0020, 0x73ae, 0xffff, 0xffdf, 0x7bef, 0x0000, 0x11e6, 0x0081, 0x8c30, 0xffff, 
-  0x3186, 0x0144, 0x0a27, 0x0944, 0xe73c, 0xe71c, 0x0000, 0x0000, 0x00c1, 0x00e2, 0x0103, 0x0000, 
-  0x52aa, 0xffff, 0x8430, 0x0963, 0x2309, 0x1aa7, 0x1ac8, 0x1ae8, 0x1ae8, 0x1944, 0xffff, 0x94b2, 
-  0x0000, 0x0061, 0xef7d, 0xb5b5, 0x0000, 0xc616, 0xf79d, 0x840f, 0xdefb, 0xef3d, 0x1103, 0x1ae7, 
-  0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1b08, 0x2308, 0x1b08, 0x1b08, 
-  0x2308, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x2308, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 0x2328, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x2308, 0x1b08, 0x2308, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x2308, 0x2328, 0x2328, 0x2328, 
-  0x01c6, 0x0a66, 0x1b08, 0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x0a06, 0x1b08, 0x0a06, 0x01e6, 0x01e7, 
-  0x01e6, 0x09e7, 0x09e7, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x09c6, 0x01c6, 0x09e7, 0x09e6, 0x01e6, 0x09c6, 0x09c6, 0x09c6, 0x01c6, 0x01e6, 0x01e7, 0x01e7, 
-  0x01e7, 0x09e6, 0x09e6, 0x01e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x01c6, 
-  0x01a6, 0x4bad, 0x6430, 0x330b, 0x0164, 0x01e6, 0x09e7, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 
-  0x09e7, 0x01e7, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x0a07, 0x09c6, 0x08a2, 0xf77d, 0x738e, 0xce58, 0x9cd3, 0x00a2, 0x09e6, 0x0965, 0x00a1, 0x00e2, 
-  0x00e2, 0x00e2, 0x0000, 0xdefa, 0xc5f6, 0x00a1, 0x1a66, 0x2965, 0xffff, 0x8410, 0x0983, 0x12a8, 
-  0x01a6, 0x1247, 0x1ac7, 0x0184, 0x1ac7, 0x12c7, 0x01e6, 0x0a47, 0x2328, 0x0a27, 0x0a28, 0x09c6, 
-  0x0061, 0x6b2c, 0xffff, 0x8c51, 0x0020, 0x09a5, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x09c5, 0x0020, 0x7bae, 0xffff, 0xc638, 0xd6ba, 0xffff, 0x632c, 0x0000, 0x0020, 0x8c50, 0xffff, 
-  0x31c7, 0x0164, 0x1ae8, 0x0943, 0xb5b6, 0xffff, 0x8c71, 0x18e3, 0x2164, 0x2164, 0x1924, 0x31a6, 
-  0xd699, 0xffdf, 0x5aca, 0x0081, 0x09c6, 0x01a5, 0x01c6, 0x09e6, 0x01c5, 0x1944, 0xffff, 0x9cd3, 
-  0x0081, 0x10c2, 0xef7c, 0xb5b5, 0x0000, 0xbdf6, 0xffff, 0xf7be, 0xffff, 0xe71c, 0x10e3, 0x01a5, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01c6, 0x0a47, 0x1b08, 0x01c6, 0x09c6, 0x09e6, 0x01c6, 0x0a06, 0x1b08, 0x0206, 0x01e6, 0x01e7, 
-  0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x09e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x09c6, 0x09c6, 0x09c6, 0x01c6, 0x09e6, 0x09e7, 0x01e6, 
-  0x09e6, 0x09e7, 0x01e7, 0x01e7, 0x09e7, 0x01e7, 0x09e6, 0x09e6, 0x09c6, 0x09e6, 0x0185, 0x0124, 
-  0x6c91, 0xd75d, 0xe7de, 0xbe9a, 0x8d74, 0x32eb, 0x01a6, 0x0a07, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 
-  0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 
-  0x0a07, 0x0164, 0x1082, 0xffdf, 0x634c, 0xce58, 0xc5f7, 0x0040, 0x09c6, 0x10c3, 0x8c10, 0x9cb2, 
-  0x9cd2, 0x9cd3, 0x94b2, 0xf79d, 0xb595, 0x00c1, 0x1a65, 0x2965, 0xffff, 0x840f, 0x0983, 0x12a8, 
-  0x01a6, 0x1247, 0x1ac7, 0x0185, 0x0a05, 0x0164, 0x00e3, 0x0184, 0x1246, 0x0164, 0x0145, 0x09c6, 
-  0x09c5, 0x0000, 0x6b4c, 0xffff, 0xa4f3, 0x0882, 0x0165, 0x0a07, 0x09e6, 0x09c6, 0x09e6, 0x1246, 
-  0x31c6, 0xad55, 0xffff, 0xdeda, 0x18a2, 0x10a2, 0xd6ba, 0xffff, 0x9cd3, 0x0841, 0x8430, 0xffff, 
-  0x39e7, 0x0a25, 0x1ac8, 0x0985, 0x2124, 0xbdd6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xef7d, 0x632c, 0x0061, 0x09a5, 0x01c6, 0x09c6, 0x09e6, 0x09e7, 0x01c5, 0x1944, 0xffdf, 0x9cf3, 
-  0x0861, 0x18e3, 0xef5c, 0xad95, 0x0000, 0xce58, 0xe73c, 0x0841, 0xbdf7, 0xf77d, 0x08c2, 0x01a6, 
-  0x09c6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 
-  0x01e6, 0x09e6, 0x09e6, 0x01c6, 0x01c6, 0x01e6, 0x09e6, 0x09e7, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 
-  0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 
-  0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 
-  0x01e6, 0x09e6, 0x09c6, 0x01e7, 0x01e7, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01c6, 0x0a66, 0x1b08, 0x01c6, 0x09e6, 0x01e6, 0x01c6, 0x0a06, 0x2308, 0x0a06, 0x09e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x01e6, 0x01e7, 0x01e7, 0x09e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x09e6, 0x09c6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09c6, 0x01e6, 0x09c6, 0x09e6, 0x09e6, 0x01e7, 
-  0x09e7, 0x09e7, 0x01e7, 0x01e6, 0x01e7, 0x01e7, 0x09e6, 0x09e6, 0x09e7, 0x09c6, 0x0164, 0x7cb2, 
-  0xcf3c, 0xc6fb, 0xc6fb, 0xcf3c, 0xf7ff, 0x53ae, 0x0185, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01e7, 0x01e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 
-  0x0a07, 0x0061, 0x8430, 0xffdf, 0x2124, 0x632c, 0xf7be, 0x4249, 0x0081, 0x18e3, 0xe71b, 0xf7be, 
-  0xf79d, 0xf7de, 0xffff, 0xffff, 0x630c, 0x00e1, 0x1a86, 0x2965, 0xffff, 0x83ef, 0x0983, 0x12a8, 
-  0x01a6, 0x1247, 0x1ac8, 0x00e3, 0x2145, 0x4228, 0x4228, 0x4269, 0x4269, 0x4248, 0x2965, 0x00c3, 
-  0x09c6, 0x09a5, 0x0040, 0x6b6d, 0xffdf, 0x9cf3, 0x10c2, 0x09c6, 0x09c6, 0x01c6, 0x1ac8, 0x09e5, 
-  0x3a27, 0xffff, 0xc638, 0x31a6, 0x0923, 0x00e3, 0x3186, 0xd699, 0xe73c, 0x0861, 0x8c50, 0xffff, 
-  0x39e7, 0x09c5, 0x0964, 0x00e2, 0x0040, 0x0000, 0x4a69, 0x738e, 0x73ae, 0x73ae, 0x6b6d, 0x6b6d, 
-  0x0861, 0x0000, 0x0040, 0x0081, 0x0185, 0x09e6, 0x09e7, 0x0a07, 0x01c6, 0x1924, 0xffff, 0xffff, 
-  0xffde, 0xffdd, 0xffff, 0xbdf7, 0x0000, 0xce99, 0xef5c, 0x0000, 0xbdf7, 0xf77d, 0x0882, 0x01a6, 
-  0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e7, 0x09e6, 0x01e6, 0x09e6, 0x09e7, 0x09e6, 
-  0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09c6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 
-  0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 
-  0x01c6, 0x0a66, 0x1b08, 0x01c6, 0x09e6, 0x01e6, 0x01e6, 0x0a06, 0x2328, 0x0a06, 0x09e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x0207, 
-  0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x09e7, 0x01e6, 0x09e6, 0x01e6, 0x01c6, 0x0165, 0x7cb2, 0xcf3c, 
-  0xc6fb, 0xc6fb, 0xcf1b, 0xc71b, 0xdf9d, 0x4bae, 0x01a5, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x01e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 
-  0x09e6, 0x0000, 0xd699, 0xc638, 0x0000, 0x1082, 0xffff, 0x7bef, 0x0061, 0x0924, 0x0841, 0x0861, 
-  0x1082, 0x0020, 0xce79, 0xf7be, 0x31a6, 0x0983, 0x1a66, 0x2965, 0xffff, 0x83ef, 0x0183, 0x1288, 
-  0x01a6, 0x1247, 0x1b08, 0x0020, 0x8c30, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb596, 0x0020, 
-  0x09c6, 0x09e6, 0x11c6, 0x0000, 0xa534, 0xffff, 0x4248, 0x0123, 0x09e6, 0x1286, 0x1a87, 0x09a4, 
-  0x0000, 0x0841, 0x0000, 0x0000, 0x00c2, 0x00a1, 0x0000, 0x0020, 0x0040, 0x0000, 0x9492, 0xffff, 
-  0x39e7, 0x0081, 0x2124, 0x6b2c, 0x632c, 0x6b4d, 0x5aeb, 0x5aeb, 0x5b0b, 0x5aeb, 0x5aca, 0x528a, 
-  0x630b, 0x6b4c, 0x6b4c, 0x5aaa, 0x08e3, 0x0a07, 0x0a07, 0x0a07, 0x09e6, 0x08e3, 0x736d, 0x7bce, 
-  0x738d, 0x73ae, 0x7bcf, 0x5acb, 0x0000, 0xd679, 0xef5d, 0x0000, 0xbdf7, 0xef5c, 0x0061, 0x01a6, 
-  0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 
-  0x09e7, 0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x01e6, 0x01e7, 0x01e7, 
-  0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01c6, 0x0a66, 0x1b08, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x0a06, 0x2328, 0x0a06, 0x09e6, 0x09e6, 
-  0x09e6, 0x01e7, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09c6, 
-  0x01e6, 0x01e7, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x01e7, 0x09e7, 0x01e7, 0x01e6, 
-  0x09e6, 0x01e7, 0x01e7, 0x09e7, 0x09e6, 0x09e7, 0x01c6, 0x1227, 0x2269, 0x84f3, 0xd75c, 0xc6fb, 
-  0xc6db, 0xc6fb, 0xcf5c, 0x7471, 0x2248, 0x1227, 0x01c6, 0x01e7, 0x01e7, 0x09e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x01e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 
-  0x09a6, 0x0020, 0xdeda, 0xbe17, 0x2965, 0x39c7, 0xef7d, 0x9471, 0x0040, 0x1227, 0x0185, 0x11e6, 
-  0x0061, 0x5aca, 0xffde, 0xad75, 0x0040, 0x1287, 0x1245, 0x2965, 0xffff, 0x7bef, 0x0163, 0x1288, 
-  0x01a6, 0x1247, 0x1b08, 0x0103, 0x18e3, 0x31a6, 0x31a6, 0x39e7, 0x31e7, 0x31e7, 0x2165, 0x00e3, 
-  0x09e6, 0x09c5, 0x0000, 0x83ef, 0xffff, 0x738e, 0x08c2, 0x01a5, 0x1aa8, 0x1a87, 0x0a06, 0x00c2, 
-  0x8410, 0xc618, 0xbdf6, 0xc617, 0xb595, 0xb595, 0xc638, 0xc638, 0xd69a, 0xb595, 0xa4f3, 0xffff, 
-  0x39e7, 0x0000, 0x528a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xe71b, 0x08e3, 0x01e7, 0x0a07, 0x09e7, 0x01c6, 0x0164, 0x0000, 0x0000, 
-  0x0841, 0x0000, 0x0060, 0x0143, 0x0964, 0x31e7, 0x3207, 0x0841, 0x4207, 0x4a69, 0x0061, 0x01a5, 
-  0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x01e6, 0x09e6, 0x01e7, 0x01e7, 0x09e7, 
-  0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 
-  0x01c6, 0x0a66, 0x1b28, 0x01c6, 0x09e6, 0x09e6, 0x01c6, 0x0a06, 0x2308, 0x0a06, 0x09e6, 0x01e6, 
-  0x01e6, 0x01e7, 0x01e6, 0x09e6, 0x09e6, 0x01e7, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x01e6, 
-  0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x0207, 0x09e7, 0x01e6, 
-  0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x09e7, 0x01c6, 0x0185, 0x6c71, 0xdf5d, 0xd73c, 0xcf1c, 0xcefb, 
-  0xd75d, 0xd75c, 0x7491, 0x0185, 0x01c6, 0x01c6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x01e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x09e7, 0x0a07, 
-  0x0123, 0x3186, 0xf7bd, 0xffff, 0xffff, 0xffff, 0xffff, 0xce79, 0x08a2, 0x09c6, 0x1247, 0x00c2, 
-  0x3185, 0xef7c, 0xf79d, 0x1923, 0x0184, 0x12c8, 0x1a86, 0x2965, 0xffff, 0x83ef, 0x0163, 0x1288, 
-  0x01a6, 0x0a67, 0x1b08, 0x01c5, 0x0a45, 0x01a4, 0x0103, 0x0143, 0x0a05, 0x0143, 0x0185, 0x09e6, 
-  0x09e6, 0x0040, 0x83ef, 0xffff, 0x7bae, 0x0040, 0x09c5, 0x1aa7, 0x1287, 0x09e6, 0x0a27, 0x00a1, 
-  0x8c50, 0xdeba, 0xce79, 0xd699, 0xffff, 0xfffe, 0xbdf7, 0xb5b6, 0xbdd7, 0x7bce, 0x8c71, 0xffff, 
-  0x31a6, 0x00c2, 0x10e3, 0x2124, 0x1082, 0x18c3, 0x31c6, 0x2144, 0x73ae, 0xffdf, 0x5aeb, 0x18e3, 
-  0x2124, 0x2104, 0x2165, 0x2165, 0x0985, 0x0a47, 0x0a68, 0x0a27, 0x09e6, 0x0a06, 0x00e2, 0x5acb, 
-  0xffdf, 0x39c7, 0x0020, 0x0103, 0x00e2, 0x0081, 0x0060, 0x0000, 0xad34, 0xd6b9, 0x0061, 0x09c5, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a27, 0x0a26, 0x0a26, 0x0a27, 0x0a27, 0x0a27, 0x0a27, 
-  0x0a27, 0x0a27, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a47, 0x0a46, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a46, 0x0a26, 0x0a26, 0x0a26, 0x09e6, 0x09e6, 0x09e6, 
-  0x09c6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e7, 0x09e6, 0x09e6, 0x0a07, 0x09e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01c6, 0x0a67, 0x1b28, 0x01c6, 0x09e6, 0x09e6, 0x01c6, 0x0a06, 0x1b08, 0x0a07, 0x09e7, 0x01e7, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 
-  0x09e6, 0x09c6, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x01e6, 
-  0x09e6, 0x01e6, 0x01e6, 0x09e7, 0x09c6, 0x0165, 0x6c51, 0xd75d, 0xcf1c, 0xcf1c, 0xcf1c, 0xd73c, 
-  0xae18, 0x84f3, 0x0165, 0x01c6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 0x01e7, 0x09e7, 0x09e7, 
-  0x09e6, 0x09e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 0x0a07, 
-  0x0061, 0xa513, 0xffff, 0x52aa, 0x4a49, 0x4a48, 0x7bef, 0xffff, 0x4a69, 0x0103, 0x0081, 0x3186, 
-  0xe73b, 0xf7de, 0x4a49, 0x00a1, 0x0206, 0x1ae8, 0x1286, 0x29a6, 0xffff, 0x83ef, 0x0142, 0x1288, 
-  0x01a6, 0x1247, 0x1b08, 0x01c5, 0x1b28, 0x12e7, 0x01e6, 0x0a06, 0x1b08, 0x0a06, 0x09e7, 0x09c6, 
-  0x0040, 0x8410, 0xffff, 0x73ae, 0x0000, 0x0965, 0x1287, 0x1ae8, 0x01e6, 0x09e7, 0x09e6, 0x09e5, 
-  0x0081, 0x0040, 0x0020, 0x0000, 0xe71c, 0xce79, 0x0000, 0x0000, 0x0061, 0x0000, 0x8c50, 0xffff, 
-  0x31a6, 0x1205, 0x22c7, 0x0060, 0x632c, 0x6b6d, 0x0903, 0x00c2, 0x5aeb, 0xffff, 0x4208, 0x0040, 
-  0x0165, 0x0164, 0x0185, 0x01a5, 0x0a67, 0x1b29, 0x2349, 0x1ae8, 0x1aa7, 0x1ae8, 0x0143, 0x5aeb, 
-  0xffff, 0xc618, 0xb575, 0xb596, 0xb595, 0xb595, 0xb595, 0xad54, 0xef7c, 0xe6fa, 0x08a1, 0x1aa7, 
-  0x1b28, 0x1b08, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1287, 0x09e6, 0x09e6, 
-  0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 
-  0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01c6, 0x0a67, 0x1b28, 0x01e6, 0x09e7, 0x09e6, 0x01e6, 0x0a06, 0x1b08, 0x0a06, 0x09e6, 0x01e6, 
-  0x09e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x09c6, 
-  0x09c6, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x01e6, 0x09e7, 0x0164, 0x0103, 0x6c10, 0xd75c, 0xcf1c, 0xcf1c, 0xcf1c, 0xdf9d, 0x9d75, 
-  0x09c6, 0x01c6, 0x09e7, 0x01c6, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x01e7, 0x09e6, 0x09e7, 0x01e6, 
-  0x09e6, 0x01e6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x0061, 0xc618, 0xe71b, 0x0000, 0x00e2, 0x0081, 0x2985, 0xffdf, 0x632c, 0x0041, 0x94b1, 0xef7d, 
-  0xffff, 0x528a, 0x0000, 0x09a5, 0x1a87, 0x2328, 0x01e4, 0x31a6, 0xffff, 0x7bcf, 0x0142, 0x1267, 
-  0x01a6, 0x1247, 0x1b28, 0x01e5, 0x1307, 0x12a7, 0x01a5, 0x0a06, 0x1ae8, 0x01e6, 0x09c6, 0x08c3, 
-  0x8c50, 0xffff, 0x8c71, 0x0000, 0x0985, 0x01a6, 0x1287, 0x1b08, 0x01e6, 0x09e7, 0x01e6, 0x12c8, 
-  0x0a47, 0x09e6, 0x09c6, 0x08a2, 0xef3c, 0xd69a, 0x08a2, 0x1a46, 0x22a8, 0x0020, 0x8c30, 0xffff, 
-  0x31c6, 0x1245, 0x1267, 0x00a2, 0xe71b, 0xf77d, 0x0903, 0x0103, 0x528a, 0xdedb, 0x4208, 0x00e3, 
-  0x0a28, 0x0a27, 0x0a27, 0x0a67, 0x1ae8, 0x1267, 0x0a06, 0x09e6, 0x09e6, 0x0a06, 0x00c2, 0x630b, 
-  0xffff, 0xef9d, 0xef7d, 0xef7d, 0xef7d, 0xef3c, 0xef5c, 0xef3c, 0xffde, 0xdeda, 0x0881, 0x01c5, 
-  0x0206, 0x0206, 0x0206, 0x0a06, 0x0206, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x1287, 0x1267, 0x01c5, 
-  0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01c6, 0x0a67, 0x1b08, 0x01e6, 0x09e7, 0x09e6, 0x01c6, 0x0a06, 0x2308, 0x0a06, 0x09e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x01c6, 0x09c6, 0x09e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x0144, 0x4b6d, 0x7451, 0xcf1b, 0xcf1b, 0xcf1b, 0xd77d, 0xe7df, 0x8513, 0x09e7, 
-  0x0a07, 0x0a07, 0x09e7, 0x09c6, 0x09c6, 0x01c6, 0x09c6, 0x09e6, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x01c6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e6, 
-  0x08c2, 0xffde, 0xc618, 0x0020, 0x1206, 0x09e6, 0x1104, 0xffff, 0xad95, 0x0000, 0xef5c, 0xf79d, 
-  0x5aca, 0x0081, 0x0184, 0x0a05, 0x2b28, 0x1ac7, 0x0184, 0x2986, 0xffff, 0x7bcf, 0x0142, 0x1267, 
-  0x0186, 0x1247, 0x1b28, 0x01c5, 0x12e7, 0x0aa7, 0x01a5, 0x0a06, 0x1ae8, 0x01e6, 0x09a6, 0x0882, 
-  0xdeda, 0xa4f3, 0x0020, 0x09a5, 0x09e6, 0x01a6, 0x1267, 0x1ae8, 0x01e6, 0x0a07, 0x01e6, 0x12a8, 
-  0x0a27, 0x09e6, 0x09e6, 0x08c2, 0xe71c, 0xd679, 0x00c2, 0x1aa7, 0x1247, 0x0061, 0x8c30, 0xffff, 
-  0x31c6, 0x0184, 0x0a27, 0x00c2, 0xd679, 0xd6da, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0061, 
-  0x00c2, 0x00c2, 0x0103, 0x1aa7, 0x1267, 0x09c6, 0x09c6, 0x01a6, 0x0185, 0x09c6, 0x00c2, 0x632c, 
-  0xffff, 0x4a48, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad75, 0xef5d, 0x08a2, 0x01c5, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x01a6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x09e6, 0x01c5, 0x1267, 0x1246, 
-  0x01c5, 0x09e7, 0x09e6, 0x01c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x01e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01c6, 0x0a67, 0x1b28, 0x01c6, 0x09e7, 0x01e6, 0x01c6, 0x0a06, 0x2308, 0x0a06, 0x09e7, 0x09e6, 
-  0x01e6, 0x01e7, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x01e6, 0x09c6, 0x09c6, 0x09e6, 
-  0x01e7, 0x01e7, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x01e6, 0x01e7, 0x01e6, 0x09e7, 
-  0x0a07, 0x0165, 0x5bae, 0xcf1c, 0xd77d, 0xc6fb, 0xc6fb, 0xd77d, 0x9d75, 0x63ef, 0x11e7, 0x01c6, 
-  0x0a07, 0x09e7, 0x09e7, 0x09e6, 0x09c6, 0x09c6, 0x09c6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x01e6, 
-  0x09c7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 
-  0x08e3, 0x8c30, 0x6b2c, 0x0081, 0x1a67, 0x1267, 0x08e3, 0x83ef, 0x52aa, 0x0061, 0x1903, 0x1903, 
-  0x0103, 0x0a26, 0x1286, 0x22e8, 0x1266, 0x0a06, 0x0144, 0x2985, 0xffff, 0x8410, 0x0122, 0x1268, 
-  0x0186, 0x1247, 0x1b08, 0x01c5, 0x12e7, 0x0a87, 0x01a5, 0x0a06, 0x1ae8, 0x01e6, 0x09c6, 0x0944, 
-  0x1103, 0x08e2, 0x0964, 0x09e6, 0x09e6, 0x01c6, 0x1267, 0x1ac8, 0x01e6, 0x0a07, 0x01e6, 0x12a7, 
-  0x0a27, 0x09e6, 0x0a07, 0x08e3, 0xffbe, 0xdefb, 0x0061, 0x09e6, 0x0a27, 0x0061, 0x94b2, 0xffff, 
-  0x39e7, 0x0184, 0x0a27, 0x00c2, 0xdefb, 0xffff, 0xc637, 0xce37, 0xce58, 0xce58, 0xce79, 0xd69a, 
-  0xd699, 0xd69a, 0x9492, 0x00e3, 0x0a07, 0x09c6, 0x01a5, 0x1246, 0x1287, 0x1b09, 0x0184, 0x73ae, 
-  0xffff, 0xdeda, 0xce58, 0xce58, 0xc637, 0xc638, 0xc638, 0xc638, 0xffdf, 0xf77d, 0x1123, 0x12c8, 
-  0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 
-  0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x12c8, 0x12a8, 0x1aa8, 0x1aa8, 0x1ac8, 0x1ac8, 
-  0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x1aa8, 0x1aa8, 0x1aa8, 0x1aa8, 0x12a8, 0x12c8, 0x1ac8, 0x1ac8, 
-  0x1ac8, 0x1ac8, 0x1ac8, 0x1ac8, 0x12c7, 0x12c7, 0x12c7, 0x0a47, 0x01c5, 0x01e6, 0x01e6, 0x1267, 
-  0x1287, 0x01e5, 0x09e6, 0x01c6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 
-  0x09e7, 0x09e6, 0x09c6, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01c6, 0x0a67, 0x1b08, 0x01c6, 0x09e7, 0x01e7, 0x01c6, 0x0a06, 0x2328, 0x0a06, 0x09e6, 0x09e6, 
-  0x01e6, 0x01e7, 0x09e7, 0x09e6, 0x09e6, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09c6, 
-  0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x01e7, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x0a07, 
-  0x09c6, 0x6c0f, 0xd73c, 0xcf3c, 0xc6fb, 0xc6fb, 0xd77d, 0x9d75, 0x19a6, 0x0124, 0x01c6, 0x09e6, 
-  0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09c6, 0x01e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 
-  0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09a6, 0x00a2, 0x00a2, 0x1a67, 0x22c8, 0x0a06, 0x0985, 0x0081, 0x0922, 0x11c5, 0x01a4, 0x01a5, 
-  0x0a06, 0x1286, 0x2b89, 0x12c7, 0x01e6, 0x09e7, 0x0165, 0x18e3, 0xbdd7, 0x62eb, 0x0983, 0x1268, 
-  0x01a6, 0x1247, 0x1b08, 0x01c5, 0x12e7, 0x1287, 0x01a5, 0x0a06, 0x1b08, 0x01e6, 0x09c6, 0x01c5, 
-  0x12c7, 0x1286, 0x01a5, 0x09c6, 0x09e7, 0x01c6, 0x1267, 0x1ac8, 0x01c6, 0x09e7, 0x01c6, 0x12a7, 
-  0x0a27, 0x09e6, 0x0a07, 0x0903, 0x7bcf, 0x734d, 0x00a2, 0x09e6, 0x1227, 0x0102, 0x6b4c, 0xbdf7, 
-  0x2965, 0x01a5, 0x0a27, 0x00e3, 0x8c50, 0xc617, 0xc617, 0xc617, 0xc617, 0xc637, 0xce58, 0xce59, 
-  0xce59, 0xce79, 0x9471, 0x00a2, 0x0a07, 0x0185, 0x1226, 0x1246, 0x1267, 0x1308, 0x09c5, 0x4228, 
-  0xbdf7, 0xc5f7, 0xc617, 0xc617, 0xce37, 0xce38, 0xce59, 0xce59, 0xc618, 0x9cd3, 0x08e2, 0x1267, 
-  0x1246, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 
-  0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x0a67, 0x0a47, 0x1267, 0x1267, 0x1267, 
-  0x0a67, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x1267, 0x0a67, 0x1267, 0x1287, 
-  0x1267, 0x1267, 0x1267, 0x1267, 0x0a67, 0x0a67, 0x0a66, 0x12a7, 0x1ae8, 0x0a26, 0x01c5, 0x01e6, 
-  0x1287, 0x12a7, 0x01e5, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01c6, 0x0a67, 0x1b08, 0x01c6, 0x09e7, 0x09e6, 0x01c6, 0x0a06, 0x2328, 0x0a06, 0x09e6, 0x09e6, 
-  0x01e6, 0x09e6, 0x01e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09c6, 0x09e7, 0x09e6, 0x09e7, 0x09e6, 
-  0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x01e6, 0x01e7, 0x09e7, 0x09e6, 0x09c6, 0x01c6, 0x01a6, 0x0103, 
-  0x63ce, 0xdf5d, 0xcf3c, 0xcf1b, 0xd73c, 0xdf7d, 0x9d75, 0x19a6, 0x0185, 0x09e7, 0x01c6, 0x01c6, 
-  0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09e7, 0x09e7, 0x09c7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 
-  0x01e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x0a27, 0x1ac8, 0x1ac8, 0x0a07, 0x01c6, 0x1247, 0x2308, 0x1a47, 0x09c5, 0x09e6, 0x01c6, 
-  0x1266, 0x2348, 0x12a7, 0x0206, 0x09e7, 0x09c7, 0x09c6, 0x0124, 0x0040, 0x00a2, 0x1ac7, 0x0a47, 
-  0x01a6, 0x1247, 0x1b08, 0x01a5, 0x12e7, 0x0a87, 0x01a5, 0x0a06, 0x1b08, 0x01e6, 0x09c6, 0x01a5, 
-  0x1ac7, 0x1287, 0x01a5, 0x09e7, 0x0a07, 0x01c6, 0x1287, 0x1ac8, 0x01c6, 0x09c6, 0x01c6, 0x0a87, 
-  0x0a27, 0x09e7, 0x01e6, 0x1247, 0x00e2, 0x0081, 0x09a5, 0x09c6, 0x1287, 0x1ac7, 0x0103, 0x0081, 
-  0x0924, 0x09e7, 0x0a07, 0x09c6, 0x0081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0061, 0x00c2, 
-  0x0902, 0x00a1, 0x00c2, 0x09a5, 0x01a5, 0x1206, 0x1247, 0x09c6, 0x09e6, 0x0227, 0x0a47, 0x0143, 
-  0x0040, 0x0020, 0x0000, 0x0000, 0x0020, 0x0040, 0x0081, 0x0081, 0x0060, 0x0081, 0x0984, 0x01c5, 
-  0x01a5, 0x01c5, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 0x01e5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01e5, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01c5, 0x01e5, 0x1ae7, 0x2348, 0x0a26, 0x01e6, 
-  0x0206, 0x1ac7, 0x1aa7, 0x01c6, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09c6, 0x09e7, 0x09e7, 
-  0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01c6, 0x0a67, 0x1b08, 0x01e6, 0x09e7, 0x09e6, 0x01e6, 0x0a06, 0x2328, 0x0a06, 0x09e6, 0x09e6, 
-  0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x09c6, 0x09e6, 0x09e6, 0x01e6, 
-  0x01e6, 0x01e6, 0x09e7, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09c6, 0x09c6, 0x0124, 0x4b4d, 0xa5d7, 
-  0xbeba, 0xd73c, 0xcf1c, 0xd75d, 0xd71c, 0xae17, 0x19c6, 0x0185, 0x09e6, 0x09c6, 0x09c6, 0x09c6, 
-  0x09c6, 0x09c7, 0x09c7, 0x09c6, 0x09c7, 0x09e7, 0x09c7, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 0x01e6, 
-  0x01e7, 0x01e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09c7, 0x09e6, 0x09e6, 
-  0x09e6, 0x1287, 0x1ac8, 0x0a07, 0x09e6, 0x1247, 0x22e8, 0x1246, 0x09e6, 0x09e6, 0x09c5, 0x1246, 
-  0x2328, 0x1b07, 0x0a46, 0x09e6, 0x09e6, 0x09c7, 0x09e7, 0x09e6, 0x09e6, 0x01e6, 0x1b08, 0x0a47, 
-  0x01a6, 0x1247, 0x1ae8, 0x01a5, 0x12e7, 0x1287, 0x01a5, 0x0a26, 0x1b28, 0x01e6, 0x09c6, 0x01a5, 
-  0x12c7, 0x1287, 0x01a6, 0x0a07, 0x0a07, 0x09e7, 0x1287, 0x12c7, 0x01c6, 0x09e6, 0x09c6, 0x0a07, 
-  0x0a07, 0x09e6, 0x1267, 0x1a87, 0x1207, 0x09e6, 0x01a5, 0x1287, 0x1b28, 0x0a67, 0x0a27, 0x0a07, 
-  0x09e7, 0x09e6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09e7, 0x09c6, 0x09e7, 0x0a07, 0x0a87, 0x2328, 
-  0x1aa7, 0x0a27, 0x0a27, 0x09c5, 0x1a47, 0x1247, 0x09c6, 0x0a07, 0x0a07, 0x12a8, 0x1b28, 0x1b08, 
-  0x1ac8, 0x1aa7, 0x1aa7, 0x1aa7, 0x1ac8, 0x1b08, 0x2348, 0x2348, 0x2308, 0x1b08, 0x1b08, 0x1ae8, 
-  0x1b08, 0x1b09, 0x1ae8, 0x1b09, 0x2329, 0x1b08, 0x2308, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b09, 0x1b09, 0x1b08, 0x1b08, 0x1b09, 0x2329, 0x2309, 0x2308, 0x2308, 0x2308, 0x2308, 0x2308, 
-  0x2308, 0x2308, 0x2309, 0x2308, 0x2309, 0x2308, 0x1b08, 0x1b29, 0x1b09, 0x2309, 0x2309, 0x2309, 
-  0x2309, 0x2308, 0x2308, 0x2308, 0x2309, 0x1287, 0x01c5, 0x01c5, 0x01c5, 0x12a7, 0x2348, 0x1286, 
-  0x01e6, 0x0226, 0x12a7, 0x12a7, 0x01e5, 0x01c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 
-  0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01c6, 0x0a67, 0x1b08, 0x01e6, 0x09e7, 0x09e6, 0x01c6, 0x0a06, 0x2328, 0x0a07, 0x09e6, 0x09e6, 
-  0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09c6, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 
-  0x01e6, 0x01e6, 0x01e7, 0x01e6, 0x01e7, 0x09e6, 0x09e6, 0x09c6, 0x0103, 0x3aeb, 0xc6db, 0xd75c, 
-  0xcf1b, 0xc6fb, 0xdf9d, 0xae17, 0x2a69, 0x1a28, 0x09c6, 0x09e7, 0x09e6, 0x09e6, 0x09c6, 0x09c6, 
-  0x09c7, 0x09c6, 0x09c6, 0x09c7, 0x09c7, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 
-  0x01e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 
-  0x1267, 0x1a87, 0x0a07, 0x0a27, 0x1288, 0x2b49, 0x1aa7, 0x0a06, 0x0a27, 0x09e6, 0x0a46, 0x22c7, 
-  0x09a4, 0x0163, 0x01a5, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09c6, 0x01e6, 0x1b28, 0x0a47, 
-  0x01a6, 0x0a47, 0x1ae8, 0x01a5, 0x12c7, 0x1287, 0x01a5, 0x0a26, 0x1b28, 0x01e6, 0x09c6, 0x0185, 
-  0x12c7, 0x1286, 0x01a6, 0x09e7, 0x0a07, 0x09e7, 0x12a8, 0x1b08, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 
-  0x09e6, 0x1267, 0x1aa7, 0x0144, 0x0103, 0x0985, 0x09a5, 0x1ae8, 0x1288, 0x0a28, 0x0a07, 0x0a07, 
-  0x1207, 0x09e7, 0x09c6, 0x09c7, 0x09e7, 0x01a6, 0x0144, 0x01c6, 0x0a27, 0x0a88, 0x2329, 0x1267, 
-  0x0a27, 0x0985, 0x00e3, 0x0144, 0x0964, 0x0103, 0x0164, 0x0a06, 0x1ae9, 0x1ae8, 0x0a06, 0x09c5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x09c5, 0x0a06, 0x0a26, 0x0a26, 0x0a06, 0x0a06, 0x09e6, 0x09e5, 
-  0x0184, 0x0164, 0x09e5, 0x0184, 0x0163, 0x09e5, 0x09e6, 0x09e5, 0x09e5, 0x01e5, 0x01e6, 0x01e5, 
-  0x01e5, 0x01e5, 0x01e6, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 
-  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e5, 0x01e5, 0x0206, 0x0206, 0x0206, 
-  0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x01e6, 0x09e5, 0x0a06, 0x0a06, 0x01c5, 0x01c5, 0x12a7, 0x2b69, 
-  0x1286, 0x0206, 0x0206, 0x1ac7, 0x1287, 0x09e6, 0x01c6, 0x09c6, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 
-  0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01c6, 0x0a67, 0x1b08, 0x01e6, 0x09e7, 0x09e6, 0x01c6, 0x0a06, 0x2328, 0x0a06, 0x01e6, 0x01e6, 
-  0x09e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x09c6, 0x09c6, 0x09e6, 0x09e6, 0x01e6, 
-  0x01e7, 0x01e7, 0x01e6, 0x09e6, 0x09e6, 0x0a07, 0x0a07, 0x0185, 0x4b4c, 0xc6da, 0xc6fb, 0xc6db, 
-  0xcf1c, 0xdf9e, 0xbe79, 0x3289, 0x0185, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x09e6, 0x09e6, 
-  0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09e7, 0x09e6, 0x09e6, 
-  0x01e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09c6, 0x0103, 0x00a2, 0x00a2, 0x00c2, 0x00c2, 0x09a5, 
-  0x1aa8, 0x0a27, 0x0985, 0x00a2, 0x0143, 0x0123, 0x00a2, 0x0081, 0x0081, 0x0123, 0x2328, 0x1205, 
-  0x18c3, 0x39c7, 0x1103, 0x09a6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e6, 0x1b28, 0x0a47, 
-  0x01a6, 0x0a26, 0x1ac8, 0x0185, 0x12e7, 0x0a66, 0x01a5, 0x0a26, 0x1b28, 0x0206, 0x09c6, 0x01a5, 
-  0x12c7, 0x1287, 0x01c6, 0x0a07, 0x09e7, 0x09e7, 0x1226, 0x0123, 0x0041, 0x0041, 0x00a2, 0x09c6, 
-  0x1aa7, 0x1aa7, 0x0903, 0x4228, 0x39e7, 0x00e3, 0x09e6, 0x1226, 0x0081, 0x0081, 0x00a2, 0x00a2, 
-  0x0081, 0x0041, 0x0103, 0x09e7, 0x09a6, 0x1924, 0x4228, 0x2165, 0x0a06, 0x2329, 0x1288, 0x0a06, 
-  0x00c2, 0x0861, 0x2965, 0x2965, 0x2965, 0x31a6, 0x31a6, 0x08c2, 0x1184, 0x1206, 0x09c6, 0x09a5, 
-  0x0a06, 0x0a26, 0x0a26, 0x0a67, 0x0984, 0x0061, 0x0081, 0x0081, 0x0061, 0x0041, 0x0041, 0x00a2, 
-  0x2986, 0x39c7, 0x0061, 0x2985, 0x39e7, 0x0903, 0x0a26, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a47, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a26, 0x0a46, 0x0a46, 
-  0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a46, 0x0a47, 0x0a47, 0x0a46, 0x0a46, 0x0a47, 
-  0x0a47, 0x0a47, 0x0a46, 0x0a47, 0x0a26, 0x0a26, 0x1ae8, 0x2328, 0x0a46, 0x01e6, 0x0206, 0x1b08, 
-  0x2b68, 0x0a66, 0x0206, 0x01e6, 0x12a7, 0x1a87, 0x01c5, 0x01a5, 0x01a6, 0x01a6, 0x01a6, 0x01a5, 
-  0x01a5, 0x01c6, 0x01c6, 0x01a6, 0x01c6, 0x01a5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x0a47, 0x1b08, 0x01e6, 0x09e6, 0x09e7, 0x01c6, 0x0a06, 0x2328, 0x0a07, 0x01e7, 0x01e7, 
-  0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 
-  0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x09e7, 0x01c6, 0x0165, 0x432b, 0xcf1b, 0xcf3c, 0xc6db, 0xcf5c, 
-  0xae38, 0x8d34, 0x3289, 0x0144, 0x09e6, 0x09e6, 0x09e7, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09c6, 0x09c7, 0x09e7, 0x09c6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x0a07, 0x0124, 0x4208, 0x630c, 0x62eb, 0x630b, 0x630c, 0x18e3, 
-  0x0164, 0x09c6, 0x2165, 0x9491, 0x8c71, 0x8c51, 0x9491, 0x8c71, 0x8c71, 0x52aa, 0x09a4, 0x00e2, 
-  0x630c, 0xffff, 0x5acb, 0x00e3, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e7, 0x1b28, 0x0a47, 
-  0x01a6, 0x0a27, 0x1ac8, 0x01a5, 0x0964, 0x10e3, 0x00c3, 0x0a06, 0x1b08, 0x09e6, 0x09c6, 0x01a5, 
-  0x12e7, 0x1287, 0x01c6, 0x01e7, 0x09e7, 0x0985, 0x0061, 0x840f, 0xad34, 0xad34, 0x632c, 0x0061, 
-  0x1a67, 0x09a5, 0x0041, 0xe73b, 0xe73c, 0x08a2, 0x01c5, 0x29a6, 0x9492, 0x94b2, 0x9cd2, 0x9cb2, 
-  0x9471, 0x8c51, 0x2945, 0x0985, 0x0103, 0x6b4d, 0xffff, 0x6b4d, 0x01e4, 0x1309, 0x0227, 0x00c2, 
-  0x4a28, 0xce58, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x4207, 0x0040, 0x11c5, 0x1247, 
-  0x1aa7, 0x1ac7, 0x1ae8, 0x1b08, 0x1964, 0xbd96, 0xd6ba, 0xdeda, 0xdeda, 0xce59, 0x9491, 0x0000, 
-  0xc638, 0xf7be, 0x0000, 0xb596, 0xffff, 0x1924, 0x1287, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ac8, 0x0a06, 0x01c5, 0x0a46, 0x2308, 0x0a05, 0x01e5, 0x0205, 
-  0x1ac6, 0x2b89, 0x0a66, 0x01e6, 0x01c6, 0x1246, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x1287, 0x1a87, 
-  0x01c6, 0x0a47, 0x1b08, 0x01c6, 0x09e7, 0x09e7, 0x01c6, 0x0a06, 0x1b28, 0x0a06, 0x09e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 0x09c6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x01e6, 0x0a07, 0x0185, 0x434c, 0x6c91, 0xc6db, 0xd75d, 0xcf1b, 0xcf5c, 0xb679, 
-  0x3aca, 0x0124, 0x0985, 0x09a6, 0x09c6, 0x09e6, 0x09e6, 0x01e6, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 
-  0x01c6, 0x01e6, 0x01c6, 0x01c5, 0x0206, 0x0081, 0xbdd6, 0xffff, 0xffde, 0xffde, 0xffff, 0xce79, 
-  0x18e3, 0x00e2, 0x31c6, 0xffde, 0xffde, 0xffde, 0xffde, 0xffde, 0xffff, 0x9cd3, 0x0081, 0x00c2, 
-  0x630c, 0xffff, 0x52aa, 0x00c2, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e6, 0x1b28, 0x0a47, 
-  0x01a6, 0x1227, 0x1ac8, 0x0123, 0x31a6, 0xef7d, 0x52aa, 0x0081, 0x12c7, 0x01e6, 0x09c6, 0x01a5, 
-  0x1ae7, 0x1287, 0x01c6, 0x0a07, 0x09c6, 0x08a2, 0xa513, 0xffff, 0xe71b, 0xef5c, 0xffff, 0x528a, 
-  0x0020, 0x0964, 0x0041, 0xdeda, 0xdefb, 0x08c2, 0x01c5, 0x39e7, 0xffde, 0xf7be, 0xffbe, 0xf7bd, 
-  0xffdd, 0xffff, 0x4a69, 0x00a2, 0x0081, 0x632c, 0xffff, 0x6b4d, 0x0204, 0x1b49, 0x0103, 0x632c, 
-  0xffff, 0xdefb, 0x630c, 0x632c, 0x6b4d, 0x6b6d, 0x73ae, 0xef5c, 0xffde, 0x4a28, 0x0923, 0x1a87, 
-  0x09a5, 0x09c6, 0x01e6, 0x01e6, 0x1124, 0xf7be, 0xe75c, 0x9cf3, 0xa513, 0xffff, 0xce79, 0x0000, 
-  0xc617, 0xef7d, 0x0000, 0xa534, 0xffff, 0x1903, 0x0144, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01a5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01c6, 0x01c5, 0x0a46, 0x1b07, 0x0a26, 0x01e6, 
-  0x0205, 0x1ae7, 0x2328, 0x01e5, 0x01e6, 0x01c6, 0x1267, 0x1ac8, 0x1ac7, 0x1ac8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x22e8, 0x1ac8, 0x1ac8, 0x22c8, 
-  0x01c6, 0x0a67, 0x1b08, 0x01c6, 0x09e6, 0x09e7, 0x01c6, 0x0a06, 0x1b08, 0x0a07, 0x09e6, 0x09e6, 
-  0x01e6, 0x09e6, 0x09e6, 0x01e7, 0x09e7, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x09e7, 
-  0x09e6, 0x09c6, 0x09e7, 0x0185, 0x53ae, 0xd71c, 0xe7be, 0xd73c, 0xd73c, 0xdf7d, 0xbeba, 0x2a69, 
-  0x0164, 0x0a07, 0x09e7, 0x09e7, 0x09c6, 0x09e7, 0x01c6, 0x0a46, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae7, 0x12e8, 0x1ae8, 0x1b08, 0x1b08, 
-  0x1ae7, 0x12e7, 0x12e7, 0x12e7, 0x1b08, 0x0102, 0xbdb6, 0xef5c, 0x2104, 0x18e3, 0x39e7, 0xef7d, 
-  0xb595, 0x0081, 0x0923, 0x10c2, 0x10c3, 0x10c3, 0x0882, 0x2124, 0xffdf, 0x9cb2, 0x00a1, 0x00c2, 
-  0x632c, 0xffff, 0x528a, 0x00c2, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x01e6, 0x1b28, 0x0a47, 
-  0x01a6, 0x0a47, 0x1ae8, 0x0164, 0x18e3, 0xbdf7, 0xffff, 0x4a28, 0x0081, 0x09e6, 0x01c6, 0x01a5, 
-  0x1ae8, 0x12a7, 0x01c6, 0x0a07, 0x00a1, 0x738d, 0xffff, 0x94b2, 0x0000, 0x1903, 0xe6fb, 0xef7d, 
-  0x39e7, 0x00c2, 0x08a2, 0xdefb, 0xe6fb, 0x08c2, 0x0a67, 0x11e5, 0x08c2, 0x08a2, 0x08a2, 0x0841, 
-  0x632c, 0xffdf, 0x4a48, 0x0882, 0x1082, 0x73ae, 0xffff, 0x6b4d, 0x01e4, 0x1b49, 0x0081, 0xbdd6, 
-  0xffde, 0x1082, 0x0000, 0x00a1, 0x0963, 0x0102, 0x0000, 0x2104, 0xffff, 0xad54, 0x0020, 0x0a06, 
-  0x0a07, 0x0a06, 0x12c8, 0x1ae8, 0x1144, 0xf79d, 0xa514, 0x0000, 0x0000, 0xdeda, 0xc638, 0x0000, 
-  0xc617, 0xf7be, 0x630b, 0xce79, 0xffdf, 0x2144, 0x1266, 0x1b08, 0x1ae8, 0x1b08, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 
-  0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x0a66, 0x01e5, 0x01e5, 0x1287, 0x12c7, 0x0226, 
-  0x01e6, 0x0206, 0x1ac7, 0x1ae8, 0x0a26, 0x01e6, 0x01c6, 0x01c6, 0x01a5, 0x01a6, 0x0185, 0x01a5, 
-  0x01c6, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 
-  0x01c6, 0x0a67, 0x1b08, 0x01c6, 0x09e7, 0x09e6, 0x01c6, 0x0a06, 0x2328, 0x0a07, 0x09e7, 0x01e6, 
-  0x09e6, 0x09e6, 0x09e7, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x09e6, 
-  0x09e6, 0x09e6, 0x0144, 0x42eb, 0xbeda, 0xd75d, 0xcefb, 0xd73c, 0xdf9d, 0xc6ba, 0x3b0b, 0x0185, 
-  0x09e6, 0x01c6, 0x09c6, 0x09c6, 0x01c6, 0x01c6, 0x0a26, 0x1ac7, 0x1287, 0x12a7, 0x12a7, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x12a7, 0x1287, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 
-  0x12a7, 0x12a7, 0x1287, 0x1287, 0x12c7, 0x00e2, 0xbdd6, 0xef5d, 0x08c2, 0x09e5, 0x0000, 0xbdd6, 
-  0xef3c, 0x00a2, 0x0184, 0x0103, 0x0103, 0x0103, 0x00a1, 0x08a2, 0xffff, 0xa4f3, 0x00c2, 0x00e2, 
-  0x632c, 0xffff, 0x528a, 0x00c2, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a27, 0x2349, 0x0a67, 
-  0x01c6, 0x1247, 0x1ae8, 0x01a5, 0x0963, 0x0061, 0xad75, 0xf7be, 0x4208, 0x0020, 0x09c6, 0x01a5, 
-  0x12e7, 0x12a7, 0x01c6, 0x09e7, 0x0020, 0xa513, 0xf7be, 0x18e3, 0x0103, 0x00a2, 0x5acb, 0xffff, 
-  0x6b4c, 0x00a1, 0x08e3, 0xe6fb, 0xe71b, 0x08c2, 0x0a47, 0x23a9, 0x01e5, 0x0165, 0x0985, 0x0000, 
-  0x630b, 0xffff, 0x5289, 0xd679, 0xffff, 0xffde, 0xffff, 0x6b4d, 0x01c3, 0x1b08, 0x0061, 0x9cd2, 
-  0xffff, 0x7bef, 0x18e3, 0x2164, 0x2185, 0x1923, 0x18e3, 0x9491, 0xffff, 0x8c71, 0x0061, 0x0a07, 
-  0x0a07, 0x1ac8, 0x1b08, 0x1287, 0x1123, 0xf79d, 0xad34, 0x0061, 0x08e3, 0xdefb, 0xce58, 0x0000, 
-  0xbdd6, 0xffff, 0xffff, 0xffff, 0xf79e, 0x2165, 0x0a46, 0x12a7, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 
-  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1ae8, 0x2b89, 0x1287, 0x01e5, 0x01e6, 0x0a46, 0x1ac7, 
-  0x0a06, 0x01c6, 0x01e5, 0x1287, 0x1b08, 0x0a46, 0x01e6, 0x09e6, 0x09e6, 0x01a4, 0x3b2b, 0x22a9, 
-  0x01a5, 0x01e5, 0x01e6, 0x01c6, 0x01e6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 
-  0x01c6, 0x0a67, 0x1b28, 0x01e6, 0x09e7, 0x09e6, 0x01c6, 0x0a06, 0x2328, 0x0a07, 0x09e6, 0x09e6, 
-  0x09e6, 0x01e6, 0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x01e6, 0x01c6, 
-  0x01a6, 0x0164, 0x3289, 0xbeda, 0xcf3c, 0xcf1b, 0xd73c, 0xdf7d, 0xbeba, 0x2aca, 0x01c6, 0x0a07, 
-  0x09c6, 0x09c6, 0x09c6, 0x01c6, 0x01c6, 0x0a06, 0x1ac8, 0x0a06, 0x01a6, 0x01c6, 0x01a6, 0x01a6, 
-  0x01a6, 0x01a6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01e6, 0x0081, 0xbdf7, 0xef7d, 0x0000, 0x0020, 0x0000, 0xce79, 
-  0xd699, 0x0040, 0x10e3, 0x2985, 0x2986, 0x2986, 0x2965, 0x4208, 0xffff, 0xa4f3, 0x00e2, 0x0123, 
-  0x6b2c, 0xffff, 0x52aa, 0x00c2, 0x0a07, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x01a5, 0x1286, 0x01e5, 
-  0x0164, 0x09c5, 0x1245, 0x0143, 0x1aa7, 0x0984, 0x0020, 0xad55, 0xf7be, 0x4a28, 0x0020, 0x01c5, 
-  0x12e7, 0x1287, 0x01c6, 0x09e6, 0x0040, 0xce58, 0xef7d, 0x0861, 0x0964, 0x0143, 0x2145, 0xffff, 
-  0x73ae, 0x0020, 0x08a2, 0xe71b, 0xe71b, 0x08a2, 0x0a26, 0x1a66, 0x0081, 0x0041, 0x0061, 0x0000, 
-  0x632c, 0xffff, 0x528a, 0x632c, 0x83ef, 0xb595, 0xffff, 0x6b6d, 0x01c3, 0x12e7, 0x0184, 0x2144, 
-  0xb595, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffbe, 0xfffe, 0xffff, 0xad75, 0x10c3, 0x09a5, 0x0a27, 
-  0x1ae8, 0x2329, 0x0a47, 0x01e6, 0x08e3, 0xef5c, 0xa513, 0x0000, 0x0020, 0xdeda, 0xc638, 0x0000, 
-  0xbdf7, 0xf77d, 0x2124, 0xb595, 0xffff, 0x2144, 0x01a5, 0x01e6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01e6, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01e5, 0x01c5, 0x01c5, 0x01e5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01c5, 
-  0x01c5, 0x01c6, 0x01e5, 0x01e5, 0x01c5, 0x0206, 0x12c7, 0x2369, 0x1286, 0x01e5, 0x01e6, 0x0a46, 
-  0x1ac7, 0x01e5, 0x01a5, 0x01e6, 0x0a46, 0x1ae8, 0x2348, 0x1b28, 0x2349, 0x12a6, 0xa5f6, 0x7cf1, 
-  0x12a6, 0x2329, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x2308, 0x2308, 0x2328, 0x2328, 0x2308, 0x2308, 
-  0x01c6, 0x0a67, 0x1b28, 0x01e6, 0x09e7, 0x01e6, 0x01c6, 0x0a06, 0x1b08, 0x0a06, 0x09e7, 0x09e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e6, 0x09e7, 0x0185, 
-  0x2248, 0x9db6, 0xb699, 0xc71b, 0xc6fb, 0xd75c, 0xcf1b, 0x434c, 0x1a89, 0x0207, 0x0a07, 0x09e7, 
-  0x09e6, 0x09e6, 0x09e6, 0x01c6, 0x0a26, 0x1ac8, 0x0a06, 0x01a5, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 
-  0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e6, 0x01e6, 0x01e6, 0x09e7, 0x0081, 0xbdd6, 0xffde, 0x9492, 0x8c71, 0xad75, 0xef7d, 
-  0x39c7, 0x0000, 0x4228, 0xffff, 0xffff, 0xffff, 0xffff, 0xffde, 0xffff, 0x62eb, 0x00e2, 0x0123, 
-  0x6b4c, 0xffff, 0x52aa, 0x00c2, 0x0a07, 0x09e6, 0x09e7, 0x0a07, 0x0944, 0x2965, 0x31c6, 0x31a6, 
-  0x29a6, 0x2985, 0x2985, 0x10c2, 0x1245, 0x1226, 0x00c2, 0x0841, 0xb5b6, 0xf79e, 0x4a48, 0x00c2, 
-  0x1ae8, 0x1287, 0x01c6, 0x09e6, 0x0020, 0xce58, 0xef7d, 0x08a2, 0x0984, 0x0143, 0x31c6, 0xffff, 
-  0xf7be, 0xef5c, 0xef5c, 0xffff, 0xdeda, 0x08c2, 0x01a5, 0x2164, 0xbdd6, 0xc637, 0xd678, 0xd699, 
-  0xef5c, 0xffff, 0x5acb, 0x0040, 0x0000, 0x630c, 0xffff, 0x6b4d, 0x01c3, 0x1266, 0x0103, 0x00e2, 
-  0x0000, 0x4248, 0x8430, 0x8410, 0x8410, 0x7bef, 0x840f, 0x4a69, 0x0000, 0x0081, 0x0164, 0x1ac8, 
-  0x1b29, 0x0a27, 0x0a07, 0x0a06, 0x10e3, 0xef7c, 0xffde, 0xd6ba, 0xd699, 0xffff, 0xce79, 0x0000, 
-  0xbdf7, 0xef5c, 0x0000, 0x9cf3, 0xffff, 0x2164, 0x12c7, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 
-  0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b28, 0x1b08, 0x1b08, 0x1b28, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b28, 0x1b28, 0x1b08, 0x0a46, 0x0206, 0x0226, 0x1ac7, 0x2328, 0x0a26, 0x01c5, 0x01e5, 
-  0x0a26, 0x1ac7, 0x09e6, 0x01c5, 0x01c5, 0x0226, 0x0a46, 0x0a66, 0x01e4, 0x3b6b, 0xceba, 0xb638, 
-  0x1a67, 0x01e5, 0x0a26, 0x0a25, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 
-  0x01c6, 0x0a67, 0x1b28, 0x01e6, 0x09e7, 0x01e7, 0x09e6, 0x0a06, 0x1b08, 0x0a06, 0x01e7, 0x01e6, 
-  0x01e7, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e7, 0x09e6, 0x09e6, 0x01e6, 0x0a07, 0x0185, 0x2aa9, 
-  0xb699, 0xcf3c, 0xc71b, 0xc6da, 0xcf1c, 0xc6da, 0x4b0b, 0x0165, 0x01e6, 0x0a07, 0x09e7, 0x09e7, 
-  0x09e6, 0x09e6, 0x01c6, 0x0a26, 0x1aa7, 0x0206, 0x01c6, 0x09c6, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 
-  0x09e6, 0x09e7, 0x01e7, 0x01e7, 0x09e7, 0x0081, 0xb5b6, 0xffff, 0xe73c, 0xdefb, 0xef5d, 0xdeda, 
-  0x2104, 0x0020, 0x1903, 0x736d, 0x738d, 0x738e, 0x738d, 0xef5c, 0xf7be, 0x39c7, 0x0123, 0x0103, 
-  0x632c, 0xffff, 0x52aa, 0x00c2, 0x09e7, 0x09c6, 0x09e7, 0x09e6, 0x08c2, 0xe71b, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0x73ae, 0x01a3, 0x1266, 0x09c5, 0x00e2, 0x0000, 0xdefb, 0xf7be, 0x08c2, 
-  0x12a7, 0x1287, 0x01c6, 0x09c6, 0x0040, 0xce58, 0xef7c, 0x0882, 0x0985, 0x0164, 0x31c6, 0xffff, 
-  0xd6ba, 0xad75, 0xad75, 0xf7be, 0xdefb, 0x08c2, 0x0144, 0x2985, 0xffff, 0xe71b, 0xb5b6, 0xc5f7, 
-  0xc638, 0xc618, 0x39c6, 0x1903, 0x10c2, 0x73ae, 0xffff, 0x6b4d, 0x00e1, 0x1944, 0x39c6, 0x3a07, 
-  0x4208, 0x31a6, 0x2965, 0x2945, 0x2945, 0x2944, 0x2945, 0x3185, 0x3a07, 0x4228, 0x3a07, 0x1184, 
-  0x0a26, 0x0a07, 0x0a07, 0x0a06, 0x08c2, 0xa4d3, 0xc638, 0xc638, 0xc638, 0xc5f7, 0x8c71, 0x0000, 
-  0xc638, 0xffff, 0x0000, 0xad54, 0xffff, 0x1924, 0x01a4, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 
-  0x0a26, 0x0a26, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0226, 
-  0x0226, 0x0a26, 0x0a26, 0x0a26, 0x0a06, 0x0a06, 0x0a06, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a06, 
-  0x0a26, 0x0a26, 0x0a06, 0x0a46, 0x1ac8, 0x0a46, 0x01e5, 0x0205, 0x1287, 0x2328, 0x0a26, 0x01c5, 
-  0x01c5, 0x1266, 0x1ac8, 0x0a06, 0x0a06, 0x0a26, 0x0a26, 0x01c4, 0x22a8, 0xb638, 0xc699, 0xceba, 
-  0x9554, 0x09e5, 0x01e5, 0x0a46, 0x0a26, 0x0a26, 0x0a26, 0x0a47, 0x0a47, 0x0a26, 0x0a26, 0x0a27, 
-  0x01c6, 0x0a67, 0x1b28, 0x01e6, 0x01e7, 0x01e7, 0x09c6, 0x0a06, 0x2328, 0x0a06, 0x09e6, 0x09e6, 
-  0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x09e7, 0x0a27, 0x01a5, 0x3b0b, 0xbeda, 
-  0xcf5c, 0xc6fb, 0xc71b, 0xd77d, 0xbe9a, 0x3a89, 0x0144, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 
-  0x09e6, 0x01e6, 0x0a26, 0x12a7, 0x0a06, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x09c6, 0x09c6, 0x01c6, 
-  0x01e6, 0x01e6, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x01e6, 0x01e6, 
-  0x09e7, 0x09e7, 0x09e6, 0x09c6, 0x09e7, 0x0061, 0xbdd6, 0xf79e, 0x0881, 0x0081, 0x0861, 0xbe17, 
-  0xdefb, 0x10a2, 0x0123, 0x00c2, 0x00e2, 0x0000, 0x39c7, 0xffff, 0x9cd2, 0x0000, 0x11e6, 0x00e2, 
-  0x632c, 0xffff, 0x52aa, 0x00e2, 0x09e7, 0x09c6, 0x09e6, 0x09c6, 0x0061, 0x4207, 0x5b0b, 0x630c, 
-  0x5b0b, 0x5aeb, 0x630c, 0x2965, 0x1225, 0x1287, 0x0964, 0x0040, 0x9cf3, 0xf7be, 0x4208, 0x00c2, 
-  0x1ae8, 0x1287, 0x01a6, 0x09c6, 0x0020, 0xce38, 0xf77d, 0x08a2, 0x0185, 0x0164, 0x31c6, 0xffff, 
-  0x738e, 0x0000, 0x0020, 0xdefb, 0xe71c, 0x08a2, 0x0123, 0x2124, 0xffff, 0x8c50, 0x0000, 0x0020, 
-  0x0081, 0x0081, 0x08a2, 0xe71c, 0xffff, 0xffdf, 0xffff, 0x6b6d, 0x0000, 0x4228, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2144, 
-  0x0185, 0x0a07, 0x1247, 0x1a87, 0x0984, 0x0061, 0x0000, 0x0000, 0x0000, 0x0061, 0x00c2, 0x08e3, 
-  0x4228, 0x5aeb, 0x0841, 0x3a07, 0x52aa, 0x08a2, 0x0185, 0x01c6, 0x09c6, 0x01c6, 0x09c6, 0x09c6, 
-  0x01c6, 0x09c6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x09c6, 0x09c6, 0x09e6, 0x09c6, 0x09c6, 0x01c6, 
-  0x09e6, 0x09c6, 0x09c6, 0x09c7, 0x09c6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x01c6, 0x01c6, 0x09e6, 0x01c6, 0x0a46, 0x1b08, 0x0a46, 0x01e5, 0x01e5, 0x1aa7, 0x2308, 0x01e5, 
-  0x01c6, 0x01e6, 0x0a46, 0x1ac7, 0x1ac8, 0x12a6, 0x12a6, 0x540d, 0xbe98, 0xcefa, 0xc6ba, 0xc6b9, 
-  0xcefb, 0xa616, 0x338a, 0x0a86, 0x12c7, 0x1ae8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 0x1ae8, 
-  0x01c6, 0x0a66, 0x1b08, 0x01e6, 0x01e7, 0x01e6, 0x01c6, 0x0a06, 0x2328, 0x0a07, 0x09e6, 0x09e6, 
-  0x01e6, 0x09e6, 0x01e6, 0x09e6, 0x01e6, 0x01c6, 0x09e6, 0x01e6, 0x0164, 0x3aea, 0xcefb, 0xdf9d, 
-  0xcf1c, 0xd75d, 0xbe79, 0x7c91, 0x3aaa, 0x0124, 0x09c6, 0x09e6, 0x09e6, 0x09c6, 0x09e6, 0x09e6, 
-  0x09e6, 0x01e6, 0x1b08, 0x0a26, 0x01c5, 0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 
-  0x09c6, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 
-  0x09e7, 0x01e7, 0x01e6, 0x09e6, 0x09e7, 0x0061, 0xbdd6, 0xef7d, 0x08c2, 0x09e6, 0x00a1, 0x8430, 
-  0xffff, 0x2144, 0x0165, 0x1248, 0x00c2, 0x2124, 0xe71b, 0xf79d, 0x3185, 0x00c2, 0x09e6, 0x00c2, 
-  0x632c, 0xffff, 0x5aca, 0x0103, 0x0a07, 0x09c6, 0x09a6, 0x11e7, 0x3aca, 0x29e7, 0x0964, 0x0081, 
-  0x00c2, 0x0143, 0x01a4, 0x0103, 0x1ac7, 0x1245, 0x0040, 0xa534, 0xffdf, 0x4a49, 0x0040, 0x09a5, 
-  0x1ae8, 0x1287, 0x01a6, 0x09c6, 0x0040, 0xd679, 0xf79d, 0x0061, 0x09a5, 0x0144, 0x2945, 0xffff, 
-  0x7bef, 0x00c2, 0x10e3, 0xe6fb, 0xe71b, 0x0882, 0x0103, 0x2144, 0xffff, 0x9cb2, 0x0040, 0x11c6, 
-  0x0a07, 0x0a07, 0x1124, 0x8c30, 0x9492, 0xbdf7, 0xffff, 0x630c, 0x00a1, 0x1924, 0x528a, 0x4a49, 
-  0x4a49, 0x52aa, 0x528a, 0x6b4c, 0xffdf, 0xad54, 0x5289, 0x5aeb, 0x5aeb, 0x5aeb, 0x5289, 0x08c2, 
-  0x0185, 0x09e6, 0x1a87, 0x09e6, 0x09e7, 0x0144, 0x4a89, 0xdefb, 0x39e7, 0x0020, 0x0103, 0x00e3, 
-  0x0020, 0x0000, 0x0000, 0x8430, 0xce79, 0x10c2, 0x0185, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09e6, 0x09c6, 
-  0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x01c5, 0x0a66, 0x2328, 0x0a26, 0x01c6, 0x01e6, 0x1287, 0x12a7, 
-  0x01c5, 0x01a5, 0x01a6, 0x01c5, 0x0184, 0x3b2b, 0xa5b5, 0xc69a, 0xbe79, 0xbe59, 0xbe79, 0xbe79, 
-  0xbe58, 0xc699, 0xc679, 0x8d13, 0x2268, 0x0184, 0x01c5, 0x01c5, 0x01a5, 0x01c5, 0x01a5, 0x01a5, 
-  0x01c6, 0x0a67, 0x1b28, 0x01e6, 0x09e6, 0x09e7, 0x09e6, 0x0a06, 0x2308, 0x09e6, 0x09c6, 0x09e6, 
-  0x09e6, 0x09e6, 0x01e7, 0x01e6, 0x01c6, 0x09c6, 0x0164, 0x2248, 0x5bee, 0xbe99, 0xdf9d, 0xd71c, 
-  0xdf5d, 0xdf7d, 0x640f, 0x00e3, 0x01a6, 0x09c6, 0x09c6, 0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x01e6, 0x1b08, 0x0a26, 0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x09c6, 0x09c6, 0x09c6, 0x09e6, 
-  0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e6, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09c6, 0x09c6, 
-  0x09e6, 0x09e7, 0x09e6, 0x01e6, 0x09e7, 0x0061, 0xbdb6, 0xef7c, 0x08a2, 0x09c5, 0x0061, 0x8430, 
-  0xffff, 0x2144, 0x00e3, 0x0020, 0x3186, 0xd699, 0xffff, 0x5acb, 0x0060, 0x09c6, 0x09e7, 0x00c2, 
-  0x630b, 0xffff, 0x5aca, 0x0103, 0x0a28, 0x0a07, 0x0144, 0x5bae, 0xcf7d, 0xc73c, 0x74f2, 0x3b4c, 
-  0x1207, 0x12a8, 0x2349, 0x01e6, 0x09c4, 0x0060, 0xa4f3, 0xffff, 0x528a, 0x0081, 0x09c6, 0x01c5, 
-  0x12c7, 0x1267, 0x01a6, 0x09e6, 0x0041, 0xad54, 0xffff, 0x5b0b, 0x0000, 0x0020, 0x9cd2, 0xffff, 
-  0x6b4d, 0x00a1, 0x08c2, 0xdefb, 0xdefb, 0x0881, 0x0103, 0x2144, 0xffff, 0x9491, 0x0000, 0x0081, 
-  0x00a2, 0x00a2, 0x0040, 0x0000, 0x0000, 0x5aeb, 0xffff, 0x630b, 0x0102, 0x11c5, 0x0000, 0x2945, 
-  0x4a69, 0x0040, 0x0040, 0x10c3, 0xffff, 0x8c51, 0x0000, 0x1246, 0x01a4, 0x0123, 0x00e2, 0x0144, 
-  0x09e6, 0x1a87, 0x1206, 0x09c6, 0x0a07, 0x0123, 0x632c, 0xffff, 0x94b2, 0x630c, 0x6b4c, 0x6b4c, 
-  0x6b6d, 0x6b6d, 0x630c, 0xd699, 0xfffe, 0x10c3, 0x0164, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09c7, 
-  0x09e6, 0x09e6, 0x09c6, 0x09c6, 0x09c7, 0x09c6, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x09c6, 0x09c6, 
-  0x09c6, 0x09c7, 0x09e7, 0x09e6, 0x09e6, 0x01e6, 0x1287, 0x1b08, 0x01e5, 0x01c5, 0x01e5, 0x12a7, 
-  0x1287, 0x12a7, 0x12a7, 0x1287, 0x1267, 0x334a, 0x7cf1, 0xbe78, 0xceda, 0xc699, 0xc699, 0xc699, 
-  0xc699, 0xceda, 0xae17, 0x6c90, 0x2ae9, 0x1267, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1a88, 
-  0x01c6, 0x0a67, 0x1b08, 0x01c6, 0x09c6, 0x09e7, 0x09e6, 0x0a06, 0x1b08, 0x0a06, 0x09c6, 0x09e6, 
-  0x09e6, 0x09e6, 0x09e6, 0x01c6, 0x09e6, 0x0144, 0x2227, 0xa5d6, 0xdfbe, 0xcf3c, 0xcf1b, 0xd75d, 
-  0xdf5d, 0x5bef, 0x01c6, 0x0a07, 0x09e6, 0x09e6, 0x09c6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 
-  0x01c6, 0x01e6, 0x1b08, 0x0a26, 0x01c6, 0x09c6, 0x01c6, 0x01c6, 0x01a6, 0x01c6, 0x01c6, 0x09e6, 
-  0x09e6, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x09e7, 0x09e6, 0x09c6, 0x09e6, 0x09e7, 0x09e7, 0x09c6, 
-  0x09c6, 0x09c6, 0x01e6, 0x01c6, 0x09e7, 0x0061, 0xb595, 0xe73c, 0x0020, 0x0020, 0x18e3, 0xbdf7, 
-  0xffff, 0x10c2, 0x18c3, 0x9cb2, 0xf79d, 0xffff, 0x630c, 0x0040, 0x09a5, 0x09c6, 0x09e7, 0x00a2, 
-  0x630b, 0xffff, 0x5aca, 0x0123, 0x0a27, 0x1a48, 0x84f3, 0xc6da, 0xc71b, 0xc71b, 0xcf5c, 0xd77d, 
-  0x2268, 0x0a87, 0x2349, 0x01a4, 0x10c3, 0xad54, 0xffff, 0x5acb, 0x0102, 0x0a26, 0x01c6, 0x01c5, 
-  0x1ac7, 0x1287, 0x01a6, 0x09e6, 0x0144, 0x18c3, 0xdeda, 0xf7be, 0x9471, 0x94b2, 0xffff, 0xc638, 
-  0x0861, 0x0103, 0x0061, 0xdeda, 0xdeda, 0x0061, 0x00e3, 0x2985, 0xffff, 0xe71c, 0xa554, 0xad55, 
-  0xad54, 0xad55, 0xad75, 0xa534, 0x0040, 0x632c, 0xffff, 0x630b, 0x0122, 0x1aa7, 0x0061, 0xb595, 
-  0xffff, 0x2985, 0x0123, 0x2986, 0xffdf, 0x9492, 0x0943, 0x2beb, 0x12c9, 0x1267, 0x0a06, 0x09e6, 
-  0x1a87, 0x0a06, 0x09c6, 0x09e6, 0x0a07, 0x0123, 0x630c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xef5c, 0x18e3, 0x0144, 0x09e7, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09c6, 0x09c6, 0x09c6, 
-  0x01a6, 0x01a6, 0x01c6, 0x09c6, 0x09c6, 0x09c6, 0x09e7, 0x09c6, 0x01c6, 0x01c6, 0x09e6, 0x09c6, 
-  0x09c6, 0x09c7, 0x09c7, 0x09e7, 0x09e7, 0x09e6, 0x01c5, 0x1287, 0x1b08, 0x0206, 0x01c5, 0x01c5, 
-  0x1287, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x0a66, 0x0205, 0x22a8, 0x9d95, 0xcefa, 0xc699, 0xc699, 
-  0xcefa, 0x74b1, 0x1246, 0x0205, 0x1267, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x12a7, 0x1aa7, 
-  0x01c6, 0x0a66, 0x1b08, 0x01e6, 0x09e7, 0x09e6, 0x01e6, 0x0a07, 0x2308, 0x0a06, 0x01e6, 0x09e6, 
-  0x01e6, 0x01e6, 0x09e7, 0x09e6, 0x0124, 0x19c6, 0xa617, 0xd77d, 0xcf1c, 0xcf1c, 0xd75d, 0xdf7d, 
-  0x6430, 0x01a5, 0x0a07, 0x09c6, 0x09e6, 0x09e7, 0x09e6, 0x09c6, 0x09c7, 0x09e7, 0x09e6, 0x09e6, 
-  0x09c6, 0x01c6, 0x1b08, 0x0a26, 0x01c5, 0x09e6, 0x01c6, 0x0a26, 0x1ac7, 0x1ac7, 0x0a06, 0x01c6, 
-  0x01e6, 0x09c6, 0x09e7, 0x09c6, 0x09c6, 0x01c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 
-  0x09c6, 0x09c6, 0x09e6, 0x09e6, 0x0a07, 0x0061, 0xbdd6, 0xffff, 0xdeda, 0xdeda, 0xf7be, 0xffff, 
-  0x52aa, 0x0061, 0x2986, 0xf79d, 0xef5d, 0x5aaa, 0x0020, 0x11a5, 0x09c6, 0x09c6, 0x0a07, 0x00a2, 
-  0x630b, 0xffff, 0x52aa, 0x00c2, 0x1228, 0xa5b6, 0xe79e, 0xcf3c, 0xcf1b, 0xc71b, 0xcf3c, 0x6450, 
-  0x09a5, 0x1267, 0x2349, 0x0164, 0x39e7, 0xf79d, 0x5aaa, 0x0040, 0x2308, 0x0206, 0x01e6, 0x01c6, 
-  0x1ae7, 0x1287, 0x01a6, 0x09c6, 0x09e7, 0x0103, 0x2145, 0xd679, 0xf7be, 0xf79e, 0xbdd7, 0x18e3, 
-  0x00c2, 0x0944, 0x0040, 0xdeda, 0xdeba, 0x0061, 0x0123, 0x2965, 0xdedb, 0xe71c, 0xef5d, 0xef5c, 
-  0xe73c, 0xe73b, 0xef5d, 0xa513, 0x0000, 0x632c, 0xffff, 0x630b, 0x0142, 0x1ac8, 0x0061, 0xa513, 
-  0xffdf, 0x10a2, 0x0060, 0x0020, 0x10a2, 0x0841, 0x0061, 0x0164, 0x00e2, 0x00e2, 0x09c5, 0x1a67, 
-  0x1206, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 0x00e3, 0x5acb, 0xffff, 0x5acb, 0x0841, 0x10a2, 0x1082, 
-  0x1082, 0x1082, 0x0841, 0xa514, 0xffde, 0x10e3, 0x0144, 0x09e7, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x01c6, 0x09c6, 0x01c6, 
-  0x1267, 0x1287, 0x0a47, 0x01c6, 0x09c6, 0x09c6, 0x09e7, 0x1287, 0x12a7, 0x1287, 0x01e6, 0x09e6, 
-  0x09c6, 0x09c7, 0x09e7, 0x09e7, 0x09c7, 0x09e7, 0x09e6, 0x09e6, 0x1287, 0x1ac7, 0x0206, 0x01c6, 
-  0x01c5, 0x01c5, 0x01c5, 0x01c5, 0x01a5, 0x01c5, 0x01c5, 0x0184, 0x0184, 0x9554, 0xc699, 0xc69a, 
-  0x6c50, 0x0123, 0x01a5, 0x01c5, 0x01a5, 0x01a5, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01c5, 0x01c5, 
-  0x01c6, 0x0a67, 0x1b08, 0x01e6, 0x09e7, 0x09e6, 0x09e6, 0x0a07, 0x2308, 0x0a06, 0x09e6, 0x09e6, 
-  0x01e6, 0x09e6, 0x09e6, 0x11e7, 0x84f3, 0xa5f7, 0xcf3c, 0xc6fb, 0xcf3c, 0xd75d, 0x7471, 0x32ea, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x09e7, 0x09e6, 0x09e7, 0x09e6, 
-  0x01e6, 0x01e6, 0x1b08, 0x0a47, 0x01c6, 0x01c6, 0x1267, 0x2368, 0x2368, 0x2368, 0x1b07, 0x01e5, 
-  0x01e6, 0x0a06, 0x0206, 0x09e6, 0x01e6, 0x01e6, 0x09e6, 0x09e6, 0x01e6, 0x01e6, 0x09e6, 0x01e6, 
-  0x01c6, 0x09c6, 0x09e7, 0x01e6, 0x09e7, 0x00c2, 0x630b, 0x9491, 0x9491, 0x9cb2, 0x94b2, 0x4228, 
-  0x0061, 0x09c6, 0x0903, 0x08c3, 0x08c3, 0x00e2, 0x09c5, 0x01c6, 0x09c6, 0x09c6, 0x0a07, 0x00a1, 
-  0x632c, 0xffff, 0x52aa, 0x00c2, 0x9d95, 0xe79d, 0xd71c, 0xd75c, 0xd75d, 0xd77c, 0x64b0, 0x01a5, 
-  0x0164, 0x1266, 0x1b08, 0x01e5, 0x0964, 0x10e2, 0x0061, 0x09c5, 0x1b28, 0x0206, 0x09e7, 0x01c6, 
-  0x1ae7, 0x1287, 0x01c6, 0x09e6, 0x09e6, 0x0a07, 0x0164, 0x08e2, 0x08c2, 0x08e3, 0x0902, 0x0103, 
-  0x09a5, 0x0165, 0x0041, 0xdefa, 0xdeda, 0x0041, 0x09c5, 0x11e5, 0x08c3, 0x08c3, 0x08c2, 0x0082, 
-  0x0061, 0x0061, 0x0061, 0x0041, 0x0000, 0x632c, 0xffff, 0x632c, 0x01a3, 0x1b28, 0x0081, 0xb575, 
-  0xffff, 0xa534, 0x9cb2, 0x9cd3, 0x9491, 0x94b2, 0x9492, 0x9471, 0x9492, 0x7bae, 0x0903, 0x09e6, 
-  0x09c6, 0x09e7, 0x09e6, 0x09c6, 0x1226, 0x09a4, 0x5aeb, 0xffff, 0xad55, 0x8430, 0x8c71, 0x8c51, 
-  0x8430, 0x8c50, 0x840f, 0xd6b9, 0xffde, 0x1904, 0x0164, 0x09c6, 0x09c6, 0x09e7, 0x09e6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x0a46, 
-  0x1b28, 0x2348, 0x12c7, 0x01c5, 0x01c6, 0x09c6, 0x0a06, 0x1b28, 0x2368, 0x1b07, 0x01e5, 0x09e6, 
-  0x09e7, 0x09e7, 0x09e6, 0x09c6, 0x09e7, 0x09e7, 0x09c7, 0x09e6, 0x01a5, 0x1ae8, 0x1b08, 0x1b08, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x12a7, 0x334a, 0xceda, 0xae17, 
-  0x1ac8, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b09, 0x2309, 
-  0x01c6, 0x0a67, 0x1b08, 0x01e6, 0x09e7, 0x09e7, 0x09c6, 0x0a06, 0x2308, 0x09e6, 0x09e6, 0x09e6, 
-  0x09e7, 0x01c6, 0x09c6, 0x9db6, 0xd77d, 0xd73c, 0xc6fb, 0xcf1c, 0xd77d, 0x6410, 0x01a5, 0x01a6, 
-  0x0a07, 0x09e7, 0x09e7, 0x09c7, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 
-  0x09e6, 0x01e6, 0x1b08, 0x0a27, 0x01c6, 0x01c6, 0x1287, 0x2bc9, 0x1ae6, 0x12a6, 0x2368, 0x1b07, 
-  0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1ae8, 0x1ae8, 0x1ae8, 0x1b08, 0x1ae8, 0x1b08, 0x12a7, 
-  0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x09a5, 0x00a2, 0x0000, 0x0060, 0x0061, 0x0040, 0x00c2, 
-  0x09a5, 0x09e6, 0x09c6, 0x01a6, 0x01a5, 0x1b08, 0x1267, 0x09c6, 0x09e6, 0x09c6, 0x09e7, 0x00a2, 
-  0x5aca, 0xef5d, 0x4207, 0x8491, 0xd77d, 0xcf1b, 0xd73c, 0xe79e, 0x9575, 0x438c, 0x2328, 0x09e5, 
-  0x0185, 0x1246, 0x2308, 0x01c5, 0x12c7, 0x1246, 0x01a5, 0x0a06, 0x1b08, 0x0206, 0x09e7, 0x01a6, 
-  0x1ac7, 0x1287, 0x01c6, 0x09e7, 0x09e6, 0x01c6, 0x12a7, 0x1ac7, 0x0185, 0x01c5, 0x1b08, 0x0a27, 
-  0x09a6, 0x0985, 0x0020, 0xce37, 0xce37, 0x0041, 0x0a06, 0x2369, 0x0a26, 0x01c6, 0x09e6, 0x09c6, 
-  0x09a6, 0x01a5, 0x01a5, 0x09c6, 0x0041, 0x5aca, 0xf79e, 0x5aaa, 0x09e4, 0x1b49, 0x00c2, 0x8410, 
-  0xef7d, 0xffbe, 0xffff, 0xffff, 0xffff, 0xffde, 0xf7be, 0xf79e, 0xffff, 0xdeba, 0x08e3, 0x09c6, 
-  0x09e7, 0x09e6, 0x09c6, 0x0a06, 0x2348, 0x0a04, 0x39a6, 0xef3c, 0xffbe, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffdf, 0xffdf, 0xf79e, 0xd679, 0x10e3, 0x0185, 0x09e6, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x1b28, 
-  0x1ae7, 0x0a66, 0x2348, 0x1287, 0x01c5, 0x01e6, 0x1b08, 0x1b28, 0x0a66, 0x2348, 0x1ae7, 0x01e6, 
-  0x09e7, 0x09e7, 0x09e6, 0x09e6, 0x09c7, 0x09e7, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x0a26, 0x0a26, 
-  0x0a46, 0x0a46, 0x0a27, 0x0a27, 0x0a27, 0x0a26, 0x0a26, 0x0a06, 0x0a47, 0x01a4, 0x8d33, 0x5c2f, 
-  0x01c5, 0x1247, 0x0a26, 0x0a27, 0x0a27, 0x0a26, 0x0a26, 0x0a26, 0x0a26, 0x0a27, 0x0a27, 0x0a27, 
-  0x01c6, 0x0a67, 0x1b28, 0x01c6, 0x09e7, 0x09e7, 0x09e6, 0x0a27, 0x2308, 0x01e6, 0x09e6, 0x0a07, 
-  0x01e6, 0x11e7, 0x9554, 0xd75c, 0xcf1c, 0xc6db, 0xcf3c, 0xc6fb, 0x5b8d, 0x09a6, 0x09c6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09c7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 
-  0x09e6, 0x01e6, 0x1b08, 0x0a27, 0x01c6, 0x01c6, 0x1267, 0x2388, 0x2368, 0x2368, 0x2348, 0x0a66, 
-  0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x0a06, 0x09e6, 0x0a66, 0x2368, 
-  0x1287, 0x01c6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09c6, 0x1aa8, 0x1267, 0x09a6, 0x09c6, 
-  0x01a6, 0x09e6, 0x09e7, 0x0a07, 0x09e6, 0x2308, 0x1267, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0164, 
-  0x08c2, 0x2124, 0x39e7, 0xbe79, 0xc6fb, 0xd71c, 0xe79e, 0x84b2, 0x1207, 0x0206, 0x2328, 0x0a26, 
-  0x01a5, 0x1247, 0x2308, 0x01c5, 0x12c7, 0x1287, 0x01c5, 0x0a26, 0x1b08, 0x0a06, 0x09e6, 0x01c6, 
-  0x1ae7, 0x1287, 0x01c6, 0x09e7, 0x09e7, 0x01c6, 0x1287, 0x1ae8, 0x01c6, 0x09e6, 0x1b28, 0x0a26, 
-  0x09c6, 0x09c6, 0x00e3, 0x10c2, 0x10c2, 0x00e3, 0x0a06, 0x2348, 0x0a46, 0x09e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0965, 0x08c2, 0x18e3, 0x08a2, 0x1ac7, 0x1328, 0x09e6, 0x1103, 
-  0x1904, 0x10e3, 0x1103, 0x10e3, 0x10e3, 0x10c2, 0x0882, 0x10a2, 0x10a2, 0x10c2, 0x11c5, 0x0a07, 
-  0x09e7, 0x09e7, 0x09c6, 0x0a06, 0x2328, 0x1ae7, 0x0923, 0x1903, 0x1904, 0x10e3, 0x10e3, 0x10e3, 
-  0x1903, 0x1903, 0x1903, 0x1904, 0x10e3, 0x0944, 0x09c6, 0x09c7, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x01e6, 0x1b08, 
-  0x1b27, 0x12a6, 0x2368, 0x1287, 0x01c5, 0x01e5, 0x1b28, 0x2368, 0x12c6, 0x2b88, 0x1ae7, 0x01c6, 
-  0x09e7, 0x09c6, 0x09e7, 0x09e7, 0x09e7, 0x09c7, 0x09e7, 0x09e6, 0x09e6, 0x09e6, 0x01c6, 0x09c6, 
-  0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x09c6, 0x01c6, 0x01c6, 0x09c6, 0x01a6, 0x2289, 0x1a48, 
-  0x01a6, 0x09c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01c6, 0x01a6, 0x09c6, 0x09c6, 0x09e6, 0x09c6, 
-  0x01c6, 0x1267, 0x1b08, 0x01c6, 0x09e7, 0x09e7, 0x09c6, 0x0a26, 0x2308, 0x09e6, 0x01c6, 0x0164, 
-  0x11c6, 0x9db6, 0xe7be, 0xcf1c, 0xd73c, 0xdf7d, 0xc6db, 0x534d, 0x0103, 0x09c6, 0x09e7, 0x09c7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 
-  0x09e6, 0x01e6, 0x1b08, 0x0a27, 0x01c6, 0x09e6, 0x01e6, 0x1286, 0x1b28, 0x1b27, 0x0a66, 0x01e6, 
-  0x01e6, 0x01c6, 0x09e6, 0x09e7, 0x09c6, 0x09c6, 0x09e6, 0x01c6, 0x01c6, 0x09c6, 0x01c5, 0x1287, 
-  0x12a7, 0x01e6, 0x09e7, 0x0a07, 0x09e7, 0x0a07, 0x09e7, 0x01c6, 0x1ac8, 0x1267, 0x01a6, 0x09e6, 
-  0x09c6, 0x09e7, 0x0a07, 0x0a07, 0x09e7, 0x1b28, 0x1267, 0x01c7, 0x0a07, 0x0a07, 0x01c6, 0x09c6, 
-  0x6c50, 0xadf7, 0xbe99, 0xc6db, 0xcefb, 0xdf7d, 0x7c71, 0x0165, 0x0a07, 0x0a07, 0x2349, 0x1267, 
-  0x01c6, 0x1267, 0x2308, 0x01c5, 0x12a7, 0x1287, 0x01c5, 0x0a26, 0x1b08, 0x09e6, 0x09e7, 0x01c6, 
-  0x1ae8, 0x1287, 0x01c6, 0x09e7, 0x09e7, 0x01c6, 0x1287, 0x1ae7, 0x01c6, 0x09e6, 0x1b08, 0x0a27, 
-  0x09c6, 0x09e7, 0x09c6, 0x0185, 0x0185, 0x01c6, 0x0a06, 0x1b28, 0x0a26, 0x09e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x01a6, 0x0165, 0x01a5, 0x1ae8, 0x12c7, 0x0226, 0x2308, 
-  0x09e5, 0x0a06, 0x1aa7, 0x01a5, 0x1266, 0x0a06, 0x0164, 0x1a66, 0x01a5, 0x0a26, 0x2308, 0x09e6, 
-  0x09e7, 0x09e7, 0x09e6, 0x01c6, 0x1246, 0x2368, 0x2388, 0x1ac7, 0x01a5, 0x01a5, 0x01a5, 0x0185, 
-  0x1206, 0x22e7, 0x22e7, 0x1226, 0x09a6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x0a26, 
-  0x2348, 0x2368, 0x12a7, 0x01e5, 0x09e6, 0x01e6, 0x0206, 0x2348, 0x2388, 0x1ae7, 0x0205, 0x09e6, 
-  0x09e7, 0x09c7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x09e7, 0x09e7, 0x09c6, 0x09c6, 0x09e7, 0x01c6, 0x01e6, 
-  0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x09c6, 0x09c6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01c6, 0x1267, 0x1b08, 0x01e6, 0x09e7, 0x09e7, 0x09c6, 0x0a26, 0x2328, 0x0185, 0x09c6, 0x3aca, 
-  0x8d34, 0xdf9e, 0xcf1c, 0xd75d, 0xd75d, 0x9554, 0x432c, 0x0185, 0x09c6, 0x09e7, 0x09e7, 0x09c7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e6, 0x09e6, 0x1b08, 0x0a47, 0x09e6, 0x09e6, 0x09e6, 0x01e6, 0x09e6, 0x0a06, 0x09e6, 0x09e7, 
-  0x09e7, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x01e6, 
-  0x0a47, 0x1267, 0x0a06, 0x09e6, 0x0a07, 0x0a07, 0x0a07, 0x01e7, 0x1ae8, 0x12a7, 0x09c6, 0x09e6, 
-  0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x2349, 0x1267, 0x09c6, 0x01c6, 0x09e6, 0x32eb, 0x84f3, 
-  0xd77d, 0xcf1b, 0xc6da, 0xcf1b, 0xcf3c, 0x63cf, 0x0124, 0x09c6, 0x09e6, 0x09e6, 0x2328, 0x1267, 
-  0x01c6, 0x1267, 0x1b08, 0x01a5, 0x12c7, 0x1287, 0x01c5, 0x0a26, 0x2308, 0x0a06, 0x09e6, 0x01c6, 
-  0x1ae8, 0x1287, 0x01c6, 0x09e6, 0x09e6, 0x01c6, 0x1287, 0x1ae8, 0x01c6, 0x09e6, 0x1b08, 0x0a27, 
-  0x09e6, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x09e6, 0x0a06, 0x1b28, 0x0a26, 0x01e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x01c6, 0x1ac8, 0x12a7, 0x01e6, 0x2308, 
-  0x0a26, 0x1247, 0x2308, 0x01c5, 0x1ac8, 0x1267, 0x01c5, 0x2308, 0x0a26, 0x1287, 0x2328, 0x09e6, 
-  0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x0a06, 0x1b07, 0x2368, 0x12a7, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 
-  0x09e7, 0x1267, 0x1b08, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e6, 
-  0x0a46, 0x1ae7, 0x01e6, 0x09e6, 0x09e6, 0x09e6, 0x09e6, 0x1287, 0x1b08, 0x01e5, 0x09e6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x01c6, 0x1267, 0x1b08, 0x09e6, 0x09e7, 0x09e7, 0x09c6, 0x1247, 0x2308, 0x09c6, 0x7cd2, 0xd77d, 
-  0xcf1c, 0xd71c, 0xd75d, 0xdf7d, 0x7471, 0x0185, 0x01e7, 0x0a27, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x0a07, 0x09e6, 0x1b08, 0x0a47, 0x09e6, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x01c6, 0x0a46, 0x1ac8, 0x0a47, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x1ae8, 0x12a7, 0x09c6, 0x09e7, 
-  0x09e7, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x1b28, 0x1247, 0x0185, 0x09a6, 0x7cb2, 0xdf7d, 0xd75c, 
-  0xd73c, 0xcf1b, 0xd77d, 0xcefb, 0x63cf, 0x00e3, 0x09c6, 0x09c6, 0x09e6, 0x09e6, 0x2328, 0x1247, 
-  0x01c6, 0x1267, 0x2308, 0x01c5, 0x1ac7, 0x1287, 0x01c5, 0x0a26, 0x2308, 0x09e6, 0x09e7, 0x01c6, 
-  0x1ae8, 0x1287, 0x01c6, 0x09e7, 0x09e6, 0x01c6, 0x1287, 0x1ae8, 0x01c6, 0x09e6, 0x1b08, 0x0a26, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x0a06, 0x1b28, 0x0a26, 0x09e6, 0x0a07, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x1ac8, 0x12a7, 0x01e6, 0x22e8, 
-  0x0a06, 0x0a46, 0x1ae8, 0x01a5, 0x1aa8, 0x1267, 0x01c5, 0x1ae8, 0x0a06, 0x1267, 0x2308, 0x09e7, 
-  0x0a07, 0x0a07, 0x09e7, 0x0a07, 0x01e6, 0x1266, 0x2328, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09c6, 0x1267, 0x1b08, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09e7, 0x09e6, 
-  0x0a47, 0x1ae8, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x0206, 0x1b08, 0x01e6, 0x09c6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 
-  0x01c6, 0x1267, 0x2328, 0x01e6, 0x09e7, 0x09e7, 0x0a07, 0x1267, 0x2b49, 0x8d54, 0xd77d, 0xcf1c, 
-  0xcf1c, 0xd73c, 0xd73c, 0x6410, 0x01a6, 0x09e7, 0x0a07, 0x0a07, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 
-  0x0a07, 0x0a07, 0x09e7, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e6, 0x1b08, 0x0a47, 0x09e7, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e6, 0x1267, 0x0a26, 0x09c6, 0x09c6, 0x09e7, 0x09c6, 0x1ae8, 0x12a7, 0x09c6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x2308, 0x1246, 0x0144, 0x7cb2, 0xdf9d, 0xcf1b, 0xcf3c, 
-  0xd75c, 0xdf9d, 0xa5f7, 0x6c50, 0x0144, 0x09a6, 0x09c6, 0x09e6, 0x09e6, 0x09e6, 0x2308, 0x1247, 
-  0x09c6, 0x1267, 0x2308, 0x01c5, 0x1ac7, 0x1287, 0x01c6, 0x0a26, 0x2308, 0x0a06, 0x09e7, 0x01c6, 
-  0x1ae8, 0x1287, 0x01c6, 0x09e7, 0x09e7, 0x01c6, 0x1287, 0x1ae8, 0x01c6, 0x09e6, 0x1b08, 0x0a26, 
-  0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x09e7, 0x0a06, 0x1b28, 0x0a26, 0x09e7, 0x0a07, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x01e6, 0x1ac8, 0x1287, 0x01e6, 0x22e8, 
-  0x0a06, 0x0a46, 0x1ae8, 0x01a5, 0x1aa8, 0x1267, 0x01c5, 0x2308, 0x0a06, 0x1267, 0x2308, 0x09e6, 
-  0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x09e7, 0x1267, 0x2328, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09c6, 0x1267, 0x1b08, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x0a07, 0x09e7, 
-  0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 
-  0x0a47, 0x1b08, 0x09e6, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x0a06, 0x1b08, 0x09e6, 0x09e6, 0x09e7, 
-  0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x0a07, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 
-  0x01c6, 0x1267, 0x2328, 0x01e6, 0x09e7, 0x0a07, 0x01e6, 0x1227, 0xa617, 0xd77d, 0xc71c, 0xcf1c, 
-  0xd75c, 0xc6db, 0x42eb, 0x0164, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 
-  0x0a07, 0x0a07, 0x09e7, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e6, 0x1b08, 0x0a47, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e6, 0x01e6, 0x1267, 0x09c6, 0x09c6, 0x09e7, 0x09c6, 0x1ae8, 0x1287, 0x09c6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x1ac8, 0x1a87, 0x8d54, 0xd75c, 0xcf1c, 0xcf3c, 0xdf5d, 
-  0xefdf, 0x9555, 0x1207, 0x0185, 0x09e7, 0x09c6, 0x09c6, 0x09e7, 0x09e7, 0x09e6, 0x2308, 0x1247, 
-  0x01c6, 0x1267, 0x2308, 0x01c5, 0x1aa7, 0x1287, 0x01c6, 0x0a26, 0x1b08, 0x09e6, 0x09e6, 0x01c6, 
-  0x1ae8, 0x1287, 0x01c6, 0x09e7, 0x09e7, 0x01c6, 0x1287, 0x1ae8, 0x01c6, 0x09e6, 0x1b08, 0x0a26, 
-  0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x09e7, 0x0a07, 0x1b28, 0x0a26, 0x09e6, 0x0a07, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x01e6, 0x1ac8, 0x1287, 0x01e6, 0x2308, 
-  0x0a06, 0x0a46, 0x22e8, 0x0185, 0x1aa7, 0x1267, 0x01c5, 0x2308, 0x0a06, 0x1267, 0x2328, 0x09e6, 
-  0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x09e7, 0x1267, 0x2328, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09c6, 0x1287, 0x1b08, 0x09e6, 0x0a07, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 
-  0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 
-  0x0a47, 0x1b08, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x0a06, 0x1b08, 0x0a06, 0x09e7, 0x09e7, 
-  0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x09e7, 0x0a07, 
-  0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 
-  0x01c6, 0x1267, 0x2328, 0x01e6, 0x0a07, 0x09a6, 0x7cd2, 0xb658, 0xd73c, 0xcf3c, 0xcf1b, 0xd77d, 
-  0x84d2, 0x2248, 0x09c6, 0x09e6, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e6, 0x2308, 0x0a47, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e6, 0x1247, 0x1ac8, 0x09c6, 0x09e7, 0x01c6, 0x1ac8, 0x1287, 0x09c6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x09c6, 0x1a67, 0x8d74, 0xdf7d, 0xcf1b, 0xcefb, 0xdf5d, 0x9575, 
-  0x3b0b, 0x22aa, 0x0a07, 0x1207, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x01e6, 0x2308, 0x1247, 
-  0x01c6, 0x1267, 0x2308, 0x01a5, 0x12a7, 0x1287, 0x01c6, 0x0a26, 0x1b08, 0x09e6, 0x09e6, 0x01c6, 
-  0x1ae8, 0x1287, 0x01c6, 0x09e7, 0x09e7, 0x01c6, 0x1287, 0x1ac8, 0x01c6, 0x09e6, 0x2308, 0x0a27, 
-  0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x09e7, 0x0a07, 0x2328, 0x0a06, 0x09e6, 0x0a07, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x01e6, 0x1ac8, 0x1287, 0x01e6, 0x2308, 
-  0x0a06, 0x0a47, 0x1ae8, 0x0185, 0x1aa7, 0x1267, 0x01c5, 0x2308, 0x0a06, 0x1267, 0x2308, 0x09c6, 
-  0x0a07, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x1267, 0x2328, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09c6, 0x1267, 0x1b08, 0x09e6, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 
-  0x0a27, 0x1ae8, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x0a26, 0x2328, 0x0a06, 0x09e6, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 
-  0x01e7, 0x1267, 0x2328, 0x01e6, 0x01a5, 0x6c71, 0xd77d, 0xdf9d, 0xd75c, 0xcf3c, 0xdf9d, 0x8d34, 
-  0x0945, 0x0185, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x1207, 0x0a07, 0x0a07, 
-  0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x09e7, 
-  0x09e7, 0x09e6, 0x22e8, 0x1227, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x11e7, 
-  0x09e7, 0x09e7, 0x09c7, 0x0a07, 0x22e8, 0x09c6, 0x09e7, 0x09c6, 0x1ac8, 0x1267, 0x09c6, 0x09e7, 
-  0x09e7, 0x09e7, 0x0a07, 0x0185, 0x7492, 0xbeba, 0xcf3c, 0xd75c, 0xcefb, 0xdf7d, 0xa5b6, 0x1165, 
-  0x0164, 0x0a47, 0x1227, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09c6, 0x2308, 0x1247, 
-  0x01c6, 0x1247, 0x2309, 0x01a6, 0x12a7, 0x1287, 0x01c6, 0x0a26, 0x2308, 0x09e6, 0x09e7, 0x01c6, 
-  0x1ac8, 0x1287, 0x01c6, 0x09e7, 0x09e7, 0x01c6, 0x1287, 0x1ac8, 0x01c6, 0x09e6, 0x2308, 0x0a27, 
-  0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x09e7, 0x0a07, 0x2328, 0x0a06, 0x09e7, 0x09e7, 0x09e7, 
-  0x0a07, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x01e6, 0x1ac8, 0x1287, 0x01e6, 0x22e8, 
-  0x0a06, 0x0a47, 0x22e8, 0x01a5, 0x1aa8, 0x1267, 0x01c5, 0x22e8, 0x0a06, 0x1267, 0x2309, 0x09c6, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x1267, 0x2b29, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x1267, 0x2308, 0x09e7, 0x0a07, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09c7, 
-  0x0a27, 0x22e8, 0x01e6, 0x09e7, 0x09e7, 0x09e7, 0x09e6, 0x0a06, 0x2308, 0x09e6, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 
-  0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x09e7, 0x11e7, 0x1207, 0x09e7, 0x09e7, 0x09e7, 
-  0x0a07, 0x0a07, 0x0a07, 0x09e7, 0x0a07, 0x09e7, 0x09e7, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x0a07
+// 240x240, RGB565 format, BITMAP_RLE (73768 bytes, 115200 raw)
+static const uint8_t intro_240x240_rle[73768] = {
+  0x4a, 0x01, 0xe6, 0x11, 0x01, 0xc5, 0x12, 0xc8, 0x12, 0x87, 0x01, 0xc5, 0x01, 0xc6, 0x0a, 0x27, 
+  0x1b, 0x28, 0x01, 0xe6, 0x01, 0xc6, 0x12, 0xc7, 0x12, 0xa7, 0x01, 0xe5, 0x23, 0x28, 0x0a, 0x26, 
+  0x01, 0xc6, 0x01, 0xe6, 0x09, 0xe6, 0x01, 0xe7, 0x41, 0x09, 0xe7, 0x00, 0x01, 0xe7, 0x41, 0x01, 
+  0xe6, 0x00, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x03, 0x02, 0x06, 0x1b, 0x28, 0x0a, 0x26, 0x01, 0xc6, 
+  0x41, 0x01, 0xe6, 0x02, 0x01, 0xc5, 0x1b, 0x08, 0x0a, 0x67, 0x41, 0x01, 0xc6, 0x0d, 0x0a, 0x87, 
+  0x1b, 0x08, 0x01, 0xc6, 0x01, 0xe6, 0x01, 0xe5, 0x1b, 0x08, 0x0a, 0x26, 0x01, 0xc6, 0x01, 0xe6, 
+  0x01, 0xe7, 0x01, 0xe6, 0x1b, 0x08, 0x12, 0xa7, 0x01, 0xc5, 0x42, 0x01, 0xe6, 0x00, 0x09, 0xe6, 
+  0x42, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x03, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0xe7, 0x41, 
+  0x01, 0xe6, 0x00, 0x01, 0xe7, 0x59, 0x01, 0xe6, 0x1b, 0x09, 0xe6, 0x01, 0xc6, 0x12, 0xa7, 0x12, 
+  0xc7, 0x01, 0xc6, 0x01, 0xe6, 0x1b, 0x08, 0x0a, 0x06, 0x01, 0xa6, 0x12, 0x87, 0x1a, 0xe8, 0x01, 
+  0xc6, 0x01, 0xe6, 0x1b, 0x08, 0x0a, 0x26, 0x01, 0xc5, 0x0a, 0x87, 0x1b, 0x08, 0x01, 0xc5, 0x12, 
+  0xe7, 0x12, 0xa7, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xe6, 0x01, 0xc6, 0x12, 0x87, 0x12, 0xe7, 0x01, 
+  0xa5, 0x48, 0x01, 0xe6, 0x02, 0x1b, 0x08, 0x0a, 0x26, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x09, 0x01, 
+  0xc6, 0x12, 0xc7, 0x12, 0x87, 0x01, 0xc6, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x87, 0x12, 
+  0xe8, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x02, 0x01, 0xc5, 0x0a, 0x46, 0x1b, 0x28, 0x43, 0x01, 0xe6, 
+  0x04, 0x01, 0xc6, 0x02, 0x06, 0x1b, 0x28, 0x02, 0x05, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x41, 0x01, 
+  0xe7, 0x46, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x01, 0x09, 0xe6, 0x01, 0xe7, 0x44, 
+  0x01, 0xe6, 0x00, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x42, 0x09, 0xe7, 0x00, 0x01, 
+  0xe7, 0x41, 0x09, 0xe7, 0x11, 0x01, 0xe7, 0x09, 0xe6, 0x01, 0xc6, 0x02, 0x26, 0x23, 0x48, 0x02, 
+  0x06, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xe6, 0x1b, 0x08, 0x0a, 0x66, 0x01, 0xa6, 0x01, 0xe6, 0x01, 
+  0xa6, 0x12, 0x87, 0x12, 0xc7, 0x01, 0xc5, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x03, 0x0a, 0x46, 0x23, 
+  0x28, 0x01, 0xe6, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x43, 0x09, 0xe7, 0x01, 0x09, 0xe6, 0x0a, 0x07, 
+  0x41, 0x09, 0xe7, 0x01, 0x0a, 0x07, 0x0a, 0x27, 0x83, 0x00, 0x01, 0xc6, 0x80, 0x00, 0x09, 0xe7, 
+  0x81, 0x41, 0x09, 0xe6, 0x84, 0x00, 0x0a, 0x26, 0x83, 0x00, 0x12, 0x87, 0x80, 0x00, 0x1b, 0x28, 
+  0x80, 0x02, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x01, 0x09, 0xe6, 0x09, 0xe7, 
+  0x84, 0x00, 0x01, 0xc6, 0x84, 0x00, 0x01, 0xc6, 0x82, 0x00, 0x01, 0xa6, 0x87, 0x02, 0x01, 0xa6, 
+  0x09, 0xe6, 0x09, 0xe7, 0x83, 0x00, 0x01, 0xc6, 0x80, 0x00, 0x01, 0xe7, 0x65, 0x01, 0xe6, 0x02, 
+  0x01, 0xc6, 0x09, 0xc6, 0x01, 0xc5, 0x83, 0x01, 0x1b, 0x28, 0x0a, 0x27, 0x81, 0x00, 0x1a, 0xc8, 
+  0x84, 0x00, 0x0a, 0x67, 0x80, 0x02, 0x01, 0xa5, 0x12, 0xc7, 0x12, 0x87, 0x81, 0x00, 0x09, 0xe7, 
+  0x81, 0x00, 0x1a, 0xe7, 0x8d, 0x00, 0x01, 0xe7, 0x87, 0x00, 0x1a, 0xe8, 0x82, 0x00, 0x01, 0xc6, 
+  0x82, 0x00, 0x01, 0xc6, 0x88, 0x4b, 0x01, 0xe6, 0x80, 0x44, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x43, 
+  0x01, 0xe6, 0x84, 0x42, 0x09, 0xe7, 0x80, 0x00, 0x01, 0xe6, 0x82, 0x00, 0x0a, 0x06, 0x80, 0x01, 
+  0x09, 0xe7, 0x01, 0xc5, 0x80, 0x01, 0x0a, 0x67, 0x01, 0xc5, 0x82, 0x00, 0x12, 0xc8, 0x84, 0x00, 
+  0x1b, 0x28, 0x87, 0x00, 0x09, 0xe7, 0x84, 0x44, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x80, 0x01, 0x09, 
+  0xe6, 0x09, 0xe7, 0x82, 0x00, 0x12, 0xc7, 0x83, 0x01, 0x1b, 0x08, 0x01, 0xe5, 0x86, 0x43, 0x01, 
+  0xe6, 0x81, 0x41, 0x09, 0xe7, 0x81, 0x00, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x82, 0x41, 0x01, 0xc6, 
+  0x84, 0x00, 0x0a, 0x86, 0x81, 0x01, 0x01, 0xc6, 0x01, 0xc5, 0x80, 0x00, 0x0a, 0x46, 0x82, 0x00, 
+  0x01, 0xc5, 0x81, 0x41, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x8e, 0x00, 0x01, 0xe7, 
+  0x94, 0x01, 0x09, 0xe6, 0x01, 0xc6, 0x89, 0x00, 0x01, 0xe5, 0x80, 0x00, 0x0a, 0x46, 0x81, 0x01, 
+  0x1a, 0xe8, 0x01, 0xc5, 0x82, 0x01, 0x01, 0xe6, 0x01, 0xe7, 0x81, 0x01, 0x12, 0xe7, 0x01, 0xc5, 
+  0x81, 0x41, 0x01, 0xe7, 0x85, 0x00, 0x0a, 0x46, 0x86, 0x00, 0x09, 0xe7, 0x82, 0x00, 0x12, 0xe8, 
+  0x84, 0x00, 0x1b, 0x08, 0x81, 0x00, 0x01, 0xc6, 0x81, 0x00, 0x02, 0x05, 0x81, 0x47, 0x01, 0xe6, 
+  0x00, 0x09, 0xe6, 0x83, 0x00, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x01, 0x09, 0xe7, 0x09, 0xe6, 0x43, 
+  0x09, 0xe7, 0x80, 0x41, 0x01, 0xe7, 0x80, 0x00, 0x01, 0xe7, 0x45, 0x09, 0xe6, 0x41, 0x09, 0xe7, 
+  0x83, 0x00, 0x02, 0x06, 0x80, 0x00, 0x09, 0xe6, 0x82, 0x01, 0x01, 0xa5, 0x01, 0xc6, 0x89, 0x00, 
+  0x09, 0xe6, 0x80, 0x41, 0x09, 0xe6, 0x44, 0x09, 0xe7, 0x42, 0x0a, 0x07, 0x80, 0x47, 0x01, 0xe6, 
+  0x80, 0x00, 0x01, 0xe6, 0x86, 0x01, 0x1b, 0x28, 0x01, 0xe6, 0x88, 0x00, 0x09, 0xe6, 0x80, 0x43, 
+  0x09, 0xe7, 0x41, 0x01, 0xe6, 0x91, 0x00, 0x1b, 0x28, 0x80, 0x00, 0x01, 0xc6, 0x41, 0x09, 0xe6, 
+  0x82, 0x00, 0x01, 0xc5, 0x43, 0x01, 0xe6, 0x83, 0x41, 0x09, 0xe6, 0x00, 0x01, 0xe7, 0x51, 0x01, 
+  0xe6, 0x00, 0x01, 0xe7, 0x81, 0x00, 0x01, 0xc6, 0x85, 0x00, 0x09, 0xe6, 0x81, 0x01, 0x09, 0xe7, 
+  0x01, 0xa5, 0x80, 0x04, 0x1a, 0xe8, 0x01, 0xc5, 0x02, 0x06, 0x1b, 0x08, 0x0a, 0x26, 0x80, 0x00, 
+  0x0a, 0x66, 0x83, 0x00, 0x0a, 0x26, 0x80, 0x00, 0x0a, 0x66, 0x85, 0x00, 0x01, 0xe6, 0x80, 0x00, 
+  0x0a, 0x87, 0x83, 0x45, 0x01, 0xe6, 0x00, 0x01, 0xe5, 0x82, 0x02, 0x01, 0xc6, 0x01, 0xe6, 0x01, 
+  0xc5, 0x82, 0x41, 0x01, 0xe6, 0x88, 0x00, 0x01, 0xe5, 0x42, 0x01, 0xe6, 0x83, 0x00, 0x01, 0xc6, 
+  0x85, 0x41, 0x01, 0xe7, 0x44, 0x09, 0xe6, 0x00, 0x09, 0xe7, 0x80, 0x41, 0x09, 0xe6, 0x82, 0x44, 
+  0x01, 0xe6, 0x00, 0x09, 0xe6, 0x42, 0x09, 0xe7, 0x80, 0x00, 0x09, 0xc6, 0x43, 0x09, 0xe6, 0x84, 
+  0x00, 0x01, 0xe6, 0x81, 0x02, 0x0a, 0x66, 0x01, 0xc5, 0x09, 0xe6, 0x84, 0x00, 0x01, 0xe6, 0x81, 
+  0x00, 0x1b, 0x08, 0x42, 0x01, 0xe6, 0x80, 0x00, 0x01, 0xe6, 0x87, 0x00, 0x0a, 0x07, 0x4a, 0x01, 
+  0xe6, 0x8d, 0x00, 0x01, 0xc6, 0x82, 0x00, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xe6, 
+  0x81, 0x01, 0x01, 0xc6, 0x02, 0x06, 0x82, 0x00, 0x01, 0xe6, 0x83, 0x41, 0x01, 0xc6, 0x00, 0x0a, 
+  0x87, 0x86, 0x41, 0x09, 0xe7, 0x82, 0x00, 0x01, 0xc6, 0x80, 0x00, 0x01, 0xe7, 0x82, 0x44, 0x09, 
+  0xe6, 0x41, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x80, 0x41, 0x01, 0xe7, 0x83, 0x43, 0x09, 0xe6, 0x00, 
+  0x09, 0xe7, 0x80, 0x01, 0x01, 0xe7, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x82, 0x44, 
+  0x09, 0xe6, 0x05, 0x01, 0xc6, 0x0a, 0x26, 0x1a, 0xe7, 0x0a, 0x66, 0x01, 0xc6, 0x01, 0xe6, 0x82, 
+  0x01, 0x0a, 0x87, 0x12, 0xc7, 0x83, 0x00, 0x01, 0xa5, 0x80, 0x00, 0x1b, 0x08, 0x80, 0x00, 0x12, 
+  0xe7, 0x89, 0x00, 0x09, 0xe6, 0x89, 0x00, 0x01, 0xc6, 0x84, 0x41, 0x01, 0xc6, 0x80, 0x00, 0x12, 
+  0xe7, 0x84, 0x02, 0x1b, 0x28, 0x01, 0xc5, 0x01, 0xc6, 0x82, 0x00, 0x02, 0x06, 0x84, 0x42, 0x09, 
+  0xe7, 0x02, 0x09, 0xc7, 0x09, 0xe7, 0x01, 0xe6, 0x82, 0x41, 0x01, 0xe6, 0x80, 0x01, 0x09, 0xe6, 
+  0x09, 0xc6, 0x83, 0x00, 0x09, 0xe6, 0x82, 0x41, 0x09, 0xe6, 0x00, 0x01, 0xe6, 0x41, 0x09, 0xe6, 
+  0x00, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x00, 0x09, 0xc6, 0x85, 0x41, 0x01, 0xe6, 0x82, 0x01, 0x01, 
+  0xa5, 0x09, 0xc6, 0x86, 0x00, 0x0a, 0x26, 0x83, 0x01, 0x01, 0xe6, 0x09, 0xe6, 0x83, 0x41, 0x0a, 
+  0x07, 0x00, 0x09, 0xe7, 0x81, 0x81, 0x00, 0x01, 0xe7, 0x82, 0x00, 0x01, 0xe7, 0x88, 0x01, 0x0a, 
+  0x27, 0x1b, 0x08, 0x83, 0x00, 0x01, 0xc5, 0x86, 0x00, 0x09, 0xe6, 0x80, 0x02, 0x01, 0xe7, 0x09, 
+  0xe6, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x80, 0x00, 0x01, 0xe6, 0x82, 0x41, 0x01, 0xc6, 0x84, 0x02, 
+  0x0a, 0x86, 0x1b, 0x07, 0x01, 0xc5, 0x84, 0x41, 0x09, 0xe6, 0x00, 0x01, 0xc6, 0x83, 0x41, 0x01, 
+  0xe6, 0x46, 0x09, 0xe6, 0x00, 0x01, 0xe7, 0x42, 0x09, 0xe7, 0x41, 0x01, 0xe6, 0x41, 0x01, 0xe7, 
+  0x81, 0x43, 0x09, 0xe6, 0x01, 0x01, 0xe6, 0x09, 0xe6, 0x44, 0x01, 0xe6, 0x03, 0x09, 0xe6, 0x09, 
+  0xc6, 0x01, 0xe6, 0x09, 0xe6, 0x82, 0x00, 0x01, 0xe6, 0x81, 0x03, 0x01, 0xe6, 0x0a, 0x26, 0x1a, 
+  0xe8, 0x0a, 0x67, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xe5, 0x82, 0x00, 0x0a, 0x66, 0x81, 0x00, 0x01, 
+  0xe6, 0x81, 0x00, 0x01, 0xa6, 0x80, 0x00, 0x1a, 0xe8, 0x80, 0x00, 0x12, 0xc7, 0x80, 0x00, 0x01, 
+  0xc5, 0x83, 0x00, 0x1a, 0xe7, 0x81, 0x00, 0x01, 0xe7, 0x45, 0x01, 0xe6, 0x83, 0x02, 0x01, 0xe6, 
+  0x09, 0xc6, 0x01, 0xc6, 0x84, 0x00, 0x01, 0xa6, 0x86, 0x00, 0x1b, 0x08, 0x80, 0x42, 0x01, 0xe6, 
+  0x87, 0x00, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x42, 0x09, 0xe6, 0x01, 0x01, 0xe6, 
+  0x01, 0xc6, 0x44, 0x01, 0xe6, 0x42, 0x09, 0xe6, 0x45, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x41, 0x01, 
+  0xe6, 0x00, 0x09, 0xe6, 0x43, 0x01, 0xc6, 0x84, 0x01, 0x01, 0xc6, 0x09, 0xe6, 0x84, 0x00, 0x01, 
+  0xa5, 0x80, 0x00, 0x12, 0xc7, 0x81, 0x41, 0x01, 0xc6, 0x82, 0x00, 0x09, 0xe6, 0x82, 0x00, 0x09, 
+  0xe6, 0x87, 0x80, 0x41, 0x09, 0xe6, 0x47, 0x01, 0xe6, 0x80, 0x00, 0x12, 0xc8, 0x82, 0x00, 0x0a, 
+  0x26, 0x80, 0x00, 0x01, 0xe5, 0x82, 0x00, 0x01, 0xe5, 0x82, 0x41, 0x09, 0xe6, 0x41, 0x01, 0xe6, 
+  0x00, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x01, 0x09, 0xe7, 0x09, 0xe6, 0x84, 0x00, 0x02, 0x06, 0x81, 
+  0x41, 0x01, 0xc5, 0x82, 0x07, 0x0a, 0x46, 0x23, 0xa8, 0x23, 0xc8, 0x12, 0x86, 0x01, 0xc5, 0x01, 
+  0xc6, 0x1b, 0x08, 0x0a, 0x26, 0x80, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xc5, 0x81, 0x00, 0x01, 0xc5, 
+  0x80, 0x01, 0x09, 0xe6, 0x09, 0xe7, 0x80, 0x42, 0x01, 0xe6, 0x00, 0x09, 0xc6, 0x42, 0x01, 0xe6, 
+  0x41, 0x09, 0xe6, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x44, 0x01, 0xe6, 0x00, 0x09, 0xe7, 0x45, 0x01, 
+  0xe6, 0x41, 0x09, 0xe6, 0x4a, 0x01, 0xe6, 0x03, 0x01, 0xc6, 0x0a, 0x46, 0x1a, 0xc8, 0x0a, 0x26, 
+  0x41, 0x01, 0xc6, 0x80, 0x00, 0x12, 0xc7, 0x80, 0x00, 0x0a, 0x06, 0x80, 0x03, 0x0a, 0x67, 0x1a, 
+  0xc8, 0x01, 0xa6, 0x01, 0xe5, 0x81, 0x00, 0x01, 0xc6, 0x81, 0x00, 0x01, 0xa5, 0x82, 0x00, 0x09, 
+  0xe6, 0x80, 0x02, 0x01, 0xc5, 0x12, 0x87, 0x12, 0xe7, 0x81, 0x41, 0x09, 0xe7, 0x00, 0x09, 0xe6, 
+  0x80, 0x00, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x80, 0x00, 0x0a, 0x26, 0x41, 0x01, 0xc6, 0x01, 0x01, 
+  0xe6, 0x01, 0xc5, 0x83, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x80, 0x00, 0x12, 0xe8, 0x85, 0x00, 0x01, 
+  0xe5, 0x81, 0x00, 0x09, 0xc6, 0x83, 0x41, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x84, 
+  0x00, 0x09, 0xe6, 0x83, 0x00, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x48, 0x01, 0xe6, 0x41, 0x09, 0xe6, 
+  0x42, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x82, 0x00, 0x01, 0xe6, 0x84, 0x02, 0x09, 0xe6, 0x01, 0xa6, 
+  0x0a, 0x87, 0x81, 0x42, 0x01, 0xc6, 0x82, 0x00, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x00, 0x01, 0xe6, 
+  0x81, 0x00, 0x09, 0xe6, 0x85, 0x45, 0x01, 0xe6, 0x00, 0x09, 0xe7, 0x85, 0x00, 0x12, 0xa7, 0x8c, 
+  0x42, 0x01, 0xe6, 0x82, 0x00, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x80, 0x03, 0x01, 0xc5, 0x1b, 0x08, 
+  0x02, 0x05, 0x01, 0xa5, 0x41, 0x01, 0xc6, 0x82, 0x07, 0x01, 0xe5, 0x1b, 0x47, 0x2c, 0x09, 0x2b, 
+  0xe8, 0x23, 0x88, 0x0a, 0x25, 0x01, 0xc5, 0x1b, 0x28, 0x81, 0x41, 0x01, 0xc6, 0x02, 0x0a, 0x06, 
+  0x23, 0x88, 0x12, 0xa6, 0x81, 0x00, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x00, 0x01, 0xc6, 0x81, 0x41, 
+  0x01, 0xc6, 0x00, 0x01, 0xc5, 0x5d, 0x01, 0xc6, 0x02, 0x0a, 0x26, 0x1b, 0x08, 0x0a, 0x46, 0x41, 
+  0x01, 0xc6, 0x06, 0x01, 0xe6, 0x1a, 0xe7, 0x12, 0xa7, 0x02, 0x06, 0x01, 0xe6, 0x01, 0xc6, 0x12, 
+  0x87, 0x80, 0x01, 0x01, 0xc6, 0x01, 0xe6, 0x87, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x00, 0x01, 
+  0xc6, 0x83, 0x44, 0x09, 0xe6, 0x85, 0x02, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xc6, 0x83, 0x01, 0x01, 
+  0xc6, 0x01, 0xa6, 0x80, 0x00, 0x1a, 0xe8, 0x88, 0x41, 0x01, 0xc6, 0x81, 0x01, 0x01, 0xe5, 0x01, 
+  0xc6, 0x81, 0x41, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x80, 0x4f, 0x01, 0xc6, 0x41, 0x01, 0xc5, 0x42, 
+  0x01, 0xc6, 0x05, 0x01, 0xc5, 0x0a, 0x86, 0x23, 0x88, 0x23, 0xa9, 0x12, 0xa6, 0x01, 0xc5, 0x83, 
+  0x41, 0x01, 0xc6, 0x83, 0x00, 0x09, 0xe7, 0x80, 0x01, 0x12, 0x87, 0x12, 0xc8, 0x86, 0x46, 0x09, 
+  0xe6, 0x41, 0x09, 0xe7, 0x43, 0x0a, 0x07, 0x85, 0x00, 0x09, 0xe6, 0x95, 0x41, 0x09, 0xe7, 0x80, 
+  0x00, 0x09, 0xe7, 0x80, 0x41, 0x01, 0xc6, 0x81, 0x02, 0x0a, 0x45, 0x23, 0x48, 0x0a, 0x25, 0x85, 
+  0x05, 0x02, 0x05, 0x2b, 0xe9, 0x1b, 0x67, 0x0a, 0x65, 0x2b, 0xc8, 0x12, 0xa6, 0x83, 0x05, 0x01, 
+  0xe6, 0x01, 0xc5, 0x1a, 0xe6, 0x2c, 0x08, 0x23, 0xa8, 0x12, 0x86, 0x80, 0x02, 0x09, 0xe6, 0x01, 
+  0xc6, 0x09, 0xc6, 0x42, 0x01, 0xc6, 0x00, 0x0a, 0x06, 0x53, 0x0a, 0x26, 0x41, 0x0a, 0x46, 0x01, 
+  0x0a, 0x26, 0x0a, 0x46, 0x47, 0x0a, 0x26, 0x01, 0x1a, 0xe8, 0x0a, 0x46, 0x41, 0x01, 0xc6, 0x02, 
+  0x01, 0xe5, 0x1a, 0xe7, 0x12, 0xc7, 0x42, 0x01, 0xc6, 0x02, 0x0a, 0x66, 0x1b, 0x28, 0x12, 0x87, 
+  0x80, 0x00, 0x01, 0xe5, 0x80, 0x00, 0x0a, 0x46, 0x89, 0x00, 0x0a, 0x86, 0x83, 0x00, 0x01, 0xe6, 
+  0x43, 0x09, 0xe6, 0x00, 0x01, 0xc6, 0x83, 0x02, 0x09, 0xe6, 0x09, 0xe7, 0x01, 0xc5, 0x81, 0x00, 
+  0x01, 0xa6, 0x41, 0x01, 0xc6, 0x80, 0x03, 0x0a, 0x67, 0x12, 0xe7, 0x01, 0xc5, 0x01, 0xc6, 0x81, 
+  0x00, 0x0a, 0x26, 0x80, 0x42, 0x01, 0xe6, 0x81, 0x01, 0x02, 0x05, 0x1b, 0x08, 0x81, 0x46, 0x01, 
+  0xc6, 0x01, 0x01, 0xa6, 0x02, 0x06, 0x47, 0x0a, 0x46, 0x49, 0x0a, 0x26, 0x07, 0x0a, 0x46, 0x0a, 
+  0x26, 0x0a, 0x86, 0x23, 0xa8, 0x23, 0xa7, 0x23, 0x87, 0x23, 0xa8, 0x0a, 0x66, 0x80, 0x01, 0x0a, 
+  0x26, 0x1b, 0x48, 0x86, 0x00, 0x01, 0xc6, 0x81, 0x00, 0x12, 0xc7, 0x86, 0x00, 0x01, 0xe6, 0x82, 
+  0x41, 0x09, 0xe7, 0x82, 0x41, 0x09, 0xe7, 0x81, 0x00, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x41, 0x09, 
+  0xe6, 0x45, 0x01, 0xe6, 0x85, 0x00, 0x1b, 0x28, 0x80, 0x00, 0x01, 0xc5, 0x81, 0x00, 0x01, 0xc5, 
+  0x85, 0x00, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x00, 0x09, 0xc7, 0x42, 0x09, 0xc6, 0x06, 0x01, 0xc5, 
+  0x0a, 0x05, 0x23, 0x87, 0x2b, 0xe8, 0x23, 0x47, 0x01, 0xe5, 0x01, 0xa5, 0x83, 0x00, 0x02, 0x06, 
+  0x80, 0x01, 0x1b, 0x47, 0x12, 0xc6, 0x80, 0x00, 0x12, 0xc6, 0x81, 0x00, 0x0a, 0x46, 0x80, 0x08, 
+  0x01, 0xc5, 0x12, 0x86, 0x23, 0xa7, 0x23, 0x86, 0x2b, 0xe7, 0x2b, 0xc8, 0x0a, 0x26, 0x01, 0xe6, 
+  0x09, 0xe6, 0x41, 0x09, 0xe7, 0x80, 0x03, 0x0a, 0x06, 0x1a, 0xc8, 0x1b, 0x08, 0x1a, 0xe8, 0x41, 
+  0x1b, 0x08, 0x41, 0x1a, 0xe8, 0x49, 0x1b, 0x08, 0x42, 0x1a, 0xe8, 0x4c, 0x1b, 0x08, 0x00, 0x0a, 
+  0x26, 0x41, 0x01, 0xc6, 0x08, 0x02, 0x05, 0x1b, 0x08, 0x12, 0xa7, 0x01, 0xc6, 0x01, 0xa6, 0x01, 
+  0xa5, 0x0a, 0x46, 0x1b, 0x48, 0x0a, 0x66, 0x41, 0x01, 0xe6, 0x03, 0x02, 0x25, 0x1b, 0x28, 0x0a, 
+  0x26, 0x01, 0xc5, 0x86, 0x02, 0x01, 0xc6, 0x01, 0xa6, 0x12, 0x86, 0x86, 0x41, 0x09, 0xc6, 0x41, 
+  0x01, 0xc6, 0x01, 0x1b, 0x28, 0x0a, 0x67, 0x42, 0x02, 0x07, 0x81, 0x07, 0x0a, 0x87, 0x01, 0xc5, 
+  0x02, 0x06, 0x02, 0x07, 0x01, 0xe6, 0x12, 0x87, 0x1a, 0xc8, 0x01, 0xa5, 0x82, 0x00, 0x0a, 0x46, 
+  0x80, 0x01, 0x01, 0xe5, 0x01, 0xc6, 0x82, 0x00, 0x02, 0x06, 0x84, 0x01, 0x09, 0xc6, 0x09, 0xe6, 
+  0x41, 0x09, 0xc6, 0x03, 0x01, 0xe6, 0x0a, 0x26, 0x12, 0xa7, 0x23, 0x48, 0x43, 0x1b, 0x28, 0x4e, 
+  0x1b, 0x08, 0x05, 0x1b, 0x27, 0x2b, 0xc8, 0x1b, 0x46, 0x12, 0xe5, 0x2b, 0xc8, 0x12, 0x86, 0x80, 
+  0x01, 0x02, 0x26, 0x1b, 0x28, 0x87, 0x00, 0x01, 0xa5, 0x80, 0x00, 0x12, 0xc8, 0x87, 0x00, 0x01, 
+  0xe6, 0x84, 0x00, 0x09, 0xe6, 0x43, 0x09, 0xe7, 0x80, 0x00, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xe6, 
+  0x42, 0x09, 0xe7, 0x00, 0x09, 0xe6, 0x84, 0x01, 0x12, 0xc7, 0x12, 0x87, 0x84, 0x00, 0x01, 0xc6, 
+  0x85, 0x41, 0x01, 0xe6, 0x43, 0x09, 0xe7, 0x02, 0x09, 0xe6, 0x01, 0xc6, 0x09, 0xe6, 0x81, 0x05, 
+  0x1b, 0x26, 0x2b, 0xc7, 0x1b, 0x06, 0x23, 0x87, 0x1b, 0x06, 0x01, 0xc5, 0x83, 0x05, 0x01, 0xe5, 
+  0x1b, 0x27, 0x2b, 0xc8, 0x2b, 0xe8, 0x23, 0x88, 0x0a, 0x45, 0x84, 0x06, 0x12, 0xa6, 0x2b, 0xe7, 
+  0x1b, 0x05, 0x23, 0x66, 0x2c, 0x08, 0x0a, 0x46, 0x01, 0xc6, 0x41, 0x09, 0xe7, 0x04, 0x01, 0xc6, 
+  0x0a, 0x46, 0x1a, 0xa8, 0x0a, 0x06, 0x01, 0xc6, 0x45, 0x01, 0xe6, 0x00, 0x02, 0x06, 0x41, 0x01, 
+  0xe6, 0x00, 0x01, 0xe5, 0x49, 0x01, 0xe6, 0x00, 0x01, 0xe5, 0x4a, 0x01, 0xe6, 0x80, 0x00, 0x0a, 
+  0x46, 0x41, 0x1a, 0xe7, 0x00, 0x02, 0x06, 0x80, 0x0c, 0x01, 0xa5, 0x12, 0x66, 0x23, 0x48, 0x12, 
+  0xa6, 0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x26, 0x23, 0x28, 0x1a, 0xc7, 0x0a, 0x06, 0x01, 0xa6, 0x0a, 
+  0x46, 0x1a, 0xc8, 0x84, 0x00, 0x09, 0xe6, 0x80, 0x00, 0x12, 0x87, 0x81, 0x00, 0x01, 0xc6, 0x42, 
+  0x09, 0xe6, 0x41, 0x09, 0xc6, 0x14, 0x01, 0xc6, 0x09, 0xc6, 0x09, 0x65, 0x1a, 0x06, 0x09, 0xa5, 
+  0x09, 0x85, 0x09, 0xa5, 0x09, 0xe6, 0x01, 0xe6, 0x12, 0xa7, 0x12, 0x67, 0x01, 0x85, 0x09, 0xc6, 
+  0x09, 0xa5, 0x01, 0x85, 0x11, 0xc5, 0x1a, 0x27, 0x01, 0x85, 0x01, 0xa6, 0x01, 0xc6, 0x01, 0xa6, 
+  0x84, 0x00, 0x01, 0xe6, 0x84, 0x01, 0x09, 0xe6, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x03, 0x09, 0xe7, 
+  0x01, 0xc6, 0x0a, 0x46, 0x23, 0x89, 0x80, 0x01, 0x01, 0xc5, 0x01, 0xe5, 0x4c, 0x01, 0xe6, 0x01, 
+  0x01, 0xe5, 0x01, 0xe6, 0x42, 0x01, 0xe5, 0x01, 0x02, 0x05, 0x1b, 0x47, 0x41, 0x2b, 0xc8, 0x01, 
+  0x23, 0x67, 0x0a, 0x25, 0x80, 0x00, 0x0a, 0x26, 0x80, 0x00, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xc6, 
+  0x83, 0x00, 0x09, 0xe6, 0x8f, 0x42, 0x09, 0xe7, 0x00, 0x09, 0xe6, 0x82, 0x41, 0x09, 0xe6, 0x42, 
+  0x09, 0xe7, 0x41, 0x09, 0xe6, 0x82, 0x01, 0x09, 0xe6, 0x01, 0xc6, 0x81, 0x00, 0x01, 0xa5, 0x8a, 
+  0x41, 0x01, 0xc6, 0x00, 0x09, 0xe6, 0x80, 0x45, 0x01, 0xe6, 0x80, 0x02, 0x23, 0x66, 0x34, 0x08, 
+  0x12, 0xc5, 0x86, 0x06, 0x01, 0xa5, 0x01, 0xc5, 0x1a, 0xe7, 0x1b, 0x07, 0x0a, 0x65, 0x01, 0xa5, 
+  0x01, 0xe6, 0x82, 0x0d, 0x01, 0xc6, 0x0a, 0x25, 0x23, 0x87, 0x2c, 0x07, 0x2c, 0x08, 0x23, 0x47, 
+  0x0a, 0x06, 0x09, 0xc6, 0x09, 0xe6, 0x01, 0xc6, 0x0a, 0x26, 0x1a, 0xe8, 0x0a, 0x07, 0x01, 0xa6, 
+  0x41, 0x01, 0xc6, 0x5e, 0x01, 0xc5, 0x0e, 0x02, 0x05, 0x1b, 0x28, 0x12, 0xa7, 0x01, 0xa5, 0x01, 
+  0xc6, 0x01, 0xe5, 0x12, 0xa6, 0x23, 0x88, 0x12, 0xc7, 0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x26, 0x1b, 
+  0x28, 0x1a, 0xc7, 0x01, 0xe5, 0x41, 0x01, 0xc6, 0x01, 0x1a, 0xc7, 0x12, 0x87, 0x80, 0x00, 0x1a, 
+  0xc7, 0x81, 0x00, 0x01, 0xc6, 0x81, 0x00, 0x0a, 0x87, 0x82, 0x41, 0x01, 0xc6, 0x42, 0x09, 0xc6, 
+  0x02, 0x09, 0xa5, 0x09, 0x03, 0x00, 0x20, 0x43, 0x00, 0x00, 0x05, 0x00, 0x41, 0x01, 0x03, 0x1a, 
+  0xa8, 0x12, 0x06, 0x00, 0x61, 0x00, 0x40, 0x43, 0x00, 0x00, 0x01, 0x00, 0xc3, 0x09, 0x65, 0x41, 
+  0x01, 0xa6, 0x00, 0x0a, 0x26, 0x80, 0x41, 0x01, 0xc6, 0x80, 0x00, 0x09, 0xe6, 0x84, 0x42, 0x01, 
+  0xc6, 0x05, 0x01, 0xe6, 0x01, 0xc6, 0x02, 0x06, 0x12, 0xe7, 0x12, 0xa7, 0x02, 0x06, 0x41, 0x01, 
+  0xc6, 0x00, 0x09, 0xe6, 0x80, 0x41, 0x01, 0xc6, 0x80, 0x4d, 0x01, 0xc6, 0x04, 0x02, 0x25, 0x12, 
+  0xe7, 0x1b, 0x07, 0x0a, 0x45, 0x01, 0xc5, 0x80, 0x00, 0x02, 0x06, 0x82, 0x00, 0x01, 0xc6, 0x83, 
+  0x01, 0x01, 0xc6, 0x01, 0xa6, 0x80, 0x00, 0x12, 0xc7, 0x87, 0x01, 0x01, 0xc6, 0x01, 0xe6, 0x43, 
+  0x09, 0xe6, 0x85, 0x87, 0x43, 0x01, 0xc6, 0x83, 0x00, 0x0a, 0x46, 0x88, 0x00, 0x01, 0xe6, 0x81, 
+  0x41, 0x09, 0xe6, 0x00, 0x09, 0xc6, 0x80, 0x00, 0x09, 0xe6, 0x81, 0x05, 0x01, 0xc6, 0x12, 0xa6, 
+  0x2c, 0x08, 0x34, 0x48, 0x2b, 0xc8, 0x0a, 0x65, 0x84, 0x01, 0x01, 0xa6, 0x01, 0xc6, 0x41, 0x01, 
+  0xc5, 0x02, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xc6, 0x83, 0x01, 0x01, 0xc5, 0x0a, 0x45, 0x41, 0x12, 
+  0xe6, 0x01, 0x0a, 0x05, 0x01, 0xa6, 0x41, 0x01, 0xc6, 0x07, 0x0a, 0x26, 0x1a, 0xe8, 0x0a, 0x47, 
+  0x01, 0xa6, 0x09, 0xc6, 0x01, 0xe6, 0x12, 0xc7, 0x1a, 0xe8, 0x41, 0x1a, 0xc8, 0x54, 0x1a, 0xe8, 
+  0x43, 0x12, 0xe8, 0x41, 0x1a, 0xe8, 0x10, 0x1a, 0xe7, 0x1b, 0x08, 0x1b, 0x07, 0x01, 0xe6, 0x09, 
+  0xc6, 0x01, 0xc5, 0x12, 0xc6, 0x1b, 0x48, 0x12, 0xa7, 0x01, 0xe6, 0x01, 0xc5, 0x0a, 0x25, 0x1b, 
+  0x07, 0x12, 0xa7, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0xc5, 0x41, 0x12, 0xa7, 0x00, 0x01, 0xe6, 0x80, 
+  0x00, 0x12, 0xc7, 0x81, 0x01, 0x01, 0xe6, 0x09, 0xc6, 0x82, 0x00, 0x01, 0xa5, 0x82, 0x00, 0x09, 
+  0xe6, 0x80, 0x15, 0x09, 0xe6, 0x09, 0x44, 0x00, 0x20, 0x10, 0xc2, 0x21, 0x83, 0x3a, 0x65, 0x42, 
+  0xa5, 0x32, 0x65, 0x19, 0x63, 0x00, 0x20, 0x09, 0x63, 0x00, 0xe1, 0x10, 0xe1, 0x32, 0x64, 0x43, 
+  0x05, 0x43, 0x25, 0x2a, 0x04, 0x19, 0x02, 0x00, 0x20, 0x00, 0x82, 0x09, 0xa5, 0x01, 0xc6, 0x81, 
+  0x00, 0x01, 0xc5, 0x81, 0x00, 0x01, 0xe6, 0x86, 0x05, 0x09, 0xc6, 0x01, 0xc6, 0x01, 0xe5, 0x12, 
+  0xc7, 0x0a, 0x66, 0x01, 0xc5, 0x42, 0x01, 0xc6, 0x02, 0x09, 0xe7, 0x09, 0xe6, 0x01, 0xe6, 0x42, 
+  0x09, 0xe6, 0x80, 0x04, 0x09, 0xc6, 0x09, 0xe6, 0x09, 0xc6, 0x01, 0xe6, 0x09, 0xc6, 0x80, 0x43, 
+  0x01, 0xe6, 0x81, 0x00, 0x01, 0xe6, 0x41, 0x01, 0xe5, 0x42, 0x01, 0xc6, 0x8b, 0x00, 0x12, 0xc8, 
+  0x80, 0x00, 0x01, 0xe6, 0x84, 0x01, 0x09, 0xe6, 0x01, 0xe6, 0x42, 0x09, 0xe6, 0x45, 0x09, 0xe7, 
+  0x41, 0x0a, 0x07, 0x42, 0x09, 0xe6, 0x42, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x85, 0x00, 0x01, 0xc5, 
+  0x8a, 0x45, 0x01, 0xc6, 0x80, 0x43, 0x01, 0xc6, 0x04, 0x01, 0xe5, 0x12, 0xa6, 0x13, 0x06, 0x12, 
+  0xa6, 0x01, 0xc5, 0x41, 0x01, 0xc6, 0x81, 0x00, 0x0a, 0x47, 0x81, 0x42, 0x01, 0xc6, 0x81, 0x00, 
+  0x1b, 0x08, 0x82, 0x42, 0x01, 0xc6, 0x00, 0x01, 0xc5, 0x42, 0x01, 0xc6, 0x05, 0x0a, 0x06, 0x1a, 
+  0xc8, 0x0a, 0x07, 0x01, 0xa6, 0x01, 0xc6, 0x01, 0xe6, 0x41, 0x12, 0xa7, 0x4f, 0x12, 0x87, 0x00, 
+  0x0a, 0x87, 0x41, 0x12, 0x87, 0x00, 0x0a, 0x87, 0x43, 0x12, 0x87, 0x02, 0x0a, 0x87, 0x12, 0x87, 
+  0x0a, 0x87, 0x44, 0x12, 0x87, 0x0b, 0x0a, 0x26, 0x01, 0xc6, 0x01, 0xc5, 0x12, 0x86, 0x23, 0x68, 
+  0x0a, 0x86, 0x01, 0xa5, 0x01, 0xc6, 0x02, 0x25, 0x1a, 0xe7, 0x12, 0xc7, 0x01, 0xe5, 0x41, 0x01, 
+  0xe6, 0x04, 0x12, 0x66, 0x12, 0x67, 0x01, 0xc5, 0x01, 0xc6, 0x01, 0xc5, 0x83, 0x01, 0x09, 0xe6, 
+  0x01, 0xc6, 0x81, 0x00, 0x01, 0xc5, 0x82, 0x17, 0x09, 0xc6, 0x01, 0xe6, 0x02, 0x06, 0x09, 0x64, 
+  0x00, 0x00, 0x53, 0x88, 0x75, 0x09, 0x6c, 0xa7, 0x75, 0x09, 0x7d, 0x69, 0x75, 0x09, 0x42, 0xe6, 
+  0x00, 0x60, 0x19, 0x62, 0x7d, 0x29, 0x8d, 0xe9, 0x8d, 0xc9, 0x7d, 0x68, 0x7d, 0x48, 0x74, 0xca, 
+  0x19, 0x02, 0x00, 0x20, 0x09, 0x85, 0x01, 0xa6, 0x8c, 0x04, 0x01, 0xc6, 0x01, 0xe5, 0x12, 0xc7, 
+  0x12, 0x87, 0x01, 0xc5, 0x43, 0x01, 0xc6, 0x01, 0x09, 0xc7, 0x09, 0xc6, 0x42, 0x01, 0xe6, 0x41, 
+  0x01, 0xc6, 0x00, 0x01, 0xe6, 0x80, 0x00, 0x01, 0xc6, 0x80, 0x01, 0x09, 0xe6, 0x01, 0xe6, 0x41, 
+  0x09, 0xe6, 0x80, 0x42, 0x01, 0xc6, 0x80, 0x44, 0x01, 0xc6, 0x87, 0x01, 0x01, 0xc5, 0x09, 0xe6, 
+  0x83, 0x42, 0x01, 0xc6, 0x83, 0x43, 0x09, 0xe6, 0x46, 0x09, 0xe7, 0x80, 0x01, 0x01, 0xe6, 0x01, 
+  0xc6, 0x41, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x45, 0x01, 0xc6, 0x00, 0x01, 0xa5, 0x80, 0x00, 0x12, 
+  0xa7, 0x81, 0x00, 0x0a, 0x26, 0x81, 0x00, 0x01, 0xc5, 0x83, 0x00, 0x1a, 0xe7, 0x41, 0x02, 0x06, 
+  0x41, 0x02, 0x05, 0x00, 0x01, 0xe5, 0x41, 0x01, 0xe6, 0x41, 0x09, 0xc6, 0x82, 0x02, 0x09, 0xc6, 
+  0x01, 0xe6, 0x01, 0xe5, 0x41, 0x01, 0xe6, 0x86, 0x42, 0x01, 0xe6, 0x04, 0x01, 0xc6, 0x0a, 0x46, 
+  0x1b, 0x27, 0x0a, 0x86, 0x01, 0xe6, 0x80, 0x41, 0x01, 0xe6, 0x01, 0x09, 0xe6, 0x01, 0xe6, 0x81, 
+  0x06, 0x0a, 0x06, 0x1a, 0xe8, 0x0a, 0x47, 0x01, 0xc6, 0x09, 0xe6, 0x02, 0x06, 0x1a, 0xe8, 0x80, 
+  0x02, 0x01, 0xe6, 0x01, 0xa6, 0x01, 0xc6, 0x44, 0x01, 0xc5, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xa5, 
+  0x00, 0x01, 0xa6, 0x4c, 0x01, 0xa5, 0x41, 0x01, 0xa6, 0x41, 0x01, 0xa5, 0x01, 0x01, 0xa6, 0x01, 
+  0xa5, 0x41, 0x01, 0xc5, 0x0e, 0x01, 0xc6, 0x01, 0xc5, 0x0a, 0x66, 0x1b, 0x48, 0x0a, 0x86, 0x01, 
+  0xe6, 0x01, 0xc6, 0x0a, 0x06, 0x12, 0xa7, 0x0a, 0x66, 0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x05, 0x1a, 
+  0xc7, 0x0a, 0x46, 0x41, 0x01, 0xc6, 0x01, 0x09, 0xe6, 0x01, 0xc6, 0x80, 0x00, 0x12, 0x67, 0x80, 
+  0x41, 0x09, 0xe6, 0x01, 0x01, 0xa5, 0x0a, 0x86, 0x82, 0x00, 0x09, 0xc6, 0x41, 0x01, 0xc6, 0x15, 
+  0x0a, 0x26, 0x13, 0x08, 0x09, 0xe4, 0x00, 0x20, 0x53, 0x67, 0x75, 0x07, 0x64, 0x46, 0x43, 0x25, 
+  0x53, 0xa6, 0x75, 0x07, 0x74, 0xe9, 0x00, 0xa1, 0x53, 0xc7, 0x96, 0x4a, 0x75, 0x07, 0x53, 0xa6, 
+  0x64, 0x66, 0x6c, 0xe6, 0x75, 0x09, 0x10, 0xe1, 0x00, 0x61, 0x09, 0xa6, 0x8d, 0x03, 0x01, 0xe6, 
+  0x12, 0xc7, 0x12, 0x87, 0x01, 0xc5, 0x42, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x80, 0x41, 0x09, 0xe6, 
+  0x83, 0x00, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x44, 0x01, 0xe6, 0x84, 0x00, 0x01, 0xc6, 0x42, 0x01, 
+  0xe6, 0x81, 0x00, 0x02, 0x26, 0x82, 0x00, 0x09, 0xe7, 0x82, 0x01, 0x01, 0xa5, 0x01, 0xe6, 0x81, 
+  0x00, 0x1a, 0xc8, 0x80, 0x00, 0x09, 0xc6, 0x81, 0x00, 0x0a, 0x46, 0x81, 0x00, 0x09, 0xc6, 0x82, 
+  0x00, 0x01, 0xe6, 0x87, 0x00, 0x0a, 0x26, 0x42, 0x0a, 0x25, 0x41, 0x0a, 0x26, 0x43, 0x0a, 0x25, 
+  0x01, 0x0a, 0x26, 0x02, 0x05, 0x80, 0x03, 0x12, 0x87, 0x01, 0xc6, 0x01, 0xe6, 0x0a, 0x47, 0x84, 
+  0x01, 0x01, 0xa5, 0x0a, 0x26, 0x41, 0x1b, 0x48, 0x04, 0x0a, 0xa6, 0x1b, 0x48, 0x1b, 0x68, 0x12, 
+  0xe7, 0x01, 0xe5, 0x41, 0x01, 0xc6, 0x84, 0x43, 0x09, 0xe6, 0x00, 0x09, 0xc6, 0x81, 0x00, 0x1a, 
+  0xe8, 0x81, 0x41, 0x09, 0xe6, 0x81, 0x04, 0x01, 0xe5, 0x1b, 0x06, 0x23, 0xa7, 0x23, 0x67, 0x0a, 
+  0x06, 0x81, 0x01, 0x09, 0xe7, 0x09, 0xc6, 0x41, 0x01, 0xc6, 0x08, 0x0a, 0x06, 0x1a, 0xa8, 0x0a, 
+  0x27, 0x01, 0xc6, 0x09, 0xe6, 0x02, 0x06, 0x1a, 0xe8, 0x12, 0xc7, 0x02, 0x26, 0x80, 0x44, 0x02, 
+  0x06, 0x00, 0x02, 0x26, 0x41, 0x02, 0x06, 0x00, 0x02, 0x26, 0x45, 0x02, 0x06, 0x41, 0x02, 0x26, 
+  0x41, 0x02, 0x06, 0x00, 0x02, 0x26, 0x43, 0x02, 0x06, 0x00, 0x0a, 0x26, 0x42, 0x02, 0x26, 0x42, 
+  0x02, 0x06, 0x04, 0x02, 0x26, 0x02, 0x05, 0x0a, 0x86, 0x23, 0x48, 0x0a, 0x66, 0x41, 0x01, 0xc6, 
+  0x02, 0x0a, 0x46, 0x23, 0x28, 0x0a, 0x67, 0x41, 0x01, 0xc6, 0x04, 0x01, 0xc5, 0x1a, 0xe7, 0x12, 
+  0x67, 0x01, 0xc5, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x80, 0x01, 0x1a, 0xc7, 0x12, 0x87, 0x83, 0x01, 
+  0x0a, 0x87, 0x12, 0xc7, 0x81, 0x41, 0x01, 0xe6, 0x17, 0x02, 0x06, 0x23, 0x69, 0x23, 0x68, 0x23, 
+  0x28, 0x00, 0x81, 0x32, 0x24, 0x75, 0x08, 0x6c, 0xc6, 0x64, 0xa6, 0x3a, 0xc5, 0x4b, 0x46, 0x53, 
+  0x87, 0x00, 0x20, 0x43, 0x05, 0x64, 0x27, 0x4b, 0x45, 0x74, 0xc7, 0x74, 0xe6, 0x7d, 0x47, 0x64, 
+  0x07, 0x00, 0x60, 0x09, 0x23, 0x09, 0xe6, 0x01, 0xc6, 0x80, 0x01, 0x1b, 0x28, 0x01, 0xe5, 0x81, 
+  0x41, 0x01, 0xc6, 0x85, 0x01, 0x12, 0x87, 0x0a, 0x66, 0x41, 0x01, 0xe6, 0x80, 0x43, 0x01, 0xe6, 
+  0x01, 0x01, 0xc6, 0x09, 0xc6, 0x46, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x47, 0x01, 0xe6, 0x46, 0x01, 
+  0xc6, 0x00, 0x0a, 0x06, 0x81, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x82, 0x01, 0x01, 0xa6, 0x01, 0xc6, 
+  0x83, 0x01, 0x01, 0xc6, 0x01, 0xe6, 0x83, 0x42, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x80, 0x00, 0x09, 
+  0xe6, 0x81, 0x00, 0x0a, 0x07, 0x80, 0x41, 0x0a, 0x07, 0x41, 0x23, 0x28, 0x41, 0x1b, 0x48, 0x41, 
+  0x23, 0x48, 0x41, 0x1b, 0x48, 0x41, 0x23, 0x28, 0x05, 0x1b, 0x28, 0x23, 0x48, 0x12, 0xa7, 0x01, 
+  0xe6, 0x09, 0xe6, 0x01, 0xe7, 0x85, 0x08, 0x01, 0xa6, 0x01, 0xc6, 0x02, 0x06, 0x23, 0xa9, 0x1b, 
+  0x28, 0x02, 0x05, 0x13, 0x27, 0x2b, 0xe9, 0x0a, 0x86, 0x42, 0x01, 0xc6, 0x42, 0x09, 0xc6, 0x01, 
+  0x09, 0xe6, 0x09, 0xc6, 0x43, 0x09, 0xe6, 0x03, 0x09, 0xc6, 0x01, 0xa5, 0x1a, 0xe7, 0x0a, 0x46, 
+  0x80, 0x41, 0x01, 0xe6, 0x04, 0x09, 0xe6, 0x01, 0xc6, 0x12, 0xc6, 0x1b, 0x67, 0x1b, 0x66, 0x80, 
+  0x01, 0x12, 0xe6, 0x01, 0xe5, 0x80, 0x00, 0x09, 0xe6, 0x81, 0x0b, 0x0a, 0x06, 0x1a, 0xa8, 0x0a, 
+  0x07, 0x01, 0xc6, 0x01, 0xc7, 0x0a, 0x26, 0x1b, 0x08, 0x12, 0xc7, 0x02, 0x26, 0x02, 0x06, 0x0a, 
+  0x45, 0x1b, 0x28, 0x41, 0x1b, 0x08, 0x00, 0x1b, 0x28, 0x44, 0x1b, 0x29, 0x00, 0x23, 0x29, 0x43, 
+  0x1b, 0x29, 0x49, 0x1b, 0x28, 0x01, 0x1b, 0x29, 0x23, 0x29, 0x41, 0x1b, 0x29, 0x41, 0x1b, 0x28, 
+  0x41, 0x1b, 0x29, 0x10, 0x1b, 0x28, 0x1b, 0x48, 0x12, 0xa7, 0x02, 0x06, 0x01, 0xc5, 0x0a, 0x46, 
+  0x1b, 0x28, 0x0a, 0x66, 0x01, 0xe6, 0x01, 0xa6, 0x01, 0xe5, 0x12, 0x87, 0x12, 0x67, 0x01, 0xe6, 
+  0x01, 0xc6, 0x09, 0xc6, 0x01, 0xc6, 0x80, 0x01, 0x01, 0xc5, 0x12, 0xc7, 0x81, 0x00, 0x01, 0xe6, 
+  0x80, 0x00, 0x01, 0xa6, 0x80, 0x01, 0x12, 0xe7, 0x01, 0xa5, 0x80, 0x00, 0x09, 0xc6, 0x80, 0x0b, 
+  0x12, 0xc7, 0x23, 0xa9, 0x0a, 0x46, 0x12, 0x66, 0x00, 0xe2, 0x00, 0x20, 0x53, 0x87, 0x85, 0x69, 
+  0x75, 0x46, 0x7d, 0x88, 0x4b, 0x47, 0x00, 0x00, 0x41, 0x00, 0x20, 0x07, 0x3a, 0x85, 0x8d, 0xca, 
+  0x85, 0xa7, 0x85, 0xa8, 0x74, 0xc8, 0x11, 0x01, 0x00, 0x40, 0x09, 0x85, 0x8e, 0x01, 0x1a, 0xc8, 
+  0x0a, 0x46, 0x41, 0x01, 0xc6, 0x03, 0x01, 0xe6, 0x12, 0xa7, 0x12, 0x87, 0x01, 0xc5, 0x41, 0x01, 
+  0xc6, 0x41, 0x09, 0xe6, 0x4b, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x88, 0x02, 0x02, 0x26, 0x1b, 0x48, 
+  0x01, 0xe5, 0x41, 0x01, 0xc6, 0x82, 0x01, 0x01, 0xc6, 0x09, 0xc7, 0x81, 0x01, 0x12, 0xc8, 0x01, 
+  0xa5, 0x84, 0x00, 0x01, 0xc6, 0x44, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x43, 0x09, 0xe7, 0x81, 0x45, 
+  0x01, 0xe6, 0x00, 0x02, 0x06, 0x44, 0x01, 0xe6, 0x00, 0x02, 0x06, 0x41, 0x09, 0xe6, 0x80, 0x00, 
+  0x0a, 0x46, 0x84, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x04, 0x1b, 0x68, 0x23, 0x68, 0x02, 0x25, 
+  0x1b, 0x67, 0x2c, 0x09, 0x80, 0x00, 0x01, 0xc5, 0x81, 0x41, 0x09, 0xe6, 0x00, 0x09, 0xe7, 0x42, 
+  0x09, 0xe6, 0x41, 0x09, 0xe7, 0x80, 0x05, 0x01, 0xc5, 0x02, 0x05, 0x1b, 0x07, 0x12, 0xc6, 0x01, 
+  0xc5, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x01, 0x01, 0xc5, 0x12, 0xe6, 0x80, 0x02, 0x0a, 0xa5, 0x13, 
+  0x06, 0x1b, 0x06, 0x80, 0x06, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0xc6, 0x0a, 0x26, 0x1a, 0xc8, 0x0a, 
+  0x07, 0x01, 0xa6, 0x80, 0x00, 0x02, 0x06, 0x41, 0x1a, 0xe8, 0x06, 0x02, 0x26, 0x01, 0xe6, 0x0a, 
+  0x45, 0x1b, 0x28, 0x12, 0xc7, 0x01, 0xe5, 0x01, 0xe6, 0x45, 0x01, 0xc5, 0x00, 0x01, 0xe5, 0x41, 
+  0x01, 0xc5, 0x48, 0x01, 0xe5, 0x42, 0x01, 0xc5, 0x4a, 0x01, 0xe5, 0x06, 0x01, 0xc5, 0x0a, 0x26, 
+  0x1b, 0x08, 0x0a, 0x87, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0xe5, 0x41, 0x12, 0xc7, 0x41, 0x01, 0xc6, 
+  0x01, 0x09, 0xc6, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x02, 0x0a, 0x26, 0x1b, 0x08, 0x0a, 0x67, 0x80, 
+  0x41, 0x09, 0xe6, 0x84, 0x00, 0x01, 0xc6, 0x80, 0x04, 0x12, 0xc8, 0x1b, 0x69, 0x02, 0x05, 0x0a, 
+  0x66, 0x09, 0xc4, 0x41, 0x00, 0x40, 0x03, 0x3a, 0x65, 0x64, 0x08, 0x63, 0xe8, 0x19, 0x22, 0x80, 
+  0x09, 0x08, 0x20, 0x08, 0x00, 0x10, 0xc1, 0x5b, 0xa7, 0x7c, 0xa8, 0x63, 0xe7, 0x19, 0x42, 0x00, 
+  0x40, 0x09, 0x23, 0x09, 0xc6, 0x41, 0x01, 0xc6, 0x00, 0x0a, 0x46, 0x85, 0x00, 0x02, 0x05, 0x83, 
+  0x02, 0x01, 0xc5, 0x1b, 0x08, 0x0a, 0x87, 0x80, 0x05, 0x02, 0x06, 0x0a, 0x87, 0x1b, 0x48, 0x1b, 
+  0x27, 0x0a, 0x66, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x81, 0x00, 0x01, 0xc6, 0x84, 0x00, 0x09, 0xe6, 
+  0x44, 0x01, 0xe6, 0x47, 0x01, 0xc6, 0x81, 0x02, 0x01, 0xe6, 0x09, 0xe6, 0x09, 0xc6, 0x82, 0x02, 
+  0x01, 0xa6, 0x09, 0xc6, 0x01, 0xa5, 0x81, 0x00, 0x01, 0xc5, 0x42, 0x01, 0xc6, 0x80, 0x02, 0x1b, 
+  0x28, 0x01, 0xe6, 0x01, 0xc6, 0x81, 0x43, 0x09, 0xe6, 0x81, 0x43, 0x0a, 0x07, 0x01, 0x01, 0xc6, 
+  0x09, 0xc6, 0x43, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x44, 0x01, 0xc6, 0x42, 0x09, 0xe6, 0x00, 0x01, 
+  0xe6, 0x84, 0x00, 0x12, 0xa7, 0x80, 0x02, 0x09, 0xe6, 0x01, 0xc6, 0x0a, 0x26, 0x80, 0x03, 0x23, 
+  0xe8, 0x2c, 0x48, 0x23, 0xe8, 0x0a, 0x45, 0x82, 0x00, 0x01, 0xe6, 0x81, 0x42, 0x01, 0xe6, 0x00, 
+  0x09, 0xe6, 0x41, 0x01, 0xe6, 0x05, 0x0a, 0x25, 0x1b, 0x47, 0x2b, 0xe7, 0x23, 0xc7, 0x12, 0xa6, 
+  0x01, 0xe5, 0x81, 0x05, 0x01, 0xe5, 0x12, 0xa6, 0x1b, 0x47, 0x1b, 0x26, 0x1b, 0x06, 0x12, 0xa6, 
+  0x81, 0x08, 0x01, 0xa6, 0x0a, 0x46, 0x1a, 0xe8, 0x0a, 0x27, 0x09, 0xc6, 0x09, 0xe6, 0x0a, 0x26, 
+  0x1b, 0x08, 0x12, 0xa7, 0x41, 0x02, 0x06, 0x04, 0x0a, 0x45, 0x23, 0x48, 0x1b, 0x07, 0x01, 0xe6, 
+  0x01, 0xc6, 0x80, 0x00, 0x0a, 0x46, 0x42, 0x12, 0x67, 0x01, 0x0a, 0x87, 0x12, 0x87, 0x41, 0x0a, 
+  0x87, 0x43, 0x12, 0x87, 0x00, 0x0a, 0x87, 0x4f, 0x12, 0x87, 0x41, 0x12, 0xa7, 0x03, 0x12, 0x87, 
+  0x12, 0x86, 0x23, 0x69, 0x12, 0xa7, 0x41, 0x01, 0xc6, 0x03, 0x0a, 0x05, 0x12, 0xe7, 0x12, 0xa7, 
+  0x0a, 0x06, 0x41, 0x09, 0xc6, 0x41, 0x09, 0xe6, 0x05, 0x01, 0xc5, 0x0a, 0x46, 0x23, 0x28, 0x0a, 
+  0x86, 0x01, 0xc6, 0x09, 0xe7, 0x80, 0x01, 0x09, 0xe7, 0x01, 0xa5, 0x81, 0x00, 0x01, 0xc5, 0x80, 
+  0x41, 0x01, 0xe6, 0x14, 0x0a, 0x26, 0x23, 0x89, 0x13, 0x27, 0x23, 0xa9, 0x1b, 0x47, 0x08, 0xe2, 
+  0x00, 0x00, 0x20, 0x00, 0x58, 0xc4, 0x38, 0x83, 0x28, 0x41, 0x81, 0x07, 0x91, 0x07, 0x89, 0x27, 
+  0x40, 0x63, 0x30, 0x41, 0x79, 0x26, 0x38, 0x41, 0x08, 0x00, 0x00, 0x61, 0x11, 0x85, 0x42, 0x01, 
+  0xc6, 0x80, 0x01, 0x1b, 0x08, 0x01, 0xc5, 0x83, 0x00, 0x02, 0x06, 0x81, 0x00, 0x01, 0xc5, 0x81, 
+  0x00, 0x1b, 0x28, 0x81, 0x00, 0x0a, 0x46, 0x43, 0x1b, 0x47, 0x00, 0x12, 0x67, 0x84, 0x48, 0x01, 
+  0xe6, 0x00, 0x09, 0xe6, 0x87, 0x00, 0x01, 0xe6, 0x83, 0x41, 0x01, 0xc6, 0x82, 0x02, 0x01, 0xa5, 
+  0x01, 0xe6, 0x01, 0xc5, 0x80, 0x00, 0x1a, 0xc8, 0x85, 0x41, 0x01, 0xc6, 0x80, 0x00, 0x01, 0xc6, 
+  0x81, 0x00, 0x09, 0xc7, 0x41, 0x09, 0xe6, 0x42, 0x09, 0xe7, 0x81, 0x45, 0x01, 0xa5, 0x42, 0x01, 
+  0xc5, 0x00, 0x01, 0xa5, 0x45, 0x01, 0xc5, 0x00, 0x02, 0x46, 0x82, 0x00, 0x12, 0xe7, 0x82, 0x06, 
+  0x01, 0xe6, 0x01, 0xe5, 0x0a, 0x26, 0x1b, 0x07, 0x1b, 0x27, 0x0a, 0x86, 0x01, 0xc5, 0x41, 0x01, 
+  0xc6, 0x41, 0x09, 0xe6, 0x44, 0x09, 0xe7, 0x80, 0x08, 0x09, 0xe7, 0x01, 0xc6, 0x12, 0xc7, 0x2b, 
+  0xe8, 0x13, 0x05, 0x1b, 0x66, 0x2b, 0xc8, 0x0a, 0x25, 0x01, 0xc5, 0x41, 0x01, 0xe6, 0x0a, 0x02, 
+  0x05, 0x12, 0x86, 0x23, 0x48, 0x12, 0xa6, 0x01, 0xc5, 0x01, 0xc6, 0x01, 0xa5, 0x0a, 0x06, 0x1a, 
+  0xe8, 0x0a, 0x27, 0x01, 0xa6, 0x80, 0x0c, 0x02, 0x06, 0x1a, 0xe8, 0x12, 0xc8, 0x02, 0x06, 0x01, 
+  0xe6, 0x0a, 0x45, 0x1b, 0x68, 0x1a, 0xe7, 0x02, 0x05, 0x01, 0xc6, 0x01, 0xe6, 0x0a, 0x66, 0x12, 
+  0xc7, 0x42, 0x12, 0xa7, 0x41, 0x12, 0xc8, 0x01, 0x12, 0xc7, 0x12, 0xa7, 0x4b, 0x12, 0xc7, 0x01, 
+  0x12, 0xa7, 0x12, 0xc7, 0x41, 0x12, 0xc8, 0x02, 0x12, 0xc7, 0x12, 0xc8, 0x1a, 0xc8, 0x41, 0x12, 
+  0xc8, 0x41, 0x12, 0xc7, 0x42, 0x12, 0xc8, 0x00, 0x0a, 0x06, 0x80, 0x04, 0x01, 0xe5, 0x12, 0xc7, 
+  0x12, 0xa7, 0x01, 0xe6, 0x09, 0xe6, 0x80, 0x06, 0x01, 0xc6, 0x01, 0xe7, 0x01, 0xe6, 0x0a, 0x46, 
+  0x1b, 0x08, 0x0a, 0x66, 0x01, 0xe5, 0x41, 0x09, 0xe7, 0x80, 0x00, 0x01, 0xc6, 0x82, 0x00, 0x01, 
+  0xa5, 0x82, 0x14, 0x01, 0xe6, 0x12, 0xc7, 0x1b, 0x08, 0x1b, 0x07, 0x09, 0xa3, 0x00, 0x00, 0x30, 
+  0x42, 0xb1, 0x69, 0xc1, 0xab, 0x40, 0x62, 0x48, 0xc4, 0xd1, 0xab, 0xd1, 0x2a, 0xd1, 0x4a, 0xa9, 
+  0x89, 0x48, 0x62, 0xa9, 0x68, 0xc1, 0xaa, 0x50, 0xa4, 0x00, 0x00, 0x00, 0xa2, 0x90, 0x00, 0x0a, 
+  0x86, 0x80, 0x01, 0x0a, 0x26, 0x12, 0xc7, 0x41, 0x1b, 0x07, 0x01, 0x12, 0xc7, 0x0a, 0x06, 0x81, 
+  0x01, 0x01, 0xe6, 0x01, 0xc6, 0x80, 0x00, 0x01, 0xc6, 0x82, 0x00, 0x09, 0xe6, 0x46, 0x01, 0xe6, 
+  0x41, 0x01, 0xe7, 0x00, 0x09, 0xe7, 0x43, 0x01, 0xe6, 0x81, 0x01, 0x23, 0x28, 0x02, 0x06, 0x85, 
+  0x01, 0x09, 0xe6, 0x01, 0xa5, 0x80, 0x00, 0x1a, 0xe8, 0x80, 0x41, 0x01, 0xe6, 0x82, 0x00, 0x01, 
+  0xc5, 0x41, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xc7, 0x45, 0x09, 0xe7, 0x81, 0x4f, 
+  0x12, 0xc7, 0x04, 0x1a, 0xe8, 0x0a, 0x66, 0x01, 0xe6, 0x01, 0xc6, 0x12, 0xe8, 0x81, 0x00, 0x09, 
+  0xe7, 0x80, 0x00, 0x09, 0xe6, 0x45, 0x01, 0xc6, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x46, 0x09, 0xe6, 
+  0x81, 0x05, 0x1a, 0xe7, 0x2c, 0x08, 0x1b, 0x25, 0x23, 0x86, 0x23, 0xc8, 0x02, 0x25, 0x80, 0x00, 
+  0x09, 0xe6, 0x42, 0x01, 0xe6, 0x10, 0x01, 0xe5, 0x01, 0xc5, 0x01, 0xc6, 0x01, 0xa5, 0x0a, 0x06, 
+  0x1a, 0xc8, 0x0a, 0x67, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0xe6, 0x1a, 0xe8, 0x12, 0xc8, 0x02, 0x06, 
+  0x01, 0xe6, 0x0a, 0x45, 0x1b, 0x47, 0x12, 0xc6, 0x41, 0x01, 0xe6, 0x04, 0x02, 0x06, 0x12, 0xc7, 
+  0x1b, 0x08, 0x0a, 0x26, 0x01, 0xa5, 0x41, 0x01, 0xc5, 0x41, 0x01, 0xa5, 0x47, 0x01, 0xc5, 0x42, 
+  0x01, 0xa5, 0x42, 0x01, 0xc5, 0x00, 0x01, 0xa5, 0x41, 0x01, 0xc5, 0x41, 0x01, 0xa5, 0x49, 0x01, 
+  0xc5, 0x03, 0x01, 0xe5, 0x1a, 0xc8, 0x12, 0xa7, 0x01, 0xc6, 0x41, 0x09, 0xe6, 0x00, 0x01, 0xe6, 
+  0x41, 0x01, 0xc6, 0x05, 0x02, 0x25, 0x1b, 0x08, 0x0a, 0x66, 0x01, 0xe5, 0x09, 0xe6, 0x01, 0xe6, 
+  0x41, 0x09, 0xe6, 0x00, 0x09, 0xc6, 0x80, 0x01, 0x12, 0x87, 0x12, 0xc7, 0x80, 0x03, 0x09, 0xe6, 
+  0x01, 0xc6, 0x09, 0xe6, 0x01, 0xc6, 0x41, 0x01, 0xc5, 0x01, 0x09, 0xe6, 0x01, 0x02, 0x80, 0x02, 
+  0x91, 0x48, 0xa9, 0x49, 0x50, 0x62, 0x41, 0x20, 0x00, 0x0b, 0x60, 0x83, 0x89, 0x06, 0x81, 0x06, 
+  0x58, 0x83, 0x28, 0x20, 0x28, 0x21, 0x81, 0x07, 0x99, 0xa9, 0x10, 0x20, 0x00, 0x41, 0x09, 0xc5, 
+  0x01, 0xe6, 0x85, 0x00, 0x01, 0xe6, 0x80, 0x00, 0x02, 0x05, 0x80, 0x00, 0x02, 0x05, 0x85, 0x04, 
+  0x01, 0xe6, 0x02, 0x06, 0x12, 0xa7, 0x12, 0xe7, 0x01, 0xe6, 0x43, 0x01, 0xc6, 0x41, 0x01, 0xe6, 
+  0x41, 0x01, 0xc6, 0x00, 0x09, 0xe6, 0x44, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x80, 0x00, 0x09, 0xe6, 
+  0x42, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x85, 0x01, 0x1b, 0x28, 0x01, 0xe6, 0x85, 0x00, 0x09, 0xe7, 
+  0x84, 0x41, 0x01, 0xc6, 0x00, 0x0a, 0x26, 0x83, 0x41, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x00, 0x09, 
+  0xe6, 0x82, 0x01, 0x0a, 0x07, 0x09, 0xe7, 0x80, 0x46, 0x12, 0x87, 0x42, 0x0a, 0x87, 0x00, 0x0a, 
+  0x86, 0x41, 0x12, 0x86, 0x05, 0x12, 0x87, 0x0a, 0x87, 0x12, 0x87, 0x12, 0x67, 0x01, 0xc5, 0x09, 
+  0xe6, 0x80, 0x00, 0x1a, 0xe8, 0x83, 0x41, 0x01, 0xe6, 0x00, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x80, 
+  0x46, 0x09, 0xe6, 0x00, 0x01, 0xe6, 0x80, 0x00, 0x01, 0xe6, 0x80, 0x06, 0x09, 0xc6, 0x0a, 0x26, 
+  0x1b, 0x47, 0x2c, 0x08, 0x2b, 0xe8, 0x12, 0xa6, 0x02, 0x06, 0x43, 0x01, 0xe6, 0x02, 0x09, 0xe6, 
+  0x01, 0xc6, 0x09, 0xe6, 0x80, 0x02, 0x09, 0xe6, 0x12, 0xa7, 0x0a, 0x46, 0x41, 0x09, 0xc7, 0x08, 
+  0x02, 0x06, 0x1a, 0xe8, 0x12, 0xc8, 0x02, 0x06, 0x01, 0xc6, 0x0a, 0x46, 0x1b, 0x27, 0x12, 0xc7, 
+  0x02, 0x05, 0x80, 0x07, 0x0a, 0x26, 0x1b, 0x07, 0x1b, 0x48, 0x0a, 0x67, 0x01, 0xe6, 0x09, 0xc6, 
+  0x01, 0xe6, 0x12, 0xa8, 0x45, 0x1a, 0xe8, 0x00, 0x1b, 0x08, 0x4e, 0x1a, 0xe8, 0x45, 0x1b, 0x08, 
+  0x42, 0x1a, 0xe8, 0x04, 0x1a, 0xc8, 0x12, 0x88, 0x02, 0x06, 0x01, 0xe6, 0x01, 0xc6, 0x41, 0x09, 
+  0xe6, 0x80, 0x05, 0x02, 0x25, 0x1b, 0x28, 0x0a, 0x66, 0x01, 0xe5, 0x09, 0xe6, 0x01, 0xe6, 0x41, 
+  0x09, 0xe6, 0x01, 0x01, 0xe6, 0x09, 0xe6, 0x81, 0x04, 0x12, 0xe7, 0x01, 0xc5, 0x01, 0xc6, 0x09, 
+  0xc6, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x14, 0x09, 0xe7, 0x11, 0xc6, 0x00, 0x81, 0x08, 0x00, 0x48, 
+  0xc4, 0x28, 0x41, 0x58, 0x83, 0xa9, 0x69, 0x99, 0x48, 0x48, 0x83, 0x10, 0x00, 0x28, 0x21, 0x91, 
+  0x07, 0xb1, 0x49, 0x71, 0x06, 0x18, 0x20, 0x30, 0xa3, 0x08, 0x20, 0x00, 0x20, 0x09, 0x64, 0x02, 
+  0x06, 0x82, 0x42, 0x01, 0xc6, 0x85, 0x00, 0x01, 0xe5, 0x81, 0x00, 0x0a, 0x67, 0x80, 0x05, 0x09, 
+  0xe6, 0x01, 0xa6, 0x12, 0x67, 0x1a, 0xc8, 0x01, 0xc6, 0x09, 0xc6, 0x80, 0x00, 0x01, 0xe6, 0x82, 
+  0x42, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x81, 0x02, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0xc6, 0x46, 0x01, 
+  0xe6, 0x42, 0x09, 0xe6, 0x84, 0x00, 0x01, 0xe6, 0x82, 0x00, 0x01, 0xc5, 0x80, 0x00, 0x01, 0xc5, 
+  0x82, 0x01, 0x09, 0xe6, 0x01, 0xe6, 0x80, 0x01, 0x0a, 0x46, 0x1b, 0x08, 0x84, 0x43, 0x09, 0xe6, 
+  0x84, 0x4d, 0x01, 0xc6, 0x00, 0x01, 0xa6, 0x41, 0x01, 0xc6, 0x01, 0x01, 0xe6, 0x09, 0xe7, 0x80, 
+  0x00, 0x1b, 0x08, 0x85, 0x00, 0x01, 0xe6, 0x81, 0x01, 0x01, 0xe6, 0x09, 0xe7, 0x81, 0x00, 0x09, 
+  0xe7, 0x81, 0x41, 0x09, 0xe7, 0x42, 0x09, 0xe6, 0x04, 0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x26, 0x0a, 
+  0x66, 0x12, 0x66, 0x42, 0x01, 0xe6, 0x43, 0x09, 0xe6, 0x0f, 0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x06, 
+  0x1a, 0xa8, 0x0a, 0x06, 0x01, 0xe6, 0x09, 0xe7, 0x0a, 0x06, 0x1a, 0xe8, 0x12, 0xc8, 0x0a, 0x07, 
+  0x01, 0xc6, 0x0a, 0x25, 0x1b, 0x07, 0x12, 0xc7, 0x01, 0xe5, 0x41, 0x01, 0xe6, 0x02, 0x1a, 0xe7, 
+  0x23, 0x68, 0x0a, 0x66, 0x42, 0x01, 0xe6, 0x02, 0x1a, 0xe8, 0x12, 0x87, 0x12, 0x67, 0x46, 0x0a, 
+  0x67, 0x00, 0x12, 0x67, 0x55, 0x0a, 0x67, 0x00, 0x0a, 0x47, 0x41, 0x01, 0xe6, 0x00, 0x09, 0xe6, 
+  0x41, 0x09, 0xc6, 0x04, 0x01, 0xc6, 0x02, 0x05, 0x1b, 0x28, 0x12, 0xa6, 0x01, 0xe5, 0x45, 0x01, 
+  0xe6, 0x80, 0x00, 0x01, 0xc5, 0x81, 0x00, 0x01, 0xa5, 0x41, 0x01, 0xc6, 0x80, 0x00, 0x09, 0xe7, 
+  0x81, 0x13, 0x08, 0xc2, 0x08, 0x00, 0x58, 0xe5, 0x30, 0x62, 0x38, 0x42, 0xb9, 0x49, 0xc9, 0x09, 
+  0xd1, 0x4a, 0xa9, 0x69, 0x18, 0x20, 0x70, 0xe5, 0xd1, 0x6a, 0xd1, 0x09, 0xc9, 0x6a, 0x69, 0x05, 
+  0x10, 0x20, 0x38, 0x83, 0x08, 0x00, 0x00, 0x81, 0x09, 0xc6, 0x84, 0x41, 0x01, 0xe6, 0x80, 0x01, 
+  0x02, 0x06, 0x1b, 0x28, 0x86, 0x00, 0x09, 0xc6, 0x81, 0x00, 0x12, 0xa7, 0x43, 0x01, 0xc6, 0x48, 
+  0x01, 0xe6, 0x41, 0x01, 0xc6, 0x00, 0x09, 0xc6, 0x81, 0x00, 0x01, 0xc6, 0x45, 0x01, 0xe6, 0x81, 
+  0x00, 0x0a, 0x26, 0x80, 0x00, 0x02, 0x06, 0x41, 0x01, 0xc6, 0x80, 0x03, 0x1a, 0xe8, 0x0a, 0x46, 
+  0x01, 0xa5, 0x09, 0xe6, 0x80, 0x00, 0x12, 0xa7, 0x84, 0x00, 0x0a, 0x26, 0x84, 0x00, 0x09, 0xe7, 
+  0x80, 0x41, 0x01, 0xe6, 0x82, 0x00, 0x09, 0xe7, 0x41, 0x0a, 0x07, 0x80, 0x04, 0x09, 0xc6, 0x09, 
+  0xc7, 0x01, 0xe7, 0x09, 0xe7, 0x09, 0xc7, 0x80, 0x01, 0x01, 0xe6, 0x09, 0xe7, 0x41, 0x09, 0xe6, 
+  0x00, 0x01, 0xe6, 0x43, 0x09, 0xe6, 0x01, 0x09, 0xc6, 0x09, 0xe6, 0x80, 0x00, 0x01, 0xe6, 0x82, 
+  0x00, 0x09, 0xe6, 0x82, 0x42, 0x09, 0xc6, 0x03, 0x09, 0xe6, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe6, 
+  0x42, 0x09, 0xe6, 0x01, 0x01, 0xc6, 0x09, 0xc6, 0x41, 0x09, 0xe7, 0x80, 0x02, 0x01, 0xc6, 0x09, 
+  0xe6, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x80, 0x42, 0x09, 0xe6, 0x00, 0x09, 0xe7, 0x80, 0x41, 0x01, 
+  0xc6, 0x02, 0x0a, 0x06, 0x1a, 0xe8, 0x0a, 0x47, 0x41, 0x01, 0xc6, 0x0e, 0x0a, 0x06, 0x1b, 0x08, 
+  0x12, 0xc8, 0x02, 0x06, 0x01, 0xe6, 0x0a, 0x05, 0x1b, 0x07, 0x12, 0xa6, 0x01, 0xc5, 0x01, 0xc6, 
+  0x01, 0xe5, 0x1b, 0x07, 0x23, 0x68, 0x0a, 0x66, 0x02, 0x06, 0x80, 0x02, 0x0a, 0x26, 0x1a, 0xe8, 
+  0x12, 0x87, 0x60, 0x01, 0xc6, 0x80, 0x41, 0x09, 0xe6, 0x80, 0x06, 0x01, 0xe6, 0x02, 0x25, 0x1b, 
+  0x08, 0x0a, 0x66, 0x01, 0xe5, 0x01, 0xe6, 0x01, 0xc6, 0x82, 0x41, 0x09, 0xe6, 0x01, 0x09, 0xe7, 
+  0x01, 0xa6, 0x81, 0x00, 0x01, 0xc5, 0x44, 0x01, 0xc6, 0x16, 0x09, 0xa6, 0x00, 0x20, 0x50, 0x83, 
+  0xc9, 0x8b, 0x50, 0x83, 0x68, 0xc5, 0xc9, 0x29, 0xc0, 0xe8, 0xc9, 0x09, 0xb1, 0x69, 0x20, 0x21, 
+  0x70, 0xe6, 0xc9, 0x29, 0xc0, 0xe8, 0xc1, 0x29, 0x91, 0x68, 0x38, 0x62, 0xa9, 0x69, 0x58, 0xc4, 
+  0x00, 0x00, 0x09, 0x65, 0x01, 0xe7, 0x0a, 0x26, 0x80, 0x00, 0x01, 0xc5, 0x84, 0x00, 0x1b, 0x08, 
+  0x80, 0x01, 0x01, 0xe5, 0x01, 0xe6, 0x82, 0x00, 0x01, 0xa6, 0x83, 0x00, 0x01, 0xc5, 0x81, 0x44, 
+  0x01, 0xe6, 0x41, 0x09, 0xe6, 0x80, 0x00, 0x01, 0xc6, 0x80, 0x42, 0x09, 0xc6, 0x42, 0x01, 0xc6, 
+  0x82, 0x42, 0x01, 0xe7, 0x81, 0x00, 0x0a, 0x06, 0x80, 0x00, 0x01, 0xe6, 0x86, 0x00, 0x01, 0xa6, 
+  0x80, 0x00, 0x1a, 0xc8, 0x80, 0x02, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0xa6, 0x83, 0x00, 0x09, 0xc6, 
+  0x45, 0x09, 0xe6, 0x43, 0x09, 0xe7, 0x80, 0x43, 0x01, 0xa6, 0x44, 0x01, 0xc6, 0x42, 0x01, 0xc5, 
+  0x00, 0x01, 0xc6, 0x41, 0x01, 0xc5, 0x00, 0x01, 0xa5, 0x41, 0x01, 0xa6, 0x01, 0x01, 0xc6, 0x01, 
+  0xc5, 0x82, 0x00, 0x09, 0xe7, 0x82, 0x42, 0x09, 0xe6, 0x01, 0x01, 0xe6, 0x09, 0xe6, 0x80, 0x41, 
+  0x09, 0xe7, 0x81, 0x00, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x03, 0x09, 0xc6, 0x09, 0xe7, 0x09, 0xe6, 
+  0x01, 0xe6, 0x41, 0x09, 0xe6, 0x00, 0x09, 0xe7, 0x42, 0x01, 0xe6, 0x42, 0x09, 0xe6, 0x80, 0x02, 
+  0x0a, 0x06, 0x1a, 0xc8, 0x0a, 0x47, 0x41, 0x01, 0xc6, 0x03, 0x01, 0xe6, 0x1a, 0xe7, 0x12, 0xe8, 
+  0x02, 0x27, 0x80, 0x11, 0x0a, 0x25, 0x1a, 0xe7, 0x12, 0xa7, 0x01, 0xc5, 0x01, 0xa6, 0x01, 0xe5, 
+  0x12, 0xc7, 0x23, 0x48, 0x0a, 0x66, 0x01, 0xe6, 0x09, 0xe7, 0x0a, 0x26, 0x1a, 0xe8, 0x12, 0x67, 
+  0x01, 0xc6, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe6, 0x82, 0x00, 0x01, 0xa6, 0x81, 0x00, 0x01, 0xa6, 
+  0x80, 0x41, 0x01, 0xa6, 0x81, 0x41, 0x01, 0xc5, 0x83, 0x00, 0x01, 0xa5, 0x84, 0x00, 0x01, 0xa6, 
+  0x81, 0x00, 0x01, 0xa6, 0x42, 0x01, 0xa5, 0x00, 0x01, 0xc5, 0x41, 0x01, 0xc6, 0x03, 0x01, 0xe5, 
+  0x1a, 0xe7, 0x12, 0x87, 0x01, 0xe5, 0x41, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x80, 
+  0x00, 0x09, 0xc6, 0x41, 0x01, 0xc6, 0x01, 0x01, 0xc5, 0x12, 0xc7, 0x81, 0x41, 0x01, 0xe6, 0x03, 
+  0x02, 0x06, 0x0a, 0x06, 0x0a, 0x26, 0x09, 0xc5, 0x80, 0x10, 0x78, 0xc6, 0xd1, 0x6b, 0x48, 0x83, 
+  0x60, 0xc4, 0xc9, 0x4a, 0xc1, 0x09, 0xc9, 0x4a, 0x81, 0x06, 0x00, 0x00, 0x28, 0x41, 0xb1, 0x49, 
+  0xc9, 0x29, 0xd1, 0x4a, 0x91, 0x47, 0x40, 0x62, 0xc1, 0x6a, 0x78, 0xe6, 0x84, 0x41, 0x01, 0xc6, 
+  0x83, 0x00, 0x1b, 0x28, 0x80, 0x00, 0x01, 0xc5, 0x81, 0x00, 0x1b, 0x08, 0x81, 0x00, 0x09, 0xe6, 
+  0x81, 0x00, 0x1a, 0xc8, 0x81, 0x43, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x02, 0x09, 
+  0xc6, 0x01, 0xc6, 0x01, 0xe6, 0x46, 0x01, 0xc6, 0x46, 0x01, 0xe6, 0x80, 0x00, 0x02, 0x06, 0x82, 
+  0x00, 0x09, 0xc6, 0x85, 0x00, 0x12, 0x87, 0x82, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x84, 0x01, 0x01, 
+  0xc6, 0x01, 0xe6, 0x82, 0x45, 0x09, 0xe7, 0x00, 0x0a, 0x47, 0x43, 0x0a, 0x46, 0x00, 0x0a, 0x66, 
+  0x41, 0x0a, 0x67, 0x01, 0x0a, 0x46, 0x0a, 0x67, 0x42, 0x0a, 0x46, 0x43, 0x0a, 0x47, 0x00, 0x0a, 
+  0x46, 0x41, 0x0a, 0x67, 0x80, 0x00, 0x12, 0x87, 0x80, 0x42, 0x09, 0xe6, 0x44, 0x01, 0xe6, 0x43, 
+  0x09, 0xe6, 0x00, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xe7, 0x81, 0x42, 0x01, 0xc6, 0x00, 0x01, 0xe7, 
+  0x81, 0x01, 0x01, 0xe6, 0x09, 0xe6, 0x80, 0x01, 0x09, 0xe6, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x02, 
+  0x0a, 0x27, 0x1a, 0xc8, 0x0a, 0x07, 0x41, 0x01, 0xc6, 0x0d, 0x02, 0x06, 0x12, 0xc7, 0x12, 0x88, 
+  0x02, 0x06, 0x01, 0xe6, 0x0a, 0x26, 0x1b, 0x07, 0x12, 0xc7, 0x09, 0xe6, 0x01, 0xc6, 0x09, 0xe6, 
+  0x1b, 0x07, 0x1b, 0x28, 0x0a, 0x26, 0x41, 0x01, 0xc6, 0x03, 0x0a, 0x06, 0x1a, 0xe8, 0x0a, 0x67, 
+  0x01, 0xc5, 0x43, 0x01, 0xe6, 0x02, 0x01, 0xa6, 0x01, 0xe6, 0x0a, 0x47, 0x52, 0x0a, 0x67, 0x43, 
+  0x0a, 0x47, 0x47, 0x0a, 0x67, 0x03, 0x12, 0xc8, 0x0a, 0x67, 0x01, 0xe6, 0x09, 0xe6, 0x80, 0x00, 
+  0x09, 0xc6, 0x41, 0x01, 0xc6, 0x01, 0x09, 0xc6, 0x09, 0xe6, 0x42, 0x01, 0xc6, 0x03, 0x0a, 0x66, 
+  0x1b, 0x49, 0x12, 0x67, 0x01, 0xa5, 0x80, 0x00, 0x0a, 0x86, 0x41, 0x1b, 0x28, 0x0b, 0x23, 0xa9, 
+  0x1a, 0xc7, 0x00, 0x00, 0x60, 0xa4, 0xb9, 0x89, 0x30, 0x41, 0x10, 0x20, 0x71, 0x06, 0x91, 0x47, 
+  0x70, 0xc5, 0x38, 0x41, 0x40, 0x62, 0x80, 0x06, 0x48, 0x83, 0x79, 0x06, 0x79, 0x26, 0x38, 0x62, 
+  0x18, 0x00, 0xa1, 0x48, 0x71, 0x06, 0x80, 0x01, 0x09, 0x44, 0x01, 0xe6, 0x87, 0x00, 0x1b, 0x08, 
+  0x86, 0x00, 0x09, 0xc6, 0x81, 0x01, 0x1a, 0xc7, 0x01, 0xa5, 0x41, 0x01, 0xc6, 0x44, 0x01, 0xe6, 
+  0x44, 0x01, 0xc6, 0x01, 0x09, 0xc6, 0x01, 0xe6, 0x80, 0x42, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x84, 
+  0x00, 0x09, 0xe6, 0x83, 0x00, 0x01, 0xa6, 0x81, 0x00, 0x1b, 0x08, 0x81, 0x00, 0x09, 0xc6, 0x84, 
+  0x41, 0x01, 0xc6, 0x00, 0x01, 0xe5, 0x41, 0x12, 0xa7, 0x00, 0x01, 0xc5, 0x41, 0x01, 0xc6, 0x82, 
+  0x45, 0x09, 0xe7, 0x00, 0x0a, 0x07, 0x00, 0x1a, 0xe8, 0x4d, 0x1b, 0x08, 0x42, 0x1a, 0xe8, 0x41, 
+  0x1b, 0x08, 0x01, 0x12, 0x67, 0x01, 0xc6, 0x41, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x42, 0x09, 0xe6, 
+  0x81, 0x41, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x80, 0x01, 0x09, 0xc6, 0x01, 0xc6, 0x80, 0x00, 0x01, 
+  0xe6, 0x42, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x01, 0x09, 0xe6, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x81, 
+  0x12, 0x0a, 0x06, 0x1a, 0xe8, 0x0a, 0x27, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0xe6, 0x1a, 0xc8, 0x12, 
+  0x88, 0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x06, 0x1a, 0xe7, 0x12, 0xa7, 0x09, 0xe6, 0x01, 0xc6, 0x09, 
+  0xe6, 0x12, 0xc7, 0x1b, 0x28, 0x0a, 0x26, 0x41, 0x01, 0xc6, 0x03, 0x01, 0xe6, 0x12, 0xa7, 0x0a, 
+  0x47, 0x01, 0xc6, 0x43, 0x01, 0xe6, 0x02, 0x01, 0xc6, 0x01, 0xe5, 0x12, 0x87, 0x47, 0x1a, 0xe8, 
+  0x41, 0x1b, 0x08, 0x42, 0x1a, 0xe8, 0x41, 0x1b, 0x08, 0x4f, 0x1a, 0xe8, 0x03, 0x1b, 0x08, 0x12, 
+  0x67, 0x01, 0xc6, 0x09, 0xc6, 0x43, 0x01, 0xc6, 0x42, 0x09, 0xc6, 0x80, 0x03, 0x01, 0xc5, 0x0a, 
+  0x66, 0x1b, 0x08, 0x0a, 0x67, 0x41, 0x01, 0xc6, 0x11, 0x01, 0xc5, 0x1b, 0x68, 0x0a, 0xc6, 0x0a, 
+  0x85, 0x1b, 0x88, 0x12, 0xc6, 0x00, 0x61, 0x18, 0x21, 0x50, 0xa3, 0x40, 0x62, 0x20, 0x21, 0x00, 
+  0x00, 0x08, 0x00, 0x30, 0x21, 0xa1, 0x28, 0xc1, 0x49, 0xb1, 0x69, 0x58, 0xc4, 0x41, 0x00, 0x00, 
+  0x04, 0x20, 0x21, 0x40, 0x83, 0x50, 0x83, 0x20, 0x41, 0x00, 0x20, 0x80, 0x00, 0x01, 0xc6, 0x88, 
+  0x00, 0x01, 0xe5, 0x80, 0x00, 0x01, 0xc6, 0x83, 0x00, 0x01, 0xc6, 0x84, 0x41, 0x01, 0xe6, 0x00, 
+  0x01, 0xc6, 0x81, 0x41, 0x01, 0xc6, 0x41, 0x09, 0xc6, 0x82, 0x00, 0x01, 0xc6, 0x43, 0x01, 0xe6, 
+  0x84, 0x41, 0x09, 0xe6, 0x81, 0x00, 0x1b, 0x08, 0x80, 0x41, 0x01, 0xc6, 0x82, 0x01, 0x01, 0xc5, 
+  0x01, 0xc6, 0x81, 0x00, 0x1a, 0xe7, 0x80, 0x43, 0x01, 0xc6, 0x05, 0x01, 0xe6, 0x1a, 0xe8, 0x12, 
+  0xa7, 0x01, 0xe5, 0x01, 0xa6, 0x01, 0xc6, 0x43, 0x09, 0xe6, 0x84, 0x42, 0x01, 0xc5, 0x41, 0x01, 
+  0xc6, 0x44, 0x01, 0xc5, 0x44, 0x01, 0xc6, 0x00, 0x01, 0xa6, 0x43, 0x01, 0xa5, 0x02, 0x01, 0xc6, 
+  0x09, 0xc6, 0x01, 0xc6, 0x41, 0x09, 0xe6, 0x80, 0x41, 0x01, 0xc6, 0x03, 0x09, 0xe7, 0x01, 0xe6, 
+  0x09, 0xe6, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x80, 0x01, 0x09, 0xe6, 0x09, 0xe7, 0x41, 0x09, 0xe6, 
+  0x41, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x82, 0x00, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x0d, 0x01, 0xc6, 
+  0x0a, 0x26, 0x1b, 0x08, 0x0a, 0x47, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xe6, 0x1a, 0xc8, 0x12, 0xa7, 
+  0x01, 0xe6, 0x01, 0xa6, 0x09, 0xe5, 0x1a, 0xc7, 0x12, 0x87, 0x41, 0x01, 0xc6, 0x03, 0x02, 0x06, 
+  0x1a, 0xe7, 0x1b, 0x28, 0x0a, 0x26, 0x41, 0x01, 0xc6, 0x03, 0x0a, 0x06, 0x1a, 0xa7, 0x12, 0x47, 
+  0x01, 0xc5, 0x81, 0x00, 0x09, 0xe7, 0x41, 0x01, 0xc6, 0x05, 0x01, 0xe6, 0x1a, 0xe8, 0x12, 0xa7, 
+  0x01, 0xa5, 0x01, 0xc6, 0x01, 0xa6, 0x47, 0x01, 0xc6, 0x45, 0x01, 0xc5, 0x00, 0x01, 0xc6, 0x41, 
+  0x01, 0xc5, 0x02, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xa5, 0x41, 0x01, 0xc5, 0x00, 0x01, 0xc6, 0x41, 
+  0x01, 0xc5, 0x42, 0x01, 0xc6, 0x00, 0x01, 0xc5, 0x43, 0x01, 0xc6, 0x41, 0x09, 0xe6, 0x00, 0x01, 
+  0xe6, 0x80, 0x00, 0x09, 0xe6, 0x80, 0x05, 0x01, 0xe5, 0x0a, 0x86, 0x1b, 0x48, 0x12, 0x87, 0x01, 
+  0xc5, 0x01, 0xe6, 0x80, 0x01, 0x01, 0xa5, 0x1b, 0x07, 0x41, 0x13, 0x27, 0x17, 0x23, 0xe9, 0x1b, 
+  0x68, 0x09, 0x44, 0x00, 0x00, 0x18, 0x20, 0xa1, 0x68, 0xa9, 0x49, 0x48, 0x83, 0x00, 0x00, 0x68, 
+  0xe5, 0xd1, 0x2a, 0xc0, 0xe8, 0xc9, 0x08, 0xb1, 0x69, 0x20, 0x21, 0x28, 0x42, 0xa9, 0x48, 0xc1, 
+  0x6a, 0x48, 0x83, 0x00, 0x00, 0x08, 0xa2, 0x09, 0xa6, 0x01, 0xa5, 0x0a, 0x06, 0x82, 0x00, 0x01, 
+  0xc6, 0x86, 0x00, 0x01, 0xa5, 0x81, 0x01, 0x01, 0xc6, 0x01, 0xe6, 0x81, 0x00, 0x1a, 0xc8, 0x80, 
+  0x41, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x80, 0x00, 0x01, 0xc6, 0x41, 0x09, 0xc6, 0x00, 0x01, 0xc6, 
+  0x41, 0x09, 0xc6, 0x42, 0x01, 0xc6, 0x47, 0x01, 0xe6, 0x01, 0x09, 0xe6, 0x09, 0xe7, 0x81, 0x01, 
+  0x0a, 0x06, 0x1b, 0x28, 0x81, 0x00, 0x09, 0xc6, 0x81, 0x02, 0x0a, 0x66, 0x01, 0xa5, 0x09, 0xc6, 
+  0x81, 0x01, 0x12, 0xc7, 0x01, 0xa5, 0x80, 0x01, 0x09, 0xe6, 0x09, 0xc6, 0x41, 0x01, 0xc6, 0x03, 
+  0x0a, 0x26, 0x23, 0x28, 0x12, 0xa7, 0x01, 0xe5, 0x89, 0x46, 0x01, 0xc6, 0x01, 0x01, 0xe6, 0x09, 
+  0xe6, 0x41, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x42, 0x01, 0xa6, 
+  0x41, 0x01, 0xc6, 0x42, 0x09, 0xe6, 0x00, 0x01, 0xe6, 0x80, 0x41, 0x01, 0xe6, 0x47, 0x01, 0xc6, 
+  0x84, 0x41, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x80, 0x0e, 0x01, 0xc6, 0x0a, 0x26, 0x1b, 0x08, 0x0a, 
+  0x47, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xe6, 0x12, 0xa8, 0x12, 0x88, 0x09, 0xe6, 0x01, 0xc6, 0x09, 
+  0xe5, 0x1a, 0xc7, 0x12, 0x46, 0x01, 0xa5, 0x80, 0x04, 0x01, 0xe6, 0x1a, 0xe7, 0x23, 0x48, 0x0a, 
+  0x46, 0x01, 0xe6, 0x80, 0x03, 0x09, 0xe6, 0x1a, 0xa8, 0x0a, 0x27, 0x01, 0xa5, 0x41, 0x01, 0xc6, 
+  0x80, 0x05, 0x01, 0xc6, 0x01, 0xe6, 0x02, 0x06, 0x12, 0xa7, 0x12, 0x87, 0x09, 0xe6, 0x44, 0x01, 
+  0xc6, 0x43, 0x01, 0xc7, 0x03, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0xe6, 0x41, 0x01, 0xc6, 
+  0x41, 0x01, 0xc7, 0x54, 0x01, 0xc6, 0x80, 0x0d, 0x01, 0xc6, 0x01, 0xe6, 0x01, 0xc5, 0x0a, 0x86, 
+  0x1b, 0x68, 0x0a, 0x86, 0x01, 0xe6, 0x09, 0xe6, 0x01, 0xc6, 0x01, 0xa6, 0x0a, 0x05, 0x1b, 0x28, 
+  0x23, 0xc9, 0x24, 0x09, 0x80, 0x0b, 0x0a, 0x87, 0x09, 0xa5, 0x00, 0x40, 0x18, 0x21, 0xa1, 0x28, 
+  0xc9, 0x09, 0xb1, 0x49, 0x30, 0x41, 0x60, 0xc5, 0xd1, 0x6a, 0xc9, 0x08, 0xc1, 0x09, 0x80, 0x04, 
+  0x48, 0x83, 0x91, 0x27, 0xc9, 0x09, 0xc9, 0x2a, 0x50, 0xa4, 0x80, 0x02, 0x09, 0x24, 0x01, 0xa6, 
+  0x01, 0x86, 0x83, 0x41, 0x01, 0xe6, 0x83, 0x00, 0x01, 0xa6, 0x80, 0x00, 0x01, 0xa6, 0x80, 0x00, 
+  0x0a, 0x47, 0x84, 0x00, 0x01, 0xc5, 0x4d, 0x01, 0xc6, 0x87, 0x01, 0x01, 0xc6, 0x01, 0xe6, 0x41, 
+  0x01, 0xc6, 0x01, 0x02, 0x06, 0x1b, 0x08, 0x82, 0x00, 0x01, 0xe5, 0x80, 0x00, 0x12, 0x86, 0x81, 
+  0x03, 0x01, 0xa5, 0x12, 0x86, 0x12, 0xa7, 0x01, 0x85, 0x41, 0x01, 0xc6, 0x82, 0x06, 0x01, 0xe6, 
+  0x02, 0x06, 0x1a, 0xc8, 0x12, 0xa7, 0x01, 0xe5, 0x01, 0xc6, 0x01, 0xe6, 0x86, 0x83, 0x00, 0x01, 
+  0xe6, 0x45, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x04, 0x02, 0x06, 0x12, 0xc7, 0x1b, 0x28, 0x12, 0xe7, 
+  0x01, 0xe5, 0x45, 0x01, 0xc6, 0x00, 0x09, 0xc6, 0x43, 0x01, 0xe6, 0x42, 0x01, 0xe5, 0x50, 0x01, 
+  0xc5, 0x17, 0x0a, 0x46, 0x23, 0x49, 0x0a, 0x67, 0x01, 0xc6, 0x09, 0xe7, 0x02, 0x06, 0x1a, 0xc8, 
+  0x12, 0xc8, 0x02, 0x07, 0x01, 0xc6, 0x0a, 0x26, 0x1a, 0xe7, 0x12, 0x66, 0x01, 0xa5, 0x01, 0xa6, 
+  0x01, 0xc5, 0x1a, 0xe7, 0x23, 0x48, 0x0a, 0x67, 0x01, 0xe6, 0x09, 0xe7, 0x09, 0xe6, 0x1a, 0xc8, 
+  0x0a, 0x26, 0x45, 0x01, 0xc6, 0x03, 0x02, 0x26, 0x1b, 0x08, 0x12, 0x87, 0x01, 0xc5, 0x43, 0x01, 
+  0xc6, 0x41, 0x01, 0xc5, 0x44, 0x01, 0xc6, 0x5c, 0x01, 0xc5, 0x41, 0x01, 0xe5, 0x02, 0x0a, 0x86, 
+  0x1b, 0x68, 0x0a, 0x87, 0x42, 0x01, 0xe6, 0x80, 0x03, 0x01, 0xe5, 0x12, 0xc7, 0x0a, 0x86, 0x0a, 
+  0x66, 0x41, 0x0a, 0x86, 0x0e, 0x01, 0xe5, 0x09, 0xc6, 0x00, 0xc2, 0x00, 0x00, 0x79, 0x06, 0xc9, 
+  0x29, 0xd1, 0x4a, 0x68, 0xc5, 0x18, 0x20, 0x89, 0x27, 0xb1, 0x69, 0xa1, 0x68, 0x58, 0xc4, 0x48, 
+  0x63, 0xc9, 0x49, 0x80, 0x05, 0xb1, 0x49, 0x28, 0x41, 0x00, 0x41, 0x09, 0x85, 0x01, 0xa5, 0x01, 
+  0xa6, 0x80, 0x00, 0x1a, 0xe8, 0x83, 0x00, 0x01, 0xe6, 0x81, 0x00, 0x01, 0xe6, 0x83, 0x00, 0x0a, 
+  0x67, 0x80, 0x02, 0x09, 0xe6, 0x01, 0xc6, 0x12, 0x87, 0x85, 0x00, 0x09, 0xc6, 0x83, 0x41, 0x09, 
+  0xc6, 0x81, 0x45, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x81, 0x00, 0x09, 0xe6, 0x86, 0x03, 0x09, 0xc7, 
+  0x01, 0xe6, 0x1b, 0x28, 0x12, 0x87, 0x41, 0x01, 0xc6, 0x81, 0x02, 0x1a, 0xe7, 0x01, 0xc5, 0x01, 
+  0xa5, 0x80, 0x01, 0x09, 0xe7, 0x01, 0xe6, 0x81, 0x04, 0x01, 0xe6, 0x02, 0x06, 0x1b, 0x08, 0x12, 
+  0xc7, 0x01, 0xe5, 0x41, 0x01, 0xc6, 0x00, 0x09, 0xc6, 0x41, 0x09, 0xe6, 0x42, 0x09, 0xe7, 0x80, 
+  0x00, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x42, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x41, 0x02, 0x06, 0x41, 
+  0x02, 0x26, 0x05, 0x13, 0x07, 0x1b, 0xa8, 0x1b, 0x87, 0x23, 0xa8, 0x1a, 0xe7, 0x01, 0xe5, 0x81, 
+  0x00, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x82, 0x03, 0x02, 0x26, 0x1a, 0xe8, 0x1b, 0x28, 0x1b, 0x08, 
+  0x41, 0x1a, 0xe8, 0x46, 0x1b, 0x08, 0x41, 0x1b, 0x29, 0x00, 0x1b, 0x28, 0x41, 0x1b, 0x29, 0x41, 
+  0x1b, 0x08, 0x41, 0x1a, 0xe8, 0x0a, 0x0a, 0x47, 0x01, 0xc6, 0x01, 0xe6, 0x0a, 0x26, 0x1a, 0xc7, 
+  0x12, 0xc8, 0x0a, 0x07, 0x09, 0xe6, 0x0a, 0x05, 0x1b, 0x08, 0x12, 0x87, 0x41, 0x01, 0xa5, 0x03, 
+  0x09, 0xc5, 0x12, 0xa6, 0x1b, 0x07, 0x0a, 0x46, 0x41, 0x01, 0xc6, 0x03, 0x01, 0xe6, 0x12, 0xa7, 
+  0x0a, 0x26, 0x01, 0xa6, 0x84, 0x03, 0x02, 0x06, 0x1b, 0x08, 0x12, 0x87, 0x01, 0xe5, 0x42, 0x01, 
+  0xc6, 0x01, 0x02, 0x05, 0x1a, 0xe8, 0x42, 0x1b, 0x08, 0x00, 0x1a, 0xe8, 0x41, 0x1b, 0x08, 0x4b, 
+  0x1a, 0xe8, 0x43, 0x1b, 0x08, 0x00, 0x1b, 0x09, 0x47, 0x1b, 0x08, 0x42, 0x1a, 0xe8, 0x41, 0x1b, 
+  0x08, 0x04, 0x1a, 0xe8, 0x1b, 0x08, 0x23, 0x49, 0x0a, 0x87, 0x01, 0xe5, 0x80, 0x00, 0x09, 0xe6, 
+  0x80, 0x03, 0x0a, 0x46, 0x12, 0xe7, 0x0a, 0x67, 0x01, 0xc6, 0x41, 0x01, 0xa5, 0x14, 0x01, 0xc5, 
+  0x01, 0xc6, 0x01, 0xa6, 0x09, 0x64, 0x00, 0x20, 0x18, 0x21, 0x91, 0x27, 0xc1, 0x8a, 0x60, 0xc4, 
+  0x08, 0x00, 0x30, 0x21, 0x60, 0x83, 0x48, 0x83, 0x08, 0x00, 0x38, 0x62, 0xb1, 0x69, 0xa1, 0x28, 
+  0x48, 0x63, 0x00, 0x00, 0x09, 0x03, 0x09, 0xa6, 0x41, 0x01, 0xa6, 0x80, 0x01, 0x1a, 0xe7, 0x01, 
+  0xe6, 0x42, 0x09, 0xe6, 0x00, 0x01, 0xc6, 0x80, 0x01, 0x1a, 0xe8, 0x01, 0xc5, 0x82, 0x01, 0x1a, 
+  0xe8, 0x0a, 0x47, 0x83, 0x00, 0x1a, 0xe8, 0x80, 0x42, 0x01, 0xe6, 0x56, 0x01, 0xc6, 0x82, 0x01, 
+  0x09, 0xe6, 0x09, 0xe7, 0x81, 0x00, 0x0a, 0x86, 0x81, 0x00, 0x12, 0x86, 0x41, 0x23, 0x48, 0x00, 
+  0x0a, 0x26, 0x81, 0x41, 0x09, 0xe6, 0x07, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0xe7, 0x01, 0xe6, 0x0a, 
+  0x26, 0x1b, 0x08, 0x12, 0xc7, 0x01, 0xe6, 0x80, 0x41, 0x09, 0xe6, 0x43, 0x09, 0xe7, 0x80, 0x41, 
+  0x09, 0xe6, 0x00, 0x01, 0xe6, 0x81, 0x01, 0x01, 0xc5, 0x12, 0xc7, 0x41, 0x1b, 0x08, 0x00, 0x1b, 
+  0x49, 0x41, 0x1b, 0x48, 0x04, 0x23, 0xa9, 0x1b, 0x87, 0x0a, 0xe5, 0x1b, 0x67, 0x1b, 0x68, 0x80, 
+  0x46, 0x01, 0xe6, 0x02, 0x02, 0x06, 0x02, 0x26, 0x1b, 0x08, 0x80, 0x41, 0x0a, 0x46, 0x43, 0x0a, 
+  0x26, 0x41, 0x0a, 0x06, 0x02, 0x0a, 0x26, 0x0a, 0x46, 0x0a, 0x66, 0x41, 0x12, 0x66, 0x06, 0x12, 
+  0x46, 0x12, 0x26, 0x0a, 0x26, 0x0a, 0x05, 0x0a, 0x26, 0x0a, 0x06, 0x01, 0xe6, 0x41, 0x01, 0xc5, 
+  0x08, 0x0a, 0x26, 0x1b, 0x08, 0x12, 0xc7, 0x02, 0x06, 0x01, 0xc6, 0x01, 0xe5, 0x1a, 0xe7, 0x1a, 
+  0xc7, 0x01, 0xc5, 0x81, 0x03, 0x12, 0xa6, 0x1b, 0x28, 0x0a, 0x26, 0x01, 0xc6, 0x41, 0x01, 0xe6, 
+  0x03, 0x1a, 0xc8, 0x12, 0x87, 0x01, 0xc6, 0x01, 0xe6, 0x80, 0x41, 0x01, 0xe6, 0x80, 0x03, 0x01, 
+  0xc5, 0x12, 0x87, 0x12, 0x67, 0x01, 0xc5, 0x41, 0x01, 0xc6, 0x03, 0x01, 0xe5, 0x0a, 0x86, 0x23, 
+  0x68, 0x12, 0x86, 0x44, 0x0a, 0x46, 0x44, 0x0a, 0x26, 0x43, 0x0a, 0x46, 0x43, 0x0a, 0x26, 0x41, 
+  0x12, 0x26, 0x41, 0x0a, 0x26, 0x00, 0x12, 0x46, 0x41, 0x0a, 0x66, 0x02, 0x0a, 0x46, 0x0a, 0x26, 
+  0x0a, 0x06, 0x41, 0x0a, 0x05, 0x00, 0x0a, 0x06, 0x41, 0x0a, 0x26, 0x00, 0x0a, 0x06, 0x42, 0x0a, 
+  0x26, 0x03, 0x0a, 0x46, 0x02, 0x26, 0x01, 0xe5, 0x01, 0xc6, 0x80, 0x04, 0x02, 0x06, 0x02, 0x46, 
+  0x13, 0x07, 0x0a, 0xc7, 0x01, 0xe6, 0x43, 0x01, 0xc6, 0x41, 0x01, 0xa6, 0x10, 0x01, 0xc6, 0x09, 
+  0x85, 0x00, 0xa1, 0x10, 0x20, 0x28, 0x61, 0x10, 0x00, 0x50, 0xe4, 0xa9, 0x69, 0xb1, 0x08, 0xb1, 
+  0x29, 0x89, 0x47, 0x28, 0x41, 0x20, 0x41, 0x18, 0x00, 0x00, 0x40, 0x09, 0x44, 0x09, 0xa5, 0x42, 
+  0x01, 0xc6, 0x01, 0x0a, 0x26, 0x1b, 0x07, 0x42, 0x01, 0xe6, 0x02, 0x01, 0xe7, 0x01, 0xe6, 0x02, 
+  0x05, 0x80, 0x00, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x02, 0x01, 0xa5, 0x1a, 0xe7, 0x0a, 0x67, 0x80, 
+  0x00, 0x01, 0xe6, 0x80, 0x01, 0x12, 0xa7, 0x1b, 0x08, 0x80, 0x01, 0x09, 0xc6, 0x09, 0xa6, 0x41, 
+  0x09, 0x85, 0x00, 0x01, 0xa6, 0x80, 0x52, 0x01, 0xe6, 0x80, 0x00, 0x0a, 0x06, 0x80, 0x00, 0x02, 
+  0x06, 0x83, 0x00, 0x12, 0xa7, 0x41, 0x01, 0xc5, 0x00, 0x12, 0xa6, 0x41, 0x23, 0x07, 0x01, 0x11, 
+  0xe5, 0x01, 0x64, 0x41, 0x01, 0xc6, 0x42, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x03, 0x0a, 0x26, 0x1a, 
+  0xe8, 0x12, 0xc7, 0x01, 0xe6, 0x85, 0x45, 0x01, 0xe6, 0x0b, 0x12, 0xc7, 0x1a, 0xe7, 0x02, 0x25, 
+  0x02, 0x05, 0x02, 0x26, 0x0a, 0x46, 0x02, 0x46, 0x13, 0x07, 0x1b, 0x88, 0x1b, 0x47, 0x1b, 0x68, 
+  0x1b, 0x28, 0x41, 0x09, 0xe6, 0x41, 0x09, 0xc6, 0x01, 0x09, 0xa6, 0x09, 0xc5, 0x41, 0x09, 0xc6, 
+  0x05, 0x01, 0xc5, 0x1a, 0xe8, 0x23, 0x08, 0x09, 0xe6, 0x01, 0xc6, 0x01, 0xa6, 0x41, 0x01, 0x86, 
+  0x41, 0x01, 0x85, 0x42, 0x01, 0xa5, 0x04, 0x01, 0xe6, 0x09, 0x85, 0x00, 0x81, 0x00, 0x61, 0x00, 
+  0x40, 0x42, 0x00, 0x20, 0x02, 0x00, 0xe2, 0x0a, 0x26, 0x0a, 0x46, 0x41, 0x0a, 0x86, 0x09, 0x23, 
+  0x48, 0x23, 0x68, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0xa5, 0x1a, 0xc7, 0x1a, 0xe8, 0x0a, 0x06, 0x09, 
+  0xc6, 0x09, 0xe6, 0x41, 0x1b, 0x08, 0x07, 0x09, 0xe5, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xa5, 0x1a, 
+  0xa7, 0x12, 0x67, 0x09, 0xe6, 0x0a, 0x06, 0x41, 0x09, 0xe6, 0x41, 0x09, 0xc6, 0x05, 0x01, 0xa5, 
+  0x12, 0x67, 0x0a, 0x06, 0x01, 0x85, 0x09, 0xa6, 0x09, 0xc6, 0x80, 0x05, 0x0a, 0x86, 0x23, 0x49, 
+  0x12, 0xc7, 0x02, 0x06, 0x01, 0xc6, 0x01, 0xa6, 0x42, 0x01, 0x85, 0x00, 0x01, 0xa6, 0x45, 0x01, 
+  0xc6, 0x43, 0x01, 0xa6, 0x01, 0x01, 0x24, 0x00, 0x41, 0x42, 0x00, 0x20, 0x41, 0x00, 0x40, 0x03, 
+  0x01, 0x43, 0x09, 0xa5, 0x00, 0xa1, 0x00, 0x40, 0x42, 0x00, 0x20, 0x02, 0x00, 0x41, 0x01, 0x24, 
+  0x01, 0xc5, 0x41, 0x01, 0xc6, 0x03, 0x09, 0xc6, 0x09, 0xa6, 0x09, 0x85, 0x09, 0xa5, 0x41, 0x09, 
+  0xa6, 0x04, 0x01, 0xc6, 0x0a, 0x26, 0x1a, 0xe8, 0x12, 0x66, 0x0a, 0x06, 0x41, 0x09, 0xc6, 0x00, 
+  0x09, 0xa6, 0x42, 0x09, 0x85, 0x01, 0x01, 0xa5, 0x01, 0xe6, 0x41, 0x0a, 0x27, 0x04, 0x09, 0x64, 
+  0x00, 0x61, 0x00, 0x00, 0x38, 0xa3, 0xa1, 0x48, 0x41, 0xb1, 0x49, 0x05, 0x89, 0x27, 0x18, 0x21, 
+  0x00, 0x20, 0x09, 0x03, 0x0a, 0x06, 0x0a, 0x27, 0x41, 0x09, 0xa6, 0x41, 0x09, 0xc6, 0x80, 0x02, 
+  0x1a, 0xe7, 0x01, 0xc5, 0x09, 0xa6, 0x42, 0x09, 0xc6, 0x00, 0x09, 0xe5, 0x80, 0x06, 0x09, 0xe6, 
+  0x01, 0xa5, 0x09, 0xa5, 0x01, 0x85, 0x1a, 0xc7, 0x12, 0x26, 0x01, 0xa5, 0x80, 0x09, 0x0a, 0x07, 
+  0x09, 0xc5, 0x00, 0xe2, 0x00, 0x81, 0x00, 0x61, 0x00, 0x41, 0x00, 0x40, 0x00, 0x20, 0x00, 0x82, 
+  0x09, 0xa5, 0x42, 0x01, 0xc6, 0x81, 0x41, 0x09, 0xc6, 0x03, 0x01, 0xc5, 0x09, 0xc5, 0x01, 0xc6, 
+  0x09, 0xc5, 0x46, 0x09, 0xc6, 0x04, 0x09, 0xa6, 0x09, 0xa5, 0x0a, 0x05, 0x23, 0x28, 0x0a, 0x26, 
+  0x41, 0x0a, 0x07, 0x00, 0x01, 0xc5, 0x80, 0x03, 0x1a, 0xa7, 0x00, 0xc1, 0x00, 0x81, 0x00, 0x80, 
+  0x41, 0x00, 0x40, 0x03, 0x00, 0x20, 0x00, 0x81, 0x09, 0x85, 0x01, 0xa6, 0x41, 0x01, 0xc6, 0x41, 
+  0x09, 0xe6, 0x06, 0x01, 0xe7, 0x09, 0xe7, 0x01, 0xe6, 0x0a, 0x06, 0x12, 0xe8, 0x12, 0x87, 0x01, 
+  0xe6, 0x83, 0x00, 0x0a, 0x07, 0x43, 0x01, 0xc6, 0x03, 0x01, 0xe5, 0x1a, 0xe8, 0x1b, 0x08, 0x02, 
+  0x05, 0x41, 0x01, 0xa5, 0x09, 0x01, 0xa6, 0x01, 0xc6, 0x01, 0xc5, 0x01, 0xe5, 0x12, 0xc7, 0x1b, 
+  0x28, 0x12, 0xe7, 0x09, 0xe4, 0x00, 0xc2, 0x00, 0x81, 0x46, 0x00, 0x61, 0x41, 0x08, 0x81, 0x41, 
+  0x00, 0x61, 0x43, 0x00, 0x41, 0x01, 0x00, 0xa2, 0x09, 0xa5, 0x41, 0x01, 0xe6, 0x02, 0x09, 0xc6, 
+  0x00, 0xa1, 0x00, 0x20, 0x44, 0x00, 0x00, 0x0a, 0x00, 0x20, 0x12, 0x05, 0x23, 0x68, 0x1b, 0x48, 
+  0x23, 0x68, 0x23, 0xa9, 0x1a, 0xa7, 0x00, 0xc2, 0x00, 0x61, 0x00, 0x41, 0x08, 0x81, 0x41, 0x00, 
+  0x81, 0x41, 0x00, 0xa1, 0x01, 0x08, 0xe2, 0x00, 0xa1, 0x41, 0x00, 0x41, 0x41, 0x00, 0x61, 0x00, 
+  0x08, 0x81, 0x42, 0x00, 0x81, 0x00, 0x00, 0x61, 0x41, 0x00, 0x81, 0x45, 0x00, 0x61, 0x06, 0x00, 
+  0xa2, 0x09, 0xc5, 0x1b, 0x49, 0x12, 0xc7, 0x02, 0x26, 0x09, 0x85, 0x08, 0xa2, 0x43, 0x00, 0x41, 
+  0x01, 0x00, 0x61, 0x09, 0x44, 0x41, 0x0a, 0x07, 0x01, 0x09, 0x24, 0x00, 0x82, 0x41, 0x00, 0x61, 
+  0x03, 0x00, 0x41, 0x08, 0xa2, 0x09, 0x04, 0x00, 0x41, 0x45, 0x00, 0x00, 0x42, 0x00, 0x20, 0x44, 
+  0x00, 0x00, 0x04, 0x00, 0x40, 0x09, 0x85, 0x0a, 0x06, 0x09, 0xc6, 0x09, 0x03, 0x41, 0x00, 0x61, 
+  0x41, 0x00, 0x41, 0x41, 0x00, 0x61, 0x02, 0x00, 0x81, 0x08, 0xc1, 0x00, 0x81, 0x42, 0x00, 0x61, 
+  0x43, 0x00, 0x41, 0x05, 0x00, 0xe3, 0x09, 0xe6, 0x02, 0x27, 0x02, 0x07, 0x12, 0x48, 0x09, 0x03, 
+  0x42, 0x00, 0x00, 0x41, 0x18, 0x20, 0x06, 0x08, 0x00, 0x08, 0x20, 0x08, 0x81, 0x12, 0x06, 0x12, 
+  0xc8, 0x09, 0xe5, 0x00, 0x81, 0x42, 0x00, 0x61, 0x03, 0x00, 0xa1, 0x08, 0xa1, 0x00, 0x61, 0x00, 
+  0x41, 0x42, 0x00, 0x61, 0x02, 0x00, 0x81, 0x08, 0xc2, 0x08, 0x81, 0x42, 0x00, 0x61, 0x00, 0x08, 
+  0x81, 0x41, 0x00, 0x81, 0x02, 0x09, 0x03, 0x09, 0x44, 0x00, 0x61, 0x46, 0x00, 0x00, 0x01, 0x08, 
+  0xc3, 0x09, 0xc5, 0x42, 0x01, 0xe6, 0x03, 0x09, 0x64, 0x00, 0x82, 0x00, 0x61, 0x00, 0x81, 0x4b, 
+  0x00, 0x61, 0x07, 0x00, 0x81, 0x08, 0xe2, 0x00, 0xc2, 0x09, 0x24, 0x09, 0xc6, 0x01, 0xa5, 0x12, 
+  0x87, 0x09, 0x23, 0x46, 0x00, 0x00, 0x01, 0x00, 0xa2, 0x09, 0x85, 0x82, 0x41, 0x01, 0xe6, 0x41, 
+  0x09, 0xe7, 0x05, 0x01, 0xc6, 0x0a, 0x06, 0x23, 0x08, 0x12, 0xa7, 0x01, 0xc6, 0x09, 0xe6, 0x42, 
+  0x0a, 0x07, 0x00, 0x12, 0x87, 0x41, 0x12, 0xa7, 0x03, 0x12, 0x87, 0x1b, 0x08, 0x1b, 0x28, 0x02, 
+  0x06, 0x41, 0x01, 0xc6, 0x00, 0x0a, 0x46, 0x41, 0x12, 0x87, 0x42, 0x12, 0xa7, 0x02, 0x12, 0xc7, 
+  0x12, 0x66, 0x00, 0xe2, 0x51, 0x00, 0x00, 0x06, 0x00, 0xa2, 0x09, 0xc6, 0x0a, 0x27, 0x00, 0xc2, 
+  0x00, 0x20, 0x10, 0x20, 0x48, 0xc3, 0x41, 0x48, 0xc4, 0x09, 0x40, 0xc4, 0x10, 0x41, 0x00, 0x00, 
+  0x00, 0x20, 0x01, 0x42, 0x0a, 0x46, 0x0a, 0x66, 0x0a, 0x05, 0x00, 0xe1, 0x00, 0x20, 0x5a, 0x00, 
+  0x00, 0x04, 0x00, 0x81, 0x0a, 0x06, 0x0a, 0x46, 0x09, 0x85, 0x00, 0x61, 0x45, 0x00, 0x00, 0x00, 
+  0x00, 0x40, 0x41, 0x09, 0x44, 0x00, 0x00, 0x20, 0x46, 0x00, 0x00, 0x05, 0x08, 0x00, 0x40, 0xe4, 
+  0x48, 0xe4, 0x48, 0xc4, 0x40, 0xe4, 0x10, 0x40, 0x41, 0x00, 0x00, 0x09, 0x08, 0x00, 0x38, 0xa3, 
+  0x48, 0xc4, 0x48, 0xc3, 0x40, 0xc3, 0x10, 0x40, 0x00, 0x00, 0x00, 0x61, 0x09, 0x84, 0x00, 0xe2, 
+  0x51, 0x00, 0x00, 0x04, 0x08, 0xe3, 0x09, 0xe6, 0x0a, 0x07, 0x09, 0x44, 0x00, 0x20, 0x80, 0x09, 
+  0x30, 0x83, 0x40, 0xa4, 0x48, 0xa4, 0x50, 0xc4, 0x48, 0xa3, 0x08, 0x00, 0x00, 0x20, 0x00, 0xe2, 
+  0x12, 0x05, 0x00, 0xa1, 0x57, 0x00, 0x00, 0x04, 0x29, 0xe4, 0x32, 0x45, 0x32, 0x24, 0x32, 0x25, 
+  0x21, 0x83, 0x41, 0x00, 0x00, 0x04, 0x01, 0x03, 0x0a, 0x07, 0x0a, 0x06, 0x09, 0x64, 0x00, 0x40, 
+  0x51, 0x00, 0x00, 0x0a, 0x00, 0x20, 0x00, 0xc2, 0x09, 0xc5, 0x09, 0x03, 0x00, 0x00, 0x00, 0x20, 
+  0x32, 0x05, 0x3a, 0x45, 0x32, 0x25, 0x3a, 0x45, 0x11, 0x02, 0x80, 0x01, 0x00, 0x20, 0x09, 0x24, 
+  0x80, 0x00, 0x01, 0xe6, 0x83, 0x05, 0x01, 0xe6, 0x09, 0xe7, 0x09, 0xe6, 0x0a, 0x06, 0x1b, 0x08, 
+  0x12, 0x87, 0x41, 0x09, 0xe6, 0x00, 0x09, 0xe7, 0x80, 0x42, 0x1a, 0xe8, 0x41, 0x1a, 0xe7, 0x05, 
+  0x0a, 0x46, 0x01, 0xe6, 0x01, 0xa6, 0x02, 0x06, 0x1a, 0xe8, 0x12, 0xc7, 0x42, 0x1a, 0xe8, 0x41, 
+  0x1b, 0x08, 0x05, 0x11, 0xa4, 0x00, 0x00, 0x20, 0x61, 0x59, 0x05, 0x50, 0xe4, 0x51, 0x05, 0x44, 
+  0x59, 0x05, 0x00, 0x59, 0x04, 0x43, 0x58, 0xe4, 0x42, 0x50, 0xe4, 0x14, 0x18, 0x41, 0x00, 0x00, 
+  0x08, 0xe3, 0x09, 0x44, 0x00, 0x40, 0x10, 0x20, 0x71, 0x05, 0xb9, 0xaa, 0xc1, 0x6a, 0xc1, 0x69, 
+  0xc1, 0x8a, 0x81, 0x47, 0x28, 0x82, 0x00, 0x00, 0x00, 0x61, 0x09, 0x64, 0x09, 0x85, 0x00, 0xc2, 
+  0x00, 0x40, 0x08, 0x20, 0x48, 0xe4, 0x41, 0x50, 0xe4, 0x41, 0x58, 0xe4, 0x43, 0x59, 0x05, 0x02, 
+  0x59, 0x04, 0x58, 0xe4, 0x59, 0x04, 0x41, 0x59, 0x05, 0x00, 0x59, 0x04, 0x47, 0x59, 0x05, 0x0a, 
+  0x59, 0x04, 0x50, 0xe4, 0x59, 0x05, 0x40, 0xc3, 0x00, 0x00, 0x08, 0xc2, 0x09, 0x65, 0x08, 0x82, 
+  0x00, 0x00, 0x08, 0x20, 0x40, 0xc4, 0x42, 0x48, 0xc4, 0x09, 0x20, 0x61, 0x00, 0x00, 0x00, 0x20, 
+  0x00, 0x00, 0x18, 0x20, 0x61, 0x05, 0x60, 0xe5, 0x58, 0xe4, 0x48, 0xe4, 0x10, 0x20, 0x81, 0x06, 
+  0x58, 0xe4, 0xb9, 0xaa, 0xc9, 0x8a, 0xc1, 0x8a, 0xc9, 0xaa, 0x71, 0x26, 0x10, 0x20, 0x80, 0x01, 
+  0x58, 0xc4, 0xb9, 0x89, 0x41, 0xc9, 0x8a, 0x08, 0xc1, 0xaa, 0x69, 0x05, 0x08, 0x20, 0x00, 0x20, 
+  0x00, 0x61, 0x00, 0x00, 0x20, 0x61, 0x50, 0xe4, 0x50, 0xc4, 0x42, 0x50, 0xe4, 0x00, 0x58, 0xe4, 
+  0x47, 0x58, 0xe5, 0x09, 0x58, 0xe4, 0x59, 0x05, 0x20, 0x61, 0x00, 0x00, 0x00, 0x81, 0x08, 0xe3, 
+  0x00, 0x20, 0x00, 0x00, 0x48, 0xa3, 0xb9, 0x89, 0x41, 0xc9, 0x6a, 0x08, 0xd1, 0x8a, 0xc1, 0x69, 
+  0x58, 0xc4, 0x08, 0x20, 0x00, 0x40, 0x08, 0x81, 0x00, 0x00, 0x19, 0x43, 0x3a, 0xc6, 0x42, 0x3a, 
+  0xa5, 0x47, 0x3a, 0x85, 0x41, 0x3a, 0xa5, 0x01, 0x3a, 0x85, 0x3a, 0xa5, 0x41, 0x3a, 0x85, 0x00, 
+  0x32, 0x25, 0x82, 0x01, 0x3a, 0x65, 0x85, 0x8a, 0x41, 0x85, 0xc9, 0x02, 0x85, 0xea, 0x75, 0x09, 
+  0x29, 0xc4, 0x80, 0x00, 0x00, 0x61, 0x41, 0x09, 0x03, 0x04, 0x00, 0x41, 0x00, 0x00, 0x00, 0x60, 
+  0x3a, 0x86, 0x3a, 0x85, 0x41, 0x3a, 0xa5, 0x42, 0x3a, 0x85, 0x42, 0x3a, 0xa5, 0x44, 0x3a, 0x85, 
+  0x05, 0x3a, 0xc5, 0x32, 0x24, 0x00, 0x00, 0x00, 0x40, 0x00, 0xa2, 0x00, 0x20, 0x80, 0x06, 0x42, 
+  0xc6, 0x85, 0xaa, 0x85, 0xe9, 0x85, 0xc9, 0x86, 0x0a, 0x64, 0x68, 0x32, 0x45, 0x80, 0x01, 0x00, 
+  0x61, 0x01, 0xc5, 0x45, 0x01, 0xe6, 0x81, 0x05, 0x01, 0xc6, 0x0a, 0x06, 0x1b, 0x08, 0x12, 0xc8, 
+  0x01, 0xe6, 0x09, 0xe6, 0x80, 0x00, 0x01, 0xc5, 0x42, 0x01, 0xc6, 0x00, 0x01, 0xc5, 0x41, 0x01, 
+  0xc6, 0x04, 0x02, 0x06, 0x1a, 0xe8, 0x0a, 0x46, 0x01, 0xa5, 0x01, 0xc5, 0x41, 0x01, 0xc6, 0x05, 
+  0x01, 0xe6, 0x01, 0xc5, 0x00, 0x20, 0x18, 0x41, 0x89, 0x67, 0xc1, 0xaa, 0x41, 0xc1, 0x89, 0x4b, 
+  0xc1, 0x69, 0x02, 0xc1, 0x89, 0x89, 0x47, 0x28, 0x82, 0x41, 0x00, 0x20, 0x02, 0x00, 0x00, 0x28, 
+  0x62, 0xb9, 0xaa, 0x43, 0xc1, 0x28, 0x01, 0xc9, 0x8a, 0x69, 0x46, 0x80, 0x00, 0x00, 0x20, 0x41, 
+  0x00, 0x00, 0x04, 0x00, 0x20, 0x08, 0x20, 0x69, 0x05, 0xb9, 0xa9, 0xc1, 0x89, 0x46, 0xc1, 0x69, 
+  0x50, 0xc1, 0x89, 0x18, 0xb1, 0x89, 0x58, 0xe4, 0x08, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 
+  0x61, 0x05, 0xb9, 0xa9, 0xc1, 0x69, 0xb9, 0x69, 0xb9, 0x89, 0x91, 0x47, 0x28, 0x62, 0x00, 0x00, 
+  0x10, 0x20, 0x81, 0x26, 0xc9, 0xaa, 0xc9, 0x69, 0xc1, 0x69, 0xb9, 0x8a, 0x79, 0x46, 0x10, 0x20, 
+  0x08, 0x00, 0xa1, 0x89, 0xc9, 0x29, 0x42, 0xc1, 0x28, 0x09, 0xb9, 0x8a, 0x28, 0x82, 0x10, 0x00, 
+  0xa9, 0x69, 0xc1, 0x29, 0xc1, 0x48, 0xc1, 0x28, 0xc1, 0x49, 0xb1, 0x89, 0x20, 0x61, 0x41, 0x00, 
+  0x00, 0x03, 0x18, 0x41, 0x91, 0x67, 0xc9, 0xaa, 0xc1, 0x89, 0x48, 0xc1, 0x69, 0x00, 0xc9, 0x69, 
+  0x41, 0xc9, 0x89, 0x03, 0xc1, 0x89, 0xc9, 0x8a, 0x91, 0x47, 0x20, 0x62, 0x43, 0x00, 0x00, 0x01, 
+  0x99, 0x68, 0xc9, 0x49, 0x42, 0xc1, 0x28, 0x02, 0xc9, 0x49, 0xa9, 0xa9, 0x18, 0x41, 0x41, 0x00, 
+  0x00, 0x02, 0x19, 0x43, 0x6c, 0xc9, 0x85, 0xe9, 0x41, 0x85, 0xc8, 0x01, 0x7d, 0xc8, 0x7d, 0xa8, 
+  0x43, 0x7d, 0x88, 0x47, 0x7d, 0xa8, 0x03, 0x85, 0xa8, 0x85, 0x89, 0x42, 0xe6, 0x00, 0x20, 0x80, 
+  0x06, 0x74, 0xc9, 0x7d, 0xa7, 0x75, 0x46, 0x75, 0x66, 0x75, 0x46, 0x7d, 0xc8, 0x6c, 0x4a, 0x44, 
+  0x00, 0x00, 0x02, 0x08, 0x61, 0x53, 0x67, 0x85, 0xc9, 0x45, 0x7d, 0xc8, 0x41, 0x85, 0xc8, 0x42, 
+  0x7d, 0xc8, 0x43, 0x85, 0xc8, 0x01, 0x7d, 0x89, 0x42, 0xc6, 0x42, 0x00, 0x00, 0x07, 0x00, 0x20, 
+  0x74, 0xe9, 0x75, 0x87, 0x75, 0x46, 0x75, 0x66, 0x75, 0x46, 0x7d, 0xc8, 0x7d, 0x2a, 0x41, 0x00, 
+  0x40, 0x81, 0x00, 0x01, 0xc6, 0x82, 0x00, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x06, 0x09, 0xe7, 0x09, 
+  0xe6, 0x0a, 0x06, 0x1b, 0x28, 0x12, 0xc7, 0x01, 0xe6, 0x09, 0xe6, 0x43, 0x01, 0xe6, 0x00, 0x09, 
+  0xe6, 0x80, 0x03, 0x0a, 0x46, 0x1b, 0x48, 0x12, 0xa7, 0x01, 0xe6, 0x43, 0x01, 0xc6, 0x80, 0x00, 
+  0x09, 0xc6, 0x80, 0x01, 0x30, 0x82, 0xc1, 0xaa, 0x43, 0xc1, 0x28, 0x02, 0xc9, 0x28, 0xc1, 0x28, 
+  0xc9, 0x28, 0x48, 0xc1, 0x28, 0x02, 0xc9, 0xaa, 0x60, 0xe4, 0x00, 0x00, 0x81, 0x01, 0x30, 0x42, 
+  0xb9, 0x69, 0x42, 0xc1, 0x49, 0x02, 0xc1, 0x48, 0xc9, 0x6a, 0x69, 0x06, 0x84, 0x02, 0x10, 0x20, 
+  0xa1, 0x68, 0xc9, 0x49, 0x4b, 0xc1, 0x28, 0x02, 0xc1, 0x48, 0xc1, 0x49, 0xc1, 0x48, 0x41, 0xc1, 
+  0x28, 0x00, 0xc9, 0x28, 0x43, 0xc1, 0x28, 0x00, 0xc9, 0x28, 0x41, 0xc1, 0x28, 0x02, 0xc9, 0x49, 
+  0x81, 0x47, 0x00, 0x00, 0x81, 0x02, 0x08, 0x20, 0xa1, 0x88, 0xc9, 0x49, 0x41, 0xc1, 0x28, 0x02, 
+  0xc1, 0x08, 0xc1, 0x8a, 0x48, 0xc4, 0x80, 0x03, 0x18, 0x41, 0xb9, 0x69, 0xc9, 0x49, 0xc1, 0x48, 
+  0x41, 0xc1, 0x28, 0x01, 0xb9, 0xaa, 0x20, 0x62, 0x80, 0x01, 0xa1, 0x68, 0xc9, 0x49, 0x42, 0xc1, 
+  0x49, 0x01, 0xb9, 0x89, 0x28, 0x62, 0x80, 0x00, 0xa9, 0x48, 0x43, 0xc1, 0x49, 0x80, 0x00, 0x28, 
+  0x61, 0x81, 0x03, 0x30, 0x62, 0xb9, 0x89, 0xc9, 0x49, 0xc1, 0x49, 0x45, 0xc1, 0x28, 0x41, 0xc1, 
+  0x08, 0x41, 0xc1, 0x28, 0x05, 0xc9, 0x48, 0xc1, 0x29, 0xc1, 0x49, 0xc1, 0x28, 0xc9, 0x8a, 0x50, 
+  0xe4, 0x82, 0x01, 0x08, 0x00, 0xa1, 0x48, 0x80, 0x42, 0xc1, 0x49, 0x80, 0x00, 0xa9, 0x89, 0x80, 
+  0x00, 0x00, 0x20, 0x80, 0x02, 0x32, 0x45, 0x85, 0xc9, 0x75, 0x46, 0x43, 0x75, 0x66, 0x00, 0x6d, 
+  0x46, 0x43, 0x75, 0x46, 0x42, 0x75, 0x66, 0x00, 0x75, 0x46, 0x42, 0x75, 0x66, 0x02, 0x75, 0x46, 
+  0x7d, 0x87, 0x74, 0xca, 0x41, 0x00, 0x20, 0x00, 0x6c, 0xa9, 0x80, 0x41, 0x75, 0x67, 0x02, 0x75, 
+  0x66, 0x7d, 0xa7, 0x64, 0x08, 0x80, 0x42, 0x00, 0x20, 0x81, 0x00, 0x75, 0x0a, 0x4a, 0x75, 0x66, 
+  0x43, 0x75, 0x86, 0x02, 0x6d, 0x46, 0x7d, 0xc8, 0x64, 0x28, 0x80, 0x00, 0x00, 0x20, 0x81, 0x00, 
+  0x6c, 0xa8, 0x80, 0x41, 0x75, 0x67, 0x02, 0x75, 0x87, 0x7d, 0xa7, 0x6c, 0xa9, 0x80, 0x02, 0x00, 
+  0x41, 0x09, 0xa6, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x41, 0x09, 0xe7, 0x80, 0x00, 0x09, 0xe6, 0x41, 
+  0x09, 0xe7, 0x03, 0x09, 0xe6, 0x0a, 0x46, 0x23, 0x49, 0x1a, 0xe8, 0x80, 0x42, 0x01, 0xc6, 0x41, 
+  0x01, 0xe6, 0x05, 0x0a, 0x46, 0x1b, 0x28, 0x12, 0xa7, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0xe5, 0x42, 
+  0x01, 0xc5, 0x01, 0x01, 0xe5, 0x09, 0xc5, 0x80, 0x01, 0x30, 0x62, 0xb9, 0x89, 0x80, 0x45, 0xc1, 
+  0x49, 0x42, 0xc1, 0x48, 0x41, 0xc1, 0x49, 0x41, 0xc1, 0x69, 0x41, 0xc1, 0x49, 0x01, 0xc9, 0x8a, 
+  0x58, 0xe4, 0x82, 0x01, 0x30, 0x62, 0xb9, 0x89, 0x43, 0xc1, 0x49, 0x01, 0xc9, 0x8a, 0x71, 0x26, 
+  0x83, 0x03, 0x00, 0x00, 0x08, 0x00, 0x91, 0x47, 0xc9, 0x69, 0x41, 0xc1, 0x49, 0x00, 0xc1, 0x48, 
+  0x80, 0x46, 0xc1, 0x49, 0x00, 0xc9, 0x49, 0x44, 0xc1, 0x49, 0x00, 0xc1, 0x48, 0x43, 0xc1, 0x49, 
+  0x01, 0xc1, 0x29, 0xc1, 0x48, 0x80, 0x01, 0xc1, 0x49, 0x79, 0x26, 0x81, 0x00, 0x00, 0x20, 0x80, 
+  0x06, 0x99, 0x68, 0xc9, 0x69, 0xc1, 0x48, 0xc1, 0x49, 0xc1, 0x28, 0xc1, 0x69, 0x40, 0xa3, 0x80, 
+  0x01, 0x18, 0x20, 0xa9, 0x48, 0x80, 0x42, 0xc1, 0x49, 0x01, 0xb9, 0x89, 0x28, 0x62, 0x81, 0x43, 
+  0xc1, 0x49, 0x80, 0x00, 0x30, 0x62, 0x80, 0x00, 0xa9, 0x68, 0x89, 0x43, 0xc1, 0x49, 0x00, 0xc1, 
+  0x48, 0x80, 0x46, 0xc1, 0x49, 0x00, 0xc1, 0x69, 0x80, 0x02, 0xc1, 0x48, 0xc9, 0x69, 0x58, 0xc4, 
+  0x80, 0x00, 0x00, 0x20, 0x81, 0x01, 0xa1, 0x68, 0xc9, 0x69, 0x87, 0x01, 0x2a, 0x04, 0x7d, 0x89, 
+  0x4e, 0x75, 0x67, 0x41, 0x75, 0x87, 0x00, 0x75, 0x67, 0x80, 0x01, 0x64, 0x68, 0x00, 0x00, 0x85, 
+  0x01, 0x7d, 0xc7, 0x64, 0x28, 0x82, 0x41, 0x00, 0x00, 0x01, 0x08, 0x41, 0x6c, 0xc9, 0x4e, 0x75, 
+  0x87, 0x00, 0x75, 0x67, 0x80, 0x00, 0x5b, 0xc7, 0x42, 0x00, 0x00, 0x81, 0x00, 0x7d, 0xa7, 0x80, 
+  0x41, 0x75, 0x87, 0x01, 0x7d, 0xc7, 0x6c, 0xc9, 0x82, 0x42, 0x01, 0xe6, 0x01, 0x01, 0xe7, 0x09, 
+  0xe6, 0x42, 0x01, 0xe7, 0x00, 0x09, 0xe6, 0x80, 0x04, 0x0a, 0x07, 0x01, 0xe6, 0x0a, 0x47, 0x1b, 
+  0x28, 0x12, 0x87, 0x42, 0x02, 0x06, 0x41, 0x02, 0x26, 0x02, 0x1b, 0x28, 0x12, 0xc7, 0x02, 0x06, 
+  0x80, 0x01, 0x0a, 0x66, 0x1b, 0x08, 0x42, 0x1a, 0xe8, 0x01, 0x1b, 0x08, 0x1a, 0xa7, 0x80, 0x02, 
+  0x28, 0x62, 0xb1, 0x89, 0xc1, 0x49, 0x41, 0xc1, 0x69, 0x80, 0x41, 0xc9, 0x49, 0x45, 0xc1, 0x49, 
+  0x81, 0x00, 0xc9, 0x69, 0x85, 0x00, 0x30, 0x42, 0x85, 0x00, 0x69, 0x26, 0x87, 0x41, 0xc1, 0x69, 
+  0x44, 0xc1, 0x49, 0x41, 0xc1, 0x69, 0x82, 0x41, 0xc1, 0x69, 0x00, 0xc9, 0x49, 0x42, 0xc1, 0x49, 
+  0x42, 0xc9, 0x49, 0x43, 0xc1, 0x49, 0x01, 0xc1, 0x69, 0x79, 0x46, 0x81, 0x00, 0x00, 0x00, 0x80, 
+  0x03, 0x99, 0x88, 0xc9, 0x49, 0xc9, 0x48, 0xc9, 0x49, 0x80, 0x01, 0xc1, 0x8a, 0x40, 0xc4, 0x81, 
+  0x00, 0xa9, 0x68, 0x41, 0xc1, 0x49, 0x00, 0xc1, 0x69, 0x80, 0x00, 0xc1, 0xaa, 0x87, 0x00, 0x30, 
+  0x82, 0x80, 0x00, 0xa9, 0x69, 0x84, 0x00, 0x28, 0x62, 0x81, 0x00, 0x30, 0x82, 0x84, 0x43, 0xc1, 
+  0x49, 0x01, 0xc9, 0x49, 0xc1, 0x69, 0x45, 0xc1, 0x49, 0x01, 0xc9, 0x89, 0x60, 0xc4, 0x42, 0x00, 
+  0x00, 0x8b, 0x00, 0x7d, 0xa9, 0x80, 0x41, 0x75, 0x87, 0x80, 0x42, 0x75, 0x87, 0x80, 0x43, 0x75, 
+  0x87, 0x45, 0x7d, 0x87, 0x01, 0x7d, 0xc8, 0x6c, 0x89, 0x8d, 0x02, 0x00, 0x20, 0x3b, 0x46, 0x6d, 
+  0x49, 0x42, 0x6d, 0x48, 0x01, 0x65, 0x48, 0x6d, 0x48, 0x42, 0x65, 0x48, 0x41, 0x6d, 0x48, 0x44, 
+  0x75, 0x87, 0x87, 0x42, 0x75, 0x87, 0x01, 0x7d, 0xa7, 0x6c, 0xc8, 0x81, 0x00, 0x01, 0xc6, 0x48, 
+  0x01, 0xe6, 0x41, 0x09, 0xe7, 0x03, 0x0a, 0x07, 0x09, 0xe6, 0x0a, 0x46, 0x23, 0x28, 0x00, 0x1b, 
+  0x29, 0x42, 0x23, 0x29, 0x07, 0x23, 0x49, 0x12, 0xc7, 0x02, 0x06, 0x01, 0xe6, 0x0a, 0x86, 0x23, 
+  0x69, 0x12, 0xc7, 0x02, 0x05, 0x42, 0x01, 0xe5, 0x04, 0x09, 0xa4, 0x00, 0x00, 0x10, 0x00, 0x80, 
+  0xc5, 0xa9, 0x28, 0x41, 0xb1, 0x28, 0x46, 0xb1, 0x08, 0x81, 0x00, 0xc9, 0x49, 0x83, 0x00, 0x58, 
+  0xe5, 0x83, 0x01, 0xb9, 0x69, 0xc9, 0x49, 0x80, 0x00, 0xc9, 0x49, 0x88, 0x01, 0x81, 0x06, 0xb9, 
+  0x29, 0x41, 0xb1, 0x28, 0x45, 0xb1, 0x08, 0x00, 0xb9, 0x28, 0x46, 0xc1, 0x49, 0x00, 0xb9, 0x28, 
+  0x44, 0xb1, 0x08, 0x04, 0xb9, 0x28, 0xb1, 0x28, 0xb9, 0x28, 0xa9, 0x08, 0x58, 0xa4, 0x83, 0x00, 
+  0x99, 0x68, 0x42, 0xc9, 0x49, 0x80, 0x00, 0xc9, 0x8a, 0x89, 0x00, 0x00, 0x00, 0x81, 0x00, 0xb9, 
+  0x49, 0x80, 0x00, 0xc9, 0x49, 0x80, 0x00, 0x30, 0x62, 0x81, 0x00, 0xc9, 0x49, 0x86, 0x03, 0x28, 
+  0x41, 0x99, 0x07, 0xb1, 0x28, 0xa9, 0x08, 0x41, 0xb1, 0x08, 0x45, 0xb1, 0x28, 0x00, 0xb9, 0x48, 
+  0x84, 0x00, 0xc9, 0x6a, 0x81, 0x00, 0x00, 0x20, 0x81, 0x00, 0x99, 0x68, 0x80, 0x00, 0xc1, 0x69, 
+  0x82, 0x00, 0xa9, 0x69, 0x80, 0x41, 0x00, 0x00, 0x04, 0x09, 0x83, 0x4c, 0x68, 0x65, 0x08, 0x5c, 
+  0xe8, 0x5d, 0x08, 0x42, 0x65, 0x08, 0x45, 0x5d, 0x08, 0x00, 0x5d, 0x28, 0x42, 0x65, 0x28, 0x41, 
+  0x65, 0x08, 0x01, 0x5d, 0x29, 0x2b, 0x26, 0x41, 0x00, 0x20, 0x00, 0x6c, 0xc9, 0x81, 0x01, 0x6d, 
+  0x67, 0x6d, 0x66, 0x82, 0x43, 0x00, 0x00, 0x02, 0x00, 0x40, 0x1b, 0x27, 0x13, 0x67, 0x44, 0x13, 
+  0x46, 0x42, 0x0b, 0x46, 0x03, 0x13, 0x46, 0x0b, 0x04, 0x4c, 0x86, 0x7d, 0xa7, 0x82, 0x00, 0x85, 
+  0xe8, 0x86, 0x00, 0x75, 0x86, 0x82, 0x00, 0x6c, 0xa8, 0x81, 0x00, 0x09, 0xa6, 0x41, 0x01, 0xc6, 
+  0x82, 0x00, 0x01, 0xe7, 0x81, 0x00, 0x09, 0xe6, 0x42, 0x09, 0xe7, 0x02, 0x0a, 0x07, 0x09, 0xe6, 
+  0x0a, 0x06, 0x43, 0x01, 0xc5, 0x41, 0x01, 0xe5, 0x09, 0x01, 0xc6, 0x0a, 0x87, 0x23, 0x89, 0x12, 
+  0xa7, 0x01, 0xe5, 0x01, 0xc6, 0x01, 0xc5, 0x09, 0xe5, 0x0a, 0x05, 0x09, 0xa5, 0x80, 0x02, 0x18, 
+  0x21, 0x68, 0x64, 0x70, 0x24, 0x45, 0x78, 0x24, 0x00, 0x70, 0x44, 0x41, 0x78, 0x24, 0x01, 0xa8, 
+  0xe7, 0xc9, 0x69, 0x81, 0x00, 0xc1, 0x69, 0x83, 0x41, 0x00, 0x00, 0x81, 0x43, 0xc1, 0x49, 0x87, 
+  0x01, 0x60, 0x84, 0x80, 0x45, 0x41, 0x78, 0x45, 0x44, 0x78, 0x44, 0x02, 0x78, 0x24, 0x90, 0x86, 
+  0xc1, 0x69, 0x84, 0x03, 0xb9, 0x29, 0x88, 0x45, 0x78, 0x24, 0x78, 0x44, 0x41, 0x78, 0x24, 0x42, 
+  0x78, 0x44, 0x02, 0x70, 0x44, 0x78, 0x45, 0x50, 0x63, 0x42, 0x00, 0x00, 0x83, 0x02, 0xc1, 0x49, 
+  0xc9, 0x28, 0xc1, 0x8a, 0x88, 0x00, 0x28, 0x82, 0x82, 0x42, 0xc1, 0x49, 0x88, 0x00, 0x28, 0x61, 
+  0x81, 0x01, 0x20, 0x21, 0x78, 0x65, 0x42, 0x78, 0x24, 0x41, 0x70, 0x24, 0x06, 0x78, 0x24, 0x78, 
+  0x44, 0x78, 0x24, 0x78, 0x44, 0x80, 0x44, 0xa9, 0x07, 0xc9, 0x69, 0x80, 0x00, 0xc1, 0x28, 0x80, 
+  0x00, 0xc1, 0x29, 0x84, 0x01, 0x10, 0x00, 0xa1, 0x48, 0x80, 0x01, 0xc1, 0x49, 0xc1, 0x69, 0x81, 
+  0x00, 0xa9, 0x89, 0x82, 0x03, 0x09, 0xa4, 0x1b, 0x47, 0x0b, 0x05, 0x0b, 0x26, 0x42, 0x0b, 0x06, 
+  0x02, 0x0b, 0x26, 0x0b, 0x46, 0x13, 0x46, 0x43, 0x0b, 0x46, 0x42, 0x0b, 0x26, 0x04, 0x0b, 0x06, 
+  0x0b, 0x26, 0x13, 0x26, 0x13, 0x27, 0x1a, 0xc6, 0x84, 0x41, 0x75, 0x67, 0x01, 0x7d, 0xa7, 0x64, 
+  0x29, 0x85, 0x01, 0x1b, 0x07, 0x2b, 0xe8, 0x41, 0x23, 0x86, 0x01, 0x1b, 0x86, 0x23, 0x86, 0x44, 
+  0x23, 0xa6, 0x01, 0x1b, 0x65, 0x54, 0xa6, 0x89, 0x00, 0x6c, 0xc8, 0x80, 0x42, 0x75, 0x87, 0x80, 
+  0x00, 0x6c, 0xc9, 0x81, 0x01, 0x01, 0xa6, 0x01, 0xe6, 0x82, 0x44, 0x01, 0xe7, 0x45, 0x09, 0xe7, 
+  0x41, 0x12, 0x67, 0x43, 0x0a, 0x67, 0x09, 0x12, 0x87, 0x23, 0x49, 0x12, 0xe8, 0x02, 0x06, 0x01, 
+  0xe6, 0x0a, 0x26, 0x1b, 0x08, 0x12, 0xc7, 0x12, 0xa7, 0x12, 0x26, 0x80, 0x02, 0x08, 0x00, 0x60, 
+  0x84, 0x78, 0x65, 0x44, 0x70, 0x45, 0x42, 0x70, 0x65, 0x01, 0x78, 0x45, 0xb0, 0xe8, 0x41, 0xc9, 
+  0x49, 0x02, 0xc9, 0x69, 0xc1, 0x49, 0xc1, 0x28, 0x84, 0x00, 0x30, 0x62, 0x84, 0x00, 0xc1, 0x8a, 
+  0x85, 0x01, 0x00, 0x00, 0x48, 0x63, 0x44, 0x70, 0x65, 0x04, 0x78, 0x65, 0x70, 0x65, 0x78, 0x65, 
+  0x78, 0x45, 0x90, 0xc7, 0x85, 0x01, 0xc1, 0x49, 0x80, 0x65, 0x41, 0x70, 0x45, 0x41, 0x70, 0x65, 
+  0x43, 0x70, 0x45, 0x01, 0x60, 0x85, 0x30, 0x62, 0x85, 0x02, 0xc9, 0x29, 0xc1, 0x29, 0xc1, 0x28, 
+  0x82, 0x00, 0x18, 0x21, 0x80, 0x00, 0xc9, 0x49, 0x42, 0xc1, 0x49, 0x80, 0x00, 0x28, 0x62, 0x86, 
+  0x00, 0x28, 0x82, 0x80, 0x00, 0xa9, 0x68, 0x81, 0x41, 0xc1, 0x48, 0x00, 0xb1, 0x69, 0x82, 0x02, 
+  0x10, 0x20, 0x58, 0x84, 0x70, 0x65, 0x44, 0x70, 0x45, 0x01, 0x78, 0x65, 0x78, 0x45, 0x41, 0x78, 
+  0x65, 0x01, 0xa9, 0x08, 0xc9, 0x49, 0x81, 0x02, 0xc1, 0x29, 0xc1, 0x28, 0xc9, 0x69, 0x84, 0x00, 
+  0xa1, 0x68, 0x84, 0x00, 0xa9, 0x69, 0x82, 0x04, 0x09, 0x02, 0x1a, 0xc7, 0x13, 0x27, 0x0b, 0x27, 
+  0x34, 0x08, 0x41, 0x34, 0x28, 0x02, 0x3c, 0x48, 0x1b, 0xa7, 0x0b, 0x47, 0x42, 0x0b, 0x88, 0x01, 
+  0x13, 0x67, 0x34, 0x28, 0x42, 0x34, 0x27, 0x05, 0x1b, 0x67, 0x0b, 0x27, 0x13, 0x28, 0x11, 0xc4, 
+  0x00, 0x00, 0x00, 0x40, 0x81, 0x00, 0x75, 0x87, 0x81, 0x00, 0x7d, 0xa8, 0x86, 0x02, 0x43, 0x47, 
+  0x7d, 0xa9, 0x75, 0x68, 0x45, 0x75, 0x88, 0x42, 0x75, 0x68, 0x41, 0x75, 0x67, 0x81, 0x00, 0x75, 
+  0x67, 0x80, 0x00, 0x5b, 0xe8, 0x82, 0x00, 0x00, 0x40, 0x88, 0x00, 0x01, 0xc6, 0x81, 0x00, 0x01, 
+  0xc6, 0x41, 0x01, 0xe6, 0x82, 0x45, 0x09, 0xe7, 0x00, 0x0a, 0x07, 0x01, 0x12, 0xc7, 0x12, 0xc8, 
+  0x44, 0x12, 0xc7, 0x03, 0x12, 0x87, 0x02, 0x06, 0x01, 0xe6, 0x0a, 0x46, 0x41, 0x12, 0xe7, 0x08, 
+  0x0a, 0x25, 0x01, 0xa5, 0x01, 0x85, 0x00, 0x61, 0x00, 0x00, 0x28, 0x41, 0x58, 0x84, 0x50, 0x64, 
+  0x50, 0x63, 0x43, 0x48, 0x63, 0x04, 0x48, 0x84, 0x50, 0x84, 0x60, 0x64, 0xa9, 0x07, 0xd1, 0x69, 
+  0x41, 0xc9, 0x49, 0x80, 0x00, 0xc1, 0x29, 0x82, 0x00, 0x00, 0x20, 0x86, 0x00, 0xc9, 0x8a, 0x81, 
+  0x44, 0x00, 0x00, 0x01, 0x08, 0x00, 0x40, 0x63, 0x42, 0x48, 0x63, 0x43, 0x50, 0x84, 0x02, 0x50, 
+  0x63, 0xa1, 0x28, 0xc9, 0x69, 0x83, 0x0b, 0xc9, 0x49, 0xb9, 0x49, 0x60, 0x44, 0x48, 0x63, 0x50, 
+  0x64, 0x58, 0x84, 0x50, 0x84, 0x50, 0x64, 0x48, 0x84, 0x48, 0x64, 0x50, 0x84, 0x40, 0x83, 0x43, 
+  0x00, 0x00, 0x03, 0x10, 0x00, 0xa1, 0x68, 0xc9, 0x29, 0xc1, 0x28, 0x81, 0x01, 0xc9, 0x69, 0x48, 
+  0x83, 0x80, 0x01, 0x20, 0x20, 0xb1, 0x68, 0x82, 0x00, 0xc1, 0x48, 0x81, 0x00, 0x08, 0x00, 0x80, 
+  0x00, 0xc9, 0x49, 0x81, 0x00, 0xc1, 0x48, 0x80, 0x00, 0x30, 0x62, 0x80, 0x00, 0xa9, 0x69, 0x82, 
+  0x00, 0xc9, 0x49, 0x83, 0x02, 0x00, 0x00, 0x18, 0x21, 0x48, 0x84, 0x44, 0x48, 0x63, 0x43, 0x50, 
+  0x84, 0x01, 0x99, 0x27, 0xc9, 0x69, 0x41, 0xc1, 0x49, 0x84, 0x41, 0x00, 0x00, 0x80, 0x00, 0x99, 
+  0x48, 0x80, 0x41, 0xc1, 0x69, 0x81, 0x00, 0xa9, 0x89, 0x82, 0x03, 0x00, 0x00, 0x08, 0xc2, 0x09, 
+  0x84, 0x33, 0x87, 0x42, 0x75, 0x88, 0x02, 0x7d, 0x88, 0x5c, 0xe8, 0x1b, 0x06, 0x42, 0x0a, 0x24, 
+  0x01, 0x44, 0x28, 0x75, 0xa9, 0x42, 0x75, 0x88, 0x02, 0x54, 0x88, 0x12, 0x04, 0x09, 0x63, 0x41, 
+  0x00, 0x00, 0x84, 0x01, 0x75, 0x66, 0x7d, 0xa7, 0x83, 0x00, 0x00, 0x20, 0x80, 0x03, 0x08, 0xa1, 
+  0x85, 0x6b, 0x75, 0x87, 0x75, 0x46, 0x41, 0x75, 0x66, 0x42, 0x75, 0x67, 0x00, 0x75, 0x87, 0x42, 
+  0x75, 0x67, 0x41, 0x75, 0x47, 0x00, 0x75, 0x67, 0x81, 0x01, 0x7d, 0xa9, 0x4b, 0xa7, 0x80, 0x00, 
+  0x00, 0x20, 0x85, 0x00, 0x75, 0x67, 0x80, 0x01, 0x6c, 0xa9, 0x00, 0x20, 0x80, 0x00, 0x09, 0xa6, 
+  0x81, 0x45, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x82, 0x00, 0x01, 0xe7, 0x81, 0x46, 0x01, 0xa4, 0x41, 
+  0x01, 0xc5, 0x03, 0x0a, 0x26, 0x1b, 0x48, 0x12, 0xa7, 0x01, 0xe5, 0x41, 0x01, 0xe6, 0x04, 0x12, 
+  0x87, 0x11, 0xe5, 0x00, 0x61, 0x00, 0x00, 0x08, 0x00, 0x46, 0x00, 0x00, 0x03, 0x08, 0x20, 0x08, 
+  0x00, 0x89, 0x06, 0xd1, 0x6a, 0x42, 0xc1, 0x49, 0x86, 0x01, 0xb9, 0x89, 0xc9, 0x49, 0x85, 0x00, 
+  0x00, 0x20, 0x49, 0x00, 0x00, 0x05, 0x08, 0x00, 0x08, 0x20, 0x00, 0x00, 0x40, 0x82, 0xb1, 0x89, 
+  0xc9, 0x49, 0x84, 0x01, 0xc1, 0x69, 0x70, 0xe5, 0x44, 0x08, 0x00, 0x41, 0x00, 0x00, 0x01, 0x08, 
+  0x20, 0x00, 0x20, 0x85, 0x00, 0xc9, 0x49, 0x42, 0xc1, 0x49, 0x04, 0xc9, 0x49, 0x91, 0x06, 0x68, 
+  0xc5, 0x80, 0xe5, 0xb9, 0x49, 0x43, 0xc1, 0x49, 0x80, 0x00, 0x28, 0x82, 0x81, 0x00, 0xc9, 0x69, 
+  0x42, 0xc1, 0x49, 0x81, 0x02, 0x10, 0x20, 0xa9, 0x89, 0xc1, 0x69, 0x41, 0xc1, 0x49, 0x80, 0x00, 
+  0xb1, 0x89, 0x83, 0x48, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00, 0x81, 0x06, 0x80, 0x00, 0xc1, 
+  0x48, 0x41, 0xc1, 0x49, 0x83, 0x00, 0x00, 0x20, 0x81, 0x00, 0x99, 0x68, 0x80, 0x42, 0xc1, 0x49, 
+  0x80, 0x00, 0xb1, 0x69, 0x83, 0x41, 0x00, 0x00, 0x01, 0x64, 0x68, 0x7d, 0xc7, 0x41, 0x75, 0x66, 
+  0x02, 0x6d, 0x46, 0x85, 0xc9, 0x3a, 0x85, 0x41, 0x00, 0x00, 0x03, 0x08, 0x60, 0x75, 0x29, 0x75, 
+  0x87, 0x75, 0x67, 0x41, 0x75, 0x46, 0x03, 0x7d, 0x89, 0x21, 0x43, 0x00, 0x00, 0x00, 0x20, 0x87, 
+  0x00, 0x64, 0x28, 0x80, 0x42, 0x00, 0x20, 0x80, 0x02, 0x08, 0x81, 0x7d, 0x4a, 0x75, 0x67, 0x42, 
+  0x75, 0x46, 0x01, 0x75, 0x66, 0x75, 0x86, 0x42, 0x75, 0x87, 0x80, 0x43, 0x75, 0x47, 0x03, 0x75, 
+  0x67, 0x75, 0x47, 0x75, 0x6a, 0x22, 0xe5, 0x41, 0x00, 0x20, 0x83, 0x42, 0x75, 0x67, 0x00, 0x7d, 
+  0x87, 0x82, 0x00, 0x01, 0xa6, 0x83, 0x02, 0x09, 0xe7, 0x01, 0xe7, 0x09, 0xe7, 0x41, 0x01, 0xe6, 
+  0x41, 0x09, 0xe6, 0x01, 0x01, 0xe7, 0x09, 0xe7, 0x41, 0x0a, 0x07, 0x45, 0x1a, 0xe8, 0x41, 0x12, 
+  0xe8, 0x02, 0x12, 0xe7, 0x1b, 0x29, 0x12, 0xc8, 0x41, 0x01, 0xe6, 0x05, 0x01, 0xe5, 0x12, 0xc7, 
+  0x1b, 0x28, 0x0a, 0x47, 0x09, 0x65, 0x00, 0x81, 0x46, 0x00, 0x00, 0x41, 0x00, 0x20, 0x00, 0x00, 
+  0x00, 0x80, 0x00, 0xc9, 0x69, 0x8a, 0x00, 0xc9, 0x69, 0x41, 0xc1, 0x69, 0x81, 0x00, 0x69, 0x06, 
+  0x4d, 0x00, 0x00, 0x02, 0x18, 0x21, 0x99, 0x68, 0xc1, 0x69, 0x46, 0xc1, 0x49, 0x01, 0xb1, 0x89, 
+  0x58, 0xe4, 0x4b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x84, 0x05, 0xc1, 0x49, 0xc1, 0x69, 0xc9, 0x69, 
+  0xc1, 0x69, 0xc1, 0x49, 0xc1, 0x69, 0x82, 0x01, 0xc1, 0x8a, 0x28, 0x41, 0x86, 0x01, 0x30, 0x82, 
+  0x10, 0x00, 0x81, 0x00, 0xc1, 0x69, 0x8b, 0x00, 0x00, 0x20, 0x44, 0x00, 0x00, 0x01, 0x79, 0x06, 
+  0xd1, 0x69, 0x42, 0xc1, 0x49, 0x85, 0x00, 0x08, 0x00, 0x82, 0x00, 0xc1, 0x69, 0x81, 0x00, 0xa9, 
+  0x69, 0x85, 0x00, 0x64, 0x48, 0x80, 0x00, 0x75, 0x67, 0x41, 0x75, 0x66, 0x80, 0x00, 0x3a, 0x65, 
+  0x81, 0x01, 0x08, 0x81, 0x6d, 0x09, 0x80, 0x02, 0x75, 0x47, 0x75, 0x67, 0x75, 0x66, 0x80, 0x00, 
+  0x21, 0x63, 0x84, 0x00, 0x7d, 0xc7, 0x41, 0x75, 0x67, 0x80, 0x01, 0x7d, 0xc7, 0x64, 0x08, 0x44, 
+  0x00, 0x00, 0x02, 0x08, 0x61, 0x53, 0xe7, 0x75, 0x68, 0x41, 0x75, 0x47, 0x01, 0x75, 0x67, 0x75, 
+  0x88, 0x42, 0x7d, 0xc8, 0x85, 0x03, 0x75, 0x46, 0x75, 0x67, 0x54, 0xc8, 0x1a, 0x64, 0x88, 0x00, 
+  0x7d, 0xa7, 0x81, 0x00, 0x00, 0x20, 0x84, 0x00, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x81, 0x44, 0x09, 
+  0xe7, 0x80, 0x00, 0x0a, 0x46, 0x43, 0x0a, 0x66, 0x42, 0x0a, 0x46, 0x02, 0x0a, 0x66, 0x0a, 0x46, 
+  0x01, 0xc6, 0x80, 0x06, 0x02, 0x05, 0x1b, 0x08, 0x12, 0xe8, 0x02, 0x26, 0x01, 0xe6, 0x09, 0x85, 
+  0x00, 0x61, 0x49, 0x00, 0x00, 0x00, 0x81, 0x06, 0x80, 0x00, 0xb9, 0x49, 0x41, 0xc1, 0x69, 0x00, 
+  0xc1, 0x49, 0x80, 0x00, 0x58, 0xe4, 0x84, 0x01, 0xc1, 0x69, 0xc9, 0x69, 0x41, 0xc1, 0x49, 0x04, 
+  0xc9, 0x69, 0x89, 0x27, 0x38, 0x82, 0x38, 0xc3, 0x20, 0x82, 0x86, 0x00, 0x00, 0x20, 0x80, 0x03, 
+  0x08, 0x00, 0x10, 0x20, 0x81, 0x26, 0xc9, 0x69, 0x47, 0xc1, 0x49, 0x02, 0xc1, 0x69, 0xb9, 0x89, 
+  0x60, 0xe4, 0x8a, 0x00, 0x08, 0x20, 0x80, 0x00, 0xd1, 0x49, 0x46, 0xc1, 0x49, 0x42, 0xc1, 0x69, 
+  0x82, 0x03, 0x79, 0x06, 0x70, 0xc5, 0xb9, 0x69, 0xc1, 0x69, 0x87, 0x41, 0xc1, 0x49, 0x8a, 0x45, 
+  0x00, 0x00, 0x00, 0x81, 0x06, 0x90, 0x00, 0xa9, 0x89, 0x85, 0x00, 0x64, 0x68, 0x80, 0x01, 0x75, 
+  0x66, 0x75, 0x87, 0x85, 0x00, 0x75, 0x09, 0x82, 0x02, 0x75, 0x86, 0x7d, 0xa9, 0x21, 0x83, 0x84, 
+  0x00, 0x75, 0xa7, 0x82, 0x05, 0x7d, 0xa7, 0x6c, 0x68, 0x19, 0x42, 0x19, 0x43, 0x19, 0x23, 0x00, 
+  0x40, 0x80, 0x02, 0x00, 0x20, 0x1a, 0x24, 0x2b, 0x66, 0x41, 0x23, 0x45, 0x07, 0x23, 0x65, 0x23, 
+  0xa5, 0x2b, 0xe6, 0x34, 0x25, 0x44, 0x66, 0x75, 0x88, 0x75, 0x87, 0x75, 0x67, 0x80, 0x00, 0x6d, 
+  0x47, 0x80, 0x03, 0x75, 0x67, 0x54, 0xc7, 0x1a, 0xa5, 0x08, 0xc1, 0x42, 0x00, 0x00, 0x81, 0x00, 
+  0x75, 0xa7, 0x83, 0x00, 0x6c, 0xc9, 0x80, 0x00, 0x00, 0x41, 0x81, 0x46, 0x01, 0xe6, 0x43, 0x09, 
+  0xe7, 0x00, 0x01, 0xe7, 0x81, 0x42, 0x01, 0xe5, 0x00, 0x01, 0xe6, 0x47, 0x02, 0x06, 0x07, 0x12, 
+  0xe8, 0x12, 0xc7, 0x02, 0x05, 0x02, 0x06, 0x09, 0xa6, 0x00, 0x61, 0x00, 0x00, 0x18, 0x20, 0x41, 
+  0x20, 0x41, 0x00, 0x18, 0x21, 0x43, 0x18, 0x41, 0x02, 0x20, 0x41, 0x18, 0x20, 0x88, 0xe6, 0x80, 
+  0x43, 0xc1, 0x49, 0x86, 0x00, 0xc1, 0x49, 0x80, 0x00, 0xc1, 0x69, 0x41, 0xc1, 0x49, 0x04, 0xc1, 
+  0x69, 0xc1, 0x89, 0xb9, 0xaa, 0x99, 0x68, 0x30, 0x62, 0x83, 0x00, 0x00, 0x20, 0x81, 0x03, 0x10, 
+  0x00, 0x50, 0xc4, 0xa1, 0x88, 0xb9, 0x69, 0x44, 0xc1, 0x49, 0x02, 0xc1, 0x29, 0xc1, 0x28, 0xc1, 
+  0x29, 0x42, 0xc1, 0x49, 0x01, 0xb9, 0x8a, 0x50, 0xc4, 0x41, 0x08, 0x00, 0x80, 0x00, 0x00, 0x20, 
+  0x86, 0x02, 0x99, 0x88, 0xd1, 0x69, 0xc9, 0x49, 0x87, 0x42, 0xc1, 0x49, 0x00, 0xc9, 0x69, 0x41, 
+  0xc9, 0x8a, 0x42, 0xc1, 0x69, 0x83, 0x00, 0x10, 0x20, 0x84, 0x01, 0xb1, 0x69, 0x28, 0x62, 0x83, 
+  0x00, 0x10, 0x20, 0x41, 0x18, 0x41, 0x00, 0x18, 0x21, 0x42, 0x18, 0x41, 0x41, 0x20, 0x41, 0x01, 
+  0x18, 0x20, 0x91, 0x06, 0x87, 0x41, 0x00, 0x00, 0x83, 0x41, 0xc1, 0x49, 0x89, 0x00, 0x75, 0x67, 
+  0x86, 0x01, 0x6c, 0xe9, 0x75, 0x67, 0x81, 0x01, 0x75, 0x66, 0x7d, 0x89, 0x84, 0x00, 0x6c, 0xe9, 
+  0x80, 0x00, 0x75, 0x87, 0x81, 0x11, 0x75, 0x67, 0x7d, 0x68, 0x7d, 0x89, 0x7d, 0x69, 0x85, 0x6a, 
+  0x42, 0x86, 0x00, 0x20, 0x00, 0x00, 0x00, 0x81, 0x0a, 0x45, 0x02, 0x24, 0x0a, 0x85, 0x12, 0xe5, 
+  0x13, 0x05, 0x13, 0x25, 0x23, 0xa4, 0x6d, 0x68, 0x7d, 0xa7, 0x82, 0x04, 0x6d, 0x27, 0x75, 0x46, 
+  0x65, 0x08, 0x23, 0x86, 0x12, 0x05, 0x43, 0x00, 0x00, 0x83, 0x00, 0x75, 0x87, 0x83, 0x00, 0x00, 
+  0x21, 0x86, 0x41, 0x01, 0xe7, 0x00, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x83, 0x49, 0x23, 0x29, 0x02, 
+  0x1b, 0x29, 0x23, 0x49, 0x12, 0xc8, 0x41, 0x02, 0x06, 0x05, 0x09, 0xe6, 0x00, 0xc2, 0x00, 0x00, 
+  0x30, 0x21, 0x91, 0x47, 0xb9, 0x89, 0x46, 0xb1, 0x69, 0x01, 0xa9, 0x69, 0xb9, 0x49, 0x41, 0xc1, 
+  0x49, 0x00, 0xc1, 0x69, 0x89, 0x01, 0xc1, 0x69, 0xc9, 0x69, 0x81, 0x04, 0xc9, 0x49, 0xc9, 0x29, 
+  0xc1, 0x28, 0xc9, 0x8a, 0x69, 0x26, 0x44, 0x00, 0x00, 0x03, 0x18, 0x20, 0x50, 0xa3, 0xa9, 0x88, 
+  0xb1, 0x48, 0x46, 0xc1, 0x49, 0x41, 0xc1, 0x28, 0x44, 0xc1, 0x49, 0x04, 0xb9, 0x49, 0xa9, 0x88, 
+  0x58, 0xa3, 0x28, 0x41, 0x08, 0x00, 0x86, 0x00, 0xa1, 0x88, 0x85, 0x41, 0xc9, 0x69, 0x83, 0x03, 
+  0xc1, 0x69, 0xc1, 0x49, 0xc1, 0x69, 0xc1, 0x49, 0x80, 0x00, 0xc9, 0x69, 0x8b, 0x00, 0x28, 0x61, 
+  0x80, 0x00, 0x00, 0x20, 0x80, 0x02, 0x18, 0x20, 0x81, 0x26, 0xb1, 0xa9, 0x43, 0xb1, 0x89, 0x43, 
+  0xb1, 0x69, 0x45, 0xc1, 0x49, 0x80, 0x00, 0x58, 0xc4, 0x86, 0x00, 0xc1, 0x69, 0x91, 0x00, 0x08, 
+  0x61, 0x81, 0x41, 0x75, 0x67, 0x80, 0x00, 0x7d, 0x88, 0x86, 0x00, 0x75, 0x66, 0x41, 0x75, 0x87, 
+  0x41, 0x75, 0x67, 0x04, 0x75, 0x87, 0x75, 0x86, 0x75, 0x87, 0x7d, 0x2b, 0x10, 0xa2, 0x80, 0x07, 
+  0x10, 0xc2, 0x19, 0xa3, 0x19, 0x83, 0x43, 0x46, 0x75, 0x69, 0x6d, 0x08, 0x6d, 0x28, 0x6d, 0x47, 
+  0x41, 0x7d, 0xa7, 0x07, 0x7d, 0x87, 0x75, 0x87, 0x75, 0x67, 0x75, 0x87, 0x65, 0x27, 0x23, 0x65, 
+  0x0a, 0xa5, 0x11, 0x84, 0x84, 0x00, 0x6c, 0xc9, 0x86, 0x01, 0x00, 0x20, 0x09, 0xa6, 0x46, 0x01, 
+  0xe6, 0x00, 0x09, 0xe7, 0x41, 0x01, 0xe6, 0x44, 0x09, 0xe7, 0x41, 0x01, 0xe6, 0x49, 0x01, 0xe5, 
+  0x41, 0x01, 0xc5, 0x05, 0x0a, 0xa7, 0x12, 0x67, 0x00, 0x20, 0x20, 0x41, 0x99, 0x27, 0xc1, 0x69, 
+  0x44, 0xc9, 0x49, 0x41, 0xc9, 0x69, 0x41, 0xc1, 0x69, 0x44, 0xc1, 0x49, 0x00, 0xc1, 0x48, 0x86, 
+  0x43, 0xc1, 0x69, 0x00, 0xc9, 0x49, 0x42, 0xc1, 0x49, 0x01, 0xc9, 0x69, 0x71, 0x06, 0x81, 0x05, 
+  0x28, 0x62, 0x38, 0xa3, 0x48, 0xa3, 0x99, 0x88, 0xb9, 0x69, 0xc9, 0x49, 0x46, 0xc1, 0x49, 0x02, 
+  0xb1, 0x08, 0xa0, 0xc7, 0xb9, 0x69, 0x81, 0x42, 0xc1, 0x48, 0x06, 0xc1, 0x49, 0xc9, 0x69, 0xb9, 
+  0x89, 0xa9, 0x89, 0x50, 0xa4, 0x38, 0x83, 0x20, 0x62, 0x89, 0x03, 0xc1, 0x69, 0xb9, 0x28, 0xa9, 
+  0x07, 0xb1, 0x28, 0x46, 0xc1, 0x49, 0x41, 0xc1, 0x69, 0x41, 0xc9, 0x69, 0x00, 0xc1, 0x69, 0x82, 
+  0x00, 0x10, 0x00, 0x85, 0x00, 0x28, 0x62, 0x41, 0x00, 0x00, 0x03, 0x10, 0x21, 0x89, 0x27, 0xc9, 
+  0x69, 0xc9, 0x49, 0x41, 0xc9, 0x69, 0x41, 0xc1, 0x49, 0x00, 0xc1, 0x69, 0x42, 0xc9, 0x69, 0x00, 
+  0xc1, 0x69, 0x83, 0x00, 0xc1, 0x48, 0x82, 0x00, 0x00, 0x20, 0x90, 0x41, 0x75, 0x87, 0x84, 0x00, 
+  0x08, 0x81, 0x80, 0x00, 0x75, 0x87, 0x80, 0x00, 0x75, 0x87, 0x81, 0x00, 0x21, 0x63, 0x86, 0x00, 
+  0x75, 0x66, 0x45, 0x75, 0x87, 0x03, 0x7d, 0x4a, 0x10, 0xc2, 0x21, 0x83, 0x74, 0xe9, 0x41, 0x7d, 
+  0x89, 0x03, 0x7d, 0xa8, 0x75, 0x87, 0x75, 0x47, 0x75, 0x46, 0x41, 0x75, 0x67, 0x41, 0x75, 0x87, 
+  0x06, 0x7d, 0x87, 0x7d, 0xc7, 0x6d, 0x68, 0x2c, 0x06, 0x13, 0x26, 0x12, 0x65, 0x00, 0x40, 0x81, 
+  0x00, 0x00, 0x20, 0x82, 0x00, 0x7d, 0xa7, 0x41, 0x75, 0x67, 0x00, 0x75, 0x66, 0x80, 0x00, 0x6c, 
+  0xa9, 0x80, 0x01, 0x00, 0x40, 0x09, 0xc6, 0x84, 0x41, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x41, 0x09, 
+  0xe6, 0x82, 0x41, 0x0a, 0x07, 0x44, 0x12, 0x87, 0x00, 0x0a, 0x87, 0x45, 0x12, 0x87, 0x06, 0x12, 
+  0xa7, 0x12, 0x87, 0x23, 0x49, 0x1a, 0xc8, 0x00, 0x00, 0x38, 0x82, 0xc1, 0x8a, 0x45, 0xc1, 0x49, 
+  0x01, 0xc9, 0x49, 0xc1, 0x69, 0x47, 0xc1, 0x49, 0x87, 0x00, 0xc1, 0x49, 0x80, 0x00, 0xc1, 0x49, 
+  0x81, 0x03, 0xc1, 0x29, 0xc1, 0x28, 0xc9, 0x8a, 0x79, 0x26, 0x80, 0x01, 0x40, 0xa3, 0xa9, 0x89, 
+  0x41, 0xc1, 0x89, 0x00, 0xc1, 0x69, 0x46, 0xc1, 0x49, 0x06, 0xc1, 0x69, 0xb9, 0x49, 0x98, 0xa6, 
+  0x78, 0x24, 0x98, 0xe7, 0xc1, 0x69, 0xc9, 0x69, 0x42, 0xc1, 0x49, 0x00, 0xc1, 0x69, 0x42, 0xc9, 
+  0x49, 0x04, 0xc1, 0x69, 0xb9, 0x89, 0xa9, 0x48, 0x60, 0xc4, 0x10, 0x20, 0x83, 0x00, 0xd1, 0x49, 
+  0x80, 0x00, 0xc9, 0x69, 0x81, 0x04, 0x88, 0xa5, 0x68, 0x23, 0x70, 0x44, 0xb1, 0x28, 0xc1, 0x69, 
+  0x83, 0x00, 0xc1, 0x69, 0x42, 0xc1, 0x49, 0x41, 0xc1, 0x69, 0x84, 0x01, 0xc9, 0x69, 0xc1, 0x69, 
+  0x82, 0x00, 0x28, 0x61, 0x81, 0x02, 0x38, 0xa3, 0xc1, 0xaa, 0xc9, 0x28, 0x44, 0xc1, 0x49, 0x43, 
+  0xc1, 0x69, 0x01, 0xc1, 0x49, 0xc1, 0x69, 0x81, 0x01, 0xc9, 0x69, 0xc1, 0x49, 0x94, 0x00, 0x75, 
+  0x86, 0x86, 0x01, 0x75, 0x09, 0x75, 0x86, 0x8c, 0x00, 0x75, 0x67, 0x81, 0x42, 0x75, 0x67, 0x03, 
+  0x85, 0x6a, 0x19, 0x03, 0x6c, 0x89, 0x7d, 0xa7, 0x41, 0x75, 0x86, 0x03, 0x7d, 0xa7, 0x7d, 0x87, 
+  0x75, 0x67, 0x6d, 0x47, 0x41, 0x75, 0x47, 0x07, 0x75, 0x67, 0x7d, 0xa8, 0x6d, 0x48, 0x5d, 0x09, 
+  0x23, 0xe7, 0x13, 0xa7, 0x1a, 0xe6, 0x01, 0x01, 0x44, 0x00, 0x00, 0x82, 0x00, 0x75, 0x87, 0x41, 
+  0x75, 0x67, 0x80, 0x00, 0x6c, 0xc9, 0x81, 0x00, 0x01, 0xc6, 0x82, 0x04, 0x01, 0xc6, 0x0a, 0x06, 
+  0x0a, 0x66, 0x0a, 0x46, 0x01, 0xc6, 0x80, 0x42, 0x09, 0xe7, 0x41, 0x0a, 0x07, 0x00, 0x09, 0xe7, 
+  0x4d, 0x1a, 0xe8, 0x01, 0x0a, 0x46, 0x09, 0xe6, 0x80, 0x01, 0x30, 0x82, 0xc1, 0x89, 0x44, 0xc9, 
+  0x49, 0x00, 0xc9, 0x69, 0x80, 0x48, 0xc1, 0x49, 0x01, 0xc9, 0xaa, 0x59, 0x05, 0x85, 0x41, 0xc1, 
+  0x69, 0x44, 0xc1, 0x49, 0x01, 0xc1, 0x69, 0x68, 0xe5, 0x80, 0x03, 0x89, 0x67, 0xc9, 0x69, 0xc1, 
+  0x28, 0xc1, 0x48, 0x46, 0xc1, 0x49, 0x08, 0xb9, 0x49, 0xa8, 0xe7, 0x98, 0xc6, 0x78, 0x44, 0x78, 
+  0x85, 0x80, 0x65, 0x98, 0xe7, 0xa0, 0xe7, 0xb9, 0x49, 0x80, 0x01, 0xc1, 0x69, 0xc9, 0x69, 0x80, 
+  0x01, 0xc1, 0x49, 0xc1, 0x48, 0x42, 0xc1, 0x28, 0x01, 0xb9, 0xaa, 0x30, 0x82, 0x83, 0x00, 0xc9, 
+  0x69, 0x81, 0x00, 0xc9, 0x49, 0x80, 0x03, 0x80, 0xc6, 0x60, 0x44, 0x68, 0x64, 0xb1, 0x48, 0x42, 
+  0xc1, 0x69, 0x81, 0x41, 0xb9, 0x48, 0x00, 0xc1, 0x69, 0x86, 0x00, 0xa1, 0x89, 0x80, 0x41, 0xc1, 
+  0x49, 0x85, 0x01, 0xc1, 0x89, 0xc9, 0x48, 0x4e, 0xc1, 0x49, 0x01, 0xc9, 0x8a, 0x58, 0xe4, 0x87, 
+  0x41, 0xc9, 0x49, 0x84, 0x41, 0x00, 0x20, 0x00, 0x5c, 0x48, 0x80, 0x41, 0x75, 0x87, 0x02, 0x75, 
+  0x86, 0x85, 0xe9, 0x32, 0x45, 0x81, 0x02, 0x11, 0x01, 0x75, 0x49, 0x75, 0x87, 0x41, 0x75, 0x66, 
+  0x00, 0x75, 0x86, 0x86, 0x00, 0x7d, 0xa7, 0x81, 0x00, 0x75, 0x86, 0x80, 0x06, 0x75, 0xa7, 0x7d, 
+  0xc8, 0x75, 0xa8, 0x75, 0x88, 0x6c, 0xca, 0x10, 0xe2, 0x5c, 0x47, 0x43, 0x75, 0x67, 0x00, 0x75, 
+  0x87, 0x80, 0x0b, 0x75, 0x46, 0x75, 0x67, 0x75, 0x68, 0x65, 0x08, 0x54, 0xa8, 0x33, 0xe7, 0x0b, 
+  0x26, 0x1b, 0xa8, 0x1b, 0x07, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x20, 0x84, 0x00, 0x6c, 0xa9, 0x80, 
+  0x42, 0x75, 0x67, 0x80, 0x00, 0x74, 0xc9, 0x41, 0x00, 0x40, 0x83, 0x04, 0x02, 0x06, 0x12, 0xe7, 
+  0x1b, 0x88, 0x1b, 0x68, 0x0a, 0x66, 0x44, 0x01, 0xc6, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0x01, 
+  0xc5, 0x01, 0xa5, 0x45, 0x01, 0xc5, 0x43, 0x01, 0xa5, 0x03, 0x01, 0xc5, 0x01, 0xa5, 0x01, 0xe6, 
+  0x01, 0xa5, 0x82, 0x01, 0xc1, 0x48, 0xc9, 0x69, 0x80, 0x41, 0xc9, 0x69, 0x42, 0xc9, 0x49, 0x41, 
+  0xc9, 0x69, 0x43, 0xc1, 0x69, 0x41, 0xc9, 0x69, 0x01, 0xc1, 0x89, 0x48, 0xc3, 0x89, 0x04, 0xb1, 
+  0x08, 0x98, 0xa6, 0x90, 0xc6, 0x88, 0xa6, 0x48, 0x42, 0x80, 0x00, 0x81, 0x46, 0x80, 0x00, 0xc1, 
+  0x48, 0x45, 0xc1, 0x49, 0x0c, 0xc9, 0x69, 0xb9, 0x48, 0x98, 0xa6, 0x78, 0x24, 0x70, 0x65, 0x58, 
+  0x84, 0x40, 0x42, 0x68, 0x84, 0x80, 0x65, 0x70, 0x24, 0x98, 0xc6, 0xc1, 0x69, 0xc9, 0x69, 0x45, 
+  0xc1, 0x49, 0x80, 0x00, 0xb1, 0x69, 0x83, 0x00, 0x99, 0x88, 0x42, 0xc9, 0x69, 0x80, 0x04, 0xc1, 
+  0x89, 0x70, 0xe5, 0x48, 0x63, 0x58, 0x84, 0xb1, 0x69, 0x41, 0xc9, 0x69, 0x42, 0xc1, 0x49, 0x02, 
+  0x88, 0x85, 0x78, 0x44, 0xb1, 0x48, 0x42, 0xc1, 0x69, 0x00, 0xc9, 0x49, 0x82, 0x00, 0xa9, 0x89, 
+  0x41, 0xc1, 0x69, 0x86, 0x00, 0xc1, 0xa9, 0x84, 0x00, 0xc9, 0x49, 0x44, 0xc1, 0x69, 0x42, 0xc9, 
+  0x69, 0x03, 0xc1, 0x69, 0xc9, 0x69, 0xb9, 0x69, 0x50, 0x83, 0x42, 0x00, 0x00, 0x82, 0x41, 0xc1, 
+  0x69, 0x85, 0x41, 0x00, 0x20, 0x03, 0x00, 0x00, 0x64, 0x68, 0x75, 0xc7, 0x75, 0x66, 0x41, 0x75, 
+  0x87, 0x02, 0x85, 0xc8, 0x43, 0x25, 0x00, 0x60, 0x80, 0x01, 0x2a, 0x63, 0x7d, 0xa8, 0x41, 0x75, 
+  0x86, 0x41, 0x75, 0x66, 0x01, 0x7d, 0xa9, 0x19, 0x63, 0x85, 0x00, 0x75, 0x67, 0x41, 0x75, 0x66, 
+  0x80, 0x08, 0x65, 0x27, 0x3c, 0x26, 0x3c, 0x47, 0x33, 0xe6, 0x1b, 0x06, 0x08, 0xc1, 0x3b, 0x66, 
+  0x6d, 0x48, 0x75, 0x87, 0x41, 0x7d, 0xa8, 0x41, 0x7d, 0xc8, 0x08, 0x75, 0x88, 0x3c, 0x47, 0x3c, 
+  0x27, 0x23, 0x86, 0x02, 0xa5, 0x0b, 0x06, 0x13, 0x47, 0x12, 0x85, 0x01, 0x01, 0x42, 0x00, 0x20, 
+  0x80, 0x00, 0x00, 0x20, 0x81, 0x00, 0x00, 0x20, 0x80, 0x00, 0x7d, 0x87, 0x42, 0x75, 0x66, 0x03, 
+  0x7d, 0xa8, 0x54, 0x07, 0x00, 0x20, 0x00, 0x41, 0x81, 0x00, 0x09, 0xe6, 0x80, 0x01, 0x0a, 0xe6, 
+  0x1b, 0xa7, 0x42, 0x1b, 0x87, 0x42, 0x12, 0xe7, 0x42, 0x12, 0xe8, 0x00, 0x1a, 0xe8, 0x4e, 0x1a, 
+  0xe8, 0x00, 0x1a, 0x46, 0x80, 0x00, 0x38, 0x82, 0x80, 0x00, 0xc1, 0x49, 0x81, 0x00, 0xc9, 0x49, 
+  0x80, 0x01, 0xc1, 0x48, 0x98, 0xa6, 0x44, 0x90, 0x86, 0x42, 0x90, 0xa6, 0x02, 0x98, 0xa6, 0x88, 
+  0xa6, 0x30, 0x42, 0x42, 0x00, 0x00, 0x85, 0x05, 0xc1, 0x69, 0xa0, 0xe7, 0x70, 0x24, 0x70, 0x44, 
+  0x70, 0x85, 0x40, 0x83, 0x80, 0x01, 0x60, 0xa4, 0xb9, 0x49, 0x45, 0xc1, 0x49, 0x0d, 0xb9, 0x28, 
+  0xa0, 0xa6, 0x88, 0x65, 0x78, 0x44, 0x70, 0x85, 0x48, 0xa4, 0x10, 0x20, 0x00, 0x00, 0x28, 0x41, 
+  0x68, 0x84, 0x78, 0x65, 0x78, 0x44, 0x90, 0x86, 0xa8, 0xe7, 0x80, 0x01, 0xc1, 0x48, 0xc1, 0x28, 
+  0x81, 0x03, 0xc1, 0x28, 0xc1, 0x49, 0x99, 0x48, 0x20, 0x21, 0x84, 0x00, 0xc9, 0x49, 0x41, 0xc1, 
+  0x49, 0x80, 0x02, 0x48, 0xc3, 0x00, 0x00, 0x20, 0x41, 0x81, 0x00, 0xc1, 0x69, 0x81, 0x02, 0xc1, 
+  0x69, 0x80, 0x65, 0x70, 0x24, 0x80, 0x00, 0xc9, 0x69, 0x81, 0x00, 0xc1, 0x49, 0x85, 0x00, 0xc1, 
+  0x69, 0x85, 0x01, 0xc1, 0x89, 0xc9, 0x29, 0x82, 0x04, 0xc9, 0x49, 0xb9, 0x28, 0x90, 0x86, 0x88, 
+  0x85, 0x88, 0x86, 0x41, 0x90, 0xa6, 0x41, 0x98, 0xa6, 0x04, 0x90, 0xa6, 0x90, 0xa5, 0x90, 0xa6, 
+  0x90, 0xa5, 0x40, 0x42, 0x80, 0x00, 0x00, 0x20, 0x84, 0x41, 0xc9, 0x69, 0x80, 0x00, 0xb1, 0x89, 
+  0x85, 0x01, 0x21, 0xc4, 0x64, 0xe7, 0x41, 0x75, 0x87, 0x03, 0x7d, 0x87, 0x7d, 0x88, 0x64, 0x86, 
+  0x19, 0x62, 0x80, 0x00, 0x3b, 0x04, 0x81, 0x00, 0x75, 0x87, 0x80, 0x02, 0x75, 0x87, 0x5c, 0x26, 
+  0x08, 0xc1, 0x87, 0x00, 0x75, 0x46, 0x80, 0x15, 0x54, 0xa8, 0x0a, 0xe5, 0x0b, 0x06, 0x0a, 0xe6, 
+  0x1b, 0x07, 0x09, 0x02, 0x12, 0x84, 0x2b, 0xa6, 0x2b, 0xe6, 0x2c, 0x06, 0x34, 0x26, 0x34, 0x46, 
+  0x34, 0x47, 0x2c, 0x07, 0x0b, 0x46, 0x0a, 0xe6, 0x0a, 0xc6, 0x12, 0xe7, 0x09, 0xa4, 0x08, 0xe2, 
+  0x00, 0x60, 0x00, 0x00, 0x80, 0x46, 0x00, 0x00, 0x01, 0x54, 0x08, 0x75, 0x88, 0x41, 0x6d, 0x48, 
+  0x03, 0x75, 0x88, 0x4c, 0xa7, 0x23, 0x05, 0x00, 0x40, 0x82, 0x41, 0x01, 0xe6, 0x00, 0x13, 0x07, 
+  0x42, 0x1b, 0xa8, 0x05, 0x1b, 0x47, 0x0a, 0x86, 0x12, 0x66, 0x0a, 0x86, 0x12, 0x87, 0x12, 0xa7, 
+  0x41, 0x12, 0x87, 0x01, 0x0a, 0x67, 0x0a, 0x46, 0x45, 0x0a, 0x66, 0x41, 0x0a, 0x46, 0x43, 0x0a, 
+  0x66, 0x01, 0x0a, 0x46, 0x09, 0xa5, 0x82, 0x42, 0xc9, 0x49, 0x41, 0xc1, 0x49, 0x01, 0xb9, 0x48, 
+  0x78, 0x24, 0x42, 0x70, 0x24, 0x44, 0x78, 0x24, 0x02, 0x70, 0x44, 0x70, 0x85, 0x28, 0x62, 0x87, 
+  0x41, 0xc1, 0x69, 0x08, 0x99, 0x27, 0x58, 0x64, 0x68, 0xa5, 0x50, 0xa4, 0x18, 0x21, 0x00, 0x20, 
+  0x50, 0x63, 0x88, 0x85, 0xb9, 0x48, 0x82, 0x13, 0xc1, 0x69, 0xa8, 0xc7, 0x88, 0x45, 0x70, 0x24, 
+  0x70, 0x44, 0x70, 0xa5, 0x48, 0x83, 0x10, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x21, 
+  0x60, 0x84, 0x80, 0x65, 0x78, 0x24, 0x80, 0x45, 0x88, 0x65, 0xa8, 0xe7, 0xc1, 0x49, 0xc1, 0x48, 
+  0x41, 0xc1, 0x49, 0x02, 0xb1, 0x28, 0x70, 0x84, 0x18, 0x20, 0x82, 0x00, 0xa1, 0x88, 0x82, 0x02, 
+  0xc1, 0x48, 0xc1, 0xa9, 0x40, 0xc3, 0x80, 0x02, 0x18, 0x41, 0xa9, 0x68, 0xc9, 0x49, 0x82, 0x03, 
+  0xc1, 0x89, 0x70, 0xa5, 0x60, 0x43, 0xb1, 0x68, 0x42, 0xc1, 0x69, 0x83, 0x01, 0xa9, 0x88, 0xc9, 
+  0x69, 0x80, 0x00, 0xc1, 0x49, 0x84, 0x02, 0x38, 0x83, 0xc1, 0xaa, 0xc9, 0x28, 0x84, 0x00, 0x70, 
+  0x24, 0x41, 0x68, 0x24, 0x41, 0x70, 0x24, 0x42, 0x70, 0x44, 0x03, 0x68, 0x44, 0x70, 0x24, 0x78, 
+  0x65, 0x40, 0x62, 0x83, 0x00, 0xa1, 0x68, 0x84, 0x00, 0xa9, 0x89, 0x85, 0x03, 0x00, 0x20, 0x5c, 
+  0x87, 0x75, 0xa7, 0x75, 0x67, 0x41, 0x7d, 0x87, 0x01, 0x7d, 0xa9, 0x2a, 0x24, 0x80, 0x01, 0x4b, 
+  0x45, 0x7d, 0xa7, 0x80, 0x05, 0x75, 0xa7, 0x75, 0x86, 0x7d, 0xe8, 0x2a, 0x64, 0x00, 0x00, 0x00, 
+  0x20, 0x41, 0x00, 0x00, 0x81, 0x00, 0x75, 0xa7, 0x80, 0x01, 0x75, 0x87, 0x75, 0x66, 0x80, 0x06, 
+  0x5c, 0xa8, 0x12, 0xe6, 0x13, 0x07, 0x1b, 0x48, 0x11, 0xe4, 0x00, 0xa1, 0x12, 0xc6, 0x41, 0x0b, 
+  0x06, 0x01, 0x0a, 0xe6, 0x03, 0x06, 0x41, 0x0b, 0x45, 0x07, 0x0b, 0x25, 0x13, 0x66, 0x1b, 0x46, 
+  0x12, 0x65, 0x09, 0x02, 0x00, 0x60, 0x00, 0x00, 0x00, 0x20, 0x48, 0x00, 0x40, 0x06, 0x22, 0x83, 
+  0x2b, 0x64, 0x23, 0x24, 0x23, 0x44, 0x23, 0x85, 0x1b, 0x86, 0x1a, 0xe6, 0x41, 0x00, 0x40, 0x83, 
+  0x05, 0x0a, 0x26, 0x1b, 0x27, 0x23, 0xc8, 0x1b, 0x68, 0x0a, 0x45, 0x01, 0xc5, 0x44, 0x01, 0xc6, 
+  0x00, 0x09, 0xc6, 0x42, 0x01, 0xe6, 0x45, 0x02, 0x06, 0x01, 0x02, 0x05, 0x02, 0x06, 0x42, 0x02, 
+  0x05, 0x01, 0x01, 0xe5, 0x01, 0x64, 0x82, 0x00, 0xc1, 0x49, 0x80, 0x42, 0xc1, 0x49, 0x02, 0xb1, 
+  0x49, 0x70, 0x85, 0x68, 0x65, 0x41, 0x70, 0x65, 0x41, 0x78, 0x65, 0x42, 0x78, 0x85, 0x02, 0x70, 
+  0x85, 0x60, 0xa5, 0x18, 0x41, 0x80, 0x00, 0x00, 0x20, 0x84, 0x41, 0xc1, 0x49, 0x04, 0xc9, 0x8a, 
+  0x71, 0x26, 0x10, 0x20, 0x18, 0x41, 0x10, 0x20, 0x41, 0x00, 0x20, 0x01, 0x50, 0x83, 0x78, 0x65, 
+  0x42, 0x80, 0x65, 0x09, 0x88, 0x65, 0x90, 0x85, 0x88, 0x65, 0x78, 0x45, 0x68, 0x65, 0x50, 0xa4, 
+  0x28, 0x42, 0x08, 0x20, 0x00, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00, 0x05, 0x18, 0x20, 0x50, 0x83, 
+  0x68, 0x85, 0x78, 0x65, 0x78, 0x45, 0x80, 0x65, 0x41, 0x88, 0x65, 0x00, 0x80, 0x45, 0x41, 0x80, 
+  0x65, 0x01, 0x70, 0x85, 0x20, 0x41, 0x82, 0x00, 0x99, 0x88, 0x82, 0x02, 0xc1, 0x28, 0xc1, 0xaa, 
+  0x48, 0xc4, 0x80, 0x00, 0x20, 0x41, 0x80, 0x00, 0xc1, 0x49, 0x41, 0xc1, 0x69, 0x81, 0x03, 0x38, 
+  0x82, 0x18, 0x20, 0xa1, 0x68, 0xc9, 0x69, 0x81, 0x00, 0xc9, 0x49, 0x82, 0x00, 0xa9, 0x89, 0x41, 
+  0xc1, 0x69, 0x41, 0xc1, 0x49, 0x88, 0x03, 0xc1, 0x48, 0xc1, 0x49, 0xb1, 0x48, 0x70, 0x64, 0x44, 
+  0x70, 0x85, 0x43, 0x70, 0x65, 0x01, 0x60, 0xa5, 0x28, 0x42, 0x82, 0x01, 0x10, 0x00, 0xa1, 0x48, 
+  0x84, 0x00, 0xb1, 0x89, 0x82, 0x00, 0x00, 0x00, 0x81, 0x01, 0x00, 0x60, 0x64, 0xa7, 0x81, 0x41, 
+  0x75, 0x67, 0x01, 0x85, 0xe9, 0x32, 0x64, 0x80, 0x06, 0x64, 0x68, 0x75, 0x87, 0x75, 0x66, 0x75, 
+  0x87, 0x75, 0x66, 0x7d, 0xc8, 0x32, 0x44, 0x84, 0x00, 0x6c, 0xc9, 0x80, 0x41, 0x75, 0x87, 0x0e, 
+  0x75, 0x86, 0x7d, 0xa7, 0x5c, 0x28, 0x00, 0x61, 0x00, 0xa1, 0x08, 0xe2, 0x00, 0x81, 0x00, 0x20, 
+  0x08, 0xe1, 0x1a, 0x66, 0x1a, 0xa6, 0x12, 0xc6, 0x12, 0xe6, 0x44, 0x68, 0x65, 0x48, 0x41, 0x65, 
+  0x28, 0x02, 0x6d, 0x49, 0x64, 0xe8, 0x64, 0x68, 0x41, 0x64, 0x88, 0x03, 0x6c, 0x88, 0x64, 0x88, 
+  0x64, 0xa8, 0x6c, 0xa9, 0x44, 0x6c, 0xc9, 0x41, 0x64, 0xc8, 0x05, 0x5c, 0xa7, 0x64, 0xc8, 0x44, 
+  0x27, 0x1b, 0x46, 0x1b, 0x27, 0x1a, 0x86, 0x41, 0x00, 0x20, 0x00, 0x01, 0x85, 0x42, 0x01, 0xc6, 
+  0x05, 0x01, 0xe6, 0x02, 0x26, 0x0a, 0x46, 0x02, 0x26, 0x01, 0xe6, 0x09, 0xc6, 0x82, 0x00, 0x09, 
+  0xc7, 0x81, 0x00, 0x1b, 0x28, 0x46, 0x1b, 0x08, 0x41, 0x1b, 0x28, 0x00, 0x1b, 0x08, 0x43, 0x1b, 
+  0x28, 0x00, 0x1a, 0x87, 0x87, 0x02, 0xa1, 0x68, 0x38, 0x63, 0x30, 0x63, 0x46, 0x40, 0x63, 0x01, 
+  0x40, 0x83, 0x20, 0x41, 0x41, 0x00, 0x00, 0x82, 0x01, 0xb9, 0x69, 0xc1, 0x49, 0x81, 0x00, 0xc9, 
+  0x49, 0x80, 0x00, 0x61, 0x26, 0x41, 0x00, 0x00, 0x42, 0x00, 0x20, 0x02, 0x30, 0x83, 0x60, 0x84, 
+  0x68, 0x65, 0x42, 0x70, 0x44, 0x04, 0x78, 0x45, 0x70, 0x65, 0x60, 0x85, 0x30, 0x42, 0x08, 0x20, 
+  0x42, 0x00, 0x00, 0x41, 0x00, 0x20, 0x80, 0x07, 0x00, 0x20, 0x00, 0x00, 0x08, 0x20, 0x18, 0x21, 
+  0x48, 0x63, 0x70, 0x85, 0x78, 0x65, 0x78, 0x45, 0x41, 0x70, 0x44, 0x03, 0x70, 0x45, 0x70, 0x65, 
+  0x60, 0x84, 0x18, 0x21, 0x83, 0x41, 0xc9, 0x49, 0x80, 0x00, 0xc1, 0x48, 0x80, 0x00, 0x50, 0xc4, 
+  0x86, 0x02, 0xc1, 0xaa, 0x28, 0x82, 0x00, 0x00, 0x81, 0x41, 0xc1, 0x49, 0x88, 0x00, 0xa9, 0x69, 
+  0x82, 0x00, 0x38, 0xa3, 0x80, 0x00, 0xc9, 0x48, 0x42, 0xc1, 0x49, 0x04, 0xc9, 0x49, 0xa1, 0x48, 
+  0x40, 0x62, 0x40, 0x63, 0x48, 0x63, 0x43, 0x40, 0x63, 0x41, 0x48, 0x63, 0x01, 0x48, 0x83, 0x20, 
+  0x62, 0x43, 0x00, 0x00, 0x82, 0x01, 0xc1, 0x49, 0xc1, 0x69, 0x89, 0x00, 0x64, 0xc8, 0x80, 0x42, 
+  0x75, 0x66, 0x00, 0x85, 0xc9, 0x81, 0x01, 0x6c, 0xa8, 0x75, 0xa7, 0x83, 0x00, 0x32, 0x24, 0x86, 
+  0x00, 0x75, 0x67, 0x80, 0x02, 0x75, 0x66, 0x7d, 0xc7, 0x5c, 0x08, 0x42, 0x00, 0x00, 0x43, 0x00, 
+  0x20, 0x04, 0x00, 0x81, 0x12, 0x02, 0x3b, 0x86, 0x75, 0x88, 0x75, 0x67, 0x42, 0x7d, 0xa7, 0x41, 
+  0x7d, 0xc7, 0x01, 0x75, 0xa7, 0x75, 0x87, 0x43, 0x75, 0xa7, 0x41, 0x7d, 0xa7, 0x00, 0x7d, 0xa8, 
+  0x42, 0x7d, 0xc7, 0x41, 0x7d, 0xa7, 0x09, 0x75, 0x87, 0x75, 0x88, 0x65, 0x2a, 0x22, 0xc5, 0x00, 
+  0x60, 0x00, 0x00, 0x00, 0x40, 0x09, 0xc6, 0x0a, 0x06, 0x0a, 0x27, 0x45, 0x0a, 0x47, 0x43, 0x0a, 
+  0x26, 0x42, 0x0a, 0x27, 0x4a, 0x01, 0xe6, 0x00, 0x02, 0x06, 0x41, 0x01, 0xe6, 0x02, 0x02, 0x06, 
+  0x09, 0xc5, 0x00, 0x20, 0x82, 0x43, 0xc1, 0x49, 0x00, 0x91, 0x47, 0x4e, 0x00, 0x00, 0x80, 0x00, 
+  0xb9, 0x89, 0x43, 0xc1, 0x49, 0x80, 0x00, 0x69, 0x26, 0x80, 0x43, 0x00, 0x20, 0x08, 0x00, 0x00, 
+  0x10, 0x20, 0x48, 0x84, 0x58, 0x64, 0x50, 0x64, 0x50, 0x63, 0x50, 0x84, 0x38, 0x62, 0x10, 0x00, 
+  0x4b, 0x00, 0x00, 0x03, 0x08, 0x00, 0x10, 0x20, 0x40, 0x63, 0x58, 0x84, 0x41, 0x58, 0x64, 0x02, 
+  0x60, 0x64, 0x48, 0x83, 0x08, 0x00, 0x42, 0x00, 0x00, 0x80, 0x00, 0xa1, 0x88, 0x80, 0x02, 0xc1, 
+  0x49, 0xc9, 0x49, 0xc1, 0x49, 0x83, 0x00, 0xb1, 0x68, 0x43, 0xc1, 0x49, 0x80, 0x01, 0x30, 0x82, 
+  0x08, 0x00, 0x83, 0x00, 0xc1, 0x49, 0x83, 0x00, 0xc9, 0x69, 0x88, 0x00, 0xc9, 0x49, 0x83, 0x01, 
+  0x99, 0x48, 0x08, 0x00, 0x4d, 0x00, 0x00, 0x84, 0x01, 0xc1, 0x69, 0xd1, 0x49, 0x84, 0x41, 0x00, 
+  0x00, 0x82, 0x01, 0x6d, 0x66, 0x75, 0x67, 0x80, 0x00, 0x7d, 0xc9, 0x81, 0x01, 0x6c, 0xc9, 0x7d, 
+  0xc7, 0x80, 0x01, 0x75, 0x67, 0x6d, 0x46, 0x89, 0x41, 0x75, 0x67, 0x80, 0x00, 0x64, 0x48, 0x80, 
+  0x44, 0x00, 0x20, 0x05, 0x00, 0x00, 0x08, 0xa1, 0x54, 0x27, 0x6d, 0x48, 0x75, 0x67, 0x75, 0x47, 
+  0x41, 0x75, 0x67, 0x41, 0x75, 0x87, 0x41, 0x75, 0x67, 0x45, 0x6d, 0x46, 0x00, 0x75, 0x46, 0x42, 
+  0x75, 0x67, 0x42, 0x75, 0x87, 0x41, 0x75, 0x67, 0x02, 0x7d, 0xa8, 0x64, 0xe8, 0x11, 0x22, 0x80, 
+  0x05, 0x08, 0xa1, 0x1a, 0x87, 0x12, 0xe8, 0x1a, 0xe8, 0x1b, 0x08, 0x1b, 0x29, 0x44, 0x1b, 0x28, 
+  0x45, 0x1b, 0x08, 0x85, 0x46, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x00, 0x09, 0xc6, 0x80, 0x02, 0x40, 
+  0x82, 0xc9, 0x89, 0xc9, 0x49, 0x83, 0x01, 0x91, 0x48, 0x08, 0x00, 0x80, 0x47, 0x00, 0x20, 0x85, 
+  0x00, 0xb9, 0x69, 0x80, 0x00, 0xc1, 0x69, 0x85, 0x44, 0x00, 0x00, 0x42, 0x08, 0x00, 0x44, 0x00, 
+  0x00, 0x41, 0x00, 0x20, 0x4b, 0x00, 0x00, 0x42, 0x08, 0x00, 0x01, 0x08, 0x20, 0x08, 0x00, 0x43, 
+  0x00, 0x00, 0x80, 0x00, 0x99, 0x88, 0x81, 0x02, 0xc1, 0x49, 0xc9, 0x29, 0xc9, 0x8a, 0x83, 0x01, 
+  0xc9, 0x49, 0xc1, 0x69, 0x85, 0x00, 0xc9, 0x49, 0x80, 0x41, 0xc9, 0x49, 0x82, 0x00, 0xa9, 0x68, 
+  0x80, 0x41, 0xc1, 0x49, 0x01, 0xc9, 0x49, 0xb1, 0x69, 0x8b, 0x44, 0x00, 0x20, 0x83, 0x00, 0x00, 
+  0x20, 0x88, 0x01, 0xc1, 0x49, 0xc9, 0x49, 0x88, 0x01, 0x75, 0x87, 0x75, 0x66, 0x81, 0x01, 0x7d, 
+  0xc8, 0x2a, 0x44, 0x80, 0x00, 0x6c, 0xe9, 0x83, 0x00, 0x7d, 0xa8, 0x8d, 0x43, 0x00, 0x00, 0x80, 
+  0x03, 0x08, 0x41, 0x43, 0x26, 0x7d, 0xa8, 0x75, 0x66, 0x83, 0x00, 0x7d, 0x87, 0x41, 0x7d, 0xc8, 
+  0x01, 0x7d, 0xa8, 0x75, 0xa7, 0x46, 0x75, 0x87, 0x41, 0x7d, 0xa7, 0x45, 0x75, 0x87, 0x06, 0x7d, 
+  0xc8, 0x5c, 0x28, 0x10, 0xa1, 0x00, 0x00, 0x01, 0x64, 0x01, 0xa5, 0x01, 0xc6, 0x4b, 0x01, 0xe6, 
+  0x00, 0x09, 0xe6, 0x4d, 0x01, 0xc6, 0x01, 0x02, 0x06, 0x01, 0xc6, 0x80, 0x01, 0x38, 0x62, 0xc1, 
+  0x89, 0x43, 0xc1, 0x49, 0x01, 0xc9, 0x49, 0x91, 0x47, 0x4e, 0x00, 0x00, 0x83, 0x00, 0xc1, 0x69, 
+  0x89, 0x00, 0x00, 0x00, 0x42, 0x00, 0x20, 0x82, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x42, 0x00, 
+  0x20, 0x82, 0x00, 0x00, 0x20, 0x46, 0x00, 0x00, 0x41, 0x00, 0x20, 0x44, 0x00, 0x00, 0x80, 0x00, 
+  0xa1, 0x88, 0x81, 0x00, 0xc9, 0x49, 0x81, 0x00, 0x48, 0xc4, 0x80, 0x00, 0x18, 0x20, 0x82, 0x00, 
+  0xc1, 0x69, 0x86, 0x00, 0xc1, 0x49, 0x86, 0x41, 0xc9, 0x49, 0x83, 0x00, 0x38, 0x83, 0x80, 0x00, 
+  0xc9, 0x29, 0x83, 0x00, 0xa1, 0x68, 0x4e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x82, 0x41, 0xc1, 0x49, 
+  0x85, 0x00, 0x00, 0x20, 0x81, 0x00, 0x64, 0xe8, 0x81, 0x41, 0x75, 0x66, 0x01, 0x7d, 0xa8, 0x2a, 
+  0x24, 0x80, 0x00, 0x6c, 0xc9, 0x80, 0x41, 0x75, 0x67, 0x84, 0x00, 0x00, 0x20, 0x84, 0x41, 0x75, 
+  0x66, 0x85, 0x04, 0x00, 0x20, 0x00, 0x00, 0x10, 0xe2, 0x7d, 0xaa, 0x75, 0x86, 0x42, 0x75, 0x67, 
+  0x00, 0x75, 0x46, 0x80, 0x03, 0x6d, 0x69, 0x44, 0x66, 0x44, 0x87, 0x44, 0x67, 0x41, 0x3c, 0x47, 
+  0x41, 0x3c, 0x27, 0x00, 0x3c, 0x26, 0x42, 0x3c, 0x27, 0x02, 0x3c, 0x46, 0x44, 0x46, 0x6d, 0x48, 
+  0x80, 0x00, 0x75, 0x67, 0x82, 0x02, 0x75, 0x66, 0x85, 0xe9, 0x21, 0x83, 0x80, 0x00, 0x09, 0xa5, 
+  0x41, 0x01, 0xc6, 0x81, 0x43, 0x09, 0xe6, 0x03, 0x01, 0xc6, 0x09, 0xe6, 0x09, 0xe7, 0x09, 0xe6, 
+  0x41, 0x09, 0xc6, 0x80, 0x01, 0x12, 0xc8, 0x12, 0xe8, 0x41, 0x12, 0xc8, 0x00, 0x12, 0xe8, 0x48, 
+  0x12, 0xc7, 0x01, 0x13, 0x48, 0x12, 0x66, 0x82, 0x00, 0xc1, 0x48, 0x83, 0x03, 0xa9, 0x48, 0x38, 
+  0x62, 0x30, 0x62, 0x38, 0x82, 0x41, 0x38, 0xa3, 0x00, 0x38, 0x83, 0x42, 0x38, 0xa3, 0x04, 0x38, 
+  0x83, 0x50, 0xc4, 0x60, 0xe5, 0x59, 0x05, 0x20, 0x41, 0x81, 0x00, 0xb9, 0x89, 0x8d, 0x5d, 0x00, 
+  0x00, 0x02, 0x08, 0x00, 0xa1, 0x68, 0xd1, 0x49, 0x41, 0xc9, 0x29, 0x00, 0xc1, 0x29, 0x80, 0x02, 
+  0x60, 0xc4, 0x18, 0x41, 0x38, 0x62, 0x80, 0x00, 0xc9, 0x69, 0x8a, 0x00, 0xc1, 0x89, 0x83, 0x01, 
+  0xc1, 0x69, 0xc1, 0x49, 0x85, 0x00, 0xc1, 0x8a, 0x84, 0x01, 0xa9, 0x48, 0x38, 0x62, 0x42, 0x30, 
+  0x82, 0x42, 0x30, 0x83, 0x41, 0x38, 0x83, 0x00, 0x48, 0xc4, 0x41, 0x50, 0xe4, 0x01, 0x50, 0xe5, 
+  0x18, 0x41, 0x80, 0x00, 0x10, 0x00, 0x83, 0x00, 0xc1, 0x69, 0x85, 0x41, 0x00, 0x00, 0x01, 0x00, 
+  0x40, 0x64, 0xc8, 0x80, 0x41, 0x75, 0x67, 0x81, 0x00, 0x21, 0xc3, 0x81, 0x00, 0x7d, 0xa7, 0x41, 
+  0x75, 0x87, 0x81, 0x00, 0x2a, 0x04, 0x43, 0x00, 0x00, 0x83, 0x01, 0x75, 0x87, 0x75, 0x67, 0x85, 
+  0x41, 0x00, 0x00, 0x01, 0x10, 0xc2, 0x75, 0x49, 0x43, 0x75, 0x67, 0x04, 0x75, 0x47, 0x6d, 0x27, 
+  0x33, 0xe7, 0x03, 0x06, 0x0b, 0x27, 0x41, 0x03, 0x27, 0x43, 0x03, 0x06, 0x01, 0x03, 0x07, 0x03, 
+  0x06, 0x41, 0x02, 0xe6, 0x02, 0x03, 0x06, 0x34, 0x07, 0x75, 0x47, 0x42, 0x75, 0x67, 0x81, 0x01, 
+  0x7d, 0x88, 0x21, 0x63, 0x80, 0x01, 0x09, 0xc6, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x45, 0x01, 0xe6, 
+  0x42, 0x09, 0xe7, 0x01, 0x09, 0xe6, 0x09, 0xe7, 0x44, 0x12, 0xa7, 0x00, 0x12, 0x87, 0x41, 0x0a, 
+  0x86, 0x00, 0x0a, 0xa6, 0x42, 0x0a, 0x86, 0x01, 0x0a, 0xa7, 0x0a, 0xa6, 0x80, 0x00, 0x1b, 0x07, 
+  0x82, 0x41, 0xc1, 0x49, 0x43, 0xc9, 0x49, 0x48, 0xc1, 0x89, 0x06, 0xc1, 0x69, 0xc9, 0x69, 0xd1, 
+  0x6a, 0xc9, 0x8a, 0x89, 0x48, 0x10, 0x21, 0x30, 0x41, 0x81, 0x00, 0xc1, 0x49, 0x87, 0x02, 0x18, 
+  0x20, 0x61, 0x05, 0x81, 0x47, 0x42, 0x79, 0x26, 0x41, 0x79, 0x46, 0x00, 0x79, 0x26, 0x41, 0x71, 
+  0x26, 0x52, 0x79, 0x26, 0x01, 0x81, 0x47, 0x40, 0x83, 0x81, 0x00, 0x10, 0x20, 0x81, 0x00, 0xc9, 
+  0x49, 0x42, 0xc1, 0x49, 0x02, 0xb9, 0x69, 0xb9, 0x89, 0xb1, 0x69, 0x42, 0xc1, 0x49, 0x84, 0x00, 
+  0xa1, 0x48, 0x41, 0xc9, 0x49, 0x81, 0x00, 0xb9, 0x89, 0x81, 0x00, 0xa9, 0x88, 0x41, 0xc1, 0x69, 
+  0x82, 0x00, 0x28, 0x41, 0x82, 0x01, 0xc1, 0xaa, 0xc9, 0x49, 0x80, 0x43, 0xc9, 0x49, 0x49, 0xc1, 
+  0x89, 0x41, 0xc9, 0x69, 0x03, 0xc9, 0x8a, 0x91, 0x48, 0x10, 0x41, 0x08, 0x00, 0x80, 0x00, 0xc9, 
+  0x49, 0x80, 0x41, 0xc9, 0x69, 0x84, 0x04, 0x29, 0xc4, 0x5c, 0x08, 0x53, 0xc7, 0x5c, 0x07, 0x6d, 
+  0x27, 0x44, 0x75, 0x67, 0x03, 0x5c, 0x27, 0x4b, 0x86, 0x6d, 0x07, 0x75, 0x67, 0x81, 0x05, 0x75, 
+  0x67, 0x75, 0x88, 0x64, 0x88, 0x5b, 0xc8, 0x5c, 0x08, 0x53, 0x68, 0x41, 0x00, 0x20, 0x01, 0x6c, 
+  0xa8, 0x7d, 0xa7, 0x83, 0x00, 0x64, 0x28, 0x86, 0x00, 0x75, 0x29, 0x44, 0x75, 0x67, 0x04, 0x65, 
+  0x07, 0x13, 0x05, 0x13, 0x07, 0x13, 0x27, 0x13, 0x47, 0x45, 0x13, 0x27, 0x42, 0x13, 0x07, 0x02, 
+  0x0a, 0xe7, 0x13, 0x26, 0x65, 0x27, 0x80, 0x41, 0x75, 0x66, 0x81, 0x01, 0x7d, 0xc9, 0x21, 0x83, 
+  0x80, 0x02, 0x0a, 0x06, 0x02, 0x26, 0x01, 0xe6, 0x41, 0x01, 0xc5, 0x00, 0x01, 0xc6, 0x47, 0x01, 
+  0xe6, 0x41, 0x09, 0xe6, 0x00, 0x01, 0xc5, 0x42, 0x01, 0xc6, 0x03, 0x01, 0xc5, 0x01, 0xa5, 0x01, 
+  0xc6, 0x01, 0xc5, 0x41, 0x01, 0xc6, 0x01, 0x01, 0xc5, 0x01, 0xa6, 0x41, 0x01, 0xc5, 0x01, 0x02, 
+  0x46, 0x12, 0x46, 0x80, 0x00, 0x30, 0x62, 0x82, 0x41, 0xc1, 0x49, 0x46, 0xc9, 0x49, 0x43, 0xc9, 
+  0x29, 0x01, 0xc9, 0x28, 0xc1, 0x28, 0x41, 0xc9, 0x28, 0x01, 0xb1, 0x8a, 0x20, 0x41, 0x82, 0x41, 
+  0xc1, 0x69, 0x86, 0x01, 0x71, 0x26, 0xc1, 0x8a, 0x4d, 0xc9, 0x69, 0x41, 0xd1, 0x69, 0x41, 0xc9, 
+  0x49, 0x42, 0xc9, 0x69, 0x00, 0xc9, 0x49, 0x42, 0xc9, 0x69, 0x05, 0xc9, 0x49, 0xc9, 0x69, 0xc9, 
+  0x49, 0xd1, 0x69, 0xa9, 0x48, 0x28, 0x62, 0x80, 0x00, 0x10, 0x00, 0x81, 0x41, 0xc1, 0x49, 0x41, 
+  0xc1, 0x48, 0x00, 0xc1, 0x49, 0x41, 0xc9, 0x49, 0x43, 0xc1, 0x49, 0x04, 0xc9, 0x49, 0xc1, 0x89, 
+  0x28, 0x62, 0x00, 0x00, 0xa1, 0x68, 0x80, 0x42, 0xc1, 0x49, 0x83, 0x00, 0xc9, 0x69, 0x83, 0x00, 
+  0x28, 0x42, 0x82, 0x01, 0xc1, 0x8a, 0xc1, 0x29, 0x80, 0x00, 0xc9, 0x69, 0x82, 0x41, 0xc9, 0x29, 
+  0x01, 0xc9, 0x49, 0xc9, 0x29, 0x44, 0xc9, 0x28, 0x43, 0xc1, 0x28, 0x01, 0xb1, 0x8a, 0x28, 0x62, 
+  0x80, 0x02, 0x99, 0x48, 0xc9, 0x69, 0xc9, 0x49, 0x82, 0x00, 0xa9, 0x89, 0x81, 0x05, 0x21, 0x63, 
+  0x75, 0x29, 0x7d, 0xa8, 0x7d, 0xa7, 0x7d, 0xc8, 0x75, 0x87, 0x84, 0x41, 0x75, 0x87, 0x00, 0x75, 
+  0x66, 0x41, 0x75, 0x67, 0x41, 0x75, 0x87, 0x06, 0x75, 0x67, 0x7d, 0xa7, 0x7d, 0xc8, 0x7d, 0xa7, 
+  0x7d, 0xa9, 0x42, 0xe6, 0x00, 0x00, 0x80, 0x00, 0x75, 0xa7, 0x41, 0x75, 0x87, 0x00, 0x75, 0x66, 
+  0x89, 0x00, 0x75, 0x66, 0x82, 0x04, 0x75, 0x66, 0x75, 0x68, 0x4b, 0xc7, 0x08, 0xc1, 0x08, 0xe2, 
+  0x49, 0x09, 0x02, 0x02, 0x00, 0xa1, 0x43, 0xc7, 0x75, 0x88, 0x80, 0x41, 0x6d, 0x66, 0x41, 0x75, 
+  0x66, 0x02, 0x85, 0xc9, 0x21, 0xa3, 0x00, 0x60, 0x41, 0x1b, 0x48, 0x41, 0x12, 0xe8, 0x00, 0x12, 
+  0xc8, 0x42, 0x12, 0xe8, 0x41, 0x1b, 0x08, 0x00, 0x12, 0xe8, 0x44, 0x1b, 0x08, 0x01, 0x09, 0xe6, 
+  0x01, 0xe7, 0x42, 0x01, 0xe6, 0x01, 0x09, 0xe6, 0x01, 0xe7, 0x45, 0x01, 0xe6, 0x03, 0x01, 0xc6, 
+  0x01, 0xe6, 0x09, 0xe5, 0x00, 0x00, 0x81, 0x00, 0xc1, 0x28, 0x85, 0x43, 0xc1, 0x49, 0x00, 0xc9, 
+  0x49, 0x45, 0xc1, 0x49, 0x02, 0xc9, 0x29, 0xb1, 0x89, 0x18, 0x41, 0x83, 0x41, 0xc1, 0x49, 0x82, 
+  0x41, 0x00, 0x00, 0x05, 0x08, 0x00, 0x99, 0x68, 0xc9, 0x69, 0xc1, 0x29, 0xc1, 0x28, 0xc1, 0x48, 
+  0x41, 0xc1, 0x28, 0x41, 0xc1, 0x48, 0x43, 0xc1, 0x28, 0x41, 0xc1, 0x48, 0x03, 0xc9, 0x48, 0xc9, 
+  0x49, 0xc9, 0x48, 0xc9, 0x28, 0x41, 0xc1, 0x28, 0x00, 0xc1, 0x48, 0x48, 0xc1, 0x28, 0x01, 0xc1, 
+  0x69, 0x50, 0x83, 0x80, 0x02, 0x08, 0x20, 0xa1, 0x88, 0xc9, 0x49, 0x82, 0x47, 0xc1, 0x49, 0x80, 
+  0x02, 0xc1, 0x8a, 0x30, 0x62, 0x08, 0x00, 0x81, 0x41, 0xc9, 0x49, 0x83, 0x00, 0xa9, 0x89, 0x84, 
+  0x00, 0x28, 0x41, 0x82, 0x00, 0xc1, 0xaa, 0x41, 0xc1, 0x49, 0x01, 0xc9, 0x49, 0xc1, 0x49, 0x81, 
+  0x46, 0xc1, 0x49, 0x41, 0xc9, 0x49, 0x02, 0xc1, 0x49, 0xc1, 0x29, 0xc1, 0x48, 0x83, 0x00, 0xa1, 
+  0x48, 0x82, 0x00, 0xc1, 0x49, 0x83, 0x02, 0x29, 0xe4, 0x85, 0xc9, 0x75, 0x67, 0x41, 0x75, 0x66, 
+  0x00, 0x75, 0x67, 0x41, 0x75, 0x66, 0x43, 0x75, 0x67, 0x00, 0x75, 0x46, 0x84, 0x05, 0x75, 0x87, 
+  0x75, 0x86, 0x75, 0x66, 0x6d, 0x46, 0x75, 0x87, 0x53, 0xa7, 0x80, 0x01, 0x6c, 0xc8, 0x75, 0xc7, 
+  0x82, 0x00, 0x7d, 0xa7, 0x86, 0x01, 0x10, 0xa1, 0x6d, 0x09, 0x45, 0x75, 0x67, 0x01, 0x75, 0x28, 
+  0x6c, 0x88, 0x44, 0x6c, 0xa8, 0x00, 0x74, 0xa8, 0x44, 0x6c, 0xa8, 0x01, 0x6c, 0x88, 0x75, 0x28, 
+  0x41, 0x75, 0x67, 0x82, 0x06, 0x75, 0x87, 0x7d, 0x89, 0x19, 0x83, 0x00, 0x80, 0x12, 0xc6, 0x0a, 
+  0x87, 0x0a, 0x46, 0x41, 0x0a, 0x26, 0x42, 0x0a, 0x27, 0x43, 0x0a, 0x47, 0x41, 0x0a, 0x67, 0x01, 
+  0x0a, 0x47, 0x0a, 0x67, 0x4c, 0x01, 0xc6, 0x02, 0x01, 0xa6, 0x12, 0x87, 0x11, 0xe5, 0x80, 0x03, 
+  0x28, 0x62, 0xa9, 0x48, 0xb9, 0x08, 0xc1, 0x29, 0x44, 0xc9, 0x49, 0x4a, 0xc1, 0x49, 0x01, 0xc1, 
+  0x28, 0xa1, 0x48, 0x80, 0x00, 0x30, 0x42, 0x80, 0x41, 0xc1, 0x69, 0x87, 0x00, 0x91, 0x47, 0x45, 
+  0xc1, 0x49, 0x80, 0x41, 0xc1, 0x49, 0x00, 0xc1, 0x48, 0x48, 0xc1, 0x49, 0x44, 0xc1, 0x48, 0x43, 
+  0xc1, 0x49, 0x00, 0xc1, 0x48, 0x81, 0x00, 0x48, 0x83, 0x41, 0x00, 0x00, 0x00, 0x81, 0x06, 0x45, 
+  0xc1, 0x49, 0x01, 0xc9, 0x49, 0xc9, 0x69, 0x41, 0xc9, 0x49, 0x80, 0x01, 0xc9, 0x49, 0xc9, 0x29, 
+  0x82, 0x00, 0x99, 0x68, 0x81, 0x01, 0xc1, 0x49, 0xc9, 0x49, 0x82, 0x00, 0xa9, 0x69, 0x80, 0x41, 
+  0xc1, 0x49, 0x84, 0x02, 0x30, 0x62, 0xb1, 0x48, 0xc9, 0x49, 0x47, 0xc1, 0x49, 0x00, 0xc9, 0x49, 
+  0x81, 0x00, 0xc9, 0x29, 0x42, 0xc1, 0x29, 0x03, 0xc9, 0x49, 0xc1, 0x49, 0xc1, 0x48, 0xa9, 0x69, 
+  0x83, 0x00, 0xc1, 0x49, 0x42, 0xc9, 0x49, 0x00, 0xa9, 0x69, 0x82, 0x01, 0x7d, 0xca, 0x75, 0x47, 
+  0x4d, 0x75, 0x66, 0x00, 0x75, 0x67, 0x42, 0x75, 0x66, 0x05, 0x75, 0x46, 0x75, 0x68, 0x4b, 0x47, 
+  0x00, 0x20, 0x6c, 0xc9, 0x7d, 0xa7, 0x81, 0x00, 0x6d, 0x66, 0x87, 0x03, 0x00, 0x60, 0x43, 0xe6, 
+  0x75, 0x87, 0x75, 0x66, 0x44, 0x75, 0x67, 0x01, 0x7d, 0xa7, 0x75, 0xa7, 0x48, 0x7d, 0xa7, 0x02, 
+  0x7d, 0xc7, 0x7d, 0xa7, 0x75, 0x87, 0x80, 0x42, 0x75, 0x66, 0x04, 0x75, 0x46, 0x7d, 0xa8, 0x54, 
+  0x87, 0x09, 0x01, 0x00, 0x41, 0x41, 0x01, 0xe6, 0x43, 0x01, 0xa6, 0x49, 0x01, 0xc6, 0x45, 0x0a, 
+  0x67, 0x02, 0x0a, 0x47, 0x0a, 0x67, 0x0a, 0x66, 0x43, 0x0a, 0x67, 0x02, 0x0a, 0x46, 0x23, 0x29, 
+  0x19, 0xe6, 0x80, 0x06, 0x18, 0x21, 0x70, 0x64, 0x90, 0xa6, 0xc1, 0x49, 0xc1, 0x28, 0xc1, 0x49, 
+  0xc1, 0x29, 0x42, 0xc1, 0x28, 0x00, 0xb9, 0x48, 0x42, 0xb9, 0x28, 0x02, 0xb9, 0x48, 0xb9, 0x28, 
+  0xc1, 0x28, 0x80, 0x04, 0xb9, 0x28, 0xb1, 0x08, 0x90, 0x65, 0x68, 0x64, 0x10, 0x20, 0x81, 0x00, 
+  0xc1, 0x49, 0x41, 0xc9, 0x49, 0x81, 0x00, 0x69, 0x06, 0x80, 0x41, 0x00, 0x20, 0x01, 0x08, 0x20, 
+  0x81, 0x26, 0x80, 0x00, 0xc1, 0x69, 0x43, 0xc9, 0x69, 0x01, 0xc9, 0x49, 0xc9, 0x69, 0x47, 0xc9, 
+  0x49, 0x00, 0xc9, 0x69, 0x45, 0xc9, 0x49, 0x41, 0xc9, 0x69, 0x43, 0xc9, 0x49, 0x02, 0xc1, 0x49, 
+  0xb1, 0x48, 0x40, 0x62, 0x81, 0x02, 0x50, 0x63, 0x88, 0x85, 0xb1, 0x28, 0x80, 0x00, 0xc1, 0x48, 
+  0x81, 0x07, 0xb9, 0x28, 0xc1, 0x49, 0xc1, 0x48, 0xc1, 0x49, 0xc1, 0x29, 0xb9, 0x28, 0xb9, 0x08, 
+  0xb9, 0x89, 0x81, 0x00, 0xa1, 0x68, 0x80, 0x41, 0xc1, 0x49, 0x00, 0xc1, 0x48, 0x80, 0x00, 0x38, 
+  0x82, 0x80, 0x01, 0xa9, 0x68, 0xc9, 0x49, 0x80, 0x41, 0xc1, 0x28, 0x83, 0x05, 0x28, 0x41, 0x88, 
+  0x85, 0xa8, 0xc7, 0xb9, 0x49, 0xb9, 0x28, 0xc1, 0x28, 0x42, 0xb9, 0x48, 0x00, 0xc1, 0x48, 0x43, 
+  0xc1, 0x28, 0x0b, 0xb9, 0x28, 0xb9, 0x08, 0xb9, 0x28, 0xb9, 0x08, 0xb1, 0x08, 0xb1, 0x28, 0x98, 
+  0xa6, 0x70, 0x85, 0x18, 0x21, 0x10, 0x00, 0x99, 0x47, 0xc9, 0x49, 0x42, 0xc1, 0x49, 0x80, 0x00, 
+  0xa9, 0x89, 0x81, 0x03, 0x19, 0x42, 0x64, 0xc8, 0x75, 0x88, 0x75, 0x68, 0x4f, 0x75, 0x88, 0x06, 
+  0x75, 0x68, 0x75, 0x88, 0x6d, 0x09, 0x22, 0x24, 0x00, 0x40, 0x6c, 0xc8, 0x75, 0xa7, 0x41, 0x75, 
+  0x66, 0x01, 0x6d, 0x46, 0x75, 0xa7, 0x86, 0x03, 0x00, 0x80, 0x23, 0x45, 0x65, 0x48, 0x75, 0xa7, 
+  0x80, 0x41, 0x75, 0x66, 0x43, 0x75, 0x67, 0x00, 0x75, 0x66, 0x41, 0x75, 0x67, 0x4b, 0x75, 0x66, 
+  0x04, 0x75, 0x67, 0x75, 0x68, 0x65, 0x09, 0x2b, 0xa6, 0x09, 0x02, 0x80, 0x02, 0x12, 0x66, 0x0a, 
+  0x87, 0x0a, 0x67, 0x42, 0x0a, 0x47, 0x42, 0x0a, 0x67, 0x42, 0x0a, 0x47, 0x43, 0x12, 0x67, 0x41, 
+  0x1b, 0x08, 0x42, 0x1a, 0xe8, 0x41, 0x1b, 0x08, 0x00, 0x1a, 0xe8, 0x43, 0x1b, 0x08, 0x04, 0x1a, 
+  0xe7, 0x23, 0x28, 0x12, 0xc7, 0x09, 0xc5, 0x00, 0x20, 0x80, 0x01, 0x70, 0x65, 0x78, 0x45, 0x41, 
+  0x80, 0x65, 0x49, 0x80, 0x45, 0x06, 0x80, 0x44, 0x80, 0x45, 0x88, 0x45, 0x80, 0x44, 0x78, 0x24, 
+  0x78, 0x44, 0x60, 0x85, 0x80, 0x02, 0x30, 0x41, 0xc1, 0xaa, 0xc9, 0x69, 0x81, 0x02, 0xc1, 0x69, 
+  0xc1, 0xaa, 0x69, 0x26, 0x81, 0x03, 0x00, 0x00, 0x08, 0x00, 0x58, 0x64, 0x98, 0xc7, 0x42, 0xa9, 
+  0x07, 0x54, 0xa8, 0xe7, 0x00, 0xa9, 0x07, 0x41, 0xb0, 0xe7, 0x41, 0xa8, 0xe7, 0x01, 0x80, 0x85, 
+  0x30, 0x21, 0x81, 0x03, 0x50, 0x84, 0x78, 0x44, 0x80, 0x44, 0x88, 0x65, 0x41, 0x80, 0x65, 0x42, 
+  0x80, 0x44, 0x01, 0x80, 0x45, 0x88, 0x65, 0x41, 0x88, 0x45, 0x05, 0x80, 0x44, 0x80, 0x85, 0x20, 
+  0x41, 0x08, 0x20, 0xa1, 0x88, 0xc9, 0x69, 0x42, 0xc1, 0x49, 0x01, 0xc1, 0xaa, 0x38, 0xa3, 0x80, 
+  0x01, 0xb1, 0x89, 0xc9, 0x69, 0x42, 0xc1, 0x49, 0x01, 0xb1, 0x89, 0x30, 0x62, 0x80, 0x03, 0x00, 
+  0x20, 0x28, 0x42, 0x78, 0x85, 0x80, 0x44, 0x44, 0x80, 0x45, 0x01, 0x80, 0x44, 0x80, 0x45, 0x43, 
+  0x88, 0x45, 0x41, 0x80, 0x44, 0x00, 0x80, 0x45, 0x42, 0x80, 0x44, 0x05, 0x78, 0x44, 0x68, 0xa5, 
+  0x10, 0x41, 0x08, 0x00, 0xa1, 0x68, 0xc9, 0x69, 0x82, 0x02, 0xd1, 0x69, 0xb1, 0x89, 0x20, 0x41, 
+  0x80, 0x02, 0x09, 0x02, 0x1b, 0x06, 0x23, 0x86, 0x41, 0x23, 0xa6, 0x00, 0x23, 0xa7, 0x41, 0x23, 
+  0xc7, 0x4c, 0x23, 0xa6, 0x41, 0x23, 0xc7, 0x03, 0x12, 0x24, 0x00, 0x60, 0x6c, 0xe9, 0x7d, 0xa8, 
+  0x42, 0x75, 0x67, 0x01, 0x85, 0xe9, 0x6c, 0x49, 0x83, 0x00, 0x00, 0x20, 0x80, 0x05, 0x08, 0xa1, 
+  0x13, 0x06, 0x2b, 0xc6, 0x5c, 0xe8, 0x6d, 0x48, 0x75, 0x87, 0x42, 0x75, 0xa7, 0x41, 0x75, 0xa8, 
+  0x03, 0x7d, 0xa7, 0x75, 0xa7, 0x75, 0x88, 0x7d, 0x87, 0x45, 0x7d, 0xa7, 0x42, 0x75, 0xa7, 0x0a, 
+  0x75, 0x87, 0x7d, 0x87, 0x65, 0x07, 0x4c, 0x88, 0x23, 0x86, 0x1b, 0x26, 0x09, 0x22, 0x00, 0x60, 
+  0x1a, 0xe7, 0x1b, 0x27, 0x1b, 0x08, 0x47, 0x12, 0xe8, 0x44, 0x1a, 0xe8, 0x42, 0x01, 0xc6, 0x42, 
+  0x01, 0xc5, 0x42, 0x01, 0xe5, 0x41, 0x01, 0xe6, 0x08, 0x02, 0x06, 0x01, 0xe5, 0x01, 0xc4, 0x43, 
+  0xcd, 0x64, 0x2f, 0x08, 0x61, 0x18, 0x20, 0x68, 0x85, 0x78, 0x65, 0x41, 0x78, 0x45, 0x45, 0x78, 
+  0x44, 0x42, 0x78, 0x45, 0x41, 0x78, 0x44, 0x00, 0x78, 0x45, 0x41, 0x78, 0x44, 0x02, 0x78, 0x45, 
+  0x78, 0x65, 0x68, 0xa5, 0x80, 0x07, 0x28, 0x41, 0xa1, 0x48, 0xb1, 0x08, 0xa8, 0xe7, 0xa0, 0xe7, 
+  0x98, 0xe7, 0xa1, 0x28, 0x58, 0xc4, 0x43, 0x00, 0x00, 0x01, 0x58, 0x84, 0x78, 0x44, 0x45, 0x78, 
+  0x24, 0x42, 0x78, 0x04, 0x00, 0x70, 0x24, 0x50, 0x78, 0x24, 0x41, 0x78, 0x04, 0x01, 0x78, 0x65, 
+  0x30, 0x42, 0x81, 0x01, 0x40, 0x83, 0x78, 0x85, 0x41, 0x78, 0x45, 0x00, 0x78, 0x44, 0x42, 0x70, 
+  0x44, 0x41, 0x78, 0x44, 0x43, 0x78, 0x24, 0x00, 0x78, 0x65, 0x81, 0x02, 0x89, 0x27, 0xa0, 0xe7, 
+  0x98, 0xe7, 0x41, 0xa0, 0xe7, 0x09, 0xa9, 0x28, 0x30, 0x82, 0x10, 0x20, 0x91, 0x27, 0xa8, 0xe7, 
+  0x98, 0xc7, 0x98, 0xe7, 0x98, 0xc7, 0x91, 0x07, 0x28, 0x41, 0x41, 0x00, 0x00, 0x02, 0x28, 0x41, 
+  0x70, 0xa5, 0x78, 0x65, 0x44, 0x70, 0x44, 0x00, 0x78, 0x24, 0x41, 0x78, 0x44, 0x44, 0x78, 0x24, 
+  0x42, 0x78, 0x44, 0x01, 0x80, 0x45, 0x80, 0x65, 0x82, 0x07, 0x89, 0x06, 0xa0, 0xe7, 0x98, 0xc6, 
+  0x98, 0xe7, 0xa0, 0xe7, 0xb1, 0x08, 0x88, 0xa6, 0x18, 0x21, 0x80, 0x01, 0x09, 0x22, 0x13, 0x27, 
+  0x41, 0x02, 0xe6, 0x44, 0x03, 0x06, 0x00, 0x03, 0x07, 0x4b, 0x03, 0x06, 0x01, 0x0b, 0x88, 0x12, 
+  0x66, 0x80, 0x06, 0x4c, 0x08, 0x4c, 0x67, 0x44, 0x47, 0x44, 0x67, 0x4c, 0x88, 0x54, 0xe9, 0x43, 
+  0x87, 0x85, 0x05, 0x00, 0x40, 0x12, 0x04, 0x13, 0x06, 0x0b, 0x26, 0x34, 0x07, 0x4c, 0x88, 0x41, 
+  0x44, 0x88, 0x42, 0x4c, 0x88, 0x05, 0x44, 0x87, 0x44, 0x68, 0x44, 0x88, 0x44, 0x67, 0x44, 0x87, 
+  0x44, 0x88, 0x45, 0x4c, 0x88, 0x41, 0x44, 0x88, 0x09, 0x4c, 0x88, 0x2b, 0xc7, 0x02, 0xa5, 0x0b, 
+  0x06, 0x12, 0x45, 0x00, 0x61, 0x00, 0x40, 0x01, 0xc5, 0x01, 0xe5, 0x01, 0xc6, 0x4c, 0x01, 0xe6, 
+  0x41, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x0a, 0x01, 0xc6, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe6, 0x01, 
+  0xe7, 0x0a, 0x07, 0x02, 0x07, 0x01, 0x64, 0x4b, 0x6d, 0xc7, 0x1b, 0xd7, 0x3c, 0x80, 0x03, 0x00, 
+  0x00, 0x28, 0x41, 0x60, 0x84, 0x80, 0x86, 0x4d, 0x78, 0x65, 0x41, 0x78, 0x85, 0x05, 0x50, 0x83, 
+  0x28, 0x62, 0x00, 0x20, 0x20, 0x21, 0x78, 0x65, 0x78, 0x44, 0x41, 0x78, 0x24, 0x02, 0x70, 0x24, 
+  0x78, 0x45, 0x40, 0x43, 0x83, 0x02, 0x50, 0x83, 0x78, 0x65, 0x78, 0x44, 0x80, 0x41, 0x78, 0x44, 
+  0x44, 0x80, 0x24, 0x01, 0x78, 0x24, 0x78, 0x44, 0x80, 0x4a, 0x80, 0x44, 0x00, 0x80, 0x24, 0x81, 
+  0x41, 0x80, 0x24, 0x02, 0x80, 0x45, 0x60, 0x64, 0x20, 0x41, 0x80, 0x02, 0x00, 0x20, 0x10, 0x20, 
+  0x50, 0x83, 0x44, 0x78, 0x85, 0x43, 0x78, 0x65, 0x42, 0x80, 0x65, 0x00, 0x78, 0xa6, 0x80, 0x01, 
+  0x00, 0x20, 0x58, 0x84, 0x41, 0x78, 0x44, 0x05, 0x78, 0x24, 0x80, 0x24, 0x78, 0x45, 0x20, 0x41, 
+  0x08, 0x20, 0x68, 0x64, 0x42, 0x78, 0x24, 0x02, 0x70, 0x24, 0x68, 0x44, 0x28, 0x21, 0x80, 0x03, 
+  0x00, 0x20, 0x08, 0x20, 0x30, 0x42, 0x68, 0x84, 0x47, 0x78, 0x65, 0x00, 0x80, 0x65, 0x45, 0x78, 
+  0x65, 0x07, 0x80, 0x85, 0x78, 0x85, 0x60, 0x84, 0x30, 0x62, 0x00, 0x20, 0x08, 0x20, 0x68, 0x64, 
+  0x80, 0x24, 0x41, 0x70, 0x24, 0x41, 0x78, 0x24, 0x00, 0x70, 0x64, 0x81, 0x02, 0x08, 0x81, 0x09, 
+  0x83, 0x12, 0x86, 0x45, 0x0b, 0x47, 0x00, 0x0b, 0x68, 0x42, 0x0b, 0x47, 0x06, 0x13, 0x48, 0x13, 
+  0x47, 0x13, 0x48, 0x13, 0x47, 0x0b, 0x48, 0x0b, 0x47, 0x13, 0x48, 0x41, 0x13, 0x47, 0x03, 0x12, 
+  0x45, 0x09, 0x42, 0x00, 0x80, 0x12, 0xe6, 0x43, 0x03, 0x06, 0x02, 0x03, 0x46, 0x0a, 0x44, 0x00, 
+  0x20, 0x81, 0x42, 0x00, 0x20, 0x03, 0x00, 0x00, 0x00, 0x40, 0x1a, 0x45, 0x13, 0x47, 0x42, 0x03, 
+  0x26, 0x43, 0x03, 0x06, 0x01, 0x03, 0x26, 0x03, 0x06, 0x42, 0x03, 0x26, 0x02, 0x03, 0x06, 0x03, 
+  0x26, 0x03, 0x06, 0x45, 0x03, 0x26, 0x08, 0x03, 0x06, 0x02, 0xe6, 0x12, 0xe7, 0x12, 0x05, 0x00, 
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x09, 0xa5, 0x01, 0xe6, 0x81, 0x02, 0x01, 0xe7, 0x09, 0xe7, 0x01, 
+  0xe7, 0x46, 0x09, 0xe7, 0x01, 0x09, 0xe6, 0x09, 0xe7, 0x46, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x07, 
+  0x01, 0xe6, 0x01, 0xc6, 0x33, 0x2b, 0x85, 0x13, 0xbe, 0x99, 0xd7, 0x5d, 0xcf, 0x1c, 0x7c, 0x30, 
+  0x41, 0x00, 0x00, 0x01, 0x18, 0x41, 0x30, 0x62, 0x4a, 0x30, 0x42, 0x42, 0x28, 0x42, 0x02, 0x28, 
+  0x62, 0x20, 0x41, 0x08, 0x00, 0x41, 0x00, 0x00, 0x01, 0x20, 0x41, 0x70, 0xa5, 0x41, 0x78, 0x65, 
+  0x03, 0x80, 0x65, 0x78, 0x65, 0x80, 0xa6, 0x38, 0x83, 0x83, 0x03, 0x10, 0x20, 0x48, 0x83, 0x60, 
+  0xa5, 0x60, 0x84, 0x42, 0x68, 0x84, 0x46, 0x60, 0x64, 0x44, 0x60, 0x84, 0x44, 0x68, 0x84, 0x02, 
+  0x68, 0x64, 0x60, 0x84, 0x60, 0x64, 0x42, 0x58, 0x64, 0x06, 0x60, 0x84, 0x38, 0x62, 0x00, 0x00, 
+  0x00, 0x40, 0x00, 0x61, 0x00, 0x20, 0x08, 0x20, 0x42, 0x28, 0x62, 0x43, 0x28, 0x42, 0x44, 0x30, 
+  0x42, 0x01, 0x30, 0x62, 0x08, 0x20, 0x80, 0x01, 0x58, 0xa4, 0x78, 0x85, 0x42, 0x80, 0x85, 0x00, 
+  0x78, 0xa6, 0x80, 0x02, 0x00, 0x00, 0x60, 0x85, 0x78, 0x65, 0x42, 0x80, 0x65, 0x01, 0x70, 0xa5, 
+  0x20, 0x41, 0x81, 0x03, 0x00, 0x20, 0x00, 0x00, 0x18, 0x41, 0x28, 0x62, 0x44, 0x30, 0x42, 0x00, 
+  0x28, 0x42, 0x45, 0x30, 0x42, 0x42, 0x30, 0x62, 0x01, 0x28, 0x41, 0x08, 0x00, 0x41, 0x00, 0x00, 
+  0x80, 0x02, 0x68, 0xa5, 0x88, 0x86, 0x80, 0x65, 0x42, 0x78, 0x65, 0x01, 0x68, 0x84, 0x10, 0x20, 
+  0x41, 0x00, 0x20, 0x01, 0x00, 0x00, 0x08, 0xe2, 0x4d, 0x09, 0xc4, 0x42, 0x09, 0xe4, 0x06, 0x11, 
+  0xe4, 0x11, 0xa4, 0x00, 0x40, 0x00, 0x00, 0x08, 0x81, 0x23, 0x48, 0x13, 0x88, 0x41, 0x13, 0x68, 
+  0x02, 0x13, 0x47, 0x13, 0x68, 0x1a, 0x66, 0x81, 0x42, 0x00, 0x20, 0x42, 0x00, 0x00, 0x03, 0x08, 
+  0x81, 0x1a, 0x66, 0x1b, 0xa8, 0x13, 0x88, 0x52, 0x13, 0x68, 0x03, 0x13, 0x47, 0x1b, 0x48, 0x12, 
+  0x05, 0x00, 0x20, 0x41, 0x00, 0x00, 0x01, 0x08, 0xe3, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x80, 0x00, 
+  0x01, 0xe6, 0x45, 0x09, 0xe6, 0x43, 0x09, 0xe7, 0x84, 0x41, 0x01, 0xc6, 0x0a, 0x01, 0xa6, 0x01, 
+  0xa5, 0x01, 0x85, 0x2a, 0xaa, 0xbe, 0xba, 0xef, 0xff, 0xd7, 0x5d, 0xd7, 0x3d, 0xd7, 0x5d, 0xd7, 
+  0x3c, 0x31, 0xe7, 0x52, 0x00, 0x00, 0x41, 0x00, 0x40, 0x80, 0x03, 0x08, 0x20, 0x28, 0x62, 0x30, 
+  0x62, 0x38, 0x62, 0x41, 0x40, 0x62, 0x01, 0x38, 0x62, 0x10, 0x21, 0x80, 0x05, 0x09, 0x02, 0x19, 
+  0xe5, 0x00, 0x61, 0x00, 0x00, 0x00, 0x20, 0x08, 0x20, 0x43, 0x10, 0x20, 0x4a, 0x08, 0x20, 0x46, 
+  0x10, 0x20, 0x00, 0x08, 0x20, 0x44, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x11, 0x84, 0x12, 
+  0x26, 0x08, 0xe2, 0x4f, 0x00, 0x00, 0x00, 0x20, 0x61, 0x41, 0x38, 0x62, 0x03, 0x40, 0x62, 0x38, 
+  0x62, 0x30, 0x62, 0x08, 0x20, 0x80, 0x01, 0x28, 0x62, 0x30, 0x62, 0x42, 0x40, 0x63, 0x05, 0x30, 
+  0x62, 0x00, 0x00, 0x00, 0x20, 0x09, 0x23, 0x01, 0x03, 0x00, 0x20, 0x51, 0x00, 0x00, 0x04, 0x00, 
+  0x20, 0x00, 0x81, 0x00, 0x40, 0x00, 0x00, 0x28, 0x62, 0x43, 0x38, 0x62, 0x05, 0x30, 0x42, 0x18, 
+  0x41, 0x00, 0x00, 0x00, 0x81, 0x09, 0x63, 0x00, 0x61, 0x53, 0x00, 0x00, 0x41, 0x00, 0x20, 0x02, 
+  0x00, 0x40, 0x11, 0x43, 0x11, 0xa3, 0x41, 0x11, 0xc4, 0x06, 0x11, 0x83, 0x11, 0x63, 0x08, 0xe2, 
+  0x00, 0x00, 0x08, 0xc1, 0x1a, 0x05, 0x09, 0x64, 0x41, 0x09, 0x44, 0x04, 0x09, 0x23, 0x00, 0x81, 
+  0x00, 0x00, 0x08, 0xa1, 0x11, 0x84, 0x47, 0x11, 0x63, 0x42, 0x09, 0x63, 0x41, 0x11, 0x63, 0x42, 
+  0x09, 0x63, 0x41, 0x11, 0x63, 0x00, 0x09, 0x63, 0x41, 0x11, 0x63, 0x01, 0x11, 0x43, 0x08, 0x60, 
+  0x41, 0x00, 0x00, 0x01, 0x08, 0xe2, 0x09, 0xc6, 0x41, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x00, 0x01, 
+  0xe7, 0x80, 0x42, 0x01, 0xe6, 0x85, 0x85, 0x0d, 0x01, 0x85, 0x01, 0x44, 0x19, 0xe7, 0xae, 0x18, 
+  0xc6, 0xda, 0xdf, 0x7d, 0xd7, 0x3c, 0xe7, 0x9e, 0xcf, 0x1c, 0xb6, 0x79, 0x2a, 0x89, 0x09, 0x64, 
+  0x01, 0x03, 0x00, 0xc2, 0x42, 0x00, 0x61, 0x03, 0x08, 0x81, 0x08, 0xe2, 0x08, 0xa2, 0x08, 0xc2, 
+  0x41, 0x09, 0x02, 0x42, 0x08, 0xc2, 0x02, 0x09, 0x02, 0x08, 0xa2, 0x00, 0x82, 0x41, 0x00, 0xa2, 
+  0x02, 0x1a, 0x46, 0x12, 0x06, 0x00, 0x61, 0x47, 0x00, 0x00, 0x04, 0x00, 0x40, 0x12, 0x05, 0x1a, 
+  0xc7, 0x09, 0x43, 0x00, 0x20, 0x41, 0x00, 0x00, 0x41, 0x00, 0x20, 0x4c, 0x00, 0x00, 0x00, 0x00, 
+  0x20, 0x46, 0x00, 0x00, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x08, 0x00, 0x20, 0x09, 0x83, 0x0a, 
+  0x66, 0x02, 0x45, 0x0a, 0x05, 0x09, 0x43, 0x09, 0x02, 0x01, 0x02, 0x08, 0xe2, 0x42, 0x00, 0xe2, 
+  0x41, 0x01, 0x02, 0x43, 0x09, 0x02, 0x02, 0x01, 0x02, 0x09, 0x63, 0x08, 0xe2, 0x4d, 0x00, 0x00, 
+  0x04, 0x00, 0x20, 0x09, 0x43, 0x02, 0x05, 0x02, 0x26, 0x09, 0xa4, 0x43, 0x09, 0x02, 0x00, 0x08, 
+  0xe2, 0x44, 0x00, 0xe2, 0x01, 0x08, 0xe2, 0x00, 0xe2, 0x44, 0x09, 0x02, 0x04, 0x00, 0xe2, 0x09, 
+  0xa4, 0x0a, 0x46, 0x09, 0xc4, 0x00, 0x40, 0x46, 0x00, 0x00, 0x05, 0x00, 0x40, 0x09, 0x83, 0x0a, 
+  0x66, 0x09, 0x83, 0x00, 0xe1, 0x00, 0xe2, 0x4b, 0x08, 0xe2, 0x08, 0x08, 0xe1, 0x08, 0xe2, 0x00, 
+  0xe2, 0x08, 0xe2, 0x00, 0xe2, 0x09, 0x02, 0x1a, 0x06, 0x19, 0xc5, 0x00, 0x20, 0x46, 0x00, 0x00, 
+  0x02, 0x00, 0x40, 0x22, 0x86, 0x1a, 0xc7, 0x41, 0x01, 0xc6, 0x04, 0x01, 0xc5, 0x12, 0x46, 0x1a, 
+  0x46, 0x00, 0x81, 0x00, 0x20, 0x57, 0x00, 0x00, 0x03, 0x00, 0x20, 0x08, 0xe2, 0x09, 0xa6, 0x01, 
+  0xc6, 0x44, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x81, 0x00, 0x01, 0xe7, 0x80, 0x43, 0x09, 0xe7, 0x00, 
+  0x0a, 0x07, 0x41, 0x01, 0xe7, 0x80, 0x01, 0x01, 0xe7, 0x0a, 0x07, 0x80, 0x09, 0x11, 0xe7, 0x22, 
+  0x28, 0xae, 0x17, 0xd7, 0x7d, 0xd7, 0x3c, 0xcf, 0x1c, 0xc6, 0xba, 0xbe, 0x79, 0x3b, 0x4c, 0x0a, 
+  0x27, 0x43, 0x01, 0xc6, 0x26, 0x01, 0xa6, 0x09, 0xa6, 0x09, 0x86, 0x09, 0xe6, 0x1a, 0xe8, 0x09, 
+  0xc5, 0x01, 0xc6, 0x1a, 0xe8, 0x1b, 0x08, 0x01, 0xe6, 0x09, 0xe6, 0x0a, 0x26, 0x23, 0x28, 0x09, 
+  0xe5, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0xc6, 0x1a, 0xe8, 0x0a, 0x46, 0x09, 0x85, 0x08, 0xa2, 0x00, 
+  0x41, 0x00, 0x81, 0x08, 0xc1, 0x08, 0xa1, 0x08, 0xa2, 0x00, 0xa2, 0x09, 0x02, 0x09, 0x84, 0x0a, 
+  0x26, 0x12, 0xa7, 0x01, 0x85, 0x09, 0x44, 0x11, 0xe5, 0x09, 0xa4, 0x01, 0x23, 0x01, 0x03, 0x09, 
+  0x84, 0x11, 0xc5, 0x41, 0x09, 0x44, 0x06, 0x09, 0x63, 0x12, 0x05, 0x09, 0xa5, 0x09, 0x64, 0x09, 
+  0x44, 0x01, 0x23, 0x09, 0xa4, 0x41, 0x12, 0x25, 0x02, 0x09, 0xe4, 0x32, 0x68, 0xa5, 0x95, 0x41, 
+  0xb5, 0xf7, 0x09, 0xad, 0xb6, 0xb6, 0x17, 0xa5, 0x54, 0x3a, 0xe9, 0x22, 0x46, 0x22, 0x06, 0x1a, 
+  0x06, 0x22, 0x46, 0x22, 0x87, 0x23, 0x28, 0x42, 0x1b, 0x48, 0x01, 0x1b, 0x49, 0x23, 0x49, 0x41, 
+  0x1b, 0x29, 0x02, 0x1b, 0x28, 0x1b, 0x08, 0x1b, 0x28, 0x42, 0x1b, 0x29, 0x43, 0x23, 0x29, 0x02, 
+  0x23, 0x69, 0x22, 0xc8, 0x00, 0xa2, 0x41, 0x00, 0x61, 0x05, 0x00, 0x41, 0x18, 0xe3, 0x29, 0x65, 
+  0x5b, 0x2c, 0x7c, 0x0f, 0x18, 0xe3, 0x41, 0x21, 0x24, 0x07, 0x21, 0x44, 0x21, 0x45, 0x21, 0x24, 
+  0x19, 0xa4, 0x1a, 0xa7, 0x1b, 0x08, 0x1b, 0x49, 0x23, 0x49, 0x41, 0x23, 0x69, 0x00, 0x23, 0x49, 
+  0x41, 0x23, 0x29, 0x00, 0x23, 0x09, 0x41, 0x23, 0x29, 0x42, 0x23, 0x09, 0x00, 0x1b, 0x29, 0x42, 
+  0x23, 0x29, 0x00, 0x1b, 0x28, 0x42, 0x1b, 0x08, 0x04, 0x1a, 0xe8, 0x22, 0xe8, 0x22, 0x06, 0x00, 
+  0x41, 0x00, 0x61, 0x42, 0x00, 0x81, 0x02, 0x00, 0x61, 0x08, 0x82, 0x1a, 0x06, 0x41, 0x1b, 0x28, 
+  0x42, 0x23, 0x48, 0x4b, 0x23, 0x49, 0x00, 0x23, 0x48, 0x42, 0x23, 0x49, 0x07, 0x23, 0x48, 0x23, 
+  0x28, 0x23, 0x08, 0x12, 0x26, 0x11, 0x44, 0x00, 0x41, 0x00, 0x20, 0x08, 0x81, 0x42, 0x00, 0x81, 
+  0x03, 0x00, 0x41, 0x19, 0xc4, 0x1a, 0xc7, 0x01, 0xe6, 0x80, 0x06, 0x01, 0xa5, 0x0a, 0x05, 0x1a, 
+  0xc7, 0x0a, 0x06, 0x09, 0xc5, 0x09, 0x44, 0x08, 0x81, 0x42, 0x00, 0x61, 0x01, 0x00, 0x81, 0x08, 
+  0x81, 0x4e, 0x00, 0x61, 0x41, 0x00, 0x81, 0x02, 0x09, 0x03, 0x09, 0x85, 0x09, 0xc6, 0x41, 0x01, 
+  0xc6, 0x45, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x82, 0x00, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xe6, 0x82, 
+  0x41, 0x01, 0xc6, 0x04, 0x02, 0x07, 0x01, 0xe6, 0x01, 0xc5, 0x22, 0xa9, 0xae, 0x38, 0x41, 0xd7, 
+  0x3c, 0x05, 0xcf, 0x1b, 0xce, 0xfb, 0xef, 0xff, 0x64, 0x30, 0x01, 0x64, 0x0a, 0x48, 0x41, 0x02, 
+  0x07, 0x00, 0x09, 0xe7, 0x41, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x05, 0x02, 0x06, 0x1a, 0xe7, 0x01, 
+  0xc5, 0x01, 0xa5, 0x12, 0xc7, 0x12, 0xe7, 0x80, 0x03, 0x01, 0xc6, 0x02, 0x26, 0x1b, 0x28, 0x02, 
+  0x06, 0x42, 0x01, 0xe6, 0x00, 0x1b, 0x08, 0x80, 0x29, 0x01, 0xa5, 0x09, 0xa6, 0x09, 0x85, 0x12, 
+  0x47, 0x2b, 0x28, 0x12, 0x06, 0x09, 0xe6, 0x0a, 0x27, 0x23, 0x49, 0x02, 0x26, 0x0a, 0x46, 0x12, 
+  0xc7, 0x01, 0xa5, 0x01, 0xe6, 0x1b, 0x28, 0x12, 0xa7, 0x01, 0xc5, 0x0a, 0x05, 0x12, 0x87, 0x12, 
+  0x47, 0x0a, 0x27, 0x0a, 0x87, 0x1b, 0x28, 0x12, 0xe8, 0x0a, 0x47, 0x0a, 0x27, 0x0a, 0x47, 0x13, 
+  0x07, 0x13, 0x68, 0x12, 0xe7, 0x02, 0x25, 0x2b, 0x09, 0xbe, 0xda, 0xdf, 0x9d, 0xdf, 0x7d, 0xe7, 
+  0x9e, 0xf7, 0xff, 0xdf, 0x5d, 0x53, 0xad, 0x01, 0xc5, 0x01, 0xe6, 0x01, 0xc5, 0x45, 0x01, 0xe5, 
+  0x00, 0x01, 0xe6, 0x42, 0x01, 0xe5, 0x47, 0x01, 0xc5, 0x43, 0x01, 0xe5, 0x41, 0x01, 0xe6, 0x15, 
+  0x09, 0xe6, 0x0a, 0x07, 0x01, 0x85, 0x5b, 0xad, 0xad, 0xb6, 0xd7, 0x1c, 0xef, 0xbe, 0xd6, 0xdb, 
+  0xce, 0xdb, 0xd6, 0xfb, 0xdf, 0x1c, 0xdf, 0x5d, 0xce, 0xfb, 0x4b, 0x6c, 0x32, 0xc9, 0x01, 0xa5, 
+  0x01, 0xe6, 0x0a, 0x27, 0x02, 0x27, 0x01, 0xe6, 0x01, 0xa5, 0x01, 0x85, 0x41, 0x01, 0xa5, 0x01, 
+  0x01, 0xc5, 0x01, 0xc6, 0x41, 0x01, 0xc5, 0x41, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xe5, 
+  0x42, 0x01, 0xc5, 0x41, 0x01, 0xa5, 0x42, 0x01, 0x85, 0x41, 0x01, 0xa6, 0x41, 0x01, 0xc6, 0x41, 
+  0x09, 0xa6, 0x41, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x46, 0x01, 0xc5, 0x01, 0x01, 
+  0xc6, 0x01, 0xe6, 0x41, 0x01, 0xe5, 0x01, 0x01, 0xe6, 0x01, 0xe5, 0x42, 0x01, 0xe6, 0x42, 0x01, 
+  0xc6, 0x07, 0x01, 0x85, 0x09, 0xc5, 0x22, 0x88, 0x12, 0x06, 0x09, 0xe6, 0x0a, 0x06, 0x12, 0x47, 
+  0x12, 0x46, 0x42, 0x01, 0xc6, 0x02, 0x0a, 0x46, 0x1a, 0xe8, 0x0a, 0x26, 0x41, 0x01, 0xe6, 0x02, 
+  0x0a, 0x26, 0x22, 0xe7, 0x1a, 0x66, 0x41, 0x09, 0xa5, 0x03, 0x11, 0xc5, 0x1a, 0x67, 0x12, 0x06, 
+  0x09, 0xa5, 0x41, 0x09, 0xe6, 0x03, 0x12, 0x26, 0x09, 0xe6, 0x09, 0xa6, 0x09, 0xc6, 0x45, 0x09, 
+  0xa6, 0x42, 0x09, 0xc6, 0x01, 0x09, 0xe6, 0x09, 0xe7, 0x44, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x45, 
+  0x01, 0xe6, 0x00, 0x09, 0xe6, 0x43, 0x09, 0xe7, 0x80, 0x0e, 0x01, 0xe6, 0x0a, 0x07, 0x02, 0x06, 
+  0x22, 0xea, 0x53, 0xce, 0xb6, 0x79, 0xdf, 0x9e, 0xd7, 0x5d, 0xcf, 0x1c, 0xd7, 0x5c, 0xbe, 0xba, 
+  0x8d, 0x34, 0x3a, 0xeb, 0x01, 0xa5, 0x0a, 0x27, 0x80, 0x44, 0x01, 0xe6, 0x82, 0x05, 0x1b, 0x07, 
+  0x01, 0xe6, 0x01, 0xa6, 0x12, 0xa7, 0x12, 0xc7, 0x01, 0xc5, 0x83, 0x00, 0x01, 0xc6, 0x80, 0x00, 
+  0x01, 0xc6, 0x80, 0x09, 0x0a, 0x67, 0x01, 0xa6, 0x01, 0xc6, 0x01, 0xa6, 0x0a, 0x67, 0x1a, 0xe7, 
+  0x01, 0xc5, 0x01, 0xc6, 0x02, 0x06, 0x1b, 0x49, 0x80, 0x01, 0x0a, 0x66, 0x12, 0xe7, 0x41, 0x01, 
+  0xc5, 0x1f, 0x1b, 0x08, 0x0a, 0x66, 0x01, 0xa5, 0x12, 0x87, 0x0a, 0x06, 0x01, 0xa5, 0x0a, 0x46, 
+  0x1b, 0x28, 0x12, 0xe8, 0x0a, 0x26, 0x02, 0x27, 0x0a, 0x47, 0x12, 0xc7, 0x13, 0x27, 0x0a, 0xc6, 
+  0x01, 0xe4, 0x22, 0x88, 0x9d, 0xf6, 0xd7, 0x5c, 0xc6, 0xdb, 0xd7, 0x3c, 0xd7, 0x1c, 0xae, 0x17, 
+  0x43, 0x4c, 0x02, 0x05, 0x12, 0xe8, 0x12, 0xc7, 0x0a, 0x87, 0x0a, 0xa7, 0x0a, 0x87, 0x0a, 0x66, 
+  0x0a, 0x67, 0x46, 0x0a, 0x87, 0x43, 0x12, 0x87, 0x00, 0x0a, 0x87, 0x43, 0x12, 0x87, 0x42, 0x0a, 
+  0x87, 0x00, 0x0a, 0xa7, 0x41, 0x0a, 0xc7, 0x0e, 0x0a, 0xa8, 0x0a, 0x66, 0x01, 0xc4, 0x74, 0xf1, 
+  0x9e, 0x17, 0xd7, 0x5d, 0xef, 0xdf, 0xe7, 0x9e, 0xd7, 0x3c, 0xd7, 0x5c, 0xd7, 0x3c, 0xd7, 0x7d, 
+  0xd7, 0x5c, 0x64, 0x50, 0x3b, 0x6c, 0x42, 0x01, 0xe5, 0x02, 0x0a, 0x26, 0x0a, 0x46, 0x0a, 0x67, 
+  0x41, 0x12, 0x87, 0x01, 0x12, 0xa7, 0x0a, 0x87, 0x41, 0x12, 0x87, 0x41, 0x0a, 0x87, 0x41, 0x12, 
+  0xa7, 0x41, 0x0a, 0x87, 0x01, 0x12, 0x87, 0x0a, 0x87, 0x42, 0x0a, 0x67, 0x00, 0x0a, 0x87, 0x41, 
+  0x12, 0x87, 0x41, 0x0a, 0xa7, 0x4a, 0x0a, 0x87, 0x01, 0x12, 0x87, 0x0a, 0x87, 0x45, 0x12, 0x87, 
+  0x44, 0x0a, 0x87, 0x42, 0x12, 0x87, 0x09, 0x12, 0x67, 0x0a, 0x67, 0x12, 0xa7, 0x1a, 0xa7, 0x0a, 
+  0x06, 0x01, 0xc6, 0x02, 0x06, 0x12, 0xc7, 0x12, 0xa7, 0x01, 0xe6, 0x80, 0x03, 0x01, 0xc5, 0x0a, 
+  0x46, 0x1b, 0x08, 0x0a, 0x46, 0x41, 0x01, 0xe6, 0x10, 0x01, 0xc6, 0x01, 0xe6, 0x0a, 0x46, 0x1b, 
+  0x48, 0x12, 0x86, 0x01, 0xa5, 0x01, 0x85, 0x09, 0xe5, 0x1a, 0xa7, 0x0a, 0x26, 0x01, 0xe5, 0x02, 
+  0x06, 0x02, 0x27, 0x0a, 0x27, 0x0a, 0x26, 0x01, 0xc6, 0x01, 0xe6, 0x44, 0x01, 0xc6, 0x4d, 0x01, 
+  0xe6, 0x00, 0x09, 0xc6, 0x81, 0x41, 0x09, 0xe6, 0x44, 0x09, 0xe7, 0x05, 0x0a, 0x07, 0x01, 0x64, 
+  0x1a, 0x48, 0xae, 0x38, 0xef, 0xdf, 0xd7, 0x5d, 0x41, 0xd7, 0x3c, 0x05, 0xe7, 0xbf, 0xcf, 0x1b, 
+  0x43, 0x0b, 0x00, 0xc2, 0x01, 0x64, 0x01, 0xc6, 0x47, 0x01, 0xe6, 0x81, 0x00, 0x1b, 0x08, 0x80, 
+  0x00, 0x01, 0xa5, 0x81, 0x00, 0x01, 0xa5, 0x80, 0x00, 0x0a, 0x26, 0x81, 0x03, 0x01, 0xe6, 0x01, 
+  0xe7, 0x01, 0xe6, 0x1b, 0x28, 0x83, 0x02, 0x12, 0x67, 0x12, 0xc7, 0x01, 0xa5, 0x81, 0x00, 0x1b, 
+  0x28, 0x80, 0x01, 0x0a, 0x86, 0x1b, 0x08, 0x83, 0x06, 0x01, 0xc5, 0x1a, 0xc8, 0x01, 0xa5, 0x01, 
+  0xc5, 0x1a, 0xe8, 0x12, 0xc8, 0x02, 0x27, 0x41, 0x02, 0x47, 0x11, 0x13, 0x28, 0x1b, 0x28, 0x02, 
+  0x25, 0x33, 0x6a, 0x5c, 0x0e, 0xae, 0x37, 0xd7, 0x5d, 0xc6, 0xfb, 0xcf, 0x3c, 0xce, 0xfb, 0x6c, 
+  0x0f, 0x01, 0x84, 0x02, 0x46, 0x1b, 0x28, 0x1b, 0x48, 0x1b, 0x28, 0x13, 0x08, 0x12, 0xe7, 0x46, 
+  0x12, 0xc7, 0x00, 0x12, 0xa7, 0x41, 0x12, 0xc7, 0x00, 0x12, 0xa7, 0x4a, 0x12, 0xc7, 0x42, 0x12, 
+  0xa7, 0x00, 0x12, 0x87, 0x41, 0x0a, 0x87, 0x41, 0x02, 0x45, 0x05, 0x6c, 0xb1, 0x85, 0x13, 0xa5, 
+  0xd6, 0xef, 0xdf, 0xd7, 0x5d, 0xcf, 0x1b, 0x41, 0xd7, 0x3c, 0x05, 0xe7, 0xff, 0xc6, 0xfa, 0x5c, 
+  0x8f, 0x54, 0x4f, 0x22, 0xc8, 0x01, 0xe4, 0x43, 0x12, 0xa7, 0x49, 0x12, 0xc7, 0x43, 0x12, 0xa7, 
+  0x44, 0x12, 0xc7, 0x00, 0x12, 0xa7, 0x4a, 0x12, 0xc7, 0x00, 0x12, 0xa7, 0x4e, 0x12, 0xc7, 0x41, 
+  0x12, 0xa7, 0x07, 0x12, 0x87, 0x01, 0xc5, 0x01, 0xa5, 0x01, 0xc5, 0x09, 0xe5, 0x1b, 0x08, 0x01, 
+  0xe6, 0x02, 0x06, 0x80, 0x04, 0x0a, 0x46, 0x1a, 0xe8, 0x0a, 0x26, 0x02, 0x06, 0x01, 0xe7, 0x82, 
+  0x03, 0x01, 0xc6, 0x0a, 0x66, 0x1b, 0x48, 0x12, 0x66, 0x41, 0x09, 0xc5, 0x09, 0x0a, 0x26, 0x1a, 
+  0xe8, 0x0a, 0x26, 0x01, 0xe6, 0x09, 0xe7, 0x0a, 0x06, 0x1a, 0xa8, 0x12, 0x67, 0x01, 0xa5, 0x01, 
+  0xc5, 0x44, 0x01, 0xa5, 0x41, 0x01, 0xc5, 0x03, 0x01, 0xc6, 0x01, 0xc5, 0x01, 0xe5, 0x01, 0xc5, 
+  0x4d, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x03, 0x09, 0x85, 0x6c, 0x0f, 0x9d, 0x96, 
+  0xdf, 0x9d, 0x42, 0xd7, 0x3c, 0x07, 0xdf, 0x7d, 0x74, 0xb1, 0x3b, 0x0b, 0x01, 0x23, 0x09, 0xa5, 
+  0x01, 0xa5, 0x01, 0xa6, 0x01, 0xc6, 0x8f, 0x00, 0x02, 0x06, 0x8d, 0x00, 0x01, 0xe6, 0x82, 0x00, 
+  0x1b, 0x28, 0x81, 0x01, 0x1a, 0xe8, 0x0a, 0x46, 0x80, 0x00, 0x1a, 0xe8, 0x80, 0x02, 0x0a, 0x26, 
+  0x1a, 0xa8, 0x02, 0x06, 0x81, 0x11, 0x13, 0x28, 0x1b, 0xa9, 0x02, 0x45, 0x2b, 0x2a, 0xbe, 0xda, 
+  0xdf, 0xbe, 0xcf, 0x3c, 0xcf, 0x1b, 0xdf, 0x9e, 0xcf, 0x1b, 0x43, 0x2b, 0x01, 0x64, 0x0a, 0x26, 
+  0x12, 0xa7, 0x1a, 0xe7, 0x02, 0x26, 0x01, 0xe5, 0x02, 0x26, 0x45, 0x12, 0xa7, 0x00, 0x12, 0x87, 
+  0x45, 0x12, 0xa7, 0x00, 0x12, 0x87, 0x49, 0x12, 0xa7, 0x44, 0x12, 0x87, 0x41, 0x12, 0xa7, 0x05, 
+  0x0a, 0xa7, 0x02, 0x66, 0x33, 0x8b, 0x75, 0x32, 0xae, 0x58, 0xe7, 0xdf, 0x80, 0x0a, 0xd7, 0x1c, 
+  0xd7, 0x3c, 0xd7, 0x5c, 0xd7, 0x9d, 0xcf, 0x5c, 0x95, 0x75, 0x74, 0x70, 0x1a, 0xa8, 0x02, 0x45, 
+  0x12, 0xe8, 0x1a, 0xe8, 0x81, 0x5f, 0x12, 0xa7, 0x41, 0x12, 0x87, 0x03, 0x12, 0xa7, 0x12, 0x87, 
+  0x12, 0xa7, 0x12, 0x87, 0x47, 0x12, 0xa7, 0x01, 0x12, 0x87, 0x12, 0xa7, 0x41, 0x12, 0xa8, 0x02, 
+  0x12, 0xa7, 0x09, 0xe6, 0x0a, 0x26, 0x41, 0x01, 0xe6, 0x04, 0x0a, 0x67, 0x1b, 0x08, 0x02, 0x06, 
+  0x01, 0xe6, 0x01, 0xe7, 0x43, 0x01, 0xe6, 0x09, 0x01, 0xe7, 0x01, 0xc5, 0x0a, 0x45, 0x23, 0x68, 
+  0x12, 0xa7, 0x01, 0xe5, 0x01, 0xe6, 0x0a, 0x46, 0x1a, 0xc7, 0x0a, 0x26, 0x41, 0x01, 0xc6, 0x01, 
+  0x0a, 0x06, 0x1a, 0xc8, 0x4a, 0x1a, 0xe8, 0x00, 0x1b, 0x08, 0x51, 0x1a, 0xe8, 0x00, 0x95, 0x34, 
+  0x41, 0xd7, 0x5d, 0x09, 0xcf, 0x1c, 0xd7, 0x5d, 0xdf, 0x9e, 0xef, 0xdf, 0x7d, 0x13, 0x02, 0xc7, 
+  0x02, 0x86, 0x0a, 0x06, 0x01, 0xa5, 0x01, 0xa6, 0x41, 0x01, 0xc6, 0x8c, 0x00, 0x12, 0xa7, 0x82, 
+  0x00, 0x1b, 0x08, 0x81, 0x02, 0x09, 0xe7, 0x01, 0xc6, 0x1b, 0x08, 0x83, 0x00, 0x0a, 0x67, 0x80, 
+  0x00, 0x01, 0xc5, 0x81, 0x05, 0x1b, 0x08, 0x02, 0x06, 0x0a, 0x66, 0x1b, 0x08, 0x01, 0xc6, 0x01, 
+  0xa5, 0x80, 0x00, 0x0a, 0x26, 0x81, 0x00, 0x01, 0xc5, 0x80, 0x15, 0x12, 0x67, 0x01, 0xa5, 0x02, 
+  0x06, 0x0a, 0x87, 0x1b, 0x68, 0x23, 0x49, 0x8d, 0x74, 0xb6, 0x78, 0xdf, 0x9d, 0xcf, 0x1b, 0xcf, 
+  0x1c, 0xd7, 0x3c, 0x6c, 0x30, 0x43, 0x2c, 0x01, 0x44, 0x0a, 0x06, 0x12, 0xa7, 0x12, 0x67, 0x01, 
+  0xc5, 0x01, 0xe6, 0x0a, 0x46, 0x1b, 0x28, 0x80, 0x00, 0x12, 0x87, 0x48, 0x12, 0x67, 0x00, 0x12, 
+  0x87, 0x41, 0x12, 0x67, 0x42, 0x12, 0x87, 0x02, 0x0a, 0x87, 0x12, 0x87, 0x0a, 0x87, 0x42, 0x12, 
+  0x87, 0x01, 0x0a, 0x67, 0x12, 0x67, 0x41, 0x0a, 0x67, 0x42, 0x12, 0x67, 0x08, 0x12, 0x87, 0x12, 
+  0xa7, 0x12, 0xe8, 0x12, 0xc8, 0x02, 0x45, 0x2b, 0x0a, 0x53, 0xad, 0xbe, 0x99, 0xe7, 0xbe, 0x41, 
+  0xd7, 0x3c, 0x08, 0xcf, 0x1b, 0xcf, 0x1c, 0xdf, 0x7d, 0xdf, 0x9e, 0xb6, 0x99, 0x9d, 0xf6, 0x12, 
+  0xc8, 0x0a, 0x66, 0x12, 0xa7, 0x41, 0x12, 0x87, 0x00, 0x12, 0x67, 0x41, 0x12, 0x87, 0x00, 0x0a, 
+  0x67, 0x41, 0x12, 0x67, 0x00, 0x0a, 0x67, 0x42, 0x12, 0x67, 0x41, 0x0a, 0x67, 0x00, 0x12, 0x67, 
+  0x41, 0x0a, 0x67, 0x01, 0x12, 0x87, 0x12, 0x67, 0x46, 0x0a, 0x67, 0x42, 0x12, 0x67, 0x42, 0x0a, 
+  0x67, 0x00, 0x0a, 0x87, 0x80, 0x41, 0x12, 0x67, 0x41, 0x0a, 0x67, 0x00, 0x12, 0x67, 0x41, 0x0a, 
+  0x67, 0x01, 0x12, 0x67, 0x0a, 0x67, 0x41, 0x12, 0x67, 0x46, 0x0a, 0x67, 0x05, 0x01, 0xe6, 0x01, 
+  0xc6, 0x01, 0xa5, 0x0a, 0x26, 0x1a, 0xe8, 0x0a, 0x46, 0x42, 0x01, 0xc6, 0x80, 0x01, 0x01, 0xc6, 
+  0x09, 0xe6, 0x42, 0x01, 0xe6, 0x03, 0x01, 0xc5, 0x0a, 0x86, 0x23, 0x48, 0x12, 0xa7, 0x80, 0x08, 
+  0x01, 0xc6, 0x0a, 0x06, 0x1a, 0xa7, 0x09, 0xe6, 0x01, 0xa5, 0x01, 0xc6, 0x0a, 0x06, 0x12, 0x87, 
+  0x0a, 0x67, 0x41, 0x12, 0x87, 0x41, 0x0a, 0x87, 0x43, 0x12, 0x87, 0x42, 0x0a, 0x87, 0x42, 0x12, 
+  0x87, 0x00, 0x0a, 0x87, 0x4c, 0x12, 0x87, 0x0a, 0xd7, 0x7d, 0xc6, 0xfb, 0xce, 0xfb, 0xcf, 0x1b, 
+  0xdf, 0x9d, 0x74, 0x91, 0x43, 0x2c, 0x12, 0xc9, 0x0a, 0xc8, 0x0a, 0xa8, 0x02, 0x06, 0x41, 0x01, 
+  0xc6, 0x00, 0x09, 0xe6, 0x47, 0x01, 0xe6, 0x80, 0x01, 0x02, 0x26, 0x1b, 0x28, 0x85, 0x00, 0x0a, 
+  0x06, 0x80, 0x00, 0x02, 0x05, 0x83, 0x00, 0x0a, 0x66, 0x88, 0x01, 0x02, 0x05, 0x0a, 0x46, 0x83, 
+  0x00, 0x0a, 0x46, 0x81, 0x00, 0x01, 0xa5, 0x81, 0x15, 0x01, 0x85, 0x01, 0xe6, 0x0a, 0xc7, 0x3c, 
+  0x2c, 0xb6, 0x99, 0xe7, 0x9e, 0xdf, 0x7d, 0xd7, 0x3c, 0xd7, 0x1c, 0xd7, 0x3c, 0x63, 0xce, 0x01, 
+  0x03, 0x01, 0x23, 0x09, 0xc6, 0x1a, 0xa7, 0x12, 0x67, 0x09, 0xc5, 0x01, 0xc6, 0x0a, 0x26, 0x1b, 
+  0x28, 0x0a, 0x87, 0x01, 0xe6, 0x43, 0x01, 0xc5, 0x41, 0x01, 0xa5, 0x4d, 0x01, 0xc5, 0x42, 0x01, 
+  0xc6, 0x42, 0x01, 0xc5, 0x43, 0x01, 0xc6, 0x09, 0x01, 0xe6, 0x01, 0xc5, 0x01, 0xe6, 0x02, 0x06, 
+  0x01, 0xc5, 0x01, 0x63, 0x2a, 0xc9, 0x4b, 0xad, 0xc6, 0xfb, 0xd7, 0x5c, 0x41, 0xd7, 0x5d, 0x41, 
+  0xcf, 0x1c, 0x07, 0xdf, 0x7d, 0xdf, 0x5d, 0xa6, 0x17, 0x74, 0xb2, 0x01, 0x64, 0x01, 0x85, 0x01, 
+  0x84, 0x01, 0xa5, 0x42, 0x01, 0xc5, 0x43, 0x01, 0xa5, 0x42, 0x01, 0xc5, 0x41, 0x01, 0xa5, 0x42, 
+  0x01, 0xc5, 0x00, 0x01, 0xc6, 0x43, 0x01, 0xc5, 0x42, 0x01, 0xc6, 0x45, 0x01, 0xc5, 0x42, 0x01, 
+  0xc6, 0x46, 0x01, 0xc5, 0x02, 0x01, 0xc6, 0x01, 0xc5, 0x01, 0xc6, 0x43, 0x01, 0xc5, 0x42, 0x01, 
+  0xc6, 0x41, 0x01, 0xe6, 0x04, 0x0a, 0x46, 0x1a, 0xc7, 0x0a, 0x06, 0x01, 0xc6, 0x01, 0xe6, 0x45, 
+  0x01, 0xc6, 0x42, 0x01, 0xe6, 0x03, 0x01, 0xc5, 0x0a, 0x66, 0x23, 0x48, 0x12, 0xa7, 0x41, 0x01, 
+  0xc6, 0x02, 0x0a, 0x06, 0x1a, 0xa7, 0x0a, 0x06, 0x80, 0x00, 0x01, 0xe6, 0x46, 0x01, 0xc6, 0x00, 
+  0x01, 0xa6, 0x41, 0x01, 0xc6, 0x41, 0x01, 0xa6, 0x00, 0x01, 0xa5, 0x42, 0x01, 0xa6, 0x41, 0x01, 
+  0xc6, 0x42, 0x01, 0xa6, 0x48, 0x01, 0xc6, 0x41, 0xcf, 0x1c, 0x00, 0xd7, 0x5d, 0x80, 0x06, 0xd7, 
+  0x5c, 0x43, 0x0b, 0x01, 0x23, 0x0a, 0x48, 0x02, 0x47, 0x12, 0xc8, 0x1a, 0xe8, 0x85, 0x41, 0x01, 
+  0xc6, 0x8a, 0x00, 0x01, 0xa6, 0x81, 0x00, 0x01, 0xe5, 0x83, 0x00, 0x0a, 0x47, 0x81, 0x01, 0x01, 
+  0x86, 0x12, 0x67, 0x83, 0x01, 0x1a, 0xe8, 0x01, 0xe5, 0x80, 0x00, 0x1a, 0xe8, 0x41, 0x01, 0xc6, 
+  0x83, 0x01, 0x01, 0x85, 0x0a, 0x06, 0x80, 0x0e, 0x01, 0x44, 0x09, 0xc5, 0x23, 0x08, 0xae, 0x98, 
+  0xdf, 0x9e, 0xce, 0xfb, 0xd7, 0x1c, 0xe7, 0xbe, 0x6c, 0x71, 0x1a, 0x48, 0x09, 0xc6, 0x01, 0xa5, 
+  0x09, 0xe6, 0x1a, 0xe7, 0x12, 0x66, 0x41, 0x01, 0xc5, 0x03, 0x01, 0xe6, 0x12, 0xc7, 0x0a, 0x66, 
+  0x01, 0xc6, 0x80, 0x00, 0x0a, 0x87, 0x42, 0x1b, 0x08, 0x00, 0x1b, 0x09, 0x42, 0x23, 0x08, 0x00, 
+  0x23, 0x09, 0x41, 0x23, 0x29, 0x41, 0x23, 0x28, 0x44, 0x1b, 0x28, 0x41, 0x23, 0x28, 0x42, 0x23, 
+  0x08, 0x41, 0x23, 0x09, 0x45, 0x23, 0x29, 0x0c, 0x23, 0x28, 0x1b, 0x28, 0x1b, 0x29, 0x23, 0x29, 
+  0x23, 0x28, 0x12, 0xa7, 0x12, 0x86, 0x33, 0x8b, 0x5c, 0x6f, 0xc6, 0xda, 0xdf, 0x5d, 0xef, 0xdf, 
+  0xdf, 0x5d, 0x41, 0xcf, 0x1b, 0x06, 0xdf, 0x7d, 0xcf, 0x3c, 0xb6, 0x79, 0x74, 0xb1, 0x2a, 0xc9, 
+  0x22, 0xc8, 0x12, 0x87, 0x41, 0x23, 0x09, 0x00, 0x1b, 0x08, 0x42, 0x23, 0x08, 0x41, 0x1b, 0x08, 
+  0x00, 0x23, 0x28, 0x41, 0x23, 0x29, 0x01, 0x23, 0x28, 0x23, 0x29, 0x42, 0x1b, 0x28, 0x00, 0x1b, 
+  0x08, 0x41, 0x1b, 0x28, 0x01, 0x23, 0x28, 0x23, 0x08, 0x44, 0x1b, 0x08, 0x02, 0x1b, 0x28, 0x23, 
+  0x29, 0x1b, 0x29, 0x44, 0x1b, 0x28, 0x46, 0x1b, 0x08, 0x41, 0x23, 0x08, 0x00, 0x1b, 0x08, 0x41, 
+  0x1b, 0x28, 0x41, 0x23, 0x29, 0x05, 0x23, 0x28, 0x1b, 0x28, 0x1b, 0x08, 0x0a, 0x06, 0x01, 0xc6, 
+  0x09, 0xe6, 0x41, 0x01, 0xc6, 0x02, 0x01, 0xa5, 0x01, 0xc5, 0x01, 0xa6, 0x84, 0x0b, 0x01, 0xe6, 
+  0x01, 0xc5, 0x0a, 0x66, 0x23, 0x48, 0x12, 0xa7, 0x01, 0xe6, 0x01, 0xa5, 0x09, 0xe6, 0x1a, 0xc7, 
+  0x12, 0x26, 0x01, 0xc6, 0x09, 0xe6, 0x42, 0x01, 0xe7, 0x01, 0x09, 0xe7, 0x09, 0xe6, 0x41, 0x09, 
+  0xc7, 0x02, 0x09, 0xe6, 0x09, 0xc6, 0x01, 0xc6, 0x44, 0x09, 0xc6, 0x41, 0x01, 0xe6, 0x41, 0x09, 
+  0xe6, 0x41, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x45, 0x09, 0xe7, 0x00, 0x0a, 0x07, 0x0e, 0xd7, 0x5c, 
+  0xcf, 0x1b, 0xbe, 0x99, 0x74, 0x71, 0x22, 0x07, 0x19, 0xc6, 0x01, 0x65, 0x01, 0xe7, 0x02, 0x27, 
+  0x02, 0x47, 0x12, 0xc7, 0x12, 0xa7, 0x09, 0xe6, 0x01, 0xc6, 0x09, 0xe6, 0x46, 0x01, 0xe6, 0x87, 
+  0x01, 0x01, 0xc6, 0x09, 0xe6, 0x80, 0x00, 0x02, 0x05, 0x80, 0x01, 0x01, 0xe7, 0x01, 0xc5, 0x80, 
+  0x00, 0x0a, 0x66, 0x81, 0x01, 0x01, 0xa6, 0x0a, 0x67, 0x86, 0x00, 0x12, 0xe8, 0x82, 0x01, 0x0a, 
+  0x66, 0x01, 0xe5, 0x80, 0x05, 0x01, 0xa5, 0x09, 0xe6, 0x02, 0x05, 0x09, 0x44, 0x85, 0x13, 0xc7, 
+  0x1b, 0x41, 0xcf, 0x1c, 0x08, 0xdf, 0x7d, 0xe7, 0x9e, 0x85, 0x34, 0x0a, 0x27, 0x02, 0x06, 0x01, 
+  0xe6, 0x0a, 0x06, 0x1a, 0xe7, 0x0a, 0x26, 0x41, 0x01, 0xc5, 0x03, 0x0a, 0x06, 0x1a, 0xc7, 0x0a, 
+  0x26, 0x01, 0xa5, 0x80, 0x04, 0x0a, 0x67, 0x1b, 0x48, 0x12, 0xc7, 0x02, 0x25, 0x02, 0x05, 0x41, 
+  0x01, 0xe5, 0x00, 0x02, 0x05, 0x41, 0x01, 0xe5, 0x58, 0x02, 0x05, 0x41, 0x01, 0xe5, 0x41, 0x01, 
+  0xc5, 0x10, 0x01, 0xa4, 0x01, 0xc5, 0x09, 0xc5, 0x53, 0xad, 0x95, 0x34, 0xbe, 0x79, 0xe7, 0x9e, 
+  0xd7, 0x3c, 0xce, 0xfb, 0xcf, 0x1c, 0xdf, 0x7d, 0xcf, 0x3c, 0xd7, 0x5c, 0x74, 0x50, 0x32, 0xc9, 
+  0x09, 0xc5, 0x01, 0x84, 0x43, 0x01, 0xc5, 0x00, 0x01, 0xe5, 0x41, 0x02, 0x05, 0x41, 0x02, 0x25, 
+  0x45, 0x02, 0x05, 0x42, 0x01, 0xe5, 0x41, 0x02, 0x05, 0x44, 0x01, 0xe5, 0x43, 0x02, 0x05, 0x49, 
+  0x01, 0xe5, 0x00, 0x02, 0x05, 0x41, 0x01, 0xe5, 0x45, 0x02, 0x05, 0x00, 0x01, 0xe5, 0x42, 0x01, 
+  0xa6, 0x05, 0x01, 0xe6, 0x12, 0xc7, 0x1b, 0x48, 0x1a, 0xc7, 0x09, 0xe5, 0x01, 0xa5, 0x45, 0x01, 
+  0xe6, 0x09, 0x01, 0xc5, 0x0a, 0x46, 0x1b, 0x28, 0x12, 0x67, 0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x05, 
+  0x1a, 0xc7, 0x0a, 0x06, 0x01, 0xa6, 0x44, 0x01, 0xc6, 0x00, 0x01, 0xc5, 0x45, 0x01, 0xc6, 0x42, 
+  0x01, 0xa6, 0x4a, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x0d, 0xe7, 0xde, 0x8d, 0x14, 
+  0x09, 0x45, 0x09, 0x65, 0x01, 0x44, 0x11, 0xe6, 0x11, 0xc6, 0x01, 0xa5, 0x01, 0xe6, 0x0a, 0x27, 
+  0x02, 0x26, 0x12, 0xe7, 0x12, 0xe8, 0x0a, 0x06, 0x47, 0x01, 0xe6, 0x88, 0x01, 0x02, 0x06, 0x1a, 
+  0xe8, 0x41, 0x01, 0xc5, 0x02, 0x01, 0xc6, 0x01, 0xa5, 0x1b, 0x07, 0x83, 0x00, 0x0a, 0x87, 0x86, 
+  0x01, 0x12, 0xc8, 0x01, 0xa5, 0x81, 0x07, 0x0a, 0x67, 0x02, 0x26, 0x23, 0x69, 0x01, 0xa4, 0x1a, 
+  0x27, 0x3b, 0x4b, 0x85, 0x13, 0xd7, 0x7d, 0x42, 0xcf, 0x1c, 0x07, 0xb6, 0x38, 0x85, 0x13, 0x02, 
+  0x47, 0x0a, 0x88, 0x02, 0x27, 0x0a, 0x67, 0x1a, 0xe7, 0x0a, 0x46, 0x41, 0x01, 0xc5, 0x0b, 0x01, 
+  0xe5, 0x1a, 0xc7, 0x0a, 0x66, 0x01, 0xe5, 0x01, 0xc5, 0x0a, 0x87, 0x1b, 0x08, 0x12, 0x87, 0x02, 
+  0x06, 0x01, 0xe6, 0x0a, 0x26, 0x12, 0x67, 0x42, 0x0a, 0x67, 0x41, 0x0a, 0x47, 0x45, 0x0a, 0x67, 
+  0x00, 0x12, 0x67, 0x44, 0x0a, 0x47, 0x42, 0x0a, 0x67, 0x00, 0x12, 0x67, 0x44, 0x0a, 0x67, 0x47, 
+  0x0a, 0x47, 0x00, 0x0a, 0x67, 0x41, 0x12, 0xa7, 0x03, 0x01, 0xe5, 0x6c, 0xb1, 0xb6, 0xb9, 0xa6, 
+  0x57, 0x41, 0xdf, 0x7d, 0x06, 0xce, 0xfb, 0xcf, 0x1c, 0xd7, 0x3c, 0xdf, 0x7d, 0xdf, 0x9e, 0x53, 
+  0x6d, 0x22, 0x48, 0x41, 0x01, 0x84, 0x00, 0x09, 0xe5, 0x46, 0x12, 0x87, 0x41, 0x12, 0x67, 0x00, 
+  0x0a, 0x67, 0x42, 0x12, 0x67, 0x01, 0x0a, 0x67, 0x12, 0x47, 0x43, 0x0a, 0x67, 0x42, 0x12, 0x67, 
+  0x45, 0x0a, 0x67, 0x44, 0x0a, 0x47, 0x45, 0x0a, 0x67, 0x00, 0x12, 0x67, 0x41, 0x0a, 0x67, 0x42, 
+  0x12, 0x67, 0x42, 0x12, 0x47, 0x06, 0x12, 0x46, 0x12, 0xc7, 0x1b, 0x88, 0x13, 0x47, 0x1b, 0x48, 
+  0x12, 0xe7, 0x01, 0xc5, 0x47, 0x01, 0xe6, 0x06, 0x01, 0xe5, 0x12, 0xc7, 0x12, 0xa7, 0x01, 0xe6, 
+  0x01, 0xc6, 0x0a, 0x06, 0x1a, 0xc8, 0x43, 0x0a, 0x67, 0x41, 0x0a, 0x87, 0x00, 0x12, 0x87, 0x41, 
+  0x0a, 0x87, 0x42, 0x0a, 0x67, 0x43, 0x12, 0x67, 0x03, 0x0a, 0x67, 0x12, 0x67, 0x0a, 0x67, 0x0a, 
+  0x87, 0x41, 0x12, 0x67, 0x41, 0x0a, 0x87, 0x41, 0x12, 0x87, 0x01, 0x12, 0x67, 0x12, 0x87, 0x41, 
+  0x12, 0x88, 0x0e, 0x8d, 0x14, 0x09, 0xc6, 0x01, 0xa6, 0x09, 0xa5, 0x09, 0x85, 0x01, 0x44, 0x12, 
+  0x27, 0x12, 0x06, 0x01, 0x85, 0x01, 0xe6, 0x02, 0x06, 0x0a, 0x66, 0x13, 0x27, 0x0a, 0xa6, 0x01, 
+  0xc6, 0x89, 0x02, 0x02, 0x06, 0x01, 0xc5, 0x12, 0xc7, 0x82, 0x01, 0x09, 0xe6, 0x23, 0x09, 0x41, 
+  0x12, 0x66, 0x02, 0x12, 0x87, 0x0a, 0x86, 0x23, 0x68, 0x81, 0x00, 0x01, 0xe6, 0x81, 0x01, 0x12, 
+  0xe7, 0x01, 0xa5, 0x84, 0x00, 0x12, 0xe8, 0x80, 0x00, 0x01, 0xc5, 0x80, 0x06, 0x0a, 0x66, 0x0a, 
+  0x46, 0x13, 0x27, 0x02, 0x05, 0x85, 0x33, 0xdf, 0x9e, 0xcf, 0x3c, 0x41, 0xcf, 0x1c, 0x09, 0xd7, 
+  0x5d, 0x85, 0x14, 0x01, 0x85, 0x01, 0xc5, 0x0a, 0x67, 0x02, 0x68, 0x12, 0xc8, 0x1a, 0xe8, 0x0a, 
+  0x26, 0x01, 0xe5, 0x80, 0x07, 0x0a, 0x06, 0x1a, 0xc7, 0x0a, 0x46, 0x01, 0xe5, 0x01, 0xc5, 0x0a, 
+  0x46, 0x1a, 0xe8, 0x0a, 0x66, 0x41, 0x01, 0xe6, 0x01, 0x0a, 0x46, 0x1a, 0xe8, 0x49, 0x1b, 0x08, 
+  0x45, 0x1a, 0xe8, 0x4b, 0x1b, 0x08, 0x00, 0x1a, 0xe8, 0x46, 0x1b, 0x08, 0x41, 0x1b, 0x28, 0x06, 
+  0x23, 0x49, 0x13, 0x08, 0x0a, 0x86, 0x12, 0x87, 0x74, 0xb1, 0x9d, 0xd6, 0xd7, 0x5c, 0x80, 0x0b, 
+  0xd7, 0x1c, 0xcf, 0x1c, 0xcf, 0x1b, 0xd7, 0x5d, 0xcf, 0x3c, 0x5c, 0x2f, 0x5c, 0x4f, 0x3b, 0x8b, 
+  0x12, 0x66, 0x12, 0xa7, 0x1b, 0x28, 0x23, 0x49, 0x41, 0x23, 0x08, 0x42, 0x1b, 0x08, 0x00, 0x23, 
+  0x08, 0x42, 0x1b, 0x08, 0x42, 0x1a, 0xe8, 0x4b, 0x1b, 0x08, 0x41, 0x1a, 0xe8, 0x4c, 0x1b, 0x08, 
+  0x43, 0x1a, 0xe8, 0x07, 0x1b, 0x08, 0x1a, 0xe8, 0x1b, 0x28, 0x1b, 0x87, 0x02, 0x85, 0x1b, 0x47, 
+  0x1b, 0x27, 0x01, 0xe5, 0x48, 0x01, 0xe6, 0x02, 0x0a, 0x46, 0x23, 0x48, 0x12, 0xa7, 0x41, 0x01, 
+  0xc5, 0x01, 0x0a, 0x46, 0x1b, 0x08, 0x41, 0x1a, 0xe8, 0x4f, 0x1b, 0x08, 0x41, 0x1b, 0x09, 0x46, 
+  0x1b, 0x08, 0x01, 0x23, 0x09, 0x23, 0x08, 0x0d, 0x0a, 0xa6, 0x0a, 0xc7, 0x02, 0x06, 0x01, 0xc6, 
+  0x01, 0x85, 0x01, 0x65, 0x01, 0x64, 0x1a, 0x87, 0x09, 0xa5, 0x01, 0x85, 0x01, 0xe6, 0x02, 0x06, 
+  0x0a, 0xa6, 0x0a, 0x86, 0x8b, 0x01, 0x01, 0xe6, 0x0a, 0x66, 0x80, 0x00, 0x0a, 0x06, 0x80, 0x01, 
+  0x01, 0xe6, 0x12, 0x87, 0x41, 0x12, 0x86, 0x00, 0x12, 0xa7, 0x41, 0x12, 0xc7, 0x06, 0x02, 0x25, 
+  0x01, 0xe6, 0x01, 0xc6, 0x01, 0xe6, 0x12, 0xe7, 0x12, 0xc7, 0x01, 0xc5, 0x83, 0x00, 0x0a, 0x66, 
+  0x80, 0x00, 0x01, 0xc6, 0x82, 0x1a, 0x01, 0x84, 0x64, 0x6f, 0x85, 0x33, 0xdf, 0x7d, 0xcf, 0x3c, 
+  0xcf, 0x1b, 0xd7, 0x5c, 0xcf, 0x3c, 0x8d, 0x54, 0x09, 0x85, 0x01, 0xa5, 0x0a, 0x07, 0x02, 0x07, 
+  0x0a, 0x87, 0x23, 0x28, 0x0a, 0x67, 0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x26, 0x1a, 0xe7, 0x0a, 0x66, 
+  0x01, 0xc5, 0x01, 0xc6, 0x12, 0x67, 0x1a, 0xe7, 0x02, 0x05, 0x01, 0xc6, 0x80, 0x03, 0x0a, 0x67, 
+  0x1a, 0xe8, 0x0a, 0x06, 0x01, 0xc5, 0x44, 0x01, 0xc6, 0x47, 0x01, 0xc5, 0x02, 0x01, 0xa5, 0x01, 
+  0xc5, 0x01, 0xc6, 0x48, 0x01, 0xc5, 0x43, 0x01, 0xc6, 0x00, 0x01, 0xc5, 0x43, 0x01, 0xc6, 0x00, 
+  0x01, 0xc5, 0x42, 0x01, 0xa5, 0x41, 0x01, 0xe6, 0x02, 0x09, 0xc6, 0x4b, 0x6c, 0x7c, 0xd2, 0x81, 
+  0x0b, 0xcf, 0x1c, 0xce, 0xfb, 0xce, 0xfc, 0xce, 0xfb, 0xcf, 0x1b, 0xd7, 0x5c, 0xe7, 0xde, 0xae, 
+  0x17, 0x5b, 0xae, 0x6c, 0x30, 0x12, 0x27, 0x01, 0x23, 0x41, 0x01, 0xc6, 0x02, 0x01, 0xa5, 0x01, 
+  0xc5, 0x01, 0xc6, 0x43, 0x01, 0xa5, 0x50, 0x01, 0xc5, 0x41, 0x01, 0xc6, 0x41, 0x01, 0xc5, 0x00, 
+  0x01, 0xa5, 0x48, 0x01, 0xc5, 0x00, 0x01, 0xa5, 0x43, 0x01, 0xc5, 0x04, 0x0a, 0x26, 0x1b, 0x27, 
+  0x1b, 0x88, 0x1b, 0x48, 0x0a, 0x66, 0x89, 0x03, 0x01, 0xe6, 0x0a, 0x66, 0x23, 0x28, 0x12, 0x86, 
+  0x80, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xc5, 0x03, 0x01, 0xc6, 0x01, 0xc5, 0x01, 0xc6, 0x01, 0xc5, 
+  0x48, 0x01, 0xc6, 0x02, 0x01, 0xc5, 0x01, 0xe5, 0x01, 0xc5, 0x49, 0x01, 0xc6, 0x41, 0x01, 0xe6, 
+  0x0c, 0x1c, 0x29, 0x1b, 0xa8, 0x02, 0x26, 0x02, 0x06, 0x01, 0xe6, 0x01, 0xa5, 0x01, 0x85, 0x09, 
+  0xc5, 0x1a, 0xa7, 0x09, 0xa5, 0x01, 0xa5, 0x01, 0xe6, 0x12, 0xc7, 0x83, 0x00, 0x09, 0xe6, 0x44, 
+  0x01, 0xe6, 0x80, 0x00, 0x1b, 0x08, 0x81, 0x05, 0x01, 0xc5, 0x1a, 0xe8, 0x12, 0x87, 0x01, 0xa5, 
+  0x01, 0xc5, 0x01, 0xa4, 0x42, 0x01, 0x64, 0x02, 0x01, 0x84, 0x0a, 0x86, 0x12, 0xe7, 0x41, 0x02, 
+  0x06, 0x01, 0x1b, 0x07, 0x23, 0x89, 0x85, 0x01, 0x0a, 0x46, 0x12, 0xe7, 0x80, 0x05, 0x01, 0xe6, 
+  0x12, 0x86, 0x01, 0xc4, 0x6c, 0x2f, 0xdf, 0x5d, 0xe7, 0x9e, 0x41, 0xcf, 0x1c, 0x09, 0xe7, 0x9e, 
+  0xae, 0x58, 0x54, 0x2e, 0x12, 0x45, 0x01, 0x84, 0x09, 0xa5, 0x01, 0x85, 0x0a, 0x47, 0x1b, 0x28, 
+  0x0a, 0x26, 0x41, 0x01, 0xe6, 0x07, 0x0a, 0x46, 0x1b, 0x28, 0x0a, 0x66, 0x01, 0xe6, 0x01, 0xe5, 
+  0x0a, 0x67, 0x12, 0xc7, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x04, 0x0a, 0x26, 0x1b, 0x08, 0x0a, 0x26, 
+  0x01, 0xe6, 0x09, 0xe6, 0x80, 0x41, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x4c, 0x01, 
+  0xc6, 0x41, 0x01, 0xe6, 0x4a, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xa6, 
+  0x07, 0x01, 0x85, 0x01, 0x64, 0x7c, 0xb2, 0xe7, 0xbe, 0xd7, 0x7d, 0xcf, 0x1c, 0xcf, 0x1b, 0xd7, 
+  0x5c, 0x42, 0xdf, 0x9e, 0x0b, 0xdf, 0x9d, 0xd7, 0x1c, 0xcf, 0x1c, 0xdf, 0x5d, 0xe7, 0xbe, 0xef, 
+  0xdf, 0xa5, 0xf7, 0x74, 0xb2, 0x01, 0x85, 0x01, 0x24, 0x01, 0xa6, 0x01, 0xc6, 0x41, 0x01, 0xe6, 
+  0x47, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x48, 0x01, 0xc6, 0x47, 
+  0x01, 0xe6, 0x46, 0x01, 0xc6, 0x06, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xc6, 0x0a, 0x26, 0x12, 0xa7, 
+  0x12, 0x66, 0x01, 0xc6, 0x4a, 0x01, 0xe6, 0x06, 0x01, 0xc5, 0x0a, 0x46, 0x23, 0x69, 0x12, 0xa7, 
+  0x01, 0xc5, 0x01, 0xc6, 0x01, 0xe6, 0x46, 0x01, 0xc6, 0x00, 0x09, 0xc6, 0x81, 0x00, 0x09, 0xc6, 
+  0x42, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x80, 0x41, 0x01, 0xe6, 0x81, 0x41, 0x01, 0xe6, 0x41, 0x09, 
+  0xe6, 0x02, 0x09, 0xe7, 0x09, 0xe6, 0x09, 0xe7, 0x41, 0x13, 0xc8, 0x09, 0x1b, 0x88, 0x12, 0xe7, 
+  0x02, 0x06, 0x01, 0xe6, 0x01, 0xa5, 0x01, 0x85, 0x0a, 0x46, 0x12, 0x87, 0x01, 0x85, 0x01, 0xa5, 
+  0x82, 0x00, 0x09, 0xe6, 0x80, 0x00, 0x01, 0xe7, 0x83, 0x00, 0x01, 0xc6, 0x80, 0x00, 0x12, 0xa7, 
+  0x42, 0x01, 0xe6, 0x02, 0x0a, 0x26, 0x12, 0xc8, 0x1b, 0x29, 0x41, 0x1b, 0x08, 0x41, 0x1a, 0xe8, 
+  0x04, 0x1a, 0xc8, 0x1a, 0xe8, 0x12, 0x87, 0x12, 0x66, 0x01, 0xe6, 0x80, 0x02, 0x0a, 0x86, 0x0a, 
+  0x87, 0x0a, 0x26, 0x41, 0x01, 0xc6, 0x81, 0x00, 0x01, 0xc5, 0x80, 0x12, 0x12, 0xe8, 0x01, 0xe6, 
+  0x01, 0x85, 0x5c, 0x2f, 0x95, 0x95, 0xcf, 0x3c, 0xd7, 0x3c, 0xcf, 0x1c, 0xcf, 0x3c, 0xdf, 0x9e, 
+  0x95, 0x55, 0x23, 0x09, 0x02, 0x04, 0x1a, 0xc7, 0x01, 0xc5, 0x01, 0x85, 0x09, 0xe5, 0x12, 0x87, 
+  0x0a, 0x26, 0x41, 0x01, 0xe6, 0x02, 0x0a, 0x46, 0x1b, 0x28, 0x0a, 0x87, 0x41, 0x02, 0x06, 0x01, 
+  0x12, 0x87, 0x12, 0xc7, 0x41, 0x01, 0xe6, 0x80, 0x04, 0x0a, 0x26, 0x1a, 0xe8, 0x0a, 0x26, 0x01, 
+  0xe6, 0x02, 0x06, 0x4a, 0x01, 0xe5, 0x02, 0x01, 0xc5, 0x01, 0xe5, 0x01, 0xc5, 0x4b, 0x01, 0xe5, 
+  0x46, 0x01, 0xc5, 0x41, 0x01, 0xe5, 0x41, 0x02, 0x06, 0x05, 0x01, 0xe6, 0x01, 0x43, 0x53, 0xae, 
+  0x95, 0x95, 0xd7, 0x3c, 0xcf, 0x3c, 0x41, 0xcf, 0x1c, 0x10, 0xd7, 0x7d, 0x85, 0x13, 0x4b, 0x2b, 
+  0x53, 0x8d, 0x4b, 0x6c, 0x6c, 0x4f, 0xd7, 0x7d, 0xd7, 0x5c, 0xd7, 0x3c, 0xd7, 0x1c, 0xcf, 0x1c, 
+  0xdf, 0x9d, 0xd7, 0x7d, 0x95, 0x75, 0x64, 0x0f, 0x00, 0xe3, 0x01, 0x44, 0x41, 0x01, 0xa5, 0x00, 
+  0x01, 0xc5, 0x4c, 0x01, 0xe5, 0x43, 0x01, 0xc5, 0x00, 0x01, 0xe5, 0x41, 0x01, 0xc5, 0x49, 0x01, 
+  0xe5, 0x44, 0x01, 0xc5, 0x00, 0x01, 0xe5, 0x42, 0x01, 0xe6, 0x42, 0x01, 0xa5, 0x46, 0x01, 0xe6, 
+  0x00, 0x01, 0xe7, 0x45, 0x01, 0xe6, 0x02, 0x0a, 0x66, 0x23, 0x69, 0x12, 0xc7, 0x5b, 0x01, 0xe5, 
+  0x41, 0x01, 0xe6, 0x80, 0x03, 0x13, 0xe8, 0x1c, 0x09, 0x1b, 0xa8, 0x0a, 0x87, 0x41, 0x01, 0xc6, 
+  0x02, 0x01, 0xa5, 0x01, 0xc5, 0x12, 0xa7, 0x86, 0x43, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x01, 0x01, 
+  0xe6, 0x0a, 0x06, 0x80, 0x00, 0x01, 0xc6, 0x80, 0x01, 0x01, 0xa6, 0x0a, 0x26, 0x41, 0x0a, 0xa7, 
+  0x00, 0x12, 0xa7, 0x41, 0x0a, 0x87, 0x41, 0x0a, 0x66, 0x03, 0x01, 0xc5, 0x01, 0x85, 0x01, 0xc6, 
+  0x01, 0xe7, 0x41, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x82, 0x0c, 0x01, 0xa5, 0x0a, 0x26, 0x12, 0xa7, 
+  0x01, 0x44, 0x74, 0x91, 0xd7, 0x5c, 0xdf, 0x9d, 0xcf, 0x1b, 0xcf, 0x3c, 0xd7, 0x3c, 0xd7, 0x7d, 
+  0x8d, 0x74, 0x09, 0xe6, 0x41, 0x12, 0xc7, 0x09, 0x1a, 0xe7, 0x01, 0xe5, 0x0a, 0x06, 0x1a, 0xc7, 
+  0x01, 0xe5, 0x01, 0xc6, 0x01, 0xc5, 0x02, 0x26, 0x1b, 0x48, 0x0a, 0x87, 0x41, 0x02, 0x06, 0x02, 
+  0x12, 0xa7, 0x12, 0xc7, 0x02, 0x06, 0x81, 0x03, 0x0a, 0x46, 0x1a, 0xe7, 0x0a, 0x26, 0x01, 0xc6, 
+  0x80, 0x03, 0x02, 0x26, 0x1b, 0x08, 0x1b, 0x28, 0x1b, 0x08, 0x43, 0x1b, 0x28, 0x41, 0x1b, 0x08, 
+  0x41, 0x1b, 0x28, 0x41, 0x1b, 0x08, 0x4e, 0x1b, 0x28, 0x46, 0x1b, 0x08, 0x05, 0x13, 0x28, 0x12, 
+  0xe7, 0x02, 0x86, 0x4c, 0x0d, 0xc7, 0x1b, 0xdf, 0xbe, 0x80, 0x00, 0xd7, 0x5d, 0x41, 0xdf, 0x5d, 
+  0x02, 0x8d, 0x74, 0x1a, 0x87, 0x0a, 0x04, 0x41, 0x0a, 0x45, 0x0c, 0x23, 0x08, 0x7d, 0x71, 0xa6, 
+  0x36, 0xe7, 0x9e, 0xdf, 0x5d, 0xd7, 0x5d, 0xcf, 0x1b, 0xce, 0xfb, 0xdf, 0x9e, 0xcf, 0x3c, 0xa5, 
+  0xf7, 0x5c, 0x4f, 0x12, 0x87, 0x41, 0x1a, 0xe8, 0x01, 0x1b, 0x28, 0x23, 0x49, 0x41, 0x1b, 0x48, 
+  0x41, 0x23, 0x48, 0x45, 0x1b, 0x28, 0x42, 0x1b, 0x08, 0x42, 0x1b, 0x28, 0x42, 0x23, 0x28, 0x48, 
+  0x1b, 0x28, 0x00, 0x23, 0x08, 0x43, 0x1b, 0x08, 0x02, 0x23, 0x49, 0x12, 0xc7, 0x02, 0x05, 0x42, 
+  0x01, 0xe6, 0x00, 0x09, 0xe6, 0x4c, 0x01, 0xe6, 0x03, 0x02, 0x06, 0x01, 0xe6, 0x0a, 0x66, 0x23, 
+  0x48, 0x45, 0x1b, 0x28, 0x01, 0x23, 0x28, 0x23, 0x08, 0x42, 0x1b, 0x28, 0x44, 0x23, 0x28, 0x41, 
+  0x23, 0x29, 0x41, 0x1b, 0x28, 0x43, 0x23, 0x29, 0x42, 0x23, 0x28, 0x00, 0x23, 0x29, 0x41, 0x23, 
+  0x28, 0x42, 0x13, 0xc8, 0x01, 0x1b, 0xc9, 0x12, 0xc7, 0x80, 0x02, 0x09, 0xe6, 0x01, 0xa6, 0x09, 
+  0xe5, 0x80, 0x41, 0x01, 0xa5, 0x82, 0x48, 0x01, 0xe6, 0x00, 0x01, 0xe5, 0x42, 0x01, 0xc6, 0x41, 
+  0x01, 0xa6, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x00, 0x01, 0xc5, 0x42, 0x01, 
+  0xa5, 0x80, 0x46, 0x01, 0xe6, 0x10, 0x1b, 0x08, 0x01, 0xc5, 0x01, 0xa4, 0x5c, 0x2e, 0xae, 0x17, 
+  0xce, 0xfb, 0xd7, 0x5d, 0xcf, 0x1b, 0xcf, 0x5c, 0xd7, 0x7d, 0x8d, 0x34, 0x2a, 0xe9, 0x23, 0x29, 
+  0x01, 0xa5, 0x1a, 0xe8, 0x0a, 0x86, 0x1b, 0x08, 0x80, 0x02, 0x0a, 0x46, 0x1a, 0xe8, 0x01, 0xc5, 
+  0x80, 0x0d, 0x01, 0xe5, 0x1a, 0xe7, 0x0a, 0x86, 0x02, 0x06, 0x01, 0xe6, 0x12, 0xa7, 0x1b, 0x08, 
+  0x02, 0x06, 0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x66, 0x1a, 0xe8, 0x0a, 0x26, 0x01, 0xe5, 0x80, 0x02, 
+  0x01, 0xe5, 0x1a, 0xc7, 0x0a, 0x86, 0x49, 0x0a, 0x46, 0x41, 0x0a, 0x26, 0x49, 0x0a, 0x46, 0x00, 
+  0x0a, 0x26, 0x43, 0x0a, 0x46, 0x42, 0x0a, 0x26, 0x00, 0x0a, 0x25, 0x41, 0x0a, 0x26, 0x15, 0x0a, 
+  0x25, 0x0a, 0x66, 0x22, 0xa7, 0x74, 0xd1, 0xcf, 0x7c, 0xcf, 0x3c, 0xc6, 0xfb, 0xcf, 0x1c, 0xd7, 
+  0x1c, 0x95, 0x95, 0x1a, 0x27, 0x11, 0xe6, 0x01, 0x84, 0x09, 0xe5, 0x0a, 0x06, 0x0a, 0x26, 0x0a, 
+  0x46, 0x0a, 0x67, 0x1a, 0xc9, 0x22, 0xa9, 0x85, 0x13, 0xcf, 0x3c, 0x80, 0x0b, 0xd7, 0x5d, 0xce, 
+  0xfb, 0xcf, 0x1c, 0xdf, 0x7d, 0xc6, 0xfb, 0xbe, 0xda, 0x5c, 0x4f, 0x1a, 0x46, 0x1a, 0x87, 0x0a, 
+  0x46, 0x0a, 0x66, 0x0a, 0x46, 0x41, 0x0a, 0x66, 0x41, 0x0a, 0x45, 0x00, 0x0a, 0x25, 0x55, 0x0a, 
+  0x46, 0x00, 0x0a, 0x26, 0x41, 0x0a, 0x46, 0x04, 0x0a, 0x66, 0x0a, 0x46, 0x1a, 0xe7, 0x12, 0xa7, 
+  0x01, 0xc5, 0x52, 0x01, 0xe6, 0x00, 0x02, 0x26, 0x45, 0x0a, 0x46, 0x00, 0x0a, 0x26, 0x56, 0x0a, 
+  0x46, 0x81, 0x01, 0x1b, 0xc9, 0x12, 0xe7, 0x41, 0x01, 0xe6, 0x80, 0x03, 0x01, 0xc6, 0x01, 0xe5, 
+  0x12, 0xc7, 0x01, 0xc5, 0x81, 0x00, 0x0a, 0xa6, 0x82, 0x00, 0x01, 0xe7, 0x81, 0x41, 0x01, 0xe7, 
+  0x02, 0x01, 0xc6, 0x02, 0x06, 0x12, 0x87, 0x41, 0x01, 0xe6, 0x80, 0x41, 0x01, 0xa5, 0x01, 0x01, 
+  0xc5, 0x09, 0xe6, 0x80, 0x00, 0x09, 0xe6, 0x41, 0x02, 0x06, 0x01, 0x0a, 0x06, 0x02, 0x06, 0x85, 
+  0x41, 0x02, 0x07, 0x0d, 0x0a, 0x46, 0x1b, 0x48, 0x01, 0x84, 0x43, 0x4c, 0xcf, 0x3b, 0xd7, 0x7d, 
+  0xcf, 0x3c, 0xcf, 0x1b, 0xdf, 0x7d, 0xc6, 0xfb, 0xa6, 0x37, 0x09, 0xc5, 0x0a, 0x46, 0x12, 0xc7, 
+  0x80, 0x00, 0x12, 0xc8, 0x81, 0x00, 0x02, 0x06, 0x82, 0x0c, 0x01, 0xc5, 0x1a, 0xe8, 0x0a, 0x66, 
+  0x01, 0xc6, 0x01, 0xe6, 0x0a, 0x86, 0x1a, 0xe7, 0x02, 0x06, 0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x26, 
+  0x12, 0xe7, 0x0a, 0x26, 0x41, 0x01, 0xe6, 0x02, 0x02, 0x06, 0x12, 0xa7, 0x0a, 0x46, 0x45, 0x01, 
+  0xe6, 0x45, 0x01, 0xc6, 0x49, 0x01, 0xe6, 0x46, 0x01, 0xc6, 0x42, 0x01, 0xa6, 0x41, 0x01, 0xc6, 
+  0x09, 0x01, 0x64, 0x43, 0x4c, 0xcf, 0x5c, 0xd7, 0x5d, 0xd7, 0x5c, 0xcf, 0x1b, 0xd7, 0x7d, 0xbe, 
+  0xba, 0x22, 0x28, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x05, 0x01, 0xa6, 0x01, 0x85, 0x01, 0xa6, 0x01, 
+  0xc6, 0x01, 0xe6, 0x02, 0x07, 0x41, 0x02, 0x27, 0x03, 0x12, 0x27, 0x11, 0xa6, 0x85, 0x13, 0xbe, 
+  0xba, 0x41, 0xd7, 0x5c, 0x02, 0xce, 0xfb, 0xcf, 0x1c, 0xd7, 0x5d, 0x41, 0xce, 0xfb, 0x03, 0xb6, 
+  0x58, 0x09, 0xc6, 0x01, 0x64, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x49, 0x01, 0xc6, 0x00, 0x01, 0xe6, 
+  0x41, 0x01, 0xc6, 0x43, 0x01, 0xe6, 0x4a, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x03, 0x01, 0xe5, 0x1a, 
+  0xc8, 0x1a, 0xa7, 0x01, 0xe5, 0x84, 0x00, 0x01, 0xe7, 0x4e, 0x01, 0xe6, 0x45, 0x01, 0xc6, 0x00, 
+  0x01, 0xe6, 0x42, 0x01, 0xc6, 0x43, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x41, 0x01, 
+  0xc6, 0x00, 0x01, 0xe6, 0x42, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x01, 0x09, 0xe6, 0x09, 0xe7, 0x03, 
+  0x1b, 0x48, 0x1b, 0x69, 0x12, 0xe7, 0x02, 0x06, 0x81, 0x04, 0x01, 0xc6, 0x01, 0xc5, 0x12, 0x66, 
+  0x12, 0xa7, 0x01, 0xc6, 0x80, 0x01, 0x12, 0xe7, 0x0a, 0xa7, 0x80, 0x00, 0x09, 0xe6, 0x44, 0x01, 
+  0xe6, 0x81, 0x02, 0x0a, 0x26, 0x23, 0x49, 0x02, 0x06, 0x81, 0x04, 0x01, 0x85, 0x0a, 0x05, 0x1a, 
+  0xc6, 0x23, 0x27, 0x0a, 0x46, 0x80, 0x04, 0x0a, 0x26, 0x1b, 0x07, 0x23, 0x88, 0x1b, 0x68, 0x0a, 
+  0x46, 0x44, 0x01, 0xc6, 0x80, 0x03, 0x0a, 0x28, 0x02, 0x66, 0x1b, 0x28, 0x4b, 0xad, 0x41, 0xcf, 
+  0x1b, 0x00, 0xc6, 0xfb, 0x80, 0x05, 0xdf, 0x7d, 0xbe, 0x99, 0x32, 0xa9, 0x1a, 0xa8, 0x01, 0xe6, 
+  0x12, 0x87, 0x81, 0x00, 0x12, 0xe8, 0x81, 0x00, 0x01, 0xe6, 0x83, 0x04, 0x12, 0xe8, 0x0a, 0x46, 
+  0x01, 0xc5, 0x12, 0xa7, 0x12, 0xc7, 0x41, 0x02, 0x06, 0x80, 0x07, 0x0a, 0x67, 0x1a, 0xe8, 0x0a, 
+  0x26, 0x01, 0xe6, 0x01, 0xc6, 0x02, 0x06, 0x1b, 0x08, 0x0a, 0x86, 0x44, 0x01, 0xe6, 0x00, 0x01, 
+  0xe7, 0x80, 0x00, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x44, 0x01, 0xe7, 0x80, 0x00, 0x01, 0xe7, 0x82, 
+  0x00, 0x01, 0xe7, 0x80, 0x02, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x00, 0x01, 
+  0xe7, 0x42, 0x01, 0xe6, 0x0d, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0x65, 0x01, 0x44, 0x43, 0x4d, 0xcf, 
+  0x3c, 0xd7, 0x5c, 0xcf, 0x1c, 0xce, 0xfb, 0xdf, 0x9d, 0xbe, 0x9a, 0x3a, 0xeb, 0x01, 0x85, 0x01, 
+  0xe6, 0x42, 0x02, 0x07, 0x02, 0x0a, 0x07, 0x0a, 0x27, 0x0a, 0x07, 0x41, 0x02, 0x07, 0x80, 0x13, 
+  0x0a, 0x07, 0x01, 0xa6, 0x01, 0x65, 0x01, 0x44, 0x11, 0xa6, 0x95, 0x75, 0xb6, 0x79, 0xdf, 0x9e, 
+  0xd7, 0x5d, 0xce, 0xfb, 0xd7, 0x3c, 0xd7, 0x5d, 0xdf, 0x5d, 0xa5, 0xf7, 0x5c, 0x2f, 0x2a, 0xca, 
+  0x01, 0x24, 0x01, 0x44, 0x01, 0xa6, 0x09, 0xc6, 0x80, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x43, 
+  0x01, 0xe6, 0x41, 0x01, 0xe7, 0x49, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x44, 0x01, 0xe6, 0x42, 0x01, 
+  0xc6, 0x03, 0x01, 0xe5, 0x1a, 0xc7, 0x12, 0xc7, 0x01, 0xe5, 0x45, 0x01, 0xe6, 0x00, 0x01, 0xe7, 
+  0x81, 0x00, 0x01, 0xe7, 0x4e, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x03, 0x01, 0xe6, 0x01, 0xe7, 0x01, 
+  0xe6, 0x09, 0xe6, 0x81, 0x00, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x03, 0x09, 0xe7, 0x0a, 0x07, 0x09, 
+  0xe7, 0x09, 0xe6, 0x47, 0x0a, 0x07, 0x44, 0x01, 0xe6, 0x05, 0x01, 0xc6, 0x01, 0xc5, 0x12, 0xa7, 
+  0x1a, 0xc7, 0x01, 0xe5, 0x01, 0xe6, 0x80, 0x01, 0x12, 0xc7, 0x12, 0xa7, 0x80, 0x41, 0x01, 0xe6, 
+  0x00, 0x09, 0xe6, 0x43, 0x01, 0xe6, 0x80, 0x01, 0x02, 0x26, 0x1b, 0x48, 0x82, 0x0b, 0x09, 0xe5, 
+  0x1a, 0xe7, 0x1a, 0xe6, 0x1b, 0x26, 0x1b, 0x27, 0x01, 0xc6, 0x12, 0xa7, 0x2c, 0x09, 0x1b, 0x88, 
+  0x1b, 0x47, 0x23, 0x48, 0x0a, 0x06, 0x42, 0x01, 0xa6, 0x0f, 0x09, 0xc6, 0x01, 0xe6, 0x01, 0xa5, 
+  0x33, 0x6c, 0x74, 0xf1, 0xd7, 0x5c, 0xcf, 0x3c, 0xc7, 0x1b, 0xd7, 0x5c, 0xae, 0x58, 0x95, 0xb5, 
+  0x22, 0xa9, 0x01, 0xc5, 0x1b, 0x09, 0x01, 0xe5, 0x0a, 0x87, 0x84, 0x05, 0x02, 0x05, 0x0a, 0x66, 
+  0x1a, 0xe7, 0x01, 0xe6, 0x01, 0xe5, 0x1b, 0x08, 0x80, 0x01, 0x01, 0xe5, 0x1b, 0x28, 0x42, 0x01, 
+  0xe6, 0x02, 0x0a, 0x66, 0x1b, 0x28, 0x0a, 0x46, 0x41, 0x01, 0xc6, 0x04, 0x02, 0x05, 0x1a, 0xe7, 
+  0x12, 0xa7, 0x01, 0xe6, 0x01, 0xe7, 0x80, 0x41, 0x01, 0xe7, 0x00, 0x09, 0xe6, 0x47, 0x01, 0xe6, 
+  0x43, 0x01, 0xe7, 0x80, 0x43, 0x01, 0xe7, 0x45, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x80, 0x05, 0x09, 
+  0xe7, 0x0a, 0x07, 0x01, 0x85, 0x32, 0xaa, 0x53, 0xae, 0xcf, 0x1b, 0x80, 0x05, 0xd7, 0x5d, 0xe7, 
+  0xdf, 0xef, 0xff, 0xc6, 0xba, 0x2a, 0xcb, 0x01, 0xa6, 0x41, 0x09, 0xe7, 0x09, 0x01, 0xe7, 0x0a, 
+  0x27, 0x09, 0xe7, 0x01, 0x44, 0x01, 0x24, 0x09, 0xe6, 0x0a, 0x28, 0x0a, 0x27, 0x01, 0xe7, 0x01, 
+  0xc6, 0x80, 0x41, 0x01, 0x85, 0x0f, 0x09, 0x86, 0x01, 0x65, 0x22, 0xaa, 0x95, 0x75, 0xbe, 0x79, 
+  0xef, 0xbe, 0xdf, 0x9e, 0xd7, 0x3c, 0xcf, 0x1c, 0xdf, 0x7d, 0xe7, 0xde, 0xa5, 0xf7, 0x3a, 0xea, 
+  0x4b, 0x4c, 0x09, 0xc6, 0x01, 0x03, 0x80, 0x00, 0x09, 0xe7, 0x45, 0x01, 0xe6, 0x80, 0x03, 0x01, 
+  0xe6, 0x01, 0xe7, 0x09, 0xe6, 0x09, 0xe7, 0x80, 0x00, 0x01, 0xc6, 0x82, 0x43, 0x01, 0xc6, 0x81, 
+  0x41, 0x09, 0xe6, 0x80, 0x05, 0x01, 0xa6, 0x01, 0x85, 0x01, 0xa6, 0x01, 0xe5, 0x1b, 0x07, 0x12, 
+  0xa7, 0x82, 0x41, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x87, 0x00, 0x01, 0xc6, 0x51, 
+  0x01, 0xe6, 0x01, 0x09, 0xe6, 0x01, 0xe6, 0x42, 0x09, 0xe6, 0x00, 0x09, 0xe7, 0x84, 0x83, 0x03, 
+  0x09, 0xe6, 0x01, 0xc5, 0x12, 0xa7, 0x1a, 0xe8, 0x41, 0x01, 0xe6, 0x01, 0x01, 0xc6, 0x0a, 0x26, 
+  0x80, 0x00, 0x0a, 0x46, 0x82, 0x43, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x81, 0x00, 0x1b, 0x28, 0x42, 
+  0x01, 0xe6, 0x05, 0x1b, 0x08, 0x2b, 0xa9, 0x01, 0xe3, 0x12, 0xa5, 0x1b, 0x07, 0x01, 0xa5, 0x80, 
+  0x15, 0x24, 0x09, 0x0b, 0x06, 0x13, 0x27, 0x23, 0x88, 0x09, 0xe6, 0x01, 0xa5, 0x01, 0x85, 0x09, 
+  0xa5, 0x01, 0x03, 0x22, 0x68, 0x5c, 0x0f, 0xbe, 0xba, 0xe7, 0xbe, 0xd7, 0x3c, 0xcf, 0x1b, 0xd7, 
+  0x5c, 0xb6, 0x79, 0x3a, 0xca, 0x01, 0xc4, 0x0a, 0x06, 0x01, 0xe6, 0x1b, 0x28, 0x81, 0x00, 0x1a, 
+  0xc7, 0x82, 0x02, 0x1b, 0x28, 0x01, 0xe5, 0x0a, 0x46, 0x80, 0x00, 0x01, 0xc5, 0x83, 0x00, 0x1a, 
+  0xe8, 0x80, 0x03, 0x01, 0xc6, 0x0a, 0x66, 0x1b, 0x28, 0x0a, 0x46, 0x41, 0x01, 0xe6, 0x03, 0x02, 
+  0x06, 0x1b, 0x08, 0x12, 0x87, 0x01, 0xc5, 0x4f, 0x01, 0xe6, 0x80, 0x41, 0x01, 0xe6, 0x82, 0x47, 
+  0x01, 0xe6, 0x2f, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0x64, 0x43, 0x6d, 0xcf, 0x1b, 0xd7, 0x7d, 0xce, 
+  0xfb, 0xe7, 0xdf, 0xa5, 0xb6, 0x5b, 0x2c, 0x6b, 0xae, 0x19, 0x25, 0x00, 0x62, 0x01, 0x04, 0x09, 
+  0x04, 0x08, 0xe3, 0x00, 0xc3, 0x00, 0xe3, 0x00, 0x00, 0x52, 0xa9, 0x7b, 0xee, 0x08, 0xa2, 0x00, 
+  0x61, 0x01, 0x03, 0x09, 0xa5, 0x09, 0x85, 0x01, 0x86, 0x01, 0xa6, 0x01, 0xc6, 0x01, 0xe6, 0x0a, 
+  0x07, 0x02, 0x07, 0x01, 0x64, 0x3b, 0x2c, 0x95, 0x75, 0x84, 0xf3, 0xce, 0xfb, 0xe7, 0xde, 0xcf, 
+  0x1c, 0xce, 0xfb, 0xd7, 0x3c, 0xd7, 0x7d, 0xe7, 0xbe, 0x7c, 0xd2, 0x4b, 0x4d, 0x01, 0xa6, 0x01, 
+  0x64, 0x09, 0xe7, 0x41, 0x0a, 0x07, 0x43, 0x01, 0xe7, 0x80, 0x00, 0x09, 0xe6, 0x42, 0x01, 0xe6, 
+  0x44, 0x01, 0xc6, 0x01, 0x01, 0xe6, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x0b, 0x01, 0xe7, 0x01, 0xe6, 
+  0x01, 0xc6, 0x01, 0xc5, 0x12, 0x06, 0x12, 0x46, 0x0a, 0x05, 0x01, 0xc5, 0x02, 0x06, 0x1b, 0x28, 
+  0x12, 0xa7, 0x01, 0xa5, 0x58, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x89, 0x41, 0x09, 0xe6, 0x45, 0x09, 
+  0xe7, 0x81, 0x80, 0x43, 0x01, 0xc5, 0x02, 0x12, 0xa7, 0x1a, 0xe7, 0x02, 0x06, 0x80, 0x04, 0x01, 
+  0xc6, 0x0a, 0x46, 0x1b, 0x28, 0x12, 0x86, 0x01, 0xc5, 0x42, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x81, 
+  0x01, 0x01, 0xe7, 0x01, 0xe6, 0x85, 0x19, 0x0a, 0x87, 0x23, 0x88, 0x1b, 0x06, 0x1a, 0xe6, 0x12, 
+  0x25, 0x01, 0x85, 0x0a, 0x26, 0x1b, 0x28, 0x1b, 0x88, 0x23, 0xc9, 0x1b, 0x08, 0x01, 0xe6, 0x01, 
+  0xc5, 0x09, 0xa6, 0x01, 0x24, 0x2a, 0x48, 0xae, 0x17, 0xdf, 0xbd, 0xcf, 0x3c, 0xcf, 0x1b, 0xd7, 
+  0x5c, 0xe7, 0xbe, 0xae, 0x38, 0x2a, 0x68, 0x01, 0x44, 0x1a, 0xa8, 0x80, 0x01, 0x01, 0xc6, 0x1b, 
+  0x08, 0x80, 0x01, 0x0a, 0x67, 0x12, 0xc7, 0x82, 0x01, 0x1b, 0x08, 0x01, 0xe6, 0x80, 0x00, 0x12, 
+  0xe7, 0x41, 0x01, 0xc5, 0x82, 0x04, 0x1b, 0x08, 0x01, 0xc5, 0x0a, 0x26, 0x1b, 0x08, 0x0a, 0x46, 
+  0x41, 0x01, 0xe6, 0x02, 0x02, 0x26, 0x1b, 0x28, 0x12, 0xa7, 0x49, 0x01, 0xe6, 0x00, 0x01, 0xe7, 
+  0x81, 0x41, 0x01, 0xe7, 0x47, 0x01, 0xe6, 0x42, 0x01, 0xe7, 0x84, 0x0f, 0x09, 0xe6, 0x01, 0x64, 
+  0x32, 0xca, 0x74, 0x71, 0xbe, 0x79, 0xdf, 0x5d, 0xcf, 0x1c, 0xce, 0xbb, 0x5b, 0x0c, 0x39, 0xc7, 
+  0x41, 0xe7, 0x5a, 0x89, 0x62, 0xeb, 0x6b, 0x2c, 0x31, 0xa6, 0x00, 0x01, 0x41, 0x00, 0x02, 0x0c, 
+  0x39, 0xc7, 0x7b, 0xee, 0xbd, 0xd5, 0xde, 0xb8, 0x7b, 0xee, 0x73, 0x8c, 0x4a, 0x69, 0x00, 0x00, 
+  0x00, 0xa2, 0x09, 0x86, 0x09, 0xc7, 0x09, 0xe7, 0x01, 0xe7, 0x41, 0x02, 0x07, 0x08, 0x0a, 0x27, 
+  0x01, 0xe6, 0x01, 0x85, 0x01, 0x44, 0x53, 0x8d, 0x7c, 0xd2, 0xd7, 0x3c, 0xd7, 0x5c, 0xcf, 0x1c, 
+  0x41, 0xce, 0xfb, 0x07, 0xd7, 0x5d, 0xdf, 0x9e, 0x95, 0x54, 0x5b, 0xae, 0x01, 0x85, 0x01, 0xa5, 
+  0x01, 0xe6, 0x02, 0x06, 0x42, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x43, 0x01, 0xc5, 0x84, 0x41, 0x01, 
+  0xc5, 0x00, 0x01, 0xe5, 0x41, 0x01, 0xe6, 0x41, 0x01, 0xc5, 0x09, 0x12, 0xa6, 0x1b, 0x07, 0x23, 
+  0x68, 0x1b, 0x07, 0x0a, 0x26, 0x01, 0xe6, 0x02, 0x06, 0x12, 0xe7, 0x12, 0x87, 0x01, 0xc5, 0x8e, 
+  0x00, 0x01, 0xe7, 0x4d, 0x01, 0xe6, 0x43, 0x09, 0xe6, 0x00, 0x09, 0xe7, 0x44, 0x09, 0xe6, 0x44, 
+  0x0a, 0x07, 0x41, 0x1b, 0x08, 0x41, 0x1a, 0xe8, 0x08, 0x1b, 0x08, 0x12, 0xc8, 0x02, 0x06, 0x01, 
+  0xe6, 0x01, 0xc6, 0x02, 0x26, 0x1b, 0x49, 0x1b, 0x08, 0x01, 0xe5, 0x46, 0x01, 0xe6, 0x85, 0x09, 
+  0x01, 0xc6, 0x02, 0x07, 0x02, 0x06, 0x0a, 0xa6, 0x23, 0x88, 0x12, 0x86, 0x01, 0x64, 0x01, 0xa6, 
+  0x01, 0xc6, 0x01, 0xe6, 0x41, 0x1b, 0x48, 0x10, 0x02, 0x26, 0x02, 0x06, 0x09, 0xc6, 0x01, 0x44, 
+  0x22, 0x48, 0xae, 0x78, 0xd7, 0x7d, 0xc6, 0xfb, 0xcf, 0x1c, 0xd7, 0x5d, 0xc6, 0xda, 0x5c, 0x2f, 
+  0x3b, 0xcc, 0x01, 0xa4, 0x01, 0xc6, 0x1a, 0xc8, 0x0a, 0x26, 0x81, 0x00, 0x01, 0xc5, 0x85, 0x00, 
+  0x02, 0x06, 0x88, 0x03, 0x0a, 0x87, 0x1a, 0xe8, 0x01, 0xa5, 0x09, 0xc6, 0x80, 0x01, 0x1b, 0x08, 
+  0x12, 0xc7, 0x47, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x82, 0x00, 0x01, 0xc6, 0x81, 0x00, 0x01, 0xe6, 
+  0x41, 0x01, 0xe7, 0x87, 0x44, 0x01, 0xe6, 0x21, 0x02, 0x07, 0x01, 0x85, 0x2a, 0x89, 0xb6, 0x79, 
+  0xe7, 0xdf, 0xdf, 0x5d, 0xdf, 0x7e, 0xdf, 0x7d, 0x4a, 0x49, 0x39, 0x86, 0x8c, 0x0f, 0xc5, 0xb4, 
+  0xd6, 0x16, 0xce, 0x36, 0xd6, 0x56, 0xad, 0x33, 0x83, 0xef, 0x5a, 0xcc, 0x10, 0x65, 0x29, 0x47, 
+  0x4a, 0x48, 0x9c, 0xf2, 0xd6, 0xb8, 0xce, 0x77, 0xd6, 0x97, 0xbd, 0xb4, 0x8c, 0x6f, 0x52, 0x89, 
+  0x00, 0x41, 0x00, 0x82, 0x09, 0xc6, 0x0a, 0x48, 0x0a, 0x88, 0x1b, 0x09, 0x41, 0x1b, 0x08, 0x08, 
+  0x1b, 0x29, 0x1b, 0x09, 0x0a, 0x26, 0x09, 0xe5, 0x4b, 0xed, 0x8d, 0xb4, 0xe7, 0xbe, 0xdf, 0x7d, 
+  0xd7, 0x3c, 0x41, 0xce, 0xfb, 0x07, 0xe7, 0x9e, 0xd7, 0x5d, 0x95, 0x75, 0x9d, 0xd6, 0x54, 0x2e, 
+  0x02, 0x45, 0x12, 0xc7, 0x12, 0xe8, 0x46, 0x1b, 0x08, 0x45, 0x1a, 0xe8, 0x42, 0x1b, 0x08, 0x02, 
+  0x1a, 0xe8, 0x1a, 0xe7, 0x23, 0x68, 0x41, 0x12, 0xe6, 0x07, 0x23, 0x88, 0x12, 0x87, 0x01, 0xc6, 
+  0x01, 0xe6, 0x02, 0x06, 0x12, 0xc7, 0x12, 0xa7, 0x01, 0xc5, 0x85, 0x00, 0x01, 0xe7, 0x83, 0x00, 
+  0x01, 0xc6, 0x85, 0x00, 0x01, 0xe7, 0x85, 0x41, 0x01, 0xe7, 0x43, 0x01, 0xe6, 0x82, 0x42, 0x09, 
+  0xe7, 0x01, 0x0a, 0x06, 0x09, 0xe7, 0x84, 0x00, 0x0a, 0x47, 0x42, 0x0a, 0x46, 0x04, 0x0a, 0x47, 
+  0x02, 0x06, 0x01, 0xc6, 0x01, 0xc5, 0x02, 0x05, 0x41, 0x1b, 0x08, 0x01, 0x0a, 0x06, 0x01, 0xc6, 
+  0x81, 0x00, 0x01, 0xe7, 0x80, 0x01, 0x01, 0xc6, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x80, 0x00, 0x02, 
+  0x06, 0x82, 0x00, 0x01, 0xe6, 0x80, 0x02, 0x02, 0x25, 0x1b, 0x68, 0x0a, 0x66, 0x42, 0x01, 0xa6, 
+  0x13, 0x01, 0x65, 0x12, 0x66, 0x12, 0x87, 0x02, 0x27, 0x01, 0xe6, 0x22, 0x68, 0x9d, 0xb6, 0xb6, 
+  0x58, 0xd7, 0x5c, 0xc6, 0xfb, 0xcf, 0x3c, 0xd7, 0x5c, 0xcf, 0x1b, 0x43, 0x2b, 0x02, 0x05, 0x13, 
+  0x28, 0x02, 0x26, 0x01, 0xc5, 0x1a, 0xe8, 0x0a, 0x47, 0x82, 0x00, 0x0a, 0x66, 0x81, 0x03, 0x12, 
+  0xc8, 0x0a, 0x87, 0x1b, 0x28, 0x02, 0x05, 0x81, 0x41, 0x01, 0xc6, 0x86, 0x03, 0x01, 0xc5, 0x01, 
+  0xe6, 0x12, 0xc7, 0x0a, 0x86, 0x46, 0x01, 0xe6, 0x02, 0x01, 0xc6, 0x01, 0xe7, 0x01, 0xe6, 0x41, 
+  0x01, 0xc6, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x87, 0x45, 0x01, 0xe6, 0x0c, 
+  0x01, 0xe7, 0x01, 0xc6, 0x2a, 0x89, 0xb6, 0x79, 0xd7, 0x5d, 0xcf, 0x1c, 0xce, 0xdb, 0x4a, 0x8b, 
+  0x39, 0xe9, 0x6b, 0x2d, 0xb5, 0x53, 0xc5, 0xf4, 0xc5, 0xd4, 0x41, 0xbd, 0xb3, 0x14, 0xbd, 0x93, 
+  0xc5, 0xd4, 0xce, 0x35, 0xb5, 0x93, 0x9c, 0xd1, 0x83, 0xef, 0x62, 0xcb, 0x42, 0x28, 0x39, 0xe8, 
+  0x9c, 0xf2, 0xb5, 0x94, 0xbd, 0xd5, 0xce, 0x56, 0xb5, 0x93, 0x94, 0xb0, 0x9c, 0xd1, 0x31, 0xe7, 
+  0x00, 0xe3, 0x09, 0xc5, 0x0a, 0x46, 0x0a, 0x66, 0x41, 0x0a, 0x46, 0x09, 0x0a, 0x26, 0x09, 0xe5, 
+  0x09, 0xc5, 0x01, 0x84, 0x1a, 0x27, 0x74, 0x72, 0xae, 0x38, 0xc6, 0xba, 0xd7, 0x5c, 0xd7, 0x3c, 
+  0x41, 0xce, 0xfb, 0x0a, 0xdf, 0x5d, 0xe7, 0x9e, 0xc6, 0xda, 0xa6, 0x57, 0x4b, 0xcd, 0x12, 0x46, 
+  0x0a, 0x26, 0x0a, 0x06, 0x12, 0x26, 0x0a, 0x27, 0x0a, 0x26, 0x44, 0x0a, 0x46, 0x42, 0x0a, 0x47, 
+  0x41, 0x0a, 0x67, 0x02, 0x0a, 0x66, 0x0a, 0x46, 0x0a, 0x66, 0x42, 0x1b, 0x48, 0x03, 0x23, 0x68, 
+  0x0a, 0x66, 0x01, 0xa6, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x02, 0x12, 0xc7, 0x12, 0x87, 0x01, 0xc5, 
+  0x87, 0x42, 0x01, 0xe7, 0x80, 0x42, 0x01, 0xc6, 0x81, 0x00, 0x01, 0xc6, 0x8a, 0x01, 0x01, 0xc6, 
+  0x01, 0xe6, 0x41, 0x09, 0xe6, 0x80, 0x41, 0x09, 0xe6, 0x44, 0x09, 0xe7, 0x81, 0x41, 0x01, 0xe6, 
+  0x00, 0x02, 0x06, 0x41, 0x01, 0xe6, 0x80, 0x05, 0x02, 0x26, 0x12, 0xc7, 0x12, 0xe7, 0x0a, 0x46, 
+  0x02, 0x06, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x42, 0x01, 0xe7, 0x02, 0x01, 0xe6, 0x01, 0xe7, 0x09, 
+  0xe7, 0x80, 0x00, 0x09, 0xe6, 0x85, 0x05, 0x01, 0xe6, 0x02, 0x05, 0x1b, 0x89, 0x0a, 0xa7, 0x01, 
+  0xe6, 0x01, 0xc6, 0x80, 0x11, 0x01, 0x64, 0x12, 0x26, 0x0a, 0x06, 0x01, 0xa5, 0x22, 0x48, 0xb6, 
+  0x38, 0xdf, 0x9d, 0xd7, 0x5d, 0xcf, 0x1c, 0xd7, 0x5d, 0xbe, 0xda, 0x43, 0x0b, 0x33, 0x29, 0x01, 
+  0xc4, 0x0a, 0x66, 0x1b, 0x08, 0x01, 0xe6, 0x01, 0xa5, 0x81, 0x00, 0x01, 0xe6, 0x85, 0x00, 0x0a, 
+  0x86, 0x82, 0x00, 0x12, 0xe8, 0x82, 0x00, 0x0a, 0x66, 0x84, 0x03, 0x01, 0xa5, 0x1a, 0xe8, 0x12, 
+  0x87, 0x01, 0xc6, 0x80, 0x00, 0x01, 0xe7, 0x45, 0x01, 0xe6, 0x80, 0x42, 0x01, 0xc6, 0x42, 0x01, 
+  0xe6, 0x43, 0x01, 0xe7, 0x89, 0x05, 0x01, 0xe7, 0x01, 0xa6, 0x09, 0xc6, 0x95, 0x75, 0xc6, 0xdb, 
+  0xdf, 0x9e, 0x80, 0x03, 0x7c, 0x30, 0x18, 0xe3, 0x6a, 0xeb, 0x94, 0x30, 0x41, 0xce, 0x17, 0x00, 
+  0xad, 0x54, 0x41, 0xad, 0x53, 0x01, 0xbd, 0xb4, 0xc5, 0xf4, 0x41, 0xbd, 0xb4, 0x0a, 0xc5, 0xf4, 
+  0xce, 0x35, 0xc6, 0x15, 0xbd, 0xb5, 0x7b, 0x8e, 0x5a, 0x8a, 0x21, 0x24, 0x39, 0xe7, 0xad, 0x54, 
+  0xb5, 0xb5, 0xce, 0x57, 0x41, 0xce, 0x56, 0x07, 0xb5, 0x74, 0x94, 0x70, 0x21, 0x24, 0x00, 0xa2, 
+  0x01, 0x44, 0x01, 0x85, 0x01, 0xa6, 0x01, 0x85, 0x41, 0x01, 0x65, 0x12, 0x01, 0xa6, 0x01, 0x86, 
+  0x01, 0x85, 0x01, 0x45, 0x74, 0x71, 0xcf, 0x1c, 0xbe, 0x9a, 0xd7, 0x3c, 0xdf, 0x5d, 0xd7, 0x3c, 
+  0xce, 0xfb, 0xcf, 0x1c, 0xd7, 0x5d, 0xc6, 0xdb, 0xb6, 0x59, 0x2a, 0x48, 0x09, 0x86, 0x01, 0x44, 
+  0x01, 0x65, 0x41, 0x01, 0xa6, 0x02, 0x01, 0x85, 0x01, 0x86, 0x01, 0xa6, 0x47, 0x01, 0xc6, 0x05, 
+  0x01, 0xc5, 0x0a, 0x66, 0x23, 0x48, 0x23, 0x68, 0x12, 0xc7, 0x01, 0xe6, 0x43, 0x01, 0xc6, 0x03, 
+  0x02, 0x06, 0x12, 0xc7, 0x0a, 0x66, 0x02, 0x06, 0x51, 0x02, 0x26, 0x41, 0x0a, 0x26, 0x44, 0x02, 
+  0x26, 0x00, 0x02, 0x06, 0x45, 0x0a, 0x26, 0x02, 0x02, 0x26, 0x02, 0x06, 0x0a, 0x26, 0x45, 0x0a, 
+  0x27, 0x00, 0x0a, 0x47, 0x00, 0x1b, 0x49, 0x43, 0x1b, 0x29, 0x42, 0x1b, 0x28, 0x00, 0x02, 0x06, 
+  0x41, 0x01, 0xc6, 0x00, 0x01, 0xe7, 0x84, 0x43, 0x01, 0xe7, 0x87, 0x01, 0x01, 0xe5, 0x23, 0x69, 
+  0x80, 0x13, 0x02, 0x07, 0x0a, 0x07, 0x09, 0xe7, 0x09, 0x85, 0x12, 0x05, 0x11, 0xc6, 0x19, 0xc6, 
+  0xb6, 0x38, 0xdf, 0x9d, 0xcf, 0x1c, 0xce, 0xfb, 0xd7, 0x5d, 0xce, 0xfb, 0x43, 0x2c, 0x01, 0x02, 
+  0x1a, 0xa7, 0x01, 0xc5, 0x0a, 0x46, 0x12, 0xe7, 0x01, 0xc5, 0x85, 0x00, 0x0a, 0x67, 0x81, 0x00, 
+  0x12, 0xe8, 0x81, 0x00, 0x01, 0xe6, 0x80, 0x01, 0x12, 0xe7, 0x01, 0xe5, 0x81, 0x00, 0x0a, 0x46, 
+  0x80, 0x00, 0x1b, 0x28, 0x80, 0x00, 0x0a, 0x67, 0x81, 0x01, 0x1b, 0x08, 0x0a, 0x66, 0x81, 0x41, 
+  0x01, 0xc6, 0x80, 0x42, 0x01, 0xc6, 0x00, 0x09, 0xc6, 0x41, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x00, 
+  0x01, 0xc6, 0x88, 0x00, 0x01, 0xe7, 0x80, 0x41, 0x01, 0xc6, 0x80, 0x16, 0x09, 0xe7, 0x01, 0x85, 
+  0x1a, 0x28, 0xa5, 0xd7, 0xef, 0xdf, 0xdf, 0x7d, 0xad, 0xd7, 0x74, 0x10, 0x29, 0x25, 0x7b, 0x8d, 
+  0xc5, 0x75, 0xde, 0x58, 0xbd, 0x75, 0x9c, 0xd3, 0x4a, 0xcd, 0x42, 0xcd, 0x3a, 0x6c, 0x7c, 0x51, 
+  0xa5, 0x53, 0xbd, 0xd4, 0xc6, 0x14, 0xbd, 0xd4, 0xbd, 0xb3, 0x41, 0xbd, 0xd4, 0x11, 0xc5, 0xf5, 
+  0xbd, 0x94, 0x8c, 0x0f, 0x73, 0x6e, 0x18, 0xc4, 0x4a, 0x49, 0xa5, 0x13, 0xb5, 0xb5, 0xce, 0x36, 
+  0xc6, 0x16, 0xc6, 0x15, 0xbd, 0xd5, 0x7b, 0xcd, 0x10, 0xa2, 0x08, 0xc2, 0x00, 0xc2, 0x01, 0x65, 
+  0x09, 0xe7, 0x41, 0x01, 0xc6, 0x03, 0x01, 0xe6, 0x0a, 0x07, 0x02, 0x07, 0x0a, 0x07, 0x41, 0x11, 
+  0xe7, 0x10, 0xa5, 0xd7, 0xbe, 0x9a, 0xbe, 0x79, 0xdf, 0x7d, 0xd7, 0x5d, 0xc6, 0xfb, 0xcf, 0x3c, 
+  0xd7, 0x3c, 0xcf, 0x1b, 0xae, 0x38, 0x2a, 0x69, 0x12, 0x07, 0x01, 0x24, 0x01, 0x86, 0x09, 0xc7, 
+  0x09, 0xc6, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x81, 0x41, 0x01, 0xe6, 0x00, 0x02, 
+  0x06, 0x41, 0x01, 0xe6, 0x02, 0x0a, 0x06, 0x02, 0x06, 0x09, 0xe6, 0x43, 0x01, 0xc6, 0x41, 0x01, 
+  0xe6, 0x02, 0x01, 0xe5, 0x12, 0xa7, 0x1b, 0x28, 0x63, 0x1b, 0x08, 0x42, 0x1b, 0x09, 0x00, 0x23, 
+  0x09, 0x41, 0x23, 0x29, 0x46, 0x02, 0x06, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x47, 0x01, 0xe6, 0x81, 
+  0x41, 0x01, 0xe6, 0x85, 0x00, 0x01, 0xc6, 0x80, 0x0d, 0x01, 0xc5, 0x1b, 0x28, 0x0a, 0x87, 0x01, 
+  0xa5, 0x01, 0xc6, 0x01, 0xa5, 0x01, 0x23, 0x22, 0x47, 0xa5, 0xf7, 0xc6, 0xdb, 0xd7, 0x3c, 0xcf, 
+  0x1c, 0xd7, 0x3c, 0xe7, 0xbe, 0x80, 0x03, 0x4b, 0x8d, 0x01, 0x85, 0x09, 0xc5, 0x1a, 0xe8, 0x82, 
+  0x00, 0x01, 0xc6, 0x83, 0x00, 0x1b, 0x28, 0x80, 0x00, 0x0a, 0x66, 0x82, 0x00, 0x0a, 0x87, 0x81, 
+  0x00, 0x0a, 0x47, 0x80, 0x41, 0x01, 0xc6, 0x81, 0x00, 0x02, 0x05, 0x80, 0x01, 0x01, 0xe5, 0x0a, 
+  0x87, 0x81, 0x01, 0x1a, 0xe7, 0x0a, 0x46, 0x81, 0x43, 0x01, 0xe6, 0x80, 0x01, 0x09, 0xc6, 0x01, 
+  0xc6, 0x45, 0x01, 0xe6, 0x44, 0x01, 0xe7, 0x45, 0x01, 0xe6, 0x1a, 0x09, 0xc6, 0x01, 0xe6, 0x01, 
+  0xa6, 0x01, 0x44, 0x22, 0x48, 0xae, 0x58, 0xef, 0xff, 0xb6, 0x18, 0x8c, 0x92, 0x39, 0xc6, 0x6b, 
+  0x6c, 0xc5, 0xd5, 0xbd, 0x94, 0xac, 0xf3, 0x94, 0x72, 0x4a, 0x6b, 0x42, 0x6c, 0x5b, 0x91, 0x53, 
+  0x70, 0x4b, 0x50, 0x3a, 0xad, 0x3a, 0x6c, 0x6b, 0xb0, 0x9d, 0x13, 0xc6, 0x35, 0xc6, 0x15, 0xc5, 
+  0xf5, 0x42, 0xbd, 0xb4, 0x10, 0xc5, 0xd4, 0xad, 0x74, 0x94, 0x92, 0x63, 0x2c, 0x31, 0x65, 0x63, 
+  0x0b, 0x8c, 0x71, 0xb5, 0xb5, 0xd6, 0x98, 0xce, 0x57, 0xc5, 0xf5, 0xbd, 0xd4, 0x84, 0x0e, 0x31, 
+  0xa6, 0x11, 0x24, 0x00, 0xc2, 0x01, 0x65, 0x41, 0x01, 0xc6, 0x01, 0x01, 0xe7, 0x01, 0xc7, 0x41, 
+  0x01, 0x65, 0x11, 0x01, 0x86, 0x09, 0xa6, 0x01, 0x65, 0x2a, 0x89, 0xa5, 0xf7, 0xb6, 0x59, 0xdf, 
+  0x9e, 0xcf, 0x1c, 0xce, 0xfb, 0xd7, 0x5c, 0xd7, 0x3c, 0xd7, 0x5d, 0x9d, 0xb6, 0x32, 0xaa, 0x11, 
+  0x86, 0x01, 0x03, 0x01, 0xe6, 0x02, 0x06, 0x80, 0x00, 0x01, 0xc6, 0x43, 0x01, 0xa5, 0x43, 0x01, 
+  0xc5, 0x41, 0x01, 0xa5, 0x42, 0x01, 0xc5, 0x42, 0x01, 0xc6, 0x00, 0x01, 0xa5, 0x41, 0x01, 0xc5, 
+  0x02, 0x01, 0xe5, 0x01, 0xc5, 0x01, 0xe5, 0x41, 0x01, 0xc5, 0x45, 0x01, 0xe5, 0x47, 0x01, 0xc5, 
+  0x46, 0x01, 0xe5, 0x02, 0x01, 0xc5, 0x01, 0xe5, 0x01, 0xc5, 0x48, 0x01, 0xe5, 0x41, 0x01, 0xe6, 
+  0x02, 0x01, 0xc5, 0x01, 0xe5, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x01, 0x01, 0xc7, 
+  0x01, 0xc6, 0x41, 0x01, 0xe6, 0x81, 0x00, 0x01, 0xe7, 0x89, 0x00, 0x01, 0xe7, 0x80, 0x00, 0x02, 
+  0x26, 0x80, 0x00, 0x01, 0xe5, 0x80, 0x0a, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0xa5, 0x1a, 0xe7, 0x01, 
+  0xe5, 0x43, 0x8d, 0x54, 0x0f, 0x5c, 0x30, 0x53, 0xce, 0x95, 0x54, 0xd7, 0x5d, 0x41, 0xcf, 0x1c, 
+  0x06, 0xe7, 0xbe, 0xd7, 0x1c, 0xa5, 0xf7, 0x64, 0x30, 0x01, 0xc5, 0x0a, 0x07, 0x01, 0xe6, 0x86, 
+  0x00, 0x0a, 0x67, 0x81, 0x01, 0x01, 0xe5, 0x0a, 0x67, 0x83, 0x00, 0x1b, 0x08, 0x80, 0x01, 0x0a, 
+  0x46, 0x12, 0xe8, 0x82, 0x00, 0x0a, 0x67, 0x85, 0x00, 0x12, 0xe7, 0x81, 0x44, 0x01, 0xe7, 0x46, 
+  0x01, 0xe6, 0x46, 0x01, 0xe7, 0x80, 0x41, 0x01, 0xc6, 0x81, 0x12, 0x01, 0xe7, 0x0a, 0x07, 0x01, 
+  0x85, 0x22, 0x48, 0x4b, 0x6d, 0xae, 0x18, 0xef, 0xff, 0x8c, 0xd3, 0x42, 0x08, 0x63, 0x0b, 0xd6, 
+  0x57, 0xc5, 0xd5, 0xbd, 0x94, 0xc5, 0xb5, 0x39, 0xe8, 0x11, 0x06, 0x2a, 0x2c, 0x5b, 0xb1, 0x53, 
+  0x90, 0x41, 0x4b, 0x70, 0x08, 0x53, 0x90, 0x53, 0x70, 0x32, 0x8d, 0x42, 0xcd, 0x7c, 0x31, 0x84, 
+  0x72, 0xa5, 0x53, 0xc5, 0xf4, 0xbd, 0xd4, 0x80, 0x0a, 0xbd, 0xd4, 0xc5, 0xd5, 0xc5, 0xf5, 0xc6, 
+  0x15, 0xb5, 0x74, 0x41, 0xe7, 0x20, 0xe4, 0x62, 0xeb, 0x7b, 0xee, 0x9c, 0xd2, 0xd6, 0x77, 0x80, 
+  0x05, 0xc5, 0xf4, 0xce, 0x36, 0x63, 0x2b, 0x42, 0x07, 0x11, 0x04, 0x12, 0x27, 0x41, 0x12, 0x88, 
+  0x03, 0x12, 0x87, 0x0a, 0x47, 0x12, 0x67, 0x12, 0x87, 0x41, 0x12, 0x67, 0x0e, 0x12, 0x47, 0x09, 
+  0xc4, 0x3b, 0x4b, 0x8d, 0x94, 0xbe, 0xda, 0xe7, 0xbe, 0xcf, 0x1c, 0xce, 0xfb, 0xcf, 0x3c, 0xcf, 
+  0x1c, 0xdf, 0x9d, 0x84, 0xf3, 0x4b, 0x4c, 0x12, 0xa8, 0x02, 0x46, 0x41, 0x12, 0x87, 0x41, 0x12, 
+  0x67, 0x49, 0x12, 0x87, 0x42, 0x12, 0xa7, 0x00, 0x12, 0x87, 0x41, 0x12, 0xa7, 0x44, 0x12, 0x87, 
+  0x41, 0x12, 0x67, 0x5d, 0x12, 0x87, 0x41, 0x12, 0xa7, 0x01, 0x12, 0xa8, 0x12, 0x88, 0x42, 0x12, 
+  0xa7, 0x80, 0x43, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x4e, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x84, 0x41, 
+  0x01, 0xc6, 0x80, 0x02, 0x1a, 0xc8, 0x64, 0x70, 0xcf, 0x3c, 0x41, 0xe7, 0x9e, 0x0c, 0xe7, 0xbe, 
+  0xdf, 0x5d, 0xcf, 0x1c, 0xd7, 0x3c, 0xcf, 0x3c, 0x8d, 0x34, 0x6c, 0x71, 0x01, 0xc6, 0x01, 0xe6, 
+  0x0a, 0x07, 0x01, 0xe7, 0x02, 0x06, 0x1b, 0x08, 0x8a, 0x00, 0x12, 0xe7, 0x85, 0x00, 0x1a, 0xe8, 
+  0x83, 0x00, 0x02, 0x06, 0x82, 0x00, 0x12, 0xe8, 0x80, 0x00, 0x1a, 0xe8, 0x81, 0x4c, 0x01, 0xe6, 
+  0x84, 0x44, 0x01, 0xe6, 0x0b, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0x24, 0x1a, 0x07, 0x9d, 0xb6, 0xef, 
+  0xdf, 0xef, 0xff, 0x8c, 0xb2, 0x5a, 0xcb, 0xbe, 0x37, 0xdf, 0x19, 0xb5, 0x93, 0x42, 0xbd, 0xb4, 
+  0x05, 0x7b, 0xad, 0x6b, 0x6d, 0x4a, 0xac, 0x3a, 0xad, 0x43, 0x0f, 0x53, 0x91, 0x42, 0x53, 0x90, 
+  0x07, 0x53, 0xb1, 0x53, 0x90, 0x3a, 0xae, 0x32, 0x8d, 0x63, 0x8f, 0x94, 0xb2, 0xa5, 0x12, 0xbd, 
+  0xd4, 0x42, 0xbd, 0xb4, 0x08, 0xbd, 0xd4, 0xb5, 0x33, 0xac, 0xb3, 0x6b, 0x0e, 0x39, 0xc9, 0x31, 
+  0x66, 0x31, 0x86, 0x84, 0x0f, 0xc6, 0x15, 0x41, 0xbd, 0xd4, 0x03, 0xce, 0x56, 0x7b, 0xce, 0x10, 
+  0xc3, 0x1a, 0x06, 0x41, 0x1a, 0xc7, 0x41, 0x12, 0xa7, 0x00, 0x12, 0xc7, 0x41, 0x12, 0xa7, 0x42, 
+  0x12, 0x87, 0x06, 0x0a, 0x46, 0x02, 0x05, 0x54, 0x0e, 0x84, 0xf3, 0xd7, 0x3c, 0xe7, 0x9e, 0xce, 
+  0xfb, 0x80, 0x0a, 0xc7, 0x1b, 0xd7, 0x5d, 0xe7, 0x9e, 0x95, 0xd5, 0x75, 0x11, 0x12, 0xa7, 0x0a, 
+  0x25, 0x0a, 0x46, 0x12, 0x87, 0x1a, 0xc8, 0x12, 0xc7, 0x41, 0x1a, 0xc7, 0x41, 0x12, 0xc7, 0x41, 
+  0x1a, 0xc7, 0x41, 0x1a, 0xc8, 0x06, 0x1a, 0xc7, 0x1a, 0xc8, 0x12, 0xc8, 0x1a, 0xc8, 0x12, 0xc7, 
+  0x1a, 0xc8, 0x1a, 0xc7, 0x41, 0x12, 0xc7, 0x01, 0x1a, 0xc7, 0x1a, 0xc8, 0x41, 0x12, 0xa7, 0x00, 
+  0x12, 0xc8, 0x42, 0x1a, 0xc7, 0x05, 0x12, 0xa7, 0x1a, 0xc7, 0x12, 0xc7, 0x1a, 0xc7, 0x12, 0xc7, 
+  0x1a, 0xc7, 0x41, 0x12, 0xc7, 0x47, 0x1a, 0xc8, 0x01, 0x12, 0xc7, 0x12, 0xa7, 0x41, 0x12, 0xc7, 
+  0x00, 0x12, 0xa7, 0x41, 0x1a, 0xc8, 0x41, 0x12, 0xc7, 0x47, 0x1a, 0xc8, 0x00, 0x09, 0xe6, 0x41, 
+  0x01, 0xe7, 0x45, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x4c, 0x01, 0xe6, 0x82, 0x00, 0x01, 0xe6, 0x82, 
+  0x06, 0x1a, 0xe8, 0xb6, 0xd9, 0xcf, 0x1c, 0xce, 0xfb, 0xcf, 0x1b, 0xce, 0xfb, 0xcf, 0x1c, 0x41, 
+  0xd7, 0x3c, 0x02, 0x63, 0xce, 0x01, 0x04, 0x01, 0x65, 0x42, 0x0a, 0x07, 0x00, 0x01, 0xe6, 0x80, 
+  0x01, 0x1b, 0x28, 0x01, 0xe5, 0x82, 0x01, 0x01, 0xc5, 0x1b, 0x08, 0x80, 0x00, 0x02, 0x06, 0x81, 
+  0x01, 0x0a, 0x87, 0x12, 0xc7, 0x80, 0x00, 0x12, 0xc8, 0x85, 0x00, 0x01, 0xe6, 0x80, 0x00, 0x0a, 
+  0x47, 0x83, 0x01, 0x1a, 0xe8, 0x01, 0xc5, 0x83, 0x00, 0x01, 0xc6, 0x53, 0x01, 0xe6, 0x0d, 0x01, 
+  0xc6, 0x01, 0x44, 0x11, 0xc6, 0x5b, 0xae, 0x95, 0x75, 0xdf, 0x7d, 0xd7, 0x5c, 0x8c, 0xb2, 0x5a, 
+  0xec, 0x84, 0x31, 0x52, 0xcb, 0x63, 0x2b, 0xd6, 0xb8, 0xc6, 0x16, 0x81, 0x07, 0xc5, 0xf5, 0xce, 
+  0x16, 0xa4, 0xf2, 0x73, 0xae, 0x4a, 0xed, 0x32, 0x8c, 0x43, 0x2f, 0x53, 0xb1, 0x41, 0x4b, 0x70, 
+  0x80, 0x05, 0x5b, 0xd1, 0x53, 0x90, 0x42, 0xce, 0x2a, 0x0b, 0x84, 0x51, 0xc5, 0xf4, 0x80, 0x11, 
+  0xbd, 0xd4, 0xbd, 0xd5, 0xac, 0xd2, 0x7b, 0x4e, 0x52, 0x0b, 0x10, 0x65, 0x21, 0x07, 0x6b, 0x0d, 
+  0x62, 0xcc, 0x39, 0x87, 0x6b, 0x2c, 0xa5, 0x12, 0x9c, 0xb2, 0x7b, 0x6d, 0x51, 0xa7, 0x61, 0xe8, 
+  0x10, 0xc3, 0x01, 0xa5, 0x41, 0x01, 0xc5, 0x01, 0x01, 0xa5, 0x01, 0x85, 0x44, 0x01, 0x84, 0x08, 
+  0x01, 0xc5, 0x02, 0x26, 0x01, 0xc4, 0x01, 0x63, 0x53, 0xad, 0x7c, 0xb2, 0xcf, 0x3c, 0xcf, 0x1b, 
+  0xcf, 0x1c, 0x41, 0xcf, 0x1b, 0x08, 0xdf, 0x7d, 0xdf, 0x5d, 0x8d, 0x54, 0x74, 0xd2, 0x33, 0x2b, 
+  0x0a, 0x26, 0x01, 0xa4, 0x01, 0xa5, 0x01, 0x84, 0x41, 0x01, 0x85, 0x41, 0x01, 0xa5, 0x00, 0x01, 
+  0xc5, 0x44, 0x01, 0xa5, 0x00, 0x01, 0xc5, 0x67, 0x01, 0xa5, 0x45, 0x01, 0xc5, 0x80, 0x4c, 0x01, 
+  0xe6, 0x41, 0x01, 0xe7, 0x82, 0x00, 0x01, 0xe7, 0x84, 0x00, 0x02, 0x05, 0x80, 0x05, 0x09, 0xe7, 
+  0x01, 0xe6, 0x01, 0xe5, 0x23, 0x28, 0xbe, 0xda, 0xd7, 0x7d, 0x43, 0xcf, 0x1c, 0x80, 0x05, 0xd7, 
+  0x5c, 0x7c, 0xb2, 0x09, 0x44, 0x09, 0xa5, 0x01, 0xa5, 0x01, 0xa6, 0x41, 0x01, 0xe6, 0x86, 0x00, 
+  0x1a, 0xe8, 0x83, 0x00, 0x0a, 0x86, 0x82, 0x02, 0x0a, 0x86, 0x1b, 0x28, 0x02, 0x06, 0x84, 0x01, 
+  0x0a, 0x66, 0x02, 0x05, 0x93, 0x00, 0x02, 0x07, 0x86, 0x11, 0x02, 0x07, 0x01, 0xc6, 0x1a, 0x68, 
+  0x8d, 0x54, 0x9d, 0xb6, 0xdf, 0x7d, 0xd7, 0x3c, 0xce, 0xfb, 0xdf, 0x7d, 0x42, 0x49, 0x84, 0x31, 
+  0x4a, 0x8a, 0x6b, 0xaf, 0x5a, 0xec, 0x42, 0x07, 0x83, 0xee, 0xce, 0x15, 0xbd, 0x93, 0x41, 0xbd, 
+  0xb4, 0x06, 0xc5, 0xd5, 0xc5, 0xf5, 0xa5, 0x32, 0x84, 0x71, 0x5b, 0x4e, 0x3a, 0xcd, 0x4b, 0x50, 
+  0x43, 0x53, 0xb1, 0x12, 0x5b, 0xb0, 0x7c, 0x31, 0xad, 0x53, 0xbd, 0xd4, 0xc5, 0xd4, 0xbd, 0x94, 
+  0x9c, 0x50, 0x6a, 0xac, 0x18, 0x64, 0x18, 0xe7, 0x21, 0x69, 0x21, 0x48, 0x18, 0xc5, 0x29, 0x25, 
+  0x18, 0xa3, 0x31, 0x47, 0x8b, 0xcf, 0x6a, 0x6b, 0x69, 0xc9, 0x41, 0x8a, 0x8b, 0x02, 0x19, 0x03, 
+  0x1a, 0xc7, 0x1a, 0xe7, 0x41, 0x1a, 0xc7, 0x01, 0x12, 0xc7, 0x1a, 0xc7, 0x41, 0x1a, 0xc8, 0x03, 
+  0x1a, 0xc7, 0x1a, 0xc8, 0x1a, 0xe8, 0x1b, 0x49, 0x41, 0x23, 0x49, 0x41, 0x12, 0xa7, 0x0f, 0x7d, 
+  0x12, 0xcf, 0x3c, 0xcf, 0x1b, 0xcf, 0x1c, 0xd7, 0x3c, 0xcf, 0x1b, 0xcf, 0x1c, 0xe7, 0x9e, 0xdf, 
+  0x9d, 0xbe, 0xda, 0x85, 0x73, 0x22, 0xe8, 0x02, 0x05, 0x12, 0x87, 0x12, 0xc8, 0x1a, 0xc8, 0x46, 
+  0x1a, 0xe8, 0x00, 0x1b, 0x08, 0x45, 0x1a, 0xe8, 0x42, 0x1a, 0xc8, 0x01, 0x1a, 0xe8, 0x1a, 0xe7, 
+  0x47, 0x1a, 0xe8, 0x00, 0x1a, 0xe7, 0x47, 0x1a, 0xe8, 0x02, 0x1a, 0xc8, 0x12, 0xc8, 0x1a, 0xc8, 
+  0x48, 0x1a, 0xe8, 0x00, 0x1a, 0xc8, 0x44, 0x1a, 0xe8, 0x00, 0x22, 0xe8, 0x4c, 0x01, 0xe6, 0x43, 
+  0x01, 0xe7, 0x43, 0x01, 0xe6, 0x01, 0x09, 0xe7, 0x01, 0xc6, 0x81, 0x00, 0x02, 0x06, 0x81, 0x06, 
+  0x09, 0xe6, 0x02, 0x06, 0x23, 0x49, 0x3b, 0x8c, 0x5b, 0xcf, 0xc6, 0xfb, 0xcf, 0x1b, 0x42, 0xcf, 
+  0x1c, 0x07, 0xd7, 0x3c, 0xdf, 0x7d, 0x95, 0x34, 0x09, 0x85, 0x01, 0x44, 0x01, 0x64, 0x01, 0xa5, 
+  0x01, 0xc6, 0x81, 0x00, 0x02, 0x06, 0x80, 0x00, 0x12, 0xe8, 0x85, 0x01, 0x01, 0xe6, 0x0a, 0x87, 
+  0x85, 0x00, 0x0a, 0x47, 0x80, 0x41, 0x01, 0xe6, 0x8b, 0x00, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x81, 
+  0x41, 0x01, 0xe7, 0x82, 0x00, 0x01, 0xe7, 0x87, 0x04, 0x01, 0xa6, 0x01, 0x44, 0x84, 0xf2, 0xef, 
+  0xdf, 0xd7, 0x5d, 0x41, 0xce, 0xfb, 0x0d, 0xdf, 0x9e, 0x73, 0xef, 0x73, 0xaf, 0x73, 0xb1, 0xa5, 
+  0x76, 0xd7, 0x3d, 0xb6, 0x39, 0x84, 0xb3, 0x5b, 0x2c, 0x39, 0xc6, 0x94, 0x90, 0xc6, 0x16, 0xbd, 
+  0xd5, 0xc5, 0xf5, 0x41, 0xbd, 0xd4, 0x11, 0xc6, 0x15, 0xad, 0x53, 0x84, 0x71, 0x42, 0xad, 0x3a, 
+  0xae, 0x42, 0xce, 0x4b, 0x2f, 0x6b, 0xf0, 0xad, 0x94, 0xbd, 0xf5, 0xbd, 0xd5, 0xbd, 0xb5, 0xac, 
+  0xd2, 0x8b, 0xef, 0x41, 0x89, 0x18, 0xa6, 0x21, 0x48, 0x29, 0xeb, 0x41, 0x32, 0x0b, 0x06, 0x21, 
+  0x89, 0x21, 0x48, 0x19, 0x06, 0x10, 0x64, 0x49, 0xa8, 0x7a, 0x4b, 0x8a, 0x6b, 0x41, 0x8a, 0x6a, 
+  0x04, 0x18, 0xc2, 0x0a, 0x05, 0x0a, 0x45, 0x0a, 0x25, 0x0a, 0x05, 0x41, 0x0a, 0x26, 0x00, 0x0a, 
+  0x46, 0x42, 0x0a, 0x26, 0x07, 0x0a, 0x46, 0x0a, 0x87, 0x0a, 0xa7, 0x12, 0xa8, 0x0a, 0x26, 0x1a, 
+  0x88, 0xae, 0x58, 0xd7, 0x3c, 0x42, 0xcf, 0x1c, 0x41, 0xd7, 0x5d, 0x08, 0xcf, 0x1b, 0xce, 0xfb, 
+  0xd7, 0x3c, 0xd7, 0x5c, 0xae, 0x58, 0xa6, 0x37, 0x3b, 0x6b, 0x09, 0xe5, 0x0a, 0x26, 0x4d, 0x0a, 
+  0x46, 0x41, 0x0a, 0x26, 0x5f, 0x0a, 0x46, 0x03, 0x0a, 0x26, 0x0a, 0x46, 0x0a, 0x47, 0x0a, 0x46, 
+  0x42, 0x0a, 0x47, 0x4e, 0x01, 0xe6, 0x80, 0x01, 0x01, 0xe6, 0x09, 0xe7, 0x83, 0x00, 0x01, 0xe6, 
+  0x80, 0x02, 0x1b, 0x08, 0x01, 0xe5, 0x01, 0xc6, 0x80, 0x06, 0x01, 0xe6, 0x02, 0x26, 0x1b, 0x28, 
+  0x02, 0x05, 0x01, 0xa6, 0x1a, 0x07, 0x53, 0xae, 0x41, 0xc6, 0xfb, 0x41, 0xd7, 0x5d, 0x06, 0xdf, 
+  0x5d, 0xce, 0xfb, 0x11, 0xc6, 0x09, 0xc4, 0x1a, 0xc7, 0x12, 0x66, 0x01, 0xc5, 0x84, 0x00, 0x01, 
+  0xe6, 0x80, 0x00, 0x1b, 0x08, 0x8f, 0x01, 0x0a, 0x67, 0x02, 0x06, 0x89, 0x00, 0x01, 0xe6, 0x82, 
+  0x41, 0x02, 0x07, 0x41, 0x02, 0x06, 0x42, 0x02, 0x07, 0x00, 0x01, 0xe7, 0x84, 0x15, 0x01, 0x65, 
+  0x6c, 0x71, 0xb6, 0x59, 0xce, 0xfb, 0xd7, 0x1c, 0xce, 0xfb, 0xd7, 0x5c, 0xdf, 0x7d, 0x73, 0xef, 
+  0x4a, 0x8b, 0x6b, 0x70, 0x95, 0x36, 0xc7, 0x1d, 0xbe, 0xbc, 0xb6, 0x9b, 0xb6, 0xdc, 0x7c, 0xf5, 
+  0x4b, 0x2e, 0x3a, 0x4a, 0x31, 0xe7, 0x9c, 0xf2, 0xb5, 0x94, 0x81, 0x00, 0xb5, 0xb3, 0x41, 0xbd, 
+  0xd4, 0x00, 0xa5, 0x53, 0x41, 0x73, 0xcf, 0x01, 0xad, 0x53, 0xb5, 0x73, 0x41, 0xbd, 0xd4, 0x07, 
+  0xb5, 0x73, 0x8b, 0xae, 0x49, 0xc8, 0x28, 0xe6, 0x00, 0x24, 0x10, 0xe7, 0x3a, 0x4c, 0x32, 0x0b, 
+  0x41, 0x29, 0xeb, 0x0a, 0x32, 0x0b, 0x2a, 0x0b, 0x29, 0x89, 0x08, 0x23, 0x41, 0x06, 0x8a, 0x6b, 
+  0x82, 0x4a, 0x8a, 0x4a, 0x92, 0x8b, 0x20, 0xe3, 0x01, 0xc4, 0x41, 0x01, 0xc5, 0x42, 0x01, 0xe5, 
+  0x42, 0x02, 0x05, 0x00, 0x01, 0xe5, 0x42, 0x01, 0xc5, 0x03, 0x01, 0xe5, 0x1a, 0x68, 0x7c, 0xb2, 
+  0xdf, 0x7d, 0x81, 0x05, 0xcf, 0x3c, 0xd7, 0x5d, 0xb6, 0x79, 0xae, 0x78, 0xd7, 0x3c, 0xdf, 0x5d, 
+  0x80, 0x0b, 0xcf, 0x1c, 0xd7, 0x3c, 0xdf, 0x7d, 0xbe, 0x9a, 0x9d, 0x96, 0x1a, 0x47, 0x09, 0xe5, 
+  0x01, 0xa4, 0x01, 0xc4, 0x02, 0x05, 0x02, 0x25, 0x02, 0x05, 0x4f, 0x01, 0xe5, 0x00, 0x02, 0x05, 
+  0x41, 0x01, 0xe5, 0x01, 0x01, 0xe6, 0x02, 0x06, 0x41, 0x01, 0xe6, 0x42, 0x02, 0x06, 0x00, 0x01, 
+  0xe6, 0x42, 0x01, 0xe5, 0x4b, 0x02, 0x06, 0x00, 0x01, 0xe6, 0x42, 0x02, 0x06, 0x02, 0x0a, 0x06, 
+  0x0a, 0x26, 0x0a, 0x06, 0x81, 0x00, 0x01, 0xe7, 0x8a, 0x00, 0x01, 0xe7, 0x43, 0x01, 0xe6, 0x00, 
+  0x09, 0xe7, 0x41, 0x01, 0xe6, 0x02, 0x01, 0xc6, 0x0a, 0x46, 0x1a, 0xe8, 0x41, 0x01, 0xe6, 0x13, 
+  0x0a, 0x07, 0x02, 0x06, 0x02, 0x25, 0x23, 0x48, 0x12, 0x67, 0x01, 0xc6, 0x01, 0x85, 0x09, 0xc6, 
+  0x11, 0xc6, 0x7d, 0x13, 0xc6, 0xfa, 0xb6, 0x99, 0x9d, 0xd6, 0x2a, 0xc9, 0x1a, 0xa7, 0x1a, 0xe7, 
+  0x1a, 0xa6, 0x1b, 0x27, 0x12, 0x66, 0x01, 0xe6, 0x80, 0x00, 0x02, 0x05, 0x80, 0x01, 0x13, 0x08, 
+  0x01, 0xc6, 0x84, 0x00, 0x01, 0xe5, 0x83, 0x00, 0x0a, 0x87, 0x86, 0x00, 0x0a, 0x66, 0x8b, 0x01, 
+  0x01, 0xe6, 0x01, 0xe7, 0x80, 0x43, 0x02, 0x06, 0x81, 0x00, 0x01, 0xe7, 0x43, 0x01, 0xe6, 0x1a, 
+  0x09, 0xe6, 0x01, 0x85, 0x6c, 0x50, 0xd7, 0x5d, 0xd7, 0x5c, 0xcf, 0x1c, 0xcf, 0x1b, 0xdf, 0x5d, 
+  0xd7, 0x1c, 0x74, 0x10, 0x42, 0x28, 0x73, 0xd1, 0x63, 0x90, 0xbe, 0xbb, 0xbe, 0xdc, 0xae, 0x3a, 
+  0x8d, 0x57, 0x4b, 0x50, 0x4b, 0x70, 0x42, 0xef, 0x3a, 0xae, 0x32, 0x4c, 0x21, 0x25, 0x39, 0xe7, 
+  0x73, 0x8c, 0xa5, 0x12, 0xc6, 0x35, 0x80, 0x01, 0xbd, 0xb4, 0xbd, 0xd4, 0x41, 0xb5, 0x93, 0x10, 
+  0xbd, 0xd4, 0xbd, 0xf4, 0xbd, 0xb4, 0xbd, 0x94, 0x73, 0x0c, 0x28, 0xe4, 0x10, 0x84, 0x20, 0xe6, 
+  0x41, 0xa9, 0x10, 0xc6, 0x32, 0x2c, 0x2a, 0x0b, 0x32, 0x0c, 0x32, 0x2c, 0x29, 0xca, 0x10, 0xa4, 
+  0x31, 0x05, 0x41, 0x7a, 0x4a, 0x42, 0x82, 0x4a, 0x02, 0x8a, 0x6a, 0x20, 0xc2, 0x22, 0xc7, 0x41, 
+  0x22, 0xe8, 0x02, 0x1b, 0x08, 0x23, 0x28, 0x23, 0x29, 0x42, 0x23, 0x49, 0x1d, 0x1b, 0x29, 0x1a, 
+  0xe8, 0x1a, 0xa7, 0x22, 0xe9, 0x43, 0x8b, 0xbe, 0xda, 0xdf, 0x7d, 0xcf, 0x3c, 0xcf, 0x1c, 0xd7, 
+  0x7d, 0xc6, 0xfb, 0xb6, 0x78, 0x33, 0x6b, 0x1a, 0xc8, 0xae, 0x38, 0xbe, 0x79, 0xbe, 0xba, 0xd7, 
+  0x7d, 0xcf, 0x3c, 0xce, 0xfb, 0xd7, 0x5d, 0xdf, 0x5d, 0xcf, 0x1c, 0x9d, 0xf6, 0x3b, 0xab, 0x44, 
+  0x0c, 0x2b, 0x69, 0x12, 0xc7, 0x1b, 0x28, 0x23, 0x28, 0x43, 0x1b, 0x08, 0x45, 0x23, 0x28, 0x43, 
+  0x1b, 0x28, 0x42, 0x1b, 0x08, 0x42, 0x1b, 0x28, 0x00, 0x1b, 0x08, 0x44, 0x23, 0x28, 0x43, 0x23, 
+  0x29, 0x41, 0x23, 0x28, 0x00, 0x1b, 0x28, 0x41, 0x23, 0x28, 0x47, 0x23, 0x29, 0x00, 0x23, 0x09, 
+  0x43, 0x23, 0x29, 0x87, 0x00, 0x01, 0xc6, 0x47, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x43, 0x01, 0xe6, 
+  0x02, 0x0a, 0x46, 0x1b, 0x08, 0x0a, 0x26, 0x80, 0x01, 0x09, 0xc6, 0x09, 0xe7, 0x80, 0x02, 0x0a, 
+  0x86, 0x1b, 0x28, 0x0a, 0x26, 0x80, 0x04, 0x09, 0xe6, 0x01, 0xc6, 0x02, 0x05, 0x2b, 0x49, 0x1a, 
+  0x88, 0x41, 0x09, 0xe6, 0x03, 0x01, 0xe5, 0x23, 0x68, 0x1b, 0x07, 0x0a, 0x25, 0x80, 0x02, 0x12, 
+  0x87, 0x01, 0xc5, 0x1b, 0x08, 0x80, 0x01, 0x0a, 0x66, 0x12, 0xe8, 0x41, 0x01, 0xc6, 0x8b, 0x00, 
+  0x0a, 0x46, 0x84, 0x00, 0x02, 0x26, 0x8c, 0x00, 0x02, 0x06, 0x43, 0x02, 0x07, 0x00, 0x01, 0xe7, 
+  0x43, 0x01, 0xe6, 0x00, 0x09, 0xe7, 0x80, 0x12, 0x01, 0xa5, 0x74, 0x71, 0xd7, 0x7d, 0xcf, 0x1b, 
+  0xc6, 0xfb, 0xd7, 0x5c, 0xdf, 0x7d, 0xbe, 0x79, 0x32, 0x8a, 0x01, 0x04, 0x5b, 0x0c, 0x7c, 0x33, 
+  0xa5, 0xd9, 0xa6, 0x19, 0x85, 0x16, 0x3a, 0xce, 0x32, 0x8d, 0x3a, 0xad, 0x32, 0x8d, 0x41, 0x3a, 
+  0xae, 0x08, 0x3a, 0xce, 0x3a, 0xad, 0x32, 0x4c, 0x10, 0xc4, 0x3a, 0x08, 0x94, 0x90, 0xad, 0x53, 
+  0xce, 0x56, 0xc6, 0x36, 0x41, 0xbd, 0xd4, 0x18, 0xb5, 0x53, 0xa4, 0xf1, 0x7b, 0x6d, 0x49, 0xa7, 
+  0x29, 0x05, 0x29, 0x88, 0x32, 0x0b, 0x29, 0x48, 0x49, 0xa9, 0x10, 0xa5, 0x32, 0x0b, 0x32, 0x2c, 
+  0x29, 0xcb, 0x21, 0x69, 0x31, 0x68, 0x6a, 0x09, 0x7a, 0x29, 0x7a, 0x2a, 0x82, 0x2a, 0x7a, 0x2a, 
+  0x82, 0x2a, 0x8a, 0x4a, 0x7a, 0x29, 0x20, 0xc3, 0x00, 0xe2, 0x41, 0x01, 0xc5, 0x00, 0x01, 0xe5, 
+  0x42, 0x01, 0xc5, 0x07, 0x01, 0xe5, 0x02, 0x06, 0x02, 0x26, 0x01, 0xc5, 0x09, 0x84, 0x85, 0x33, 
+  0xcf, 0x5c, 0xcf, 0x1b, 0x41, 0xcf, 0x1c, 0x03, 0xdf, 0x9d, 0xcf, 0x1c, 0x53, 0xae, 0x01, 0xa5, 
+  0x41, 0x02, 0x06, 0x05, 0x0a, 0x06, 0x01, 0xa5, 0x32, 0xaa, 0xa5, 0xd7, 0xbe, 0x9a, 0xdf, 0x7d, 
+  0x41, 0xcf, 0x1c, 0x41, 0xd7, 0x3c, 0x07, 0xcf, 0x1c, 0xd7, 0x5c, 0x7c, 0xf2, 0x3b, 0x0a, 0x01, 
+  0xc5, 0x01, 0x43, 0x01, 0x63, 0x01, 0xa5, 0x41, 0x01, 0xa4, 0x41, 0x01, 0xc5, 0x46, 0x01, 0xe5, 
+  0x00, 0x01, 0xc5, 0x44, 0x01, 0xe5, 0x41, 0x01, 0xc5, 0x4c, 0x01, 0xe5, 0x42, 0x01, 0xe6, 0x44, 
+  0x01, 0xe5, 0x42, 0x01, 0xe6, 0x41, 0x02, 0x06, 0x00, 0x01, 0xe6, 0x44, 0x01, 0xe6, 0x00, 0x09, 
+  0xe6, 0x80, 0x00, 0x01, 0xc6, 0x4a, 0x01, 0xe6, 0x1b, 0x09, 0xe6, 0x01, 0xc6, 0x0a, 0x46, 0x1a, 
+  0xe8, 0x0a, 0x26, 0x01, 0xe6, 0x09, 0xc6, 0x09, 0xe6, 0x01, 0xe6, 0x0a, 0x66, 0x1b, 0x08, 0x0a, 
+  0x46, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xe6, 0x0a, 0x26, 0x1a, 0xe8, 0x0a, 0x47, 0x01, 0xc6, 0x01, 
+  0xe6, 0x01, 0xc6, 0x0a, 0x06, 0x1a, 0xe8, 0x1b, 0x27, 0x23, 0x88, 0x23, 0x48, 0x0a, 0x26, 0x01, 
+  0xe5, 0x82, 0x00, 0x12, 0xe7, 0x41, 0x01, 0xc5, 0x00, 0x12, 0xe8, 0x86, 0x00, 0x12, 0xe8, 0x80, 
+  0x00, 0x1b, 0x08, 0x86, 0x00, 0x02, 0x06, 0x81, 0x00, 0x12, 0x87, 0x82, 0x00, 0x0a, 0x67, 0x84, 
+  0x42, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x43, 0x01, 0xe6, 0x02, 0x01, 0xc6, 0x09, 0xc6, 0x09, 0xe7, 
+  0x41, 0x01, 0x64, 0x06, 0x6c, 0x71, 0xdf, 0x7d, 0xcf, 0x1b, 0xc6, 0xfb, 0xdf, 0x7d, 0xae, 0x18, 
+  0x84, 0xf3, 0x41, 0x19, 0xc6, 0x07, 0x6b, 0xef, 0x73, 0x90, 0x6b, 0xb1, 0x95, 0x77, 0x42, 0xee, 
+  0x2a, 0x2c, 0x32, 0x8d, 0x3a, 0x8e, 0x44, 0x3a, 0xae, 0x80, 0x0f, 0x3a, 0x8d, 0x3a, 0xce, 0x2a, 
+  0x0a, 0x10, 0xc4, 0x52, 0xcb, 0x8c, 0x4f, 0x84, 0x0e, 0xb5, 0x94, 0xb5, 0x53, 0x73, 0x2c, 0x28, 
+  0xe4, 0x18, 0xa4, 0x08, 0x83, 0x29, 0xc9, 0x3a, 0x2c, 0x29, 0xeb, 0x82, 0x07, 0x32, 0x2c, 0x21, 
+  0x89, 0x21, 0x07, 0x39, 0x07, 0x72, 0x4a, 0x7a, 0x4a, 0x7a, 0x09, 0x7a, 0x29, 0x41, 0x82, 0x2a, 
+  0x06, 0x82, 0x4a, 0x69, 0xc8, 0x8b, 0x4e, 0x8c, 0x10, 0x08, 0xe2, 0x1a, 0xa7, 0x13, 0x08, 0x41, 
+  0x12, 0xe8, 0x00, 0x12, 0xc7, 0x42, 0x12, 0xa7, 0x05, 0x02, 0x45, 0x12, 0x46, 0x84, 0xf3, 0xd7, 
+  0x5c, 0xcf, 0x1b, 0xc6, 0xfb, 0x41, 0xcf, 0x3c, 0x03, 0xa6, 0x37, 0x5c, 0x6f, 0x0a, 0x66, 0x12, 
+  0xc7, 0x41, 0x12, 0xa7, 0x05, 0x0a, 0x87, 0x0a, 0x66, 0x0a, 0x26, 0x01, 0xc4, 0x53, 0xee, 0x9d, 
+  0xf6, 0x80, 0x02, 0xe7, 0x9e, 0xcf, 0x1b, 0xcf, 0x1c, 0x41, 0xd7, 0x3c, 0x41, 0xdf, 0x7d, 0x05, 
+  0x6c, 0x30, 0x4b, 0x2c, 0x3a, 0xeb, 0x01, 0xa4, 0x0a, 0x26, 0x12, 0x87, 0x45, 0x12, 0xa7, 0x50, 
+  0x12, 0x87, 0x43, 0x12, 0xa7, 0x43, 0x12, 0x87, 0x00, 0x12, 0xa7, 0x46, 0x12, 0x87, 0x41, 0x12, 
+  0xa7, 0x41, 0x12, 0xa8, 0x00, 0x1a, 0xa8, 0x45, 0x01, 0xe6, 0x02, 0x01, 0xc6, 0x01, 0xe6, 0x01, 
+  0xe7, 0x80, 0x00, 0x01, 0xe7, 0x82, 0x00, 0x01, 0xe7, 0x44, 0x01, 0xe6, 0x1b, 0x0a, 0x46, 0x12, 
+  0xc8, 0x02, 0x06, 0x01, 0xc6, 0x09, 0xc6, 0x09, 0xe6, 0x01, 0xe6, 0x0a, 0x46, 0x1a, 0xe8, 0x0a, 
+  0x26, 0x01, 0xc6, 0x0a, 0x07, 0x01, 0xe6, 0x0a, 0x26, 0x1b, 0x08, 0x12, 0x67, 0x01, 0xe6, 0x0a, 
+  0x06, 0x09, 0xe6, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0xa5, 0x0a, 0x66, 0x23, 0x48, 0x0a, 0x26, 0x01, 
+  0xc6, 0x01, 0xe6, 0x1b, 0x28, 0x80, 0x00, 0x0a, 0x46, 0x80, 0x00, 0x01, 0xc6, 0x84, 0x00, 0x01, 
+  0xe6, 0x82, 0x00, 0x12, 0xc8, 0x80, 0x00, 0x1b, 0x28, 0x80, 0x00, 0x0a, 0x66, 0x83, 0x00, 0x0a, 
+  0x67, 0x80, 0x00, 0x23, 0x28, 0x80, 0x00, 0x12, 0xa7, 0x80, 0x00, 0x01, 0xa5, 0x80, 0x00, 0x0a, 
+  0x46, 0x84, 0x41, 0x02, 0x07, 0x02, 0x02, 0x06, 0x01, 0xe6, 0x01, 0xe7, 0x80, 0x00, 0x01, 0xe7, 
+  0x80, 0x04, 0x09, 0xe6, 0x01, 0x65, 0x01, 0x24, 0x43, 0x2c, 0x6c, 0x30, 0x41, 0xd7, 0x3c, 0x80, 
+  0x09, 0xdf, 0x9d, 0xa5, 0xd6, 0x22, 0x28, 0x01, 0x24, 0x09, 0x44, 0x19, 0x24, 0x31, 0xc8, 0x3a, 
+  0x6c, 0x53, 0x50, 0x2a, 0x2c, 0x41, 0x3a, 0x8d, 0x41, 0x32, 0x8d, 0x00, 0x3a, 0xad, 0x82, 0x00, 
+  0x3a, 0xad, 0x41, 0x3a, 0x8d, 0x0d, 0x3a, 0xad, 0x3a, 0xae, 0x42, 0xef, 0x32, 0x2b, 0x19, 0x26, 
+  0x19, 0x46, 0xa5, 0x12, 0x7b, 0x4d, 0x31, 0x26, 0x10, 0xc4, 0x21, 0x47, 0x32, 0x0b, 0x29, 0xeb, 
+  0x32, 0x0b, 0x81, 0x05, 0x49, 0xc8, 0x10, 0x85, 0x19, 0x47, 0x20, 0xc4, 0x61, 0xc8, 0x82, 0x6b, 
+  0x41, 0x7a, 0x4a, 0x00, 0x82, 0x6a, 0x42, 0x82, 0x6b, 0x05, 0x59, 0xa8, 0x31, 0x26, 0x62, 0xed, 
+  0x6b, 0x4e, 0x08, 0xc2, 0x22, 0xe8, 0x41, 0x1b, 0x49, 0x41, 0x1b, 0x69, 0x06, 0x1b, 0x49, 0x12, 
+  0xc7, 0x1a, 0xc8, 0x5c, 0x8f, 0x9d, 0xd6, 0xdf, 0x7d, 0xcf, 0x1c, 0x80, 0x00, 0xd7, 0x7d, 0x80, 
+  0x03, 0x5c, 0x2f, 0x0a, 0x86, 0x12, 0xe7, 0x1b, 0x29, 0x42, 0x1b, 0x08, 0x00, 0x1a, 0xc8, 0x41, 
+  0x12, 0xa7, 0x06, 0x1a, 0xa8, 0x12, 0xa7, 0x02, 0x66, 0x64, 0x50, 0x8d, 0x34, 0xdf, 0x5d, 0xe7, 
+  0xbe, 0x80, 0x41, 0xd7, 0x1c, 0x09, 0xd7, 0x3c, 0xdf, 0x7d, 0xe7, 0xbe, 0xc6, 0xfb, 0x43, 0xcc, 
+  0x22, 0xa8, 0x0a, 0x45, 0x1a, 0xe8, 0x23, 0x28, 0x1a, 0xe8, 0x44, 0x1a, 0xc7, 0x04, 0x12, 0xc7, 
+  0x1a, 0xc7, 0x12, 0xc7, 0x12, 0xc8, 0x12, 0xe8, 0x41, 0x1a, 0xc8, 0x00, 0x12, 0xc8, 0x45, 0x1a, 
+  0xc8, 0x42, 0x12, 0xc8, 0x52, 0x1a, 0xc8, 0x4d, 0x01, 0xe6, 0x83, 0x12, 0x01, 0xc6, 0x0a, 0x67, 
+  0x1a, 0xe8, 0x02, 0x06, 0x01, 0xe6, 0x09, 0xc6, 0x09, 0xe7, 0x01, 0xe6, 0x0a, 0x46, 0x1a, 0xe8, 
+  0x0a, 0x26, 0x01, 0xa6, 0x09, 0xc6, 0x01, 0xe6, 0x02, 0x26, 0x1a, 0xe8, 0x12, 0x87, 0x01, 0xe6, 
+  0x09, 0xe6, 0x42, 0x01, 0xe6, 0x81, 0x02, 0x12, 0x87, 0x12, 0xe7, 0x01, 0xc5, 0x41, 0x01, 0xe6, 
+  0x80, 0x00, 0x02, 0x06, 0x83, 0x02, 0x1a, 0xe8, 0x0a, 0x47, 0x01, 0xe6, 0x80, 0x00, 0x01, 0xe5, 
+  0x8b, 0x00, 0x0a, 0x66, 0x80, 0x00, 0x23, 0x29, 0x80, 0x00, 0x12, 0x87, 0x88, 0x41, 0x01, 0xe6, 
+  0x00, 0x01, 0xe7, 0x81, 0x41, 0x01, 0xe7, 0x12, 0x0a, 0x07, 0x01, 0x85, 0x53, 0x8e, 0x7c, 0xf3, 
+  0xc6, 0xfb, 0xd7, 0x7d, 0xcf, 0x1b, 0xc6, 0xfb, 0xdf, 0x7d, 0xad, 0xf7, 0x1a, 0x28, 0x09, 0x85, 
+  0x00, 0xa2, 0x00, 0x41, 0x63, 0x2c, 0x42, 0x28, 0x10, 0xc5, 0x32, 0x4d, 0x3a, 0xce, 0x81, 0x00, 
+  0x3a, 0xae, 0x42, 0x3a, 0xad, 0x01, 0x3a, 0x8d, 0x3a, 0x8e, 0x42, 0x3a, 0x8d, 0x41, 0x3a, 0xae, 
+  0x00, 0x3a, 0x8d, 0x41, 0x3a, 0xae, 0x06, 0x42, 0xee, 0xb5, 0x95, 0x62, 0x8a, 0x18, 0xc5, 0x3a, 
+  0x2c, 0x29, 0xeb, 0x29, 0xea, 0x41, 0x29, 0xeb, 0x23, 0x29, 0xca, 0x29, 0x27, 0x41, 0x87, 0x18, 
+  0x83, 0x49, 0x67, 0x69, 0xe9, 0x82, 0x4a, 0x7a, 0x09, 0x82, 0x4a, 0x72, 0x2a, 0x41, 0x26, 0x39, 
+  0x05, 0x59, 0xe9, 0x82, 0xcd, 0x28, 0xc5, 0x39, 0xc9, 0x39, 0xca, 0x39, 0xc9, 0x00, 0x41, 0x01, 
+  0x24, 0x01, 0x64, 0x01, 0x84, 0x01, 0xe5, 0x02, 0x47, 0x02, 0x06, 0x11, 0xe6, 0x85, 0x13, 0xd7, 
+  0x5d, 0xd7, 0x3c, 0xcf, 0x1c, 0xd7, 0x3c, 0xd7, 0x5c, 0x6c, 0x70, 0x43, 0x6c, 0x01, 0x63, 0x01, 
+  0xa5, 0x45, 0x01, 0xc5, 0x41, 0x01, 0xa5, 0x00, 0x01, 0xc5, 0x41, 0x01, 0xe6, 0x06, 0x01, 0x84, 
+  0x01, 0xa5, 0x53, 0xce, 0x7c, 0xd2, 0xdf, 0x7d, 0xdf, 0x5d, 0xd7, 0x3c, 0x42, 0xcf, 0x1c, 0x08, 
+  0xce, 0xfb, 0xd7, 0x3c, 0xa5, 0xf7, 0x7c, 0xb2, 0x1a, 0x88, 0x01, 0x84, 0x01, 0xe5, 0x01, 0xa5, 
+  0x01, 0x84, 0x41, 0x01, 0x85, 0x5e, 0x01, 0xa5, 0x43, 0x01, 0xc5, 0x41, 0x01, 0xa5, 0x41, 0x01, 
+  0xc6, 0x84, 0x43, 0x01, 0xc6, 0x46, 0x01, 0xe6, 0x03, 0x0a, 0x47, 0x1b, 0x28, 0x0a, 0x26, 0x01, 
+  0xc6, 0x41, 0x09, 0xe6, 0x0c, 0x01, 0xe6, 0x0a, 0x46, 0x1b, 0x08, 0x0a, 0x26, 0x01, 0xa6, 0x09, 
+  0xc6, 0x01, 0xc6, 0x02, 0x26, 0x1b, 0x08, 0x12, 0x87, 0x01, 0xe5, 0x0a, 0x06, 0x01, 0xe6, 0x42, 
+  0x01, 0xc6, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x80, 0x00, 0x1b, 0x08, 0x85, 0x00, 0x13, 0x08, 0x41, 
+  0x01, 0xc5, 0x80, 0x00, 0x0a, 0x67, 0x82, 0x00, 0x0a, 0x67, 0x82, 0x00, 0x0a, 0x86, 0x88, 0x00, 
+  0x23, 0x28, 0x8c, 0x43, 0x01, 0xe6, 0x06, 0x0a, 0x07, 0x01, 0xa5, 0x53, 0x8d, 0xcf, 0x1c, 0xdf, 
+  0x9d, 0xce, 0xfc, 0xce, 0xfb, 0x80, 0x0d, 0xdf, 0x9e, 0x9d, 0xb6, 0x19, 0xa6, 0x00, 0xe3, 0x11, 
+  0x04, 0x6b, 0x6d, 0x84, 0x0f, 0xc6, 0x16, 0xbd, 0xb4, 0x39, 0xc7, 0x00, 0x22, 0x10, 0xe6, 0x3a, 
+  0x8e, 0x3a, 0xcf, 0x41, 0x3a, 0xae, 0x80, 0x00, 0x3a, 0xae, 0x41, 0x3a, 0x8e, 0x41, 0x3a, 0xad, 
+  0x00, 0x3a, 0x8e, 0x80, 0x00, 0x3a, 0x8e, 0x41, 0x3a, 0x8d, 0x05, 0x2a, 0x4d, 0x6b, 0xcf, 0xa4, 
+  0xd2, 0x62, 0x6a, 0x10, 0xa5, 0x32, 0x0b, 0x43, 0x29, 0xeb, 0x05, 0x21, 0xa9, 0x20, 0xe6, 0x61, 
+  0xe9, 0x61, 0xc8, 0x82, 0x6b, 0x7a, 0x2a, 0x41, 0x7a, 0x29, 0x01, 0x7a, 0x6b, 0x30, 0xc4, 0x41, 
+  0x00, 0x00, 0x0f, 0x18, 0x63, 0x62, 0x4b, 0x41, 0x88, 0x42, 0x2a, 0x5a, 0xed, 0x21, 0x25, 0x11, 
+  0xa5, 0x12, 0x26, 0x12, 0x67, 0x1a, 0xa7, 0x1a, 0xe8, 0x12, 0xc7, 0x1a, 0xa8, 0x9d, 0x96, 0xd7, 
+  0x7d, 0xc6, 0xfb, 0x41, 0xcf, 0x1c, 0x03, 0xdf, 0x7d, 0x7d, 0x32, 0x12, 0x86, 0x0a, 0x86, 0x4b, 
+  0x1a, 0xe8, 0x08, 0x1a, 0xc8, 0x1a, 0xe8, 0x1b, 0x08, 0x0a, 0xa6, 0x22, 0xe8, 0x5c, 0x6f, 0x4b, 
+  0xed, 0x9d, 0xb6, 0xdf, 0x7e, 0x81, 0x0a, 0xcf, 0x1b, 0xcf, 0x1c, 0xd7, 0x5d, 0xe7, 0xbf, 0xae, 
+  0x17, 0x8d, 0x54, 0x2a, 0xe9, 0x0a, 0x25, 0x1a, 0xa7, 0x1a, 0xc7, 0x1a, 0xc8, 0x42, 0x1a, 0xe8, 
+  0x00, 0x1b, 0x08, 0x41, 0x1a, 0xe8, 0x44, 0x1a, 0xc8, 0x00, 0x1a, 0xe8, 0x42, 0x1a, 0xc8, 0x46, 
+  0x1a, 0xe8, 0x00, 0x1a, 0xc8, 0x41, 0x1a, 0xe8, 0x42, 0x1a, 0xc8, 0x41, 0x1a, 0xe8, 0x00, 0x1a, 
+  0xc8, 0x42, 0x1a, 0xe8, 0x00, 0x22, 0xe9, 0x41, 0x22, 0xe8, 0x4c, 0x01, 0xe6, 0x00, 0x02, 0x06, 
+  0x82, 0x03, 0x0a, 0x46, 0x1a, 0xc8, 0x0a, 0x26, 0x01, 0xc6, 0x41, 0x09, 0xe6, 0x0d, 0x01, 0xe6, 
+  0x0a, 0x46, 0x1a, 0xe8, 0x0a, 0x46, 0x01, 0xa6, 0x09, 0xc6, 0x01, 0xc6, 0x02, 0x05, 0x12, 0xe8, 
+  0x12, 0x87, 0x01, 0xe6, 0x02, 0x06, 0x01, 0xe6, 0x01, 0xe7, 0x43, 0x01, 0xe6, 0x81, 0x01, 0x1b, 
+  0x07, 0x01, 0xe5, 0x84, 0x00, 0x12, 0xe8, 0x80, 0x01, 0x01, 0xa5, 0x1a, 0xe7, 0x83, 0x00, 0x12, 
+  0x67, 0x81, 0x00, 0x12, 0xe8, 0x89, 0x00, 0x23, 0x29, 0x83, 0x00, 0x1b, 0x08, 0x89, 0x18, 0x01, 
+  0xc6, 0x01, 0xa6, 0x01, 0x65, 0x4b, 0x4d, 0xd7, 0x1c, 0xd7, 0x3d, 0xce, 0xfb, 0xd7, 0x3c, 0xdf, 
+  0x7d, 0xae, 0x38, 0x43, 0x6d, 0x22, 0x28, 0x00, 0x20, 0x42, 0x49, 0x94, 0xb1, 0xc5, 0xf5, 0xc6, 
+  0x15, 0xb5, 0x93, 0xbd, 0xb3, 0xa5, 0x12, 0x8c, 0x50, 0x73, 0x6e, 0x21, 0x47, 0x11, 0x07, 0x3a, 
+  0x8d, 0x42, 0x3a, 0xae, 0x43, 0x3a, 0x8d, 0x82, 0x06, 0x32, 0x8d, 0x3a, 0xae, 0x2a, 0x0b, 0x8c, 
+  0x50, 0x83, 0x2d, 0x29, 0x05, 0x29, 0xa9, 0x42, 0x32, 0x0b, 0x06, 0x29, 0xea, 0x29, 0xca, 0x08, 
+  0x84, 0x20, 0xc4, 0x7a, 0x4b, 0x82, 0x2a, 0x7a, 0x09, 0x41, 0x7a, 0x29, 0x0a, 0x7a, 0x2a, 0x39, 
+  0x05, 0x08, 0x01, 0x18, 0xc4, 0x18, 0xa3, 0x00, 0x00, 0x18, 0x83, 0x20, 0xc4, 0x19, 0x25, 0x19, 
+  0xa6, 0x01, 0x43, 0x43, 0x09, 0xe5, 0x03, 0x09, 0xc5, 0x85, 0x33, 0xb6, 0x58, 0xd7, 0x5d, 0x42, 
+  0xcf, 0x1c, 0x04, 0xd7, 0x5d, 0x6c, 0x50, 0x09, 0xe5, 0x0a, 0x66, 0x12, 0x87, 0x45, 0x0a, 0x66, 
+  0x41, 0x0a, 0x46, 0x43, 0x0a, 0x67, 0x42, 0x0a, 0x66, 0x01, 0x12, 0x66, 0x0a, 0x45, 0x41, 0x02, 
+  0x04, 0x04, 0x22, 0xc8, 0x3b, 0x6b, 0xa6, 0x17, 0xd7, 0x3c, 0xcf, 0x1c, 0x41, 0xd7, 0x3c, 0x06, 
+  0xcf, 0x1c, 0xdf, 0x7d, 0xe7, 0x9e, 0xae, 0x38, 0x8d, 0x54, 0x11, 0xc5, 0x09, 0xe5, 0x42, 0x0a, 
+  0x66, 0x03, 0x12, 0x66, 0x12, 0x46, 0x0a, 0x46, 0x12, 0x46, 0x42, 0x0a, 0x46, 0x00, 0x0a, 0x47, 
+  0x41, 0x0a, 0x66, 0x41, 0x0a, 0x46, 0x44, 0x0a, 0x66, 0x42, 0x0a, 0x67, 0x00, 0x0a, 0x47, 0x41, 
+  0x0a, 0x67, 0x00, 0x12, 0x47, 0x41, 0x0a, 0x47, 0x44, 0x12, 0x47, 0x43, 0x12, 0x67, 0x41, 0x1a, 
+  0xe8, 0x4e, 0x1b, 0x08, 0x03, 0x1a, 0xc8, 0x0a, 0x06, 0x01, 0xc6, 0x09, 0xc6, 0x80, 0x0a, 0x01, 
+  0xc6, 0x0a, 0x26, 0x1a, 0xe8, 0x0a, 0x26, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xc6, 0x02, 0x05, 0x1a, 
+  0xe8, 0x0a, 0x67, 0x01, 0xc5, 0x42, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x80, 0x41, 0x01, 0xc6, 0x00, 
+  0x01, 0xa6, 0x80, 0x00, 0x1a, 0xe7, 0x42, 0x01, 0xe6, 0x00, 0x1b, 0x08, 0x80, 0x01, 0x0a, 0x66, 
+  0x1a, 0xe8, 0x41, 0x01, 0xa5, 0x80, 0x00, 0x0a, 0x66, 0x89, 0x00, 0x0a, 0x46, 0x83, 0x00, 0x0a, 
+  0x47, 0x80, 0x01, 0x23, 0x28, 0x01, 0xc5, 0x82, 0x01, 0x1a, 0xe8, 0x0a, 0x67, 0x86, 0x08, 0x01, 
+  0xe7, 0x01, 0xa6, 0x01, 0x85, 0x09, 0x44, 0x3a, 0xcb, 0xce, 0xfb, 0xd7, 0x3c, 0xce, 0xfb, 0xdf, 
+  0x7d, 0x80, 0x15, 0x53, 0xee, 0x22, 0x89, 0x00, 0xe3, 0x00, 0x82, 0x6b, 0x6c, 0xbd, 0xd5, 0xc5, 
+  0xf5, 0xbd, 0xb4, 0xbd, 0xb3, 0xbd, 0xb4, 0xa5, 0x12, 0xad, 0x32, 0xce, 0x15, 0xbd, 0xd5, 0x94, 
+  0x70, 0x6b, 0x4e, 0x19, 0x06, 0x19, 0x07, 0x32, 0x4c, 0x32, 0x6d, 0x3a, 0xae, 0x3a, 0xad, 0x80, 
+  0x01, 0x3a, 0x8e, 0x3a, 0x8d, 0x41, 0x3a, 0x8e, 0x06, 0x3a, 0xae, 0x32, 0x6d, 0x7c, 0x10, 0xac, 
+  0xd2, 0x6a, 0x4a, 0x10, 0x83, 0x29, 0xeb, 0x80, 0x41, 0x32, 0x2c, 0x04, 0x19, 0x06, 0x08, 0x62, 
+  0x51, 0xc9, 0x59, 0xe9, 0x41, 0x47, 0x80, 0x00, 0x7a, 0x2a, 0x80, 0x03, 0x82, 0x4a, 0x30, 0xe4, 
+  0x00, 0x00, 0x10, 0x83, 0x41, 0x18, 0xc5, 0x0f, 0x10, 0x83, 0x08, 0x22, 0x10, 0xe4, 0x22, 0x88, 
+  0x1a, 0xe8, 0x1b, 0x08, 0x1a, 0xc7, 0x12, 0x67, 0x12, 0x25, 0x22, 0xa8, 0x8d, 0x34, 0xd7, 0x3c, 
+  0xd7, 0x5d, 0xce, 0xfb, 0xd7, 0x3c, 0xcf, 0x3c, 0x80, 0x06, 0x7d, 0x53, 0x12, 0x87, 0x1a, 0xc7, 
+  0x1a, 0xe8, 0x1b, 0x08, 0x23, 0x28, 0x23, 0x08, 0x4e, 0x1a, 0xe8, 0x00, 0x23, 0x29, 0x41, 0x23, 
+  0x49, 0x04, 0x1b, 0x08, 0x2b, 0x6a, 0x4c, 0x0d, 0xbe, 0x9a, 0xce, 0xfb, 0x80, 0x06, 0xdf, 0x7d, 
+  0xcf, 0x1c, 0xce, 0xfb, 0xd7, 0x5d, 0xcf, 0x1c, 0xae, 0x17, 0x95, 0x74, 0x41, 0x2b, 0x69, 0x01, 
+  0x1a, 0xe8, 0x12, 0x87, 0x43, 0x1a, 0xc8, 0x42, 0x1a, 0xe8, 0x41, 0x23, 0x08, 0x41, 0x22, 0xe8, 
+  0x00, 0x23, 0x08, 0x41, 0x1b, 0x08, 0x49, 0x1a, 0xe8, 0x47, 0x22, 0xe8, 0x41, 0x22, 0xe9, 0x41, 
+  0x01, 0xe5, 0x49, 0x01, 0xe6, 0x41, 0x01, 0xe5, 0x00, 0x01, 0xe6, 0x42, 0x01, 0xe5, 0x00, 0x01, 
+  0xa5, 0x41, 0x01, 0xa6, 0x09, 0x01, 0xc5, 0x0a, 0x26, 0x1a, 0xe8, 0x0a, 0x46, 0x01, 0xc6, 0x09, 
+  0xe6, 0x01, 0xe6, 0x02, 0x06, 0x1a, 0xe8, 0x0a, 0x67, 0x45, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x41, 
+  0x01, 0xe6, 0x00, 0x01, 0xc6, 0x80, 0x01, 0x12, 0xe7, 0x01, 0xc5, 0x83, 0x00, 0x0a, 0x46, 0x80, 
+  0x00, 0x01, 0xc5, 0x81, 0x00, 0x0a, 0x47, 0x95, 0x01, 0x1b, 0x08, 0x0a, 0x66, 0x81, 0x00, 0x01, 
+  0xe7, 0x82, 0x11, 0x09, 0xe7, 0x01, 0xa6, 0x12, 0x28, 0x32, 0xca, 0xb6, 0x58, 0xbe, 0x9a, 0xcf, 
+  0x1c, 0xc6, 0xdb, 0xd7, 0x5d, 0xce, 0xfb, 0x5b, 0xae, 0x09, 0x65, 0x11, 0x65, 0x29, 0x45, 0x63, 
+  0x2b, 0xbd, 0xd5, 0xbd, 0xb4, 0xb5, 0x93, 0x80, 0x02, 0xbd, 0x94, 0xa4, 0xd2, 0x9c, 0xb1, 0x41, 
+  0xbd, 0xb4, 0x0a, 0xbd, 0xd4, 0xc5, 0xf5, 0xbd, 0x94, 0x83, 0xef, 0x62, 0xec, 0x10, 0xa3, 0x21, 
+  0x68, 0x2a, 0x0b, 0x32, 0x6d, 0x42, 0xef, 0x3a, 0xcf, 0x41, 0x3a, 0x8d, 0x81, 0x0e, 0x2a, 0x4c, 
+  0x8c, 0x71, 0xa4, 0x10, 0x20, 0xc5, 0x21, 0x68, 0x32, 0x0b, 0x31, 0xeb, 0x29, 0xea, 0x29, 0x47, 
+  0x51, 0xc9, 0x72, 0x4a, 0x6a, 0x0a, 0x62, 0x0b, 0x39, 0x27, 0x82, 0x4a, 0x41, 0x82, 0x2a, 0x01, 
+  0x6a, 0x09, 0x10, 0x61, 0x80, 0x0d, 0x00, 0x21, 0x31, 0x87, 0x6b, 0x4e, 0x31, 0xa8, 0x08, 0x42, 
+  0x11, 0x25, 0x12, 0x48, 0x0a, 0x27, 0x02, 0x06, 0x01, 0xa5, 0x09, 0xc5, 0x19, 0xa5, 0x84, 0xf3, 
+  0xd7, 0x9d, 0x41, 0xce, 0xfb, 0x05, 0xdf, 0x5d, 0xd7, 0x5d, 0x8d, 0x54, 0x1a, 0x47, 0x0a, 0x06, 
+  0x01, 0xa4, 0x41, 0x01, 0xc5, 0x00, 0x01, 0xe5, 0x41, 0x02, 0x05, 0x41, 0x01, 0xe6, 0x46, 0x01, 
+  0xe5, 0x43, 0x02, 0x05, 0x43, 0x02, 0x06, 0x13, 0x0a, 0x06, 0x09, 0xe5, 0x01, 0x84, 0x01, 0xa4, 
+  0x12, 0x27, 0x22, 0x88, 0x7c, 0xb2, 0xbe, 0x59, 0xce, 0xdb, 0xcf, 0x3c, 0xc6, 0xdb, 0xce, 0xfb, 
+  0xdf, 0x7d, 0xdf, 0x5d, 0xce, 0xfb, 0xcf, 0x3c, 0x6c, 0x70, 0x1a, 0x06, 0x09, 0x64, 0x01, 0x03, 
+  0x41, 0x09, 0xc5, 0x43, 0x01, 0xe5, 0x41, 0x09, 0xe5, 0x45, 0x01, 0xe5, 0x49, 0x01, 0xe6, 0x41, 
+  0x09, 0xe6, 0x00, 0x01, 0xe6, 0x41, 0x0a, 0x06, 0x42, 0x09, 0xe6, 0x51, 0x0a, 0x46, 0x41, 0x0a, 
+  0x47, 0x0a, 0x0a, 0x67, 0x0a, 0x66, 0x1a, 0xe8, 0x0a, 0x46, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0xc6, 
+  0x02, 0x05, 0x1a, 0xc7, 0x0a, 0x66, 0x01, 0xc5, 0x83, 0x43, 0x09, 0xe6, 0x82, 0x03, 0x0a, 0x67, 
+  0x1a, 0xe7, 0x01, 0xc6, 0x09, 0xe6, 0x82, 0x00, 0x0a, 0x66, 0x80, 0x41, 0x01, 0xa5, 0x01, 0x1a, 
+  0xe8, 0x0a, 0x46, 0x8e, 0x00, 0x0a, 0x46, 0x81, 0x00, 0x01, 0xe5, 0x82, 0x01, 0x1a, 0xe8, 0x0a, 
+  0x67, 0x81, 0x41, 0x01, 0xc6, 0x80, 0x05, 0x0a, 0x27, 0x01, 0xc6, 0x32, 0xca, 0xb6, 0x79, 0xcf, 
+  0x1c, 0xcf, 0x3c, 0x41, 0xcf, 0x1c, 0x0b, 0xdf, 0x9e, 0xb6, 0x59, 0x32, 0xaa, 0x01, 0x86, 0x11, 
+  0x86, 0x63, 0x4c, 0xc5, 0xf6, 0xbd, 0xd5, 0xbd, 0xb4, 0xbd, 0x94, 0xbd, 0xb4, 0xad, 0x33, 0x41, 
+  0xa4, 0xd2, 0x41, 0xbd, 0xd4, 0x44, 0xbd, 0xb4, 0x16, 0xad, 0x53, 0x9c, 0xd2, 0x6b, 0x2d, 0x29, 
+  0x66, 0x29, 0xca, 0x21, 0xca, 0x21, 0xaa, 0x3a, 0xae, 0x3a, 0x8e, 0x3a, 0x8d, 0x32, 0x8e, 0x4b, 
+  0x0e, 0x8c, 0x50, 0x73, 0x0d, 0x18, 0xc6, 0x21, 0x89, 0x21, 0x68, 0x21, 0x47, 0x18, 0xa3, 0x59, 
+  0xe9, 0x82, 0x8c, 0x72, 0x2b, 0x59, 0x89, 0x80, 0x00, 0x41, 0x28, 0x41, 0x7a, 0x2a, 0x10, 0x8a, 
+  0x8b, 0x30, 0xe4, 0x00, 0x00, 0x00, 0x20, 0x10, 0xa4, 0x5a, 0xcb, 0x84, 0x10, 0x29, 0x87, 0x00, 
+  0x21, 0x09, 0x44, 0x12, 0xa8, 0x12, 0xc8, 0x12, 0xe8, 0x12, 0x87, 0x74, 0x91, 0xc6, 0xfb, 0xc6, 
+  0xdb, 0x41, 0xc6, 0xfb, 0x06, 0xcf, 0x3c, 0xa6, 0x37, 0x85, 0x53, 0x12, 0x67, 0x12, 0xa7, 0x0a, 
+  0x86, 0x0a, 0x46, 0x42, 0x0a, 0x26, 0x52, 0x0a, 0x46, 0x41, 0x0a, 0x26, 0x13, 0x0a, 0x06, 0x0a, 
+  0x26, 0x0a, 0x66, 0x0a, 0x87, 0x12, 0x87, 0x11, 0xe5, 0x53, 0xad, 0xc6, 0xda, 0xdf, 0x7d, 0xd7, 
+  0x5d, 0xce, 0xfb, 0xce, 0xfc, 0xd7, 0x3c, 0xd7, 0x3d, 0xcf, 0x1b, 0xce, 0xfb, 0x53, 0x6d, 0x2a, 
+  0x48, 0x01, 0xe5, 0x02, 0x05, 0x41, 0x12, 0x67, 0x02, 0x12, 0x47, 0x0a, 0x46, 0x0a, 0x47, 0x44, 
+  0x0a, 0x46, 0x09, 0x0a, 0x26, 0x0a, 0x46, 0x0a, 0x26, 0x0a, 0x46, 0x0a, 0x26, 0x0a, 0x46, 0x0a, 
+  0x26, 0x0a, 0x27, 0x0a, 0x26, 0x0a, 0x46, 0x44, 0x0a, 0x47, 0x01, 0x12, 0x47, 0x0a, 0x47, 0x42, 
+  0x12, 0x47, 0x47, 0x1a, 0xe8, 0x02, 0x1b, 0x08, 0x1a, 0xe8, 0x1b, 0x08, 0x4a, 0x1a, 0xe8, 0x07, 
+  0x0a, 0x26, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0xc6, 0x02, 0x06, 0x12, 0xc7, 0x0a, 0x46, 0x01, 0xe5, 
+  0x43, 0x01, 0xe6, 0x04, 0x09, 0xe6, 0x01, 0xe6, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0xc6, 0x81, 0x02, 
+  0x02, 0x06, 0x12, 0xc7, 0x12, 0x87, 0x41, 0x01, 0xc6, 0x82, 0x00, 0x0a, 0x46, 0x80, 0x00, 0x01, 
+  0xc5, 0x85, 0x00, 0x0a, 0x67, 0x82, 0x00, 0x0a, 0x87, 0x86, 0x00, 0x0a, 0x47, 0x8a, 0x05, 0x01, 
+  0xa6, 0x01, 0x65, 0x01, 0x24, 0x32, 0xeb, 0xc6, 0xba, 0xd7, 0x5d, 0x80, 0x10, 0xce, 0xfb, 0xdf, 
+  0x7d, 0xb6, 0x79, 0x84, 0xf3, 0x2a, 0x69, 0x01, 0x44, 0x11, 0x65, 0x6b, 0xad, 0xd6, 0x98, 0xb5, 
+  0xb4, 0xbd, 0xb4, 0xbd, 0x94, 0xbd, 0xb4, 0xad, 0x32, 0x9c, 0x91, 0xbd, 0x94, 0xbd, 0xd4, 0x44, 
+  0xbd, 0xb4, 0x00, 0xbd, 0xb3, 0x41, 0xbd, 0xb4, 0x10, 0xbd, 0xd4, 0xb5, 0x73, 0xbd, 0xb5, 0x73, 
+  0x8e, 0x31, 0x87, 0x3a, 0x09, 0x21, 0x69, 0x21, 0x89, 0x42, 0xcf, 0x2a, 0x0c, 0x84, 0x52, 0x9c, 
+  0xb2, 0x21, 0x28, 0x21, 0x49, 0x19, 0x06, 0x18, 0x83, 0x41, 0x46, 0x41, 0x7a, 0x4a, 0x04, 0x7a, 
+  0x4b, 0x69, 0xea, 0x7a, 0x6b, 0x72, 0x2b, 0x39, 0x07, 0x80, 0x02, 0x72, 0x2a, 0x62, 0x0a, 0x20, 
+  0xa3, 0x81, 0x07, 0x18, 0xe6, 0x6b, 0x6d, 0x94, 0x71, 0x21, 0x25, 0x00, 0x20, 0x09, 0x84, 0x1a, 
+  0xc8, 0x12, 0xc7, 0x80, 0x09, 0x7d, 0x53, 0xdf, 0x9d, 0xcf, 0x3c, 0xcf, 0x1b, 0xcf, 0x3d, 0xd7, 
+  0x9e, 0x85, 0x13, 0x12, 0x67, 0x12, 0xc7, 0x1b, 0x28, 0x41, 0x23, 0x49, 0x02, 0x1b, 0x28, 0x1b, 
+  0x08, 0x12, 0xe8, 0x44, 0x1a, 0xe8, 0x00, 0x1a, 0xc8, 0x4d, 0x1a, 0xe8, 0x00, 0x1a, 0xc8, 0x41, 
+  0x1a, 0xc7, 0x00, 0x1a, 0xc8, 0x41, 0x1b, 0x08, 0x13, 0x1a, 0xe8, 0x1a, 0xc8, 0x02, 0x05, 0x53, 
+  0xee, 0x8d, 0x54, 0x95, 0x75, 0xe7, 0x9e, 0xe7, 0xbe, 0xdf, 0x7d, 0xcf, 0x1c, 0xd7, 0x3c, 0xcf, 
+  0x1c, 0xd7, 0x5d, 0xcf, 0x1b, 0x6c, 0x90, 0x43, 0xec, 0x12, 0xe7, 0x1b, 0x08, 0x23, 0x29, 0x1b, 
+  0x08, 0x4a, 0x1a, 0xe8, 0x41, 0x1a, 0xc8, 0x45, 0x1a, 0xe8, 0x01, 0x1a, 0xc8, 0x1a, 0xe8, 0x41, 
+  0x1a, 0xc8, 0x02, 0x22, 0xe8, 0x1a, 0xe8, 0x22, 0xe8, 0x56, 0x01, 0xa5, 0x80, 0x05, 0x01, 0xc5, 
+  0x0a, 0x06, 0x12, 0xc7, 0x12, 0x67, 0x01, 0xc5, 0x09, 0xe6, 0x81, 0x03, 0x01, 0xe7, 0x01, 0xc6, 
+  0x01, 0xe6, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x06, 0x09, 0xe6, 0x01, 0xc6, 0x01, 0xc5, 0x1a, 0xe7, 
+  0x23, 0x08, 0x01, 0xc5, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xe6, 0x86, 0x00, 0x0a, 0x67, 0x82, 0x00, 
+  0x0a, 0x66, 0x85, 0x00, 0x0a, 0x66, 0x88, 0x1c, 0x1a, 0xc8, 0x01, 0xa4, 0x1b, 0x08, 0x12, 0x87, 
+  0x01, 0xe6, 0x0a, 0x07, 0x09, 0xe7, 0x01, 0x44, 0x22, 0x28, 0x63, 0xae, 0xae, 0x18, 0xdf, 0x7d, 
+  0xcf, 0x1b, 0xce, 0xfb, 0xd7, 0x5d, 0xd7, 0x3c, 0x43, 0x4c, 0x01, 0x03, 0x01, 0x85, 0x00, 0xc3, 
+  0x00, 0x20, 0x73, 0x6e, 0xa5, 0x13, 0xc6, 0x16, 0xbd, 0xd5, 0xbd, 0xb4, 0xad, 0x12, 0xa4, 0xf2, 
+  0xbd, 0x94, 0x48, 0xbd, 0xb4, 0x00, 0xbd, 0xb3, 0x41, 0xbd, 0xb4, 0x19, 0xbd, 0xd4, 0xbd, 0xb5, 
+  0xad, 0x33, 0xb5, 0x94, 0x42, 0x08, 0x21, 0x26, 0x10, 0xe5, 0x39, 0xe9, 0x9c, 0xf3, 0x73, 0x8f, 
+  0x18, 0xe7, 0x10, 0xc6, 0x39, 0x25, 0x7a, 0x2a, 0x7a, 0x29, 0x7a, 0x09, 0x7a, 0x29, 0x7a, 0x2a, 
+  0x82, 0x4a, 0x82, 0x6b, 0x6a, 0x0b, 0x39, 0x27, 0x72, 0x09, 0x41, 0x06, 0x41, 0x68, 0x20, 0xc3, 
+  0x80, 0x00, 0x00, 0x21, 0x80, 0x0f, 0x52, 0x8b, 0x5a, 0xec, 0x08, 0x62, 0x00, 0xa2, 0x09, 0x85, 
+  0x00, 0xe3, 0x43, 0x4c, 0x74, 0x91, 0xd7, 0x1c, 0xcf, 0x1c, 0xce, 0xfc, 0xd7, 0x5d, 0x95, 0x95, 
+  0x6c, 0x50, 0x09, 0x85, 0x01, 0x84, 0x43, 0x01, 0xe5, 0x42, 0x01, 0xc5, 0x47, 0x01, 0xa5, 0x41, 
+  0x01, 0xa4, 0x4c, 0x01, 0xa5, 0x00, 0x01, 0xc5, 0x43, 0x01, 0xa5, 0x41, 0x01, 0xc5, 0x06, 0x01, 
+  0x84, 0x01, 0xc5, 0x74, 0x91, 0x74, 0x71, 0x95, 0x95, 0xdf, 0x7e, 0xc6, 0xdb, 0x42, 0xce, 0xfb, 
+  0x04, 0xdf, 0x5d, 0xc6, 0xda, 0x7d, 0x12, 0x2a, 0xa9, 0x01, 0x22, 0x42, 0x01, 0x84, 0x01, 0x01, 
+  0xa5, 0x01, 0xa4, 0x41, 0x01, 0xa5, 0x00, 0x01, 0xc5, 0x52, 0x01, 0xa5, 0x02, 0x12, 0xc8, 0x1a, 
+  0xc8, 0x1a, 0xe8, 0x42, 0x1a, 0xc8, 0x4d, 0x12, 0xc8, 0x44, 0x12, 0xc7, 0x03, 0x1a, 0xc8, 0x0a, 
+  0x46, 0x01, 0xc6, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x43, 0x01, 0xe6, 0x06, 0x01, 
+  0xc6, 0x01, 0xe6, 0x01, 0xe5, 0x12, 0xc7, 0x1b, 0x08, 0x0a, 0x26, 0x01, 0xc6, 0x81, 0x01, 0x02, 
+  0x06, 0x1b, 0x28, 0x81, 0x00, 0x12, 0xe7, 0x82, 0x01, 0x0a, 0x66, 0x02, 0x06, 0x88, 0x00, 0x0a, 
+  0x46, 0x83, 0x02, 0x0a, 0x46, 0x02, 0x05, 0x1b, 0x28, 0x80, 0x1c, 0x12, 0xa7, 0x1a, 0xc7, 0x01, 
+  0xa5, 0x12, 0xa7, 0x01, 0xe5, 0x01, 0x44, 0x02, 0x06, 0x01, 0xe6, 0x19, 0xc6, 0x9d, 0x96, 0xdf, 
+  0xbe, 0xcf, 0x1c, 0xce, 0xfb, 0xcf, 0x1c, 0xe7, 0xbe, 0xcf, 0x1c, 0x53, 0xae, 0x01, 0xc6, 0x0a, 
+  0x07, 0x09, 0xa6, 0x00, 0x61, 0x49, 0x84, 0x41, 0xa7, 0x29, 0x68, 0x73, 0xb0, 0x8c, 0x72, 0xad, 
+  0x55, 0x9c, 0xb1, 0xb5, 0x93, 0x4e, 0xbd, 0xb4, 0x0a, 0xad, 0x52, 0x9c, 0x90, 0xbd, 0x94, 0xa5, 
+  0x12, 0x63, 0x0b, 0x9c, 0xb0, 0x9c, 0xd2, 0x29, 0x48, 0x00, 0x44, 0x41, 0x87, 0x82, 0x6b, 0x80, 
+  0x41, 0x7a, 0x09, 0x80, 0x01, 0x7a, 0x09, 0x7a, 0x2a, 0x80, 0x01, 0x6a, 0x2b, 0x31, 0x06, 0x41, 
+  0x49, 0x47, 0x03, 0x59, 0xe8, 0x18, 0x82, 0x00, 0x20, 0x08, 0x21, 0x80, 0x11, 0x21, 0x27, 0x10, 
+  0xc5, 0x00, 0x61, 0x11, 0x84, 0x01, 0x23, 0x4b, 0x2c, 0xce, 0xfb, 0xdf, 0x7e, 0xcf, 0x1c, 0xce, 
+  0xfb, 0xdf, 0x7d, 0xb6, 0xb9, 0x2b, 0x29, 0x0a, 0x04, 0x12, 0x66, 0x12, 0x87, 0x12, 0xc7, 0x1a, 
+  0xe7, 0x41, 0x1a, 0xc7, 0x01, 0x1a, 0xc8, 0x12, 0xc8, 0x48, 0x1a, 0xc7, 0x49, 0x1a, 0xc8, 0x00, 
+  0x1a, 0xc7, 0x44, 0x1a, 0xc8, 0x00, 0x1a, 0xc7, 0x41, 0x1a, 0xa7, 0x41, 0x1a, 0xc7, 0x41, 0x1a, 
+  0xe8, 0x04, 0x1a, 0xc8, 0x0a, 0x86, 0x0a, 0x45, 0x2a, 0xe9, 0xa5, 0xf7, 0x41, 0xdf, 0x7d, 0x00, 
+  0xd7, 0x1c, 0x41, 0xce, 0xfb, 0x08, 0xd7, 0x1c, 0xe7, 0xbe, 0xad, 0xf7, 0x74, 0x91, 0x33, 0x0a, 
+  0x01, 0xc4, 0x12, 0x87, 0x12, 0xa7, 0x1a, 0xa7, 0x45, 0x1a, 0xc8, 0x41, 0x1a, 0xa8, 0x46, 0x1a, 
+  0xc8, 0x00, 0x1a, 0xa8, 0x43, 0x1a, 0xc8, 0x41, 0x1a, 0xa8, 0x41, 0x12, 0x87, 0x42, 0x12, 0xa7, 
+  0x42, 0x12, 0x87, 0x00, 0x12, 0xa7, 0x4d, 0x12, 0x87, 0x02, 0x0a, 0x87, 0x12, 0x87, 0x0a, 0x46, 
+  0x42, 0x01, 0xe6, 0x00, 0x01, 0xc7, 0x45, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x0b, 0x01, 0xe5, 0x12, 
+  0xa7, 0x1b, 0x28, 0x0a, 0x26, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xc6, 0x02, 0x06, 0x12, 0xa7, 0x12, 
+  0x87, 0x01, 0xe5, 0x0a, 0x66, 0x81, 0x00, 0x01, 0xc5, 0x80, 0x00, 0x0a, 0x67, 0x82, 0x00, 0x0a, 
+  0x87, 0x82, 0x01, 0x0a, 0x86, 0x1b, 0x08, 0x85, 0x01, 0x0a, 0x66, 0x02, 0x06, 0x82, 0x08, 0x1a, 
+  0xe8, 0x01, 0x43, 0x53, 0xce, 0x85, 0x33, 0x7c, 0xd2, 0x11, 0xe6, 0x22, 0x69, 0xb6, 0x58, 0xdf, 
+  0x7d, 0x41, 0xc6, 0xfb, 0x11, 0xcf, 0x1c, 0xce, 0xfb, 0x64, 0x0f, 0x3b, 0x2c, 0x01, 0xa5, 0x0a, 
+  0x07, 0x02, 0x07, 0x09, 0xc6, 0x10, 0xe3, 0xab, 0xca, 0xde, 0x13, 0x7b, 0xaf, 0x00, 0x02, 0x29, 
+  0x48, 0x42, 0x0c, 0x94, 0x71, 0xc5, 0xf5, 0xbd, 0xd5, 0x81, 0x00, 0xbd, 0xd4, 0x80, 0x00, 0xbd, 
+  0xd4, 0x82, 0x00, 0xbd, 0xd4, 0x83, 0x0b, 0xa5, 0x12, 0xad, 0x32, 0xad, 0x33, 0xbd, 0xb4, 0xbd, 
+  0xd4, 0xce, 0x15, 0xbd, 0x94, 0x94, 0x10, 0x5a, 0x09, 0x31, 0x27, 0x72, 0x4a, 0x7a, 0x4a, 0x41, 
+  0x7a, 0x2a, 0x00, 0x7a, 0x0a, 0x82, 0x08, 0x61, 0xc9, 0x39, 0x27, 0x28, 0xe6, 0x6a, 0x2a, 0x59, 
+  0xa8, 0x10, 0x62, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x41, 0x08, 0x83, 0x03, 0x08, 0xa3, 0x09, 
+  0xa5, 0x01, 0x84, 0x5b, 0xce, 0x41, 0xcf, 0x1c, 0x00, 0xc6, 0xfb, 0x80, 0x06, 0xdf, 0x7d, 0xa5, 
+  0xf7, 0x2a, 0xc9, 0x0a, 0x87, 0x12, 0xa7, 0x12, 0x46, 0x0a, 0x46, 0x41, 0x12, 0x66, 0x01, 0x12, 
+  0x87, 0x12, 0x86, 0x41, 0x12, 0x87, 0x41, 0x12, 0x67, 0x00, 0x12, 0x66, 0x43, 0x12, 0x67, 0x46, 
+  0x12, 0x87, 0x47, 0x12, 0x67, 0x42, 0x12, 0x87, 0x44, 0x12, 0x67, 0x0a, 0x0a, 0x46, 0x0a, 0x67, 
+  0x12, 0x67, 0x12, 0xa7, 0x12, 0xa8, 0x09, 0xe5, 0x1a, 0x27, 0x4b, 0x6d, 0x43, 0x4c, 0xb6, 0x58, 
+  0xdf, 0x7d, 0x41, 0xd7, 0x3c, 0x06, 0xce, 0xfb, 0xd7, 0x3c, 0xe7, 0xbe, 0xb6, 0x99, 0x95, 0xd5, 
+  0x2a, 0xe9, 0x12, 0x46, 0x41, 0x12, 0xa7, 0x42, 0x12, 0x87, 0x51, 0x12, 0x67, 0x4c, 0x01, 0xe5, 
+  0x00, 0x01, 0xe6, 0x49, 0x01, 0xe5, 0x00, 0x02, 0x05, 0x41, 0x02, 0x06, 0x80, 0x42, 0x02, 0x06, 
+  0x41, 0x01, 0xe6, 0x01, 0x02, 0x06, 0x01, 0xe6, 0x42, 0x02, 0x06, 0x03, 0x1a, 0xe7, 0x1b, 0x08, 
+  0x0a, 0x26, 0x01, 0xc6, 0x41, 0x09, 0xc6, 0x04, 0x01, 0xe6, 0x1a, 0xc7, 0x12, 0x87, 0x01, 0xc5, 
+  0x01, 0xc6, 0x80, 0x00, 0x1a, 0xe8, 0x80, 0x02, 0x01, 0xa5, 0x1a, 0xe7, 0x0a, 0x66, 0x81, 0x00, 
+  0x01, 0xe6, 0x87, 0x01, 0x1a, 0xe7, 0x01, 0xc6, 0x85, 0x11, 0x12, 0xc7, 0x12, 0xa6, 0x53, 0xad, 
+  0xcf, 0x1c, 0xdf, 0x9e, 0xdf, 0x7d, 0xae, 0x38, 0xb6, 0x38, 0xdf, 0x7d, 0xd7, 0x1c, 0xd7, 0x5d, 
+  0xcf, 0x1c, 0xc7, 0x1b, 0x4b, 0x6d, 0x01, 0x44, 0x01, 0xc6, 0x0a, 0x07, 0x01, 0xe7, 0x80, 0x0c, 
+  0x09, 0xe6, 0x18, 0xe3, 0xb4, 0x0a, 0xfe, 0xd4, 0xee, 0xda, 0xc5, 0xd7, 0x73, 0x8f, 0x00, 0x03, 
+  0x39, 0xaa, 0x73, 0x90, 0xb5, 0x75, 0xbd, 0xd5, 0xbd, 0xd4, 0x42, 0xbd, 0xb3, 0x80, 0x00, 0xbd, 
+  0xb3, 0x83, 0x04, 0xad, 0x32, 0x9c, 0x91, 0xad, 0x13, 0xbd, 0x94, 0xbd, 0xd4, 0x41, 0xbd, 0xb4, 
+  0x07, 0xb5, 0x93, 0x93, 0xee, 0x82, 0xeb, 0x82, 0x8b, 0x49, 0x88, 0x72, 0x0a, 0x82, 0x4a, 0x7a, 
+  0x4a, 0x80, 0x41, 0x7a, 0x29, 0x11, 0x72, 0x0a, 0x69, 0xe9, 0x30, 0xc6, 0x51, 0x89, 0x5a, 0x0a, 
+  0x31, 0x25, 0x10, 0x61, 0x00, 0xa2, 0x09, 0x24, 0x08, 0xe3, 0x09, 0x24, 0x09, 0x65, 0x09, 0xc6, 
+  0x01, 0x85, 0x5b, 0xce, 0xae, 0x38, 0xcf, 0x1b, 0xd7, 0x5d, 0x80, 0x06, 0xc6, 0xfc, 0xc7, 0x1c, 
+  0xae, 0x18, 0x1a, 0x07, 0x01, 0xa5, 0x0a, 0x07, 0x01, 0xe6, 0x41, 0x01, 0xc5, 0x01, 0x01, 0xe5, 
+  0x01, 0xa5, 0x44, 0x01, 0xc6, 0x41, 0x01, 0xa6, 0x52, 0x01, 0xc6, 0x01, 0x01, 0xc5, 0x01, 0xa5, 
+  0x41, 0x01, 0xc5, 0x43, 0x01, 0xc6, 0x00, 0x01, 0xa6, 0x43, 0x01, 0xc6, 0x06, 0x09, 0xa5, 0x01, 
+  0x85, 0x01, 0x65, 0x01, 0x85, 0x22, 0x68, 0x53, 0xad, 0xce, 0xfb, 0x80, 0x07, 0xcf, 0x1c, 0xcf, 
+  0x1b, 0xc6, 0xfb, 0xd7, 0x3c, 0xd7, 0x5d, 0xbe, 0x79, 0x9d, 0xb6, 0x12, 0x27, 0x41, 0x01, 0xe6, 
+  0x42, 0x01, 0xc6, 0x41, 0x01, 0xa6, 0x48, 0x01, 0xc6, 0x44, 0x01, 0xa6, 0x00, 0x01, 0xc6, 0x56, 
+  0x23, 0x49, 0x02, 0x1b, 0x29, 0x23, 0x49, 0x1b, 0x49, 0x41, 0x1b, 0x29, 0x01, 0x23, 0x49, 0x1b, 
+  0x49, 0x41, 0x1b, 0x29, 0x43, 0x1b, 0x28, 0x09, 0x1b, 0x48, 0x1b, 0x49, 0x23, 0x48, 0x0a, 0x66, 
+  0x01, 0xe6, 0x09, 0xe6, 0x01, 0xc6, 0x01, 0xe6, 0x12, 0xa7, 0x12, 0x67, 0x41, 0x09, 0xe6, 0x80, 
+  0x00, 0x12, 0x87, 0x80, 0x02, 0x01, 0xe6, 0x01, 0xc5, 0x1a, 0xe8, 0x83, 0x00, 0x12, 0x87, 0x81, 
+  0x02, 0x1a, 0xe8, 0x0a, 0x87, 0x1b, 0x28, 0x80, 0x00, 0x0a, 0x67, 0x80, 0x00, 0x01, 0xc5, 0x83, 
+  0x00, 0x23, 0x28, 0x81, 0x0f, 0x0a, 0x65, 0x74, 0xb2, 0xe7, 0xbe, 0xc6, 0xfb, 0xce, 0xfb, 0xd7, 
+  0x5d, 0xd7, 0x5c, 0xcf, 0x1c, 0xd7, 0x3c, 0xdf, 0x5d, 0x53, 0xae, 0x19, 0xe7, 0x01, 0x65, 0x01, 
+  0xc6, 0x0a, 0x07, 0x02, 0x07, 0x80, 0x10, 0x0a, 0x07, 0x09, 0x44, 0x18, 0xa2, 0x82, 0xa7, 0xb4, 
+  0x2b, 0xf6, 0x93, 0xff, 0xff, 0x94, 0x72, 0x29, 0x68, 0x31, 0xcb, 0x21, 0x08, 0x21, 0x28, 0x39, 
+  0xea, 0x94, 0x91, 0xa4, 0xf1, 0xc5, 0xf3, 0xbd, 0xd3, 0x41, 0xbd, 0xb3, 0x0c, 0xbd, 0xd4, 0xbd, 
+  0xb4, 0xb5, 0x73, 0x94, 0x91, 0xa5, 0x12, 0xb5, 0x73, 0xb5, 0x93, 0xbd, 0xb3, 0xb5, 0x93, 0xbd, 
+  0xd4, 0xbd, 0xf5, 0xac, 0xd1, 0x7a, 0xaa, 0x41, 0x7a, 0x29, 0x04, 0x41, 0x68, 0x6a, 0x09, 0x82, 
+  0x2a, 0x82, 0x29, 0x82, 0x49, 0x41, 0x7a, 0x2a, 0x05, 0x41, 0x06, 0x28, 0x84, 0x59, 0x88, 0x61, 
+  0xe9, 0x18, 0xa3, 0x08, 0xe3, 0x41, 0x09, 0x85, 0x02, 0x01, 0x85, 0x09, 0xa5, 0x09, 0xc6, 0x41, 
+  0x01, 0xc6, 0x03, 0x53, 0xce, 0xcf, 0x1c, 0xdf, 0x7d, 0xd7, 0x3c, 0x80, 0x05, 0xcf, 0x3c, 0xae, 
+  0x18, 0x22, 0x07, 0x11, 0xa6, 0x01, 0x65, 0x09, 0xe7, 0x80, 0x04, 0x02, 0x27, 0x02, 0x26, 0x0a, 
+  0x66, 0x1b, 0x07, 0x01, 0xe6, 0x81, 0x44, 0x01, 0xe6, 0x80, 0x42, 0x01, 0xe6, 0x80, 0x43, 0x01, 
+  0xe6, 0x41, 0x09, 0xe6, 0x43, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x00, 0x09, 0xc6, 
+  0x80, 0x02, 0x0a, 0x05, 0x0a, 0x25, 0x01, 0xe5, 0x81, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x43, 0x09, 
+  0xe6, 0x41, 0x09, 0xc6, 0x0f, 0x09, 0xa6, 0x01, 0xa6, 0x1a, 0x28, 0xa5, 0xf7, 0xd7, 0x3c, 0xd7, 
+  0x1c, 0xcf, 0x1b, 0xcf, 0x1c, 0xd7, 0x3c, 0xcf, 0x1b, 0xce, 0xfb, 0xd7, 0x5c, 0xd7, 0x3c, 0xce, 
+  0xda, 0x84, 0xf3, 0x01, 0xa5, 0x80, 0x41, 0x01, 0xa6, 0x00, 0x09, 0xc6, 0x43, 0x09, 0xe6, 0x00, 
+  0x01, 0xe6, 0x41, 0x09, 0xe6, 0x46, 0x09, 0xc6, 0x41, 0x09, 0xe6, 0x4a, 0x02, 0x06, 0x43, 0x01, 
+  0xe6, 0x51, 0x02, 0x06, 0x41, 0x02, 0x05, 0x01, 0x02, 0x06, 0x02, 0x05, 0x41, 0x02, 0x06, 0x00, 
+  0x01, 0xe5, 0x80, 0x09, 0x01, 0xc6, 0x01, 0xe6, 0x12, 0xa7, 0x12, 0x67, 0x01, 0xe6, 0x0a, 0x06, 
+  0x01, 0xe6, 0x0a, 0x67, 0x1a, 0xe8, 0x0a, 0x26, 0x41, 0x01, 0xe6, 0x01, 0x1b, 0x08, 0x0a, 0x67, 
+  0x83, 0x00, 0x1a, 0xe7, 0x81, 0x00, 0x0a, 0x86, 0x81, 0x01, 0x0a, 0x66, 0x1a, 0xe8, 0x41, 0x01, 
+  0xe6, 0x82, 0x00, 0x23, 0x48, 0x80, 0x03, 0x12, 0xa7, 0x0a, 0x86, 0x64, 0x0f, 0xcf, 0x1c, 0x41, 
+  0xd7, 0x3c, 0x41, 0xc6, 0xfb, 0x80, 0x04, 0xdf, 0x7d, 0x8d, 0x34, 0x22, 0x89, 0x09, 0xe6, 0x01, 
+  0xa6, 0x41, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x81, 0x09, 0x09, 0x04, 0x94, 0x70, 0x39, 0xa6, 0x39, 
+  0x23, 0xb4, 0x2a, 0xe6, 0x54, 0x83, 0xce, 0x10, 0xa4, 0x4a, 0x6c, 0x4a, 0xad, 0x41, 0x18, 0xe7, 
+  0x14, 0x10, 0x86, 0x42, 0x09, 0xad, 0x33, 0xb5, 0xb4, 0xc5, 0xf5, 0xbd, 0xd4, 0xb5, 0xb3, 0x9c, 
+  0xb1, 0xa4, 0xf1, 0xbd, 0xb3, 0xbd, 0xb4, 0xbd, 0xd4, 0xbd, 0xb4, 0xb5, 0x93, 0xbd, 0xb3, 0xb5, 
+  0x72, 0xa4, 0xd1, 0x7a, 0xaa, 0x7a, 0x6a, 0x82, 0x4a, 0x7a, 0x2a, 0x80, 0x15, 0x69, 0xe9, 0x82, 
+  0x29, 0x7a, 0x2a, 0x72, 0x2a, 0x59, 0xa8, 0x40, 0xe6, 0x59, 0xa8, 0x61, 0xc9, 0x49, 0x46, 0x08, 
+  0x41, 0x09, 0x44, 0x0a, 0x06, 0x02, 0x26, 0x0a, 0x26, 0x0a, 0x06, 0x01, 0x84, 0x01, 0x44, 0x11, 
+  0xc6, 0x3b, 0x0b, 0xc7, 0x1b, 0xcf, 0x3c, 0xc6, 0xfb, 0x80, 0x0d, 0xce, 0xfb, 0x3b, 0x6c, 0x12, 
+  0x47, 0x01, 0xa5, 0x01, 0x84, 0x01, 0xa5, 0x01, 0xc6, 0x01, 0xe6, 0x0a, 0x46, 0x23, 0x88, 0x23, 
+  0xa9, 0x23, 0x88, 0x1a, 0xc7, 0x01, 0xa5, 0x46, 0x01, 0xc6, 0x44, 0x01, 0xe6, 0x00, 0x01, 0xc6, 
+  0x42, 0x01, 0xe6, 0x44, 0x01, 0xc6, 0x44, 0x01, 0xe6, 0x06, 0x0a, 0x45, 0x23, 0x47, 0x23, 0x68, 
+  0x1a, 0xe7, 0x01, 0xc5, 0x01, 0xa5, 0x01, 0xa6, 0x45, 0x01, 0xc6, 0x04, 0x01, 0x85, 0x11, 0xe7, 
+  0x19, 0xe7, 0xa5, 0xf7, 0xdf, 0x9d, 0x41, 0xcf, 0x1c, 0x04, 0xd7, 0x5d, 0xce, 0xfb, 0xb6, 0x79, 
+  0xce, 0xfb, 0xd7, 0x5d, 0x41, 0xce, 0xfb, 0x41, 0xd7, 0x3c, 0x01, 0x7c, 0xd2, 0x22, 0x48, 0x41, 
+  0x19, 0xe7, 0x41, 0x01, 0x85, 0x00, 0x09, 0xc6, 0x41, 0x01, 0xc6, 0x00, 0x01, 0xa6, 0x41, 0x01, 
+  0xa5, 0x41, 0x01, 0xa6, 0x00, 0x01, 0xa5, 0x42, 0x01, 0xa6, 0x42, 0x01, 0xc6, 0x41, 0x0a, 0x47, 
+  0x41, 0x0a, 0x67, 0x48, 0x0a, 0x47, 0x41, 0x0a, 0x67, 0x03, 0x0a, 0x46, 0x0a, 0x66, 0x0a, 0x67, 
+  0x0a, 0x66, 0x41, 0x0a, 0x46, 0x00, 0x0a, 0x67, 0x43, 0x0a, 0x46, 0x41, 0x0a, 0x47, 0x00, 0x0a, 
+  0x67, 0x41, 0x0a, 0x47, 0x47, 0x0a, 0x46, 0x00, 0x0a, 0x66, 0x41, 0x0a, 0x67, 0x07, 0x12, 0xc7, 
+  0x12, 0x87, 0x01, 0xe6, 0x0a, 0x06, 0x01, 0xe6, 0x0a, 0x67, 0x1a, 0xe8, 0x0a, 0x26, 0x41, 0x01, 
+  0xe6, 0x02, 0x0a, 0x66, 0x23, 0x48, 0x0a, 0x46, 0x83, 0x01, 0x12, 0xe7, 0x01, 0xc5, 0x80, 0x00, 
+  0x0a, 0x87, 0x81, 0x01, 0x0a, 0x46, 0x1a, 0xe7, 0x84, 0x00, 0x23, 0x28, 0x80, 0x05, 0x0a, 0x87, 
+  0x1a, 0xc7, 0x01, 0xe5, 0x2b, 0x2a, 0x9d, 0xd6, 0xbe, 0x79, 0x41, 0xd7, 0x5d, 0x00, 0xc6, 0xfb, 
+  0x41, 0xcf, 0x1c, 0x02, 0xd7, 0x5c, 0x43, 0x6c, 0x01, 0xa5, 0x80, 0x01, 0x01, 0xa6, 0x01, 0xc6, 
+  0x41, 0x01, 0xe6, 0x13, 0x09, 0x24, 0x83, 0xee, 0xb5, 0x94, 0x9c, 0xb1, 0x52, 0x48, 0x41, 0x85, 
+  0x00, 0x00, 0x31, 0x87, 0x39, 0xc9, 0x21, 0x26, 0x42, 0x0a, 0x3a, 0x0a, 0x21, 0x07, 0x19, 0x07, 
+  0x10, 0xa6, 0x4a, 0x4b, 0x6b, 0x4e, 0x94, 0x71, 0x9c, 0xd1, 0xb5, 0x72, 0x41, 0xbd, 0xb3, 0x80, 
+  0x00, 0xb5, 0xb3, 0x41, 0xbd, 0xd4, 0x02, 0xa4, 0xb1, 0x7a, 0xaa, 0x7a, 0x8a, 0x41, 0x7a, 0x6a, 
+  0x80, 0x15, 0x82, 0x2a, 0x49, 0x68, 0x72, 0x09, 0x82, 0x6b, 0x59, 0xc9, 0x41, 0x07, 0x61, 0xc9, 
+  0x82, 0x6b, 0x69, 0xe9, 0x20, 0xa3, 0x00, 0x81, 0x09, 0x64, 0x0a, 0x05, 0x0a, 0xe7, 0x13, 0x67, 
+  0x1b, 0x88, 0x0a, 0xc6, 0x2a, 0xc9, 0x43, 0x2b, 0xb6, 0x59, 0xc7, 0x1b, 0xcf, 0x1c, 0x80, 0x0a, 
+  0xdf, 0xbe, 0xcf, 0x3c, 0x43, 0xcc, 0x0a, 0xc7, 0x12, 0xc8, 0x0a, 0x67, 0x02, 0x06, 0x01, 0xc6, 
+  0x01, 0xc5, 0x09, 0xe5, 0x23, 0x28, 0x80, 0x03, 0x1b, 0x68, 0x23, 0xa8, 0x1a, 0xe7, 0x01, 0xa6, 
+  0x4c, 0x01, 0xc6, 0x80, 0x42, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x86, 0x01, 0x02, 0x05, 0x1b, 0x47, 
+  0x80, 0x03, 0x1a, 0xc6, 0x2b, 0x48, 0x1a, 0xe7, 0x0a, 0x46, 0x41, 0x0a, 0x66, 0x41, 0x0a, 0x46, 
+  0x07, 0x0a, 0x66, 0x12, 0xa7, 0x12, 0xc7, 0x1a, 0x87, 0x9d, 0x95, 0xcf, 0x1b, 0xc6, 0xfb, 0xc7, 
+  0x1b, 0x80, 0x05, 0xd7, 0x3c, 0xbe, 0xb9, 0x64, 0x4f, 0x11, 0xe5, 0x7d, 0x32, 0xbe, 0xd9, 0x41, 
+  0xdf, 0x7d, 0x0b, 0xce, 0xfb, 0xd7, 0x1c, 0xdf, 0x5d, 0xce, 0xfb, 0xc6, 0xdb, 0xc6, 0xda, 0x4b, 
+  0x4c, 0x1a, 0x47, 0x01, 0xc4, 0x02, 0x05, 0x12, 0x67, 0x0a, 0x66, 0x41, 0x0a, 0x46, 0x48, 0x12, 
+  0x47, 0x56, 0x1b, 0x08, 0x41, 0x1a, 0xe8, 0x01, 0x1b, 0x08, 0x1a, 0xe8, 0x4d, 0x1b, 0x08, 0x00, 
+  0x1b, 0x28, 0x80, 0x0e, 0x02, 0x06, 0x0a, 0x06, 0x01, 0xe6, 0x12, 0x87, 0x1a, 0xe7, 0x02, 0x26, 
+  0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x06, 0x1a, 0xc7, 0x0a, 0x46, 0x01, 0xe5, 0x02, 0x26, 0x1b, 0x48, 
+  0x02, 0x06, 0x80, 0x00, 0x12, 0xc7, 0x81, 0x00, 0x0a, 0x86, 0x82, 0x00, 0x1b, 0x08, 0x84, 0x00, 
+  0x1b, 0x28, 0x80, 0x01, 0x12, 0x87, 0x1a, 0xe8, 0x80, 0x09, 0x23, 0x48, 0x12, 0x26, 0x11, 0xc6, 
+  0x7c, 0xb2, 0x9d, 0xd7, 0xe7, 0xbe, 0xd7, 0x5c, 0xc6, 0xfb, 0xe7, 0xde, 0x43, 0xad, 0x80, 0x00, 
+  0x09, 0xe7, 0x42, 0x01, 0xa6, 0x15, 0x01, 0xc6, 0x08, 0xe3, 0x4a, 0x6a, 0x63, 0x2d, 0x94, 0xb1, 
+  0xc6, 0x58, 0x9c, 0xd2, 0x52, 0x8a, 0x18, 0xc4, 0x21, 0x05, 0x42, 0x2a, 0x29, 0x68, 0x31, 0x88, 
+  0x42, 0x2b, 0x42, 0x4c, 0x31, 0xaa, 0x21, 0x09, 0x00, 0x05, 0x4a, 0x4c, 0x73, 0xaf, 0xad, 0x53, 
+  0xb5, 0x93, 0x41, 0xbd, 0xb3, 0x05, 0xbd, 0xf4, 0xb5, 0x73, 0x9c, 0x50, 0x7a, 0x6a, 0x7a, 0x29, 
+  0x7a, 0x4a, 0x41, 0x82, 0x4a, 0x21, 0x7a, 0x4a, 0x82, 0x4a, 0x49, 0x88, 0x51, 0xa9, 0x49, 0x47, 
+  0x49, 0x48, 0x72, 0x6b, 0x6a, 0x09, 0x51, 0x87, 0x21, 0x04, 0x01, 0x44, 0x0a, 0x06, 0x09, 0xe5, 
+  0x12, 0x86, 0x13, 0x47, 0x13, 0x07, 0x0b, 0x07, 0x23, 0x48, 0xae, 0x78, 0xdf, 0x7d, 0xcf, 0x1c, 
+  0xc6, 0xfb, 0xcf, 0x5d, 0xb6, 0xba, 0x85, 0x13, 0x43, 0x8c, 0x0a, 0xa7, 0x1b, 0x69, 0x23, 0xca, 
+  0x1b, 0x69, 0x0a, 0x87, 0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x06, 0x80, 0x01, 0x1b, 0x06, 0x13, 0x07, 
+  0x80, 0x00, 0x1b, 0x07, 0x47, 0x01, 0xc6, 0x46, 0x01, 0xe6, 0x43, 0x01, 0xc6, 0x00, 0x01, 0xe6, 
+  0x85, 0x08, 0x02, 0x06, 0x23, 0x68, 0x12, 0xc5, 0x0a, 0x44, 0x23, 0x47, 0x23, 0x68, 0x1a, 0xe7, 
+  0x1b, 0x07, 0x1a, 0xe7, 0x41, 0x1a, 0xa7, 0x04, 0x1b, 0x08, 0x1b, 0x28, 0x33, 0xaa, 0xb6, 0xb8, 
+  0xd7, 0x3c, 0x80, 0x00, 0xc7, 0x1b, 0x41, 0xcf, 0x1b, 0x14, 0x74, 0x71, 0x33, 0x2a, 0x12, 0xc7, 
+  0x1b, 0x28, 0x23, 0x69, 0x33, 0xaa, 0x8d, 0x34, 0x9d, 0x96, 0xdf, 0x7d, 0xd7, 0x5d, 0xce, 0xfb, 
+  0xd7, 0x1c, 0xd7, 0x3c, 0xcf, 0x3c, 0xd7, 0x5c, 0xb6, 0x99, 0x64, 0xd0, 0x4c, 0x2d, 0x02, 0x65, 
+  0x12, 0xc7, 0x1b, 0x08, 0x42, 0x1a, 0xe8, 0x46, 0x1a, 0xc8, 0x47, 0x01, 0xa5, 0x4f, 0x01, 0xc5, 
+  0x03, 0x01, 0xa5, 0x01, 0xc5, 0x01, 0xa5, 0x01, 0xc5, 0x47, 0x01, 0xa5, 0x46, 0x01, 0xc5, 0x41, 
+  0x01, 0xe6, 0x03, 0x12, 0xa7, 0x1a, 0xe8, 0x0a, 0x06, 0x09, 0xe6, 0x80, 0x03, 0x0a, 0x26, 0x12, 
+  0x87, 0x0a, 0x06, 0x01, 0xa5, 0x80, 0x02, 0x12, 0xa7, 0x1a, 0xc7, 0x01, 0xe6, 0x82, 0x00, 0x12, 
+  0xe8, 0x84, 0x41, 0x01, 0xe5, 0x80, 0x00, 0x0a, 0x46, 0x81, 0x00, 0x01, 0xc5, 0x81, 0x0c, 0x01, 
+  0xc5, 0x1b, 0x08, 0x0a, 0x46, 0x01, 0xa5, 0x01, 0x44, 0x1a, 0x69, 0x74, 0xb2, 0xa6, 0x17, 0xe7, 
+  0xff, 0x9d, 0xb6, 0x22, 0x89, 0x01, 0xc6, 0x09, 0xe6, 0x43, 0x01, 0xa6, 0x1a, 0x09, 0x24, 0x18, 
+  0xe4, 0x31, 0x87, 0x63, 0x2e, 0x73, 0xaf, 0xa5, 0x34, 0xd6, 0xba, 0xa5, 0x14, 0x29, 0x66, 0x00, 
+  0x00, 0x21, 0x06, 0x39, 0xe9, 0x21, 0x48, 0x39, 0xca, 0x4a, 0x4c, 0x5a, 0xcd, 0x42, 0x0a, 0x21, 
+  0x28, 0x08, 0x45, 0x31, 0x88, 0x5a, 0xcc, 0xb5, 0x74, 0xa5, 0x33, 0x9c, 0xb1, 0x8b, 0x6d, 0x7a, 
+  0x29, 0x7a, 0x49, 0x80, 0x00, 0x82, 0x49, 0x41, 0x8a, 0x8b, 0x03, 0x82, 0x6b, 0x7a, 0x2a, 0x41, 
+  0x48, 0x41, 0x68, 0x80, 0x05, 0x62, 0x0a, 0x41, 0x66, 0x20, 0xe4, 0x00, 0xa2, 0x09, 0xa5, 0x0a, 
+  0x06, 0x41, 0x01, 0xe6, 0x12, 0x0a, 0x46, 0x0a, 0x86, 0x01, 0xc4, 0x12, 0x46, 0x95, 0x95, 0xcf, 
+  0x1c, 0xc6, 0xfb, 0xcf, 0x1b, 0xdf, 0xbe, 0xbe, 0xba, 0x43, 0x2b, 0x01, 0x03, 0x01, 0xa5, 0x02, 
+  0x07, 0x02, 0x47, 0x02, 0x67, 0x1b, 0x28, 0x1b, 0x69, 0x02, 0x06, 0x41, 0x01, 0xe6, 0x02, 0x12, 
+  0x66, 0x23, 0x47, 0x23, 0x88, 0x80, 0x00, 0x12, 0x87, 0x82, 0x00, 0x01, 0xe6, 0x8f, 0x45, 0x01, 
+  0xe6, 0x80, 0x05, 0x1b, 0x27, 0x2b, 0xe9, 0x2b, 0xa8, 0x23, 0x68, 0x0a, 0x46, 0x01, 0xa5, 0x41, 
+  0x01, 0xc5, 0x00, 0x01, 0x85, 0x41, 0x01, 0xa5, 0x0a, 0x09, 0xc5, 0x8d, 0x74, 0xd7, 0x5d, 0xcf, 
+  0x1b, 0xce, 0xfb, 0xcf, 0x1b, 0xcf, 0x3c, 0x6c, 0x2f, 0x01, 0x03, 0x01, 0xc5, 0x0a, 0x27, 0x41, 
+  0x02, 0x47, 0x06, 0x02, 0x06, 0x01, 0x85, 0x11, 0xe6, 0x64, 0x0f, 0x84, 0xf3, 0xdf, 0x9e, 0xd7, 
+  0x3c, 0x41, 0xce, 0xfb, 0x0a, 0xcf, 0x1b, 0xcf, 0x1c, 0xdf, 0x9d, 0xb6, 0x99, 0x74, 0xd1, 0x3b, 
+  0x4b, 0x01, 0x03, 0x01, 0xc5, 0x01, 0xc6, 0x01, 0xa5, 0x01, 0xa6, 0x45, 0x01, 0xc6, 0x44, 0x1a, 
+  0xc8, 0x42, 0x12, 0xc8, 0x45, 0x1a, 0xc8, 0x02, 0x12, 0xc8, 0x1a, 0xc8, 0x12, 0xc8, 0x41, 0x12, 
+  0xe8, 0x41, 0x1a, 0xc8, 0x01, 0x12, 0xc8, 0x1a, 0xc8, 0x44, 0x12, 0xc8, 0x02, 0x12, 0xe8, 0x1a, 
+  0xe8, 0x1a, 0xc8, 0x41, 0x1a, 0xe8, 0x00, 0x1a, 0xc8, 0x41, 0x12, 0xc8, 0x02, 0x1a, 0xe8, 0x12, 
+  0xe8, 0x1a, 0xe8, 0x44, 0x12, 0xc8, 0x02, 0x1a, 0xe8, 0x1b, 0x08, 0x0a, 0x26, 0x41, 0x09, 0xe6, 
+  0x09, 0x0a, 0x26, 0x1a, 0xe7, 0x0a, 0x46, 0x01, 0xa5, 0x01, 0xe5, 0x12, 0xa7, 0x1a, 0xe7, 0x0a, 
+  0x06, 0x01, 0xc5, 0x12, 0x86, 0x80, 0x01, 0x01, 0xa5, 0x1a, 0xe8, 0x83, 0x00, 0x1b, 0x07, 0x41, 
+  0x01, 0xe6, 0x80, 0x00, 0x0a, 0x66, 0x85, 0x00, 0x1a, 0xe8, 0x80, 0x00, 0x01, 0xc6, 0x41, 0x0a, 
+  0x07, 0x06, 0x01, 0x24, 0x2a, 0xca, 0x74, 0xb2, 0x1a, 0x48, 0x01, 0x85, 0x09, 0xe7, 0x01, 0xe6, 
+  0x41, 0x01, 0xc6, 0x81, 0x0d, 0x09, 0xe6, 0x09, 0x64, 0x08, 0x82, 0x31, 0x87, 0x5b, 0x0d, 0x5a, 
+  0xed, 0x6b, 0x8f, 0x94, 0xd3, 0x9d, 0x13, 0x73, 0xae, 0x5a, 0xec, 0x08, 0x42, 0x29, 0x67, 0x39, 
+  0xe9, 0x41, 0x31, 0xa9, 0x08, 0x39, 0xea, 0x39, 0xa9, 0x7b, 0xd0, 0x8c, 0x51, 0x6b, 0x6e, 0x29, 
+  0x46, 0x31, 0x67, 0x62, 0x08, 0x82, 0x29, 0x41, 0x7a, 0x49, 0x01, 0x82, 0x6a, 0x72, 0x29, 0x41, 
+  0x41, 0x25, 0x08, 0x61, 0xa8, 0x82, 0x4b, 0x61, 0xc9, 0x7a, 0x4a, 0x72, 0x2a, 0x28, 0xe4, 0x00, 
+  0x00, 0x09, 0x24, 0x09, 0xe7, 0x42, 0x01, 0xe6, 0x0b, 0x0a, 0x06, 0x0a, 0x26, 0x01, 0xa4, 0x32, 
+  0xe9, 0x95, 0xd6, 0xcf, 0x5c, 0xc6, 0xfb, 0xd7, 0x3c, 0xce, 0xfb, 0x74, 0x91, 0x43, 0x4c, 0x01, 
+  0x23, 0x41, 0x09, 0xe7, 0x80, 0x00, 0x0a, 0x27, 0x41, 0x02, 0x27, 0x07, 0x13, 0x08, 0x12, 0xe7, 
+  0x02, 0x26, 0x02, 0x07, 0x01, 0xc5, 0x0a, 0x26, 0x12, 0x86, 0x12, 0x66, 0x44, 0x01, 0xc6, 0x00, 
+  0x01, 0xe6, 0x81, 0x47, 0x01, 0xe6, 0x82, 0x45, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x41, 0x01, 0xe6, 
+  0x00, 0x0a, 0x46, 0x41, 0x1b, 0x07, 0x01, 0x12, 0xa7, 0x01, 0xc6, 0x41, 0x09, 0xc6, 0x0e, 0x01, 
+  0xe6, 0x09, 0xc7, 0x01, 0x44, 0x09, 0x85, 0x8d, 0x54, 0xdf, 0x7d, 0xcf, 0x1c, 0xd7, 0x3c, 0xe7, 
+  0x9e, 0xdf, 0x7d, 0x63, 0xce, 0x01, 0x03, 0x09, 0xa6, 0x09, 0xc6, 0x0a, 0x06, 0x42, 0x02, 0x07, 
+  0x12, 0x0a, 0x07, 0x01, 0xe6, 0x01, 0x24, 0x11, 0xe7, 0x5b, 0xce, 0xa5, 0xf7, 0xdf, 0x9e, 0xd7, 
+  0x5d, 0xcf, 0x1c, 0xcf, 0x1b, 0xce, 0xfb, 0xd7, 0x3c, 0xef, 0xdf, 0xbe, 0x79, 0x7c, 0xb2, 0x1a, 
+  0x07, 0x01, 0x23, 0x01, 0xa6, 0x09, 0xc6, 0x41, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x01, 0x09, 0xe7, 
+  0x0a, 0x07, 0x41, 0x12, 0x88, 0x41, 0x12, 0xa8, 0x00, 0x12, 0x88, 0x41, 0x12, 0x87, 0x00, 0x12, 
+  0xa7, 0x42, 0x12, 0x87, 0x00, 0x12, 0x88, 0x47, 0x12, 0x87, 0x41, 0x12, 0xa7, 0x47, 0x12, 0x87, 
+  0x43, 0x12, 0xa7, 0x00, 0x12, 0x87, 0x44, 0x12, 0xa7, 0x43, 0x12, 0x87, 0x02, 0x12, 0xa7, 0x0a, 
+  0x26, 0x02, 0x06, 0x41, 0x0a, 0x06, 0x01, 0x1a, 0xc7, 0x0a, 0x26, 0x41, 0x01, 0xe6, 0x00, 0x12, 
+  0x87, 0x80, 0x04, 0x02, 0x06, 0x01, 0xe6, 0x0a, 0x06, 0x1a, 0xe8, 0x12, 0xa7, 0x80, 0x01, 0x1b, 
+  0x08, 0x12, 0xa7, 0x80, 0x00, 0x01, 0xe5, 0x80, 0x00, 0x1b, 0x08, 0x82, 0x00, 0x0a, 0x67, 0x80, 
+  0x00, 0x23, 0x28, 0x82, 0x00, 0x01, 0xa5, 0x82, 0x41, 0x09, 0xe6, 0x06, 0x0a, 0x07, 0x01, 0xa6, 
+  0x01, 0x64, 0x01, 0xa6, 0x09, 0xe6, 0x01, 0xc6, 0x09, 0xc6, 0x41, 0x01, 0xe6, 0x41, 0x01, 0xc6, 
+  0x1c, 0x1a, 0xc6, 0x2b, 0x68, 0x11, 0xa5, 0x08, 0xc3, 0x18, 0xe4, 0x10, 0xa3, 0x39, 0xe8, 0x52, 
+  0xac, 0x6b, 0x4e, 0x94, 0xb2, 0xad, 0x55, 0x94, 0x92, 0x52, 0xab, 0x00, 0x22, 0x21, 0x25, 0x31, 
+  0xc9, 0x42, 0x2b, 0x39, 0x88, 0xe7, 0x1a, 0xff, 0xff, 0xe6, 0xfa, 0xa4, 0xf3, 0x6a, 0xca, 0x69, 
+  0x64, 0x92, 0x89, 0x72, 0x29, 0x82, 0x6a, 0x69, 0xe8, 0x30, 0xe4, 0x41, 0x00, 0x00, 0x17, 0x20, 
+  0x85, 0x72, 0x2b, 0x8a, 0x6b, 0x49, 0x26, 0x20, 0x83, 0x00, 0xa2, 0x09, 0x44, 0x09, 0xa5, 0x01, 
+  0xa5, 0x01, 0xc6, 0x09, 0xe6, 0x09, 0xe7, 0x09, 0xe6, 0x01, 0x64, 0x2a, 0xa9, 0xb6, 0x99, 0xcf, 
+  0x5c, 0xc6, 0xdb, 0xc7, 0x1b, 0xd7, 0x5d, 0x64, 0x0f, 0x01, 0x84, 0x01, 0xc5, 0x09, 0xc6, 0x42, 
+  0x01, 0xc6, 0x01, 0x01, 0xe6, 0x02, 0x07, 0x80, 0x05, 0x0a, 0x67, 0x1b, 0x48, 0x12, 0xe8, 0x02, 
+  0x06, 0x09, 0xe6, 0x01, 0xa5, 0x41, 0x01, 0xa6, 0x83, 0x42, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x84, 
+  0x00, 0x01, 0xc6, 0x89, 0x43, 0x01, 0xe6, 0x00, 0x02, 0x06, 0x41, 0x02, 0x26, 0x01, 0x02, 0x06, 
+  0x09, 0xe6, 0x80, 0x05, 0x01, 0xa6, 0x01, 0x65, 0x6c, 0x30, 0x9d, 0x95, 0xd7, 0x5d, 0xcf, 0x1b, 
+  0x41, 0xcf, 0x3c, 0x03, 0x85, 0x13, 0x5c, 0x0f, 0x01, 0x65, 0x01, 0xa6, 0x41, 0x01, 0xc6, 0x45, 
+  0x01, 0xe6, 0x41, 0x09, 0xe6, 0x06, 0x01, 0x44, 0x2a, 0x89, 0x4b, 0x8d, 0x53, 0xae, 0xce, 0xfb, 
+  0xdf, 0x7d, 0xd7, 0x1c, 0x41, 0xd7, 0x3c, 0x07, 0xdf, 0x5d, 0xe7, 0x9e, 0x9d, 0x75, 0x7c, 0xd2, 
+  0x11, 0xa6, 0x01, 0x44, 0x01, 0x85, 0x01, 0xc6, 0x80, 0x42, 0x0a, 0x07, 0x6c, 0x01, 0xe6, 0x05, 
+  0x0a, 0x06, 0x0a, 0x26, 0x0a, 0x46, 0x1a, 0xe8, 0x0a, 0x46, 0x01, 0xc5, 0x80, 0x41, 0x12, 0x87, 
+  0x0c, 0x01, 0xe6, 0x01, 0xc6, 0x09, 0xe6, 0x23, 0x08, 0x1a, 0xe7, 0x0a, 0x05, 0x01, 0xe6, 0x0a, 
+  0x46, 0x1b, 0x28, 0x12, 0x87, 0x01, 0xe6, 0x0a, 0x66, 0x1a, 0xe7, 0x82, 0x00, 0x0a, 0x46, 0x83, 
+  0x00, 0x12, 0xc8, 0x83, 0x42, 0x01, 0xe6, 0x41, 0x09, 0xe7, 0x02, 0x09, 0xe6, 0x01, 0xc6, 0x01, 
+  0xe6, 0x42, 0x09, 0xe6, 0x27, 0x01, 0xe6, 0x12, 0x87, 0x2b, 0xc8, 0x23, 0x07, 0x12, 0x06, 0x09, 
+  0xa5, 0x09, 0x44, 0x09, 0x84, 0x09, 0x03, 0x29, 0x86, 0x4a, 0x6b, 0x4a, 0x8b, 0x6b, 0x6e, 0x94, 
+  0xf4, 0xad, 0x75, 0x94, 0xb2, 0x4a, 0x6a, 0x10, 0xa4, 0x20, 0xe6, 0x28, 0xe6, 0xd6, 0x16, 0xff, 
+  0x59, 0xff, 0x38, 0xff, 0xda, 0xe5, 0xcf, 0xc3, 0xc7, 0x9a, 0xc9, 0x7a, 0x29, 0x72, 0x4a, 0x20, 
+  0xc5, 0x08, 0x64, 0x18, 0xc6, 0x20, 0xe6, 0x10, 0x85, 0x28, 0xe6, 0x28, 0xe5, 0x08, 0xe4, 0x01, 
+  0x44, 0x09, 0xc6, 0x09, 0xc5, 0x41, 0x01, 0xa5, 0x07, 0x09, 0xa6, 0x01, 0xa6, 0x01, 0x85, 0x22, 
+  0x68, 0x9d, 0xb6, 0xb6, 0x79, 0xd7, 0x5c, 0xc6, 0xdb, 0x41, 0xcf, 0x1c, 0x05, 0x53, 0x8d, 0x01, 
+  0xc5, 0x0a, 0x47, 0x0a, 0x46, 0x02, 0x06, 0x01, 0xe5, 0x41, 0x01, 0xc5, 0x42, 0x01, 0xe6, 0x03, 
+  0x02, 0x06, 0x02, 0x46, 0x23, 0x49, 0x12, 0xc7, 0x41, 0x01, 0xe6, 0x43, 0x01, 0xc6, 0x48, 0x01, 
+  0xe6, 0x46, 0x01, 0xc6, 0x45, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x82, 0x12, 0x02, 0x26, 0x1b, 0x08, 
+  0x23, 0x89, 0x1b, 0x48, 0x02, 0x67, 0x02, 0x27, 0x01, 0xe6, 0x09, 0xa6, 0x84, 0xf3, 0xd7, 0x5c, 
+  0xdf, 0x7d, 0xcf, 0x1b, 0xcf, 0x1c, 0xd7, 0x7d, 0x85, 0x33, 0x01, 0xc4, 0x01, 0xe5, 0x0a, 0x06, 
+  0x01, 0xe6, 0x80, 0x44, 0x01, 0xe6, 0x43, 0x02, 0x06, 0x12, 0x0a, 0x07, 0x01, 0xc5, 0x01, 0xa4, 
+  0x01, 0xc5, 0x2a, 0xea, 0x64, 0x0f, 0xcf, 0x1b, 0xce, 0xfb, 0xcf, 0x1b, 0xcf, 0x1c, 0xc6, 0xda, 
+  0xd7, 0x3c, 0xd7, 0x5d, 0xae, 0x17, 0xae, 0x18, 0x74, 0x71, 0x01, 0x85, 0x0a, 0x26, 0x02, 0x26, 
+  0x41, 0x0a, 0x47, 0x01, 0x1b, 0x08, 0x1a, 0xe8, 0x44, 0x1b, 0x08, 0x45, 0x1a, 0xe8, 0x44, 0x1b, 
+  0x08, 0x44, 0x1a, 0xe8, 0x00, 0x1b, 0x08, 0x42, 0x1a, 0xe8, 0x50, 0x1b, 0x08, 0x00, 0x1a, 0xe8, 
+  0x41, 0x1b, 0x08, 0x0a, 0x1b, 0x28, 0x0a, 0x67, 0x02, 0x06, 0x0a, 0x26, 0x12, 0xa7, 0x1a, 0xc8, 
+  0x0a, 0x06, 0x01, 0xc5, 0x01, 0xe5, 0x1a, 0xc7, 0x1a, 0xe7, 0x41, 0x01, 0xe6, 0x03, 0x02, 0x26, 
+  0x1a, 0xe7, 0x12, 0x66, 0x0a, 0x06, 0x80, 0x01, 0x0a, 0x46, 0x1a, 0xe8, 0x82, 0x00, 0x0a, 0x47, 
+  0x83, 0x00, 0x1a, 0xe8, 0x81, 0x00, 0x0a, 0x47, 0x83, 0x01, 0x09, 0xe6, 0x01, 0xe6, 0x41, 0x01, 
+  0xc6, 0x82, 0x04, 0x01, 0xe6, 0x12, 0x86, 0x2b, 0xa8, 0x2b, 0x67, 0x12, 0x25, 0x41, 0x01, 0xa5, 
+  0x2b, 0x12, 0x26, 0x2b, 0x67, 0x22, 0xc6, 0x11, 0x44, 0x10, 0xa3, 0x31, 0xa7, 0x3a, 0x09, 0x39, 
+  0xe9, 0x52, 0xec, 0x8c, 0x72, 0xb5, 0x96, 0x9c, 0xf3, 0x73, 0x4d, 0x28, 0xe5, 0x49, 0xe7, 0xbc, 
+  0x8d, 0xcd, 0x0d, 0xee, 0x2e, 0xe5, 0x6c, 0xe4, 0xcc, 0x92, 0xe9, 0x61, 0xe9, 0x20, 0xa4, 0x10, 
+  0xa6, 0x18, 0xc7, 0x21, 0x28, 0x31, 0x69, 0x18, 0xa5, 0x08, 0x63, 0x09, 0x44, 0x09, 0xe7, 0x0a, 
+  0x07, 0x09, 0xe6, 0x01, 0xc6, 0x09, 0xc6, 0x09, 0xa6, 0x01, 0x65, 0x09, 0xc6, 0x22, 0x28, 0xb6, 
+  0x38, 0xdf, 0x9d, 0xd7, 0x5c, 0xcf, 0x1c, 0xd7, 0x5c, 0x80, 0x02, 0x64, 0x70, 0x1a, 0xc7, 0x1a, 
+  0xe8, 0x42, 0x1b, 0x48, 0x41, 0x1b, 0x28, 0x41, 0x1b, 0x08, 0x00, 0x1a, 0xe7, 0x80, 0x04, 0x01, 
+  0xc6, 0x01, 0xe6, 0x0a, 0x26, 0x1b, 0x28, 0x12, 0x87, 0x80, 0x00, 0x09, 0xc6, 0x87, 0x41, 0x01, 
+  0xe7, 0x42, 0x01, 0xe6, 0x8b, 0x42, 0x01, 0xe6, 0x0b, 0x01, 0xc6, 0x1a, 0xe8, 0x0a, 0xa6, 0x0a, 
+  0x86, 0x23, 0xa9, 0x1b, 0x68, 0x13, 0x28, 0x1a, 0xe8, 0x8d, 0x74, 0xdf, 0x7d, 0xcf, 0x1c, 0xce, 
+  0xfb, 0x41, 0xd7, 0x3c, 0x00, 0xa6, 0x17, 0x41, 0x23, 0x49, 0x02, 0x23, 0x6a, 0x23, 0x49, 0x1b, 
+  0x29, 0x45, 0x1b, 0x08, 0x44, 0x1b, 0x28, 0x42, 0x1b, 0x29, 0x04, 0x12, 0xc7, 0x1b, 0x08, 0x3c, 
+  0x0c, 0x33, 0xca, 0x75, 0x32, 0x41, 0xd7, 0x3c, 0x09, 0xcf, 0x1c, 0xc6, 0xdb, 0xcf, 0x1c, 0xd7, 
+  0x5c, 0xc6, 0xdb, 0xbe, 0x99, 0x6c, 0xf1, 0x2b, 0x8a, 0x23, 0x69, 0x1b, 0x29, 0x00, 0x0a, 0x46, 
+  0x41, 0x0a, 0x66, 0x46, 0x0a, 0x46, 0x41, 0x0a, 0x66, 0x41, 0x0a, 0x46, 0x41, 0x0a, 0x66, 0x49, 
+  0x0a, 0x46, 0x44, 0x0a, 0x66, 0x46, 0x0a, 0x46, 0x00, 0x0a, 0x66, 0x46, 0x0a, 0x46, 0x41, 0x0a, 
+  0x66, 0x41, 0x0a, 0x67, 0x00, 0x12, 0xc8, 0x80, 0x02, 0x0a, 0x06, 0x01, 0xe6, 0x0a, 0x06, 0x41, 
+  0x1a, 0xc7, 0x00, 0x01, 0xc5, 0x80, 0x04, 0x02, 0x06, 0x1a, 0xe8, 0x12, 0xa7, 0x02, 0x06, 0x09, 
+  0xe6, 0x80, 0x03, 0x12, 0x67, 0x1a, 0xc7, 0x01, 0xc6, 0x01, 0xc5, 0x80, 0x00, 0x0a, 0x67, 0x8a, 
+  0x03, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x14, 0x09, 0xc6, 0x01, 
+  0xc5, 0x12, 0xa7, 0x2b, 0x87, 0x23, 0x27, 0x0a, 0x05, 0x09, 0xc6, 0x01, 0xc5, 0x12, 0x45, 0x23, 
+  0x47, 0x23, 0x67, 0x1a, 0x86, 0x09, 0xc5, 0x2a, 0x67, 0x11, 0x03, 0x00, 0x41, 0x08, 0x41, 0x29, 
+  0x46, 0x39, 0xe8, 0x63, 0x2d, 0x9c, 0xb3, 0x41, 0xbd, 0xb5, 0x09, 0x9c, 0x90, 0x31, 0x04, 0x51, 
+  0x85, 0xc4, 0x2a, 0x9b, 0x09, 0x7a, 0x6a, 0x49, 0xc9, 0x10, 0x64, 0x00, 0x21, 0x18, 0xc6, 0x80, 
+  0x04, 0x4a, 0x6b, 0x7b, 0xd0, 0x20, 0xe5, 0x00, 0x22, 0x09, 0xa6, 0x80, 0x01, 0x01, 0xe7, 0x09, 
+  0xe7, 0x41, 0x0a, 0x07, 0x05, 0x01, 0x85, 0x11, 0x86, 0x95, 0x75, 0xc6, 0xfb, 0xd7, 0x3c, 0xce, 
+  0xfb, 0x41, 0xd7, 0x3c, 0x05, 0x9d, 0x96, 0x32, 0xea, 0x01, 0xc5, 0x09, 0xe6, 0x0a, 0x06, 0x02, 
+  0x26, 0x41, 0x0a, 0x26, 0x00, 0x0a, 0x46, 0x41, 0x0a, 0x26, 0x08, 0x02, 0x26, 0x0a, 0x46, 0x12, 
+  0xa7, 0x09, 0xe6, 0x01, 0xa6, 0x01, 0xc6, 0x0a, 0x06, 0x1a, 0xe8, 0x12, 0x46, 0x83, 0x00, 0x01, 
+  0xc6, 0x86, 0x4a, 0x01, 0xc6, 0x84, 0x07, 0x01, 0xc6, 0x01, 0xc5, 0x1a, 0xe7, 0x0a, 0x66, 0x0a, 
+  0x45, 0x13, 0x26, 0x13, 0x07, 0x75, 0x31, 0x42, 0xd7, 0x3c, 0x80, 0x05, 0xdf, 0x7d, 0xad, 0xf7, 
+  0x32, 0xca, 0x1a, 0x48, 0x01, 0xc5, 0x0a, 0x06, 0x42, 0x0a, 0x26, 0x47, 0x0a, 0x06, 0x42, 0x0a, 
+  0x26, 0x41, 0x02, 0x06, 0x00, 0x0a, 0x06, 0x41, 0x0a, 0x26, 0x0e, 0x02, 0x06, 0x02, 0x05, 0x09, 
+  0x84, 0x74, 0x71, 0xb6, 0x79, 0xad, 0xf7, 0xce, 0xfb, 0xd7, 0x3c, 0xc6, 0xda, 0xcf, 0x1b, 0xdf, 
+  0x5d, 0xd7, 0x3c, 0xd7, 0x5c, 0x4b, 0xad, 0x1a, 0x67, 0x00, 0x1a, 0xe8, 0x41, 0x1b, 0x08, 0x48, 
+  0x1a, 0xe8, 0x43, 0x1b, 0x08, 0x5f, 0x1a, 0xe8, 0x02, 0x1b, 0x08, 0x1b, 0x28, 0x12, 0xa7, 0x41, 
+  0x09, 0xe6, 0x0a, 0x0a, 0x26, 0x1b, 0x08, 0x1a, 0xe8, 0x01, 0xc5, 0x01, 0xc6, 0x02, 0x06, 0x1a, 
+  0xc7, 0x12, 0x67, 0x01, 0xe6, 0x0a, 0x06, 0x01, 0xe6, 0x41, 0x1a, 0xc7, 0x00, 0x01, 0xe6, 0x82, 
+  0x02, 0x0a, 0x46, 0x02, 0x05, 0x1b, 0x08, 0x81, 0x00, 0x1a, 0xe7, 0x81, 0x00, 0x0a, 0x67, 0x82, 
+  0x42, 0x01, 0xe6, 0x00, 0x09, 0xc6, 0x81, 0x19, 0x01, 0xa6, 0x12, 0x86, 0x2b, 0x87, 0x2b, 0x47, 
+  0x0a, 0x05, 0x01, 0xc5, 0x0a, 0x06, 0x12, 0x86, 0x23, 0x67, 0x23, 0xa7, 0x1a, 0xe6, 0x0a, 0x05, 
+  0x09, 0xe6, 0x1a, 0x67, 0x1a, 0x06, 0x11, 0x65, 0x08, 0xc3, 0x08, 0x82, 0x21, 0x24, 0x4a, 0x29, 
+  0x5a, 0xac, 0x5b, 0x0d, 0x7b, 0xef, 0x8c, 0x30, 0xad, 0x53, 0x9c, 0x70, 0x41, 0x49, 0xc7, 0x03, 
+  0x39, 0xa7, 0x31, 0x89, 0x10, 0x84, 0x00, 0x00, 0x80, 0x14, 0x21, 0x08, 0x63, 0x2e, 0x8c, 0x31, 
+  0x21, 0x06, 0x00, 0x01, 0x09, 0x65, 0x09, 0xc6, 0x01, 0xc6, 0x0a, 0x07, 0x02, 0x06, 0x01, 0xc5, 
+  0x09, 0xa6, 0x9d, 0x75, 0xd7, 0x7d, 0xcf, 0x3c, 0xc6, 0xfb, 0xd7, 0x5d, 0xdf, 0x5d, 0x63, 0xef, 
+  0x01, 0x44, 0x01, 0xa5, 0x47, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x04, 0x01, 0xc6, 0x0a, 0x47, 0x1a, 
+  0xa7, 0x01, 0xc6, 0x01, 0xa6, 0x41, 0x09, 0xe6, 0x02, 0x12, 0x87, 0x12, 0x67, 0x01, 0xc5, 0x84, 
+  0x43, 0x01, 0xe7, 0x89, 0x44, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x80, 0x06, 0x01, 0xa5, 0x12, 0x87, 
+  0x1b, 0x48, 0x1b, 0x07, 0x33, 0x8a, 0x6c, 0xb0, 0xd7, 0x5c, 0x80, 0x06, 0xd7, 0x1c, 0xd7, 0x1b, 
+  0xdf, 0x5d, 0x9d, 0x95, 0x11, 0xe7, 0x01, 0xa5, 0x01, 0xa6, 0x53, 0x01, 0xc6, 0x02, 0x09, 0xc6, 
+  0x09, 0xe7, 0x09, 0xc6, 0x41, 0x01, 0x85, 0x41, 0x09, 0x85, 0x04, 0x8d, 0x14, 0xb6, 0x59, 0xdf, 
+  0x7d, 0xdf, 0x5d, 0xce, 0xfb, 0x41, 0xd7, 0x1c, 0x01, 0xc6, 0xdb, 0xc6, 0xba, 0x42, 0x01, 0xa5, 
+  0x4b, 0x01, 0xc5, 0x45, 0x01, 0xa5, 0x00, 0x01, 0xc5, 0x42, 0x01, 0xa5, 0x48, 0x01, 0xc5, 0x41, 
+  0x01, 0xa5, 0x41, 0x01, 0xc5, 0x00, 0x01, 0xa5, 0x4a, 0x01, 0xc5, 0x41, 0x01, 0xe6, 0x02, 0x0a, 
+  0x26, 0x1b, 0x08, 0x1a, 0xe7, 0x41, 0x01, 0xe6, 0x08, 0x0a, 0x06, 0x1a, 0xc7, 0x12, 0x87, 0x01, 
+  0xc5, 0x09, 0xe6, 0x01, 0xe6, 0x12, 0x67, 0x1a, 0xe8, 0x09, 0xe6, 0x42, 0x01, 0xc6, 0x81, 0x00, 
+  0x02, 0x06, 0x82, 0x00, 0x1a, 0xe8, 0x87, 0x43, 0x01, 0xc6, 0x0e, 0x12, 0xa6, 0x2b, 0xa7, 0x23, 
+  0x67, 0x12, 0x46, 0x01, 0xa5, 0x0a, 0x05, 0x1b, 0x27, 0x2b, 0xa7, 0x2b, 0x87, 0x1a, 0xe7, 0x02, 
+  0x05, 0x0a, 0x26, 0x1a, 0x87, 0x12, 0x06, 0x09, 0xa6, 0x41, 0x09, 0xc6, 0x0d, 0x12, 0x07, 0x11, 
+  0xa6, 0x00, 0x82, 0x29, 0x46, 0x29, 0x66, 0x42, 0x2a, 0x5a, 0xed, 0x7b, 0xef, 0x8c, 0x70, 0x94, 
+  0xd2, 0x8c, 0x92, 0x84, 0x31, 0x42, 0x0c, 0x10, 0x64, 0x80, 0x0d, 0x18, 0xa5, 0x21, 0x49, 0x6b, 
+  0x6f, 0x7b, 0xf0, 0x21, 0x05, 0x00, 0x41, 0x09, 0x85, 0x09, 0xa5, 0x09, 0xc6, 0x01, 0xc6, 0x22, 
+  0xa9, 0x4b, 0xad, 0x95, 0x75, 0xdf, 0x7d, 0x41, 0xcf, 0x1c, 0x03, 0xdf, 0x7d, 0xc6, 0x9a, 0x5b, 
+  0xae, 0x01, 0x65, 0x41, 0x09, 0xe7, 0x43, 0x09, 0xe6, 0x00, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x00, 
+  0x01, 0xe6, 0x41, 0x09, 0xe7, 0x09, 0x01, 0xe7, 0x01, 0xe6, 0x0a, 0x46, 0x1a, 0xa8, 0x09, 0xe6, 
+  0x01, 0xc6, 0x01, 0xc5, 0x01, 0xe5, 0x1a, 0xc7, 0x12, 0x87, 0x84, 0x41, 0x01, 0xe6, 0x80, 0x42, 
+  0x01, 0xe6, 0x00, 0x09, 0xe6, 0x89, 0x00, 0x01, 0xe7, 0x80, 0x42, 0x01, 0xc6, 0x0c, 0x09, 0xa6, 
+  0x09, 0xc6, 0x0a, 0x86, 0x5c, 0x4e, 0xcf, 0x3b, 0xd7, 0x3c, 0xd7, 0x1c, 0xcf, 0x1b, 0xd7, 0x5d, 
+  0xe7, 0xbe, 0xa5, 0xd7, 0x09, 0xa5, 0x01, 0xc6, 0x41, 0x09, 0xc6, 0x80, 0x44, 0x09, 0xc6, 0x00, 
+  0x09, 0xc7, 0x42, 0x09, 0xe7, 0x00, 0x09, 0xc6, 0x42, 0x09, 0xe6, 0x03, 0x09, 0xe7, 0x09, 0xe6, 
+  0x09, 0xc6, 0x09, 0xc7, 0x41, 0x09, 0xe6, 0x80, 0x00, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x00, 0x09, 
+  0xc6, 0x41, 0x09, 0xe6, 0x06, 0x01, 0xa5, 0x1a, 0x48, 0x8d, 0x13, 0xae, 0x18, 0xef, 0xbe, 0xd7, 
+  0x3c, 0xce, 0xdb, 0x41, 0xcf, 0x1b, 0x51, 0x12, 0x87, 0x41, 0x12, 0x67, 0x43, 0x12, 0x87, 0x41, 
+  0x12, 0x67, 0x41, 0x12, 0x86, 0x43, 0x12, 0x87, 0x01, 0x12, 0x86, 0x12, 0x87, 0x41, 0x12, 0x67, 
+  0x47, 0x12, 0x87, 0x00, 0x12, 0x86, 0x46, 0x12, 0x87, 0x41, 0x1b, 0x08, 0x00, 0x02, 0x06, 0x80, 
+  0x08, 0x02, 0x26, 0x1a, 0xe8, 0x12, 0x87, 0x01, 0xe6, 0x09, 0xe6, 0x01, 0xc6, 0x12, 0x87, 0x12, 
+  0xa7, 0x01, 0xe5, 0x43, 0x01, 0xc6, 0x80, 0x00, 0x0a, 0x47, 0x81, 0x00, 0x01, 0xe5, 0x83, 0x00, 
+  0x0a, 0x66, 0x81, 0x43, 0x01, 0xc6, 0x11, 0x09, 0xc6, 0x01, 0xe6, 0x12, 0xc7, 0x23, 0x88, 0x1b, 
+  0x07, 0x12, 0x26, 0x01, 0xa5, 0x01, 0xc5, 0x12, 0x86, 0x2b, 0xa7, 0x2b, 0x87, 0x1a, 0xe6, 0x01, 
+  0xe6, 0x0a, 0x26, 0x1a, 0xc7, 0x0a, 0x06, 0x01, 0xa5, 0x09, 0xc6, 0x42, 0x09, 0xe6, 0x0c, 0x0a, 
+  0x26, 0x22, 0x88, 0x11, 0x85, 0x00, 0x62, 0x18, 0xe4, 0x29, 0x46, 0x52, 0xad, 0x5b, 0x0e, 0x63, 
+  0x4f, 0x63, 0x2f, 0x52, 0x8c, 0x29, 0x07, 0x08, 0x42, 0x80, 0x0d, 0x10, 0xa5, 0x21, 0x28, 0x5b, 
+  0x0f, 0x5a, 0xcd, 0x18, 0xa4, 0x00, 0xe3, 0x09, 0xa6, 0x09, 0x85, 0x01, 0x03, 0x09, 0xa6, 0x9d, 
+  0xb6, 0xef, 0xde, 0xd7, 0x5c, 0xcf, 0x1c, 0x41, 0xd7, 0x3c, 0x04, 0x95, 0x75, 0x43, 0x2b, 0x01, 
+  0x44, 0x09, 0xe6, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x80, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x42, 
+  0x01, 0xe6, 0x0e, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xc6, 0x0a, 0x26, 0x12, 
+  0xa7, 0x01, 0xc5, 0x01, 0xa5, 0x01, 0xc6, 0x0a, 0x06, 0x1a, 0xc8, 0x12, 0x87, 0x01, 0xc5, 0x09, 
+  0xe6, 0x41, 0x01, 0xc6, 0x45, 0x01, 0xe6, 0x43, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x81, 0x45, 0x01, 
+  0xe6, 0x81, 0x00, 0x09, 0xc6, 0x41, 0x01, 0x64, 0x00, 0x5c, 0x2f, 0x41, 0xd7, 0x3c, 0x07, 0xd7, 
+  0x1b, 0xce, 0xfb, 0xd7, 0x3c, 0x9d, 0xb6, 0x84, 0xf2, 0x1a, 0x27, 0x01, 0xc5, 0x01, 0xe6, 0x41, 
+  0x01, 0xc5, 0x80, 0x58, 0x01, 0xc5, 0x09, 0x01, 0xc6, 0x01, 0xe6, 0x02, 0x06, 0x01, 0x64, 0x32, 
+  0xea, 0x84, 0xf3, 0xad, 0xf7, 0xe7, 0x9e, 0xce, 0xfb, 0xc6, 0xdb, 0x41, 0x2b, 0xc9, 0x00, 0x2b, 
+  0xe9, 0x42, 0x2b, 0xc9, 0x41, 0x23, 0xc9, 0x4f, 0x2b, 0xc9, 0x41, 0x23, 0xc9, 0x00, 0x23, 0xa9, 
+  0x41, 0x23, 0xc9, 0x54, 0x2b, 0xc9, 0x03, 0x23, 0xc9, 0x2b, 0xe9, 0x1b, 0x48, 0x0a, 0x26, 0x80, 
+  0x02, 0x0a, 0x26, 0x1b, 0x08, 0x12, 0xa7, 0x41, 0x01, 0xe6, 0x04, 0x01, 0xc6, 0x12, 0x87, 0x1a, 
+  0xa7, 0x01, 0xe6, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x80, 0x00, 0x01, 0xe6, 0x80, 0x02, 0x0a, 0x67, 
+  0x02, 0x05, 0x23, 0x28, 0x86, 0x43, 0x01, 0xc6, 0x05, 0x09, 0xc6, 0x01, 0xc6, 0x12, 0xa7, 0x2b, 
+  0x88, 0x1a, 0xa7, 0x09, 0xe5, 0x41, 0x01, 0xa5, 0x08, 0x0a, 0x66, 0x23, 0x67, 0x23, 0xa7, 0x12, 
+  0xc6, 0x01, 0xe6, 0x0a, 0x26, 0x1a, 0xe7, 0x0a, 0x26, 0x01, 0xa5, 0x41, 0x09, 0xc6, 0x81, 0x02, 
+  0x0a, 0x06, 0x22, 0xc8, 0x1a, 0x47, 0x41, 0x09, 0xc6, 0x0f, 0x01, 0x03, 0x00, 0xe2, 0x21, 0x46, 
+  0x29, 0x46, 0x21, 0x46, 0x21, 0x25, 0x20, 0xe6, 0x08, 0x42, 0x00, 0x00, 0x00, 0x21, 0x18, 0xe6, 
+  0x21, 0x07, 0x31, 0xa9, 0x29, 0x26, 0x08, 0xc3, 0x09, 0x86, 0x80, 0x05, 0x01, 0x45, 0x53, 0xae, 
+  0x84, 0xf3, 0xd7, 0x7d, 0xc7, 0x1b, 0xcf, 0x1b, 0x80, 0x04, 0xdf, 0x7d, 0x6c, 0x30, 0x01, 0x64, 
+  0x01, 0x85, 0x09, 0xe6, 0x41, 0x01, 0xc6, 0x4b, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x03, 0x01, 0xc6, 
+  0x12, 0x67, 0x1a, 0xc8, 0x09, 0xe6, 0x80, 0x04, 0x09, 0xe6, 0x0a, 0x26, 0x12, 0xa7, 0x0a, 0x66, 
+  0x01, 0xc5, 0x42, 0x01, 0xc6, 0x46, 0x01, 0xe6, 0x80, 0x48, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x04, 
+  0x09, 0xc6, 0x01, 0x44, 0x43, 0x4c, 0x85, 0x33, 0xcf, 0x1b, 0x80, 0x06, 0xcf, 0x1b, 0xd7, 0x5c, 
+  0xe7, 0x9e, 0x9e, 0x36, 0x2b, 0x29, 0x0a, 0x25, 0x12, 0xc7, 0x41, 0x1a, 0xe8, 0x42, 0x1b, 0x08, 
+  0x42, 0x1a, 0xe8, 0x41, 0x12, 0xe8, 0x00, 0x1a, 0xe8, 0x41, 0x12, 0xe8, 0x00, 0x1a, 0xe8, 0x41, 
+  0x12, 0xe8, 0x41, 0x1a, 0xe8, 0x41, 0x12, 0xe8, 0x4c, 0x1a, 0xe8, 0x06, 0x1b, 0x09, 0x1a, 0xe8, 
+  0x02, 0x25, 0x33, 0x2a, 0x64, 0x0f, 0xbe, 0x9a, 0xdf, 0x9e, 0x42, 0x0a, 0x66, 0x45, 0x0a, 0x86, 
+  0x41, 0x0a, 0x66, 0x03, 0x0a, 0x86, 0x0a, 0x66, 0x0a, 0x86, 0x0a, 0x66, 0x4e, 0x0a, 0x86, 0x48, 
+  0x0a, 0x66, 0x45, 0x0a, 0x86, 0x45, 0x0a, 0x66, 0x05, 0x0a, 0x87, 0x0a, 0x46, 0x02, 0x06, 0x0a, 
+  0x27, 0x1a, 0xe8, 0x12, 0xa7, 0x41, 0x02, 0x06, 0x80, 0x03, 0x12, 0x87, 0x1a, 0xc7, 0x01, 0xe5, 
+  0x01, 0xc5, 0x41, 0x01, 0xc6, 0x81, 0x00, 0x01, 0xc6, 0x80, 0x01, 0x0a, 0x46, 0x02, 0x06, 0x83, 
+  0x03, 0x01, 0xc5, 0x1b, 0x08, 0x0a, 0x46, 0x01, 0xa6, 0x44, 0x01, 0xc6, 0x03, 0x12, 0xa7, 0x23, 
+  0x48, 0x12, 0x86, 0x01, 0xc5, 0x41, 0x01, 0xc6, 0x08, 0x0a, 0x65, 0x23, 0x67, 0x2b, 0xa7, 0x1a, 
+  0xe6, 0x02, 0x06, 0x0a, 0x26, 0x1a, 0xc7, 0x12, 0x46, 0x01, 0xc5, 0x42, 0x09, 0xe6, 0x04, 0x01, 
+  0xe6, 0x0a, 0x06, 0x1a, 0xc8, 0x12, 0x27, 0x01, 0xa5, 0x80, 0x19, 0x01, 0xa6, 0x1a, 0x87, 0x1a, 
+  0xc8, 0x09, 0x24, 0x00, 0xc3, 0x00, 0xc2, 0x00, 0xa2, 0x09, 0x04, 0x11, 0x66, 0x08, 0xa3, 0x00, 
+  0x01, 0x08, 0x63, 0x08, 0x42, 0x08, 0x21, 0x08, 0x82, 0x09, 0xa6, 0x09, 0xc6, 0x11, 0xc6, 0x74, 
+  0x91, 0xcf, 0x5c, 0xd7, 0x7d, 0xc6, 0xfb, 0xcf, 0x1c, 0xd7, 0x3c, 0xe7, 0xbe, 0x8d, 0x54, 0x41, 
+  0x01, 0xc6, 0x00, 0x09, 0xc6, 0x42, 0x01, 0xc6, 0x85, 0x41, 0x01, 0xe7, 0x80, 0x00, 0x01, 0xe7, 
+  0x80, 0x41, 0x01, 0xe7, 0x41, 0x09, 0xe6, 0x03, 0x01, 0xc6, 0x0a, 0x47, 0x12, 0xa7, 0x02, 0x06, 
+  0x80, 0x04, 0x0a, 0x06, 0x02, 0x06, 0x1a, 0xc7, 0x12, 0xa7, 0x01, 0xc5, 0x84, 0x00, 0x01, 0xc6, 
+  0x81, 0x41, 0x01, 0xc6, 0x85, 0x42, 0x01, 0xc6, 0x0d, 0x01, 0xe6, 0x09, 0xc6, 0x01, 0xa5, 0x53, 
+  0xce, 0xb6, 0x79, 0xdf, 0x9d, 0xc7, 0x1b, 0xcf, 0x1b, 0xdf, 0x7d, 0xb6, 0x58, 0x53, 0xee, 0x2a, 
+  0xe9, 0x0a, 0x46, 0x12, 0x87, 0x41, 0x12, 0x67, 0x43, 0x12, 0x87, 0x45, 0x12, 0x67, 0x43, 0x12, 
+  0x87, 0x00, 0x12, 0x67, 0x41, 0x12, 0x87, 0x01, 0x12, 0x67, 0x0a, 0x67, 0x45, 0x12, 0x67, 0x47, 
+  0x12, 0x87, 0x05, 0x12, 0x67, 0x12, 0x87, 0x0a, 0x06, 0x01, 0x44, 0x3b, 0x0b, 0x4b, 0x8d, 0x00, 
+  0x22, 0xe8, 0x44, 0x1a, 0xe8, 0x00, 0x1a, 0xe9, 0x41, 0x1a, 0xe8, 0x00, 0x22, 0xe8, 0x42, 0x1a, 
+  0xe8, 0x42, 0x1a, 0xe9, 0x42, 0x1a, 0xe8, 0x04, 0x22, 0xe9, 0x23, 0x09, 0x23, 0x08, 0x23, 0x09, 
+  0x22, 0xe9, 0x41, 0x1b, 0x08, 0x48, 0x1a, 0xe8, 0x41, 0x22, 0xe8, 0x41, 0x1a, 0xe8, 0x01, 0x1b, 
+  0x08, 0x1a, 0xe8, 0x41, 0x1b, 0x08, 0x43, 0x1a, 0xe8, 0x41, 0x1b, 0x08, 0x42, 0x1a, 0xe8, 0x00, 
+  0x23, 0x09, 0x41, 0x23, 0x29, 0x01, 0x12, 0x87, 0x01, 0xe6, 0x81, 0x04, 0x12, 0xa7, 0x1a, 0xc8, 
+  0x01, 0xe5, 0x01, 0xe6, 0x09, 0xe6, 0x43, 0x01, 0xe6, 0x81, 0x00, 0x0a, 0x66, 0x80, 0x00, 0x1b, 
+  0x28, 0x84, 0x00, 0x0a, 0x67, 0x84, 0x04, 0x12, 0xa7, 0x23, 0x88, 0x12, 0xa7, 0x01, 0xc6, 0x09, 
+  0xe6, 0x80, 0x00, 0x0a, 0x66, 0x41, 0x23, 0x87, 0x05, 0x12, 0xa6, 0x01, 0xe5, 0x0a, 0x26, 0x1a, 
+  0xc7, 0x12, 0x46, 0x01, 0xc5, 0x41, 0x09, 0xe6, 0x00, 0x0a, 0x06, 0x80, 0x07, 0x0a, 0x06, 0x1a, 
+  0xe8, 0x12, 0x66, 0x01, 0xa5, 0x09, 0xc6, 0x01, 0xc5, 0x0a, 0x26, 0x12, 0x67, 0x41, 0x0a, 0x27, 
+  0x0a, 0x0a, 0x07, 0x09, 0xe6, 0x09, 0xe7, 0x09, 0xe6, 0x0a, 0x07, 0x09, 0xe7, 0x09, 0x65, 0x09, 
+  0x44, 0x01, 0x24, 0x09, 0x24, 0x09, 0x44, 0x41, 0x09, 0xc6, 0x01, 0x95, 0x75, 0xdf, 0xbe, 0x41, 
+  0xc6, 0xfb, 0x06, 0xcf, 0x3c, 0xd7, 0x7d, 0x8d, 0x14, 0x3b, 0x0b, 0x12, 0x48, 0x01, 0xe6, 0x09, 
+  0xe7, 0x47, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x81, 0x42, 0x01, 0xe6, 0x03, 0x09, 0xe6, 0x01, 0xe6, 
+  0x09, 0xe6, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x02, 0x01, 0xc6, 0x12, 0x67, 0x1a, 0xc7, 0x80, 0x41, 
+  0x01, 0xe6, 0x03, 0x0a, 0x06, 0x1b, 0x28, 0x12, 0xa7, 0x01, 0xc5, 0x83, 0x49, 0x01, 0xe6, 0x42, 
+  0x01, 0xc6, 0x0f, 0x09, 0xe6, 0x01, 0xc6, 0x01, 0xc5, 0x64, 0x50, 0xd7, 0x5c, 0xcf, 0x3c, 0xce, 
+  0xfb, 0xcf, 0x3c, 0xd7, 0x5c, 0xbe, 0xb9, 0x43, 0xec, 0x02, 0x25, 0x01, 0xc5, 0x01, 0xc6, 0x01, 
+  0xa5, 0x01, 0xa6, 0x47, 0x01, 0xc6, 0x42, 0x01, 0xa5, 0x44, 0x01, 0xc5, 0x01, 0x01, 0xa5, 0x01, 
+  0xc5, 0x42, 0x01, 0xa5, 0x00, 0x01, 0xc5, 0x42, 0x01, 0xc6, 0x41, 0x01, 0xc5, 0x00, 0x01, 0xa5, 
+  0x41, 0x01, 0xc5, 0x01, 0x01, 0xc6, 0x01, 0xc5, 0x43, 0x01, 0xc6, 0x03, 0x09, 0xe6, 0x0a, 0x07, 
+  0x01, 0xa5, 0x01, 0x85, 0x48, 0x0a, 0x26, 0x00, 0x0a, 0x27, 0x41, 0x0a, 0x26, 0x47, 0x0a, 0x27, 
+  0x41, 0x0a, 0x26, 0x00, 0x0a, 0x27, 0x52, 0x0a, 0x26, 0x00, 0x0a, 0x27, 0x4b, 0x0a, 0x26, 0x42, 
+  0x01, 0xe6, 0x01, 0x12, 0xa7, 0x12, 0xc7, 0x41, 0x01, 0xe6, 0x01, 0x09, 0xe6, 0x01, 0xe7, 0x85, 
+  0x00, 0x0a, 0x46, 0x86, 0x00, 0x0a, 0x46, 0x80, 0x42, 0x01, 0xe6, 0x02, 0x1a, 0xe7, 0x23, 0x68, 
+  0x12, 0x86, 0x41, 0x09, 0xe6, 0x0a, 0x01, 0xe6, 0x0a, 0x66, 0x23, 0x87, 0x2b, 0xa7, 0x12, 0xa6, 
+  0x09, 0xe6, 0x0a, 0x06, 0x1a, 0xc8, 0x0a, 0x26, 0x01, 0xc6, 0x0a, 0x06, 0x81, 0x03, 0x01, 0xe6, 
+  0x0a, 0x26, 0x1a, 0xe7, 0x12, 0x66, 0x41, 0x01, 0xc6, 0x13, 0x01, 0xa5, 0x12, 0x66, 0x1a, 0xe7, 
+  0x0a, 0x06, 0x01, 0xe6, 0x0a, 0x07, 0x09, 0xe6, 0x01, 0xc6, 0x01, 0xa6, 0x09, 0xc6, 0x09, 0xe6, 
+  0x01, 0xa6, 0x01, 0xc6, 0x0a, 0x07, 0x09, 0xe6, 0x09, 0xc6, 0x01, 0x65, 0x6c, 0x71, 0xbe, 0xda, 
+  0xd7, 0x3c, 0x42, 0xcf, 0x1c, 0x05, 0xc6, 0xba, 0x8d, 0x94, 0x12, 0x06, 0x01, 0x44, 0x01, 0xe6, 
+  0x09, 0xe7, 0x44, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x47, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x81, 0x00, 
+  0x01, 0xe6, 0x42, 0x09, 0xe6, 0x04, 0x09, 0xe7, 0x01, 0xe6, 0x0a, 0x46, 0x12, 0xa7, 0x0a, 0x06, 
+  0x41, 0x01, 0xe6, 0x02, 0x02, 0x05, 0x1b, 0x08, 0x12, 0x87, 0x41, 0x01, 0xc6, 0x8a, 0x00, 0x09, 
+  0xe6, 0x80, 0x41, 0x01, 0xe6, 0x0d, 0x01, 0x85, 0x2a, 0xca, 0x95, 0x75, 0xd7, 0x3c, 0xcf, 0x3c, 
+  0xc6, 0xfb, 0xd7, 0x7d, 0xbe, 0x99, 0x33, 0x0a, 0x2b, 0x8a, 0x12, 0xe7, 0x0a, 0x26, 0x0a, 0x06, 
+  0x01, 0xe6, 0x46, 0x01, 0xc6, 0x01, 0x09, 0xc6, 0x01, 0xa6, 0x4a, 0x01, 0xc6, 0x00, 0x01, 0xa6, 
+  0x4d, 0x01, 0xc6, 0x42, 0x09, 0xc6, 0x41, 0x01, 0xc6, 0x41, 0x09, 0xe6, 0x66, 0x0a, 0x26, 0x41, 
+  0x0a, 0x46, 0x4d, 0x0a, 0x26, 0x41, 0x0a, 0x46, 0x00, 0x12, 0x87, 0x80, 0x41, 0x01, 0xe6, 0x01, 
+  0x09, 0xe6, 0x09, 0xe7, 0x86, 0x00, 0x0a, 0x67, 0x81, 0x01, 0x01, 0xe6, 0x12, 0xa7, 0x81, 0x08, 
+  0x1a, 0xe8, 0x0a, 0x67, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xc6, 0x12, 0x87, 0x23, 0x69, 0x12, 0x86, 
+  0x01, 0xe6, 0x80, 0x01, 0x01, 0xc6, 0x0a, 0x66, 0x41, 0x23, 0x88, 0x05, 0x12, 0xc6, 0x01, 0xe6, 
+  0x0a, 0x26, 0x1a, 0xc8, 0x0a, 0x46, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x04, 0x0a, 0x06, 0x01, 0xe6, 
+  0x0a, 0x46, 0x1b, 0x08, 0x0a, 0x46, 0x41, 0x01, 0xc6, 0x05, 0x01, 0xa5, 0x12, 0x66, 0x1b, 0x07, 
+  0x0a, 0x46, 0x09, 0xe6, 0x0a, 0x06, 0x41, 0x09, 0xe6, 0x81, 0x41, 0x01, 0xa6, 0x41, 0x22, 0x89, 
+  0x00, 0x09, 0xe7, 0x80, 0x03, 0x01, 0x24, 0x64, 0x30, 0xd7, 0x7d, 0xd7, 0x5c, 0x80, 0x07, 0xd7, 
+  0x5d, 0xe7, 0xbe, 0x95, 0x95, 0x09, 0x65, 0x1a, 0x87, 0x12, 0x46, 0x01, 0xa5, 0x09, 0xe6, 0x41, 
+  0x01, 0xe6, 0x00, 0x01, 0xc6, 0x4a, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x41, 0x09, 
+  0xe6, 0x00, 0x01, 0xe7, 0x43, 0x01, 0xe6, 0x02, 0x0a, 0x47, 0x1a, 0xc7, 0x0a, 0x06, 0x80, 0x03, 
+  0x09, 0xe6, 0x02, 0x06, 0x1a, 0xe7, 0x12, 0x87, 0x88, 0x00, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x05, 
+  0x09, 0xc6, 0x01, 0xa6, 0x01, 0x65, 0x32, 0xea, 0xc6, 0xfb, 0xdf, 0x7d, 0x80, 0x08, 0xcf, 0x1b, 
+  0xd7, 0x5d, 0xbe, 0x99, 0x2a, 0xa9, 0x01, 0xc4, 0x02, 0x25, 0x0a, 0x26, 0x01, 0xe6, 0x09, 0xe6, 
+  0x85, 0x41, 0x09, 0xc6, 0x01, 0x01, 0xa6, 0x0a, 0x06, 0x45, 0x0a, 0x26, 0x03, 0x0a, 0x46, 0x0a, 
+  0x26, 0x0a, 0x27, 0x0a, 0x47, 0x42, 0x0a, 0x26, 0x00, 0x0a, 0x27, 0x47, 0x0a, 0x26, 0x41, 0x0a, 
+  0x46, 0x41, 0x0a, 0x26, 0x00, 0x0a, 0x47, 0x43, 0x0a, 0x27, 0x41, 0x0a, 0x47, 0x41, 0x1b, 0x48, 
+  0x42, 0x1b, 0x28, 0x46, 0x1b, 0x29, 0x45, 0x1b, 0x28, 0x00, 0x1b, 0x48, 0x4d, 0x1b, 0x28, 0x45, 
+  0x1b, 0x48, 0x43, 0x1b, 0x28, 0x43, 0x1b, 0x29, 0x49, 0x1b, 0x28, 0x03, 0x1b, 0x07, 0x02, 0x06, 
+  0x0a, 0x06, 0x09, 0xe7, 0x47, 0x01, 0xe6, 0x81, 0x00, 0x02, 0x26, 0x80, 0x00, 0x01, 0xe5, 0x81, 
+  0x01, 0x01, 0xa5, 0x1b, 0x08, 0x81, 0x10, 0x01, 0xc6, 0x12, 0xa7, 0x23, 0x68, 0x0a, 0x66, 0x09, 
+  0xe6, 0x0a, 0x07, 0x01, 0xe6, 0x0a, 0x66, 0x23, 0x67, 0x23, 0xa8, 0x12, 0xc6, 0x01, 0xe6, 0x0a, 
+  0x26, 0x1a, 0xe7, 0x0a, 0x26, 0x01, 0xc6, 0x0a, 0x06, 0x80, 0x0b, 0x0a, 0x06, 0x01, 0xe6, 0x0a, 
+  0x26, 0x1b, 0x07, 0x12, 0x86, 0x01, 0xe6, 0x09, 0xc6, 0x01, 0xc5, 0x12, 0xa6, 0x1b, 0x27, 0x0a, 
+  0x46, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xe7, 0x80, 0x00, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x11, 0x01, 
+  0x85, 0x22, 0x28, 0xbe, 0xdb, 0xc6, 0xdb, 0x01, 0xe6, 0x01, 0xc6, 0x6c, 0x30, 0xcf, 0x5c, 0xcf, 
+  0x3c, 0xcf, 0x1b, 0xbe, 0xba, 0xb6, 0x79, 0x7c, 0xf2, 0x12, 0x27, 0x01, 0xa5, 0x12, 0xa7, 0x1a, 
+  0xa7, 0x01, 0x85, 0x41, 0x01, 0xc6, 0x4d, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x82, 0x41, 0x01, 0xe6, 
+  0x41, 0x01, 0xe7, 0x80, 0x04, 0x01, 0xe7, 0x01, 0xe6, 0x0a, 0x47, 0x1a, 0xe8, 0x0a, 0x26, 0x41, 
+  0x01, 0xe6, 0x03, 0x02, 0x06, 0x1a, 0xe7, 0x12, 0x86, 0x01, 0xc5, 0x88, 0x0d, 0x01, 0xc6, 0x09, 
+  0xe7, 0x01, 0x85, 0x01, 0x44, 0x43, 0x2c, 0xc6, 0xfb, 0xcf, 0x3c, 0xcf, 0x1b, 0xd7, 0x1c, 0xdf, 
+  0x7d, 0xbe, 0xba, 0x33, 0x0a, 0x02, 0x05, 0x0a, 0x26, 0x41, 0x01, 0xe6, 0x01, 0x09, 0xe7, 0x01, 
+  0xe7, 0x85, 0x02, 0x09, 0xe6, 0x01, 0xc6, 0x0a, 0x66, 0x44, 0x1b, 0x28, 0x43, 0x1b, 0x08, 0x41, 
+  0x1b, 0x28, 0x43, 0x1b, 0x08, 0x43, 0x1b, 0x28, 0x43, 0x1b, 0x08, 0x00, 0x1b, 0x28, 0x42, 0x1b, 
+  0x08, 0x41, 0x1a, 0xe8, 0x00, 0x1b, 0x08, 0x41, 0x23, 0x08, 0x01, 0x1b, 0x08, 0x23, 0x08, 0x51, 
+  0x01, 0xe6, 0x43, 0x02, 0x06, 0x4a, 0x01, 0xe6, 0x44, 0x02, 0x06, 0x4f, 0x01, 0xe6, 0x41, 0x02, 
+  0x06, 0x42, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x48, 0x01, 0xe6, 0x80, 0x00, 0x0a, 0x66, 0x86, 0x10, 
+  0x0a, 0x66, 0x01, 0xa6, 0x0a, 0x26, 0x23, 0x68, 0x12, 0xa7, 0x01, 0xc6, 0x0a, 0x07, 0x01, 0xe6, 
+  0x0a, 0x66, 0x23, 0x87, 0x23, 0xa8, 0x12, 0xc6, 0x01, 0xe5, 0x0a, 0x26, 0x12, 0xa7, 0x0a, 0x46, 
+  0x01, 0xc5, 0x41, 0x09, 0xe6, 0x0c, 0x0a, 0x06, 0x02, 0x06, 0x0a, 0x06, 0x1b, 0x07, 0x12, 0x86, 
+  0x01, 0xe6, 0x09, 0xe6, 0x01, 0xc5, 0x12, 0xa6, 0x23, 0x68, 0x0a, 0x66, 0x01, 0xe6, 0x0a, 0x06, 
+  0x41, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x80, 0x0d, 0x09, 0xe6, 0x01, 0x24, 0x6c, 0x71, 0xdf, 0xbe, 
+  0xcf, 0x1b, 0x5c, 0x0f, 0x6c, 0x71, 0xdf, 0x9d, 0xcf, 0x3c, 0xcf, 0x1b, 0xd7, 0x7d, 0x53, 0xae, 
+  0x01, 0x85, 0x01, 0xa6, 0x41, 0x02, 0x06, 0x02, 0x1a, 0xe8, 0x1a, 0xc7, 0x01, 0xa5, 0x80, 0x45, 
+  0x01, 0xe6, 0x00, 0x01, 0xc6, 0x80, 0x41, 0x01, 0xc6, 0x81, 0x00, 0x01, 0xc6, 0x48, 0x01, 0xe6, 
+  0x80, 0x0c, 0x09, 0xe6, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe6, 0x0a, 0x47, 0x1a, 0xe7, 0x0a, 0x06, 
+  0x01, 0xc6, 0x01, 0xe6, 0x02, 0x06, 0x1b, 0x08, 0x12, 0xa7, 0x01, 0xc5, 0x46, 0x01, 0xe6, 0x0e, 
+  0x09, 0xe6, 0x09, 0xe7, 0x01, 0x64, 0x12, 0x27, 0x6c, 0xb1, 0xc7, 0x3c, 0xcf, 0x3c, 0xcf, 0x1b, 
+  0xdf, 0x7d, 0xc7, 0x1b, 0xae, 0xd8, 0x4b, 0xed, 0x01, 0xc5, 0x02, 0x06, 0x01, 0xe5, 0x41, 0x01, 
+  0xc6, 0x03, 0x01, 0xe6, 0x09, 0xe6, 0x01, 0xc6, 0x01, 0xe6, 0x44, 0x01, 0xc6, 0x04, 0x0a, 0x26, 
+  0x1b, 0x08, 0x0a, 0x46, 0x01, 0xe5, 0x02, 0x05, 0x53, 0x01, 0xe5, 0x46, 0x01, 0xe6, 0x41, 0x09, 
+  0xe6, 0x41, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xe6, 0x82, 0x00, 0x09, 0xe6, 0x81, 0x41, 0x01, 0xc6, 
+  0x00, 0x09, 0xc6, 0x80, 0x00, 0x09, 0xe6, 0x80, 0x01, 0x01, 0xe7, 0x09, 0xe6, 0x42, 0x09, 0xe7, 
+  0x00, 0x01, 0xe7, 0x41, 0x09, 0xe7, 0x01, 0x01, 0xe7, 0x09, 0xe7, 0x41, 0x01, 0xe7, 0x80, 0x00, 
+  0x01, 0xe7, 0x80, 0x00, 0x01, 0xc6, 0x44, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x01, 0x01, 0xe6, 0x01, 
+  0xe7, 0x83, 0x42, 0x01, 0xc6, 0x86, 0x00, 0x01, 0xe7, 0x43, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x49, 
+  0x01, 0xe6, 0x81, 0x00, 0x02, 0x25, 0x84, 0x00, 0x1a, 0xe8, 0x81, 0x0d, 0x0a, 0x27, 0x1b, 0x08, 
+  0x01, 0xc5, 0x09, 0xe6, 0x01, 0xc6, 0x0a, 0x66, 0x23, 0xa8, 0x2b, 0xc8, 0x12, 0xc6, 0x01, 0xe5, 
+  0x0a, 0x26, 0x1a, 0xe8, 0x0a, 0x46, 0x01, 0xc6, 0x42, 0x09, 0xe6, 0x0c, 0x01, 0xe6, 0x0a, 0x26, 
+  0x1a, 0xa7, 0x12, 0x66, 0x01, 0xe6, 0x0a, 0x06, 0x01, 0xc5, 0x12, 0x86, 0x23, 0x68, 0x12, 0x87, 
+  0x01, 0xe6, 0x09, 0xe7, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x05, 0x01, 0xc6, 0x01, 0xe6, 0x01, 0xa6, 
+  0x1a, 0x07, 0xb6, 0x79, 0xd7, 0x5c, 0x80, 0x41, 0xdf, 0x9d, 0x41, 0xcf, 0x3c, 0x0b, 0xd7, 0x3c, 
+  0xbe, 0xba, 0x1a, 0x28, 0x01, 0xa6, 0x0a, 0x07, 0x09, 0xe6, 0x01, 0xe5, 0x13, 0x07, 0x1a, 0xe8, 
+  0x01, 0xc6, 0x01, 0xe6, 0x01, 0xc6, 0x85, 0x46, 0x01, 0xc6, 0x80, 0x00, 0x01, 0xc6, 0x81, 0x41, 
+  0x01, 0xe7, 0x82, 0x00, 0x09, 0xe7, 0x42, 0x01, 0xe6, 0x08, 0x01, 0xc6, 0x0a, 0x67, 0x12, 0xa7, 
+  0x01, 0xe6, 0x01, 0xc6, 0x01, 0xe6, 0x0a, 0x06, 0x1a, 0xe7, 0x0a, 0x86, 0x86, 0x10, 0x01, 0xa6, 
+  0x01, 0x23, 0x3a, 0xca, 0xae, 0x58, 0xd7, 0x7d, 0xce, 0xfb, 0xcf, 0x1b, 0xcf, 0x3c, 0xb6, 0x99, 
+  0x5c, 0x4f, 0x13, 0x07, 0x0a, 0x66, 0x01, 0x85, 0x0a, 0x46, 0x12, 0xa7, 0x0a, 0x26, 0x01, 0xc5, 
+  0x41, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x00, 0x09, 0xe6, 0x80, 0x03, 0x0a, 0x26, 
+  0x12, 0xc7, 0x0a, 0x26, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x4c, 0x01, 0xc6, 0x01, 
+  0x09, 0xc6, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x45, 0x09, 0xe6, 0x44, 0x09, 0xe7, 0x5c, 0x01, 0xe6, 
+  0x85, 0x47, 0x01, 0xe6, 0x80, 0x58, 0x01, 0xe6, 0x81, 0x00, 0x02, 0x06, 0x89, 0x0b, 0x01, 0xe6, 
+  0x01, 0xc6, 0x0a, 0x46, 0x23, 0x68, 0x23, 0xc8, 0x12, 0xe7, 0x01, 0xe6, 0x0a, 0x27, 0x1a, 0xc8, 
+  0x0a, 0x47, 0x01, 0xc6, 0x02, 0x06, 0x81, 0x0b, 0x01, 0xc6, 0x0a, 0x06, 0x1a, 0xc7, 0x0a, 0x46, 
+  0x01, 0xc5, 0x09, 0xe6, 0x01, 0xc5, 0x12, 0xa7, 0x23, 0x68, 0x0a, 0x86, 0x01, 0xe6, 0x01, 0xe7, 
+  0x46, 0x01, 0xe6, 0x80, 0x03, 0x1a, 0x48, 0x7c, 0xf3, 0xdf, 0x9d, 0xdf, 0x9e, 0x41, 0xcf, 0x1b, 
+  0x81, 0x08, 0xd7, 0x5c, 0xce, 0xfb, 0x2a, 0xa9, 0x01, 0xc6, 0x09, 0xe6, 0x09, 0xc6, 0x01, 0xc5, 
+  0x12, 0xe7, 0x13, 0x07, 0x81, 0x43, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x47, 0x01, 
+  0xc6, 0x46, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x43, 0x01, 0xe6, 0x09, 0x01, 0xc6, 0x0a, 0x46, 0x12, 
+  0xc7, 0x09, 0xe6, 0x01, 0xc6, 0x01, 0xe6, 0x02, 0x06, 0x1a, 0xe7, 0x12, 0x87, 0x01, 0xc6, 0x80, 
+  0x00, 0x01, 0xc6, 0x80, 0x05, 0x0a, 0x06, 0x01, 0xa5, 0x2a, 0xca, 0x64, 0x2f, 0xae, 0x58, 0xd7, 
+  0x7d, 0x41, 0xce, 0xfb, 0x02, 0xd7, 0x5d, 0xa5, 0xd6, 0x1a, 0x07, 0x41, 0x01, 0x85, 0x05, 0x01, 
+  0xc5, 0x0a, 0x66, 0x23, 0x68, 0x23, 0x88, 0x1b, 0x28, 0x0a, 0x46, 0x80, 0x0c, 0x09, 0xc6, 0x09, 
+  0xe6, 0x01, 0xe6, 0x09, 0xc6, 0x09, 0xe6, 0x01, 0xc6, 0x0a, 0x26, 0x1b, 0x08, 0x0a, 0x26, 0x01, 
+  0xc6, 0x09, 0xc6, 0x01, 0xc6, 0x01, 0xa6, 0x44, 0x01, 0xc6, 0x45, 0x01, 0xa6, 0x81, 0x00, 0x01, 
+  0xc5, 0x43, 0x01, 0xc6, 0x00, 0x01, 0xc5, 0x4b, 0x01, 0xc6, 0x92, 0x01, 0x01, 0xc6, 0x01, 0xe5, 
+  0x55, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x8c, 0x42, 0x01, 0xc6, 0x94, 0x0a, 0x01, 0xc5, 0x0a, 0x46, 
+  0x23, 0x68, 0x23, 0xa8, 0x12, 0xc7, 0x01, 0xe6, 0x0a, 0x26, 0x1a, 0xc8, 0x0a, 0x27, 0x01, 0xc6, 
+  0x09, 0xe7, 0x41, 0x0a, 0x06, 0x0d, 0x01, 0xe6, 0x0a, 0x26, 0x1a, 0xe7, 0x0a, 0x46, 0x01, 0xc6, 
+  0x09, 0xe6, 0x01, 0xc5, 0x12, 0xa7, 0x23, 0x88, 0x12, 0x86, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe6, 
+  0x01, 0xc6, 0x85, 0x00, 0x01, 0xe7, 0x41, 0x01, 0xc6, 0x03, 0x4b, 0xad, 0x64, 0x30, 0xcf, 0x3c, 
+  0xd7, 0x5c, 0x80, 0x09, 0xd7, 0x3c, 0xd7, 0x1c, 0xdf, 0x9e, 0x3a, 0xeb, 0x01, 0x64, 0x09, 0xc6, 
+  0x01, 0xc6, 0x01, 0xa5, 0x12, 0xa7, 0x12, 0xe7, 0x41, 0x01, 0xc6, 0x86, 0x48, 0x01, 0xc6, 0x4c, 
+  0x01, 0xe6, 0x1e, 0x01, 0xc6, 0x0a, 0x46, 0x12, 0xc7, 0x02, 0x06, 0x01, 0xc6, 0x01, 0xe6, 0x02, 
+  0x06, 0x12, 0xa7, 0x12, 0x86, 0x01, 0xc6, 0x01, 0xe6, 0x0a, 0x06, 0x01, 0x85, 0x1a, 0x27, 0xae, 
+  0x78, 0xdf, 0x9e, 0xcf, 0x1c, 0xce, 0xfb, 0xcf, 0x1c, 0xdf, 0x7d, 0xbe, 0xba, 0x1a, 0x07, 0x01, 
+  0x44, 0x01, 0xa6, 0x01, 0xc6, 0x01, 0xa6, 0x1b, 0x27, 0x23, 0x88, 0x12, 0xa6, 0x23, 0x68, 0x1a, 
+  0xe7, 0x80, 0x01, 0x09, 0xe6, 0x09, 0xc6, 0x80, 0x08, 0x01, 0xe7, 0x01, 0xc6, 0x0a, 0x46, 0x1b, 
+  0x28, 0x0a, 0x46, 0x09, 0xc6, 0x01, 0xe6, 0x01, 0xc5, 0x12, 0xa7, 0x5c, 0x1a, 0xe8, 0x42, 0x1b, 
+  0x08, 0x49, 0x1b, 0x09, 0x01, 0x23, 0x09, 0x1b, 0x09, 0x46, 0x23, 0x09, 0x01, 0x1b, 0x09, 0x1b, 
+  0x08, 0x41, 0x1a, 0xe9, 0x01, 0x1a, 0xe8, 0x1a, 0xe9, 0x41, 0x1a, 0xe8, 0x41, 0x1a, 0xe9, 0x41, 
+  0x1b, 0x08, 0x01, 0x1b, 0x28, 0x12, 0xc7, 0x41, 0x01, 0xc6, 0x81, 0x00, 0x01, 0xe7, 0x4f, 0x01, 
+  0xe6, 0x47, 0x01, 0xc6, 0x81, 0x00, 0x01, 0xc6, 0x88, 0x01, 0x12, 0x87, 0x1a, 0xc8, 0x86, 0x07, 
+  0x12, 0xc7, 0x12, 0xe7, 0x1b, 0x08, 0x0a, 0x66, 0x02, 0x05, 0x1a, 0xe7, 0x0a, 0x46, 0x01, 0xc6, 
+  0x42, 0x09, 0xe7, 0x03, 0x01, 0xe6, 0x0a, 0x26, 0x1b, 0x28, 0x12, 0x87, 0x41, 0x01, 0xe6, 0x06, 
+  0x01, 0xc6, 0x12, 0xc7, 0x23, 0x88, 0x12, 0x86, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe6, 0x43, 0x01, 
+  0xc6, 0x44, 0x01, 0xe6, 0x06, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0x64, 0x01, 0x85, 0x22, 0x48, 0x64, 
+  0x30, 0xdf, 0x7d, 0x41, 0xd7, 0x3c, 0x04, 0xd7, 0x5d, 0xae, 0x79, 0x2a, 0xa9, 0x01, 0x85, 0x09, 
+  0xc6, 0x81, 0x01, 0x12, 0xc7, 0x01, 0xa5, 0x86, 0x41, 0x01, 0xe6, 0x82, 0x01, 0x01, 0xc5, 0x01, 
+  0xa5, 0x43, 0x01, 0xc6, 0x80, 0x41, 0x01, 0xe7, 0x49, 0x01, 0xe6, 0x03, 0x01, 0xc6, 0x0a, 0x46, 
+  0x12, 0xc7, 0x02, 0x05, 0x80, 0x08, 0x01, 0xc6, 0x01, 0xc5, 0x12, 0xa7, 0x12, 0x87, 0x01, 0xc6, 
+  0x01, 0xc5, 0x3b, 0x2b, 0xa6, 0x17, 0xd7, 0x5c, 0x41, 0xce, 0xfb, 0x05, 0xd7, 0x5c, 0xd7, 0x3c, 
+  0x4b, 0xcd, 0x2b, 0x0a, 0x01, 0xa5, 0x01, 0xc6, 0x42, 0x01, 0xa6, 0x03, 0x1a, 0xe7, 0x23, 0x68, 
+  0x1b, 0x27, 0x23, 0x88, 0x81, 0x00, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x04, 0x0a, 0x46, 0x1b, 0x48, 
+  0x0a, 0x66, 0x01, 0xe6, 0x01, 0xc6, 0x80, 0x01, 0x1a, 0xe8, 0x12, 0x87, 0x42, 0x0a, 0x66, 0x00, 
+  0x0a, 0x67, 0x47, 0x0a, 0x66, 0x04, 0x0a, 0x86, 0x0a, 0x67, 0x0a, 0x66, 0x0a, 0x67, 0x0a, 0x66, 
+  0x41, 0x0a, 0x87, 0x46, 0x0a, 0x67, 0x42, 0x0a, 0x87, 0x02, 0x12, 0x87, 0x12, 0x67, 0x12, 0x87, 
+  0x5e, 0x0a, 0x26, 0x03, 0x0a, 0x46, 0x0a, 0x66, 0x12, 0x87, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x81, 
+  0x01, 0x01, 0xc6, 0x01, 0xe7, 0x8a, 0x49, 0x01, 0xc6, 0x95, 0x05, 0x0a, 0x86, 0x12, 0xc7, 0x12, 
+  0x87, 0x1a, 0xe7, 0x0a, 0x66, 0x01, 0xc6, 0x42, 0x09, 0xe7, 0x03, 0x01, 0xe6, 0x0a, 0x06, 0x1b, 
+  0x08, 0x0a, 0x66, 0x41, 0x01, 0xe6, 0x04, 0x01, 0xc5, 0x12, 0x86, 0x23, 0x88, 0x0a, 0x66, 0x01, 
+  0xc6, 0x41, 0x01, 0xe6, 0x45, 0x01, 0xc6, 0x44, 0x01, 0xe6, 0x0d, 0x01, 0xc6, 0x01, 0xe6, 0x01, 
+  0xc6, 0x01, 0x65, 0x11, 0xc6, 0x22, 0x28, 0x6c, 0x50, 0xd7, 0x5d, 0xbe, 0xda, 0x43, 0x2c, 0x12, 
+  0x07, 0x09, 0xc6, 0x01, 0xa6, 0x0a, 0x26, 0x41, 0x1b, 0x48, 0x01, 0x0a, 0x26, 0x01, 0xa6, 0x81, 
+  0x00, 0x02, 0x06, 0x81, 0x01, 0x01, 0xe6, 0x02, 0x06, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xc5, 0x41, 
+  0x02, 0x05, 0x00, 0x01, 0xc5, 0x81, 0x41, 0x01, 0xe5, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x00, 
+  0x01, 0xe7, 0x81, 0x00, 0x01, 0xe7, 0x83, 0x00, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x03, 0x01, 0xc6, 
+  0x0a, 0x46, 0x1a, 0xe7, 0x0a, 0x06, 0x41, 0x01, 0xc6, 0x0a, 0x01, 0xe6, 0x1a, 0xc8, 0x12, 0x27, 
+  0x1a, 0x27, 0xbe, 0xba, 0xdf, 0x7d, 0xce, 0xfb, 0xce, 0xfc, 0xdf, 0x7d, 0xce, 0xfb, 0x43, 0x4b, 
+  0x41, 0x01, 0xc5, 0x00, 0x01, 0xe7, 0x43, 0x01, 0xc6, 0x04, 0x0a, 0x26, 0x1b, 0x28, 0x23, 0x89, 
+  0x1b, 0x28, 0x0a, 0x26, 0x41, 0x01, 0xc6, 0x00, 0x09, 0xe6, 0x80, 0x02, 0x0a, 0x26, 0x1b, 0x28, 
+  0x0a, 0x46, 0x42, 0x01, 0xe6, 0x03, 0x1a, 0xe8, 0x12, 0x87, 0x01, 0xc5, 0x01, 0xa6, 0x44, 0x01, 
+  0xc6, 0x00, 0x01, 0xa6, 0x49, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x4d, 0x01, 0xc6, 0x83, 0x00, 0x02, 
+  0x26, 0x82, 0x41, 0x02, 0x26, 0x81, 0x00, 0x02, 0x26, 0x82, 0x41, 0x02, 0x26, 0x81, 0x00, 0x0a, 
+  0x06, 0x81, 0x41, 0x0a, 0x06, 0x80, 0x43, 0x02, 0x26, 0x80, 0x04, 0x02, 0x26, 0x01, 0xc5, 0x0a, 
+  0x46, 0x12, 0xc7, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xe6, 0x43, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x92, 
+  0x42, 0x01, 0xc6, 0x84, 0x00, 0x0a, 0x67, 0x80, 0x00, 0x1b, 0x08, 0x8a, 0x01, 0x12, 0xa6, 0x12, 
+  0xe7, 0x80, 0x01, 0x1b, 0x08, 0x0a, 0x06, 0x82, 0x04, 0x01, 0xe6, 0x0a, 0x26, 0x1b, 0x08, 0x12, 
+  0xa7, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x02, 0x12, 0xa7, 0x23, 0x48, 0x0a, 0x46, 0x49, 0x01, 0xc6, 
+  0x45, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x0d, 0x09, 0xe7, 0x01, 0xc6, 0x01, 0x85, 0x09, 0xc6, 0x1a, 
+  0x48, 0x1a, 0x68, 0x01, 0x85, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xc6, 0x0a, 0x86, 0x1b, 0x88, 0x1b, 
+  0x68, 0x0a, 0x46, 0x80, 0x09, 0x01, 0xc6, 0x0a, 0x26, 0x23, 0x69, 0x0a, 0x06, 0x01, 0xa6, 0x12, 
+  0xc7, 0x23, 0xa9, 0x0a, 0x46, 0x01, 0xc6, 0x0a, 0x46, 0x41, 0x1b, 0x68, 0x00, 0x12, 0x66, 0x41, 
+  0x01, 0xa6, 0x03, 0x12, 0xe7, 0x1b, 0x48, 0x01, 0xe6, 0x01, 0xc6, 0x4a, 0x01, 0xe6, 0x00, 0x01, 
+  0xc6, 0x41, 0x01, 0xe6, 0x02, 0x0a, 0x67, 0x1a, 0xe8, 0x0a, 0x06, 0x80, 0x03, 0x01, 0x85, 0x1a, 
+  0x27, 0x95, 0xb6, 0xc6, 0xba, 0x41, 0xcf, 0x1b, 0x04, 0xd7, 0x3c, 0xd7, 0x5d, 0x9d, 0xd6, 0x2a, 
+  0xa9, 0x01, 0xa5, 0x41, 0x0a, 0x07, 0x80, 0x00, 0x09, 0xe6, 0x44, 0x01, 0xe6, 0x08, 0x02, 0x06, 
+  0x0a, 0x06, 0x01, 0xe6, 0x09, 0xe6, 0x09, 0xe7, 0x01, 0xc6, 0x0a, 0x06, 0x1a, 0xe7, 0x0a, 0x46, 
+  0x41, 0x01, 0xe6, 0x05, 0x02, 0x06, 0x12, 0xc7, 0x12, 0x87, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0xe6, 
+  0x84, 0x00, 0x01, 0xe6, 0x80, 0x49, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x41, 0x01, 
+  0xe7, 0x01, 0x01, 0xe6, 0x01, 0xe7, 0x46, 0x09, 0xe7, 0x42, 0x1a, 0xe8, 0x00, 0x1a, 0xc8, 0x44, 
+  0x12, 0xc8, 0x42, 0x1a, 0xe8, 0x46, 0x12, 0xc8, 0x41, 0x12, 0xc7, 0x00, 0x12, 0xc8, 0x41, 0x12, 
+  0xc7, 0x41, 0x1a, 0xe8, 0x45, 0x1a, 0xc8, 0x04, 0x0a, 0x46, 0x01, 0xc5, 0x12, 0x67, 0x1a, 0xc8, 
+  0x09, 0xe6, 0x42, 0x01, 0xc6, 0x00, 0x09, 0xc6, 0x47, 0x01, 0xe6, 0x49, 0x01, 0xc6, 0x41, 0x01, 
+  0xe6, 0x88, 0x00, 0x0a, 0x66, 0x80, 0x00, 0x1b, 0x28, 0x81, 0x00, 0x1a, 0xe8, 0x86, 0x00, 0x12, 
+  0xa7, 0x80, 0x00, 0x12, 0xc7, 0x81, 0x00, 0x0a, 0x26, 0x80, 0x0c, 0x09, 0xe6, 0x01, 0xe6, 0x0a, 
+  0x26, 0x1b, 0x08, 0x12, 0x87, 0x02, 0x06, 0x0a, 0x06, 0x01, 0xe6, 0x12, 0xa7, 0x23, 0x68, 0x12, 
+  0x66, 0x01, 0xc6, 0x01, 0xe6, 0x8f, 0x42, 0x01, 0xe6, 0x04, 0x09, 0xe7, 0x01, 0xc6, 0x01, 0x85, 
+  0x01, 0xa6, 0x09, 0xc6, 0x42, 0x01, 0xe6, 0x01, 0x0a, 0xc6, 0x1b, 0xa8, 0x80, 0x00, 0x0a, 0x26, 
+  0x41, 0x01, 0xa6, 0x06, 0x0a, 0x06, 0x23, 0x49, 0x02, 0x06, 0x01, 0xc6, 0x13, 0x07, 0x23, 0xc9, 
+  0x0a, 0x67, 0x81, 0x41, 0x1b, 0x88, 0x80, 0x03, 0x01, 0xa5, 0x01, 0xc6, 0x13, 0x08, 0x1b, 0x68, 
+  0x81, 0x45, 0x01, 0xc6, 0x85, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x08, 0x12, 0x67, 0x12, 0x87, 
+  0x01, 0xa5, 0x22, 0x68, 0xb6, 0x58, 0xdf, 0x7d, 0xd7, 0x3c, 0xce, 0xfb, 0xcf, 0x3c, 0x80, 0x03, 
+  0x74, 0x51, 0x01, 0x23, 0x01, 0x64, 0x01, 0xe6, 0x47, 0x01, 0xc6, 0x41, 0x01, 0xa6, 0x43, 0x01, 
+  0xc6, 0x08, 0x0a, 0x46, 0x1a, 0xe7, 0x0a, 0x06, 0x01, 0xa6, 0x01, 0xc6, 0x01, 0xe5, 0x1a, 0xc7, 
+  0x12, 0x87, 0x01, 0xc5, 0x4a, 0x01, 0xc6, 0x82, 0x00, 0x01, 0xc6, 0x45, 0x01, 0xe6, 0x00, 0x01, 
+  0xc6, 0x43, 0x01, 0xe6, 0x87, 0x42, 0x12, 0x87, 0x00, 0x0a, 0x87, 0x45, 0x12, 0x87, 0x00, 0x0a, 
+  0x87, 0x42, 0x12, 0x87, 0x00, 0x0a, 0x86, 0x41, 0x0a, 0x87, 0x01, 0x12, 0x87, 0x0a, 0x87, 0x41, 
+  0x12, 0x87, 0x41, 0x0a, 0x87, 0x00, 0x12, 0x87, 0x45, 0x01, 0xe6, 0x07, 0x01, 0xc6, 0x09, 0xe6, 
+  0x1a, 0xc8, 0x0a, 0x46, 0x01, 0xc5, 0x12, 0x67, 0x1a, 0xc7, 0x09, 0xe6, 0x80, 0x01, 0x09, 0xc6, 
+  0x01, 0xc6, 0x80, 0x00, 0x01, 0xc6, 0x84, 0x4a, 0x01, 0xc6, 0x85, 0x41, 0x01, 0xc6, 0x83, 0x00, 
+  0x02, 0x05, 0x80, 0x01, 0x01, 0xe6, 0x12, 0xa7, 0x84, 0x00, 0x0a, 0x26, 0x81, 0x01, 0x12, 0xc7, 
+  0x12, 0xa7, 0x81, 0x0e, 0x1a, 0xe8, 0x0a, 0x06, 0x09, 0xc6, 0x01, 0xa6, 0x0a, 0x06, 0x1b, 0x08, 
+  0x12, 0x87, 0x01, 0xe6, 0x0a, 0x26, 0x01, 0xe6, 0x12, 0xa7, 0x23, 0x88, 0x12, 0x66, 0x01, 0xc6, 
+  0x01, 0xe6, 0x49, 0x01, 0xc6, 0x81, 0x44, 0x01, 0xc6, 0x80, 0x43, 0x01, 0xc6, 0x00, 0x01, 0xe6, 
+  0x42, 0x01, 0xc6, 0x00, 0x01, 0xe7, 0x80, 0x03, 0x12, 0xe7, 0x23, 0xe8, 0x23, 0xa8, 0x0a, 0x46, 
+  0x83, 0x09, 0x0a, 0x06, 0x01, 0xa6, 0x12, 0xc7, 0x23, 0xa9, 0x0a, 0x47, 0x01, 0xa6, 0x0a, 0x26, 
+  0x23, 0x88, 0x23, 0xa9, 0x12, 0xa7, 0x80, 0x02, 0x01, 0xe6, 0x1b, 0x48, 0x23, 0x88, 0x82, 0x41, 
+  0x09, 0xc6, 0x86, 0x42, 0x01, 0xc6, 0x80, 0x05, 0x0a, 0x07, 0x01, 0xa5, 0x33, 0x2a, 0x6c, 0xd1, 
+  0xae, 0x38, 0xdf, 0x9d, 0x41, 0xcf, 0x1b, 0x03, 0xe7, 0x9e, 0xd7, 0x7c, 0x5c, 0x4f, 0x09, 0xc5, 
+  0x42, 0x0a, 0x46, 0x41, 0x0a, 0x67, 0x00, 0x0a, 0x87, 0x43, 0x0a, 0x67, 0x43, 0x12, 0x67, 0x41, 
+  0x12, 0x87, 0x09, 0x0a, 0x87, 0x1b, 0x08, 0x0a, 0x66, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0xc5, 0x12, 
+  0xc7, 0x12, 0x87, 0x01, 0xc6, 0x01, 0xe6, 0x88, 0x00, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x80, 0x47, 
+  0x01, 0xc6, 0x44, 0x01, 0xe6, 0x42, 0x01, 0xe7, 0x83, 0x00, 0x0a, 0x07, 0x45, 0x12, 0xe7, 0x42, 
+  0x12, 0xc7, 0x00, 0x12, 0xe7, 0x41, 0x12, 0xc7, 0x00, 0x12, 0xe7, 0x49, 0x12, 0xc7, 0x01, 0x12, 
+  0xa7, 0x12, 0x67, 0x82, 0x41, 0x01, 0xc6, 0x08, 0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x06, 0x1a, 0xc8, 
+  0x12, 0x87, 0x01, 0xc6, 0x12, 0x67, 0x1a, 0xc8, 0x0a, 0x06, 0x41, 0x01, 0xc6, 0x46, 0x01, 0xe6, 
+  0x4b, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x85, 0x00, 0x01, 0xc6, 0x82, 0x00, 0x1b, 0x08, 0x86, 0x00, 
+  0x0a, 0x27, 0x84, 0x00, 0x0a, 0x87, 0x80, 0x0c, 0x0a, 0x26, 0x01, 0xa6, 0x0a, 0x06, 0x1a, 0xc7, 
+  0x0a, 0x67, 0x01, 0xe6, 0x09, 0xe6, 0x01, 0xe6, 0x12, 0xc7, 0x23, 0x89, 0x12, 0x87, 0x01, 0xe6, 
+  0x01, 0xe7, 0x49, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x49, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x81, 0x41, 
+  0x01, 0xe6, 0x03, 0x0a, 0x66, 0x13, 0x07, 0x12, 0xe7, 0x0a, 0x26, 0x80, 0x03, 0x01, 0xc6, 0x02, 
+  0x06, 0x12, 0xa7, 0x01, 0xe6, 0x80, 0x02, 0x0a, 0x46, 0x12, 0xc7, 0x0a, 0x06, 0x80, 0x04, 0x09, 
+  0xe6, 0x12, 0xc7, 0x12, 0xe7, 0x0a, 0x46, 0x01, 0xc6, 0x80, 0x41, 0x12, 0xc7, 0x00, 0x01, 0xc5, 
+  0x47, 0x01, 0xc6, 0x80, 0x44, 0x01, 0xc6, 0x06, 0x01, 0xa6, 0x01, 0x24, 0x01, 0x85, 0xa5, 0xf7, 
+  0xdf, 0xbe, 0xd7, 0x3c, 0xd7, 0x1c, 0x41, 0xdf, 0x5d, 0x04, 0x8c, 0xf3, 0x53, 0xee, 0x0a, 0x66, 
+  0x12, 0xc7, 0x12, 0xa7, 0x43, 0x12, 0x87, 0x45, 0x12, 0xa7, 0x00, 0x12, 0xc7, 0x42, 0x12, 0xa7, 
+  0x09, 0x12, 0xc7, 0x1a, 0xe8, 0x0a, 0x46, 0x01, 0xe6, 0x09, 0xe6, 0x01, 0xe5, 0x12, 0xc7, 0x12, 
+  0xa7, 0x01, 0xc5, 0x01, 0xe6, 0x4a, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x48, 0x01, 0xc6, 0x88, 0x00, 
+  0x01, 0xe7, 0x80, 0x01, 0x0a, 0x07, 0x01, 0xc6, 0x45, 0x01, 0xa5, 0x01, 0x01, 0xc5, 0x01, 0xa5, 
+  0x49, 0x01, 0xc5, 0x43, 0x01, 0xa5, 0x01, 0x01, 0xc6, 0x01, 0xc5, 0x80, 0x02, 0x12, 0x86, 0x01, 
+  0xe5, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x09, 0x01, 0xc6, 0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x06, 0x1a, 
+  0xc8, 0x12, 0x67, 0x01, 0xc6, 0x12, 0x47, 0x1a, 0xe8, 0x09, 0xe6, 0x41, 0x01, 0xc6, 0x81, 0x00, 
+  0x09, 0xe6, 0x81, 0x4d, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x85, 0x02, 0x0a, 0x67, 0x02, 0x06, 0x1b, 
+  0x28, 0x80, 0x00, 0x12, 0x87, 0x81, 0x00, 0x1b, 0x08, 0x80, 0x00, 0x01, 0xc6, 0x82, 0x41, 0x12, 
+  0xa7, 0x82, 0x0a, 0x0a, 0x06, 0x01, 0xc6, 0x1a, 0xc7, 0x12, 0xa7, 0x01, 0xa6, 0x01, 0xc6, 0x01, 
+  0xc5, 0x12, 0xa7, 0x23, 0x88, 0x12, 0x87, 0x01, 0xc6, 0x80, 0x4a, 0x01, 0xc6, 0x80, 0x00, 0x01, 
+  0xe7, 0x8a, 0x41, 0x01, 0xc6, 0x43, 0x01, 0xe6, 0x44, 0x01, 0xc5, 0x80, 0x00, 0x01, 0xc5, 0x42, 
+  0x01, 0xa5, 0x41, 0x01, 0x85, 0x43, 0x01, 0xa5, 0x42, 0x01, 0xc5, 0x41, 0x01, 0xe5, 0x02, 0x01, 
+  0xc5, 0x01, 0xa5, 0x01, 0xa6, 0x48, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x80, 0x05, 0x09, 0xc6, 0x01, 
+  0x65, 0x09, 0x44, 0x64, 0x30, 0x7c, 0xd2, 0xd7, 0x5d, 0x41, 0xcf, 0x1c, 0x07, 0xdf, 0x5d, 0xae, 
+  0x58, 0x64, 0x6f, 0x01, 0x64, 0x01, 0x43, 0x01, 0xc5, 0x01, 0xe5, 0x01, 0xc5, 0x45, 0x01, 0xa5, 
+  0x04, 0x01, 0xa6, 0x01, 0xc6, 0x01, 0xc5, 0x01, 0xa5, 0x01, 0xc5, 0x42, 0x01, 0xa5, 0x02, 0x01, 
+  0xc5, 0x01, 0xa5, 0x01, 0xc6, 0x80, 0x04, 0x01, 0xc5, 0x12, 0xa7, 0x12, 0x87, 0x01, 0xc5, 0x01, 
+  0xe6, 0x47, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x80, 0x42, 0x01, 0xe6, 0x4b, 0x01, 0xc6, 0x00, 0x01, 
+  0xe7, 0x82, 0x00, 0x01, 0xe6, 0x81, 0x03, 0x09, 0xe7, 0x01, 0xe6, 0x09, 0xc6, 0x85, 0x33, 0x46, 
+  0x1b, 0x08, 0x00, 0x1b, 0x09, 0x45, 0x1b, 0x08, 0x42, 0x1a, 0xe8, 0x44, 0x1b, 0x08, 0x00, 0x0a, 
+  0x26, 0x41, 0x01, 0xe6, 0x02, 0x1a, 0xa7, 0x1a, 0xc7, 0x01, 0xc5, 0x83, 0x08, 0x09, 0xe7, 0x01, 
+  0xc6, 0x0a, 0x26, 0x1a, 0xc8, 0x12, 0x67, 0x01, 0xc5, 0x12, 0x67, 0x12, 0xa7, 0x09, 0xe6, 0x41, 
+  0x01, 0xc6, 0x42, 0x01, 0xe6, 0x4e, 0x01, 0xc6, 0x89, 0x00, 0x02, 0x05, 0x85, 0x01, 0x0a, 0x67, 
+  0x01, 0xa6, 0x82, 0x00, 0x12, 0xc7, 0x81, 0x00, 0x12, 0x87, 0x81, 0x01, 0x0a, 0x26, 0x1a, 0xe8, 
+  0x41, 0x01, 0xc6, 0x03, 0x01, 0xc5, 0x12, 0x86, 0x23, 0x48, 0x12, 0xa7, 0x42, 0x01, 0xe6, 0x88, 
+  0x45, 0x01, 0xe6, 0x87, 0x44, 0x01, 0xe6, 0x03, 0x01, 0xc6, 0x09, 0xe5, 0x12, 0xe7, 0x13, 0x07, 
+  0x41, 0x1b, 0x27, 0x00, 0x13, 0x27, 0x43, 0x1b, 0x27, 0x41, 0x1b, 0x07, 0x41, 0x13, 0x07, 0x41, 
+  0x13, 0x27, 0x02, 0x1b, 0x27, 0x13, 0x47, 0x1b, 0x47, 0x41, 0x13, 0x47, 0x02, 0x1b, 0x48, 0x1b, 
+  0x27, 0x12, 0xe7, 0x48, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x05, 0x01, 0x85, 0x01, 0x44, 0x7c, 0xd2, 
+  0xd7, 0x9d, 0xd7, 0x7d, 0xcf, 0x1b, 0x80, 0x05, 0xcf, 0x3c, 0xdf, 0x9e, 0x54, 0x4e, 0x02, 0xa6, 
+  0x0a, 0x46, 0x01, 0xc5, 0x42, 0x01, 0xe5, 0x45, 0x01, 0xc5, 0x41, 0x01, 0xc6, 0x00, 0x01, 0xe6, 
+  0x47, 0x01, 0xc5, 0x02, 0x01, 0xe5, 0x12, 0xa7, 0x12, 0x66, 0x41, 0x01, 0xe6, 0x43, 0x01, 0xc6, 
+  0x00, 0x01, 0xc7, 0x87, 0x01, 0x01, 0xc6, 0x01, 0xe6, 0x89, 0x00, 0x01, 0xe6, 0x81, 0x42, 0x01, 
+  0xc6, 0x00, 0x09, 0xe6, 0x41, 0x01, 0xc6, 0x02, 0x01, 0xa5, 0x7c, 0xf3, 0xd7, 0x7d, 0x4d, 0x0a, 
+  0x66, 0x00, 0x0a, 0x46, 0x42, 0x0a, 0x66, 0x41, 0x0a, 0x46, 0x07, 0x0a, 0x67, 0x12, 0x67, 0x1a, 
+  0xe7, 0x0a, 0x26, 0x01, 0xa5, 0x09, 0xc5, 0x1a, 0xa7, 0x1a, 0xc7, 0x80, 0x42, 0x09, 0xe6, 0x09, 
+  0x09, 0xc6, 0x09, 0xe7, 0x01, 0xc6, 0x09, 0xe6, 0x1a, 0xe8, 0x12, 0x67, 0x01, 0x85, 0x0a, 0x26, 
+  0x1a, 0xc7, 0x09, 0xe6, 0x82, 0x4a, 0x01, 0xc6, 0x47, 0x01, 0xe6, 0x85, 0x00, 0x0a, 0x66, 0x81, 
+  0x00, 0x01, 0xe5, 0x81, 0x00, 0x01, 0xc5, 0x85, 0x41, 0x12, 0xa7, 0x81, 0x02, 0x1b, 0x08, 0x0a, 
+  0x26, 0x0a, 0x46, 0x80, 0x04, 0x01, 0xa6, 0x0a, 0x06, 0x12, 0xc7, 0x23, 0x48, 0x0a, 0x67, 0x43, 
+  0x01, 0xe6, 0x9a, 0x03, 0x01, 0xc6, 0x0a, 0x26, 0x1b, 0x27, 0x23, 0xa8, 0x4d, 0x1b, 0xc8, 0x44, 
+  0x1b, 0xe8, 0x03, 0x1b, 0xc8, 0x23, 0xc8, 0x1b, 0x88, 0x01, 0xe6, 0x43, 0x01, 0xa6, 0x82, 0x08, 
+  0x01, 0xe6, 0x09, 0xe7, 0x0a, 0x07, 0x09, 0xe6, 0x74, 0xb1, 0xa6, 0x17, 0xcf, 0x3c, 0xcf, 0x1b, 
+  0xc6, 0xfb, 0x41, 0xcf, 0x3c, 0x06, 0xcf, 0x1b, 0xcf, 0x3c, 0x3b, 0x8b, 0x0a, 0xc6, 0x1b, 0x28, 
+  0x1a, 0xe7, 0x1b, 0x08, 0x42, 0x1b, 0x28, 0x01, 0x1b, 0x08, 0x1a, 0xe7, 0x42, 0x1a, 0xe8, 0x00, 
+  0x1a, 0xc8, 0x41, 0x1a, 0xc7, 0x00, 0x1a, 0xc8, 0x41, 0x1a, 0xe8, 0x41, 0x1a, 0xc8, 0x41, 0x1a, 
+  0xe8, 0x41, 0x1b, 0x08, 0x01, 0x12, 0x87, 0x01, 0xe6, 0x49, 0x01, 0xc6, 0x45, 0x01, 0xe6, 0x49, 
+  0x01, 0xc6, 0x42, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x07, 0x01, 0xe6, 0x09, 0xe6, 0x01, 0xc6, 0x09, 
+  0xa6, 0x09, 0x85, 0x74, 0xb2, 0xdf, 0x7d, 0xcf, 0x1c, 0x41, 0x1b, 0x08, 0x42, 0x1a, 0xe8, 0x03, 
+  0x12, 0xe7, 0x1a, 0xe7, 0x1a, 0xe8, 0x12, 0xe8, 0x41, 0x1a, 0xe8, 0x42, 0x1b, 0x08, 0x00, 0x1a, 
+  0xe8, 0x41, 0x1b, 0x08, 0x07, 0x1a, 0xe8, 0x0a, 0x26, 0x01, 0xc5, 0x01, 0xe6, 0x01, 0xe5, 0x0a, 
+  0x26, 0x1a, 0xc7, 0x0a, 0x46, 0x41, 0x01, 0xc5, 0x41, 0x12, 0x86, 0x00, 0x01, 0xc5, 0x80, 0x00, 
+  0x09, 0xc7, 0x42, 0x09, 0xe6, 0x07, 0x01, 0xc6, 0x0a, 0x06, 0x1a, 0xc7, 0x0a, 0x66, 0x01, 0xc5, 
+  0x12, 0x46, 0x1a, 0xe8, 0x0a, 0x26, 0x42, 0x01, 0xe6, 0x83, 0x41, 0x01, 0xe6, 0x82, 0x4a, 0x01, 
+  0xe6, 0x8a, 0x01, 0x1a, 0xe8, 0x0a, 0x66, 0x80, 0x00, 0x0a, 0x26, 0x83, 0x01, 0x12, 0xe7, 0x12, 
+  0xa7, 0x82, 0x05, 0x1b, 0x08, 0x01, 0xc5, 0x0a, 0x67, 0x12, 0xa7, 0x0a, 0x26, 0x01, 0xc6, 0x81, 
+  0x00, 0x01, 0xe7, 0x48, 0x01, 0xc6, 0x43, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x89, 0x41, 0x01, 0xc6, 
+  0x80, 0x41, 0x01, 0xc6, 0x00, 0x1b, 0x48, 0x4f, 0x1b, 0xa8, 0x00, 0x1b, 0xc8, 0x41, 0x1b, 0xa8, 
+  0x43, 0x1b, 0xc8, 0x80, 0x01, 0x02, 0x06, 0x01, 0xc6, 0x42, 0x01, 0xc5, 0x41, 0x01, 0xa6, 0x80, 
+  0x41, 0x0a, 0x07, 0x03, 0x01, 0xc5, 0x6c, 0x91, 0xdf, 0x9e, 0xdf, 0x7d, 0x41, 0xcf, 0x1c, 0x00, 
+  0xd7, 0x5c, 0x80, 0x08, 0x74, 0x71, 0x22, 0x27, 0x22, 0x48, 0x0a, 0x06, 0x02, 0x26, 0x0a, 0x46, 
+  0x0a, 0x26, 0x0a, 0x06, 0x0a, 0x26, 0x42, 0x0a, 0x46, 0x4d, 0x0a, 0x26, 0x01, 0x0a, 0x46, 0x0a, 
+  0x26, 0x41, 0x01, 0xe6, 0x84, 0x44, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x45, 0x01, 0xe6, 0x81, 0x44, 
+  0x01, 0xe6, 0x82, 0x00, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x07, 0x01, 0xe7, 0x09, 0xe7, 0x01, 0x65, 
+  0x5b, 0xce, 0xbe, 0xba, 0xce, 0xfb, 0xd7, 0x3d, 0xd7, 0x5d, 0x42, 0x02, 0x06, 0x00, 0x0a, 0x06, 
+  0x41, 0x02, 0x06, 0x02, 0x0a, 0x06, 0x02, 0x06, 0x0a, 0x06, 0x42, 0x02, 0x06, 0x00, 0x0a, 0x06, 
+  0x41, 0x02, 0x06, 0x0a, 0x0a, 0x06, 0x02, 0x06, 0x0a, 0x26, 0x0a, 0x67, 0x0a, 0x26, 0x02, 0x06, 
+  0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x26, 0x1b, 0x08, 0x0a, 0x46, 0x41, 0x01, 0xa5, 0x41, 0x12, 0xa7, 
+  0x02, 0x01, 0xe6, 0x09, 0xe6, 0x09, 0xc7, 0x80, 0x09, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0xc6, 0x01, 
+  0xe6, 0x1b, 0x08, 0x0a, 0x66, 0x01, 0xe5, 0x12, 0x87, 0x1b, 0x08, 0x02, 0x06, 0x85, 0x41, 0x01, 
+  0xc6, 0x49, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x88, 0x01, 0x01, 0xe6, 0x12, 0xa7, 0x80, 0x02, 0x01, 
+  0xa5, 0x1b, 0x08, 0x0a, 0x67, 0x83, 0x00, 0x12, 0xc7, 0x84, 0x00, 0x0a, 0x67, 0x80, 0x42, 0x01, 
+  0xe6, 0x44, 0x01, 0xc6, 0x41, 0x01, 0xe7, 0x80, 0x49, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x41, 0x01, 
+  0xe6, 0x84, 0x01, 0x01, 0xe6, 0x02, 0x06, 0x41, 0x0a, 0x26, 0x03, 0x0a, 0x46, 0x02, 0x06, 0x01, 
+  0xe6, 0x1b, 0x88, 0x84, 0x51, 0x1b, 0xc8, 0x00, 0x1b, 0xa8, 0x80, 0x06, 0x0a, 0x66, 0x1b, 0x68, 
+  0x1b, 0x27, 0x1b, 0x47, 0x12, 0x66, 0x09, 0xe6, 0x01, 0xa6, 0x41, 0x01, 0x85, 0x08, 0x74, 0xb1, 
+  0xd7, 0x5d, 0xcf, 0x3c, 0xcf, 0x1c, 0xd7, 0x3c, 0xd7, 0x3d, 0xc6, 0xba, 0x7c, 0x91, 0x01, 0x23, 
+  0x41, 0x01, 0xa5, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xa5, 0x03, 
+  0x01, 0xc5, 0x02, 0x26, 0x0a, 0x26, 0x01, 0xe6, 0x53, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x41, 0x01, 
+  0xc6, 0x83, 0x00, 0x01, 0xe7, 0x87, 0x00, 0x01, 0xc6, 0x46, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x80, 
+  0x03, 0x09, 0xe6, 0x01, 0xe6, 0x01, 0x64, 0x5b, 0xef, 0x41, 0xcf, 0x3c, 0x80, 0x01, 0xcf, 0x3c, 
+  0xbe, 0x9a, 0x45, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x48, 0x01, 0xc6, 0x04, 0x01, 0xe6, 0x01, 0xc6, 
+  0x0a, 0x47, 0x23, 0x68, 0x12, 0xc7, 0x41, 0x01, 0xc6, 0x09, 0x01, 0xc5, 0x0a, 0x06, 0x1a, 0xe8, 
+  0x12, 0x66, 0x01, 0xc5, 0x01, 0xe6, 0x1a, 0xc7, 0x12, 0x87, 0x01, 0xe6, 0x09, 0xe7, 0x80, 0x00, 
+  0x09, 0xc6, 0x41, 0x09, 0xe6, 0x07, 0x01, 0xc6, 0x01, 0xe6, 0x12, 0xc7, 0x12, 0x87, 0x01, 0xe6, 
+  0x12, 0x67, 0x1a, 0xc7, 0x0a, 0x26, 0x46, 0x01, 0xc6, 0x4a, 0x01, 0xe6, 0x82, 0x41, 0x01, 0xe6, 
+  0x86, 0x01, 0x1b, 0x08, 0x01, 0xc5, 0x82, 0x00, 0x0a, 0x27, 0x83, 0x00, 0x12, 0xe8, 0x83, 0x01, 
+  0x1b, 0x28, 0x01, 0xe5, 0x42, 0x01, 0xe6, 0x83, 0x00, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x87, 0x41, 
+  0x01, 0xc6, 0x42, 0x01, 0xe6, 0x83, 0x09, 0x01, 0xe6, 0x01, 0xc6, 0x12, 0x86, 0x23, 0xa8, 0x23, 
+  0x88, 0x23, 0xa9, 0x0a, 0x67, 0x02, 0x06, 0x1b, 0xa8, 0x1b, 0xc8, 0x81, 0x00, 0x1b, 0xc8, 0x42, 
+  0x1b, 0xa8, 0x8f, 0x12, 0x1b, 0x88, 0x01, 0xe6, 0x0a, 0xa7, 0x24, 0x09, 0x23, 0xc8, 0x1b, 0xa8, 
+  0x1b, 0x68, 0x12, 0xe7, 0x09, 0xe5, 0x2a, 0xa9, 0x64, 0x2f, 0xd7, 0x9d, 0xcf, 0x3c, 0xcf, 0x1b, 
+  0xd7, 0x3c, 0xd7, 0x5c, 0xae, 0x37, 0x11, 0xc6, 0x01, 0x44, 0x41, 0x01, 0x85, 0x42, 0x01, 0xa6, 
+  0x41, 0x01, 0xc6, 0x81, 0x00, 0x1a, 0xc7, 0x41, 0x23, 0x88, 0x01, 0x12, 0xa7, 0x02, 0x06, 0x88, 
+  0x42, 0x01, 0xe6, 0x87, 0x44, 0x01, 0xe6, 0x47, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x41, 0x01, 0xe7, 
+  0x82, 0x43, 0x01, 0xe7, 0x41, 0x0a, 0x07, 0x07, 0x01, 0x85, 0x53, 0xae, 0xcf, 0x3c, 0xc7, 0x3c, 
+  0xc6, 0xfb, 0xd7, 0x5d, 0x9d, 0x96, 0x19, 0xc7, 0x50, 0x01, 0xe6, 0x04, 0x01, 0xe7, 0x01, 0xe6, 
+  0x0a, 0x46, 0x1b, 0x28, 0x12, 0x87, 0x42, 0x01, 0xc6, 0x08, 0x0a, 0x06, 0x1a, 0xe8, 0x0a, 0x46, 
+  0x01, 0xc6, 0x01, 0xe6, 0x12, 0xa7, 0x12, 0x87, 0x01, 0xc6, 0x09, 0xc6, 0x41, 0x09, 0xe6, 0x41, 
+  0x09, 0xe7, 0x80, 0x06, 0x0a, 0x26, 0x1b, 0x08, 0x12, 0x67, 0x01, 0xc6, 0x12, 0x67, 0x12, 0xa7, 
+  0x01, 0xe6, 0x80, 0x41, 0x01, 0xe6, 0x80, 0x51, 0x01, 0xe6, 0x90, 0x00, 0x1a, 0xe7, 0x80, 0x02, 
+  0x1b, 0x28, 0x02, 0x26, 0x0a, 0x66, 0x82, 0x00, 0x01, 0xe7, 0x84, 0x43, 0x01, 0xc6, 0x89, 0x43, 
+  0x01, 0xc6, 0x00, 0x01, 0xe6, 0x80, 0x41, 0x01, 0xe6, 0x80, 0x01, 0x0a, 0x46, 0x1b, 0x07, 0x41, 
+  0x1a, 0xe7, 0x01, 0x09, 0xe6, 0x01, 0xe6, 0x82, 0x00, 0x1b, 0xc8, 0x42, 0x1b, 0xa8, 0x50, 0x1b, 
+  0xc8, 0x80, 0x00, 0x01, 0xe5, 0x80, 0x01, 0x13, 0x87, 0x0b, 0x26, 0x80, 0x11, 0x02, 0x64, 0x01, 
+  0x83, 0x54, 0x0e, 0xc7, 0x3c, 0xcf, 0x5c, 0xcf, 0x3c, 0xcf, 0x1c, 0xd7, 0x7d, 0xe7, 0xbe, 0x6c, 
+  0xf1, 0x23, 0x68, 0x12, 0xe7, 0x0a, 0x86, 0x0a, 0x46, 0x0a, 0x26, 0x0a, 0x46, 0x12, 0x47, 0x12, 
+  0x67, 0x41, 0x12, 0x87, 0x06, 0x12, 0x67, 0x1a, 0xc7, 0x23, 0x67, 0x1a, 0xe7, 0x1b, 0x47, 0x23, 
+  0x68, 0x02, 0x26, 0x81, 0x02, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x82, 0x46, 
+  0x01, 0xc6, 0x45, 0x01, 0xe6, 0x01, 0x09, 0xe6, 0x09, 0xe7, 0x83, 0x00, 0x01, 0xe6, 0x80, 0x4b, 
+  0x01, 0xe6, 0x00, 0x0a, 0x07, 0x41, 0x01, 0xa5, 0x07, 0x64, 0x50, 0xd7, 0x7d, 0xcf, 0x1c, 0xc6, 
+  0xfb, 0xcf, 0x5c, 0xa5, 0xf7, 0x11, 0xa6, 0x01, 0x64, 0x00, 0x01, 0xc6, 0x82, 0x00, 0x01, 0xc6, 
+  0x83, 0x41, 0x01, 0xc6, 0x86, 0x04, 0x09, 0xe7, 0x01, 0xc6, 0x0a, 0x26, 0x1b, 0x07, 0x12, 0x67, 
+  0x80, 0x04, 0x01, 0xe6, 0x01, 0xc5, 0x0a, 0x26, 0x1a, 0xe8, 0x0a, 0x46, 0x80, 0x00, 0x01, 0xe5, 
+  0x41, 0x12, 0xa7, 0x00, 0x01, 0xc6, 0x80, 0x01, 0x09, 0xe7, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x08, 
+  0x09, 0xc6, 0x0a, 0x06, 0x1a, 0xa8, 0x12, 0x67, 0x01, 0xc5, 0x0a, 0x46, 0x1a, 0xa7, 0x01, 0xe6, 
+  0x01, 0xc6, 0x86, 0x00, 0x01, 0xc6, 0x4c, 0x01, 0xe6, 0x85, 0x00, 0x1a, 0xe8, 0x81, 0x00, 0x0a, 
+  0x87, 0x80, 0x00, 0x0a, 0x06, 0x82, 0x02, 0x12, 0xc7, 0x12, 0xe7, 0x0a, 0xa7, 0x84, 0x01, 0x01, 
+  0xe7, 0x01, 0xe6, 0x47, 0x01, 0xc6, 0x46, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x84, 0x00, 0x01, 0xe6, 
+  0x42, 0x01, 0xc6, 0x43, 0x01, 0xe6, 0x41, 0x01, 0xc5, 0x41, 0x01, 0xa5, 0x01, 0x01, 0xe5, 0x1b, 
+  0x88, 0x96, 0x07, 0x1b, 0x68, 0x01, 0xc5, 0x01, 0x22, 0x2a, 0xe9, 0x7d, 0x52, 0x23, 0x28, 0x4b, 
+  0xcc, 0x74, 0xb1, 0x41, 0xcf, 0x3c, 0x09, 0xcf, 0x1b, 0xc6, 0xfb, 0xdf, 0x9d, 0xae, 0x17, 0x74, 
+  0x91, 0x12, 0xa7, 0x12, 0xe7, 0x1b, 0x28, 0x1b, 0x08, 0x12, 0xc7, 0x43, 0x12, 0xa7, 0x41, 0x12, 
+  0xc7, 0x04, 0x1a, 0xe7, 0x1b, 0x27, 0x23, 0x68, 0x12, 0xa6, 0x1b, 0x07, 0x80, 0x00, 0x0a, 0x26, 
+  0x81, 0x41, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x01, 0x01, 0xc7, 0x01, 0xe7, 0x85, 
+  0x47, 0x01, 0xe6, 0x02, 0x01, 0xe7, 0x01, 0xe6, 0x02, 0x07, 0x80, 0x41, 0x01, 0xe6, 0x43, 0x01, 
+  0xc6, 0x44, 0x01, 0xc5, 0x0e, 0x01, 0xc6, 0x01, 0xa6, 0x01, 0xa5, 0x01, 0xc6, 0x01, 0x85, 0x53, 
+  0xce, 0x7c, 0xf3, 0xdf, 0x7d, 0xdf, 0x5d, 0xcf, 0x1b, 0xd7, 0x7d, 0xae, 0x17, 0x11, 0x85, 0x01, 
+  0x03, 0x01, 0x45, 0x81, 0x00, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x45, 0x01, 0xc6, 0x84, 0x06, 0x09, 
+  0xe7, 0x01, 0xe6, 0x09, 0xe6, 0x01, 0xc6, 0x0a, 0x26, 0x23, 0x28, 0x12, 0x87, 0x42, 0x01, 0xc6, 
+  0x08, 0x0a, 0x06, 0x1a, 0xc7, 0x0a, 0x46, 0x01, 0xc6, 0x09, 0xe5, 0x1a, 0xa7, 0x12, 0x87, 0x01, 
+  0xc5, 0x01, 0xe6, 0x82, 0x09, 0x09, 0xe7, 0x01, 0xe6, 0x09, 0xe6, 0x12, 0xc8, 0x12, 0x87, 0x01, 
+  0xe6, 0x12, 0x87, 0x1a, 0xe8, 0x0a, 0x86, 0x02, 0x25, 0x46, 0x01, 0xe5, 0x81, 0x41, 0x01, 0xc6, 
+  0x81, 0x00, 0x01, 0xc6, 0x8e, 0x00, 0x12, 0x87, 0x80, 0x00, 0x0a, 0x26, 0x85, 0x00, 0x1b, 0x08, 
+  0x83, 0x42, 0x01, 0xe6, 0x82, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x43, 0x01, 0xe6, 0x00, 0x01, 
+  0xe7, 0x43, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x41, 0x01, 0xe6, 
+  0x84, 0x41, 0x02, 0x06, 0x02, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0xe6, 0x81, 0x42, 0x1b, 0xc8, 0x80, 
+  0x50, 0x1b, 0xc8, 0x08, 0x23, 0xc8, 0x13, 0x67, 0x2a, 0xe9, 0x64, 0x0f, 0x95, 0x95, 0xdf, 0xff, 
+  0x8d, 0x54, 0xc6, 0xfb, 0xe7, 0xdf, 0x80, 0x06, 0xd7, 0x3c, 0xd7, 0x7d, 0xdf, 0xde, 0xa6, 0x17, 
+  0x21, 0xe7, 0x01, 0x03, 0x0a, 0x06, 0x41, 0x02, 0x06, 0x01, 0x01, 0xe6, 0x01, 0xc5, 0x44, 0x01, 
+  0xa5, 0x07, 0x01, 0xa6, 0x01, 0xc5, 0x0a, 0x46, 0x23, 0x48, 0x23, 0x89, 0x23, 0x68, 0x12, 0xc7, 
+  0x01, 0xe5, 0x47, 0x01, 0xe6, 0x45, 0x01, 0xc6, 0x50, 0x01, 0xe6, 0x02, 0x0a, 0x06, 0x12, 0xe8, 
+  0x1a, 0xe8, 0x42, 0x12, 0xc8, 0x41, 0x1a, 0xc8, 0x41, 0x12, 0xc8, 0x0b, 0x12, 0xc7, 0x12, 0xa7, 
+  0x0a, 0x46, 0x5c, 0x0f, 0xd7, 0x3c, 0xe7, 0xbe, 0xcf, 0x1c, 0xcf, 0x3c, 0xe7, 0xbe, 0xc6, 0xba, 
+  0x43, 0x8c, 0x12, 0x66, 0x41, 0x1a, 0x87, 0x81, 0x43, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x42, 0x01, 
+  0xe6, 0x86, 0x41, 0x01, 0xe6, 0x05, 0x01, 0xc6, 0x01, 0xe6, 0x01, 0xc6, 0x0a, 0x47, 0x2b, 0x69, 
+  0x12, 0x87, 0x80, 0x06, 0x09, 0xe6, 0x01, 0xc6, 0x0a, 0x26, 0x1a, 0xe8, 0x0a, 0x06, 0x01, 0xc5, 
+  0x01, 0xe5, 0x41, 0x12, 0x87, 0x41, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x0a, 0x09, 0xc7, 0x09, 0xe6, 
+  0x01, 0xc6, 0x0a, 0x07, 0x1a, 0xe8, 0x12, 0x67, 0x01, 0xc5, 0x0a, 0x66, 0x1b, 0x28, 0x1b, 0x48, 
+  0x12, 0xe7, 0x41, 0x13, 0x07, 0x43, 0x13, 0x08, 0x04, 0x1b, 0x08, 0x12, 0xe8, 0x1b, 0x08, 0x0a, 
+  0x26, 0x01, 0xa6, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x88, 0x01, 0x01, 0xe5, 0x12, 0x87, 0x81, 
+  0x02, 0x0a, 0x26, 0x02, 0x06, 0x01, 0xc5, 0x80, 0x00, 0x1b, 0x28, 0x81, 0x00, 0x12, 0xa7, 0x83, 
+  0x00, 0x0a, 0x46, 0x89, 0x48, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x80, 0x43, 0x01, 0xc6, 0x44, 0x01, 
+  0xe6, 0x02, 0x01, 0xc6, 0x0a, 0x46, 0x1b, 0x27, 0x41, 0x13, 0x07, 0x01, 0x02, 0x06, 0x01, 0xe5, 
+  0x81, 0x00, 0x1b, 0xa8, 0x4e, 0x1b, 0xc8, 0x00, 0x1b, 0xa8, 0x81, 0x00, 0x1b, 0xa8, 0x80, 0x10, 
+  0x1b, 0xe9, 0x13, 0x46, 0x75, 0x51, 0xef, 0xff, 0xc7, 0x5c, 0xc7, 0x1b, 0xd7, 0x9d, 0xd7, 0x5c, 
+  0xcf, 0x1c, 0xd7, 0x3c, 0xdf, 0x9d, 0xa5, 0xd6, 0x4b, 0x6d, 0x22, 0x68, 0x01, 0x23, 0x09, 0xc6, 
+  0x01, 0xc6, 0x42, 0x02, 0x06, 0x00, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x41, 0x09, 
+  0xc6, 0x02, 0x09, 0xe6, 0x02, 0x06, 0x0a, 0x26, 0x41, 0x0a, 0x46, 0x01, 0x01, 0xe5, 0x01, 0xc5, 
+  0x87, 0x00, 0x01, 0xe7, 0x82, 0x50, 0x01, 0xe6, 0x02, 0x01, 0xa5, 0x0a, 0x06, 0x1b, 0x28, 0x80, 
+  0x42, 0x12, 0xa7, 0x43, 0x12, 0x87, 0x0e, 0x12, 0x67, 0x12, 0x87, 0x09, 0xe5, 0x5c, 0x2f, 0xcf, 
+  0x7d, 0xcf, 0x3c, 0xc6, 0xfb, 0xd7, 0x5c, 0xc6, 0xda, 0x5c, 0x0f, 0x3b, 0x4b, 0x0a, 0x67, 0x12, 
+  0xa8, 0x12, 0x87, 0x12, 0xa7, 0x82, 0x00, 0x01, 0xe7, 0x86, 0x46, 0x01, 0xe6, 0x11, 0x01, 0xe7, 
+  0x01, 0xe6, 0x01, 0xc6, 0x09, 0xe7, 0x01, 0xc6, 0x0a, 0x47, 0x23, 0x69, 0x12, 0xa7, 0x01, 0xc6, 
+  0x09, 0xe6, 0x01, 0xe6, 0x0a, 0x26, 0x1a, 0xe8, 0x0a, 0x06, 0x01, 0xc6, 0x01, 0xe5, 0x12, 0xa7, 
+  0x12, 0x87, 0x42, 0x01, 0xe6, 0x00, 0x09, 0xe7, 0x80, 0x08, 0x09, 0xe7, 0x09, 0xc7, 0x0a, 0x06, 
+  0x1a, 0xe8, 0x12, 0x87, 0x01, 0xa5, 0x0a, 0x06, 0x12, 0x87, 0x23, 0x69, 0x43, 0x0a, 0x46, 0x42, 
+  0x0a, 0x67, 0x05, 0x0a, 0x46, 0x12, 0xc7, 0x23, 0x48, 0x0a, 0x26, 0x01, 0xa5, 0x01, 0xc6, 0x45, 
+  0x01, 0xe6, 0x81, 0x00, 0x02, 0x06, 0x80, 0x02, 0x01, 0xc5, 0x12, 0x67, 0x1a, 0xc8, 0x41, 0x01, 
+  0xc5, 0x02, 0x12, 0x87, 0x12, 0xc7, 0x0a, 0x66, 0x82, 0x00, 0x12, 0xc7, 0x84, 0x00, 0x1b, 0x08, 
+  0x83, 0x49, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x80, 0x00, 0x01, 0xe7, 0x81, 0x01, 0x01, 0xe6, 0x01, 
+  0xc6, 0x47, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x80, 0x04, 0x0a, 0x87, 0x23, 0xa8, 0x1b, 0x88, 0x23, 
+  0xa8, 0x0a, 0x66, 0x85, 0x00, 0x1b, 0xa8, 0x8e, 0x42, 0x1b, 0xc8, 0x04, 0x1b, 0x68, 0x1a, 0x66, 
+  0x7d, 0x12, 0xd7, 0x7d, 0xcf, 0x3c, 0x41, 0xcf, 0x1b, 0x07, 0xcf, 0x3c, 0xcf, 0x1b, 0xe7, 0xbe, 
+  0x7c, 0x71, 0x01, 0x02, 0x01, 0xe5, 0x09, 0xc6, 0x01, 0xa6, 0x42, 0x01, 0xc6, 0x46, 0x01, 0xe6, 
+  0x06, 0x01, 0xc6, 0x01, 0xe6, 0x01, 0xc5, 0x12, 0x86, 0x1b, 0x27, 0x1b, 0x07, 0x02, 0x05, 0x47, 
+  0x01, 0xe6, 0x44, 0x01, 0xc6, 0x90, 0x03, 0x12, 0xa7, 0x1a, 0xe7, 0x0a, 0x67, 0x02, 0x06, 0x43, 
+  0x01, 0xe6, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xa6, 0x03, 0x01, 0xa5, 0x01, 0x64, 0x4b, 0x8d, 0xc6, 
+  0xfb, 0x41, 0xc7, 0x1b, 0x05, 0xcf, 0x5c, 0xcf, 0x1b, 0x42, 0xeb, 0x01, 0x64, 0x01, 0xe6, 0x0a, 
+  0x07, 0x42, 0x01, 0xe6, 0x43, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x41, 0x01, 0xc6, 0x80, 0x41, 0x01, 
+  0xc6, 0x47, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x03, 0x01, 0xc6, 0x12, 0x47, 0x23, 
+  0x28, 0x12, 0xa7, 0x42, 0x01, 0xe6, 0x06, 0x0a, 0x26, 0x1a, 0xa7, 0x0a, 0x06, 0x01, 0xe6, 0x02, 
+  0x06, 0x12, 0xa7, 0x12, 0x87, 0x80, 0x00, 0x01, 0xe7, 0x80, 0x04, 0x01, 0xe6, 0x09, 0xe6, 0x09, 
+  0xe7, 0x01, 0xa6, 0x12, 0xe8, 0x81, 0x41, 0x01, 0xc6, 0x05, 0x12, 0x46, 0x12, 0x66, 0x01, 0xa5, 
+  0x01, 0xe5, 0x01, 0xe6, 0x02, 0x06, 0x41, 0x01, 0xe6, 0x06, 0x01, 0xc6, 0x01, 0xe5, 0x1a, 0xe7, 
+  0x23, 0x68, 0x1a, 0xe7, 0x0a, 0x26, 0x01, 0xc6, 0x84, 0x01, 0x1b, 0x28, 0x0a, 0x87, 0x80, 0x00, 
+  0x23, 0x28, 0x81, 0x05, 0x1a, 0xa8, 0x01, 0xa5, 0x0a, 0x46, 0x23, 0x47, 0x23, 0x68, 0x0a, 0x86, 
+  0x80, 0x01, 0x01, 0xe5, 0x12, 0xe7, 0x86, 0x00, 0x01, 0xc6, 0x81, 0x00, 0x01, 0xc6, 0x81, 0x00, 
+  0x01, 0xe7, 0x84, 0x00, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x01, 0x01, 0xc6, 0x01, 0xe6, 0x43, 0x01, 
+  0xc6, 0x48, 0x01, 0xe6, 0x80, 0x05, 0x0a, 0x67, 0x1b, 0x68, 0x1b, 0x48, 0x23, 0x68, 0x0a, 0x46, 
+  0x02, 0x06, 0x84, 0x4a, 0x1b, 0xc8, 0x00, 0x1b, 0xa8, 0x81, 0x00, 0x1b, 0xa8, 0x84, 0x06, 0x01, 
+  0xc5, 0x12, 0x87, 0x7d, 0x53, 0xcf, 0x7d, 0xcf, 0x5c, 0xd7, 0x5d, 0xcf, 0x1c, 0x80, 0x04, 0xcf, 
+  0x3c, 0xd7, 0x3c, 0x64, 0x4f, 0x01, 0xa4, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x41, 0x02, 0x06, 0x43, 
+  0x0a, 0x06, 0x42, 0x0a, 0x07, 0x80, 0x01, 0x12, 0x66, 0x23, 0x68, 0x41, 0x23, 0xa8, 0x01, 0x23, 
+  0x48, 0x0a, 0x26, 0x83, 0x00, 0x01, 0xe7, 0x80, 0x43, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x8f, 0x04, 
+  0x01, 0xc6, 0x1a, 0xc7, 0x23, 0x48, 0x0a, 0x47, 0x01, 0xe6, 0x41, 0x02, 0x06, 0x00, 0x02, 0x07, 
+  0x43, 0x0a, 0x07, 0x03, 0x01, 0x65, 0x3b, 0x0b, 0xb6, 0x79, 0xbe, 0xdb, 0x41, 0xcf, 0x3c, 0x80, 
+  0x03, 0xb6, 0x79, 0x3b, 0x0b, 0x01, 0x85, 0x09, 0xe7, 0x42, 0x0a, 0x07, 0x01, 0x09, 0xe7, 0x0a, 
+  0x07, 0x01, 0x01, 0xc6, 0x01, 0xe7, 0x82, 0x00, 0x01, 0xe6, 0x84, 0x00, 0x01, 0xc6, 0x80, 0x41, 
+  0x01, 0xe7, 0x81, 0x00, 0x01, 0xe7, 0x41, 0x01, 0xc6, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x80, 0x0a, 
+  0x09, 0xe6, 0x01, 0xc6, 0x12, 0x67, 0x23, 0x68, 0x12, 0xc7, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xe6, 
+  0x0a, 0x06, 0x1a, 0xa7, 0x0a, 0x26, 0x41, 0x01, 0xe6, 0x02, 0x12, 0xa7, 0x12, 0x87, 0x01, 0xe6, 
+  0x44, 0x01, 0xc6, 0x0e, 0x12, 0xe7, 0x0a, 0x87, 0x01, 0xc6, 0x09, 0xe7, 0x09, 0xc7, 0x01, 0xc6, 
+  0x09, 0xe5, 0x12, 0xa7, 0x1b, 0x48, 0x23, 0xa8, 0x0a, 0xa7, 0x01, 0xe7, 0x09, 0xe7, 0x09, 0xc6, 
+  0x01, 0xe6, 0x82, 0x02, 0x1b, 0x07, 0x0a, 0x26, 0x01, 0xc6, 0x80, 0x00, 0x01, 0xc6, 0x80, 0x00, 
+  0x01, 0xc6, 0x82, 0x01, 0x1b, 0x08, 0x01, 0xc6, 0x80, 0x05, 0x12, 0x87, 0x12, 0x66, 0x23, 0x47, 
+  0x1b, 0x47, 0x23, 0x47, 0x23, 0x48, 0x80, 0x00, 0x01, 0xc5, 0x42, 0x12, 0xc7, 0x00, 0x0a, 0x87, 
+  0x80, 0x00, 0x02, 0x06, 0x84, 0x00, 0x01, 0xe7, 0x4a, 0x01, 0xe6, 0x45, 0x01, 0xc6, 0x83, 0x00, 
+  0x01, 0xe7, 0x81, 0x00, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x41, 0x02, 0x06, 0x01, 0x0a, 0x06, 0x01, 
+  0xe6, 0x89, 0x41, 0x1b, 0xa8, 0x80, 0x41, 0x1b, 0xa8, 0x83, 0x00, 0x1b, 0xc8, 0x82, 0x00, 0x1b, 
+  0xa8, 0x80, 0x0d, 0x1b, 0x88, 0x0a, 0x06, 0x0a, 0x86, 0x1b, 0x48, 0x2b, 0x49, 0x85, 0x74, 0xa6, 
+  0x58, 0xc7, 0x3c, 0xd7, 0x7d, 0xce, 0xfb, 0xe7, 0xbe, 0x7d, 0x33, 0x0a, 0x86, 0x1a, 0xe8, 0x41, 
+  0x12, 0xe8, 0x41, 0x1a, 0xe8, 0x00, 0x1b, 0x08, 0x47, 0x1a, 0xe8, 0x00, 0x1b, 0x08, 0x80, 0x00, 
+  0x23, 0x88, 0x80, 0x01, 0x23, 0x68, 0x02, 0x26, 0x83, 0x41, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x46, 
+  0x01, 0xc6, 0x89, 0x00, 0x01, 0xc6, 0x81, 0x03, 0x12, 0xe7, 0x23, 0x88, 0x0a, 0x47, 0x01, 0xa5, 
+  0x80, 0x01, 0x09, 0xe6, 0x01, 0xe7, 0x42, 0x0a, 0x07, 0x0b, 0x01, 0xe6, 0x01, 0x85, 0x32, 0xeb, 
+  0xbe, 0xba, 0xcf, 0x7d, 0xc7, 0x1b, 0xd7, 0x5c, 0xae, 0x59, 0x4b, 0x4d, 0x11, 0xc6, 0x01, 0x85, 
+  0x09, 0xc6, 0x44, 0x09, 0xe7, 0x80, 0x00, 0x01, 0xe6, 0x85, 0x41, 0x01, 0xe6, 0x81, 0x41, 0x01, 
+  0xe6, 0x80, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x49, 0x01, 0xe6, 0x0e, 0x12, 0x67, 0x23, 0x68, 0x12, 
+  0xa7, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0xe6, 0x0a, 0x46, 0x1a, 0xc8, 0x0a, 0x26, 0x01, 0xc6, 0x01, 
+  0xe5, 0x12, 0xa7, 0x12, 0x87, 0x09, 0xe7, 0x01, 0xe6, 0x81, 0x02, 0x01, 0xc5, 0x1b, 0x08, 0x12, 
+  0xc7, 0x83, 0x04, 0x01, 0xe6, 0x1a, 0xc7, 0x23, 0x68, 0x1b, 0x68, 0x12, 0xc7, 0x41, 0x0a, 0x07, 
+  0x06, 0x01, 0xc6, 0x12, 0x87, 0x23, 0xa8, 0x12, 0x86, 0x01, 0xa5, 0x1a, 0xc7, 0x0a, 0x27, 0x43, 
+  0x01, 0xc6, 0x04, 0x0a, 0x26, 0x1b, 0x08, 0x0a, 0x46, 0x0a, 0x26, 0x23, 0x28, 0x81, 0x06, 0x12, 
+  0x67, 0x12, 0x65, 0x23, 0x67, 0x12, 0x86, 0x1b, 0x27, 0x23, 0x67, 0x12, 0x87, 0x86, 0x00, 0x0a, 
+  0x26, 0x83, 0x42, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x83, 0x41, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x83, 
+  0x4a, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x83, 0x00, 0x1b, 0xa8, 
+  0x45, 0x1b, 0xc8, 0x47, 0x1b, 0xa8, 0x43, 0x1b, 0xc8, 0x82, 0x0c, 0x02, 0x06, 0x0a, 0x27, 0x0a, 
+  0x06, 0x01, 0x44, 0x01, 0xa5, 0x09, 0xe6, 0x84, 0xf3, 0xae, 0x59, 0xdf, 0xbe, 0xdf, 0x7e, 0x43, 
+  0x0b, 0x01, 0xa4, 0x0a, 0x06, 0x4a, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x04, 0x01, 0xe6, 0x12, 0xa6, 
+  0x1b, 0x47, 0x1b, 0x27, 0x0a, 0x45, 0x41, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x00, 
+  0x01, 0xc6, 0x41, 0x01, 0xe6, 0x82, 0x43, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x87, 0x03, 0x0a, 0x67, 
+  0x23, 0x69, 0x1b, 0x48, 0x12, 0x67, 0x42, 0x01, 0xc6, 0x41, 0x09, 0xe6, 0x80, 0x0d, 0x0a, 0x27, 
+  0x0a, 0x48, 0x2b, 0x0b, 0x53, 0xae, 0xc6, 0xfb, 0xd7, 0x5d, 0xc6, 0xfb, 0xcf, 0x5c, 0xcf, 0x1c, 
+  0x3a, 0xeb, 0x01, 0x24, 0x01, 0xa6, 0x09, 0xc6, 0x09, 0xe6, 0x85, 0x45, 0x01, 0xe6, 0x84, 0x00, 
+  0x01, 0xe7, 0x8a, 0x00, 0x01, 0xc6, 0x80, 0x0e, 0x09, 0xe6, 0x01, 0xe6, 0x12, 0x66, 0x23, 0x48, 
+  0x12, 0x86, 0x01, 0xa5, 0x01, 0xc6, 0x01, 0xe6, 0x0a, 0x27, 0x1a, 0xa7, 0x0a, 0x26, 0x01, 0xc5, 
+  0x01, 0xe6, 0x12, 0xa7, 0x12, 0x67, 0x80, 0x41, 0x09, 0xe6, 0x02, 0x01, 0xc6, 0x12, 0xc7, 0x0a, 
+  0x87, 0x41, 0x01, 0xc6, 0x00, 0x09, 0xc6, 0x80, 0x05, 0x0a, 0x47, 0x23, 0x28, 0x12, 0x66, 0x01, 
+  0xa5, 0x1a, 0xe8, 0x0a, 0x47, 0x80, 0x02, 0x09, 0xe7, 0x12, 0xa7, 0x2b, 0xc9, 0x81, 0x44, 0x01, 
+  0xc6, 0x03, 0x0a, 0x06, 0x1b, 0x28, 0x12, 0x87, 0x01, 0xc6, 0x80, 0x01, 0x23, 0x29, 0x01, 0xe6, 
+  0x41, 0x12, 0x87, 0x01, 0x09, 0xe5, 0x1a, 0xe7, 0x41, 0x23, 0x47, 0x01, 0x12, 0xa7, 0x02, 0x06, 
+  0x83, 0x00, 0x12, 0x87, 0x81, 0x00, 0x0a, 0x46, 0x86, 0x44, 0x01, 0xe6, 0x43, 0x01, 0xc6, 0x01, 
+  0x01, 0xe7, 0x01, 0xe6, 0x81, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x80, 0x42, 0x01, 0xc6, 0x84, 0x03, 
+  0x01, 0xc6, 0x09, 0xc6, 0x09, 0xe7, 0x09, 0xe6, 0x81, 0x00, 0x09, 0xe6, 0x85, 0x00, 0x1b, 0xa8, 
+  0x43, 0x1b, 0xc8, 0x80, 0x00, 0x1b, 0xc8, 0x81, 0x48, 0x1b, 0xc8, 0x80, 0x02, 0x0a, 0x06, 0x01, 
+  0xc6, 0x01, 0x85, 0x41, 0x01, 0x65, 0x06, 0x01, 0xc6, 0x01, 0x84, 0x22, 0x28, 0x8d, 0x14, 0x6b, 
+  0xef, 0x01, 0x44, 0x09, 0xc6, 0x41, 0x01, 0xe6, 0x45, 0x01, 0xc6, 0x01, 0x09, 0xc6, 0x01, 0xc6, 
+  0x41, 0x09, 0xe6, 0x07, 0x09, 0xe7, 0x0a, 0x07, 0x02, 0x07, 0x12, 0x86, 0x12, 0xa6, 0x0a, 0x65, 
+  0x01, 0xe5, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x83, 0x43, 0x01, 0xe6, 0x82, 0x00, 0x01, 0xe7, 0x80, 
+  0x00, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x83, 0x00, 0x01, 0xe7, 0x80, 0x02, 0x12, 
+  0x87, 0x23, 0x68, 0x0a, 0x46, 0x41, 0x01, 0xe6, 0x43, 0x01, 0xc6, 0x00, 0x09, 0xe6, 0x80, 0x0a, 
+  0x01, 0xa5, 0x9d, 0xf7, 0xef, 0xff, 0xd7, 0x3c, 0xcf, 0x1c, 0xdf, 0x7d, 0xc6, 0xfb, 0x43, 0x4c, 
+  0x01, 0x85, 0x09, 0xc6, 0x09, 0xc7, 0x86, 0x00, 0x09, 0xe7, 0x00, 0x01, 0xe7, 0x86, 0x41, 0x01, 
+  0xc6, 0x48, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x81, 0x43, 0x01, 0xc6, 0x04, 0x09, 0xe6, 0x01, 0xc6, 
+  0x0a, 0x66, 0x23, 0x68, 0x12, 0xa7, 0x80, 0x08, 0x09, 0xe6, 0x09, 0xe7, 0x0a, 0x26, 0x12, 0xa7, 
+  0x0a, 0x26, 0x01, 0xa5, 0x01, 0xc6, 0x0a, 0x26, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x80, 0x01, 0x0a, 
+  0x67, 0x0a, 0x26, 0x83, 0x0b, 0x0a, 0x26, 0x23, 0x69, 0x12, 0x46, 0x01, 0x65, 0x0a, 0x06, 0x09, 
+  0xe6, 0x09, 0xe7, 0x0a, 0x07, 0x0a, 0x47, 0x1a, 0xe7, 0x0a, 0x46, 0x01, 0xa6, 0x83, 0x02, 0x0a, 
+  0x06, 0x1a, 0xa7, 0x0a, 0x47, 0x41, 0x01, 0xe6, 0x01, 0x12, 0xa7, 0x23, 0x08, 0x81, 0x07, 0x1a, 
+  0xe8, 0x01, 0x85, 0x0a, 0x06, 0x1a, 0xe7, 0x12, 0xa6, 0x01, 0xe6, 0x02, 0x07, 0x01, 0xc6, 0x80, 
+  0x01, 0x12, 0xa7, 0x12, 0xc8, 0x80, 0x01, 0x1a, 0xe8, 0x0a, 0x06, 0x84, 0x00, 0x01, 0xc6, 0x8a, 
+  0x00, 0x01, 0xc6, 0x45, 0x01, 0xe6, 0x81, 0x43, 0x01, 0xe6, 0x43, 0x01, 0xc6, 0x02, 0x01, 0xa6, 
+  0x01, 0xa5, 0x01, 0xa6, 0x84, 0x48, 0x1b, 0xc8, 0x41, 0x1b, 0xa8, 0x47, 0x1b, 0xc8, 0x00, 0x1b, 
+  0xa8, 0x80, 0x08, 0x1b, 0x68, 0x01, 0xc6, 0x09, 0xc6, 0x12, 0x46, 0x12, 0x26, 0x12, 0x46, 0x01, 
+  0xe6, 0x01, 0xc5, 0x01, 0x85, 0x41, 0x00, 0xe2, 0x00, 0x01, 0x85, 0x42, 0x01, 0xc6, 0x42, 0x01, 
+  0xa6, 0x43, 0x01, 0xa5, 0x05, 0x01, 0xa6, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xc6, 0x01, 0xe6, 0x0a, 
+  0xa7, 0x41, 0x23, 0x88, 0x02, 0x23, 0x48, 0x12, 0x86, 0x01, 0xe5, 0x43, 0x01, 0xe6, 0x43, 0x01, 
+  0xc6, 0x80, 0x42, 0x01, 0xc6, 0x43, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x41, 0x01, 
+  0xe7, 0x83, 0x04, 0x1b, 0x28, 0x02, 0x06, 0x0a, 0x07, 0x09, 0xe6, 0x01, 0xe6, 0x80, 0x0c, 0x01, 
+  0xa6, 0x09, 0xc6, 0x01, 0x44, 0x09, 0xe7, 0x3b, 0x4c, 0xb6, 0x79, 0xd7, 0x5d, 0xce, 0xfb, 0xdf, 
+  0x7d, 0xce, 0xdb, 0x43, 0x2c, 0x01, 0x85, 0x09, 0xe7, 0x80, 0x00, 0x09, 0xe7, 0x41, 0x09, 0xe6, 
+  0x84, 0x00, 0x0a, 0x07, 0x44, 0x01, 0xe6, 0x02, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0xc6, 0x44, 0x01, 
+  0xe6, 0x42, 0x01, 0xc6, 0x85, 0x00, 0x01, 0xe6, 0x43, 0x01, 0xc6, 0x04, 0x09, 0xe6, 0x01, 0xe6, 
+  0x12, 0x67, 0x23, 0x68, 0x12, 0xc7, 0x41, 0x0a, 0x06, 0x04, 0x01, 0xe6, 0x0a, 0x06, 0x1a, 0xa7, 
+  0x0a, 0x06, 0x01, 0xa5, 0x41, 0x01, 0xc6, 0x82, 0x02, 0x1b, 0x08, 0x12, 0xa7, 0x01, 0xa6, 0x42, 
+  0x01, 0xc6, 0x04, 0x01, 0xe6, 0x12, 0x66, 0x1a, 0xe7, 0x0a, 0x26, 0x01, 0xa6, 0x42, 0x09, 0xe6, 
+  0x01, 0x01, 0xe6, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x81, 0x08, 0x01, 0xa6, 0x0a, 0x05, 0x1a, 0xc7, 
+  0x0a, 0x26, 0x01, 0x85, 0x01, 0xa5, 0x12, 0x87, 0x12, 0xe7, 0x0a, 0x67, 0x80, 0x07, 0x12, 0xa8, 
+  0x1b, 0x08, 0x01, 0xe6, 0x01, 0xc5, 0x12, 0xc7, 0x02, 0x05, 0x01, 0xc6, 0x09, 0xe7, 0x81, 0x41, 
+  0x12, 0xc7, 0x86, 0x41, 0x01, 0xc6, 0x84, 0x44, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x44, 0x01, 0xe7, 
+  0x43, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x08, 0x09, 0xe6, 0x01, 0xe6, 0x0a, 0x46, 0x12, 0xc7, 0x12, 
+  0x86, 0x12, 0xa7, 0x0a, 0x06, 0x01, 0xe6, 0x1b, 0xa8, 0x83, 0x41, 0x1b, 0xa8, 0x50, 0x1b, 0xc8, 
+  0x80, 0x06, 0x01, 0xa5, 0x0a, 0x26, 0x2b, 0x89, 0x23, 0x89, 0x2b, 0x89, 0x1a, 0xe8, 0x1a, 0xc7, 
+  0x42, 0x1a, 0xc8, 0x44, 0x1a, 0xe8, 0x47, 0x1a, 0xc8, 0x41, 0x1a, 0xe8, 0x07, 0x13, 0x08, 0x23, 
+  0xa8, 0x1b, 0x47, 0x0a, 0x45, 0x1b, 0x07, 0x23, 0x88, 0x0a, 0x26, 0x01, 0xc6, 0x81, 0x00, 0x01, 
+  0xc6, 0x41, 0x01, 0xe7, 0x00, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x49, 0x01, 0xe6, 0x00, 0x01, 0xe7, 
+  0x41, 0x09, 0xe7, 0x04, 0x01, 0xe7, 0x09, 0xe6, 0x01, 0xa6, 0x12, 0x67, 0x1b, 0x08, 0x81, 0x07, 
+  0x02, 0x07, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0x03, 0x19, 0xe7, 0x9d, 0xf7, 0xd7, 0x7d, 
+  0x41, 0xd7, 0x3c, 0x04, 0xef, 0xdf, 0xbe, 0x9a, 0x32, 0xaa, 0x01, 0x85, 0x0a, 0x07, 0x41, 0x09, 
+  0xe7, 0x01, 0x09, 0xe6, 0x01, 0xe6, 0x43, 0x09, 0xe7, 0x00, 0x0a, 0x07, 0x81, 0x80, 0x00, 0x01, 
+  0xe7, 0x4c, 0x01, 0xe6, 0x43, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x00, 0x01, 0xe6, 
+  0x82, 0x0c, 0x09, 0xc7, 0x09, 0xe7, 0x09, 0xe6, 0x12, 0x87, 0x23, 0x68, 0x12, 0xa7, 0x01, 0xe6, 
+  0x09, 0xe6, 0x01, 0xa6, 0x09, 0xc5, 0x12, 0x67, 0x09, 0xe5, 0x01, 0xa5, 0x41, 0x01, 0xc6, 0x81, 
+  0x02, 0x12, 0xc7, 0x12, 0x86, 0x01, 0xa5, 0x43, 0x01, 0xc6, 0x02, 0x01, 0xa5, 0x0a, 0x46, 0x0a, 
+  0x27, 0x41, 0x01, 0xc6, 0x00, 0x09, 0xc6, 0x41, 0x01, 0xc6, 0x00, 0x09, 0xc6, 0x42, 0x09, 0xe7, 
+  0x80, 0x07, 0x0a, 0x06, 0x1a, 0xc7, 0x0a, 0x47, 0x01, 0xc6, 0x01, 0xa5, 0x12, 0x46, 0x1a, 0xc8, 
+  0x0a, 0x06, 0x41, 0x01, 0xe6, 0x01, 0x12, 0xc8, 0x1b, 0x28, 0x41, 0x01, 0xc6, 0x02, 0x1a, 0xe7, 
+  0x0a, 0x05, 0x01, 0xa5, 0x82, 0x00, 0x12, 0xa7, 0x85, 0x00, 0x01, 0xc5, 0x41, 0x01, 0xc6, 0x00, 
+  0x01, 0xe6, 0x41, 0x01, 0xc6, 0x82, 0x01, 0x01, 0xe7, 0x01, 0xe6, 0x80, 0x00, 0x01, 0xe6, 0x44, 
+  0x01, 0xc6, 0x41, 0x01, 0xe6, 0x85, 0x41, 0x01, 0xe6, 0x80, 0x05, 0x01, 0xe6, 0x01, 0xc6, 0x12, 
+  0x87, 0x23, 0xa9, 0x23, 0x68, 0x23, 0x89, 0x80, 0x01, 0x01, 0xc6, 0x1b, 0x88, 0x82, 0x41, 0x1b, 
+  0xa8, 0x51, 0x1b, 0xc8, 0x81, 0x03, 0x09, 0xc6, 0x0a, 0x46, 0x0a, 0x67, 0x0a, 0x86, 0x41, 0x12, 
+  0x66, 0x41, 0x12, 0x87, 0x44, 0x12, 0xa7, 0x43, 0x12, 0x87, 0x44, 0x12, 0x67, 0x41, 0x12, 0x87, 
+  0x06, 0x0a, 0x86, 0x1a, 0xe7, 0x23, 0x27, 0x1a, 0xe7, 0x23, 0x48, 0x12, 0xa6, 0x01, 0xe5, 0x81, 
+  0x01, 0x01, 0xe7, 0x01, 0xe6, 0x80, 0x41, 0x01, 0xc6, 0x45, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x83, 
+  0x41, 0x01, 0xe7, 0x43, 0x01, 0xc6, 0x04, 0x01, 0xc5, 0x1a, 0xc6, 0x23, 0x48, 0x0a, 0x66, 0x02, 
+  0x06, 0x41, 0x02, 0x07, 0x0a, 0x0a, 0x07, 0x01, 0x44, 0x42, 0xeb, 0xbe, 0x9a, 0xd7, 0x7d, 0xc6, 
+  0xfb, 0xd7, 0x5d, 0xcf, 0x1c, 0x5b, 0xef, 0x32, 0xeb, 0x01, 0xa6, 0x44, 0x09, 0xe7, 0x00, 0x01, 
+  0xe7, 0x45, 0x09, 0xe7, 0x80, 0x4f, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xc7, 0x44, 0x01, 0xe6, 0x43, 
+  0x01, 0xc6, 0x41, 0x09, 0xe6, 0x0c, 0x09, 0xe7, 0x01, 0xe6, 0x0a, 0x66, 0x23, 0x48, 0x12, 0xc7, 
+  0x01, 0xc5, 0x09, 0xa6, 0x01, 0xa5, 0x01, 0xc5, 0x1a, 0xc7, 0x0a, 0x06, 0x01, 0xa6, 0x01, 0xe6, 
+  0x80, 0x00, 0x01, 0xe6, 0x80, 0x01, 0x0a, 0x86, 0x01, 0xc5, 0x82, 0x43, 0x01, 0xe6, 0x00, 0x09, 
+  0xc6, 0x83, 0x00, 0x01, 0xc6, 0x42, 0x09, 0xe6, 0x02, 0x0a, 0x26, 0x1b, 0x08, 0x0a, 0x47, 0x41, 
+  0x01, 0xc6, 0x01, 0x12, 0x87, 0x1a, 0xc8, 0x42, 0x09, 0xe6, 0x00, 0x01, 0xc6, 0x81, 0x00, 0x01, 
+  0xc5, 0x80, 0x01, 0x1a, 0xe8, 0x0a, 0x25, 0x80, 0x41, 0x01, 0xc6, 0x81, 0x00, 0x1a, 0xe8, 0x80, 
+  0x00, 0x1b, 0x08, 0x84, 0x42, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x82, 0x01, 0x01, 0xe6, 0x01, 0xe7, 
+  0x46, 0x01, 0xe6, 0x87, 0x41, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xe6, 0x41, 0x0a, 0x26, 0x02, 0x0a, 
+  0x06, 0x01, 0xc6, 0x01, 0xe6, 0x81, 0x41, 0x1b, 0xc8, 0x80, 0x52, 0x1b, 0xc8, 0x80, 0x44, 0x01, 
+  0xc6, 0x41, 0x01, 0xa5, 0x49, 0x01, 0xc6, 0x44, 0x01, 0xa6, 0x42, 0x01, 0xc6, 0x06, 0x01, 0xc5, 
+  0x01, 0xa4, 0x1a, 0xc7, 0x2b, 0x89, 0x23, 0x68, 0x0a, 0x26, 0x01, 0xa6, 0x82, 0x41, 0x01, 0xe7, 
+  0x41, 0x09, 0xe7, 0x4b, 0x01, 0xe6, 0x80, 0x41, 0x01, 0xe6, 0x80, 0x05, 0x01, 0xa6, 0x0a, 0x05, 
+  0x1b, 0x06, 0x23, 0x47, 0x1b, 0x47, 0x0a, 0x87, 0x81, 0x0a, 0x12, 0x48, 0x9d, 0xb6, 0xc6, 0xfb, 
+  0xcf, 0x5c, 0xc6, 0xdb, 0xcf, 0x3c, 0xbe, 0xba, 0x42, 0xeb, 0x01, 0x44, 0x01, 0xa6, 0x09, 0xe6, 
+  0x4b, 0x09, 0xe7, 0x80, 0x81, 0x41, 0x01, 0xe7, 0x80, 0x00, 0x01, 0xe7, 0x80, 0x41, 0x01, 0xe7, 
+  0x83, 0x44, 0x01, 0xc6, 0x01, 0x09, 0xc7, 0x01, 0xc6, 0x81, 0x47, 0x01, 0xc6, 0x80, 0x04, 0x02, 
+  0x07, 0x0a, 0x26, 0x12, 0x67, 0x22, 0xc8, 0x09, 0xc6, 0x41, 0x01, 0xa5, 0x00, 0x12, 0xa7, 0x80, 
+  0x41, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x01, 0x13, 0x07, 0x12, 0xa7, 0x41, 0x01, 0xc6, 0x00, 0x01, 
+  0xa6, 0x80, 0x02, 0x0a, 0x27, 0x23, 0x8a, 0x12, 0xe8, 0x80, 0x44, 0x01, 0xc6, 0x41, 0x09, 0xe6, 
+  0x04, 0x01, 0xc6, 0x0a, 0x26, 0x1b, 0x08, 0x12, 0x67, 0x01, 0xe6, 0x80, 0x0c, 0x12, 0x87, 0x1a, 
+  0xe8, 0x0a, 0x06, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0xc5, 0x02, 0x06, 0x1a, 0xe8, 0x1b, 0x08, 0x01, 
+  0xc6, 0x01, 0xe6, 0x1b, 0x08, 0x0a, 0x45, 0x81, 0x00, 0x01, 0xa6, 0x81, 0x00, 0x12, 0xc7, 0x81, 
+  0x00, 0x0a, 0x26, 0x81, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xe7, 0x43, 0x01, 0xe6, 0x81, 0x42, 0x01, 
+  0xc6, 0x83, 0x43, 0x01, 0xe7, 0x00, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x84, 0x00, 0x09, 0xe6, 0x81, 
+  0x00, 0x01, 0xc6, 0x43, 0x01, 0xa6, 0x82, 0x00, 0x1b, 0xa8, 0x41, 0x1b, 0xc8, 0x44, 0x1b, 0xa8, 
+  0x81, 0x00, 0x1b, 0xa8, 0x88, 0x00, 0x1b, 0xa8, 0x82, 0x00, 0x01, 0xe6, 0x42, 0x0a, 0x06, 0x01, 
+  0x01, 0xe6, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x49, 0x01, 0xc6, 0x41, 0x01, 0xc5, 0x43, 0x01, 0xc6, 
+  0x03, 0x01, 0xa5, 0x0a, 0x05, 0x0a, 0x46, 0x0a, 0x06, 0x42, 0x01, 0xc6, 0x80, 0x00, 0x09, 0xc6, 
+  0x80, 0x43, 0x01, 0xe6, 0x01, 0x09, 0xe7, 0x01, 0xe7, 0x80, 0x00, 0x01, 0xe7, 0x82, 0x00, 0x01, 
+  0xc6, 0x80, 0x43, 0x01, 0xc6, 0x80, 0x0a, 0x01, 0xa6, 0x0a, 0x06, 0x1b, 0x08, 0x0a, 0x25, 0x12, 
+  0x65, 0x2b, 0x88, 0x12, 0x88, 0x01, 0xc6, 0x1a, 0x68, 0xae, 0x38, 0xdf, 0x7d, 0x41, 0xcf, 0x1c, 
+  0x04, 0xcf, 0x3c, 0xcf, 0x1b, 0x3a, 0xcb, 0x00, 0xe3, 0x09, 0xc7, 0x41, 0x09, 0xe7, 0x01, 0x09, 
+  0xc7, 0x09, 0xe6, 0x80, 0x41, 0x0a, 0x07, 0x87, 0x55, 0x01, 0xe6, 0x83, 0x00, 0x01, 0xe6, 0x80, 
+  0x00, 0x09, 0xe6, 0x41, 0x0a, 0x06, 0x07, 0x09, 0xe6, 0x01, 0xc6, 0x09, 0xe6, 0x2b, 0x29, 0x1a, 
+  0xa8, 0x01, 0xc6, 0x12, 0x27, 0x0a, 0x26, 0x43, 0x01, 0xc6, 0x00, 0x01, 0xc5, 0x80, 0x00, 0x12, 
+  0xa6, 0x43, 0x01, 0xc6, 0x00, 0x02, 0x26, 0x87, 0x05, 0x09, 0xe7, 0x01, 0xc6, 0x0a, 0x06, 0x1b, 
+  0x08, 0x12, 0x87, 0x0a, 0x06, 0x80, 0x09, 0x12, 0xa7, 0x23, 0x08, 0x0a, 0x06, 0x01, 0xc6, 0x09, 
+  0xc6, 0x01, 0xc6, 0x0a, 0x26, 0x0a, 0x27, 0x12, 0xa8, 0x1a, 0xe7, 0x89, 0x00, 0x12, 0xa7, 0x83, 
+  0x01, 0x01, 0xc5, 0x01, 0xe6, 0x43, 0x01, 0xe7, 0x44, 0x01, 0xe6, 0x82, 0x00, 0x01, 0xe7, 0x41, 
+  0x01, 0xe6, 0x44, 0x01, 0xe7, 0x44, 0x01, 0xe6, 0x01, 0x01, 0xe7, 0x09, 0xe7, 0x41, 0x09, 0xe6, 
+  0x00, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x84, 0x41, 0x1b, 0xa8, 0x52, 0x1b, 0xc8, 0x81, 0x06, 0x0a, 
+  0x67, 0x23, 0x69, 0x1b, 0x68, 0x23, 0x89, 0x0a, 0x66, 0x0a, 0x26, 0x0a, 0x46, 0x51, 0x0a, 0x26, 
+  0x04, 0x0a, 0x06, 0x23, 0x08, 0x12, 0x66, 0x01, 0xc5, 0x0a, 0x06, 0x46, 0x01, 0xe6, 0x02, 0x01, 
+  0xe7, 0x09, 0xe7, 0x09, 0xe6, 0x46, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x01, 0x01, 0xe6, 0x09, 0xe7, 
+  0x41, 0x01, 0xe6, 0x11, 0x01, 0xc6, 0x09, 0xe6, 0x1a, 0xc7, 0x09, 0xe4, 0x0a, 0x25, 0x2b, 0x48, 
+  0x09, 0xe6, 0x1a, 0x28, 0xa6, 0x17, 0xdf, 0x9d, 0xcf, 0x1c, 0xd7, 0x3c, 0xbe, 0x9a, 0xb6, 0x99, 
+  0x4b, 0x2c, 0x01, 0x24, 0x09, 0xa6, 0x09, 0xc6, 0x4d, 0x09, 0xe7, 0x80, 0x81, 0x00, 0x09, 0xe6, 
+  0x80, 0x45, 0x01, 0xc6, 0x80, 0x4f, 0x01, 0xc6, 0x0b, 0x01, 0xe6, 0x1a, 0xe7, 0x23, 0x68, 0x1a, 
+  0xe7, 0x0a, 0x06, 0x09, 0xc6, 0x01, 0xa5, 0x01, 0x85, 0x1a, 0xa7, 0x1a, 0xe7, 0x23, 0x08, 0x12, 
+  0x47, 0x44, 0x01, 0xc6, 0x01, 0x12, 0xc7, 0x0a, 0x86, 0x83, 0x03, 0x01, 0xe6, 0x13, 0x08, 0x12, 
+  0xa7, 0x01, 0xc5, 0x83, 0x13, 0x09, 0xe6, 0x01, 0xe6, 0x0a, 0x06, 0x1a, 0xc8, 0x0a, 0x67, 0x0a, 
+  0x06, 0x0a, 0x26, 0x1b, 0x08, 0x23, 0x48, 0x12, 0x67, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0xc5, 0x0a, 
+  0x46, 0x1a, 0xa7, 0x01, 0xa5, 0x0a, 0x66, 0x12, 0xc7, 0x01, 0xa6, 0x01, 0xc6, 0x83, 0x00, 0x01, 
+  0xa5, 0x85, 0x02, 0x0a, 0x67, 0x1b, 0x28, 0x01, 0xe5, 0x81, 0x00, 0x01, 0xe6, 0x80, 0x41, 0x01, 
+  0xe6, 0x00, 0x01, 0xc6, 0x80, 0x00, 0x01, 0xe7, 0x81, 0x00, 0x01, 0xc6, 0x45, 0x01, 0xe6, 0x81, 
+  0x45, 0x01, 0xe6, 0x03, 0x01, 0xc6, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xc6, 0x80, 0x00, 0x0a, 0x47, 
+  0x41, 0x0a, 0x46, 0x00, 0x01, 0xc6, 0x96, 0x00, 0x1b, 0xa8, 0x82, 0x01, 0x12, 0x87, 0x23, 0xc9, 
+  0x41, 0x23, 0x88, 0x01, 0x1b, 0x07, 0x1b, 0x08, 0x45, 0x1a, 0xe8, 0x00, 0x1b, 0x08, 0x43, 0x1a, 
+  0xe8, 0x43, 0x1b, 0x08, 0x41, 0x1a, 0xe8, 0x08, 0x1b, 0x08, 0x1a, 0xe8, 0x1b, 0x28, 0x23, 0x68, 
+  0x0a, 0x26, 0x01, 0xe5, 0x23, 0x29, 0x0a, 0x26, 0x01, 0xc6, 0x83, 0x00, 0x01, 0xe7, 0x41, 0x09, 
+  0xe7, 0x45, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x43, 0x01, 0xe6, 0x01, 0x09, 0xe6, 0x09, 0xe7, 0x80, 
+  0x0c, 0x01, 0xe7, 0x01, 0xa5, 0x09, 0xc5, 0x1a, 0x87, 0x12, 0x45, 0x01, 0xe3, 0x2a, 0x88, 0xb6, 
+  0x59, 0xd7, 0x9d, 0xcf, 0x1c, 0xd7, 0x5d, 0xce, 0xdb, 0x22, 0x69, 0x41, 0x09, 0xc6, 0x02, 0x01, 
+  0xa6, 0x01, 0xc6, 0x01, 0xe6, 0x81, 0x00, 0x0a, 0x07, 0x89, 0x41, 0x0a, 0x07, 0x80, 0x03, 0x09, 
+  0xe6, 0x01, 0xe6, 0x0a, 0x26, 0x12, 0xa7, 0x53, 0x12, 0x87, 0x0d, 0x12, 0xa7, 0x12, 0x87, 0x13, 
+  0x06, 0x1b, 0x86, 0x1b, 0x66, 0x1b, 0x67, 0x12, 0xa7, 0x01, 0xc6, 0x01, 0xa6, 0x01, 0xa5, 0x12, 
+  0xa7, 0x23, 0xa8, 0x23, 0x87, 0x0a, 0x46, 0x82, 0x04, 0x09, 0xc6, 0x01, 0xa5, 0x12, 0x86, 0x12, 
+  0xc7, 0x01, 0xe6, 0x81, 0x04, 0x01, 0xa6, 0x0a, 0x46, 0x23, 0x68, 0x1b, 0x07, 0x0a, 0x06, 0x80, 
+  0x00, 0x01, 0xe6, 0x80, 0x05, 0x09, 0xc6, 0x01, 0xe6, 0x0a, 0x26, 0x1a, 0xc7, 0x0a, 0x47, 0x09, 
+  0xe6, 0x80, 0x0c, 0x1a, 0xe8, 0x23, 0x68, 0x12, 0x87, 0x09, 0xe6, 0x09, 0xe7, 0x01, 0xa6, 0x0a, 
+  0x26, 0x1a, 0x87, 0x09, 0xc6, 0x01, 0x85, 0x12, 0x46, 0x12, 0xa7, 0x01, 0xa5, 0x81, 0x03, 0x0a, 
+  0x46, 0x01, 0xc5, 0x09, 0xc6, 0x01, 0xa6, 0x82, 0x01, 0x12, 0x87, 0x1b, 0x28, 0x84, 0x44, 0x01, 
+  0xe6, 0x44, 0x01, 0xe7, 0x46, 0x01, 0xe6, 0x89, 0x06, 0x02, 0x06, 0x12, 0xa7, 0x1b, 0x28, 0x23, 
+  0xc9, 0x23, 0xc8, 0x23, 0xc9, 0x0a, 0x46, 0x80, 0x00, 0x1b, 0xa8, 0x81, 0x00, 0x1b, 0xc8, 0x93, 
+  0x07, 0x1b, 0x88, 0x02, 0x06, 0x0a, 0x67, 0x1b, 0x07, 0x12, 0xc7, 0x1a, 0xe7, 0x0a, 0x26, 0x01, 
+  0xe5, 0x42, 0x01, 0xc5, 0x00, 0x01, 0xe5, 0x42, 0x01, 0xc5, 0x43, 0x01, 0xe6, 0x00, 0x01, 0xe5, 
+  0x41, 0x01, 0xe6, 0x44, 0x01, 0xe5, 0x05, 0x0a, 0x26, 0x23, 0x28, 0x1a, 0xc7, 0x02, 0x06, 0x1a, 
+  0xa8, 0x0a, 0x06, 0x45, 0x01, 0xe6, 0x80, 0x48, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x42, 0x01, 0xe6, 
+  0x00, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x80, 0x06, 0x01, 0x84, 0x32, 0xe9, 0x4b, 
+  0xad, 0xae, 0x37, 0xd7, 0x7d, 0xc7, 0x1b, 0xd7, 0x5c, 0x80, 0x05, 0x5b, 0xce, 0x01, 0xa6, 0x0a, 
+  0x07, 0x09, 0xe7, 0x01, 0xe6, 0x09, 0xe6, 0x42, 0x09, 0xe7, 0x00, 0x01, 0xe7, 0x88, 0x42, 0x0a, 
+  0x07, 0x80, 0x01, 0x01, 0xc6, 0x0a, 0x06, 0x41, 0x1a, 0xe7, 0x43, 0x12, 0xc7, 0x02, 0x1a, 0xc7, 
+  0x12, 0xc7, 0x1a, 0xc7, 0x43, 0x12, 0xc7, 0x00, 0x1a, 0xc7, 0x45, 0x12, 0xc7, 0x00, 0x12, 0xe7, 
+  0x41, 0x1a, 0xe7, 0x01, 0x1b, 0x28, 0x23, 0xa7, 0x81, 0x02, 0x1b, 0x66, 0x23, 0x47, 0x01, 0xc5, 
+  0x81, 0x23, 0x12, 0x86, 0x23, 0xc8, 0x23, 0xa7, 0x12, 0xa6, 0x02, 0x05, 0x01, 0xe6, 0x09, 0xc7, 
+  0x01, 0xc6, 0x01, 0xc5, 0x1a, 0xc7, 0x23, 0x88, 0x12, 0xe7, 0x0a, 0x06, 0x01, 0xe6, 0x01, 0xc5, 
+  0x12, 0xa6, 0x2b, 0xc8, 0x23, 0xa8, 0x12, 0xe7, 0x02, 0x06, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xe6, 
+  0x0a, 0x26, 0x1a, 0xc7, 0x12, 0x47, 0x01, 0xc6, 0x01, 0xe6, 0x12, 0x87, 0x23, 0x28, 0x0a, 0x66, 
+  0x02, 0x06, 0x0a, 0x07, 0x01, 0xc6, 0x0a, 0x46, 0x1a, 0x87, 0x41, 0x09, 0xe6, 0x00, 0x01, 0x86, 
+  0x80, 0x00, 0x12, 0xc7, 0x80, 0x00, 0x01, 0xe6, 0x81, 0x01, 0x01, 0xa5, 0x01, 0xc6, 0x83, 0x00, 
+  0x0a, 0x87, 0x83, 0x00, 0x01, 0xc5, 0x82, 0x41, 0x01, 0xc6, 0x84, 0x46, 0x01, 0xe6, 0x01, 0x01, 
+  0xe7, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x80, 0x41, 0x01, 0xe7, 0x80, 0x09, 0x01, 0xc6, 0x01, 0xe6, 
+  0x01, 0xe5, 0x12, 0xa7, 0x12, 0xe7, 0x13, 0x07, 0x1b, 0x47, 0x1b, 0x27, 0x13, 0x07, 0x0a, 0x06, 
+  0x80, 0x00, 0x1b, 0x88, 0x82, 0x50, 0x1b, 0xc8, 0x00, 0x1b, 0xa8, 0x41, 0x1b, 0xc8, 0x80, 0x04, 
+  0x02, 0x26, 0x02, 0x06, 0x01, 0xc5, 0x01, 0xa5, 0x01, 0xc5, 0x41, 0x01, 0xe6, 0x46, 0x01, 0xc6, 
+  0x46, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x05, 0x01, 0xc6, 0x0a, 0x26, 0x12, 0xc7, 
+  0x0a, 0x27, 0x01, 0xe6, 0x09, 0xe6, 0x46, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x80, 0x42, 0x01, 0xe7, 
+  0x85, 0x00, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x08, 0x01, 0xe7, 0x02, 0x07, 0x0a, 0x27, 0x01, 0xe6, 
+  0x1a, 0x07, 0x95, 0x75, 0xd7, 0x9d, 0xc7, 0x1b, 0xc6, 0xfb, 0x41, 0xd7, 0x7d, 0x02, 0x74, 0x71, 
+  0x01, 0xa6, 0x0a, 0x27, 0x41, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x80, 0x01, 0x01, 0xe7, 0x01, 0xe6, 
+  0x89, 0x00, 0x09, 0xe7, 0x81, 0x03, 0x01, 0xc6, 0x0a, 0x06, 0x1a, 0xa7, 0x0a, 0x46, 0x47, 0x01, 
+  0xc6, 0x41, 0x01, 0xc5, 0x02, 0x01, 0xc6, 0x01, 0xc5, 0x01, 0xa5, 0x48, 0x01, 0xc5, 0x05, 0x02, 
+  0x26, 0x0a, 0xa6, 0x13, 0x46, 0x1b, 0x87, 0x1b, 0x47, 0x12, 0x86, 0x41, 0x01, 0xc6, 0x08, 0x01, 
+  0xe5, 0x1b, 0x07, 0x1b, 0x47, 0x1b, 0x67, 0x23, 0xa8, 0x12, 0xc6, 0x0a, 0x26, 0x01, 0xe6, 0x0a, 
+  0x26, 0x41, 0x1a, 0xe7, 0x02, 0x1a, 0xc6, 0x23, 0x88, 0x0a, 0x46, 0x80, 0x05, 0x0a, 0x46, 0x1b, 
+  0x47, 0x1b, 0x27, 0x1b, 0x06, 0x23, 0x87, 0x0a, 0x66, 0x41, 0x01, 0xe6, 0x0e, 0x0a, 0x26, 0x12, 
+  0xa7, 0x0a, 0x26, 0x01, 0xc6, 0x01, 0xe6, 0x12, 0x86, 0x23, 0x48, 0x12, 0x46, 0x01, 0xe6, 0x0a, 
+  0x07, 0x01, 0xe6, 0x12, 0x66, 0x1a, 0xc7, 0x09, 0xe6, 0x09, 0xc6, 0x80, 0x03, 0x01, 0x85, 0x12, 
+  0x67, 0x1a, 0xe8, 0x01, 0xa6, 0x82, 0x01, 0x01, 0xc5, 0x09, 0xe6, 0x81, 0x02, 0x12, 0xc7, 0x12, 
+  0xe7, 0x12, 0xa7, 0x80, 0x00, 0x02, 0x26, 0x81, 0x00, 0x01, 0xe5, 0x80, 0x00, 0x01, 0xe7, 0x41, 
+  0x01, 0xe6, 0x81, 0x00, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xe7, 0x43, 0x01, 0xe6, 0x41, 0x01, 0xe7, 
+  0x80, 0x00, 0x01, 0xe7, 0x43, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x07, 0x01, 0xc5, 
+  0x01, 0xe5, 0x12, 0xa7, 0x12, 0x87, 0x01, 0xe5, 0x02, 0x05, 0x02, 0x06, 0x01, 0xe5, 0x41, 0x01, 
+  0xc6, 0x82, 0x52, 0x1b, 0xc8, 0x41, 0x1b, 0xa8, 0x81, 0x05, 0x02, 0x06, 0x0a, 0x67, 0x13, 0x08, 
+  0x12, 0xe7, 0x12, 0xe8, 0x0a, 0x26, 0x80, 0x00, 0x09, 0xc6, 0x8c, 0x00, 0x01, 0xe6, 0x81, 0x00, 
+  0x09, 0xe6, 0x83, 0x01, 0x12, 0xe8, 0x02, 0x06, 0x48, 0x01, 0xe6, 0x44, 0x01, 0xe7, 0x47, 0x01, 
+  0xe6, 0x0c, 0x02, 0x07, 0x0a, 0x27, 0x02, 0x07, 0x12, 0x68, 0xa5, 0xf6, 0xd7, 0x7d, 0xc6, 0xdb, 
+  0xc6, 0xfb, 0xd7, 0x5d, 0x7c, 0xb2, 0x53, 0x4d, 0x01, 0x65, 0x09, 0xe7, 0x41, 0x01, 0xe7, 0x41, 
+  0x01, 0xe6, 0x41, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x8a, 0x04, 0x0a, 0x26, 0x1a, 
+  0xe8, 0x0a, 0x46, 0x01, 0xe6, 0x09, 0xe7, 0x41, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x81, 0x00, 0x01, 
+  0xe6, 0x41, 0x01, 0xc6, 0x43, 0x01, 0xe6, 0x41, 0x01, 0xe5, 0x47, 0x01, 0xe6, 0x04, 0x0a, 0x66, 
+  0x1b, 0x47, 0x1a, 0xe7, 0x01, 0xe5, 0x01, 0xe6, 0x80, 0x01, 0x0a, 0x26, 0x23, 0x88, 0x80, 0x11, 
+  0x23, 0x88, 0x23, 0xc8, 0x1b, 0x47, 0x0a, 0x67, 0x01, 0xc6, 0x12, 0x67, 0x2b, 0xc9, 0x12, 0xe6, 
+  0x12, 0xa6, 0x1b, 0x07, 0x0a, 0x06, 0x01, 0xc6, 0x0a, 0x87, 0x2b, 0xe9, 0x1b, 0x47, 0x1b, 0x26, 
+  0x23, 0x88, 0x0a, 0x47, 0x80, 0x13, 0x0a, 0x27, 0x1a, 0xe8, 0x0a, 0x26, 0x01, 0xa6, 0x01, 0xa5, 
+  0x12, 0x66, 0x23, 0x28, 0x12, 0x66, 0x01, 0xe6, 0x09, 0xe6, 0x01, 0xc6, 0x12, 0x47, 0x1a, 0xc8, 
+  0x0a, 0x26, 0x01, 0xe6, 0x09, 0xe7, 0x01, 0xc6, 0x0a, 0x26, 0x12, 0xc7, 0x0a, 0x47, 0x41, 0x01, 
+  0xc6, 0x80, 0x02, 0x0a, 0x26, 0x01, 0xc6, 0x09, 0xe7, 0x84, 0x00, 0x1b, 0x08, 0x83, 0x01, 0x09, 
+  0xe6, 0x09, 0xe7, 0x80, 0x00, 0x01, 0xe7, 0x42, 0x09, 0xe7, 0x01, 0x01, 0xe6, 0x01, 0xe7, 0x80, 
+  0x01, 0x09, 0xe6, 0x01, 0xe7, 0x81, 0x4a, 0x01, 0xe6, 0x03, 0x01, 0xe5, 0x12, 0xa7, 0x1a, 0xc8, 
+  0x02, 0x06, 0x41, 0x01, 0xe6, 0x42, 0x02, 0x06, 0x41, 0x09, 0xe6, 0x00, 0x1b, 0xa8, 0x96, 0x07, 
+  0x1b, 0x68, 0x01, 0xe5, 0x0a, 0xa7, 0x23, 0xe9, 0x1b, 0xc8, 0x23, 0xa8, 0x0a, 0x46, 0x01, 0xc5, 
+  0x41, 0x01, 0xc6, 0x43, 0x01, 0xe6, 0x80, 0x41, 0x01, 0xe5, 0x48, 0x01, 0xe6, 0x02, 0x01, 0xc5, 
+  0x01, 0xe5, 0x23, 0x48, 0x41, 0x23, 0x88, 0x01, 0x1b, 0x07, 0x02, 0x06, 0x41, 0x09, 0xe6, 0x84, 
+  0x00, 0x09, 0xe6, 0x83, 0x00, 0x09, 0xe7, 0x86, 0x00, 0x01, 0xe7, 0x80, 0x09, 0x01, 0xe6, 0x12, 
+  0x48, 0x95, 0x95, 0xd7, 0x7d, 0xcf, 0x1b, 0xce, 0xfb, 0xcf, 0x3c, 0x74, 0x30, 0x00, 0xe3, 0x01, 
+  0x04, 0x41, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x01, 0x01, 0xe7, 0x01, 0xe6, 0x43, 0x01, 0xe7, 0x49, 
+  0x09, 0xe7, 0x81, 0x02, 0x23, 0x28, 0x12, 0x87, 0x01, 0xc6, 0x41, 0x09, 0xe6, 0x41, 0x01, 0xe6, 
+  0x00, 0x0a, 0x26, 0x41, 0x1a, 0xe8, 0x01, 0x1b, 0x08, 0x1a, 0xe8, 0x49, 0x1b, 0x08, 0x00, 0x1a, 
+  0xe8, 0x45, 0x1b, 0x08, 0x02, 0x12, 0xc7, 0x0a, 0x26, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x01, 0x1a, 
+  0xc7, 0x2b, 0xc9, 0x41, 0x23, 0x88, 0x0a, 0x0a, 0x66, 0x0a, 0x07, 0x09, 0xe7, 0x0a, 0x07, 0x1b, 
+  0x08, 0x23, 0x88, 0x1b, 0x48, 0x0a, 0x26, 0x01, 0x85, 0x01, 0xa6, 0x0a, 0x67, 0x41, 0x23, 0xc8, 
+  0x03, 0x2b, 0xc8, 0x12, 0xc7, 0x0a, 0x06, 0x09, 0xe7, 0x80, 0x06, 0x0a, 0x48, 0x09, 0xc6, 0x01, 
+  0xa5, 0x12, 0x46, 0x23, 0x07, 0x12, 0x46, 0x01, 0xc5, 0x41, 0x01, 0xc6, 0x08, 0x0a, 0x26, 0x1a, 
+  0xa7, 0x0a, 0x06, 0x09, 0xe6, 0x0a, 0x07, 0x01, 0xc6, 0x12, 0x67, 0x23, 0x69, 0x12, 0xa7, 0x42, 
+  0x01, 0xc6, 0x01, 0x1a, 0xe8, 0x0a, 0x46, 0x81, 0x00, 0x01, 0xc6, 0x84, 0x00, 0x02, 0x06, 0x80, 
+  0x02, 0x1b, 0x08, 0x01, 0xc5, 0x09, 0xe7, 0x42, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x42, 0x01, 0xe7, 
+  0x00, 0x09, 0xe7, 0x80, 0x00, 0x09, 0xe7, 0x42, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x80, 0x00, 0x01, 
+  0xe7, 0x83, 0x03, 0x01, 0xc6, 0x12, 0xa7, 0x1a, 0xa7, 0x0a, 0x06, 0x80, 0x01, 0x01, 0xc5, 0x0a, 
+  0x26, 0x41, 0x1b, 0x28, 0x02, 0x1b, 0x48, 0x0a, 0x46, 0x02, 0x06, 0x98, 0x04, 0x01, 0xc5, 0x0a, 
+  0x86, 0x23, 0xc8, 0x1b, 0xa8, 0x23, 0x88, 0x41, 0x1a, 0xe7, 0x00, 0x1a, 0xe8, 0x51, 0x1b, 0x08, 
+  0x06, 0x1b, 0x28, 0x23, 0xa8, 0x12, 0xa6, 0x1b, 0x06, 0x23, 0xa8, 0x0a, 0x26, 0x01, 0xe6, 0x84, 
+  0x00, 0x09, 0xe7, 0x80, 0x46, 0x01, 0xe6, 0x02, 0x01, 0xe7, 0x09, 0xe7, 0x01, 0xe7, 0x81, 0x0b, 
+  0x01, 0xc6, 0x09, 0xc6, 0x7d, 0x13, 0xae, 0x38, 0xdf, 0x7d, 0xc6, 0xfb, 0xce, 0xfb, 0xdf, 0x7d, 
+  0x64, 0x0f, 0x01, 0x04, 0x01, 0x65, 0x09, 0xc6, 0x80, 0x46, 0x01, 0xe6, 0x80, 0x41, 0x09, 0xe7, 
+  0x00, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x47, 0x09, 0xe7, 0x80, 0x01, 0x0a, 0x26, 0x01, 0xe6, 0x41, 
+  0x09, 0xe6, 0x00, 0x01, 0xc6, 0x80, 0x02, 0x1a, 0xc7, 0x1b, 0x07, 0x0a, 0x46, 0x42, 0x0a, 0x26, 
+  0x42, 0x0a, 0x46, 0x41, 0x0a, 0x26, 0x45, 0x0a, 0x46, 0x41, 0x0a, 0x26, 0x41, 0x0a, 0x46, 0x02, 
+  0x0a, 0x26, 0x0a, 0x47, 0x02, 0x06, 0x43, 0x01, 0xe6, 0x80, 0x05, 0x09, 0xe6, 0x0a, 0x46, 0x0a, 
+  0x06, 0x0a, 0x26, 0x01, 0xe6, 0x09, 0xe6, 0x80, 0x08, 0x01, 0xe7, 0x0a, 0x07, 0x0a, 0x46, 0x0a, 
+  0x06, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xc6, 0x02, 0x06, 0x0a, 0x66, 0x41, 0x0a, 0x67, 0x01, 0x0a, 
+  0x27, 0x09, 0xe6, 0x42, 0x09, 0xe7, 0x80, 0x04, 0x1a, 0x87, 0x22, 0xe7, 0x0a, 0x05, 0x01, 0x85, 
+  0x01, 0xa6, 0x80, 0x03, 0x0a, 0x26, 0x12, 0x87, 0x09, 0xe6, 0x01, 0xc6, 0x80, 0x05, 0x01, 0xe6, 
+  0x12, 0x67, 0x23, 0x48, 0x12, 0xc7, 0x0a, 0x26, 0x09, 0xe7, 0x81, 0x01, 0x1a, 0xc7, 0x0a, 0x26, 
+  0x80, 0x00, 0x01, 0xe7, 0x83, 0x00, 0x0a, 0xa7, 0x84, 0x00, 0x01, 0xe6, 0x83, 0x42, 0x01, 0xe7, 
+  0x00, 0x01, 0xe6, 0x41, 0x09, 0xe7, 0x00, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x81, 0x41, 0x09, 0xe7, 
+  0x00, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x81, 0x01, 0x1a, 0xc7, 0x12, 0x87, 0x42, 
+  0x01, 0xe6, 0x05, 0x0a, 0x46, 0x23, 0x28, 0x23, 0xa8, 0x1b, 0xa8, 0x23, 0xa8, 0x0a, 0x66, 0x95, 
+  0x00, 0x1b, 0xc8, 0x83, 0x06, 0x0a, 0x46, 0x23, 0x88, 0x1b, 0x88, 0x23, 0x68, 0x0a, 0x46, 0x0a, 
+  0x06, 0x0a, 0x26, 0x46, 0x0a, 0x46, 0x42, 0x0a, 0x26, 0x00, 0x0a, 0x46, 0x41, 0x0a, 0x26, 0x00, 
+  0x0a, 0x46, 0x41, 0x0a, 0x26, 0x41, 0x0a, 0x46, 0x05, 0x12, 0xa6, 0x23, 0x88, 0x23, 0x47, 0x1b, 
+  0x27, 0x1b, 0x48, 0x02, 0x26, 0x80, 0x00, 0x01, 0xe7, 0x84, 0x46, 0x01, 0xe6, 0x00, 0x01, 0xe7, 
+  0x41, 0x01, 0xa6, 0x0b, 0x01, 0xc6, 0x01, 0xe7, 0x01, 0xa6, 0x01, 0x65, 0x7c, 0xf3, 0xd7, 0x7d, 
+  0xd7, 0x5d, 0xc6, 0xfb, 0xd7, 0x3c, 0xdf, 0x5d, 0x6c, 0x50, 0x09, 0xa5, 0x41, 0x09, 0xc6, 0x41, 
+  0x01, 0xc6, 0x88, 0x00, 0x01, 0xe7, 0x80, 0x41, 0x09, 0xe7, 0x42, 0x09, 0xe6, 0x85, 0x00, 0x01, 
+  0xc6, 0x41, 0x09, 0xe6, 0x02, 0x01, 0xc6, 0x0a, 0x05, 0x1a, 0xe7, 0x80, 0x02, 0x0a, 0x26, 0x01, 
+  0xe6, 0x01, 0xc6, 0x42, 0x01, 0xa6, 0x43, 0x01, 0xa5, 0x00, 0x01, 0xa6, 0x42, 0x01, 0xc6, 0x41, 
+  0x01, 0xa5, 0x01, 0x01, 0xa6, 0x01, 0xa5, 0x43, 0x01, 0xa6, 0x00, 0x01, 0xc6, 0x80, 0x00, 0x01, 
+  0xc6, 0x42, 0x01, 0xe6, 0x01, 0x01, 0xc6, 0x01, 0xa5, 0x41, 0x01, 0xa6, 0x00, 0x01, 0xc6, 0x41, 
+  0x09, 0xe6, 0x41, 0x09, 0xe7, 0x00, 0x09, 0xe6, 0x41, 0x09, 0xc6, 0x00, 0x09, 0xe6, 0x80, 0x41, 
+  0x09, 0xe6, 0x00, 0x09, 0xe7, 0x42, 0x0a, 0x07, 0x81, 0x18, 0x09, 0xe6, 0x12, 0x66, 0x2b, 0x48, 
+  0x12, 0x67, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xa5, 0x12, 0x26, 0x1a, 0xa7, 0x09, 0xe6, 0x01, 0xe6, 
+  0x09, 0xe6, 0x01, 0xc6, 0x0a, 0x67, 0x2b, 0x89, 0x1b, 0x28, 0x02, 0x06, 0x0a, 0x06, 0x09, 0xe6, 
+  0x01, 0xe5, 0x1a, 0xc7, 0x12, 0x66, 0x01, 0xe5, 0x01, 0xe6, 0x09, 0xe7, 0x80, 0x00, 0x12, 0xe7, 
+  0x83, 0x00, 0x02, 0x26, 0x82, 0x01, 0x09, 0xe6, 0x09, 0xe7, 0x41, 0x01, 0xe6, 0x42, 0x01, 0xe7, 
+  0x41, 0x01, 0xe6, 0x80, 0x41, 0x01, 0xe7, 0x00, 0x09, 0xe7, 0x42, 0x01, 0xe6, 0x41, 0x09, 0xe6, 
+  0x41, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x07, 0x1a, 0xc7, 0x1a, 0xc8, 0x02, 0x06, 0x0a, 0x06, 0x01, 
+  0xc6, 0x12, 0x66, 0x23, 0x27, 0x1a, 0xe7, 0x41, 0x1b, 0x27, 0x01, 0x1b, 0x48, 0x0a, 0x46, 0x8f, 
+  0x42, 0x1b, 0xa8, 0x86, 0x01, 0x09, 0xc5, 0x01, 0xe6, 0x41, 0x0a, 0x26, 0x00, 0x0a, 0x06, 0x45, 
+  0x01, 0xc6, 0x00, 0x01, 0xe6, 0x43, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x48, 0x01, 0xc6, 0x06, 0x01, 
+  0xe6, 0x13, 0x07, 0x23, 0xa8, 0x1b, 0x47, 0x0a, 0x46, 0x02, 0x06, 0x09, 0xe6, 0x41, 0x09, 0xe7, 
+  0x81, 0x42, 0x09, 0xe7, 0x84, 0x09, 0x01, 0xc6, 0x01, 0x85, 0x1a, 0x69, 0x22, 0xaa, 0x12, 0x48, 
+  0x01, 0xc6, 0x09, 0x85, 0x7c, 0xb2, 0xcf, 0x5c, 0xc6, 0xfb, 0x41, 0xcf, 0x1b, 0x04, 0xc6, 0xba, 
+  0x7c, 0x92, 0x01, 0xa5, 0x09, 0xe7, 0x09, 0xe6, 0x41, 0x01, 0xc6, 0x01, 0x01, 0xe6, 0x01, 0xe7, 
+  0x47, 0x01, 0xe6, 0x42, 0x01, 0xe7, 0x82, 0x45, 0x09, 0xe7, 0x80, 0x06, 0x01, 0xe7, 0x09, 0xe7, 
+  0x01, 0xc6, 0x0a, 0x06, 0x1a, 0xe7, 0x1a, 0xa7, 0x09, 0xe6, 0x41, 0x01, 0xc6, 0x00, 0x09, 0xe6, 
+  0x42, 0x12, 0x67, 0x01, 0x0a, 0x87, 0x12, 0x67, 0x42, 0x0a, 0x67, 0x01, 0x0a, 0x87, 0x12, 0x87, 
+  0x41, 0x12, 0x67, 0x42, 0x0a, 0x67, 0x42, 0x12, 0x47, 0x41, 0x12, 0x67, 0x01, 0x0a, 0x87, 0x12, 
+  0x87, 0x43, 0x0a, 0x87, 0x02, 0x0a, 0x67, 0x0a, 0x46, 0x09, 0xe6, 0x84, 0x41, 0x09, 0xe7, 0x03, 
+  0x09, 0xe6, 0x09, 0xe7, 0x09, 0xc6, 0x01, 0xe6, 0x41, 0x09, 0xe7, 0x80, 0x00, 0x09, 0xe7, 0x81, 
+  0x05, 0x01, 0xc6, 0x0a, 0x06, 0x1a, 0xe8, 0x12, 0xa8, 0x0a, 0x07, 0x09, 0xe7, 0x80, 0x0f, 0x0a, 
+  0x26, 0x1a, 0x87, 0x09, 0xe6, 0x01, 0xe6, 0x09, 0xe7, 0x01, 0xe6, 0x0a, 0x46, 0x23, 0x68, 0x23, 
+  0x28, 0x0a, 0x26, 0x0a, 0x07, 0x09, 0xe7, 0x0a, 0x06, 0x1a, 0xa7, 0x12, 0x66, 0x01, 0xc6, 0x41, 
+  0x01, 0xe6, 0x81, 0x00, 0x12, 0xe8, 0x81, 0x00, 0x0a, 0x87, 0x84, 0x41, 0x09, 0xe7, 0x82, 0x42, 
+  0x01, 0xe6, 0x41, 0x09, 0xe7, 0x80, 0x00, 0x01, 0xe6, 0x82, 0x45, 0x09, 0xe6, 0x00, 0x01, 0xe5, 
+  0x41, 0x1a, 0xc7, 0x05, 0x0a, 0x06, 0x01, 0xe6, 0x09, 0xe6, 0x0a, 0x46, 0x23, 0x07, 0x12, 0x86, 
+  0x42, 0x01, 0xc5, 0x41, 0x01, 0xc6, 0x01, 0x0a, 0x26, 0x23, 0xc8, 0x42, 0x23, 0xe8, 0x49, 0x1b, 
+  0xe8, 0x80, 0x41, 0x23, 0xc8, 0x00, 0x1b, 0xc8, 0x45, 0x1b, 0xe8, 0x80, 0x00, 0x01, 0xe6, 0x43, 
+  0x01, 0xc6, 0x00, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x01, 0x09, 0xe6, 0x01, 0xe7, 0x41, 0x09, 0xe7, 
+  0x00, 0x01, 0xe7, 0x44, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x41, 0x09, 0xe6, 0x02, 0x09, 0xc6, 0x09, 
+  0xe7, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x04, 0x02, 0x07, 0x02, 0x67, 0x1b, 0x27, 0x23, 0x88, 0x02, 
+  0x26, 0x80, 0x41, 0x09, 0xe7, 0x42, 0x01, 0xe6, 0x44, 0x09, 0xe7, 0x80, 0x01, 0x09, 0xe7, 0x09, 
+  0xe6, 0x80, 0x06, 0x43, 0x4c, 0xc6, 0xfb, 0xe7, 0xbe, 0xa6, 0x17, 0x22, 0x07, 0x8d, 0x34, 0xd7, 
+  0x7d, 0x41, 0xc7, 0x1b, 0x04, 0xd7, 0x3c, 0x84, 0xf3, 0x09, 0xa6, 0x09, 0xe7, 0x01, 0xe7, 0x82, 
+  0x46, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x43, 0x01, 0xe6, 0x4b, 0x09, 0xe7, 0x80, 0x03, 0x01, 0xe6, 
+  0x0a, 0x06, 0x1a, 0xe7, 0x12, 0x87, 0x42, 0x01, 0xc6, 0x01, 0x0a, 0x26, 0x12, 0x67, 0x41, 0x1a, 
+  0xe8, 0x4a, 0x1b, 0x08, 0x46, 0x1a, 0xe8, 0x45, 0x1b, 0x08, 0x41, 0x1a, 0xe8, 0x00, 0x0a, 0x27, 
+  0x81, 0x02, 0x09, 0xe7, 0x09, 0xc7, 0x09, 0xe6, 0x80, 0x00, 0x09, 0xe6, 0x48, 0x09, 0xe7, 0x01, 
+  0x01, 0xe6, 0x0a, 0x07, 0x80, 0x01, 0x12, 0x68, 0x0a, 0x27, 0x80, 0x12, 0x02, 0x07, 0x12, 0x67, 
+  0x1a, 0xa7, 0x09, 0xe6, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xe6, 0x0a, 0x67, 0x23, 0x89, 0x1b, 0x08, 
+  0x0a, 0x06, 0x09, 0xe6, 0x01, 0xe6, 0x0a, 0x07, 0x1a, 0xc8, 0x12, 0x67, 0x01, 0xc5, 0x09, 0xe6, 
+  0x01, 0xc6, 0x81, 0x01, 0x01, 0xe6, 0x1a, 0xe8, 0x80, 0x02, 0x1a, 0xe8, 0x12, 0x87, 0x1a, 0xe8, 
+  0x81, 0x00, 0x1b, 0x28, 0x80, 0x01, 0x09, 0xc6, 0x09, 0xc7, 0x42, 0x09, 0xe7, 0x80, 0x41, 0x09, 
+  0xe7, 0x00, 0x01, 0xe6, 0x41, 0x09, 0xe7, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x41, 0x09, 0xc7, 
+  0x41, 0x09, 0xc6, 0x80, 0x03, 0x01, 0xc6, 0x01, 0xe6, 0x12, 0xa7, 0x12, 0xa8, 0x42, 0x0a, 0x06, 
+  0x03, 0x12, 0x46, 0x1a, 0xe7, 0x1a, 0xa7, 0x09, 0xc6, 0x44, 0x01, 0xa6, 0x04, 0x0a, 0x06, 0x1b, 
+  0x28, 0x1b, 0x47, 0x1b, 0x48, 0x1b, 0x47, 0x46, 0x13, 0x27, 0x00, 0x1b, 0x27, 0x42, 0x13, 0x27, 
+  0x42, 0x1b, 0x27, 0x00, 0x1b, 0x47, 0x41, 0x13, 0x47, 0x03, 0x1b, 0x67, 0x13, 0x47, 0x1b, 0x48, 
+  0x1a, 0xe7, 0x81, 0x02, 0x09, 0xa6, 0x09, 0x86, 0x09, 0xc6, 0x83, 0x00, 0x09, 0xe6, 0x81, 0x41, 
+  0x09, 0xe6, 0x05, 0x01, 0xe7, 0x01, 0xc6, 0x09, 0xc6, 0x09, 0xe7, 0x09, 0xc6, 0x01, 0xc6, 0x41, 
+  0x09, 0xc6, 0x42, 0x09, 0xe7, 0x00, 0x09, 0xc6, 0x80, 0x05, 0x02, 0x27, 0x13, 0x08, 0x23, 0xc8, 
+  0x0a, 0xa7, 0x01, 0xe6, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x81, 0x00, 0x09, 0xe6, 0x41, 0x01, 0xe6, 
+  0x00, 0x09, 0xe6, 0x43, 0x09, 0xe7, 0x04, 0x01, 0x85, 0xae, 0x58, 0xdf, 0x7d, 0xcf, 0x3c, 0xd7, 
+  0x3c, 0x41, 0xd7, 0x5c, 0x06, 0xcf, 0x1c, 0xcf, 0x1b, 0xcf, 0x3c, 0x95, 0x95, 0x09, 0xa6, 0x01, 
+  0xc6, 0x01, 0xe7, 0x41, 0x09, 0xc6, 0x00, 0x01, 0xc6, 0x46, 0x01, 0xe6, 0x00, 0x01, 0xc6, 0x45, 
+  0x01, 0xe6, 0x41, 0x01, 0xe7, 0x86, 0x41, 0x0a, 0x07, 0x00, 0x01, 0xc6, 0x80, 0x03, 0x23, 0x28, 
+  0x1b, 0x07, 0x01, 0xe6, 0x09, 0xe6, 0x80, 0x02, 0x12, 0x67, 0x23, 0x09, 0x0a, 0x27, 0x42, 0x01, 
+  0xc6, 0x4e, 0x01, 0xc5, 0x01, 0x01, 0xc6, 0x01, 0xe6, 0x41, 0x01, 0xc5, 0x00, 0x01, 0xe5, 0x41, 
+  0x01, 0xe6, 0x41, 0x01, 0xe5, 0x02, 0x01, 0xe6, 0x01, 0xc6, 0x09, 0xc6, 0x42, 0x09, 0xe7, 0x41, 
+  0x09, 0xe6, 0x00, 0x01, 0xe6, 0x83, 0x00, 0x01, 0xe6, 0x81, 0x00, 0x09, 0xe6, 0x80, 0x01, 0x12, 
+  0xa8, 0x1b, 0x09, 0x41, 0x02, 0x07, 0x41, 0x0a, 0x47, 0x0f, 0x12, 0xc8, 0x23, 0x29, 0x0a, 0x06, 
+  0x01, 0xc6, 0x09, 0xc6, 0x01, 0xc6, 0x0a, 0x26, 0x23, 0x29, 0x1a, 0xe8, 0x0a, 0x47, 0x0a, 0x27, 
+  0x0a, 0x07, 0x12, 0x47, 0x23, 0x29, 0x12, 0x87, 0x01, 0xa6, 0x42, 0x09, 0xc6, 0x41, 0x09, 0xe7, 
+  0x00, 0x01, 0xc6, 0x81, 0x06, 0x1b, 0x08, 0x12, 0xc8, 0x1b, 0x29, 0x0a, 0x47, 0x12, 0xa8, 0x23, 
+  0x69, 0x01, 0xe6, 0x43, 0x0a, 0x07, 0x41, 0x09, 0xe7, 0x00, 0x09, 0xe6, 0x80, 0x00, 0x01, 0xe7, 
+  0x81, 0x41, 0x01, 0xe7, 0x43, 0x09, 0xe7, 0x18, 0x0a, 0x07, 0x09, 0xe7, 0x01, 0xe6, 0x1a, 0xc7, 
+  0x1a, 0xc8, 0x0a, 0x06, 0x0a, 0x07, 0x0a, 0x47, 0x1a, 0xa7, 0x23, 0x07, 0x0a, 0x06, 0x01, 0xa6, 
+  0x09, 0xe6, 0x09, 0xe7, 0x09, 0xc6, 0x09, 0xa6, 0x09, 0xc6, 0x09, 0xa6, 0x01, 0xc6, 0x0a, 0x07, 
+  0x02, 0x26, 0x02, 0x06, 0x01, 0xe6, 0x02, 0x06, 0x02, 0x26, 0x43, 0x02, 0x06, 0x41, 0x01, 0xe6, 
+  0x02, 0x01, 0xc5, 0x01, 0xe6, 0x0a, 0x06, 0x42, 0x01, 0xe6, 0x41, 0x02, 0x06, 0x04, 0x02, 0x26, 
+  0x0a, 0x47, 0x0a, 0x67, 0x0a, 0x47, 0x02, 0x27, 0x80, 0x04, 0x09, 0xa6, 0x01, 0xa5, 0x09, 0xc6, 
+  0x09, 0xe6, 0x01, 0xe6, 0x82, 0x00, 0x09, 0xe7, 0x42, 0x09, 0xe6, 0x00, 0x09, 0xc6, 0x41, 0x01, 
+  0xc6, 0x00, 0x0a, 0x07, 0x80, 0x02, 0x09, 0xc7, 0x09, 0xe7, 0x01, 0xc6, 0x84, 0x07, 0x01, 0xc6, 
+  0x0a, 0x07, 0x12, 0xc8, 0x1b, 0x48, 0x23, 0x68, 0x0a, 0x26, 0x01, 0xc6, 0x09, 0xe6, 0x80, 0x41, 
+  0x09, 0xe6, 0x01, 0x09, 0xe7, 0x09, 0xe6, 0x45, 0x09, 0xe7, 0x80, 0x02, 0xb6, 0x79, 0xef, 0xff, 
+  0xce, 0xfb, 0x44, 0xcf, 0x1c, 0x80, 0x01, 0x6c, 0x50, 0x01, 0x24, 0x80, 0x02, 0x09, 0xc6, 0x09, 
+  0xe6, 0x01, 0xc6, 0x47, 0x01, 0xe6, 0x83, 0x41, 0x09, 0xe7, 0x00, 0x01, 0xe7, 0x49, 0x09, 0xe7, 
+  0x80, 0x03, 0x01, 0xe6, 0x1a, 0xe7, 0x1b, 0x08, 0x0a, 0x26, 0x41, 0x01, 0xc6, 0x06, 0x12, 0x87, 
+  0x23, 0x08, 0x12, 0x67, 0x01, 0x44, 0x01, 0x03, 0x01, 0x24, 0x01, 0x85, 0x42, 0x09, 0xc6, 0x4b, 
+  0x01, 0xc6, 0x01, 0x01, 0xe6, 0x09, 0xe6, 0x42, 0x01, 0xc6, 0x01, 0x09, 0xe7, 0x01, 0xc6, 0x42, 
+  0x09, 0xc7, 0x42, 0x09, 0xc6, 0x44, 0x09, 0xe7, 0x00, 0x09, 0xe6, 0x43, 0x09, 0xe7, 0x00, 0x01, 
+  0x85, 0x41, 0x00, 0xe3, 0x0e, 0x01, 0x23, 0x12, 0x05, 0x01, 0xc5, 0x01, 0xa6, 0x01, 0x44, 0x00, 
+  0x81, 0x09, 0x84, 0x12, 0x05, 0x00, 0xe2, 0x01, 0x44, 0x09, 0xe6, 0x01, 0xc6, 0x0a, 0x06, 0x23, 
+  0x28, 0x11, 0xe5, 0x43, 0x00, 0x61, 0x03, 0x00, 0xa2, 0x00, 0xe2, 0x00, 0xa2, 0x09, 0xa6, 0x80, 
+  0x00, 0x09, 0xe6, 0x42, 0x09, 0xe7, 0x80, 0x07, 0x12, 0xc8, 0x12, 0xe7, 0x1a, 0xa7, 0x01, 0x23, 
+  0x01, 0x63, 0x00, 0xc2, 0x01, 0x02, 0x09, 0x84, 0x43, 0x00, 0xa2, 0x01, 0x00, 0xe3, 0x01, 0xe6, 
+  0x41, 0x09, 0xe7, 0x02, 0x01, 0xa6, 0x01, 0x85, 0x01, 0x65, 0x43, 0x01, 0x85, 0x0d, 0x01, 0xc6, 
+  0x09, 0xc6, 0x00, 0xe3, 0x00, 0x41, 0x01, 0x24, 0x1a, 0xc7, 0x1a, 0xe8, 0x0a, 0x27, 0x0a, 0x07, 
+  0x0a, 0x87, 0x1b, 0x27, 0x23, 0x07, 0x12, 0x67, 0x09, 0xc6, 0x80, 0x02, 0x01, 0x24, 0x01, 0x45, 
+  0x09, 0xe7, 0x81, 0x03, 0x09, 0xc6, 0x01, 0x44, 0x00, 0x61, 0x01, 0x43, 0x41, 0x0a, 0x06, 0x00, 
+  0x01, 0x64, 0x41, 0x01, 0x03, 0x00, 0x00, 0xe3, 0x41, 0x01, 0x03, 0x06, 0x01, 0x24, 0x01, 0x44, 
+  0x01, 0xc6, 0x01, 0x44, 0x00, 0xa1, 0x01, 0x64, 0x0a, 0x27, 0x42, 0x02, 0x06, 0x00, 0x01, 0x44, 
+  0x41, 0x01, 0x64, 0x41, 0x01, 0x44, 0x41, 0x01, 0xa6, 0x04, 0x01, 0x44, 0x00, 0x61, 0x00, 0x82, 
+  0x01, 0xa5, 0x01, 0xc6, 0x80, 0x00, 0x01, 0xe7, 0x80, 0x01, 0x01, 0xc6, 0x01, 0xa6, 0x42, 0x01, 
+  0xc6, 0x06, 0x01, 0x65, 0x00, 0x81, 0x01, 0x24, 0x01, 0x65, 0x00, 0xa2, 0x01, 0x03, 0x09, 0xa6, 
+  0x41, 0x09, 0xc6, 0x01, 0x01, 0xc6, 0x09, 0xe7, 0x41, 0x01, 0xe6, 0x06, 0x0a, 0xa7, 0x13, 0x07, 
+  0x1b, 0x07, 0x02, 0x06, 0x0a, 0x07, 0x09, 0xe7, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x01, 0x09, 0xe6, 
+  0x01, 0xe6, 0x82, 0x42, 0x09, 0xc6, 0x05, 0x01, 0xc6, 0x53, 0x6d, 0x84, 0xd2, 0xe7, 0xbe, 0xd7, 
+  0x5d, 0xce, 0xfb, 0x80, 0x01, 0xcf, 0x1b, 0xce, 0xfb, 0x41, 0xcf, 0x3c, 0x01, 0x53, 0xae, 0x01, 
+  0x65, 0x42, 0x01, 0xc6, 0x82, 0x41, 0x01, 0xe7, 0x46, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x42, 0x01, 
+  0xe6, 0x82, 0x00, 0x09, 0xe6, 0x85, 0x0e, 0x23, 0x28, 0x23, 0x07, 0x09, 0xe6, 0x01, 0xc6, 0x01, 
+  0xe6, 0x1a, 0x87, 0x23, 0x09, 0x0a, 0x06, 0x01, 0x65, 0x84, 0xd2, 0x95, 0x34, 0x9d, 0x96, 0x3a, 
+  0xeb, 0x01, 0x64, 0x09, 0xe7, 0x42, 0x01, 0xc6, 0x41, 0x09, 0xc6, 0x82, 0x41, 0x09, 0xe6, 0x83, 
+  0x00, 0x01, 0xe6, 0x43, 0x01, 0xc6, 0x00, 0x09, 0xc6, 0x43, 0x09, 0xe7, 0x81, 0x00, 0x09, 0xe6, 
+  0x84, 0x41, 0x09, 0xe6, 0x80, 0x14, 0x01, 0x85, 0x21, 0x45, 0x4a, 0x28, 0x42, 0x08, 0x42, 0x28, 
+  0x4a, 0x28, 0x4a, 0x69, 0x10, 0xc3, 0x21, 0x04, 0x9c, 0xf3, 0x4a, 0x49, 0x10, 0x82, 0x9c, 0xd3, 
+  0x52, 0xaa, 0x01, 0x24, 0x0a, 0x67, 0x22, 0xe8, 0x09, 0x22, 0x10, 0x82, 0x94, 0x71, 0xb5, 0x75, 
+  0x41, 0xad, 0x55, 0x03, 0xad, 0x34, 0xa4, 0xf3, 0x41, 0xe7, 0x00, 0x61, 0x80, 0x00, 0x0a, 0x07, 
+  0x80, 0x00, 0x09, 0xe6, 0x82, 0x03, 0x12, 0xc7, 0x08, 0xe3, 0x6b, 0x2c, 0x73, 0x8e, 0x41, 0x6b, 
+  0x6d, 0x00, 0x73, 0x6d, 0x41, 0x73, 0x8e, 0x06, 0x73, 0x8d, 0x73, 0x8e, 0x6b, 0x4c, 0x11, 0x44, 
+  0x02, 0x07, 0x01, 0x85, 0x10, 0xc3, 0x41, 0x18, 0xe3, 0x10, 0x19, 0x03, 0x19, 0x04, 0x21, 0x24, 
+  0x19, 0x04, 0x09, 0x44, 0x00, 0xa2, 0x4a, 0x69, 0xad, 0x34, 0x21, 0x65, 0x12, 0x05, 0x0a, 0x26, 
+  0x09, 0xe7, 0x0a, 0x67, 0x1b, 0x07, 0x2b, 0x88, 0x1a, 0xa7, 0x01, 0xe6, 0x80, 0x03, 0x09, 0x04, 
+  0x42, 0x08, 0x31, 0xc7, 0x09, 0x44, 0x41, 0x09, 0xc6, 0x17, 0x01, 0x85, 0x19, 0x24, 0xa5, 0x34, 
+  0x5a, 0xeb, 0x12, 0x25, 0x1a, 0x66, 0x42, 0x08, 0x52, 0x8a, 0x4a, 0x49, 0x42, 0x28, 0x42, 0x08, 
+  0x39, 0xe7, 0x42, 0x08, 0x3a, 0x08, 0x00, 0xa2, 0x31, 0xa6, 0x9c, 0xd3, 0x39, 0xe7, 0x0a, 0x66, 
+  0x1b, 0x48, 0x12, 0xc7, 0x11, 0x44, 0x52, 0x8a, 0x52, 0xcb, 0x41, 0x52, 0xaa, 0x16, 0x39, 0xc7, 
+  0x01, 0x03, 0x09, 0xe6, 0x08, 0xc2, 0x9c, 0xb2, 0x84, 0x10, 0x00, 0xc2, 0x09, 0xe6, 0x01, 0xc6, 
+  0x01, 0xe6, 0x09, 0x85, 0x00, 0xa2, 0x00, 0x81, 0x00, 0xe3, 0x01, 0x85, 0x01, 0x64, 0x21, 0x45, 
+  0x94, 0xb2, 0x42, 0x28, 0x18, 0xe3, 0xa5, 0x14, 0x52, 0x69, 0x00, 0xe3, 0x80, 0x04, 0x01, 0xa6, 
+  0x09, 0xc6, 0x01, 0x04, 0x00, 0x82, 0x11, 0x03, 0x41, 0x11, 0x23, 0x05, 0x11, 0x03, 0x10, 0xe3, 
+  0x00, 0xa2, 0x09, 0xa6, 0x09, 0xe7, 0x09, 0xc6, 0x45, 0x09, 0xe7, 0x82, 0x0d, 0x09, 0xe7, 0x01, 
+  0x64, 0x09, 0xc6, 0x4b, 0x2c, 0x7c, 0xb2, 0xe7, 0xbe, 0xcf, 0x3c, 0xcf, 0x1c, 0xcf, 0x1b, 0xce, 
+  0xfb, 0xd7, 0x7d, 0xa6, 0x17, 0x01, 0x44, 0x09, 0xc6, 0x80, 0x4b, 0x01, 0xe6, 0x41, 0x09, 0xe6, 
+  0x80, 0x00, 0x01, 0xe7, 0x4a, 0x09, 0xe7, 0x02, 0x1a, 0xe7, 0x0a, 0x06, 0x01, 0xa5, 0x80, 0x0a, 
+  0x1a, 0x87, 0x23, 0x28, 0x12, 0x47, 0x1a, 0x07, 0x9d, 0x75, 0xd7, 0x3c, 0xd7, 0x7d, 0xdf, 0x7d, 
+  0xb6, 0x79, 0x32, 0xca, 0x01, 0x85, 0x82, 0x00, 0x09, 0xe6, 0x83, 0x00, 0x01, 0xc6, 0x42, 0x01, 
+  0xe6, 0x80, 0x00, 0x09, 0xe6, 0x44, 0x01, 0xc6, 0x80, 0x00, 0x09, 0xe6, 0x80, 0x00, 0x09, 0xe6, 
+  0x41, 0x01, 0xc6, 0x47, 0x09, 0xe7, 0x03, 0x09, 0xc6, 0x0a, 0x07, 0x00, 0xa2, 0x6b, 0x4d, 0x44, 
+  0xff, 0xff, 0x0d, 0x39, 0xc7, 0x29, 0x65, 0xff, 0xff, 0x7b, 0xcf, 0x18, 0xe3, 0xff, 0xff, 0x8c, 
+  0x30, 0x00, 0xe2, 0x2b, 0x8a, 0x09, 0x63, 0x42, 0x08, 0xe7, 0x3c, 0xf7, 0xbe, 0xde, 0xfb, 0x41, 
+  0xe7, 0x1b, 0x04, 0xde, 0xfb, 0xf7, 0xbe, 0xff, 0xff, 0x83, 0xef, 0x00, 0xa2, 0x82, 0x00, 0x09, 
+  0xc6, 0x81, 0x05, 0x12, 0x87, 0x08, 0x82, 0xe7, 0x1c, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xde, 0x45, 
+  0xff, 0xff, 0x05, 0x21, 0x65, 0x01, 0xa6, 0x00, 0x41, 0x9c, 0xd2, 0xff, 0xff, 0xff, 0xfe, 0x41, 
+  0xff, 0xff, 0x13, 0xff, 0xbe, 0xc6, 0x18, 0x08, 0x82, 0x00, 0x20, 0x7b, 0xef, 0xff, 0xff, 0x39, 
+  0xc7, 0x01, 0x23, 0x01, 0xe6, 0x0a, 0x26, 0x1a, 0xe7, 0x23, 0x48, 0x23, 0x08, 0x09, 0xe6, 0x09, 
+  0xe7, 0x01, 0xa6, 0x10, 0xc3, 0xff, 0xde, 0xc6, 0x17, 0x00, 0x61, 0x81, 0x06, 0x01, 0x44, 0x29, 
+  0x85, 0xff, 0xff, 0x9c, 0xd2, 0x01, 0xc3, 0x09, 0x83, 0xde, 0xba, 0x46, 0xff, 0xff, 0x08, 0x08, 
+  0x20, 0x5a, 0xca, 0xff, 0xff, 0x63, 0x2c, 0x0a, 0x24, 0x24, 0x09, 0x1a, 0xc6, 0x10, 0xe3, 0xff, 
+  0xde, 0x42, 0xff, 0xff, 0x06, 0xc6, 0x18, 0x00, 0xa1, 0x0a, 0x27, 0x08, 0xa2, 0xff, 0xde, 0xde, 
+  0xdb, 0x00, 0xa2, 0x41, 0x01, 0xc6, 0x04, 0x09, 0xe7, 0x00, 0x61, 0x7b, 0xae, 0xde, 0xda, 0x29, 
+  0x65, 0x41, 0x01, 0x24, 0x13, 0x31, 0xc6, 0xff, 0xff, 0x7b, 0xce, 0x29, 0x24, 0xff, 0xff, 0x83, 
+  0xef, 0x00, 0x82, 0x09, 0xe7, 0x09, 0xa6, 0x00, 0xa2, 0x21, 0x24, 0xad, 0x54, 0xf7, 0x9e, 0xf7, 
+  0x9d, 0xf7, 0xbd, 0xf7, 0xbe, 0xe7, 0x3c, 0x5a, 0xcb, 0x00, 0x61, 0x01, 0xa6, 0x86, 0x42, 0x09, 
+  0xe7, 0x00, 0x09, 0xe6, 0x41, 0x0a, 0x07, 0x09, 0x01, 0x44, 0x11, 0xe7, 0x3a, 0xaa, 0x8d, 0x34, 
+  0xdf, 0x7d, 0xcf, 0x1c, 0xd7, 0x3c, 0xc6, 0xba, 0x3b, 0x2c, 0x01, 0x85, 0x42, 0x01, 0xc6, 0x4e, 
+  0x01, 0xe6, 0x00, 0x09, 0xe6, 0x89, 0x41, 0x01, 0x85, 0x80, 0x0b, 0x12, 0x67, 0x1b, 0x08, 0x0a, 
+  0x46, 0x1a, 0x27, 0x9d, 0xb6, 0xdf, 0x9e, 0xcf, 0x1c, 0xce, 0xdb, 0xce, 0xfb, 0xd7, 0x3c, 0x43, 
+  0x4c, 0x01, 0x65, 0x80, 0x42, 0x01, 0xa6, 0x47, 0x01, 0xc6, 0x00, 0x01, 0xa6, 0x44, 0x01, 0xc6, 
+  0x00, 0x01, 0xa6, 0x4d, 0x01, 0xc6, 0x01, 0x01, 0xa6, 0x09, 0xe7, 0x82, 0x02, 0x73, 0x6d, 0x42, 
+  0x08, 0x8c, 0x50, 0x80, 0x0a, 0x39, 0xc6, 0x21, 0x24, 0xff, 0xdf, 0x6b, 0x6d, 0x10, 0x82, 0xff, 
+  0xdf, 0x7b, 0xcf, 0x01, 0x63, 0x1b, 0x08, 0x08, 0xa2, 0xe7, 0x1b, 0x80, 0x00, 0x18, 0xe3, 0x43, 
+  0x00, 0x00, 0x05, 0x08, 0x41, 0xb5, 0xb6, 0xff, 0xff, 0x4a, 0x69, 0x01, 0x24, 0x0a, 0x07, 0x82, 
+  0x02, 0x12, 0xc7, 0x12, 0x86, 0x09, 0x03, 0x42, 0x18, 0xc3, 0x10, 0x08, 0x41, 0x00, 0x20, 0x18, 
+  0xc3, 0x21, 0x24, 0x10, 0xa2, 0xb5, 0x95, 0xff, 0xdf, 0x21, 0x24, 0x01, 0x44, 0x00, 0xc2, 0x4a, 
+  0x28, 0x7b, 0xcf, 0x7b, 0xce, 0x7b, 0xcf, 0x7b, 0xce, 0xf7, 0x9d, 0xde, 0xba, 0x81, 0x07, 0x73, 
+  0xae, 0xff, 0xdf, 0x31, 0xc6, 0x01, 0x03, 0x0a, 0x46, 0x1a, 0xe7, 0x23, 0x28, 0x1a, 0xa7, 0x41, 
+  0x09, 0xe6, 0x81, 0x03, 0x10, 0xe3, 0xf7, 0x9d, 0xbd, 0xf7, 0x00, 0x82, 0x41, 0x09, 0xe7, 0x16, 
+  0x01, 0x64, 0x29, 0x65, 0xff, 0xdf, 0x94, 0x71, 0x01, 0x82, 0x11, 0xc4, 0x39, 0xc7, 0x52, 0x8a, 
+  0x4a, 0x49, 0xde, 0xba, 0xf7, 0x9d, 0x52, 0xaa, 0x4a, 0x28, 0x4a, 0x69, 0x00, 0x20, 0x5a, 0xcb, 
+  0xff, 0xdf, 0x52, 0xaa, 0x00, 0x40, 0x19, 0xe5, 0x00, 0xc1, 0x00, 0x00, 0x29, 0x65, 0x41, 0x31, 
+  0xa6, 0x08, 0x39, 0xc7, 0x29, 0x45, 0x00, 0x40, 0x00, 0xe3, 0x08, 0x82, 0xef, 0x3c, 0xd6, 0x79, 
+  0x00, 0xc2, 0x01, 0xe6, 0x80, 0x04, 0x0a, 0x07, 0x00, 0x40, 0x94, 0x91, 0xff, 0xff, 0x31, 0xc6, 
+  0x81, 0x02, 0x31, 0xa6, 0xff, 0xdf, 0x73, 0xae, 0x80, 0x0f, 0xff, 0xdf, 0x7b, 0xae, 0x00, 0xa2, 
+  0x0a, 0x27, 0x01, 0x03, 0x20, 0xe3, 0xe7, 0x1b, 0xff, 0xff, 0xa5, 0x34, 0x8c, 0x50, 0x8c, 0x71, 
+  0x8c, 0x30, 0xce, 0x79, 0xff, 0xff, 0x84, 0x10, 0x00, 0x20, 0x80, 0x00, 0x09, 0xe6, 0x88, 0x0a, 
+  0x09, 0xe7, 0x09, 0xe6, 0x09, 0xe7, 0x01, 0xa6, 0x01, 0x44, 0x12, 0x07, 0x2a, 0x89, 0xa5, 0xf7, 
+  0xce, 0xfb, 0x2a, 0xaa, 0x01, 0xa5, 0x43, 0x01, 0xc6, 0x82, 0x00, 0x01, 0xe7, 0x81, 0x00, 0x01, 
+  0xe7, 0x86, 0x00, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x88, 0x00, 0x01, 0xa5, 0x80, 0x00, 0x12, 0x47, 
+  0x80, 0x0a, 0x01, 0x63, 0x12, 0x07, 0xa5, 0xd7, 0xdf, 0x7d, 0xce, 0xfc, 0xd7, 0x1c, 0xdf, 0x7d, 
+  0xdf, 0x5d, 0x64, 0x0f, 0x01, 0x85, 0x01, 0xc6, 0x43, 0x0a, 0x26, 0x47, 0x0a, 0x46, 0x00, 0x0a, 
+  0x66, 0x4b, 0x0a, 0x46, 0x00, 0x0a, 0x66, 0x46, 0x0a, 0x47, 0x03, 0x0a, 0x46, 0x12, 0x67, 0x01, 
+  0x02, 0x6b, 0x6d, 0x80, 0x02, 0x31, 0xa6, 0x00, 0x00, 0x52, 0xaa, 0x80, 0x08, 0x39, 0xe7, 0x29, 
+  0x65, 0xff, 0xff, 0xe7, 0x1b, 0xd6, 0x9a, 0xff, 0xff, 0x7b, 0xef, 0x01, 0x02, 0x12, 0x47, 0x80, 
+  0x03, 0xde, 0xda, 0xff, 0xff, 0x73, 0x8e, 0x18, 0xc3, 0x42, 0x18, 0xe3, 0x03, 0x31, 0x85, 0xd6, 
+  0xba, 0xff, 0xdf, 0x39, 0xe7, 0x81, 0x01, 0x01, 0xc6, 0x09, 0xc7, 0x80, 0x0d, 0x12, 0xa7, 0x12, 
+  0x46, 0x1a, 0xa7, 0x12, 0x45, 0x1a, 0x87, 0x00, 0xa1, 0x4a, 0x69, 0x94, 0x92, 0x19, 0x24, 0x12, 
+  0x47, 0x00, 0xa1, 0xb5, 0x96, 0xff, 0xff, 0x18, 0xe3, 0x80, 0x02, 0x09, 0xc6, 0x00, 0xc2, 0x00, 
+  0x61, 0x41, 0x00, 0xc2, 0x0f, 0x00, 0x00, 0xe6, 0xfb, 0xde, 0xda, 0x08, 0xc2, 0x00, 0xc2, 0x7b, 
+  0xce, 0xff, 0xff, 0x31, 0xa6, 0x01, 0x43, 0x12, 0xa7, 0x23, 0x28, 0x1a, 0xc7, 0x01, 0xc6, 0x09, 
+  0xc6, 0x09, 0xe7, 0x0a, 0x07, 0x80, 0x1c, 0x10, 0xc3, 0xf7, 0x9e, 0xc5, 0xf7, 0x00, 0xc3, 0x0a, 
+  0x28, 0x0a, 0x07, 0x01, 0x44, 0x21, 0x44, 0xff, 0xff, 0x8c, 0x50, 0x01, 0x02, 0x12, 0xc7, 0x01, 
+  0x84, 0x01, 0x64, 0x00, 0x00, 0xce, 0x38, 0xef, 0x7d, 0x00, 0x00, 0x00, 0x81, 0x09, 0xe5, 0x01, 
+  0x43, 0x63, 0x0c, 0xff, 0xff, 0xce, 0x79, 0xbd, 0xb6, 0x18, 0xc3, 0x8c, 0x51, 0xde, 0xda, 0xce, 
+  0x58, 0x41, 0xce, 0x78, 0x41, 0xce, 0x79, 0x04, 0xde, 0xdb, 0x83, 0xef, 0x00, 0x00, 0xef, 0x7d, 
+  0xd6, 0x99, 0x81, 0x01, 0x01, 0xe7, 0x09, 0xe7, 0x80, 0x00, 0x8c, 0x51, 0x81, 0x03, 0x01, 0x65, 
+  0x01, 0x85, 0x31, 0xc7, 0xff, 0xff, 0x80, 0x01, 0x29, 0x44, 0xff, 0xff, 0x81, 0x06, 0x0a, 0x28, 
+  0x00, 0xa2, 0xb5, 0xb6, 0xff, 0xdf, 0x5a, 0xeb, 0x00, 0x00, 0x00, 0x61, 0x41, 0x00, 0x81, 0x06, 
+  0x08, 0xa2, 0xa5, 0x34, 0xff, 0xdf, 0x5a, 0xeb, 0x00, 0xe3, 0x0a, 0x07, 0x09, 0xc6, 0x85, 0x00, 
+  0x0a, 0x07, 0x41, 0x09, 0xe7, 0x80, 0x41, 0x01, 0xc6, 0x07, 0x09, 0xe7, 0x01, 0xe6, 0x01, 0xa5, 
+  0x12, 0x27, 0x1a, 0x89, 0x01, 0xe6, 0x09, 0xe7, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x42, 0x01, 0xe7, 
+  0x41, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x82, 0x42, 0x09, 0xe7, 
+  0x82, 0x00, 0x0a, 0x07, 0x82, 0x00, 0x0a, 0x07, 0x80, 0x00, 0x0a, 0x07, 0x0e, 0x01, 0x85, 0x12, 
+  0x67, 0x1a, 0x87, 0x1a, 0x27, 0x3a, 0xca, 0x95, 0x95, 0xd7, 0x5d, 0xce, 0xfb, 0xd7, 0x1c, 0xce, 
+  0xfc, 0xad, 0xf7, 0x64, 0x10, 0x01, 0xa5, 0x01, 0xc6, 0x12, 0x27, 0x44, 0x23, 0x08, 0x43, 0x1b, 
+  0x08, 0x49, 0x1b, 0x28, 0x43, 0x1b, 0x08, 0x44, 0x1b, 0x28, 0x45, 0x1b, 0x08, 0x01, 0x23, 0x49, 
+  0x09, 0xa3, 0x81, 0x00, 0x31, 0x86, 0x85, 0x01, 0xd6, 0xda, 0xc6, 0x17, 0x81, 0x04, 0x00, 0xa1, 
+  0x12, 0x67, 0x09, 0x03, 0x31, 0x65, 0xbd, 0xd7, 0x45, 0xff, 0xff, 0x03, 0xe7, 0x3c, 0x5a, 0xeb, 
+  0x00, 0x61, 0x09, 0xc6, 0x41, 0x01, 0xe6, 0x1b, 0x09, 0xe6, 0x01, 0xa5, 0x1a, 0xa7, 0x11, 0xe5, 
+  0x09, 0xc4, 0x09, 0xe4, 0x1a, 0xa7, 0x00, 0x40, 0x94, 0xb2, 0xff, 0xff, 0x29, 0x86, 0x01, 0x43, 
+  0x00, 0x81, 0xce, 0x59, 0xad, 0x54, 0x00, 0x00, 0x01, 0x03, 0x09, 0xa6, 0x01, 0x24, 0x01, 0x03, 
+  0x01, 0x64, 0x01, 0x85, 0x00, 0x81, 0xe7, 0x3c, 0xde, 0xfb, 0x11, 0x03, 0x01, 0x23, 0x7b, 0xef, 
+  0x80, 0x04, 0x21, 0x24, 0x00, 0xe1, 0x1a, 0x86, 0x1a, 0xa7, 0x09, 0xc6, 0x41, 0x09, 0xe6, 0x81, 
+  0x00, 0x09, 0xe6, 0x80, 0x03, 0xf7, 0xbd, 0xbd, 0xf7, 0x00, 0xa2, 0x0a, 0x48, 0x80, 0x00, 0x01, 
+  0x64, 0x82, 0x07, 0x00, 0x40, 0x0a, 0x06, 0x12, 0x67, 0x00, 0xc2, 0x52, 0xaa, 0xef, 0x7d, 0xff, 
+  0xff, 0x94, 0x71, 0x80, 0x01, 0x1a, 0xa8, 0x09, 0xa4, 0x81, 0x08, 0xe7, 0x3c, 0xde, 0xfb, 0x29, 
+  0x24, 0x73, 0x8d, 0xb5, 0x95, 0xad, 0x54, 0x9c, 0xf3, 0xa5, 0x13, 0xad, 0x54, 0x41, 0xb5, 0xb6, 
+  0x01, 0x73, 0x8e, 0x00, 0x20, 0x81, 0x01, 0x00, 0xa2, 0x09, 0xe6, 0x80, 0x02, 0x0a, 0x07, 0x00, 
+  0x61, 0x94, 0xb2, 0x80, 0x03, 0x39, 0xc7, 0x00, 0x61, 0x00, 0x20, 0x21, 0x45, 0x83, 0x11, 0x73, 
+  0xae, 0x00, 0x82, 0x09, 0xe7, 0x10, 0xe3, 0xf7, 0x9e, 0xce, 0x79, 0x00, 0x00, 0x09, 0x85, 0x0a, 
+  0x26, 0x0a, 0x47, 0x12, 0x88, 0x01, 0x44, 0x29, 0x65, 0xff, 0xff, 0x8c, 0x71, 0x00, 0x81, 0x01, 
+  0xe6, 0x01, 0xa6, 0x48, 0x01, 0xc6, 0x42, 0x01, 0xa6, 0x04, 0x01, 0xa5, 0x01, 0xc6, 0x01, 0xe6, 
+  0x01, 0xc6, 0x01, 0xa6, 0x80, 0x4d, 0x01, 0xc6, 0x00, 0x01, 0xc5, 0x42, 0x01, 0xc6, 0x00, 0x01, 
+  0xc5, 0x49, 0x01, 0xc6, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x06, 0x12, 0x47, 0x1a, 0xa7, 0x01, 0xc5, 
+  0x74, 0x91, 0xdf, 0xbe, 0xcf, 0x1c, 0xce, 0xfc, 0x80, 0x02, 0xdf, 0x5d, 0x84, 0xd3, 0x01, 0x85, 
+  0x41, 0x01, 0xe6, 0x03, 0x0a, 0x67, 0x22, 0xc8, 0x0a, 0x06, 0x01, 0xc5, 0x42, 0x01, 0xe6, 0x4d, 
+  0x01, 0xe5, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xe5, 0x41, 0x01, 0xe6, 0x44, 0x01, 0xe5, 0x41, 0x01, 
+  0xe6, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xe6, 0x01, 0x0a, 0x27, 0x00, 0xe2, 0x81, 0x02, 0x52, 0x8a, 
+  0x29, 0x44, 0x73, 0xae, 0x80, 0x01, 0x42, 0x07, 0x29, 0x85, 0x80, 0x01, 0x6b, 0x4d, 0x10, 0x82, 
+  0x80, 0x03, 0x7b, 0xcf, 0x00, 0x61, 0x09, 0x24, 0x00, 0x41, 0x41, 0x00, 0x00, 0x02, 0x42, 0x28, 
+  0x4a, 0x69, 0x4a, 0x49, 0x41, 0x4a, 0x69, 0x07, 0x52, 0x8a, 0x18, 0xe3, 0x00, 0x00, 0x00, 0x41, 
+  0x00, 0x61, 0x09, 0x85, 0x01, 0xc6, 0x09, 0xc6, 0x80, 0x10, 0x09, 0xa5, 0x21, 0x64, 0x31, 0x86, 
+  0x31, 0xa6, 0x39, 0xe7, 0x29, 0x65, 0xa5, 0x34, 0xff, 0xbe, 0x52, 0xaa, 0x31, 0x86, 0x39, 0xc7, 
+  0x52, 0x89, 0x39, 0xe7, 0x31, 0x86, 0x18, 0xe3, 0x00, 0xa2, 0x31, 0x86, 0x41, 0x42, 0x08, 0x03, 
+  0x42, 0x48, 0x4a, 0x48, 0xef, 0x5d, 0xde, 0xdb, 0x80, 0x00, 0x00, 0xc2, 0x81, 0x03, 0x52, 0xaa, 
+  0x31, 0x86, 0x19, 0x03, 0x01, 0x44, 0x80, 0x00, 0x09, 0xe7, 0x80, 0x08, 0x01, 0xc6, 0x0a, 0x27, 
+  0x12, 0x06, 0x21, 0x45, 0xf7, 0xbe, 0xce, 0x38, 0x08, 0xa2, 0x09, 0xe7, 0x0a, 0x27, 0x80, 0x00, 
+  0x29, 0x65, 0x81, 0x0b, 0x00, 0x20, 0x09, 0x64, 0x00, 0x00, 0x52, 0x69, 0xff, 0xff, 0xe7, 0x3c, 
+  0xd6, 0x79, 0xff, 0xff, 0x8c, 0x51, 0x00, 0x61, 0x00, 0xc2, 0x5a, 0xeb, 0x80, 0x03, 0x63, 0x2c, 
+  0x00, 0x00, 0x08, 0xe3, 0x00, 0xa2, 0x41, 0x00, 0x00, 0x41, 0x52, 0x8a, 0x0a, 0x39, 0xc7, 0x00, 
+  0x00, 0x00, 0x20, 0x01, 0x23, 0x08, 0xe3, 0xef, 0x5d, 0xce, 0x79, 0x00, 0x00, 0x00, 0x40, 0x01, 
+  0x44, 0x0a, 0x27, 0x80, 0x00, 0x9c, 0xd2, 0x80, 0x03, 0x31, 0x86, 0x4a, 0x49, 0xbd, 0xb6, 0xbd, 
+  0xd6, 0x80, 0x01, 0x73, 0x8d, 0x29, 0x45, 0x80, 0x0c, 0x7b, 0xae, 0x00, 0xa2, 0x09, 0xe6, 0x08, 
+  0xa2, 0xef, 0x5c, 0xde, 0xfb, 0x08, 0x61, 0x00, 0x61, 0x01, 0x85, 0x01, 0xc6, 0x09, 0xe6, 0x00, 
+  0x81, 0x52, 0x89, 0x80, 0x02, 0x8c, 0x50, 0x00, 0xe2, 0x1a, 0xc8, 0x4f, 0x12, 0x87, 0x41, 0x12, 
+  0xa8, 0x01, 0x12, 0xa7, 0x12, 0xa8, 0x43, 0x12, 0xa7, 0x43, 0x12, 0x87, 0x41, 0x12, 0xa7, 0x42, 
+  0x12, 0x87, 0x42, 0x12, 0xa7, 0x41, 0x12, 0x87, 0x00, 0x12, 0xa7, 0x4a, 0x12, 0x87, 0x0e, 0x02, 
+  0x25, 0x09, 0xe6, 0x8c, 0xf3, 0xd7, 0x5d, 0xc6, 0xdb, 0xce, 0xdb, 0xce, 0xfb, 0xd7, 0x3c, 0x7c, 
+  0x91, 0x09, 0xc6, 0x0a, 0x27, 0x02, 0x06, 0x12, 0x87, 0x1a, 0xe8, 0x0a, 0x06, 0x41, 0x01, 0xe6, 
+  0x41, 0x01, 0xc6, 0x80, 0x42, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x47, 0x09, 0xc6, 
+  0x41, 0x09, 0xe6, 0x07, 0x09, 0xe7, 0x09, 0xe6, 0x09, 0xe7, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0xe6, 
+  0x09, 0xe7, 0x01, 0xe7, 0x44, 0x09, 0xe7, 0x00, 0x0a, 0x28, 0x82, 0x43, 0xff, 0xff, 0x01, 0x42, 
+  0x28, 0x31, 0x86, 0x80, 0x01, 0x7b, 0xef, 0x18, 0xe3, 0x80, 0x03, 0x84, 0x30, 0x00, 0x00, 0x5a, 
+  0xcb, 0xce, 0x59, 0x41, 0xce, 0x79, 0x42, 0xbd, 0xf7, 0x00, 0xc6, 0x17, 0x41, 0xc6, 0x18, 0x05, 
+  0xce, 0x59, 0xd6, 0x9a, 0xce, 0x79, 0xa5, 0x14, 0x00, 0xa2, 0x09, 0xc7, 0x80, 0x02, 0x09, 0xe7, 
+  0x00, 0x81, 0x94, 0x91, 0x4b, 0xff, 0xff, 0x02, 0x84, 0x10, 0x00, 0x00, 0xd6, 0xba, 0x44, 0xff, 
+  0xff, 0x00, 0xe6, 0xfb, 0x80, 0x01, 0x00, 0xe2, 0x84, 0x10, 0x42, 0xff, 0xff, 0x03, 0x63, 0x0c, 
+  0x00, 0xa2, 0x09, 0xe7, 0x09, 0xc6, 0x41, 0x09, 0xe6, 0x02, 0x1a, 0xc8, 0x09, 0x02, 0x83, 0xef, 
+  0x41, 0xff, 0xff, 0x02, 0x5a, 0xeb, 0x00, 0xe2, 0x0a, 0x48, 0x80, 0x00, 0x29, 0x85, 0x81, 0x0c, 
+  0x00, 0x00, 0x08, 0xa2, 0x84, 0x0f, 0xff, 0xff, 0xe7, 0x1b, 0x31, 0x86, 0x08, 0x41, 0xb5, 0xb6, 
+  0xff, 0xff, 0xa5, 0x34, 0x00, 0x20, 0x52, 0x8a, 0xff, 0xdf, 0x80, 0x04, 0x00, 0x81, 0x0a, 0x07, 
+  0x01, 0x44, 0x21, 0x24, 0xd6, 0x9a, 0x42, 0xff, 0xff, 0x02, 0xa5, 0x13, 0x08, 0xa2, 0x09, 0xc6, 
+  0x80, 0x07, 0xe6, 0xfb, 0xf7, 0x9d, 0xb5, 0x95, 0xa5, 0x34, 0x11, 0x03, 0x01, 0xa6, 0x19, 0x65, 
+  0xde, 0xfb, 0x80, 0x03, 0x8c, 0x51, 0x5a, 0xcb, 0xde, 0xdb, 0xd6, 0x99, 0x84, 0x0f, 0x00, 0x81, 
+  0x0a, 0x07, 0x00, 0x81, 0x84, 0x0f, 0xff, 0xff, 0xce, 0x58, 0x31, 0x86, 0x10, 0xa2, 0x10, 0xe3, 
+  0x10, 0xc3, 0x52, 0x89, 0xef, 0x5d, 0xef, 0x7d, 0x41, 0xe7, 0x09, 0x84, 0x1b, 0x08, 0x48, 0x1a, 
+  0xe8, 0x41, 0x1a, 0xc8, 0x55, 0x1a, 0xe8, 0x00, 0x1b, 0x08, 0x4f, 0x1a, 0xe8, 0x08, 0x84, 0xf3, 
+  0x95, 0x75, 0xdf, 0x7d, 0xd7, 0x1c, 0xce, 0xfb, 0xcf, 0x1c, 0xd7, 0x3c, 0x6c, 0x30, 0x01, 0x44, 
+  0x41, 0x01, 0xc6, 0x04, 0x12, 0x47, 0x22, 0xc8, 0x0a, 0x47, 0x01, 0xe6, 0x09, 0xe7, 0x42, 0x01, 
+  0xe6, 0x01, 0x09, 0xe6, 0x01, 0xe6, 0x80, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x81, 0x01, 0x09, 0xe6, 
+  0x01, 0xc6, 0x41, 0x09, 0xe6, 0x44, 0x01, 0xe6, 0x41, 0x09, 0xe7, 0x00, 0x01, 0xe7, 0x82, 0x00, 
+  0x01, 0xe7, 0x81, 0x41, 0x01, 0xe7, 0x82, 0x03, 0x0a, 0x07, 0x01, 0x85, 0x19, 0x04, 0x5a, 0xca, 
+  0x41, 0x4a, 0x48, 0x0b, 0x5a, 0xeb, 0x63, 0x0c, 0x10, 0xc2, 0x29, 0x65, 0xde, 0xba, 0x63, 0x0c, 
+  0x18, 0xc2, 0xd6, 0xba, 0x6b, 0x4c, 0x00, 0x20, 0x52, 0x8a, 0xbd, 0xd7, 0x42, 0xad, 0x54, 0x44, 
+  0xad, 0x75, 0x03, 0xad, 0x54, 0xa5, 0x34, 0xb5, 0xb6, 0x94, 0x71, 0x80, 0x42, 0x09, 0xe7, 0x03, 
+  0x09, 0xa5, 0x31, 0xc6, 0x5a, 0xeb, 0x52, 0x89, 0x41, 0x52, 0xaa, 0x41, 0x5a, 0xca, 0x01, 0x52, 
+  0xaa, 0x4a, 0x89, 0x41, 0x4a, 0x48, 0x03, 0x4a, 0x69, 0x5a, 0xcb, 0x29, 0x65, 0x00, 0x41, 0x80, 
+  0x08, 0xe7, 0x3c, 0x4a, 0x69, 0x4a, 0x48, 0x42, 0x28, 0x4a, 0x49, 0x42, 0x07, 0x09, 0x24, 0x01, 
+  0x03, 0x84, 0x30, 0x80, 0x05, 0x73, 0xce, 0x5a, 0xcb, 0x29, 0x65, 0x01, 0x44, 0x09, 0xc6, 0x09, 
+  0xc7, 0x80, 0x03, 0x12, 0x87, 0x1a, 0x66, 0x19, 0x03, 0xde, 0xda, 0x81, 0x02, 0xb5, 0x95, 0x10, 
+  0xe2, 0x09, 0xa5, 0x82, 0x0e, 0x8c, 0x71, 0x00, 0x20, 0x10, 0xa2, 0xd6, 0x99, 0xce, 0x79, 0x29, 
+  0x65, 0x00, 0xe3, 0x11, 0xa6, 0x18, 0xe3, 0x9c, 0xd3, 0xbd, 0xf7, 0x08, 0x41, 0x52, 0xaa, 0xff, 
+  0xff, 0x6b, 0x4d, 0x81, 0x11, 0x10, 0xe3, 0xce, 0x79, 0xff, 0xff, 0x63, 0x0c, 0x18, 0xc3, 0x8c, 
+  0x71, 0xff, 0xff, 0x94, 0x71, 0x00, 0x61, 0x08, 0xc3, 0xde, 0xfa, 0xff, 0xde, 0xe7, 0x3c, 0xd6, 
+  0x79, 0x10, 0xc3, 0x00, 0xe3, 0x31, 0xe7, 0xff, 0xdf, 0x80, 0x03, 0xe7, 0x1c, 0x10, 0xa2, 0x00, 
+  0x00, 0x21, 0x24, 0x86, 0x02, 0x09, 0xa5, 0x00, 0x40, 0x8c, 0x50, 0x41, 0xff, 0xff, 0x0a, 0xf7, 
+  0xbe, 0xff, 0xde, 0xf7, 0xbe, 0xff, 0xff, 0xef, 0x7d, 0x42, 0x08, 0x00, 0x20, 0x01, 0x65, 0x01, 
+  0x85, 0x01, 0xa5, 0x01, 0xc5, 0x41, 0x01, 0xa5, 0x00, 0x01, 0xa6, 0x42, 0x01, 0xc6, 0x43, 0x01, 
+  0xa5, 0x02, 0x01, 0xc6, 0x01, 0xa6, 0x01, 0xc5, 0x57, 0x01, 0xa5, 0x49, 0x01, 0xc6, 0x00, 0x01, 
+  0xc5, 0x08, 0xe7, 0xbe, 0xdf, 0x7d, 0xce, 0xdb, 0xce, 0xfb, 0xe7, 0x9e, 0x7c, 0xd2, 0x32, 0x89, 
+  0x01, 0x85, 0x01, 0xa6, 0x80, 0x04, 0x0a, 0x06, 0x1a, 0xc8, 0x0a, 0x27, 0x01, 0xe6, 0x02, 0x06, 
+  0x47, 0x01, 0xe6, 0x44, 0x01, 0xc6, 0x55, 0x01, 0xe6, 0x02, 0x01, 0xc6, 0x01, 0x03, 0x00, 0x00, 
+  0x41, 0x39, 0xc6, 0x0c, 0x00, 0x00, 0x01, 0x03, 0x09, 0xa5, 0x11, 0x44, 0x10, 0xe3, 0x08, 0x82, 
+  0x10, 0xa2, 0x52, 0xaa, 0x29, 0x24, 0x00, 0xa2, 0x00, 0xe3, 0x00, 0x00, 0x4a, 0x48, 0x45, 0x5a, 
+  0xeb, 0x06, 0x5a, 0xca, 0x52, 0xaa, 0x4a, 0x49, 0x00, 0x00, 0x00, 0x20, 0x09, 0x65, 0x09, 0xe6, 
+  0x80, 0x04, 0x01, 0xc6, 0x1a, 0xe8, 0x0a, 0x05, 0x00, 0x00, 0x8c, 0x71, 0x44, 0xa5, 0x34, 0x0e, 
+  0x9d, 0x13, 0x9c, 0xf2, 0x9c, 0xd2, 0x7b, 0xcf, 0x00, 0x00, 0x00, 0xe3, 0x00, 0xc2, 0xde, 0xda, 
+  0xde, 0xdb, 0x00, 0x40, 0x09, 0xa4, 0x00, 0xe2, 0x00, 0x81, 0x00, 0xc2, 0x0a, 0x06, 0x82, 0x02, 
+  0x21, 0x44, 0x00, 0x20, 0x01, 0x44, 0x41, 0x09, 0xc6, 0x0c, 0x01, 0xc6, 0x12, 0x66, 0x22, 0xe7, 
+  0x00, 0x60, 0x52, 0x69, 0xff, 0xff, 0x7b, 0xce, 0x8c, 0x71, 0xff, 0xff, 0x42, 0x08, 0x00, 0xa1, 
+  0x1a, 0x67, 0x29, 0xa6, 0x80, 0x03, 0x94, 0x91, 0x00, 0xa1, 0x09, 0x44, 0x08, 0x61, 0x41, 0x00, 
+  0x00, 0x02, 0x00, 0x82, 0x00, 0xc2, 0x00, 0x20, 0x42, 0x00, 0x00, 0x19, 0x10, 0xa2, 0x63, 0x0c, 
+  0x21, 0x24, 0x01, 0x03, 0x01, 0xe6, 0x21, 0x44, 0xff, 0xff, 0xc6, 0x17, 0x00, 0x20, 0x00, 0xe3, 
+  0x08, 0x82, 0xef, 0x7c, 0xc6, 0x17, 0x00, 0x20, 0x08, 0x82, 0xe7, 0x3b, 0xce, 0x78, 0x00, 0x20, 
+  0x00, 0x81, 0x09, 0x03, 0x00, 0x00, 0x8c, 0x50, 0xf7, 0xbe, 0xc6, 0x18, 0xff, 0xff, 0x63, 0x2c, 
+  0x80, 0x00, 0x31, 0xa6, 0x80, 0x01, 0x73, 0xae, 0x29, 0x65, 0x80, 0x00, 0x7b, 0xce, 0x80, 0x0e, 
+  0x09, 0xe7, 0x01, 0xe7, 0x09, 0xa5, 0x00, 0x20, 0x42, 0x28, 0x84, 0x0f, 0x94, 0x92, 0x94, 0x91, 
+  0x94, 0x92, 0x7b, 0xef, 0x31, 0x65, 0x00, 0xa1, 0x22, 0xa8, 0x1a, 0x87, 0x1a, 0xc8, 0x51, 0x1a, 
+  0xe8, 0x41, 0x1b, 0x08, 0x47, 0x1a, 0xe8, 0x00, 0x1a, 0xc8, 0x44, 0x1a, 0xe8, 0x00, 0x1b, 0x08, 
+  0x47, 0x1a, 0xe8, 0x44, 0x1a, 0xe9, 0x41, 0x22, 0xe9, 0x41, 0xce, 0xfb, 0x09, 0xcf, 0x1c, 0xdf, 
+  0x7d, 0x8d, 0x13, 0x11, 0xc6, 0x01, 0x44, 0x09, 0xc6, 0x01, 0xc6, 0x0a, 0x07, 0x1a, 0xa8, 0x0a, 
+  0x27, 0x41, 0x01, 0xe6, 0x80, 0x42, 0x1b, 0x08, 0x41, 0x1b, 0x28, 0x01, 0x1b, 0x08, 0x1b, 0x28, 
+  0x47, 0x1b, 0x08, 0x42, 0x1b, 0x28, 0x41, 0x1b, 0x08, 0x00, 0x1b, 0x28, 0x48, 0x1b, 0x08, 0x42, 
+  0x1b, 0x28, 0x41, 0x1b, 0x08, 0x41, 0x1a, 0xc8, 0x00, 0x00, 0xa1, 0x41, 0xe7, 0x1b, 0x80, 0x41, 
+  0x00, 0x81, 0x41, 0x00, 0x61, 0x0b, 0x00, 0x00, 0x29, 0x45, 0xff, 0xff, 0x84, 0x30, 0x00, 0x61, 
+  0x09, 0xe6, 0x08, 0xe3, 0xce, 0x38, 0xff, 0xdf, 0xf7, 0xbe, 0xf7, 0xde, 0xf7, 0xbe, 0x41, 0xf7, 
+  0xbd, 0x04, 0xf7, 0x9d, 0xff, 0xff, 0xff, 0xde, 0x19, 0x04, 0x01, 0x65, 0x41, 0x09, 0xc6, 0x80, 
+  0x17, 0x01, 0xe6, 0x13, 0x08, 0x1b, 0x07, 0x10, 0xe3, 0xad, 0x75, 0xce, 0x58, 0xc6, 0x38, 0xce, 
+  0x59, 0xce, 0x79, 0xce, 0x58, 0xc6, 0x37, 0xc6, 0x17, 0xff, 0xde, 0xef, 0x5c, 0x10, 0xc3, 0x09, 
+  0xe6, 0x00, 0xe3, 0xde, 0xdb, 0xde, 0xba, 0x09, 0x02, 0x12, 0x88, 0x01, 0xa5, 0x09, 0xa5, 0x09, 
+  0xc6, 0x80, 0x01, 0x00, 0xe2, 0x84, 0x10, 0x80, 0x0c, 0x31, 0xe7, 0x01, 0x64, 0x0a, 0x07, 0x09, 
+  0xe7, 0x09, 0xe6, 0x12, 0x67, 0x1a, 0x87, 0x09, 0xa4, 0x21, 0x04, 0xc6, 0x17, 0xff, 0xde, 0x10, 
+  0xa2, 0x39, 0xc6, 0x80, 0x03, 0xad, 0x54, 0x10, 0xe2, 0x09, 0xa4, 0x31, 0xa6, 0x81, 0x0d, 0x00, 
+  0xa2, 0x0a, 0x06, 0x11, 0x03, 0x9c, 0xf3, 0xb5, 0x95, 0xad, 0x54, 0xad, 0x55, 0xb5, 0x75, 0xb5, 
+  0x95, 0xad, 0x54, 0xa5, 0x34, 0x9c, 0xf3, 0x9c, 0xd2, 0x42, 0x07, 0x80, 0x08, 0x02, 0x06, 0x19, 
+  0x44, 0xff, 0xdf, 0xbd, 0xf7, 0x00, 0xa2, 0x09, 0xe6, 0x08, 0x61, 0xef, 0x5b, 0xbd, 0xf6, 0x80, 
+  0x00, 0x00, 0x82, 0x81, 0x06, 0x00, 0x61, 0x0a, 0x07, 0x09, 0x85, 0x08, 0x41, 0xd6, 0x99, 0xc6, 
+  0x38, 0x21, 0x24, 0x80, 0x01, 0xb5, 0x95, 0x08, 0x61, 0x84, 0x00, 0x7b, 0xae, 0x81, 0x0e, 0x09, 
+  0xe6, 0x01, 0xe6, 0x19, 0x44, 0xb5, 0x96, 0x6b, 0x4d, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x8c, 
+  0x71, 0x63, 0x2c, 0x08, 0xc2, 0x12, 0x26, 0x0a, 0x26, 0x0a, 0x46, 0x0a, 0x66, 0x42, 0x0a, 0x67, 
+  0x43, 0x0a, 0x66, 0x00, 0x12, 0x67, 0x41, 0x12, 0x66, 0x01, 0x0a, 0x66, 0x12, 0x66, 0x41, 0x12, 
+  0x86, 0x00, 0x12, 0x66, 0x45, 0x0a, 0x66, 0x43, 0x0a, 0x67, 0x00, 0x0a, 0x66, 0x41, 0x0a, 0x67, 
+  0x01, 0x0a, 0x66, 0x0a, 0x67, 0x41, 0x0a, 0x66, 0x00, 0x0a, 0x67, 0x42, 0x12, 0x67, 0x00, 0x0a, 
+  0x66, 0x44, 0x0a, 0x67, 0x01, 0x12, 0x67, 0x0a, 0x67, 0x43, 0x12, 0x67, 0x00, 0x12, 0x47, 0x0a, 
+  0xd7, 0x1c, 0xcf, 0x1c, 0xd7, 0x1c, 0x95, 0x54, 0x09, 0xc6, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xc6, 
+  0x0a, 0x06, 0x1a, 0x87, 0x09, 0xe6, 0x41, 0x01, 0xc6, 0x80, 0x02, 0x1a, 0xc8, 0x12, 0x86, 0x0a, 
+  0x46, 0x41, 0x0a, 0x66, 0x4a, 0x0a, 0x46, 0x43, 0x0a, 0x66, 0x4f, 0x0a, 0x46, 0x41, 0x0a, 0x26, 
+  0x80, 0x02, 0xce, 0x58, 0xff, 0xdf, 0xce, 0x79, 0x41, 0xce, 0x59, 0x03, 0xce, 0x58, 0xce, 0x38, 
+  0xc6, 0x37, 0xd6, 0x99, 0x80, 0x0e, 0x84, 0x0f, 0x00, 0x81, 0x0a, 0x06, 0x00, 0xc2, 0x31, 0x65, 
+  0x39, 0xe7, 0x31, 0xa6, 0x31, 0x86, 0x29, 0x65, 0x29, 0x45, 0x29, 0x65, 0x29, 0x45, 0xbd, 0xf6, 
+  0xef, 0x7c, 0x10, 0xe3, 0x82, 0x02, 0x09, 0xe6, 0x02, 0x06, 0x13, 0x07, 0x80, 0x01, 0x08, 0xe2, 
+  0x29, 0x65, 0x41, 0x31, 0x85, 0x41, 0x31, 0xa6, 0x05, 0x31, 0x85, 0x31, 0x86, 0x29, 0x65, 0xc6, 
+  0x17, 0xe7, 0x3c, 0x08, 0xc3, 0x80, 0x00, 0x00, 0xe2, 0x41, 0xd6, 0xba, 0x07, 0x10, 0xa2, 0x10, 
+  0xe3, 0x10, 0xc3, 0x10, 0xc2, 0x08, 0xa2, 0x19, 0x04, 0x00, 0x40, 0x7b, 0xef, 0x80, 0x01, 0x31, 
+  0xa6, 0x01, 0x44, 0x41, 0x0a, 0x07, 0x06, 0x12, 0x67, 0x1a, 0x87, 0x09, 0xc6, 0x00, 0x61, 0x4a, 
+  0x69, 0xff, 0xff, 0xbd, 0xd6, 0x41, 0x00, 0x20, 0x04, 0xbd, 0xf7, 0xff, 0xff, 0x39, 0xe7, 0x00, 
+  0x40, 0x29, 0x86, 0x80, 0x00, 0x94, 0x71, 0x80, 0x02, 0x0a, 0x67, 0x21, 0x85, 0xe6, 0xfb, 0x42, 
+  0xf7, 0x9d, 0x12, 0xf7, 0x9e, 0xf7, 0x9d, 0xef, 0x7c, 0xef, 0x5c, 0xf7, 0x9d, 0xff, 0xff, 0x73, 
+  0xae, 0x01, 0x23, 0x0a, 0x47, 0x21, 0x44, 0xff, 0xff, 0xc6, 0x18, 0x00, 0x40, 0x00, 0xa2, 0x10, 
+  0x82, 0xef, 0x7c, 0xce, 0x78, 0x00, 0x61, 0x08, 0xc2, 0x80, 0x00, 0xce, 0x58, 0x81, 0x08, 0x00, 
+  0xa2, 0x73, 0xae, 0xff, 0xff, 0x8c, 0x51, 0x00, 0x00, 0xce, 0x79, 0xff, 0xff, 0x31, 0xa6, 0x29, 
+  0x65, 0x83, 0x0f, 0x73, 0xae, 0x00, 0xa1, 0x0a, 0x07, 0x01, 0xe6, 0x01, 0x85, 0x19, 0x24, 0xff, 
+  0xff, 0xad, 0x54, 0x00, 0x61, 0x09, 0xc5, 0x10, 0xc2, 0xff, 0xff, 0xb5, 0xb6, 0x00, 0x00, 0x01, 
+  0x64, 0x01, 0x85, 0x41, 0x01, 0xe6, 0x00, 0x02, 0x06, 0x41, 0x01, 0xe6, 0x42, 0x01, 0xe5, 0x00, 
+  0x01, 0xe6, 0x45, 0x01, 0xe5, 0x49, 0x02, 0x05, 0x43, 0x01, 0xe5, 0x00, 0x02, 0x05, 0x45, 0x01, 
+  0xe5, 0x00, 0x02, 0x05, 0x41, 0x01, 0xe5, 0x41, 0x01, 0xe6, 0x41, 0x01, 0xe5, 0x00, 0x02, 0x06, 
+  0x42, 0x01, 0xe6, 0x42, 0x02, 0x06, 0x00, 0x01, 0xe6, 0x09, 0xdf, 0x7d, 0x95, 0x54, 0x11, 0xc6, 
+  0x11, 0xe6, 0x01, 0xc6, 0x09, 0xe7, 0x01, 0xe6, 0x12, 0x46, 0x22, 0xa8, 0x09, 0xe6, 0x41, 0x01, 
+  0xc6, 0x03, 0x0a, 0x26, 0x22, 0xe8, 0x12, 0x47, 0x01, 0xc5, 0x4e, 0x01, 0xc6, 0x46, 0x01, 0xe6, 
+  0x41, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x44, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x41, 
+  0x01, 0xc6, 0x06, 0x00, 0xa2, 0xd6, 0x79, 0xf7, 0x9e, 0xb5, 0xb6, 0xbd, 0xd7, 0xb5, 0xd6, 0xb5, 
+  0xb6, 0x41, 0xb5, 0x95, 0x00, 0xbd, 0xd6, 0x80, 0x00, 0x84, 0x10, 0x80, 0x03, 0x09, 0xe7, 0x00, 
+  0x82, 0xce, 0x38, 0xff, 0xdf, 0x41, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x41, 0xff, 0xff, 0x03, 0xff, 
+  0xde, 0xff, 0xff, 0xff, 0xbe, 0x18, 0xe3, 0x80, 0x03, 0x09, 0xe7, 0x09, 0xe6, 0x09, 0xe7, 0x01, 
+  0xe6, 0x41, 0x12, 0xe7, 0x03, 0x11, 0x23, 0xef, 0x5c, 0xff, 0xff, 0xff, 0xfe, 0x45, 0xff, 0xff, 
+  0x08, 0xde, 0xfb, 0x11, 0x03, 0x01, 0xe7, 0x00, 0xc2, 0xde, 0xda, 0xff, 0xff, 0xf7, 0xbd, 0xff, 
+  0xde, 0xff, 0xdf, 0x41, 0xff, 0xbe, 0x02, 0xd6, 0xba, 0x00, 0x20, 0x73, 0xae, 0x80, 0x11, 0x29, 
+  0x86, 0x01, 0x23, 0x01, 0xe7, 0x1a, 0xc8, 0x22, 0xc8, 0x09, 0xe6, 0x01, 0x64, 0x29, 0x65, 0xf7, 
+  0x9d, 0xff, 0xde, 0x39, 0xe7, 0x00, 0xc2, 0x09, 0x02, 0x4a, 0x69, 0xf7, 0x9e, 0xff, 0xde, 0x39, 
+  0xc7, 0x21, 0x04, 0x80, 0x04, 0x8c, 0x51, 0x01, 0x63, 0x2b, 0xaa, 0x19, 0xc5, 0x08, 0x82, 0x41, 
+  0x08, 0x81, 0x01, 0x08, 0xa2, 0x08, 0x81, 0x41, 0x08, 0x61, 0x1c, 0x00, 0x20, 0x52, 0xaa, 0xff, 
+  0xdf, 0x6b, 0x6d, 0x09, 0xe4, 0x23, 0x8a, 0x11, 0x03, 0xad, 0x34, 0xff, 0xff, 0x7b, 0xae, 0x29, 
+  0x45, 0x94, 0xb2, 0xff, 0xff, 0x73, 0x6d, 0x09, 0x43, 0x11, 0x64, 0xe7, 0x3c, 0xce, 0x38, 0x08, 
+  0xe2, 0x09, 0xe5, 0x42, 0x48, 0xff, 0xff, 0xde, 0xfb, 0x10, 0xc3, 0x00, 0xa2, 0x39, 0xc7, 0xff, 
+  0xdf, 0xe7, 0x3c, 0x42, 0x07, 0x81, 0x00, 0x29, 0x45, 0x81, 0x07, 0x09, 0x63, 0x19, 0xa5, 0x19, 
+  0x45, 0x19, 0x24, 0x29, 0x65, 0xf7, 0xbe, 0xa5, 0x34, 0x10, 0xc3, 0x41, 0x21, 0x45, 0x0b, 0xef, 
+  0x9d, 0xb5, 0x95, 0x10, 0xa2, 0x21, 0x44, 0x19, 0x64, 0x1a, 0x67, 0x23, 0x29, 0x1b, 0x08, 0x23, 
+  0x28, 0x1b, 0x29, 0x1b, 0x08, 0x23, 0x08, 0x43, 0x1b, 0x08, 0x00, 0x1b, 0x28, 0x41, 0x23, 0x29, 
+  0x42, 0x1b, 0x28, 0x41, 0x1b, 0x08, 0x41, 0x1b, 0x28, 0x41, 0x23, 0x28, 0x00, 0x23, 0x29, 0x42, 
+  0x1b, 0x28, 0x00, 0x1b, 0x08, 0x41, 0x1b, 0x28, 0x42, 0x1b, 0x08, 0x44, 0x1b, 0x28, 0x43, 0x1b, 
+  0x08, 0x01, 0x1b, 0x28, 0x23, 0x28, 0x41, 0x1b, 0x28, 0x04, 0x23, 0x28, 0x1b, 0x28, 0x23, 0x28, 
+  0x1b, 0x28, 0x23, 0x28, 0x08, 0x8d, 0x34, 0x09, 0xa5, 0x01, 0x85, 0x01, 0xc6, 0x09, 0xe7, 0x01, 
+  0xe6, 0x0a, 0x47, 0x1a, 0xe8, 0x0a, 0x06, 0x42, 0x01, 0xe6, 0x03, 0x1a, 0xc8, 0x12, 0x66, 0x01, 
+  0xc6, 0x01, 0xe6, 0x44, 0x09, 0xe6, 0x00, 0x09, 0xe7, 0x42, 0x01, 0xe6, 0x00, 0x09, 0xc6, 0x42, 
+  0x09, 0xe6, 0x00, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x00, 0x09, 0xe6, 0x41, 0x01, 
+  0xe7, 0x42, 0x09, 0xe7, 0x00, 0x09, 0xe6, 0x47, 0x09, 0xe7, 0x05, 0x01, 0xe7, 0x09, 0xe7, 0x09, 
+  0xe6, 0x00, 0x81, 0xd6, 0xba, 0xd6, 0x99, 0x45, 0x00, 0x00, 0x02, 0x18, 0xe3, 0xff, 0xdf, 0x84, 
+  0x30, 0x80, 0x06, 0x0a, 0x07, 0x00, 0xa2, 0xd6, 0x79, 0xf7, 0x9d, 0x52, 0xaa, 0x52, 0x8a, 0x5a, 
+  0xca, 0x41, 0x5a, 0xcb, 0x04, 0x52, 0x8a, 0x4a, 0x69, 0x4a, 0x28, 0x08, 0x81, 0x01, 0x85, 0x42, 
+  0x09, 0xe7, 0x01, 0x01, 0xc6, 0x12, 0xc7, 0x81, 0x02, 0xef, 0x5d, 0xce, 0x58, 0x18, 0xe3, 0x42, 
+  0x21, 0x24, 0x00, 0x29, 0x65, 0x41, 0x31, 0x86, 0x0f, 0x29, 0x45, 0x08, 0xc3, 0x0a, 0x07, 0x09, 
+  0x44, 0x7b, 0xae, 0x9c, 0xb2, 0x94, 0x91, 0x94, 0xb2, 0x9c, 0xd3, 0x9c, 0xd2, 0x9c, 0xd3, 0x52, 
+  0xaa, 0x00, 0x00, 0x7b, 0xce, 0xff, 0xdf, 0x29, 0x65, 0x80, 0x01, 0x12, 0x87, 0x1a, 0xa8, 0x41, 
+  0x0a, 0x07, 0x0b, 0x01, 0x85, 0x21, 0x65, 0xce, 0x38, 0x7b, 0xef, 0x00, 0x40, 0x1a, 0x87, 0x22, 
+  0x87, 0x00, 0x40, 0x7b, 0xae, 0xc6, 0x18, 0x29, 0x65, 0x21, 0x24, 0x81, 0x0a, 0x09, 0x83, 0x1a, 
+  0xe9, 0x0a, 0x07, 0x09, 0xc6, 0x01, 0xa5, 0x12, 0x26, 0x1a, 0x87, 0x09, 0xc5, 0x01, 0x85, 0x09, 
+  0xa6, 0x00, 0x81, 0x81, 0x05, 0x73, 0x8e, 0x01, 0x02, 0x0a, 0x68, 0x09, 0x64, 0x08, 0x41, 0xad, 
+  0x55, 0x42, 0xff, 0xff, 0x03, 0x8c, 0x50, 0x00, 0x81, 0x0a, 0x06, 0x09, 0x03, 0x81, 0x0a, 0x00, 
+  0x41, 0x00, 0xe2, 0x31, 0xa6, 0xb5, 0x96, 0x42, 0x08, 0x00, 0xc2, 0x09, 0xe6, 0x00, 0x61, 0x83, 
+  0xef, 0xbd, 0xb6, 0x39, 0xc7, 0x80, 0x07, 0x6b, 0x8d, 0x29, 0x65, 0xff, 0xdf, 0x7b, 0xef, 0x00, 
+  0x20, 0x42, 0x48, 0xff, 0xff, 0xff, 0xde, 0x49, 0xff, 0xff, 0x02, 0xd6, 0x79, 0x00, 0xc2, 0x0a, 
+  0x06, 0x42, 0x02, 0x06, 0x41, 0x09, 0xe6, 0x43, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x48, 0x02, 0x06, 
+  0x45, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x42, 0x02, 0x06, 0x00, 
+  0x0a, 0x06, 0x42, 0x01, 0xe6, 0x41, 0x0a, 0x06, 0x01, 0x01, 0xe6, 0x09, 0xe6, 0x47, 0x0a, 0x06, 
+  0x07, 0x01, 0x65, 0x01, 0xa5, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xe6, 0x12, 0x47, 0x22, 0xe8, 0x0a, 
+  0x06, 0x41, 0x01, 0xe6, 0x03, 0x0a, 0x06, 0x22, 0xe8, 0x12, 0x26, 0x01, 0xc6, 0x42, 0x01, 0xe6, 
+  0x80, 0x41, 0x09, 0xc6, 0x81, 0x00, 0x09, 0xe6, 0x81, 0x41, 0x01, 0xe7, 0x00, 0x09, 0xe7, 0x41, 
+  0x01, 0xe6, 0x41, 0x01, 0xe7, 0x00, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x01, 0x09, 0xe7, 0x01, 0xe6, 
+  0x4d, 0x09, 0xe7, 0x03, 0x01, 0xe6, 0x00, 0x82, 0xde, 0xba, 0xff, 0xff, 0x43, 0xef, 0x5c, 0x06, 
+  0xef, 0x7c, 0xef, 0x7d, 0xef, 0x9d, 0xff, 0xff, 0x94, 0x91, 0x00, 0xa2, 0x0a, 0x27, 0x80, 0x03, 
+  0xde, 0xda, 0xff, 0xff, 0xbd, 0xf7, 0xc6, 0x17, 0x41, 0xc6, 0x38, 0x06, 0xc6, 0x18, 0xc6, 0x17, 
+  0xbd, 0xd7, 0xc6, 0x18, 0x42, 0x28, 0x01, 0x24, 0x0a, 0x07, 0x85, 0x06, 0xf7, 0xbe, 0xff, 0xff, 
+  0xce, 0x99, 0xd6, 0x99, 0xce, 0x99, 0xd6, 0x99, 0xde, 0xda, 0x42, 0xde, 0xdb, 0x03, 0x31, 0xc6, 
+  0x0a, 0x26, 0x1a, 0x46, 0x00, 0x40, 0x41, 0x00, 0x00, 0x01, 0x00, 0xa0, 0x01, 0x01, 0x41, 0x00, 
+  0xe1, 0x00, 0x00, 0xe3, 0x80, 0x01, 0x83, 0xef, 0xff, 0xff, 0x80, 0x03, 0x09, 0x84, 0x22, 0xc8, 
+  0x0a, 0x06, 0x09, 0xe7, 0x41, 0x0a, 0x07, 0x0a, 0x01, 0x44, 0x00, 0x40, 0x00, 0x61, 0x1a, 0x66, 
+  0x1a, 0x67, 0x09, 0xc6, 0x09, 0xa5, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61, 0x31, 0xa6, 0x80, 0x02, 
+  0x9c, 0xd3, 0x00, 0xc2, 0x0a, 0x48, 0x41, 0x0a, 0x07, 0x22, 0x12, 0x87, 0x23, 0x08, 0x0a, 0x07, 
+  0x09, 0xe6, 0x09, 0xe7, 0x0a, 0x28, 0x01, 0x03, 0x63, 0x0c, 0xff, 0xff, 0x7b, 0xef, 0x00, 0xe2, 
+  0x0a, 0x27, 0x09, 0xc6, 0x00, 0xc3, 0x08, 0x41, 0x4a, 0x48, 0x63, 0x2c, 0x52, 0x8a, 0x00, 0x41, 
+  0x09, 0xc6, 0x0a, 0x07, 0x08, 0xc3, 0xff, 0xbe, 0xde, 0xba, 0x00, 0x20, 0x09, 0x65, 0x00, 0xc2, 
+  0x00, 0x40, 0x00, 0xe3, 0x09, 0xe6, 0x01, 0xe6, 0x09, 0xc6, 0x00, 0xc2, 0x00, 0x00, 0x29, 0x65, 
+  0x80, 0x03, 0x73, 0xae, 0x31, 0xa6, 0xff, 0xff, 0x84, 0x10, 0x80, 0x01, 0x29, 0xa6, 0x84, 0x10, 
+  0x41, 0x7b, 0xef, 0x41, 0x7b, 0xce, 0x00, 0x7b, 0xef, 0x43, 0x83, 0xef, 0x03, 0x84, 0x0f, 0x8c, 
+  0x30, 0x6b, 0x6d, 0x08, 0xc2, 0x41, 0x01, 0xc6, 0x00, 0x09, 0xe7, 0x41, 0x09, 0xc6, 0x45, 0x01, 
+  0xc6, 0x00, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x01, 0x01, 0xe6, 0x09, 0xe6, 0x53, 0x01, 0xc6, 0x00, 
+  0x09, 0xc6, 0x41, 0x01, 0xc6, 0x41, 0x09, 0xc6, 0x00, 0x01, 0xc6, 0x41, 0x09, 0xe6, 0x44, 0x09, 
+  0xe7, 0x00, 0x09, 0xc7, 0x43, 0x01, 0xc6, 0x03, 0x12, 0x47, 0x1a, 0xc8, 0x0a, 0x06, 0x01, 0xc6, 
+  0x80, 0x04, 0x0a, 0x06, 0x1a, 0xe8, 0x12, 0x87, 0x01, 0xc6, 0x09, 0xe6, 0x81, 0x45, 0x09, 0xe6, 
+  0x42, 0x09, 0xc6, 0x00, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x01, 0x01, 0xe7, 0x09, 0xe6, 0x81, 0x00, 
+  0x09, 0xe6, 0x41, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x88, 0x00, 0x01, 0xe7, 0x81, 0x04, 0x01, 0xe7, 
+  0x09, 0xe6, 0x09, 0xe7, 0x00, 0xc2, 0x63, 0x0b, 0x42, 0xa5, 0x14, 0x42, 0xa5, 0x13, 0x00, 0xa5, 
+  0x34, 0x41, 0xa5, 0x14, 0x01, 0x42, 0x28, 0x01, 0x24, 0x80, 0x03, 0x00, 0xe3, 0x73, 0x8d, 0xb5, 
+  0x75, 0xb5, 0xb6, 0x42, 0xbd, 0xd6, 0x01, 0xbd, 0xb6, 0xbd, 0xd6, 0x81, 0x01, 0x39, 0xe7, 0x01, 
+  0x23, 0x80, 0x00, 0x09, 0xc7, 0x80, 0x00, 0x01, 0xe6, 0x81, 0x04, 0x09, 0x03, 0x8c, 0x30, 0xa5, 
+  0x14, 0xad, 0x34, 0xa5, 0x13, 0x41, 0x9c, 0xf3, 0x14, 0xa5, 0x14, 0xa5, 0x34, 0xad, 0x34, 0xad, 
+  0x55, 0x21, 0x45, 0x09, 0xc5, 0x09, 0xa5, 0x09, 0xa6, 0x09, 0xa5, 0x12, 0x26, 0x23, 0x08, 0x23, 
+  0x28, 0x2b, 0x89, 0x23, 0x29, 0x12, 0x47, 0x00, 0x82, 0x4a, 0x49, 0xa4, 0xf4, 0x18, 0xe3, 0x11, 
+  0xc5, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x42, 0x0a, 0x07, 0x00, 0x09, 0xe6, 0x41, 0x1a, 0xa7, 0x02, 
+  0x09, 0xe6, 0x09, 0xe7, 0x09, 0xe6, 0x41, 0x09, 0xc6, 0x0a, 0x01, 0x65, 0x19, 0x24, 0xb5, 0x96, 
+  0x6b, 0x4c, 0x01, 0x03, 0x0a, 0x47, 0x0a, 0x27, 0x12, 0xa7, 0x1a, 0xc7, 0x09, 0xe5, 0x01, 0xc6, 
+  0x80, 0x18, 0x09, 0xc6, 0x0a, 0x27, 0x01, 0x85, 0x39, 0xe7, 0xa4, 0xf4, 0x4a, 0x69, 0x01, 0x03, 
+  0x01, 0xa6, 0x01, 0x85, 0x01, 0xa6, 0x01, 0x44, 0x00, 0x82, 0x00, 0x81, 0x01, 0x03, 0x09, 0xe6, 
+  0x02, 0x07, 0x01, 0xc6, 0x00, 0x82, 0x8c, 0x51, 0x83, 0xef, 0x00, 0x82, 0x01, 0xa6, 0x01, 0x85, 
+  0x01, 0xa6, 0x01, 0xc6, 0x42, 0x01, 0xe6, 0x09, 0x09, 0xc6, 0x01, 0x44, 0x08, 0xa2, 0x52, 0x8a, 
+  0x21, 0x24, 0x21, 0x04, 0xa4, 0xf4, 0x4a, 0x49, 0x00, 0xe3, 0x01, 0x85, 0x41, 0x00, 0x61, 0x42, 
+  0x00, 0x41, 0x02, 0x00, 0x20, 0x00, 0x40, 0x00, 0x41, 0x43, 0x00, 0x61, 0x01, 0x00, 0x81, 0x01, 
+  0x65, 0x41, 0x01, 0xa6, 0x42, 0x01, 0xc6, 0x00, 0x01, 0xa6, 0x4c, 0x01, 0xc6, 0x41, 0x01, 0xa6, 
+  0x80, 0x41, 0x01, 0xa6, 0x01, 0x01, 0xa5, 0x01, 0xc5, 0x41, 0x01, 0xa6, 0x84, 0x00, 0x01, 0xc5, 
+  0x80, 0x46, 0x01, 0xa6, 0x47, 0x01, 0xc6, 0x80, 0x0a, 0x09, 0xc6, 0x01, 0xa6, 0x0a, 0x47, 0x1a, 
+  0xc8, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0xe6, 0x0a, 0x06, 0x1a, 0xc7, 0x12, 0x86, 0x01, 0xc6, 0x41, 
+  0x09, 0xe6, 0x02, 0x01, 0xe7, 0x09, 0xe7, 0x01, 0xe7, 0x41, 0x09, 0xe7, 0x81, 0x04, 0x09, 0xe7, 
+  0x09, 0xe6, 0x09, 0xe7, 0x09, 0xe6, 0x01, 0xe7, 0x80, 0x00, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x80, 
+  0x00, 0x01, 0xe6, 0x42, 0x09, 0xe6, 0x50, 0x09, 0xe7, 0x02, 0x09, 0xc6, 0x00, 0xa2, 0x00, 0x40, 
+  0x43, 0x00, 0x20, 0x00, 0x00, 0x00, 0x41, 0x00, 0x20, 0x01, 0x00, 0x41, 0x00, 0xe3, 0x41, 0x01, 
+  0xc6, 0x02, 0x01, 0xa6, 0x00, 0x82, 0x00, 0x40, 0x45, 0x00, 0x20, 0x03, 0x00, 0x40, 0x00, 0x41, 
+  0x00, 0xe3, 0x09, 0xa6, 0x41, 0x09, 0xe7, 0x06, 0x09, 0xe6, 0x01, 0xc6, 0x12, 0xe8, 0x12, 0x86, 
+  0x12, 0x05, 0x00, 0xa1, 0x00, 0xc1, 0x41, 0x00, 0x81, 0x00, 0x00, 0xa1, 0x42, 0x00, 0x00, 0x11, 
+  0x00, 0x20, 0x00, 0x60, 0x09, 0x03, 0x09, 0x85, 0x09, 0xa6, 0x01, 0xa5, 0x0a, 0x06, 0x1a, 0xa7, 
+  0x12, 0x87, 0x23, 0x48, 0x23, 0x08, 0x0a, 0x27, 0x09, 0xe7, 0x01, 0x85, 0x00, 0x82, 0x00, 0x60, 
+  0x09, 0x43, 0x01, 0xa6, 0x44, 0x09, 0xe7, 0x03, 0x09, 0xe6, 0x1a, 0xa7, 0x1a, 0x87, 0x01, 0xc6, 
+  0x41, 0x09, 0xc6, 0x80, 0x41, 0x09, 0xe7, 0x13, 0x0a, 0x06, 0x1a, 0x06, 0x00, 0xa1, 0x00, 0xe3, 
+  0x09, 0xe6, 0x02, 0x07, 0x12, 0x88, 0x1a, 0xc7, 0x09, 0xc5, 0x01, 0xc6, 0x09, 0xe6, 0x09, 0xc6, 
+  0x09, 0xe6, 0x0a, 0x07, 0x0a, 0x27, 0x12, 0x05, 0x09, 0x83, 0x11, 0xe5, 0x1a, 0x87, 0x12, 0x87, 
+  0x41, 0x12, 0xa7, 0x0e, 0x12, 0xc8, 0x1a, 0xe8, 0x1b, 0x28, 0x1b, 0x49, 0x1b, 0x48, 0x1b, 0x28, 
+  0x1a, 0xe8, 0x12, 0x25, 0x00, 0xc1, 0x01, 0x42, 0x1a, 0xc7, 0x1b, 0x08, 0x12, 0xc7, 0x1a, 0xa7, 
+  0x1a, 0xe7, 0x41, 0x13, 0x08, 0x00, 0x12, 0xe8, 0x41, 0x12, 0xa7, 0x08, 0x12, 0x66, 0x01, 0xe4, 
+  0x12, 0x25, 0x12, 0x05, 0x01, 0x22, 0x09, 0xc4, 0x1a, 0xc7, 0x1b, 0x08, 0x1b, 0x28, 0x43, 0x1b, 
+  0x08, 0x00, 0x1a, 0xe8, 0x46, 0x1b, 0x08, 0x02, 0x12, 0xe7, 0x12, 0xc7, 0x1a, 0xe8, 0x48, 0x1a, 
+  0xe7, 0x44, 0x12, 0xe7, 0x00, 0x13, 0x07, 0x41, 0x1a, 0xe7, 0x01, 0x12, 0xe7, 0x1a, 0xe7, 0x53, 
+  0x12, 0xe7, 0x41, 0x1a, 0xe7, 0x01, 0x12, 0xe7, 0x1a, 0xe7, 0x44, 0x1a, 0xe8, 0x80, 0x03, 0x01, 
+  0xa6, 0x0a, 0x06, 0x1a, 0xa8, 0x0a, 0x06, 0x41, 0x01, 0xc6, 0x04, 0x02, 0x06, 0x1a, 0xc7, 0x0a, 
+  0x46, 0x01, 0xc6, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x00, 0x09, 0xe7, 0x41, 
+  0x09, 0xe6, 0x44, 0x09, 0xc6, 0x42, 0x09, 0xe6, 0x43, 0x01, 0xe7, 0x80, 0x00, 0x09, 0xc6, 0x80, 
+  0x41, 0x09, 0xc6, 0x80, 0x41, 0x09, 0xc6, 0x80, 0x41, 0x09, 0xe6, 0x00, 0x01, 0xe6, 0x86, 0x00, 
+  0x09, 0xe6, 0x41, 0x09, 0xe7, 0x02, 0x0a, 0x07, 0x09, 0xe7, 0x09, 0xe6, 0x45, 0x09, 0xe7, 0x02, 
+  0x0a, 0x07, 0x09, 0xe7, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x00, 0x0a, 0x07, 0x46, 0x09, 0xe7, 0x00, 
+  0x0a, 0x07, 0x41, 0x09, 0xe7, 0x00, 0x09, 0xe6, 0x42, 0x09, 0xe7, 0x80, 0x01, 0x12, 0x87, 0x12, 
+  0x26, 0x41, 0x12, 0x66, 0x08, 0x23, 0x49, 0x0a, 0x47, 0x12, 0xa7, 0x23, 0xaa, 0x0a, 0x07, 0x09, 
+  0xe7, 0x09, 0xc6, 0x1a, 0x87, 0x1a, 0x47, 0x41, 0x09, 0xc6, 0x08, 0x01, 0xc6, 0x12, 0x47, 0x22, 
+  0xe8, 0x0a, 0x26, 0x1a, 0xc7, 0x1a, 0xa7, 0x0a, 0x06, 0x0a, 0x07, 0x09, 0xc6, 0x80, 0x01, 0x12, 
+  0x47, 0x22, 0xa8, 0x41, 0x09, 0xc6, 0x81, 0x41, 0x09, 0xe6, 0x04, 0x01, 0xc6, 0x1a, 0xa8, 0x1a, 
+  0x87, 0x09, 0xe6, 0x09, 0xe7, 0x42, 0x09, 0xc6, 0x80, 0x02, 0x0a, 0x27, 0x23, 0x09, 0x1a, 0xa8, 
+  0x41, 0x0a, 0x07, 0x04, 0x0a, 0x27, 0x12, 0xc8, 0x1a, 0xc8, 0x09, 0xe6, 0x09, 0xc6, 0x42, 0x09, 
+  0xe7, 0x41, 0x0a, 0x28, 0x09, 0x1a, 0xe9, 0x2b, 0xaa, 0x2b, 0xea, 0x23, 0xa9, 0x23, 0x68, 0x1b, 
+  0x67, 0x1b, 0x68, 0x23, 0x88, 0x23, 0xc8, 0x23, 0xe8, 0x41, 0x23, 0xc8, 0x05, 0x23, 0xc9, 0x23, 
+  0xe8, 0x23, 0xc8, 0x23, 0xa8, 0x23, 0xa9, 0x23, 0xe9, 0x41, 0x24, 0x09, 0x02, 0x23, 0xe9, 0x2c, 
+  0x09, 0x2b, 0xe9, 0x41, 0x23, 0xc8, 0x04, 0x23, 0xa8, 0x23, 0x68, 0x23, 0x88, 0x23, 0xc8, 0x23, 
+  0xe9, 0x41, 0x23, 0xa8, 0x00, 0x23, 0xa9, 0x58, 0x23, 0xa8, 0x5a, 0x23, 0xc8, 0x45, 0x23, 0xa8, 
+  0x41, 0x23, 0xc8, 0x00, 0x23, 0xc9, 0x45, 0x2b, 0xc9, 0x80, 0x04, 0x0a, 0x06, 0x1a, 0xe8, 0x0a, 
+  0x06, 0x01, 0xc6, 0x09, 0xe6, 0x80, 0x01, 0x0a, 0x06, 0x1b, 0x28, 0x41, 0x01, 0xe6, 0x43, 0x09, 
+  0xe6, 0x41, 0x09, 0xc6, 0x84, 0x01, 0x09, 0xe6, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xc6, 0x80, 0x41, 
+  0x01, 0xe6, 0x84, 0x00, 0x09, 0xe6, 0x80, 0x00, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x41, 0x01, 0xe7, 
+  0x80, 0x01, 0x09, 0xc6, 0x01, 0xe7, 0x83, 0x00, 0x01, 0xe7, 0x45, 0x09, 0xe7, 0x01, 0x01, 0xc6, 
+  0x09, 0xe6, 0x80, 0x00, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x44, 0x09, 0xe7, 0x00, 0x09, 0xe6, 0x83, 
+  0x00, 0x09, 0xe6, 0x83, 0x00, 0x09, 0xc6, 0x80, 0x00, 0x0a, 0x07, 0x81, 0x02, 0x01, 0x86, 0x12, 
+  0x67, 0x12, 0x46, 0x80, 0x09, 0x12, 0x46, 0x1b, 0x49, 0x0a, 0x67, 0x0a, 0x87, 0x23, 0x89, 0x01, 
+  0xa6, 0x00, 0xe2, 0x01, 0x43, 0x1a, 0xa7, 0x09, 0xe6, 0x80, 0x0c, 0x01, 0xa6, 0x12, 0x47, 0x23, 
+  0x28, 0x12, 0xa7, 0x1a, 0xe8, 0x12, 0x87, 0x09, 0xc6, 0x09, 0xe6, 0x09, 0xe7, 0x09, 0xa6, 0x12, 
+  0x47, 0x1a, 0xa8, 0x09, 0xe6, 0x80, 0x43, 0x09, 0xe7, 0x00, 0x01, 0xc6, 0x41, 0x1a, 0x87, 0x41, 
+  0x09, 0xe6, 0x43, 0x09, 0xe7, 0x03, 0x01, 0x85, 0x1a, 0xa8, 0x12, 0xa8, 0x09, 0xe6, 0x80, 0x06, 
+  0x09, 0xe6, 0x09, 0x64, 0x09, 0x84, 0x09, 0x64, 0x09, 0xa6, 0x09, 0xe6, 0x09, 0xc6, 0x80, 0x07, 
+  0x0a, 0x07, 0x01, 0x85, 0x0a, 0x06, 0x12, 0x66, 0x01, 0x84, 0x01, 0x43, 0x01, 0x02, 0x09, 0xa4, 
+  0x41, 0x0a, 0x05, 0x03, 0x0a, 0x66, 0x0a, 0xa6, 0x0a, 0x86, 0x0a, 0x66, 0x42, 0x0a, 0x46, 0x02, 
+  0x02, 0x25, 0x02, 0x05, 0x01, 0xe5, 0x41, 0x02, 0x05, 0x07, 0x0a, 0x25, 0x0a, 0xa6, 0x02, 0x04, 
+  0x01, 0xa3, 0x09, 0xe5, 0x01, 0x43, 0x01, 0x22, 0x09, 0xe5, 0x41, 0x0a, 0x66, 0x42, 0x0a, 0x46, 
+  0x41, 0x0a, 0x26, 0x46, 0x0a, 0x46, 0x00, 0x0a, 0x26, 0x45, 0x0a, 0x46, 0x00, 0x0a, 0x26, 0x72, 
+  0x0a, 0x46, 0x80, 0x03, 0x0a, 0x46, 0x1b, 0x08, 0x01, 0xc6, 0x09, 0xe7, 0x83, 0x00, 0x0a, 0x06, 
+  0x82, 0x00, 0x09, 0xe7, 0x82, 0x42, 0x09, 0xc6, 0x01, 0x09, 0xe6, 0x09, 0xe7, 0x41, 0x09, 0xe6, 
+  0x01, 0x01, 0xe6, 0x09, 0xe6, 0x41, 0x01, 0xc6, 0x81, 0x00, 0x09, 0xe7, 0x81, 0x00, 0x01, 0xe6, 
+  0x41, 0x09, 0xe6, 0x02, 0x09, 0xc6, 0x09, 0xe6, 0x01, 0xe7, 0x42, 0x09, 0xe6, 0x02, 0x01, 0xc6, 
+  0x01, 0xe6, 0x09, 0xe6, 0x47, 0x09, 0xe7, 0x03, 0x09, 0xe6, 0x09, 0xc7, 0x09, 0xe6, 0x01, 0xe7, 
+  0x41, 0x09, 0xe7, 0x00, 0x09, 0xe6, 0x80, 0x00, 0x01, 0xe7, 0x81, 0x03, 0x01, 0xe7, 0x09, 0xe6, 
+  0x09, 0xc6, 0x09, 0xc7, 0x85, 0x04, 0x0a, 0x07, 0x09, 0xa5, 0x00, 0xc3, 0x08, 0xe3, 0x09, 0xa6, 
+  0x41, 0x0a, 0x07, 0x12, 0x09, 0x65, 0x00, 0x41, 0x00, 0x61, 0x00, 0x81, 0x00, 0x61, 0x00, 0x81, 
+  0x09, 0x23, 0x01, 0x23, 0x12, 0x87, 0x1b, 0x48, 0x19, 0x44, 0x6b, 0x2c, 0x31, 0xa6, 0x11, 0xc4, 
+  0x0a, 0x26, 0x01, 0xc6, 0x0a, 0x06, 0x23, 0x48, 0x12, 0xe7, 0x41, 0x12, 0xc7, 0x00, 0x01, 0xc6, 
+  0x42, 0x09, 0xc6, 0x02, 0x1a, 0x47, 0x1a, 0xc8, 0x01, 0xc5, 0x80, 0x00, 0x0a, 0x07, 0x81, 0x04, 
+  0x09, 0xc6, 0x01, 0xa6, 0x1a, 0x87, 0x1a, 0xa7, 0x01, 0xc6, 0x80, 0x41, 0x09, 0xc6, 0x81, 0x2c, 
+  0x09, 0x44, 0x29, 0x86, 0x29, 0xa6, 0x09, 0x85, 0x0a, 0x07, 0x0a, 0x27, 0x01, 0x44, 0x39, 0xe7, 
+  0x6b, 0x6d, 0x10, 0xc3, 0x01, 0x65, 0x09, 0xc6, 0x09, 0xe7, 0x09, 0xc6, 0x00, 0x40, 0x29, 0x86, 
+  0x42, 0x49, 0x3a, 0x07, 0x39, 0xe7, 0x31, 0xa6, 0x39, 0xa6, 0x00, 0x41, 0x00, 0xa2, 0x09, 0xe6, 
+  0x01, 0xe6, 0x02, 0x07, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0xa6, 0x09, 0x04, 0x19, 0x04, 
+  0x21, 0x24, 0x19, 0x24, 0x19, 0x04, 0x21, 0x04, 0x19, 0x03, 0x00, 0xc2, 0x52, 0xaa, 0x5a, 0xcb, 
+  0x00, 0x00, 0x42, 0x28, 0x5a, 0xcb, 0x00, 0xc2, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x03, 0x09, 0xc6, 
+  0x09, 0xe6, 0x09, 0xe7, 0x09, 0xc6, 0x41, 0x01, 0xc6, 0x00, 0x01, 0xa6, 0x41, 0x01, 0xc6, 0x03, 
+  0x09, 0xc6, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0xc7, 0x44, 0x01, 0xc6, 0x00, 0x01, 0xa6, 0x4b, 0x01, 
+  0xc6, 0x03, 0x09, 0xc6, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xe7, 0x41, 0x09, 0xc6, 0x01, 0x01, 0xc6, 
+  0x01, 0xa6, 0x49, 0x01, 0xc6, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x42, 0x09, 0xc6, 0x41, 0x01, 0xc6, 
+  0x00, 0x01, 0xa6, 0x43, 0x01, 0xc6, 0x03, 0x09, 0xc6, 0x01, 0xc6, 0x09, 0xc6, 0x09, 0xe6, 0x41, 
+  0x09, 0xc7, 0x00, 0x09, 0xe7, 0x41, 0x09, 0xc7, 0x00, 0x01, 0xa6, 0x82, 0x41, 0x09, 0xe6, 0x86, 
+  0x00, 0x01, 0xe7, 0x42, 0x09, 0xe6, 0x02, 0x09, 0xe7, 0x01, 0xe7, 0x01, 0xe6, 0x81, 0x00, 0x09, 
+  0xc6, 0x41, 0x09, 0xe6, 0x00, 0x09, 0xc6, 0x82, 0x00, 0x01, 0xe6, 0x41, 0x09, 0xe7, 0x01, 0x09, 
+  0xe6, 0x09, 0xe7, 0x81, 0x41, 0x09, 0xe7, 0x00, 0x01, 0xe6, 0x80, 0x00, 0x09, 0xe7, 0x42, 0x01, 
+  0xe6, 0x43, 0x09, 0xe7, 0x00, 0x01, 0xe7, 0x81, 0x00, 0x09, 0xc7, 0x45, 0x09, 0xe7, 0x44, 0x01, 
+  0xe7, 0x81, 0x41, 0x01, 0xc6, 0x45, 0x09, 0xe7, 0x0a, 0x0a, 0x07, 0x01, 0xa6, 0x19, 0x44, 0xce, 
+  0x58, 0xad, 0x34, 0x01, 0x03, 0x0a, 0x27, 0x01, 0xe6, 0x11, 0x44, 0xc6, 0x18, 0xd6, 0xba, 0x42, 
+  0xd6, 0x79, 0x0e, 0xce, 0x59, 0x94, 0x92, 0x11, 0x84, 0x1a, 0xe7, 0x31, 0xc6, 0xff, 0xff, 0x84, 
+  0x10, 0x00, 0xe2, 0x12, 0x27, 0x01, 0xa6, 0x12, 0x47, 0x23, 0x28, 0x01, 0xe6, 0x1b, 0x08, 0x12, 
+  0xa7, 0x80, 0x0d, 0x09, 0xa6, 0x09, 0x85, 0x12, 0x26, 0x1a, 0xa7, 0x09, 0x64, 0x31, 0xc7, 0x11, 
+  0x04, 0x09, 0x85, 0x0a, 0x07, 0x09, 0xc6, 0x01, 0xa5, 0x12, 0x66, 0x1a, 0xa7, 0x0a, 0x06, 0x41, 
+  0x09, 0xe7, 0x00, 0x09, 0xc7, 0x41, 0x09, 0xe7, 0x10, 0x0a, 0x06, 0x19, 0x44, 0xef, 0x5c, 0xd6, 
+  0x79, 0x00, 0xe3, 0x0a, 0x47, 0x1a, 0xa7, 0x01, 0x01, 0x94, 0x91, 0xff, 0xff, 0x31, 0xa6, 0x01, 
+  0x03, 0x09, 0xe7, 0x09, 0xa6, 0x08, 0xa2, 0x84, 0x10, 0xff, 0xde, 0x44, 0xff, 0xff, 0x03, 0xbd, 
+  0xd7, 0x39, 0xc7, 0x00, 0xa2, 0x09, 0xe7, 0x80, 0x42, 0x01, 0xc6, 0x03, 0x01, 0x45, 0x10, 0xc3, 
+  0xde, 0xda, 0xff, 0xdf, 0x41, 0xff, 0xff, 0x08, 0xf7, 0xbe, 0xa5, 0x14, 0x00, 0x00, 0xde, 0xda, 
+  0xf7, 0xbd, 0x00, 0x20, 0xbd, 0xf7, 0xff, 0xde, 0x08, 0xc2, 0x43, 0x01, 0xc6, 0x00, 0x09, 0xc6, 
+  0x7f, 0x01, 0xc6, 0x00, 0x01, 0xc6, 0x81, 0x00, 0x09, 0xc6, 0x80, 0x00, 0x0a, 0x47, 0x87, 0x00, 
+  0x09, 0xe6, 0x42, 0x09, 0xe7, 0x80, 0x03, 0x09, 0xe7, 0x09, 0xc6, 0x09, 0xe6, 0x01, 0xe6, 0x42, 
+  0x09, 0xe6, 0x01, 0x01, 0xe7, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x83, 0x04, 0x09, 0xc6, 0x09, 0xe6, 
+  0x09, 0xe7, 0x01, 0xe7, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x81, 0x04, 0x09, 0xe7, 0x01, 0xe7, 0x09, 
+  0xe7, 0x09, 0xe6, 0x01, 0xe7, 0x82, 0x41, 0x01, 0xe7, 0x44, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x80, 
+  0x00, 0x09, 0xe6, 0x80, 0x00, 0x09, 0xe7, 0x82, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x80, 0x00, 
+  0x09, 0xe6, 0x80, 0x01, 0x09, 0xc6, 0x09, 0xe6, 0x42, 0x09, 0xe7, 0x0a, 0x01, 0x03, 0x21, 0x24, 
+  0xff, 0xff, 0xd6, 0xba, 0x00, 0x61, 0x09, 0xc6, 0x01, 0xc6, 0x11, 0x24, 0xbd, 0xd7, 0xce, 0x38, 
+  0xc5, 0xf7, 0x41, 0xbd, 0xd6, 0x04, 0xff, 0xff, 0xce, 0x38, 0x09, 0x42, 0x1b, 0x07, 0x31, 0xa6, 
+  0x80, 0x03, 0x83, 0xef, 0x01, 0x22, 0x12, 0x47, 0x01, 0x86, 0x80, 0x00, 0x1b, 0x08, 0x80, 0x00, 
+  0x1b, 0x28, 0x81, 0x0c, 0x01, 0xa5, 0x12, 0x26, 0x1a, 0x47, 0x01, 0x85, 0x10, 0xc3, 0xff, 0xff, 
+  0xa5, 0x14, 0x00, 0x20, 0x09, 0x85, 0x09, 0xc5, 0x12, 0x46, 0x1a, 0x87, 0x01, 0xe6, 0x41, 0x09, 
+  0xe7, 0x41, 0x0a, 0x07, 0x80, 0x11, 0x0a, 0x07, 0x12, 0x05, 0x10, 0xc2, 0xf7, 0x9e, 0xd6, 0x9a, 
+  0x00, 0x41, 0x09, 0xe6, 0x23, 0x08, 0x00, 0xa1, 0x8c, 0x50, 0xff, 0xdf, 0x29, 0x65, 0x01, 0x24, 
+  0x0a, 0x07, 0x00, 0xc2, 0x9c, 0xd2, 0xff, 0xff, 0xad, 0x54, 0x41, 0x42, 0x28, 0x07, 0x42, 0x08, 
+  0x42, 0x28, 0x63, 0x0c, 0xef, 0x5d, 0xef, 0x7d, 0x4a, 0x49, 0x09, 0xc5, 0x12, 0xa8, 0x41, 0x0a, 
+  0x27, 0x01, 0x12, 0x27, 0x09, 0xc6, 0x80, 0x05, 0xf7, 0xbe, 0xc6, 0x38, 0x63, 0x2c, 0x73, 0xae, 
+  0xff, 0xdf, 0xb5, 0x95, 0x80, 0x07, 0xc6, 0x37, 0xdf, 0x1a, 0x00, 0x00, 0xb5, 0x95, 0xef, 0x5c, 
+  0x08, 0xe2, 0x0a, 0x47, 0x12, 0x87, 0x44, 0x12, 0x67, 0x00, 0x0a, 0x67, 0x41, 0x12, 0x67, 0x42, 
+  0x0a, 0x67, 0x46, 0x12, 0x67, 0x41, 0x0a, 0x67, 0x44, 0x12, 0x67, 0x41, 0x0a, 0x67, 0x4e, 0x12, 
+  0x67, 0x01, 0x0a, 0x67, 0x12, 0x87, 0x44, 0x12, 0x67, 0x00, 0x12, 0x87, 0x47, 0x12, 0x67, 0x01, 
+  0x0a, 0x67, 0x0a, 0x87, 0x41, 0x0a, 0x67, 0x42, 0x12, 0x67, 0x45, 0x12, 0x87, 0x01, 0x01, 0xc6, 
+  0x0a, 0x66, 0x83, 0x00, 0x01, 0xe6, 0x80, 0x00, 0x1b, 0x08, 0x80, 0x01, 0x01, 0xe6, 0x01, 0xe7, 
+  0x80, 0x41, 0x09, 0xe6, 0x00, 0x01, 0xe7, 0x42, 0x09, 0xe6, 0x00, 0x01, 0xe6, 0x42, 0x09, 0xe6, 
+  0x00, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x82, 0x00, 0x01, 0xc6, 0x80, 0x01, 0x01, 
+  0xe6, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x42, 0x09, 0xe6, 0x80, 0x00, 0x09, 0xe6, 0x45, 0x09, 0xe7, 
+  0x80, 0x00, 0x09, 0xe7, 0x41, 0x01, 0x85, 0x01, 0x01, 0xa6, 0x0a, 0x07, 0x80, 0x00, 0x01, 0xe6, 
+  0x82, 0x01, 0x01, 0xe6, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x80, 0x01, 0x09, 0xe7, 0x09, 0xe6, 0x80, 
+  0x01, 0x01, 0xe6, 0x01, 0xe7, 0x84, 0x12, 0x0a, 0x07, 0x00, 0xc2, 0x6b, 0x4d, 0xef, 0x7d, 0xf7, 
+  0x9e, 0x4a, 0x28, 0x00, 0xe3, 0x09, 0xe6, 0x09, 0x44, 0x00, 0xc2, 0x01, 0x03, 0x00, 0xc2, 0x00, 
+  0xa1, 0x00, 0x00, 0xde, 0xda, 0xbd, 0xd6, 0x00, 0xe2, 0x1a, 0xc6, 0x29, 0x85, 0x80, 0x03, 0x84, 
+  0x0f, 0x01, 0x63, 0x12, 0x88, 0x01, 0xa6, 0x80, 0x02, 0x1a, 0xe8, 0x01, 0xc5, 0x1b, 0x08, 0x81, 
+  0x0a, 0x09, 0xe6, 0x1a, 0x87, 0x09, 0xc6, 0x09, 0xe6, 0x09, 0x03, 0x7b, 0xef, 0xff, 0xff, 0x8c, 
+  0x71, 0x00, 0x00, 0x11, 0xc5, 0x1a, 0xa7, 0x41, 0x09, 0xe6, 0x00, 0x09, 0xc6, 0x82, 0x11, 0x0a, 
+  0x07, 0x12, 0x06, 0x00, 0x20, 0x73, 0xae, 0xff, 0xff, 0xff, 0xdf, 0x7b, 0xef, 0x00, 0x00, 0x11, 
+  0xe6, 0x00, 0x81, 0x8c, 0x30, 0xff, 0xff, 0x31, 0x86, 0x01, 0x44, 0x0a, 0x27, 0x09, 0x44, 0xe7, 
+  0x3c, 0xe7, 0x1c, 0x41, 0x00, 0x00, 0x0a, 0x00, 0xc1, 0x00, 0xe2, 0x01, 0x03, 0x00, 0x00, 0x52, 
+  0xaa, 0xff, 0xff, 0x84, 0x30, 0x09, 0x63, 0x23, 0x09, 0x1a, 0xa7, 0x1a, 0xc8, 0x41, 0x1a, 0xe8, 
+  0x06, 0x19, 0x44, 0xff, 0xff, 0x94, 0xb2, 0x00, 0x00, 0x00, 0x61, 0xef, 0x7d, 0xb5, 0xb5, 0x80, 
+  0x07, 0xc6, 0x16, 0xf7, 0x9d, 0x84, 0x0f, 0xde, 0xfb, 0xef, 0x3d, 0x11, 0x03, 0x1a, 0xe7, 0x1b, 
+  0x28, 0x4d, 0x1b, 0x08, 0x43, 0x1a, 0xe8, 0x41, 0x1b, 0x08, 0x00, 0x23, 0x08, 0x41, 0x1b, 0x08, 
+  0x00, 0x23, 0x08, 0x49, 0x1b, 0x08, 0x00, 0x23, 0x08, 0x47, 0x1b, 0x08, 0x01, 0x1b, 0x28, 0x23, 
+  0x28, 0x46, 0x1b, 0x08, 0x02, 0x23, 0x08, 0x1b, 0x08, 0x23, 0x08, 0x4b, 0x1b, 0x08, 0x00, 0x23, 
+  0x08, 0x42, 0x23, 0x28, 0x84, 0x41, 0x01, 0xe6, 0x84, 0x00, 0x01, 0xe6, 0x41, 0x09, 0xe7, 0x00, 
+  0x09, 0xe6, 0x47, 0x01, 0xe6, 0x03, 0x09, 0xc6, 0x01, 0xc6, 0x09, 0xe7, 0x09, 0xe6, 0x80, 0x42, 
+  0x09, 0xc6, 0x01, 0x01, 0xc6, 0x01, 0xe6, 0x42, 0x01, 0xe7, 0x81, 0x00, 0x01, 0xe7, 0x83, 0x42, 
+  0x09, 0xe6, 0x07, 0x01, 0xc6, 0x01, 0xa6, 0x4b, 0xad, 0x64, 0x30, 0x33, 0x0b, 0x01, 0x64, 0x01, 
+  0xe6, 0x09, 0xe7, 0x41, 0x01, 0xe7, 0x42, 0x01, 0xe6, 0x80, 0x01, 0x01, 0xe7, 0x01, 0xe6, 0x41, 
+  0x09, 0xe6, 0x41, 0x09, 0xe7, 0x81, 0x42, 0x09, 0xe7, 0x07, 0x0a, 0x07, 0x09, 0xc6, 0x08, 0xa2, 
+  0xf7, 0x7d, 0x73, 0x8e, 0xce, 0x58, 0x9c, 0xd3, 0x00, 0xa2, 0x80, 0x01, 0x09, 0x65, 0x00, 0xa1, 
+  0x42, 0x00, 0xe2, 0x80, 0x04, 0xde, 0xfa, 0xc5, 0xf6, 0x00, 0xa1, 0x1a, 0x66, 0x29, 0x65, 0x80, 
+  0x02, 0x84, 0x10, 0x09, 0x83, 0x12, 0xa8, 0x81, 0x10, 0x1a, 0xc7, 0x01, 0x84, 0x1a, 0xc7, 0x12, 
+  0xc7, 0x01, 0xe6, 0x0a, 0x47, 0x23, 0x28, 0x0a, 0x27, 0x0a, 0x28, 0x09, 0xc6, 0x00, 0x61, 0x6b, 
+  0x2c, 0xff, 0xff, 0x8c, 0x51, 0x00, 0x20, 0x09, 0xa5, 0x0a, 0x07, 0x43, 0x09, 0xe7, 0x80, 0x0a, 
+  0x09, 0xc5, 0x00, 0x20, 0x7b, 0xae, 0xff, 0xff, 0xc6, 0x38, 0xd6, 0xba, 0xff, 0xff, 0x63, 0x2c, 
+  0x00, 0x00, 0x00, 0x20, 0x8c, 0x50, 0x80, 0x07, 0x31, 0xc7, 0x01, 0x64, 0x1a, 0xe8, 0x09, 0x43, 
+  0xb5, 0xb6, 0xff, 0xff, 0x8c, 0x71, 0x18, 0xe3, 0x41, 0x21, 0x64, 0x0a, 0x19, 0x24, 0x31, 0xa6, 
+  0xd6, 0x99, 0xff, 0xdf, 0x5a, 0xca, 0x00, 0x81, 0x09, 0xc6, 0x01, 0xa5, 0x01, 0xc6, 0x09, 0xe6, 
+  0x01, 0xc5, 0x81, 0x03, 0x9c, 0xd3, 0x00, 0x81, 0x10, 0xc2, 0xef, 0x7c, 0x81, 0x06, 0xbd, 0xf6, 
+  0xff, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xe7, 0x1c, 0x10, 0xe3, 0x01, 0xa5, 0x43, 0x01, 0xc6, 0x01, 
+  0x01, 0xe6, 0x01, 0xc6, 0x47, 0x01, 0xe6, 0x45, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x41, 0x01, 0xc6, 
+  0x45, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x44, 0x01, 0xe6, 0x42, 0x01, 0xc6, 0x01, 0x01, 0xc5, 0x01, 
+  0xe6, 0x4c, 0x01, 0xc6, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x46, 0x01, 0xe6, 0x43, 0x01, 0xc6, 0x43, 
+  0x01, 0xe6, 0x80, 0x00, 0x0a, 0x47, 0x81, 0x02, 0x09, 0xc6, 0x09, 0xe6, 0x01, 0xc6, 0x81, 0x00, 
+  0x02, 0x06, 0x82, 0x00, 0x01, 0xe7, 0x43, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x84, 0x02, 0x09, 0xe6, 
+  0x01, 0xe6, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x83, 0x04, 0x09, 0xe6, 0x09, 0xe7, 0x01, 0xe6, 0x09, 
+  0xe6, 0x09, 0xe7, 0x41, 0x01, 0xe7, 0x01, 0x09, 0xe7, 0x01, 0xe7, 0x41, 0x09, 0xe6, 0x00, 0x09, 
+  0xc6, 0x80, 0x09, 0x01, 0x85, 0x01, 0x24, 0x6c, 0x91, 0xd7, 0x5d, 0xe7, 0xde, 0xbe, 0x9a, 0x8d, 
+  0x74, 0x32, 0xeb, 0x01, 0xa6, 0x0a, 0x07, 0x41, 0x09, 0xe6, 0x02, 0x09, 0xe7, 0x09, 0xe6, 0x01, 
+  0xe6, 0x43, 0x01, 0xe7, 0x44, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x80, 0x03, 0x01, 0x64, 0x10, 0x82, 
+  0xff, 0xdf, 0x63, 0x4c, 0x80, 0x0c, 0xc5, 0xf7, 0x00, 0x40, 0x09, 0xc6, 0x10, 0xc3, 0x8c, 0x10, 
+  0x9c, 0xb2, 0x9c, 0xd2, 0x9c, 0xd3, 0x94, 0xb2, 0xf7, 0x9d, 0xb5, 0x95, 0x00, 0xc1, 0x1a, 0x65, 
+  0x81, 0x00, 0x84, 0x0f, 0x84, 0x07, 0x01, 0x85, 0x0a, 0x05, 0x01, 0x64, 0x00, 0xe3, 0x01, 0x84, 
+  0x12, 0x46, 0x01, 0x64, 0x01, 0x45, 0x80, 0x16, 0x09, 0xc5, 0x00, 0x00, 0x6b, 0x4c, 0xff, 0xff, 
+  0xa4, 0xf3, 0x08, 0x82, 0x01, 0x65, 0x0a, 0x07, 0x09, 0xe6, 0x09, 0xc6, 0x09, 0xe6, 0x12, 0x46, 
+  0x31, 0xc6, 0xad, 0x55, 0xff, 0xff, 0xde, 0xda, 0x18, 0xa2, 0x10, 0xa2, 0xd6, 0xba, 0xff, 0xff, 
+  0x9c, 0xd3, 0x08, 0x41, 0x84, 0x30, 0x80, 0x05, 0x39, 0xe7, 0x0a, 0x25, 0x1a, 0xc8, 0x09, 0x85, 
+  0x21, 0x24, 0xbd, 0xd6, 0x45, 0xff, 0xff, 0x07, 0xef, 0x7d, 0x63, 0x2c, 0x00, 0x61, 0x09, 0xa5, 
+  0x01, 0xc6, 0x09, 0xc6, 0x09, 0xe6, 0x09, 0xe7, 0x81, 0x05, 0xff, 0xdf, 0x9c, 0xf3, 0x08, 0x61, 
+  0x18, 0xe3, 0xef, 0x5c, 0xad, 0x95, 0x80, 0x07, 0xce, 0x58, 0xe7, 0x3c, 0x08, 0x41, 0xbd, 0xf7, 
+  0xf7, 0x7d, 0x08, 0xc2, 0x01, 0xa6, 0x09, 0xc6, 0x43, 0x09, 0xe7, 0x02, 0x01, 0xe7, 0x09, 0xe6, 
+  0x09, 0xe7, 0x41, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x80, 0x41, 0x09, 0xe6, 0x81, 0x04, 0x01, 0xe6, 
+  0x09, 0xe6, 0x09, 0xe7, 0x09, 0xe6, 0x09, 0xe7, 0x42, 0x09, 0xe6, 0x80, 0x42, 0x09, 0xe6, 0x02, 
+  0x09, 0xe7, 0x01, 0xe6, 0x09, 0xe6, 0x82, 0x00, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x41, 0x01, 0xe6, 
+  0x00, 0x09, 0xe6, 0x80, 0x01, 0x09, 0xe6, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x04, 0x09, 0xe7, 0x09, 
+  0xe6, 0x01, 0xe6, 0x09, 0xe6, 0x09, 0xc6, 0x41, 0x01, 0xe7, 0x00, 0x01, 0xe6, 0x43, 0x09, 0xe6, 
+  0x80, 0x4c, 0x09, 0xe7, 0x80, 0x00, 0x0a, 0x66, 0x81, 0x01, 0x09, 0xe6, 0x01, 0xe6, 0x81, 0x02, 
+  0x23, 0x08, 0x0a, 0x06, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x80, 0x41, 0x01, 0xe7, 
+  0x01, 0x09, 0xe6, 0x01, 0xe7, 0x83, 0x41, 0x09, 0xe6, 0x00, 0x09, 0xc6, 0x81, 0x41, 0x09, 0xe6, 
+  0x80, 0x01, 0x01, 0xe6, 0x09, 0xc6, 0x41, 0x09, 0xe6, 0x00, 0x01, 0xe7, 0x41, 0x09, 0xe7, 0x80, 
+  0x00, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x81, 0x04, 0x09, 0xe7, 0x09, 0xc6, 0x01, 0x64, 0x7c, 0xb2, 
+  0xcf, 0x3c, 0x41, 0xc6, 0xfb, 0x03, 0xcf, 0x3c, 0xf7, 0xff, 0x53, 0xae, 0x01, 0x85, 0x80, 0x43, 
+  0x09, 0xe7, 0x42, 0x01, 0xe7, 0x45, 0x09, 0xe7, 0x00, 0x0a, 0x07, 0x41, 0x09, 0xe7, 0x80, 0x01, 
+  0x00, 0x61, 0x84, 0x30, 0x80, 0x09, 0x21, 0x24, 0x63, 0x2c, 0xf7, 0xbe, 0x42, 0x49, 0x00, 0x81, 
+  0x18, 0xe3, 0xe7, 0x1b, 0xf7, 0xbe, 0xf7, 0x9d, 0xf7, 0xde, 0x41, 0xff, 0xff, 0x02, 0x63, 0x0c, 
+  0x00, 0xe1, 0x1a, 0x86, 0x81, 0x00, 0x83, 0xef, 0x83, 0x02, 0x1a, 0xc8, 0x00, 0xe3, 0x21, 0x45, 
+  0x41, 0x42, 0x28, 0x41, 0x42, 0x69, 0x09, 0x42, 0x48, 0x29, 0x65, 0x00, 0xc3, 0x09, 0xc6, 0x09, 
+  0xa5, 0x00, 0x40, 0x6b, 0x6d, 0xff, 0xdf, 0x9c, 0xf3, 0x10, 0xc2, 0x41, 0x09, 0xc6, 0x0d, 0x01, 
+  0xc6, 0x1a, 0xc8, 0x09, 0xe5, 0x3a, 0x27, 0xff, 0xff, 0xc6, 0x38, 0x31, 0xa6, 0x09, 0x23, 0x00, 
+  0xe3, 0x31, 0x86, 0xd6, 0x99, 0xe7, 0x3c, 0x08, 0x61, 0x8c, 0x50, 0x81, 0x06, 0x09, 0xc5, 0x09, 
+  0x64, 0x00, 0xe2, 0x00, 0x40, 0x00, 0x00, 0x4a, 0x69, 0x73, 0x8e, 0x41, 0x73, 0xae, 0x41, 0x6b, 
+  0x6d, 0x09, 0x08, 0x61, 0x00, 0x00, 0x00, 0x40, 0x00, 0x81, 0x01, 0x85, 0x09, 0xe6, 0x09, 0xe7, 
+  0x0a, 0x07, 0x01, 0xc6, 0x19, 0x24, 0x41, 0xff, 0xff, 0x03, 0xff, 0xde, 0xff, 0xdd, 0xff, 0xff, 
+  0xbd, 0xf7, 0x80, 0x02, 0xce, 0x99, 0xef, 0x5c, 0x00, 0x00, 0x81, 0x00, 0x08, 0x82, 0x80, 0x00, 
+  0x01, 0xe6, 0x41, 0x09, 0xe6, 0x80, 0x47, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x43, 0x01, 0xe6, 0x05, 
+  0x09, 0xe6, 0x09, 0xe7, 0x09, 0xe6, 0x01, 0xe6, 0x09, 0xe6, 0x09, 0xe7, 0x86, 0x01, 0x09, 0xe6, 
+  0x09, 0xc6, 0x82, 0x41, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x81, 0x42, 0x01, 0xe6, 0x80, 0x00, 0x01, 
+  0xe6, 0x42, 0x09, 0xe6, 0x80, 0x44, 0x09, 0xe6, 0x00, 0x09, 0xe7, 0x43, 0x09, 0xe6, 0x81, 0x42, 
+  0x09, 0xe6, 0x82, 0x00, 0x09, 0xe6, 0x81, 0x85, 0x00, 0x01, 0xe6, 0x80, 0x00, 0x23, 0x28, 0x83, 
+  0x02, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe6, 0x80, 0x01, 0x01, 0xe6, 0x09, 0xe6, 0x85, 0x42, 0x01, 
+  0xe6, 0x43, 0x09, 0xe6, 0x00, 0x01, 0xe6, 0x81, 0x00, 0x02, 0x07, 0x43, 0x01, 0xe7, 0x01, 0x09, 
+  0xe7, 0x01, 0xe6, 0x80, 0x04, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0x65, 0x7c, 0xb2, 0xcf, 0x3c, 0x41, 
+  0xc6, 0xfb, 0x04, 0xcf, 0x1b, 0xc7, 0x1b, 0xdf, 0x9d, 0x4b, 0xae, 0x01, 0xa5, 0x84, 0x41, 0x09, 
+  0xe7, 0x41, 0x01, 0xe7, 0x83, 0x41, 0x0a, 0x07, 0x81, 0x12, 0x09, 0xe6, 0x00, 0x00, 0xd6, 0x99, 
+  0xc6, 0x38, 0x00, 0x00, 0x10, 0x82, 0xff, 0xff, 0x7b, 0xef, 0x00, 0x61, 0x09, 0x24, 0x08, 0x41, 
+  0x08, 0x61, 0x10, 0x82, 0x00, 0x20, 0xce, 0x79, 0xf7, 0xbe, 0x31, 0xa6, 0x09, 0x83, 0x1a, 0x66, 
+  0x82, 0x01, 0x01, 0x83, 0x12, 0x88, 0x81, 0x02, 0x1b, 0x08, 0x00, 0x20, 0x8c, 0x30, 0x44, 0xff, 
+  0xff, 0x01, 0xb5, 0x96, 0x00, 0x20, 0x80, 0x0c, 0x09, 0xe6, 0x11, 0xc6, 0x00, 0x00, 0xa5, 0x34, 
+  0xff, 0xff, 0x42, 0x48, 0x01, 0x23, 0x09, 0xe6, 0x12, 0x86, 0x1a, 0x87, 0x09, 0xa4, 0x00, 0x00, 
+  0x08, 0x41, 0x41, 0x00, 0x00, 0x06, 0x00, 0xc2, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 
+  0x00, 0x00, 0x94, 0x92, 0x81, 0x04, 0x00, 0x81, 0x21, 0x24, 0x6b, 0x2c, 0x63, 0x2c, 0x6b, 0x4d, 
+  0x41, 0x5a, 0xeb, 0x04, 0x5b, 0x0b, 0x5a, 0xeb, 0x5a, 0xca, 0x52, 0x8a, 0x63, 0x0b, 0x41, 0x6b, 
+  0x4c, 0x01, 0x5a, 0xaa, 0x08, 0xe3, 0x42, 0x0a, 0x07, 0x07, 0x09, 0xe6, 0x08, 0xe3, 0x73, 0x6d, 
+  0x7b, 0xce, 0x73, 0x8d, 0x73, 0xae, 0x7b, 0xcf, 0x5a, 0xcb, 0x80, 0x01, 0xd6, 0x79, 0xef, 0x5d, 
+  0x81, 0x01, 0xef, 0x5c, 0x00, 0x61, 0x80, 0x00, 0x09, 0xe7, 0x80, 0x41, 0x09, 0xe7, 0x41, 0x09, 
+  0xe6, 0x43, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x00, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x80, 0x00, 0x09, 
+  0xe6, 0x42, 0x09, 0xe7, 0x41, 0x0a, 0x07, 0x45, 0x09, 0xe7, 0x01, 0x01, 0xe7, 0x01, 0xe6, 0x42, 
+  0x09, 0xe6, 0x83, 0x42, 0x09, 0xe6, 0x00, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x00, 
+  0x01, 0xe6, 0x41, 0x01, 0xe7, 0x80, 0x42, 0x01, 0xe6, 0x81, 0x01, 0x01, 0xe6, 0x01, 0xe7, 0x44, 
+  0x09, 0xe7, 0x00, 0x01, 0xe7, 0x49, 0x09, 0xe7, 0x82, 0x00, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x84, 
+  0x41, 0x09, 0xe6, 0x41, 0x01, 0xe7, 0x46, 0x01, 0xe6, 0x04, 0x09, 0xe6, 0x09, 0xc6, 0x01, 0xe6, 
+  0x01, 0xe7, 0x09, 0xe7, 0x42, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x04, 0x01, 0xe7, 0x09, 0xe7, 0x01, 
+  0xe7, 0x01, 0xe6, 0x09, 0xe6, 0x81, 0x09, 0x09, 0xe7, 0x09, 0xe6, 0x09, 0xe7, 0x01, 0xc6, 0x12, 
+  0x27, 0x22, 0x69, 0x84, 0xf3, 0xd7, 0x5c, 0xc6, 0xfb, 0xc6, 0xdb, 0x80, 0x04, 0xcf, 0x5c, 0x74, 
+  0x71, 0x22, 0x48, 0x12, 0x27, 0x01, 0xc6, 0x41, 0x01, 0xe7, 0x00, 0x09, 0xe6, 0x89, 0x00, 0x09, 
+  0xe7, 0x82, 0x12, 0x09, 0xa6, 0x00, 0x20, 0xde, 0xda, 0xbe, 0x17, 0x29, 0x65, 0x39, 0xc7, 0xef, 
+  0x7d, 0x94, 0x71, 0x00, 0x40, 0x12, 0x27, 0x01, 0x85, 0x11, 0xe6, 0x00, 0x61, 0x5a, 0xca, 0xff, 
+  0xde, 0xad, 0x75, 0x00, 0x40, 0x12, 0x87, 0x12, 0x45, 0x81, 0x01, 0x7b, 0xef, 0x01, 0x63, 0x83, 
+  0x01, 0x01, 0x03, 0x18, 0xe3, 0x41, 0x31, 0xa6, 0x00, 0x39, 0xe7, 0x41, 0x31, 0xe7, 0x11, 0x21, 
+  0x65, 0x00, 0xe3, 0x09, 0xe6, 0x09, 0xc5, 0x00, 0x00, 0x83, 0xef, 0xff, 0xff, 0x73, 0x8e, 0x08, 
+  0xc2, 0x01, 0xa5, 0x1a, 0xa8, 0x1a, 0x87, 0x0a, 0x06, 0x00, 0xc2, 0x84, 0x10, 0xc6, 0x18, 0xbd, 
+  0xf6, 0xc6, 0x17, 0x41, 0xb5, 0x95, 0x41, 0xc6, 0x38, 0x02, 0xd6, 0x9a, 0xb5, 0x95, 0xa4, 0xf3, 
+  0x81, 0x01, 0x00, 0x00, 0x52, 0x8a, 0x4b, 0xff, 0xff, 0x00, 0xe7, 0x1b, 0x80, 0x00, 0x01, 0xe7, 
+  0x80, 0x02, 0x09, 0xe7, 0x01, 0xc6, 0x01, 0x64, 0x41, 0x00, 0x00, 0x09, 0x08, 0x41, 0x00, 0x00, 
+  0x00, 0x60, 0x01, 0x43, 0x09, 0x64, 0x31, 0xe7, 0x32, 0x07, 0x08, 0x41, 0x42, 0x07, 0x4a, 0x69, 
+  0x80, 0x02, 0x01, 0xa5, 0x01, 0xc6, 0x01, 0xe6, 0x44, 0x01, 0xc6, 0x00, 0x01, 0xe6, 0x49, 0x01, 
+  0xc6, 0x43, 0x01, 0xe6, 0x56, 0x01, 0xc6, 0x80, 0x42, 0x09, 0xe7, 0x82, 0x42, 0x09, 0xe7, 0x01, 
+  0x01, 0xe6, 0x09, 0xe6, 0x41, 0x01, 0xe7, 0x80, 0x00, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x00, 0x09, 
+  0xe6, 0x84, 0x00, 0x0a, 0x07, 0x81, 0x81, 0x01, 0x1b, 0x28, 0x01, 0xc6, 0x81, 0x00, 0x01, 0xc6, 
+  0x80, 0x00, 0x23, 0x08, 0x81, 0x41, 0x01, 0xe6, 0x80, 0x00, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x00, 
+  0x01, 0xe7, 0x80, 0x41, 0x09, 0xe6, 0x81, 0x41, 0x01, 0xe6, 0x42, 0x09, 0xe6, 0x41, 0x09, 0xe7, 
+  0x41, 0x09, 0xe6, 0x02, 0x09, 0xe7, 0x02, 0x07, 0x09, 0xe7, 0x80, 0x43, 0x01, 0xe7, 0x0b, 0x09, 
+  0xe7, 0x01, 0xc6, 0x01, 0x85, 0x6c, 0x71, 0xdf, 0x5d, 0xd7, 0x3c, 0xcf, 0x1c, 0xce, 0xfb, 0xd7, 
+  0x5d, 0xd7, 0x5c, 0x74, 0x91, 0x01, 0x85, 0x41, 0x01, 0xc6, 0x00, 0x09, 0xe6, 0x46, 0x09, 0xe7, 
+  0x85, 0x41, 0x0a, 0x07, 0x80, 0x03, 0x0a, 0x07, 0x01, 0x23, 0x31, 0x86, 0xf7, 0xbd, 0x43, 0xff, 
+  0xff, 0x0b, 0xce, 0x79, 0x08, 0xa2, 0x09, 0xc6, 0x12, 0x47, 0x00, 0xc2, 0x31, 0x85, 0xef, 0x7c, 
+  0xf7, 0x9d, 0x19, 0x23, 0x01, 0x84, 0x12, 0xc8, 0x1a, 0x86, 0x81, 0x00, 0x83, 0xef, 0x82, 0x00, 
+  0x0a, 0x67, 0x80, 0x07, 0x01, 0xc5, 0x0a, 0x45, 0x01, 0xa4, 0x01, 0x03, 0x01, 0x43, 0x0a, 0x05, 
+  0x01, 0x43, 0x01, 0x85, 0x41, 0x09, 0xe6, 0x15, 0x00, 0x40, 0x83, 0xef, 0xff, 0xff, 0x7b, 0xae, 
+  0x00, 0x40, 0x09, 0xc5, 0x1a, 0xa7, 0x12, 0x87, 0x09, 0xe6, 0x0a, 0x27, 0x00, 0xa1, 0x8c, 0x50, 
+  0xde, 0xba, 0xce, 0x79, 0xd6, 0x99, 0xff, 0xff, 0xff, 0xfe, 0xbd, 0xf7, 0xb5, 0xb6, 0xbd, 0xd7, 
+  0x7b, 0xce, 0x8c, 0x71, 0x80, 0x0d, 0x31, 0xa6, 0x00, 0xc2, 0x10, 0xe3, 0x21, 0x24, 0x10, 0x82, 
+  0x18, 0xc3, 0x31, 0xc6, 0x21, 0x44, 0x73, 0xae, 0xff, 0xdf, 0x5a, 0xeb, 0x18, 0xe3, 0x21, 0x24, 
+  0x21, 0x04, 0x41, 0x21, 0x65, 0x11, 0x09, 0x85, 0x0a, 0x47, 0x0a, 0x68, 0x0a, 0x27, 0x09, 0xe6, 
+  0x0a, 0x06, 0x00, 0xe2, 0x5a, 0xcb, 0xff, 0xdf, 0x39, 0xc7, 0x00, 0x20, 0x01, 0x03, 0x00, 0xe2, 
+  0x00, 0x81, 0x00, 0x60, 0x00, 0x00, 0xad, 0x34, 0xd6, 0xb9, 0x80, 0x00, 0x09, 0xc5, 0x44, 0x0a, 
+  0x26, 0x00, 0x0a, 0x27, 0x41, 0x0a, 0x26, 0x45, 0x0a, 0x27, 0x43, 0x0a, 0x26, 0x01, 0x0a, 0x47, 
+  0x0a, 0x46, 0x54, 0x0a, 0x26, 0x00, 0x0a, 0x46, 0x42, 0x0a, 0x26, 0x42, 0x09, 0xe6, 0x00, 0x09, 
+  0xc6, 0x41, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x41, 0x09, 0xe6, 0x01, 0x0a, 0x07, 
+  0x09, 0xe6, 0x44, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x45, 0x09, 0xe7, 0x00, 0x0a, 0x07, 0x80, 0x00, 
+  0x0a, 0x67, 0x85, 0x03, 0x1b, 0x08, 0x0a, 0x07, 0x09, 0xe7, 0x01, 0xe7, 0x46, 0x01, 0xe6, 0x43, 
+  0x09, 0xe6, 0x80, 0x00, 0x09, 0xe6, 0x41, 0x09, 0xc6, 0x42, 0x09, 0xe6, 0x00, 0x01, 0xe6, 0x81, 
+  0x01, 0x09, 0xe7, 0x09, 0xe6, 0x80, 0x00, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x04, 0x09, 0xe7, 0x09, 
+  0xc6, 0x01, 0x65, 0x6c, 0x51, 0xd7, 0x5d, 0x42, 0xcf, 0x1c, 0x04, 0xd7, 0x3c, 0xae, 0x18, 0x84, 
+  0xf3, 0x01, 0x65, 0x01, 0xc6, 0x43, 0x09, 0xe7, 0x41, 0x01, 0xe7, 0x81, 0x00, 0x09, 0xe6, 0x81, 
+  0x46, 0x09, 0xe7, 0x00, 0x01, 0xe7, 0x80, 0x13, 0x00, 0x61, 0xa5, 0x13, 0xff, 0xff, 0x52, 0xaa, 
+  0x4a, 0x49, 0x4a, 0x48, 0x7b, 0xef, 0xff, 0xff, 0x4a, 0x69, 0x01, 0x03, 0x00, 0x81, 0x31, 0x86, 
+  0xe7, 0x3b, 0xf7, 0xde, 0x4a, 0x49, 0x00, 0xa1, 0x02, 0x06, 0x1a, 0xe8, 0x12, 0x86, 0x29, 0xa6, 
+  0x81, 0x00, 0x01, 0x42, 0x81, 0x00, 0x12, 0x47, 0x81, 0x19, 0x1b, 0x28, 0x12, 0xe7, 0x01, 0xe6, 
+  0x0a, 0x06, 0x1b, 0x08, 0x0a, 0x06, 0x09, 0xe7, 0x09, 0xc6, 0x00, 0x40, 0x84, 0x10, 0xff, 0xff, 
+  0x73, 0xae, 0x00, 0x00, 0x09, 0x65, 0x12, 0x87, 0x1a, 0xe8, 0x01, 0xe6, 0x09, 0xe7, 0x09, 0xe6, 
+  0x09, 0xe5, 0x00, 0x81, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0xe7, 0x1c, 0xce, 0x79, 0x41, 0x00, 
+  0x00, 0x02, 0x00, 0x61, 0x00, 0x00, 0x8c, 0x50, 0x81, 0x1a, 0x12, 0x05, 0x22, 0xc7, 0x00, 0x60, 
+  0x63, 0x2c, 0x6b, 0x6d, 0x09, 0x03, 0x00, 0xc2, 0x5a, 0xeb, 0xff, 0xff, 0x42, 0x08, 0x00, 0x40, 
+  0x01, 0x65, 0x01, 0x64, 0x01, 0x85, 0x01, 0xa5, 0x0a, 0x67, 0x1b, 0x29, 0x23, 0x49, 0x1a, 0xe8, 
+  0x1a, 0xa7, 0x1a, 0xe8, 0x01, 0x43, 0x5a, 0xeb, 0xff, 0xff, 0xc6, 0x18, 0xb5, 0x75, 0xb5, 0x96, 
+  0x42, 0xb5, 0x95, 0x07, 0xad, 0x54, 0xef, 0x7c, 0xe6, 0xfa, 0x08, 0xa1, 0x1a, 0xa7, 0x1b, 0x28, 
+  0x1b, 0x08, 0x1b, 0x28, 0x4b, 0x1b, 0x08, 0x00, 0x1b, 0x28, 0x5c, 0x1b, 0x08, 0x00, 0x12, 0x87, 
+  0x84, 0x42, 0x09, 0xe6, 0x44, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x49, 0x09, 0xe7, 0x80, 0x82, 0x01, 
+  0x01, 0xe6, 0x09, 0xe7, 0x80, 0x00, 0x01, 0xe6, 0x81, 0x03, 0x0a, 0x06, 0x09, 0xe6, 0x01, 0xe6, 
+  0x09, 0xe6, 0x80, 0x00, 0x09, 0xe6, 0x86, 0x43, 0x09, 0xc6, 0x42, 0x09, 0xe6, 0x00, 0x09, 0xe7, 
+  0x83, 0x42, 0x09, 0xe7, 0x80, 0x04, 0x09, 0xe7, 0x01, 0x64, 0x01, 0x03, 0x6c, 0x10, 0xd7, 0x5c, 
+  0x42, 0xcf, 0x1c, 0x04, 0xdf, 0x9d, 0x9d, 0x75, 0x09, 0xc6, 0x01, 0xc6, 0x09, 0xe7, 0x80, 0x00, 
+  0x09, 0xc6, 0x42, 0x09, 0xe6, 0x80, 0x00, 0x09, 0xe6, 0x80, 0x00, 0x01, 0xe6, 0x80, 0x41, 0x01, 
+  0xe6, 0x00, 0x09, 0xe6, 0x81, 0x00, 0x0a, 0x07, 0x43, 0x09, 0xe7, 0x81, 0x12, 0xc6, 0x18, 0xe7, 
+  0x1b, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x81, 0x29, 0x85, 0xff, 0xdf, 0x63, 0x2c, 0x00, 0x41, 0x94, 
+  0xb1, 0xef, 0x7d, 0xff, 0xff, 0x52, 0x8a, 0x00, 0x00, 0x09, 0xa5, 0x1a, 0x87, 0x23, 0x28, 0x01, 
+  0xe4, 0x31, 0xa6, 0x80, 0x00, 0x7b, 0xcf, 0x80, 0x00, 0x12, 0x67, 0x81, 0x04, 0x1b, 0x28, 0x01, 
+  0xe5, 0x13, 0x07, 0x12, 0xa7, 0x01, 0xa5, 0x80, 0x09, 0x1a, 0xe8, 0x01, 0xe6, 0x09, 0xc6, 0x08, 
+  0xc3, 0x8c, 0x50, 0xff, 0xff, 0x8c, 0x71, 0x00, 0x00, 0x09, 0x85, 0x01, 0xa6, 0x80, 0x00, 0x1b, 
+  0x08, 0x81, 0x0c, 0x01, 0xe6, 0x12, 0xc8, 0x0a, 0x47, 0x09, 0xe6, 0x09, 0xc6, 0x08, 0xa2, 0xef, 
+  0x3c, 0xd6, 0x9a, 0x08, 0xa2, 0x1a, 0x46, 0x22, 0xa8, 0x00, 0x20, 0x8c, 0x30, 0x80, 0x05, 0x31, 
+  0xc6, 0x12, 0x45, 0x12, 0x67, 0x00, 0xa2, 0xe7, 0x1b, 0xf7, 0x7d, 0x80, 0x02, 0x01, 0x03, 0x52, 
+  0x8a, 0xde, 0xdb, 0x80, 0x01, 0x00, 0xe3, 0x0a, 0x28, 0x41, 0x0a, 0x27, 0x03, 0x0a, 0x67, 0x1a, 
+  0xe8, 0x12, 0x67, 0x0a, 0x06, 0x41, 0x09, 0xe6, 0x02, 0x0a, 0x06, 0x00, 0xc2, 0x63, 0x0b, 0x80, 
+  0x00, 0xef, 0x9d, 0x42, 0xef, 0x7d, 0x06, 0xef, 0x3c, 0xef, 0x5c, 0xef, 0x3c, 0xff, 0xde, 0xde, 
+  0xda, 0x08, 0x81, 0x01, 0xc5, 0x42, 0x02, 0x06, 0x01, 0x0a, 0x06, 0x02, 0x06, 0x4a, 0x01, 0xe6, 
+  0x41, 0x09, 0xe6, 0x5a, 0x01, 0xe6, 0x80, 0x03, 0x12, 0x67, 0x01, 0xc5, 0x09, 0xe6, 0x09, 0xe7, 
+  0x81, 0x00, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x81, 0x00, 0x09, 0xe6, 0x44, 0x09, 0xe7, 0x43, 0x09, 
+  0xe6, 0x84, 0x81, 0x00, 0x1b, 0x08, 0x82, 0x00, 0x01, 0xc6, 0x80, 0x00, 0x23, 0x08, 0x82, 0x41, 
+  0x01, 0xe6, 0x81, 0x00, 0x09, 0xe6, 0x80, 0x01, 0x01, 0xe7, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x80, 
+  0x00, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x42, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x00, 
+  0x01, 0xe7, 0x42, 0x09, 0xe7, 0x02, 0x01, 0x44, 0x4b, 0x6d, 0x74, 0x51, 0x42, 0xcf, 0x1b, 0x03, 
+  0xd7, 0x7d, 0xe7, 0xdf, 0x85, 0x13, 0x09, 0xe7, 0x41, 0x0a, 0x07, 0x80, 0x41, 0x09, 0xc6, 0x01, 
+  0x01, 0xc6, 0x09, 0xc6, 0x80, 0x00, 0x09, 0xe7, 0x81, 0x42, 0x09, 0xe7, 0x02, 0x01, 0xc6, 0x01, 
+  0xe6, 0x09, 0xe6, 0x45, 0x09, 0xe7, 0x14, 0x01, 0xe6, 0x08, 0xc2, 0xff, 0xde, 0xc6, 0x18, 0x00, 
+  0x20, 0x12, 0x06, 0x09, 0xe6, 0x11, 0x04, 0xff, 0xff, 0xad, 0x95, 0x00, 0x00, 0xef, 0x5c, 0xf7, 
+  0x9d, 0x5a, 0xca, 0x00, 0x81, 0x01, 0x84, 0x0a, 0x05, 0x2b, 0x28, 0x1a, 0xc7, 0x01, 0x84, 0x29, 
+  0x86, 0x83, 0x00, 0x01, 0x86, 0x81, 0x02, 0x01, 0xc5, 0x12, 0xe7, 0x0a, 0xa7, 0x83, 0x06, 0x09, 
+  0xa6, 0x08, 0x82, 0xde, 0xda, 0xa4, 0xf3, 0x00, 0x20, 0x09, 0xa5, 0x09, 0xe6, 0x80, 0x01, 0x12, 
+  0x67, 0x1a, 0xe8, 0x80, 0x00, 0x0a, 0x07, 0x80, 0x01, 0x12, 0xa8, 0x0a, 0x27, 0x41, 0x09, 0xe6, 
+  0x06, 0x08, 0xc2, 0xe7, 0x1c, 0xd6, 0x79, 0x00, 0xc2, 0x1a, 0xa7, 0x12, 0x47, 0x00, 0x61, 0x82, 
+  0x04, 0x01, 0x84, 0x0a, 0x27, 0x00, 0xc2, 0xd6, 0x79, 0xd6, 0xda, 0x44, 0x00, 0x00, 0x00, 0x00, 
+  0x61, 0x41, 0x00, 0xc2, 0x02, 0x01, 0x03, 0x1a, 0xa7, 0x12, 0x67, 0x41, 0x09, 0xc6, 0x02, 0x01, 
+  0xa6, 0x01, 0x85, 0x09, 0xc6, 0x80, 0x00, 0x63, 0x2c, 0x80, 0x00, 0x4a, 0x48, 0x45, 0x00, 0x00, 
+  0x02, 0xad, 0x75, 0xef, 0x5d, 0x08, 0xa2, 0x80, 0x50, 0x01, 0xc6, 0x00, 0x01, 0xa6, 0x49, 0x01, 
+  0xc6, 0x46, 0x01, 0xa6, 0x43, 0x01, 0xc6, 0x41, 0x01, 0xa6, 0x42, 0x01, 0xc6, 0x01, 0x09, 0xe6, 
+  0x01, 0xc5, 0x80, 0x01, 0x12, 0x46, 0x01, 0xc5, 0x81, 0x00, 0x01, 0xc6, 0x45, 0x09, 0xe6, 0x80, 
+  0x00, 0x09, 0xe6, 0x83, 0x00, 0x01, 0xe7, 0x86, 0x81, 0x01, 0x1b, 0x28, 0x01, 0xc6, 0x80, 0x00, 
+  0x01, 0xe6, 0x83, 0x01, 0x09, 0xe7, 0x09, 0xe6, 0x80, 0x00, 0x01, 0xe7, 0x44, 0x09, 0xe6, 0x01, 
+  0x09, 0xc6, 0x01, 0xe6, 0x41, 0x09, 0xc6, 0x80, 0x41, 0x01, 0xe7, 0x00, 0x09, 0xe7, 0x82, 0x04, 
+  0x09, 0xe7, 0x09, 0xe6, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe6, 0x80, 0x04, 0x0a, 0x07, 0x01, 0x65, 
+  0x5b, 0xae, 0xcf, 0x1c, 0xd7, 0x7d, 0x41, 0xc6, 0xfb, 0x04, 0xd7, 0x7d, 0x9d, 0x75, 0x63, 0xef, 
+  0x11, 0xe7, 0x01, 0xc6, 0x80, 0x41, 0x09, 0xe7, 0x00, 0x09, 0xe6, 0x42, 0x09, 0xc6, 0x81, 0x03, 
+  0x09, 0xe7, 0x09, 0xe6, 0x01, 0xe6, 0x09, 0xc7, 0x41, 0x09, 0xe6, 0x47, 0x09, 0xe7, 0x0a, 0x09, 
+  0xe6, 0x08, 0xe3, 0x8c, 0x30, 0x6b, 0x2c, 0x00, 0x81, 0x1a, 0x67, 0x12, 0x67, 0x08, 0xe3, 0x83, 
+  0xef, 0x52, 0xaa, 0x00, 0x61, 0x41, 0x19, 0x03, 0x07, 0x01, 0x03, 0x0a, 0x26, 0x12, 0x86, 0x22, 
+  0xe8, 0x12, 0x66, 0x0a, 0x06, 0x01, 0x44, 0x29, 0x85, 0x80, 0x02, 0x84, 0x10, 0x01, 0x22, 0x12, 
+  0x68, 0x81, 0x00, 0x1b, 0x08, 0x81, 0x00, 0x0a, 0x87, 0x83, 0x04, 0x09, 0xc6, 0x09, 0x44, 0x11, 
+  0x03, 0x08, 0xe2, 0x09, 0x64, 0x41, 0x09, 0xe6, 0x00, 0x01, 0xc6, 0x80, 0x00, 0x1a, 0xc8, 0x82, 
+  0x00, 0x12, 0xa7, 0x81, 0x06, 0x0a, 0x07, 0x08, 0xe3, 0xff, 0xbe, 0xde, 0xfb, 0x00, 0x61, 0x09, 
+  0xe6, 0x0a, 0x27, 0x80, 0x00, 0x94, 0xb2, 0x80, 0x00, 0x39, 0xe7, 0x82, 0x03, 0xde, 0xfb, 0xff, 
+  0xff, 0xc6, 0x37, 0xce, 0x37, 0x41, 0xce, 0x58, 0x06, 0xce, 0x79, 0xd6, 0x9a, 0xd6, 0x99, 0xd6, 
+  0x9a, 0x94, 0x92, 0x00, 0xe3, 0x0a, 0x07, 0x80, 0x05, 0x01, 0xa5, 0x12, 0x46, 0x12, 0x87, 0x1b, 
+  0x09, 0x01, 0x84, 0x73, 0xae, 0x80, 0x00, 0xde, 0xda, 0x41, 0xce, 0x58, 0x00, 0xc6, 0x37, 0x42, 
+  0xc6, 0x38, 0x03, 0xff, 0xdf, 0xf7, 0x7d, 0x11, 0x23, 0x12, 0xc8, 0x51, 0x1a, 0xc8, 0x01, 0x12, 
+  0xc8, 0x12, 0xa8, 0x41, 0x1a, 0xa8, 0x45, 0x1a, 0xc8, 0x43, 0x1a, 0xa8, 0x01, 0x12, 0xa8, 0x12, 
+  0xc8, 0x45, 0x1a, 0xc8, 0x42, 0x12, 0xc7, 0x01, 0x0a, 0x47, 0x01, 0xc5, 0x41, 0x01, 0xe6, 0x02, 
+  0x12, 0x67, 0x12, 0x87, 0x01, 0xe5, 0x82, 0x42, 0x09, 0xe7, 0x80, 0x41, 0x09, 0xe7, 0x81, 0x03, 
+  0x09, 0xe6, 0x09, 0xc6, 0x09, 0xe7, 0x09, 0xe6, 0x46, 0x09, 0xe7, 0x81, 0x00, 0x1b, 0x08, 0x81, 
+  0x00, 0x01, 0xe7, 0x81, 0x00, 0x23, 0x28, 0x80, 0x41, 0x09, 0xe6, 0x81, 0x00, 0x09, 0xe7, 0x81, 
+  0x00, 0x09, 0xc6, 0x43, 0x09, 0xe6, 0x03, 0x09, 0xe7, 0x09, 0xc6, 0x09, 0xe6, 0x09, 0xe7, 0x42, 
+  0x09, 0xe6, 0x01, 0x01, 0xe6, 0x01, 0xe7, 0x81, 0x41, 0x09, 0xe6, 0x04, 0x0a, 0x07, 0x09, 0xc6, 
+  0x6c, 0x0f, 0xd7, 0x3c, 0xcf, 0x3c, 0x41, 0xc6, 0xfb, 0x07, 0xd7, 0x7d, 0x9d, 0x75, 0x19, 0xa6, 
+  0x01, 0x24, 0x01, 0xc6, 0x09, 0xe6, 0x09, 0xe7, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x00, 0x09, 0xe6, 
+  0x80, 0x00, 0x01, 0xe6, 0x82, 0x01, 0x09, 0xe7, 0x01, 0xe7, 0x41, 0x01, 0xe6, 0x41, 0x09, 0xe6, 
+  0x47, 0x09, 0xe7, 0x00, 0x09, 0xa6, 0x41, 0x00, 0xa2, 0x13, 0x1a, 0x67, 0x22, 0xc8, 0x0a, 0x06, 
+  0x09, 0x85, 0x00, 0x81, 0x09, 0x22, 0x11, 0xc5, 0x01, 0xa4, 0x01, 0xa5, 0x0a, 0x06, 0x12, 0x86, 
+  0x2b, 0x89, 0x12, 0xc7, 0x01, 0xe6, 0x09, 0xe7, 0x01, 0x65, 0x18, 0xe3, 0xbd, 0xd7, 0x62, 0xeb, 
+  0x09, 0x83, 0x80, 0x00, 0x01, 0xa6, 0x83, 0x00, 0x12, 0x87, 0x81, 0x00, 0x1b, 0x08, 0x81, 0x05, 
+  0x01, 0xc5, 0x12, 0xc7, 0x12, 0x86, 0x01, 0xa5, 0x09, 0xc6, 0x09, 0xe7, 0x82, 0x02, 0x01, 0xc6, 
+  0x09, 0xe7, 0x01, 0xc6, 0x83, 0x03, 0x09, 0x03, 0x7b, 0xcf, 0x73, 0x4d, 0x00, 0xa2, 0x80, 0x05, 
+  0x12, 0x27, 0x01, 0x02, 0x6b, 0x4c, 0xbd, 0xf7, 0x29, 0x65, 0x01, 0xa5, 0x80, 0x01, 0x00, 0xe3, 
+  0x8c, 0x50, 0x43, 0xc6, 0x17, 0x01, 0xc6, 0x37, 0xce, 0x58, 0x41, 0xce, 0x59, 0x02, 0xce, 0x79, 
+  0x94, 0x71, 0x00, 0xa2, 0x80, 0x01, 0x01, 0x85, 0x12, 0x26, 0x80, 0x05, 0x12, 0x67, 0x13, 0x08, 
+  0x09, 0xc5, 0x42, 0x28, 0xbd, 0xf7, 0xc5, 0xf7, 0x41, 0xc6, 0x17, 0x01, 0xce, 0x37, 0xce, 0x38, 
+  0x41, 0xce, 0x59, 0x04, 0xc6, 0x18, 0x9c, 0xd3, 0x08, 0xe2, 0x12, 0x67, 0x12, 0x46, 0x51, 0x12, 
+  0x67, 0x01, 0x0a, 0x67, 0x0a, 0x47, 0x42, 0x12, 0x67, 0x00, 0x0a, 0x67, 0x47, 0x12, 0x67, 0x02, 
+  0x0a, 0x67, 0x12, 0x67, 0x12, 0x87, 0x43, 0x12, 0x67, 0x41, 0x0a, 0x67, 0x05, 0x0a, 0x66, 0x12, 
+  0xa7, 0x1a, 0xe8, 0x0a, 0x26, 0x01, 0xc5, 0x01, 0xe6, 0x80, 0x02, 0x12, 0xa7, 0x01, 0xe5, 0x01, 
+  0xe6, 0x42, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x00, 0x09, 0xe6, 0x42, 0x09, 0xe7, 0x41, 0x09, 0xe6, 
+  0x41, 0x09, 0xe7, 0x00, 0x01, 0xe7, 0x85, 0x84, 0x00, 0x09, 0xe6, 0x86, 0x02, 0x09, 0xe6, 0x01, 
+  0xe7, 0x09, 0xe7, 0x80, 0x41, 0x09, 0xe7, 0x01, 0x09, 0xc6, 0x09, 0xe7, 0x81, 0x41, 0x09, 0xe6, 
+  0x41, 0x09, 0xe7, 0x80, 0x02, 0x01, 0xe6, 0x01, 0xe7, 0x09, 0xe7, 0x80, 0x0d, 0x09, 0xc6, 0x01, 
+  0xc6, 0x01, 0xa6, 0x01, 0x03, 0x63, 0xce, 0xdf, 0x5d, 0xcf, 0x3c, 0xcf, 0x1b, 0xd7, 0x3c, 0xdf, 
+  0x7d, 0x9d, 0x75, 0x19, 0xa6, 0x01, 0x85, 0x09, 0xe7, 0x41, 0x01, 0xc6, 0x44, 0x09, 0xc6, 0x41, 
+  0x09, 0xe7, 0x00, 0x09, 0xc7, 0x43, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x4a, 0x09, 0xe7, 0x00, 0x0a, 
+  0x27, 0x41, 0x1a, 0xc8, 0x13, 0x0a, 0x07, 0x01, 0xc6, 0x12, 0x47, 0x23, 0x08, 0x1a, 0x47, 0x09, 
+  0xc5, 0x09, 0xe6, 0x01, 0xc6, 0x12, 0x66, 0x23, 0x48, 0x12, 0xa7, 0x02, 0x06, 0x09, 0xe7, 0x09, 
+  0xc7, 0x09, 0xc6, 0x01, 0x24, 0x00, 0x40, 0x00, 0xa2, 0x1a, 0xc7, 0x0a, 0x47, 0x82, 0x00, 0x01, 
+  0xa5, 0x80, 0x00, 0x0a, 0x87, 0x84, 0x02, 0x01, 0xa5, 0x1a, 0xc7, 0x12, 0x87, 0x80, 0x01, 0x09, 
+  0xe7, 0x0a, 0x07, 0x80, 0x00, 0x12, 0x87, 0x81, 0x00, 0x09, 0xc6, 0x80, 0x00, 0x0a, 0x87, 0x80, 
+  0x0f, 0x09, 0xe7, 0x01, 0xe6, 0x12, 0x47, 0x00, 0xe2, 0x00, 0x81, 0x09, 0xa5, 0x09, 0xc6, 0x12, 
+  0x87, 0x1a, 0xc7, 0x01, 0x03, 0x00, 0x81, 0x09, 0x24, 0x09, 0xe7, 0x0a, 0x07, 0x09, 0xc6, 0x00, 
+  0x81, 0x43, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x61, 0x00, 0xc2, 0x09, 0x02, 0x00, 0xa1, 0x00, 
+  0xc2, 0x09, 0xa5, 0x01, 0xa5, 0x12, 0x06, 0x12, 0x47, 0x09, 0xc6, 0x09, 0xe6, 0x02, 0x27, 0x0a, 
+  0x47, 0x01, 0x43, 0x00, 0x40, 0x00, 0x20, 0x41, 0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x40, 0x41, 
+  0x00, 0x81, 0x05, 0x00, 0x60, 0x00, 0x81, 0x09, 0x84, 0x01, 0xc5, 0x01, 0xa5, 0x01, 0xc5, 0x41, 
+  0x01, 0xc6, 0x41, 0x01, 0xc5, 0x41, 0x01, 0xc6, 0x00, 0x01, 0xe5, 0x44, 0x01, 0xc5, 0x41, 0x01, 
+  0xe5, 0x42, 0x01, 0xe6, 0x4a, 0x01, 0xc5, 0x01, 0x01, 0xc6, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x47, 
+  0x01, 0xe6, 0x04, 0x01, 0xc5, 0x01, 0xe5, 0x1a, 0xe7, 0x23, 0x48, 0x0a, 0x26, 0x80, 0x04, 0x02, 
+  0x06, 0x1a, 0xc7, 0x1a, 0xa7, 0x01, 0xc6, 0x09, 0xe7, 0x82, 0x01, 0x09, 0xe6, 0x09, 0xc6, 0x81, 
+  0x00, 0x09, 0xc6, 0x43, 0x09, 0xe6, 0x01, 0x01, 0xe6, 0x01, 0xe7, 0x83, 0x00, 0x0a, 0x07, 0x82, 
+  0x00, 0x01, 0xe6, 0x81, 0x00, 0x01, 0xe6, 0x85, 0x00, 0x01, 0xe6, 0x44, 0x09, 0xe6, 0x41, 0x09, 
+  0xc6, 0x41, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x82, 0x41, 0x09, 0xe6, 0x41, 0x09, 0xc6, 0x0b, 0x01, 
+  0x24, 0x4b, 0x4d, 0xa5, 0xd7, 0xbe, 0xba, 0xd7, 0x3c, 0xcf, 0x1c, 0xd7, 0x5d, 0xd7, 0x1c, 0xae, 
+  0x17, 0x19, 0xc6, 0x01, 0x85, 0x09, 0xe6, 0x43, 0x09, 0xc6, 0x41, 0x09, 0xc7, 0x80, 0x00, 0x09, 
+  0xc7, 0x80, 0x00, 0x09, 0xc7, 0x42, 0x09, 0xe7, 0x00, 0x01, 0xe7, 0x87, 0x00, 0x09, 0xe6, 0x80, 
+  0x00, 0x09, 0xc7, 0x42, 0x09, 0xe6, 0x00, 0x12, 0x87, 0x80, 0x04, 0x0a, 0x07, 0x09, 0xe6, 0x12, 
+  0x47, 0x22, 0xe8, 0x12, 0x46, 0x41, 0x09, 0xe6, 0x04, 0x09, 0xc5, 0x12, 0x46, 0x23, 0x28, 0x1b, 
+  0x07, 0x0a, 0x46, 0x41, 0x09, 0xe6, 0x80, 0x00, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x01, 0x01, 0xe6, 
+  0x1b, 0x08, 0x82, 0x00, 0x1a, 0xe8, 0x81, 0x00, 0x12, 0x87, 0x80, 0x01, 0x0a, 0x26, 0x1b, 0x28, 
+  0x82, 0x00, 0x12, 0xc7, 0x80, 0x00, 0x01, 0xa6, 0x41, 0x0a, 0x07, 0x00, 0x09, 0xe7, 0x80, 0x00, 
+  0x12, 0xc7, 0x80, 0x01, 0x09, 0xe6, 0x09, 0xc6, 0x41, 0x0a, 0x07, 0x0c, 0x09, 0xe6, 0x12, 0x67, 
+  0x1a, 0x87, 0x12, 0x07, 0x09, 0xe6, 0x01, 0xa5, 0x12, 0x87, 0x1b, 0x28, 0x0a, 0x67, 0x0a, 0x27, 
+  0x0a, 0x07, 0x09, 0xe7, 0x09, 0xe6, 0x43, 0x09, 0xc6, 0x06, 0x09, 0xe7, 0x09, 0xc6, 0x09, 0xe7, 
+  0x0a, 0x07, 0x0a, 0x87, 0x23, 0x28, 0x1a, 0xa7, 0x41, 0x0a, 0x27, 0x03, 0x09, 0xc5, 0x1a, 0x47, 
+  0x12, 0x47, 0x09, 0xc6, 0x41, 0x0a, 0x07, 0x03, 0x12, 0xa8, 0x1b, 0x28, 0x1b, 0x08, 0x1a, 0xc8, 
+  0x42, 0x1a, 0xa7, 0x01, 0x1a, 0xc8, 0x1b, 0x08, 0x41, 0x23, 0x48, 0x00, 0x23, 0x08, 0x41, 0x1b, 
+  0x08, 0x07, 0x1a, 0xe8, 0x1b, 0x08, 0x1b, 0x09, 0x1a, 0xe8, 0x1b, 0x09, 0x23, 0x29, 0x1b, 0x08, 
+  0x23, 0x08, 0x44, 0x1b, 0x08, 0x41, 0x1b, 0x09, 0x41, 0x1b, 0x08, 0x02, 0x1b, 0x09, 0x23, 0x29, 
+  0x23, 0x09, 0x46, 0x23, 0x08, 0x06, 0x23, 0x09, 0x23, 0x08, 0x23, 0x09, 0x23, 0x08, 0x1b, 0x08, 
+  0x1b, 0x29, 0x1b, 0x09, 0x43, 0x23, 0x09, 0x42, 0x23, 0x08, 0x01, 0x23, 0x09, 0x12, 0x87, 0x42, 
+  0x01, 0xc5, 0x04, 0x12, 0xa7, 0x23, 0x48, 0x12, 0x86, 0x01, 0xe6, 0x02, 0x26, 0x41, 0x12, 0xa7, 
+  0x01, 0x01, 0xe5, 0x01, 0xc6, 0x44, 0x09, 0xe6, 0x80, 0x01, 0x09, 0xe6, 0x09, 0xe7, 0x81, 0x47, 
+  0x09, 0xe7, 0x85, 0x00, 0x01, 0xc6, 0x81, 0x00, 0x0a, 0x07, 0x42, 0x09, 0xe6, 0x43, 0x01, 0xe6, 
+  0x80, 0x01, 0x09, 0xc6, 0x09, 0xe7, 0x43, 0x09, 0xe6, 0x81, 0x02, 0x01, 0xe7, 0x01, 0xe6, 0x01, 
+  0xe7, 0x82, 0x0b, 0x01, 0x03, 0x3a, 0xeb, 0xc6, 0xdb, 0xd7, 0x5c, 0xcf, 0x1b, 0xc6, 0xfb, 0xdf, 
+  0x9d, 0xae, 0x17, 0x2a, 0x69, 0x1a, 0x28, 0x09, 0xc6, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x81, 0x00, 
+  0x09, 0xc7, 0x41, 0x09, 0xc6, 0x41, 0x09, 0xc7, 0x00, 0x09, 0xc6, 0x43, 0x09, 0xe7, 0x41, 0x09, 
+  0xe6, 0x80, 0x41, 0x09, 0xe6, 0x81, 0x00, 0x09, 0xe6, 0x41, 0x0a, 0x07, 0x42, 0x09, 0xe7, 0x80, 
+  0x08, 0x12, 0x67, 0x1a, 0x87, 0x0a, 0x07, 0x0a, 0x27, 0x12, 0x88, 0x2b, 0x49, 0x1a, 0xa7, 0x0a, 
+  0x06, 0x0a, 0x27, 0x80, 0x04, 0x0a, 0x46, 0x22, 0xc7, 0x09, 0xa4, 0x01, 0x63, 0x01, 0xa5, 0x43, 
+  0x09, 0xe7, 0x80, 0x00, 0x09, 0xc6, 0x80, 0x00, 0x1b, 0x28, 0x81, 0x00, 0x0a, 0x47, 0x81, 0x00, 
+  0x12, 0xc7, 0x85, 0x00, 0x01, 0x85, 0x80, 0x00, 0x12, 0x86, 0x80, 0x00, 0x09, 0xe7, 0x81, 0x01, 
+  0x12, 0xa8, 0x1b, 0x08, 0x41, 0x0a, 0x07, 0x41, 0x09, 0xe7, 0x09, 0x09, 0xe6, 0x12, 0x67, 0x1a, 
+  0xa7, 0x01, 0x44, 0x01, 0x03, 0x09, 0x85, 0x09, 0xa5, 0x1a, 0xe8, 0x12, 0x88, 0x0a, 0x28, 0x41, 
+  0x0a, 0x07, 0x01, 0x12, 0x07, 0x09, 0xe7, 0x80, 0x14, 0x09, 0xc7, 0x09, 0xe7, 0x01, 0xa6, 0x01, 
+  0x44, 0x01, 0xc6, 0x0a, 0x27, 0x0a, 0x88, 0x23, 0x29, 0x12, 0x67, 0x0a, 0x27, 0x09, 0x85, 0x00, 
+  0xe3, 0x01, 0x44, 0x09, 0x64, 0x01, 0x03, 0x01, 0x64, 0x0a, 0x06, 0x1a, 0xe9, 0x1a, 0xe8, 0x0a, 
+  0x06, 0x09, 0xc5, 0x43, 0x01, 0xa5, 0x01, 0x09, 0xc5, 0x0a, 0x06, 0x41, 0x0a, 0x26, 0x41, 0x0a, 
+  0x06, 0x08, 0x09, 0xe6, 0x09, 0xe5, 0x01, 0x84, 0x01, 0x64, 0x09, 0xe5, 0x01, 0x84, 0x01, 0x63, 
+  0x09, 0xe5, 0x09, 0xe6, 0x41, 0x09, 0xe5, 0x01, 0x01, 0xe5, 0x01, 0xe6, 0x42, 0x01, 0xe5, 0x01, 
+  0x01, 0xe6, 0x01, 0xe5, 0x43, 0x01, 0xe6, 0x47, 0x01, 0xe5, 0x42, 0x01, 0xe6, 0x41, 0x01, 0xe5, 
+  0x42, 0x02, 0x06, 0x41, 0x01, 0xe6, 0x00, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x00, 0x09, 0xe5, 0x41, 
+  0x0a, 0x06, 0x41, 0x01, 0xc5, 0x02, 0x12, 0xa7, 0x2b, 0x69, 0x12, 0x86, 0x41, 0x02, 0x06, 0x05, 
+  0x1a, 0xc7, 0x12, 0x87, 0x09, 0xe6, 0x01, 0xc6, 0x09, 0xc6, 0x09, 0xe7, 0x83, 0x00, 0x09, 0xe6, 
+  0x42, 0x09, 0xe7, 0x42, 0x09, 0xe6, 0x83, 0x88, 0x00, 0x0a, 0x06, 0x41, 0x01, 0xe6, 0x82, 0x42, 
+  0x09, 0xe6, 0x42, 0x09, 0xc6, 0x81, 0x00, 0x01, 0xe6, 0x41, 0x01, 0xe7, 0x00, 0x01, 0xe6, 0x41, 
+  0x09, 0xe6, 0x41, 0x0a, 0x07, 0x09, 0x01, 0x85, 0x4b, 0x4c, 0xc6, 0xda, 0xc6, 0xfb, 0xc6, 0xdb, 
+  0xcf, 0x1c, 0xdf, 0x9e, 0xbe, 0x79, 0x32, 0x89, 0x01, 0x85, 0x43, 0x09, 0xe6, 0x00, 0x09, 0xc6, 
+  0x41, 0x09, 0xe6, 0x48, 0x09, 0xc6, 0x83, 0x00, 0x09, 0xe7, 0x82, 0x01, 0x09, 0xc6, 0x01, 0x03, 
+  0x41, 0x00, 0xa2, 0x41, 0x00, 0xc2, 0x07, 0x09, 0xa5, 0x1a, 0xa8, 0x0a, 0x27, 0x09, 0x85, 0x00, 
+  0xa2, 0x01, 0x43, 0x01, 0x23, 0x00, 0xa2, 0x41, 0x00, 0x81, 0x06, 0x01, 0x23, 0x23, 0x28, 0x12, 
+  0x05, 0x18, 0xc3, 0x39, 0xc7, 0x11, 0x03, 0x09, 0xa6, 0x44, 0x09, 0xe7, 0x83, 0x04, 0x0a, 0x26, 
+  0x1a, 0xc8, 0x01, 0x85, 0x12, 0xe7, 0x0a, 0x66, 0x82, 0x00, 0x02, 0x06, 0x80, 0x00, 0x01, 0xa5, 
+  0x80, 0x02, 0x12, 0x87, 0x01, 0xc6, 0x0a, 0x07, 0x41, 0x09, 0xe7, 0x01, 0x12, 0x26, 0x01, 0x23, 
+  0x41, 0x00, 0x41, 0x01, 0x00, 0xa2, 0x09, 0xc6, 0x41, 0x1a, 0xa7, 0x05, 0x09, 0x03, 0x42, 0x28, 
+  0x39, 0xe7, 0x00, 0xe3, 0x09, 0xe6, 0x12, 0x26, 0x41, 0x00, 0x81, 0x41, 0x00, 0xa2, 0x0d, 0x00, 
+  0x81, 0x00, 0x41, 0x01, 0x03, 0x09, 0xe7, 0x09, 0xa6, 0x19, 0x24, 0x42, 0x28, 0x21, 0x65, 0x0a, 
+  0x06, 0x23, 0x29, 0x12, 0x88, 0x0a, 0x06, 0x00, 0xc2, 0x08, 0x61, 0x42, 0x29, 0x65, 0x41, 0x31, 
+  0xa6, 0x05, 0x08, 0xc2, 0x11, 0x84, 0x12, 0x06, 0x09, 0xc6, 0x09, 0xa5, 0x0a, 0x06, 0x41, 0x0a, 
+  0x26, 0x02, 0x0a, 0x67, 0x09, 0x84, 0x00, 0x61, 0x41, 0x00, 0x81, 0x00, 0x00, 0x61, 0x41, 0x00, 
+  0x41, 0x07, 0x00, 0xa2, 0x29, 0x86, 0x39, 0xc7, 0x00, 0x61, 0x29, 0x85, 0x39, 0xe7, 0x09, 0x03, 
+  0x0a, 0x26, 0x48, 0x0a, 0x46, 0x00, 0x0a, 0x47, 0x43, 0x0a, 0x46, 0x00, 0x0a, 0x26, 0x48, 0x0a, 
+  0x46, 0x41, 0x0a, 0x47, 0x41, 0x0a, 0x46, 0x42, 0x0a, 0x47, 0x01, 0x0a, 0x46, 0x0a, 0x47, 0x41, 
+  0x0a, 0x26, 0x07, 0x1a, 0xe8, 0x23, 0x28, 0x0a, 0x46, 0x01, 0xe6, 0x02, 0x06, 0x1b, 0x08, 0x2b, 
+  0x68, 0x0a, 0x66, 0x80, 0x04, 0x01, 0xe6, 0x12, 0xa7, 0x1a, 0x87, 0x01, 0xc5, 0x01, 0xa5, 0x42, 
+  0x01, 0xa6, 0x41, 0x01, 0xa5, 0x41, 0x01, 0xc6, 0x02, 0x01, 0xa6, 0x01, 0xc6, 0x01, 0xa5, 0x45, 
+  0x01, 0xc6, 0x80, 0x00, 0x0a, 0x47, 0x81, 0x01, 0x09, 0xe6, 0x09, 0xe7, 0x82, 0x00, 0x0a, 0x07, 
+  0x41, 0x01, 0xe7, 0x41, 0x09, 0xe6, 0x83, 0x00, 0x01, 0xe6, 0x80, 0x43, 0x09, 0xe6, 0x01, 0x01, 
+  0xe6, 0x09, 0xe6, 0x81, 0x0b, 0x09, 0xe7, 0x01, 0xc6, 0x01, 0x65, 0x43, 0x2b, 0xcf, 0x1b, 0xcf, 
+  0x3c, 0xc6, 0xdb, 0xcf, 0x5c, 0xae, 0x38, 0x8d, 0x34, 0x32, 0x89, 0x01, 0x44, 0x41, 0x09, 0xe6, 
+  0x01, 0x09, 0xe7, 0x01, 0xe6, 0x43, 0x09, 0xe7, 0x80, 0x01, 0x09, 0xc7, 0x09, 0xe7, 0x80, 0x00, 
+  0x09, 0xe6, 0x41, 0x09, 0xe7, 0x00, 0x09, 0xe6, 0x81, 0x44, 0x09, 0xe7, 0x0f, 0x09, 0xe6, 0x0a, 
+  0x07, 0x01, 0x24, 0x42, 0x08, 0x63, 0x0c, 0x62, 0xeb, 0x63, 0x0b, 0x63, 0x0c, 0x18, 0xe3, 0x01, 
+  0x64, 0x09, 0xc6, 0x21, 0x65, 0x94, 0x91, 0x8c, 0x71, 0x8c, 0x51, 0x94, 0x91, 0x41, 0x8c, 0x71, 
+  0x07, 0x52, 0xaa, 0x09, 0xa4, 0x00, 0xe2, 0x63, 0x0c, 0xff, 0xff, 0x5a, 0xcb, 0x00, 0xe3, 0x0a, 
+  0x07, 0x83, 0x00, 0x01, 0xe7, 0x82, 0x00, 0x0a, 0x27, 0x80, 0x06, 0x01, 0xa5, 0x09, 0x64, 0x10, 
+  0xe3, 0x00, 0xc3, 0x0a, 0x06, 0x1b, 0x08, 0x09, 0xe6, 0x81, 0x00, 0x12, 0xe7, 0x81, 0x00, 0x01, 
+  0xe7, 0x80, 0x02, 0x09, 0x85, 0x00, 0x61, 0x84, 0x0f, 0x41, 0xad, 0x34, 0x1b, 0x63, 0x2c, 0x00, 
+  0x61, 0x1a, 0x67, 0x09, 0xa5, 0x00, 0x41, 0xe7, 0x3b, 0xe7, 0x3c, 0x08, 0xa2, 0x01, 0xc5, 0x29, 
+  0xa6, 0x94, 0x92, 0x94, 0xb2, 0x9c, 0xd2, 0x9c, 0xb2, 0x94, 0x71, 0x8c, 0x51, 0x29, 0x45, 0x09, 
+  0x85, 0x01, 0x03, 0x6b, 0x4d, 0xff, 0xff, 0x6b, 0x4d, 0x01, 0xe4, 0x13, 0x09, 0x02, 0x27, 0x00, 
+  0xc2, 0x4a, 0x28, 0xce, 0x58, 0x44, 0xff, 0xff, 0x0b, 0xce, 0x59, 0x42, 0x07, 0x00, 0x40, 0x11, 
+  0xc5, 0x12, 0x47, 0x1a, 0xa7, 0x1a, 0xc7, 0x1a, 0xe8, 0x1b, 0x08, 0x19, 0x64, 0xbd, 0x96, 0xd6, 
+  0xba, 0x41, 0xde, 0xda, 0x0a, 0xce, 0x59, 0x94, 0x91, 0x00, 0x00, 0xc6, 0x38, 0xf7, 0xbe, 0x00, 
+  0x00, 0xb5, 0x96, 0xff, 0xff, 0x19, 0x24, 0x12, 0x87, 0x1b, 0x08, 0x52, 0x1a, 0xe8, 0x00, 0x1b, 
+  0x08, 0x4b, 0x1a, 0xe8, 0x0a, 0x1a, 0xc8, 0x0a, 0x06, 0x01, 0xc5, 0x0a, 0x46, 0x23, 0x08, 0x0a, 
+  0x05, 0x01, 0xe5, 0x02, 0x05, 0x1a, 0xc6, 0x2b, 0x89, 0x0a, 0x66, 0x80, 0x01, 0x01, 0xc6, 0x12, 
+  0x46, 0x46, 0x12, 0x87, 0x48, 0x12, 0xa7, 0x01, 0x12, 0x87, 0x1a, 0x87, 0x82, 0x00, 0x01, 0xc6, 
+  0x41, 0x09, 0xe7, 0x81, 0x01, 0x1b, 0x28, 0x0a, 0x06, 0x43, 0x09, 0xe6, 0x82, 0x00, 0x09, 0xc6, 
+  0x41, 0x01, 0xe6, 0x80, 0x00, 0x01, 0xe6, 0x43, 0x09, 0xe6, 0x80, 0x0d, 0x0a, 0x07, 0x01, 0x85, 
+  0x43, 0x4c, 0x6c, 0x91, 0xc6, 0xdb, 0xd7, 0x5d, 0xcf, 0x1b, 0xcf, 0x5c, 0xb6, 0x79, 0x3a, 0xca, 
+  0x01, 0x24, 0x09, 0x85, 0x09, 0xa6, 0x09, 0xc6, 0x41, 0x09, 0xe6, 0x80, 0x00, 0x01, 0xc5, 0x46, 
+  0x01, 0xc6, 0x41, 0x01, 0xc5, 0x41, 0x01, 0xc6, 0x41, 0x01, 0xc5, 0x42, 0x01, 0xc6, 0x06, 0x01, 
+  0xe6, 0x01, 0xc6, 0x01, 0xc5, 0x02, 0x06, 0x00, 0x81, 0xbd, 0xd6, 0xff, 0xff, 0x41, 0xff, 0xde, 
+  0x04, 0xff, 0xff, 0xce, 0x79, 0x18, 0xe3, 0x00, 0xe2, 0x31, 0xc6, 0x44, 0xff, 0xde, 0x03, 0xff, 
+  0xff, 0x9c, 0xd3, 0x00, 0x81, 0x00, 0xc2, 0x81, 0x01, 0x52, 0xaa, 0x00, 0xc2, 0x44, 0x09, 0xe7, 
+  0x00, 0x01, 0xe6, 0x82, 0x00, 0x12, 0x27, 0x80, 0x06, 0x01, 0x23, 0x31, 0xa6, 0xef, 0x7d, 0x52, 
+  0xaa, 0x00, 0x81, 0x12, 0xc7, 0x01, 0xe6, 0x81, 0x00, 0x1a, 0xe7, 0x81, 0x0a, 0x0a, 0x07, 0x09, 
+  0xc6, 0x08, 0xa2, 0xa5, 0x13, 0xff, 0xff, 0xe7, 0x1b, 0xef, 0x5c, 0xff, 0xff, 0x52, 0x8a, 0x00, 
+  0x20, 0x09, 0x64, 0x80, 0x02, 0xde, 0xda, 0xde, 0xfb, 0x08, 0xc2, 0x80, 0x0a, 0x39, 0xe7, 0xff, 
+  0xde, 0xf7, 0xbe, 0xff, 0xbe, 0xf7, 0xbd, 0xff, 0xdd, 0xff, 0xff, 0x4a, 0x69, 0x00, 0xa2, 0x00, 
+  0x81, 0x63, 0x2c, 0x81, 0x11, 0x02, 0x04, 0x1b, 0x49, 0x01, 0x03, 0x63, 0x2c, 0xff, 0xff, 0xde, 
+  0xfb, 0x63, 0x0c, 0x63, 0x2c, 0x6b, 0x4d, 0x6b, 0x6d, 0x73, 0xae, 0xef, 0x5c, 0xff, 0xde, 0x4a, 
+  0x28, 0x09, 0x23, 0x1a, 0x87, 0x09, 0xa5, 0x09, 0xc6, 0x41, 0x01, 0xe6, 0x06, 0x11, 0x24, 0xf7, 
+  0xbe, 0xe7, 0x5c, 0x9c, 0xf3, 0xa5, 0x13, 0xff, 0xff, 0xce, 0x79, 0x80, 0x01, 0xc6, 0x17, 0xef, 
+  0x7d, 0x80, 0x00, 0xa5, 0x34, 0x80, 0x01, 0x19, 0x03, 0x01, 0x44, 0x43, 0x01, 0xc5, 0x47, 0x01, 
+  0xa5, 0x41, 0x01, 0xc5, 0x42, 0x01, 0xa5, 0x47, 0x01, 0xc5, 0x49, 0x01, 0xa5, 0x0f, 0x01, 0xc6, 
+  0x01, 0xc5, 0x0a, 0x46, 0x1b, 0x07, 0x0a, 0x26, 0x01, 0xe6, 0x02, 0x05, 0x1a, 0xe7, 0x23, 0x28, 
+  0x01, 0xe5, 0x01, 0xe6, 0x01, 0xc6, 0x12, 0x67, 0x1a, 0xc8, 0x1a, 0xc7, 0x1a, 0xc8, 0x49, 0x1a, 
+  0xe8, 0x00, 0x22, 0xe8, 0x41, 0x1a, 0xc8, 0x00, 0x22, 0xc8, 0x80, 0x00, 0x0a, 0x67, 0x81, 0x00, 
+  0x09, 0xe6, 0x82, 0x01, 0x1b, 0x08, 0x0a, 0x07, 0x81, 0x00, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x01, 
+  0x01, 0xe7, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x42, 0x01, 0xe6, 0x41, 0x09, 0xe7, 0x80, 0x05, 0x09, 
+  0xc6, 0x09, 0xe7, 0x01, 0x85, 0x53, 0xae, 0xd7, 0x1c, 0xe7, 0xbe, 0x41, 0xd7, 0x3c, 0x04, 0xdf, 
+  0x7d, 0xbe, 0xba, 0x2a, 0x69, 0x01, 0x64, 0x0a, 0x07, 0x41, 0x09, 0xe7, 0x80, 0x02, 0x09, 0xe7, 
+  0x01, 0xc6, 0x0a, 0x46, 0x4a, 0x1a, 0xe8, 0x02, 0x1a, 0xe7, 0x12, 0xe8, 0x1a, 0xe8, 0x41, 0x1b, 
+  0x08, 0x00, 0x1a, 0xe7, 0x42, 0x12, 0xe7, 0x0b, 0x1b, 0x08, 0x01, 0x02, 0xbd, 0xb6, 0xef, 0x5c, 
+  0x21, 0x04, 0x18, 0xe3, 0x39, 0xe7, 0xef, 0x7d, 0xb5, 0x95, 0x00, 0x81, 0x09, 0x23, 0x10, 0xc2, 
+  0x41, 0x10, 0xc3, 0x04, 0x08, 0x82, 0x21, 0x24, 0xff, 0xdf, 0x9c, 0xb2, 0x00, 0xa1, 0x80, 0x00, 
+  0x63, 0x2c, 0x80, 0x00, 0x52, 0x8a, 0x84, 0x00, 0x0a, 0x07, 0x83, 0x09, 0x0a, 0x47, 0x1a, 0xe8, 
+  0x01, 0x64, 0x18, 0xe3, 0xbd, 0xf7, 0xff, 0xff, 0x4a, 0x28, 0x00, 0x81, 0x09, 0xe6, 0x01, 0xc6, 
+  0x80, 0x01, 0x1a, 0xe8, 0x12, 0xa7, 0x81, 0x0c, 0x00, 0xa1, 0x73, 0x8d, 0xff, 0xff, 0x94, 0xb2, 
+  0x00, 0x00, 0x19, 0x03, 0xe6, 0xfb, 0xef, 0x7d, 0x39, 0xe7, 0x00, 0xc2, 0x08, 0xa2, 0xde, 0xfb, 
+  0xe6, 0xfb, 0x80, 0x02, 0x0a, 0x67, 0x11, 0xe5, 0x08, 0xc2, 0x41, 0x08, 0xa2, 0x06, 0x08, 0x41, 
+  0x63, 0x2c, 0xff, 0xdf, 0x4a, 0x48, 0x08, 0x82, 0x10, 0x82, 0x73, 0xae, 0x81, 0x00, 0x01, 0xe4, 
+  0x80, 0x14, 0x00, 0x81, 0xbd, 0xd6, 0xff, 0xde, 0x10, 0x82, 0x00, 0x00, 0x00, 0xa1, 0x09, 0x63, 
+  0x01, 0x02, 0x00, 0x00, 0x21, 0x04, 0xff, 0xff, 0xad, 0x54, 0x00, 0x20, 0x0a, 0x06, 0x0a, 0x07, 
+  0x0a, 0x06, 0x12, 0xc8, 0x1a, 0xe8, 0x11, 0x44, 0xf7, 0x9d, 0xa5, 0x14, 0x41, 0x00, 0x00, 0x01, 
+  0xde, 0xda, 0xc6, 0x38, 0x81, 0x08, 0xf7, 0xbe, 0x63, 0x0b, 0xce, 0x79, 0xff, 0xdf, 0x21, 0x44, 
+  0x12, 0x66, 0x1b, 0x08, 0x1a, 0xe8, 0x1b, 0x08, 0x4b, 0x1a, 0xe8, 0x00, 0x1b, 0x08, 0x52, 0x1a, 
+  0xe8, 0x00, 0x0a, 0x66, 0x41, 0x01, 0xe5, 0x08, 0x12, 0x87, 0x12, 0xc7, 0x02, 0x26, 0x01, 0xe6, 
+  0x02, 0x06, 0x1a, 0xc7, 0x1a, 0xe8, 0x0a, 0x26, 0x01, 0xe6, 0x41, 0x01, 0xc6, 0x05, 0x01, 0xa5, 
+  0x01, 0xa6, 0x01, 0x85, 0x01, 0xa5, 0x01, 0xc6, 0x01, 0xc5, 0x48, 0x01, 0xc6, 0x00, 0x01, 0xc5, 
+  0x83, 0x01, 0x09, 0xe7, 0x09, 0xe6, 0x81, 0x00, 0x23, 0x28, 0x80, 0x01, 0x09, 0xe7, 0x01, 0xe6, 
+  0x41, 0x09, 0xe6, 0x00, 0x09, 0xe7, 0x41, 0x01, 0xe6, 0x44, 0x09, 0xe6, 0x00, 0x09, 0xc6, 0x42, 
+  0x09, 0xe6, 0x04, 0x01, 0x44, 0x42, 0xeb, 0xbe, 0xda, 0xd7, 0x5d, 0xce, 0xfb, 0x80, 0x05, 0xdf, 
+  0x9d, 0xc6, 0xba, 0x3b, 0x0b, 0x01, 0x85, 0x09, 0xe6, 0x01, 0xc6, 0x41, 0x09, 0xc6, 0x41, 0x01, 
+  0xc6, 0x02, 0x0a, 0x26, 0x1a, 0xc7, 0x12, 0x87, 0x41, 0x12, 0xa7, 0x43, 0x12, 0x87, 0x01, 0x12, 
+  0xa7, 0x12, 0x87, 0x48, 0x12, 0xa7, 0x41, 0x12, 0x87, 0x0a, 0x12, 0xc7, 0x00, 0xe2, 0xbd, 0xd6, 
+  0xef, 0x5d, 0x08, 0xc2, 0x09, 0xe5, 0x00, 0x00, 0xbd, 0xd6, 0xef, 0x3c, 0x00, 0xa2, 0x01, 0x84, 
+  0x42, 0x01, 0x03, 0x05, 0x00, 0xa1, 0x08, 0xa2, 0xff, 0xff, 0xa4, 0xf3, 0x00, 0xc2, 0x00, 0xe2, 
+  0x86, 0x41, 0x0a, 0x07, 0x04, 0x0a, 0x27, 0x23, 0x49, 0x0a, 0x67, 0x01, 0xc6, 0x12, 0x47, 0x80, 
+  0x07, 0x01, 0xa5, 0x09, 0x63, 0x00, 0x61, 0xad, 0x75, 0xf7, 0xbe, 0x42, 0x08, 0x00, 0x20, 0x09, 
+  0xc6, 0x80, 0x00, 0x12, 0xe7, 0x81, 0x0d, 0x09, 0xe7, 0x00, 0x20, 0xa5, 0x13, 0xf7, 0xbe, 0x18, 
+  0xe3, 0x01, 0x03, 0x00, 0xa2, 0x5a, 0xcb, 0xff, 0xff, 0x6b, 0x4c, 0x00, 0xa1, 0x08, 0xe3, 0xe6, 
+  0xfb, 0xe7, 0x1b, 0x80, 0x0b, 0x0a, 0x47, 0x23, 0xa9, 0x01, 0xe5, 0x01, 0x65, 0x09, 0x85, 0x00, 
+  0x00, 0x63, 0x0b, 0xff, 0xff, 0x52, 0x89, 0xd6, 0x79, 0xff, 0xff, 0xff, 0xde, 0x81, 0x0b, 0x01, 
+  0xc3, 0x1b, 0x08, 0x00, 0x61, 0x9c, 0xd2, 0xff, 0xff, 0x7b, 0xef, 0x18, 0xe3, 0x21, 0x64, 0x21, 
+  0x85, 0x19, 0x23, 0x18, 0xe3, 0x94, 0x91, 0x80, 0x01, 0x8c, 0x71, 0x00, 0x61, 0x41, 0x0a, 0x07, 
+  0x03, 0x1a, 0xc8, 0x1b, 0x08, 0x12, 0x87, 0x11, 0x23, 0x80, 0x04, 0xad, 0x34, 0x00, 0x61, 0x08, 
+  0xe3, 0xde, 0xfb, 0xce, 0x58, 0x80, 0x00, 0xbd, 0xd6, 0x42, 0xff, 0xff, 0x03, 0xf7, 0x9e, 0x21, 
+  0x65, 0x0a, 0x46, 0x12, 0xa7, 0x60, 0x12, 0x87, 0x80, 0x01, 0x2b, 0x89, 0x12, 0x87, 0x80, 0x09, 
+  0x01, 0xe6, 0x0a, 0x46, 0x1a, 0xc7, 0x0a, 0x06, 0x01, 0xc6, 0x01, 0xe5, 0x12, 0x87, 0x1b, 0x08, 
+  0x0a, 0x46, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x05, 0x01, 0xa4, 0x3b, 0x2b, 0x22, 0xa9, 0x01, 0xa5, 
+  0x01, 0xe5, 0x01, 0xe6, 0x80, 0x00, 0x01, 0xe6, 0x82, 0x00, 0x01, 0xe6, 0x42, 0x09, 0xe6, 0x81, 
+  0x01, 0x1b, 0x28, 0x01, 0xe6, 0x85, 0x42, 0x09, 0xe6, 0x01, 0x01, 0xe6, 0x01, 0xe7, 0x42, 0x01, 
+  0xe6, 0x82, 0x0e, 0x09, 0xe7, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0xa6, 0x01, 0x64, 0x32, 0x89, 0xbe, 
+  0xda, 0xcf, 0x3c, 0xcf, 0x1b, 0xd7, 0x3c, 0xdf, 0x7d, 0xbe, 0xba, 0x2a, 0xca, 0x01, 0xc6, 0x0a, 
+  0x07, 0x42, 0x09, 0xc6, 0x41, 0x01, 0xc6, 0x04, 0x0a, 0x06, 0x1a, 0xc8, 0x0a, 0x06, 0x01, 0xa6, 
+  0x01, 0xc6, 0x43, 0x01, 0xa6, 0x4d, 0x01, 0xc6, 0x05, 0x01, 0xe6, 0x00, 0x81, 0xbd, 0xf7, 0xef, 
+  0x7d, 0x00, 0x00, 0x00, 0x20, 0x80, 0x04, 0xce, 0x79, 0xd6, 0x99, 0x00, 0x40, 0x10, 0xe3, 0x29, 
+  0x85, 0x41, 0x29, 0x86, 0x01, 0x29, 0x65, 0x42, 0x08, 0x81, 0x02, 0x00, 0xe2, 0x01, 0x23, 0x6b, 
+  0x2c, 0x80, 0x00, 0x52, 0xaa, 0x80, 0x00, 0x0a, 0x07, 0x83, 0x0e, 0x01, 0xa5, 0x12, 0x86, 0x01, 
+  0xe5, 0x01, 0x64, 0x09, 0xc5, 0x12, 0x45, 0x01, 0x43, 0x1a, 0xa7, 0x09, 0x84, 0x00, 0x20, 0xad, 
+  0x55, 0xf7, 0xbe, 0x4a, 0x28, 0x00, 0x20, 0x01, 0xc5, 0x80, 0x00, 0x12, 0x87, 0x80, 0x07, 0x09, 
+  0xe6, 0x00, 0x40, 0xce, 0x58, 0xef, 0x7d, 0x08, 0x61, 0x09, 0x64, 0x01, 0x43, 0x21, 0x45, 0x80, 
+  0x02, 0x73, 0xae, 0x00, 0x20, 0x08, 0xa2, 0x41, 0xe7, 0x1b, 0x05, 0x08, 0xa2, 0x0a, 0x26, 0x1a, 
+  0x66, 0x00, 0x81, 0x00, 0x41, 0x00, 0x61, 0x80, 0x00, 0x63, 0x2c, 0x80, 0x03, 0x52, 0x8a, 0x63, 
+  0x2c, 0x83, 0xef, 0xb5, 0x95, 0x80, 0x00, 0x6b, 0x6d, 0x80, 0x03, 0x12, 0xe7, 0x01, 0x84, 0x21, 
+  0x44, 0xb5, 0x95, 0x41, 0xff, 0xff, 0x41, 0xff, 0xdf, 0x11, 0xff, 0xbe, 0xff, 0xfe, 0xff, 0xff, 
+  0xad, 0x75, 0x10, 0xc3, 0x09, 0xa5, 0x0a, 0x27, 0x1a, 0xe8, 0x23, 0x29, 0x0a, 0x47, 0x01, 0xe6, 
+  0x08, 0xe3, 0xef, 0x5c, 0xa5, 0x13, 0x00, 0x00, 0x00, 0x20, 0xde, 0xda, 0xc6, 0x38, 0x80, 0x07, 
+  0xbd, 0xf7, 0xf7, 0x7d, 0x21, 0x24, 0xb5, 0x95, 0xff, 0xff, 0x21, 0x44, 0x01, 0xa5, 0x01, 0xe6, 
+  0x43, 0x01, 0xc5, 0x43, 0x01, 0xc6, 0x43, 0x01, 0xc5, 0x00, 0x01, 0xe6, 0x43, 0x01, 0xc5, 0x00, 
+  0x01, 0xe5, 0x41, 0x01, 0xc5, 0x00, 0x01, 0xe5, 0x47, 0x01, 0xc5, 0x00, 0x01, 0xc6, 0x41, 0x01, 
+  0xe5, 0x15, 0x01, 0xc5, 0x02, 0x06, 0x12, 0xc7, 0x23, 0x69, 0x12, 0x86, 0x01, 0xe5, 0x01, 0xe6, 
+  0x0a, 0x46, 0x1a, 0xc7, 0x01, 0xe5, 0x01, 0xa5, 0x01, 0xe6, 0x0a, 0x46, 0x1a, 0xe8, 0x23, 0x48, 
+  0x1b, 0x28, 0x23, 0x49, 0x12, 0xa6, 0xa5, 0xf6, 0x7c, 0xf1, 0x12, 0xa6, 0x23, 0x29, 0x43, 0x1b, 
+  0x08, 0x41, 0x23, 0x08, 0x41, 0x23, 0x28, 0x41, 0x23, 0x08, 0x84, 0x00, 0x01, 0xe6, 0x81, 0x02, 
+  0x1b, 0x08, 0x0a, 0x06, 0x09, 0xe7, 0x45, 0x09, 0xe6, 0x43, 0x01, 0xe6, 0x0e, 0x09, 0xe6, 0x09, 
+  0xe7, 0x01, 0x85, 0x22, 0x48, 0x9d, 0xb6, 0xb6, 0x99, 0xc7, 0x1b, 0xc6, 0xfb, 0xd7, 0x5c, 0xcf, 
+  0x1b, 0x43, 0x4c, 0x1a, 0x89, 0x02, 0x07, 0x0a, 0x07, 0x09, 0xe7, 0x42, 0x09, 0xe6, 0x80, 0x04, 
+  0x0a, 0x26, 0x1a, 0xc8, 0x0a, 0x06, 0x01, 0xa5, 0x09, 0xc6, 0x43, 0x09, 0xe6, 0x43, 0x09, 0xe7, 
+  0x00, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x00, 0x09, 0xe6, 0x43, 0x09, 0xe7, 0x00, 0x09, 0xe6, 0x41, 
+  0x01, 0xe6, 0x00, 0x09, 0xe7, 0x80, 0x08, 0xbd, 0xd6, 0xff, 0xde, 0x94, 0x92, 0x8c, 0x71, 0xad, 
+  0x75, 0xef, 0x7d, 0x39, 0xc7, 0x00, 0x00, 0x42, 0x28, 0x43, 0xff, 0xff, 0x00, 0xff, 0xde, 0x80, 
+  0x00, 0x62, 0xeb, 0x81, 0x00, 0x6b, 0x4c, 0x83, 0x00, 0x09, 0xe6, 0x81, 0x04, 0x09, 0x44, 0x29, 
+  0x65, 0x31, 0xc6, 0x31, 0xa6, 0x29, 0xa6, 0x41, 0x29, 0x85, 0x09, 0x10, 0xc2, 0x12, 0x45, 0x12, 
+  0x26, 0x00, 0xc2, 0x08, 0x41, 0xb5, 0xb6, 0xf7, 0x9e, 0x4a, 0x48, 0x00, 0xc2, 0x1a, 0xe8, 0x82, 
+  0x00, 0x00, 0x20, 0x81, 0x01, 0x08, 0xa2, 0x09, 0x84, 0x80, 0x00, 0x31, 0xc6, 0x80, 0x00, 0xf7, 
+  0xbe, 0x41, 0xef, 0x5c, 0x09, 0xff, 0xff, 0xde, 0xda, 0x08, 0xc2, 0x01, 0xa5, 0x21, 0x64, 0xbd, 
+  0xd6, 0xc6, 0x37, 0xd6, 0x78, 0xd6, 0x99, 0xef, 0x5c, 0x80, 0x03, 0x5a, 0xcb, 0x00, 0x40, 0x00, 
+  0x00, 0x63, 0x0c, 0x80, 0x00, 0x6b, 0x4d, 0x80, 0x05, 0x12, 0x66, 0x01, 0x03, 0x00, 0xe2, 0x00, 
+  0x00, 0x42, 0x48, 0x84, 0x30, 0x41, 0x84, 0x10, 0x11, 0x7b, 0xef, 0x84, 0x0f, 0x4a, 0x69, 0x00, 
+  0x00, 0x00, 0x81, 0x01, 0x64, 0x1a, 0xc8, 0x1b, 0x29, 0x0a, 0x27, 0x0a, 0x07, 0x0a, 0x06, 0x10, 
+  0xe3, 0xef, 0x7c, 0xff, 0xde, 0xd6, 0xba, 0xd6, 0x99, 0xff, 0xff, 0xce, 0x79, 0x81, 0x02, 0xef, 
+  0x5c, 0x00, 0x00, 0x9c, 0xf3, 0x80, 0x02, 0x21, 0x64, 0x12, 0xc7, 0x1b, 0x28, 0x43, 0x1b, 0x08, 
+  0x00, 0x1b, 0x28, 0x45, 0x1b, 0x08, 0x49, 0x1b, 0x28, 0x41, 0x1b, 0x08, 0x00, 0x1b, 0x28, 0x44, 
+  0x1b, 0x08, 0x41, 0x1b, 0x28, 0x01, 0x1b, 0x08, 0x0a, 0x46, 0x80, 0x08, 0x02, 0x26, 0x1a, 0xc7, 
+  0x23, 0x28, 0x0a, 0x26, 0x01, 0xc5, 0x01, 0xe5, 0x0a, 0x26, 0x1a, 0xc7, 0x09, 0xe6, 0x41, 0x01, 
+  0xc5, 0x0a, 0x02, 0x26, 0x0a, 0x46, 0x0a, 0x66, 0x01, 0xe4, 0x3b, 0x6b, 0xce, 0xba, 0xb6, 0x38, 
+  0x1a, 0x67, 0x01, 0xe5, 0x0a, 0x26, 0x0a, 0x25, 0x47, 0x0a, 0x26, 0x84, 0x01, 0x01, 0xe7, 0x09, 
+  0xe6, 0x82, 0x02, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0xe7, 0x43, 0x01, 0xe6, 0x00, 0x01, 0xe7, 0x41, 
+  0x09, 0xe6, 0x80, 0x0c, 0x0a, 0x07, 0x01, 0x85, 0x2a, 0xa9, 0xb6, 0x99, 0xcf, 0x3c, 0xc7, 0x1b, 
+  0xc6, 0xda, 0xcf, 0x1c, 0xc6, 0xda, 0x4b, 0x0b, 0x01, 0x65, 0x01, 0xe6, 0x0a, 0x07, 0x41, 0x09, 
+  0xe7, 0x81, 0x05, 0x01, 0xc6, 0x0a, 0x26, 0x1a, 0xa7, 0x02, 0x06, 0x01, 0xc6, 0x09, 0xc6, 0x41, 
+  0x09, 0xe6, 0x00, 0x09, 0xe7, 0x43, 0x09, 0xe6, 0x82, 0x42, 0x09, 0xe6, 0x80, 0x42, 0x09, 0xe6, 
+  0x00, 0x09, 0xe7, 0x41, 0x01, 0xe7, 0x81, 0x12, 0xb5, 0xb6, 0xff, 0xff, 0xe7, 0x3c, 0xde, 0xfb, 
+  0xef, 0x5d, 0xde, 0xda, 0x21, 0x04, 0x00, 0x20, 0x19, 0x03, 0x73, 0x6d, 0x73, 0x8d, 0x73, 0x8e, 
+  0x73, 0x8d, 0xef, 0x5c, 0xf7, 0xbe, 0x39, 0xc7, 0x01, 0x23, 0x01, 0x03, 0x63, 0x2c, 0x82, 0x01, 
+  0x09, 0xe7, 0x09, 0xc6, 0x80, 0x02, 0x09, 0xe6, 0x08, 0xc2, 0xe7, 0x1b, 0x44, 0xff, 0xff, 0x09, 
+  0x73, 0xae, 0x01, 0xa3, 0x12, 0x66, 0x09, 0xc5, 0x00, 0xe2, 0x00, 0x00, 0xde, 0xfb, 0xf7, 0xbe, 
+  0x08, 0xc2, 0x12, 0xa7, 0x81, 0x01, 0x09, 0xc6, 0x00, 0x40, 0x80, 0x03, 0xef, 0x7c, 0x08, 0x82, 
+  0x09, 0x85, 0x01, 0x64, 0x81, 0x00, 0xd6, 0xba, 0x41, 0xad, 0x75, 0x01, 0xf7, 0xbe, 0xde, 0xfb, 
+  0x80, 0x0b, 0x01, 0x44, 0x29, 0x85, 0xff, 0xff, 0xe7, 0x1b, 0xb5, 0xb6, 0xc5, 0xf7, 0xc6, 0x38, 
+  0xc6, 0x18, 0x39, 0xc6, 0x19, 0x03, 0x10, 0xc2, 0x73, 0xae, 0x81, 0x06, 0x00, 0xe1, 0x19, 0x44, 
+  0x39, 0xc6, 0x3a, 0x07, 0x42, 0x08, 0x31, 0xa6, 0x29, 0x65, 0x41, 0x29, 0x45, 0x07, 0x29, 0x44, 
+  0x29, 0x45, 0x31, 0x85, 0x3a, 0x07, 0x42, 0x28, 0x3a, 0x07, 0x11, 0x84, 0x0a, 0x26, 0x41, 0x0a, 
+  0x07, 0x80, 0x01, 0x08, 0xc2, 0xa4, 0xd3, 0x42, 0xc6, 0x38, 0x01, 0xc5, 0xf7, 0x8c, 0x71, 0x80, 
+  0x01, 0xc6, 0x38, 0xff, 0xff, 0x80, 0x00, 0xad, 0x54, 0x80, 0x01, 0x19, 0x24, 0x01, 0xa4, 0x44, 
+  0x0a, 0x06, 0x41, 0x0a, 0x26, 0x43, 0x0a, 0x06, 0x44, 0x0a, 0x26, 0x41, 0x02, 0x26, 0x42, 0x0a, 
+  0x26, 0x42, 0x0a, 0x06, 0x43, 0x0a, 0x26, 0x00, 0x0a, 0x06, 0x41, 0x0a, 0x26, 0x08, 0x0a, 0x06, 
+  0x0a, 0x46, 0x1a, 0xc8, 0x0a, 0x46, 0x01, 0xe5, 0x02, 0x05, 0x12, 0x87, 0x23, 0x28, 0x0a, 0x26, 
+  0x41, 0x01, 0xc5, 0x01, 0x12, 0x66, 0x1a, 0xc8, 0x41, 0x0a, 0x06, 0x41, 0x0a, 0x26, 0x08, 0x01, 
+  0xc4, 0x22, 0xa8, 0xb6, 0x38, 0xc6, 0x99, 0xce, 0xba, 0x95, 0x54, 0x09, 0xe5, 0x01, 0xe5, 0x0a, 
+  0x46, 0x82, 0x41, 0x0a, 0x47, 0x81, 0x00, 0x0a, 0x27, 0x83, 0x41, 0x01, 0xe7, 0x00, 0x09, 0xc6, 
+  0x80, 0x00, 0x23, 0x28, 0x80, 0x41, 0x09, 0xe6, 0x46, 0x01, 0xe6, 0x06, 0x09, 0xe7, 0x0a, 0x27, 
+  0x01, 0xa5, 0x3b, 0x0b, 0xbe, 0xda, 0xcf, 0x5c, 0xc6, 0xfb, 0x80, 0x03, 0xd7, 0x7d, 0xbe, 0x9a, 
+  0x3a, 0x89, 0x01, 0x44, 0x41, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x81, 0x03, 0x01, 0xe6, 0x0a, 0x26, 
+  0x12, 0xa7, 0x0a, 0x06, 0x42, 0x01, 0xc6, 0x42, 0x09, 0xc6, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xe6, 
+  0x00, 0x09, 0xe7, 0x43, 0x09, 0xe6, 0x42, 0x09, 0xe7, 0x41, 0x01, 0xe6, 0x41, 0x09, 0xe7, 0x01, 
+  0x09, 0xe6, 0x09, 0xc6, 0x80, 0x12, 0x00, 0x61, 0xbd, 0xd6, 0xf7, 0x9e, 0x08, 0x81, 0x00, 0x81, 
+  0x08, 0x61, 0xbe, 0x17, 0xde, 0xfb, 0x10, 0xa2, 0x01, 0x23, 0x00, 0xc2, 0x00, 0xe2, 0x00, 0x00, 
+  0x39, 0xc7, 0xff, 0xff, 0x9c, 0xd2, 0x00, 0x00, 0x11, 0xe6, 0x00, 0xe2, 0x82, 0x00, 0x00, 0xe2, 
+  0x81, 0x12, 0x09, 0xe6, 0x09, 0xc6, 0x00, 0x61, 0x42, 0x07, 0x5b, 0x0b, 0x63, 0x0c, 0x5b, 0x0b, 
+  0x5a, 0xeb, 0x63, 0x0c, 0x29, 0x65, 0x12, 0x25, 0x12, 0x87, 0x09, 0x64, 0x00, 0x40, 0x9c, 0xf3, 
+  0xf7, 0xbe, 0x42, 0x08, 0x00, 0xc2, 0x1a, 0xe8, 0x80, 0x00, 0x01, 0xa6, 0x80, 0x04, 0x00, 0x20, 
+  0xce, 0x38, 0xf7, 0x7d, 0x08, 0xa2, 0x01, 0x85, 0x82, 0x07, 0x73, 0x8e, 0x00, 0x00, 0x00, 0x20, 
+  0xde, 0xfb, 0xe7, 0x1c, 0x08, 0xa2, 0x01, 0x23, 0x21, 0x24, 0x80, 0x02, 0x8c, 0x50, 0x00, 0x00, 
+  0x00, 0x20, 0x41, 0x00, 0x81, 0x03, 0x08, 0xa2, 0xe7, 0x1c, 0xff, 0xff, 0xff, 0xdf, 0x80, 0x02, 
+  0x6b, 0x6d, 0x00, 0x00, 0x42, 0x28, 0x4c, 0xff, 0xff, 0x01, 0x21, 0x44, 0x01, 0x85, 0x80, 0x03, 
+  0x12, 0x47, 0x1a, 0x87, 0x09, 0x84, 0x00, 0x61, 0x42, 0x00, 0x00, 0x0c, 0x00, 0x61, 0x00, 0xc2, 
+  0x08, 0xe3, 0x42, 0x28, 0x5a, 0xeb, 0x08, 0x41, 0x3a, 0x07, 0x52, 0xaa, 0x08, 0xa2, 0x01, 0x85, 
+  0x01, 0xc6, 0x09, 0xc6, 0x01, 0xc6, 0x41, 0x09, 0xc6, 0x00, 0x01, 0xc6, 0x41, 0x09, 0xc6, 0x42, 
+  0x01, 0xc6, 0x41, 0x09, 0xc6, 0x00, 0x09, 0xe6, 0x41, 0x09, 0xc6, 0x01, 0x01, 0xc6, 0x09, 0xe6, 
+  0x41, 0x09, 0xc6, 0x00, 0x09, 0xc7, 0x41, 0x09, 0xc6, 0x47, 0x01, 0xc6, 0x04, 0x09, 0xe6, 0x01, 
+  0xc6, 0x0a, 0x46, 0x1b, 0x08, 0x0a, 0x46, 0x41, 0x01, 0xe5, 0x07, 0x1a, 0xa7, 0x23, 0x08, 0x01, 
+  0xe5, 0x01, 0xc6, 0x01, 0xe6, 0x0a, 0x46, 0x1a, 0xc7, 0x1a, 0xc8, 0x41, 0x12, 0xa6, 0x09, 0x54, 
+  0x0d, 0xbe, 0x98, 0xce, 0xfa, 0xc6, 0xba, 0xc6, 0xb9, 0xce, 0xfb, 0xa6, 0x16, 0x33, 0x8a, 0x0a, 
+  0x86, 0x12, 0xc7, 0x43, 0x1a, 0xe8, 0x00, 0x1b, 0x08, 0x41, 0x1a, 0xe8, 0x80, 0x01, 0x0a, 0x66, 
+  0x1b, 0x08, 0x81, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x81, 0x00, 0x0a, 0x07, 0x82, 0x00, 0x09, 0xe6, 
+  0x80, 0x00, 0x09, 0xe6, 0x80, 0x0d, 0x01, 0xc6, 0x09, 0xe6, 0x01, 0xe6, 0x01, 0x64, 0x3a, 0xea, 
+  0xce, 0xfb, 0xdf, 0x9d, 0xcf, 0x1c, 0xd7, 0x5d, 0xbe, 0x79, 0x7c, 0x91, 0x3a, 0xaa, 0x01, 0x24, 
+  0x09, 0xc6, 0x41, 0x09, 0xe6, 0x00, 0x09, 0xc6, 0x42, 0x09, 0xe6, 0x80, 0x02, 0x1b, 0x08, 0x0a, 
+  0x26, 0x01, 0xc5, 0x80, 0x00, 0x09, 0xc6, 0x44, 0x01, 0xc6, 0x01, 0x09, 0xc6, 0x09, 0xe7, 0x45, 
+  0x09, 0xe6, 0x80, 0x42, 0x09, 0xe6, 0x80, 0x02, 0x01, 0xe7, 0x01, 0xe6, 0x09, 0xe6, 0x82, 0x10, 
+  0xef, 0x7d, 0x08, 0xc2, 0x09, 0xe6, 0x00, 0xa1, 0x84, 0x30, 0xff, 0xff, 0x21, 0x44, 0x01, 0x65, 
+  0x12, 0x48, 0x00, 0xc2, 0x21, 0x24, 0xe7, 0x1b, 0xf7, 0x9d, 0x31, 0x85, 0x00, 0xc2, 0x09, 0xe6, 
+  0x00, 0xc2, 0x81, 0x02, 0x5a, 0xca, 0x01, 0x03, 0x0a, 0x07, 0x80, 0x11, 0x09, 0xa6, 0x11, 0xe7, 
+  0x3a, 0xca, 0x29, 0xe7, 0x09, 0x64, 0x00, 0x81, 0x00, 0xc2, 0x01, 0x43, 0x01, 0xa4, 0x01, 0x03, 
+  0x1a, 0xc7, 0x12, 0x45, 0x00, 0x40, 0xa5, 0x34, 0xff, 0xdf, 0x4a, 0x49, 0x00, 0x40, 0x09, 0xa5, 
+  0x83, 0x06, 0x00, 0x40, 0xd6, 0x79, 0xf7, 0x9d, 0x00, 0x61, 0x09, 0xa5, 0x01, 0x44, 0x29, 0x45, 
+  0x80, 0x07, 0x7b, 0xef, 0x00, 0xc2, 0x10, 0xe3, 0xe6, 0xfb, 0xe7, 0x1b, 0x08, 0x82, 0x01, 0x03, 
+  0x21, 0x44, 0x80, 0x02, 0x9c, 0xb2, 0x00, 0x40, 0x11, 0xc6, 0x41, 0x0a, 0x07, 0x03, 0x11, 0x24, 
+  0x8c, 0x30, 0x94, 0x92, 0xbd, 0xf7, 0x80, 0x03, 0x63, 0x0c, 0x00, 0xa1, 0x19, 0x24, 0x52, 0x8a, 
+  0x41, 0x4a, 0x49, 0x05, 0x52, 0xaa, 0x52, 0x8a, 0x6b, 0x4c, 0xff, 0xdf, 0xad, 0x54, 0x52, 0x89, 
+  0x42, 0x5a, 0xeb, 0x01, 0x52, 0x89, 0x08, 0xc2, 0x80, 0x0b, 0x09, 0xe6, 0x1a, 0x87, 0x09, 0xe6, 
+  0x09, 0xe7, 0x01, 0x44, 0x4a, 0x89, 0xde, 0xfb, 0x39, 0xe7, 0x00, 0x20, 0x01, 0x03, 0x00, 0xe3, 
+  0x00, 0x20, 0x41, 0x00, 0x00, 0x02, 0x84, 0x30, 0xce, 0x79, 0x10, 0xc2, 0x80, 0x00, 0x09, 0xe6, 
+  0x47, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x00, 0x09, 0xe7, 0x47, 0x09, 0xe6, 0x01, 0x09, 0xe7, 0x09, 
+  0xe6, 0x44, 0x09, 0xc6, 0x01, 0x09, 0xe6, 0x09, 0xc6, 0x43, 0x09, 0xe6, 0x11, 0x01, 0xc5, 0x0a, 
+  0x66, 0x23, 0x28, 0x0a, 0x26, 0x01, 0xc6, 0x01, 0xe6, 0x12, 0x87, 0x12, 0xa7, 0x01, 0xc5, 0x01, 
+  0xa5, 0x01, 0xa6, 0x01, 0xc5, 0x01, 0x84, 0x3b, 0x2b, 0xa5, 0xb5, 0xc6, 0x9a, 0xbe, 0x79, 0xbe, 
+  0x59, 0x41, 0xbe, 0x79, 0x05, 0xbe, 0x58, 0xc6, 0x99, 0xc6, 0x79, 0x8d, 0x13, 0x22, 0x68, 0x01, 
+  0x84, 0x41, 0x01, 0xc5, 0x01, 0x01, 0xa5, 0x01, 0xc5, 0x41, 0x01, 0xa5, 0x80, 0x01, 0x0a, 0x67, 
+  0x1b, 0x28, 0x80, 0x02, 0x09, 0xe6, 0x09, 0xe7, 0x09, 0xe6, 0x80, 0x02, 0x23, 0x08, 0x09, 0xe6, 
+  0x09, 0xc6, 0x42, 0x09, 0xe6, 0x0e, 0x01, 0xe7, 0x01, 0xe6, 0x01, 0xc6, 0x09, 0xc6, 0x01, 0x64, 
+  0x22, 0x48, 0x5b, 0xee, 0xbe, 0x99, 0xdf, 0x9d, 0xd7, 0x1c, 0xdf, 0x5d, 0xdf, 0x7d, 0x64, 0x0f, 
+  0x00, 0xe3, 0x01, 0xa6, 0x41, 0x09, 0xc6, 0x00, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x42, 0x09, 0xe7, 
+  0x82, 0x01, 0x01, 0xc6, 0x09, 0xc6, 0x41, 0x01, 0xc6, 0x42, 0x09, 0xc6, 0x00, 0x09, 0xe6, 0x41, 
+  0x09, 0xe7, 0x80, 0x00, 0x09, 0xe7, 0x80, 0x00, 0x09, 0xe7, 0x42, 0x09, 0xe6, 0x00, 0x09, 0xe7, 
+  0x41, 0x09, 0xc6, 0x03, 0x09, 0xe6, 0x09, 0xe7, 0x09, 0xe6, 0x01, 0xe6, 0x81, 0x04, 0xbd, 0xb6, 
+  0xef, 0x7c, 0x08, 0xa2, 0x09, 0xc5, 0x00, 0x61, 0x82, 0x08, 0x00, 0xe3, 0x00, 0x20, 0x31, 0x86, 
+  0xd6, 0x99, 0xff, 0xff, 0x5a, 0xcb, 0x00, 0x60, 0x09, 0xc6, 0x09, 0xe7, 0x80, 0x00, 0x63, 0x0b, 
+  0x82, 0x15, 0x0a, 0x28, 0x0a, 0x07, 0x01, 0x44, 0x5b, 0xae, 0xcf, 0x7d, 0xc7, 0x3c, 0x74, 0xf2, 
+  0x3b, 0x4c, 0x12, 0x07, 0x12, 0xa8, 0x23, 0x49, 0x01, 0xe6, 0x09, 0xc4, 0x00, 0x60, 0xa4, 0xf3, 
+  0xff, 0xff, 0x52, 0x8a, 0x00, 0x81, 0x09, 0xc6, 0x01, 0xc5, 0x12, 0xc7, 0x12, 0x67, 0x80, 0x07, 
+  0x09, 0xe6, 0x00, 0x41, 0xad, 0x54, 0xff, 0xff, 0x5b, 0x0b, 0x00, 0x00, 0x00, 0x20, 0x9c, 0xd2, 
+  0x80, 0x02, 0x6b, 0x4d, 0x00, 0xa1, 0x08, 0xc2, 0x41, 0xde, 0xfb, 0x00, 0x08, 0x81, 0x82, 0x02, 
+  0x94, 0x91, 0x00, 0x00, 0x00, 0x81, 0x41, 0x00, 0xa2, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0x00, 
+  0x5a, 0xeb, 0x80, 0x05, 0x63, 0x0b, 0x01, 0x02, 0x11, 0xc5, 0x00, 0x00, 0x29, 0x45, 0x4a, 0x69, 
+  0x41, 0x00, 0x40, 0x12, 0x10, 0xc3, 0xff, 0xff, 0x8c, 0x51, 0x00, 0x00, 0x12, 0x46, 0x01, 0xa4, 
+  0x01, 0x23, 0x00, 0xe2, 0x01, 0x44, 0x09, 0xe6, 0x1a, 0x87, 0x12, 0x06, 0x09, 0xc6, 0x0a, 0x07, 
+  0x01, 0x23, 0x63, 0x2c, 0xff, 0xff, 0x94, 0xb2, 0x63, 0x0c, 0x41, 0x6b, 0x4c, 0x41, 0x6b, 0x6d, 
+  0x04, 0x63, 0x0c, 0xd6, 0x99, 0xff, 0xfe, 0x10, 0xc3, 0x01, 0x64, 0x4d, 0x09, 0xe7, 0x81, 0x00, 
+  0x09, 0xc7, 0x81, 0x41, 0x09, 0xc6, 0x00, 0x09, 0xc7, 0x81, 0x42, 0x09, 0xe6, 0x42, 0x09, 0xc6, 
+  0x01, 0x09, 0xc7, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x05, 0x01, 0xe6, 0x12, 0x87, 0x1b, 0x08, 0x01, 
+  0xe5, 0x01, 0xc5, 0x01, 0xe5, 0x80, 0x00, 0x12, 0x87, 0x41, 0x12, 0xa7, 0x05, 0x12, 0x87, 0x12, 
+  0x67, 0x33, 0x4a, 0x7c, 0xf1, 0xbe, 0x78, 0xce, 0xda, 0x43, 0xc6, 0x99, 0x04, 0xce, 0xda, 0xae, 
+  0x17, 0x6c, 0x90, 0x2a, 0xe9, 0x12, 0x67, 0x44, 0x12, 0x87, 0x00, 0x1a, 0x88, 0x81, 0x02, 0x1b, 
+  0x08, 0x01, 0xc6, 0x09, 0xc6, 0x82, 0x01, 0x1b, 0x08, 0x0a, 0x06, 0x83, 0x09, 0x09, 0xe6, 0x01, 
+  0xc6, 0x09, 0xe6, 0x01, 0x44, 0x22, 0x27, 0xa5, 0xd6, 0xdf, 0xbe, 0xcf, 0x3c, 0xcf, 0x1b, 0xd7, 
+  0x5d, 0x80, 0x02, 0x5b, 0xef, 0x01, 0xc6, 0x0a, 0x07, 0x41, 0x09, 0xe6, 0x80, 0x00, 0x09, 0xe6, 
+  0x42, 0x09, 0xe7, 0x01, 0x09, 0xe6, 0x01, 0xc6, 0x86, 0x00, 0x01, 0xa6, 0x41, 0x01, 0xc6, 0x41, 
+  0x09, 0xe6, 0x00, 0x09, 0xc6, 0x42, 0x09, 0xe6, 0x81, 0x00, 0x09, 0xc6, 0x81, 0x00, 0x09, 0xe7, 
+  0x42, 0x09, 0xc6, 0x01, 0x01, 0xe6, 0x01, 0xc6, 0x81, 0x01, 0xb5, 0x95, 0xe7, 0x3c, 0x41, 0x00, 
+  0x20, 0x01, 0x18, 0xe3, 0xbd, 0xf7, 0x80, 0x07, 0x10, 0xc2, 0x18, 0xc3, 0x9c, 0xb2, 0xf7, 0x9d, 
+  0xff, 0xff, 0x63, 0x0c, 0x00, 0x40, 0x09, 0xa5, 0x81, 0x00, 0x00, 0xa2, 0x82, 0x04, 0x01, 0x23, 
+  0x0a, 0x27, 0x1a, 0x48, 0x84, 0xf3, 0xc6, 0xda, 0x41, 0xc7, 0x1b, 0x03, 0xcf, 0x5c, 0xd7, 0x7d, 
+  0x22, 0x68, 0x0a, 0x87, 0x80, 0x07, 0x01, 0xa4, 0x10, 0xc3, 0xad, 0x54, 0xff, 0xff, 0x5a, 0xcb, 
+  0x01, 0x02, 0x0a, 0x26, 0x01, 0xc6, 0x80, 0x01, 0x1a, 0xc7, 0x12, 0x87, 0x81, 0x0a, 0x01, 0x44, 
+  0x18, 0xc3, 0xde, 0xda, 0xf7, 0xbe, 0x94, 0x71, 0x94, 0xb2, 0xff, 0xff, 0xc6, 0x38, 0x08, 0x61, 
+  0x01, 0x03, 0x00, 0x61, 0x41, 0xde, 0xda, 0x02, 0x00, 0x61, 0x00, 0xe3, 0x29, 0x85, 0x80, 0x08, 
+  0xe7, 0x1c, 0xa5, 0x54, 0xad, 0x55, 0xad, 0x54, 0xad, 0x55, 0xad, 0x75, 0xa5, 0x34, 0x00, 0x40, 
+  0x63, 0x2c, 0x81, 0x13, 0x01, 0x22, 0x1a, 0xa7, 0x00, 0x61, 0xb5, 0x95, 0xff, 0xff, 0x29, 0x85, 
+  0x01, 0x23, 0x29, 0x86, 0xff, 0xdf, 0x94, 0x92, 0x09, 0x43, 0x2b, 0xeb, 0x12, 0xc9, 0x12, 0x67, 
+  0x0a, 0x06, 0x09, 0xe6, 0x1a, 0x87, 0x0a, 0x06, 0x09, 0xc6, 0x09, 0xe6, 0x81, 0x00, 0x63, 0x0c, 
+  0x48, 0xff, 0xff, 0x02, 0xef, 0x5c, 0x18, 0xe3, 0x01, 0x44, 0x80, 0x00, 0x09, 0xc6, 0x89, 0x00, 
+  0x09, 0xe6, 0x80, 0x42, 0x09, 0xc6, 0x41, 0x01, 0xa6, 0x00, 0x01, 0xc6, 0x42, 0x09, 0xc6, 0x01, 
+  0x09, 0xe7, 0x09, 0xc6, 0x41, 0x01, 0xc6, 0x00, 0x09, 0xe6, 0x82, 0x00, 0x09, 0xc7, 0x41, 0x09, 
+  0xe7, 0x04, 0x09, 0xe6, 0x01, 0xc5, 0x12, 0x87, 0x1b, 0x08, 0x02, 0x06, 0x41, 0x01, 0xc5, 0x82, 
+  0x41, 0x12, 0xa7, 0x04, 0x0a, 0x66, 0x02, 0x05, 0x22, 0xa8, 0x9d, 0x95, 0xce, 0xfa, 0x81, 0x04, 
+  0xce, 0xfa, 0x74, 0xb1, 0x12, 0x46, 0x02, 0x05, 0x12, 0x67, 0x45, 0x12, 0xa7, 0x00, 0x1a, 0xa7, 
+  0x80, 0x00, 0x0a, 0x66, 0x80, 0x05, 0x01, 0xe6, 0x09, 0xe7, 0x09, 0xe6, 0x01, 0xe6, 0x0a, 0x07, 
+  0x23, 0x08, 0x80, 0x00, 0x01, 0xe6, 0x80, 0x41, 0x01, 0xe6, 0x05, 0x09, 0xe7, 0x09, 0xe6, 0x01, 
+  0x24, 0x19, 0xc6, 0xa6, 0x17, 0xd7, 0x7d, 0x41, 0xcf, 0x1c, 0x05, 0xd7, 0x5d, 0xdf, 0x7d, 0x64, 
+  0x30, 0x01, 0xa5, 0x0a, 0x07, 0x09, 0xc6, 0x80, 0x03, 0x09, 0xe7, 0x09, 0xe6, 0x09, 0xc6, 0x09, 
+  0xc7, 0x80, 0x41, 0x09, 0xe6, 0x01, 0x09, 0xc6, 0x01, 0xc6, 0x81, 0x01, 0x01, 0xc5, 0x09, 0xe6, 
+  0x80, 0x00, 0x0a, 0x26, 0x41, 0x1a, 0xc7, 0x02, 0x0a, 0x06, 0x01, 0xc6, 0x01, 0xe6, 0x80, 0x00, 
+  0x09, 0xe7, 0x41, 0x09, 0xc6, 0x00, 0x01, 0xc6, 0x47, 0x09, 0xc6, 0x41, 0x09, 0xe6, 0x00, 0x0a, 
+  0x07, 0x80, 0x01, 0xbd, 0xd6, 0xff, 0xff, 0x41, 0xde, 0xda, 0x09, 0xf7, 0xbe, 0xff, 0xff, 0x52, 
+  0xaa, 0x00, 0x61, 0x29, 0x86, 0xf7, 0x9d, 0xef, 0x5d, 0x5a, 0xaa, 0x00, 0x20, 0x11, 0xa5, 0x41, 
+  0x09, 0xc6, 0x00, 0x0a, 0x07, 0x82, 0x06, 0x52, 0xaa, 0x00, 0xc2, 0x12, 0x28, 0xa5, 0xb6, 0xe7, 
+  0x9e, 0xcf, 0x3c, 0xcf, 0x1b, 0x80, 0x03, 0xcf, 0x3c, 0x64, 0x50, 0x09, 0xa5, 0x12, 0x67, 0x80, 
+  0x09, 0x01, 0x64, 0x39, 0xe7, 0xf7, 0x9d, 0x5a, 0xaa, 0x00, 0x40, 0x23, 0x08, 0x02, 0x06, 0x01, 
+  0xe6, 0x01, 0xc6, 0x1a, 0xe7, 0x81, 0x0b, 0x09, 0xc6, 0x09, 0xe7, 0x01, 0x03, 0x21, 0x45, 0xd6, 
+  0x79, 0xf7, 0xbe, 0xf7, 0x9e, 0xbd, 0xd7, 0x18, 0xe3, 0x00, 0xc2, 0x09, 0x44, 0x00, 0x40, 0x80, 
+  0x00, 0xde, 0xba, 0x80, 0x02, 0x01, 0x23, 0x29, 0x65, 0xde, 0xdb, 0x80, 0x06, 0xef, 0x5d, 0xef, 
+  0x5c, 0xe7, 0x3c, 0xe7, 0x3b, 0xef, 0x5d, 0xa5, 0x13, 0x00, 0x00, 0x82, 0x01, 0x01, 0x42, 0x1a, 
+  0xc8, 0x80, 0x08, 0xa5, 0x13, 0xff, 0xdf, 0x10, 0xa2, 0x00, 0x60, 0x00, 0x20, 0x10, 0xa2, 0x08, 
+  0x41, 0x00, 0x61, 0x01, 0x64, 0x41, 0x00, 0xe2, 0x03, 0x09, 0xc5, 0x1a, 0x67, 0x12, 0x06, 0x09, 
+  0xc6, 0x42, 0x09, 0xe7, 0x01, 0x00, 0xe3, 0x5a, 0xcb, 0x80, 0x02, 0x5a, 0xcb, 0x08, 0x41, 0x10, 
+  0xa2, 0x42, 0x10, 0x82, 0x03, 0x08, 0x41, 0xa5, 0x14, 0xff, 0xde, 0x10, 0xe3, 0x86, 0x00, 0x09, 
+  0xe6, 0x45, 0x09, 0xe7, 0x01, 0x09, 0xe6, 0x01, 0xc6, 0x80, 0x04, 0x01, 0xc6, 0x12, 0x67, 0x12, 
+  0x87, 0x0a, 0x47, 0x01, 0xc6, 0x82, 0x04, 0x12, 0x87, 0x12, 0xa7, 0x12, 0x87, 0x01, 0xe6, 0x09, 
+  0xe6, 0x81, 0x41, 0x09, 0xe7, 0x01, 0x09, 0xc7, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x03, 0x12, 0x87, 
+  0x1a, 0xc7, 0x02, 0x06, 0x01, 0xc6, 0x43, 0x01, 0xc5, 0x00, 0x01, 0xa5, 0x41, 0x01, 0xc5, 0x41, 
+  0x01, 0x84, 0x00, 0x95, 0x54, 0x80, 0x04, 0xc6, 0x9a, 0x6c, 0x50, 0x01, 0x23, 0x01, 0xa5, 0x01, 
+  0xc5, 0x41, 0x01, 0xa5, 0x42, 0x01, 0xc5, 0x00, 0x01, 0xc6, 0x41, 0x01, 0xc5, 0x80, 0x00, 0x0a, 
+  0x67, 0x83, 0x00, 0x09, 0xe6, 0x82, 0x41, 0x09, 0xe6, 0x80, 0x41, 0x09, 0xe6, 0x08, 0x11, 0xe7, 
+  0x84, 0xf3, 0xa5, 0xf7, 0xcf, 0x3c, 0xc6, 0xfb, 0xcf, 0x3c, 0xd7, 0x5d, 0x74, 0x71, 0x32, 0xea, 
+  0x46, 0x09, 0xe7, 0x80, 0x02, 0x09, 0xe7, 0x09, 0xe6, 0x09, 0xe7, 0x80, 0x41, 0x01, 0xe6, 0x80, 
+  0x00, 0x0a, 0x47, 0x41, 0x01, 0xc6, 0x00, 0x12, 0x67, 0x42, 0x23, 0x68, 0x01, 0x1b, 0x07, 0x01, 
+  0xe5, 0x80, 0x02, 0x0a, 0x06, 0x02, 0x06, 0x09, 0xe6, 0x41, 0x01, 0xe6, 0x41, 0x09, 0xe6, 0x41, 
+  0x01, 0xe6, 0x02, 0x09, 0xe6, 0x01, 0xe6, 0x01, 0xc6, 0x80, 0x04, 0x09, 0xe7, 0x01, 0xe6, 0x09, 
+  0xe7, 0x00, 0xc2, 0x63, 0x0b, 0x41, 0x94, 0x91, 0x05, 0x9c, 0xb2, 0x94, 0xb2, 0x42, 0x28, 0x00, 
+  0x61, 0x09, 0xc6, 0x09, 0x03, 0x41, 0x08, 0xc3, 0x02, 0x00, 0xe2, 0x09, 0xc5, 0x01, 0xc6, 0x82, 
+  0x01, 0x00, 0xa1, 0x63, 0x2c, 0x82, 0x10, 0x9d, 0x95, 0xe7, 0x9d, 0xd7, 0x1c, 0xd7, 0x5c, 0xd7, 
+  0x5d, 0xd7, 0x7c, 0x64, 0xb0, 0x01, 0xa5, 0x01, 0x64, 0x12, 0x66, 0x1b, 0x08, 0x01, 0xe5, 0x09, 
+  0x64, 0x10, 0xe2, 0x00, 0x61, 0x09, 0xc5, 0x1b, 0x28, 0x80, 0x00, 0x09, 0xe7, 0x82, 0x00, 0x01, 
+  0xc6, 0x41, 0x09, 0xe6, 0x0e, 0x0a, 0x07, 0x01, 0x64, 0x08, 0xe2, 0x08, 0xc2, 0x08, 0xe3, 0x09, 
+  0x02, 0x01, 0x03, 0x09, 0xa5, 0x01, 0x65, 0x00, 0x41, 0xde, 0xfa, 0xde, 0xda, 0x00, 0x41, 0x09, 
+  0xc5, 0x11, 0xe5, 0x41, 0x08, 0xc3, 0x01, 0x08, 0xc2, 0x00, 0x82, 0x42, 0x00, 0x61, 0x00, 0x00, 
+  0x41, 0x82, 0x17, 0x63, 0x2c, 0x01, 0xa3, 0x1b, 0x28, 0x00, 0x81, 0xb5, 0x75, 0xff, 0xff, 0xa5, 
+  0x34, 0x9c, 0xb2, 0x9c, 0xd3, 0x94, 0x91, 0x94, 0xb2, 0x94, 0x92, 0x94, 0x71, 0x94, 0x92, 0x7b, 
+  0xae, 0x09, 0x03, 0x09, 0xe6, 0x09, 0xc6, 0x09, 0xe7, 0x09, 0xe6, 0x09, 0xc6, 0x12, 0x26, 0x09, 
+  0xa4, 0x5a, 0xeb, 0x80, 0x07, 0xad, 0x55, 0x84, 0x30, 0x8c, 0x71, 0x8c, 0x51, 0x84, 0x30, 0x8c, 
+  0x50, 0x84, 0x0f, 0xd6, 0xb9, 0x80, 0x01, 0x19, 0x04, 0x01, 0x64, 0x41, 0x09, 0xc6, 0x80, 0x00, 
+  0x09, 0xe6, 0x46, 0x09, 0xe7, 0x43, 0x09, 0xe6, 0x06, 0x01, 0xe6, 0x0a, 0x46, 0x1b, 0x28, 0x23, 
+  0x48, 0x12, 0xc7, 0x01, 0xc5, 0x01, 0xc6, 0x80, 0x04, 0x0a, 0x06, 0x1b, 0x28, 0x23, 0x68, 0x1b, 
+  0x07, 0x01, 0xe5, 0x80, 0x41, 0x09, 0xe7, 0x01, 0x09, 0xe6, 0x09, 0xc6, 0x41, 0x09, 0xe7, 0x00, 
+  0x09, 0xc7, 0x80, 0x01, 0x01, 0xa5, 0x1a, 0xe8, 0x47, 0x1b, 0x08, 0x41, 0x1a, 0xe8, 0x04, 0x12, 
+  0xa7, 0x33, 0x4a, 0xce, 0xda, 0xae, 0x17, 0x1a, 0xc8, 0x42, 0x1a, 0xe8, 0x01, 0x1b, 0x08, 0x1a, 
+  0xe8, 0x43, 0x1b, 0x08, 0x01, 0x1b, 0x09, 0x23, 0x09, 0x84, 0x02, 0x09, 0xe7, 0x09, 0xc6, 0x0a, 
+  0x06, 0x80, 0x42, 0x09, 0xe6, 0x0c, 0x09, 0xe7, 0x01, 0xc6, 0x09, 0xc6, 0x9d, 0xb6, 0xd7, 0x7d, 
+  0xd7, 0x3c, 0xc6, 0xfb, 0xcf, 0x1c, 0xd7, 0x7d, 0x64, 0x10, 0x01, 0xa5, 0x01, 0xa6, 0x0a, 0x07, 
+  0x81, 0x00, 0x09, 0xc7, 0x86, 0x01, 0x09, 0xe7, 0x09, 0xe6, 0x81, 0x00, 0x0a, 0x27, 0x81, 0x05, 
+  0x12, 0x87, 0x2b, 0xc9, 0x1a, 0xe6, 0x12, 0xa6, 0x23, 0x68, 0x1b, 0x07, 0x44, 0x1b, 0x08, 0x42, 
+  0x1a, 0xe8, 0x04, 0x1b, 0x08, 0x1a, 0xe8, 0x1b, 0x08, 0x12, 0xa7, 0x01, 0xe6, 0x43, 0x09, 0xe6, 
+  0x0f, 0x09, 0xa5, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x60, 0x00, 0x61, 0x00, 0x40, 0x00, 0xc2, 0x09, 
+  0xa5, 0x09, 0xe6, 0x09, 0xc6, 0x01, 0xa6, 0x01, 0xa5, 0x1b, 0x08, 0x12, 0x67, 0x09, 0xc6, 0x09, 
+  0xe6, 0x80, 0x16, 0x09, 0xe7, 0x00, 0xa2, 0x5a, 0xca, 0xef, 0x5d, 0x42, 0x07, 0x84, 0x91, 0xd7, 
+  0x7d, 0xcf, 0x1b, 0xd7, 0x3c, 0xe7, 0x9e, 0x95, 0x75, 0x43, 0x8c, 0x23, 0x28, 0x09, 0xe5, 0x01, 
+  0x85, 0x12, 0x46, 0x23, 0x08, 0x01, 0xc5, 0x12, 0xc7, 0x12, 0x46, 0x01, 0xa5, 0x0a, 0x06, 0x1b, 
+  0x08, 0x81, 0x01, 0x01, 0xa6, 0x1a, 0xc7, 0x81, 0x00, 0x09, 0xe7, 0x80, 0x09, 0x01, 0xc6, 0x12, 
+  0xa7, 0x1a, 0xc7, 0x01, 0x85, 0x01, 0xc5, 0x1b, 0x08, 0x0a, 0x27, 0x09, 0xa6, 0x09, 0x85, 0x00, 
+  0x20, 0x41, 0xce, 0x37, 0x80, 0x06, 0x0a, 0x06, 0x23, 0x69, 0x0a, 0x26, 0x01, 0xc6, 0x09, 0xe6, 
+  0x09, 0xc6, 0x09, 0xa6, 0x41, 0x01, 0xa5, 0x0a, 0x09, 0xc6, 0x00, 0x41, 0x5a, 0xca, 0xf7, 0x9e, 
+  0x5a, 0xaa, 0x09, 0xe4, 0x1b, 0x49, 0x00, 0xc2, 0x84, 0x10, 0xef, 0x7d, 0xff, 0xbe, 0x42, 0xff, 
+  0xff, 0x0f, 0xff, 0xde, 0xf7, 0xbe, 0xf7, 0x9e, 0xff, 0xff, 0xde, 0xba, 0x08, 0xe3, 0x09, 0xc6, 
+  0x09, 0xe7, 0x09, 0xe6, 0x09, 0xc6, 0x0a, 0x06, 0x23, 0x48, 0x0a, 0x04, 0x39, 0xa6, 0xef, 0x3c, 
+  0xff, 0xbe, 0x43, 0xff, 0xff, 0x41, 0xff, 0xdf, 0x04, 0xf7, 0x9e, 0xd6, 0x79, 0x10, 0xe3, 0x01, 
+  0x85, 0x09, 0xe6, 0x81, 0x48, 0x09, 0xe7, 0x43, 0x09, 0xe6, 0x07, 0x1b, 0x28, 0x1a, 0xe7, 0x0a, 
+  0x66, 0x23, 0x48, 0x12, 0x87, 0x01, 0xc5, 0x01, 0xe6, 0x1b, 0x08, 0x80, 0x03, 0x0a, 0x66, 0x23, 
+  0x48, 0x1a, 0xe7, 0x01, 0xe6, 0x82, 0x01, 0x09, 0xe6, 0x09, 0xc7, 0x80, 0x00, 0x09, 0xc6, 0x42, 
+  0x09, 0xe6, 0x41, 0x0a, 0x26, 0x41, 0x0a, 0x46, 0x42, 0x0a, 0x27, 0x41, 0x0a, 0x26, 0x07, 0x0a, 
+  0x06, 0x0a, 0x47, 0x01, 0xa4, 0x8d, 0x33, 0x5c, 0x2f, 0x01, 0xc5, 0x12, 0x47, 0x0a, 0x26, 0x41, 
+  0x0a, 0x27, 0x43, 0x0a, 0x26, 0x42, 0x0a, 0x27, 0x81, 0x01, 0x1b, 0x28, 0x01, 0xc6, 0x81, 0x01, 
+  0x09, 0xe6, 0x0a, 0x27, 0x80, 0x00, 0x01, 0xe6, 0x80, 0x0b, 0x0a, 0x07, 0x01, 0xe6, 0x11, 0xe7, 
+  0x95, 0x54, 0xd7, 0x5c, 0xcf, 0x1c, 0xc6, 0xdb, 0xcf, 0x3c, 0xc6, 0xfb, 0x5b, 0x8d, 0x09, 0xa6, 
+  0x09, 0xc6, 0x47, 0x09, 0xe7, 0x00, 0x09, 0xc7, 0x42, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x84, 0x01, 
+  0x12, 0x67, 0x23, 0x88, 0x41, 0x23, 0x68, 0x01, 0x23, 0x48, 0x0a, 0x66, 0x48, 0x0a, 0x06, 0x04, 
+  0x09, 0xe6, 0x0a, 0x66, 0x23, 0x68, 0x12, 0x87, 0x01, 0xc6, 0x80, 0x42, 0x09, 0xe7, 0x06, 0x0a, 
+  0x07, 0x09, 0xc6, 0x1a, 0xa8, 0x12, 0x67, 0x09, 0xa6, 0x09, 0xc6, 0x01, 0xa6, 0x80, 0x03, 0x09, 
+  0xe7, 0x0a, 0x07, 0x09, 0xe6, 0x23, 0x08, 0x80, 0x43, 0x09, 0xe7, 0x0a, 0x01, 0x64, 0x08, 0xc2, 
+  0x21, 0x24, 0x39, 0xe7, 0xbe, 0x79, 0xc6, 0xfb, 0xd7, 0x1c, 0xe7, 0x9e, 0x84, 0xb2, 0x12, 0x07, 
+  0x02, 0x06, 0x80, 0x02, 0x0a, 0x26, 0x01, 0xa5, 0x12, 0x47, 0x82, 0x02, 0x12, 0x87, 0x01, 0xc5, 
+  0x0a, 0x26, 0x80, 0x03, 0x0a, 0x06, 0x09, 0xe6, 0x01, 0xc6, 0x1a, 0xe7, 0x82, 0x00, 0x09, 0xe7, 
+  0x80, 0x05, 0x12, 0x87, 0x1a, 0xe8, 0x01, 0xc6, 0x09, 0xe6, 0x1b, 0x28, 0x0a, 0x26, 0x41, 0x09, 
+  0xc6, 0x00, 0x00, 0xe3, 0x41, 0x10, 0xc2, 0x00, 0x00, 0xe3, 0x80, 0x02, 0x23, 0x48, 0x0a, 0x46, 
+  0x09, 0xe6, 0x45, 0x09, 0xe7, 0x0a, 0x09, 0x65, 0x08, 0xc2, 0x18, 0xe3, 0x08, 0xa2, 0x1a, 0xc7, 
+  0x13, 0x28, 0x09, 0xe6, 0x11, 0x03, 0x19, 0x04, 0x10, 0xe3, 0x11, 0x03, 0x41, 0x10, 0xe3, 0x01, 
+  0x10, 0xc2, 0x08, 0x82, 0x41, 0x10, 0xa2, 0x02, 0x10, 0xc2, 0x11, 0xc5, 0x0a, 0x07, 0x41, 0x09, 
+  0xe7, 0x81, 0x04, 0x23, 0x28, 0x1a, 0xe7, 0x09, 0x23, 0x19, 0x03, 0x19, 0x04, 0x42, 0x10, 0xe3, 
+  0x42, 0x19, 0x03, 0x04, 0x19, 0x04, 0x10, 0xe3, 0x09, 0x44, 0x09, 0xc6, 0x09, 0xc7, 0x87, 0x00, 
+  0x09, 0xe6, 0x43, 0x09, 0xe7, 0x80, 0x04, 0x01, 0xe6, 0x1b, 0x08, 0x1b, 0x27, 0x12, 0xa6, 0x23, 
+  0x68, 0x81, 0x04, 0x01, 0xe5, 0x1b, 0x28, 0x23, 0x68, 0x12, 0xc6, 0x2b, 0x88, 0x80, 0x00, 0x01, 
+  0xc6, 0x80, 0x00, 0x09, 0xc6, 0x42, 0x09, 0xe7, 0x01, 0x09, 0xc7, 0x09, 0xe7, 0x82, 0x00, 0x01, 
+  0xc6, 0x46, 0x09, 0xc6, 0x41, 0x01, 0xc6, 0x05, 0x09, 0xc6, 0x01, 0xa6, 0x22, 0x89, 0x1a, 0x48, 
+  0x01, 0xa6, 0x09, 0xc6, 0x44, 0x01, 0xc6, 0x00, 0x01, 0xa6, 0x41, 0x09, 0xc6, 0x01, 0x09, 0xe6, 
+  0x09, 0xc6, 0x80, 0x01, 0x12, 0x67, 0x1b, 0x08, 0x82, 0x01, 0x09, 0xc6, 0x0a, 0x26, 0x80, 0x0e, 
+  0x09, 0xe6, 0x01, 0xc6, 0x01, 0x64, 0x11, 0xc6, 0x9d, 0xb6, 0xe7, 0xbe, 0xcf, 0x1c, 0xd7, 0x3c, 
+  0xdf, 0x7d, 0xc6, 0xdb, 0x53, 0x4d, 0x01, 0x03, 0x09, 0xc6, 0x09, 0xe7, 0x09, 0xc7, 0x4a, 0x09, 
+  0xe7, 0x85, 0x05, 0x09, 0xe6, 0x01, 0xe6, 0x12, 0x86, 0x1b, 0x28, 0x1b, 0x27, 0x0a, 0x66, 0x41, 
+  0x01, 0xe6, 0x02, 0x01, 0xc6, 0x09, 0xe6, 0x09, 0xe7, 0x41, 0x09, 0xc6, 0x00, 0x09, 0xe6, 0x41, 
+  0x01, 0xc6, 0x06, 0x09, 0xc6, 0x01, 0xc5, 0x12, 0x87, 0x12, 0xa7, 0x01, 0xe6, 0x09, 0xe7, 0x0a, 
+  0x07, 0x80, 0x03, 0x0a, 0x07, 0x09, 0xe7, 0x01, 0xc6, 0x1a, 0xc8, 0x80, 0x03, 0x01, 0xa6, 0x09, 
+  0xe6, 0x09, 0xc6, 0x09, 0xe7, 0x41, 0x0a, 0x07, 0x01, 0x09, 0xe7, 0x1b, 0x28, 0x80, 0x00, 0x01, 
+  0xc7, 0x41, 0x0a, 0x07, 0x09, 0x01, 0xc6, 0x09, 0xc6, 0x6c, 0x50, 0xad, 0xf7, 0xbe, 0x99, 0xc6, 
+  0xdb, 0xce, 0xfb, 0xdf, 0x7d, 0x7c, 0x71, 0x01, 0x65, 0x41, 0x0a, 0x07, 0x03, 0x23, 0x49, 0x12, 
+  0x67, 0x01, 0xc6, 0x12, 0x67, 0x81, 0x00, 0x12, 0xa7, 0x83, 0x01, 0x09, 0xe6, 0x09, 0xe7, 0x80, 
+  0x00, 0x1a, 0xe8, 0x85, 0x00, 0x1a, 0xe7, 0x81, 0x01, 0x1b, 0x08, 0x0a, 0x27, 0x80, 0x01, 0x09, 
+  0xe7, 0x09, 0xc6, 0x41, 0x01, 0x85, 0x00, 0x01, 0xc6, 0x80, 0x01, 0x1b, 0x28, 0x0a, 0x26, 0x86, 
+  0x13, 0x0a, 0x07, 0x01, 0xa6, 0x01, 0x65, 0x01, 0xa5, 0x1a, 0xe8, 0x12, 0xc7, 0x02, 0x26, 0x23, 
+  0x08, 0x09, 0xe5, 0x0a, 0x06, 0x1a, 0xa7, 0x01, 0xa5, 0x12, 0x66, 0x0a, 0x06, 0x01, 0x64, 0x1a, 
+  0x66, 0x01, 0xa5, 0x0a, 0x26, 0x23, 0x08, 0x09, 0xe6, 0x81, 0x05, 0x09, 0xe6, 0x01, 0xc6, 0x12, 
+  0x46, 0x23, 0x68, 0x23, 0x88, 0x1a, 0xc7, 0x42, 0x01, 0xa5, 0x01, 0x01, 0x85, 0x12, 0x06, 0x41, 
+  0x22, 0xe7, 0x02, 0x12, 0x26, 0x09, 0xa6, 0x09, 0xe6, 0x4f, 0x09, 0xe7, 0x0d, 0x09, 0xe6, 0x0a, 
+  0x26, 0x23, 0x48, 0x23, 0x68, 0x12, 0xa7, 0x01, 0xe5, 0x09, 0xe6, 0x01, 0xe6, 0x02, 0x06, 0x23, 
+  0x48, 0x23, 0x88, 0x1a, 0xe7, 0x02, 0x05, 0x09, 0xe6, 0x80, 0x00, 0x09, 0xc7, 0x4d, 0x09, 0xe7, 
+  0x80, 0x41, 0x09, 0xe7, 0x41, 0x09, 0xc6, 0x02, 0x09, 0xe7, 0x01, 0xc6, 0x01, 0xe6, 0x42, 0x09, 
+  0xe7, 0x42, 0x09, 0xc6, 0x00, 0x09, 0xe6, 0x44, 0x09, 0xe7, 0x82, 0x00, 0x01, 0xe6, 0x83, 0x06, 
+  0x23, 0x28, 0x01, 0x85, 0x09, 0xc6, 0x3a, 0xca, 0x8d, 0x34, 0xdf, 0x9e, 0xcf, 0x1c, 0x41, 0xd7, 
+  0x5d, 0x03, 0x95, 0x54, 0x43, 0x2c, 0x01, 0x85, 0x09, 0xc6, 0x41, 0x09, 0xe7, 0x8b, 0x00, 0x09, 
+  0xe7, 0x41, 0x09, 0xe6, 0x80, 0x00, 0x0a, 0x47, 0x42, 0x09, 0xe6, 0x03, 0x01, 0xe6, 0x09, 0xe6, 
+  0x0a, 0x06, 0x09, 0xe6, 0x41, 0x09, 0xe7, 0x41, 0x09, 0xe6, 0x46, 0x09, 0xe7, 0x05, 0x09, 0xe6, 
+  0x01, 0xe6, 0x0a, 0x47, 0x12, 0x67, 0x0a, 0x06, 0x09, 0xe6, 0x42, 0x0a, 0x07, 0x03, 0x01, 0xe7, 
+  0x1a, 0xe8, 0x12, 0xa7, 0x09, 0xc6, 0x80, 0x41, 0x09, 0xe7, 0x42, 0x0a, 0x07, 0x00, 0x23, 0x49, 
+  0x80, 0x0c, 0x09, 0xc6, 0x01, 0xc6, 0x09, 0xe6, 0x32, 0xeb, 0x84, 0xf3, 0xd7, 0x7d, 0xcf, 0x1b, 
+  0xc6, 0xda, 0xcf, 0x1b, 0xcf, 0x3c, 0x63, 0xcf, 0x01, 0x24, 0x09, 0xc6, 0x41, 0x09, 0xe6, 0x00, 
+  0x23, 0x28, 0x82, 0x02, 0x1b, 0x08, 0x01, 0xa5, 0x12, 0xc7, 0x82, 0x02, 0x23, 0x08, 0x0a, 0x06, 
+  0x09, 0xe6, 0x83, 0x41, 0x09, 0xe6, 0x81, 0x00, 0x1a, 0xe8, 0x83, 0x00, 0x09, 0xe6, 0x41, 0x09, 
+  0xe7, 0x41, 0x0a, 0x07, 0x00, 0x09, 0xe6, 0x82, 0x00, 0x01, 0xe6, 0x47, 0x09, 0xe7, 0x04, 0x0a, 
+  0x07, 0x01, 0xc6, 0x1a, 0xc8, 0x12, 0xa7, 0x01, 0xe6, 0x80, 0x0a, 0x0a, 0x26, 0x12, 0x47, 0x23, 
+  0x08, 0x01, 0xc5, 0x1a, 0xc8, 0x12, 0x67, 0x01, 0xc5, 0x23, 0x08, 0x0a, 0x26, 0x12, 0x87, 0x23, 
+  0x28, 0x82, 0x05, 0x09, 0xe7, 0x09, 0xc6, 0x0a, 0x06, 0x1b, 0x07, 0x23, 0x68, 0x12, 0xa7, 0x43, 
+  0x0a, 0x07, 0x02, 0x09, 0xe7, 0x12, 0x67, 0x1b, 0x08, 0x41, 0x0a, 0x07, 0x4f, 0x09, 0xe7, 0x05, 
+  0x09, 0xe6, 0x09, 0xe7, 0x09, 0xe6, 0x0a, 0x46, 0x1a, 0xe7, 0x01, 0xe6, 0x43, 0x09, 0xe6, 0x03, 
+  0x12, 0x87, 0x1b, 0x08, 0x01, 0xe5, 0x09, 0xe6, 0x43, 0x09, 0xe7, 0x00, 0x0a, 0x07, 0x85, 0x00, 
+  0x09, 0xe6, 0x57, 0x09, 0xe7, 0x00, 0x0a, 0x07, 0x82, 0x00, 0x09, 0xe6, 0x82, 0x0c, 0x12, 0x47, 
+  0x23, 0x08, 0x09, 0xc6, 0x7c, 0xd2, 0xd7, 0x7d, 0xcf, 0x1c, 0xd7, 0x1c, 0xd7, 0x5d, 0xdf, 0x7d, 
+  0x74, 0x71, 0x01, 0x85, 0x01, 0xe7, 0x0a, 0x27, 0x41, 0x0a, 0x07, 0x45, 0x09, 0xe7, 0x00, 0x0a, 
+  0x07, 0x85, 0x41, 0x0a, 0x07, 0x84, 0x44, 0x09, 0xe7, 0x00, 0x0a, 0x07, 0x42, 0x09, 0xe7, 0x00, 
+  0x09, 0xe6, 0x47, 0x09, 0xe7, 0x03, 0x01, 0xc6, 0x0a, 0x46, 0x1a, 0xc8, 0x0a, 0x47, 0x43, 0x09, 
+  0xe7, 0x82, 0x41, 0x09, 0xe7, 0x41, 0x0a, 0x07, 0x41, 0x09, 0xe7, 0x07, 0x1b, 0x28, 0x12, 0x47, 
+  0x01, 0x85, 0x09, 0xa6, 0x7c, 0xb2, 0xdf, 0x7d, 0xd7, 0x5c, 0xd7, 0x3c, 0x80, 0x03, 0xd7, 0x7d, 
+  0xce, 0xfb, 0x63, 0xcf, 0x00, 0xe3, 0x41, 0x09, 0xc6, 0x82, 0x00, 0x12, 0x47, 0x81, 0x02, 0x23, 
+  0x08, 0x01, 0xc5, 0x1a, 0xc7, 0x83, 0x01, 0x09, 0xe6, 0x09, 0xe7, 0x83, 0x00, 0x09, 0xe7, 0x86, 
+  0x00, 0x0a, 0x26, 0x43, 0x09, 0xe7, 0x80, 0x00, 0x09, 0xe7, 0x82, 0x01, 0x09, 0xe6, 0x0a, 0x07, 
+  0x47, 0x09, 0xe7, 0x00, 0x09, 0xc6, 0x82, 0x05, 0x22, 0xe8, 0x0a, 0x06, 0x0a, 0x46, 0x1a, 0xe8, 
+  0x01, 0xa5, 0x1a, 0xa8, 0x81, 0x04, 0x1a, 0xe8, 0x0a, 0x06, 0x12, 0x67, 0x23, 0x08, 0x09, 0xe7, 
+  0x41, 0x0a, 0x07, 0x80, 0x03, 0x0a, 0x07, 0x01, 0xe6, 0x12, 0x66, 0x23, 0x28, 0x44, 0x09, 0xe7, 
+  0x00, 0x09, 0xc6, 0x8b, 0x42, 0x0a, 0x07, 0x87, 0x01, 0x0a, 0x47, 0x1a, 0xe8, 0x80, 0x42, 0x09, 
+  0xe7, 0x80, 0x00, 0x02, 0x06, 0x80, 0x01, 0x01, 0xe6, 0x09, 0xc6, 0x44, 0x09, 0xe7, 0x00, 0x0a, 
+  0x07, 0x5c, 0x09, 0xe7, 0x41, 0x0a, 0x07, 0x81, 0x01, 0x23, 0x28, 0x01, 0xe6, 0x81, 0x04, 0x0a, 
+  0x07, 0x12, 0x67, 0x2b, 0x49, 0x8d, 0x54, 0xd7, 0x7d, 0x41, 0xcf, 0x1c, 0x41, 0xd7, 0x3c, 0x02, 
+  0x64, 0x10, 0x01, 0xa6, 0x09, 0xe7, 0x41, 0x0a, 0x07, 0x00, 0x09, 0xe7, 0x44, 0x0a, 0x07, 0x80, 
+  0x41, 0x0a, 0x07, 0x47, 0x09, 0xe7, 0x82, 0x00, 0x09, 0xe7, 0x41, 0x0a, 0x07, 0x51, 0x09, 0xe7, 
+  0x02, 0x09, 0xe6, 0x12, 0x67, 0x0a, 0x26, 0x41, 0x09, 0xc6, 0x80, 0x00, 0x09, 0xc6, 0x84, 0x42, 
+  0x09, 0xe7, 0x0d, 0x09, 0xc6, 0x23, 0x08, 0x12, 0x46, 0x01, 0x44, 0x7c, 0xb2, 0xdf, 0x9d, 0xcf, 
+  0x1b, 0xcf, 0x3c, 0xd7, 0x5c, 0xdf, 0x9d, 0xa5, 0xf7, 0x6c, 0x50, 0x01, 0x44, 0x09, 0xa6, 0x80, 
+  0x42, 0x09, 0xe6, 0x00, 0x23, 0x08, 0x80, 0x00, 0x09, 0xc6, 0x84, 0x00, 0x01, 0xc6, 0x81, 0x00, 
+  0x0a, 0x06, 0x85, 0x00, 0x09, 0xe7, 0x87, 0x43, 0x0a, 0x07, 0x83, 0x00, 0x09, 0xe7, 0x85, 0x42, 
+  0x0a, 0x07, 0x00, 0x01, 0xe6, 0x80, 0x00, 0x12, 0x87, 0x88, 0x00, 0x23, 0x08, 0x82, 0x00, 0x09, 
+  0xe6, 0x43, 0x0a, 0x07, 0x01, 0x09, 0xe7, 0x12, 0x67, 0x88, 0x00, 0x09, 0xe6, 0x43, 0x09, 0xe7, 
+  0x00, 0x0a, 0x07, 0x80, 0x00, 0x0a, 0x07, 0x89, 0x41, 0x09, 0xe7, 0x81, 0x01, 0x1b, 0x08, 0x09, 
+  0xe6, 0x82, 0x01, 0x09, 0xc6, 0x0a, 0x06, 0x80, 0x41, 0x09, 0xe6, 0x80, 0x41, 0x0a, 0x07, 0x51, 
+  0x09, 0xe7, 0x00, 0x0a, 0x07, 0x81, 0x00, 0x0a, 0x07, 0x88, 0x42, 0x0a, 0x07, 0x84, 0x05, 0x0a, 
+  0x07, 0x01, 0xe6, 0x12, 0x27, 0xa6, 0x17, 0xd7, 0x7d, 0xc7, 0x1c, 0x80, 0x03, 0xd7, 0x5c, 0xc6, 
+  0xdb, 0x42, 0xeb, 0x01, 0x64, 0x41, 0x09, 0xe7, 0x80, 0x00, 0x09, 0xe7, 0x45, 0x0a, 0x07, 0x8e, 
+  0x53, 0x09, 0xe7, 0x80, 0x01, 0x01, 0xe6, 0x12, 0x67, 0x84, 0x00, 0x12, 0x87, 0x86, 0x0b, 0x1a, 
+  0xc8, 0x1a, 0x87, 0x8d, 0x54, 0xd7, 0x5c, 0xcf, 0x1c, 0xcf, 0x3c, 0xdf, 0x5d, 0xef, 0xdf, 0x95, 
+  0x55, 0x12, 0x07, 0x01, 0x85, 0x09, 0xe7, 0x41, 0x09, 0xc6, 0x41, 0x09, 0xe7, 0x82, 0x00, 0x01, 
+  0xc6, 0x82, 0x00, 0x1a, 0xa7, 0x82, 0x00, 0x1b, 0x08, 0x41, 0x09, 0xe6, 0x92, 0x00, 0x0a, 0x07, 
+  0x81, 0x00, 0x09, 0xe6, 0x86, 0x41, 0x09, 0xe7, 0x83, 0x00, 0x23, 0x08, 0x81, 0x02, 0x22, 0xe8, 
+  0x01, 0x85, 0x1a, 0xa7, 0x84, 0x00, 0x23, 0x28, 0x8d, 0x00, 0x12, 0x87, 0x81, 0x42, 0x0a, 0x07, 
+  0x41, 0x09, 0xe7, 0x00, 0x0a, 0x07, 0x41, 0x09, 0xe7, 0x00, 0x0a, 0x07, 0x49, 0x09, 0xe7, 0x82, 
+  0x00, 0x01, 0xe6, 0x85, 0x00, 0x0a, 0x06, 0x41, 0x09, 0xe7, 0x92, 0x42, 0x0a, 0x07, 0x81, 0x00, 
+  0x0a, 0x07, 0x86, 0x43, 0x0a, 0x07, 0x83, 0x0b, 0x0a, 0x07, 0x09, 0xa6, 0x7c, 0xd2, 0xb6, 0x58, 
+  0xd7, 0x3c, 0xcf, 0x3c, 0xcf, 0x1b, 0xd7, 0x7d, 0x84, 0xd2, 0x22, 0x48, 0x09, 0xc6, 0x09, 0xe6, 
+  0x80, 0x00, 0x0a, 0x07, 0x42, 0x09, 0xe7, 0x82, 0x43, 0x09, 0xe7, 0x41, 0x0a, 0x07, 0x87, 0x00, 
+  0x23, 0x08, 0x95, 0x03, 0x09, 0xe7, 0x09, 0xe6, 0x12, 0x47, 0x1a, 0xc8, 0x81, 0x01, 0x01, 0xc6, 
+  0x1a, 0xc8, 0x85, 0x00, 0x09, 0xe6, 0x80, 0x0a, 0x1a, 0x67, 0x8d, 0x74, 0xdf, 0x7d, 0xcf, 0x1b, 
+  0xce, 0xfb, 0xdf, 0x5d, 0x95, 0x75, 0x3b, 0x0b, 0x22, 0xaa, 0x0a, 0x07, 0x12, 0x07, 0x44, 0x09, 
+  0xe7, 0x00, 0x01, 0xe6, 0x84, 0x01, 0x01, 0xa5, 0x12, 0xa7, 0x8d, 0x00, 0x1a, 0xc8, 0x81, 0x01, 
+  0x23, 0x08, 0x0a, 0x27, 0x86, 0x01, 0x23, 0x28, 0x0a, 0x06, 0x86, 0x41, 0x09, 0xe7, 0x00, 0x0a, 
+  0x07, 0x85, 0x01, 0x0a, 0x47, 0x1a, 0xe8, 0x86, 0x01, 0x23, 0x08, 0x09, 0xc6, 0x80, 0x41, 0x09, 
+  0xe7, 0x89, 0x00, 0x12, 0x67, 0x83, 0x50, 0x09, 0xe7, 0x02, 0x09, 0xc6, 0x0a, 0x27, 0x1a, 0xe8, 
+  0x84, 0x01, 0x0a, 0x26, 0x23, 0x28, 0x80, 0x00, 0x09, 0xe6, 0x5f, 0x09, 0xe7, 0x44, 0x0a, 0x07, 
+  0x00, 0x01, 0xe7, 0x82, 0x04, 0x01, 0xa5, 0x6c, 0x71, 0xd7, 0x7d, 0xdf, 0x9d, 0xd7, 0x5c, 0x80, 
+  0x04, 0xdf, 0x9d, 0x8d, 0x34, 0x09, 0x45, 0x01, 0x85, 0x0a, 0x07, 0x43, 0x09, 0xe7, 0x41, 0x0a, 
+  0x07, 0x00, 0x12, 0x07, 0x83, 0x00, 0x0a, 0x07, 0x41, 0x09, 0xe7, 0x83, 0x41, 0x0a, 0x07, 0x82, 
+  0x01, 0x22, 0xe8, 0x12, 0x27, 0x8c, 0x42, 0x0a, 0x07, 0x82, 0x00, 0x11, 0xe7, 0x81, 0x02, 0x09, 
+  0xc7, 0x0a, 0x07, 0x22, 0xe8, 0x81, 0x00, 0x09, 0xc6, 0x80, 0x00, 0x12, 0x67, 0x83, 0x0d, 0x0a, 
+  0x07, 0x01, 0x85, 0x74, 0x92, 0xbe, 0xba, 0xcf, 0x3c, 0xd7, 0x5c, 0xce, 0xfb, 0xdf, 0x7d, 0xa5, 
+  0xb6, 0x11, 0x65, 0x01, 0x64, 0x0a, 0x47, 0x12, 0x27, 0x0a, 0x07, 0x84, 0x00, 0x09, 0xc6, 0x82, 
+  0x02, 0x12, 0x47, 0x23, 0x09, 0x01, 0xa6, 0x83, 0x00, 0x23, 0x08, 0x80, 0x00, 0x09, 0xe7, 0x80, 
+  0x00, 0x1a, 0xc8, 0x93, 0x42, 0x09, 0xe7, 0x00, 0x0a, 0x07, 0x80, 0x00, 0x0a, 0x07, 0x81, 0x41, 
+  0x0a, 0x07, 0x83, 0x00, 0x22, 0xe8, 0x81, 0x02, 0x22, 0xe8, 0x01, 0xa5, 0x1a, 0xa8, 0x81, 0x00, 
+  0x22, 0xe8, 0x81, 0x00, 0x23, 0x09, 0x80, 0x44, 0x09, 0xe7, 0x80, 0x00, 0x2b, 0x29, 0x80, 0x00, 
+  0x0a, 0x07, 0x43, 0x09, 0xe7, 0x80, 0x01, 0x23, 0x08, 0x09, 0xe7, 0x80, 0x01, 0x09, 0xe7, 0x0a, 
+  0x07, 0x81, 0x42, 0x0a, 0x07, 0x8a, 0x00, 0x09, 0xc7, 0x80, 0x00, 0x22, 0xe8, 0x83, 0x03, 0x09, 
+  0xe6, 0x0a, 0x06, 0x23, 0x08, 0x09, 0xe6, 0x54, 0x09, 0xe7, 0x01, 0x11, 0xe7, 0x12, 0x07, 0x82, 
+  0x42, 0x0a, 0x07, 0x80, 0x00, 0x0a, 0x07, 0x86
 };
 
-const bitmap intro_240x240_bitmap = { 240, 240, (uint16_t*)intro_240x240_pixels };
+const bitmap intro_240x240_bitmap = { 240, 240, NULL, BITMAP_RLE, intro_240x240_rle, 73768 };
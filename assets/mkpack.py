@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+# mkpack.py
+# Build a binary asset pack (loaded with mmap by src/asset_pack.c)
+#
+# Layout (little-endian):
+#   header  32 bytes  magic "RCAP", version, entry count, index offset,
+#                     page size, pixel byte order
+#   index   48 bytes per entry: name[32], width, height, format, offset, size
+#   blobs   one per entry, each starting on a page boundary
+#
+# RAW blobs are RGB565 words in the requested byte order (native
+# little-endian, or --wire-order for FB_WIRE_ORDER builds). RLE blobs use the
+# BITMAP_RLE stream from png2c.py, which is byte-order independent.
+#
+# Inputs are PNG files (needs PIL) or already generated asset .c files, as
+#   name=path[:rle]
+
+import argparse
+import importlib.util
+import os
+import re
+import struct
+
+MAGIC = b"RCAP"
+VERSION = 1
+HEADER_SIZE = 32
+ENTRY_SIZE = 48
+NAME_SIZE = 32
+FORMAT_RAW = 0
+FORMAT_RLE = 1
+ORDER_LITTLE = 0
+ORDER_WIRE = 1
+
+
+def load_png2c():
+    here = os.path.dirname(os.path.abspath(__file__))
+    spec = importlib.util.spec_from_file_location("png2c", os.path.join(here, "png2c.py"))
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+
+def read_c_asset(path, png2c):
+    """Pixels of a generated asset .c file (raw BITMAP_PX array or RLE stream)"""
+    text = open(path, encoding="utf-8").read()
+    m = re.search(r"const bitmap \w+ = \{ (\d+), (\d+),", text)
+    if not m:
+        raise ValueError(f"{path}: no bitmap definition")
+    w, h = int(m.group(1)), int(m.group(2))
+
+    if "BITMAP_RLE" in text:
+        body = text[text.index("_rle["):]
+        body = body[body.index("{") + 1:body.index("}")]
+        data = bytes(int(v, 16) for v in re.findall(r"0x([0-9a-f]{2})", body))
+        return w, h, png2c.rle_decode(w, h, data)
+
+    words = [int(v, 16) for v in re.findall(r"BITMAP_PX\(0x([0-9a-f]{4})\)", text)]
+    return w, h, words
+
+
+def read_input(path, png2c):
+    if path.endswith(".c"):
+        return read_c_asset(path, png2c)
+    from PIL import Image
+    return png2c.image_to_rgb565_words(Image.open(path))
+
+
+def align(value, page):
+    return (value + page - 1) // page * page
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Build an mmap-able asset pack.")
+    ap.add_argument("entries", nargs="+", help="name=path[:rle] (path is .png or generated .c)")
+    ap.add_argument("-o", "--out", required=True, help="output pack file")
+    ap.add_argument("--page-size", type=int, default=4096, help="blob alignment (default 4096)")
+    ap.add_argument("--wire-order", action="store_true",
+                    help="store RAW pixels high byte first (FB_WIRE_ORDER builds)")
+    args = ap.parse_args()
+
+    png2c = load_png2c()
+    order = ORDER_WIRE if args.wire_order else ORDER_LITTLE
+    pixel_fmt = ">{}H" if args.wire_order else "<{}H"
+
+    blobs = []
+    for spec in args.entries:
+        name, _, source = spec.partition("=")
+        path, _, option = source.partition(":")
+        if len(name.encode()) >= NAME_SIZE:
+            raise SystemExit(f"name too long: {name}")
+
+        w, h, words = read_input(path, png2c)
+        if option == "rle":
+            blobs.append((name, w, h, FORMAT_RLE, png2c.rle_encode(w, h, words)))
+        else:
+            blobs.append((name, w, h, FORMAT_RAW, struct.pack(pixel_fmt.format(len(words)), *words)))
+
+    offset = align(HEADER_SIZE + ENTRY_SIZE * len(blobs), args.page_size)
+    index = bytearray()
+    layout = []
+    for name, w, h, fmt, data in blobs:
+        index += struct.pack("<32sHHB3xII", name.encode(), w, h, fmt, offset, len(data))
+        layout.append((offset, data))
+        offset = align(offset + len(data), args.page_size)
+
+    header = struct.pack("<4sHHIIB15x", MAGIC, VERSION, len(blobs), HEADER_SIZE,
+                         args.page_size, order)
+
+    with open(args.out, "wb") as f:
+        f.write(header)
+        f.write(index)
+        for blob_offset, data in layout:
+            f.write(b"\0" * (blob_offset - f.tell()))
+            f.write(data)
+        size = f.tell()
+
+    print(f"Wrote {args.out} ({len(blobs)} bitmaps, {size} bytes)")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,479 +1,480 @@
 // Generated by png2bitmap_rgb565_c_h_pragonce.py
+#include <stddef.h>
 #include <stdint.h>
 #include "obstacle.h"
 #include "images.h"
 
 // 75x75, RGB565 format
 static const uint16_t obstacle_75x75_pixels[5625] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0xf562, 0xf562, 0xfeea, 0xfe65, 0xfe65, 0xfe44, 0xfe44, 0xfe44, 0xfe45, 0xf668, 0xf668, 
-  0xfe03, 0xa9c0, 0xa9c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xf506, 0x1903, 0x1903, 0xfe23, 0xfe45, 0xfe45, 0xfe44, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 
-  0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xf5e3, 0xf5e3, 0x31a6, 0xdb80, 0xdb80, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xf506, 0x1903, 0x1903, 0xfe23, 0xfe45, 0xfe45, 0xfe44, 0xfe45, 0xfe45, 
-  0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xf5e3, 0xf5e3, 0x31a6, 0xdb80, 0xdb80, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfd44, 0xfffe, 0xfeaa, 0xfeaa, 0xfe44, 0xfe45, 0xfe45, 
-  0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe44, 
-  0xfe48, 0xef7d, 0xef7d, 0xdb80, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xff96, 0xfeaa, 0xfe65, 0xfe65, 
-  0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe44, 0xfe45, 0xfe45, 0xfe45, 
-  0xfe88, 0xfe64, 0xfe64, 0xfe03, 0xfe04, 0xfe04, 0xed63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xff96, 
-  0xfeaa, 0xfe65, 0xfe65, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe44, 
-  0xfe45, 0xfe45, 0xfe45, 0xfe88, 0xfe64, 0xfe64, 0xfe03, 0xfe04, 0xfe04, 0xed63, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xffff, 0xfeaa, 0xf646, 0xf646, 0xfe45, 0xfe45, 0xfe45, 0xfe65, 0xfe45, 0xfe45, 
-  0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe44, 0xfe45, 0xfe03, 0xfe03, 
-  0xfda3, 0xcb40, 0xcb40, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xfd40, 0xfd40, 0xffd8, 0xfe44, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 
-  0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe65, 0xfe65, 0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe44, 0xfe44, 
-  0xfe44, 0xfe04, 0xfe04, 0xfda2, 0xd381, 0xd381, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfd40, 0xfd40, 0xffd8, 0xfe44, 0xfe45, 0xfe45, 
-  0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe65, 0xfe65, 0xfe45, 0xfe45, 0xfe45, 
-  0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe04, 0xfe04, 0xfda2, 0xd381, 0xd381, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfd40, 0xfd40, 0xff2e, 
-  0xfe44, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe65, 0xfe65, 
-  0xfe45, 0xfe65, 0xfe65, 0xfe45, 0xfe65, 0xfe65, 0xfe45, 0xfe04, 0xfe04, 0xfda2, 0xd3c0, 0xd3c0, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xfd40, 0xfd40, 0xff2e, 0xfe44, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 
-  0xfe45, 0xfe65, 0xfe65, 0xfe45, 0xfe65, 0xfe65, 0xfe45, 0xfe65, 0xfe65, 0xfe45, 0xfe04, 0xfe04, 
-  0xfda2, 0xd3c0, 0xd3c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xfeaa, 0xfeaa, 0xfea9, 0xfe88, 0xfe44, 0xfe44, 0xfe45, 0xfe65, 0xfe65, 
-  0xfe45, 0x93c7, 0x93c7, 0x0000, 0x0000, 0x0000, 0x93c7, 0xfe45, 0xfe45, 0xfe65, 0xfe44, 0xfe44, 
-  0xfe44, 0xfec9, 0xfec9, 0xfe04, 0xdc00, 0xdc00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfeab, 0xfeab, 0xfe8a, 0xfe64, 0xfe45, 0xfe45, 
-  0x0000, 0x0840, 0x0840, 0x2945, 0x2124, 0x2124, 0x31c7, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 
-  0x0000, 0x0000, 0x0000, 0xfe44, 0xfe45, 0xfe45, 0xfe03, 0xdc00, 0xdc00, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfeab, 0xfeab, 0xfe8a, 
-  0xfe64, 0xfe45, 0xfe45, 0x0000, 0x0840, 0x0840, 0x2945, 0x2124, 0x2124, 0x31c7, 0x2124, 0x2124, 
-  0x2124, 0x2945, 0x2945, 0x0000, 0x0000, 0x0000, 0xfe44, 0xfe45, 0xfe45, 0xfe03, 0xdc00, 0xdc00, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xfd20, 0xfd20, 0xff0c, 0xfe45, 0x1903, 0x1903, 0x18e3, 0x3a07, 0x3a07, 0x3a07, 0x632c, 0x632c, 
-  0x5b2b, 0x73ae, 0x73ae, 0x632c, 0x3a07, 0x3a07, 0x3a07, 0x2124, 0x2124, 0x2104, 0xfe44, 0xfe44, 
-  0xfe04, 0xe3c0, 0xe3c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfecc, 0x2104, 0x39e7, 0x39e7, 0x5b0c, 0x5b2c, 0x5b2c, 
-  0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x6b8e, 0x5b0c, 0x5b0c, 0x5b0b, 0x5b2c, 0x5b2c, 
-  0x31c7, 0x1903, 0x1903, 0xfe04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfecc, 0x2104, 0x39e7, 0x39e7, 
-  0x5b0c, 0x5b2c, 0x5b2c, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x6b8e, 0x5b0c, 0x5b0c, 
-  0x5b0b, 0x5b2c, 0x5b2c, 0x31c7, 0x1903, 0x1903, 0xfe04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf5e5, 0xf5e5, 0xfe45, 
-  0x31a6, 0x5b0c, 0x5b0c, 0x5b0b, 0x5b0b, 0x5b0b, 0x5b0c, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b0c, 0x5b0c, 
-  0x5b0c, 0x6b6d, 0x6b6d, 0x5b0b, 0x5b2c, 0x5b2c, 0x5b2c, 0x31a6, 0x31a6, 0xe441, 0xf625, 0xf625, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf522, 
-  0xf528, 0xf528, 0xfe04, 0xfe65, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 
-  0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b2c, 0x5b2c, 0x634d, 0x5b0b, 0x5b0b, 0x5b2c, 0xfe45, 0xfe45, 
-  0xdb80, 0xf4e0, 0xf4e0, 0xfda3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xf522, 0xf528, 0xf528, 0xfe04, 0xfe65, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 
-  0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b0c, 0x5b2c, 0x5b2c, 0x634d, 0x5b0b, 0x5b0b, 
-  0x5b2c, 0xfe45, 0xfe45, 0xdb80, 0xf4e0, 0xf4e0, 0xfda3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfe03, 0x2985, 0x4aaa, 0x4aaa, 
-  0x5b0c, 0x5b0b, 0x5b0b, 0x5b0b, 0x5b0c, 0x5b0c, 0x5b0b, 0x5b0b, 0x5b0b, 0x5b2b, 0x5b2b, 0x5b2b, 
-  0x5b0b, 0x5b0b, 0x5b0b, 0x73cf, 0x0000, 0x0000, 0xe3c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfe27, 
-  0x73ae, 0x31a6, 0x31a6, 0x5b2b, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 
-  0x31a6, 0x31c7, 0x31c7, 0x31a6, 0x73ae, 0x73ae, 0x52ca, 0x3a08, 0x3a08, 0xe3c0, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xfda2, 0x7bef, 0xfeed, 0xfeed, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe45, 0xfe45, 
-  0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe88, 0xfe44, 0xfe44, 0xfe45, 0x634d, 0x634d, 
-  0xe443, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfda2, 0x7bef, 0xfeed, 0xfeed, 0xfe44, 0xfe44, 0xfe44, 
-  0xfe44, 0xfe45, 0xfe45, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe88, 0xfe44, 0xfe44, 
-  0xfe45, 0x634d, 0x634d, 0xe443, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfda2, 0x6b6d, 0xff0c, 0xff0c, 
-  0xfe87, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 
-  0xfe44, 0xfe44, 0xfe44, 0xfe44, 0x634c, 0x634c, 0xe4a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfda2, 
-  0x6b6d, 0xff96, 0xff96, 0xfe44, 0xfe87, 0xfe87, 0xfe44, 0xfe45, 0xfe45, 0xfe65, 0xfe45, 0xfe45, 
-  0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe64, 0xfe64, 0xfe24, 0x632c, 0x632c, 0xe443, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xfda2, 0x6b6d, 0xff96, 0xff96, 0xfe44, 0xfe87, 0xfe87, 0xfe44, 0xfe45, 0xfe45, 
-  0xfe65, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe64, 0xfe64, 0xfe24, 0x632c, 0x632c, 
-  0xe443, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfda3, 0x73ae, 0xff96, 0xff96, 0xfe45, 0xfe45, 0xfe45, 
-  0xfe66, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe44, 
-  0xfe44, 0x634d, 0x634d, 0xe4a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfda3, 0x8430, 0xff96, 0xff96, 
-  0xfe45, 0xfe44, 0xfe44, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 
-  0xfe44, 0xfe64, 0xfe64, 0xfe45, 0x634c, 0x634c, 0xdc45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfda3, 
-  0x8430, 0xff96, 0xff96, 0xfe45, 0xfe44, 0xfe44, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 
-  0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe64, 0xfe64, 0xfe45, 0x634c, 0x634c, 0xdc45, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xf562, 0x1081, 0xff94, 0xff94, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 
-  0xfe66, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe64, 0xfe64, 0xfe66, 0x1081, 0x1081, 
-  0xdc45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfda3, 0x7bef, 0xff30, 0xff30, 0xfe45, 0xfe65, 0xfe65, 
-  0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe48, 0xfe48, 0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe64, 0xfe64, 
-  0xfe66, 0x6b6d, 0x6b6d, 0xe4a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfda3, 0x7bef, 0xff30, 0xff30, 
-  0xfe45, 0xfe65, 0xfe65, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe48, 0xfe48, 0xfe45, 0xfe45, 0xfe45, 
-  0xfe44, 0xfe64, 0xfe64, 0xfe66, 0x6b6d, 0x6b6d, 0xe4a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfda3, 
-  0x73cf, 0xfecb, 0xfecb, 0xfe45, 0xfe89, 0xfe89, 0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe44, 0xfe44, 
-  0xfe87, 0xfe45, 0xfe45, 0xfe44, 0xfe64, 0xfe64, 0xfe66, 0x6b6d, 0x6b6d, 0xe4a5, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xf562, 0x7bef, 0xfe8a, 0xfe8a, 0xfe45, 0xfe65, 0xfe65, 0xfe45, 0xfe45, 0xfe45, 
-  0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe48, 0xfe48, 0xfe44, 0xfe64, 0xfe64, 0xfe66, 0x73cf, 0x73cf, 
-  0xe443, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf562, 0x7bef, 0xfe8a, 0xfe8a, 0xfe45, 0xfe65, 0xfe65, 
-  0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe48, 0xfe48, 0xfe44, 0xfe64, 0xfe64, 
-  0xfe66, 0x73cf, 0x73cf, 0xe443, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfd61, 0x7bef, 0xfeea, 0xfeea, 
-  0xfe45, 0xfe44, 0xfe44, 0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe45, 0xfe45, 0xfe44, 0xfe45, 0xfe45, 
-  0xfe87, 0xfe64, 0xfe64, 0xfe45, 0x73ae, 0x73ae, 0xe400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfd40, 
-  0x7bef, 0xfe88, 0xfe88, 0xfe45, 0xfe45, 0xfe45, 0xfe65, 0xfe65, 0xfe65, 0xfe65, 0xfe45, 0xfe45, 
-  0xfe45, 0xfe44, 0xfe44, 0xfe45, 0xfe65, 0xfe65, 0xfe88, 0x634d, 0x634d, 0xe3c0, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xfd40, 0x7bef, 0xfe88, 0xfe88, 0xfe45, 0xfe45, 0xfe45, 0xfe65, 0xfe65, 0xfe65, 
-  0xfe65, 0xfe45, 0xfe45, 0xfe45, 0xfe44, 0xfe44, 0xfe45, 0xfe65, 0xfe65, 0xfe88, 0x634d, 0x634d, 
-  0xe3c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfda6, 0x8c92, 0xfe66, 0xfe66, 0x1903, 0x4248, 0x4248, 
-  0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x5b0c, 0x5b0c, 
-  0xfe89, 0x634c, 0x634c, 0xe3c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfd40, 0x7bef, 0xff52, 0xff52, 
-  0x4228, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 
-  0x5b2c, 0x4248, 0x4248, 0xfe45, 0x8430, 0x8430, 0xe3c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfd40, 
-  0x7bef, 0xff52, 0xff52, 0x4228, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 
-  0x4248, 0x4248, 0x4248, 0x5b2c, 0x4248, 0x4248, 0xfe45, 0x8430, 0x8430, 0xe3c0, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xfd20, 0xfd20, 0xfecb, 0x3a08, 0xffd8, 0xffd8, 0x5b0c, 0x5b0b, 0x5b0b, 0x5b0b, 0x5b2b, 0x5b2b, 
-  0x5b0b, 0x5b0b, 0x5b0b, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b0b, 0x4a89, 0x4a89, 0xfe64, 0x39e7, 0x39e7, 
-  0xfe25, 0xd360, 0xd360, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xfe49, 0xfe49, 0xfecb, 0xfd41, 0xfffb, 0xfffb, 0x1081, 0x6b8e, 0x6b8e, 
-  0x5b2c, 0x5b2c, 0x5b2c, 0x5b2c, 0x632c, 0x632c, 0x5b2c, 0x5b2c, 0x5b2c, 0x6b6d, 0x39e7, 0x39e7, 
-  0xfe44, 0xe400, 0xe400, 0xfdc3, 0xe4a5, 0xe4a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfe49, 0xfe49, 0xfecb, 0xfd41, 0xfffb, 0xfffb, 
-  0x1081, 0x6b8e, 0x6b8e, 0x5b2c, 0x5b2c, 0x5b2c, 0x5b2c, 0x632c, 0x632c, 0x5b2c, 0x5b2c, 0x5b2c, 
-  0x6b6d, 0x39e7, 0x39e7, 0xfe44, 0xe400, 0xe400, 0xfdc3, 0xe4a5, 0xe4a5, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfeee, 0xfeee, 0xfeac, 
-  0xfd41, 0xeed2, 0xeed2, 0x18c3, 0x5b0b, 0x5b0b, 0x73ae, 0x5b0b, 0x5b0b, 0x5b0b, 0x5b0b, 0x5b0b, 
-  0x5b0b, 0x5b0b, 0x5b0b, 0x5b2c, 0x2124, 0x2124, 0xfe66, 0xdc00, 0xdc00, 0xfe03, 0xf522, 0xf522, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xf6f0, 0xf6f0, 0xfecb, 0xfd41, 0xff52, 0xff52, 0x10c2, 0x5b2c, 0x5b2c, 0x5b2b, 0x632c, 0x632c, 
-  0x5b2b, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b2b, 0x18c3, 0x18c3, 0xf522, 0xe400, 0xe400, 
-  0xfe04, 0xf522, 0xf522, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xf6f0, 0xf6f0, 0xfecb, 0xfd41, 0xff52, 0xff52, 0x10c2, 0x5b2c, 0x5b2c, 
-  0x5b2b, 0x632c, 0x632c, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b2b, 0x18c3, 0x18c3, 
-  0xf522, 0xe400, 0xe400, 0xfe04, 0xf522, 0xf522, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xff0f, 0xff0f, 0xfecb, 0xfd61, 0xfe49, 0xfe49, 
-  0x18e3, 0x5b0b, 0x5b0b, 0x5b2b, 0x5b0b, 0x5b0b, 0x5b2c, 0x5b2c, 0x5b2c, 0x5b2c, 0x5b2b, 0x5b2b, 
-  0x5b2b, 0x18c3, 0x18c3, 0xec41, 0xe441, 0xe441, 0xfe04, 0xf522, 0xf522, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfeee, 0xfeee, 0xfeab, 
-  0xfecb, 0xfda6, 0xfda6, 0x18c3, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b2c, 0x5b2c, 
-  0x5b2b, 0x5b2b, 0x5b2b, 0x5b0b, 0x18c3, 0x18c3, 0xe441, 0xfda2, 0xfda2, 0xfe03, 0xfd02, 0xfd02, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xfeee, 0xfeee, 0xfeab, 0xfecb, 0xfda6, 0xfda6, 0x18c3, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b2b, 
-  0x5b2b, 0x5b2c, 0x5b2c, 0x5b2b, 0x5b2b, 0x5b2b, 0x5b0b, 0x18c3, 0x18c3, 0xe441, 0xfda2, 0xfda2, 
-  0xfe03, 0xfd02, 0xfd02, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xfeee, 0xfeee, 0xfeaa, 0xfecb, 0xfdc4, 0xfdc4, 0x18c3, 0x73cf, 0x73cf, 
-  0x5b2c, 0x5b2c, 0x5b2c, 0x5b2c, 0x5b2c, 0x5b2c, 0x632c, 0x5b2b, 0x5b2b, 0x5b2c, 0x18c3, 0x18c3, 
-  0xe441, 0xfda2, 0xfda2, 0xfe04, 0xf566, 0xf566, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfeab, 0xfeab, 0xfeaa, 0xfecb, 0xfde5, 0xfde5, 
-  0x18c3, 0x5b2c, 0x5b2c, 0x5b2c, 0x5b2b, 0x5b2b, 0x5b0b, 0x5b2c, 0x5b2c, 0x5b0b, 0x632c, 0x632c, 
-  0x5b2b, 0x1903, 0x1903, 0xec81, 0xfda2, 0xfda2, 0xfe03, 0xe441, 0xe441, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfeab, 0xfeab, 0xfeaa, 
-  0xfecb, 0xfde5, 0xfde5, 0x18c3, 0x5b2c, 0x5b2c, 0x5b2c, 0x5b2b, 0x5b2b, 0x5b0b, 0x5b2c, 0x5b2c, 
-  0x5b0b, 0x632c, 0x632c, 0x5b2b, 0x1903, 0x1903, 0xec81, 0xfda2, 0xfda2, 0xfe03, 0xe441, 0xe441, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xfd20, 0xfd20, 0xff0f, 0xfecb, 0xfde5, 0xfde5, 0xfe24, 0x18e3, 0x18e3, 0x18c3, 0x52eb, 0x52eb, 
-  0x52ca, 0x52ca, 0x52ca, 0x52eb, 0x18c3, 0x18c3, 0x2124, 0xfe44, 0xfe44, 0xec61, 0xfdc3, 0xfdc3, 
-  0xfdc3, 0xdb80, 0xdb80, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xfd20, 0xfd20, 0xff0f, 0xfecb, 0xfde5, 0xfde5, 0xfe24, 0x18e3, 0x18e3, 
-  0x18c3, 0x52eb, 0x52eb, 0x52ca, 0x52ca, 0x52ca, 0x52eb, 0x18c3, 0x18c3, 0x2124, 0xfe44, 0xfe44, 
-  0xec61, 0xfdc3, 0xfdc3, 0xfdc3, 0xdb80, 0xdb80, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xfecb, 0xfde5, 0xfde5, 
-  0xfe24, 0xfe44, 0xfe44, 0xfe65, 0xf627, 0xf627, 0xa3c2, 0xa3c2, 0xa3c2, 0xf627, 0xfe44, 0xfe44, 
-  0xfe44, 0xfe24, 0xfe24, 0xf4e1, 0xfda2, 0xfda2, 0xfda3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xeed2, 
-  0xfeee, 0xfdc4, 0xfdc4, 0xfea9, 0xfe44, 0xfe44, 0xfe45, 0xfe65, 0xfe65, 0xfe65, 0xfe44, 0xfe44, 
-  0xfe65, 0xfe45, 0xfe45, 0xfe44, 0xfeaa, 0xfeaa, 0xf566, 0xfda3, 0xfda3, 0xe4e9, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xeed2, 0xfeee, 0xfdc4, 0xfdc4, 0xfea9, 0xfe44, 0xfe44, 0xfe45, 0xfe65, 0xfe65, 
-  0xfe65, 0xfe44, 0xfe44, 0xfe65, 0xfe45, 0xfe45, 0xfe44, 0xfeaa, 0xfeaa, 0xf566, 0xfda3, 0xfda3, 
-  0xe4e9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf66b, 0xfecc, 0xfecc, 0xfea9, 0xfe65, 0xfe65, 
-  0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe45, 0xfe45, 0xfe88, 0xfe65, 0xfe65, 
-  0xf506, 0xf5a4, 0xf5a4, 0xcb40, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4020, 0x4020, 
-  0xfe45, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe24, 0xfe24, 
-  0xfe44, 0xfe44, 0xfe44, 0x4020, 0xb220, 0xb220, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x4020, 0x4020, 0xfe45, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 0xfe44, 
-  0xfe44, 0xfe24, 0xfe24, 0xfe44, 0xfe44, 0xfe44, 0x4020, 0xb220, 0xb220, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe400, 0xe400, 0xe4e9, 0xf6ae, 0xf6ae, 
-  0xf627, 0xfe27, 0xfe27, 0xf6ae, 0xdc45, 0xdc45, 0xe3c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0xf562), BITMAP_PX(0xf562), BITMAP_PX(0xfeea), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xf668), BITMAP_PX(0xf668), 
+  BITMAP_PX(0xfe03), BITMAP_PX(0xa9c0), BITMAP_PX(0xa9c0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xf506), BITMAP_PX(0x1903), BITMAP_PX(0x1903), BITMAP_PX(0xfe23), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xf5e3), BITMAP_PX(0xf5e3), BITMAP_PX(0x31a6), BITMAP_PX(0xdb80), BITMAP_PX(0xdb80), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xf506), BITMAP_PX(0x1903), BITMAP_PX(0x1903), BITMAP_PX(0xfe23), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xf5e3), BITMAP_PX(0xf5e3), BITMAP_PX(0x31a6), BITMAP_PX(0xdb80), BITMAP_PX(0xdb80), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfd44), BITMAP_PX(0xfffe), BITMAP_PX(0xfeaa), BITMAP_PX(0xfeaa), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), 
+  BITMAP_PX(0xfe48), BITMAP_PX(0xef7d), BITMAP_PX(0xef7d), BITMAP_PX(0xdb80), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xff96), BITMAP_PX(0xfeaa), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe88), BITMAP_PX(0xfe64), BITMAP_PX(0xfe64), BITMAP_PX(0xfe03), BITMAP_PX(0xfe04), BITMAP_PX(0xfe04), BITMAP_PX(0xed63), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xff96), 
+  BITMAP_PX(0xfeaa), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe88), BITMAP_PX(0xfe64), BITMAP_PX(0xfe64), BITMAP_PX(0xfe03), BITMAP_PX(0xfe04), BITMAP_PX(0xfe04), BITMAP_PX(0xed63), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xfeaa), BITMAP_PX(0xf646), BITMAP_PX(0xf646), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe03), BITMAP_PX(0xfe03), 
+  BITMAP_PX(0xfda3), BITMAP_PX(0xcb40), BITMAP_PX(0xcb40), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfd40), BITMAP_PX(0xfd40), BITMAP_PX(0xffd8), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), 
+  BITMAP_PX(0xfe44), BITMAP_PX(0xfe04), BITMAP_PX(0xfe04), BITMAP_PX(0xfda2), BITMAP_PX(0xd381), BITMAP_PX(0xd381), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfd40), BITMAP_PX(0xfd40), BITMAP_PX(0xffd8), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe04), BITMAP_PX(0xfe04), BITMAP_PX(0xfda2), BITMAP_PX(0xd381), BITMAP_PX(0xd381), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfd40), BITMAP_PX(0xfd40), BITMAP_PX(0xff2e), 
+  BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe04), BITMAP_PX(0xfe04), BITMAP_PX(0xfda2), BITMAP_PX(0xd3c0), BITMAP_PX(0xd3c0), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xfd40), BITMAP_PX(0xfd40), BITMAP_PX(0xff2e), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe04), BITMAP_PX(0xfe04), 
+  BITMAP_PX(0xfda2), BITMAP_PX(0xd3c0), BITMAP_PX(0xd3c0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfeaa), BITMAP_PX(0xfeaa), BITMAP_PX(0xfea9), BITMAP_PX(0xfe88), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0x93c7), BITMAP_PX(0x93c7), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x93c7), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), 
+  BITMAP_PX(0xfe44), BITMAP_PX(0xfec9), BITMAP_PX(0xfec9), BITMAP_PX(0xfe04), BITMAP_PX(0xdc00), BITMAP_PX(0xdc00), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfeab), BITMAP_PX(0xfeab), BITMAP_PX(0xfe8a), BITMAP_PX(0xfe64), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0840), BITMAP_PX(0x0840), BITMAP_PX(0x2945), BITMAP_PX(0x2124), BITMAP_PX(0x2124), BITMAP_PX(0x31c7), BITMAP_PX(0x2124), BITMAP_PX(0x2124), BITMAP_PX(0x2124), BITMAP_PX(0x2945), BITMAP_PX(0x2945), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe03), BITMAP_PX(0xdc00), BITMAP_PX(0xdc00), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfeab), BITMAP_PX(0xfeab), BITMAP_PX(0xfe8a), 
+  BITMAP_PX(0xfe64), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0x0000), BITMAP_PX(0x0840), BITMAP_PX(0x0840), BITMAP_PX(0x2945), BITMAP_PX(0x2124), BITMAP_PX(0x2124), BITMAP_PX(0x31c7), BITMAP_PX(0x2124), BITMAP_PX(0x2124), 
+  BITMAP_PX(0x2124), BITMAP_PX(0x2945), BITMAP_PX(0x2945), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe03), BITMAP_PX(0xdc00), BITMAP_PX(0xdc00), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xfd20), BITMAP_PX(0xfd20), BITMAP_PX(0xff0c), BITMAP_PX(0xfe45), BITMAP_PX(0x1903), BITMAP_PX(0x1903), BITMAP_PX(0x18e3), BITMAP_PX(0x3a07), BITMAP_PX(0x3a07), BITMAP_PX(0x3a07), BITMAP_PX(0x632c), BITMAP_PX(0x632c), 
+  BITMAP_PX(0x5b2b), BITMAP_PX(0x73ae), BITMAP_PX(0x73ae), BITMAP_PX(0x632c), BITMAP_PX(0x3a07), BITMAP_PX(0x3a07), BITMAP_PX(0x3a07), BITMAP_PX(0x2124), BITMAP_PX(0x2124), BITMAP_PX(0x2104), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), 
+  BITMAP_PX(0xfe04), BITMAP_PX(0xe3c0), BITMAP_PX(0xe3c0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfecc), BITMAP_PX(0x2104), BITMAP_PX(0x39e7), BITMAP_PX(0x39e7), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), 
+  BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x6b8e), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), 
+  BITMAP_PX(0x31c7), BITMAP_PX(0x1903), BITMAP_PX(0x1903), BITMAP_PX(0xfe04), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfecc), BITMAP_PX(0x2104), BITMAP_PX(0x39e7), BITMAP_PX(0x39e7), 
+  BITMAP_PX(0x5b0c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x6b8e), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), 
+  BITMAP_PX(0x5b0b), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x31c7), BITMAP_PX(0x1903), BITMAP_PX(0x1903), BITMAP_PX(0xfe04), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xf5e5), BITMAP_PX(0xf5e5), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0x31a6), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), 
+  BITMAP_PX(0x5b0c), BITMAP_PX(0x6b6d), BITMAP_PX(0x6b6d), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x31a6), BITMAP_PX(0x31a6), BITMAP_PX(0xe441), BITMAP_PX(0xf625), BITMAP_PX(0xf625), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xf522), 
+  BITMAP_PX(0xf528), BITMAP_PX(0xf528), BITMAP_PX(0xfe04), BITMAP_PX(0xfe65), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), 
+  BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x634d), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b2c), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xdb80), BITMAP_PX(0xf4e0), BITMAP_PX(0xf4e0), BITMAP_PX(0xfda3), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xf522), BITMAP_PX(0xf528), BITMAP_PX(0xf528), BITMAP_PX(0xfe04), BITMAP_PX(0xfe65), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), 
+  BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x634d), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), 
+  BITMAP_PX(0x5b2c), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xdb80), BITMAP_PX(0xf4e0), BITMAP_PX(0xf4e0), BITMAP_PX(0xfda3), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfe03), BITMAP_PX(0x2985), BITMAP_PX(0x4aaa), BITMAP_PX(0x4aaa), 
+  BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), 
+  BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x73cf), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xe3c0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfe27), 
+  BITMAP_PX(0x73ae), BITMAP_PX(0x31a6), BITMAP_PX(0x31a6), BITMAP_PX(0x5b2b), BITMAP_PX(0x31a6), BITMAP_PX(0x31a6), BITMAP_PX(0x31a6), BITMAP_PX(0x31a6), BITMAP_PX(0x31a6), BITMAP_PX(0x31a6), BITMAP_PX(0x31a6), BITMAP_PX(0x31a6), 
+  BITMAP_PX(0x31a6), BITMAP_PX(0x31c7), BITMAP_PX(0x31c7), BITMAP_PX(0x31a6), BITMAP_PX(0x73ae), BITMAP_PX(0x73ae), BITMAP_PX(0x52ca), BITMAP_PX(0x3a08), BITMAP_PX(0x3a08), BITMAP_PX(0xe3c0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfda2), BITMAP_PX(0x7bef), BITMAP_PX(0xfeed), BITMAP_PX(0xfeed), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe88), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0x634d), BITMAP_PX(0x634d), 
+  BITMAP_PX(0xe443), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfda2), BITMAP_PX(0x7bef), BITMAP_PX(0xfeed), BITMAP_PX(0xfeed), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), 
+  BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe88), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0x634d), BITMAP_PX(0x634d), BITMAP_PX(0xe443), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfda2), BITMAP_PX(0x6b6d), BITMAP_PX(0xff0c), BITMAP_PX(0xff0c), 
+  BITMAP_PX(0xfe87), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), 
+  BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0x634c), BITMAP_PX(0x634c), BITMAP_PX(0xe4a5), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfda2), 
+  BITMAP_PX(0x6b6d), BITMAP_PX(0xff96), BITMAP_PX(0xff96), BITMAP_PX(0xfe44), BITMAP_PX(0xfe87), BITMAP_PX(0xfe87), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe64), BITMAP_PX(0xfe64), BITMAP_PX(0xfe24), BITMAP_PX(0x632c), BITMAP_PX(0x632c), BITMAP_PX(0xe443), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfda2), BITMAP_PX(0x6b6d), BITMAP_PX(0xff96), BITMAP_PX(0xff96), BITMAP_PX(0xfe44), BITMAP_PX(0xfe87), BITMAP_PX(0xfe87), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe64), BITMAP_PX(0xfe64), BITMAP_PX(0xfe24), BITMAP_PX(0x632c), BITMAP_PX(0x632c), 
+  BITMAP_PX(0xe443), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfda3), BITMAP_PX(0x73ae), BITMAP_PX(0xff96), BITMAP_PX(0xff96), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe66), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), 
+  BITMAP_PX(0xfe44), BITMAP_PX(0x634d), BITMAP_PX(0x634d), BITMAP_PX(0xe4a5), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfda3), BITMAP_PX(0x8430), BITMAP_PX(0xff96), BITMAP_PX(0xff96), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe44), BITMAP_PX(0xfe64), BITMAP_PX(0xfe64), BITMAP_PX(0xfe45), BITMAP_PX(0x634c), BITMAP_PX(0x634c), BITMAP_PX(0xdc45), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfda3), 
+  BITMAP_PX(0x8430), BITMAP_PX(0xff96), BITMAP_PX(0xff96), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe64), BITMAP_PX(0xfe64), BITMAP_PX(0xfe45), BITMAP_PX(0x634c), BITMAP_PX(0x634c), BITMAP_PX(0xdc45), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xf562), BITMAP_PX(0x1081), BITMAP_PX(0xff94), BITMAP_PX(0xff94), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe66), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe64), BITMAP_PX(0xfe64), BITMAP_PX(0xfe66), BITMAP_PX(0x1081), BITMAP_PX(0x1081), 
+  BITMAP_PX(0xdc45), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfda3), BITMAP_PX(0x7bef), BITMAP_PX(0xff30), BITMAP_PX(0xff30), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe48), BITMAP_PX(0xfe48), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe64), BITMAP_PX(0xfe64), 
+  BITMAP_PX(0xfe66), BITMAP_PX(0x6b6d), BITMAP_PX(0x6b6d), BITMAP_PX(0xe4a5), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfda3), BITMAP_PX(0x7bef), BITMAP_PX(0xff30), BITMAP_PX(0xff30), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe48), BITMAP_PX(0xfe48), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe44), BITMAP_PX(0xfe64), BITMAP_PX(0xfe64), BITMAP_PX(0xfe66), BITMAP_PX(0x6b6d), BITMAP_PX(0x6b6d), BITMAP_PX(0xe4a5), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfda3), 
+  BITMAP_PX(0x73cf), BITMAP_PX(0xfecb), BITMAP_PX(0xfecb), BITMAP_PX(0xfe45), BITMAP_PX(0xfe89), BITMAP_PX(0xfe89), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), 
+  BITMAP_PX(0xfe87), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe64), BITMAP_PX(0xfe64), BITMAP_PX(0xfe66), BITMAP_PX(0x6b6d), BITMAP_PX(0x6b6d), BITMAP_PX(0xe4a5), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xf562), BITMAP_PX(0x7bef), BITMAP_PX(0xfe8a), BITMAP_PX(0xfe8a), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe48), BITMAP_PX(0xfe48), BITMAP_PX(0xfe44), BITMAP_PX(0xfe64), BITMAP_PX(0xfe64), BITMAP_PX(0xfe66), BITMAP_PX(0x73cf), BITMAP_PX(0x73cf), 
+  BITMAP_PX(0xe443), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xf562), BITMAP_PX(0x7bef), BITMAP_PX(0xfe8a), BITMAP_PX(0xfe8a), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe48), BITMAP_PX(0xfe48), BITMAP_PX(0xfe44), BITMAP_PX(0xfe64), BITMAP_PX(0xfe64), 
+  BITMAP_PX(0xfe66), BITMAP_PX(0x73cf), BITMAP_PX(0x73cf), BITMAP_PX(0xe443), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfd61), BITMAP_PX(0x7bef), BITMAP_PX(0xfeea), BITMAP_PX(0xfeea), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe87), BITMAP_PX(0xfe64), BITMAP_PX(0xfe64), BITMAP_PX(0xfe45), BITMAP_PX(0x73ae), BITMAP_PX(0x73ae), BITMAP_PX(0xe400), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfd40), 
+  BITMAP_PX(0x7bef), BITMAP_PX(0xfe88), BITMAP_PX(0xfe88), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe88), BITMAP_PX(0x634d), BITMAP_PX(0x634d), BITMAP_PX(0xe3c0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfd40), BITMAP_PX(0x7bef), BITMAP_PX(0xfe88), BITMAP_PX(0xfe88), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), 
+  BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe88), BITMAP_PX(0x634d), BITMAP_PX(0x634d), 
+  BITMAP_PX(0xe3c0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfda6), BITMAP_PX(0x8c92), BITMAP_PX(0xfe66), BITMAP_PX(0xfe66), BITMAP_PX(0x1903), BITMAP_PX(0x4248), BITMAP_PX(0x4248), 
+  BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0c), 
+  BITMAP_PX(0xfe89), BITMAP_PX(0x634c), BITMAP_PX(0x634c), BITMAP_PX(0xe3c0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfd40), BITMAP_PX(0x7bef), BITMAP_PX(0xff52), BITMAP_PX(0xff52), 
+  BITMAP_PX(0x4228), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), 
+  BITMAP_PX(0x5b2c), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0xfe45), BITMAP_PX(0x8430), BITMAP_PX(0x8430), BITMAP_PX(0xe3c0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfd40), 
+  BITMAP_PX(0x7bef), BITMAP_PX(0xff52), BITMAP_PX(0xff52), BITMAP_PX(0x4228), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), 
+  BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0x5b2c), BITMAP_PX(0x4248), BITMAP_PX(0x4248), BITMAP_PX(0xfe45), BITMAP_PX(0x8430), BITMAP_PX(0x8430), BITMAP_PX(0xe3c0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xfd20), BITMAP_PX(0xfd20), BITMAP_PX(0xfecb), BITMAP_PX(0x3a08), BITMAP_PX(0xffd8), BITMAP_PX(0xffd8), BITMAP_PX(0x5b0c), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), 
+  BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b0b), BITMAP_PX(0x4a89), BITMAP_PX(0x4a89), BITMAP_PX(0xfe64), BITMAP_PX(0x39e7), BITMAP_PX(0x39e7), 
+  BITMAP_PX(0xfe25), BITMAP_PX(0xd360), BITMAP_PX(0xd360), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfe49), BITMAP_PX(0xfe49), BITMAP_PX(0xfecb), BITMAP_PX(0xfd41), BITMAP_PX(0xfffb), BITMAP_PX(0xfffb), BITMAP_PX(0x1081), BITMAP_PX(0x6b8e), BITMAP_PX(0x6b8e), 
+  BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x632c), BITMAP_PX(0x632c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x6b6d), BITMAP_PX(0x39e7), BITMAP_PX(0x39e7), 
+  BITMAP_PX(0xfe44), BITMAP_PX(0xe400), BITMAP_PX(0xe400), BITMAP_PX(0xfdc3), BITMAP_PX(0xe4a5), BITMAP_PX(0xe4a5), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfe49), BITMAP_PX(0xfe49), BITMAP_PX(0xfecb), BITMAP_PX(0xfd41), BITMAP_PX(0xfffb), BITMAP_PX(0xfffb), 
+  BITMAP_PX(0x1081), BITMAP_PX(0x6b8e), BITMAP_PX(0x6b8e), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x632c), BITMAP_PX(0x632c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), 
+  BITMAP_PX(0x6b6d), BITMAP_PX(0x39e7), BITMAP_PX(0x39e7), BITMAP_PX(0xfe44), BITMAP_PX(0xe400), BITMAP_PX(0xe400), BITMAP_PX(0xfdc3), BITMAP_PX(0xe4a5), BITMAP_PX(0xe4a5), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfeee), BITMAP_PX(0xfeee), BITMAP_PX(0xfeac), 
+  BITMAP_PX(0xfd41), BITMAP_PX(0xeed2), BITMAP_PX(0xeed2), BITMAP_PX(0x18c3), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x73ae), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), 
+  BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b2c), BITMAP_PX(0x2124), BITMAP_PX(0x2124), BITMAP_PX(0xfe66), BITMAP_PX(0xdc00), BITMAP_PX(0xdc00), BITMAP_PX(0xfe03), BITMAP_PX(0xf522), BITMAP_PX(0xf522), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xf6f0), BITMAP_PX(0xf6f0), BITMAP_PX(0xfecb), BITMAP_PX(0xfd41), BITMAP_PX(0xff52), BITMAP_PX(0xff52), BITMAP_PX(0x10c2), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2b), BITMAP_PX(0x632c), BITMAP_PX(0x632c), 
+  BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x18c3), BITMAP_PX(0x18c3), BITMAP_PX(0xf522), BITMAP_PX(0xe400), BITMAP_PX(0xe400), 
+  BITMAP_PX(0xfe04), BITMAP_PX(0xf522), BITMAP_PX(0xf522), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xf6f0), BITMAP_PX(0xf6f0), BITMAP_PX(0xfecb), BITMAP_PX(0xfd41), BITMAP_PX(0xff52), BITMAP_PX(0xff52), BITMAP_PX(0x10c2), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), 
+  BITMAP_PX(0x5b2b), BITMAP_PX(0x632c), BITMAP_PX(0x632c), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x18c3), BITMAP_PX(0x18c3), 
+  BITMAP_PX(0xf522), BITMAP_PX(0xe400), BITMAP_PX(0xe400), BITMAP_PX(0xfe04), BITMAP_PX(0xf522), BITMAP_PX(0xf522), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xff0f), BITMAP_PX(0xff0f), BITMAP_PX(0xfecb), BITMAP_PX(0xfd61), BITMAP_PX(0xfe49), BITMAP_PX(0xfe49), 
+  BITMAP_PX(0x18e3), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), 
+  BITMAP_PX(0x5b2b), BITMAP_PX(0x18c3), BITMAP_PX(0x18c3), BITMAP_PX(0xec41), BITMAP_PX(0xe441), BITMAP_PX(0xe441), BITMAP_PX(0xfe04), BITMAP_PX(0xf522), BITMAP_PX(0xf522), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfeee), BITMAP_PX(0xfeee), BITMAP_PX(0xfeab), 
+  BITMAP_PX(0xfecb), BITMAP_PX(0xfda6), BITMAP_PX(0xfda6), BITMAP_PX(0x18c3), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), 
+  BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b0b), BITMAP_PX(0x18c3), BITMAP_PX(0x18c3), BITMAP_PX(0xe441), BITMAP_PX(0xfda2), BITMAP_PX(0xfda2), BITMAP_PX(0xfe03), BITMAP_PX(0xfd02), BITMAP_PX(0xfd02), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xfeee), BITMAP_PX(0xfeee), BITMAP_PX(0xfeab), BITMAP_PX(0xfecb), BITMAP_PX(0xfda6), BITMAP_PX(0xfda6), BITMAP_PX(0x18c3), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), 
+  BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b0b), BITMAP_PX(0x18c3), BITMAP_PX(0x18c3), BITMAP_PX(0xe441), BITMAP_PX(0xfda2), BITMAP_PX(0xfda2), 
+  BITMAP_PX(0xfe03), BITMAP_PX(0xfd02), BITMAP_PX(0xfd02), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfeee), BITMAP_PX(0xfeee), BITMAP_PX(0xfeaa), BITMAP_PX(0xfecb), BITMAP_PX(0xfdc4), BITMAP_PX(0xfdc4), BITMAP_PX(0x18c3), BITMAP_PX(0x73cf), BITMAP_PX(0x73cf), 
+  BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x632c), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2c), BITMAP_PX(0x18c3), BITMAP_PX(0x18c3), 
+  BITMAP_PX(0xe441), BITMAP_PX(0xfda2), BITMAP_PX(0xfda2), BITMAP_PX(0xfe04), BITMAP_PX(0xf566), BITMAP_PX(0xf566), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfeab), BITMAP_PX(0xfeab), BITMAP_PX(0xfeaa), BITMAP_PX(0xfecb), BITMAP_PX(0xfde5), BITMAP_PX(0xfde5), 
+  BITMAP_PX(0x18c3), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b0b), BITMAP_PX(0x632c), BITMAP_PX(0x632c), 
+  BITMAP_PX(0x5b2b), BITMAP_PX(0x1903), BITMAP_PX(0x1903), BITMAP_PX(0xec81), BITMAP_PX(0xfda2), BITMAP_PX(0xfda2), BITMAP_PX(0xfe03), BITMAP_PX(0xe441), BITMAP_PX(0xe441), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfeab), BITMAP_PX(0xfeab), BITMAP_PX(0xfeaa), 
+  BITMAP_PX(0xfecb), BITMAP_PX(0xfde5), BITMAP_PX(0xfde5), BITMAP_PX(0x18c3), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b2b), BITMAP_PX(0x5b0b), BITMAP_PX(0x5b2c), BITMAP_PX(0x5b2c), 
+  BITMAP_PX(0x5b0b), BITMAP_PX(0x632c), BITMAP_PX(0x632c), BITMAP_PX(0x5b2b), BITMAP_PX(0x1903), BITMAP_PX(0x1903), BITMAP_PX(0xec81), BITMAP_PX(0xfda2), BITMAP_PX(0xfda2), BITMAP_PX(0xfe03), BITMAP_PX(0xe441), BITMAP_PX(0xe441), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0xfd20), BITMAP_PX(0xfd20), BITMAP_PX(0xff0f), BITMAP_PX(0xfecb), BITMAP_PX(0xfde5), BITMAP_PX(0xfde5), BITMAP_PX(0xfe24), BITMAP_PX(0x18e3), BITMAP_PX(0x18e3), BITMAP_PX(0x18c3), BITMAP_PX(0x52eb), BITMAP_PX(0x52eb), 
+  BITMAP_PX(0x52ca), BITMAP_PX(0x52ca), BITMAP_PX(0x52ca), BITMAP_PX(0x52eb), BITMAP_PX(0x18c3), BITMAP_PX(0x18c3), BITMAP_PX(0x2124), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xec61), BITMAP_PX(0xfdc3), BITMAP_PX(0xfdc3), 
+  BITMAP_PX(0xfdc3), BITMAP_PX(0xdb80), BITMAP_PX(0xdb80), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xfd20), BITMAP_PX(0xfd20), BITMAP_PX(0xff0f), BITMAP_PX(0xfecb), BITMAP_PX(0xfde5), BITMAP_PX(0xfde5), BITMAP_PX(0xfe24), BITMAP_PX(0x18e3), BITMAP_PX(0x18e3), 
+  BITMAP_PX(0x18c3), BITMAP_PX(0x52eb), BITMAP_PX(0x52eb), BITMAP_PX(0x52ca), BITMAP_PX(0x52ca), BITMAP_PX(0x52ca), BITMAP_PX(0x52eb), BITMAP_PX(0x18c3), BITMAP_PX(0x18c3), BITMAP_PX(0x2124), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), 
+  BITMAP_PX(0xec61), BITMAP_PX(0xfdc3), BITMAP_PX(0xfdc3), BITMAP_PX(0xfdc3), BITMAP_PX(0xdb80), BITMAP_PX(0xdb80), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xffff), BITMAP_PX(0xfecb), BITMAP_PX(0xfde5), BITMAP_PX(0xfde5), 
+  BITMAP_PX(0xfe24), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe65), BITMAP_PX(0xf627), BITMAP_PX(0xf627), BITMAP_PX(0xa3c2), BITMAP_PX(0xa3c2), BITMAP_PX(0xa3c2), BITMAP_PX(0xf627), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), 
+  BITMAP_PX(0xfe44), BITMAP_PX(0xfe24), BITMAP_PX(0xfe24), BITMAP_PX(0xf4e1), BITMAP_PX(0xfda2), BITMAP_PX(0xfda2), BITMAP_PX(0xfda3), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xeed2), 
+  BITMAP_PX(0xfeee), BITMAP_PX(0xfdc4), BITMAP_PX(0xfdc4), BITMAP_PX(0xfea9), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), 
+  BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfeaa), BITMAP_PX(0xfeaa), BITMAP_PX(0xf566), BITMAP_PX(0xfda3), BITMAP_PX(0xfda3), BITMAP_PX(0xe4e9), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xeed2), BITMAP_PX(0xfeee), BITMAP_PX(0xfdc4), BITMAP_PX(0xfdc4), BITMAP_PX(0xfea9), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), 
+  BITMAP_PX(0xfe65), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe65), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfeaa), BITMAP_PX(0xfeaa), BITMAP_PX(0xf566), BITMAP_PX(0xfda3), BITMAP_PX(0xfda3), 
+  BITMAP_PX(0xe4e9), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xf66b), BITMAP_PX(0xfecc), BITMAP_PX(0xfecc), BITMAP_PX(0xfea9), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), 
+  BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe45), BITMAP_PX(0xfe45), BITMAP_PX(0xfe88), BITMAP_PX(0xfe65), BITMAP_PX(0xfe65), 
+  BITMAP_PX(0xf506), BITMAP_PX(0xf5a4), BITMAP_PX(0xf5a4), BITMAP_PX(0xcb40), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x4020), BITMAP_PX(0x4020), 
+  BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe24), BITMAP_PX(0xfe24), 
+  BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0x4020), BITMAP_PX(0xb220), BITMAP_PX(0xb220), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x4020), BITMAP_PX(0x4020), BITMAP_PX(0xfe45), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), 
+  BITMAP_PX(0xfe44), BITMAP_PX(0xfe24), BITMAP_PX(0xfe24), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0xfe44), BITMAP_PX(0x4020), BITMAP_PX(0xb220), BITMAP_PX(0xb220), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0xe400), BITMAP_PX(0xe400), BITMAP_PX(0xe4e9), BITMAP_PX(0xf6ae), BITMAP_PX(0xf6ae), 
+  BITMAP_PX(0xf627), BITMAP_PX(0xfe27), BITMAP_PX(0xfe27), BITMAP_PX(0xf6ae), BITMAP_PX(0xdc45), BITMAP_PX(0xdc45), BITMAP_PX(0xe3c0), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), 
+  BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000), BITMAP_PX(0x0000)
 };
 
-const bitmap obstacle_75x75_bitmap = { 75, 75, (uint16_t*)obstacle_75x75_pixels };
+const bitmap obstacle_75x75_bitmap = { 75, 75, (uint16_t*)obstacle_75x75_pixels, BITMAP_RAW, NULL, 0 };
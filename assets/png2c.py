@@ -1,14 +1,17 @@
 #!/usr/bin/env python3
 # png2bitmap_rgb565_c_h_pragonce.py
 # Convert PNG → RGB565 .c + .h files for:
-# struct bitmap { uint16_t width; uint16_t height; uint16_t* bitmap; }
+# struct bitmap (assets/images.h)
 # Symbols are prefixed with the PNG filename (without extension)
 # .h uses #pragma once instead of include guards
+# Pixels are wrapped in BITMAP_PX() (images.h) so FB_WIRE_ORDER builds
+# get byte-swapped data at compile time
+# --rle emits a BITMAP_RLE stream instead (format in drivers/lcd/bitmap_rle.h)
 
 import argparse
 import os
 import struct
-from PIL import Image
+import sys
 
 
 def pack_rgb565(r, g, b):
@@ -33,16 +36,83 @@ def image_to_rgb565_words(img):
     return w, h, words
 
 
+RLE_OP_LITERAL = 0x00
+RLE_OP_RUN = 0x40
+RLE_OP_UP = 0x80
+RLE_MAX_COUNT = 64
+
+
+def rle_encode(w, h, words):
+    """RGB565 words → BITMAP_RLE byte stream (greedy, runs never cross rows)"""
+    out = bytearray()
+    for y in range(h):
+        row = words[y * w:(y + 1) * w]
+        prev = words[(y - 1) * w:y * w] if y > 0 else None
+        literal = []
+
+        def flush_literal():
+            while literal:
+                chunk = literal[:RLE_MAX_COUNT]
+                del literal[:RLE_MAX_COUNT]
+                out.append(RLE_OP_LITERAL | (len(chunk) - 1))
+                for v in chunk:
+                    out.extend((v >> 8, v & 0xFF))
+
+        x = 0
+        while x < w:
+            run = 1
+            while x + run < w and run < RLE_MAX_COUNT and row[x + run] == row[x]:
+                run += 1
+            up = 0
+            if prev is not None:
+                while x + up < w and up < RLE_MAX_COUNT and row[x + up] == prev[x + up]:
+                    up += 1
+
+            if up >= 1 and up >= run:
+                flush_literal()
+                out.append(RLE_OP_UP | (up - 1))
+                x += up
+            elif run >= 2:
+                flush_literal()
+                out.append(RLE_OP_RUN | (run - 1))
+                out += bytes((row[x] >> 8, row[x] & 0xFF))
+                x += run
+            else:
+                literal.append(row[x])
+                x += 1
+        flush_literal()
+    return bytes(out)
+
+
+def rle_decode(w, h, data):
+    """BITMAP_RLE byte stream → RGB565 words (used to verify the encoder)"""
+    words = []
+    pos = 0
+    for y in range(h):
+        x = 0
+        while x < w:
+            token = data[pos]
+            pos += 1
+            count = (token & 0x3F) + 1
+            op = token & 0xC0
+            if op == RLE_OP_LITERAL:
+                for _ in range(count):
+                    words.append((data[pos] << 8) | data[pos + 1])
+                    pos += 2
+            elif op == RLE_OP_RUN:
+                words += [(data[pos] << 8) | data[pos + 1]] * count
+                pos += 2
+            else:
+                words += words[(y - 1) * w + x:(y - 1) * w + x + count]
+            x += count
+    return words
+
+
 def write_h_file(path, prefix):
     with open(path, "w", encoding="utf-8") as f:
         f.write("// Generated by png2bitmap_rgb565_c_h_pragonce.py\n")
         f.write("#pragma once\n\n")
-        f.write("#include <stdint.h>\n\n")
-        f.write("typedef struct bitmap {\n"
-                "    uint16_t width;\n"
-                "    uint16_t height;\n"
-                "    uint16_t* bitmap;\n"
-                "} bitmap;\n\n")
+        f.write("#include \"images.h\"\n\n")
         f.write(f"extern const bitmap {prefix}_bitmap;\n")
 
 
@@ -50,6 +120,7 @@ def write_c_file(path, header_name, prefix, w, h, words):
     total = len(words)
     with open(path, "w", encoding="utf-8") as f:
         f.write("// Generated by png2bitmap_rgb565_c_h_pragonce.py\n")
+        f.write("#include <stddef.h>\n")
         f.write("#include <stdint.h>\n")
         f.write(f"#include \"{header_name}\"\n\n")
         f.write(f"// {w}x{h}, RGB565 format\n")
@@ -57,11 +128,35 @@ def write_c_file(path, header_name, prefix, w, h, words):
         for i, v in enumerate(words):
             end = ", " if i + 1 < total else ""
             if (i + 1) % 12 == 0 and (i + 1) < total:
-                f.write(f"0x{v:04x}{end}\n  ")
+                f.write(f"BITMAP_PX(0x{v:04x}){end}\n  ")
+            else:
+                f.write(f"BITMAP_PX(0x{v:04x}){end}")
+        f.write("\n};\n\n")
+        f.write(f"const bitmap {prefix}_bitmap = {{ {w}, {h}, (uint16_t*){prefix}_pixels, "
+                f"BITMAP_RAW, NULL, 0 }};\n")
+
+
+def write_c_file_rle(path, header_name, prefix, w, h, words, command):
+    data = rle_encode(w, h, words)
+    assert rle_decode(w, h, data) == words
+    total = len(data)
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(f"// Generated by png2c.py: {command}\n")
+        f.write("#include <stddef.h>\n")
+        f.write("#include <stdint.h>\n")
+        f.write(f"#include \"{header_name}\"\n\n")
+        f.write(f"// {w}x{h}, RGB565 format, BITMAP_RLE ({total} bytes, {2 * w * h} raw)\n")
+        f.write(f"static const uint8_t {prefix}_rle[{total}] = {{\n  ")
+        for i, v in enumerate(data):
+            end = ", " if i + 1 < total else ""
+            if (i + 1) % 16 == 0 and (i + 1) < total:
+                f.write(f"0x{v:02x}{end}\n  ")
             else:
-                f.write(f"0x{v:04x}{end}")
+                f.write(f"0x{v:02x}{end}")
         f.write("\n};\n\n")
-        f.write(f"const bitmap {prefix}_bitmap = {{ {w}, {h}, (uint16_t*){prefix}_pixels }};\n")
+        f.write(f"const bitmap {prefix}_bitmap = {{ {w}, {h}, NULL, BITMAP_RLE, "
+                f"{prefix}_rle, {total} }};\n")
+    return total
 
 
 def main():
@@ -69,8 +164,10 @@ def main():
     ap.add_argument("input", help="input .png file")
     ap.add_argument("--out-c", help="output .c filename (default: <input>.c)")
     ap.add_argument("--out-h", help="output .h filename (default: <input>.h)")
+    ap.add_argument("--rle", action="store_true", help="emit a BITMAP_RLE compressed bitmap")
     args = ap.parse_args()
 
+    from PIL import Image
     img = Image.open(args.input)
     w, h, words = image_to_rgb565_words(img)
 
@@ -82,9 +179,13 @@ def main():
     header_name = os.path.basename(out_h)
 
     write_h_file(out_h, prefix)
-    write_c_file(out_c, header_name, prefix, w, h, words)
-
-    print(f"Wrote {out_c} ({w}x{h}, RGB565, {len(words)} pixels)")
+    if args.rle:
+        command = " ".join(["python3"] + sys.argv)
+        size = write_c_file_rle(out_c, header_name, prefix, w, h, words, command)
+        print(f"Wrote {out_c} ({w}x{h}, RGB565, BITMAP_RLE {size} bytes)")
+    else:
+        write_c_file(out_c, header_name, prefix, w, h, words)
+        print(f"Wrote {out_c} ({w}x{h}, RGB565, {len(words)} pixels)")
     print(f"Wrote {out_h} (header for {prefix}_bitmap, using #pragma once)")
 
 
@@ -0,0 +1,261 @@
+/**
+ * @file bench.c
+ * @brief Host microbenchmark runner
+ *
+ * Usage: bench [--json PATH] [--baseline PATH] [--threshold PCT]
+ *
+ * Every result and check is recorded. With --json they are written one
+ * per line, so a later run can read the file back as its baseline. With
+ * --baseline, results measured with bench_measure() that are slower than
+ * the baseline by more than the threshold are flagged. The exit status is
+ * non-zero if a check failed or a regression was flagged.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include "lcd/fb_simd.h"
+
+#define BENCH_MAX_RESULTS 256
+#define BENCH_MAX_CHECKS  64
+#define BENCH_NAME_SIZE   48
+
+typedef struct {
+    char name[BENCH_NAME_SIZE];
+    uint32_t iterations;
+    double ns_per_op;
+    double pixels_per_s;     // 0 if not a pixel benchmark
+    uint32_t samples;        // Timed runs behind the result (1 = single run)
+} bench_result_t;
+
+typedef struct {
+    char name[BENCH_NAME_SIZE];
+    bool ok;
+} bench_check_t;
+
+static bench_result_t s_results[BENCH_MAX_RESULTS];
+static uint32_t s_result_count = 0;
+static bench_check_t s_checks[BENCH_MAX_CHECKS];
+static uint32_t s_check_count = 0;
+static uint32_t s_failed_checks = 0;
+
+#ifdef FB_WIRE_ORDER
+#define BENCH_WIRE_ORDER 1
+#else
+#define BENCH_WIRE_ORDER 0
+#endif
+
+uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void record_result(const char* name, uint32_t iterations, uint64_t elapsed_ns,
+                          uint64_t pixels_per_op, uint32_t samples) {
+    double ns_per_op = (iterations > 0) ? (double)elapsed_ns / iterations : 0.0;
+    double pixels_per_s = (pixels_per_op > 0 && ns_per_op > 0.0) ?
+                          (double)pixels_per_op * 1e9 / ns_per_op : 0.0;
+
+    if (pixels_per_s > 0.0) {
+        printf("%-36s %10u iters %14.1f ns/op %9.1f Mpx/s\n",
+               name, iterations, ns_per_op, pixels_per_s / 1e6);
+    } else {
+        printf("%-36s %10u iters %14.1f ns/op\n", name, iterations, ns_per_op);
+    }
+
+    if (s_result_count < BENCH_MAX_RESULTS) {
+        bench_result_t* r = &s_results[s_result_count++];
+        snprintf(r->name, sizeof(r->name), "%s", name);
+        r->iterations = iterations;
+        r->ns_per_op = ns_per_op;
+        r->pixels_per_s = pixels_per_s;
+        r->samples = samples;
+    }
+}
+
+void bench_report_pixels(const char* name, uint32_t iterations, uint64_t elapsed_ns,
+                         uint64_t pixels_per_op) {
+    record_result(name, iterations, elapsed_ns, pixels_per_op, 1);
+}
+
+void bench_report(const char* name, uint32_t iterations, uint64_t elapsed_ns) {
+    record_result(name, iterations, elapsed_ns, 0, 1);
+}
+
+static int compare_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+void bench_measure(const char* name, uint32_t iterations, uint64_t pixels_per_op,
+                   bench_fn_t fn, void* ctx) {
+    uint64_t samples[BENCH_SAMPLES];
+
+    fn(ctx, iterations);  // Warm caches and lazily built state
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        uint64_t start = bench_now_ns();
+        fn(ctx, iterations);
+        samples[i] = bench_now_ns() - start;
+    }
+
+    qsort(samples, BENCH_SAMPLES, sizeof(samples[0]), compare_u64);
+    record_result(name, iterations, samples[BENCH_SAMPLES / 2], pixels_per_op, BENCH_SAMPLES);
+}
+
+bool bench_check(const char* name, bool ok, const char* detail, ...) {
+    printf("%-36s %s", name, ok ? "ok" : "MISMATCH");
+    if (detail != NULL) {
+        va_list args;
+        va_start(args, detail);
+        putchar(' ');
+        vprintf(detail, args);
+        va_end(args);
+    }
+    putchar('\n');
+
+    if (s_check_count < BENCH_MAX_CHECKS) {
+        bench_check_t* c = &s_checks[s_check_count++];
+        snprintf(c->name, sizeof(c->name), "%s", name);
+        c->ok = ok;
+    }
+    if (!ok) {
+        s_failed_checks++;
+    }
+    return ok;
+}
+
+static bool write_json(const char* path) {
+    FILE* f = fopen(path, "w");
+    if (f == NULL) {
+        printf("bench: cannot write %s\n", path);
+        return false;
+    }
+
+    fprintf(f, "{\n\"config\": {\"simd\": \"%s\", \"fb_buffers\": %d, \"wire_order\": %d},\n",
+            fb_simd_backend(), FB_BUFFER_COUNT, BENCH_WIRE_ORDER);
+    fprintf(f, "\"results\": [\n");
+    for (uint32_t i = 0; i < s_result_count; i++) {
+        const bench_result_t* r = &s_results[i];
+        fprintf(f, "{\"name\": \"%s\", \"iterations\": %u, \"ns_per_op\": %.1f, "
+                   "\"pixels_per_s\": %.0f, \"samples\": %u}%s\n",
+                r->name, r->iterations, r->ns_per_op, r->pixels_per_s, r->samples,
+                (i + 1 < s_result_count) ? "," : "");
+    }
+    fprintf(f, "],\n\"checks\": [\n");
+    for (uint32_t i = 0; i < s_check_count; i++) {
+        fprintf(f, "{\"name\": \"%s\", \"ok\": %s}%s\n", s_checks[i].name,
+                s_checks[i].ok ? "true" : "false", (i + 1 < s_check_count) ? "," : "");
+    }
+    fprintf(f, "]\n}\n");
+    return fclose(f) == 0;
+}
+
+static const bench_result_t* find_result(const char* name) {
+    for (uint32_t i = 0; i < s_result_count; i++) {
+        if (strcmp(s_results[i].name, name) == 0) {
+            return &s_results[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Compare against a file written by write_json()
+ * @return Number of regressions, or -1 if the baseline cannot be read
+ */
+static int compare_baseline(const char* path, double threshold_pct) {
+    FILE* f = fopen(path, "r");
+    if (f == NULL) {
+        printf("bench: cannot read baseline %s\n", path);
+        return -1;
+    }
+
+    char line[256];
+    char config[128] = "";
+    int compared = 0;
+    int regressions = 0;
+
+    printf("\nBaseline %s (regression threshold %.0f%%)\n", path, threshold_pct);
+    while (fgets(line, sizeof(line), f) != NULL) {
+        char name[BENCH_NAME_SIZE];
+        double base_ns;
+
+        if (sscanf(line, "\"config\": %127[^\n]", config) == 1) continue;
+        if (sscanf(line, "{\"name\": \"%47[^\"]\", \"iterations\": %*u, \"ns_per_op\": %lf",
+                   name, &base_ns) != 2) {
+            continue;
+        }
+
+        const bench_result_t* r = find_result(name);
+        if (r == NULL || base_ns <= 0.0) continue;
+
+        // Single-run results are too noisy to gate on; they are shown only
+        double delta_pct = (r->ns_per_op - base_ns) * 100.0 / base_ns;
+        bool regressed = r->samples > 1 && delta_pct > threshold_pct;
+        printf("%-36s %12.1f -> %12.1f ns/op %+7.1f%%%s\n", name, base_ns, r->ns_per_op,
+               delta_pct, regressed ? "  REGRESSION" : (r->samples > 1 ? "" : "  (single run)"));
+        compared++;
+        regressions += regressed;
+    }
+    fclose(f);
+
+    char current[128];
+    snprintf(current, sizeof(current), "{\"simd\": \"%s\", \"fb_buffers\": %d, \"wire_order\": %d},",
+             fb_simd_backend(), FB_BUFFER_COUNT, BENCH_WIRE_ORDER);
+    if (strcmp(config, current) != 0) {
+        printf("bench: baseline was built with a different configuration: %s\n", config);
+    }
+    printf("%d results compared, %d regressions\n", compared, regressions);
+    return regressions;
+}
+
+int main(int argc, char** argv) {
+    const char* json_path = NULL;
+    const char* baseline_path = NULL;
+    double threshold_pct = BENCH_DEFAULT_THRESHOLD_PCT;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            baseline_path = argv[++i];
+        } else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+            threshold_pct = atof(argv[++i]);
+        } else {
+            printf("Usage: %s [--json PATH] [--baseline PATH] [--threshold PCT]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    bench_core_run();
+    bench_spi_run();
+    bench_fb_run();
+    bench_rotate_run();
+    bench_rotcache_run();
+    bench_sprite_run();
+    bench_simd_run();
+    bench_assets_run();
+    bench_timing_run();
+    bench_input_run();
+    bench_collision_run();
+
+    int status = 0;
+    if (json_path != NULL && !write_json(json_path)) {
+        status = 1;
+    }
+    if (baseline_path != NULL && compare_baseline(baseline_path, threshold_pct) != 0) {
+        status = 1;
+    }
+    if (s_failed_checks > 0) {
+        printf("%u checks failed\n", s_failed_checks);
+        status = 1;
+    }
+    return status;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file bench.h
+ * @brief Host microbenchmark helpers
+ *
+ * Benchmarks are built against the bcm2835 stub (host/), so no hardware
+ * is touched and SPI traffic can be counted instead of transmitted.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Timed runs per bench_measure() (the median is reported)
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES 5
+#endif
+
+// Slowdown against the baseline that counts as a regression
+#define BENCH_DEFAULT_THRESHOLD_PCT 15.0
+
+/**
+ * @brief Timed body for bench_measure(): run `iterations` operations
+ */
+typedef void (*bench_fn_t)(void* ctx, uint32_t iterations);
+
+/**
+ * @brief Monotonic clock in nanoseconds
+ */
+uint64_t bench_now_ns(void);
+
+/**
+ * @brief Print and record one result line
+ * @param name Benchmark name (stable, used to match baseline results)
+ * @param iterations Number of timed iterations
+ * @param elapsed_ns Total elapsed time for all iterations
+ */
+void bench_report(const char* name, uint32_t iterations, uint64_t elapsed_ns);
+
+/**
+ * @brief Like bench_report(), also reporting pixel throughput
+ * @param pixels_per_op Pixels produced per iteration
+ */
+void bench_report_pixels(const char* name, uint32_t iterations, uint64_t elapsed_ns,
+                         uint64_t pixels_per_op);
+
+/**
+ * @brief Repeatable measurement
+ *
+ * Runs fn once to warm up, then BENCH_SAMPLES times, and reports the
+ * median run.
+ *
+ * @param pixels_per_op Pixels produced per iteration (0 if not a pixel benchmark)
+ */
+void bench_measure(const char* name, uint32_t iterations, uint64_t pixels_per_op,
+                   bench_fn_t fn, void* ctx);
+
+/**
+ * @brief Print and record a correctness check
+ * @param detail Optional printf format for text after ok/MISMATCH (or NULL)
+ * @return ok
+ */
+bool bench_check(const char* name, bool ok, const char* detail, ...)
+    __attribute__((format(printf, 3, 4)));
+
+// Benchmark groups
+void bench_core_run(void);
+void bench_spi_run(void);
+void bench_fb_run(void);
+void bench_rotate_run(void);
+void bench_rotcache_run(void);
+void bench_sprite_run(void);
+void bench_simd_run(void);
+void bench_assets_run(void);
+void bench_timing_run(void);
+void bench_input_run(void);
+void bench_collision_run(void);
+
+#endif // BENCH_H
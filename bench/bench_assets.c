@@ -0,0 +1,218 @@
+/**
+ * @file bench_assets.c
+ * @brief Asset pack loader checks
+ *
+ * Writes a pack from the compiled-in bitmaps, maps it and checks that every
+ * entry decodes to the same pixels. Also checks the fallbacks for missing
+ * entries and damaged files (including truncated and corrupt RLE
+ * streams), and verifies bin/assets.pack if one was built.
+ */
+
+#include "bench.h"
+#include <stdio.h>
+#include <string.h>
+#include "asset_pack.h"
+#include "lcd/bitmap_rle.h"
+#include "lcd/st7789.h"
+#include "../assets/car.h"
+#include "../assets/handle.h"
+#include "../assets/obstacle.h"
+#include "../assets/intro.h"
+#include "../assets/easy_map.h"
+#include "../assets/hard_map.h"
+#include "../assets/game_over.h"
+#include "../assets/complete.h"
+
+#define ASSET_BENCH_PATH  "/tmp/racing_bench_assets.pack"
+#define ASSET_BENCH_ITERS 1000
+#define ASSET_BENCH_PAGE  4096
+
+typedef struct {
+    const char* name;
+    const bitmap* builtin;
+} bench_asset_t;
+
+static const bench_asset_t s_assets[] = {
+    { "car_100x100", &car_100x100_bitmap },
+    { "handle_80x80", &handle_80x80_bitmap },
+    { "obstacle_75x75", &obstacle_75x75_bitmap },
+    { "intro_240x240", &intro_240x240_bitmap },
+    { "easy_map_240x240", &easy_map_240x240_bitmap },
+    { "hard_map_240x240", &hard_map_240x240_bitmap },
+    { "game_over_240x240", &game_over_240x240_bitmap },
+    { "complete_240x240", &complete_240x240_bitmap },
+};
+#define ASSET_COUNT (sizeof(s_assets) / sizeof(s_assets[0]))
+
+static uint16_t s_expected[ST7789_WIDTH * ST7789_HEIGHT];
+static uint16_t s_actual[ST7789_WIDTH * ST7789_HEIGHT];
+
+static const void* blob_of(const bitmap* bmp, uint32_t* size) {
+    if (bmp->format == BITMAP_RLE) {
+        *size = bmp->data_size;
+        return bmp->data;
+    }
+    *size = (uint32_t)bmp->width * bmp->height * sizeof(uint16_t);
+    return bmp->bitmap;
+}
+
+// Damage write_pack() can apply to the entries it writes
+typedef enum {
+    PACK_INTACT,
+    PACK_SHORT_RAW,      // RAW sizes one pixel short of the dimensions
+    PACK_TRUNCATED_RLE,  // RLE streams cut in half
+    PACK_FLIPPED_RLE     // Top bit of each RLE stream's first token flipped
+} pack_damage_t;
+
+// Same layout as assets/mkpack.py, blobs taken from the compiled-in bitmaps
+static bool write_pack(const char* path, const char* magic, pack_damage_t damage) {
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) {
+        return false;
+    }
+
+    asset_pack_header_t header = {
+        .version = ASSET_PACK_VERSION,
+        .entry_count = ASSET_COUNT,
+        .index_offset = sizeof(asset_pack_header_t),
+        .page_size = ASSET_BENCH_PAGE,
+#ifdef FB_WIRE_ORDER
+        .pixel_order = ASSET_PACK_ORDER_WIRE,
+#else
+        .pixel_order = ASSET_PACK_ORDER_LITTLE,
+#endif
+    };
+    memcpy(header.magic, magic, sizeof(header.magic));
+    fwrite(&header, sizeof(header), 1, f);
+
+    uint32_t offset = ASSET_BENCH_PAGE;
+    for (size_t i = 0; i < ASSET_COUNT; i++) {
+        const bitmap* bmp = s_assets[i].builtin;
+        asset_pack_entry_t e = {
+            .width = bmp->width,
+            .height = bmp->height,
+            .format = bmp->format,
+            .offset = offset,
+        };
+        blob_of(bmp, &e.size);
+        if (damage == PACK_SHORT_RAW && bmp->format == BITMAP_RAW) {
+            e.size -= sizeof(uint16_t);
+        }
+        if (damage == PACK_TRUNCATED_RLE && bmp->format == BITMAP_RLE) {
+            e.size /= 2;
+        }
+        strncpy(e.name, s_assets[i].name, ASSET_PACK_NAME_SIZE - 1);
+        fwrite(&e, sizeof(e), 1, f);
+        offset += (e.size + ASSET_BENCH_PAGE - 1) / ASSET_BENCH_PAGE * ASSET_BENCH_PAGE;
+    }
+
+    offset = ASSET_BENCH_PAGE;
+    for (size_t i = 0; i < ASSET_COUNT; i++) {
+        uint32_t size;
+        const uint8_t* blob = blob_of(s_assets[i].builtin, &size);
+        if (damage == PACK_TRUNCATED_RLE && s_assets[i].builtin->format == BITMAP_RLE) {
+            size /= 2;
+        }
+        fseek(f, offset, SEEK_SET);
+        if (damage == PACK_FLIPPED_RLE && s_assets[i].builtin->format == BITMAP_RLE) {
+            // A literal or run on the first row becomes "up" or an unused opcode
+            fputc(blob[0] ^ 0x80, f);
+            fwrite(blob + 1, 1, size - 1, f);
+        } else {
+            fwrite(blob, 1, size, f);
+        }
+        offset += (size + ASSET_BENCH_PAGE - 1) / ASSET_BENCH_PAGE * ASSET_BENCH_PAGE;
+    }
+
+    return fclose(f) == 0;
+}
+
+static bool decodes_equal(const bitmap* a, const bitmap* b) {
+    if (a->width != b->width || a->height != b->height) {
+        return false;
+    }
+    size_t n = (size_t)a->width * a->height;
+    bitmap_decode(a, s_expected, a->width);
+    bitmap_decode(b, s_actual, b->width);
+    return memcmp(s_expected, s_actual, n * sizeof(uint16_t)) == 0;
+}
+
+// Every lookup served from the pack and identical to the built-in
+static bool pack_matches_builtin(void) {
+    for (size_t i = 0; i < ASSET_COUNT; i++) {
+        const bitmap* bmp = asset_pack_get(s_assets[i].name, NULL);
+        if (bmp == NULL || bmp == s_assets[i].builtin || !decodes_equal(bmp, s_assets[i].builtin)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Damaged RLE streams fall back to the built-in bitmaps, RAW entries are
+// still served from the pack
+static bool check_damaged_rle(pack_damage_t damage) {
+    if (!write_pack(ASSET_BENCH_PATH, "RCAP", damage) || !asset_pack_open(ASSET_BENCH_PATH)) {
+        return false;
+    }
+    bool ok = true;
+    for (size_t i = 0; i < ASSET_COUNT; i++) {
+        const bitmap* builtin = s_assets[i].builtin;
+        bool from_pack = (asset_pack_get(s_assets[i].name, builtin) != builtin);
+        ok &= (from_pack == (builtin->format == BITMAP_RAW));
+    }
+    asset_pack_close();
+    return ok;
+}
+
+static bool check_fallbacks(void) {
+    const bitmap* car = &car_100x100_bitmap;
+    const bitmap* intro = &intro_240x240_bitmap;
+
+    // Unknown name and RLE entry requested as RAW
+    if (asset_pack_get("missing", car) != car ||
+        asset_pack_get_raw("intro_240x240", intro) != intro) {
+        return false;
+    }
+
+    // Bad magic: nothing mapped, all lookups fall back
+    if (!write_pack(ASSET_BENCH_PATH, "XXXX", PACK_INTACT) || asset_pack_open(ASSET_BENCH_PATH) ||
+        asset_pack_count() != 0 || asset_pack_get("car_100x100", car) != car) {
+        return false;
+    }
+
+    // RAW sizes that do not match the dimensions: those entries are skipped
+    if (!write_pack(ASSET_BENCH_PATH, "RCAP", PACK_SHORT_RAW) || !asset_pack_open(ASSET_BENCH_PATH) ||
+        asset_pack_get("car_100x100", car) != car || asset_pack_get("intro_240x240", intro) == intro) {
+        return false;
+    }
+    asset_pack_close();
+
+    return !asset_pack_open("/nonexistent/assets.pack") && asset_pack_get("car_100x100", car) == car;
+}
+
+void bench_assets_run(void) {
+    bool ok = write_pack(ASSET_BENCH_PATH, "RCAP", PACK_INTACT) && asset_pack_open(ASSET_BENCH_PATH) &&
+              asset_pack_count() == ASSET_COUNT && pack_matches_builtin();
+    bench_check("assets/pack_exact", ok, NULL);
+    bench_check("assets/fallback", check_fallbacks(), NULL);
+    bench_check("assets/truncated_rle", check_damaged_rle(PACK_TRUNCATED_RLE), NULL);
+    bench_check("assets/flipped_rle", check_damaged_rle(PACK_FLIPPED_RLE), NULL);
+
+    if (asset_pack_open(ASSET_PACK_PATH)) {
+        bench_check("assets/" ASSET_PACK_PATH, pack_matches_builtin(),
+                    "(%u bitmaps)", asset_pack_count());
+    } else {
+        printf("%-36s skipped (run make pack)\n", "assets/" ASSET_PACK_PATH);
+    }
+
+    write_pack(ASSET_BENCH_PATH, "RCAP", PACK_INTACT);
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < ASSET_BENCH_ITERS; i++) {
+        asset_pack_open(ASSET_BENCH_PATH);
+        asset_pack_get("complete_240x240", &complete_240x240_bitmap);
+    }
+    bench_report("assets/open_and_lookup", ASSET_BENCH_ITERS, bench_now_ns() - start);
+
+    asset_pack_close();
+    remove(ASSET_BENCH_PATH);
+}
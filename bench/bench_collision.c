@@ -0,0 +1,664 @@
+/**
+ * @file bench_collision.c
+ * @brief SAT kernels and the obstacle grid
+ *
+ * The projected-radius kernels are checked against a double precision
+ * vertex-projection SAT over random boxes (box axes from the same sine
+ * table, so both must agree exactly) and timed against the previous
+ * vertex-based OBB-vs-AABB test.
+ *
+ * Car poses are checked against the game maps and against synthetic
+ * parking lots of up to MAP_MAX_OBSTACLES small obstacles. The grid must
+ * give the same answer as a SAT test with every active obstacle, and its
+ * cost per query should not grow with the obstacle count. Random poses
+ * jump across the field; driven poses move a few pixels per query, which
+ * is where the coherence cache skips most tests.
+ *
+ * Sprite masks are checked against a per-pixel overlap of the rendered
+ * sprites, and the hitboxes derived from them must contain every opaque
+ * pixel at every angle, so the SAT broadphase never hides a pixel hit.
+ */
+
+#include "bench.h"
+#include <stdio.h>
+#include <string.h>
+#include "game/collision.h"
+#include "game/sin_table.h"
+#include "lcd/framebuffer.h"
+#include "lcd/rot_cache.h"
+#include "maps/map_types.h"
+#include "maps/easy_map.h"
+#include "maps/hard_map.h"
+#include "maps/obstacle_grid.h"
+#include "game.h"
+#include "../assets/car.h"
+#include "../assets/obstacle.h"
+
+// Game hitboxes (see game.c)
+#define CAR_HITBOX_WIDTH       25
+#define CAR_HITBOX_HEIGHT      45
+#define OBSTACLE_HITBOX_WIDTH  35
+#define OBSTACLE_HITBOX_HEIGHT 55
+
+// Synthetic lots: small parked cars so most poses stay collision-free
+#define LOT_HITBOX_WIDTH  4
+#define LOT_HITBOX_HEIGHT 6
+#define LOT_POSES         1024
+#define LOT_QUERY_ITERS   20000
+
+// Sprite pairs for the mask checks: obstacle offsets from the car up to
+// MASK_MAX_OFFSET, angles in MASK_ANGLE_STEP steps for the timing (so all
+// of them stay cached)
+#define MASK_PAIRS        1024
+#define MASK_MAX_OFFSET   60
+#define MASK_ANGLE_STEP   15
+#define MASK_ITERS        20000
+#define TRANSPARENT_COLOR 0x0000
+
+// Random box pairs for the kernel checks and timings
+#define KERNEL_PAIRS 4096
+#define KERNEL_ITERS 20000
+
+static obstacle_t s_lot_obstacles[MAP_MAX_OBSTACLES];
+static map_config_t s_lot;
+static obb_t s_poses[LOT_POSES];
+static obb_t s_drive[LOT_POSES];
+static obb_t s_pair_a[KERNEL_PAIRS];
+static obb_t s_pair_b[KERNEL_PAIRS];
+static aabb_t s_pair_aabb[KERNEL_PAIRS];
+
+// The b boxes of the pairs again, as a SoA
+static int16_t s_soa_cx[KERNEL_PAIRS];
+static int16_t s_soa_cy[KERNEL_PAIRS];
+static int16_t s_soa_half_w[KERNEL_PAIRS];
+static int16_t s_soa_half_h[KERNEL_PAIRS];
+static int16_t s_soa_angle[KERNEL_PAIRS];
+static int16_t s_soa_cos[KERNEL_PAIRS];
+static int16_t s_soa_sin[KERNEL_PAIRS];
+static collision_soa_t s_soa = {
+    s_soa_cx, s_soa_cy, s_soa_half_w, s_soa_half_h, s_soa_angle, s_soa_cos, s_soa_sin,
+    KERNEL_PAIRS
+};
+static volatile uint32_t s_sink;
+
+typedef struct {
+    int16_t dx, dy;
+    int16_t car_angle, obstacle_angle;
+} mask_pair_t;
+
+static mask_pair_t s_mask_pairs[MASK_PAIRS];
+static uint16_t s_canvas_a[ST7789_HEIGHT * ST7789_WIDTH];
+static uint16_t s_canvas_b[ST7789_HEIGHT * ST7789_WIDTH];
+
+static uint32_t s_rng = 4242;
+
+static int16_t next_random(int16_t lo, int16_t hi) {
+    s_rng = s_rng * 1103515245u + 12345u;
+    return (int16_t)(lo + (int32_t)((s_rng >> 16) % (uint32_t)(hi - lo + 1)));
+}
+
+// Previous check_collision_obb_aabb(): project all 8 vertices on 4 axes
+static int32_t vertex_dot(const vec2_fp_t* a, const vec2_fp_t* b) {
+    return (int32_t)(((int64_t)a->x * b->x + (int64_t)a->y * b->y) >> FP_SHIFT);
+}
+
+static void vertex_project(const vec2_fp_t v[4], const vec2_fp_t* axis,
+                           int32_t* out_min, int32_t* out_max) {
+    *out_min = *out_max = vertex_dot(&v[0], axis);
+    for (int i = 1; i < 4; i++) {
+        int32_t p = vertex_dot(&v[i], axis);
+        if (p < *out_min) *out_min = p;
+        if (p > *out_max) *out_max = p;
+    }
+}
+
+static bool obb_aabb_vertices(const obb_t* obb, const aabb_t* aabb) {
+    vec2_fp_t obb_verts[4];
+    vec2_fp_t aabb_verts[4];
+    obb_t box = { aabb->cx, aabb->cy, aabb->half_w, aabb->half_h, 0 };
+    obb_get_vertices(obb, obb_verts);
+    obb_get_vertices(&box, aabb_verts);
+
+    int16_t sin_a = get_sin(obb->angle);
+    int16_t cos_a = get_cos(obb->angle);
+    vec2_fp_t axes[4] = { {FP_SCALE, 0}, {0, FP_SCALE}, {cos_a, sin_a}, {-sin_a, cos_a} };
+    for (int i = 0; i < 4; i++) {
+        int32_t min1, max1, min2, max2;
+        vertex_project(obb_verts, &axes[i], &min1, &max1);
+        vertex_project(aabb_verts, &axes[i], &min2, &max2);
+        if (max1 < min2 || max2 < min1) return false;
+    }
+    return true;
+}
+
+// Reference: vertices and projections in doubles, touching boxes collide
+static void ref_vertices(const obb_t* obb, double vx[4], double vy[4]) {
+    static const int sx[4] = { -1, 1, 1, -1 };
+    static const int sy[4] = { -1, -1, 1, 1 };
+    double c = get_cos(obb->angle) / (double)FP_SCALE;
+    double s = get_sin(obb->angle) / (double)FP_SCALE;
+    for (int i = 0; i < 4; i++) {
+        double lx = sx[i] * obb->half_w;
+        double ly = sy[i] * obb->half_h;
+        vx[i] = obb->cx + lx * c - ly * s;
+        vy[i] = obb->cy + lx * s + ly * c;
+    }
+}
+
+static bool ref_separated(const double ax[4], const double ay[4],
+                          const double bx[4], const double by[4], double nx, double ny) {
+    double min1 = 1e18, max1 = -1e18, min2 = 1e18, max2 = -1e18;
+    for (int i = 0; i < 4; i++) {
+        double p = ax[i] * nx + ay[i] * ny;
+        double q = bx[i] * nx + by[i] * ny;
+        if (p < min1) min1 = p;
+        if (p > max1) max1 = p;
+        if (q < min2) min2 = q;
+        if (q > max2) max2 = q;
+    }
+    return max1 < min2 || max2 < min1;
+}
+
+static bool ref_obb_obb(const obb_t* a, const obb_t* b) {
+    double ax[4], ay[4], bx[4], by[4];
+    ref_vertices(a, ax, ay);
+    ref_vertices(b, bx, by);
+
+    const obb_t* boxes[2] = { a, b };
+    for (int k = 0; k < 2; k++) {
+        double c = get_cos(boxes[k]->angle);
+        double s = get_sin(boxes[k]->angle);
+        if (ref_separated(ax, ay, bx, by, c, s) || ref_separated(ax, ay, bx, by, -s, c)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static obb_t random_box(int16_t angle) {
+    return (obb_t){ next_random(60, 180), next_random(60, 180),
+                    next_random(1, 40), next_random(1, 40), angle };
+}
+
+static void make_pairs(void) {
+    for (int i = 0; i < KERNEL_PAIRS; i++) {
+        s_pair_a[i] = random_box(next_random(0, 359));
+        s_pair_b[i] = random_box(next_random(0, 359));
+
+        // Every few pairs, b just touches a along a's local x axis
+        if (i % 8 == 0) {
+            s_pair_b[i] = s_pair_a[i];
+            s_pair_b[i].cx = (int16_t)(s_pair_a[i].cx + 2 * s_pair_a[i].half_w);
+            s_pair_b[i].angle = 0;
+            s_pair_a[i].angle = (int16_t)(next_random(0, 3) * 90);
+        }
+        obb_t b = s_pair_b[i];
+        s_pair_aabb[i] = (aabb_t){ b.cx, b.cy, b.half_w, b.half_h };
+        collision_soa_set(&s_soa, i, &b);
+    }
+}
+
+static void check_kernels(void) {
+    int mismatches_aabb = 0;
+    int mismatches_obb = 0;
+    int hits = 0;
+
+    for (int i = 0; i < KERNEL_PAIRS; i++) {
+        obb_t as_obb = { s_pair_aabb[i].cx, s_pair_aabb[i].cy,
+                         s_pair_aabb[i].half_w, s_pair_aabb[i].half_h, 0 };
+        bool expected = ref_obb_obb(&s_pair_a[i], &as_obb);
+        mismatches_aabb += (check_collision_obb_aabb(&s_pair_a[i], &s_pair_aabb[i]) != expected);
+
+        expected = ref_obb_obb(&s_pair_a[i], &s_pair_b[i]);
+        mismatches_obb += (check_collision_obb_obb(&s_pair_a[i], &s_pair_b[i]) != expected);
+        hits += expected;
+    }
+    bench_check("collision/obb_aabb_matches_ref", mismatches_aabb == 0,
+                "(%d of %d pairs differ)", mismatches_aabb, KERNEL_PAIRS);
+    bench_check("collision/obb_obb_matches_ref", mismatches_obb == 0,
+                "(%d of %d pairs differ, %d collide)", mismatches_obb, KERNEL_PAIRS, hits);
+}
+
+// Each a box against every batch of b boxes, at every alignment and length
+static void check_batch(void) {
+    int mismatches = 0;
+    int first_mismatches = 0;
+
+    for (int i = 0; i < KERNEL_PAIRS; i += 61) {
+        for (int first = 0; first + COLLISION_BATCH_MAX <= KERNEL_PAIRS; first += 37) {
+            int count = 1 + (first % COLLISION_BATCH_MAX);
+            uint32_t expected = 0;
+            for (int k = 0; k < count; k++) {
+                if (check_collision_obb_obb(&s_pair_a[i], &s_pair_b[first + k])) {
+                    expected |= 1u << k;
+                }
+            }
+            mismatches += (check_collision_obb_batch(&s_pair_a[i], &s_soa, first, count) != expected);
+            mismatches += (check_collision_obb_batch_scalar(&s_pair_a[i], &s_soa, first, count) != expected);
+            int first_hit = expected ? first + __builtin_ctz(expected) : -1;
+            first_mismatches += (check_collision_obb_first(&s_pair_a[i], &s_soa, first, count) != first_hit);
+        }
+    }
+    bench_check("collision/batch_matches_single", mismatches == 0 && first_mismatches == 0,
+                "(%d masks, %d first hits differ)", mismatches, first_mismatches);
+}
+
+static void run_batch(void* ctx, uint32_t iterations) {
+    (void)ctx;
+    uint32_t hits = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint32_t first = (i * COLLISION_BATCH_MAX) % KERNEL_PAIRS;
+        hits += (uint32_t)__builtin_popcount(
+            check_collision_obb_batch(&s_pair_a[i % KERNEL_PAIRS], &s_soa, (int)first, COLLISION_BATCH_MAX));
+    }
+    s_sink = hits;
+}
+
+static void run_batch_scalar(void* ctx, uint32_t iterations) {
+    (void)ctx;
+    uint32_t hits = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint32_t first = (i * COLLISION_BATCH_MAX) % KERNEL_PAIRS;
+        hits += (uint32_t)__builtin_popcount(
+            check_collision_obb_batch_scalar(&s_pair_a[i % KERNEL_PAIRS], &s_soa, (int)first,
+                                             COLLISION_BATCH_MAX));
+    }
+    s_sink = hits;
+}
+
+static void run_obb_aabb_vertices(void* ctx, uint32_t iterations) {
+    (void)ctx;
+    uint32_t hits = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint32_t k = i % KERNEL_PAIRS;
+        hits += obb_aabb_vertices(&s_pair_a[k], &s_pair_aabb[k]);
+    }
+    s_sink = hits;
+}
+
+static void run_obb_aabb(void* ctx, uint32_t iterations) {
+    (void)ctx;
+    uint32_t hits = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint32_t k = i % KERNEL_PAIRS;
+        hits += check_collision_obb_aabb(&s_pair_a[k], &s_pair_aabb[k]);
+    }
+    s_sink = hits;
+}
+
+static void run_obb_obb(void* ctx, uint32_t iterations) {
+    (void)ctx;
+    uint32_t hits = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint32_t k = i % KERNEL_PAIRS;
+        hits += check_collision_obb_obb(&s_pair_a[k], &s_pair_b[k]);
+    }
+    s_sink = hits;
+}
+
+static void run_obb_obb_gap(void* ctx, uint32_t iterations) {
+    (void)ctx;
+    uint32_t hits = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint32_t k = i % KERNEL_PAIRS;
+        uint8_t axis = 0;
+        int32_t gap;
+        hits += check_collision_obb_obb_gap(&s_pair_a[k], &s_pair_b[k], &axis, &gap);
+    }
+    s_sink = hits;
+}
+
+static void bench_kernels(void) {
+    make_pairs();
+    check_kernels();
+    bench_measure("collision/obb_aabb_vertices", KERNEL_ITERS, 0, run_obb_aabb_vertices, NULL);
+    bench_measure("collision/obb_aabb", KERNEL_ITERS, 0, run_obb_aabb, NULL);
+    bench_measure("collision/obb_obb", KERNEL_ITERS, 0, run_obb_obb, NULL);
+    bench_measure("collision/obb_obb_gap", KERNEL_ITERS, 0, run_obb_obb_gap, NULL);
+
+    // Per batch of COLLISION_BATCH_MAX boxes
+    check_batch();
+    bench_measure("collision/batch32_scalar", KERNEL_ITERS / 8, 0, run_batch_scalar, NULL);
+    bench_measure("collision/batch32", KERNEL_ITERS / 8, 0, run_batch, NULL);
+}
+
+// Reference: SAT against every active obstacle
+static bool collides_all(const map_config_t* map, const obb_t* obb, int16_t w, int16_t h) {
+    for (int i = 0; i < map->obstacle_count; i++) {
+        const obstacle_t* obs = &map->obstacles[i];
+        if (!obs->active) continue;
+        obb_t box = { obs->x, obs->y, w / 2, h / 2, obs->angle };
+        if (check_collision_obb_obb(obb, &box)) return true;
+    }
+    return false;
+}
+
+static void make_poses(void) {
+    for (int i = 0; i < LOT_POSES; i++) {
+        s_poses[i] = (obb_t){ next_random(-10, 250), next_random(-10, 250),
+                              CAR_HITBOX_WIDTH / 2, CAR_HITBOX_HEIGHT / 2,
+                              next_random(0, 359) };
+    }
+}
+
+// A car driving around the field: small steps and turns, bouncing off
+// the edges, standing still now and then
+static void make_drive(void) {
+    int16_t x = 120, y = 120, angle = 0;
+    for (int i = 0; i < LOT_POSES; i++) {
+        if (i % 16 >= 2) {
+            angle = (int16_t)((angle + next_random(-4, 4) + 360) % 360);
+            x += (int16_t)(2 * get_sin(angle) / FP_SCALE);
+            y -= (int16_t)(2 * get_cos(angle) / FP_SCALE);
+            if (x < -10 || x > 250 || y < -10 || y > 250) {
+                angle = (int16_t)((angle + 180) % 360);
+            }
+        }
+        s_drive[i] = (obb_t){ x, y, CAR_HITBOX_WIDTH / 2, CAR_HITBOX_HEIGHT / 2, angle };
+    }
+}
+
+static void make_lot(int count) {
+    for (int i = 0; i < count; i++) {
+        s_lot_obstacles[i] = (obstacle_t){ next_random(0, 239), next_random(0, 239),
+                                           next_random(0, 179),
+                                           next_random(0, 7) != 0 };
+    }
+    s_lot = (map_config_t){ .obstacles = s_lot_obstacles, .obstacle_count = count };
+    obstacle_grid_build(&s_lot, LOT_HITBOX_WIDTH, LOT_HITBOX_HEIGHT);
+}
+
+static bool grid_matches(const map_config_t* map, const obb_t* poses,
+                         int16_t w, int16_t h, int* hits, int* tests) {
+    bool ok = true;
+    *hits = 0;
+    *tests = 0;
+    for (int i = 0; i < LOT_POSES; i++) {
+        bool expected = collides_all(map, &poses[i], w, h);
+        ok &= (obstacle_grid_collides(&poses[i]) == expected);
+        *hits += expected;
+        *tests += obstacle_grid_last_tests();
+    }
+    return ok;
+}
+
+static void check_maps(void) {
+    const map_config_t* maps[] = { get_easy_map_config(), get_hard_map_config() };
+    bool ok = true;
+    int hits = 0;
+
+    for (size_t m = 0; m < sizeof(maps) / sizeof(maps[0]); m++) {
+        const obb_t* paths[] = { s_poses, s_drive };
+        for (size_t p = 0; p < sizeof(paths) / sizeof(paths[0]); p++) {
+            int map_hits, tests;
+            obstacle_grid_build(maps[m], OBSTACLE_HITBOX_WIDTH, OBSTACLE_HITBOX_HEIGHT);
+            ok &= grid_matches(maps[m], paths[p], OBSTACLE_HITBOX_WIDTH,
+                               OBSTACLE_HITBOX_HEIGHT, &map_hits, &tests);
+            hits += map_hits;
+        }
+    }
+    bench_check("collision/grid_matches_maps", ok, "(%d of %d poses collide)",
+                hits, LOT_POSES * 4);
+}
+
+// ctx: the poses to query in turn
+static void run_grid(void* ctx, uint32_t iterations) {
+    const obb_t* poses = ctx;
+    uint32_t hits = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        hits += obstacle_grid_collides(&poses[i % LOT_POSES]);
+    }
+    s_sink = hits;
+}
+
+static void run_all(void* ctx, uint32_t iterations) {
+    (void)ctx;
+    uint32_t hits = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        hits += collides_all(&s_lot, &s_poses[i % LOT_POSES],
+                             LOT_HITBOX_WIDTH, LOT_HITBOX_HEIGHT);
+    }
+    s_sink = hits;
+}
+
+static void bench_lot(int count) {
+    char name[48];
+    int hits;
+
+    int jump_tests, drive_tests;
+
+    make_lot(count);
+    bool ok = grid_matches(&s_lot, s_poses, LOT_HITBOX_WIDTH, LOT_HITBOX_HEIGHT,
+                           &hits, &jump_tests);
+    snprintf(name, sizeof(name), "collision/grid_matches_%d", count);
+    bench_check(name, ok, "(%d of %d poses collide)", hits, LOT_POSES);
+
+    ok = grid_matches(&s_lot, s_drive, LOT_HITBOX_WIDTH, LOT_HITBOX_HEIGHT,
+                      &hits, &drive_tests);
+    snprintf(name, sizeof(name), "collision/grid_drive_matches_%d", count);
+    bench_check(name, ok, "(%d of %d poses collide, %.1f tests/query driving, %.1f jumping)",
+                hits, LOT_POSES, (double)drive_tests / LOT_POSES,
+                (double)jump_tests / LOT_POSES);
+
+    snprintf(name, sizeof(name), "collision/grid_query_%d", count);
+    bench_measure(name, LOT_QUERY_ITERS, 0, run_grid, s_poses);
+    snprintf(name, sizeof(name), "collision/grid_drive_%d", count);
+    bench_measure(name, LOT_QUERY_ITERS, 0, run_grid, s_drive);
+    snprintf(name, sizeof(name), "collision/all_obstacles_%d", count);
+    bench_measure(name, LOT_QUERY_ITERS, 0, run_all, NULL);
+}
+
+// Sprite rendered like the map layer does, centered in a canvas
+static void render_sprite(uint16_t* canvas, int16_t cx, int16_t cy,
+                          const bitmap* bmp, int16_t angle) {
+    memset(canvas, 0, sizeof(s_canvas_a));
+    fb_render_rotated(canvas, ST7789_WIDTH, ST7789_HEIGHT, cx, cy, bmp, angle, TRANSPARENT_COLOR);
+}
+
+static bool canvases_overlap(void) {
+    uint16_t key = BITMAP_PX(TRANSPARENT_COLOR);
+    for (size_t i = 0; i < sizeof(s_canvas_a) / sizeof(s_canvas_a[0]); i++) {
+        if (s_canvas_a[i] != key && s_canvas_b[i] != key) return true;
+    }
+    return false;
+}
+
+// Every opaque pixel at every angle lies in the hitbox at that angle
+static bool check_hitbox(const bitmap* bmp, int16_t* half_w, int16_t* half_h, int* outside) {
+    uint16_t key = BITMAP_PX(TRANSPARENT_COLOR);
+    int16_t c = ST7789_WIDTH / 2;
+
+    *outside = 0;
+    if (!rot_cache_get_hitbox(bmp, TRANSPARENT_COLOR, half_w, half_h)) {
+        return false;
+    }
+    for (int16_t angle = 0; angle < 360; angle++) {
+        obb_t box = { c, c, *half_w, *half_h, angle };
+        render_sprite(s_canvas_a, c, c, bmp, angle);
+        for (int16_t y = 0; y < ST7789_HEIGHT; y++) {
+            for (int16_t x = 0; x < ST7789_WIDTH; x++) {
+                obb_t pixel = { x, y, 0, 0, 0 };
+                if (s_canvas_a[y * ST7789_WIDTH + x] != key &&
+                    !check_collision_obb_obb(&box, &pixel)) {
+                    (*outside)++;
+                }
+            }
+        }
+    }
+    return *outside == 0;
+}
+
+static void make_mask_pairs(void) {
+    for (int i = 0; i < MASK_PAIRS; i++) {
+        s_mask_pairs[i] = (mask_pair_t){
+            next_random(-MASK_MAX_OFFSET, MASK_MAX_OFFSET),
+            next_random(-MASK_MAX_OFFSET, MASK_MAX_OFFSET),
+            next_random(0, 359), next_random(0, 359)
+        };
+    }
+}
+
+static bool pair_overlaps(const mask_pair_t* p, bool* overlap) {
+    int16_t c = ST7789_WIDTH / 2;
+    return rot_cache_sprites_overlap(&car_100x100_bitmap, c, c, p->car_angle,
+                                     &obstacle_75x75_bitmap, c + p->dx, c + p->dy,
+                                     p->obstacle_angle, TRANSPARENT_COLOR, overlap);
+}
+
+static void check_masks(void) {
+    int16_t c = ST7789_WIDTH / 2;
+    int differ = 0, overlaps = 0;
+
+    for (int i = 0; i < MASK_PAIRS; i++) {
+        const mask_pair_t* p = &s_mask_pairs[i];
+        render_sprite(s_canvas_a, c, c, &car_100x100_bitmap, p->car_angle);
+        render_sprite(s_canvas_b, c + p->dx, c + p->dy, &obstacle_75x75_bitmap,
+                      p->obstacle_angle);
+        bool expected = canvases_overlap();
+        bool overlap;
+        if (!pair_overlaps(p, &overlap) || overlap != expected) {
+            differ++;
+        }
+        overlaps += expected;
+    }
+    bench_check("collision/mask_matches_pixels", differ == 0,
+                "(%d of %d pairs differ, %d overlap)", differ, MASK_PAIRS, overlaps);
+
+    int16_t half_w, half_h;
+    int outside;
+    bool ok = check_hitbox(&car_100x100_bitmap, &half_w, &half_h, &outside);
+    bench_check("collision/car_mask_in_hitbox", ok, "(%dx%d, %d pixels outside)",
+                2 * half_w, 2 * half_h, outside);
+    ok = check_hitbox(&obstacle_75x75_bitmap, &half_w, &half_h, &outside);
+    bench_check("collision/obstacle_mask_in_hitbox", ok, "(%dx%d, %d pixels outside)",
+                2 * half_w, 2 * half_h, outside);
+}
+
+static void run_mask_overlap(void* ctx, uint32_t iterations) {
+    (void)ctx;
+    uint32_t hits = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        bool overlap = false;
+        pair_overlaps(&s_mask_pairs[i % MASK_PAIRS], &overlap);
+        hits += overlap;
+    }
+    s_sink = hits;
+}
+
+// Grid with sprite hitboxes and the game's narrow phase, against the
+// masks of every active obstacle
+static void check_maps_narrow(void) {
+    const map_config_t* maps[] = { get_easy_map_config(), get_hard_map_config() };
+    const obb_t* paths[] = { s_poses, s_drive };
+    int16_t car_w, car_h, obs_w, obs_h;
+    int differ = 0, box_hits = 0, pixel_hits = 0;
+
+    rot_cache_get_hitbox(&car_100x100_bitmap, TRANSPARENT_COLOR, &car_w, &car_h);
+    rot_cache_get_hitbox(&obstacle_75x75_bitmap, TRANSPARENT_COLOR, &obs_w, &obs_h);
+    for (size_t m = 0; m < sizeof(maps) / sizeof(maps[0]); m++) {
+        obstacle_grid_build(maps[m], 2 * obs_w, 2 * obs_h);
+        for (size_t p = 0; p < sizeof(paths) / sizeof(paths[0]); p++) {
+            for (int i = 0; i < LOT_POSES; i++) {
+                obb_t car = paths[p][i];
+                car.half_w = car_w;
+                car.half_h = car_h;
+
+                bool expected = false;
+                for (int k = 0; k < maps[m]->obstacle_count && !expected; k++) {
+                    const obstacle_t* obs = &maps[m]->obstacles[k];
+                    expected = obs->active && game_sprites_overlap(obs, &car);
+                }
+                box_hits += obstacle_grid_collides(&car);
+                pixel_hits += expected;
+                differ += (obstacle_grid_collides_narrow(&car, game_sprites_overlap, &car) != expected);
+            }
+        }
+    }
+    bench_check("collision/grid_narrow_matches_maps", differ == 0,
+                "(%d poses differ, %d of %d box hits touch pixels)",
+                differ, pixel_hits, box_hits);
+}
+
+// A pair that just fits the budget is compared even when other sprites
+// fill the cache; two bytes less and it reports failure (the game then
+// falls back to its hitboxes)
+static bool check_tight_budget(void) {
+    mask_pair_t pair = { 20, 0, 45, 30 };
+    bool overlap;
+
+    rot_cache_init();
+    pair_overlaps(&pair, &overlap);
+    uint32_t bytes = rot_cache_get_stats().bytes_used;
+
+    rot_cache_init();
+    rot_cache_set_budget(bytes);
+    for (int16_t angle = 0; angle < 360; angle += 90) {
+        rot_cache_prewarm(&car_100x100_bitmap, angle, TRANSPARENT_COLOR);
+    }
+    bool ok = pair_overlaps(&pair, &overlap) && overlap;
+
+    rot_cache_init();
+    rot_cache_set_budget(bytes - 2);
+    ok &= !pair_overlaps(&pair, &overlap);
+
+    rot_cache_set_budget(ROT_CACHE_POOL_BYTES);
+    return ok;
+}
+
+// With no room for the masks, the game's narrow phase is the hand-tuned
+// hitbox test
+static bool check_narrow_fallback(int* differ) {
+    int16_t c = ST7789_WIDTH / 2;
+    int hits = 0;
+
+    *differ = 0;
+    rot_cache_init();
+    rot_cache_set_budget(0);
+    for (int i = 0; i < MASK_PAIRS; i++) {
+        const mask_pair_t* p = &s_mask_pairs[i];
+        obb_t car = { c, c, CAR_HITBOX_WIDTH / 2, CAR_HITBOX_HEIGHT / 2, p->car_angle };
+        obstacle_t obs = { .x = c + p->dx, .y = c + p->dy, .angle = p->obstacle_angle, .active = true };
+        obb_t obstacle_hitbox = {
+            obs.x, obs.y, OBSTACLE_HITBOX_WIDTH / 2, OBSTACLE_HITBOX_HEIGHT / 2, obs.angle
+        };
+        bool expected = check_collision_obb_obb(&car, &obstacle_hitbox);
+        hits += expected;
+        *differ += (game_sprites_overlap(&obs, &car) != expected);
+    }
+    rot_cache_set_budget(ROT_CACHE_POOL_BYTES);
+    return *differ == 0 && hits > 0;
+}
+
+static void bench_masks(void) {
+    rot_cache_init();
+    make_mask_pairs();
+    check_masks();
+    check_maps_narrow();
+    bench_check("collision/mask_pair_tight_budget", check_tight_budget(), NULL);
+    int differ;
+    bool ok = check_narrow_fallback(&differ);
+    bench_check("collision/narrow_fallback_hitboxes", ok, "(%d of %d pairs differ)",
+                differ, MASK_PAIRS);
+
+    // Timed pairs at angles that all fit in the cache, cached beforehand
+    rot_cache_init();
+    for (int i = 0; i < MASK_PAIRS; i++) {
+        mask_pair_t* p = &s_mask_pairs[i];
+        bool overlap;
+        p->car_angle -= p->car_angle % MASK_ANGLE_STEP;
+        p->obstacle_angle -= p->obstacle_angle % (MASK_ANGLE_STEP * 6);
+        pair_overlaps(p, &overlap);
+    }
+    bench_measure("collision/mask_overlap", MASK_ITERS, 0, run_mask_overlap, NULL);
+}
+
+void bench_collision_run(void) {
+    bench_kernels();
+    make_poses();
+    make_drive();
+    check_maps();
+    bench_lot(8);
+    bench_lot(128);
+    bench_lot(MAP_MAX_OBSTACLES);
+    bench_masks();
+}
@@ -0,0 +1,154 @@
+/**
+ * @file bench_core.c
+ * @brief Baseline suite for the per-frame hot paths
+ *
+ * Each benchmark runs through bench_measure() (median of several runs)
+ * and keeps its name from build to build, so results can be compared
+ * against a stored baseline (`make bench-baseline`).
+ */
+
+#include "bench.h"
+#include <stdio.h>
+#include "bcm2835_stub.h"
+#include "lcd/framebuffer.h"
+#include "lcd/fb_simd.h"
+#include "lcd/bitmap_rle.h"
+#include "game/car_physics.h"
+#include "game/collision.h"
+#include "../assets/car.h"
+#include "../assets/handle.h"
+#include "../assets/obstacle.h"
+#include "../assets/intro.h"
+
+#define CORE_FRAME_PIXELS   (ST7789_WIDTH * ST7789_HEIGHT)
+#define CORE_BLIT_ITERS     200
+#define CORE_ROTATE_SWEEPS  2
+#define CORE_COLLIDE_PAIRS  1024
+#define CORE_COLLIDE_ITERS  20000
+#define CORE_PHYSICS_ITERS  100000
+#define CORE_PACK_ITERS     200
+#define TRANSPARENT_COLOR   0x0000
+
+static uint16_t s_intro_pixels[CORE_FRAME_PIXELS];
+static const bitmap s_intro_raw = { ST7789_WIDTH, ST7789_HEIGHT, s_intro_pixels, BITMAP_RAW, NULL, 0 };
+static uint8_t s_packed[CORE_FRAME_PIXELS * 2];
+static obb_t s_obbs[CORE_COLLIDE_PAIRS];
+static aabb_t s_aabbs[CORE_COLLIDE_PAIRS];
+static volatile uint32_t s_sink;
+
+static uint32_t s_rng = 2024;
+
+static int16_t next_random(int16_t lo, int16_t hi) {
+    s_rng = s_rng * 1103515245u + 12345u;
+    return (int16_t)(lo + (int32_t)((s_rng >> 16) % (uint32_t)(hi - lo + 1)));
+}
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    const bitmap* bmp;
+} blit_ctx_t;
+
+static void run_clear(void* ctx, uint32_t iterations) {
+    (void)ctx;
+    for (uint32_t i = 0; i < iterations; i++) {
+        fb_clear((uint16_t)(0x1234 + i));
+    }
+}
+
+static void run_bitmap(void* ctx, uint32_t iterations) {
+    const blit_ctx_t* b = ctx;
+    for (uint32_t i = 0; i < iterations; i++) {
+        fb_draw_bitmap(b->x, b->y, b->bmp);
+    }
+}
+
+static void run_rotate_sweep(void* ctx, uint32_t iterations) {
+    const bitmap* bmp = ctx;
+    for (uint32_t i = 0; i < iterations; i++) {
+        fb_draw_bitmap_rotated(120, 120, bmp, (int16_t)(i % 360), TRANSPARENT_COLOR);
+    }
+}
+
+// Every angle in turn, so the result is the average over all 360 angles
+static void bench_rotated(const char* name, const bitmap* bmp) {
+    char label[48];
+    snprintf(label, sizeof(label), "core/fb_draw_bitmap_rotated_%s", name);
+    bench_measure(label, 360 * CORE_ROTATE_SWEEPS, (uint64_t)bmp->width * bmp->height,
+                  run_rotate_sweep, (void*)bmp);
+}
+
+static void run_collision(void* ctx, uint32_t iterations) {
+    (void)ctx;
+    uint32_t hits = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint32_t k = i % CORE_COLLIDE_PAIRS;
+        hits += check_collision_obb_aabb(&s_obbs[k], &s_aabbs[k]);
+    }
+    s_sink = hits;
+}
+
+static void run_physics(void* ctx, uint32_t iterations) {
+    car_state_t* car = ctx;
+    for (uint32_t i = 0; i < iterations; i++) {
+        car_apply_acceleration(car, &default_car_params, (i & 256) == 0);
+        car_apply_turn(car, &default_car_params, (i & 64) ? 1 : -1);
+        car_physics_update(car, &default_car_params);
+        car_clamp_to_screen(car, ST7789_WIDTH, ST7789_HEIGHT, 30, 50);
+    }
+}
+
+static void run_pack(void* ctx, uint32_t iterations) {
+    const uint16_t* frame = ctx;
+    for (uint32_t i = 0; i < iterations; i++) {
+        fb_simd_pack_be(s_packed, frame, CORE_FRAME_PIXELS);
+    }
+}
+
+static void run_flush_full(void* ctx, uint32_t iterations) {
+    (void)ctx;
+    for (uint32_t i = 0; i < iterations; i++) {
+        fb_mark_dirty(0, 0, ST7789_WIDTH - 1, ST7789_HEIGHT - 1);
+        fb_flush();
+    }
+    fb_sync();
+}
+
+void bench_core_run(void) {
+    bcm2835_stub_set_panel_enabled(0);
+    fb_init();
+    fb_set_flush_mode(FB_FLUSH_DAMAGE);
+    bitmap_decode(&intro_240x240_bitmap, s_intro_pixels, ST7789_WIDTH);
+
+    bench_measure("core/fb_clear", CORE_BLIT_ITERS, CORE_FRAME_PIXELS, run_clear, NULL);
+
+    blit_ctx_t raw = { 0, 0, &s_intro_raw };
+    blit_ctx_t rle = { 0, 0, &intro_240x240_bitmap };
+    blit_ctx_t clipped = { -30, 170, &car_100x100_bitmap };
+    bench_measure("core/fb_draw_bitmap_fullscreen", CORE_BLIT_ITERS, CORE_FRAME_PIXELS, run_bitmap, &raw);
+    bench_measure("core/fb_draw_bitmap_rle", CORE_BLIT_ITERS, CORE_FRAME_PIXELS, run_bitmap, &rle);
+    bench_measure("core/fb_draw_bitmap_clipped", CORE_BLIT_ITERS * 10, 70 * 70, run_bitmap, &clipped);
+
+    bench_rotated("car", &car_100x100_bitmap);
+    bench_rotated("handle", &handle_80x80_bitmap);
+    bench_rotated("obstacle", &obstacle_75x75_bitmap);
+
+    // Car boxes scattered around obstacles, about half of them touching
+    for (int i = 0; i < CORE_COLLIDE_PAIRS; i++) {
+        s_aabbs[i] = (aabb_t){ next_random(40, 200), next_random(40, 200), 37, 37 };
+        s_obbs[i] = (obb_t){ (int16_t)(s_aabbs[i].cx + next_random(-70, 70)),
+                             (int16_t)(s_aabbs[i].cy + next_random(-70, 70)),
+                             15, 25, next_random(0, 359) };
+    }
+    bench_measure("core/check_collision_obb_aabb", CORE_COLLIDE_ITERS, 0, run_collision, NULL);
+
+    car_state_t car;
+    car_physics_init(&car, 120, 120, 0);
+    bench_measure("core/car_physics_update", CORE_PHYSICS_ITERS, 0, run_physics, &car);
+
+    bench_measure("core/flush_pack_be", CORE_PACK_ITERS, CORE_FRAME_PIXELS, run_pack, s_intro_pixels);
+    bench_measure("core/flush_full_frame", CORE_PACK_ITERS / 4, CORE_FRAME_PIXELS, run_flush_full, NULL);
+
+    fb_shutdown();
+    bcm2835_stub_set_panel_enabled(1);
+}
@@ -0,0 +1,314 @@
+/**
+ * @file bench_fb.c
+ * @brief Frame buffer benchmarks and flush correctness checks
+ */
+
+#include "bench.h"
+#include <stdio.h>
+#include <string.h>
+#include "bcm2835_stub.h"
+#include "lcd/framebuffer.h"
+#include "maps/easy_map.h"
+#include "maps/hard_map.h"
+#include "maps/map_layer.h"
+#include "lcd/bitmap_rle.h"
+#include "../assets/car.h"
+#include "../assets/easy_map.h"
+#include "../assets/obstacle.h"
+#include "../assets/intro.h"
+#include "../assets/hard_map.h"
+#include "../assets/game_over.h"
+#include "../assets/complete.h"
+
+#define FB_BENCH_FRAMES 120
+#define LAYER_BENCH_ITERS 200
+#define BLIT_BENCH_ITERS  500
+#define BLIT_CLEAR_COLOR  0x1234
+#define TRANSPARENT_COLOR 0x0000
+
+static bool panel_matches_framebuffer(void) {
+    const uint16_t* gram = bcm2835_stub_get_gram();
+
+    fb_sync();
+    for (uint16_t y = 0; y < ST7789_HEIGHT; y++) {
+        for (uint16_t x = 0; x < ST7789_WIDTH; x++) {
+            if (gram[y * ST7789_WIDTH + x] != fb_get_pixel(x, y)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Moving car over a map: erase by restoring background, redraw, flush
+static bool run_damage_scene(fb_flush_mode_t mode, uint64_t* bytes_out) {
+    bool ok = true;
+    fb_rect_t prev = {0, 0, -1, -1};
+
+    fb_set_flush_mode(mode);
+    fb_draw_bitmap(0, 0, &easy_map_240x240_bitmap);
+    fb_flush();
+    fb_sync();
+
+    bcm2835_stub_reset_stats();
+    for (int frame = 0; frame < FB_BENCH_FRAMES; frame++) {
+        int16_t cx = (int16_t)(20 + frame * 2);
+        int16_t cy = (int16_t)(120 + (frame % 30) - 15);
+        int16_t angle = (int16_t)(frame * 3);
+
+        fb_restore_bitmap_region(&easy_map_240x240_bitmap, &prev);
+        fb_draw_bitmap_rotated(cx, cy, &car_100x100_bitmap, angle, TRANSPARENT_COLOR);
+        if (!fb_get_rotated_bounds(cx, cy, &car_100x100_bitmap, angle, &prev)) {
+            prev = (fb_rect_t){0, 0, -1, -1};
+        }
+        fb_flush();
+
+        if (!panel_matches_framebuffer()) {
+            ok = false;
+        }
+    }
+    *bytes_out = bcm2835_stub_get_stats().spi_bytes / FB_BENCH_FRAMES;
+    return ok;
+}
+
+static void bench_damage_flush(void) {
+    uint64_t full_bytes = 0;
+    uint64_t damage_bytes = 0;
+
+    bool full_ok = run_damage_scene(FB_FLUSH_FULL, &full_bytes);
+    bool damage_ok = run_damage_scene(FB_FLUSH_DAMAGE, &damage_bytes);
+    fb_set_flush_mode(FB_FLUSH_FULL);
+    fb_sync();
+
+    bench_check("fb/flush_full_panel", full_ok, "(%llu bytes per frame)",
+                (unsigned long long)full_bytes);
+    bench_check("fb/flush_damage_panel", damage_ok, "(%llu bytes per frame)",
+                (unsigned long long)damage_bytes);
+}
+
+// Frame start as it used to be: background, then every active obstacle
+static void draw_map_and_obstacles(const map_config_t* map) {
+    fb_draw_bitmap(0, 0, map->map_bitmap);
+    for (int i = 0; i < map->obstacle_count; i++) {
+        if (!map->obstacles[i].active) continue;
+        fb_draw_bitmap_rotated(map->obstacles[i].x, map->obstacles[i].y,
+                               &obstacle_75x75_bitmap, map->obstacles[i].angle, TRANSPARENT_COLOR);
+    }
+}
+
+static bool layer_matches(const map_config_t* map) {
+    draw_map_and_obstacles(map);
+    return memcmp(fb_get_buffer(), map_layer_bitmap()->bitmap,
+                  ST7789_WIDTH * ST7789_HEIGHT * sizeof(uint16_t)) == 0;
+}
+
+static void bench_map_layer(void) {
+    static map_config_t map;
+    bool ok = true;
+
+    // Layer contents for both maps, then rebuild on active flag changes
+    map = *get_hard_map_config();
+    ok &= map_layer_sync(&map) && layer_matches(&map);
+    ok &= !map_layer_sync(&map);
+    map = *get_easy_map_config();
+    ok &= map_layer_sync(&map) && layer_matches(&map);
+    map.obstacles[3].active = false;
+    ok &= map_layer_sync(&map) && layer_matches(&map);
+    map.obstacles[3].active = true;
+    ok &= map_layer_sync(&map) && layer_matches(&map);
+    map_layer_invalidate();
+    ok &= map_layer_sync(&map);
+    bench_check("fb/map_layer_exact", ok, NULL);
+
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < LAYER_BENCH_ITERS; i++) {
+        draw_map_and_obstacles(&map);
+    }
+    bench_report("fb/frame_start_map_obstacles", LAYER_BENCH_ITERS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (int i = 0; i < LAYER_BENCH_ITERS; i++) {
+        map_layer_sync(&map);
+        fb_draw_bitmap(0, 0, map_layer_bitmap());
+    }
+    bench_report("fb/frame_start_layer", LAYER_BENCH_ITERS, bench_now_ns() - start);
+}
+
+static uint16_t s_expected[ST7789_HEIGHT][ST7789_WIDTH];
+
+// Uncompressed copy of the intro screen (BITMAP_RLE in assets/)
+static uint16_t s_intro_pixels[ST7789_HEIGHT * ST7789_WIDTH];
+static const bitmap s_intro_raw = { ST7789_WIDTH, ST7789_HEIGHT, s_intro_pixels, BITMAP_RAW, NULL, 0 };
+
+static void reference_fill(uint16_t color) {
+    for (int y = 0; y < ST7789_HEIGHT; y++) {
+        for (int x = 0; x < ST7789_WIDTH; x++) {
+            s_expected[y][x] = BITMAP_PX(color);
+        }
+    }
+}
+
+// Per-pixel clipped copy with signed origin
+static void reference_bitmap(int16_t x, int16_t y, const bitmap* bmp) {
+    for (int by = 0; by < bmp->height; by++) {
+        for (int bx = 0; bx < bmp->width; bx++) {
+            int sx = x + bx;
+            int sy = y + by;
+            if (sx < 0 || sx >= ST7789_WIDTH || sy < 0 || sy >= ST7789_HEIGHT) continue;
+            s_expected[sy][sx] = bmp->bitmap[by * bmp->width + bx];
+        }
+    }
+}
+
+static bool expected_matches(void) {
+    return memcmp(s_expected, fb_get_buffer(), sizeof(s_expected)) == 0;
+}
+
+static bool check_blits_exact(void) {
+    static const int16_t origins[][2] = {
+        {0, 0}, {10, 20}, {-30, 5}, {200, -40}, {-99, -99}, {239, 239}, {-100, 0}, {240, 10}
+    };
+    static const uint16_t colors[] = {0x0000, 0xFFFF, 0x1234, 0xF800, 0x00FF};
+
+    for (size_t c = 0; c < sizeof(colors) / sizeof(colors[0]); c++) {
+        fb_clear(colors[c]);
+        reference_fill(colors[c]);
+        if (!expected_matches()) return false;
+
+        fb_draw_rect(17, 33, 101, 7, colors[(c + 1) % 5]);
+        fb_draw_rect(0, 100, ST7789_WIDTH, 20, colors[(c + 2) % 5]);
+        fb_draw_rect(230, 230, 50, 50, colors[(c + 3) % 5]);
+        for (int y = 33; y < 40; y++) {
+            for (int x = 17; x < 118; x++) s_expected[y][x] = BITMAP_PX(colors[(c + 1) % 5]);
+        }
+        for (int y = 100; y < 120; y++) {
+            for (int x = 0; x < ST7789_WIDTH; x++) s_expected[y][x] = BITMAP_PX(colors[(c + 2) % 5]);
+        }
+        for (int y = 230; y < ST7789_HEIGHT; y++) {
+            for (int x = 230; x < ST7789_WIDTH; x++) s_expected[y][x] = BITMAP_PX(colors[(c + 3) % 5]);
+        }
+        if (!expected_matches()) return false;
+    }
+
+    // Compressed and raw bitmaps at clipped and negative origins
+    for (size_t o = 0; o < sizeof(origins) / sizeof(origins[0]); o++) {
+        const bitmap* sources[] = { &s_intro_raw, &intro_240x240_bitmap };
+        for (size_t b = 0; b < 2; b++) {
+            fb_clear(BLIT_CLEAR_COLOR);
+            reference_fill(BLIT_CLEAR_COLOR);
+            fb_draw_bitmap(origins[o][0], origins[o][1], &car_100x100_bitmap);
+            reference_bitmap(origins[o][0], origins[o][1], &car_100x100_bitmap);
+            fb_draw_bitmap(origins[o][0], origins[o][1], sources[b]);
+            reference_bitmap(origins[o][0], origins[o][1], &s_intro_raw);
+            if (!expected_matches()) {
+                printf("bitmap mismatch at (%d, %d) %s\n", origins[o][0], origins[o][1],
+                       b ? "rle" : "raw");
+                return false;
+            }
+        }
+    }
+
+    // Region restore from a compressed bitmap
+    static const fb_rect_t regions[] = {
+        {0, 0, 239, 239}, {10, 20, 60, 90}, {-5, 200, 30, 260}, {200, 0, 239, 0}, {120, 239, 120, 239}
+    };
+    for (size_t r = 0; r < sizeof(regions) / sizeof(regions[0]); r++) {
+        fb_clear(BLIT_CLEAR_COLOR);
+        fb_restore_bitmap_region(&s_intro_raw, &regions[r]);
+        memcpy(s_expected, fb_get_buffer(), sizeof(s_expected));
+        fb_clear(BLIT_CLEAR_COLOR);
+        fb_restore_bitmap_region(&intro_240x240_bitmap, &regions[r]);
+        if (!expected_matches()) {
+            printf("rle restore mismatch in region %zu\n", r);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Screens the game redraws whole; they ship RAW so fb_draw_bitmap() copies
+// them in one go
+static const bitmap* const s_shipped_screens[] = {
+    &easy_map_240x240_bitmap, &hard_map_240x240_bitmap,
+    &game_over_240x240_bitmap, &complete_240x240_bitmap
+};
+#define SHIPPED_SCREEN_COUNT (sizeof(s_shipped_screens) / sizeof(s_shipped_screens[0]))
+
+static bool check_shipped_screens(void) {
+    for (size_t i = 0; i < SHIPPED_SCREEN_COUNT; i++) {
+        const bitmap* bmp = s_shipped_screens[i];
+        if (bmp->format != BITMAP_RAW || bmp->width != ST7789_WIDTH ||
+            bmp->height != ST7789_HEIGHT) {
+            printf("shipped screen %zu is not a raw full screen\n", i);
+            return false;
+        }
+        fb_clear(BLIT_CLEAR_COLOR);
+        reference_fill(BLIT_CLEAR_COLOR);
+        fb_draw_bitmap(0, 0, bmp);
+        reference_bitmap(0, 0, bmp);
+        if (!expected_matches()) {
+            printf("shipped screen %zu mismatch\n", i);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void bench_blits(void) {
+    bitmap_decode(&intro_240x240_bitmap, s_intro_pixels, ST7789_WIDTH);
+    bench_check("fb/blit_exact", check_blits_exact(), NULL);
+    bench_check("fb/shipped_screens_raw", check_shipped_screens(), NULL);
+
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < BLIT_BENCH_ITERS; i++) {
+        reference_bitmap(0, 0, &s_intro_raw);
+    }
+    bench_report("fb/fullscreen_bitmap_reference", BLIT_BENCH_ITERS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (int i = 0; i < BLIT_BENCH_ITERS; i++) {
+        fb_draw_bitmap(0, 0, &s_intro_raw);
+    }
+    bench_report("fb/fullscreen_bitmap", BLIT_BENCH_ITERS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (int i = 0; i < BLIT_BENCH_ITERS; i++) {
+        fb_draw_bitmap(0, 0, s_shipped_screens[i % SHIPPED_SCREEN_COUNT]);
+    }
+    bench_report("fb/fullscreen_bitmap_shipped", BLIT_BENCH_ITERS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (int i = 0; i < BLIT_BENCH_ITERS; i++) {
+        fb_draw_bitmap(0, 0, &intro_240x240_bitmap);
+    }
+    bench_report("fb/fullscreen_bitmap_rle", BLIT_BENCH_ITERS, bench_now_ns() - start);
+    printf("%-36s %12u bytes (raw %u)\n", "fb/intro_rle_size", intro_240x240_bitmap.data_size,
+           (unsigned)sizeof(s_intro_pixels));
+
+    start = bench_now_ns();
+    for (int i = 0; i < BLIT_BENCH_ITERS; i++) {
+        fb_draw_bitmap(-30, 170, &car_100x100_bitmap);
+    }
+    bench_report("fb/clipped_bitmap", BLIT_BENCH_ITERS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (int i = 0; i < BLIT_BENCH_ITERS; i++) {
+        fb_clear(BLIT_CLEAR_COLOR);
+    }
+    bench_report("fb/clear", BLIT_BENCH_ITERS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (int i = 0; i < BLIT_BENCH_ITERS; i++) {
+        fb_draw_rect(20, 20, 200, 200, BLIT_CLEAR_COLOR);
+    }
+    bench_report("fb/rect_200x200", BLIT_BENCH_ITERS, bench_now_ns() - start);
+}
+
+void bench_fb_run(void) {
+    fb_init();
+    bench_damage_flush();
+    bench_map_layer();
+    bench_blits();
+    fb_flush();
+    fb_shutdown();
+}
@@ -0,0 +1,324 @@
+/**
+ * @file bench_input.c
+ * @brief Input snapshot and debounce checks
+ *
+ * Drives the stub's input pins through every combination of the six
+ * controls and checks that one GPLEV0 snapshot decodes to the same state
+ * as reading each pin separately. Register reads are counted by the stub,
+ * since their cost on the Pi (uncached peripheral access) cannot be
+ * reproduced on the host. The debouncer is fed bouncing contact traces
+ * and must report exactly one press and one release, without the
+ * debounced readers ever calling bcm2835_delay(). The background sampler
+ * is driven sample by sample on simulated time, then run as a real
+ * thread against the stub pins.
+ */
+
+#include "bench.h"
+#include <bcm2835.h>
+#include "bcm2835_stub.h"
+#include "common/gpio_init.h"
+#include "input/button.h"
+#include "input/joystick.h"
+#include "input/input_snapshot.h"
+#include "input/debounce.h"
+#include "input/input_sampler.h"
+#include "common/timing.h"
+#include "game/car_physics.h"
+
+#define INPUT_DECODE_ITERS   1000000
+#define INPUT_DEBOUNCE_ITERS 1000000
+#define INPUT_SAMPLER_ITERS  1000000
+
+#define SAMPLER_TICK_US      10000   // Game physics tick
+#define SAMPLER_TAP_START_MS 12      // A tap that falls between two tick polls
+#define SAMPLER_TAP_MS       6
+
+// INPUT_KEY_* mask the stub pins report (also read by the sampler thread)
+static volatile uint8_t s_pressed;
+static volatile uint32_t s_sink;
+
+static uint8_t scripted_input(uint8_t pin) {
+    uint8_t key = 0;
+    switch (pin) {
+        case BUTTON_A:  key = INPUT_KEY_A; break;
+        case BUTTON_B:  key = INPUT_KEY_B; break;
+        case JOY_UP:    key = INPUT_KEY_UP; break;
+        case JOY_DOWN:  key = INPUT_KEY_DOWN; break;
+        case JOY_LEFT:  key = INPUT_KEY_LEFT; break;
+        case JOY_RIGHT: key = INPUT_KEY_RIGHT; break;
+    }
+    return (s_pressed & key) ? LOW : HIGH;
+}
+
+// The six controls read pin by pin, as before the snapshot API
+static uint8_t read_per_pin(void) {
+    uint8_t keys = 0;
+    if (bcm2835_gpio_lev(BUTTON_A) == LOW) keys |= INPUT_KEY_A;
+    if (bcm2835_gpio_lev(BUTTON_B) == LOW) keys |= INPUT_KEY_B;
+    if (bcm2835_gpio_lev(JOY_UP) == LOW) keys |= INPUT_KEY_UP;
+    if (bcm2835_gpio_lev(JOY_DOWN) == LOW) keys |= INPUT_KEY_DOWN;
+    if (bcm2835_gpio_lev(JOY_LEFT) == LOW) keys |= INPUT_KEY_LEFT;
+    if (bcm2835_gpio_lev(JOY_RIGHT) == LOW) keys |= INPUT_KEY_RIGHT;
+    return keys;
+}
+
+static bool snapshot_matches_pins(void) {
+    for (uint32_t mask = 0; mask <= INPUT_KEY_ANY; mask++) {
+        s_pressed = (uint8_t)mask;
+
+        uint8_t keys = input_snapshot_read();
+        joystick_state_t joy = joystick_read_state();
+        joystick_state_t snap_joy = input_snapshot_joystick(keys);
+        if (keys != read_per_pin() || keys != mask ||
+            joy.up != snap_joy.up || joy.down != snap_joy.down ||
+            joy.left != snap_joy.left || joy.right != snap_joy.right ||
+            input_snapshot_button(keys, BTN_A) != button_read_raw(BTN_A) ||
+            input_snapshot_button(keys, BTN_B) != button_read_raw(BTN_B)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint64_t count_reads(uint8_t (*read)(void)) {
+    uint64_t before = bcm2835_stub_get_stats().gplev_reads;
+    s_sink = read();
+    return bcm2835_stub_get_stats().gplev_reads - before;
+}
+
+// A press and a release of A, both bouncing for a few samples
+static const uint8_t s_bouncy_trace[] = {
+    0, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+};
+#define TRACE_LEN (sizeof(s_bouncy_trace) / sizeof(s_bouncy_trace[0]))
+
+static bool debounce_bouncy_edges(void) {
+    debounce_t d;
+    debounce_init(&d);
+
+    uint32_t presses = 0, releases = 0, held_at_release = 0;
+    for (size_t i = 0; i < TRACE_LEN; i++) {
+        debounce_update(&d, s_bouncy_trace[i] ? INPUT_KEY_A : 0);
+        if (d.pressed & INPUT_KEY_A) presses++;
+        if (d.released & INPUT_KEY_A) {
+            releases++;
+            held_at_release = i;
+        }
+        if (i + 1 == DEBOUNCE_SAMPLES + 5 && !(d.state & INPUT_KEY_A)) {
+            return false;  // Settled press not accepted in time
+        }
+    }
+    return presses == 1 && releases == 1 && !(d.state & INPUT_KEY_A) &&
+           debounce_held(&d, INPUT_KEY_A) == TRACE_LEN - 1 - held_at_release;
+}
+
+// A one-sample glitch on a released key and on a held key is ignored
+static bool debounce_ignores_glitch(void) {
+    debounce_t d;
+    debounce_init(&d);
+
+    debounce_update(&d, INPUT_KEY_B);
+    bool ok = d.state == 0 && d.pressed == 0;
+    debounce_update(&d, 0);
+    for (int i = 0; i < DEBOUNCE_SAMPLES + 1; i++) {
+        debounce_update(&d, INPUT_KEY_B);
+    }
+    uint32_t held = debounce_held(&d, INPUT_KEY_B);
+    debounce_update(&d, 0);
+    ok = ok && (d.state & INPUT_KEY_B) && d.released == 0;
+    debounce_update(&d, INPUT_KEY_B);
+    return ok && (d.state & INPUT_KEY_B) && debounce_held(&d, INPUT_KEY_B) == held + 2;
+}
+
+// Debounced readers report state and never wait
+static bool debounced_readers_nonblocking(void) {
+    s_pressed = INPUT_KEY_B | INPUT_KEY_DOWN;
+    uint64_t before = bcm2835_stub_get_stats().delay_ms;
+
+    for (int i = 0; i < DEBOUNCE_SAMPLES; i++) {
+        input_poll();
+    }
+    bool ok = button_read(BTN_B) == BUTTON_PRESSED && !button_is_pressed(BTN_A) &&
+              joystick_is_down() && !joystick_is_up() && !joystick_is_left() &&
+              !joystick_is_right();
+
+    s_pressed = 0;
+    for (int i = 0; i < DEBOUNCE_SAMPLES; i++) {
+        input_poll();
+    }
+    ok = ok && button_read(BTN_B) == BUTTON_RELEASED && !joystick_is_down();
+    return ok && bcm2835_stub_get_stats().delay_ms == before;
+}
+
+// A 6 ms tap between two 10 ms ticks: the sampler reports it, split over
+// the ticks it spans, for its full length; polling once per tick misses it
+static bool sampler_catches_short_tap(uint32_t* weight_sum, bool* seen_by_tick_poll) {
+    debounce_t per_tick;
+    debounce_init(&per_tick);
+    input_sampler_reset(0);
+
+    uint8_t tick_keys = 0;
+    *weight_sum = 0;
+    *seen_by_tick_poll = false;
+    for (uint32_t ms = 0; ms < 50; ms++) {
+        s_pressed = (ms >= SAMPLER_TAP_START_MS && ms < SAMPLER_TAP_START_MS + SAMPLER_TAP_MS) ?
+                    INPUT_KEY_A : 0;
+        input_sampler_poll((uint64_t)ms * 1000);
+
+        if (ms % (SAMPLER_TICK_US / 1000) == 0) {
+            *seen_by_tick_poll |= (input_poll()->state & INPUT_KEY_A) != 0;
+            debounce_update(&per_tick, input_snapshot_read());
+        }
+        if ((ms + 1) % (SAMPLER_TICK_US / 1000) == 0) {
+            input_tick_t tick;
+            input_sampler_collect((uint64_t)(ms + 1) * 1000, &tick);
+            tick_keys |= tick.keys;
+            *weight_sum += input_tick_weight(&tick, INPUT_KEY_A);
+        }
+    }
+    *seen_by_tick_poll |= (per_tick.state & INPUT_KEY_A) != 0;
+
+    // Each tick's weight is rounded down, so allow one unit per tick
+    uint32_t expected = SAMPLER_TAP_MS * 1000 * INPUT_WEIGHT_FULL / SAMPLER_TICK_US;
+    return tick_keys == INPUT_KEY_A && *weight_sum <= expected && *weight_sum + 2 >= expected;
+}
+
+// Contact bounce at 1 kHz produces one press and one release event
+static bool sampler_debounces(void) {
+    input_sampler_reset(0);
+    for (size_t i = 0; i < TRACE_LEN; i++) {
+        s_pressed = s_bouncy_trace[i] ? INPUT_KEY_A : 0;
+        input_sampler_poll((uint64_t)i * 1000);
+    }
+    input_tick_t tick;
+    input_sampler_collect(TRACE_LEN * 1000, &tick);
+    input_sampler_stats_t stats = input_sampler_get_stats();
+    return stats.events == 2 && stats.overruns == 0 && (tick.keys & INPUT_KEY_A);
+}
+
+// Far more changes than the ring holds: changes wait, the final state arrives
+static bool sampler_overflow_keeps_state(void) {
+    input_sampler_reset(0);
+    uint64_t t = 0;
+    for (uint32_t i = 0; i < 4 * INPUT_SAMPLER_RING_SIZE * INPUT_SAMPLER_DEBOUNCE; i++) {
+        s_pressed = ((i / INPUT_SAMPLER_DEBOUNCE) & 1) ? INPUT_KEY_B : 0;
+        input_sampler_poll(t += 1000);
+    }
+    s_pressed = 0;
+    for (uint32_t i = 0; i < INPUT_SAMPLER_DEBOUNCE; i++) {
+        input_sampler_poll(t += 1000);
+    }
+
+    input_tick_t tick;
+    input_sampler_collect(t + 1000, &tick);   // Drains the full ring
+    input_sampler_poll(t += 1000);            // Pushes the waiting release
+    input_sampler_collect(t + 1000, &tick);
+    input_sampler_collect(t + 2000, &tick);
+    return input_sampler_get_stats().overruns > 0 && tick.keys == 0;
+}
+
+// The real thread against the stub pins, on the monotonic clock
+static bool sampler_thread_edges(uint32_t* samples) {
+    s_pressed = 0;
+    if (!input_sampler_start(INPUT_SAMPLER_PERIOD_US)) {
+        return false;
+    }
+    uint64_t t = timing_now_us();
+    timing_sleep_until_us(t += 20000);
+    s_pressed = INPUT_KEY_LEFT;
+    timing_sleep_until_us(t += 50000);
+    s_pressed = 0;
+    timing_sleep_until_us(t += 50000);
+    input_sampler_stop();
+
+    input_tick_t tick;
+    input_sampler_collect(timing_now_us(), &tick);
+    input_sampler_stats_t stats = input_sampler_get_stats();
+    *samples = stats.samples;
+    return stats.events == 2 && tick.keys == INPUT_KEY_LEFT &&
+           input_tick_weight(&tick, INPUT_KEY_LEFT) < INPUT_WEIGHT_FULL;
+}
+
+// Partial ticks add up to whole ones, including turns below one degree
+static bool weighted_physics_adds_up(void) {
+    car_state_t whole, parts;
+    car_physics_init(&whole, 120, 120, 0);
+    car_physics_init(&parts, 120, 120, 0);
+    whole.speed = parts.speed = 256;
+
+    car_apply_acceleration(&whole, &default_car_params, true);
+    car_apply_turn(&whole, &default_car_params, +1);
+    for (int i = 0; i < 4; i++) {
+        car_apply_acceleration_weighted(&parts, &default_car_params, true, CAR_WEIGHT_FULL / 4);
+        car_apply_turn_weighted(&parts, &default_car_params, +1, CAR_WEIGHT_FULL / 4);
+    }
+    return whole.speed == parts.speed && whole.angle == parts.angle && parts.turn_residue == 0;
+}
+
+static void run_sampler_poll(void* ctx, uint32_t iterations) {
+    (void)ctx;
+    for (uint32_t i = 0; i < iterations; i++) {
+        input_sampler_poll(i);
+    }
+    s_sink = input_sampler_get_stats().samples;
+}
+
+static void run_debounce(void* ctx, uint32_t iterations) {
+    debounce_t* d = ctx;
+    for (uint32_t i = 0; i < iterations; i++) {
+        debounce_update(d, (uint8_t)((i * 0x9E3779B9u) >> 26));
+    }
+    s_sink = d->state;
+}
+
+static void run_decode(void* ctx, uint32_t iterations) {
+    (void)ctx;
+    uint32_t acc = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        acc += input_snapshot_decode(i * 0x9E3779B9u);
+    }
+    s_sink = acc;
+}
+
+void bench_input_run(void) {
+    bcm2835_stub_set_input(scripted_input);
+
+    bench_check("input/snapshot_exact", snapshot_matches_pins(), "(64 combinations)");
+
+    s_pressed = INPUT_KEY_A | INPUT_KEY_LEFT;
+    uint64_t per_pin = count_reads(read_per_pin);
+    uint64_t snapshot = count_reads(input_snapshot_read);
+    bench_check("input/gplev_reads_per_sample", snapshot == 1,
+                "(%llu per pin, %llu snapshot)",
+                (unsigned long long)per_pin, (unsigned long long)snapshot);
+
+    bench_measure("input/snapshot_decode", INPUT_DECODE_ITERS, 0, run_decode, NULL);
+
+    bench_check("input/debounce_bouncy_edges", debounce_bouncy_edges(), NULL);
+    bench_check("input/debounce_glitch", debounce_ignores_glitch(), NULL);
+    bench_check("input/debounce_nonblocking", debounced_readers_nonblocking(), NULL);
+
+    debounce_t d;
+    debounce_init(&d);
+    bench_measure("input/debounce_update", INPUT_DEBOUNCE_ITERS, 0, run_debounce, &d);
+
+    uint32_t weight_sum = 0;
+    bool seen_by_tick_poll = false;
+    bool tap_ok = sampler_catches_short_tap(&weight_sum, &seen_by_tick_poll);
+    bench_check("input/sampler_short_tap", tap_ok,
+                "(%u ms tap = %u/%u of a tick, per-tick poll %s)", SAMPLER_TAP_MS, weight_sum,
+                INPUT_WEIGHT_FULL, seen_by_tick_poll ? "saw it" : "missed it");
+    bench_check("input/sampler_debounce", sampler_debounces(), NULL);
+    bench_check("input/sampler_overflow", sampler_overflow_keeps_state(), NULL);
+    bench_check("input/weighted_physics", weighted_physics_adds_up(), NULL);
+
+    uint32_t samples = 0;
+    bool thread_ok = sampler_thread_edges(&samples);
+    bench_check("input/sampler_thread", thread_ok, "(%u samples in 120 ms)", samples);
+
+    s_pressed = 0;
+    input_sampler_reset(0);
+    bench_measure("input/sampler_poll", INPUT_SAMPLER_ITERS, 0, run_sampler_poll, NULL);
+
+    bcm2835_stub_set_input(NULL);
+}
@@ -0,0 +1,125 @@
+/**
+ * @file bench_rotate.c
+ * @brief Rotated sprite blit benchmarks and exactness check
+ */
+
+#include "bench.h"
+#include <stdio.h>
+#include <string.h>
+#include "lcd/framebuffer.h"
+#include "game/sin_table.h"
+#include "../assets/car.h"
+#include "../assets/handle.h"
+#include "../assets/obstacle.h"
+
+#define ROTATE_BENCH_REPEAT 4
+#define ROTATE_CLEAR_COLOR  0x1234
+#define TRANSPARENT_COLOR   0x0000
+
+static uint16_t s_reference[ST7789_HEIGHT][ST7789_WIDTH];
+
+// Previous per-pixel inverse-mapping loop, kept as the exactness oracle
+static void reference_draw_rotated(int16_t cx, int16_t cy, const bitmap* bmp,
+                                   int16_t angle, uint16_t transparent_color) {
+    angle = normalize_angle(angle);
+    if (angle == 0) {
+        int16_t x = cx - bmp->width / 2;
+        int16_t y = cy - bmp->height / 2;
+        for (uint16_t by = 0; by < bmp->height; by++) {
+            for (uint16_t bx = 0; bx < bmp->width; bx++) {
+                int16_t sx = x + bx;
+                int16_t sy = y + by;
+                if (sx < 0 || sx >= ST7789_WIDTH || sy < 0 || sy >= ST7789_HEIGHT) continue;
+                uint16_t color = bmp->bitmap[by * bmp->width + bx];
+                if (color != transparent_color) s_reference[sy][sx] = color;
+            }
+        }
+        return;
+    }
+
+    int16_t bmp_cx = bmp->width / 2;
+    int16_t bmp_cy = bmp->height / 2;
+    int16_t sin_a = get_sin(angle);
+    int16_t cos_a = get_cos(angle);
+    int16_t max_dim = (bmp->width > bmp->height) ? bmp->width : bmp->height;
+    int16_t half_diag = (max_dim * 3) / 4 + 1;
+
+    for (int16_t dy = -half_diag; dy <= half_diag; dy++) {
+        for (int16_t dx = -half_diag; dx <= half_diag; dx++) {
+            int16_t sx = cx + dx;
+            int16_t sy = cy + dy;
+            if (sx < 0 || sx >= ST7789_WIDTH || sy < 0 || sy >= ST7789_HEIGHT) continue;
+
+            int32_t src_x_fp = (int32_t)dx * cos_a + (int32_t)dy * sin_a;
+            int32_t src_y_fp = -(int32_t)dx * sin_a + (int32_t)dy * cos_a;
+            int16_t src_x = (src_x_fp >> FP_SHIFT) + bmp_cx;
+            int16_t src_y = (src_y_fp >> FP_SHIFT) + bmp_cy;
+            if (src_x < 0 || src_x >= bmp->width || src_y < 0 || src_y >= bmp->height) continue;
+
+            uint16_t color = bmp->bitmap[src_y * bmp->width + src_x];
+            if (color != transparent_color) s_reference[sy][sx] = color;
+        }
+    }
+}
+
+static void reference_clear(void) {
+    for (int y = 0; y < ST7789_HEIGHT; y++) {
+        for (int x = 0; x < ST7789_WIDTH; x++) {
+            s_reference[y][x] = BITMAP_PX(ROTATE_CLEAR_COLOR);
+        }
+    }
+}
+
+// Every angle at centre, edge and corner positions (partially off screen)
+static bool check_rotated_exact(const bitmap* bmp) {
+    static const int16_t positions[][2] = {
+        {120, 120}, {0, 0}, {239, 239}, {-30, 100}, {260, 50}, {100, -40}, {37, 211}
+    };
+
+    for (int16_t angle = 0; angle < 360; angle++) {
+        for (size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); p++) {
+            fb_clear(ROTATE_CLEAR_COLOR);
+            reference_clear();
+            fb_draw_bitmap_rotated(positions[p][0], positions[p][1], bmp, angle, TRANSPARENT_COLOR);
+            reference_draw_rotated(positions[p][0], positions[p][1], bmp, angle, BITMAP_PX(TRANSPARENT_COLOR));
+            if (memcmp(s_reference, fb_get_buffer(), sizeof(s_reference)) != 0) {
+                printf("rotate mismatch: angle %d at (%d, %d)\n",
+                       angle, positions[p][0], positions[p][1]);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void bench_rotated_sprite(const char* name, const char* ref_name, const bitmap* bmp) {
+    uint32_t draws = 360 * ROTATE_BENCH_REPEAT;
+
+    uint64_t start = bench_now_ns();
+    for (int r = 0; r < ROTATE_BENCH_REPEAT; r++) {
+        for (int16_t angle = 0; angle < 360; angle++) {
+            reference_draw_rotated(120, 120, bmp, angle, TRANSPARENT_COLOR);
+        }
+    }
+    bench_report(ref_name, draws, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (int r = 0; r < ROTATE_BENCH_REPEAT; r++) {
+        for (int16_t angle = 0; angle < 360; angle++) {
+            fb_draw_bitmap_rotated(120, 120, bmp, angle, TRANSPARENT_COLOR);
+        }
+    }
+    bench_report(name, draws, bench_now_ns() - start);
+}
+
+void bench_rotate_run(void) {
+    bool ok = check_rotated_exact(&car_100x100_bitmap) &&
+              check_rotated_exact(&obstacle_75x75_bitmap) &&
+              check_rotated_exact(&handle_80x80_bitmap);
+    bench_check("rotate/exact_vs_reference", ok, NULL);
+
+    bench_rotated_sprite("rotate/car_span", "rotate/car_reference", &car_100x100_bitmap);
+    bench_rotated_sprite("rotate/obstacle_span", "rotate/obstacle_reference", &obstacle_75x75_bitmap);
+    bench_rotated_sprite("rotate/handle_span", "rotate/handle_reference", &handle_80x80_bitmap);
+    fb_flush();
+}
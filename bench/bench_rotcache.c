@@ -0,0 +1,134 @@
+/**
+ * @file bench_rotcache.c
+ * @brief Pre-rotated sprite cache benchmarks and exactness check
+ */
+
+#include "bench.h"
+#include <stdio.h>
+#include <string.h>
+#include "lcd/framebuffer.h"
+#include "lcd/rot_cache.h"
+#include "game/car_physics.h"
+#include "../assets/car.h"
+#include "../assets/handle.h"
+#include "../assets/obstacle.h"
+
+#define ROTCACHE_BENCH_REPEAT 8
+#define ROTCACHE_CLEAR_COLOR  0x1234
+#define TRANSPARENT_COLOR     0x0000
+
+// Physics ticks of the weighted-turn run and the hit rate it must reach
+#define ROTCACHE_TURN_TICKS   20000
+#define ROTCACHE_MIN_HIT_PCT  99
+
+static uint16_t s_expected[ST7789_HEIGHT * ST7789_WIDTH];
+
+// Cached draws must match fb_draw_bitmap_rotated() pixel for pixel
+static bool check_cache_exact(const bitmap* bmp) {
+    static const int16_t positions[][2] = {
+        {120, 120}, {0, 0}, {239, 239}, {-30, 100}, {260, 50}, {100, -40}, {37, 211}
+    };
+
+    for (int16_t angle = 0; angle < 360; angle++) {
+        for (size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); p++) {
+            fb_clear(ROTCACHE_CLEAR_COLOR);
+            fb_draw_bitmap_rotated(positions[p][0], positions[p][1], bmp, angle, TRANSPARENT_COLOR);
+            memcpy(s_expected, fb_get_buffer(), sizeof(s_expected));
+
+            fb_clear(ROTCACHE_CLEAR_COLOR);
+            rot_cache_draw(positions[p][0], positions[p][1], bmp, angle, TRANSPARENT_COLOR);
+            if (memcmp(s_expected, fb_get_buffer(), sizeof(s_expected)) != 0) {
+                printf("rot_cache mismatch: angle %d at (%d, %d)\n",
+                       angle, positions[p][0], positions[p][1]);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Draw every angle in [first, last] with the given step, as seen in play
+static void bench_cached_sprite(const char* name, const bitmap* bmp,
+                                int16_t first, int16_t last, int16_t step) {
+    uint32_t draws = 0;
+
+    for (int16_t angle = first; angle <= last; angle += step) {
+        rot_cache_prewarm(bmp, angle, TRANSPARENT_COLOR);
+    }
+
+    uint64_t start = bench_now_ns();
+    for (int r = 0; r < ROTCACHE_BENCH_REPEAT; r++) {
+        for (int16_t angle = first; angle <= last; angle += step) {
+            rot_cache_draw(120, 120, bmp, angle, TRANSPARENT_COLOR);
+            draws++;
+        }
+    }
+    bench_report(name, draws, bench_now_ns() - start);
+}
+
+// Sampler-style play: partial turn weights every tick, the car drawn and
+// tested against an obstacle at its angle, as the game does
+static void check_weighted_turns(void) {
+    static const int16_t obstacle_angles[] = { 0, 30, 60, 90 };
+    uint32_t rng = 77;
+    int8_t direction = 1;
+    car_state_t car;
+
+    rot_cache_init();
+    car_physics_init(&car, 120, 120, 0);
+    car.speed = default_car_params.max_speed_forward;
+    for (int t = 0; t < ROTCACHE_TURN_TICKS; t++) {
+        rng = rng * 1103515245u + 12345u;
+        if ((rng >> 24) < 4) direction = -direction;
+        uint16_t weight = (uint16_t)(1 + (rng >> 16) % CAR_WEIGHT_FULL);
+        car_apply_turn_weighted(&car, &default_car_params, direction, weight);
+
+        bool overlap;
+        rot_cache_draw(120, 120, &car_100x100_bitmap, car.angle, TRANSPARENT_COLOR);
+        rot_cache_sprites_overlap(&car_100x100_bitmap, 120, 120, car.angle,
+                                  &obstacle_75x75_bitmap, 150, 120,
+                                  obstacle_angles[t % 4], TRANSPARENT_COLOR, &overlap);
+    }
+
+    rot_cache_stats_t stats = rot_cache_get_stats();
+    uint32_t lookups = stats.hits + stats.misses;
+    bool ok = stats.evictions == 0 && stats.hits * 100 >= lookups * ROTCACHE_MIN_HIT_PCT;
+    bench_check("rotcache/weighted_turn_hit_rate", ok,
+                "(%.2f%% of %u lookups hit, %u entries, %u evictions)",
+                100.0 * stats.hits / lookups, lookups, stats.entries, stats.evictions);
+}
+
+void bench_rotcache_run(void) {
+    rot_cache_init();
+    bool ok = check_cache_exact(&car_100x100_bitmap) &&
+              check_cache_exact(&obstacle_75x75_bitmap) &&
+              check_cache_exact(&handle_80x80_bitmap);
+    bench_check("rotcache/exact_vs_rotate", ok, NULL);
+
+    rot_cache_stats_t stats = rot_cache_get_stats();
+    printf("%-36s %u entries, %u bytes, %u evictions\n", "rotcache/all_angles",
+           stats.entries, stats.bytes_used, stats.evictions);
+
+    // In-game working set: car in turn_rate steps, handle in return-speed
+    // steps up to +-HANDLE_ANGLE_MAX, obstacles at map angles
+    rot_cache_init();
+    bench_cached_sprite("rotcache/car_cached", &car_100x100_bitmap, 0, 357, 3);
+    bench_cached_sprite("rotcache/handle_cached", &handle_80x80_bitmap, -45, 45, 5);
+    bench_cached_sprite("rotcache/obstacle_cached", &obstacle_75x75_bitmap, 0, 90, 30);
+    stats = rot_cache_get_stats();
+    printf("%-36s %u hits, %u misses, %u bytes\n", "rotcache/working_set",
+           stats.hits, stats.misses, stats.bytes_used);
+
+    // A tight budget must evict but still draw correctly
+    rot_cache_init();
+    rot_cache_set_budget(32 * 1024);
+    ok = check_cache_exact(&car_100x100_bitmap);
+    stats = rot_cache_get_stats();
+    bench_check("rotcache/exact_small_budget", ok, "(%u evictions, %u/%u bytes)",
+                stats.evictions, stats.bytes_used, stats.budget_bytes);
+
+    rot_cache_set_budget(ROT_CACHE_POOL_BYTES);
+    check_weighted_turns();
+    rot_cache_init();
+    fb_flush();
+}
@@ -0,0 +1,175 @@
+/**
+ * @file bench_simd.c
+ * @brief SIMD kernel benchmarks and bit-exactness checks against scalar
+ */
+
+#include "bench.h"
+#include <stdio.h>
+#include <string.h>
+#include "lcd/fb_simd.h"
+#include "lcd/framebuffer.h"
+#include "../assets/car.h"
+#include "../assets/handle.h"
+#include "../assets/obstacle.h"
+
+#define SIMD_MAX_COUNT     (ST7789_WIDTH * ST7789_HEIGHT)
+#define SIMD_BENCH_ITERS   500
+#define SIMD_CHECK_PAD     16
+#define SIMD_KEY           0x0000
+#define SIMD_CLEAR_COLOR   0x1234
+
+static uint16_t s_src[SIMD_MAX_COUNT + SIMD_CHECK_PAD];
+static uint16_t s_dst_a[SIMD_MAX_COUNT + SIMD_CHECK_PAD];
+static uint16_t s_dst_b[SIMD_MAX_COUNT + SIMD_CHECK_PAD];
+static uint8_t s_pack_a[2 * (SIMD_MAX_COUNT + SIMD_CHECK_PAD)];
+static uint8_t s_pack_b[2 * (SIMD_MAX_COUNT + SIMD_CHECK_PAD)];
+
+static uint32_t s_rng = 12345;
+
+static uint16_t next_random(void) {
+    s_rng = s_rng * 1103515245u + 12345u;
+    return (uint16_t)(s_rng >> 16);
+}
+
+// Source with runs of key pixels, so masks are neither all-on nor all-off
+static void fill_source(void) {
+    for (size_t i = 0; i < sizeof(s_src) / sizeof(s_src[0]); i++) {
+        uint16_t r = next_random();
+        s_src[i] = ((r & 7) < 3) ? SIMD_KEY : r;
+    }
+}
+
+static void fill_dest(uint16_t* a, uint16_t* b) {
+    for (size_t i = 0; i < SIMD_MAX_COUNT + SIMD_CHECK_PAD; i++) {
+        a[i] = b[i] = (uint16_t)(0xA5A5 ^ i);
+    }
+}
+
+// Every length up to 70 at every start offset up to 7, plus a full frame
+static bool check_kernels_exact(void) {
+    static const uint16_t colors[] = {0x1234, 0xF800, 0xFFFF, 0x0000, 0x00FF};
+
+    fill_source();
+    for (size_t offset = 0; offset < 8; offset++) {
+        for (size_t count = 0; count <= 70; count++) {
+            size_t n = (count == 70) ? SIMD_MAX_COUNT : count;
+
+            for (size_t c = 0; c < sizeof(colors) / sizeof(colors[0]); c++) {
+                fill_dest(s_dst_a, s_dst_b);
+                fb_simd_fill(&s_dst_a[offset], colors[c], n);
+                fb_simd_fill_scalar(&s_dst_b[offset], colors[c], n);
+                if (memcmp(s_dst_a, s_dst_b, sizeof(s_dst_a)) != 0) {
+                    printf("fill mismatch: offset %zu count %zu\n", offset, n);
+                    return false;
+                }
+            }
+
+            fill_dest(s_dst_a, s_dst_b);
+            fb_simd_copy_keyed(&s_dst_a[offset], &s_src[offset / 2], n, SIMD_KEY);
+            fb_simd_copy_keyed_scalar(&s_dst_b[offset], &s_src[offset / 2], n, SIMD_KEY);
+            if (memcmp(s_dst_a, s_dst_b, sizeof(s_dst_a)) != 0) {
+                printf("copy_keyed mismatch: offset %zu count %zu\n", offset, n);
+                return false;
+            }
+
+            memset(s_pack_a, 0x5A, sizeof(s_pack_a));
+            memset(s_pack_b, 0x5A, sizeof(s_pack_b));
+            fb_simd_pack_be(&s_pack_a[offset], &s_src[offset / 2], n);
+            fb_simd_pack_be_scalar(&s_pack_b[offset], &s_src[offset / 2], n);
+            if (memcmp(s_pack_a, s_pack_b, sizeof(s_pack_a)) != 0) {
+                printf("pack_be mismatch: offset %zu count %zu\n", offset, n);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static uint16_t s_expected[ST7789_HEIGHT][ST7789_WIDTH];
+
+// Scalar transparent blit centered at (cx, cy), as the 0-degree rotation
+// path places it
+static void keyed_draw_centered(int16_t cx, int16_t cy, const bitmap* bmp) {
+    int32_t x = cx - bmp->width / 2;
+    int32_t y = cy - bmp->height / 2;
+    for (int32_t by = 0; by < bmp->height; by++) {
+        for (int32_t bx = 0; bx < bmp->width; bx++) {
+            int32_t sx = x + bx;
+            int32_t sy = y + by;
+            if (sx < 0 || sx >= ST7789_WIDTH || sy < 0 || sy >= ST7789_HEIGHT) continue;
+            uint16_t color = bmp->bitmap[by * bmp->width + bx];
+            if (color != BITMAP_PX(SIMD_KEY)) s_expected[sy][sx] = color;
+        }
+    }
+}
+
+// fb_draw_bitmap_rotated() at 0 degrees goes through fb_simd_copy_keyed();
+// odd widths and clipped centers leave vector tails at both row ends
+static bool check_rotated_zero_exact(void) {
+    static const int16_t centers[][2] = {
+        {120, 120}, {0, 0}, {239, 239}, {-20, 100}, {250, 30}, {117, -13}, {3, 236}
+    };
+    static const bitmap odd = { 37, 23, s_src, BITMAP_RAW, NULL, 0 };
+    const bitmap* sources[] = { &car_100x100_bitmap, &handle_80x80_bitmap, &obstacle_75x75_bitmap, &odd };
+
+    fill_source();
+    for (size_t b = 0; b < sizeof(sources) / sizeof(sources[0]); b++) {
+        for (size_t c = 0; c < sizeof(centers) / sizeof(centers[0]); c++) {
+            fb_clear(SIMD_CLEAR_COLOR);
+            memcpy(s_expected, fb_get_buffer(), sizeof(s_expected));
+            keyed_draw_centered(centers[c][0], centers[c][1], sources[b]);
+            fb_draw_bitmap_rotated(centers[c][0], centers[c][1], sources[b], 0, SIMD_KEY);
+            if (memcmp(s_expected, fb_get_buffer(), sizeof(s_expected)) != 0) {
+                printf("rotated 0 mismatch: bitmap %zu at (%d, %d)\n", b,
+                       centers[c][0], centers[c][1]);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void bench_simd_run(void) {
+    char label[48];
+
+    snprintf(label, sizeof(label), "simd/exact_%s_vs_scalar", fb_simd_backend());
+    bench_check(label, check_kernels_exact(), NULL);
+    snprintf(label, sizeof(label), "simd/rotated_0_%s_vs_scalar", fb_simd_backend());
+    bench_check(label, check_rotated_zero_exact(), NULL);
+
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < SIMD_BENCH_ITERS; i++) {
+        fb_simd_fill_scalar(s_dst_a, 0x1234 + i, SIMD_MAX_COUNT);
+    }
+    bench_report("simd/fill_frame_scalar", SIMD_BENCH_ITERS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (int i = 0; i < SIMD_BENCH_ITERS; i++) {
+        fb_simd_fill(s_dst_a, 0x1234 + i, SIMD_MAX_COUNT);
+    }
+    bench_report("simd/fill_frame", SIMD_BENCH_ITERS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (int i = 0; i < SIMD_BENCH_ITERS; i++) {
+        fb_simd_copy_keyed_scalar(s_dst_a, s_src, SIMD_MAX_COUNT, SIMD_KEY);
+    }
+    bench_report("simd/copy_keyed_frame_scalar", SIMD_BENCH_ITERS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (int i = 0; i < SIMD_BENCH_ITERS; i++) {
+        fb_simd_copy_keyed(s_dst_a, s_src, SIMD_MAX_COUNT, SIMD_KEY);
+    }
+    bench_report("simd/copy_keyed_frame", SIMD_BENCH_ITERS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (int i = 0; i < SIMD_BENCH_ITERS; i++) {
+        fb_simd_pack_be_scalar(s_pack_a, s_src, SIMD_MAX_COUNT);
+    }
+    bench_report("simd/pack_be_frame_scalar", SIMD_BENCH_ITERS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (int i = 0; i < SIMD_BENCH_ITERS; i++) {
+        fb_simd_pack_be(s_pack_a, s_src, SIMD_MAX_COUNT);
+    }
+    bench_report("simd/pack_be_frame", SIMD_BENCH_ITERS, bench_now_ns() - start);
+}
@@ -0,0 +1,88 @@
+/**
+ * @file bench_spi.c
+ * @brief ST7789 SPI transfer benchmarks (per-byte vs bulk)
+ */
+
+#include "bench.h"
+#include <stdio.h>
+#include <bcm2835.h>
+#include "bcm2835_stub.h"
+#include "common/gpio_init.h"
+#include "lcd/st7789.h"
+
+#define SPI_BENCH_ITERATIONS 50
+#define FRAME_PIXELS (ST7789_WIDTH * ST7789_HEIGHT)
+
+static uint16_t s_frame[FRAME_PIXELS];
+
+// Previous implementation: two single-byte transfers per pixel
+static void legacy_write_framebuffer(const uint16_t* buffer, size_t length) {
+    st7789_set_window(0, 0, ST7789_WIDTH - 1, ST7789_HEIGHT - 1);
+    st7789_write_command(ST7789_RAMWR);
+    bcm2835_gpio_set(TFT_DC);
+
+    for (size_t i = 0; i < length; i++) {
+        bcm2835_spi_transfer(buffer[i] >> 8);
+        bcm2835_spi_transfer(buffer[i] & 0xFF);
+    }
+}
+
+static void print_traffic(const char* name) {
+    bcm2835_stub_stats_t stats = bcm2835_stub_get_stats();
+    printf("%-36s %10llu calls %12llu bytes per frame\n", name,
+           (unsigned long long)(stats.spi_calls / SPI_BENCH_ITERATIONS),
+           (unsigned long long)(stats.spi_bytes / SPI_BENCH_ITERATIONS));
+}
+
+static void bench_legacy_framebuffer(void) {
+    bcm2835_stub_reset_stats();
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < SPI_BENCH_ITERATIONS; i++) {
+        legacy_write_framebuffer(s_frame, FRAME_PIXELS);
+    }
+    bench_report("spi/write_framebuffer_legacy", SPI_BENCH_ITERATIONS, bench_now_ns() - start);
+    print_traffic("spi/write_framebuffer_legacy");
+}
+
+static void bench_bulk_framebuffer(void) {
+    bcm2835_stub_reset_stats();
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < SPI_BENCH_ITERATIONS; i++) {
+        st7789_write_framebuffer(s_frame, FRAME_PIXELS);
+    }
+    bench_report("spi/write_framebuffer_bulk", SPI_BENCH_ITERATIONS, bench_now_ns() - start);
+    print_traffic("spi/write_framebuffer_bulk");
+}
+
+static void bench_wire_framebuffer(void) {
+    bcm2835_stub_reset_stats();
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < SPI_BENCH_ITERATIONS; i++) {
+        st7789_write_framebuffer_wire(s_frame, FRAME_PIXELS);
+    }
+    bench_report("spi/write_framebuffer_wire", SPI_BENCH_ITERATIONS, bench_now_ns() - start);
+    print_traffic("spi/write_framebuffer_wire");
+}
+
+static void bench_fill_screen(void) {
+    bcm2835_stub_reset_stats();
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < SPI_BENCH_ITERATIONS; i++) {
+        st7789_fill_screen((i & 1) ? COLOR_RED : COLOR_BLUE);
+    }
+    bench_report("spi/fill_screen_bulk", SPI_BENCH_ITERATIONS, bench_now_ns() - start);
+    print_traffic("spi/fill_screen_bulk");
+}
+
+void bench_spi_run(void) {
+    bcm2835_stub_set_panel_enabled(0);
+    for (int i = 0; i < FRAME_PIXELS; i++) {
+        s_frame[i] = (uint16_t)(i * 31);
+    }
+
+    bench_legacy_framebuffer();
+    bench_bulk_framebuffer();
+    bench_wire_framebuffer();
+    bench_fill_screen();
+    bcm2835_stub_set_panel_enabled(1);
+}
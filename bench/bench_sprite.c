@@ -0,0 +1,89 @@
+/**
+ * @file bench_sprite.c
+ * @brief Opaque-span sprite blit benchmarks and exactness check
+ */
+
+#include "bench.h"
+#include <stdio.h>
+#include <string.h>
+#include "lcd/framebuffer.h"
+#include "../assets/car.h"
+#include "../assets/handle.h"
+#include "../assets/obstacle.h"
+
+#define SPRITE_BENCH_ITERS  2000
+#define SPRITE_CLEAR_COLOR  0x1234
+#define TRANSPARENT_COLOR   0x0000
+
+static uint16_t s_expected[ST7789_HEIGHT * ST7789_WIDTH];
+
+// Per-pixel transparent blit the sprite must reproduce
+static void keyed_draw(int16_t x, int16_t y, const bitmap* bmp, uint16_t key) {
+    uint16_t* fb = fb_get_buffer();
+    for (int16_t by = 0; by < bmp->height; by++) {
+        for (int16_t bx = 0; bx < bmp->width; bx++) {
+            int16_t sx = x + bx;
+            int16_t sy = y + by;
+            if (sx < 0 || sx >= ST7789_WIDTH || sy < 0 || sy >= ST7789_HEIGHT) continue;
+            uint16_t color = bmp->bitmap[by * bmp->width + bx];
+            if (color != key) fb[sy * ST7789_WIDTH + sx] = color;
+        }
+    }
+}
+
+static bool check_sprite_exact(const bitmap* bmp, const sprite_t* sprite) {
+    static const int16_t positions[][2] = {
+        {70, 70}, {0, 0}, {200, 200}, {-40, 30}, {190, -20}, {-60, -60}, {239, 100}, {300, 0}
+    };
+
+    for (size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); p++) {
+        fb_clear(SPRITE_CLEAR_COLOR);
+        keyed_draw(positions[p][0], positions[p][1], bmp, BITMAP_PX(TRANSPARENT_COLOR));
+        memcpy(s_expected, fb_get_buffer(), sizeof(s_expected));
+
+        fb_clear(SPRITE_CLEAR_COLOR);
+        fb_draw_sprite(positions[p][0], positions[p][1], sprite);
+        if (memcmp(s_expected, fb_get_buffer(), sizeof(s_expected)) != 0) {
+            printf("sprite mismatch at (%d, %d)\n", positions[p][0], positions[p][1]);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void bench_sprite_case(const char* name, const bitmap* bmp) {
+    sprite_t sprite;
+    char label[48];
+
+    if (!sprite_from_bitmap(bmp, TRANSPARENT_COLOR, &sprite)) {
+        bench_check(name, false, "(pool exhausted)");
+        return;
+    }
+
+    bool ok = check_sprite_exact(bmp, &sprite);
+    snprintf(label, sizeof(label), "sprite/%s_exact", name);
+    bench_check(label, ok, "(%u -> %u bytes, %u runs)",
+                (unsigned)(bmp->width * bmp->height * sizeof(uint16_t)),
+                sprite_data_bytes(&sprite), sprite.run_count);
+
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < SPRITE_BENCH_ITERS; i++) {
+        keyed_draw(70, 70, bmp, BITMAP_PX(TRANSPARENT_COLOR));
+    }
+    snprintf(label, sizeof(label), "sprite/%s_keyed", name);
+    bench_report(label, SPRITE_BENCH_ITERS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (int i = 0; i < SPRITE_BENCH_ITERS; i++) {
+        fb_draw_sprite(70, 70, &sprite);
+    }
+    snprintf(label, sizeof(label), "sprite/%s_spans", name);
+    bench_report(label, SPRITE_BENCH_ITERS, bench_now_ns() - start);
+}
+
+void bench_sprite_run(void) {
+    bench_sprite_case("car", &car_100x100_bitmap);
+    bench_sprite_case("obstacle", &obstacle_75x75_bitmap);
+    bench_sprite_case("handle", &handle_80x80_bitmap);
+    fb_flush();
+}
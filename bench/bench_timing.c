@@ -0,0 +1,138 @@
+/**
+ * @file bench_timing.c
+ * @brief Fixed-timestep loop checks and deadline sleep accuracy
+ *
+ * The game loop is replayed on a simulated clock with different frame
+ * costs; the car must end up in the same state at every frame rate.
+ */
+
+#include "bench.h"
+#include <stdio.h>
+#include "common/timing.h"
+#include "game/car_physics.h"
+#include "frame_profiler.h"
+
+#define TIMING_TICK_US       10000
+#define TIMING_MAX_CATCHUP   10
+#define TIMING_SIM_TICKS     1000
+#define TIMING_SLEEP_ITERS   200
+#define TIMING_SLEEP_STEP_US 2000
+
+typedef struct {
+    uint32_t ticks;
+    uint32_t frames;
+    uint32_t dropped;
+    uint64_t elapsed_us;
+    car_state_t car;
+} sim_result_t;
+
+// Same structure as handle_state_playing(), time advanced by frame_us per render
+static sim_result_t simulate(uint32_t frame_us) {
+    sim_result_t r = {0};
+    timing_stepper_t physics;
+    uint64_t now = 0;
+
+    car_physics_init(&r.car, 120, 200, 0);
+    timing_stepper_init(&physics, now + TIMING_TICK_US, TIMING_TICK_US, TIMING_MAX_CATCHUP);
+
+    while (r.ticks < TIMING_SIM_TICKS) {
+        uint32_t ticks = timing_stepper_advance(&physics, now);
+        for (uint32_t i = 0; i < ticks && r.ticks < TIMING_SIM_TICKS; i++) {
+            // Accelerate and steer for the first 3 s, then coast
+            if (r.ticks < 300) {
+                car_apply_acceleration(&r.car, &default_car_params, true);
+                car_apply_turn(&r.car, &default_car_params, +1);
+            }
+            car_physics_update(&r.car, &default_car_params);
+            r.ticks++;
+            r.elapsed_us = now;
+        }
+
+        now += frame_us;
+        r.frames++;
+        if (now < physics.next_us) {
+            now = physics.next_us;
+        }
+    }
+    r.dropped = physics.dropped;
+    return r;
+}
+
+static bool same_car(const car_state_t* a, const car_state_t* b) {
+    return a->pos_x == b->pos_x && a->pos_y == b->pos_y &&
+           a->speed == b->speed && a->angle == b->angle;
+}
+
+static void check_frame_rate_independence(void) {
+    static const uint32_t frame_costs_us[] = { 1000, 16667, 33333, 50000 };
+    sim_result_t ref = simulate(frame_costs_us[0]);
+    bool ok = true;
+
+    for (size_t i = 0; i < sizeof(frame_costs_us) / sizeof(frame_costs_us[0]); i++) {
+        sim_result_t r = simulate(frame_costs_us[i]);
+        printf("%-36s %6u frames %8.3f s last tick %4u dropped\n", "timing/sim_frame_cost",
+               r.frames, (double)r.elapsed_us / 1e6, r.dropped);
+
+        // Same car state after the same ticks, and the last tick ran within
+        // one frame of its deadline
+        uint64_t ideal_us = (uint64_t)TIMING_SIM_TICKS * TIMING_TICK_US;
+        ok = ok && r.dropped == 0 && same_car(&r.car, &ref.car) &&
+             r.elapsed_us <= ideal_us + frame_costs_us[i];
+    }
+    bench_check("timing/physics_rate_independent", ok, NULL);
+
+    // A frame slower than the catch-up window drops ticks instead of snowballing
+    sim_result_t slow = simulate(TIMING_TICK_US * (TIMING_MAX_CATCHUP + 5));
+    bench_check("timing/catchup_bounded", slow.dropped > 0, "(%u dropped)", slow.dropped);
+}
+
+static void bench_sleep_accuracy(void) {
+    uint64_t total_late = 0;
+    uint64_t max_late = 0;
+    uint64_t deadline = timing_now_us();
+
+    for (int i = 0; i < TIMING_SLEEP_ITERS; i++) {
+        deadline += TIMING_SLEEP_STEP_US;
+        timing_sleep_until_us(deadline);
+        uint64_t late = timing_now_us() - deadline;
+        total_late += late;
+        if (late > max_late) max_late = late;
+    }
+    printf("%-36s %10.1f us avg %6llu us max\n", "timing/sleep_until_lateness",
+           (double)total_late / TIMING_SLEEP_ITERS, (unsigned long long)max_late);
+}
+
+#ifdef FRAME_PROFILE
+// Percentiles of a known distribution, and the cost of one timed section
+static void check_profiler(void) {
+    frame_profiler_init();
+    for (uint64_t ns = 1; ns <= 10000; ns++) {
+        frame_profiler_record(PROF_STAGE_INPUT, ns * 100);
+    }
+
+    bool ok = true;
+    static const uint32_t pcts[] = { 50, 95, 99 };
+    for (size_t i = 0; i < sizeof(pcts) / sizeof(pcts[0]); i++) {
+        uint64_t exact = (uint64_t)pcts[i] * 10000;
+        uint64_t got = frame_profiler_percentile(PROF_STAGE_INPUT, pcts[i]);
+        ok = ok && got >= exact && got <= exact + exact / 8;
+    }
+    bench_check("timing/profiler_percentiles", ok, NULL);
+
+    volatile uint32_t sink = 0;
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < TIMING_SLEEP_ITERS * 100; i++) {
+        PROF_TIME(PROF_STAGE_PHYSICS, sink++);
+    }
+    bench_report("timing/profiler_section", TIMING_SLEEP_ITERS * 100, bench_now_ns() - start);
+    frame_profiler_init();
+}
+#endif
+
+void bench_timing_run(void) {
+    check_frame_rate_independence();
+    bench_sleep_accuracy();
+#ifdef FRAME_PROFILE
+    check_profiler();
+#endif
+}
@@ -0,0 +1,76 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "timing.h"
+#include <time.h>
+#include <errno.h>
+
+static const timing_source_t* s_source = NULL;
+
+void timing_set_source(const timing_source_t* source) {
+    s_source = source;
+}
+
+uint64_t timing_now_us(void) {
+    if (s_source != NULL) {
+        return s_source->now_us();
+    }
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+uint64_t timing_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void timing_sleep_until_us(uint64_t deadline_us) {
+    if (s_source != NULL) {
+        s_source->sleep_until_us(deadline_us);
+        return;
+    }
+
+    // Coarse part: absolute sleep, so an interrupted sleep resumes correctly
+    if (deadline_us > TIMING_SPIN_US) {
+        uint64_t wake_us = deadline_us - TIMING_SPIN_US;
+        if (timing_now_us() < wake_us) {
+            struct timespec ts = {
+                .tv_sec = (time_t)(wake_us / 1000000ULL),
+                .tv_nsec = (long)(wake_us % 1000000ULL) * 1000L
+            };
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+            }
+        }
+    }
+
+    // Fine part: spin through the last stretch
+    while (timing_now_us() < deadline_us) {
+    }
+}
+
+void timing_stepper_init(timing_stepper_t* s, uint64_t now_us,
+                         uint32_t step_us, uint32_t max_steps) {
+    s->next_us = now_us;
+    s->step_us = step_us;
+    s->max_steps = max_steps;
+    s->dropped = 0;
+}
+
+uint32_t timing_stepper_advance(timing_stepper_t* s, uint64_t now_us) {
+    if (now_us < s->next_us) {
+        return 0;
+    }
+
+    uint64_t due = (now_us - s->next_us) / s->step_us + 1;
+    if (due > s->max_steps) {
+        // Too far behind: run max_steps and restart the schedule from now
+        s->dropped += (uint32_t)(due - s->max_steps);
+        s->next_us = now_us + s->step_us;
+        return s->max_steps;
+    }
+
+    s->next_us += due * s->step_us;
+    return (uint32_t)due;
+}
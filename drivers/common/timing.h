@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Last stretch before a deadline that is busy-waited instead of slept
+// (covers scheduler wake-up latency)
+#ifndef TIMING_SPIN_US
+#define TIMING_SPIN_US 500
+#endif
+
+/**
+ * Fixed-timestep scheduler
+ * Produces a constant number of steps per second of wall time,
+ * independent of how long each frame takes.
+ */
+typedef struct {
+    uint64_t next_us;       // Deadline of the next step
+    uint32_t step_us;       // Step period
+    uint32_t max_steps;     // Steps run at most per advance (rest is dropped)
+    uint32_t dropped;       // Steps dropped because the loop fell behind
+} timing_stepper_t;
+
+/**
+ * Replacement clock for the scheduling functions
+ * Lets a simulator run the game loop on virtual time: now_us reads the
+ * clock and sleep_until_us advances it.
+ */
+typedef struct {
+    uint64_t (*now_us)(void);
+    void (*sleep_until_us)(uint64_t deadline_us);
+} timing_source_t;
+
+/**
+ * Route timing_now_us() and timing_sleep_until_us() through a source
+ * (NULL restores the monotonic clock). timing_now_ns() always reads the
+ * monotonic clock, so profiling keeps measuring real time.
+ */
+void timing_set_source(const timing_source_t* source);
+
+/**
+ * Monotonic time in microseconds (unaffected by wall clock changes)
+ */
+uint64_t timing_now_us(void);
+
+/**
+ * Monotonic time in nanoseconds (for profiling short code sections)
+ */
+uint64_t timing_now_ns(void);
+
+/**
+ * Sleep until a monotonic deadline
+ * Sleeps until TIMING_SPIN_US before the deadline, then spins.
+ * Returns immediately if the deadline has passed.
+ */
+void timing_sleep_until_us(uint64_t deadline_us);
+
+/**
+ * Start a stepper whose first step is due at now_us
+ */
+void timing_stepper_init(timing_stepper_t* s, uint64_t now_us,
+                         uint32_t step_us, uint32_t max_steps);
+
+/**
+ * Take the steps that are due at now_us
+ * Returns: number of steps to run (0..max_steps). If the loop fell
+ *          further behind than max_steps, the backlog is dropped so a
+ *          slow frame cannot snowball into ever longer catch-up.
+ */
+uint32_t timing_stepper_advance(timing_stepper_t* s, uint64_t now_us);
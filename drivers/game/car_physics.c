@@ -22,22 +22,29 @@ void car_physics_init(car_state_t* car, int16_t start_x, int16_t start_y, int16_
     car->pos_y = (int32_t)start_y << CAR_FP_SHIFT;
     car->speed = 0;
     car->angle = start_angle;
+    car->turn_residue = 0;
     car->is_accelerating = false;
     car->is_braking = false;
 }
 
 void car_apply_acceleration(car_state_t* car, const car_physics_params_t* params, bool forward) {
+    car_apply_acceleration_weighted(car, params, forward, CAR_WEIGHT_FULL);
+}
+
+void car_apply_acceleration_weighted(car_state_t* car, const car_physics_params_t* params,
+                                     bool forward, uint16_t weight) {
     car->is_accelerating = true;
+    int32_t rate = params->acceleration_rate * weight / CAR_WEIGHT_FULL;
 
     if (forward) {
         // 전진 가속
-        car->speed += params->acceleration_rate;
+        car->speed += rate;
         if (car->speed > params->max_speed_forward) {
             car->speed = params->max_speed_forward;
         }
     } else {
         // 후진 가속
-        car->speed -= params->acceleration_rate;
+        car->speed -= rate;
         if (car->speed < -params->max_speed_reverse) {
             car->speed = -params->max_speed_reverse;
         }
@@ -45,15 +52,20 @@ void car_apply_acceleration(car_state_t* car, const car_physics_params_t* params
 }
 
 void car_apply_brake(car_state_t* car, const car_physics_params_t* params) {
+    car_apply_brake_weighted(car, params, CAR_WEIGHT_FULL);
+}
+
+void car_apply_brake_weighted(car_state_t* car, const car_physics_params_t* params, uint16_t weight) {
     car->is_braking = true;
+    int32_t deceleration = params->brake_deceleration * weight / CAR_WEIGHT_FULL;
 
     if (car->speed > 0) {
-        car->speed -= params->brake_deceleration;
+        car->speed -= deceleration;
         if (car->speed < 0) {
             car->speed = 0;
         }
     } else if (car->speed < 0) {
-        car->speed += params->brake_deceleration;
+        car->speed += deceleration;
         if (car->speed > 0) {
             car->speed = 0;
         }
@@ -80,6 +92,11 @@ static void apply_friction(car_state_t* car, const car_physics_params_t* params)
 }
 
 void car_apply_turn(car_state_t* car, const car_physics_params_t* params, int8_t direction) {
+    car_apply_turn_weighted(car, params, direction, CAR_WEIGHT_FULL);
+}
+
+void car_apply_turn_weighted(car_state_t* car, const car_physics_params_t* params,
+                             int8_t direction, uint16_t weight) {
     // 속도의 절댓값 계산
     int32_t abs_speed = car->speed;
     if (abs_speed < 0) {
@@ -97,8 +114,12 @@ void car_apply_turn(car_state_t* car, const car_physics_params_t* params, int8_t
         effective_direction = -direction;
     }
 
-    // 각도 업데이트
-    car->angle += effective_direction * params->turn_rate;
+    // 각도 업데이트: turn_rate 단위로만 회전하고 나머지는 누적
+    // (화면/충돌 각도가 turn_rate 배수로 유지되어 회전 캐시 항목 수가 제한됨)
+    int32_t step = params->turn_rate * (int32_t)CAR_WEIGHT_FULL;
+    int32_t turn = effective_direction * params->turn_rate * (int32_t)weight + car->turn_residue;
+    car->angle += (int16_t)(turn / step * params->turn_rate);
+    car->turn_residue = (int16_t)(turn % step);
 
     // 각도 정규화 (0-359)
     while (car->angle < 0) {
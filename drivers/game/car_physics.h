@@ -13,6 +13,9 @@
 #define CAR_FP_SHIFT 8
 #define CAR_FP_SCALE (1 << CAR_FP_SHIFT)  // 256
 
+// 입력 가중치: 한 프레임 중 입력이 유지된 비율 (CAR_WEIGHT_FULL = 프레임 전체)
+#define CAR_WEIGHT_FULL 256
+
 /**
  * 자동차 상태 구조체
  */
@@ -27,6 +30,9 @@ typedef struct {
     // 방향 (0-359도, 0=위쪽, 시계방향 증가)
     int16_t angle;
 
+    // turn_rate 한 단계 미만 회전 누적값 (1/CAR_WEIGHT_FULL도 단위, 부분 입력용)
+    int16_t turn_residue;
+
     // 상태 플래그 (프레임별 리셋)
     bool is_accelerating;
     bool is_braking;
@@ -65,6 +71,13 @@ void car_physics_init(car_state_t* car, int16_t start_x, int16_t start_y, int16_
  */
 void car_apply_acceleration(car_state_t* car, const car_physics_params_t* params, bool forward);
 
+/**
+ * 가중치 가속 (프레임 일부 동안만 눌린 버튼)
+ * @param weight 1..CAR_WEIGHT_FULL, 가속도에 weight/CAR_WEIGHT_FULL 배 적용
+ */
+void car_apply_acceleration_weighted(car_state_t* car, const car_physics_params_t* params,
+                                     bool forward, uint16_t weight);
+
 /**
  * 브레이크 적용 (조이스틱 아래)
  * @param car 자동차 상태 포인터
@@ -72,6 +85,12 @@ void car_apply_acceleration(car_state_t* car, const car_physics_params_t* params
  */
 void car_apply_brake(car_state_t* car, const car_physics_params_t* params);
 
+/**
+ * 가중치 브레이크
+ * @param weight 1..CAR_WEIGHT_FULL
+ */
+void car_apply_brake_weighted(car_state_t* car, const car_physics_params_t* params, uint16_t weight);
+
 /**
  * 회전 적용 (조이스틱 좌/우)
  * - 후진 시 방향 자동 반전
@@ -82,6 +101,15 @@ void car_apply_brake(car_state_t* car, const car_physics_params_t* params);
  */
 void car_apply_turn(car_state_t* car, const car_physics_params_t* params, int8_t direction);
 
+/**
+ * 가중치 회전
+ * - 각도는 turn_rate 단위로만 바뀜 (회전 캐시가 담을 각도 수 제한)
+ * - 한 단계 미만 회전은 turn_residue에 누적되어 다음 회전에 반영
+ * @param weight 1..CAR_WEIGHT_FULL
+ */
+void car_apply_turn_weighted(car_state_t* car, const car_physics_params_t* params,
+                             int8_t direction, uint16_t weight);
+
 /**
  * 전체 물리 업데이트 (매 프레임 호출)
  * - 마찰 적용
@@ -10,37 +10,36 @@
 #define COLLISION_FP_SHIFT 10
 #define COLLISION_FP_SCALE (1 << COLLISION_FP_SHIFT)  // 1024
 
-/**
- * @brief Fixed-point dot product
- */
-static int32_t vec2_dot(const vec2_fp_t* a, const vec2_fp_t* b) {
-    int64_t result = (int64_t)a->x * b->x + (int64_t)a->y * b->y;
-    return (int32_t)(result >> COLLISION_FP_SHIFT);
+// Axis of an OBB in table units (length about COLLISION_FP_SCALE)
+typedef struct {
+    int32_t cos_a;
+    int32_t sin_a;
+    int64_t len_sq;  // cos^2 + sin^2
+} obb_axes_t;
+
+static obb_axes_t obb_axes(const obb_t* obb) {
+    obb_axes_t axes = { get_cos(obb->angle), get_sin(obb->angle), 0 };
+    axes.len_sq = (int64_t)axes.cos_a * axes.cos_a + (int64_t)axes.sin_a * axes.sin_a;
+    return axes;
 }
 
-/**
- * @brief Project vertices onto an axis and get min/max range
- */
-static void project_vertices(const vec2_fp_t vertices[4],
-                             const vec2_fp_t* axis,
-                             int32_t* out_min, int32_t* out_max) {
-    int32_t projection = vec2_dot(&vertices[0], axis);
-    *out_min = projection;
-    *out_max = projection;
-
-    for (int i = 1; i < 4; i++) {
-        projection = vec2_dot(&vertices[i], axis);
-        if (projection < *out_min) *out_min = projection;
-        if (projection > *out_max) *out_max = projection;
-    }
+static int64_t abs64(int64_t v) {
+    return (v < 0) ? -v : v;
 }
 
 /**
- * @brief Check if two ranges overlap
+ * @brief Bounding circles do not touch
+ *
+ * Uses (r1 + r2)^2 <= 2 * (r1^2 + r2^2), so no square root is needed and
+ * the test never rejects touching boxes. Squared radii are in table units.
  */
-static bool ranges_overlap(int32_t min1, int32_t max1,
-                           int32_t min2, int32_t max2) {
-    return !(max1 < min2 || max2 < min1);
+static bool circles_apart(int32_t dx, int32_t dy, int64_t r1_sq, int64_t r2_sq) {
+    int64_t dist_sq = ((int64_t)dx * dx + (int64_t)dy * dy) * COLLISION_FP_SCALE * COLLISION_FP_SCALE;
+    return dist_sq > 2 * (r1_sq + r2_sq);
+}
+
+static int64_t obb_radius_sq(const obb_t* obb, const obb_axes_t* axes) {
+    return ((int64_t)obb->half_w * obb->half_w + (int64_t)obb->half_h * obb->half_h) * axes->len_sq;
 }
 
 void obb_get_vertices(const obb_t* obb, vec2_fp_t vertices[4]) {
@@ -65,54 +64,154 @@ void obb_get_vertices(const obb_t* obb, vec2_fp_t vertices[4]) {
     }
 }
 
-bool check_collision_obb_aabb(const obb_t* obb, const aabb_t* aabb) {
-    // 1. Calculate OBB vertices
-    vec2_fp_t obb_verts[4];
-    obb_get_vertices(obb, obb_verts);
+void obb_get_extent(const obb_t* obb, int16_t* min_x, int16_t* min_y,
+                    int16_t* max_x, int16_t* max_y) {
+    vec2_fp_t verts[4];
+    obb_get_vertices(obb, verts);
 
-    // 2. Calculate AABB vertices (no rotation)
-    vec2_fp_t aabb_verts[4];
-    int32_t aabb_cx_fp = (int32_t)aabb->cx << COLLISION_FP_SHIFT;
-    int32_t aabb_cy_fp = (int32_t)aabb->cy << COLLISION_FP_SHIFT;
-    int32_t aabb_hw_fp = (int32_t)aabb->half_w << COLLISION_FP_SHIFT;
-    int32_t aabb_hh_fp = (int32_t)aabb->half_h << COLLISION_FP_SHIFT;
+    int32_t x0 = verts[0].x, x1 = verts[0].x;
+    int32_t y0 = verts[0].y, y1 = verts[0].y;
+    for (int i = 1; i < 4; i++) {
+        if (verts[i].x < x0) x0 = verts[i].x;
+        if (verts[i].x > x1) x1 = verts[i].x;
+        if (verts[i].y < y0) y0 = verts[i].y;
+        if (verts[i].y > y1) y1 = verts[i].y;
+    }
 
-    aabb_verts[0] = (vec2_fp_t){aabb_cx_fp - aabb_hw_fp, aabb_cy_fp - aabb_hh_fp};
-    aabb_verts[1] = (vec2_fp_t){aabb_cx_fp + aabb_hw_fp, aabb_cy_fp - aabb_hh_fp};
-    aabb_verts[2] = (vec2_fp_t){aabb_cx_fp + aabb_hw_fp, aabb_cy_fp + aabb_hh_fp};
-    aabb_verts[3] = (vec2_fp_t){aabb_cx_fp - aabb_hw_fp, aabb_cy_fp + aabb_hh_fp};
+    // Round outwards to whole pixels
+    *min_x = (int16_t)(x0 >> COLLISION_FP_SHIFT);
+    *min_y = (int16_t)(y0 >> COLLISION_FP_SHIFT);
+    *max_x = (int16_t)((x1 + COLLISION_FP_SCALE - 1) >> COLLISION_FP_SHIFT);
+    *max_y = (int16_t)((y1 + COLLISION_FP_SCALE - 1) >> COLLISION_FP_SHIFT);
+}
 
-    // 3. SAT: Test separation on 4 axes
-    // Axes 1,2: AABB axes (X, Y)
-    // Axes 3,4: OBB axes (rotated X, Y)
+/*
+ * Projected-radius SAT: on axis L the boxes are apart when the projected
+ * center distance exceeds the sum of their projected half extents,
+ * |D.L| > sum(half * |axis.L|). Box axes come from the sine table, so both
+ * sides are scaled by COLLISION_FP_SCALE and compared exactly in 64 bits.
+ * Touching boxes collide.
+ */
+bool check_collision_obb_aabb(const obb_t* obb, const aabb_t* aabb) {
+    int32_t dx = aabb->cx - obb->cx;
+    int32_t dy = aabb->cy - obb->cy;
+    obb_axes_t a = obb_axes(obb);
+
+    int64_t aabb_r_sq = ((int64_t)aabb->half_w * aabb->half_w +
+                         (int64_t)aabb->half_h * aabb->half_h) * COLLISION_FP_SCALE * COLLISION_FP_SCALE;
+    if (circles_apart(dx, dy, obb_radius_sq(obb, &a), aabb_r_sq)) {
+        return false;
+    }
 
-    vec2_fp_t axes[4];
+    int64_t abs_c = abs64(a.cos_a);
+    int64_t abs_s = abs64(a.sin_a);
 
-    // AABB axes (fixed)
-    axes[0] = (vec2_fp_t){COLLISION_FP_SCALE, 0};  // X axis
-    axes[1] = (vec2_fp_t){0, COLLISION_FP_SCALE};  // Y axis
+    // Screen X and Y axes
+    if (abs64(dx) * COLLISION_FP_SCALE >
+        obb->half_w * abs_c + obb->half_h * abs_s + (int64_t)aabb->half_w * COLLISION_FP_SCALE) {
+        return false;
+    }
+    if (abs64(dy) * COLLISION_FP_SCALE >
+        obb->half_w * abs_s + obb->half_h * abs_c + (int64_t)aabb->half_h * COLLISION_FP_SCALE) {
+        return false;
+    }
 
-    // OBB axes (rotated)
-    int16_t sin_a = get_sin(obb->angle);
-    int16_t cos_a = get_cos(obb->angle);
-    axes[2] = (vec2_fp_t){cos_a, sin_a};   // Rotated X axis
-    axes[3] = (vec2_fp_t){-sin_a, cos_a};  // Rotated Y axis
+    // OBB axes
+    int64_t t_u = (int64_t)dx * a.cos_a + (int64_t)dy * a.sin_a;
+    int64_t t_v = (int64_t)dy * a.cos_a - (int64_t)dx * a.sin_a;
+    if (abs64(t_u) * COLLISION_FP_SCALE >
+        obb->half_w * a.len_sq + (aabb->half_w * abs_c + aabb->half_h * abs_s) * COLLISION_FP_SCALE) {
+        return false;
+    }
+    if (abs64(t_v) * COLLISION_FP_SCALE >
+        obb->half_h * a.len_sq + (aabb->half_w * abs_s + aabb->half_h * abs_c) * COLLISION_FP_SCALE) {
+        return false;
+    }
+    return true;
+}
 
-    // Test each axis for separation
-    for (int i = 0; i < 4; i++) {
-        int32_t obb_min, obb_max;
-        int32_t aabb_min, aabb_max;
+// Two OBBs in the terms all four separating axes need
+typedef struct {
+    const obb_t* a;
+    const obb_t* b;
+    int32_t dx, dy;
+    obb_axes_t axa, axb;
+    int64_t r_uu, r_uv;  // |cos| and |sin| of the angle between a and b
+} obb_pair_t;
+
+static inline obb_pair_t obb_pair(const obb_t* a, const obb_t* b) {
+    obb_pair_t p = { a, b, b->cx - a->cx, b->cy - a->cy, obb_axes(a), obb_axes(b), 0, 0 };
+
+    // Cross terms between the axes of a and b (the other two are the
+    // same up to sign)
+    p.r_uu = abs64((int64_t)p.axa.cos_a * p.axb.cos_a + (int64_t)p.axa.sin_a * p.axb.sin_a);
+    p.r_uv = abs64((int64_t)p.axa.sin_a * p.axb.cos_a - (int64_t)p.axa.cos_a * p.axb.sin_a);
+    return p;
+}
 
-        project_vertices(obb_verts, &axes[i], &obb_min, &obb_max);
-        project_vertices(aabb_verts, &axes[i], &aabb_min, &aabb_max);
+/*
+ * Projected center distance minus projected half extents on axis k
+ * (0, 1: axes of a; 2, 3: axes of b), scaled by COLLISION_FP_SCALE times
+ * the axis length. Positive if the boxes are apart on that axis.
+ */
+static inline int64_t axis_separation(const obb_pair_t* p, int k) {
+    const obb_t* a = p->a;
+    const obb_t* b = p->b;
+    int64_t t;
+    int64_t r;
+
+    switch (k) {
+        case 0:
+            t = (int64_t)p->dx * p->axa.cos_a + (int64_t)p->dy * p->axa.sin_a;
+            r = a->half_w * p->axa.len_sq + b->half_w * p->r_uu + b->half_h * p->r_uv;
+            break;
+        case 1:
+            t = (int64_t)p->dy * p->axa.cos_a - (int64_t)p->dx * p->axa.sin_a;
+            r = a->half_h * p->axa.len_sq + b->half_w * p->r_uv + b->half_h * p->r_uu;
+            break;
+        case 2:
+            t = (int64_t)p->dx * p->axb.cos_a + (int64_t)p->dy * p->axb.sin_a;
+            r = b->half_w * p->axb.len_sq + a->half_w * p->r_uu + a->half_h * p->r_uv;
+            break;
+        default:
+            t = (int64_t)p->dy * p->axb.cos_a - (int64_t)p->dx * p->axb.sin_a;
+            r = b->half_h * p->axb.len_sq + a->half_w * p->r_uv + a->half_h * p->r_uu;
+            break;
+    }
+    return abs64(t) * COLLISION_FP_SCALE - r;
+}
+
+bool check_collision_obb_obb(const obb_t* a, const obb_t* b) {
+    obb_pair_t p = obb_pair(a, b);
+    if (circles_apart(p.dx, p.dy, obb_radius_sq(a, &p.axa), obb_radius_sq(b, &p.axb))) {
+        return false;
+    }
 
-        // If separation found -> no collision
-        if (!ranges_overlap(obb_min, obb_max, aabb_min, aabb_max)) {
+    return axis_separation(&p, 0) <= 0 && axis_separation(&p, 1) <= 0 &&
+           axis_separation(&p, 2) <= 0 && axis_separation(&p, 3) <= 0;
+}
+
+/*
+ * Axis lengths are at most 1025 in table units, so dividing by
+ * COLLISION_FP_SCALE * 1025 never overstates the gap.
+ */
+#define GAP_DIVISOR ((int64_t)COLLISION_FP_SCALE * 1025)
+
+bool check_collision_obb_obb_gap(const obb_t* a, const obb_t* b,
+                                 uint8_t* axis, int32_t* gap) {
+    obb_pair_t p = obb_pair(a, b);
+
+    for (int i = 0; i < COLLISION_OBB_AXES; i++) {
+        int k = (*axis + i) % COLLISION_OBB_AXES;
+        int64_t sep = axis_separation(&p, k);
+        if (sep > 0) {
+            int64_t g = sep * COLLISION_GAP_SCALE / GAP_DIVISOR;
+            *axis = (uint8_t)k;
+            *gap = (g > INT32_MAX) ? INT32_MAX : (int32_t)g;
             return false;
         }
     }
-
-    // All axes overlap -> collision
+    *gap = 0;
     return true;
 }
 
@@ -3,7 +3,10 @@
  * @brief OBB/AABB collision detection system
  *
  * Provides oriented bounding box (OBB) collision detection using
- * the Separating Axis Theorem (SAT) algorithm.
+ * the Separating Axis Theorem (SAT) algorithm in its projected-radius
+ * form: box half extents are projected onto each axis directly, so no
+ * vertices are generated, and a bounding circle test rejects far pairs
+ * first.
  */
 
 #ifndef COLLISION_H
@@ -48,6 +51,15 @@ typedef struct {
  */
 void obb_get_vertices(const obb_t* obb, vec2_fp_t vertices[4]);
 
+/**
+ * @brief Pixel range covered by an OBB's vertices (inclusive)
+ *
+ * Conservative for check_collision_obb_aabb(): an AABB outside this range
+ * never collides with the OBB.
+ */
+void obb_get_extent(const obb_t* obb, int16_t* min_x, int16_t* min_y,
+                    int16_t* max_x, int16_t* max_y);
+
 /**
  * @brief Check collision between OBB and AABB using SAT algorithm
  * @param obb Rotated bounding box (player)
@@ -56,6 +68,147 @@ void obb_get_vertices(const obb_t* obb, vec2_fp_t vertices[4]);
  */
 bool check_collision_obb_aabb(const obb_t* obb, const aabb_t* aabb);
 
+/**
+ * @brief Check collision between two OBBs using SAT algorithm
+ * @param a, b Rotated bounding boxes
+ * @return true if collision detected (touching counts)
+ */
+bool check_collision_obb_obb(const obb_t* a, const obb_t* b);
+
+// Separating axes of two OBBs (two of each box)
+#define COLLISION_OBB_AXES 4
+
+// Separation gaps are in 1/16 pixel
+#define COLLISION_GAP_SHIFT 4
+#define COLLISION_GAP_SCALE (1 << COLLISION_GAP_SHIFT)
+
+/**
+ * @brief check_collision_obb_obb() that also reports how far apart the boxes are
+ *
+ * Axis *axis is tried first, so passing back the last separating axis of
+ * a pair that barely moved usually finds the separation in one step.
+ * @param axis In: axis to try first (0-3). Out: separating axis found
+ * @param gap Out: distance between the boxes along that axis in
+ *            COLLISION_GAP_SCALE units, rounded down (0 on collision).
+ *            The boxes stay apart while neither moves further than this.
+ * @return true if collision detected
+ */
+bool check_collision_obb_obb_gap(const obb_t* a, const obb_t* b,
+                                 uint8_t* axis, int32_t* gap);
+
+/**
+ * @brief Boxes in structure-of-arrays form for batch tests
+ *
+ * Arrays are owned by the caller and hold at least count entries.
+ * cos_a and sin_a are the sine table values for angle, filled in by
+ * collision_soa_set(), so each batch only loads and converts.
+ */
+typedef struct {
+    int16_t* cx;
+    int16_t* cy;
+    int16_t* half_w;
+    int16_t* half_h;
+    int16_t* angle;
+    int16_t* cos_a;
+    int16_t* sin_a;
+    int count;
+} collision_soa_t;
+
+// Boxes per batch call (one bit each in the result mask)
+#define COLLISION_BATCH_MAX 32
+
+// Boxes screened per SIMD step; ranges padded to a multiple of this have
+// no scalar tail
+#define COLLISION_BATCH_LANES 4
+
+/**
+ * @brief Store box i of a SoA
+ */
+void collision_soa_set(collision_soa_t* soa, int i, const obb_t* box);
+
+/**
+ * @brief Read box i of a SoA back as an OBB
+ */
+obb_t collision_soa_get(const collision_soa_t* soa, int i);
+
+/**
+ * @brief Check one OBB against up to COLLISION_BATCH_MAX boxes of a SoA
+ *
+ * Boxes are screened several at a time with NEON or SSE2 in float, with a
+ * margin so no collision is missed, and screened-in boxes are confirmed
+ * with check_collision_obb_obb(). Results match that function exactly.
+ * @param first, count Boxes first .. first + count - 1 (count <= 32)
+ * @return Bit k set if box first + k collides
+ */
+uint32_t check_collision_obb_batch(const obb_t* obb, const collision_soa_t* soa,
+                                   int first, int count);
+
+/**
+ * @brief check_collision_obb_batch() without SIMD screening (reference)
+ */
+uint32_t check_collision_obb_batch_scalar(const obb_t* obb, const collision_soa_t* soa,
+                                          int first, int count);
+
+/**
+ * @brief check_collision_obb_batch() for a coherence cache
+ *
+ * Only boxes with their bit set in due are tested. For each of them that
+ * does not collide, gaps[k] receives a lower bound of its separation as
+ * in check_collision_obb_obb_gap(). axes[k] is the axis hint of box
+ * first + k for boxes that need the exact test.
+ * @param due Boxes to test (bit k = box first + k)
+ * @return Bit k set if box first + k is due and collides
+ */
+uint32_t check_collision_obb_batch_gaps(const obb_t* obb, const collision_soa_t* soa,
+                                        int first, int count, uint32_t due,
+                                        int32_t gaps[], uint8_t axes[]);
+
+/**
+ * @brief First box of a SoA range that collides with an OBB
+ * @return Box index, or -1 if none does
+ */
+int check_collision_obb_first(const obb_t* obb, const collision_soa_t* soa,
+                              int first, int count);
+
+/**
+ * @brief How an OBB moved since the previous collision_motion_update()
+ */
+typedef enum {
+    COLLISION_MOTION_STILL,   // Same pose
+    COLLISION_MOTION_MOVED,   // travel grew by the distance moved
+    COLLISION_MOTION_RESET    // First pose, new size or travel wrapped: drop cached gaps
+} collision_motion_result_t;
+
+/**
+ * @brief Temporal coherence: distance an OBB has moved over many queries
+ *
+ * travel adds up a bound on how far any point of the box moved between
+ * updates (COLLISION_GAP_SCALE units). A pair found apart by gap when
+ * travel was T stays apart while travel < T + gap, so it needs no test;
+ * see collision_clear_until().
+ */
+typedef struct {
+    obb_t pose;
+    int32_t travel;
+    int32_t step;     // travel added by the last update
+    bool valid;
+} collision_motion_t;
+
+/**
+ * @brief Forget the last pose (the next update returns COLLISION_MOTION_RESET)
+ */
+void collision_motion_reset(collision_motion_t* motion);
+
+/**
+ * @brief Record the pose for the next query
+ */
+collision_motion_result_t collision_motion_update(collision_motion_t* motion, const obb_t* obb);
+
+/**
+ * @brief travel value until which a pair found gap apart now stays apart
+ */
+int32_t collision_clear_until(const collision_motion_t* motion, int32_t gap);
+
 /**
  * @brief Check AABB collision between two rectangles (center-based)
  * @param x1, y1 Center of first rectangle
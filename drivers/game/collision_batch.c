@@ -0,0 +1,269 @@
+/**
+ * @file collision_batch.c
+ * @brief One OBB against many boxes in SoA form (NEON / SSE2 / scalar)
+ *
+ * The vector pass evaluates the projected-radius SAT of collision.c for
+ * four boxes at a time in float. Float rounding is far below
+ * BATCH_SCREEN_MARGIN, so a box it separates is separated exactly; the
+ * remaining boxes are confirmed with the exact fixed-point test.
+ */
+
+#include "collision.h"
+#include "sin_table.h"
+
+#if !defined(FB_SIMD_SCALAR) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define COLLISION_SIMD_NEON
+#include <arm_neon.h>
+#elif !defined(FB_SIMD_SCALAR) && defined(__SSE2__)
+#define COLLISION_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+// Pixels a box must be separated by in float before it is skipped
+#define BATCH_SCREEN_MARGIN (1.0f / 64.0f)
+
+// Float separation to gap units; the factor covers sine table axes up to
+// 1025/1024 long (about 0.1% over 1.0, the bound GAP_DIVISOR uses), as
+// 0.999 < 1024/1025
+#define BATCH_GAP_SCALE (COLLISION_GAP_SCALE * 0.999f)
+
+void collision_soa_set(collision_soa_t* soa, int i, const obb_t* box) {
+    soa->cx[i] = box->cx;
+    soa->cy[i] = box->cy;
+    soa->half_w[i] = box->half_w;
+    soa->half_h[i] = box->half_h;
+    soa->angle[i] = box->angle;
+    soa->cos_a[i] = get_cos(box->angle);
+    soa->sin_a[i] = get_sin(box->angle);
+}
+
+obb_t collision_soa_get(const collision_soa_t* soa, int i) {
+    obb_t box = { soa->cx[i], soa->cy[i], soa->half_w[i], soa->half_h[i], soa->angle[i] };
+    return box;
+}
+
+// Exact test of the boxes whose bit is set in candidates
+static uint32_t confirm(const obb_t* obb, const collision_soa_t* soa, int first,
+                        uint32_t candidates) {
+    uint32_t hits = 0;
+    while (candidates) {
+        int k = __builtin_ctz(candidates);
+        candidates &= candidates - 1;
+        obb_t box = collision_soa_get(soa, first + k);
+        if (check_collision_obb_obb(obb, &box)) {
+            hits |= 1u << k;
+        }
+    }
+    return hits;
+}
+
+uint32_t check_collision_obb_batch_scalar(const obb_t* obb, const collision_soa_t* soa,
+                                          int first, int count) {
+    if (count > COLLISION_BATCH_MAX) count = COLLISION_BATCH_MAX;
+    uint32_t all = (count >= COLLISION_BATCH_MAX) ? 0xFFFFFFFFu : ((1u << count) - 1);
+    return confirm(obb, soa, first, all);
+}
+
+#if defined(COLLISION_SIMD_NEON) || defined(COLLISION_SIMD_SSE2)
+// Per-query constants of the OBB (sine table values scaled to 1.0)
+typedef struct {
+    float cx, cy;
+    float cos_a, sin_a;
+    float half_w, half_h;
+    float w_len, h_len;  // Half extents times the squared axis length
+} batch_query_t;
+
+static batch_query_t batch_query(const obb_t* obb) {
+    batch_query_t q;
+    q.cx = obb->cx;
+    q.cy = obb->cy;
+    q.cos_a = get_cos(obb->angle) / (float)FP_SCALE;
+    q.sin_a = get_sin(obb->angle) / (float)FP_SCALE;
+    q.half_w = obb->half_w;
+    q.half_h = obb->half_h;
+    float len_sq = q.cos_a * q.cos_a + q.sin_a * q.sin_a;
+    q.w_len = q.half_w * len_sq + BATCH_SCREEN_MARGIN;
+    q.h_len = q.half_h * len_sq + BATCH_SCREEN_MARGIN;
+    return q;
+}
+#endif
+
+#if defined(COLLISION_SIMD_NEON)
+static inline float32x4_t load_f32(const int16_t* p) {
+    return vcvtq_f32_s32(vmovl_s16(vld1_s16(p)));
+}
+
+static inline uint32_t lane_mask(uint32x4_t m) {
+    static const uint32_t bits[COLLISION_BATCH_LANES] = { 1, 2, 4, 8 };
+    uint32x4_t b = vandq_u32(m, vld1q_u32(bits));
+    uint32x2_t s = vadd_u32(vget_low_u32(b), vget_high_u32(b));
+    return vget_lane_u32(vpadd_u32(s, s), 0);
+}
+
+// Bits of the 4 boxes at i that are not separated on any axis, and the
+// separation of each (margin included, not scaled by axis length)
+static uint32_t screen4(const batch_query_t* q, const collision_soa_t* soa, int i,
+                        float gaps[COLLISION_BATCH_LANES]) {
+    const float32x4_t scale = vdupq_n_f32(1.0f / FP_SCALE);
+    float32x4_t ca = vdupq_n_f32(q->cos_a);
+    float32x4_t sa = vdupq_n_f32(q->sin_a);
+    float32x4_t aw = vdupq_n_f32(q->half_w);
+    float32x4_t ah = vdupq_n_f32(q->half_h);
+
+    float32x4_t dx = vsubq_f32(load_f32(&soa->cx[i]), vdupq_n_f32(q->cx));
+    float32x4_t dy = vsubq_f32(load_f32(&soa->cy[i]), vdupq_n_f32(q->cy));
+    float32x4_t bw = load_f32(&soa->half_w[i]);
+    float32x4_t bh = load_f32(&soa->half_h[i]);
+    float32x4_t cb = vmulq_f32(load_f32(&soa->cos_a[i]), scale);
+    float32x4_t sb = vmulq_f32(load_f32(&soa->sin_a[i]), scale);
+
+    float32x4_t r_uu = vabsq_f32(vmlaq_f32(vmulq_f32(ca, cb), sa, sb));
+    float32x4_t r_uv = vabsq_f32(vmlsq_f32(vmulq_f32(sa, cb), ca, sb));
+    float32x4_t margin = vdupq_n_f32(BATCH_SCREEN_MARGIN);
+    float32x4_t lb = vmlaq_f32(vmulq_f32(cb, cb), sb, sb);
+
+    // Axes of the OBB, then of the boxes; the largest separation counts
+    float32x4_t t = vabsq_f32(vmlaq_f32(vmulq_f32(dx, ca), dy, sa));
+    float32x4_t r = vmlaq_f32(vmlaq_f32(vdupq_n_f32(q->w_len), bw, r_uu), bh, r_uv);
+    float32x4_t sep = vsubq_f32(t, r);
+    t = vabsq_f32(vmlsq_f32(vmulq_f32(dy, ca), dx, sa));
+    r = vmlaq_f32(vmlaq_f32(vdupq_n_f32(q->h_len), bw, r_uv), bh, r_uu);
+    sep = vmaxq_f32(sep, vsubq_f32(t, r));
+    t = vabsq_f32(vmlaq_f32(vmulq_f32(dx, cb), dy, sb));
+    r = vmlaq_f32(vmlaq_f32(vmlaq_f32(margin, bw, lb), aw, r_uu), ah, r_uv);
+    sep = vmaxq_f32(sep, vsubq_f32(t, r));
+    t = vabsq_f32(vmlsq_f32(vmulq_f32(dy, cb), dx, sb));
+    r = vmlaq_f32(vmlaq_f32(vmlaq_f32(margin, bh, lb), aw, r_uv), ah, r_uu);
+    sep = vmaxq_f32(sep, vsubq_f32(t, r));
+
+    vst1q_f32(gaps, sep);
+    return lane_mask(vcleq_f32(sep, vdupq_n_f32(0.0f)));
+}
+#elif defined(COLLISION_SIMD_SSE2)
+static inline __m128 load_f32(const int16_t* p) {
+    __m128i v = _mm_loadl_epi64((const __m128i*)(const void*)p);
+    return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+}
+
+static inline __m128 abs_f32(__m128 v) {
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+}
+
+static inline __m128 mul_add(__m128 acc, __m128 a, __m128 b) {
+    return _mm_add_ps(acc, _mm_mul_ps(a, b));
+}
+
+// Bits of the 4 boxes at i that are not separated on any axis, and the
+// separation of each (margin included, not scaled by axis length)
+static uint32_t screen4(const batch_query_t* q, const collision_soa_t* soa, int i,
+                        float gaps[COLLISION_BATCH_LANES]) {
+    const __m128 scale = _mm_set1_ps(1.0f / FP_SCALE);
+    __m128 ca = _mm_set1_ps(q->cos_a);
+    __m128 sa = _mm_set1_ps(q->sin_a);
+    __m128 aw = _mm_set1_ps(q->half_w);
+    __m128 ah = _mm_set1_ps(q->half_h);
+
+    __m128 dx = _mm_sub_ps(load_f32(&soa->cx[i]), _mm_set1_ps(q->cx));
+    __m128 dy = _mm_sub_ps(load_f32(&soa->cy[i]), _mm_set1_ps(q->cy));
+    __m128 bw = load_f32(&soa->half_w[i]);
+    __m128 bh = load_f32(&soa->half_h[i]);
+    __m128 cb = _mm_mul_ps(load_f32(&soa->cos_a[i]), scale);
+    __m128 sb = _mm_mul_ps(load_f32(&soa->sin_a[i]), scale);
+
+    __m128 r_uu = abs_f32(mul_add(_mm_mul_ps(ca, cb), sa, sb));
+    __m128 r_uv = abs_f32(_mm_sub_ps(_mm_mul_ps(sa, cb), _mm_mul_ps(ca, sb)));
+    __m128 margin = _mm_set1_ps(BATCH_SCREEN_MARGIN);
+    __m128 lb = mul_add(_mm_mul_ps(cb, cb), sb, sb);
+
+    // Axes of the OBB, then of the boxes; the largest separation counts
+    __m128 t = abs_f32(mul_add(_mm_mul_ps(dx, ca), dy, sa));
+    __m128 r = mul_add(mul_add(_mm_set1_ps(q->w_len), bw, r_uu), bh, r_uv);
+    __m128 sep = _mm_sub_ps(t, r);
+    t = abs_f32(_mm_sub_ps(_mm_mul_ps(dy, ca), _mm_mul_ps(dx, sa)));
+    r = mul_add(mul_add(_mm_set1_ps(q->h_len), bw, r_uv), bh, r_uu);
+    sep = _mm_max_ps(sep, _mm_sub_ps(t, r));
+    t = abs_f32(mul_add(_mm_mul_ps(dx, cb), dy, sb));
+    r = mul_add(mul_add(mul_add(margin, bw, lb), aw, r_uu), ah, r_uv);
+    sep = _mm_max_ps(sep, _mm_sub_ps(t, r));
+    t = abs_f32(_mm_sub_ps(_mm_mul_ps(dy, cb), _mm_mul_ps(dx, sb)));
+    r = mul_add(mul_add(mul_add(margin, bh, lb), aw, r_uv), ah, r_uu);
+    sep = _mm_max_ps(sep, _mm_sub_ps(t, r));
+
+    _mm_storeu_ps(gaps, sep);
+    return (uint32_t)_mm_movemask_ps(_mm_cmple_ps(sep, _mm_setzero_ps()));
+}
+#endif
+
+static uint32_t lane_bits(int count) {
+    return (count >= COLLISION_BATCH_MAX) ? 0xFFFFFFFFu : ((1u << count) - 1);
+}
+
+// Boxes in want the vector pass cannot rule out (all of them without
+// SIMD), and the float separation of the others. Groups of lanes with no
+// bit in want are skipped.
+static uint32_t screen(const obb_t* obb, const collision_soa_t* soa, int first, int count,
+                       uint32_t want, float gaps[COLLISION_BATCH_MAX]) {
+    uint32_t candidates = 0;
+    int k = 0;
+#if defined(COLLISION_SIMD_NEON) || defined(COLLISION_SIMD_SSE2)
+    batch_query_t q = batch_query(obb);
+    for (; k + COLLISION_BATCH_LANES <= count; k += COLLISION_BATCH_LANES) {
+        if ((want >> k) & lane_bits(COLLISION_BATCH_LANES)) {
+            candidates |= screen4(&q, soa, first + k, &gaps[k]) << k;
+        }
+    }
+#else
+    (void)obb;
+    (void)soa;
+    (void)first;
+    (void)gaps;
+#endif
+    // Tail goes straight to the exact test
+    return (candidates | (lane_bits(count) & ~lane_bits(k))) & want;
+}
+
+uint32_t check_collision_obb_batch(const obb_t* obb, const collision_soa_t* soa,
+                                   int first, int count) {
+    float gaps[COLLISION_BATCH_MAX];
+    if (count > COLLISION_BATCH_MAX) count = COLLISION_BATCH_MAX;
+    return confirm(obb, soa, first, screen(obb, soa, first, count, lane_bits(count), gaps));
+}
+
+uint32_t check_collision_obb_batch_gaps(const obb_t* obb, const collision_soa_t* soa,
+                                        int first, int count, uint32_t due,
+                                        int32_t gaps[], uint8_t axes[]) {
+    float screened[COLLISION_BATCH_MAX];
+    if (count > COLLISION_BATCH_MAX) count = COLLISION_BATCH_MAX;
+    due &= lane_bits(count);
+
+    uint32_t candidates = screen(obb, soa, first, count, due, screened);
+    uint32_t apart = due & ~candidates;
+    while (apart) {
+        int k = __builtin_ctz(apart);
+        apart &= apart - 1;
+        gaps[k] = (int32_t)(screened[k] * BATCH_GAP_SCALE);
+    }
+
+    uint32_t hits = 0;
+    while (candidates) {
+        int k = __builtin_ctz(candidates);
+        candidates &= candidates - 1;
+        obb_t box = collision_soa_get(soa, first + k);
+        if (check_collision_obb_obb_gap(obb, &box, &axes[k], &gaps[k])) {
+            hits |= 1u << k;
+        }
+    }
+    return hits;
+}
+
+int check_collision_obb_first(const obb_t* obb, const collision_soa_t* soa,
+                              int first, int count) {
+    for (int i = first; i < first + count; i += COLLISION_BATCH_MAX) {
+        int n = first + count - i;
+        uint32_t hits = check_collision_obb_batch(obb, soa, i, n);
+        if (hits) {
+            return i + __builtin_ctz(hits);
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file collision_coherence.c
+ * @brief Motion bounds for skipping pairs known to be apart
+ */
+
+#include "collision.h"
+#include "sin_table.h"
+
+// travel is restarted before it can overflow clear_until values
+#define MOTION_TRAVEL_LIMIT (INT32_MAX / 2)
+
+static int32_t abs32(int32_t v) {
+    return (v < 0) ? -v : v;
+}
+
+/*
+ * A box point at local (x, y) sits at center + x*U + y*V, U and V from
+ * the sine table. Between two poses it moves by at most
+ * |d center| + (|x| + |y|) * |d U|, bounded here with L1 norms.
+ */
+static int32_t motion_bound(const obb_t* from, const obb_t* to) {
+    int32_t shift = abs32(to->cx - from->cx) + abs32(to->cy - from->cy);
+    int32_t turn = abs32(get_cos(to->angle) - get_cos(from->angle)) +
+                   abs32(get_sin(to->angle) - get_sin(from->angle));
+    int32_t extent = (int32_t)from->half_w + from->half_h;
+
+    return shift * COLLISION_GAP_SCALE +
+           (extent * turn * COLLISION_GAP_SCALE + FP_SCALE - 1) / FP_SCALE;
+}
+
+void collision_motion_reset(collision_motion_t* motion) {
+    motion->valid = false;
+    motion->travel = 0;
+    motion->step = 0;
+}
+
+collision_motion_result_t collision_motion_update(collision_motion_t* motion, const obb_t* obb) {
+    const obb_t* last = &motion->pose;
+    bool reshaped = !motion->valid ||
+                    last->half_w != obb->half_w || last->half_h != obb->half_h;
+    if (reshaped || motion->travel > MOTION_TRAVEL_LIMIT) {
+        motion->pose = *obb;
+        motion->travel = 0;
+        motion->step = 0;
+        motion->valid = true;
+        return COLLISION_MOTION_RESET;
+    }
+
+    int32_t moved = motion_bound(last, obb);
+    motion->pose = *obb;
+    motion->step = moved;
+    if (moved == 0) {
+        return COLLISION_MOTION_STILL;
+    }
+    motion->travel += moved;
+    return COLLISION_MOTION_MOVED;
+}
+
+int32_t collision_clear_until(const collision_motion_t* motion, int32_t gap) {
+    int64_t until = (int64_t)motion->travel + gap;
+    return (until > INT32_MAX) ? INT32_MAX : (int32_t)until;
+}
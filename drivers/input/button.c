@@ -1,4 +1,5 @@
 #include "button.h"
+#include "debounce.h"
 #include "../common/gpio_init.h"
 #include <bcm2835.h>
 
@@ -18,22 +19,12 @@ uint8_t button_read_raw(button_id_t btn) {
     return (level == LOW) ? BUTTON_PRESSED : BUTTON_RELEASED;
 }
 
-uint8_t button_read(button_id_t btn) {
-    if (btn >= BTN_COUNT) {
-        return BUTTON_RELEASED;
-    }
-
-    // Read initial state
-    uint8_t state1 = button_read_raw(btn);
-
-    // Wait for debounce delay
-    bcm2835_delay(DEBOUNCE_DELAY_MS);
-
-    // Read again and compare
-    uint8_t state2 = button_read_raw(btn);
+static uint8_t button_key(button_id_t btn) {
+    return (btn == BTN_A) ? INPUT_KEY_A : (btn == BTN_B) ? INPUT_KEY_B : 0;
+}
 
-    // Return stable state
-    return (state1 == state2) ? state1 : BUTTON_RELEASED;
+uint8_t button_read(button_id_t btn) {
+    return (input_debounced()->state & button_key(btn)) ? BUTTON_PRESSED : BUTTON_RELEASED;
 }
 
 uint8_t button_is_pressed(button_id_t btn) {
@@ -45,12 +36,9 @@ void button_wait_release(button_id_t btn) {
         return;
     }
 
-    while (button_read_raw(btn) == BUTTON_PRESSED) {
-        bcm2835_delay(10);
+    while (input_poll()->state & button_key(btn)) {
+        bcm2835_delay(DEBOUNCE_POLL_MS);
     }
-
-    // Additional debounce delay
-    bcm2835_delay(DEBOUNCE_DELAY_MS);
 }
 
 void button_wait_press(button_id_t btn) {
@@ -58,10 +46,7 @@ void button_wait_press(button_id_t btn) {
         return;
     }
 
-    while (button_read_raw(btn) == BUTTON_RELEASED) {
-        bcm2835_delay(10);
+    while (!(input_poll()->state & button_key(btn))) {
+        bcm2835_delay(DEBOUNCE_POLL_MS);
     }
-
-    // Additional debounce delay
-    bcm2835_delay(DEBOUNCE_DELAY_MS);
 }
@@ -6,9 +6,6 @@
 #define BUTTON_RELEASED 0
 #define BUTTON_PRESSED  1
 
-// Debounce delay in milliseconds
-#define DEBOUNCE_DELAY_MS 20
-
 /**
  * Button identifiers
  */
@@ -25,23 +22,23 @@ typedef enum {
 uint8_t button_read_raw(button_id_t btn);
 
 /**
- * Read button state with debouncing
+ * Read debounced button state (as of the last input_poll(), never blocks)
  * Returns: BUTTON_PRESSED or BUTTON_RELEASED
  */
 uint8_t button_read(button_id_t btn);
 
 /**
- * Check if button is currently pressed (with debouncing)
+ * Check if button is currently pressed (debounced, never blocks)
  * Returns: 1 if pressed, 0 if released
  */
 uint8_t button_is_pressed(button_id_t btn);
 
 /**
- * Wait for button to be released (blocking)
+ * Wait for button to be released (blocking, polls input_poll())
  */
 void button_wait_release(button_id_t btn);
 
 /**
- * Wait for button to be pressed (blocking)
+ * Wait for button to be pressed (blocking, polls input_poll())
  */
 void button_wait_press(button_id_t btn);
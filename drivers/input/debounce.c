@@ -0,0 +1,59 @@
+#include "debounce.h"
+#include <string.h>
+
+static debounce_t s_shared = { .samples = DEBOUNCE_SAMPLES };
+
+void debounce_init(debounce_t* d) {
+    debounce_init_samples(d, DEBOUNCE_SAMPLES);
+}
+
+void debounce_init_samples(debounce_t* d, uint8_t samples) {
+    memset(d, 0, sizeof(*d));
+    d->samples = (samples > 0) ? samples : 1;
+}
+
+void debounce_update(debounce_t* d, uint8_t raw) {
+    uint8_t state = d->state;
+
+    for (uint32_t i = 0; i < INPUT_KEY_COUNT; i++) {
+        uint8_t bit = (uint8_t)(1u << i);
+
+        if (raw & bit) {
+            if (d->integrator[i] < d->samples) d->integrator[i]++;
+        } else {
+            if (d->integrator[i] > 0) d->integrator[i]--;
+        }
+
+        if (d->integrator[i] == d->samples) {
+            state |= bit;
+        } else if (d->integrator[i] == 0) {
+            state &= (uint8_t)~bit;
+        }
+
+        if ((state ^ d->state) & bit) {
+            d->held[i] = 0;
+        } else if (d->held[i] < UINT32_MAX) {
+            d->held[i]++;
+        }
+    }
+
+    d->pressed = state & (uint8_t)~d->state;
+    d->released = d->state & (uint8_t)~state;
+    d->state = state;
+}
+
+uint32_t debounce_held(const debounce_t* d, uint8_t key) {
+    if (key == 0) {
+        return 0;
+    }
+    return d->held[__builtin_ctz(key)];
+}
+
+const debounce_t* input_poll(void) {
+    debounce_update(&s_shared, input_snapshot_read());
+    return &s_shared;
+}
+
+const debounce_t* input_debounced(void) {
+    return &s_shared;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "input_snapshot.h"
+
+/**
+ * Integrating debounce for all controls
+ * Each control has a counter that moves one step towards the sampled
+ * level on every update. The debounced state changes only when the
+ * counter reaches an end, so contact bounce shorter than
+ * DEBOUNCE_SAMPLES updates is absorbed without ever waiting.
+ */
+
+// Consecutive samples needed to accept a change (2 at the 10 ms game tick = 20 ms)
+#ifndef DEBOUNCE_SAMPLES
+#define DEBOUNCE_SAMPLES 2
+#endif
+
+// Poll period of the blocking wait helpers (button_wait_*, joystick_wait_any)
+#define DEBOUNCE_POLL_MS 10
+
+#define INPUT_KEY_COUNT 6
+
+typedef struct {
+    uint8_t integrator[INPUT_KEY_COUNT];  // 0 = settled released, samples = settled pressed
+    uint32_t held[INPUT_KEY_COUNT];       // Updates since the debounced state last changed
+    uint8_t state;                        // Debounced INPUT_KEY_* mask
+    uint8_t pressed;                      // Keys that went down in the last update
+    uint8_t released;                     // Keys that went up in the last update
+    uint8_t samples;                      // Consecutive samples needed to accept a change
+} debounce_t;
+
+/**
+ * Reset to all released, accepting changes after DEBOUNCE_SAMPLES samples
+ */
+void debounce_init(debounce_t* d);
+
+/**
+ * Reset to all released with another sample count (for other poll rates)
+ */
+void debounce_init_samples(debounce_t* d, uint8_t samples);
+
+/**
+ * Feed one sample (INPUT_KEY_* mask of raw levels)
+ */
+void debounce_update(debounce_t* d, uint8_t raw);
+
+/**
+ * Updates a key has spent in its current debounced state
+ * Returns: sample count (saturates at UINT32_MAX)
+ */
+uint32_t debounce_held(const debounce_t* d, uint8_t key);
+
+/**
+ * Take one input snapshot and feed it to the shared debouncer
+ * Call once per tick; button_read(), button_is_pressed() and
+ * joystick_is_*() report the shared debouncer's state.
+ * Returns: the shared debouncer
+ */
+const debounce_t* input_poll(void);
+
+/**
+ * Shared debouncer as of the last input_poll()
+ */
+const debounce_t* input_debounced(void);
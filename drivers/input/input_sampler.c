@@ -0,0 +1,239 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "input_sampler.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#include <errno.h>
+#include "input_snapshot.h"
+#include "../common/timing.h"
+
+#define RING_MASK (INPUT_SAMPLER_RING_SIZE - 1)
+
+_Static_assert((INPUT_SAMPLER_RING_SIZE & RING_MASK) == 0, "ring size must be a power of two");
+
+// Ring: head is written by the producer only, tail by the consumer only
+static input_event_t s_ring[INPUT_SAMPLER_RING_SIZE];
+static atomic_uint s_head;
+static atomic_uint s_tail;
+
+// Producer state
+static debounce_t s_debounce;
+static uint8_t s_pushed = 0;         // Debounced state as of the last pushed event
+
+// Consumer state
+static uint8_t s_state = 0;          // Debounced state at s_cursor_us
+static uint64_t s_cursor_us = 0;     // End of the last drain
+
+static atomic_uint s_samples;
+static atomic_uint s_events;
+static atomic_uint s_overruns;
+
+static pthread_t s_thread;
+static bool s_thread_running = false;
+static atomic_bool s_stop_requested;
+static uint32_t s_period_us = INPUT_SAMPLER_PERIOD_US;
+
+static bool ring_push(const input_event_t* ev) {
+    unsigned head = atomic_load_explicit(&s_head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&s_tail, memory_order_acquire);
+    if (head - tail == INPUT_SAMPLER_RING_SIZE) {
+        return false;
+    }
+    s_ring[head & RING_MASK] = *ev;
+    atomic_store_explicit(&s_head, head + 1, memory_order_release);
+    return true;
+}
+
+// Oldest event, left in the ring (NULL if empty)
+static const input_event_t* ring_peek(void) {
+    unsigned tail = atomic_load_explicit(&s_tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&s_head, memory_order_acquire);
+    if (head == tail) {
+        return NULL;
+    }
+    return &s_ring[tail & RING_MASK];
+}
+
+static void ring_drop(void) {
+    unsigned tail = atomic_load_explicit(&s_tail, memory_order_relaxed);
+    atomic_store_explicit(&s_tail, tail + 1, memory_order_release);
+}
+
+void input_tick_from_keys(input_tick_t* tick, uint8_t keys) {
+    tick->keys = keys;
+    for (uint32_t i = 0; i < INPUT_KEY_COUNT; i++) {
+        tick->weight[i] = (keys & (1u << i)) ? INPUT_WEIGHT_FULL : 0;
+    }
+}
+
+uint16_t input_tick_weight(const input_tick_t* tick, uint8_t key) {
+    if (key == 0) {
+        return 0;
+    }
+    return tick->weight[__builtin_ctz(key)];
+}
+
+void input_sampler_reset(uint64_t now_us) {
+    memset(s_ring, 0, sizeof(s_ring));
+    atomic_store(&s_head, 0);
+    atomic_store(&s_tail, 0);
+
+    debounce_init_samples(&s_debounce, INPUT_SAMPLER_DEBOUNCE);
+    s_pushed = 0;
+    s_state = 0;
+    s_cursor_us = now_us;
+
+    atomic_store(&s_samples, 0);
+    atomic_store(&s_events, 0);
+    atomic_store(&s_overruns, 0);
+}
+
+void input_sampler_poll(uint64_t now_us) {
+    debounce_update(&s_debounce, input_snapshot_read());
+    atomic_fetch_add_explicit(&s_samples, 1, memory_order_relaxed);
+
+    if (s_debounce.state == s_pushed) {
+        return;
+    }
+    input_event_t ev = { now_us, s_debounce.state };
+    if (ring_push(&ev)) {
+        s_pushed = ev.keys;
+        atomic_fetch_add_explicit(&s_events, 1, memory_order_relaxed);
+    } else {
+        atomic_fetch_add_explicit(&s_overruns, 1, memory_order_relaxed);
+    }
+}
+
+// Absolute sleep without the final spin of timing_sleep_until_us(), which
+// would keep a core busy at this rate
+static void sleep_until_us(uint64_t deadline_us) {
+    struct timespec ts = {
+        .tv_sec = (time_t)(deadline_us / 1000000ULL),
+        .tv_nsec = (long)(deadline_us % 1000000ULL) * 1000L
+    };
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+    }
+}
+
+static void* sampler_thread_main(void* arg) {
+    (void)arg;
+    uint64_t next = timing_now_us();
+
+    while (!atomic_load(&s_stop_requested)) {
+        uint64_t now = timing_now_us();
+        input_sampler_poll(now);
+
+        // After a stall, resume the schedule from now instead of bursting
+        next += s_period_us;
+        if (next <= now) {
+            next = now + s_period_us;
+        }
+        sleep_until_us(next);
+    }
+    return NULL;
+}
+
+bool input_sampler_start(uint32_t period_us) {
+    if (s_thread_running) {
+        return true;
+    }
+
+    input_sampler_reset(timing_now_us());
+    s_period_us = (period_us > 0) ? period_us : INPUT_SAMPLER_PERIOD_US;
+    atomic_store(&s_stop_requested, false);
+
+    // Keep SIGINT/SIGTERM on the main thread so the game loop sees them
+    sigset_t block, previous;
+    sigemptyset(&block);
+    sigaddset(&block, SIGINT);
+    sigaddset(&block, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &block, &previous);
+    s_thread_running = (pthread_create(&s_thread, NULL, sampler_thread_main, NULL) == 0);
+    pthread_sigmask(SIG_SETMASK, &previous, NULL);
+
+    if (!s_thread_running) {
+        printf("Input sampler thread start failed\n");
+    }
+    return s_thread_running;
+}
+
+void input_sampler_stop(void) {
+    if (s_thread_running) {
+        atomic_store(&s_stop_requested, true);
+        pthread_join(s_thread, NULL);
+        s_thread_running = false;
+    }
+}
+
+bool input_sampler_running(void) {
+    return s_thread_running;
+}
+
+void input_sampler_skip(uint64_t until_us) {
+    const input_event_t* ev;
+    while ((ev = ring_peek()) != NULL && ev->t_us < until_us) {
+        s_state = ev->keys;
+        ring_drop();
+    }
+    if (until_us > s_cursor_us) {
+        s_cursor_us = until_us;
+    }
+}
+
+static void add_held(uint64_t* held_us, uint8_t keys, uint64_t duration_us) {
+    for (uint32_t i = 0; i < INPUT_KEY_COUNT; i++) {
+        if (keys & (1u << i)) {
+            held_us[i] += duration_us;
+        }
+    }
+}
+
+void input_sampler_collect(uint64_t until_us, input_tick_t* tick) {
+    uint64_t held_us[INPUT_KEY_COUNT] = {0};
+    uint64_t start_us = s_cursor_us;
+    if (until_us < start_us) {
+        until_us = start_us;
+    }
+    uint8_t keys = s_state;
+
+    // Changes stamped before the previous drain (the sampler ran late)
+    // count from the start of this tick
+    const input_event_t* ev;
+    while ((ev = ring_peek()) != NULL && ev->t_us < until_us) {
+        uint64_t t = (ev->t_us > s_cursor_us) ? ev->t_us : s_cursor_us;
+        add_held(held_us, s_state, t - s_cursor_us);
+        s_state = ev->keys;
+        s_cursor_us = t;
+        keys |= s_state;
+        ring_drop();
+    }
+    add_held(held_us, s_state, until_us - s_cursor_us);
+    s_cursor_us = until_us;
+
+    uint64_t span_us = until_us - start_us;
+    tick->keys = keys;
+    for (uint32_t i = 0; i < INPUT_KEY_COUNT; i++) {
+        uint16_t weight = 0;
+        if (keys & (1u << i)) {
+            weight = (span_us > 0) ?
+                     (uint16_t)(held_us[i] * INPUT_WEIGHT_FULL / span_us) : INPUT_WEIGHT_FULL;
+            if (weight == 0) {
+                weight = 1;  // Down for less than 1/256 of the tick still counts
+            }
+        }
+        tick->weight[i] = weight;
+    }
+}
+
+input_sampler_stats_t input_sampler_get_stats(void) {
+    input_sampler_stats_t stats = {
+        .samples = atomic_load_explicit(&s_samples, memory_order_relaxed),
+        .events = atomic_load_explicit(&s_events, memory_order_relaxed),
+        .overruns = atomic_load_explicit(&s_overruns, memory_order_relaxed)
+    };
+    return stats;
+}
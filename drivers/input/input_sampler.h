@@ -0,0 +1,100 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "debounce.h"
+
+/**
+ * Background input sampler
+ * A thread takes an input snapshot about every millisecond, debounces it
+ * and pushes each change of the debounced state, with its timestamp, into
+ * a lock-free single-producer/single-consumer ring. The game drains the
+ * ring once per physics tick and learns how long each key was held within
+ * the tick, so a tap between two ticks is not lost and counts for its
+ * real duration.
+ *
+ * The producer side (input_sampler_poll) can also be called directly with
+ * any timestamps, which is how the host checks drive it from simulated
+ * pin levels. The thread itself uses the monotonic clock and must not be
+ * combined with a virtual timing source.
+ */
+
+// Sample period of the thread (1 kHz)
+#define INPUT_SAMPLER_PERIOD_US 1000
+
+// Debounce samples at the sampler rate (5 at 1 kHz = 5 ms)
+#define INPUT_SAMPLER_DEBOUNCE 5
+
+// Events held between two drains (power of two)
+#define INPUT_SAMPLER_RING_SIZE 64
+
+// Weight of a key held for a whole tick
+#define INPUT_WEIGHT_FULL 256
+
+// Debounced state change
+typedef struct {
+    uint64_t t_us;    // Time of the sample that completed the change
+    uint8_t keys;     // Debounced INPUT_KEY_* mask from then on
+} input_event_t;
+
+// Input of one physics tick
+typedef struct {
+    uint8_t keys;                        // Keys held at any time during the tick
+    uint16_t weight[INPUT_KEY_COUNT];    // Held part of the tick, 1..INPUT_WEIGHT_FULL (0 = not held)
+} input_tick_t;
+
+typedef struct {
+    uint32_t samples;
+    uint32_t events;
+    uint32_t overruns;   // Changes that had to wait for room in the ring
+} input_sampler_stats_t;
+
+/**
+ * Tick input with every key in `keys` held for the whole tick
+ */
+void input_tick_from_keys(input_tick_t* tick, uint8_t keys);
+
+/**
+ * Weight of one INPUT_KEY_* bit in a tick
+ */
+uint16_t input_tick_weight(const input_tick_t* tick, uint8_t key);
+
+/**
+ * Empty the ring and restart debouncing, all keys released at now_us
+ * Only while the thread is not running.
+ */
+void input_sampler_reset(uint64_t now_us);
+
+/**
+ * Producer: take one snapshot and push the change it completes, if any
+ * A change that finds the ring full is pushed by a later sample, so the
+ * consumer may see a change late but always ends on the real state.
+ */
+void input_sampler_poll(uint64_t now_us);
+
+/**
+ * Reset and start the sampling thread
+ * Returns: false if the thread could not be created
+ */
+bool input_sampler_start(uint32_t period_us);
+
+/**
+ * Stop the sampling thread (no-op if it is not running)
+ */
+void input_sampler_stop(void);
+
+bool input_sampler_running(void);
+
+/**
+ * Consumer: apply the changes before until_us without measuring them
+ * (start of a session, after input was handled some other way)
+ */
+void input_sampler_skip(uint64_t until_us);
+
+/**
+ * Consumer: input from the end of the previous drain up to until_us
+ * Changes stamped at or after until_us stay in the ring for the next tick.
+ */
+void input_sampler_collect(uint64_t until_us, input_tick_t* tick);
+
+input_sampler_stats_t input_sampler_get_stats(void);
@@ -0,0 +1,39 @@
+#include "input_snapshot.h"
+#include "../common/gpio_init.h"
+#include <bcm2835.h>
+
+// All input pins live in bank 0 (GPIO 0-31)
+_Static_assert(BUTTON_A < 32 && BUTTON_B < 32 && JOY_UP < 32 && JOY_DOWN < 32 &&
+               JOY_LEFT < 32 && JOY_RIGHT < 32, "input pins must be in GPLEV0");
+
+// Move pin `pin` of the inverted level word to snapshot bit `bit`
+#define PIN_TO_KEY(pressed, pin, bit) ((((pressed) >> (pin)) & 1u) << (bit))
+
+uint8_t input_snapshot_read(void) {
+    return input_snapshot_decode(bcm2835_peri_read(bcm2835_gpio + BCM2835_GPLEV0 / 4));
+}
+
+uint8_t input_snapshot_decode(uint32_t gplev0) {
+    uint32_t pressed = ~gplev0;  // Pull-ups: LOW = pressed
+
+    return (uint8_t)(PIN_TO_KEY(pressed, BUTTON_A, 0) |
+                     PIN_TO_KEY(pressed, BUTTON_B, 1) |
+                     PIN_TO_KEY(pressed, JOY_UP, 2) |
+                     PIN_TO_KEY(pressed, JOY_DOWN, 3) |
+                     PIN_TO_KEY(pressed, JOY_LEFT, 4) |
+                     PIN_TO_KEY(pressed, JOY_RIGHT, 5));
+}
+
+joystick_state_t input_snapshot_joystick(uint8_t keys) {
+    joystick_state_t state;
+    state.up = (keys & INPUT_KEY_UP) ? 1 : 0;
+    state.down = (keys & INPUT_KEY_DOWN) ? 1 : 0;
+    state.left = (keys & INPUT_KEY_LEFT) ? 1 : 0;
+    state.right = (keys & INPUT_KEY_RIGHT) ? 1 : 0;
+    return state;
+}
+
+uint8_t input_snapshot_button(uint8_t keys, button_id_t btn) {
+    uint8_t bit = (btn == BTN_A) ? INPUT_KEY_A : (btn == BTN_B) ? INPUT_KEY_B : 0;
+    return (keys & bit) ? BUTTON_PRESSED : BUTTON_RELEASED;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h>
+#include "joystick.h"
+#include "button.h"
+
+/**
+ * Input snapshot: all buttons and joystick directions from one read of
+ * the GPIO level register (GPLEV0), so every control is sampled at the
+ * same instant and a frame costs a single peripheral access.
+ */
+
+// Snapshot bits (1 = pressed)
+#define INPUT_KEY_A     (1u << 0)
+#define INPUT_KEY_B     (1u << 1)
+#define INPUT_KEY_UP    (1u << 2)
+#define INPUT_KEY_DOWN  (1u << 3)
+#define INPUT_KEY_LEFT  (1u << 4)
+#define INPUT_KEY_RIGHT (1u << 5)
+#define INPUT_KEY_ANY   0x3Fu
+
+/**
+ * Read GPLEV0 once and decode all controls
+ * Returns: INPUT_KEY_* mask of pressed controls
+ */
+uint8_t input_snapshot_read(void);
+
+/**
+ * Decode a raw GPLEV0 value (inputs are active low)
+ * Returns: INPUT_KEY_* mask of pressed controls
+ */
+uint8_t input_snapshot_decode(uint32_t gplev0);
+
+/**
+ * Joystick directions of a snapshot
+ */
+joystick_state_t input_snapshot_joystick(uint8_t keys);
+
+/**
+ * Button state of a snapshot
+ * Returns: BUTTON_PRESSED or BUTTON_RELEASED
+ */
+uint8_t input_snapshot_button(uint8_t keys, button_id_t btn);
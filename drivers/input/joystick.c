@@ -1,20 +1,12 @@
 #include "joystick.h"
+#include "input_snapshot.h"
+#include "debounce.h"
 #include "../common/gpio_init.h"
 #include <bcm2835.h>
 
-// Debounce delay in milliseconds
-#define JOY_DEBOUNCE_MS 20
-
 joystick_state_t joystick_read_state(void) {
-    joystick_state_t state;
-
-    // Read all joystick pins (LOW = pressed due to pull-up)
-    state.up = (bcm2835_gpio_lev(JOY_UP) == LOW) ? 1 : 0;
-    state.down = (bcm2835_gpio_lev(JOY_DOWN) == LOW) ? 1 : 0;
-    state.left = (bcm2835_gpio_lev(JOY_LEFT) == LOW) ? 1 : 0;
-    state.right = (bcm2835_gpio_lev(JOY_RIGHT) == LOW) ? 1 : 0;
-
-    return state;
+    // All four directions from one GPLEV0 read (LOW = pressed due to pull-up)
+    return input_snapshot_joystick(input_snapshot_read());
 }
 
 joystick_dir_t joystick_get_direction(void) {
@@ -38,44 +30,33 @@ joystick_dir_t joystick_get_direction(void) {
 }
 
 uint8_t joystick_is_up(void) {
-    uint8_t state1 = (bcm2835_gpio_lev(JOY_UP) == LOW);
-    bcm2835_delay(JOY_DEBOUNCE_MS);
-    uint8_t state2 = (bcm2835_gpio_lev(JOY_UP) == LOW);
-    return (state1 && state2);
+    return (input_debounced()->state & INPUT_KEY_UP) ? 1 : 0;
 }
 
 uint8_t joystick_is_down(void) {
-    uint8_t state1 = (bcm2835_gpio_lev(JOY_DOWN) == LOW);
-    bcm2835_delay(JOY_DEBOUNCE_MS);
-    uint8_t state2 = (bcm2835_gpio_lev(JOY_DOWN) == LOW);
-    return (state1 && state2);
+    return (input_debounced()->state & INPUT_KEY_DOWN) ? 1 : 0;
 }
 
 uint8_t joystick_is_left(void) {
-    uint8_t state1 = (bcm2835_gpio_lev(JOY_LEFT) == LOW);
-    bcm2835_delay(JOY_DEBOUNCE_MS);
-    uint8_t state2 = (bcm2835_gpio_lev(JOY_LEFT) == LOW);
-    return (state1 && state2);
+    return (input_debounced()->state & INPUT_KEY_LEFT) ? 1 : 0;
 }
 
 uint8_t joystick_is_right(void) {
-    uint8_t state1 = (bcm2835_gpio_lev(JOY_RIGHT) == LOW);
-    bcm2835_delay(JOY_DEBOUNCE_MS);
-    uint8_t state2 = (bcm2835_gpio_lev(JOY_RIGHT) == LOW);
-    return (state1 && state2);
+    return (input_debounced()->state & INPUT_KEY_RIGHT) ? 1 : 0;
 }
 
 joystick_dir_t joystick_wait_any(void) {
-    joystick_dir_t dir;
+    const uint8_t directions = INPUT_KEY_UP | INPUT_KEY_DOWN | INPUT_KEY_LEFT | INPUT_KEY_RIGHT;
+    const debounce_t* input;
 
-    // Wait until any direction is pressed
-    do {
-        bcm2835_delay(10);
-        dir = joystick_get_direction();
-    } while (dir == JOY_DIR_NONE);
-
-    // Debounce delay
-    bcm2835_delay(JOY_DEBOUNCE_MS);
+    // Wait until any direction is pressed (debounced)
+    while (!((input = input_poll())->state & directions)) {
+        bcm2835_delay(DEBOUNCE_POLL_MS);
+    }
 
-    return dir;
+    // Priority: UP > DOWN > LEFT > RIGHT
+    if (input->state & INPUT_KEY_UP) return JOY_DIR_UP;
+    if (input->state & INPUT_KEY_DOWN) return JOY_DIR_DOWN;
+    if (input->state & INPUT_KEY_LEFT) return JOY_DIR_LEFT;
+    return JOY_DIR_RIGHT;
 }
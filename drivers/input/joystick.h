@@ -36,7 +36,8 @@ joystick_state_t joystick_read_state(void);
 joystick_dir_t joystick_get_direction(void);
 
 /**
- * Check if specific direction is pressed
+ * Check if specific direction is pressed (debounced as of the last
+ * input_poll(), never blocks)
  * Returns: 1 if pressed, 0 if not
  */
 uint8_t joystick_is_up(void);
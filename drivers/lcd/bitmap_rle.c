@@ -0,0 +1,126 @@
+/**
+ * @file bitmap_rle.c
+ * @brief Streaming decoder for BITMAP_RLE bitmaps
+ */
+
+#include "bitmap_rle.h"
+#include <string.h>
+
+// Stream checks in debug builds; release builds rely on bitmap_rle_validate()
+#ifdef DEBUG
+#include <assert.h>
+#define RLE_ASSERT(cond) assert(cond)
+#else
+#define RLE_ASSERT(cond) ((void)0)
+#endif
+
+static inline uint16_t read_pixel(const uint8_t* p) {
+    return BITMAP_PX(((uint16_t)p[0] << 8) | p[1]);
+}
+
+bool bitmap_rle_validate(const bitmap* bmp) {
+    if (bmp->format != BITMAP_RLE || bmp->data == NULL) {
+        return false;
+    }
+
+    uint32_t pos = 0;
+    for (uint16_t y = 0; y < bmp->height; y++) {
+        uint32_t x = 0;
+        while (x < bmp->width) {
+            if (pos >= bmp->data_size) {
+                return false;
+            }
+            uint8_t token = bmp->data[pos++];
+            uint32_t count = (token & BITMAP_RLE_COUNT_MASK) + 1u;
+            uint32_t bytes;
+
+            switch (token & BITMAP_RLE_OP_MASK) {
+                case BITMAP_RLE_OP_LITERAL:
+                    bytes = 2 * count;
+                    break;
+                case BITMAP_RLE_OP_RUN:
+                    bytes = 2;
+                    break;
+                case BITMAP_RLE_OP_UP:
+                    if (y == 0) return false;  // No previous row
+                    bytes = 0;
+                    break;
+                default:
+                    return false;
+            }
+            if (x + count > bmp->width || bytes > bmp->data_size - pos) {
+                return false;
+            }
+            x += count;
+            pos += bytes;
+        }
+    }
+    return true;
+}
+
+void bitmap_rle_begin(bitmap_rle_stream_t* s, const bitmap* bmp) {
+    s->bmp = bmp;
+    s->pos = bmp->data;
+    s->row = 0;
+}
+
+void bitmap_rle_next_row(bitmap_rle_stream_t* s, uint16_t* dst, const uint16_t* prev) {
+    const uint8_t* p = s->pos;
+    uint16_t* out = dst;
+    uint16_t* end = dst + s->bmp->width;
+
+    // Runs are short (at most 64 pixels); plain loops beat library calls here
+    while (out < end) {
+        uint8_t token = *p++;
+        uint16_t count = (token & BITMAP_RLE_COUNT_MASK) + 1;
+        RLE_ASSERT(out + count <= end);
+
+        switch (token & BITMAP_RLE_OP_MASK) {
+            case BITMAP_RLE_OP_LITERAL:
+                for (uint16_t i = 0; i < count; i++) {
+                    out[i] = read_pixel(&p[2 * i]);
+                }
+                p += 2 * count;
+                break;
+
+            case BITMAP_RLE_OP_RUN: {
+                uint16_t color = read_pixel(p);
+                for (uint16_t i = 0; i < count; i++) {
+                    out[i] = color;
+                }
+                p += 2;
+                break;
+            }
+
+            default: {  // BITMAP_RLE_OP_UP
+                RLE_ASSERT(prev != NULL);
+                const uint16_t* above = prev + (out - dst);
+                for (uint16_t i = 0; i < count; i++) {
+                    out[i] = above[i];
+                }
+                break;
+            }
+        }
+        out += count;
+    }
+
+    s->pos = p;
+    s->row++;
+}
+
+void bitmap_decode(const bitmap* bmp, uint16_t* dst, size_t stride) {
+    if (bmp->format == BITMAP_RAW) {
+        for (uint16_t y = 0; y < bmp->height; y++) {
+            memcpy(&dst[y * stride], &bmp->bitmap[y * bmp->width],
+                   bmp->width * sizeof(uint16_t));
+        }
+        return;
+    }
+
+    bitmap_rle_stream_t s;
+    bitmap_rle_begin(&s, bmp);
+    for (uint16_t y = 0; y < bmp->height; y++) {
+        uint16_t* row = &dst[y * stride];
+        bitmap_rle_next_row(&s, row, (y > 0) ? row - stride : NULL);
+    }
+}
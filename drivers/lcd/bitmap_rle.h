@@ -0,0 +1,79 @@
+/**
+ * @file bitmap_rle.h
+ * @brief Streaming decoder for BITMAP_RLE bitmaps
+ *
+ * The stream is a sequence of one-byte tokens per row; runs never cross
+ * rows. The top two bits select the operation, the low six bits hold
+ * count - 1 (1 to 64 pixels):
+ *   00  literal  count pixels follow, 2 bytes each, high byte first
+ *   01  run      one pixel follows, repeated count times
+ *   10  up       copy count pixels from the same x in the previous row
+ * Pixels are decoded to frame buffer storage order (BITMAP_PX()).
+ *
+ * Because "up" refers to the previous row, rows are decoded top to bottom;
+ * the caller keeps the previous row (usually the row it just wrote).
+ *
+ * The decoder trusts the stream: token counts are not checked against the
+ * row end or data_size. Streams from outside the binary (asset packs)
+ * must pass bitmap_rle_validate() before they are decoded.
+ */
+
+#ifndef BITMAP_RLE_H
+#define BITMAP_RLE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "../../assets/images.h"
+
+#define BITMAP_RLE_OP_LITERAL 0x00
+#define BITMAP_RLE_OP_RUN     0x40
+#define BITMAP_RLE_OP_UP      0x80
+#define BITMAP_RLE_OP_MASK    0xC0
+#define BITMAP_RLE_COUNT_MASK 0x3F
+
+// Widest compressed bitmap the frame buffer can decode through line buffers
+#define BITMAP_RLE_MAX_WIDTH 256
+
+/**
+ * @brief Row decoder state
+ */
+typedef struct {
+    const bitmap* bmp;
+    const uint8_t* pos;
+    uint16_t row;  // Next row to decode
+} bitmap_rle_stream_t;
+
+/**
+ * @brief Check a stream without decoding it
+ *
+ * Every row must end exactly at its last pixel, no token may read past
+ * data_size, and the first row may not use "up".
+ * @return true if the stream can be decoded safely
+ */
+bool bitmap_rle_validate(const bitmap* bmp);
+
+/**
+ * @brief Start decoding a BITMAP_RLE bitmap from its first row
+ */
+void bitmap_rle_begin(bitmap_rle_stream_t* s, const bitmap* bmp);
+
+/**
+ * @brief Decode the next row
+ *
+ * The stream must be valid (see bitmap_rle_validate()).
+ * @param s Stream state
+ * @param dst Output row (bmp->width pixels)
+ * @param prev Previously decoded row (ignored for the first row)
+ */
+void bitmap_rle_next_row(bitmap_rle_stream_t* s, uint16_t* dst, const uint16_t* prev);
+
+/**
+ * @brief Decode a whole bitmap (either format) into a pixel buffer
+ * @param bmp Source bitmap
+ * @param dst Destination, at least height rows of stride pixels
+ * @param stride Destination row stride in pixels (>= width)
+ */
+void bitmap_decode(const bitmap* bmp, uint16_t* dst, size_t stride);
+
+#endif // BITMAP_RLE_H
@@ -0,0 +1,142 @@
+/**
+ * @file fb_simd.c
+ * @brief SIMD pixel kernels (NEON / AVX2 / SSE2 / scalar)
+ */
+
+#include "fb_simd.h"
+#include <string.h>
+
+#if !defined(FB_SIMD_SCALAR) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define FB_SIMD_NEON
+#include <arm_neon.h>
+#elif !defined(FB_SIMD_SCALAR) && defined(__AVX2__)
+#define FB_SIMD_AVX2
+#include <immintrin.h>
+#elif !defined(FB_SIMD_SCALAR) && defined(__SSE2__)
+#define FB_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+// ---------------------------------------------------------------------------
+// Scalar reference
+// ---------------------------------------------------------------------------
+
+void fb_simd_fill_scalar(uint16_t* dst, uint16_t color, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = color;
+    }
+}
+
+void fb_simd_copy_keyed_scalar(uint16_t* dst, const uint16_t* src, size_t count, uint16_t key) {
+    for (size_t i = 0; i < count; i++) {
+        if (src[i] != key) {
+            dst[i] = src[i];
+        }
+    }
+}
+
+void fb_simd_pack_be_scalar(uint8_t* dst, const uint16_t* src, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[2 * i] = (uint8_t)(src[i] >> 8);
+        dst[2 * i + 1] = (uint8_t)(src[i] & 0xFF);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Dispatched kernels: vector body, scalar tail
+// ---------------------------------------------------------------------------
+
+void fb_simd_fill(uint16_t* dst, uint16_t color, size_t count) {
+    // Black and white have equal bytes: libc memset is already optimal
+    if ((color >> 8) == (color & 0xFF)) {
+        memset(dst, color & 0xFF, count * sizeof(uint16_t));
+        return;
+    }
+
+    size_t i = 0;
+#if defined(FB_SIMD_NEON)
+    uint16x8_t v = vdupq_n_u16(color);
+    for (; i + 8 <= count; i += 8) {
+        vst1q_u16(&dst[i], v);
+    }
+#elif defined(FB_SIMD_AVX2)
+    __m256i v = _mm256_set1_epi16((short)color);
+    for (; i + 16 <= count; i += 16) {
+        _mm256_storeu_si256((__m256i*)(void*)&dst[i], v);
+    }
+#elif defined(FB_SIMD_SSE2)
+    __m128i v = _mm_set1_epi16((short)color);
+    for (; i + 8 <= count; i += 8) {
+        _mm_storeu_si128((__m128i*)(void*)&dst[i], v);
+    }
+#endif
+    fb_simd_fill_scalar(&dst[i], color, count - i);
+}
+
+void fb_simd_copy_keyed(uint16_t* dst, const uint16_t* src, size_t count, uint16_t key) {
+    size_t i = 0;
+#if defined(FB_SIMD_NEON)
+    uint16x8_t k = vdupq_n_u16(key);
+    for (; i + 8 <= count; i += 8) {
+        uint16x8_t s = vld1q_u16(&src[i]);
+        uint16x8_t d = vld1q_u16(&dst[i]);
+        uint16x8_t transparent = vceqq_u16(s, k);
+        vst1q_u16(&dst[i], vbslq_u16(transparent, d, s));
+    }
+#elif defined(FB_SIMD_AVX2)
+    __m256i k = _mm256_set1_epi16((short)key);
+    for (; i + 16 <= count; i += 16) {
+        __m256i s = _mm256_loadu_si256((const __m256i*)(const void*)&src[i]);
+        __m256i d = _mm256_loadu_si256((const __m256i*)(const void*)&dst[i]);
+        __m256i transparent = _mm256_cmpeq_epi16(s, k);
+        _mm256_storeu_si256((__m256i*)(void*)&dst[i], _mm256_blendv_epi8(s, d, transparent));
+    }
+#elif defined(FB_SIMD_SSE2)
+    __m128i k = _mm_set1_epi16((short)key);
+    for (; i + 8 <= count; i += 8) {
+        __m128i s = _mm_loadu_si128((const __m128i*)(const void*)&src[i]);
+        __m128i d = _mm_loadu_si128((const __m128i*)(const void*)&dst[i]);
+        __m128i transparent = _mm_cmpeq_epi16(s, k);
+        __m128i out = _mm_or_si128(_mm_and_si128(transparent, d),
+                                   _mm_andnot_si128(transparent, s));
+        _mm_storeu_si128((__m128i*)(void*)&dst[i], out);
+    }
+#endif
+    fb_simd_copy_keyed_scalar(&dst[i], &src[i], count - i, key);
+}
+
+void fb_simd_pack_be(uint8_t* dst, const uint16_t* src, size_t count) {
+    size_t i = 0;
+#if defined(FB_SIMD_NEON) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    for (; i + 8 <= count; i += 8) {
+        uint8x16_t v = vreinterpretq_u8_u16(vld1q_u16(&src[i]));
+        vst1q_u8(&dst[2 * i], vrev16q_u8(v));
+    }
+#elif defined(FB_SIMD_AVX2)
+    const __m256i swap = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                          1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    for (; i + 16 <= count; i += 16) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(const void*)&src[i]);
+        _mm256_storeu_si256((__m256i*)(void*)&dst[2 * i], _mm256_shuffle_epi8(v, swap));
+    }
+#elif defined(FB_SIMD_SSE2)
+    for (; i + 8 <= count; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(const void*)&src[i]);
+        __m128i swapped = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        _mm_storeu_si128((__m128i*)(void*)&dst[2 * i], swapped);
+    }
+#endif
+    fb_simd_pack_be_scalar(&dst[2 * i], &src[i], count - i);
+}
+
+const char* fb_simd_backend(void) {
+#if defined(FB_SIMD_NEON)
+    return "neon";
+#elif defined(FB_SIMD_AVX2)
+    return "avx2";
+#elif defined(FB_SIMD_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
@@ -0,0 +1,47 @@
+/**
+ * @file fb_simd.h
+ * @brief SIMD pixel kernels used by the frame buffer and LCD driver
+ *
+ * Three hot loops are implemented once per instruction set:
+ *   - solid fill (fb_clear, fb_draw_rect)
+ *   - transparent-key copy (unrotated sprite blit)
+ *   - RGB565 big-endian packing for SPI (st7789_write_pixels)
+ *
+ * The backend is chosen at compile time: NEON on ARM (Raspberry Pi),
+ * AVX2 or SSE2 on x86 hosts, otherwise the scalar reference. Define
+ * FB_SIMD_SCALAR to force the scalar versions. The *_scalar functions are
+ * always built so benchmarks can check the SIMD paths bit for bit.
+ */
+
+#ifndef FB_SIMD_H
+#define FB_SIMD_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Fill count pixels with color
+ */
+void fb_simd_fill(uint16_t* dst, uint16_t color, size_t count);
+
+/**
+ * @brief Copy count pixels, skipping those equal to key
+ */
+void fb_simd_copy_keyed(uint16_t* dst, const uint16_t* src, size_t count, uint16_t key);
+
+/**
+ * @brief Store count pixels high byte first (ST7789 wire order)
+ */
+void fb_simd_pack_be(uint8_t* dst, const uint16_t* src, size_t count);
+
+// Scalar reference versions
+void fb_simd_fill_scalar(uint16_t* dst, uint16_t color, size_t count);
+void fb_simd_copy_keyed_scalar(uint16_t* dst, const uint16_t* src, size_t count, uint16_t key);
+void fb_simd_pack_be_scalar(uint8_t* dst, const uint16_t* src, size_t count);
+
+/**
+ * @brief Name of the compiled-in backend ("neon", "avx2", "sse2", "scalar")
+ */
+const char* fb_simd_backend(void);
+
+#endif // FB_SIMD_H
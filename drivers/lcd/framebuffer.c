@@ -3,25 +3,338 @@
  * @brief Frame buffer implementation
  */
 
+#define _POSIX_C_SOURCE 200809L
+
 #include "framebuffer.h"
 #include <string.h>
+#include "fb_simd.h"
+#include "bitmap_rle.h"
 #include "../game/sin_table.h"
 
-// Frame buffer: 240x240 pixels, RGB565 format
-// Size: 240 * 240 * 2 bytes = 115,200 bytes (~112.5 KB)
-static uint16_t framebuffer[ST7789_HEIGHT][ST7789_WIDTH];
+#if FB_BUFFER_COUNT > 1
+#include <stdio.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#endif
+
+// Storage byte order: colors passed to fb_* are converted once per call, and
+// wire-order buffers go to the LCD without any per-pixel transform
+#define FB_COLOR(c) BITMAP_PX(c)
+#ifdef FB_WIRE_ORDER
+#define FB_WRITE_FRAME  st7789_write_framebuffer_wire
+#define FB_WRITE_REGION st7789_write_region_wire
+#else
+#define FB_WRITE_FRAME  st7789_write_framebuffer
+#define FB_WRITE_REGION st7789_write_region
+#endif
+
+// Frame buffers: 240x240 pixels, RGB565 format
+// Size: 240 * 240 * 2 bytes = 115,200 bytes (~112.5 KB) each
+static uint16_t s_buffers[FB_BUFFER_COUNT][ST7789_HEIGHT][ST7789_WIDTH];
+
+// Back buffer currently being drawn into
+static uint16_t (*framebuffer)[ST7789_WIDTH] = s_buffers[0];
+
+// Damage tracking: rectangles drawn since the last flush
+typedef struct {
+    fb_rect_t rects[FB_MAX_DIRTY_RECTS];
+    uint8_t count;
+} fb_damage_t;
+
+static fb_damage_t s_damage;
+static fb_flush_mode_t s_flush_mode = FB_FLUSH_FULL;
+
+// Estimated cost of sending one window (command overhead + pixel bytes)
+static uint32_t rect_cost(const fb_rect_t* r) {
+    uint32_t area = (uint32_t)(r->x1 - r->x0 + 1) * (uint32_t)(r->y1 - r->y0 + 1);
+    return FB_WINDOW_OVERHEAD_BYTES + area * 2;
+}
+
+static fb_rect_t rect_union(const fb_rect_t* a, const fb_rect_t* b) {
+    fb_rect_t u;
+    u.x0 = (a->x0 < b->x0) ? a->x0 : b->x0;
+    u.y0 = (a->y0 < b->y0) ? a->y0 : b->y0;
+    u.x1 = (a->x1 > b->x1) ? a->x1 : b->x1;
+    u.y1 = (a->y1 > b->y1) ? a->y1 : b->y1;
+    return u;
+}
+
+static bool rect_intersects(const fb_rect_t* a, const fb_rect_t* b) {
+    return !(a->x1 < b->x0 || b->x1 < a->x0 || a->y1 < b->y0 || b->y1 < a->y0);
+}
+
+static bool rect_contains(const fb_rect_t* outer, const fb_rect_t* inner) {
+    return (inner->x0 >= outer->x0 && inner->x1 <= outer->x1 &&
+            inner->y0 >= outer->y0 && inner->y1 <= outer->y1);
+}
+
+// Clip rectangle to screen; returns false if nothing is left
+static bool rect_clip(fb_rect_t* r) {
+    if (r->x0 < 0) r->x0 = 0;
+    if (r->y0 < 0) r->y0 = 0;
+    if (r->x1 >= ST7789_WIDTH) r->x1 = ST7789_WIDTH - 1;
+    if (r->y1 >= ST7789_HEIGHT) r->y1 = ST7789_HEIGHT - 1;
+    return (r->x0 <= r->x1 && r->y0 <= r->y1);
+}
+
+// Index of the dirty rect that grows least when absorbing r
+static uint8_t find_cheapest_merge(const fb_damage_t* d, const fb_rect_t* r) {
+    uint8_t best = 0;
+    uint32_t best_growth = UINT32_MAX;
+
+    for (uint8_t i = 0; i < d->count; i++) {
+        fb_rect_t u = rect_union(&d->rects[i], r);
+        uint32_t growth = rect_cost(&u) - rect_cost(&d->rects[i]);
+        if (growth < best_growth) {
+            best_growth = growth;
+            best = i;
+        }
+    }
+    return best;
+}
+
+static void mark_dirty_rect(fb_rect_t r) {
+    if (!rect_clip(&r)) {
+        return;
+    }
+
+    fb_damage_t* d = &s_damage;
+    for (uint8_t i = 0; i < d->count; i++) {
+        if (rect_contains(&d->rects[i], &r)) {
+            return;
+        }
+    }
+
+    if (d->count < FB_MAX_DIRTY_RECTS) {
+        d->rects[d->count++] = r;
+        return;
+    }
+
+    // List full: fold into the rect that grows least
+    uint8_t i = find_cheapest_merge(d, &r);
+    d->rects[i] = rect_union(&d->rects[i], &r);
+}
+
+/**
+ * @brief Merge dirty rects while one window is cheaper than two
+ */
+static void merge_dirty_rects(fb_damage_t* d) {
+    bool merged = true;
+
+    while (merged) {
+        merged = false;
+        for (uint8_t i = 0; i < d->count && !merged; i++) {
+            for (uint8_t j = i + 1; j < d->count; j++) {
+                fb_rect_t u = rect_union(&d->rects[i], &d->rects[j]);
+                if (rect_cost(&u) <= rect_cost(&d->rects[i]) + rect_cost(&d->rects[j])) {
+                    d->rects[i] = u;
+                    d->rects[j] = d->rects[--d->count];
+                    merged = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Send one frame to the LCD using its damage list
+ */
+static void flush_frame(const uint16_t* buffer, fb_damage_t* damage, fb_flush_mode_t mode) {
+    if (mode == FB_FLUSH_FULL) {
+        FB_WRITE_FRAME(buffer, ST7789_WIDTH * ST7789_HEIGHT);
+        return;
+    }
+
+    if (damage->count == 0) {
+        return;
+    }
+
+    merge_dirty_rects(damage);
+
+    // Fall back to one full-frame window when most of the screen is dirty
+    uint32_t total_cost = 0;
+    for (uint8_t i = 0; i < damage->count; i++) {
+        total_cost += rect_cost(&damage->rects[i]);
+    }
+    uint32_t full_cost = FB_WINDOW_OVERHEAD_BYTES + ST7789_WIDTH * ST7789_HEIGHT * 2;
+
+    if (total_cost * 100 >= full_cost * FB_FULL_FLUSH_PERCENT) {
+        FB_WRITE_FRAME(buffer, ST7789_WIDTH * ST7789_HEIGHT);
+        return;
+    }
+
+    for (uint8_t i = 0; i < damage->count; i++) {
+        const fb_rect_t* r = &damage->rects[i];
+        FB_WRITE_REGION(buffer, ST7789_WIDTH, r->x0, r->y0, r->x1, r->y1);
+    }
+}
+
+#if FB_BUFFER_COUNT > 1
+
+// Lock-free single-producer/single-consumer ring of buffer indices
+#define FB_RING_SIZE 4
+#define FB_RING_MASK (FB_RING_SIZE - 1)
+
+// Flush thread poll interval while no frame is pending
+#define FB_FLUSH_IDLE_NS 200000L
+
+typedef struct {
+    uint8_t slots[FB_RING_SIZE];
+    atomic_uint head;  // Written by producer only
+    atomic_uint tail;  // Written by consumer only
+} fb_ring_t;
+
+// Frame handed to the flush thread together with its damage list
+typedef struct {
+    fb_damage_t damage;
+    fb_flush_mode_t mode;
+} fb_frame_t;
+
+static fb_frame_t s_frames[FB_BUFFER_COUNT];
+static fb_ring_t s_submit_ring;  // Render thread -> flush thread
+static fb_ring_t s_free_ring;    // Flush thread -> render thread
+static uint8_t s_back_index = 0;
+static pthread_t s_flush_thread;
+static bool s_thread_running = false;
+static atomic_bool s_stop_requested;
+static atomic_uint s_frames_submitted;
+static atomic_uint s_frames_flushed;
+
+static bool ring_push(fb_ring_t* ring, uint8_t value) {
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if (head - tail == FB_RING_SIZE) {
+        return false;
+    }
+    ring->slots[head & FB_RING_MASK] = value;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return true;
+}
+
+static bool ring_pop(fb_ring_t* ring, uint8_t* value) {
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    if (head == tail) {
+        return false;
+    }
+    *value = ring->slots[tail & FB_RING_MASK];
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+static void idle_wait(void) {
+    struct timespec ts = { 0, FB_FLUSH_IDLE_NS };
+    nanosleep(&ts, NULL);
+}
+
+static void* flush_thread_main(void* arg) {
+    (void)arg;
+
+    // Drain every submitted frame before honouring a stop request
+    while (true) {
+        uint8_t index;
+        if (ring_pop(&s_submit_ring, &index)) {
+            flush_frame((uint16_t*)s_buffers[index], &s_frames[index].damage,
+                        s_frames[index].mode);
+            atomic_fetch_add(&s_frames_flushed, 1);
+            ring_push(&s_free_ring, index);
+            continue;
+        }
+        if (atomic_load(&s_stop_requested)) {
+            break;
+        }
+        idle_wait();
+    }
+    return NULL;
+}
+
+static void start_flush_thread(void) {
+    atomic_store(&s_stop_requested, false);
+    for (uint8_t i = 1; i < FB_BUFFER_COUNT; i++) {
+        ring_push(&s_free_ring, i);
+    }
+
+    // Keep SIGINT/SIGTERM on the main thread so the game loop sees them
+    sigset_t block, previous;
+    sigemptyset(&block);
+    sigaddset(&block, SIGINT);
+    sigaddset(&block, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &block, &previous);
+    s_thread_running = (pthread_create(&s_flush_thread, NULL, flush_thread_main, NULL) == 0);
+    pthread_sigmask(SIG_SETMASK, &previous, NULL);
+
+    if (!s_thread_running) {
+        printf("Flush thread start failed, using synchronous flush\n");
+    }
+}
+
+/**
+ * @brief Hand the back buffer to the flush thread and take a free one
+ *
+ * The new back buffer starts as a copy of the frame just submitted, so
+ * drawing code sees the same persistent canvas as in single-buffer mode.
+ */
+static void submit_back_buffer(void) {
+    uint8_t submitted = s_back_index;
+    s_frames[submitted].damage = s_damage;
+    s_frames[submitted].mode = s_flush_mode;
+
+    atomic_fetch_add(&s_frames_submitted, 1);
+    while (!ring_push(&s_submit_ring, submitted)) {
+        idle_wait();
+    }
+
+    uint8_t next;
+    while (!ring_pop(&s_free_ring, &next)) {
+        idle_wait();
+    }
+
+    memcpy(s_buffers[next], s_buffers[submitted], sizeof(s_buffers[next]));
+    s_back_index = next;
+    framebuffer = s_buffers[next];
+}
+
+#endif // FB_BUFFER_COUNT > 1
 
 void fb_init(void) {
     // Initialize frame buffer to black
     fb_clear(0x0000);
+
+#if FB_BUFFER_COUNT > 1
+    // Start background flushing (all back buffers begin identical)
+    if (!s_thread_running) {
+        for (uint8_t i = 1; i < FB_BUFFER_COUNT; i++) {
+            memcpy(s_buffers[i], s_buffers[0], sizeof(s_buffers[i]));
+        }
+        start_flush_thread();
+    }
+#endif
 }
 
-void fb_clear(uint16_t color) {
-    for (int y = 0; y < ST7789_HEIGHT; y++) {
-        for (int x = 0; x < ST7789_WIDTH; x++) {
-            framebuffer[y][x] = color;
+void fb_set_flush_mode(fb_flush_mode_t mode) {
+    s_flush_mode = mode;
+}
+
+void fb_mark_dirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    mark_dirty_rect((fb_rect_t){ x0, y0, x1, y1 });
+}
+
+bool fb_is_dirty(const fb_rect_t* rect) {
+    for (uint8_t i = 0; i < s_damage.count; i++) {
+        if (rect_intersects(&s_damage.rects[i], rect)) {
+            return true;
         }
     }
+    return false;
+}
+
+void fb_clear(uint16_t color) {
+    // 버퍼 전체가 연속 메모리이므로 한 번에 채운다
+    fb_simd_fill(&framebuffer[0][0], FB_COLOR(color), ST7789_WIDTH * ST7789_HEIGHT);
+    fb_mark_dirty(0, 0, ST7789_WIDTH - 1, ST7789_HEIGHT - 1);
 }
 
 void fb_set_pixel(uint16_t x, uint16_t y, uint16_t color) {
@@ -29,7 +342,8 @@ void fb_set_pixel(uint16_t x, uint16_t y, uint16_t color) {
     if (x >= ST7789_WIDTH || y >= ST7789_HEIGHT) {
         return;
     }
-    framebuffer[y][x] = color;
+    framebuffer[y][x] = FB_COLOR(color);
+    fb_mark_dirty(x, y, x, y);
 }
 
 uint16_t fb_get_pixel(uint16_t x, uint16_t y) {
@@ -37,41 +351,46 @@ uint16_t fb_get_pixel(uint16_t x, uint16_t y) {
     if (x >= ST7789_WIDTH || y >= ST7789_HEIGHT) {
         return 0x0000;
     }
-    return framebuffer[y][x];
+    return FB_COLOR(framebuffer[y][x]);
 }
 
 void fb_draw_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-    // Boundary check
-    if (x >= ST7789_WIDTH || y >= ST7789_HEIGHT) {
-        return;
-    }
-
-    // Clip rectangle to screen boundaries
-    uint16_t x1 = x + w;
-    uint16_t y1 = y + h;
+    color = FB_COLOR(color);
 
-    if (x1 > ST7789_WIDTH) {
-        x1 = ST7789_WIDTH;
-    }
-    if (y1 > ST7789_HEIGHT) {
-        y1 = ST7789_HEIGHT;
+    // Clip rectangle to screen boundaries once
+    if (x >= ST7789_WIDTH || y >= ST7789_HEIGHT || w == 0 || h == 0) {
+        return;
     }
-
-    // Draw rectangle to frame buffer
-    for (uint16_t py = y; py < y1; py++) {
-        for (uint16_t px = x; px < x1; px++) {
-            framebuffer[py][px] = color;
+    uint32_t x1 = (uint32_t)x + w;
+    uint32_t y1 = (uint32_t)y + h;
+    if (x1 > ST7789_WIDTH) x1 = ST7789_WIDTH;
+    if (y1 > ST7789_HEIGHT) y1 = ST7789_HEIGHT;
+
+    if (x == 0 && x1 == ST7789_WIDTH) {
+        // Full-width rows are contiguous
+        fb_simd_fill(&framebuffer[y][0], color, (size_t)(y1 - y) * ST7789_WIDTH);
+    } else {
+        // Fill the first row, then copy it down
+        size_t row_bytes = (x1 - x) * sizeof(uint16_t);
+        fb_simd_fill(&framebuffer[y][x], color, x1 - x);
+        for (uint32_t py = y + 1; py < y1; py++) {
+            memcpy(&framebuffer[py][x], &framebuffer[y][x], row_bytes);
         }
     }
+    fb_mark_dirty(x, y, x1 - 1, y1 - 1);
 }
 
 void fb_draw_rect_outline(int16_t cx, int16_t cy, int16_t w, int16_t h, uint16_t color) {
+    color = FB_COLOR(color);
+
     // Calculate corners from center
     int16_t x1 = cx - w / 2;
     int16_t y1 = cy - h / 2;
     int16_t x2 = cx + w / 2;
     int16_t y2 = cy + h / 2;
 
+    fb_mark_dirty(x1, y1, x2, y2);
+
     // Draw horizontal lines (top and bottom)
     for (int16_t x = x1; x <= x2; x++) {
         if (x >= 0 && x < ST7789_WIDTH) {
@@ -97,130 +416,372 @@ void fb_draw_rect_outline(int16_t cx, int16_t cy, int16_t w, int16_t h, uint16_t
     }
 }
 
-void fb_draw_bitmap(uint16_t x, uint16_t y, const bitmap* bmp) {
-    if (bmp == NULL || bmp->bitmap == NULL) {
+/**
+ * @brief Decode a BITMAP_RLE bitmap placed at (x, y), writing only inside clip
+ *
+ * Rows are decoded top to bottom. Rows that lie fully inside clip are
+ * decoded straight into the frame buffer; the others go through a line
+ * buffer and only the clipped part is copied.
+ */
+static void blit_rle(int32_t x, int32_t y, const bitmap* bmp, const fb_rect_t* clip) {
+    static uint16_t s_line[2][BITMAP_RLE_MAX_WIDTH];
+
+    if (bmp->data == NULL || bmp->width > BITMAP_RLE_MAX_WIDTH) {
         return;
     }
 
-    // Draw bitmap with boundary checking and clipping
-    for (uint16_t by = 0; by < bmp->height; by++) {
-        for (uint16_t bx = 0; bx < bmp->width; bx++) {
-            uint16_t screen_x = x + bx;
-            uint16_t screen_y = y + by;
+    bool direct = (clip->x0 <= x && x + bmp->width - 1 <= clip->x1);
+    size_t clip_bytes = (size_t)(clip->x1 - clip->x0 + 1) * sizeof(uint16_t);
+    int32_t last_row = clip->y1 - y;
+    const uint16_t* prev = NULL;
+    bitmap_rle_stream_t stream;
+
+    bitmap_rle_begin(&stream, bmp);
+    for (int32_t r = 0; r <= last_row; r++) {
+        int32_t sy = y + r;
+        bool visible = (sy >= clip->y0);
+        uint16_t* out = (visible && direct) ? &framebuffer[sy][x] : s_line[r & 1];
+
+        bitmap_rle_next_row(&stream, out, prev);
+        if (visible && !direct) {
+            memcpy(&framebuffer[sy][clip->x0], &out[clip->x0 - x], clip_bytes);
+        }
+        prev = out;
+    }
+}
 
-            // Skip pixels outside screen boundaries
-            if (screen_x >= ST7789_WIDTH || screen_y >= ST7789_HEIGHT) {
-                continue;
-            }
+void fb_draw_bitmap(int16_t x, int16_t y, const bitmap* bmp) {
+    if (bmp == NULL || (bmp->format == BITMAP_RAW && bmp->bitmap == NULL)) {
+        return;
+    }
+
+    // Full-screen bitmap at the origin (maps, intro, end screens): one copy
+    if (bmp->format == BITMAP_RAW && x == 0 && y == 0 &&
+        bmp->width == ST7789_WIDTH && bmp->height == ST7789_HEIGHT) {
+        memcpy(&framebuffer[0][0], bmp->bitmap, sizeof(s_buffers[0]));
+        fb_mark_dirty(0, 0, ST7789_WIDTH - 1, ST7789_HEIGHT - 1);
+        return;
+    }
+
+    // Clip once against the screen (origin may be negative)
+    int32_t x0 = (x < 0) ? 0 : x;
+    int32_t y0 = (y < 0) ? 0 : y;
+    int32_t x1 = (int32_t)x + bmp->width;
+    int32_t y1 = (int32_t)y + bmp->height;
+    if (x1 > ST7789_WIDTH) x1 = ST7789_WIDTH;
+    if (y1 > ST7789_HEIGHT) y1 = ST7789_HEIGHT;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    if (bmp->format == BITMAP_RLE) {
+        fb_rect_t clip = {(int16_t)x0, (int16_t)y0, (int16_t)(x1 - 1), (int16_t)(y1 - 1)};
+        blit_rle(x, y, bmp, &clip);
+        mark_dirty_rect(clip);
+        return;
+    }
+
+    size_t row_bytes = (size_t)(x1 - x0) * sizeof(uint16_t);
+    const uint16_t* src = &bmp->bitmap[(size_t)(y0 - y) * bmp->width + (x0 - x)];
+    for (int32_t py = y0; py < y1; py++) {
+        memcpy(&framebuffer[py][x0], src, row_bytes);
+        src += bmp->width;
+    }
+    fb_mark_dirty(x0, y0, x1 - 1, y1 - 1);
+}
 
-            // Copy pixel from bitmap to frame buffer
-            uint16_t pixel_color = bmp->bitmap[by * bmp->width + bx];
-            framebuffer[screen_y][screen_x] = pixel_color;
+void fb_restore_bitmap_region(const bitmap* bmp, const fb_rect_t* rect) {
+    if (bmp == NULL || rect == NULL || (bmp->format == BITMAP_RAW && bmp->bitmap == NULL)) {
+        return;
+    }
+
+    // Bitmap is placed at (0, 0): clip to both the screen and the bitmap
+    fb_rect_t r = *rect;
+    if (!rect_clip(&r)) {
+        return;
+    }
+    if (r.x1 >= bmp->width) r.x1 = bmp->width - 1;
+    if (r.y1 >= bmp->height) r.y1 = bmp->height - 1;
+    if (r.x0 > r.x1 || r.y0 > r.y1) {
+        return;
+    }
+
+    if (bmp->format == BITMAP_RLE) {
+        blit_rle(0, 0, bmp, &r);
+        mark_dirty_rect(r);
+        return;
+    }
+
+    size_t row_bytes = (size_t)(r.x1 - r.x0 + 1) * sizeof(uint16_t);
+    for (int16_t y = r.y0; y <= r.y1; y++) {
+        memcpy(&framebuffer[y][r.x0], &bmp->bitmap[y * bmp->width + r.x0], row_bytes);
+    }
+    mark_dirty_rect(r);
+}
+
+void fb_draw_sprite(int16_t x, int16_t y, const sprite_t* sprite) {
+    if (sprite == NULL || sprite->data == NULL || sprite->height == 0) {
+        return;
+    }
+
+    int32_t box_x = x + sprite->left;
+    int32_t box_y = y + sprite->top;
+    fb_rect_t bounds = {
+        (int16_t)box_x, (int16_t)box_y,
+        (int16_t)(box_x + sprite->width - 1), (int16_t)(box_y + sprite->height - 1)
+    };
+    if (!rect_clip(&bounds)) {
+        return;
+    }
+    mark_dirty_rect(bounds);
+
+    const uint16_t* row_start = sprite_row_start(sprite);
+    const uint16_t* runs = sprite_runs(sprite);
+    const uint16_t* pixels = sprite_pixels(sprite);
+
+    // Skip pixel data of rows above the screen
+    uint16_t first_row = (uint16_t)(bounds.y0 - box_y);
+    for (uint16_t k = 0; k < row_start[first_row]; k++) {
+        pixels += runs[2 * k + 1];
+    }
+
+    for (uint16_t r = first_row; r <= bounds.y1 - box_y; r++) {
+        uint16_t* dst = framebuffer[box_y + r];
+
+        for (uint16_t k = row_start[r]; k < row_start[r + 1]; k++) {
+            int32_t x0 = box_x + runs[2 * k];
+            int32_t x1 = x0 + runs[2 * k + 1];
+            const uint16_t* src = pixels;
+            pixels += runs[2 * k + 1];
+
+            // 화면 밖 구간 잘라내기
+            if (x0 < 0) {
+                src -= x0;
+                x0 = 0;
+            }
+            if (x1 > ST7789_WIDTH) x1 = ST7789_WIDTH;
+            if (x0 < x1) {
+                memcpy(&dst[x0], src, (size_t)(x1 - x0) * sizeof(uint16_t));
+            }
         }
     }
 }
 
 void fb_flush(void) {
-    // Send entire frame buffer to LCD
-    // This function will use the st7789_write_framebuffer() function
-    st7789_write_framebuffer((uint16_t*)framebuffer, ST7789_WIDTH * ST7789_HEIGHT);
+#if FB_BUFFER_COUNT > 1
+    if (s_thread_running) {
+        submit_back_buffer();
+        s_damage.count = 0;
+        return;
+    }
+#endif
+    flush_frame((uint16_t*)framebuffer, &s_damage, s_flush_mode);
+    s_damage.count = 0;
+}
+
+void fb_sync(void) {
+#if FB_BUFFER_COUNT > 1
+    while (s_thread_running &&
+           atomic_load(&s_frames_flushed) != atomic_load(&s_frames_submitted)) {
+        idle_wait();
+    }
+#endif
+}
+
+void fb_shutdown(void) {
+#if FB_BUFFER_COUNT > 1
+    if (s_thread_running) {
+        atomic_store(&s_stop_requested, true);
+        pthread_join(s_flush_thread, NULL);
+        s_thread_running = false;
+    }
+#endif
 }
 
 uint16_t* fb_get_buffer(void) {
     return (uint16_t*)framebuffer;
 }
 
-void fb_draw_bitmap_rotated(int16_t cx, int16_t cy, const bitmap* bmp,
-                            int16_t angle, uint16_t transparent_color) {
-    if (bmp == NULL || bmp->bitmap == NULL) {
+bool fb_get_rotated_bounds(int16_t cx, int16_t cy, const bitmap* bmp,
+                           int16_t angle, fb_rect_t* out) {
+    if (bmp == NULL || out == NULL) {
+        return false;
+    }
+
+    if (normalize_angle(angle) == 0) {
+        out->x0 = cx - bmp->width / 2;
+        out->y0 = cy - bmp->height / 2;
+        out->x1 = out->x0 + bmp->width - 1;
+        out->y1 = out->y0 + bmp->height - 1;
+    } else {
+        // Same square the rotated rasterizer visits
+        int16_t max_dim = (bmp->width > bmp->height) ? bmp->width : bmp->height;
+        int16_t half_diag = (max_dim * 3) / 4 + 1;
+        out->x0 = cx - half_diag;
+        out->y0 = cy - half_diag;
+        out->x1 = cx + half_diag;
+        out->y1 = cy + half_diag;
+    }
+    return rect_clip(out);
+}
+
+// 바닥 나눗셈 (음수 몫도 -inf 방향으로 내림)
+static int32_t floor_div(int32_t a, int32_t b) {
+    int32_t q = a / b;
+    if ((a % b != 0) && ((a < 0) != (b < 0))) {
+        q--;
+    }
+    return q;
+}
+
+static int32_t ceil_div(int32_t a, int32_t b) {
+    return -floor_div(-a, b);
+}
+
+/**
+ * @brief Narrow [*lo, *hi] to the d where min_v <= base + slope * d <= max_v
+ */
+static void clip_linear_span(int32_t base, int32_t slope, int32_t min_v, int32_t max_v,
+                             int32_t* lo, int32_t* hi) {
+    int32_t d_min, d_max;
+
+    if (slope == 0) {
+        if (base < min_v || base > max_v) {
+            *hi = *lo - 1;  // 빈 구간
+        }
         return;
     }
 
-    // 각도 정규화 (0-359)
-    angle = normalize_angle(angle);
+    if (slope > 0) {
+        d_min = ceil_div(min_v - base, slope);
+        d_max = floor_div(max_v - base, slope);
+    } else {
+        d_min = ceil_div(max_v - base, slope);
+        d_max = floor_div(min_v - base, slope);
+    }
 
-    // 특수 각도 최적화: 0도일 때 일반 draw 사용
-    if (angle == 0) {
-        // 중심 좌표를 좌상단 좌표로 변환
-        int16_t x = cx - bmp->width / 2;
-        int16_t y = cy - bmp->height / 2;
-
-        // 투명 색상 처리 포함 그리기
-        for (uint16_t by = 0; by < bmp->height; by++) {
-            for (uint16_t bx = 0; bx < bmp->width; bx++) {
-                int16_t screen_x = x + bx;
-                int16_t screen_y = y + by;
-
-                if (screen_x < 0 || screen_x >= ST7789_WIDTH ||
-                    screen_y < 0 || screen_y >= ST7789_HEIGHT) {
-                    continue;
-                }
+    if (d_min > *lo) *lo = d_min;
+    if (d_max < *hi) *hi = d_max;
+}
 
-                uint16_t color = bmp->bitmap[by * bmp->width + bx];
-                if (color != transparent_color) {
-                    framebuffer[screen_y][screen_x] = color;
-                }
-            }
+/**
+ * @brief Rotated blit into any RGB565 target (transparent_color in storage order)
+ *
+ * 역변환 방식 최근접 샘플링. 각 목적지 행마다 원본 좌표가 비트맵 안에 들어오는
+ * 정확한 구간(span)을 한 번 계산하고, 구간 안에서는 고정소수점 덧셈만으로
+ * 원본 좌표를 진행한다. 결과는 픽셀 단위 역변환 루프와 동일하다.
+ */
+static void raster_rotated(uint16_t* dst, size_t stride, int16_t dst_w, int16_t dst_h,
+                           int16_t cx, int16_t cy, const bitmap* bmp,
+                           int16_t angle, uint16_t transparent_color) {
+    // 특수 각도 최적화: 0도일 때 행 단위 투명색 복사
+    if (angle == 0) {
+        // 중심 좌표를 좌상단 좌표로 변환 후 한 번만 클리핑
+        int32_t x = cx - bmp->width / 2;
+        int32_t y = cy - bmp->height / 2;
+        int32_t x0 = (x < 0) ? 0 : x;
+        int32_t y0 = (y < 0) ? 0 : y;
+        int32_t x1 = (x + bmp->width < dst_w) ? x + bmp->width : dst_w;
+        int32_t y1 = (y + bmp->height < dst_h) ? y + bmp->height : dst_h;
+
+        for (int32_t sy = y0; sy < y1; sy++) {
+            fb_simd_copy_keyed(&dst[sy * stride + x0],
+                               &bmp->bitmap[(sy - y) * bmp->width + (x0 - x)],
+                               (x1 > x0) ? (size_t)(x1 - x0) : 0, transparent_color);
         }
         return;
     }
 
     // 비트맵 중심점
-    int16_t bmp_cx = bmp->width / 2;
-    int16_t bmp_cy = bmp->height / 2;
+    int32_t bmp_cx = bmp->width / 2;
+    int32_t bmp_cy = bmp->height / 2;
 
     // sin/cos 값 가져오기 (고정소수점 스케일 1024)
-    int16_t sin_a = get_sin(angle);
-    int16_t cos_a = get_cos(angle);
+    int32_t sin_a = get_sin(angle);
+    int32_t cos_a = get_cos(angle);
 
     // 회전된 비트맵의 바운딩 박스 크기 계산
     // 최대 대각선 길이를 사용
-    int16_t max_dim = (bmp->width > bmp->height) ? bmp->width : bmp->height;
-    int16_t half_diag = (max_dim * 3) / 4 + 1;  // 약간의 여유
-
-    // 목적지 픽셀 순회 (역변환 방식)
-    for (int16_t dy = -half_diag; dy <= half_diag; dy++) {
-        for (int16_t dx = -half_diag; dx <= half_diag; dx++) {
-            // 화면 좌표
-            int16_t screen_x = cx + dx;
-            int16_t screen_y = cy + dy;
-
-            // 화면 범위 체크
-            if (screen_x < 0 || screen_x >= ST7789_WIDTH ||
-                screen_y < 0 || screen_y >= ST7789_HEIGHT) {
-                continue;
-            }
-
-            // 역회전 변환: 화면 좌표 -> 원본 비트맵 좌표
-            // 공식: src = R^(-1) * dst
-            // R^(-1)은 -angle 회전이므로 sin(-a) = -sin(a), cos(-a) = cos(a)
-            int32_t src_x_fp = (int32_t)dx * cos_a + (int32_t)dy * sin_a;
-            int32_t src_y_fp = -(int32_t)dx * sin_a + (int32_t)dy * cos_a;
-
-            // 고정소수점 -> 정수 변환 + 비트맵 중심 오프셋
-            int16_t src_x = (src_x_fp >> FP_SHIFT) + bmp_cx;
-            int16_t src_y = (src_y_fp >> FP_SHIFT) + bmp_cy;
+    int32_t max_dim = (bmp->width > bmp->height) ? bmp->width : bmp->height;
+    int32_t half_diag = (max_dim * 3) / 4 + 1;  // 약간의 여유
+
+    // (src_fp >> FP_SHIFT) + 중심 이 [0, 크기-1] 에 들어오는 고정소수점 범위
+    int32_t src_x_min = -bmp_cx * FP_SCALE;
+    int32_t src_x_max = (bmp->width - bmp_cx) * FP_SCALE - 1;
+    int32_t src_y_min = -bmp_cy * FP_SCALE;
+    int32_t src_y_max = (bmp->height - bmp_cy) * FP_SCALE - 1;
+
+    // 화면 클리핑은 행/열 범위로 한 번만
+    int32_t dy_lo = (-half_diag > -cy) ? -half_diag : -cy;
+    int32_t dy_hi = (half_diag < dst_h - 1 - cy) ? half_diag : dst_h - 1 - cy;
+    int32_t dx_lo_screen = (-half_diag > -cx) ? -half_diag : -cx;
+    int32_t dx_hi_screen = (half_diag < dst_w - 1 - cx) ? half_diag : dst_w - 1 - cx;
+
+    for (int32_t dy = dy_lo; dy <= dy_hi; dy++) {
+        // 역회전 변환: src = R^(-1) * dst
+        // src_x_fp = dx*cos + dy*sin, src_y_fp = -dx*sin + dy*cos
+        int32_t row_x = dy * sin_a;
+        int32_t row_y = dy * cos_a;
+
+        // 원본 비트맵 안에 들어오는 dx 구간
+        int32_t lo = dx_lo_screen;
+        int32_t hi = dx_hi_screen;
+        clip_linear_span(row_x, cos_a, src_x_min, src_x_max, &lo, &hi);
+        clip_linear_span(row_y, -sin_a, src_y_min, src_y_max, &lo, &hi);
+        if (lo > hi) {
+            continue;
+        }
 
-            // 원본 비트맵 범위 체크
-            if (src_x < 0 || src_x >= bmp->width ||
-                src_y < 0 || src_y >= bmp->height) {
-                continue;
-            }
+        int32_t src_x_fp = lo * cos_a + row_x;
+        int32_t src_y_fp = -lo * sin_a + row_y;
+        uint16_t* out = dst + (size_t)(cy + dy) * stride + (cx + lo);
 
-            // 픽셀 색상 가져오기
+        for (int32_t dx = lo; dx <= hi; dx++) {
+            int32_t src_x = (src_x_fp >> FP_SHIFT) + bmp_cx;
+            int32_t src_y = (src_y_fp >> FP_SHIFT) + bmp_cy;
             uint16_t color = bmp->bitmap[src_y * bmp->width + src_x];
 
             // 투명 색상이면 스킵
-            if (color == transparent_color) {
-                continue;
+            if (color != transparent_color) {
+                *out = color;
             }
-
-            // 프레임버퍼에 그리기
-            framebuffer[screen_y][screen_x] = color;
+            out++;
+            src_x_fp += cos_a;
+            src_y_fp -= sin_a;
         }
     }
 }
 
+void fb_render_rotated(uint16_t* dst, uint16_t dst_w, uint16_t dst_h,
+                       int16_t cx, int16_t cy, const bitmap* bmp,
+                       int16_t angle, uint16_t transparent_color) {
+    if (dst == NULL || bmp == NULL || bmp->bitmap == NULL) {
+        return;
+    }
+
+    raster_rotated(dst, dst_w, (int16_t)dst_w, (int16_t)dst_h, cx, cy, bmp,
+                   normalize_angle(angle), FB_COLOR(transparent_color));
+}
+
+void fb_draw_bitmap_rotated(int16_t cx, int16_t cy, const bitmap* bmp,
+                            int16_t angle, uint16_t transparent_color) {
+    if (bmp == NULL || bmp->bitmap == NULL) {
+        return;
+    }
+
+    // 각도 정규화 (0-359)
+    angle = normalize_angle(angle);
+    transparent_color = FB_COLOR(transparent_color);
+
+    fb_rect_t bounds;
+    if (fb_get_rotated_bounds(cx, cy, bmp, angle, &bounds)) {
+        mark_dirty_rect(bounds);
+    }
+
+    raster_rotated((uint16_t*)framebuffer, ST7789_WIDTH, ST7789_WIDTH, ST7789_HEIGHT,
+                   cx, cy, bmp, angle, transparent_color);
+}
+
 /**
  * @brief Draw a line using Bresenham's algorithm
  */
@@ -247,6 +808,8 @@ static void fb_draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_
 void fb_draw_rotated_rect_outline(int16_t cx, int16_t cy,
                                    int16_t half_w, int16_t half_h,
                                    int16_t angle, uint16_t color) {
+    color = FB_COLOR(color);
+
     // Get sin/cos values
     int16_t sin_a = get_sin(angle);
     int16_t cos_a = get_cos(angle);
@@ -264,6 +827,16 @@ void fb_draw_rotated_rect_outline(int16_t cx, int16_t cy,
         screen_y[i] = cy + (int16_t)rot_y;
     }
 
+    int16_t min_x = screen_x[0], max_x = screen_x[0];
+    int16_t min_y = screen_y[0], max_y = screen_y[0];
+    for (int i = 1; i < 4; i++) {
+        if (screen_x[i] < min_x) min_x = screen_x[i];
+        if (screen_x[i] > max_x) max_x = screen_x[i];
+        if (screen_y[i] < min_y) min_y = screen_y[i];
+        if (screen_y[i] > max_y) max_y = screen_y[i];
+    }
+    fb_mark_dirty(min_x, min_y, max_x, max_y);
+
     // Draw 4 edges
     fb_draw_line(screen_x[0], screen_y[0], screen_x[1], screen_y[1], color);  // top
     fb_draw_line(screen_x[1], screen_y[1], screen_x[2], screen_y[2], color);  // right
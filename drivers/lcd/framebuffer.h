@@ -5,22 +5,113 @@
  * This module provides a 2D array-based frame buffer for managing screen content.
  * Objects and bitmaps are drawn to the frame buffer in memory, then the entire
  * buffer is sent to the LCD display at once.
+ *
+ * Every draw call records the screen rectangle it touched. In FB_FLUSH_DAMAGE
+ * mode fb_flush() sends only those rectangles, merged by a simple cost model,
+ * and falls back to a full-frame transfer when most of the screen is dirty.
+ *
+ * With FB_WIRE_ORDER defined at build time, pixels are stored high byte first
+ * (ST7789 wire order). All fb_* functions still take and return normal RGB565
+ * values; only code writing through fb_get_buffer() must use BITMAP_PX().
+ *
+ * With FB_BUFFER_COUNT set to 2 or 3 at build time, fb_flush() hands the
+ * finished back buffer to a background flush thread and returns right away,
+ * so the next frame is simulated and drawn while the previous one is sent.
  */
 
 #ifndef FRAMEBUFFER_H
 #define FRAMEBUFFER_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "st7789.h"
+#include "sprite.h"
 #include "../../assets/images.h"
 
+// Number of frame buffers: 1 = synchronous flush, 2-3 = background flush thread
+#ifndef FB_BUFFER_COUNT
+#define FB_BUFFER_COUNT 1
+#endif
+
+#if FB_BUFFER_COUNT < 1 || FB_BUFFER_COUNT > 3
+#error "FB_BUFFER_COUNT must be 1, 2 or 3"
+#endif
+
+// Maximum number of dirty rectangles tracked between flushes
+#define FB_MAX_DIRTY_RECTS 16
+
+// Per-window cost in byte equivalents: CASET/RASET/RAMWR are 11 bytes on the
+// wire, plus six SPI calls and DC toggles that each cost several byte times
+#define FB_WINDOW_OVERHEAD_BYTES 64
+
+// Send the whole frame when partial windows would cost this much (percent)
+#define FB_FULL_FLUSH_PERCENT 75
+
+/**
+ * @brief Screen rectangle (inclusive corners)
+ */
+typedef struct {
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+} fb_rect_t;
+
+/**
+ * @brief Frame buffer flush strategy
+ */
+typedef enum {
+    FB_FLUSH_FULL,    // Always send all 240x240 pixels
+    FB_FLUSH_DAMAGE   // Send only dirty rectangles (full frame as fallback)
+} fb_flush_mode_t;
+
 /**
  * @brief Initialize the frame buffer
  *
  * Must be called before using any other frame buffer functions.
+ * In buffered builds this also starts the flush thread.
  */
 void fb_init(void);
 
+/**
+ * @brief Wait until every submitted frame has reached the LCD
+ *
+ * Returns immediately in single-buffer builds.
+ */
+void fb_sync(void);
+
+/**
+ * @brief Flush remaining frames and stop the flush thread
+ *
+ * Call once at shutdown, after the last fb_flush() and before the SPI bus
+ * is closed. Safe to call in single-buffer builds (does nothing).
+ */
+void fb_shutdown(void);
+
+/**
+ * @brief Select how fb_flush() sends the frame buffer
+ * @param mode FB_FLUSH_FULL (default) or FB_FLUSH_DAMAGE
+ */
+void fb_set_flush_mode(fb_flush_mode_t mode);
+
+/**
+ * @brief Mark a rectangle as changed since the last flush
+ *
+ * Draw functions call this themselves; use it after writing to the buffer
+ * returned by fb_get_buffer(). Coordinates are clipped to the screen.
+ *
+ * @param x0, y0 Top-left corner (inclusive)
+ * @param x1, y1 Bottom-right corner (inclusive)
+ */
+void fb_mark_dirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+/**
+ * @brief Check whether a rectangle overlaps any dirty area
+ * @param rect Rectangle to test
+ * @return true if the rectangle intersects a dirty rectangle
+ */
+bool fb_is_dirty(const fb_rect_t* rect);
+
 /**
  * @brief Clear the entire frame buffer with a color
  * @param color RGB565 color value
@@ -67,24 +158,57 @@ void fb_draw_rect_outline(int16_t cx, int16_t cy, int16_t w, int16_t h, uint16_t
  * @brief Draw a bitmap to the frame buffer
  *
  * Copies bitmap pixel data into the frame buffer at the specified position.
- * Performs boundary checking and clips the bitmap if it extends beyond screen edges.
+ * The bitmap is clipped to the screen once and copied row by row; a
+ * full-screen bitmap at (0, 0) is a single memory copy. BITMAP_RLE
+ * bitmaps are decoded row by row straight into the frame buffer.
  *
- * @param x X coordinate of top-left corner
- * @param y Y coordinate of top-left corner
+ * @param x X coordinate of top-left corner (may be negative)
+ * @param y Y coordinate of top-left corner (may be negative)
  * @param bmp Pointer to bitmap structure
  */
-void fb_draw_bitmap(uint16_t x, uint16_t y, const bitmap* bmp);
+void fb_draw_bitmap(int16_t x, int16_t y, const bitmap* bmp);
+
+/**
+ * @brief Copy part of a full-screen bitmap back into the frame buffer
+ *
+ * The bitmap is treated as placed at (0, 0); only the pixels inside rect are
+ * copied. Used to erase sprites by restoring the background underneath.
+ * Works with BITMAP_RLE bitmaps too (rows above rect are decoded and skipped).
+ *
+ * @param bmp Pointer to bitmap structure (typically a map background)
+ * @param rect Screen rectangle to restore
+ */
+void fb_restore_bitmap_region(const bitmap* bmp, const fb_rect_t* rect);
+
+/**
+ * @brief Draw an opaque-span sprite to the frame buffer
+ *
+ * Equivalent to drawing the source bitmap with its transparent pixels
+ * skipped, but copies whole runs. Clipped to the screen.
+ *
+ * @param x X coordinate of the source image's top-left corner
+ * @param y Y coordinate of the source image's top-left corner
+ * @param sprite Sprite built by sprite_from_bitmap() or sprite_encode()
+ */
+void fb_draw_sprite(int16_t x, int16_t y, const sprite_t* sprite);
 
 /**
- * @brief Send the entire frame buffer to the LCD display
+ * @brief Send the frame buffer to the LCD display
  *
- * Transfers all 240x240 pixels from the frame buffer to the LCD in one operation.
+ * In FB_FLUSH_FULL mode transfers all 240x240 pixels in one operation.
+ * In FB_FLUSH_DAMAGE mode transfers only the dirty rectangles.
+ * In buffered builds the transfer happens on the flush thread; this call only
+ * waits if every back buffer is still queued.
  * This should be called once per frame after all drawing operations are complete.
  */
 void fb_flush(void);
 
 /**
  * @brief Get pointer to the frame buffer array
+ *
+ * In buffered builds this is the current back buffer and changes after
+ * every fb_flush(); do not keep the pointer across frames.
+ *
  * @return Pointer to the frame buffer data (for advanced usage)
  */
 uint16_t* fb_get_buffer(void);
@@ -105,6 +229,39 @@ uint16_t* fb_get_buffer(void);
 void fb_draw_bitmap_rotated(int16_t cx, int16_t cy, const bitmap* bmp,
                             int16_t angle, uint16_t transparent_color);
 
+/**
+ * @brief Render a rotated bitmap into a caller-supplied pixel buffer
+ *
+ * Same rasterizer and output as fb_draw_bitmap_rotated(), but writes to dst
+ * (row-major, dst_w pixels per row) instead of the frame buffer and does not
+ * track damage. Pixels are written in frame buffer storage order.
+ *
+ * @param dst Destination pixel buffer
+ * @param dst_w Destination width (also the row stride)
+ * @param dst_h Destination height
+ * @param cx X coordinate of bitmap center in dst
+ * @param cy Y coordinate of bitmap center in dst
+ * @param bmp Pointer to bitmap structure
+ * @param angle Rotation angle in degrees
+ * @param transparent_color Color to treat as transparent
+ */
+void fb_render_rotated(uint16_t* dst, uint16_t dst_w, uint16_t dst_h,
+                       int16_t cx, int16_t cy, const bitmap* bmp,
+                       int16_t angle, uint16_t transparent_color);
+
+/**
+ * @brief Get the screen area fb_draw_bitmap_rotated() may touch
+ *
+ * @param cx X coordinate of bitmap center on screen
+ * @param cy Y coordinate of bitmap center on screen
+ * @param bmp Pointer to bitmap structure
+ * @param angle Rotation angle in degrees
+ * @param out Output: bounds clipped to the screen
+ * @return false if the bounds are entirely off screen
+ */
+bool fb_get_rotated_bounds(int16_t cx, int16_t cy, const bitmap* bmp,
+                           int16_t angle, fb_rect_t* out);
+
 /**
  * @brief Draw a rotated rectangle outline (OBB debug visualization)
  *
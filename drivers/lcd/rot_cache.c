@@ -0,0 +1,315 @@
+/**
+ * @file rot_cache.c
+ * @brief Pre-rotated sprite cache implementation
+ *
+ * Each entry is an opaque-span sprite (sprite.h) whose data lives in a
+ * static pool, plus its collision mask (sprite_mask.h) in a second pool of
+ * 32-bit words. Entries are kept in pool order; evicting one compacts both
+ * pools behind it.
+ */
+
+#include "rot_cache.h"
+#include <string.h>
+#include "../game/sin_table.h"
+
+// Scratch canvas large enough for any cacheable bitmap at any angle
+#define ROT_CACHE_HALF_DIAG   ((ROT_CACHE_MAX_DIM * 3) / 4 + 1)
+#define ROT_CACHE_SCRATCH_DIM (2 * ROT_CACHE_HALF_DIAG + 1)
+
+#define POOL_WORDS (ROT_CACHE_POOL_BYTES / 2)
+#define MASK_POOL_WORDS (ROT_CACHE_MASK_POOL_BYTES / 4)
+
+typedef struct {
+    const bitmap* bmp;
+    int16_t angle;
+    uint16_t transparent;
+    int16_t origin_x;        // Sprite source top-left relative to center
+    int16_t origin_y;
+    sprite_t sprite;
+    sprite_mask_t mask;
+    uint32_t offset;         // Start of entry data in s_pool (words)
+    uint32_t words;          // Size of entry data (words)
+    uint32_t mask_offset;    // Start of the mask in s_mask_pool (words)
+    uint32_t mask_words;
+    uint32_t last_used;
+    bool pinned;             // Not evicted (held by an operation in progress)
+} rot_entry_t;
+
+static uint16_t s_pool[POOL_WORDS];
+static uint32_t s_mask_pool[MASK_POOL_WORDS];
+static uint16_t s_scratch[ROT_CACHE_SCRATCH_DIM * ROT_CACHE_SCRATCH_DIM];
+static rot_entry_t s_entries[ROT_CACHE_MAX_ENTRIES];
+static uint16_t s_entry_count = 0;
+static uint32_t s_used_words = 0;
+static uint32_t s_mask_used = 0;
+static uint32_t s_budget_words = POOL_WORDS;
+static uint32_t s_clock = 0;
+static rot_cache_stats_t s_stats;
+
+static void evict_index(uint16_t index) {
+    rot_entry_t* e = &s_entries[index];
+    uint32_t tail = s_used_words - (e->offset + e->words);
+    uint32_t mask_tail = s_mask_used - (e->mask_offset + e->mask_words);
+
+    memmove(&s_pool[e->offset], &s_pool[e->offset + e->words], tail * sizeof(uint16_t));
+    memmove(&s_mask_pool[e->mask_offset], &s_mask_pool[e->mask_offset + e->mask_words],
+            mask_tail * sizeof(uint32_t));
+    for (uint16_t i = index + 1; i < s_entry_count; i++) {
+        s_entries[i].offset -= e->words;
+        s_entries[i].sprite.data -= e->words;
+        s_entries[i].mask_offset -= e->mask_words;
+        s_entries[i].mask.rows -= e->mask_words;
+    }
+    s_used_words -= e->words;
+    s_mask_used -= e->mask_words;
+
+    memmove(&s_entries[index], &s_entries[index + 1],
+            (size_t)(s_entry_count - index - 1) * sizeof(rot_entry_t));
+    s_entry_count--;
+    s_stats.evictions++;
+}
+
+// Evict the least recently used entry that is not pinned
+static bool evict_lru(void) {
+    int32_t oldest = -1;
+    for (uint16_t i = 0; i < s_entry_count; i++) {
+        if (!s_entries[i].pinned &&
+            (oldest < 0 || s_entries[i].last_used < s_entries[oldest].last_used)) {
+            oldest = i;
+        }
+    }
+    if (oldest < 0) {
+        return false;
+    }
+    evict_index((uint16_t)oldest);
+    return true;
+}
+
+// Evict until an entry of the given size fits in the budget (the mask
+// pool has its own fixed size)
+static bool make_room(uint32_t words, uint32_t mask_words) {
+    if (words > s_budget_words || mask_words > MASK_POOL_WORDS) {
+        return false;
+    }
+    while (s_entry_count > 0 &&
+           (s_used_words + words > s_budget_words ||
+            s_mask_used + mask_words > MASK_POOL_WORDS ||
+            s_entry_count >= ROT_CACHE_MAX_ENTRIES)) {
+        if (!evict_lru()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int16_t build_entry(const bitmap* bmp, int16_t angle, uint16_t transparent_color) {
+    uint16_t key = BITMAP_PX(transparent_color);
+    rot_entry_t e = { .bmp = bmp, .angle = angle, .transparent = transparent_color };
+    const uint16_t* src;
+    size_t stride;
+    uint16_t w, h;
+
+    if (angle == 0) {
+        // Unrotated: encode the bitmap itself, placed like the 0 degree blit
+        src = bmp->bitmap;
+        stride = w = bmp->width;
+        h = bmp->height;
+        e.origin_x = -(int16_t)(bmp->width / 2);
+        e.origin_y = -(int16_t)(bmp->height / 2);
+    } else {
+        if (bmp->width > ROT_CACHE_MAX_DIM || bmp->height > ROT_CACHE_MAX_DIM) {
+            return -1;
+        }
+
+        // Render once on a canvas pre-filled with the transparent color
+        for (size_t i = 0; i < sizeof(s_scratch) / sizeof(s_scratch[0]); i++) {
+            s_scratch[i] = key;
+        }
+        fb_render_rotated(s_scratch, ROT_CACHE_SCRATCH_DIM, ROT_CACHE_SCRATCH_DIM,
+                          ROT_CACHE_HALF_DIAG, ROT_CACHE_HALF_DIAG, bmp, angle, transparent_color);
+        src = s_scratch;
+        stride = w = h = ROT_CACHE_SCRATCH_DIM;
+        e.origin_x = -ROT_CACHE_HALF_DIAG;
+        e.origin_y = -ROT_CACHE_HALF_DIAG;
+    }
+
+    e.words = sprite_measure(src, stride, w, h, key, &e.sprite);
+    e.mask_words = sprite_mask_words(&e.sprite);
+    if (e.words == 0 || !make_room(e.words, e.mask_words)) {
+        return -1;
+    }
+
+    e.offset = s_used_words;
+    sprite_encode(src, stride, key, &s_pool[e.offset], &e.sprite);
+    s_used_words += e.words;
+
+    e.mask_offset = s_mask_used;
+    sprite_mask_encode(&e.sprite, &s_mask_pool[e.mask_offset], &e.mask);
+    s_mask_used += e.mask_words;
+
+    s_entries[s_entry_count] = e;
+    return (int16_t)s_entry_count++;
+}
+
+static int16_t find_entry(const bitmap* bmp, int16_t angle, uint16_t transparent_color) {
+    for (uint16_t i = 0; i < s_entry_count; i++) {
+        const rot_entry_t* e = &s_entries[i];
+        if (e->bmp == bmp && e->angle == angle && e->transparent == transparent_color) {
+            return (int16_t)i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Find or build the entry for (bmp, angle, transparent_color)
+ * @return Entry index, or -1 if the sprite cannot be cached
+ */
+static int16_t acquire_entry(const bitmap* bmp, int16_t angle, uint16_t transparent_color) {
+    int16_t index = find_entry(bmp, angle, transparent_color);
+
+    if (index >= 0) {
+        s_stats.hits++;
+    } else {
+        s_stats.misses++;
+        index = build_entry(bmp, angle, transparent_color);
+        if (index < 0) {
+            return -1;
+        }
+    }
+
+    s_entries[index].last_used = ++s_clock;
+    return index;
+}
+
+void rot_cache_init(void) {
+    s_entry_count = 0;
+    s_used_words = 0;
+    s_mask_used = 0;
+    s_clock = 0;
+    s_stats = (rot_cache_stats_t){0};
+}
+
+void rot_cache_set_budget(uint32_t bytes) {
+    uint32_t words = bytes / 2;
+    s_budget_words = (words > POOL_WORDS) ? POOL_WORDS : words;
+
+    while (s_entry_count > 0 && s_used_words > s_budget_words) {
+        if (!evict_lru()) {
+            break;
+        }
+    }
+}
+
+bool rot_cache_prewarm(const bitmap* bmp, int16_t angle, uint16_t transparent_color) {
+    if (bmp == NULL || bmp->bitmap == NULL) {
+        return false;
+    }
+    return acquire_entry(bmp, normalize_angle(angle), transparent_color) >= 0;
+}
+
+void rot_cache_draw(int16_t cx, int16_t cy, const bitmap* bmp,
+                    int16_t angle, uint16_t transparent_color) {
+    if (bmp == NULL || bmp->bitmap == NULL) {
+        return;
+    }
+
+    angle = normalize_angle(angle);
+    int16_t index = acquire_entry(bmp, angle, transparent_color);
+    if (index < 0) {
+        fb_draw_bitmap_rotated(cx, cy, bmp, angle, transparent_color);
+        return;
+    }
+
+    const rot_entry_t* e = &s_entries[index];
+    fb_draw_sprite(cx + e->origin_x, cy + e->origin_y, &e->sprite);
+}
+
+bool rot_cache_get_bounds(int16_t cx, int16_t cy, const bitmap* bmp,
+                          int16_t angle, uint16_t transparent_color, fb_rect_t* out) {
+    if (bmp == NULL || bmp->bitmap == NULL || out == NULL) {
+        return false;
+    }
+
+    angle = normalize_angle(angle);
+    int16_t index = acquire_entry(bmp, angle, transparent_color);
+    if (index < 0) {
+        return fb_get_rotated_bounds(cx, cy, bmp, angle, out);
+    }
+
+    const sprite_t* sprite = &s_entries[index].sprite;
+    if (sprite->height == 0) {
+        return false;
+    }
+
+    int32_t x0 = cx + s_entries[index].origin_x + sprite->left;
+    int32_t y0 = cy + s_entries[index].origin_y + sprite->top;
+    int32_t x1 = x0 + sprite->width - 1;
+    int32_t y1 = y0 + sprite->height - 1;
+
+    out->x0 = (x0 < 0) ? 0 : x0;
+    out->y0 = (y0 < 0) ? 0 : y0;
+    out->x1 = (x1 >= ST7789_WIDTH) ? ST7789_WIDTH - 1 : x1;
+    out->y1 = (y1 >= ST7789_HEIGHT) ? ST7789_HEIGHT - 1 : y1;
+    return (out->x0 <= out->x1 && out->y0 <= out->y1);
+}
+
+bool rot_cache_get_hitbox(const bitmap* bmp, uint16_t transparent_color,
+                          int16_t* half_w, int16_t* half_h) {
+    if (bmp == NULL || bmp->bitmap == NULL) {
+        return false;
+    }
+
+    int16_t index = acquire_entry(bmp, 0, transparent_color);
+    if (index < 0 || s_entries[index].sprite.height == 0) {
+        return false;
+    }
+
+    // Opaque box around the center, as drawn at angle 0
+    const rot_entry_t* e = &s_entries[index];
+    int32_t x0 = e->origin_x + e->sprite.left;
+    int32_t y0 = e->origin_y + e->sprite.top;
+    int32_t x1 = x0 + e->sprite.width - 1;
+    int32_t y1 = y0 + e->sprite.height - 1;
+    *half_w = (int16_t)(((-x0 > x1) ? -x0 : x1) + ROT_CACHE_HITBOX_MARGIN);
+    *half_h = (int16_t)(((-y0 > y1) ? -y0 : y1) + ROT_CACHE_HITBOX_MARGIN);
+    return true;
+}
+
+bool rot_cache_sprites_overlap(const bitmap* a, int16_t ax, int16_t ay, int16_t a_angle,
+                               const bitmap* b, int16_t bx, int16_t by, int16_t b_angle,
+                               uint16_t transparent_color, bool* overlap) {
+    if (a == NULL || a->bitmap == NULL || b == NULL || b->bitmap == NULL) {
+        return false;
+    }
+
+    a_angle = normalize_angle(a_angle);
+    b_angle = normalize_angle(b_angle);
+    int16_t ia = acquire_entry(a, a_angle, transparent_color);
+    if (ia < 0) {
+        return false;
+    }
+
+    // a stays cached while b is built; evictions may still move it
+    s_entries[ia].pinned = true;
+    int16_t ib = acquire_entry(b, b_angle, transparent_color);
+    ia = find_entry(a, a_angle, transparent_color);
+    s_entries[ia].pinned = false;
+    if (ib < 0) {
+        return false;
+    }
+
+    const rot_entry_t* ea = &s_entries[ia];
+    const rot_entry_t* eb = &s_entries[ib];
+    *overlap = sprite_mask_overlap(&ea->mask, ax + ea->origin_x, ay + ea->origin_y,
+                                   &eb->mask, bx + eb->origin_x, by + eb->origin_y);
+    return true;
+}
+
+rot_cache_stats_t rot_cache_get_stats(void) {
+    rot_cache_stats_t stats = s_stats;
+    stats.entries = s_entry_count;
+    stats.bytes_used = s_used_words * sizeof(uint16_t);
+    stats.budget_bytes = s_budget_words * sizeof(uint16_t);
+    return stats;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file rot_cache.h
+ * @brief Pre-rotated sprite cache
+ *
+ * Sprites only ever appear at a small set of angles (car in turn_rate steps,
+ * handle at a few steering positions, obstacles at fixed map angles). This
+ * module renders each (bitmap, angle) pair once with the frame buffer's
+ * rotation rasterizer and keeps the result as an opaque-span sprite, so drawing
+ * a rotated sprite becomes a handful of row copies. Each entry also keeps
+ * a 1-bit mask of its opaque pixels for pixel-accurate collision tests.
+ *
+ * Entries live in a static pool. When the memory budget is exceeded the
+ * least recently used entries are evicted.
+ */
+
+#ifndef ROT_CACHE_H
+#define ROT_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "framebuffer.h"
+#include "sprite_mask.h"
+
+// Size of the static entry pool in bytes (upper limit for the budget)
+#ifndef ROT_CACHE_POOL_BYTES
+#define ROT_CACHE_POOL_BYTES (1024 * 1024)
+#endif
+
+// Size of the static collision mask pool in bytes
+#ifndef ROT_CACHE_MASK_POOL_BYTES
+#define ROT_CACHE_MASK_POOL_BYTES (256 * 1024)
+#endif
+
+// Maximum number of cached (bitmap, angle) pairs
+#ifndef ROT_CACHE_MAX_ENTRIES
+#define ROT_CACHE_MAX_ENTRIES 192
+#endif
+
+// Largest bitmap dimension that can be cached (larger ones draw uncached)
+#define ROT_CACHE_MAX_DIM 128
+
+// Pixels added around the angle 0 opaque box by rot_cache_get_hitbox() to
+// cover rounding in the rotation rasterizer
+#define ROT_CACHE_HITBOX_MARGIN 2
+
+/**
+ * @brief Cache counters
+ */
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t entries;
+    uint32_t bytes_used;
+    uint32_t budget_bytes;
+} rot_cache_stats_t;
+
+/**
+ * @brief Drop all cached sprites and reset counters
+ */
+void rot_cache_init(void);
+
+/**
+ * @brief Limit the memory the cache may use
+ * @param bytes Budget in bytes (clamped to ROT_CACHE_POOL_BYTES)
+ */
+void rot_cache_set_budget(uint32_t bytes);
+
+/**
+ * @brief Render a sprite at an angle ahead of time (e.g. at map load)
+ * @return true if the sprite is now cached
+ */
+bool rot_cache_prewarm(const bitmap* bmp, int16_t angle, uint16_t transparent_color);
+
+/**
+ * @brief Draw a rotated sprite from the cache
+ *
+ * Output is identical to fb_draw_bitmap_rotated(). On a miss the sprite is
+ * rendered into the cache first; if it cannot be cached it is drawn directly.
+ *
+ * @param cx X coordinate of bitmap center on screen
+ * @param cy Y coordinate of bitmap center on screen
+ * @param bmp Pointer to bitmap structure
+ * @param angle Rotation angle in degrees
+ * @param transparent_color Color to treat as transparent
+ */
+void rot_cache_draw(int16_t cx, int16_t cy, const bitmap* bmp,
+                    int16_t angle, uint16_t transparent_color);
+
+/**
+ * @brief Get the screen area actually covered by a rotated sprite's pixels
+ *
+ * Tighter than fb_get_rotated_bounds(): only rows and columns that contain
+ * opaque pixels are included.
+ *
+ * @return false if the sprite has no visible pixels on screen
+ */
+bool rot_cache_get_bounds(int16_t cx, int16_t cy, const bitmap* bmp,
+                          int16_t angle, uint16_t transparent_color, fb_rect_t* out);
+
+/**
+ * @brief Box that contains a sprite's opaque pixels at any angle
+ *
+ * Half extents of the opaque box around the sprite center at angle 0,
+ * grown by ROT_CACHE_HITBOX_MARGIN. An OBB of this size at the sprite's
+ * angle covers everything rot_cache_draw() draws, so it is a broadphase
+ * for rot_cache_sprites_overlap().
+ *
+ * @return false if the sprite cannot be cached or has no opaque pixels
+ */
+bool rot_cache_get_hitbox(const bitmap* bmp, uint16_t transparent_color,
+                          int16_t* half_w, int16_t* half_h);
+
+/**
+ * @brief Check whether two rotated sprites share an opaque pixel
+ *
+ * Compares the 1-bit masks of the cached sprites (see sprite_mask.h), so
+ * the result is exact for what rot_cache_draw() draws at those centers.
+ * Sprite a is pinned while b is built, so this only fails if the two
+ * sprites do not fit in the cache together.
+ *
+ * @param ax, ay, a_angle Center and angle of sprite a (likewise for b)
+ * @param transparent_color Color to treat as transparent in both bitmaps
+ * @param overlap Output: true if any opaque pixels coincide
+ * @return false if the sprites cannot both be cached (overlap not set)
+ */
+bool rot_cache_sprites_overlap(const bitmap* a, int16_t ax, int16_t ay, int16_t a_angle,
+                               const bitmap* b, int16_t bx, int16_t by, int16_t b_angle,
+                               uint16_t transparent_color, bool* overlap);
+
+/**
+ * @brief Get cache counters
+ */
+rot_cache_stats_t rot_cache_get_stats(void);
+
+#endif // ROT_CACHE_H
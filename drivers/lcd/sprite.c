@@ -0,0 +1,101 @@
+/**
+ * @file sprite.c
+ * @brief Opaque-span sprite encoder
+ */
+
+#include "sprite.h"
+
+#define SPRITE_POOL_WORDS (SPRITE_POOL_BYTES / 2)
+
+static uint16_t s_pool[SPRITE_POOL_WORDS];
+static uint32_t s_pool_used = 0;
+
+uint32_t sprite_measure(const uint16_t* pixels, size_t stride, uint16_t w, uint16_t h,
+                        uint16_t key, sprite_t* out) {
+    int32_t x0 = w, y0 = h, x1 = -1, y1 = -1;
+    uint32_t runs = 0;
+    uint32_t count = 0;
+
+    for (int32_t y = 0; y < h; y++) {
+        const uint16_t* row = &pixels[(size_t)y * stride];
+        bool in_run = false;
+        for (int32_t x = 0; x < w; x++) {
+            bool opaque = (row[x] != key);
+            if (opaque) {
+                count++;
+                if (x < x0) x0 = x;
+                if (x > x1) x1 = x;
+                if (y < y0) y0 = y;
+                y1 = y;
+                if (!in_run) runs++;
+            }
+            in_run = opaque;
+        }
+    }
+
+    if (runs > UINT16_MAX) {
+        return 0;
+    }
+
+    if (y1 < 0) {
+        out->left = 0;
+        out->top = 0;
+        out->width = 0;
+        out->height = 0;
+    } else {
+        out->left = (int16_t)x0;
+        out->top = (int16_t)y0;
+        out->width = (uint16_t)(x1 - x0 + 1);
+        out->height = (uint16_t)(y1 - y0 + 1);
+    }
+    out->run_count = (uint16_t)runs;
+    out->pixel_count = count;
+    out->data = NULL;
+    return out->height + 1u + 2u * runs + count;
+}
+
+void sprite_encode(const uint16_t* pixels, size_t stride, uint16_t key,
+                   uint16_t* storage, sprite_t* s) {
+    uint16_t* row_start = storage;
+    uint16_t* runs = storage + s->height + 1;
+    uint16_t* out = runs + 2u * s->run_count;
+    uint16_t run = 0;
+
+    for (uint16_t r = 0; r < s->height; r++) {
+        const uint16_t* row = &pixels[(size_t)(s->top + r) * stride + s->left];
+        row_start[r] = run;
+
+        uint16_t x = 0;
+        while (x < s->width) {
+            if (row[x] == key) {
+                x++;
+                continue;
+            }
+            uint16_t start = x;
+            while (x < s->width && row[x] != key) {
+                *out++ = row[x++];
+            }
+            runs[2 * run] = start;
+            runs[2 * run + 1] = x - start;
+            run++;
+        }
+    }
+    row_start[s->height] = run;
+    s->data = storage;
+}
+
+bool sprite_from_bitmap(const bitmap* bmp, uint16_t transparent_color, sprite_t* out) {
+    if (bmp == NULL || bmp->bitmap == NULL || out == NULL) {
+        return false;
+    }
+
+    uint16_t key = BITMAP_PX(transparent_color);
+    uint32_t words = sprite_measure(bmp->bitmap, bmp->width, bmp->width, bmp->height, key, out);
+    if (words == 0 || words > SPRITE_POOL_WORDS - s_pool_used) {
+        return false;
+    }
+
+    sprite_encode(bmp->bitmap, bmp->width, key, &s_pool[s_pool_used], out);
+    s_pool_used += words;
+    return true;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file sprite.h
+ * @brief Opaque-span sprite format
+ *
+ * Sprite bitmaps are mostly transparent. A sprite_t keeps only the opaque
+ * pixels: the tight opaque box of the source image, and per row a list of
+ * (x, length) runs pointing into packed pixel data. Blitting a sprite is
+ * then one memcpy per run with no per-pixel transparency test
+ * (see fb_draw_sprite()).
+ *
+ * Sprite data is a single uint16_t array laid out as
+ *   row_start[height + 1]  index of the first run of each row
+ *   runs[run_count * 2]    (x from box left, length) pairs
+ *   pixels[pixel_count]    opaque pixels of all runs, in run order
+ * Pixels are kept in frame buffer storage order (see BITMAP_PX()).
+ */
+
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "../../assets/images.h"
+
+// Static pool used by sprite_from_bitmap() (bytes)
+#ifndef SPRITE_POOL_BYTES
+#define SPRITE_POOL_BYTES (64 * 1024)
+#endif
+
+/**
+ * @brief Opaque-span sprite
+ */
+typedef struct {
+    int16_t left;          // Opaque box offset inside the source image
+    int16_t top;
+    uint16_t width;        // Opaque box size (0 if fully transparent)
+    uint16_t height;
+    uint16_t run_count;
+    uint32_t pixel_count;
+    const uint16_t* data;  // row_start, runs, pixels (see file comment)
+} sprite_t;
+
+static inline const uint16_t* sprite_row_start(const sprite_t* s) {
+    return s->data;
+}
+
+static inline const uint16_t* sprite_runs(const sprite_t* s) {
+    return s->data + s->height + 1;
+}
+
+static inline const uint16_t* sprite_pixels(const sprite_t* s) {
+    return s->data + s->height + 1 + 2u * s->run_count;
+}
+
+/**
+ * @brief Measure an image and fill in the sprite geometry
+ *
+ * @param pixels Source pixels in storage order
+ * @param stride Source row stride in pixels
+ * @param w, h Source size
+ * @param key Transparent color in storage order
+ * @param out Output: left/top/width/height/run_count/pixel_count
+ * @return Number of uint16_t words sprite_encode() will write (0 if the
+ *         image has more runs than the format can index)
+ */
+uint32_t sprite_measure(const uint16_t* pixels, size_t stride, uint16_t w, uint16_t h,
+                        uint16_t key, sprite_t* out);
+
+/**
+ * @brief Encode a measured image into caller-supplied storage
+ *
+ * @param pixels Same source as passed to sprite_measure()
+ * @param stride Source row stride in pixels
+ * @param key Transparent color in storage order
+ * @param storage At least sprite_measure() words
+ * @param s Sprite from sprite_measure(); s->data is set to storage
+ */
+void sprite_encode(const uint16_t* pixels, size_t stride, uint16_t key,
+                   uint16_t* storage, sprite_t* s);
+
+/**
+ * @brief Build a sprite from a bitmap in the static sprite pool
+ *
+ * Intended for startup; pool memory is never released.
+ *
+ * @param bmp Source bitmap
+ * @param transparent_color Color to treat as transparent (RGB565)
+ * @param out Output sprite
+ * @return false if the pool is exhausted
+ */
+bool sprite_from_bitmap(const bitmap* bmp, uint16_t transparent_color, sprite_t* out);
+
+/**
+ * @brief Size of a sprite's data in bytes
+ */
+static inline uint32_t sprite_data_bytes(const sprite_t* s) {
+    return (s->height + 1u + 2u * s->run_count + s->pixel_count) * sizeof(uint16_t);
+}
+
+#endif // SPRITE_H
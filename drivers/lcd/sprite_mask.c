@@ -0,0 +1,93 @@
+/**
+ * @file sprite_mask.c
+ * @brief 1-bit opaque pixel masks
+ */
+
+#include "sprite_mask.h"
+#include <string.h>
+
+// Set bits x .. x + len - 1 of a row
+static void set_bits(uint32_t* row, uint32_t x, uint32_t len) {
+    while (len > 0) {
+        uint32_t bit = x % SPRITE_MASK_WORD_BITS;
+        uint32_t n = SPRITE_MASK_WORD_BITS - bit;
+        if (n > len) n = len;
+
+        uint32_t bits = (n == SPRITE_MASK_WORD_BITS) ? 0xFFFFFFFFu : ((1u << n) - 1u);
+        row[x / SPRITE_MASK_WORD_BITS] |= bits << bit;
+        x += n;
+        len -= n;
+    }
+}
+
+void sprite_mask_encode(const sprite_t* s, uint32_t* storage, sprite_mask_t* out) {
+    out->left = s->left;
+    out->top = s->top;
+    out->width = s->width;
+    out->height = s->height;
+    out->row_words = (uint16_t)((s->width + SPRITE_MASK_WORD_BITS - 1u) / SPRITE_MASK_WORD_BITS);
+    out->rows = storage;
+    memset(storage, 0, sprite_mask_words(s) * sizeof(uint32_t));
+
+    const uint16_t* row_start = sprite_row_start(s);
+    const uint16_t* runs = sprite_runs(s);
+    for (uint16_t r = 0; r < s->height; r++) {
+        uint32_t* row = &storage[(uint32_t)r * out->row_words];
+        for (uint16_t k = row_start[r]; k < row_start[r + 1]; k++) {
+            set_bits(row, runs[2 * k], runs[2 * k + 1]);
+        }
+    }
+}
+
+static inline uint32_t row_word(const uint32_t* row, int32_t words, int32_t w) {
+    return (w >= 0 && w < words) ? row[w] : 0;
+}
+
+// 32 bits of a row starting at pixel x (pixels outside the box are clear)
+static inline uint32_t row_bits(const uint32_t* row, int32_t words, int32_t x) {
+    int32_t w = (x >= 0) ? x / SPRITE_MASK_WORD_BITS
+                         : -((SPRITE_MASK_WORD_BITS - 1 - x) / SPRITE_MASK_WORD_BITS);
+    uint32_t shift = (uint32_t)(x - w * SPRITE_MASK_WORD_BITS);
+    uint32_t lo = row_word(row, words, w);
+    if (shift == 0) {
+        return lo;
+    }
+    return (lo >> shift) | (row_word(row, words, w + 1) << (SPRITE_MASK_WORD_BITS - shift));
+}
+
+bool sprite_mask_overlap(const sprite_mask_t* a, int32_t ax, int32_t ay,
+                         const sprite_mask_t* b, int32_t bx, int32_t by) {
+    if (a->height == 0 || b->height == 0) {
+        return false;
+    }
+
+    // Opaque boxes on screen and their intersection
+    int32_t a_x0 = ax + a->left, a_y0 = ay + a->top;
+    int32_t b_x0 = bx + b->left, b_y0 = by + b->top;
+    int32_t x0 = (a_x0 > b_x0) ? a_x0 : b_x0;
+    int32_t y0 = (a_y0 > b_y0) ? a_y0 : b_y0;
+    int32_t x1 = a_x0 + a->width - 1;
+    int32_t y1 = a_y0 + a->height - 1;
+    if (b_x0 + b->width - 1 < x1) x1 = b_x0 + b->width - 1;
+    if (b_y0 + b->height - 1 < y1) y1 = b_y0 + b->height - 1;
+    if (x0 > x1 || y0 > y1) {
+        return false;
+    }
+
+    // Words of a covering the intersection, and b's pixels under each
+    int32_t w0 = (x0 - a_x0) / SPRITE_MASK_WORD_BITS;
+    int32_t w1 = (x1 - a_x0) / SPRITE_MASK_WORD_BITS;
+    int32_t b_shift = a_x0 - b_x0;
+
+    for (int32_t y = y0; y <= y1; y++) {
+        const uint32_t* a_row = &a->rows[(y - a_y0) * a->row_words];
+        const uint32_t* b_row = &b->rows[(y - b_y0) * b->row_words];
+        for (int32_t w = w0; w <= w1; w++) {
+            uint32_t b_bits = row_bits(b_row, b->row_words, b_shift + w * SPRITE_MASK_WORD_BITS);
+            if (a_row[w] & b_bits) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
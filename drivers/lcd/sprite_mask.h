@@ -0,0 +1,63 @@
+/**
+ * @file sprite_mask.h
+ * @brief 1-bit opaque pixel masks for pixel-accurate collision
+ *
+ * A mask covers the opaque box of a sprite (same left/top/width/height as
+ * its sprite_t) with one bit per pixel, set where the sprite has an
+ * opaque pixel. Rows are padded to whole 32-bit words; bit b of word w in
+ * a row is pixel x = 32 * w + b from the box left.
+ *
+ * Two placed masks overlap if any pair of rows on the same screen line
+ * ANDs to non-zero. Rows are compared a word at a time, so a 30 pixel
+ * wide car costs one AND per row instead of 30 pixel tests.
+ */
+
+#ifndef SPRITE_MASK_H
+#define SPRITE_MASK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sprite.h"
+
+#define SPRITE_MASK_WORD_BITS 32
+
+/**
+ * @brief Opaque pixel mask of a sprite
+ */
+typedef struct {
+    int16_t left;           // Opaque box offset inside the source image
+    int16_t top;
+    uint16_t width;         // Opaque box size (0 if fully transparent)
+    uint16_t height;
+    uint16_t row_words;     // Words per row
+    const uint32_t* rows;   // height * row_words words
+} sprite_mask_t;
+
+/**
+ * @brief Number of uint32_t words sprite_mask_encode() writes for a sprite
+ */
+static inline uint32_t sprite_mask_words(const sprite_t* s) {
+    uint32_t row_words = (s->width + SPRITE_MASK_WORD_BITS - 1u) / SPRITE_MASK_WORD_BITS;
+    return row_words * s->height;
+}
+
+/**
+ * @brief Build the mask of an encoded sprite from its runs
+ *
+ * @param s Sprite with data (sprite_encode() or sprite_from_bitmap())
+ * @param storage At least sprite_mask_words() words
+ * @param out Output mask; out->rows is set to storage
+ */
+void sprite_mask_encode(const sprite_t* s, uint32_t* storage, sprite_mask_t* out);
+
+/**
+ * @brief Check whether two placed masks share an opaque pixel
+ *
+ * Positions are those of the source images' top-left corners, as passed
+ * to fb_draw_sprite().
+ * @return true if any pixel is opaque in both
+ */
+bool sprite_mask_overlap(const sprite_mask_t* a, int32_t ax, int32_t ay,
+                         const sprite_mask_t* b, int32_t bx, int32_t by);
+
+#endif // SPRITE_MASK_H
@@ -1,17 +1,129 @@
 #include "st7789.h"
 #include "../common/gpio_init.h"
+#include "fb_simd.h"
 #include <stdio.h>
+#include <string.h>
+#ifdef FRAME_PROFILE
+#include <stdatomic.h>
+#endif
+
+// Staging buffer for bulk SPI transfers (RGB565 pixels packed high byte first)
+static char s_spi_buf[ST7789_SPI_CHUNK_SIZE];
+
+// Color currently replicated across s_spi_buf (valid only for pattern fills)
+static uint16_t s_pattern_color;
+static uint8_t s_pattern_valid = 0;
+
+#ifdef FRAME_PROFILE
+// SPI traffic counters (the flush thread writes them, the profiler reads them)
+static atomic_uint s_spi_bytes;
+static atomic_uint s_spi_commands;
+static atomic_uint s_spi_transfers;
+
+static inline void spi_count(uint32_t bytes) {
+    atomic_fetch_add_explicit(&s_spi_bytes, bytes, memory_order_relaxed);
+    atomic_fetch_add_explicit(&s_spi_transfers, 1, memory_order_relaxed);
+}
+
+static inline void spi_count_command(void) {
+    atomic_fetch_add_explicit(&s_spi_commands, 1, memory_order_relaxed);
+}
+
+st7789_spi_stats_t st7789_get_spi_stats(void) {
+    st7789_spi_stats_t stats = {
+        .bytes = atomic_load_explicit(&s_spi_bytes, memory_order_relaxed),
+        .commands = atomic_load_explicit(&s_spi_commands, memory_order_relaxed),
+        .transfers = atomic_load_explicit(&s_spi_transfers, memory_order_relaxed)
+    };
+    return stats;
+}
+#else
+#define spi_count(bytes) ((void)0)
+#define spi_count_command() ((void)0)
+#endif
+
+// Bulk transfer of bytes already in wire order
+static inline void spi_write(const char* buf, uint32_t length) {
+    spi_count(length);
+    bcm2835_spi_writenb(buf, length);
+}
 
 void st7789_write_command(uint8_t cmd) {
+    spi_count_command();
+    spi_count(1);
     bcm2835_gpio_clr(TFT_DC);  // DC = LOW (command mode)
     bcm2835_spi_transfer(cmd);
 }
 
 void st7789_write_data(uint8_t data) {
+    spi_count(1);
     bcm2835_gpio_set(TFT_DC);  // DC = HIGH (data mode)
     bcm2835_spi_transfer(data);
 }
 
+void st7789_write_data_buf(const uint8_t* data, size_t length) {
+    bcm2835_gpio_set(TFT_DC);  // DC = HIGH (data mode)
+    spi_write((const char*)data, (uint32_t)length);
+}
+
+// Pack pixels into the staging buffer, sending it whenever it fills up
+static void spi_stage_pixels(const uint16_t* pixels, size_t count, size_t* used) {
+    while (count > 0) {
+        size_t n = (ST7789_SPI_CHUNK_SIZE - *used) / 2;
+        if (n > count) {
+            n = count;
+        }
+
+        // High byte first
+        fb_simd_pack_be((uint8_t*)s_spi_buf + *used, pixels, n);
+
+        *used += n * 2;
+        pixels += n;
+        count -= n;
+
+        if (*used == ST7789_SPI_CHUNK_SIZE) {
+            spi_write(s_spi_buf, ST7789_SPI_CHUNK_SIZE);
+            *used = 0;
+        }
+    }
+}
+
+// Send whatever is left in the staging buffer
+static void spi_flush_stage(size_t* used) {
+    if (*used > 0) {
+        spi_write(s_spi_buf, (uint32_t)*used);
+        *used = 0;
+    }
+}
+
+void st7789_write_pixels(const uint16_t* pixels, size_t count) {
+    size_t used = 0;
+
+    s_pattern_valid = 0;
+    spi_stage_pixels(pixels, count, &used);
+    spi_flush_stage(&used);
+}
+
+void st7789_fill_color(uint16_t color, size_t count) {
+    size_t pattern_pixels = ST7789_SPI_CHUNK_SIZE / 2;
+
+    // Replicate the color once; repeated fills of the same color reuse it
+    if (!s_pattern_valid || s_pattern_color != color) {
+        for (size_t i = 0; i < pattern_pixels; i++) {
+            s_spi_buf[2 * i] = (char)(color >> 8);
+            s_spi_buf[2 * i + 1] = (char)(color & 0xFF);
+        }
+        s_pattern_color = color;
+        s_pattern_valid = 1;
+    }
+
+    while (count > 0) {
+        size_t n = (count > pattern_pixels) ? pattern_pixels : count;
+        spi_write(s_spi_buf, (uint32_t)(n * 2));
+        count -= n;
+    }
+}
+
 void st7789_init(void) {
     // Initialize SPI
     bcm2835_spi_begin();
@@ -66,37 +178,24 @@ void st7789_init(void) {
 }
 
 void st7789_fill_screen(uint16_t color) {
-    uint8_t hi = color >> 8;
-    uint8_t lo = color & 0xFF;
-
     st7789_set_window(0, 0, ST7789_WIDTH - 1, ST7789_HEIGHT - 1);
 
     st7789_write_command(ST7789_RAMWR);
     bcm2835_gpio_set(TFT_DC);  // Data mode
 
-    int32_t i, j;
-    for (i = 0; i < ST7789_HEIGHT; i++) {
-        for (j = 0; j < ST7789_WIDTH; j++) {
-            bcm2835_spi_transfer(hi);
-            bcm2835_spi_transfer(lo);
-        }
-    }
+    st7789_fill_color(color, (size_t)ST7789_WIDTH * ST7789_HEIGHT);
 }
 
 void st7789_set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
     // Column address set
+    uint8_t caset[4] = { x0 >> 8, x0 & 0xFF, x1 >> 8, x1 & 0xFF };
     st7789_write_command(ST7789_CASET);
-    st7789_write_data(x0 >> 8);
-    st7789_write_data(x0 & 0xFF);
-    st7789_write_data(x1 >> 8);
-    st7789_write_data(x1 & 0xFF);
+    st7789_write_data_buf(caset, sizeof(caset));
 
     // Row address set
+    uint8_t raset[4] = { y0 >> 8, y0 & 0xFF, y1 >> 8, y1 & 0xFF };
     st7789_write_command(ST7789_RASET);
-    st7789_write_data(y0 >> 8);
-    st7789_write_data(y0 & 0xFF);
-    st7789_write_data(y1 >> 8);
-    st7789_write_data(y1 & 0xFF);
+    st7789_write_data_buf(raset, sizeof(raset));
 }
 
 void st7789_draw_pixel(uint16_t x, uint16_t y, uint16_t color) {
@@ -111,7 +210,7 @@ void st7789_draw_pixel(uint16_t x, uint16_t y, uint16_t color) {
 }
 
 void st7789_draw_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-    if (x >= ST7789_WIDTH || y >= ST7789_HEIGHT) {
+    if (x >= ST7789_WIDTH || y >= ST7789_HEIGHT || w == 0 || h == 0) {
         return;
     }
 
@@ -125,23 +224,15 @@ void st7789_draw_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t c
         y1 = ST7789_HEIGHT - 1;
     }
 
-    uint8_t hi = color >> 8;
-    uint8_t lo = color & 0xFF;
-
     st7789_set_window(x, y, x1, y1);
     st7789_write_command(ST7789_RAMWR);
     bcm2835_gpio_set(TFT_DC);  // Data mode
 
-    int32_t i, j;
-    for (i = 0; i < h; i++) {
-        for (j = 0; j < w; j++) {
-            bcm2835_spi_transfer(hi);
-            bcm2835_spi_transfer(lo);
-        }
-    }
+    // Send exactly the clipped window size so RAM writes never wrap
+    st7789_fill_color(color, (size_t)(x1 - x + 1) * (y1 - y + 1));
 }
 
-void st7789_write_framebuffer(uint16_t* buffer, size_t length) {
+void st7789_write_framebuffer(const uint16_t* buffer, size_t length) {
     if (buffer == NULL || length == 0) {
         return;
     }
@@ -153,11 +244,88 @@ void st7789_write_framebuffer(uint16_t* buffer, size_t length) {
     st7789_write_command(ST7789_RAMWR);
     bcm2835_gpio_set(TFT_DC);  // Data mode
 
-    // Send all pixels
-    for (size_t i = 0; i < length; i++) {
-        uint16_t pixel = buffer[i];
-        bcm2835_spi_transfer(pixel >> 8);    // High byte
-        bcm2835_spi_transfer(pixel & 0xFF);  // Low byte
+    // Send all pixels in staging-buffer sized chunks
+    st7789_write_pixels(buffer, length);
+}
+
+void st7789_write_region(const uint16_t* buffer, size_t stride,
+                         uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    if (buffer == NULL || x1 >= ST7789_WIDTH || y1 >= ST7789_HEIGHT ||
+        x0 > x1 || y0 > y1) {
+        return;
+    }
+
+    st7789_set_window(x0, y0, x1, y1);
+    st7789_write_command(ST7789_RAMWR);
+    bcm2835_gpio_set(TFT_DC);  // Data mode
+
+    // Rows are packed back to back so short rows still share SPI calls
+    size_t width = (size_t)(x1 - x0 + 1);
+    size_t used = 0;
+
+    s_pattern_valid = 0;
+    for (uint16_t y = y0; y <= y1; y++) {
+        spi_stage_pixels(buffer + (size_t)y * stride + x0, width, &used);
+    }
+    spi_flush_stage(&used);
+}
+
+void st7789_write_framebuffer_wire(const uint16_t* buffer, size_t length) {
+    if (buffer == NULL || length == 0) {
+        return;
+    }
+
+    st7789_set_window(0, 0, ST7789_WIDTH - 1, ST7789_HEIGHT - 1);
+    st7789_write_command(ST7789_RAMWR);
+    bcm2835_gpio_set(TFT_DC);  // Data mode
+
+    // Already in wire order: stream the buffer memory as is
+    spi_write((const char*)buffer, (uint32_t)(length * 2));
+}
+
+void st7789_write_region_wire(const uint16_t* buffer, size_t stride,
+                              uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    if (buffer == NULL || x1 >= ST7789_WIDTH || y1 >= ST7789_HEIGHT ||
+        x0 > x1 || y0 > y1) {
+        return;
+    }
+
+    st7789_set_window(x0, y0, x1, y1);
+    st7789_write_command(ST7789_RAMWR);
+    bcm2835_gpio_set(TFT_DC);  // Data mode
+
+    size_t row_bytes = (size_t)(x1 - x0 + 1) * 2;
+    const uint16_t* first_row = buffer + (size_t)y0 * stride + x0;
+
+    // Full-width rows are contiguous in memory: one transfer for all of them
+    if (row_bytes == stride * 2) {
+        spi_write((const char*)first_row, (uint32_t)(row_bytes * (y1 - y0 + 1)));
+        return;
+    }
+
+    // Otherwise gather rows into the staging buffer (plain copies, no swap)
+    size_t used = 0;
+    s_pattern_valid = 0;
+    for (uint16_t y = y0; y <= y1; y++) {
+        const char* row = (const char*)(first_row + (size_t)(y - y0) * stride);
+        size_t remaining = row_bytes;
+        while (remaining > 0) {
+            size_t n = ST7789_SPI_CHUNK_SIZE - used;
+            if (n > remaining) {
+                n = remaining;
+            }
+            memcpy(s_spi_buf + used, row, n);
+            used += n;
+            row += n;
+            remaining -= n;
+            if (used == ST7789_SPI_CHUNK_SIZE) {
+                spi_write(s_spi_buf, ST7789_SPI_CHUNK_SIZE);
+                used = 0;
+            }
+        }
+    }
+    if (used > 0) {
+        spi_write(s_spi_buf, (uint32_t)used);
     }
 }
 
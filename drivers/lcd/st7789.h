@@ -8,6 +8,11 @@
 #define ST7789_WIDTH   240
 #define ST7789_HEIGHT  240
 
+// Bulk SPI staging buffer size in bytes (must be even)
+#ifndef ST7789_SPI_CHUNK_SIZE
+#define ST7789_SPI_CHUNK_SIZE 4096
+#endif
+
 // ST7789 commands
 #define ST7789_NOP     0x00
 #define ST7789_SWRESET 0x01
@@ -29,6 +34,23 @@
 #define COLOR_CYAN    0x07FF
 #define COLOR_MAGENTA 0xF81F
 
+#ifdef FRAME_PROFILE
+/**
+ * SPI traffic counters since startup
+ * Counters wrap at 2^32; take differences between two samples.
+ */
+typedef struct {
+    uint32_t bytes;      // Bytes sent (commands and data)
+    uint32_t commands;   // Command bytes (DC low)
+    uint32_t transfers;  // SPI transfer calls
+} st7789_spi_stats_t;
+
+/**
+ * Read the SPI traffic counters (FRAME_PROFILE builds only)
+ */
+st7789_spi_stats_t st7789_get_spi_stats(void);
+#endif
+
 /**
  * Write command to ST7789
  */
@@ -39,6 +61,28 @@ void st7789_write_command(uint8_t cmd);
  */
 void st7789_write_data(uint8_t data);
 
+/**
+ * Write a block of data bytes to ST7789 in a single SPI transfer
+ */
+void st7789_write_data_buf(const uint8_t* data, size_t length);
+
+/**
+ * Stream RGB565 pixels to display RAM (after RAMWR, in data mode)
+ * Pixels are packed high byte first into a staging buffer and sent
+ * in chunks of ST7789_SPI_CHUNK_SIZE bytes per SPI call.
+ * @param pixels Pointer to RGB565 pixel array
+ * @param count Number of pixels to send
+ */
+void st7789_write_pixels(const uint16_t* pixels, size_t count);
+
+/**
+ * Stream a solid color to display RAM (after RAMWR, in data mode)
+ * The color pattern is built once in the staging buffer and resent per chunk.
+ * @param color RGB565 color value
+ * @param count Number of pixels to send
+ */
+void st7789_fill_color(uint16_t color, size_t count);
+
 /**
  * Initialize ST7789 LCD
  */
@@ -70,7 +114,33 @@ void st7789_draw_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t c
  * @param buffer Pointer to frame buffer array (RGB565 format)
  * @param length Number of pixels to write
  */
-void st7789_write_framebuffer(uint16_t* buffer, size_t length);
+void st7789_write_framebuffer(const uint16_t* buffer, size_t length);
+
+/**
+ * Write a rectangular region of a frame buffer to LCD
+ * Sets the window to (x0, y0)-(x1, y1) and sends only those pixels.
+ * @param buffer Pointer to frame buffer array (RGB565 format)
+ * @param stride Frame buffer row length in pixels
+ * @param x0, y0 Top-left corner (inclusive)
+ * @param x1, y1 Bottom-right corner (inclusive)
+ */
+void st7789_write_region(const uint16_t* buffer, size_t stride,
+                         uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+/**
+ * Write a frame buffer already stored in wire order (high byte first)
+ * The memory is sent unchanged in a single SPI transfer.
+ * @param buffer Pointer to frame buffer array (byte-swapped RGB565)
+ * @param length Number of pixels to write
+ */
+void st7789_write_framebuffer_wire(const uint16_t* buffer, size_t length);
+
+/**
+ * Write a rectangular region of a wire-order frame buffer to LCD
+ * Same as st7789_write_region() but without per-pixel byte swapping.
+ */
+void st7789_write_region_wire(const uint16_t* buffer, size_t stride,
+                              uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 
 /**
  * Convert RGB888 to RGB565
@@ -0,0 +1,231 @@
+/**
+ * @file bcm2835_stub.c
+ * @brief Host-side bcm2835 replacement (no hardware access, virtual panel)
+ */
+
+#include <bcm2835.h>
+#include "bcm2835_stub.h"
+#include "common/gpio_init.h"
+#include "lcd/st7789.h"
+
+static bcm2835_stub_stats_t s_stats;
+static uint64_t s_now_us;                // Virtual time advanced by the delay calls
+static bcm2835_stub_input_fn s_input;    // NULL: every input reads HIGH
+
+// Fake GPIO register bank behind bcm2835_gpio (only GPLEV0 is modelled)
+static uint32_t s_gpio_regs[BCM2835_BLOCK_SIZE / 4];
+volatile uint32_t* bcm2835_gpio = s_gpio_regs;
+
+// Virtual ST7789: DC level, current command and RAM write window/cursor
+static uint16_t s_gram[ST7789_WIDTH * ST7789_HEIGHT];
+static uint8_t s_dc_level = LOW;
+static uint8_t s_command = ST7789_NOP;
+static uint8_t s_args[4];
+static uint32_t s_arg_count = 0;
+static uint16_t s_win_x0 = 0, s_win_x1 = ST7789_WIDTH - 1;
+static uint16_t s_win_y0 = 0, s_win_y1 = ST7789_HEIGHT - 1;
+static uint16_t s_cur_x = 0, s_cur_y = 0;
+static uint8_t s_pixel_hi = 0;
+static int s_panel_enabled = 1;
+
+static void panel_command(uint8_t cmd) {
+    s_command = cmd;
+    s_arg_count = 0;
+    if (cmd == ST7789_RAMWR) {
+        s_cur_x = s_win_x0;
+        s_cur_y = s_win_y0;
+    }
+}
+
+static void panel_ram_byte(uint8_t value) {
+    if ((s_arg_count++ & 1) == 0) {
+        s_pixel_hi = value;
+        return;
+    }
+
+    if (s_cur_x < ST7789_WIDTH && s_cur_y < ST7789_HEIGHT) {
+        s_gram[s_cur_y * ST7789_WIDTH + s_cur_x] = (uint16_t)((s_pixel_hi << 8) | value);
+    }
+    if (++s_cur_x > s_win_x1) {
+        s_cur_x = s_win_x0;
+        if (++s_cur_y > s_win_y1) {
+            s_cur_y = s_win_y0;
+        }
+    }
+}
+
+static void panel_data(uint8_t value) {
+    if (s_command == ST7789_RAMWR) {
+        panel_ram_byte(value);
+        return;
+    }
+    if (s_command != ST7789_CASET && s_command != ST7789_RASET) {
+        return;
+    }
+    if (s_arg_count < 4) {
+        s_args[s_arg_count++] = value;
+    }
+    if (s_arg_count == 4) {
+        uint16_t start = (uint16_t)((s_args[0] << 8) | s_args[1]);
+        uint16_t end = (uint16_t)((s_args[2] << 8) | s_args[3]);
+        if (s_command == ST7789_CASET) {
+            s_win_x0 = start;
+            s_win_x1 = end;
+        } else {
+            s_win_y0 = start;
+            s_win_y1 = end;
+        }
+    }
+}
+
+static void panel_byte(uint8_t value) {
+    if (s_dc_level == LOW) {
+        panel_command(value);
+    } else {
+        panel_data(value);
+    }
+}
+
+void bcm2835_stub_set_panel_enabled(int enabled) {
+    s_panel_enabled = enabled;
+}
+
+const uint16_t* bcm2835_stub_get_gram(void) {
+    return s_gram;
+}
+
+void bcm2835_stub_reset_stats(void) {
+    s_stats = (bcm2835_stub_stats_t){0};
+}
+
+bcm2835_stub_stats_t bcm2835_stub_get_stats(void) {
+    return s_stats;
+}
+
+int bcm2835_init(void) {
+    return 1;
+}
+
+int bcm2835_close(void) {
+    return 1;
+}
+
+void bcm2835_delay(unsigned int millis) {
+    s_stats.delay_ms += millis;
+    s_now_us += (uint64_t)millis * 1000;
+}
+
+void bcm2835_delayMicroseconds(uint64_t micros) {
+    s_now_us += micros;
+}
+
+uint64_t bcm2835_stub_now_us(void) {
+    return s_now_us;
+}
+
+void bcm2835_stub_set_input(bcm2835_stub_input_fn fn) {
+    s_input = fn;
+}
+
+void bcm2835_gpio_fsel(uint8_t pin, uint8_t mode) {
+    (void)pin;
+    (void)mode;
+}
+
+void bcm2835_gpio_set(uint8_t pin) {
+    if (pin == TFT_DC) {
+        s_dc_level = HIGH;
+        s_stats.dc_toggles++;
+    }
+}
+
+void bcm2835_gpio_clr(uint8_t pin) {
+    if (pin == TFT_DC) {
+        s_dc_level = LOW;
+        s_stats.dc_toggles++;
+    }
+}
+
+static uint8_t pin_level(uint8_t pin) {
+    if (s_input != NULL) {
+        return s_input(pin);
+    }
+    return HIGH;  // Pull-up: inputs read as released
+}
+
+// Both level reads below cost one GPLEV0 access on hardware
+uint8_t bcm2835_gpio_lev(uint8_t pin) {
+    s_stats.gplev_reads++;
+    return pin_level(pin);
+}
+
+uint32_t bcm2835_peri_read(volatile uint32_t* paddr) {
+    // GPLEV0 is sampled from the input source, one bit per pin
+    if (paddr == &s_gpio_regs[BCM2835_GPLEV0 / 4]) {
+        uint32_t levels = 0;
+        for (uint8_t pin = 0; pin < 32; pin++) {
+            levels |= (uint32_t)(pin_level(pin) == HIGH) << pin;
+        }
+        s_gpio_regs[BCM2835_GPLEV0 / 4] = levels;
+        s_stats.gplev_reads++;
+    }
+    return *paddr;
+}
+
+void bcm2835_gpio_set_pud(uint8_t pin, uint8_t pud) {
+    (void)pin;
+    (void)pud;
+}
+
+int bcm2835_spi_begin(void) {
+    return 1;
+}
+
+void bcm2835_spi_end(void) {
+}
+
+void bcm2835_spi_setBitOrder(uint8_t order) {
+    (void)order;
+}
+
+void bcm2835_spi_setClockDivider(uint16_t divider) {
+    (void)divider;
+}
+
+void bcm2835_spi_setDataMode(uint8_t mode) {
+    (void)mode;
+}
+
+void bcm2835_spi_chipSelect(uint8_t cs) {
+    (void)cs;
+}
+
+void bcm2835_spi_setChipSelectPolarity(uint8_t cs, uint8_t active) {
+    (void)cs;
+    (void)active;
+}
+
+uint8_t bcm2835_spi_transfer(uint8_t value) {
+    s_stats.spi_calls++;
+    s_stats.spi_bytes++;
+    if (s_panel_enabled) {
+        panel_byte(value);
+    }
+    return 0;
+}
+
+void bcm2835_spi_transfern(char* buf, uint32_t len) {
+    s_stats.spi_calls++;
+    s_stats.spi_bytes += len;
+    for (uint32_t i = 0; s_panel_enabled && i < len; i++) {
+        panel_byte((uint8_t)buf[i]);
+    }
+}
+
+void bcm2835_spi_writenb(const char* buf, uint32_t len) {
+    s_stats.spi_calls++;
+    s_stats.spi_bytes += len;
+    for (uint32_t i = 0; s_panel_enabled && i < len; i++) {
+        panel_byte((uint8_t)buf[i]);
+    }
+}
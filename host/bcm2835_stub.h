@@ -0,0 +1,69 @@
+/**
+ * @file bcm2835_stub.h
+ * @brief Host-side bcm2835 replacement for off-device builds
+ *
+ * Implements the subset of the bcm2835 API used by this project without
+ * touching any hardware. SPI traffic is discarded but counted, so transfer
+ * paths can be measured on a development machine.
+ */
+
+#ifndef BCM2835_STUB_H
+#define BCM2835_STUB_H
+
+#include <stdint.h>
+
+/**
+ * @brief SPI/GPIO traffic counters collected by the stub
+ */
+typedef struct {
+    uint64_t spi_calls;      // Number of SPI transfer function calls
+    uint64_t spi_bytes;      // Total bytes clocked out on MOSI
+    uint64_t dc_toggles;     // Number of gpio_set/gpio_clr calls
+    uint64_t delay_ms;       // Total milliseconds requested via bcm2835_delay
+    uint64_t gplev_reads;    // GPIO level register reads (gpio_lev or peri_read of GPLEV0)
+} bcm2835_stub_stats_t;
+
+/**
+ * @brief Reset all traffic counters to zero
+ */
+void bcm2835_stub_reset_stats(void);
+
+/**
+ * @brief Get a snapshot of the traffic counters
+ */
+bcm2835_stub_stats_t bcm2835_stub_get_stats(void);
+
+/**
+ * @brief Enable or disable decoding SPI traffic into the virtual panel
+ *
+ * Decoding is on by default; disable it when timing transfer code so the
+ * per-byte decode cost does not dominate the measurement.
+ */
+void bcm2835_stub_set_panel_enabled(int enabled);
+
+/**
+ * @brief Get the virtual panel memory written through CASET/RASET/RAMWR
+ * @return Pointer to 240*240 RGB565 pixels (row-major, host byte order)
+ */
+const uint16_t* bcm2835_stub_get_gram(void);
+
+/**
+ * @brief Virtual time in microseconds
+ *
+ * Starts at zero and only moves when bcm2835_delay() or
+ * bcm2835_delayMicroseconds() is called (those return immediately).
+ */
+uint64_t bcm2835_stub_now_us(void);
+
+/**
+ * @brief Input level source for bcm2835_gpio_lev()
+ * @return HIGH or LOW for the pin
+ */
+typedef uint8_t (*bcm2835_stub_input_fn)(uint8_t pin);
+
+/**
+ * @brief Drive input pins from a callback (NULL: all pins read HIGH)
+ */
+void bcm2835_stub_set_input(bcm2835_stub_input_fn fn);
+
+#endif // BCM2835_STUB_H
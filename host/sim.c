@@ -0,0 +1,299 @@
+/**
+ * @file sim.c
+ * @brief Headless deterministic game simulation
+ *
+ * Usage: sim [--seconds N] [--script PATH | --replay LOG] [--record LOG]
+ *            [--hashes PATH]
+ *
+ * Runs the real game state machine against the bcm2835 stub: the display
+ * is the stub's virtual panel, input comes from a script and time is the
+ * stub's virtual clock, so frames are produced as fast as the CPU allows
+ * and a run is reproducible bit for bit. Every presented frame is hashed
+ * (FNV-1a over the panel memory); the hashes are chained into one run
+ * hash, and can be written one per line to compare runs frame by frame.
+ *
+ * Script lines are `<ms> <keys>`: from that time on the listed keys are
+ * held (A, B, UP, DOWN, LEFT, RIGHT, or `-` for none). Lines must be in
+ * time order; the script repeats with the last line's time as its period.
+ *
+ * With --replay the game is driven by an input log (see input_log.h)
+ * instead of the script, and the run ends when the log does. Replaying a
+ * log recorded with --record presents the same frames as the recording.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <bcm2835.h>
+#include "bcm2835_stub.h"
+#include "common/gpio_init.h"
+#include "common/timing.h"
+#include "lcd/st7789.h"
+#include "lcd/framebuffer.h"
+#include "game.h"
+
+#define SIM_DEFAULT_SECONDS 60
+#define SIM_MAX_STEPS       256
+
+#define FNV_OFFSET 0xcbf29ce484222325ULL
+#define FNV_PRIME  0x100000001b3ULL
+
+// Input bits held by a script step
+enum {
+    KEY_A     = 1 << 0,
+    KEY_B     = 1 << 1,
+    KEY_UP    = 1 << 2,
+    KEY_DOWN  = 1 << 3,
+    KEY_LEFT  = 1 << 4,
+    KEY_RIGHT = 1 << 5,
+};
+
+typedef struct {
+    uint32_t at_ms;
+    uint8_t keys;
+} sim_step_t;
+
+static const struct {
+    const char* name;
+    uint8_t key;
+    uint8_t pin;
+} s_keys[] = {
+    { "A", KEY_A, BUTTON_A },
+    { "B", KEY_B, BUTTON_B },
+    { "UP", KEY_UP, JOY_UP },
+    { "DOWN", KEY_DOWN, JOY_DOWN },
+    { "LEFT", KEY_LEFT, JOY_LEFT },
+    { "RIGHT", KEY_RIGHT, JOY_RIGHT },
+};
+#define KEY_COUNT (sizeof(s_keys) / sizeof(s_keys[0]))
+
+// Pick the easy map, drive into the course, restart, then the hard map
+static const sim_step_t s_default_script[] = {
+    {    0, 0 },
+    {  500, KEY_A },
+    {  600, 0 },
+    { 1000, KEY_A },
+    { 2500, KEY_A | KEY_RIGHT },
+    { 3000, KEY_A },
+    { 4500, KEY_A | KEY_LEFT },
+    { 5000, KEY_DOWN },
+    { 6000, KEY_B },
+    { 7000, 0 },
+    { 7500, KEY_UP },
+    { 7600, 0 },
+    { 8000, KEY_B },
+    { 8100, 0 },
+    { 8500, KEY_A | KEY_LEFT },
+    { 10000, KEY_A },
+    { 12000, KEY_UP },
+    { 12100, 0 },
+    { 13000, 0 },
+};
+
+static sim_step_t s_script[SIM_MAX_STEPS];
+static uint32_t s_step_count = 0;
+static uint32_t s_period_ms = 0;
+
+static uint64_t s_start_us;
+static uint64_t s_end_us;
+static uint32_t s_frames = 0;
+static uint64_t s_run_hash = FNV_OFFSET;
+static FILE* s_hash_file = NULL;
+
+static void use_default_script(void) {
+    s_step_count = sizeof(s_default_script) / sizeof(s_default_script[0]);
+    memcpy(s_script, s_default_script, sizeof(s_default_script));
+}
+
+static bool load_script(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (f == NULL) {
+        printf("sim: cannot read script %s\n", path);
+        return false;
+    }
+
+    char line[256];
+    int line_no = 0;
+    while (fgets(line, sizeof(line), f) != NULL) {
+        line_no++;
+        char* tok = strtok(line, " \t\r\n");
+        if (tok == NULL || tok[0] == '#') continue;
+
+        sim_step_t step = { (uint32_t)strtoul(tok, NULL, 10), 0 };
+        while ((tok = strtok(NULL, " \t\r\n")) != NULL && strcmp(tok, "-") != 0) {
+            size_t k = 0;
+            while (k < KEY_COUNT && strcmp(tok, s_keys[k].name) != 0) k++;
+            if (k == KEY_COUNT) {
+                printf("sim: %s:%d: unknown key %s\n", path, line_no, tok);
+                fclose(f);
+                return false;
+            }
+            step.keys |= s_keys[k].key;
+        }
+
+        if (s_step_count == SIM_MAX_STEPS ||
+            (s_step_count > 0 && step.at_ms < s_script[s_step_count - 1].at_ms)) {
+            printf("sim: %s:%d: too many steps or out of order\n", path, line_no);
+            fclose(f);
+            return false;
+        }
+        s_script[s_step_count++] = step;
+    }
+    fclose(f);
+    return s_step_count > 0;
+}
+
+static uint8_t keys_at(uint64_t now_us) {
+    uint32_t ms = (uint32_t)((now_us - s_start_us) / 1000);
+    if (s_period_ms > 0) {
+        ms %= s_period_ms;
+    }
+
+    uint8_t keys = 0;
+    for (uint32_t i = 0; i < s_step_count && s_script[i].at_ms <= ms; i++) {
+        keys = s_script[i].keys;
+    }
+    return keys;
+}
+
+// Inputs are active low; after the end everything reads released so no
+// blocking wait in the game can hold the run open
+static uint8_t sim_input(uint8_t pin) {
+    uint64_t now = bcm2835_stub_now_us();
+    if (now >= s_end_us) {
+        game_stop();
+        return HIGH;
+    }
+
+    uint8_t keys = keys_at(now);
+    for (size_t k = 0; k < KEY_COUNT; k++) {
+        if (s_keys[k].pin == pin) {
+            return (keys & s_keys[k].key) ? LOW : HIGH;
+        }
+    }
+    return HIGH;
+}
+
+// The game loop's sleeps jump the virtual clock to the deadline
+static void sim_sleep_until_us(uint64_t deadline_us) {
+    uint64_t now = bcm2835_stub_now_us();
+    if (deadline_us > now) {
+        bcm2835_delayMicroseconds(deadline_us - now);
+    }
+}
+
+static const timing_source_t s_virtual_clock = {
+    .now_us = bcm2835_stub_now_us,
+    .sleep_until_us = sim_sleep_until_us,
+};
+
+static uint64_t hash_bytes(uint64_t h, const void* data, size_t size) {
+    const uint8_t* p = data;
+    for (size_t i = 0; i < size; i++) {
+        h = (h ^ p[i]) * FNV_PRIME;
+    }
+    return h;
+}
+
+// Hash what the panel shows, so the result does not depend on the flush
+// path (buffer count, wire order, damage tracking)
+static void sim_frame(void) {
+    fb_sync();
+    uint64_t h = hash_bytes(FNV_OFFSET, bcm2835_stub_get_gram(),
+                            ST7789_WIDTH * ST7789_HEIGHT * sizeof(uint16_t));
+    s_run_hash = hash_bytes(s_run_hash, &h, sizeof(h));
+    s_frames++;
+
+    if (s_hash_file != NULL) {
+        fprintf(s_hash_file, "%u %016llx\n", s_frames, (unsigned long long)h);
+    }
+    if (bcm2835_stub_now_us() >= s_end_us) {
+        game_stop();
+    }
+}
+
+static double wall_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv) {
+    uint32_t seconds = SIM_DEFAULT_SECONDS;
+    const char* script_path = NULL;
+    const char* hash_path = NULL;
+    const char* record_path = NULL;
+    const char* replay_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            seconds = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--script") == 0 && i + 1 < argc) {
+            script_path = argv[++i];
+        } else if (strcmp(argv[i], "--hashes") == 0 && i + 1 < argc) {
+            hash_path = argv[++i];
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            record_path = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replay_path = argv[++i];
+        } else {
+            printf("Usage: %s [--seconds N] [--script PATH | --replay LOG] [--record LOG] "
+                   "[--hashes PATH]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (script_path != NULL) {
+        if (!load_script(script_path)) return 2;
+    } else {
+        use_default_script();
+    }
+    s_period_ms = s_script[s_step_count - 1].at_ms;
+
+    if (hash_path != NULL && (s_hash_file = fopen(hash_path, "w")) == NULL) {
+        printf("sim: cannot write %s\n", hash_path);
+        return 2;
+    }
+
+    timing_set_source(&s_virtual_clock);
+    bcm2835_stub_set_input(sim_input);
+    gpio_init_all();
+    st7789_init();
+    fb_init();
+    fb_set_flush_mode(FB_FLUSH_DAMAGE);
+    game_init();
+    game_set_frame_hook(sim_frame);
+
+    if (record_path != NULL && !game_record_input(record_path)) {
+        printf("sim: cannot write %s\n", record_path);
+        return 2;
+    }
+    if (replay_path != NULL && !game_replay_input(replay_path)) {
+        printf("sim: cannot replay %s\n", replay_path);
+        return 2;
+    }
+
+    s_start_us = bcm2835_stub_now_us();
+    s_end_us = s_start_us + (uint64_t)seconds * 1000000ULL;
+    double wall_start = wall_seconds();
+
+    game_run();
+
+    double wall = wall_seconds() - wall_start;
+    double simulated = (double)(bcm2835_stub_now_us() - s_start_us) / 1e6;
+    game_shutdown();
+    fb_shutdown();
+    gpio_cleanup();
+    if (s_hash_file != NULL) fclose(s_hash_file);
+
+    printf("\nsim: %u frames, %.1f s simulated in %.3f s (%.0f frames/s, %.0fx real time)\n",
+           s_frames, simulated, wall, wall > 0.0 ? s_frames / wall : 0.0,
+           wall > 0.0 ? simulated / wall : 0.0);
+    printf("sim: run hash %016llx\n", (unsigned long long)s_run_hash);
+    return 0;
+}
@@ -0,0 +1,153 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "asset_pack.h"
+#include "lcd/bitmap_rle.h"
+#include "lcd/st7789.h"
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// RAW blobs must already be in frame buffer storage order
+#if defined(FB_WIRE_ORDER) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define ASSET_PACK_STORAGE_ORDER ASSET_PACK_ORDER_WIRE
+#else
+#define ASSET_PACK_STORAGE_ORDER ASSET_PACK_ORDER_LITTLE
+#endif
+
+typedef struct {
+    char name[ASSET_PACK_NAME_SIZE];
+    bitmap view;
+} asset_pack_item_t;
+
+static const uint8_t* s_map = NULL;
+static size_t s_map_size = 0;
+static asset_pack_item_t s_items[ASSET_PACK_MAX_ENTRIES];
+static uint16_t s_item_count = 0;
+
+// Decoders trust RLE streams, so each one is walked once before use
+static bool rle_valid(const asset_pack_entry_t* e) {
+    if (e->width == 0 || e->width > BITMAP_RLE_MAX_WIDTH ||
+        e->height == 0 || e->height > ST7789_HEIGHT) {
+        return false;
+    }
+
+    bitmap view = {
+        .width = e->width,
+        .height = e->height,
+        .format = BITMAP_RLE,
+        .data = s_map + e->offset,
+        .data_size = e->size
+    };
+    return bitmap_rle_validate(&view);
+}
+
+static bool entry_valid(const asset_pack_entry_t* e, uint8_t pixel_order) {
+    if (memchr(e->name, '\0', ASSET_PACK_NAME_SIZE) == NULL) {
+        return false;
+    }
+    if (e->offset > s_map_size || e->size > s_map_size - e->offset) {
+        return false;
+    }
+    if ((e->offset % sizeof(uint16_t)) != 0) {
+        return false;
+    }
+
+    switch (e->format) {
+        case BITMAP_RAW:
+            return pixel_order == ASSET_PACK_STORAGE_ORDER &&
+                   e->size == (uint32_t)e->width * e->height * sizeof(uint16_t);
+        case BITMAP_RLE:
+            return rle_valid(e);
+        default:
+            return false;
+    }
+}
+
+bool asset_pack_open(const char* path) {
+    asset_pack_close();
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(asset_pack_header_t)) {
+        close(fd);
+        return false;
+    }
+
+    void* map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+    s_map = map;
+    s_map_size = (size_t)st.st_size;
+
+    asset_pack_header_t header;
+    memcpy(&header, s_map, sizeof(header));
+    if (memcmp(header.magic, "RCAP", 4) != 0 || header.version != ASSET_PACK_VERSION ||
+        header.entry_count > ASSET_PACK_MAX_ENTRIES ||
+        header.index_offset > s_map_size ||
+        (size_t)header.entry_count * sizeof(asset_pack_entry_t) > s_map_size - header.index_offset) {
+        printf("Asset pack %s: invalid header\n", path);
+        asset_pack_close();
+        return false;
+    }
+
+    for (uint16_t i = 0; i < header.entry_count; i++) {
+        asset_pack_entry_t e;
+        memcpy(&e, s_map + header.index_offset + i * sizeof(e), sizeof(e));
+        if (!entry_valid(&e, header.pixel_order)) {
+            printf("Asset pack %s: skipping entry %u\n", path, i);
+            continue;
+        }
+
+        asset_pack_item_t* item = &s_items[s_item_count++];
+        memcpy(item->name, e.name, ASSET_PACK_NAME_SIZE);
+        item->view = (bitmap){
+            .width = e.width,
+            .height = e.height,
+            .format = e.format
+        };
+        if (e.format == BITMAP_RAW) {
+            // Read-only mapping: pixels must never be written through this view
+            item->view.bitmap = (uint16_t*)(uintptr_t)(s_map + e.offset);
+        } else {
+            item->view.data = s_map + e.offset;
+            item->view.data_size = e.size;
+        }
+    }
+    return true;
+}
+
+void asset_pack_close(void) {
+    if (s_map != NULL) {
+        munmap((void*)(uintptr_t)s_map, s_map_size);
+    }
+    s_map = NULL;
+    s_map_size = 0;
+    s_item_count = 0;
+}
+
+const bitmap* asset_pack_get(const char* name, const bitmap* fallback) {
+    for (uint16_t i = 0; i < s_item_count; i++) {
+        if (strcmp(s_items[i].name, name) == 0) {
+            return &s_items[i].view;
+        }
+    }
+    return fallback;
+}
+
+const bitmap* asset_pack_get_raw(const char* name, const bitmap* fallback) {
+    const bitmap* bmp = asset_pack_get(name, fallback);
+    return (bmp->format == BITMAP_RAW) ? bmp : fallback;
+}
+
+uint16_t asset_pack_count(void) {
+    return s_item_count;
+}
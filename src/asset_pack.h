@@ -0,0 +1,91 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../assets/images.h"
+
+/**
+ * @brief Binary asset pack (built by assets/mkpack.py, `make pack`)
+ *
+ * The pack is mapped read-only and its bitmaps are handed out as views
+ * into the mapping, without copying. Every lookup takes the compiled-in
+ * bitmap as fallback, so the game runs unchanged when no pack is present
+ * or a pack entry is missing or unusable. RLE streams are validated when
+ * the pack is opened; a damaged one falls back like a missing entry.
+ */
+
+// Default pack location (relative to the working directory)
+#ifndef ASSET_PACK_PATH
+#define ASSET_PACK_PATH "bin/assets.pack"
+#endif
+
+// Maximum number of bitmaps in a pack
+#define ASSET_PACK_MAX_ENTRIES 32
+
+#define ASSET_PACK_NAME_SIZE 32
+#define ASSET_PACK_VERSION   1
+
+// Pixel byte order of RAW blobs
+#define ASSET_PACK_ORDER_LITTLE 0
+#define ASSET_PACK_ORDER_WIRE   1
+
+// On-disk header (little-endian)
+typedef struct {
+    char magic[4];            // "RCAP"
+    uint16_t version;
+    uint16_t entry_count;
+    uint32_t index_offset;
+    uint32_t page_size;
+    uint8_t pixel_order;      // ASSET_PACK_ORDER_*
+    uint8_t reserved[15];
+} asset_pack_header_t;
+
+// On-disk index entry (little-endian)
+typedef struct {
+    char name[ASSET_PACK_NAME_SIZE];
+    uint16_t width;
+    uint16_t height;
+    uint8_t format;           // bitmap_format_t
+    uint8_t reserved[3];
+    uint32_t offset;          // Blob offset from start of file (page aligned)
+    uint32_t size;            // Blob size in bytes
+} asset_pack_entry_t;
+
+_Static_assert(sizeof(asset_pack_header_t) == 32, "asset pack header must be 32 bytes");
+_Static_assert(sizeof(asset_pack_entry_t) == 48, "asset pack entry must be 48 bytes");
+
+/**
+ * @brief Map an asset pack read-only
+ * @param path Pack file path
+ * @return true if the pack was mapped and its index is valid
+ */
+bool asset_pack_open(const char* path);
+
+/**
+ * @brief Unmap the pack (bitmap views become invalid)
+ */
+void asset_pack_close(void);
+
+/**
+ * @brief Look up a bitmap by name
+ * @param name Entry name (asset symbol prefix, e.g. "car_100x100")
+ * @param fallback Compiled-in bitmap returned if the pack has no usable entry
+ * @return Bitmap view into the pack, or fallback
+ */
+const bitmap* asset_pack_get(const char* name, const bitmap* fallback);
+
+/**
+ * @brief Look up an uncompressed bitmap (for rotation and sprites)
+ *
+ * Like asset_pack_get(), but returns fallback if the pack entry is not
+ * BITMAP_RAW.
+ */
+const bitmap* asset_pack_get_raw(const char* name, const bitmap* fallback);
+
+/**
+ * @brief Number of bitmaps served from the pack
+ */
+uint16_t asset_pack_count(void);
+
+#endif
@@ -0,0 +1,194 @@
+#include "frame_profiler.h"
+#include <stdio.h>
+#include <string.h>
+#include "lcd/st7789.h"
+
+// Log-linear buckets: values below 8 ns get one bucket each, above that
+// every power of two is split into 8 buckets
+#define PROF_SUB_BITS  3
+#define PROF_SUB_COUNT (1u << PROF_SUB_BITS)
+#define PROF_MAX_EXP   35  // Largest tracked value just under 2^36 ns (~68 s)
+#define PROF_BUCKETS   ((PROF_MAX_EXP - PROF_SUB_BITS + 2) * PROF_SUB_COUNT)
+
+typedef struct {
+    uint32_t buckets[PROF_BUCKETS];
+    uint32_t count;
+    uint64_t sum_ns;
+    uint64_t max_ns;
+} prof_hist_t;
+
+static const char* const s_stage_names[PROF_STAGE_COUNT] = {
+    "input", "physics", "collision", "render", "flush", "input_to_flush"
+};
+
+static prof_hist_t s_window[PROF_STAGE_COUNT];  // Since the last summary
+static prof_hist_t s_total[PROF_STAGE_COUNT];   // Since init
+
+static uint64_t s_pending_input_ns;  // Oldest input not yet flushed (0 = none)
+static uint64_t s_start_ns;
+static uint64_t s_window_start_ns;
+static uint32_t s_frames;
+static uint32_t s_window_frames;
+static st7789_spi_stats_t s_spi_start;
+static st7789_spi_stats_t s_spi_window_start;
+
+static uint32_t bucket_index(uint64_t ns) {
+    if (ns < PROF_SUB_COUNT) {
+        return (uint32_t)ns;
+    }
+    uint32_t exp = 63 - (uint32_t)__builtin_clzll(ns);
+    if (exp > PROF_MAX_EXP) {
+        return PROF_BUCKETS - 1;
+    }
+    uint32_t sub = (uint32_t)(ns >> (exp - PROF_SUB_BITS)) & (PROF_SUB_COUNT - 1);
+    return (exp - PROF_SUB_BITS + 1) * PROF_SUB_COUNT + sub;
+}
+
+static uint64_t bucket_lower(uint32_t index) {
+    if (index < PROF_SUB_COUNT) {
+        return index;
+    }
+    uint32_t exp = index / PROF_SUB_COUNT + PROF_SUB_BITS - 1;
+    uint64_t sub = index % PROF_SUB_COUNT;
+    return (PROF_SUB_COUNT + sub) << (exp - PROF_SUB_BITS);
+}
+
+static uint64_t bucket_upper(uint32_t index) {
+    return (index + 1 < PROF_BUCKETS) ? bucket_lower(index + 1) - 1 : UINT64_MAX;
+}
+
+static void hist_add(prof_hist_t* h, uint64_t ns) {
+    h->buckets[bucket_index(ns)]++;
+    h->count++;
+    h->sum_ns += ns;
+    if (ns > h->max_ns) {
+        h->max_ns = ns;
+    }
+}
+
+static uint64_t hist_percentile(const prof_hist_t* h, uint32_t pct) {
+    if (h->count == 0) {
+        return 0;
+    }
+
+    // Rank of the sample at the percentile (1-based, rounded up)
+    uint64_t rank = ((uint64_t)h->count * pct + 99) / 100;
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < PROF_BUCKETS; i++) {
+        seen += h->buckets[i];
+        if (seen >= rank) {
+            uint64_t upper = bucket_upper(i);
+            return (upper < h->max_ns) ? upper : h->max_ns;
+        }
+    }
+    return h->max_ns;
+}
+
+void frame_profiler_init(void) {
+    memset(s_window, 0, sizeof(s_window));
+    memset(s_total, 0, sizeof(s_total));
+    s_pending_input_ns = 0;
+    s_start_ns = s_window_start_ns = timing_now_ns();
+    s_frames = s_window_frames = 0;
+    s_spi_start = s_spi_window_start = st7789_get_spi_stats();
+}
+
+void frame_profiler_record(prof_stage_t stage, uint64_t ns) {
+    hist_add(&s_window[stage], ns);
+    hist_add(&s_total[stage], ns);
+}
+
+void frame_profiler_mark_input(void) {
+    if (s_pending_input_ns == 0) {
+        s_pending_input_ns = timing_now_ns();
+    }
+}
+
+static void print_summary(uint64_t now_ns) {
+    st7789_spi_stats_t spi = st7789_get_spi_stats();
+    uint32_t bytes = spi.bytes - s_spi_window_start.bytes;
+    uint32_t commands = spi.commands - s_spi_window_start.commands;
+    double seconds = (double)(now_ns - s_window_start_ns) / 1e9;
+    uint32_t frames = s_window_frames ? s_window_frames : 1;
+
+    printf("[profile] %.1f s: %u frames (%.1f fps), SPI %.1f KB/frame, %.1f cmds/frame\n",
+           seconds, s_window_frames, s_window_frames / seconds,
+           bytes / 1024.0 / frames, (double)commands / frames);
+    for (int i = 0; i < PROF_STAGE_COUNT; i++) {
+        const prof_hist_t* h = &s_window[i];
+        printf("[profile]   %-15s n=%-6u p50 %8.1f  p95 %8.1f  p99 %8.1f  max %8.1f us\n",
+               s_stage_names[i], h->count,
+               hist_percentile(h, 50) / 1e3, hist_percentile(h, 95) / 1e3,
+               hist_percentile(h, 99) / 1e3, h->max_ns / 1e3);
+    }
+}
+
+void frame_profiler_frame_done(void) {
+    uint64_t now = timing_now_ns();
+
+    if (s_pending_input_ns != 0) {
+        frame_profiler_record(PROF_STAGE_LATENCY, now - s_pending_input_ns);
+        s_pending_input_ns = 0;
+    }
+    s_frames++;
+    s_window_frames++;
+
+    if (now - s_window_start_ns >= (uint64_t)FRAME_PROFILE_REPORT_US * 1000) {
+        print_summary(now);
+        frame_profiler_dump(FRAME_PROFILE_DUMP_PATH);
+
+        memset(s_window, 0, sizeof(s_window));
+        s_window_frames = 0;
+        s_window_start_ns = timing_now_ns();
+        s_spi_window_start = st7789_get_spi_stats();
+    }
+}
+
+bool frame_profiler_dump(const char* path) {
+    FILE* f = fopen(path, "w");
+    if (f == NULL) {
+        return false;
+    }
+
+    st7789_spi_stats_t spi = st7789_get_spi_stats();
+    fprintf(f, "{\n  \"elapsed_ns\": %llu,\n  \"frames\": %u,\n",
+            (unsigned long long)(timing_now_ns() - s_start_ns), s_frames);
+    fprintf(f, "  \"spi\": {\"bytes\": %u, \"commands\": %u, \"transfers\": %u},\n",
+            spi.bytes - s_spi_start.bytes, spi.commands - s_spi_start.commands,
+            spi.transfers - s_spi_start.transfers);
+    fprintf(f, "  \"stages\": {\n");
+
+    for (int i = 0; i < PROF_STAGE_COUNT; i++) {
+        const prof_hist_t* h = &s_total[i];
+        fprintf(f, "    \"%s\": {\"count\": %u, \"mean_ns\": %llu, \"p50_ns\": %llu, "
+                   "\"p95_ns\": %llu, \"p99_ns\": %llu, \"max_ns\": %llu,\n",
+                s_stage_names[i], h->count,
+                (unsigned long long)(h->count ? h->sum_ns / h->count : 0),
+                (unsigned long long)hist_percentile(h, 50),
+                (unsigned long long)hist_percentile(h, 95),
+                (unsigned long long)hist_percentile(h, 99),
+                (unsigned long long)h->max_ns);
+
+        // Non-empty buckets as [lower_ns, count]
+        fprintf(f, "      \"histogram\": [");
+        bool first = true;
+        for (uint32_t b = 0; b < PROF_BUCKETS; b++) {
+            if (h->buckets[b] == 0) continue;
+            fprintf(f, "%s[%llu, %u]", first ? "" : ", ",
+                    (unsigned long long)bucket_lower(b), h->buckets[b]);
+            first = false;
+        }
+        fprintf(f, "]}%s\n", (i + 1 < PROF_STAGE_COUNT) ? "," : "");
+    }
+
+    fprintf(f, "  }\n}\n");
+    return fclose(f) == 0;
+}
+
+uint64_t frame_profiler_percentile(prof_stage_t stage, uint32_t pct) {
+    return hist_percentile(&s_total[stage], pct);
+}
@@ -0,0 +1,97 @@
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+/**
+ * @brief Per-stage frame timing (build with `make PROFILE=1`)
+ *
+ * Each stage of the frame pipeline is timed with the monotonic clock and
+ * recorded in a log-bucketed histogram (8 buckets per power of two, so
+ * percentiles are within 12.5%). A summary with p50/p95/p99 per stage is
+ * printed every FRAME_PROFILE_REPORT_US, and cumulative results are
+ * written as JSON to FRAME_PROFILE_DUMP_PATH.
+ *
+ * Without FRAME_PROFILE the macros below expand to the bare statements
+ * and no profiler code is compiled.
+ */
+
+#ifdef FRAME_PROFILE
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "common/timing.h"
+
+// Summary interval
+#ifndef FRAME_PROFILE_REPORT_US
+#define FRAME_PROFILE_REPORT_US 5000000
+#endif
+
+// Machine-readable results (rewritten with every summary and at exit)
+#ifndef FRAME_PROFILE_DUMP_PATH
+#define FRAME_PROFILE_DUMP_PATH "bin/frame_profile.json"
+#endif
+
+typedef enum {
+    PROF_STAGE_INPUT,       // process_input()
+    PROF_STAGE_PHYSICS,     // car_physics_update()
+    PROF_STAGE_COLLISION,   // check_obstacle_collision()
+    PROF_STAGE_RENDER,      // draw_game() up to the flush
+    PROF_STAGE_FLUSH,       // fb_flush()
+    PROF_STAGE_LATENCY,     // Oldest undisplayed input sample to flush return
+    PROF_STAGE_COUNT
+} prof_stage_t;
+
+/**
+ * @brief Reset all histograms and counters
+ */
+void frame_profiler_init(void);
+
+/**
+ * @brief Add one sample to a stage
+ */
+void frame_profiler_record(prof_stage_t stage, uint64_t ns);
+
+/**
+ * @brief Note that input was sampled (start of input-to-flush latency)
+ */
+void frame_profiler_mark_input(void);
+
+/**
+ * @brief Close a frame after its flush; prints a summary when one is due
+ */
+void frame_profiler_frame_done(void);
+
+/**
+ * @brief Write cumulative results as JSON
+ * @return false if the file could not be written
+ */
+bool frame_profiler_dump(const char* path);
+
+/**
+ * @brief Percentile of a stage's cumulative histogram
+ * @param pct Percentile (0-100)
+ * @return Upper bound of the bucket holding the percentile, in ns
+ */
+uint64_t frame_profiler_percentile(prof_stage_t stage, uint32_t pct);
+
+#define PROF_BEGIN(name)          uint64_t prof_##name = timing_now_ns()
+#define PROF_END(name, stage)     frame_profiler_record(stage, timing_now_ns() - prof_##name)
+#define PROF_TIME(stage, ...)     do {                                              \
+                                      uint64_t prof_t0_ = timing_now_ns();          \
+                                      __VA_ARGS__;                                  \
+                                      frame_profiler_record(stage, timing_now_ns() - prof_t0_); \
+                                  } while (0)
+
+#else
+
+#define PROF_BEGIN(name)
+#define PROF_END(name, stage)
+#define PROF_TIME(stage, ...)     do { __VA_ARGS__; } while (0)
+
+#define frame_profiler_init()         ((void)0)
+#define frame_profiler_mark_input()   ((void)0)
+#define frame_profiler_frame_done()   ((void)0)
+#define frame_profiler_dump(path)     ((void)0)
+
+#endif // FRAME_PROFILE
+
+#endif
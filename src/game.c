@@ -0,0 +1,692 @@
+#include "game.h"
+#include <stdio.h>
+#include <signal.h>
+#include "common/gpio_init.h"
+#include "common/timing.h"
+#include "lcd/st7789.h"
+#include "lcd/framebuffer.h"
+#include "lcd/rot_cache.h"
+#include "input/button.h"
+#include "input/joystick.h"
+#include "input/input_snapshot.h"
+#include "input/debounce.h"
+#include "input/input_sampler.h"
+#include "game/car_physics.h"
+#include "game/collision.h"
+#include "maps/map_types.h"
+#include "maps/easy_map.h"
+#include "maps/hard_map.h"
+#include "maps/map_layer.h"
+#include "maps/obstacle_grid.h"
+#include "asset_pack.h"
+#include "input_log.h"
+#include "frame_profiler.h"
+#include "../assets/images.h"
+#include "../assets/car.h"
+#include "../assets/handle.h"
+#include "../assets/intro.h"
+#include "../assets/obstacle.h"
+#include "../assets/game_over.h"
+#include "../assets/complete.h"
+
+// Cleared by game_stop() (signal handler or simulator)
+static volatile sig_atomic_t g_running = 1;
+
+// Called after every presented frame (NULL when nobody observes frames)
+static game_frame_hook_t s_frame_hook = NULL;
+
+// Current map config pointer
+static const map_config_t* g_current_map = NULL;
+
+// Car hitbox size (actual car bounds within bitmap)
+#define CAR_HITBOX_WIDTH  25
+#define CAR_HITBOX_HEIGHT 45 
+
+// Handle bitmap size and position constants
+#define HANDLE_WIDTH  80
+#define HANDLE_HEIGHT 80
+#define HANDLE_X      (HANDLE_WIDTH / 2)              // Handle center X (left side)
+#define HANDLE_Y      (ST7789_HEIGHT - HANDLE_HEIGHT / 2)  // Handle center Y (bottom)
+
+// Transparent color for bitmaps
+#define TRANSPARENT_COLOR 0x0000
+
+// Debug hitbox colors
+#define DEBUG_COLOR_PLAYER   0x001F  // Blue
+#define DEBUG_COLOR_OBSTACLE 0xF800  // Red
+#define DEBUG_COLOR_GOAL     0x07E0  // Green
+
+// Obstacle hitbox constants
+#define OBSTACLE_HITBOX_WIDTH  35
+#define OBSTACLE_HITBOX_HEIGHT 55
+
+// Collision boxes (half extents): SAT broadphase around every opaque
+// pixel of the sprite, refined by the sprites' pixel masks. The hitboxes
+// above are used until the sprites are cached, and decide a hit when the
+// masks are not available.
+typedef struct {
+    int16_t half_w;
+    int16_t half_h;
+} collision_box_t;
+
+static collision_box_t s_car_box = { CAR_HITBOX_WIDTH / 2, CAR_HITBOX_HEIGHT / 2 };
+static collision_box_t s_obstacle_box = { OBSTACLE_HITBOX_WIDTH / 2, OBSTACLE_HITBOX_HEIGHT / 2 };
+
+// Timing constants
+#define GOAL_SUCCESS_DELAY 5000  // 5초 (ms)
+
+// Game state enum
+typedef enum {
+    GAME_STATE_INTRO,
+    GAME_STATE_PLAYING,
+    GAME_STATE_GAMEOVER,
+    GAME_STATE_GOAL_SUCCESS
+} game_state_t;
+
+// Car state (physics-based)
+static car_state_t g_car;
+
+// Physics parameters (from the log header when replaying)
+static const car_physics_params_t* s_car_params = &default_car_params;
+
+// Tick input comes from the background sampler (game_use_input_sampler())
+static bool s_use_sampler = false;
+
+_Static_assert(INPUT_WEIGHT_FULL == CAR_WEIGHT_FULL, "input and physics weights must agree");
+
+// Handle angle for UI (-45 ~ +45 degrees)
+static int16_t g_handle_angle = 0;
+#define HANDLE_ANGLE_MAX 45
+#define HANDLE_ANGLE_RETURN_SPEED 5
+
+// Game loop timing: physics runs at a fixed rate, rendering follows
+#define PHYSICS_TICK_US        10000  // 100 Hz
+#define PHYSICS_MAX_CATCHUP    10     // Ticks per frame before the backlog is dropped
+#ifndef RENDER_FPS_CAP
+#define RENDER_FPS_CAP         0      // 0 = render after every tick the display keeps up with
+#endif
+
+// Game state
+static game_state_t g_game_state = GAME_STATE_INTRO;
+
+// Sprite placement as drawn in the previous frame (for partial redraw)
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int16_t angle;
+    fb_rect_t bounds;
+    bool visible;
+} drawn_sprite_t;
+
+// Bitmaps in use: compiled-in by default, replaced by asset pack entries
+static const bitmap* s_car_bitmap = &car_100x100_bitmap;
+static const bitmap* s_handle_bitmap = &handle_80x80_bitmap;
+static const bitmap* s_obstacle_bitmap = &obstacle_75x75_bitmap;
+static const bitmap* s_intro_bitmap = &intro_240x240_bitmap;
+static const bitmap* s_game_over_bitmap = &game_over_240x240_bitmap;
+static const bitmap* s_complete_bitmap = &complete_240x240_bitmap;
+
+// Scene needs a full background redraw (map changed or screen replaced)
+static bool s_scene_dirty = true;
+static drawn_sprite_t s_drawn_car;
+static drawn_sprite_t s_drawn_handle;
+
+// Map the asset pack if present; missing entries keep the built-in bitmaps
+static void load_assets(void) {
+    if (asset_pack_open(ASSET_PACK_PATH)) {
+        printf("Asset pack %s: %u bitmaps\n", ASSET_PACK_PATH, asset_pack_count());
+    } else {
+        printf("Using built-in assets\n");
+    }
+
+    // Rotated sprites need uncompressed pixels
+    s_car_bitmap = asset_pack_get_raw("car_100x100", &car_100x100_bitmap);
+    s_handle_bitmap = asset_pack_get_raw("handle_80x80", &handle_80x80_bitmap);
+    s_obstacle_bitmap = asset_pack_get_raw("obstacle_75x75", &obstacle_75x75_bitmap);
+    s_intro_bitmap = asset_pack_get("intro_240x240", &intro_240x240_bitmap);
+    s_game_over_bitmap = asset_pack_get("game_over_240x240", &game_over_240x240_bitmap);
+    s_complete_bitmap = asset_pack_get("complete_240x240", &complete_240x240_bitmap);
+}
+
+// Send the finished frame to the display and notify the frame observer
+static void present_frame(void) {
+    PROF_TIME(PROF_STAGE_FLUSH, fb_flush());
+    if (s_frame_hook) s_frame_hook();
+}
+
+// Narrow phase: car and obstacle sprites share an opaque pixel
+bool game_sprites_overlap(const obstacle_t* obs, void* ctx) {
+    const obb_t* car = ctx;
+    bool overlap;
+    if (rot_cache_sprites_overlap(s_car_bitmap, car->cx, car->cy, car->angle,
+                                  s_obstacle_bitmap, obs->x, obs->y, obs->angle,
+                                  TRANSPARENT_COLOR, &overlap)) {
+        return overlap;
+    }
+
+    // No masks: the hand-tuned hitboxes decide, not the enlarged broadphase
+    obb_t car_hitbox = { car->cx, car->cy, CAR_HITBOX_WIDTH / 2, CAR_HITBOX_HEIGHT / 2, car->angle };
+    obb_t obstacle_hitbox = {
+        obs->x, obs->y, OBSTACLE_HITBOX_WIDTH / 2, OBSTACLE_HITBOX_HEIGHT / 2, obs->angle
+    };
+    return check_collision_obb_obb(&car_hitbox, &obstacle_hitbox);
+}
+
+// Check collision with any active obstacle (SAT, then pixel masks)
+bool check_obstacle_collision(void) {
+    if (!g_current_map) return false;
+
+    int16_t car_x = car_get_screen_x(&g_car);
+    int16_t car_y = car_get_screen_y(&g_car);
+
+    obb_t player_obb = {
+        .cx = car_x,
+        .cy = car_y,
+        .half_w = s_car_box.half_w,
+        .half_h = s_car_box.half_h,
+        .angle = g_car.angle
+    };
+
+    // Only obstacles in the grid cells around the car are tested
+    return obstacle_grid_collides_narrow(&player_obb, game_sprites_overlap, &player_obb);
+}
+
+// Check if car reached the goal (player must fully cover the goal area)
+bool check_goal_reached(void) {
+    if (!g_current_map) return false;
+
+    aabb_t player = {
+        .cx = car_get_screen_x(&g_car),
+        .cy = car_get_screen_y(&g_car),
+        .half_w = CAR_HITBOX_WIDTH / 2,
+        .half_h = CAR_HITBOX_HEIGHT / 2
+    };
+
+    aabb_t goal = {
+        .cx = g_current_map->goal_x,
+        .cy = g_current_map->goal_y,
+        .half_w = g_current_map->goal_width / 2,
+        .half_h = g_current_map->goal_height / 2
+    };
+
+    return (player.cx - player.half_w <= goal.cx - goal.half_w &&
+            player.cx + player.half_w >= goal.cx + goal.half_w &&
+            player.cy - player.half_h <= goal.cy - goal.half_h &&
+            player.cy + player.half_h >= goal.cy + goal.half_h);
+}
+
+// Show game over screen
+void show_game_over_screen(void) {
+    fb_draw_bitmap(0, 0, s_game_over_bitmap);
+    present_frame();
+    printf("GAME OVER! Press any button to restart.\n");
+}
+
+// Wait until one of `keys` is pressed and released again, sampling input
+// every physics tick. A key already held when the wait starts does not
+// count. Returns the key, or 0 if the game is stopping.
+static uint8_t wait_for_click(uint8_t keys) {
+    uint64_t deadline = timing_now_us();
+    uint8_t armed = 0;
+
+    while (g_running) {
+        const debounce_t* input = input_poll();
+        armed |= input->pressed & keys;
+
+        uint8_t clicked = input->released & armed;
+        if (clicked) {
+            return clicked & (uint8_t)-clicked;
+        }
+
+        deadline += PHYSICS_TICK_US;
+        timing_sleep_until_us(deadline);
+    }
+    return 0;
+}
+
+// Wait for ms while still sampling input every physics tick, so a stop
+// request ends the wait. Returns false if the game is stopping.
+static bool wait_for_delay(uint32_t ms) {
+    uint64_t deadline = timing_now_us();
+    uint64_t end = deadline + (uint64_t)ms * 1000;
+
+    while (g_running && deadline < end) {
+        input_poll();
+        deadline += PHYSICS_TICK_US;
+        timing_sleep_until_us(deadline);
+    }
+    return g_running;
+}
+
+// Restart game to intro
+void restart_game(void) {
+    g_game_state = GAME_STATE_INTRO;
+    g_current_map = NULL;
+}
+
+void show_intro_screen(void) {
+    fb_draw_bitmap(0, 0, s_intro_bitmap);
+    present_frame();
+}
+
+// The map starts once its button is released, so the car does not
+// accelerate from the selection press
+map_type_t wait_for_map_selection(void) {
+    uint8_t key = wait_for_click(INPUT_KEY_A | INPUT_KEY_B);
+    return (key == INPUT_KEY_B) ? MAP_HARD : MAP_EASY;  // Easy if interrupted
+}
+
+void set_current_map(map_type_t map) {
+    g_current_map = (map == MAP_EASY) ?
+        get_easy_map_config() : get_hard_map_config();
+    s_scene_dirty = true;
+
+    // Background and obstacles are composited and indexed once per map
+    map_layer_sync(g_current_map);
+    obstacle_grid_build(g_current_map, 2 * s_obstacle_box.half_w, 2 * s_obstacle_box.half_h);
+
+    // Obstacle masks at the map's angles, ready for the first collision test
+    for (int i = 0; i < g_current_map->obstacle_count; i++) {
+        rot_cache_prewarm(s_obstacle_bitmap, g_current_map->obstacles[i].angle, TRANSPARENT_COLOR);
+    }
+    printf("Selected: %s Map (with %d obstacles)\n",
+           (map == MAP_EASY) ? "Easy" : "Hard",
+           g_current_map->obstacle_count);
+}
+
+// Draw debug hitboxes for player, obstacles, and goal
+static void draw_debug_hitboxes(int16_t car_cx, int16_t car_cy) {
+    // Player hitbox (Blue)
+    fb_draw_rotated_rect_outline(car_cx, car_cy, s_car_box.half_w, s_car_box.half_h,
+                                  g_car.angle, DEBUG_COLOR_PLAYER);
+
+    // Obstacle hitboxes (Red), rotated with the obstacle
+    const obstacle_t* obstacles = g_current_map->obstacles;
+    int count = g_current_map->obstacle_count;
+    for (int i = 0; i < count; i++) {
+        if (obstacles[i].active) {
+            const obb_t* box = obstacle_grid_hitbox(i);
+            fb_draw_rotated_rect_outline(box->cx, box->cy, box->half_w, box->half_h,
+                                         box->angle, DEBUG_COLOR_OBSTACLE);
+        }
+    }
+
+    // Goal area (Green)
+    fb_draw_rect_outline(g_current_map->goal_x, g_current_map->goal_y,
+                         g_current_map->goal_width, g_current_map->goal_height,
+                         DEBUG_COLOR_GOAL);
+}
+
+static bool sprite_moved(const drawn_sprite_t* drawn, int16_t x, int16_t y, int16_t angle) {
+    return (drawn->x != x || drawn->y != y || drawn->angle != angle);
+}
+
+// Erase a sprite drawn last frame by restoring the static map layer underneath
+static void erase_sprite(const drawn_sprite_t* drawn) {
+    if (drawn->visible) {
+        fb_restore_bitmap_region(map_layer_bitmap(), &drawn->bounds);
+    }
+}
+
+static void draw_sprite(drawn_sprite_t* drawn, int16_t x, int16_t y,
+                        const bitmap* bmp, int16_t angle) {
+    rot_cache_draw(x, y, bmp, angle, TRANSPARENT_COLOR);
+    drawn->x = x;
+    drawn->y = y;
+    drawn->angle = angle;
+    drawn->visible = rot_cache_get_bounds(x, y, bmp, angle, TRANSPARENT_COLOR, &drawn->bounds);
+}
+
+// Redraw a sprite if it moved or anything under it was redrawn this frame
+static void update_sprite(drawn_sprite_t* drawn, bool moved, int16_t x, int16_t y,
+                          const bitmap* bmp, int16_t angle) {
+    if (moved || (drawn->visible && fb_is_dirty(&drawn->bounds))) {
+        draw_sprite(drawn, x, y, bmp, angle);
+    }
+}
+
+void draw_game(void) {
+    if (!g_current_map) return;
+    PROF_BEGIN(render);
+
+    // Rebuild the static layer if an obstacle was enabled or disabled
+    if (map_layer_sync(g_current_map)) {
+        s_scene_dirty = true;
+    }
+
+    int16_t car_cx = car_get_screen_x(&g_car);
+    int16_t car_cy = car_get_screen_y(&g_car);
+    bool car_moved = s_scene_dirty ||
+        sprite_moved(&s_drawn_car, car_cx, car_cy, g_car.angle);
+    bool handle_moved = s_scene_dirty ||
+        sprite_moved(&s_drawn_handle, HANDLE_X, HANDLE_Y, g_handle_angle);
+
+    // Static layer (map + obstacles): whole layer on a scene change,
+    // otherwise erase moved sprites only
+    if (s_scene_dirty) {
+        fb_draw_bitmap(0, 0, map_layer_bitmap());
+    } else {
+        if (car_moved) erase_sprite(&s_drawn_car);
+        if (handle_moved) erase_sprite(&s_drawn_handle);
+    }
+
+    // Car and handle in z-order, each redrawn if its area changed
+    update_sprite(&s_drawn_car, car_moved, car_cx, car_cy,
+                  s_car_bitmap, g_car.angle);
+    update_sprite(&s_drawn_handle, handle_moved, HANDLE_X, HANDLE_Y,
+                  s_handle_bitmap, g_handle_angle);
+    s_scene_dirty = false;
+
+#ifdef DEBUG
+    // Debug: Draw hitbox outlines (outlines are not tracked, redraw all next frame)
+    draw_debug_hitboxes(car_cx, car_cy);
+    s_scene_dirty = true;
+#endif
+
+    PROF_END(render, PROF_STAGE_RENDER);
+    present_frame();
+}
+
+// Return handle to center gradually
+static void update_handle_return(void) {
+    if (g_handle_angle > 0) {
+        g_handle_angle -= HANDLE_ANGLE_RETURN_SPEED;
+        if (g_handle_angle < 0) g_handle_angle = 0;
+    } else if (g_handle_angle < 0) {
+        g_handle_angle += HANDLE_ANGLE_RETURN_SPEED;
+        if (g_handle_angle > 0) g_handle_angle = 0;
+    }
+}
+
+// Input for the physics tick ending at tick_end_us: from the log when
+// replaying, otherwise sampled (and logged when recording). Returns false
+// if the tick should not run: the replay has ended or a stop was
+// requested while sampling.
+static bool next_tick_input(uint64_t tick_end_us, input_tick_t* tick) {
+    input_tick_from_keys(tick, 0);
+    if (input_log_mode() == INPUT_LOG_REPLAY) {
+        if (!input_log_read_tick(tick)) {
+            printf("Replay finished\n");
+            return false;
+        }
+        return true;
+    }
+
+    if (s_use_sampler) {
+        input_sampler_collect(tick_end_us, tick);
+    } else {
+        input_tick_from_keys(tick, input_poll()->state);
+    }
+    if (!g_running) {
+        return false;
+    }
+    input_log_write_tick(tick);
+    return true;
+}
+
+// Keys held for part of the tick act for that part of it
+void process_input(const input_tick_t* tick) {
+    uint8_t keys = tick->keys;
+
+    // Acceleration
+    if (keys & INPUT_KEY_A) {
+        car_apply_acceleration_weighted(&g_car, s_car_params, true,
+                                        input_tick_weight(tick, INPUT_KEY_A));
+    } else if (keys & INPUT_KEY_B) {
+        car_apply_acceleration_weighted(&g_car, s_car_params, false,
+                                        input_tick_weight(tick, INPUT_KEY_B));
+    }
+
+    // Brake
+    if (keys & INPUT_KEY_DOWN) {
+        car_apply_brake_weighted(&g_car, s_car_params, input_tick_weight(tick, INPUT_KEY_DOWN));
+    }
+
+    // Steering
+    if (keys & INPUT_KEY_LEFT) {
+        car_apply_turn_weighted(&g_car, s_car_params, -1, input_tick_weight(tick, INPUT_KEY_LEFT));
+        g_handle_angle = -HANDLE_ANGLE_MAX;
+    } else if (keys & INPUT_KEY_RIGHT) {
+        car_apply_turn_weighted(&g_car, s_car_params, +1, input_tick_weight(tick, INPUT_KEY_RIGHT));
+        g_handle_angle = HANDLE_ANGLE_MAX;
+    } else {
+        update_handle_return();
+    }
+}
+
+void update_game(uint64_t tick_end_us) {
+    // Process player input
+    input_tick_t input;
+    frame_profiler_mark_input();
+    PROF_BEGIN(input);
+    if (!next_tick_input(tick_end_us, &input)) {
+        game_stop();
+        return;
+    }
+    process_input(&input);
+    PROF_END(input, PROF_STAGE_INPUT);
+
+    // Update physics
+    PROF_TIME(PROF_STAGE_PHYSICS, car_physics_update(&g_car, s_car_params));
+
+    // Keep car within screen boundaries (use hitbox size, not bitmap size)
+    car_clamp_to_screen(&g_car, ST7789_WIDTH, ST7789_HEIGHT, CAR_HITBOX_WIDTH, CAR_HITBOX_HEIGHT);
+
+    // Check obstacle collision
+    bool collided;
+    PROF_TIME(PROF_STAGE_COLLISION, collided = check_obstacle_collision());
+    if (g_game_state == GAME_STATE_PLAYING && collided) {
+        printf("Collision detected!\n");
+        g_game_state = GAME_STATE_GAMEOVER;
+        return;
+    }
+
+    // Check goal reached (Easy map only)
+    if (g_game_state == GAME_STATE_PLAYING && check_goal_reached()) {
+        printf("Goal reached!\n");
+        g_game_state = GAME_STATE_GOAL_SUCCESS;
+        return;
+    }
+}
+
+// Put the car on the start of a map. A replay takes the map from the
+// next session in the log; returns false when there is none.
+static bool start_session(map_type_t map) {
+    if (input_log_mode() == INPUT_LOG_REPLAY) {
+        uint8_t logged;
+        if (!input_log_next_session(&logged)) {
+            printf("Replay finished\n");
+            game_stop();
+            return false;
+        }
+        map = (map_type_t)logged;
+    }
+
+    set_current_map(map);
+    input_log_begin_session((uint8_t)map);
+    car_physics_init(&g_car, g_current_map->start_x, g_current_map->start_y, 0);
+    g_handle_angle = 0;
+    return true;
+}
+
+// State handler: INTRO
+static void handle_state_intro(void) {
+    printf("\n=== RaspberryParking ===\n");
+    printf("Press A for Easy Map, B for Hard Map\n");
+    show_intro_screen();
+
+    map_type_t selected_map = MAP_EASY;
+    if (input_log_mode() != INPUT_LOG_REPLAY) {
+        selected_map = wait_for_map_selection();
+        if (!g_running) return;
+    }
+    if (!start_session(selected_map)) return;
+
+    printf("\n=== Game Controls ===\n");
+    printf("A button: Accelerate forward\n");
+    printf("B button: Accelerate backward (reverse)\n");
+    printf("Joystick left/right: Steer\n");
+    printf("Joystick down: Brake\n");
+    printf("Press Ctrl+C to exit\n\n");
+
+    g_game_state = GAME_STATE_PLAYING;
+    draw_game();
+}
+
+// State handler: PLAYING
+// Physics ticks on a fixed schedule; a frame is drawn once the ticks due
+// have run, so game speed does not depend on render or flush time.
+static void handle_state_playing(void) {
+    uint64_t start_us = timing_now_us();
+    if (s_use_sampler) {
+        input_sampler_skip(start_us);
+    }
+
+    timing_stepper_t physics;
+    timing_stepper_init(&physics, start_us + PHYSICS_TICK_US,
+                        PHYSICS_TICK_US, PHYSICS_MAX_CATCHUP);
+#if RENDER_FPS_CAP > 0
+    uint64_t next_frame = 0;
+#endif
+
+    while (g_running && g_game_state == GAME_STATE_PLAYING) {
+        uint32_t ticks = timing_stepper_advance(&physics, timing_now_us());
+        uint64_t tick_end_us = physics.next_us - (uint64_t)ticks * PHYSICS_TICK_US;
+        while (ticks-- > 0 && g_running && g_game_state == GAME_STATE_PLAYING) {
+            update_game(tick_end_us);
+            tick_end_us += PHYSICS_TICK_US;
+        }
+        if (!g_running || g_game_state != GAME_STATE_PLAYING) break;
+
+#if RENDER_FPS_CAP > 0
+        uint64_t now = timing_now_us();
+        if (now >= next_frame) {
+            draw_game();
+            frame_profiler_frame_done();
+            next_frame += 1000000 / RENDER_FPS_CAP;
+            if (next_frame < now) next_frame = now;
+        }
+#else
+        draw_game();
+        frame_profiler_frame_done();
+#endif
+
+        // Nothing changes before the next tick
+        timing_sleep_until_us(physics.next_us);
+    }
+
+    input_log_end_session();
+    if (physics.dropped > 0) {
+        printf("Physics fell behind: %u ticks dropped\n", physics.dropped);
+    }
+}
+
+// State handler: GAMEOVER
+static void handle_state_gameover(void) {
+    show_game_over_screen();
+
+    // A replay restarts right away if the log has another session
+    if (input_log_mode() == INPUT_LOG_REPLAY && !input_log_has_session()) {
+        printf("Replay finished\n");
+        game_stop();
+    }
+    if (input_log_mode() != INPUT_LOG_REPLAY) {
+        wait_for_click(INPUT_KEY_ANY);
+    }
+
+    if (g_running) {
+        restart_game();
+    }
+}
+
+// State handler: GOAL_SUCCESS
+static void handle_state_goal_success(void) {
+    draw_game();
+
+    bool is_easy = (g_current_map == get_easy_map_config());
+    if (is_easy) {
+        printf("Switching to Hard Map in 5 seconds...\n");
+        if (!wait_for_delay(GOAL_SUCCESS_DELAY)) return;
+
+        if (!start_session(MAP_HARD)) return;
+
+        g_game_state = GAME_STATE_PLAYING;
+        draw_game();
+    } else {
+        printf("SUCCESS! Returning to intro in 5 seconds...\n");
+        fb_draw_bitmap(0, 0, s_complete_bitmap);
+        present_frame();
+        if (!wait_for_delay(GOAL_SUCCESS_DELAY)) return;
+
+        g_game_state = GAME_STATE_INTRO;
+        g_current_map = NULL;
+    }
+}
+
+void game_init(void) {
+    load_assets();
+    rot_cache_init();
+    rot_cache_prewarm(s_car_bitmap, 0, TRANSPARENT_COLOR);
+    rot_cache_prewarm(s_handle_bitmap, 0, TRANSPARENT_COLOR);
+    rot_cache_get_hitbox(s_car_bitmap, TRANSPARENT_COLOR, &s_car_box.half_w, &s_car_box.half_h);
+    rot_cache_get_hitbox(s_obstacle_bitmap, TRANSPARENT_COLOR,
+                         &s_obstacle_box.half_w, &s_obstacle_box.half_h);
+    frame_profiler_init();
+
+    g_running = 1;
+    g_game_state = GAME_STATE_INTRO;
+    g_current_map = NULL;
+    s_scene_dirty = true;
+}
+
+void game_run(void) {
+    while (g_running) {
+        switch (g_game_state) {
+            case GAME_STATE_INTRO:
+                handle_state_intro();
+                break;
+            case GAME_STATE_PLAYING:
+                handle_state_playing();
+                break;
+            case GAME_STATE_GAMEOVER:
+                handle_state_gameover();
+                break;
+            case GAME_STATE_GOAL_SUCCESS:
+                handle_state_goal_success();
+                break;
+        }
+    }
+}
+
+void game_stop(void) {
+    g_running = 0;
+}
+
+void game_shutdown(void) {
+    input_sampler_stop();
+    frame_profiler_dump(FRAME_PROFILE_DUMP_PATH);
+    input_log_close();
+    asset_pack_close();
+}
+
+bool game_record_input(const char* path) {
+    s_car_params = &default_car_params;
+    return input_log_record(path, PHYSICS_TICK_US, s_car_params);
+}
+
+bool game_replay_input(const char* path) {
+    if (!input_log_replay(path, PHYSICS_TICK_US)) {
+        return false;
+    }
+    s_car_params = input_log_params();
+    return true;
+}
+
+void game_set_frame_hook(game_frame_hook_t hook) {
+    s_frame_hook = hook;
+}
+
+bool game_use_input_sampler(void) {
+    s_use_sampler = input_sampler_start(INPUT_SAMPLER_PERIOD_US);
+    return s_use_sampler;
+}
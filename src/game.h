@@ -0,0 +1,79 @@
+#ifndef GAME_H
+#define GAME_H
+
+#include <stdbool.h>
+#include "maps/map_types.h"
+
+/**
+ * @brief Game state machine (intro, map selection, driving, results)
+ *
+ * Independent of how the program is hosted: main.c runs it on the
+ * device, host/sim.c runs it headless against the bcm2835 stub.
+ */
+
+/**
+ * @brief Called after every frame sent to the display
+ */
+typedef void (*game_frame_hook_t)(void);
+
+/**
+ * @brief Load assets and warm caches (after fb_init())
+ */
+void game_init(void);
+
+/**
+ * @brief Run the state machine until game_stop() is called
+ */
+void game_run(void);
+
+/**
+ * @brief Ask game_run() to return (async-signal-safe)
+ */
+void game_stop(void);
+
+/**
+ * @brief Release assets and write profiler results
+ */
+void game_shutdown(void);
+
+/**
+ * @brief Record the input of every physics tick to a log
+ * @return false if the log could not be created
+ */
+bool game_record_input(const char* path);
+
+/**
+ * @brief Drive the game from a recorded log instead of the buttons
+ *
+ * Maps and physics parameters come from the log, key waits are skipped
+ * and game_run() returns when the log is exhausted.
+ * @return false if the log is missing or was made with another tick rate
+ */
+bool game_replay_input(const char* path);
+
+/**
+ * @brief Sample input on a background thread at about 1 kHz
+ *
+ * Taps shorter than a physics tick are caught, and keys act for the part
+ * of each tick they were held. Needs the monotonic clock, so it is not
+ * for the simulator's virtual time.
+ * @return false if the thread could not be started (per-tick polling stays)
+ */
+bool game_use_input_sampler(void);
+
+/**
+ * @brief Observe presented frames (NULL to remove)
+ */
+void game_set_frame_hook(game_frame_hook_t hook);
+
+/**
+ * @brief Car against obstacle narrow phase (an obstacle_grid_narrow_fn)
+ *
+ * Compares the pixel masks of the car and obstacle sprites in use. If the
+ * rotation cache cannot hold both, the hand-tuned hitboxes decide.
+ * @param ctx Car pose as const obb_t* (center and angle are used)
+ * @return true if the car touches the obstacle
+ */
+bool game_sprites_overlap(const obstacle_t* obs, void* ctx);
+
+#endif
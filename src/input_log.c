@@ -0,0 +1,263 @@
+#include "input_log.h"
+#include <stdio.h>
+#include <string.h>
+
+static FILE* s_file = NULL;
+static input_log_mode_t s_mode = INPUT_LOG_OFF;
+static input_log_header_t s_header;
+static car_physics_params_t s_params;
+static char s_io_buffer[4096];
+
+static uint8_t s_mask = 0;         // Mask of the current tick
+static uint32_t s_run = 0;         // Record: ticks under s_mask / replay: ticks left
+static int s_op = INPUT_LOG_OP_END; // Replay: opcode that follows the run (-1 = end of file)
+static bool s_in_session = false;
+
+static void params_to_header(const car_physics_params_t* p, int32_t* out) {
+    out[0] = p->max_speed_forward;
+    out[1] = p->max_speed_reverse;
+    out[2] = p->acceleration_rate;
+    out[3] = p->brake_deceleration;
+    out[4] = p->friction;
+    out[5] = p->turn_rate;
+    out[6] = p->min_speed_to_turn;
+}
+
+static void params_from_header(const int32_t* in, car_physics_params_t* p) {
+    p->max_speed_forward = in[0];
+    p->max_speed_reverse = in[1];
+    p->acceleration_rate = in[2];
+    p->brake_deceleration = in[3];
+    p->friction = in[4];
+    p->turn_rate = (int16_t)in[5];
+    p->min_speed_to_turn = in[6];
+}
+
+static void write_record(uint32_t run, uint8_t op) {
+    while (run >= 0x80) {
+        fputc((int)(run & 0x7F) | 0x80, s_file);
+        run >>= 7;
+    }
+    fputc((int)run, s_file);
+    fputc(op, s_file);
+}
+
+static void write_partial(uint32_t run, const input_tick_t* tick) {
+    write_record(run, INPUT_LOG_OP_PARTIAL);
+    fputc(tick->keys, s_file);
+    for (uint32_t i = 0; i < INPUT_KEY_COUNT; i++) {
+        if (tick->keys & (1u << i)) {
+            fputc(tick->weight[i] - 1, s_file);
+        }
+    }
+}
+
+// Payload of an INPUT_LOG_OP_PARTIAL record; false if it is cut short
+static bool read_partial(input_tick_t* tick) {
+    int keys = fgetc(s_file);
+    if (keys == EOF) return false;
+
+    tick->keys = (uint8_t)keys & INPUT_KEY_ANY;
+    for (uint32_t i = 0; i < INPUT_KEY_COUNT; i++) {
+        tick->weight[i] = 0;
+        if (tick->keys & (1u << i)) {
+            int weight = fgetc(s_file);
+            if (weight == EOF) return false;
+            tick->weight[i] = (uint16_t)(weight + 1);
+        }
+    }
+    return true;
+}
+
+// Returns the opcode, or -1 at end of file or on a damaged record
+static int read_record(uint32_t* run) {
+    uint32_t value = 0;
+    for (int shift = 0; shift < 32; shift += 7) {
+        int c = fgetc(s_file);
+        if (c == EOF) return -1;
+        value |= (uint32_t)(c & 0x7F) << shift;
+        if ((c & 0x80) == 0) {
+            *run = value;
+            c = fgetc(s_file);
+            return (c == EOF) ? -1 : c;
+        }
+    }
+    return -1;
+}
+
+bool input_log_record(const char* path, uint32_t tick_us, const car_physics_params_t* params) {
+    input_log_close();
+
+    s_file = fopen(path, "wb");
+    if (s_file == NULL) {
+        return false;
+    }
+    setvbuf(s_file, s_io_buffer, _IOFBF, sizeof(s_io_buffer));
+
+    memset(&s_header, 0, sizeof(s_header));
+    memcpy(s_header.magic, "RCIL", 4);
+    s_header.version = INPUT_LOG_VERSION;
+    s_header.tick_us = tick_us;
+    params_to_header(params, s_header.params);
+    fwrite(&s_header, sizeof(s_header), 1, s_file);
+
+    s_mode = INPUT_LOG_RECORD;
+    s_in_session = false;
+    return true;
+}
+
+bool input_log_replay(const char* path, uint32_t tick_us) {
+    input_log_close();
+
+    s_file = fopen(path, "rb");
+    if (s_file == NULL) {
+        return false;
+    }
+    setvbuf(s_file, s_io_buffer, _IOFBF, sizeof(s_io_buffer));
+
+    if (fread(&s_header, sizeof(s_header), 1, s_file) != 1 ||
+        memcmp(s_header.magic, "RCIL", 4) != 0 ||
+        s_header.version == 0 || s_header.version > INPUT_LOG_VERSION ||
+        s_header.tick_us != tick_us) {
+        fclose(s_file);
+        s_file = NULL;
+        return false;
+    }
+    params_from_header(s_header.params, &s_params);
+
+    s_mode = INPUT_LOG_REPLAY;
+    s_in_session = false;
+    s_op = INPUT_LOG_OP_END;
+    s_run = 0;
+    return true;
+}
+
+void input_log_close(void) {
+    if (s_file == NULL) {
+        return;
+    }
+
+    if (s_mode == INPUT_LOG_RECORD) {
+        input_log_end_session();
+        fseek(s_file, 0, SEEK_SET);
+        fwrite(&s_header, sizeof(s_header), 1, s_file);
+    }
+    fclose(s_file);
+    s_file = NULL;
+    s_mode = INPUT_LOG_OFF;
+}
+
+input_log_mode_t input_log_mode(void) {
+    return s_mode;
+}
+
+const car_physics_params_t* input_log_params(void) {
+    return &s_params;
+}
+
+void input_log_begin_session(uint8_t map) {
+    if (s_mode != INPUT_LOG_RECORD) return;
+
+    input_log_end_session();
+    write_record(0, (uint8_t)(INPUT_LOG_OP_SESSION + map));
+    s_header.session_count++;
+    s_mask = 0;
+    s_run = 0;
+    s_in_session = true;
+}
+
+void input_log_end_session(void) {
+    if (s_mode != INPUT_LOG_RECORD || !s_in_session) return;
+
+    write_record(s_run, INPUT_LOG_OP_END);
+    s_in_session = false;
+}
+
+void input_log_write_tick(const input_tick_t* tick) {
+    if (s_mode != INPUT_LOG_RECORD || !s_in_session) return;
+
+    uint8_t keys = tick->keys & INPUT_KEY_ANY;
+    for (uint32_t i = 0; i < INPUT_KEY_COUNT; i++) {
+        if ((keys & (1u << i)) && tick->weight[i] != INPUT_WEIGHT_FULL) {
+            write_partial(s_run, tick);
+            s_run = 0;
+            s_header.tick_count++;
+            return;
+        }
+    }
+
+    if (keys != s_mask) {
+        write_record(s_run, keys);
+        s_mask = keys;
+        s_run = 0;
+    }
+    s_run++;
+    s_header.tick_count++;
+}
+
+// Skip to the next session start; returns its opcode or -1 at the end
+static int find_session(void) {
+    for (;;) {
+        uint32_t run;
+        int op = read_record(&run);
+        if (op == INPUT_LOG_OP_PARTIAL) {
+            input_tick_t skipped;
+            if (!read_partial(&skipped)) return -1;
+        } else if (op < 0 || (op >= INPUT_LOG_OP_SESSION && op < INPUT_LOG_OP_PARTIAL)) {
+            return op;
+        }
+    }
+}
+
+bool input_log_has_session(void) {
+    if (s_mode != INPUT_LOG_REPLAY) return false;
+
+    long pos = ftell(s_file);
+    bool found = find_session() >= 0;
+    fseek(s_file, pos, SEEK_SET);
+    return found;
+}
+
+bool input_log_next_session(uint8_t* map) {
+    if (s_mode != INPUT_LOG_REPLAY) return false;
+
+    // Skip whatever the previous session left unread
+    int op = find_session();
+    if (op < 0) {
+        s_in_session = false;
+        return false;
+    }
+    *map = (uint8_t)(op - INPUT_LOG_OP_SESSION);
+
+    s_mask = 0;
+    s_op = read_record(&s_run);
+    s_in_session = true;
+    return true;
+}
+
+bool input_log_read_tick(input_tick_t* tick) {
+    if (s_mode != INPUT_LOG_REPLAY || !s_in_session) return false;
+
+    // Apply mask changes that are due now
+    while (s_run == 0) {
+        if (s_op == INPUT_LOG_OP_PARTIAL) {
+            // One tick of its own; the mask carries on after it
+            if (!read_partial(tick)) {
+                s_in_session = false;
+                return false;
+            }
+            s_op = read_record(&s_run);
+            return true;
+        }
+        if (s_op < 0 || s_op > (int)INPUT_KEY_ANY) {
+            s_in_session = false;
+            return false;
+        }
+        s_mask = (uint8_t)s_op;
+        s_op = read_record(&s_run);  // Run counts the ticks under the new mask
+    }
+
+    s_run--;
+    input_tick_from_keys(tick, s_mask);
+    return true;
+}
@@ -0,0 +1,117 @@
+#ifndef INPUT_LOG_H
+#define INPUT_LOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "game/car_physics.h"
+#include "input/input_snapshot.h"
+#include "input/input_sampler.h"
+
+/**
+ * @brief Input recording and replay
+ *
+ * A log holds the input bitmask of every physics tick, grouped into
+ * sessions (one per map played). Only changes are stored: each record is
+ * the number of ticks the previous mask was held (LEB128 varint) followed
+ * by an opcode byte, so a held key costs nothing and a typical session
+ * takes a few hundred bytes. Since the game consumes one mask per tick,
+ * a replay runs the same physics as the recording, bit for bit,
+ * regardless of frame timing.
+ *
+ * Ticks measured by the input sampler, where a key was held for only part
+ * of the tick, are stored one by one with their weights and do not
+ * change the mask of the ticks around them.
+ *
+ * Layout: input_log_header_t, then records. Opcodes:
+ *   0x00-0x3F  New input mask (INPUT_KEY_* bits) from this tick on
+ *   0x40+map   Session start on map_type_t `map` (mask resets to 0)
+ *   0x7E       One partial tick: key mask byte, then weight - 1 for each
+ *              key in the mask, lowest bit first (version 2)
+ *   0x7F       Session end
+ */
+
+#define INPUT_LOG_VERSION     2
+#define INPUT_LOG_PARAM_COUNT 7
+
+#define INPUT_LOG_OP_SESSION 0x40
+#define INPUT_LOG_OP_PARTIAL 0x7E
+#define INPUT_LOG_OP_END     0x7F
+
+// On-disk header (little-endian)
+typedef struct {
+    char magic[4];                            // "RCIL"
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t tick_us;                         // Physics tick period
+    uint32_t session_count;
+    uint32_t tick_count;
+    int32_t params[INPUT_LOG_PARAM_COUNT];    // car_physics_params_t, in field order
+} input_log_header_t;
+
+_Static_assert(sizeof(input_log_header_t) == 48, "input log header must be 48 bytes");
+
+typedef enum {
+    INPUT_LOG_OFF,
+    INPUT_LOG_RECORD,
+    INPUT_LOG_REPLAY
+} input_log_mode_t;
+
+/**
+ * @brief Start recording to a file
+ * @param params Physics parameters stored in the header
+ * @return false if the file could not be created
+ */
+bool input_log_record(const char* path, uint32_t tick_us, const car_physics_params_t* params);
+
+/**
+ * @brief Start replaying a file
+ * @return false if the file is missing, damaged, newer or has another tick period
+ */
+bool input_log_replay(const char* path, uint32_t tick_us);
+
+/**
+ * @brief Finish the log (recording: writes the end and the final header)
+ */
+void input_log_close(void);
+
+input_log_mode_t input_log_mode(void);
+
+/**
+ * @brief Physics parameters from the replayed log's header
+ */
+const car_physics_params_t* input_log_params(void);
+
+/**
+ * @brief Recording: mark the start of a session on a map
+ */
+void input_log_begin_session(uint8_t map);
+
+/**
+ * @brief Recording: close the current session
+ */
+void input_log_end_session(void);
+
+/**
+ * @brief Recording: store the input of one tick
+ */
+void input_log_write_tick(const input_tick_t* tick);
+
+/**
+ * @brief Replay: whether another session follows (without entering it)
+ */
+bool input_log_has_session(void);
+
+/**
+ * @brief Replay: enter the next session
+ * @param map Receives the session's map_type_t
+ * @return false when the log has no more sessions
+ */
+bool input_log_next_session(uint8_t* map);
+
+/**
+ * @brief Replay: input of the next tick
+ * @return false at the end of the session (tick unchanged)
+ */
+bool input_log_read_tick(input_tick_t* tick);
+
+#endif
@@ -1,4 +1,5 @@
 #include "easy_map.h"
+#include "../asset_pack.h"
 #include "../../assets/easy_map.h"
 
 #define EASY_START_X 198
@@ -7,7 +8,21 @@
 #define EASY_GOAL_Y  50
 #define EASY_GOAL_TOLERANCE 10
 
-static const map_config_t s_easy_map = {
+static obstacle_t s_easy_obstacles[] = {
+    {85, 55, 0, true},
+    {125, 65, 0, true},
+    {165, 55, 0, true},
+    {205, 55, 0, true},
+    {45, 165, 0, true},
+    {85, 165, 0, true},
+    {125, 165, 0, true},
+    {165, 155, 0, true}
+};
+
+#define EASY_OBSTACLE_COUNT (sizeof(s_easy_obstacles) / sizeof(s_easy_obstacles[0]))
+_Static_assert(EASY_OBSTACLE_COUNT <= MAP_MAX_OBSTACLES, "too many obstacles");
+
+static map_config_t s_easy_map = {
     .start_x = EASY_START_X,
     .start_y = EASY_START_Y,
     .goal_x = EASY_GOAL_X,
@@ -15,19 +30,12 @@ static const map_config_t s_easy_map = {
     .goal_width = EASY_GOAL_TOLERANCE * 2,
     .goal_height = EASY_GOAL_TOLERANCE * 2,
     .map_bitmap = &easy_map_240x240_bitmap,
-    .obstacles = {
-        {85, 55, 0, true},
-        {125, 65, 0, true},
-        {165, 55, 0, true},
-        {205, 55, 0, true},
-        {45, 165, 0, true},
-        {85, 165, 0, true},
-        {125, 165, 0, true},
-        {165, 155, 0, true}
-    },
-    .obstacle_count = 8
+    .obstacles = s_easy_obstacles,
+    .obstacle_count = EASY_OBSTACLE_COUNT
 };
 
 const map_config_t* get_easy_map_config(void) {
+    // Background from the asset pack when one is loaded
+    s_easy_map.map_bitmap = asset_pack_get("easy_map_240x240", &easy_map_240x240_bitmap);
     return &s_easy_map;
 }
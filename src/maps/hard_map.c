@@ -1,4 +1,5 @@
 #include "hard_map.h"
+#include "../asset_pack.h"
 #include "../../assets/hard_map.h"
 
 #define HARD_START_X 35
@@ -8,7 +9,20 @@
 #define HARD_GOAL_WIDTH  20
 #define HARD_GOAL_HEIGHT 20
 
-static const map_config_t s_hard_map = {
+static obstacle_t s_hard_obstacles[] = {
+    {30, 50, 0, true},
+    {75, 50, 0, true},
+    {75, 180, 0, true},
+    {205, 75, 90, true},
+    {145, 125, 60, true},
+    {205, 155, 90, true},
+    {205, 205, 90, true}
+};
+
+#define HARD_OBSTACLE_COUNT (sizeof(s_hard_obstacles) / sizeof(s_hard_obstacles[0]))
+_Static_assert(HARD_OBSTACLE_COUNT <= MAP_MAX_OBSTACLES, "too many obstacles");
+
+static map_config_t s_hard_map = {
     .start_x = HARD_START_X,
     .start_y = HARD_START_Y,
     .goal_x = HARD_GOAL_X,
@@ -16,19 +30,12 @@ static const map_config_t s_hard_map = {
     .goal_width = HARD_GOAL_WIDTH,
     .goal_height = HARD_GOAL_HEIGHT,
     .map_bitmap = &hard_map_240x240_bitmap,
-    .obstacles = {
-        {30, 50, 0, true},
-        {75, 50, 0, true},
-        {75, 180, 0, true},
-        {205, 75, 90, true},
-        {145, 125, 60, true},
-        {205, 155, 90, true},
-        {205, 205, 90, true},
-        {0, 0, 0, false}
-    },
-    .obstacle_count = 7
+    .obstacles = s_hard_obstacles,
+    .obstacle_count = HARD_OBSTACLE_COUNT
 };
 
 const map_config_t* get_hard_map_config(void) {
+    // Background from the asset pack when one is loaded
+    s_hard_map.map_bitmap = asset_pack_get("hard_map_240x240", &hard_map_240x240_bitmap);
     return &s_hard_map;
 }
@@ -0,0 +1,77 @@
+#include "map_layer.h"
+#include <string.h>
+#include "lcd/bitmap_rle.h"
+#include "../asset_pack.h"
+#include "../../assets/obstacle.h"
+
+// Transparent color of the obstacle bitmap
+#define OBSTACLE_TRANSPARENT_COLOR 0x0000
+
+static uint16_t s_layer_pixels[ST7789_HEIGHT * ST7789_WIDTH];
+static const bitmap s_layer = {
+    .width = ST7789_WIDTH,
+    .height = ST7789_HEIGHT,
+    .bitmap = s_layer_pixels
+};
+
+// Active flags as one bit per obstacle
+#define ACTIVE_WORDS ((MAP_MAX_OBSTACLES + 31) / 32)
+
+static const map_config_t* s_built_map = NULL;
+static int s_built_count = 0;
+static uint32_t s_built_active[ACTIVE_WORDS];
+static uint32_t s_active[ACTIVE_WORDS];
+
+static void collect_active(const map_config_t* map, uint32_t* bits) {
+    memset(bits, 0, ACTIVE_WORDS * sizeof(uint32_t));
+    for (int i = 0; i < map->obstacle_count && i < MAP_MAX_OBSTACLES; i++) {
+        if (map->obstacles[i].active) {
+            bits[i >> 5] |= (1u << (i & 31));
+        }
+    }
+}
+
+static void build_layer(const map_config_t* map) {
+    const bitmap* bg = map->map_bitmap;
+
+    // Background may be compressed; areas it does not cover stay black
+    if (bg->width < ST7789_WIDTH || bg->height < ST7789_HEIGHT) {
+        memset(s_layer_pixels, 0, sizeof(s_layer_pixels));
+    }
+    if (bg->width <= ST7789_WIDTH && bg->height <= ST7789_HEIGHT) {
+        bitmap_decode(bg, s_layer_pixels, ST7789_WIDTH);
+    }
+
+    // Obstacles in map order, same z-order as drawing them on the frame buffer
+    const bitmap* obstacle = asset_pack_get_raw("obstacle_75x75", &obstacle_75x75_bitmap);
+    for (int i = 0; i < map->obstacle_count; i++) {
+        const obstacle_t* obs = &map->obstacles[i];
+        if (!obs->active) continue;
+        fb_render_rotated(s_layer_pixels, ST7789_WIDTH, ST7789_HEIGHT, obs->x, obs->y,
+                          obstacle, obs->angle, OBSTACLE_TRANSPARENT_COLOR);
+    }
+}
+
+bool map_layer_sync(const map_config_t* map) {
+    collect_active(map, s_active);
+    size_t words = ((size_t)map->obstacle_count + 31) / 32;
+    if (words > ACTIVE_WORDS) words = ACTIVE_WORDS;
+    if (map == s_built_map && map->obstacle_count == s_built_count &&
+        memcmp(s_active, s_built_active, words * sizeof(uint32_t)) == 0) {
+        return false;
+    }
+
+    build_layer(map);
+    s_built_map = map;
+    s_built_count = map->obstacle_count;
+    memcpy(s_built_active, s_active, sizeof(s_built_active));
+    return true;
+}
+
+void map_layer_invalidate(void) {
+    s_built_map = NULL;
+}
+
+const bitmap* map_layer_bitmap(void) {
+    return &s_layer;
+}
@@ -0,0 +1,35 @@
+#ifndef MAP_LAYER_H
+#define MAP_LAYER_H
+
+#include "map_types.h"
+
+/**
+ * @brief Static map layer: background with all active obstacles composited
+ *
+ * Obstacles never move, so the background and the active obstacles are
+ * drawn once into a cached 240x240 layer. Frames start from this layer
+ * (one block copy) and erase sprites by restoring regions of it.
+ *
+ * The layer remembers which map and which obstacle active flags it was
+ * built from (one bit per obstacle, up to MAP_MAX_OBSTACLES) and is
+ * rebuilt by map_layer_sync() when either changes.
+ */
+
+/**
+ * @brief Make sure the layer matches the map and its active obstacles
+ * @param map Current map
+ * @return true if the layer was rebuilt (callers must redraw everything)
+ */
+bool map_layer_sync(const map_config_t* map);
+
+/**
+ * @brief Force the next map_layer_sync() to rebuild the layer
+ */
+void map_layer_invalidate(void);
+
+/**
+ * @brief Get the composited layer (valid after map_layer_sync())
+ */
+const bitmap* map_layer_bitmap(void);
+
+#endif
@@ -17,7 +17,9 @@ typedef struct {
     bool active;
 } obstacle_t;
 
-#define MAX_OBSTACLES 8
+// Obstacles a map may have (sizes the static per-map pools: layer state,
+// hitboxes and the obstacle grid)
+#define MAP_MAX_OBSTACLES 1024
 
 typedef struct {
     int16_t start_x;
@@ -27,8 +29,8 @@ typedef struct {
     int16_t goal_width;
     int16_t goal_height;
     const bitmap* map_bitmap;
-    obstacle_t obstacles[MAX_OBSTACLES];
-    int obstacle_count;
+    obstacle_t* obstacles;       // Map's own array, obstacle_count entries
+    int obstacle_count;          // At most MAP_MAX_OBSTACLES
 } map_config_t;
 
 #endif
@@ -0,0 +1,337 @@
+#include "obstacle_grid.h"
+#include <stdio.h>
+#include <string.h>
+
+#define GRID_CELLS (OBSTACLE_GRID_COLS * OBSTACLE_GRID_ROWS)
+
+// Cell entries per obstacle the pool is sized for (a 35x55 hitbox covers
+// at most 4x4 cells at any angle; larger hitboxes fall back to testing
+// every obstacle)
+#define GRID_ENTRIES_PER_OBSTACLE 16
+#define GRID_MAX_ENTRIES (MAP_MAX_OBSTACLES * GRID_ENTRIES_PER_OBSTACLE)
+
+// Cell ranges are padded to whole SIMD steps with boxes far off the field
+#define GRID_MAX_PADDING (GRID_CELLS * (COLLISION_BATCH_LANES - 1))
+#define GRID_SOA_SIZE    (GRID_MAX_ENTRIES + GRID_MAX_PADDING)
+#define GRID_PAD_COORD   (-16000)
+#define GRID_PAD_INDEX   UINT16_MAX
+
+static const map_config_t* s_map = NULL;
+static int s_count = 0;
+
+// Obstacle hitboxes, with the pixel range each covers
+typedef struct {
+    obb_t obb;
+    int16_t min_x, min_y, max_x, max_y;
+} grid_hitbox_t;
+
+static grid_hitbox_t s_hitboxes[MAP_MAX_OBSTACLES];
+
+// Hitboxes per cell: entries s_cell_start[c] .. s_cell_start[c + 1] - 1,
+// cells in row-major order. An obstacle is stored in every cell it covers,
+// as structure-of-arrays so a cell is one batch test.
+static uint16_t s_cell_start[GRID_CELLS + 1];
+static uint16_t s_entry_obstacle[GRID_SOA_SIZE];
+static int16_t s_soa_cx[GRID_SOA_SIZE];
+static int16_t s_soa_cy[GRID_SOA_SIZE];
+static int16_t s_soa_half_w[GRID_SOA_SIZE];
+static int16_t s_soa_half_h[GRID_SOA_SIZE];
+static int16_t s_soa_angle[GRID_SOA_SIZE];
+static int16_t s_soa_cos[GRID_SOA_SIZE];
+static int16_t s_soa_sin[GRID_SOA_SIZE];
+static collision_soa_t s_soa = {
+    s_soa_cx, s_soa_cy, s_soa_half_w, s_soa_half_h, s_soa_angle, s_soa_cos, s_soa_sin, 0
+};
+static bool s_linear = false;
+static int s_last_tests = 0;
+
+// Coherence cache per entry (per obstacle without the grid): last
+// separating axis and the car travel until which it is known to be apart
+static collision_motion_t s_motion;
+static int32_t s_clear_until[GRID_SOA_SIZE];
+static uint8_t s_axis[GRID_SOA_SIZE];
+
+// Last query found nothing touching the car, active or not
+static bool s_last_clear = false;
+
+// A step longer than a cell leaves few gaps to reuse: such queries use
+// the plain tests and leave the cache as it is (entries it holds stay
+// valid, as travel keeps growing)
+#define GRID_JUMP_TRAVEL (OBSTACLE_GRID_CELL_SIZE * COLLISION_GAP_SCALE)
+static bool s_jumped = false;
+
+// Narrow phase of the running query (NULL: hitboxes decide)
+static obstacle_grid_narrow_fn s_narrow = NULL;
+static void* s_narrow_ctx = NULL;
+
+_Static_assert(MAP_MAX_OBSTACLES < GRID_PAD_INDEX, "entries hold 16-bit obstacle indices");
+_Static_assert(GRID_SOA_SIZE <= UINT16_MAX, "cell starts are 16-bit");
+
+typedef struct {
+    int x0, y0, x1, y1;   // Inclusive cell range
+} cell_range_t;
+
+static int cell_col(int x) {
+    if (x < 0) x = 0;
+    if (x >= ST7789_WIDTH) x = ST7789_WIDTH - 1;
+    return x / OBSTACLE_GRID_CELL_SIZE;
+}
+
+static int cell_row(int y) {
+    if (y < 0) y = 0;
+    if (y >= ST7789_HEIGHT) y = ST7789_HEIGHT - 1;
+    return y / OBSTACLE_GRID_CELL_SIZE;
+}
+
+// Cells covering a pixel range; anything off the field lands in the edge cells
+static cell_range_t cells_covering(int min_x, int min_y, int max_x, int max_y) {
+    cell_range_t r = {
+        cell_col(min_x), cell_row(min_y), cell_col(max_x), cell_row(max_y)
+    };
+    return r;
+}
+
+static cell_range_t hitbox_cells(const grid_hitbox_t* box) {
+    return cells_covering(box->min_x, box->min_y, box->max_x, box->max_y);
+}
+
+static int range_cells(const cell_range_t* r) {
+    return (r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+}
+
+static int padded(int n) {
+    return (n + COLLISION_BATCH_LANES - 1) / COLLISION_BATCH_LANES * COLLISION_BATCH_LANES;
+}
+
+static void fill_padding(const uint16_t* fill) {
+    static const obb_t far_box = { GRID_PAD_COORD, GRID_PAD_COORD, 0, 0, 0 };
+    for (int c = 0; c < GRID_CELLS; c++) {
+        for (int e = fill[c]; e < s_cell_start[c + 1]; e++) {
+            collision_soa_set(&s_soa, e, &far_box);
+            s_entry_obstacle[e] = GRID_PAD_INDEX;
+        }
+    }
+}
+
+// Counting sort of (cell, obstacle) pairs into the SoA
+static void bin_hitboxes(void) {
+    uint16_t counts[GRID_CELLS] = {0};
+    uint16_t fill[GRID_CELLS];
+
+    for (int i = 0; i < s_count; i++) {
+        cell_range_t r = hitbox_cells(&s_hitboxes[i]);
+        for (int cy = r.y0; cy <= r.y1; cy++) {
+            for (int cx = r.x0; cx <= r.x1; cx++) {
+                counts[cy * OBSTACLE_GRID_COLS + cx]++;
+            }
+        }
+    }
+    s_cell_start[0] = 0;
+    for (int c = 0; c < GRID_CELLS; c++) {
+        s_cell_start[c + 1] = (uint16_t)(s_cell_start[c] + padded(counts[c]));
+        fill[c] = s_cell_start[c];
+    }
+
+    for (int i = 0; i < s_count; i++) {
+        cell_range_t r = hitbox_cells(&s_hitboxes[i]);
+        for (int cy = r.y0; cy <= r.y1; cy++) {
+            for (int cx = r.x0; cx <= r.x1; cx++) {
+                int e = fill[cy * OBSTACLE_GRID_COLS + cx]++;
+                collision_soa_set(&s_soa, e, &s_hitboxes[i].obb);
+                s_entry_obstacle[e] = (uint16_t)i;
+            }
+        }
+    }
+    fill_padding(fill);
+    s_soa.count = s_cell_start[GRID_CELLS];
+}
+
+static void set_hitbox(grid_hitbox_t* box, const obstacle_t* obs,
+                       int16_t hitbox_w, int16_t hitbox_h) {
+    box->obb = (obb_t){
+        .cx = obs->x,
+        .cy = obs->y,
+        .half_w = hitbox_w / 2,
+        .half_h = hitbox_h / 2,
+        .angle = obs->angle
+    };
+    obb_get_extent(&box->obb, &box->min_x, &box->min_y, &box->max_x, &box->max_y);
+}
+
+void obstacle_grid_build(const map_config_t* map, int16_t hitbox_w, int16_t hitbox_h) {
+    s_map = map;
+    s_count = map->obstacle_count;
+    if (s_count > MAP_MAX_OBSTACLES) {
+        printf("obstacle_grid: %d obstacles, only the first %d are used\n",
+               s_count, MAP_MAX_OBSTACLES);
+        s_count = MAP_MAX_OBSTACLES;
+    }
+
+    int entries = 0;
+    for (int i = 0; i < s_count; i++) {
+        const obstacle_t* obs = &map->obstacles[i];
+        set_hitbox(&s_hitboxes[i], obs, hitbox_w, hitbox_h);
+        cell_range_t r = hitbox_cells(&s_hitboxes[i]);
+        entries += range_cells(&r);
+    }
+
+    // Pool too small for these hitboxes: test every obstacle instead
+    s_linear = (entries > GRID_MAX_ENTRIES);
+    if (!s_linear) {
+        bin_hitboxes();
+    }
+    collision_motion_reset(&s_motion);
+    s_last_clear = false;
+}
+
+// Every entry needs testing again; padding never does
+static void clear_coherence(void) {
+    int entries = s_linear ? s_count : s_soa.count;
+    for (int e = 0; e < entries; e++) {
+        bool pad = !s_linear && s_entry_obstacle[e] == GRID_PAD_INDEX;
+        s_clear_until[e] = pad ? INT32_MAX : 0;
+        s_axis[e] = 0;
+    }
+}
+
+// Entries first .. first + n - 1 not known to be apart from the car
+static uint32_t due_entries(int first, int n) {
+    uint32_t due = 0;
+    for (int k = 0; k < n; k++) {
+        if (s_motion.travel >= s_clear_until[first + k]) {
+            due |= 1u << k;
+        }
+    }
+    return due;
+}
+
+// Pixel ranges overlap (inclusive, like the SAT range test)
+static bool extent_overlaps(const grid_hitbox_t* box, int min_x, int min_y, int max_x, int max_y) {
+    return box->min_x <= max_x && box->max_x >= min_x &&
+           box->min_y <= max_y && box->max_y >= min_y;
+}
+
+// Obstacle i, whose hitbox the query touches, collides
+static bool confirm_hit(int i) {
+    const obstacle_t* obs = &s_map->obstacles[i];
+    return obs->active && (s_narrow == NULL || s_narrow(obs, s_narrow_ctx));
+}
+
+static bool collides_linear(const obb_t* obb, int min_x, int min_y, int max_x, int max_y) {
+    for (int i = 0; i < s_count; i++) {
+        const grid_hitbox_t* box = &s_hitboxes[i];
+        if (!extent_overlaps(box, min_x, min_y, max_x, max_y) || !due_entries(i, 1)) {
+            continue;
+        }
+        s_last_tests++;
+        if (s_jumped) {
+            if (!check_collision_obb_obb(obb, &box->obb)) continue;
+        } else {
+            int32_t gap;
+            if (!check_collision_obb_obb_gap(obb, &box->obb, &s_axis[i], &gap)) {
+                s_clear_until[i] = collision_clear_until(&s_motion, gap);
+                continue;
+            }
+        }
+        s_last_clear = false;
+        if (confirm_hit(i)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Hits in the mask that belong to active obstacles (not padding) and
+// pass the narrow phase
+static bool any_confirmed(int first, uint32_t hits) {
+    while (hits) {
+        int i = s_entry_obstacle[first + __builtin_ctz(hits)];
+        hits &= hits - 1;
+        if (i != GRID_PAD_INDEX && confirm_hit(i)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void remember_gaps(int first, uint32_t apart, const int32_t* gaps) {
+    while (apart) {
+        int k = __builtin_ctz(apart);
+        apart &= apart - 1;
+        s_clear_until[first + k] = collision_clear_until(&s_motion, gaps[k]);
+    }
+}
+
+static bool collides_in_cell(const obb_t* obb, int cell) {
+    int end = s_cell_start[cell + 1];
+    for (int e = s_cell_start[cell]; e < end; e += COLLISION_BATCH_MAX) {
+        int n = (end - e < COLLISION_BATCH_MAX) ? end - e : COLLISION_BATCH_MAX;
+        uint32_t hits;
+        if (s_jumped) {
+            s_last_tests += n;
+            hits = check_collision_obb_batch(obb, &s_soa, e, n);
+        } else {
+            uint32_t due = due_entries(e, n);
+            if (!due) continue;
+
+            int32_t gaps[COLLISION_BATCH_MAX];
+            s_last_tests += __builtin_popcount(due);
+            hits = check_collision_obb_batch_gaps(obb, &s_soa, e, n, due, gaps, &s_axis[e]);
+            remember_gaps(e, due & ~hits, gaps);
+        }
+        if (hits) {
+            s_last_clear = false;
+        }
+        if (any_confirmed(e, hits)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool obstacle_grid_collides(const obb_t* obb) {
+    return obstacle_grid_collides_narrow(obb, NULL, NULL);
+}
+
+bool obstacle_grid_collides_narrow(const obb_t* obb, obstacle_grid_narrow_fn narrow, void* ctx) {
+    s_last_tests = 0;
+    if (s_map == NULL || s_count == 0) return false;
+    s_narrow = narrow;
+    s_narrow_ctx = ctx;
+
+    // The car has not moved and nothing was touching it
+    collision_motion_result_t motion = collision_motion_update(&s_motion, obb);
+    if (motion == COLLISION_MOTION_RESET) {
+        clear_coherence();
+    } else if (motion == COLLISION_MOTION_STILL && s_last_clear) {
+        return false;
+    }
+    s_last_clear = true;
+    s_jumped = (s_motion.step > GRID_JUMP_TRAVEL);
+
+    int16_t min_x, min_y, max_x, max_y;
+    obb_get_extent(obb, &min_x, &min_y, &max_x, &max_y);
+    if (s_linear) {
+        return collides_linear(obb, min_x, min_y, max_x, max_y);
+    }
+
+    // Obstacles covering several cells are tested once per cell
+    cell_range_t r = cells_covering(min_x, min_y, max_x, max_y);
+    for (int cy = r.y0; cy <= r.y1; cy++) {
+        for (int cx = r.x0; cx <= r.x1; cx++) {
+            if (collides_in_cell(obb, cy * OBSTACLE_GRID_COLS + cx)) {
+                s_last_clear = false;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+const obb_t* obstacle_grid_hitbox(int i) {
+    return &s_hitboxes[i].obb;
+}
+
+int obstacle_grid_last_tests(void) {
+    return s_last_tests;
+}
@@ -0,0 +1,73 @@
+#ifndef OBSTACLE_GRID_H
+#define OBSTACLE_GRID_H
+
+#include "map_types.h"
+#include "game/collision.h"
+
+/**
+ * @brief Uniform grid over the play field for obstacle collision queries
+ *
+ * Obstacles never move, so their hitboxes are binned into fixed-size
+ * cells once when a map is loaded. A query only visits the cells the
+ * car's bounding box covers, so its cost depends on how crowded the area
+ * around the car is, not on how many obstacles the map has. Each cell's
+ * hitboxes are stored as structure-of-arrays and tested in one
+ * check_collision_obb_batch() call.
+ *
+ * Queries are temporally coherent: each entry remembers its last
+ * separating axis and how far the car may travel before it could touch
+ * it, and is skipped until then. A query at an unchanged pose with
+ * nothing near the car returns at once.
+ *
+ * Active flags are read from the map at query time; toggling an obstacle
+ * does not need a rebuild, moving one does.
+ */
+
+// Cell edge in pixels (8x8 cells over the 240x240 field)
+#define OBSTACLE_GRID_CELL_SIZE 30
+#define OBSTACLE_GRID_COLS      ((ST7789_WIDTH + OBSTACLE_GRID_CELL_SIZE - 1) / OBSTACLE_GRID_CELL_SIZE)
+#define OBSTACLE_GRID_ROWS      ((ST7789_HEIGHT + OBSTACLE_GRID_CELL_SIZE - 1) / OBSTACLE_GRID_CELL_SIZE)
+
+/**
+ * @brief Bin the map's obstacles into the grid
+ * @param map Map whose obstacles are indexed (kept for queries)
+ * @param hitbox_w, hitbox_h Obstacle hitbox at angle 0 (rotated with the obstacle)
+ */
+void obstacle_grid_build(const map_config_t* map, int16_t hitbox_w, int16_t hitbox_h);
+
+/**
+ * @brief Check an OBB against the active obstacles near it
+ * @return true if it collides with any (same result as testing all of them)
+ */
+bool obstacle_grid_collides(const obb_t* obb);
+
+/**
+ * @brief Narrow phase for obstacle_grid_collides_narrow()
+ * @param obs Active obstacle whose hitbox the query OBB touches
+ * @param ctx Caller context
+ * @return true if they really collide
+ */
+typedef bool (*obstacle_grid_narrow_fn)(const obstacle_t* obs, void* ctx);
+
+/**
+ * @brief obstacle_grid_collides() with a finer test after the hitboxes
+ *
+ * narrow only runs for obstacles whose hitbox collides, so the hitboxes
+ * must contain everything narrow can report.
+ * @param narrow Narrow phase (NULL: same as obstacle_grid_collides())
+ * @return true if narrow confirms a collision with any active obstacle
+ */
+bool obstacle_grid_collides_narrow(const obb_t* obb, obstacle_grid_narrow_fn narrow, void* ctx);
+
+/**
+ * @brief Hitbox of obstacle i as indexed by obstacle_grid_build()
+ */
+const obb_t* obstacle_grid_hitbox(int i);
+
+/**
+ * @brief Hitboxes tested in the last obstacle_grid_collides() (not
+ *        skipped by the coherence cache)
+ */
+int obstacle_grid_last_tests(void);
+
+#endif